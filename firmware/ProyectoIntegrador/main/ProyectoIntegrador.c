@@ -4,12 +4,93 @@
  *
  * PostureCare es un sistema de monitoreo de postura corporal que utiliza un
  * acelerómetro analógico ADXL335 para medir la inclinación del usuario y detectar malas posturas.
+ * Opcionalmente se puede agregar un MPU6050 por I2C (p. ej. en la espalda, con el ADXL335
+ * en el pecho): si se detecta al encender, cada sensor tiene su propia calibración y la
+ * inclinación que se evalúa es el promedio de la de ambos (middelware/posture_fusion).
  * Funcionamiento:
- * Calibración inicial de 3 segundos al encender el dispositivo.
- * Monitoreo continuo de la inclinación corporal.
+ * Calibración inicial de 3 segundos, que se guarda en NVS: en los siguientes
+ * encendidos se usa la guardada y el monitoreo empieza de inmediato, mientras
+ * se verifica en segundo plano que el sensor no haya derivado. Enviando 'K'
+ * desde el celular se recalibra.
+ * Monitoreo continuo de la inclinación corporal, con histéresis: una vez superado el
+ * umbral, la postura vuelve a ser correcta recién tras 0,5 s por debajo de un umbral menor.
  * Si la postura incorrecta se mantiene durante 3 segundos, se activa una advertencia(LED amarillo).
  * Si se mantiene durante más de 5 segundos, se activa una alerta (LED rojo).
- * Además, el sistema puede enviar los datos al celular vía Bluetooth en tiempo real.
+ * Además, el sistema puede enviar los datos al celular vía Bluetooth en tiempo real,
+ * como texto para la app Bluetooth Electronics o como trama binaria compacta
+ * (se selecciona enviando 'T' o 'B' desde el celular).
+ * Para consultar sólo el estado actual, sin suscribirse al envío continuo, la app lee
+ * la característica de estado (BLE_STATE_UUID): estado_ble_t, que se actualiza sólo
+ * cuando cambia y que el stack BLE responde sin intervención del programa.
+ * Las estadísticas de cada minuto (tiempo en cada estado, ángulo medio y máximo y
+ * cantidad de alertas) se guardan en un historial de 2 horas que persiste en NVS y
+ * que la app descarga de una vez enviando 'H'.
+ * Para ajustar los umbrales se pueden grabar las muestras crudas (400 Hz, mili-g)
+ * en la partición "muestras" de la flash: 'G' empieza una grabación, 'F' la
+ * termina y 'V' descarga todo lo grabado (unos 29 minutos) a la velocidad del enlace.
+ * La detección (filtros, calibración, inclinación y máquina de estados) está en
+ * middelware/posture_pipeline y sólo depende de las muestras y sus marcas temporales:
+ * 'Y' reproduce lo grabado en la placa a la velocidad de la CPU, y la grabación
+ * descargada se reproduce en la PC con benchmarks/host/posture_replay, con las mismas
+ * decisiones.
+ * Todas las muestras procesadas (100 Hz) se envían también a la PC por UART_PC
+ * a 921600 baudios como tramas del sumidero de telemetría (middelware/telemetry).
+ * Con CONFIG_MIDDELWARE_TASK_PROFILER (activado en sdkconfig.defaults) se agrega cada
+ * 5 segundos un informe de la carga de CPU y la pila libre de cada tarea y del heap
+ * mínimo (middelware/telemetry/task_profiler), para dimensionar las pilas.
+ * Al primer estado de postura válido se imprime en una línea la duración de cada
+ * etapa del arranque, desde el reset (ROM y bootloader) hasta esa decisión
+ * (middelware/telemetry/boot_trace). Los LEDs y el buzzer, la partición de
+ * muestras y el MPU6050 se inicializan en paralelo, cada uno en su tarea.
+ * La aplicación usa dos tareas: LeerAcelerometro, que corre el motor de postura con
+ * cada trama de los sensores, y Eventos, un único bucle que atiende en orden las
+ * muestras nuevas, los comandos de la app y el envío periódico por Bluetooth, y llama
+ * directamente al manejador de cada uno (ver evento_t).
+ * Para reducir el consumo, el ADC convierte por DMA (cada muestra del ADXL335 es el
+ * promedio de 4 conversiones) y la CPU sólo se despierta en cada trama, la frecuencia de la CPU baja cuando está ociosa (tickless idle y
+ * light sleep automático si ningún periférico lo impide) y, con la postura estable
+ * y el envío sólo de cambios, el enlace BLE usa intervalos largos. Las alertas no
+ * dependen del enlace, así que mantienen sus tiempos de 3 s y 5 s.
+ * Con el MPU6050 conectado, su detector de caída libre avisa las caídas por la salida INT
+ * (sin leer muestras): se informan por consola y, si hay conexión, por BLE.
+ * La frecuencia de muestreo de los sensores y el período de envío por BLE siguen al
+ * control de frecuencia (middelware/rate_controller): con el usuario quieto y la
+ * inclinación estable bajan un nivel cada TIEMPO_NIVEL_MUESTREO ms (ver frecuencias_ac,
+ * frecuencias_mpu y periodos_envio); cualquier movimiento, inclinación que varía o cambio
+ * de estado vuelve al primer nivel. El motor de postura sigue a FRECUENCIA_POSTURA.
+ * Con el ADXL335 como único sensor, tras TIEMPO_MONITOR_ADC ms en postura correcta sin
+ * nadie conectado por BLE las tramas DMA dejan de despertar a la CPU: el monitor digital
+ * del ADC vigila dos ejes con una ventana alrededor de la calibración y despierta al
+ * motor de postura sólo cuando la inclinación se acerca a UMBRAL_SALIDA (o al
+ * conectarse la app). Mientras tanto no se envían muestras por UART_PC ni se registran
+ * en el historial por minuto.
+ * Con el MPU6050 conectado, tras TIEMPO_VIGILANCIA ms en postura correcta sin nadie
+ * conectado por BLE el HP entra en deep sleep y la postura la vigila el núcleo LP
+ * (main/ulp/postura_lp.c): lee el MPU6050 por LP I2C cada PERIODO_VIGILANCIA ms, lo
+ * compara con la referencia calibrada y acumula el tiempo en mala postura con la misma
+ * máquina de estados. Despierta al HP cuando cambia el estado (el período de mala
+ * postura continúa, con los mismos tiempos de advertencia y alerta) y cada
+ * PERIODO_SINCRONIZACION ms, para que la app pueda conectarse y descargar el historial
+ * durante TIEMPO_VIGILANCIA ms. Mientras el HP duerme los LEDs están apagados y el
+ * historial por minuto no registra muestras.
+ * El historial y las referencias ajustadas quedan retenidos en la memoria RTC durante el
+ * deep sleep (retain_mcu): al despertar el HP sigue con ellos sin leer ni escribir la
+ * flash y sin volver a verificar la calibración; los filtros arrancan estables con la
+ * primera muestra. Tras cualquier otro reinicio se usa lo guardado en NVS.
+ * Con CONFIG_DRIVERS_ILI9341 (activado en sdkconfig.defaults) el estado se muestra también
+ * en un display ILI9341 (main/tablero.c): franja de estado, indicador de aguja con la
+ * inclinación, tiempo de sesión y gráfico de la inclinación media de cada minuto del
+ * historial. Una tarea de prioridad baja lo actualiza cada TABLERO_PERIODO_MS y sólo
+ * redibuja la aguja, los dígitos y la franja que cambiaron.
+ * Con CONFIG_DRIVERS_BLE_OTA (activado en sdkconfig.defaults) el firmware se actualiza
+ * por BLE con drivers/microcontroller/ble_ota.py: la imagen se graba en la otra
+ * partición OTA (ota_0/ota_1 de partitions.csv) mientras llega y el dispositivo se
+ * reinicia con ella. Con la tabla de particiones nueva hay que grabar una vez por USB.
+ * Las prioridades de las tareas, las de la aplicación y las de los drivers, salen de
+ * plan_tareas (rt_schedule_mcu.h): período, plazo y tiempo de ejecución estimado de cada
+ * una. Al arrancar se asignan por plazo (el muestreo por encima del procesamiento, de
+ * Bluetooth y del display) y se verifica que se cumplan todos los plazos; el perfil de
+ * tareas muestra la carga estimada de cada una junto a la medida.
  *
  * @section hardConn Hardware Connections
  *
@@ -22,7 +103,16 @@
  * | LED amarillo       | LED_2         | Indica advertencia (3s)                |
  * | LED rojo           |          | Indica mala postura (5s)               |
  * | Buzzer             | GPIO_x         | Alerta sonora                          |
+ * | MPU6050 SDA        | GPIO_6         | Bus I2C y LP I2C (opcional)            |
+ * | MPU6050 SCL        | GPIO_7         | Bus I2C y LP I2C (opcional)            |
+ * | MPU6050 INT        | GPIO_9         | Dato listo (opcional)                  |
  * | Bluetooth          | BLE int.       | Comunicación con celular               |
+ * | Display SCK        | GPIO_20        | ILI9341 (opcional)                     |
+ * | Display SDI/MOSI   | GPIO_21        | ILI9341 (opcional)                     |
+ * | Display SDO/MISO   | GPIO_22        | ILI9341 (opcional)                     |
+ * | Display CS         | GPIO_19        | ILI9341 (opcional)                     |
+ * | Display DC/RS      | GPIO_18        | ILI9341 (opcional)                     |
+ * | Display RESET      | GPIO_0         | ILI9341 (opcional)                     |
  *
  * @section changelog Changelog
  *
@@ -31,6 +121,36 @@
  * | 23/10/2025 | Integración con driver ADXL335                 |
  * | 22/10/2025 | Document creation		
  * | 12/11/2025 | Implementación completa con Bluetooth          |                         |
+ * | 14/10/2026 | Telemetría binaria de todas las muestras por UART |
+ * | 14/10/2026 | Telemetría de texto sin snprintf (text_format) |
+ * | 14/10/2026 | Indicadores con una sola escritura (LedsMask)  |
+ * | 14/10/2026 | Calibración persistente en NVS                 |
+ * | 14/10/2026 | Bajo consumo: ADC por DMA, DFS y BLE en reposo |
+ * | 14/10/2026 | Máquina de estados con histéresis, ajustable por BLE |
+ * | 14/10/2026 | Historial por minuto en NVS, envío completo con 'H' |
+ * | 14/10/2026 | Grabador de muestras crudas en flash, descarga con 'V' |
+ * | 14/10/2026 | Varios sensores (ADXL335 y MPU6050) con fusión de la inclinación |
+ * | 14/10/2026 | Sobremuestreo x4 del ADXL335 en el ADC          |
+ * | 15/10/2026 | Perfil de CPU, pila y heap por telemetría      |
+ * | 15/10/2026 | Tiempos del arranque e inicialización en paralelo |
+ * | 15/10/2026 | Detección en posture_pipeline, reproducción con 'Y' |
+ * | 15/10/2026 | Vigilancia en el núcleo LP con el HP en deep sleep |
+ * | 15/10/2026 | Vigilancia del ADXL335 con el monitor digital del ADC |
+ * | 15/10/2026 | Una sola tarea de eventos en lugar de tres tareas |
+ * | 15/10/2026 | Pilas de las tareas en memoria estática (opcional) |
+ * | 15/10/2026 | Ajuste continuo de la referencia en postura correcta y quieta |
+ * | 15/10/2026 | Corrección de escala, desalineación y sesgo de los ejes por trama |
+ * | 15/10/2026 | Rechazo de picos por mediana móvil en lugar de mediana de 3 |
+ * | 15/10/2026 | Sin advertencias al alcanzar algo o caminar (clasificador int8) |
+ * | 15/10/2026 | Perfil de muestreo reducido mientras el usuario está quieto |
+ * | 15/10/2026 | Caídas detectadas por el MPU6050 (interrupción de caída libre) |
+ * | 15/10/2026 | Control de frecuencia de muestreo y de envío por niveles |
+ * | 15/10/2026 | Mensajes de calibración diferidos (log_mcu), sin printf en LeerAcelerometro |
+ * | 15/10/2026 | Tablero en display ILI9341 que sólo redibuja lo que cambia |
+ * | 15/10/2026 | Actualización del firmware por BLE (OTA) |
+ * | 15/10/2026 | Característica BLE de lectura con el estado actual |
+ * | 15/10/2026 | Prioridades desde un plan de tareas con verificación de plazos |
+ * | 15/10/2026 | Historial y referencias retenidos en memoria RTC durante el deep sleep |
  *
  * @author
  * Anahí Chaves (natalia.chaves@ingenieria.uner.edu.ar)
@@ -40,25 +160,184 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "nvs.h"
 #include "led.h"
 #include "buzzer.h"
 #include "ble_mcu.h"
-#include "ADXL335.h"
+#include "i2c_mcu.h"
+#include "accel_sensor.h"
+#include "mpu6050.h"
+#include "power_mcu.h"
+#include "spsc_ring.h"
+#include "seqlock.h"
+#include "posture_math.h"
+#include "posture_engine.h"
+#include "posture_history.h"
+#include "posture_pipeline.h"
+#include "rate_controller.h"
+#include "sample_convert.h"
+#include "postura_actividad.h"     /* python activity_model.py postura --fs 100 */
+#include "axis_calibration.h"
+#include "uart_mcu.h"
+#include "rtos_alloc_mcu.h"
+#include "rt_schedule_mcu.h"
+#include "retain_mcu.h"
+#include "telemetry.h"
+#include "task_profiler.h"
+#include "text_format.h"
+#include "flash_log.h"
+#include "boot_trace.h"
+#include "log_mcu.h"
+#if CONFIG_DRIVERS_ILI9341
+#include "tablero.h"
+#endif
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+#include "esp_sleep.h"
+#include "driver/rtc_io.h"
+#include "ulp_lp_core.h"
+#include "lp_core_i2c.h"
+#include "ulp_postura.h"
+#include "ulp/postura_lp.h"
+#endif
 /*==================[macros and definitions]=================================*/
 /**
- * @def PERIODO_MUESTREO_AC
- * @brief Periodo de muestreo del acelerómetro en milisegundos
+ * @def FRECUENCIA_MUESTREO_AC
+ * @brief Frecuencia de muestreo del ADXL335 en Hz (se decima a FRECUENCIA_POSTURA)
  */
-#define PERIODO_MUESTREO_AC 1000 
+#define FRECUENCIA_MUESTREO_AC 400
+/**
+ * @def SOBREMUESTREO_AC
+ * @brief Conversiones del ADC promediadas por cada muestra del ADXL335 (reduce el ruido a la mitad)
+ */
+#define SOBREMUESTREO_AC 4
+/**
+ * @def FRECUENCIA_MUESTREO_MPU
+ * @brief Frecuencia de muestreo del MPU6050 en Hz (se decima a FRECUENCIA_POSTURA)
+ */
+#define FRECUENCIA_MUESTREO_MPU 200
+/**
+ * @def NIVELES_MUESTREO
+ * @brief Niveles del control de frecuencia de muestreo (ver frecuencias_ac)
+ */
+#define NIVELES_MUESTREO 3
+/**
+ * @def FRECUENCIA_POSTURA
+ * @brief Frecuencia en Hz de las muestras filtradas con las que se evalúa la postura
+ */
+#define FRECUENCIA_POSTURA 100
+/**
+ * @def PIN_INT_MPU
+ * @brief GPIO conectado a la salida INT del MPU6050
+ */
+#define PIN_INT_MPU GPIO_9
+/**
+ * @def SENSOR_PRINCIPAL
+ * @brief Sensor (ADXL335) cuyas muestras filtradas marcan el ritmo de la evaluación de la postura
+ */
+#define SENSOR_PRINCIPAL POSTURE_PIPELINE_MAIN
+/**
+ * @def LARGO_COLA_MUESTRAS
+ * @brief Cantidad de muestras que puede acumular la cola adquisición → procesamiento (potencia de 2)
+ */
+#define LARGO_COLA_MUESTRAS 32
+/**
+ * @def PERIODO_ENVIO_BLE
+ * @brief Periodo de envío de datos por Bluetooth en milisegundos
+ */
+#define PERIODO_ENVIO_BLE 100
+/**
+ * @def PERIODO_ENVIO_BLE_REPOSO
+ * @brief Periodo de envío de datos por Bluetooth en milisegundos mientras la postura está estable
+ */
+#define PERIODO_ENVIO_BLE_REPOSO 500
+/**
+ * @def TIEMPO_REPOSO_BLE
+ * @brief Tiempo en ms en postura correcta, sin cambios de estado, para pasar el enlace BLE a bajo consumo
+ */
+#define TIEMPO_REPOSO_BLE 10000
+/**
+ * @def TIEMPO_MONITOR_ADC
+ * @brief Tiempo en ms en postura correcta tras el cual el ADXL335 queda vigilado por el monitor del ADC
+ */
+#define TIEMPO_MONITOR_ADC 15000
+/**
+ * @def TIEMPO_NIVEL_MUESTREO
+ * @brief Tiempo en ms quieto y con la inclinación estable antes de bajar cada nivel de muestreo
+ */
+#define TIEMPO_NIVEL_MUESTREO 5000
+/**
+ * @def DISPERSION_RAPIDA
+ * @brief Dispersión de la inclinación (grados) que vuelve al primer nivel de muestreo
+ */
+#define DISPERSION_RAPIDA 2.0f
+/**
+ * @def DISPERSION_LENTA
+ * @brief Dispersión de la inclinación (grados) bajo la cual baja el nivel de muestreo
+ */
+#define DISPERSION_LENTA 0.5f
+/**
+ * @def SYNC_TRAMA
+ * @brief Byte de inicio de la trama binaria de telemetría
+ */
+#define SYNC_TRAMA 0xA5
+/**
+ * @def BANDA_MUERTA_ANGULO
+ * @brief Variación mínima del ángulo (grados) para enviar un dato nuevo en modo sólo cambios
+ */
+#define BANDA_MUERTA_ANGULO 1.0f
+/**
+ * @def PERIODO_HEARTBEAT
+ * @brief Tiempo máximo en ms sin enviar datos en modo sólo cambios
+ */
+#define PERIODO_HEARTBEAT 2000
+/**
+ * @def BAUDIOS_TELEMETRIA
+ * @brief Velocidad de UART_PC para la telemetría binaria
+ */
+#define BAUDIOS_TELEMETRIA 921600
+/**
+ * @def LARGO_COLA_TELEMETRIA
+ * @brief Registros que puede acumular la cola hacia el sumidero de telemetría (potencia de 2)
+ */
+#define LARGO_COLA_TELEMETRIA 32
+/**
+ * @def TIPO_MUESTRA_POSTURA
+ * @brief Tipo de registro de telemetría con una muestra procesada (muestra_telemetria_t)
+ */
+#define TIPO_MUESTRA_POSTURA 0x01
+/**
+ * @def TIPO_PERFIL_TAREAS
+ * @brief Tipo de registro de telemetría del resumen del perfil de tareas (las tareas usan el siguiente)
+ */
+#define TIPO_PERFIL_TAREAS 0x10
+/**
+ * @def PERIODO_PERFIL
+ * @brief Período del informe de carga de CPU y pila de las tareas en ms
+ */
+#define PERIODO_PERFIL 5000
 /**
  * @def UMBRAL_INCLINACION
  * @brief Umbral de inclinación en grados para considerar mala postura
- * @details Cualquier desviación mayor a este valor activa las alertas
+ * @details Cualquier desviación mayor a este valor inicia un período de mala postura
  */
 #define UMBRAL_INCLINACION 12.0f 
+/**
+ * @def UMBRAL_SALIDA
+ * @brief Umbral de inclinación en grados para volver a postura correcta (histéresis)
+ */
+#define UMBRAL_SALIDA 10.0f
+/**
+ * @def PERMANENCIA_MINIMA
+ * @brief Tiempo en ms bajo UMBRAL_SALIDA para dar por terminado un período de mala postura
+ */
+#define PERMANENCIA_MINIMA 500
 /**
  * @def TIEMPO_ADVERTENCIA
  * @brief Tiempo en ms para activar advertencia (LED amarillo)
@@ -74,6 +353,175 @@
  * @brief Tiempo en ms para la calibración inicial del acelerómetro
  */
 #define TIEMPO_CALIBRACION 3000  
+/**
+ * @def DISPERSION_MAXIMA
+ * @brief Dispersión máxima (g RMS) de las muestras para que una calibración se considere quieta
+ * @details Las calibraciones con más movimiento se usan pero no se guardan
+ */
+#define DISPERSION_MAXIMA 0.03f
+/**
+ * @def DERIVA_MAXIMA
+ * @brief Diferencia máxima (g) entre el módulo de la aceleración medida y el de la calibración guardada
+ * @details El módulo no depende de la postura, sólo de los offsets y ganancias del sensor
+ */
+#define DERIVA_MAXIMA 0.05f
+/**
+ * @def TASA_AJUSTE
+ * @brief Fracción de la diferencia con la referencia que se corrige en cada muestra de postura
+ * @details Sólo en postura correcta y quieta; con FRECUENCIA_POSTURA muestras por segundo la
+ * referencia sigue al usuario en unos 1 / (TASA_AJUSTE * FRECUENCIA_POSTURA) segundos. 0 lo desactiva.
+ */
+#define TASA_AJUSTE 0.002f
+/**
+ * @def TIEMPO_QUIETO_AJUSTE
+ * @brief Tiempo en ms que el usuario debe estar quieto antes de ajustar la referencia
+ */
+#define TIEMPO_QUIETO_AJUSTE 60000
+/**
+ * @def DISPERSION_AJUSTE
+ * @brief Dispersión máxima (g) de las muestras filtradas para considerar al usuario quieto
+ */
+#define DISPERSION_AJUSTE 0.02f
+/**
+ * @def INCLINACION_AJUSTE
+ * @brief Inclinación máxima (grados) respecto a la referencia para ajustarla
+ */
+#define INCLINACION_AJUSTE 3.0f
+/**
+ * @def CORRIMIENTO_AJUSTE
+ * @brief Ángulo máximo (grados) que el ajuste puede alejar la referencia de la calibración
+ * @details Más allá hace falta una calibración nueva
+ */
+#define CORRIMIENTO_AJUSTE 8.0f
+/**
+ * @def PERIODO_GUARDADO_AJUSTE
+ * @brief Tiempo mínimo en ms entre guardados en NVS de la referencia ajustada
+ */
+#define PERIODO_GUARDADO_AJUSTE (30 * 60 * 1000)
+/**
+ * @def VENTANA_PICOS
+ * @brief Muestras de la mediana móvil con la que se detectan los picos de cada eje
+ */
+#define VENTANA_PICOS 5
+/**
+ * @def UMBRAL_PICOS
+ * @brief Distancia máxima (g) de una muestra a la mediana: las más alejadas (golpes,
+ * errores de lectura) se reemplazan por la mediana
+ */
+#define UMBRAL_PICOS 0.3f
+/**
+ * @def UMBRAL_CAIDA
+ * @brief Aceleración en mg bajo la cual están los tres ejes del MPU6050 durante una caída libre
+ */
+#define UMBRAL_CAIDA 300
+/**
+ * @def DURACION_CAIDA
+ * @brief Tiempo en ms de caída libre para avisar una caída (unos 5 cm de altura)
+ */
+#define DURACION_CAIDA 100
+/**
+ * @def NVS_ESPACIO
+ * @brief Espacio de nombres NVS de PostureCare
+ */
+#define NVS_ESPACIO "posturecare"
+/**
+ * @def NVS_CLAVE_CALIBRACION
+ * @brief Clave NVS de la calibración (calibracion_nvs_t)
+ */
+#define NVS_CLAVE_CALIBRACION "calibracion"
+/**
+ * @def VERSION_CALIBRACION
+ * @brief Versión de calibracion_nvs_t, se incrementa al cambiar la estructura
+ */
+#define VERSION_CALIBRACION 2
+/**
+ * @def NVS_CLAVE_EJES
+ * @brief Clave NVS de la corrección de los ejes de cada sensor (ejes_nvs_t)
+ */
+#define NVS_CLAVE_EJES "ejes"
+/**
+ * @def NVS_CLAVE_HISTORIAL
+ * @brief Clave NVS del historial por minuto (posture_history_ring_t)
+ */
+#define NVS_CLAVE_HISTORIAL "historial"
+/**
+ * @def RETENIDO_HISTORIAL
+ * @brief Registro de la memoria RTC con el historial por minuto (posture_history_ring_t)
+ */
+#define RETENIDO_HISTORIAL 1
+/**
+ * @def RETENIDO_POSTURA
+ * @brief Registro de la memoria RTC con las referencias y la mala postura (posture_pipeline_state_t)
+ */
+#define RETENIDO_POSTURA 2
+/**
+ * @def PERIODO_GUARDADO_HISTORIAL
+ * @brief Cada cuántos minutos cerrados se guarda el historial en NVS
+ */
+#define PERIODO_GUARDADO_HISTORIAL 10
+/**
+ * @def SYNC_HISTORIAL
+ * @brief Byte de inicio de la cabecera del envío del historial
+ */
+#define SYNC_HISTORIAL 0xA6
+/**
+ * @def PARTICION_MUESTRAS
+ * @brief Etiqueta de la partición de la grabación de muestras crudas (partitions.csv)
+ */
+#define PARTICION_MUESTRAS "muestras"
+/**
+ * @def SENSOR_VIGILANCIA
+ * @brief Sensor que lee el núcleo LP mientras el HP duerme (el MPU6050, ver IniciarMpu6050())
+ */
+#define SENSOR_VIGILANCIA 1
+/**
+ * @def TIEMPO_VIGILANCIA
+ * @brief Tiempo en postura correcta sin conexión BLE tras el cual el HP se duerme y vigila
+ * el núcleo LP (ms); es también la ventana de sincronización al despertar
+ */
+#define TIEMPO_VIGILANCIA 30000
+/**
+ * @def PERIODO_VIGILANCIA
+ * @brief Período de muestreo del núcleo LP (ms)
+ */
+#define PERIODO_VIGILANCIA 100
+/**
+ * @def PERIODO_SINCRONIZACION
+ * @brief El núcleo LP despierta al HP cada este tiempo para sincronizar por BLE (ms)
+ */
+#define PERIODO_SINCRONIZACION 600000
+/**
+ * @def PILA_ADQUISICION
+ * @brief Pila de la tarea LeerAcelerometro (bytes, revisar el margen con el perfil de tareas)
+ */
+#define PILA_ADQUISICION 3072
+/**
+ * @def PILA_EVENTOS
+ * @brief Pila de la tarea Eventos (bytes)
+ */
+#define PILA_EVENTOS 4096
+/**
+ * @def PRIORIDAD_MINIMA
+ * @brief Prioridad más baja que asigna el plan de tareas
+ */
+#define PRIORIDAD_MINIMA 1
+/**
+ * @def PRIORIDAD_MAXIMA
+ * @brief Prioridad más alta que asigna el plan de tareas (debajo de las de ESP-IDF)
+ */
+#define PRIORIDAD_MAXIMA 12
+
+/**
+ * @def PIN_DC_DISPLAY
+ * @brief Pin DC/RS del display ILI9341 (GPIO_9, el del ejemplo, es la interrupción del MPU6050)
+ */
+#define PIN_DC_DISPLAY GPIO_18
+
+/**
+ * @def PIN_RST_DISPLAY
+ * @brief Pin RESET del display ILI9341
+ */
+#define PIN_RST_DISPLAY GPIO_0
 
 /**==================[internal data definition]===============================*/
 
@@ -89,266 +537,1583 @@ typedef struct
     float ay;
     float az;
     float angulo;
+    uint16_t angulo_cdeg; /**< Ángulo de inclinación (centésimas de grado) */
+    int64_t timestamp_us; /**< Instante de adquisición de la muestra (us) */
+    uint8_t estado;       /**< Estado de la postura después de la muestra */
+    uint32_t tiempo_mala_ms; /**< Duración del período de mala postura en curso (ms) */
+    bool calibrado;       /**< Hay calibración: el estado es una decisión válida */
+    activity_t actividad; /**< Actividad del usuario en la última ventana */
 } acelerometro_data_t;
 
-/** @brief Variable global con los últimos datos del acelerómetro */
-volatile acelerometro_data_t datos_acelerometro = {0};
+/**
+ * @brief Formato de los datos enviados por Bluetooth
+ */
+typedef enum
+{
+    TELEMETRIA_TEXTO,   /**< Texto para la app Bluetooth Electronics (compatibilidad) */
+    TELEMETRIA_BINARIA  /**< Trama binaria compacta trama_postura_t */
+} modo_telemetria_t;
+
+/**
+ * @struct trama_postura_t
+ * @brief Trama binaria de telemetría (16 bytes, entra en una sola notificación BLE)
+ *
+ * Los campos multibyte se envían en little-endian.
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t sync;           /**< SYNC_TRAMA */
+    uint8_t secuencia;      /**< Número de secuencia, permite detectar tramas perdidas */
+    uint32_t timestamp_ms;  /**< Instante de adquisición de la muestra (ms) */
+    int16_t ax_mg;          /**< Aceleración en X (mili-g) */
+    int16_t ay_mg;          /**< Aceleración en Y (mili-g) */
+    int16_t az_mg;          /**< Aceleración en Z (mili-g) */
+    int16_t angulo_cdeg;    /**< Ángulo de inclinación (centésimas de grado) */
+    uint8_t estado;         /**< Estado de la postura */
+    uint8_t checksum;       /**< XOR de todos los bytes anteriores */
+} trama_postura_t;
+
+/**
+ * @struct muestra_telemetria_t
+ * @brief Carga del registro TIPO_MUESTRA_POSTURA (13 bytes, little-endian)
+ */
+typedef struct __attribute__((packed))
+{
+    uint32_t timestamp_ms;  /**< Instante de adquisición de la muestra (ms) */
+    int16_t ax_mg;          /**< Aceleración en X (mili-g) */
+    int16_t ay_mg;          /**< Aceleración en Y (mili-g) */
+    int16_t az_mg;          /**< Aceleración en Z (mili-g) */
+    int16_t angulo_cdeg;    /**< Ángulo de inclinación (centésimas de grado) */
+    uint8_t estado;         /**< Estado de la postura */
+} muestra_telemetria_t;
+
+/**
+ * @struct estado_ble_t
+ * @brief Valor de la característica de estado (BLE_STATE_UUID, 5 bytes, little-endian)
+ *
+ * El ángulo va en grados enteros y el tiempo en segundos para que el valor cambie pocas
+ * veces por segundo aunque cambie cada muestra.
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t estado;         /**< Estado de la postura */
+    uint8_t calibrado;      /**< 1 si hay calibración (el estado es una decisión válida) */
+    uint8_t angulo_grados;  /**< Ángulo de inclinación (grados) */
+    uint16_t tiempo_mala_s; /**< Duración del período de mala postura en curso (s) */
+} estado_ble_t;
+
+/**
+ * @struct calibracion_nvs_t
+ * @brief Calibración guardada en NVS
+ */
+typedef struct
+{
+    uint8_t version;    /**< VERSION_CALIBRACION */
+    uint8_t sensores;   /**< Cantidad de sensores calibrados */
+    posture_calibration_t sensor[ACCEL_SENSOR_MAX]; /**< Postura de referencia y dispersión (calidad) de cada sensor */
+} calibracion_nvs_t;
+
+/**
+ * @struct ejes_nvs_t
+ * @brief Corrección de los ejes guardada en NVS (medida en fábrica, p. ej. en seis posiciones)
+ * @details Aceleración corregida = matriz · (aceleración medida - sesgo)
+ */
+typedef struct
+{
+    uint8_t sensores;                       /**< Cantidad de sensores con corrección */
+    float matriz[ACCEL_SENSOR_MAX][9];      /**< Escala y desalineación de cada sensor, por filas */
+    float sesgo[ACCEL_SENSOR_MAX][3];       /**< Sesgo de cada eje de cada sensor (g) */
+} ejes_nvs_t;
+_Static_assert(offsetof(accel_frame_t, z) == offsetof(accel_frame_t, x) + 2 * ACCEL_FRAME_LEN * sizeof(float),
+               "AxisCalibrationApplyBlock usa x, y y z de accel_frame_t como filas consecutivas");
+
+/**
+ * @struct muestra_cruda_t
+ * @brief Registro de la grabación en flash: una muestra sin filtrar (6 bytes, little-endian)
+ */
+typedef struct __attribute__((packed))
+{
+    int16_t ax_mg;          /**< Aceleración en X (mili-g) */
+    int16_t ay_mg;          /**< Aceleración en Y (mili-g) */
+    int16_t az_mg;          /**< Aceleración en Z (mili-g) */
+} muestra_cruda_t;
+
+/**
+ * @struct cabecera_historial_t
+ * @brief Cabecera del envío del historial, seguida de cantidad registros posture_minute_t
+ * (del más viejo al más nuevo, little-endian, agrupados en notificaciones de hasta el MTU)
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t sync;           /**< SYNC_HISTORIAL */
+    uint8_t largo_registro; /**< sizeof(posture_minute_t) */
+    uint16_t cantidad;      /**< Cantidad de registros que siguen */
+} cabecera_historial_t;
+
+/**
+ * @brief Política de envío de datos por Bluetooth
+ */
+typedef enum
+{
+    ENVIO_CONTINUO,     /**< Envía cada PERIODO_ENVIO_BLE ms */
+    ENVIO_SOLO_CAMBIOS  /**< Envía sólo si el ángulo supera la banda muerta, cambia el estado o vence el heartbeat */
+} politica_envio_t;
+
+/**
+ * @brief Eventos de la tarea Eventos (bits de su notificación, ver PublicarEvento())
+ */
+typedef enum
+{
+    EVENTO_MUESTRAS = (1 << 0),     /**< LeerAcelerometro publicó muestras en cola_muestras */
+    EVENTO_CALIBRACION = (1 << 1),  /**< Hay una calibración nueva para guardar en NVS */
+    EVENTO_HISTORIAL = (1 << 2),    /**< La app pidió el historial con 'H' */
+    EVENTO_GRABACION = (1 << 3),    /**< La app pidió la grabación de muestras crudas con 'V' */
+    EVENTO_REPRODUCCION = (1 << 4), /**< La app pidió reproducir la grabación con 'Y' */
+    EVENTO_CAIDA = (1 << 5),        /**< El MPU6050 detectó una caída libre */
+} evento_t;
+
+/**
+ * @brief Transferencia larga en curso, la tarea Eventos la avanza de a un bloque de la flash
+ */
+typedef enum
+{
+    TRABAJO_NINGUNO,        /**< Sin transferencia */
+    TRABAJO_GRABACION,      /**< Envío de la grabación (ver EnviarGrabacion()) */
+    TRABAJO_REPRODUCCION,   /**< Reproducción de la grabación (ver ReproducirGrabacion()) */
+} trabajo_t;
+
+/**
+ * @brief Estado de la reproducción de la grabación entre bloques
+ */
+typedef struct
+{
+    posture_pipeline_t motor;   /**< Motor de postura aparte, sin calibración */
+    float frecuencia;           /**< Frecuencia de muestreo del sensor principal (Hz) */
+    int64_t periodo_us;         /**< Período de muestreo (us) */
+    int64_t ultimo_us;          /**< Marca temporal de la última muestra, -1 al empezar */
+    int64_t desplazamiento_us;  /**< Corrimiento de las sesiones siguientes (la placa se reinició) */
+    int64_t proceso_us;         /**< Tiempo de proceso, sin contar la lectura de la flash */
+    uint32_t muestras;          /**< Muestras reproducidas */
+    uint32_t advertencias;      /**< Cambios a advertencia */
+    uint32_t alertas;           /**< Cambios a alerta */
+    posture_state_t estado;     /**< Estado de la última muestra */
+} reproduccion_t;
+
+/** @brief Política de envío activa, se cambia desde la app enviando 'C' (continuo) o 'D' (sólo cambios) */
+static volatile politica_envio_t politica_envio = ENVIO_SOLO_CAMBIOS;
+
+/** @brief Formato de telemetría activo, se cambia desde la app enviando 'B' (binario) o 'T' (texto) */
+static volatile modo_telemetria_t modo_telemetria = TELEMETRIA_TEXTO;
+
+/** @brief Cola sin bloqueo con todas las muestras, de LeerAcelerometro a la tarea Eventos */
+SPSC_RING_DEFINE(cola_muestras, acelerometro_data_t, LARGO_COLA_MUESTRAS);
+
+/** @brief Último dato del acelerómetro, para los lectores que sólo necesitan el valor más reciente */
+SEQLOCK_DEFINE(ultimo_dato, acelerometro_data_t);
+
+/** @brief Cola sin bloqueo de la tarea Eventos al sumidero de telemetría */
+SPSC_RING_DEFINE(cola_telemetria, telemetry_record_t, LARGO_COLA_TELEMETRIA);
+
+/**
+ * @brief Etapas del filtrado de cada eje: rechazo de picos (sólo se reemplazan las
+ * muestras alejadas de la mediana, el resto pasa sin cambios), pasa bajos de 5 Hz
+ * y decimación a FRECUENCIA_POSTURA (posture_pipeline elige el factor de cada sensor)
+ */
+static const filter_stage_config_t etapas_filtro[] = {
+    {.type = STAGE_SPIKE, .window = VENTANA_PICOS, .threshold = UMBRAL_PICOS},
+    {.type = STAGE_LOW_PASS, .cut_frec = 5.0f, .order = ORDER_2},
+    {.type = STAGE_DECIMATE, .factor = 4},
+};
+
+/** @brief Sensores detectados (índice en accel_sensor) */
+static int8_t sensores[ACCEL_SENSOR_MAX];
+/** @brief Cantidad de sensores detectados */
+static uint8_t cantidad_sensores = 0;
 
 /**@var posture_state 
  * @brief Estado actual de la postura
  * @details 0 = correcta, 1 = advertencia (3s), 2 = alerta (5s)
  */
-volatile uint8_t posture_state = 0;
+uint8_t posture_state = 0;
 
 /** @brief Tiempo acumulado en postura incorrecta (ms) */
-volatile uint32_t bad_posture_time = 0;
+uint32_t bad_posture_time = 0;
+
+/** @brief Filtrado, calibración, inclinación y máquina de estados; lo usa sólo LeerAcelerometro */
+static posture_pipeline_t postura;
+
+/** @brief Control de la frecuencia de muestreo; lo usa sólo LeerAcelerometro */
+static rate_controller_t control_frecuencia;
+
+/** @brief Configuración del control de frecuencia (dispersión de la inclinación en 1 s) */
+static const rate_controller_config_t config_frecuencia = {
+    .levels = NIVELES_MUESTREO,
+    .alpha = 1.0f / FRECUENCIA_POSTURA,
+    .fast_std_deg = DISPERSION_RAPIDA,
+    .slow_std_deg = DISPERSION_LENTA,
+    .hold_ms = TIEMPO_NIVEL_MUESTREO,
+};
+
+/** @brief Frecuencia de muestreo del ADXL335 de cada nivel (Hz, múltiplos de FRECUENCIA_POSTURA) */
+static const uint16_t frecuencias_ac[NIVELES_MUESTREO] = {FRECUENCIA_MUESTREO_AC, 200, 100};
 
-/* Variables de calibración */
-static float base_x = 0, base_y = 0, base_z = 0;
+/** @brief Frecuencia de muestreo del MPU6050 de cada nivel (Hz, múltiplos de FRECUENCIA_POSTURA) */
+static const uint16_t frecuencias_mpu[NIVELES_MUESTREO] = {FRECUENCIA_MUESTREO_MPU, 100, 100};
 
+/** @brief Período de envío por BLE de cada nivel (ms) */
+static const uint16_t periodos_envio[NIVELES_MUESTREO] = {PERIODO_ENVIO_BLE, 200, PERIODO_ENVIO_BLE_REPOSO};
+
+/** @brief Nivel de muestreo aplicado a los sensores, lo fija LeerAcelerometro */
+static volatile uint8_t nivel_muestreo = 0;
+
+/** @brief Configuración pedida desde la app, la mantiene AjusteBle */
+static posture_engine_config_t config_pedida = {
+    .enter_cdeg = (uint16_t)(UMBRAL_INCLINACION * 100),
+    .exit_cdeg = (uint16_t)(UMBRAL_SALIDA * 100),
+    .dwell_ms = PERMANENCIA_MINIMA,
+    .warning_ms = TIEMPO_ADVERTENCIA,
+    .alert_ms = TIEMPO_ALERTA,
+};
+
+/** @brief Configuración del motor de postura (la máquina de estados parte de config_pedida) */
+static posture_pipeline_config_t config_motor = {
+    .stages = etapas_filtro,
+    .n_stages = sizeof(etapas_filtro) / sizeof(etapas_filtro[0]),
+    .output_frec = FRECUENCIA_POSTURA,
+    .threshold_deg = UMBRAL_INCLINACION,
+    .calibration_ms = TIEMPO_CALIBRACION,
+    .max_dispersion = DISPERSION_MAXIMA,
+    .max_drift = DERIVA_MAXIMA,
+    .refine_rate = TASA_AJUSTE,
+    .refine_hold_ms = TIEMPO_QUIETO_AJUSTE,
+    .refine_max_std = DISPERSION_AJUSTE,
+    .refine_max_tilt_deg = INCLINACION_AJUSTE,
+    .refine_max_deg = CORRIMIENTO_AJUSTE,
+    .activity_model = &postura_actividad,
+};
+
+/** @brief Configuración nueva para LeerAcelerometro, publicada por AjusteBle */
+SEQLOCK_DEFINE(config_postura, posture_engine_config_t);
+
+/** @brief Hay una configuración nueva en config_postura */
+static volatile bool config_postura_nueva = false;
+
+/** @brief Estadísticas por minuto, las agrega, guarda y envía sólo la tarea Eventos */
+static posture_history_t historial;
+/** @brief Bloque de la grabación leído de la flash (lo usa sólo la tarea Eventos) */
+static uint8_t bloque_flash[FLASH_LOG_BLOCK_SIZE];
+/** @brief Transferencia larga en curso (la avanza la tarea Eventos) */
+static volatile trabajo_t trabajo = TRABAJO_NINGUNO;
+/** @brief Próximo bloque de la flash del trabajo en curso */
+static uint32_t bloque_trabajo = 0;
+/** @brief Reproducción de la grabación en curso */
+static reproduccion_t reproduccion;
+
+/** @brief Calibración en uso (cargada de NVS o medida) */
+static calibracion_nvs_t calibracion;
+/** @brief Corrección de los ejes de cada sensor (identidad si no hay una en NVS) */
+static axis_calibration_t correccion_ejes[ACCEL_SENSOR_MAX];
+/** @brief Hay corrección de los ejes en NVS */
+static bool corregir_ejes = false;
+/** @brief Recalibración pedida desde la app con 'K' */
+static volatile bool pedido_calibracion = false;
+/** @brief Tarea de adquisición, notificada por el timer de muestreo */
+TaskHandle_t adquisicion_task_handle = NULL;
+/** @brief Tarea Eventos: procesamiento, indicadores, Bluetooth y NVS */
+TaskHandle_t eventos_task_handle = NULL;
+/** @brief Pilas de las tareas (estáticas con CONFIG_DRIVERS_STATIC_ALLOCATION) */
+TASK_STORAGE_DEFINE(pila_adquisicion, PILA_ADQUISICION);
+TASK_STORAGE_DEFINE(pila_eventos, PILA_EVENTOS);
+/** @brief Tareas del plan (índices de plan_tareas) */
+enum
+{
+    TAREA_MPU6050,
+    TAREA_ADQUISICION,
+    TAREA_EVENTOS,
+    TAREA_TELEMETRIA,
+    TAREA_LOG,
+    TAREA_BLE_LECTURA,
+    TAREA_BLE_EVENTOS,
+    TAREA_TABLERO,
+    TAREA_GRABACION,
+    TAREA_PERFIL,
+    CANTIDAD_TAREAS
+};
 /**
- * @var calibrado
- * @brief Indica si el sistema completó la calibración inicial
+ * @brief Plan de tareas: período (o intervalo mínimo entre activaciones), plazo y tiempo
+ * de ejecución estimado de cada una, en us. RtScheduleInit asigna las prioridades por
+ * plazo y verifica que se cumplan; las estimaciones se revisan con el perfil de tareas.
  */
-static bool calibrado = false;
-TaskHandle_t ble_task_handle = NULL;
+static rt_task_t plan_tareas[CANTIDAD_TAREAS] = {
+    // Vaciado de la FIFO del MPU6050 (20 por segundo), antes de la trama siguiente del ADXL335
+    [TAREA_MPU6050] = {.name = "mpu6050", .period_us = 50000, .deadline_us = 2000, .wcet_us = 500},
+    // Tramas DMA del ADXL335 cada ~13 ms y del MPU6050: motor de postura por trama
+    [TAREA_ADQUISICION] = {.name = "LeerAcelerometro", .period_us = 10000, .deadline_us = 5000, .wcet_us = 2000},
+    // Muestras nuevas de LeerAcelerometro, indicadores, historial y envíos por Bluetooth
+    [TAREA_EVENTOS] = {.name = "Eventos", .period_us = 10000, .wcet_us = 1500},
+    [TAREA_TELEMETRIA] = {.name = "Telemetry", .period_us = 20000, .wcet_us = 500},
+    [TAREA_LOG] = {.name = "LogDefer", .period_us = 20000, .wcet_us = 500},
+    // Comandos de la app y eventos del enlace, a lo sumo uno por intervalo de conexión
+    [TAREA_BLE_LECTURA] = {.name = "read", .period_us = 30000, .wcet_us = 300},
+    [TAREA_BLE_EVENTOS] = {.name = "bluetooth_events", .period_us = 30000, .wcet_us = 500},
+    // Cada TABLERO_PERIODO_MS; sin CONFIG_DRIVERS_ILI9341 la tarea no se crea y su carga queda como margen
+    [TAREA_TABLERO] = {.name = "Tablero", .period_us = 200000, .wcet_us = 25000},
+    // Borrado y escritura de un bloque de la grabación
+    [TAREA_GRABACION] = {.name = "flash_log", .period_us = 1000000, .wcet_us = 50000},
+    [TAREA_PERFIL] = {.name = "TaskProfiler", .period_us = PERIODO_PERFIL * 1000, .wcet_us = 5000},
+};
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+/** @brief Programa de vigilancia del núcleo LP */
+extern const uint8_t postura_lp_inicio[] asm("_binary_ulp_postura_bin_start");
+extern const uint8_t postura_lp_fin[] asm("_binary_ulp_postura_bin_end");
+/** @brief Resultados de la vigilancia del núcleo LP, si el HP despertó de ella */
+static vigilancia_lp_t resultado_vigilancia;
+/** @brief El HP despertó de la vigilancia del núcleo LP */
+static bool despertado_por_lp = false;
+#endif
 
 
 /*==================[internal functions declaration]=========================*/
 
 /**
- * @brief Calcula el ángulo de inclinación a partir de los valores del acelerómetro.
- * Utiliza el producto punto entre el vector de aceleración actual y el vector
- * de referencia (calibrado) para determinar el ángulo de desviación.
- * @param ax Aceleración en eje X
- * @param ay Aceleración en eje Y
- * @param az Aceleración en eje Z
- * @return Ángulo de inclinación en grados
+ * @brief Convierte un valor a entero con saturación al rango de int16_t.
+ * @param valor Valor ya escalado
+ * @return Valor redondeado y saturado
+ */
+static int16_t SaturarInt16(float valor)
+{
+    if (valor > INT16_MAX)
+        return INT16_MAX;
+    if (valor < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t)lrintf(valor);
+}
+
+/**
+ * @brief Publica un evento para la tarea Eventos (desde cualquier tarea, no bloquea).
+ * @param evento Evento (los repetidos antes de ser atendidos se atienden una vez)
+ */
+static void PublicarEvento(evento_t evento)
+{
+    if (eventos_task_handle != NULL)
+        xTaskNotify(eventos_task_handle, evento, eSetBits);
+}
+
+/**
+ * @brief Lee un dato guardado en NVS.
+ * @param clave Clave del dato en NVS_ESPACIO
+ * @param dato Dato leído
+ * @param largo Tamaño del dato (bytes)
+ * @return true si el dato existe y tiene el tamaño esperado
  */
-static float CalcularAnguloDesviacion(float ax, float ay, float az)
+static bool LeerNvs(const char *clave, void *dato, size_t largo)
 {
-    //Producto punto entre vector actual y vector de referencia
-    float dot = (ax * base_x) + (ay * base_y) + (az * base_z);
-    //Magnitud de ambos vectores
-    float mag_base = sqrtf(base_x * base_x + base_y * base_y + base_z * base_z);
-    float mag_actual = sqrtf(ax * ax + ay * ay + az * az);
-    //Coseno del ángulo entre ambos vectores
-    float cos_theta = dot / (mag_base * mag_actual);
+    nvs_handle_t nvs;
+    size_t largo_leido = largo;
+    esp_err_t err;
 
-    // Evitar valores fuera de rango [-1,1] por errores de redondeo
-    if (cos_theta > 1.0f)
-        cos_theta = 1.0f;
-    if (cos_theta < -1.0f)
-        cos_theta = -1.0f;
-    //Convertir de rad a grados
-    return acosf(cos_theta) * (180.0f / 3.14159f);
+    if (nvs_open(NVS_ESPACIO, NVS_READONLY, &nvs) != ESP_OK)
+        return false;
+    err = nvs_get_blob(nvs, clave, dato, &largo_leido);
+    nvs_close(nvs);
+    return (err == ESP_OK) && (largo_leido == largo);
 }
 
 /**
- * @brief Aplica un filtro de promedio para suavizar las lecturas.
- * Reduce el ruido en las mediciones del acelerómetro.
- * @param nuevo Valor nuevo leído del acelerómetro
- * @param previo Valor previo filtrado
- * @return valor filtrado
+ * @brief Guarda un dato en NVS.
+ * 
+ * Escribir la flash demora varios ms, por eso se llama desde la tarea Eventos
+ * y no desde la de adquisición.
+ * @param clave Clave del dato en NVS_ESPACIO
+ * @param dato Dato a guardar
+ * @param largo Tamaño del dato (bytes)
  */
-static float FiltroSuavizado(float nuevo, float previo)
+static void EscribirNvs(const char *clave, const void *dato, size_t largo)
 {
-    return (0.8f * previo) + (0.2f * nuevo); // promedio móvil simple
+    nvs_handle_t nvs;
+
+    if (nvs_open(NVS_ESPACIO, NVS_READWRITE, &nvs) != ESP_OK)
+        return;
+    if (nvs_set_blob(nvs, clave, dato, largo) == ESP_OK)
+        nvs_commit(nvs);
+    nvs_close(nvs);
 }
 
 /**
- * @brief Tarea que lee el acelerómetro periódicamente.
+ * @brief Lee la calibración guardada en NVS.
+ * @param cal Calibración leída
+ * @return true si hay una calibración válida de la versión actual
+ */
+static bool CargarCalibracion(calibracion_nvs_t *cal)
+{
+    return LeerNvs(NVS_CLAVE_CALIBRACION, cal, sizeof(*cal)) && (cal->version == VERSION_CALIBRACION) &&
+           (cal->sensores == cantidad_sensores);
+}
+
+/**
+ * @brief Aplica una calibración medida por el motor de postura (middelware/posture_pipeline).
  *
- * Esta tarea se ejecuta cada PERIODO_MUESTREO_AC milisegundos.
- * Realiza las siguientes acciones: 
-  1. Lee los valores ax, ay, az del acelerómetro.
-  2. Aplica un filtro de suavizado.
-  3. Durante los primeros TIEMPO_CALIBRACION ms, acumula las lecturas para
-     calcular la calibración.
-  4. Después de la calibración, calcula el ángulo de inclinación continuamente.  la posición base.
+ * Sin referencia, la medida pasa a ser la referencia (y se guarda si es quieta).
+ * Con la referencia de NVS, sólo hay calibración nueva si el usuario estuvo quieto y el
+ * módulo de algún sensor cambió más de DERIVA_MAXIMA (cambiaron sus offsets).
+ * Un sensor sin muestras en el período (p. ej. desconectado) queda sin calibrar y no
+ * participa de la fusión.
+ * La referencia ajustada en postura correcta y quieta (medida->refined) se guarda a lo sumo
+ * cada PERIODO_GUARDADO_AJUSTE ms, para no gastar la flash.
+ * @param medida Calibración medida
  */
-void LeerAcelerometro(void *pvParameter)
+static void AplicarCalibracion(const posture_cal_result_t *medida)
 {
-    float suma_x = 0, suma_y = 0, suma_z = 0;
-    uint16_t muestras = 0;
+    static int64_t guardado_us = 0;
+    int64_t ahora_us = esp_timer_get_time();
+
+    if (medida->refined && (guardado_us != 0) && (ahora_us - guardado_us < PERIODO_GUARDADO_AJUSTE * 1000LL))
+        return;
+    if (medida->drift > 0)
+        LOG_DEFER("Deriva de %.3f g respecto a la calibración guardada, recalibrando\r\n", medida->drift);
+    calibracion.version = VERSION_CALIBRACION;
+    calibracion.sensores = cantidad_sensores;
+    for (uint8_t s = 0; s < cantidad_sensores; s++)
+    {
+        if (!medida->measured[s])
+        {
+            LOG_DEFER("Sensor %u sin muestras, queda sin calibrar\r\n", s);
+            continue;
+        }
+        calibracion.sensor[s] = medida->sensor[s];
+        LOG_DEFER("✅ Calibracion sensor %u: X=%.2f Y=%.2f Z=%.2f (%.3f g RMS)\r\n", s,
+                  medida->sensor[s].base[0], medida->sensor[s].base[1], medida->sensor[s].base[2],
+                  medida->sensor[s].dispersion);
+    }
+    if (medida->refined)
+        LOG_DEFER("Referencia ajustada en postura correcta\r\n");
+    else
+        BootMark("calibracion");
+    if (medida->still)
+    {
+        guardado_us = ahora_us;
+        PublicarEvento(EVENTO_CALIBRACION);
+    }
+}
+
+/**
+ * @brief Publica las muestras filtradas del sensor principal, con la decisión de cada una,
+ * y las agrega al control de frecuencia.
+ * @param salida Muestras filtradas y decisiones
+ * @param cantidad Cantidad de muestras
+ * @param primer_nivel Mantener el primer nivel de muestreo (p. ej. mientras se graba)
+ */
+static void PublicarMuestras(const posture_output_t *salida, uint8_t cantidad, bool primer_nivel)
+{
+    acelerometro_data_t datos_acelerometro;
+
+    for (uint8_t k = 0; k < cantidad; k++)
+    {
+        // Sin calibración o con el usuario en movimiento no se baja la frecuencia
+        RateControllerAdd(&control_frecuencia, salida[k].angle_cdeg / 100.0f, salida[k].state,
+                          primer_nivel || !salida[k].calibrated || (salida[k].activity != ACTIVITY_STILL),
+                          salida[k].timestamp_us);
+        datos_acelerometro.ax = salida[k].x;
+        datos_acelerometro.ay = salida[k].y;
+        datos_acelerometro.az = salida[k].z;
+        datos_acelerometro.timestamp_us = salida[k].timestamp_us;
+        datos_acelerometro.angulo_cdeg = salida[k].angle_cdeg;
+        datos_acelerometro.angulo = salida[k].angle_cdeg / 100.0f;
+        datos_acelerometro.estado = salida[k].state;
+        datos_acelerometro.tiempo_mala_ms = salida[k].bad_ms;
+        datos_acelerometro.calibrado = salida[k].calibrated;
+        datos_acelerometro.actividad = salida[k].activity;
+        // Cola para el procesamiento y último valor para el resto
+        SpscRingPush(&cola_muestras, &datos_acelerometro);
+        SeqlockWrite(&ultimo_dato, &datos_acelerometro);
+    }
+}
+
+/**
+ * @brief Cambia la frecuencia de muestreo de todos los sensores y la del motor de postura.
+ *
+ * Se llama entre tramas: las muestras de la frecuencia anterior que el motor no terminó de
+ * filtrar se descartan (ver PosturePipelineSetSampleFrec()).
+ * @param nivel Nivel del control de frecuencia
+ */
+static void CambiarNivel(uint8_t nivel)
+{
+    uint16_t frecuencia;
+
+    for (uint8_t s = 0; s < cantidad_sensores; s++)
+    {
+        // El ADXL335 es siempre el sensor principal
+        frecuencia = (s == SENSOR_PRINCIPAL) ? frecuencias_ac[nivel] : frecuencias_mpu[nivel];
+        if (AccelSensorSetFrequency(sensores[s], frecuencia))
+            PosturePipelineSetSampleFrec(&postura, s, AccelSensorFrequency(sensores[s]));
+    }
+    nivel_muestreo = nivel;
+}
+
+/**
+ * @brief Deja el ADXL335 al monitor digital del ADC tras TIEMPO_MONITOR_ADC ms en postura correcta.
+ *
+ * Sólo con el ADXL335 como único sensor (con el MPU6050 vigila el núcleo LP), sin conexión
+ * BLE y sin grabación ni reproducción. Las ventanas (ver ADXL335Watch()) detectan
+ * cualquier inclinación de UMBRAL_SALIDA respecto a la calibración: el motor de postura
+ * vuelve a evaluar antes de que empiece un período de mala postura.
+ * @param inicio_us Comienzo de la postura correcta actual (-1: todavía no)
+ */
+static void VigilarConMonitor(int64_t *inicio_us)
+{
+    acelerometro_data_t dato;
+    flash_log_stats_t grabacion;
+    float banda;
+
+    SeqlockRead(&ultimo_dato, &dato);
+    if (!dato.calibrado || (dato.estado != 0) || (dato.tiempo_mala_ms > 0))
+    {
+        *inicio_us = -1;
+        return;
+    }
+    if (*inicio_us < 0)
+        *inicio_us = dato.timestamp_us;
+    if ((cantidad_sensores != 1) || ((dato.timestamp_us - *inicio_us) < (TIEMPO_MONITOR_ADC * 1000LL)))
+        return;
+    FlashLogGetStats(&grabacion);
+    if ((BleStatus() == BLE_CONNECTED) || grabacion.recording || (trabajo != TRABAJO_NINGUNO))
+        return;
+    // Cuerda de UMBRAL_SALIDA sobre la esfera de 1 g, vista por el eje más sensible
+    banda = 2.0f * sinf(postura.engine.config.exit_cdeg * (float)M_PI / 36000.0f) / sqrtf(6.0f);
+    if (AccelSensorWatch(sensores[SENSOR_PRINCIPAL], calibracion.sensor[SENSOR_PRINCIPAL].base, banda))
+        *inicio_us = -1;
+}
 
-    TickType_t start_time = xTaskGetTickCount();
+/**
+ * @brief Tarea que lee los acelerómetros y evalúa la postura.
+ *
+ * Cada sensor entrega sus muestras por lotes (tramas DMA del ADC o bloques de la FIFO
+ * del MPU6050) y esta tarea es despertada cuando cualquiera tiene muestras nuevas; en
+ * cada despertar se vacían todos los sensores, de modo que agregar un sensor no agrega
+ * despertares por muestra.
+ * Cada muestra pasa por el motor de postura (middelware/posture_pipeline): filtrado con
+ * la cadena etapas_filtro, calibración durante los primeros TIEMPO_CALIBRACION ms (y al
+ * recalibrar), inclinación respecto a la posición de referencia y máquina de estados.
+ * El motor sólo depende de las muestras y sus marcas temporales, así que las mismas
+ * muestras dan siempre las mismas decisiones (ver ReproducirGrabacion()).
+ * Las muestras filtradas del sensor principal se publican con su decisión.
+ * Cada trama se corrige entera (escala, desalineación y sesgo de los ejes) antes de usarla,
+ * si hay corrección en NVS.
+ * Si hay una grabación en curso, cada muestra del sensor principal se agrega también
+ * al registro en flash, ya corregida.
+ * Entre despertares aplica el nivel del control de frecuencia (ver CambiarNivel()); al
+ * empezar una grabación vuelve al primer nivel antes de grabar la primera trama y lo
+ * mantiene mientras se graba, para que la grabación tenga siempre FRECUENCIA_MUESTREO_AC.
+ * Con la postura correcta y estable la vigilancia pasa al monitor del ADC (ver
+ * VigilarConMonitor()) y la tarea duerme hasta que el ADXL335 se mueve.
+ */
+void LeerAcelerometro(void *pvParameter)
+{
+    static accel_frame_t trama;
+    static int16_t trama_mg[3][ACCEL_FRAME_LEN];
+    posture_output_t salida[POSTURE_PIPELINE_BLOCK];
+    posture_engine_config_t config;
+    posture_cal_result_t medida;
+    muestra_cruda_t cruda;
+    int64_t tiempo;
+    int64_t inicio_correcta_us = -1;
+    flash_log_stats_t grabacion;
+    bool publicadas;
+    uint8_t n;
 
     while (true)
-    {   //Leer valores del acelerometro
-        float ax = ReadXValue();
-        float ay = ReadYValue();
-        float az = ReadZValue();
-        // Aplicar filtro de suavizado
-        datos_acelerometro.ax = FiltroSuavizado(ax, datos_acelerometro.ax);
-        datos_acelerometro.ay = FiltroSuavizado(ay, datos_acelerometro.ay);
-        datos_acelerometro.az = FiltroSuavizado(az, datos_acelerometro.az);
-
-        // Calibración inicial
-        if (!calibrado)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        publicadas = false;
+        // Configuración nueva desde la app y recalibración pedida con 'K', entre muestras
+        if (config_postura_nueva)
         {
-            suma_x += datos_acelerometro.ax;
-            suma_y += datos_acelerometro.ay;
-            suma_z += datos_acelerometro.az;
-            muestras++;
-            //Verifica si terminó el tiempo de calibración
-            if ((xTaskGetTickCount() - start_time) >= pdMS_TO_TICKS(TIEMPO_CALIBRACION))
-            {   //Calcula los promerios como valores de referencia
-                base_x = suma_x / muestras;
-                base_y = suma_y / muestras;
-                base_z = suma_z / muestras;
-                calibrado = true;
-                printf("✅ Calibracion completa: X=%.2f Y=%.2f Z=%.2f\r\n", base_x, base_y, base_z);
+            config_postura_nueva = false;
+            SeqlockRead(&config_postura, &config);
+            PosturePipelineSetConfig(&postura, &config);
+        }
+        if (pedido_calibracion)
+        {
+            pedido_calibracion = false;
+            PosturePipelineRecalibrate(&postura);
+        }
+        FlashLogGetStats(&grabacion);
+        // Una grabación es siempre del primer nivel: al empezar se descartan las muestras de otra frecuencia
+        if (grabacion.recording && (nivel_muestreo != 0))
+        {
+            RateControllerReset(&control_frecuencia);
+            CambiarNivel(0);
+        }
+        for (uint8_t s = 0; s < cantidad_sensores; s++)
+        {
+            while (AccelSensorRead(sensores[s], &trama) > 0)
+            {
+                if (corregir_ejes)
+                    AxisCalibrationApplyBlock(&correccion_ejes[s], trama.x, trama.len, ACCEL_FRAME_LEN);
+                if (s == SENSOR_PRINCIPAL)
+                {   // Trama entera a mili-g para la grabación
+                    SampleConvertF32ToI16(trama.x, trama_mg[0], trama.len, 0.0f, 1000.0f);
+                    SampleConvertF32ToI16(trama.y, trama_mg[1], trama.len, 0.0f, 1000.0f);
+                    SampleConvertF32ToI16(trama.z, trama_mg[2], trama.len, 0.0f, 1000.0f);
+                }
+                for (uint16_t i = 0; i < trama.len; i++)
+                {
+                    tiempo = trama.first_us + (int64_t)i * trama.period_us;
+                    if ((s == SENSOR_PRINCIPAL) && grabacion.recording)
+                    {   // Grabación de la muestra sin filtrar (no bloquea, la escritura la hace otra tarea)
+                        cruda.ax_mg = trama_mg[0][i];
+                        cruda.ay_mg = trama_mg[1][i];
+                        cruda.az_mg = trama_mg[2][i];
+                        FlashLogAppend(&cruda, tiempo);
+                    }
+                    n = PosturePipelineAdd(&postura, s, trama.x[i], trama.y[i], trama.z[i], tiempo, salida);
+                    if (n > 0)
+                    {
+                        PublicarMuestras(salida, n, grabacion.recording);
+                        publicadas = true;
+                    }
+                }
             }
         }
-        else
-        {   // Calcular ángulo de desviación respecto a la posición de referencia.
-            datos_acelerometro.angulo = CalcularAnguloDesviacion(
-                datos_acelerometro.ax,
-                datos_acelerometro.ay,
-                datos_acelerometro.az);
+        if (PosturePipelineTakeCalibration(&postura, &medida))
+            AplicarCalibracion(&medida);
+        // Avisar a la tarea Eventos una vez por despertar
+        if (publicadas)
+        {
+            PublicarEvento(EVENTO_MUESTRAS);
+            if (RateControllerLevel(&control_frecuencia) != nivel_muestreo)
+                CambiarNivel(RateControllerLevel(&control_frecuencia));
+            VigilarConMonitor(&inicio_correcta_us);
         }
+    }
+}
 
-        // Espera hasta el siguiente periodo de muestreo.
-        vTaskDelay(1000 / PERIODO_MUESTREO_AC);
+/**
+ * @brief Muestra el estado de la postura en los LEDs y el buzzer.
+ *
+ * Estado 0 → LED verde encendido (postura correcta)
+ * Estado 1 → LED amarillo encendido (advertencia)
+ * Estado 2 → LED rojo encendido + buzzer (alerta)
+ * @param estado Estado de la postura
+ */
+static void MostrarEstado(uint8_t estado)
+{
+    switch (estado)
+    {
+    case 0: // Postura correcta
+        LedsMask(LED_1);
+        BuzzerOff();
+        break;
+    case 1: // Advertencia
+        LedsMask(LED_2);
+        BuzzerOff();
+        break;
+    case 2: // Alerta
+        LedsMask(LED_3);
+        BuzzerOn();
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Actualiza el estado de la postura y, si cambió, los indicadores.
+ * @param nuevo_estado Estado calculado (0 = correcta, 1 = advertencia, 2 = alerta)
+ */
+static void CambiarEstadoPostura(uint8_t nuevo_estado)
+{
+    if (nuevo_estado != posture_state)
+    {
+        posture_state = nuevo_estado;
+        MostrarEstado(nuevo_estado);
     }
 }
 
 /**
- * @brief Tarea que evalúa la postura del usuario en base al ángulo de inclinación.
+ * @brief Publica una muestra procesada en el sumidero de telemetría.
+ * Nunca bloquea: si la cola está llena la muestra se descarta y se contabiliza en el sumidero.
+ * @param datos Muestra procesada
+ */
+static void EnviarTelemetria(const acelerometro_data_t *datos)
+{
+    muestra_telemetria_t muestra = {
+        .timestamp_ms = (uint32_t)(datos->timestamp_us / 1000),
+        .ax_mg = SaturarInt16(datos->ax * 1000.0f),
+        .ay_mg = SaturarInt16(datos->ay * 1000.0f),
+        .az_mg = SaturarInt16(datos->az * 1000.0f),
+        .angulo_cdeg = SaturarInt16(datos->angulo * 100.0f),
+        .estado = posture_state,
+    };
+    TelemetryPush(&cola_telemetria, TIPO_MUESTRA_POSTURA, &muestra, sizeof(muestra));
+}
+
+/**
+ * @brief Atiende EVENTO_CAIDA: informa la caída por consola y, si hay conexión, por BLE.
+ */
+static void AtenderCaida(void)
+{
+    printf("Caída detectada por el MPU6050\r\n");
+    if (BleStatus() == BLE_CONNECTED)
+        BleSendString("*FCaida\n");
+}
+
+/**
+ * @brief Atiende EVENTO_MUESTRAS: actúa según las decisiones del motor de postura.
  *
- * Si el ángulo supera el umbral definido (UMBRAL_INCLINACION), se considera postura incorrecta.
- * Si se mantiene más de 3 s, cambia a estado de advertencia (LED amarillo).
+ * La evaluación la hace el motor de postura en LeerAcelerometro (middelware/posture_engine
+ * dentro de posture_pipeline): un período de mala postura empieza cuando el ángulo supera
+ * UMBRAL_INCLINACION y termina recién cuando el ángulo se mantiene PERMANENCIA_MINIMA ms
+ * por debajo de UMBRAL_SALIDA, de modo que el ruido cerca del umbral no reinicia los
+ * temporizadores.
+ * Si el período dura más de 3 s, cambia a estado de advertencia (LED amarillo).
  * Si supera 5 s, pasa a estado de alerta (LED rojo + buzzer).
- * Si vuelve a postura correcta, se reinicia el temporizador y el estado.
- * Se ejecuta cada PERIODO_MUESTREO_AC milisegundos.
+ * Procesa todas las muestras pendientes en la cola; el tiempo en mala postura se calcula
+ * a partir de las marcas temporales de las muestras y no de la cantidad de eventos. Los
+ * umbrales y tiempos se pueden cambiar desde la app (ver AjusteBle()).
+ * Cada muestra se agrega también al historial por minuto, que se guarda en NVS cada
+ * PERIODO_GUARDADO_HISTORIAL minutos, y actualiza la característica de estado (estado_ble_t).
  */
-void ProcesarPostura(void *pvParameter)
+static void AtenderMuestras(void)
 {
-    
-    while (true)
+    static bool arranque_medido = false;
+    acelerometro_data_t datos_acelerometro;
+
+    while (SpscRingPop(&cola_muestras, &datos_acelerometro))
     {
-        if (calibrado)
-        {   
-            // Verificar si el ángulo supera el umbral de inclinación
-            if (fabs(datos_acelerometro.angulo) > UMBRAL_INCLINACION)
-            {   //Acumula tiempo en mala postura
-                bad_posture_time += PERIODO_MUESTREO_AC;
-                
-                //Actualiza estado según el tiempo acumulado
-                if (bad_posture_time >= TIEMPO_ALERTA)
-                    posture_state = 2;
-                else if (bad_posture_time >= TIEMPO_ADVERTENCIA)
-                    posture_state = 1;
+        // Sin calibración (recalibrando) el estado es postura correcta
+        CambiarEstadoPostura(datos_acelerometro.estado);
+        bad_posture_time = datos_acelerometro.tiempo_mala_ms;
+#if CONFIG_DRIVERS_ILI9341
+        TableroActualizar(&(tablero_dato_t){
+            .angulo_cdeg = datos_acelerometro.angulo_cdeg,
+            .estado = datos_acelerometro.estado,
+            .calibrado = datos_acelerometro.calibrado,
+        });
+#endif
+        // Sólo los cambios llegan al stack BLE (BleSetState compara con el valor anterior)
+        BleSetState(&(estado_ble_t){
+            .estado = datos_acelerometro.estado,
+            .calibrado = datos_acelerometro.calibrado,
+            .angulo_grados = (datos_acelerometro.angulo_cdeg > 25500) ? 255 : (datos_acelerometro.angulo_cdeg / 100),
+            .tiempo_mala_s = (datos_acelerometro.tiempo_mala_ms > 65535000) ? 65535 : (datos_acelerometro.tiempo_mala_ms / 1000),
+        }, sizeof(estado_ble_t));
+        if (datos_acelerometro.calibrado)
+        {
+            if (!arranque_medido)
+            {   // Primera decisión válida: fin del arranque
+                arranque_medido = true;
+                BootMark("decision");
+                BootTracePrint();
             }
-            else
-            {  
-                //Postura correcta: reiniciar contador y estado
-                bad_posture_time = 0;
-                posture_state = 0;
+            if (PostureHistoryAdd(&historial, (posture_state_t)datos_acelerometro.estado,
+                    datos_acelerometro.angulo_cdeg, datos_acelerometro.timestamp_us))
+            {
+#if CONFIG_DRIVERS_ILI9341
+                TableroMinuto(historial.ring.entries[(historial.ring.head + POSTURE_HISTORY_LEN - 1) % POSTURE_HISTORY_LEN].mean_cdeg);
+#endif
+                if ((historial.ring.next_minute % PERIODO_GUARDADO_HISTORIAL) == 0)
+                    EscribirNvs(NVS_CLAVE_HISTORIAL, &historial.ring, sizeof(historial.ring));
             }
         }
-        // Esperar al siguiente periodo
-        vTaskDelay(pdMS_TO_TICKS(PERIODO_MUESTREO_AC));
+        EnviarTelemetria(&datos_acelerometro);
     }
 }
+
+/**
+ * @brief Convierte el número (texto) que sigue a un comando recibido por Bluetooth.
+ * @param data Texto, sin terminar en cero
+ * @param length Cantidad de caracteres
+ * @param valor Número leído
+ * @return true si el texto empieza con un número
+ */
+static bool LeerNumero(const uint8_t *data, uint8_t length, float *valor)
+{
+    char texto[16];
+    char *fin;
+
+    if (length == 0 || length >= sizeof(texto))
+        return false;
+    memcpy(texto, data, length);
+    texto[length] = '\0';
+    *valor = strtof(texto, &fin);
+    return fin != texto;
+}
+
 /**
- * @brief Tarea que actualiza los LEDs y buzzer según el estado de postura.
+ * @brief Avisa que Bluetooth ya está anunciando (BleInit no bloquea el muestreo)
+ */
+static void BluetoothListo(void)
+{
+    printf("Bluetooth listo\r\n");
+}
+
+/**
+ * @brief Comandos sin argumento recibidos por Bluetooth.
  *
- * Estado 0 → LED verde encendido (postura correcta)
- * Estado 1 → LED amarillo encendido (advertencia)
- * Estado 2 → LED rojo encendido + buzzer (alerta)
- * Se actualiza cada 1 segundo.
+ * 'B' selecciona la trama binaria y 'T' el texto para Bluetooth Electronics.
+ * 'C' selecciona el envío continuo y 'D' el envío sólo de cambios.
+ * 'K' recalibra tomando la postura actual como referencia (TIEMPO_CALIBRACION ms quieto).
+ * 'H' pide el historial por minuto completo (ver EnviarHistorial()).
+ * 'G' empieza una grabación de muestras crudas en flash, 'F' la termina y 'V' pide
+ * la descarga de todo lo grabado (ver EnviarGrabacion()).
+ * 'Y' reproduce lo grabado en el motor de postura (ver ReproducirGrabacion()).
+ * @param id Letra del comando
+ * @param arg Argumento (no se usa)
+ * @param length Cantidad de bytes del argumento
  */
-void ActualizarIndicadores(void *pvParameter)
+static void ComandoBle(char id, uint8_t *arg, uint8_t length)
 {
-    while (true)
+    switch (id)
     {
-        switch (posture_state)
+    case 'B':
+        modo_telemetria = TELEMETRIA_BINARIA;
+        break;
+    case 'T':
+        modo_telemetria = TELEMETRIA_TEXTO;
+        break;
+    case 'C':
+        politica_envio = ENVIO_CONTINUO;
+        break;
+    case 'D':
+        politica_envio = ENVIO_SOLO_CAMBIOS;
+        break;
+    case 'K':
+        pedido_calibracion = true;
+        break;
+    case 'H':
+        PublicarEvento(EVENTO_HISTORIAL);
+        break;
+    case 'G':
+        FlashLogStart();
+        break;
+    case 'F':
+        FlashLogStop();
+        break;
+    case 'V':
+        PublicarEvento(EVENTO_GRABACION);
+        break;
+    case 'Y':
+        PublicarEvento(EVENTO_REPRODUCCION);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Ajustes de la máquina de estados recibidos por Bluetooth.
+ *
+ * Llevan un número a continuación de la letra: 'U' umbral de inclinación (°),
+ * 'S' umbral de salida (°), 'P' permanencia mínima (ms), 'A' tiempo de advertencia (ms)
+ * y 'R' tiempo de alerta (ms); p. ej. "U15" o "S12.5". Varios ajustes pueden llegar
+ * juntos separados por ';' ("U15;S12;P2000"), se aplican en orden y cada uno se valida
+ * con los anteriores. Los ajustes inconsistentes (salida mayor que inclinación o
+ * advertencia mayor que alerta) se descartan.
+ * @param id Letra del ajuste
+ * @param arg Valor en texto
+ * @param length Cantidad de caracteres del valor
+ */
+static void AjusteBle(char id, uint8_t *arg, uint8_t length)
+{
+    posture_engine_config_t config = config_pedida;
+    float valor;
+    bool ajuste;
+
+    if (!LeerNumero(arg, length, &valor))
+        return;
+    switch (id)
+    {
+    case 'U':
+        config.enter_cdeg = (uint16_t)lrintf(valor * 100.0f);
+        ajuste = (valor >= 0) && (valor <= 180.0f);
+        break;
+    case 'S':
+        config.exit_cdeg = (uint16_t)lrintf(valor * 100.0f);
+        ajuste = (valor >= 0) && (valor <= 180.0f);
+        break;
+    case 'P':
+        config.dwell_ms = (uint32_t)valor;
+        ajuste = (valor >= 0) && (valor <= 600000.0f);
+        break;
+    case 'A':
+        config.warning_ms = (uint32_t)valor;
+        ajuste = (valor >= 0) && (valor <= 600000.0f);
+        break;
+    case 'R':
+        config.alert_ms = (uint32_t)valor;
+        ajuste = (valor >= 0) && (valor <= 600000.0f);
+        break;
+    default:
+        return;
+    }
+    if (ajuste && PostureEngineConfigValid(&config))
+    {   // Publicar la configuración para LeerAcelerometro
+        config_pedida = config;
+        SeqlockWrite(&config_postura, &config);
+        config_postura_nueva = true;
+    }
+}
+
+/** @brief Comandos recibidos por Bluetooth (ver ComandoBle() y AjusteBle()) */
+static const ble_command_t comandos_ble[] = {
+    {'B', ComandoBle}, {'T', ComandoBle}, {'C', ComandoBle}, {'D', ComandoBle},
+    {'K', ComandoBle}, {'H', ComandoBle}, {'G', ComandoBle}, {'F', ComandoBle},
+    {'V', ComandoBle}, {'Y', ComandoBle},
+    {'U', AjusteBle}, {'S', AjusteBle}, {'P', AjusteBle}, {'A', AjusteBle}, {'R', AjusteBle},
+};
+
+/**
+ * @brief Envía un dato en formato texto para la app Bluetooth Electronics.
+ *
+ * El prefijo * indica inicio de dato en protocolo Bluetooth Electronics.
+ * @param datos Dato a enviar
+ */
+static void EnviarTexto(const acelerometro_data_t *datos)
+{
+    char buffer[124];
+    //Convertir estado numérico a texto
+    const char *estado_texto;
+    switch(posture_state){
+        case 0: estado_texto = "Correcta"; break;
+        case 1: estado_texto = "Incorrecta-Advertencia"; break;
+        case 2: estado_texto = "Incorrecta-Alerta"; break;
+        default: estado_texto = "Desconocido"; break;
+    }
+
+    // Enviar datos individuales (para que los reciba cada widget)
+    char *p = buffer;
+    p += FmtStr(p, "*X");
+    p += FmtFloat(p, datos->ax, 2);
+    p += FmtStr(p, "g\n*Y");
+    p += FmtFloat(p, datos->ay, 2);
+    p += FmtStr(p, "g\n*Z");
+    p += FmtFloat(p, datos->az, 2);
+    p += FmtStr(p, "g\n*A");
+    p += FmtFloat(p, datos->angulo, 2);
+    p += FmtStr(p, "\n*E");
+    p += FmtStr(p, estado_texto);
+    p += FmtStr(p, "\n");
+    BleSendString(buffer);
+}
+
+/**
+ * @brief Envía un dato como trama binaria trama_postura_t.
+ * @param datos Dato a enviar
+ */
+static void EnviarBinario(const acelerometro_data_t *datos)
+{
+    static uint8_t secuencia = 0;
+    trama_postura_t trama = {
+        .sync = SYNC_TRAMA,
+        .secuencia = secuencia++,
+        .timestamp_ms = (uint32_t)(datos->timestamp_us / 1000),
+        .ax_mg = SaturarInt16(datos->ax * 1000.0f),
+        .ay_mg = SaturarInt16(datos->ay * 1000.0f),
+        .az_mg = SaturarInt16(datos->az * 1000.0f),
+        .angulo_cdeg = SaturarInt16(datos->angulo * 100.0f),
+        .estado = posture_state,
+        .checksum = 0,
+    };
+    const uint8_t *bytes = (const uint8_t *)&trama;
+    for (uint8_t i = 0; i < sizeof(trama) - 1; i++)
+        trama.checksum ^= bytes[i];
+    BleSendBuffer((const char *)&trama, sizeof(trama));
+}
+
+/**
+ * @brief Envía el historial por minuto en una sola transferencia.
+ *
+ * Una cabecera cabecera_historial_t seguida de los registros posture_minute_t, del más
+ * viejo al más nuevo, empaquetados en notificaciones de hasta el MTU negociado.
+ * @param anillo Copia del anillo del historial
+ */
+static void EnviarHistorial(const posture_history_ring_t *anillo)
+{
+    static posture_minute_t registros[POSTURE_HISTORY_LEN];
+    cabecera_historial_t cabecera = {
+        .sync = SYNC_HISTORIAL,
+        .largo_registro = sizeof(posture_minute_t),
+    };
+
+    if (BleStatus() != BLE_CONNECTED)
+        return;
+    cabecera.cantidad = PostureHistoryRead(anillo, registros, POSTURE_HISTORY_LEN);
+    BleSendBuffer((const char *)&cabecera, sizeof(cabecera));
+    BleSendBatch(registros, sizeof(posture_minute_t), cabecera.cantidad);
+}
+
+/**
+ * @brief Envía un bloque de la grabación de muestras crudas, del más viejo al más nuevo.
+ *
+ * Cada bloque es una cabecera flash_log_header_t seguida de count registros
+ * muestra_cruda_t, tal como está en la flash, empaquetado en notificaciones de hasta
+ * el MTU negociado. La transferencia termina con una cabecera con count = 0.
+ * @param n Número de bloque
+ * @return true si quedan bloques por enviar
+ */
+static bool EnviarGrabacion(uint32_t n)
+{
+    flash_log_header_t fin = {
+        .magic = FLASH_LOG_MAGIC,
+        .seq = UINT32_MAX,
+        .count = 0,
+        .record_size = sizeof(muestra_cruda_t),
+    };
+    uint16_t largo;
+
+    if (n < FlashLogBlockCount() && BleStatus() == BLE_CONNECTED)
+    {
+        largo = FlashLogReadBlock(n, bloque_flash);
+        if (largo > 0)
+            BleSendBatch(bloque_flash, 1, largo);
+        return true;
+    }
+    BleSendBuffer((const char *)&fin, sizeof(fin));
+    return false;
+}
+
+/**
+ * @brief Reproduce un bloque de la grabación de muestras crudas en el motor de postura, a la velocidad de la CPU.
+ *
+ * Pasa las muestras grabadas, del bloque más viejo al más nuevo, por un motor de
+ * postura aparte con la misma configuración que el de LeerAcelerometro pero sin
+ * calibración (la calibran los primeros TIEMPO_CALIBRACION ms de la grabación), y al
+ * terminar imprime por consola las muestras, advertencias y alertas y las muestras por
+ * segundo procesadas (sin contar la lectura de la flash). Como el motor sólo depende de
+ * las muestras, las decisiones son las mismas que da benchmarks/host/posture_replay con
+ * la grabación descargada con 'V'.
+ * @param n Número de bloque
+ * @return true si quedan bloques por reproducir
+ */
+static bool ReproducirGrabacion(uint32_t n)
+{
+    const flash_log_header_t *cabecera = (const flash_log_header_t *)bloque_flash;
+    const muestra_cruda_t *registros = (const muestra_cruda_t *)(bloque_flash + sizeof(flash_log_header_t));
+    posture_output_t salida[POSTURE_PIPELINE_BLOCK];
+    reproduccion_t *r = &reproduccion;
+    int64_t tiempo_us, inicio_us;
+    uint8_t cantidad;
+
+    if (n >= FlashLogBlockCount())
+    {
+        printf("REPLAY %lu muestras (%.1f min) en %lu ms, %lu muestras/s: %lu advertencias, %lu alertas\r\n",
+               r->muestras, r->muestras / (60.0f * r->frecuencia), (uint32_t)(r->proceso_us / 1000),
+               (r->proceso_us > 0) ? (uint32_t)(r->muestras * 1000000LL / r->proceso_us) : 0, r->advertencias, r->alertas);
+        return false;
+    }
+    if (FlashLogReadBlock(n, bloque_flash) == 0 || cabecera->record_size != sizeof(muestra_cruda_t))
+        return true;
+    inicio_us = esp_timer_get_time();
+    for (uint16_t i = 0; i < cabecera->count; i++)
+    {
+        tiempo_us = (int64_t)cabecera->first_ms * 1000 + i * r->periodo_us + r->desplazamiento_us;
+        if (tiempo_us <= r->ultimo_us)
+        {   // Otra sesión (la placa se reinició): sigue después de la anterior
+            r->desplazamiento_us += r->ultimo_us + r->periodo_us - tiempo_us;
+            tiempo_us = r->ultimo_us + r->periodo_us;
+        }
+        r->ultimo_us = tiempo_us;
+        cantidad = PosturePipelineAdd(&r->motor, SENSOR_PRINCIPAL, registros[i].ax_mg / 1000.0f,
+                                      registros[i].ay_mg / 1000.0f, registros[i].az_mg / 1000.0f, tiempo_us, salida);
+        for (uint8_t k = 0; k < cantidad; k++)
         {
-        case 0: // Postura correcta
-            LedOn(LED_1);
-            LedOff(LED_2);
-            LedOff(LED_3);
-            BuzzerOff();
-            break;
-        case 1: // Advertencia
-            LedOff(LED_1);
-            LedOn(LED_2);
-            LedOff(LED_3);
-            BuzzerOff();
-            break;
-        case 2: // Alerta
-            LedOff(LED_1);
-            LedOff(LED_2);
-            LedOn(LED_3);
-            BuzzerOn();
-            break;
-        default:
-            break;
+            if (salida[k].state != r->estado)
+            {
+                r->estado = salida[k].state;
+                r->advertencias += (r->estado == POSTURE_WARNING);
+                r->alertas += (r->estado == POSTURE_ALERT);
+            }
         }
-        vTaskDelay(pdMS_TO_TICKS(1000));
     }
+    r->proceso_us += esp_timer_get_time() - inicio_us;
+    r->muestras += cabecera->count;
+    return true;
+}
+
+/**
+ * @brief Empieza una transferencia larga pedida por la app, si no hay otra en curso.
+ *
+ * No se envía ni se reproduce nada mientras se está grabando.
+ * @param nuevo Transferencia pedida
+ */
+static void EmpezarTrabajo(trabajo_t nuevo)
+{
+    flash_log_stats_t estadisticas;
+
+    FlashLogGetStats(&estadisticas);
+    if (trabajo != TRABAJO_NINGUNO || estadisticas.recording)
+        return;
+    if (nuevo == TRABAJO_GRABACION)
+    {
+        if (BleStatus() != BLE_CONNECTED)
+            return;
+        BleSetLinkProfile(BLE_LINK_FAST);
+    }
+    else
+    {
+        memset(&reproduccion, 0, sizeof(reproduccion));
+        // Las grabaciones son del primer nivel, sea cual sea el nivel actual (ver LeerAcelerometro())
+        reproduccion.frecuencia = frecuencias_ac[0];
+        reproduccion.periodo_us = (int64_t)lrintf(1e6f / reproduccion.frecuencia);
+        reproduccion.ultimo_us = -1;
+        reproduccion.estado = POSTURE_CORRECT;
+        config_motor.engine = config_pedida;
+        PosturePipelineInit(&reproduccion.motor, &config_motor, &reproduccion.frecuencia, 1);
+    }
+    bloque_trabajo = 0;
+    trabajo = nuevo;
+}
+
+/**
+ * @brief Avanza un bloque de la transferencia larga en curso.
+ */
+static void AvanzarTrabajo(void)
+{
+    bool sigue = (trabajo == TRABAJO_GRABACION) ? EnviarGrabacion(bloque_trabajo) : ReproducirGrabacion(bloque_trabajo);
+
+    bloque_trabajo++;
+    if (!sigue)
+        trabajo = TRABAJO_NINGUNO;
+}
+
+/**
+ * @brief Decide si un dato debe enviarse según la política de envío activa.
+ *
+ * En modo sólo cambios se envía cuando el ángulo se aleja más de BANDA_MUERTA_ANGULO
+ * del último enviado, cuando cambia el estado de la postura o cuando pasaron
+ * PERIODO_HEARTBEAT ms desde el último envío (para que la app sepa que el enlace sigue activo).
+ * @param datos Dato candidato
+ * @return true si el dato debe enviarse
+ */
+static bool DebeEnviar(const acelerometro_data_t *datos)
+{
+    static float ultimo_angulo = 0;
+    static uint8_t ultimo_estado = UINT8_MAX;
+    static int64_t ultimo_envio_us = 0;
+    bool enviar = true;
+
+    if (politica_envio == ENVIO_SOLO_CAMBIOS)
+    {
+        enviar = (fabsf(datos->angulo - ultimo_angulo) > BANDA_MUERTA_ANGULO) ||
+                 (posture_state != ultimo_estado) ||
+                 ((datos->timestamp_us - ultimo_envio_us) >= (PERIODO_HEARTBEAT * 1000LL));
+    }
+    if (enviar)
+    {
+        ultimo_angulo = datos->angulo;
+        ultimo_estado = posture_state;
+        ultimo_envio_us = datos->timestamp_us;
+    }
+    return enviar;
+}
+
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+/**
+ * @brief Coseno de un ángulo en Q15.
+ * @param cdeg Ángulo (centésimas de grado)
+ * @return Coseno (Q15)
+ */
+static int16_t CosenoQ15(uint16_t cdeg)
+{
+    return (int16_t)lrintf(cosf(cdeg * (float)M_PI / 18000.0f) * POSTURE_Q15_ONE);
+}
+
+/**
+ * @brief Verifica si el núcleo LP puede vigilar la postura.
+ *
+ * Hace falta el MPU6050 calibrado (el núcleo LP no puede leer el ADXL335) y que no haya
+ * nadie conectado ni una grabación o una transferencia larga en curso.
+ * @param datos Último dato del acelerómetro
+ * @return true si el HP puede dormirse
+ */
+static bool PuedeVigilar(const acelerometro_data_t *datos)
+{
+    flash_log_stats_t grabacion;
+
+    FlashLogGetStats(&grabacion);
+    return (cantidad_sensores > SENSOR_VIGILANCIA) && datos->calibrado && (BleStatus() != BLE_CONNECTED) &&
+           !grabacion.recording && (trabajo == TRABAJO_NINGUNO);
+}
+
+/**
+ * @brief Pasa la vigilancia de la postura al núcleo LP y duerme el HP (deep sleep).
+ *
+ * Carga el programa del núcleo LP con la referencia del MPU6050 y la configuración de la
+ * máquina de estados, y le pasa los pines del I2C. La RAM del HP se pierde, pero la memoria
+ * RTC no (retain_mcu): el historial y las referencias ajustadas de todos los sensores quedan
+ * retenidos ahí, sin escribir la flash, y al despertar siguen sin verificar la calibración
+ * (sólo si no entran, el historial se guarda en NVS).
+ * No vuelve, salvo que algo falle (el HP sigue despierto).
+ */
+static void EntrarVigilancia(void)
+{
+    vigilancia_lp_t *lp = (vigilancia_lp_t *)&ulp_vigilancia;
+    const posture_calibration_t *cal = &calibracion.sensor[SENSOR_VIGILANCIA];
+    lp_core_i2c_cfg_t i2c = LP_CORE_I2C_DEFAULT_CONFIG();
+    ulp_lp_core_cfg_t lp_config = {
+        .wakeup_source = ULP_LP_CORE_WAKEUP_SOURCE_LP_TIMER,
+        .lp_timer_sleep_duration_us = PERIODO_VIGILANCIA * 1000,
+    };
+    posture_ref_t ref;
+    posture_pipeline_state_t estado;
+
+    PostureRefInit(&ref, cal->base[0], cal->base[1], cal->base[2], config_pedida.enter_cdeg / 100.0f);
+    if (!ref.valid)
+        return;
+
+    if (ulp_lp_core_load_binary(postura_lp_inicio, postura_lp_fin - postura_lp_inicio) != ESP_OK)
+        return;
+    memset(lp, 0, sizeof(*lp));
+    memcpy(lp->ref_q15, ref.ref_q15, sizeof(lp->ref_q15));
+    lp->cos_entrada_q15 = CosenoQ15(config_pedida.enter_cdeg);
+    lp->cos_salida_q15 = CosenoQ15(config_pedida.exit_cdeg);
+    lp->config = config_pedida;
+    lp->periodo_ms = PERIODO_VIGILANCIA;
+    lp->sincronizacion_ms = PERIODO_SINCRONIZACION;
+    if (lp_core_i2c_master_init(LP_I2C_NUM_0, &i2c) != ESP_OK || ulp_lp_core_run(&lp_config) != ESP_OK)
+    {
+        printf("Núcleo LP no disponible, el HP sigue despierto\r\n");
+        return;
+    }
+    // Sin muestras nuevas mientras se toma el estado de la postura
+    vTaskSuspend(adquisicion_task_handle);
+    PosturePipelineSaveState(&postura, esp_timer_get_time(), &estado);
+    RetainSave(RETENIDO_POSTURA, &estado, sizeof(estado));
+    if (!RetainSave(RETENIDO_HISTORIAL, &historial.ring, sizeof(historial.ring)))
+        EscribirNvs(NVS_CLAVE_HISTORIAL, &historial.ring, sizeof(historial.ring));
+    printf("Vigilancia en el núcleo LP, el HP duerme\r\n");
+    LedsMask(0);
+    BuzzerOff();
+    esp_sleep_enable_ulp_wakeup();
+    esp_deep_sleep_start();
 }
 
 /**
- * @brief Tarea que envía datos de postura al celular vía Bluetooth BLE.
+ * @brief Si el HP despertó de la vigilancia, detiene el núcleo LP y toma sus resultados.
+ *
+ * Se llama al comienzo de app_main, antes de inicializar el I2C del HP.
+ */
+static void SalirVigilancia(void)
+{
+    static const char *motivos[] = {"-", "cambio de estado", "sincronizacion", "sensor"};
+    lp_core_i2c_cfg_t i2c = LP_CORE_I2C_DEFAULT_CONFIG();
+
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_ULP)
+        return;
+    ulp_lp_core_stop();
+    resultado_vigilancia = *(vigilancia_lp_t *)&ulp_vigilancia;
+    despertado_por_lp = true;
+    // Los pines vuelven del LP I2C al I2C del HP
+    rtc_gpio_deinit(i2c.i2c_pin_cfg.sda_io_num);
+    rtc_gpio_deinit(i2c.i2c_pin_cfg.scl_io_num);
+    printf("Despertado por el núcleo LP (%s): %lu s vigilados, %lu s en mala postura, %lu errores I2C\r\n",
+           motivos[resultado_vigilancia.motivo <= DESPERTAR_SENSOR ? resultado_vigilancia.motivo : 0],
+           resultado_vigilancia.vigilado_ms / 1000, resultado_vigilancia.mala_total_ms / 1000,
+           resultado_vigilancia.errores_i2c);
+}
+#endif
+
+/**
+ * @brief Envía datos de postura al celular vía Bluetooth BLE (lo llama periódicamente la tarea Eventos).
  *
  * Envía en tiempo real a la aplicación:
  * -Aceleraciones X,Y,Z en g.
  * -Ángulo de inclinación en grados.
  * -Estado de postura (correcta, advertencia, alerta).
- * Envía datos cada 100 ms.
- * El prefijo * indica inicio de dato en protocolo Bluetooth Electronics.
+ * Evalúa si corresponde enviar (ver DebeEnviar()) y envía como texto o como trama
+ * binaria según modo_telemetria.
+ * En modo sólo cambios, tras TIEMPO_REPOSO_BLE ms en postura correcta pasa el enlace al
+ * perfil de bajo consumo y pide ser llamada cada PERIODO_ENVIO_BLE_REPOSO ms; cualquier
+ * cambio de estado o de política, o una transferencia larga, vuelve al perfil rápido.
+ * Fuera de ese perfil el período es el del nivel de muestreo (ver periodos_envio).
+ * Tras TIEMPO_VIGILANCIA ms en postura correcta sin conexión pasa la vigilancia al
+ * núcleo LP (ver EntrarVigilancia()).
+ * @return Tiempo hasta el próximo envío (ms)
  */
-void Bluetooth(void *pvParameter)
+static uint32_t AtenderBluetooth(void)
 {
-    char buffer[124];
+    static uint8_t estado_anterior = UINT8_MAX;
+    static int64_t inicio_estado_us = 0;
+    acelerometro_data_t datos_acelerometro;
+    bool reposo;
+
+    // Con la app conectada el ADXL335 vuelve a entregar muestras (ver VigilarConMonitor())
+    if (BleStatus() == BLE_CONNECTED)
+        AccelSensorWake(sensores[SENSOR_PRINCIPAL]);
+    // Copia consistente del último dato (sin mezclar ejes de muestras distintas)
+    SeqlockRead(&ultimo_dato, &datos_acelerometro);
+    if (BleStatus() == BLE_CONNECTED && DebeEnviar(&datos_acelerometro))
+    {
+        if (modo_telemetria == TELEMETRIA_BINARIA)
+            EnviarBinario(&datos_acelerometro);
+        else
+            EnviarTexto(&datos_acelerometro);
+    }
+    // Perfil del enlace según la estabilidad de la postura
+    if (posture_state != estado_anterior)
+    {
+        estado_anterior = posture_state;
+        inicio_estado_us = datos_acelerometro.timestamp_us;
+    }
+    reposo = (politica_envio == ENVIO_SOLO_CAMBIOS) && (estado_anterior == 0) && (trabajo == TRABAJO_NINGUNO) &&
+             ((datos_acelerometro.timestamp_us - inicio_estado_us) >= (TIEMPO_REPOSO_BLE * 1000LL));
+    BleSetLinkProfile(reposo ? BLE_LINK_LOW_POWER : BLE_LINK_FAST);
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+    // Postura correcta y estable sin nadie conectado: vigila el núcleo LP y el HP duerme
+    if ((estado_anterior == 0) && ((datos_acelerometro.timestamp_us - inicio_estado_us) >= (TIEMPO_VIGILANCIA * 1000LL)) &&
+        PuedeVigilar(&datos_acelerometro))
+        EntrarVigilancia();
+#endif
+    // Próximo envío
+    return reposo ? PERIODO_ENVIO_BLE_REPOSO : periodos_envio[nivel_muestreo];
+}
+
+/**
+ * @brief Tarea única de la aplicación: atiende los eventos en orden, con un manejador para cada uno.
+ *
+ * Espera los eventos (bits de su notificación, ver evento_t) hasta el próximo envío por
+ * Bluetooth y llama directamente al manejador de cada uno: las muestras nuevas
+ * (AtenderMuestras(), con los indicadores y el historial), la calibración nueva para
+ * guardar en NVS, y los pedidos de la app (historial, descarga y reproducción de la
+ * grabación). La descarga y la reproducción avanzan un bloque de la flash por vuelta
+ * (esperando un tick, para dejar correr a las tareas de menor prioridad), así las
+ * muestras y las alertas se siguen atendiendo durante toda la transferencia.
+ * Cuando vence el período de envío llama a AtenderBluetooth(), que fija el siguiente.
+ * Sólo LeerAcelerometro, que corre el motor de postura con cada trama, queda en su propia
+ * tarea, de mayor prioridad.
+ */
+void Eventos(void *pvParameter)
+{
+    uint32_t eventos;
+    uint32_t periodo_ms = 0;
+    TickType_t ultimo_envio = xTaskGetTickCount();
+    TickType_t transcurrido, espera;
+
+    MostrarEstado(posture_state);
     while (true)
     {
-        //Convertir estado numérico a texto
-        const char *estado_texto;
-        switch(posture_state){
-            case 0: estado_texto = "Correcta"; break;
-            case 1: estado_texto = "Incorrecta-Advertencia"; break;
-            case 2: estado_texto = "Incorrecta-Alerta"; break;
-            default: estado_texto = "Desconocido"; break;
+        transcurrido = xTaskGetTickCount() - ultimo_envio;
+        espera = (transcurrido >= pdMS_TO_TICKS(periodo_ms)) ? 0 : pdMS_TO_TICKS(periodo_ms) - transcurrido;
+        if (trabajo != TRABAJO_NINGUNO && espera > 1)
+            espera = 1;
+        eventos = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &eventos, espera);
+        if (eventos & EVENTO_MUESTRAS)
+            AtenderMuestras();
+        if (eventos & EVENTO_CALIBRACION)
+            EscribirNvs(NVS_CLAVE_CALIBRACION, &calibracion, sizeof(calibracion));
+        if (eventos & EVENTO_HISTORIAL)
+            EnviarHistorial(&historial.ring);
+        if (eventos & EVENTO_GRABACION)
+            EmpezarTrabajo(TRABAJO_GRABACION);
+        if (eventos & EVENTO_REPRODUCCION)
+            EmpezarTrabajo(TRABAJO_REPRODUCCION);
+        if (eventos & EVENTO_CAIDA)
+            AtenderCaida();
+        if (trabajo != TRABAJO_NINGUNO)
+            AvanzarTrabajo();
+        if ((xTaskGetTickCount() - ultimo_envio) >= pdMS_TO_TICKS(periodo_ms))
+        {
+            ultimo_envio = xTaskGetTickCount();
+            periodo_ms = AtenderBluetooth();
         }
+    }
+}
 
-        // Enviar datos individuales (para que los reciba cada widget)
-        snprintf(buffer, sizeof(buffer),
-                 "*X%.2fg\n*Y%.2fg\n*Z%.2fg\n*A%.2f\n*E%s\n",
-                 datos_acelerometro.ax,
-                 datos_acelerometro.ay,
-                 datos_acelerometro.az,
-                 datos_acelerometro.angulo,
-                 estado_texto);
-            BleSendString(buffer);
-        // Esperar al siguiente envío
-        vTaskDelay(100/portTICK_PERIOD_MS);
+/**
+ * @brief Inicializa los LEDs y el buzzer (en paralelo con IniciarMuestras e IniciarMpu6050)
+ */
+static void IniciarIndicadores(void)
+{
+    LedsInit();
+    BuzzerInit(GPIO_4); // Pin  al buzzer
+}
+
+/**
+ * @brief Prepara la grabación de muestras crudas (prioridad baja: sólo escribe los bloques llenos)
+ */
+static void IniciarMuestras(void)
+{
+    if (!FlashLogInit(PARTICION_MUESTRAS, sizeof(muestra_cruda_t), plan_tareas[TAREA_GRABACION].priority))
+        printf("Partición de muestras no disponible\r\n");
+}
+
+/**
+ * @brief Eventos del detector de movimiento del MPU6050 (desde su tarea de adquisición).
+ * @param eventos Eventos detectados (MPU6050_EVENT_*)
+ * @param param No se usa
+ */
+static void EventoMpu6050(uint8_t eventos, void *param)
+{
+    if (eventos & MPU6050_EVENT_FALL)
+        PublicarEvento(EVENTO_CAIDA);
+}
+
+/**
+ * @brief Inicializa el bus I2C y agrega el MPU6050 si responde
+ *
+ * Se ejecuta después de agregar el ADXL335, que queda como sensor principal. La caída
+ * libre la detecta el propio MPU6050 (ver MPU6050_startEvents()), que sólo interrumpe
+ * cuando ocurre.
+ */
+static void IniciarMpu6050(void)
+{
+    accel_sensor_config_t mpu6050 = {
+        .type = ACCEL_SENSOR_MPU6050,
+        .sample_frec = FRECUENCIA_MUESTREO_MPU,
+        .int_pin = PIN_INT_MPU,
+    };
+    mpu6050_events_config_t caida = {
+        .events = MPU6050_EVENT_FALL,
+        .dhpf = MPU6050_DHPF_RESET,     // la caída libre se mide con la gravedad
+        .fall_mg = UMBRAL_CAIDA,
+        .fall_ms = DURACION_CAIDA,
+    };
+    I2C_initialize(I2C_MASTER_FREQ_HZ);
+    sensores[cantidad_sensores] = AccelSensorAdd(&mpu6050);
+    if (sensores[cantidad_sensores] >= 0)
+    {
+        cantidad_sensores++;
+        MPU6050_startEvents(PIN_INT_MPU, &caida, EventoMpu6050, NULL);
     }
+    else
+        printf("MPU6050 no detectado, se usa sólo el ADXL335\r\n");
 }
 
 /*==================[external functions definition]==========================*/
 void app_main(void)
 {
+    // Inicializaciones independientes entre sí, cada una en su tarea
+    const boot_job_t inicializaciones[] = {
+        {"mpu6050", IniciarMpu6050, 3072},
+        {"muestras", IniciarMuestras, 3072},
+        {"indicadores", IniciarIndicadores, 2048},
+    };
+    float frecuencias[ACCEL_SENSOR_MAX];
+    static posture_history_ring_t anillo_guardado;
+    posture_pipeline_state_t estado_retenido;
+    static ejes_nvs_t ejes;
+
+    BootMark("app_main"); // ROM, bootloader e inicio de ESP-IDF
+    // Prioridades de todas las tareas, antes de que los drivers creen las suyas
+    if (!RtScheduleInit(plan_tareas, CANTIDAD_TAREAS, PRIORIDAD_MINIMA, PRIORIDAD_MAXIMA))
+        printf("Plan de tareas: hay plazos que pueden no cumplirse\r\n");
+    // Estado retenido en la memoria RTC, sólo si se despertó de deep sleep
+    RetainInit();
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+    SalirVigilancia();
+#endif
+
+    // Frecuencia de la CPU según la carga y light sleep automático cuando está ociosa
+    power_config_t energia = {
+        .max_freq_mhz = 160,
+        .min_freq_mhz = 40,
+        .light_sleep = true,
+    };
+    if (!PowerInit(&energia))
+        printf("Gestión de energía no disponible (CONFIG_PM_ENABLE)\r\n");
+    BootMark("energia");
 
-    // Inicialización de periféricos
-    ADXL335Init();
-    LedsInit();
-    BuzzerInit(GPIO_4); // Pin  al buzzer
-    
     //Configuración de Bluetooth
     ble_config_t ble_device = {
         .device_name = "PostureCare",
-        .func_p = BLE_NO_INT, // No se espera recepción de datos
+        .func_p = BLE_NO_INT,
+        .commands = comandos_ble, // Formato de telemetría, política de envío y ajustes
+        .n_commands = sizeof(comandos_ble) / sizeof(comandos_ble[0]),
+        .ready_p = BluetoothListo,
+    };
+    BleInit(&ble_device); // Inicializa la NVS y arranca Bluetooth en segundo plano
+    BootMark("ble_nvs");
+
+    // Historial por minuto retenido o guardado, continúa la numeración de los minutos
+    PostureHistoryInit(&historial, (RetainLoad(RETENIDO_HISTORIAL, &anillo_guardado, sizeof(anillo_guardado)) ||
+                                    LeerNvs(NVS_CLAVE_HISTORIAL, &anillo_guardado, sizeof(anillo_guardado)))
+                                       ? &anillo_guardado
+                                       : NULL);
+    BootMark("historial");
+#if CONFIG_DRIVERS_ILI9341
+    // Tablero: su tarea inicializa el display, sin demorar el arranque
+    tablero_config_t tablero = {
+        .spi = SPI_1,
+        .dc = PIN_DC_DISPLAY,
+        .rst = PIN_RST_DISPLAY,
+        .umbral_cdeg = UMBRAL_INCLINACION * 100,
+        .prioridad = plan_tareas[TAREA_TABLERO].priority,
+    };
+    if (!TableroInit(&tablero, &historial.ring))
+        printf("Tablero no disponible\r\n");
+#endif
+
+    // Sensores: ADXL335 en el pecho (principal) y, si está conectado, MPU6050 en la espalda
+    accel_sensor_config_t adxl335 = {
+        .type = ACCEL_SENSOR_ADXL335,
+        .sample_frec = FRECUENCIA_MUESTREO_AC,
+        .oversampling = SOBREMUESTREO_AC,
+    };
+    sensores[cantidad_sensores] = AccelSensorAdd(&adxl335);
+    cantidad_sensores++;
+    BootMark("adxl335");
+    // MPU6050 (espera la respuesta del bus), muestras en flash e indicadores
+    BootParallel(inicializaciones, sizeof(inicializaciones) / sizeof(inicializaciones[0]));
+    BootMark("perifericos");
+    for (uint8_t s = 0; s < cantidad_sensores; s++)
+        frecuencias[s] = AccelSensorFrequency(sensores[s]);
+    // Corrección de los ejes medida en fábrica, si la hay
+    corregir_ejes = LeerNvs(NVS_CLAVE_EJES, &ejes, sizeof(ejes)) && (ejes.sensores == cantidad_sensores);
+    for (uint8_t s = 0; s < cantidad_sensores; s++)
+        AxisCalibrationInit(&correccion_ejes[s], corregir_ejes ? ejes.matriz[s] : NULL, corregir_ejes ? ejes.sesgo[s] : NULL);
+    config_motor.engine = config_pedida;
+    PosturePipelineInit(&postura, &config_motor, frecuencias, cantidad_sensores);
+    RateControllerInit(&control_frecuencia, &config_frecuencia);
+
+    // De vuelta de deep sleep: las referencias ajustadas siguen, sin verificar la calibración
+    if (RetainLoad(RETENIDO_POSTURA, &estado_retenido, sizeof(estado_retenido)) &&
+        PosturePipelineRestoreState(&postura, &estado_retenido) && postura.calibrated)
+    {
+        calibracion.version = VERSION_CALIBRACION;
+        calibracion.sensores = cantidad_sensores;
+        for (uint8_t s = 0; s < cantidad_sensores; s++)
+            if (estado_retenido.calibrated[s])
+                calibracion.sensor[s] = estado_retenido.sensor[s];
+        printf("Calibracion y referencias retenidas en memoria RTC\r\n");
+    }
+    // Calibración guardada: se monitorea desde el primer dato y se verifica en segundo plano
+    else if (CargarCalibracion(&calibracion))
+    {
+        for (uint8_t s = 0; s < cantidad_sensores; s++)
+            printf("Calibracion sensor %u cargada de NVS: X=%.2f Y=%.2f Z=%.2f\r\n", s,
+                   calibracion.sensor[s].base[0], calibracion.sensor[s].base[1], calibracion.sensor[s].base[2]);
+        PosturePipelineRestore(&postura, calibracion.sensor);
+    }
+#if CONFIG_ULP_COPROC_TYPE_LP_CORE
+    // El período de mala postura que detectó el núcleo LP continúa
+    if (despertado_por_lp && postura.calibrated)
+        PostureEngineResume(&postura.engine, resultado_vigilancia.tiempo_mala_ms);
+#endif
+
+    //Configuración de la telemetría binaria por UART hacia la PC
+    serial_config_t uart_telemetria = {
+        .port = UART_PC,
+        .baud_rate = BAUDIOS_TELEMETRIA,
+        .func_p = UART_NO_INT,
+        .param_p = NULL,
     };
-    BleInit(&ble_device); // Inicializar Bluetooth
+    UartInit(&uart_telemetria);
+    TelemetryAddSource(&cola_telemetria);
+    TelemetryInit(TELEMETRY_UART_PC, plan_tareas[TAREA_TELEMETRIA].priority); // Sólo vacía la cola
+    LogDeferInit(plan_tareas[TAREA_LOG].priority); // Da formato a los mensajes de LeerAcelerometro fuera de la tarea
+#if CONFIG_MIDDELWARE_TASK_PROFILER
+    TaskProfilerInit(PERIODO_PERFIL, TIPO_PERFIL_TAREAS, plan_tareas[TAREA_PERFIL].priority);
+#endif
 
     // Creación de tareas
-    xTaskCreate(LeerAcelerometro, "LeerAcelerometro", 2048, NULL, 5, NULL);
-    xTaskCreate(ProcesarPostura, "ProcesarPostura", 2048, NULL, 5, NULL);
-    xTaskCreate(ActualizarIndicadores, "ActualizarIndicadores", 2048, NULL, 5, NULL);
-    xTaskCreate(Bluetooth, "Bluetooth", 2048, NULL, 5, NULL);
+    TaskCreateStored(&pila_adquisicion, LeerAcelerometro, "LeerAcelerometro", NULL, plan_tareas[TAREA_ADQUISICION].priority,
+                     &adquisicion_task_handle);
+    TaskCreateStored(&pila_eventos, Eventos, "Eventos", NULL, plan_tareas[TAREA_EVENTOS].priority, &eventos_task_handle);
+
+    // Inicio del muestreo de todos los sensores (después de crear la tarea que los atiende)
+    AccelSensorStart(adquisicion_task_handle);
+    BootMark("tareas");
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -0,0 +1,20 @@
+/**
+ * @file postura_actividad.h
+ * @brief Clasificador de actividad para fs = 100 Hz, segmentos de 1000 ms
+ * @note Creado con activity_model.py: 40 señales sintéticas por clase
+ * (semilla 1), 97.2 % de aciertos en int8
+ */
+#include "activity_classifier.h"
+
+/* Características: tilt_std, tilt_range, tilt_net, mag_std, step_freq, step_power */
+static const activity_model_t postura_actividad = {
+    .segment_ms = 1000,
+    .offset = {3.48380184f, 10.4947681f, 4.84240389f, 0.0582534075f, 1.6681056f, 0.582912564f},
+    .gain = {6.24023771f, 2.47629428f, 3.22953248f, 407.18811f, 67.4511871f, 116.744171f},
+    .weight = {
+        { -80,   64,    8, -106,    6, -111,   11,    0},   /* quieto */
+        { 127,  -16,   34,  -10,  -41,    2,   -5,    0},   /* alcance */
+        { -47,  -48,  -42,  116,   35,  109,   -6,    0},   /* caminata */
+    },
+    .shift = 9,
+};
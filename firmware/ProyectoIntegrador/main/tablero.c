@@ -0,0 +1,300 @@
+/**
+ * @file tablero.c
+ * @brief Tablero de PostureCare en el display ILI9341: sólo se redibuja lo que cambia
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "tablero.h"
+#include "ili9341.h"
+#include "ili9341_scene.h"
+#include "power_mcu.h"
+#include "seqlock.h"
+#include "spsc_ring.h"
+#include "text_format.h"
+/*==================[macros and definitions]=================================*/
+#define PILA_TABLERO 3072
+#define COLOR_FONDO ILI9341_BLACK
+#define COLOR_TEXTO ILI9341_WHITE
+#define COLOR_AGUJA ILI9341_WHITE
+#define COLOR_MARCA ILI9341_DARKGREEN
+#define COLOR_MARCA_MALA ILI9341_RED
+#define COLOR_UMBRAL ILI9341_DARKGREY
+
+/* Franja de estado */
+#define ALTO_FRANJA 50
+
+/* Indicador de aguja: marcas cada PASO_MARCAS grados entre RADIO_MARCAS y RADIO_ARCO,
+ * la aguja (más corta) nunca las toca al borrarse */
+#define CENTRO_X 120
+#define CENTRO_Y 160
+#define RADIO_ARCO 100
+#define RADIO_MARCAS 88
+#define LARGO_AGUJA 82
+#define RADIO_EJE 5
+#define PASO_MARCAS 5
+
+/* Textos, debajo del eje de la aguja */
+#define GRADOS_X 80
+#define GRADOS_Y 170
+#define SESION_Y 236
+
+/* Gráfico del historial: una columna de ANCHO_COLUMNA píxeles por minuto */
+#define GRAFICO_Y 266
+#define ALTO_GRAFICO (ILI9341_HEIGHT - GRAFICO_Y)
+#define ANCHO_COLUMNA 2
+#define COLUMNAS_GRAFICO POSTURE_HISTORY_LEN
+#define SIN_DATO UINT8_MAX
+
+_Static_assert(COLUMNAS_GRAFICO * ANCHO_COLUMNA <= ILI9341_WIDTH, "El historial no entra en el ancho del display");
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** @brief Último estado publicado por TableroActualizar, lo lee la tarea del tablero */
+SEQLOCK_DEFINE(dato_tablero, tablero_dato_t);
+
+/** @brief Medias de los minutos cerrados, de TableroMinuto a la tarea del tablero */
+SPSC_RING_DEFINE(minutos_tablero, uint16_t, 4);
+
+static tablero_config_t config_tablero;
+
+/** @brief Altura de la línea de cada columna del gráfico (píxeles desde arriba), SIN_DATO si no hay */
+static uint8_t columnas[COLUMNAS_GRAFICO];
+
+/** @brief Columna que escribe el próximo minuto */
+static uint8_t columna_actual = 0;
+
+static int8_t franja_id, estado_id, grados_id, sesion_id;
+
+/** @brief Estado de la franja: posture_state_t, o POSTURE_HISTORY_STATES mientras se calibra */
+static const struct
+{
+    const char *texto;
+    uint16_t fondo;
+    uint16_t letra;
+} estados[POSTURE_HISTORY_STATES + 1] = {
+    {"CORRECTA", ILI9341_DARKGREEN, ILI9341_WHITE},
+    {"ADVERTENCIA", ILI9341_YELLOW, ILI9341_BLACK},
+    {"ALERTA", ILI9341_RED, ILI9341_WHITE},
+    {"CALIBRANDO", ILI9341_DARKGREY, ILI9341_WHITE},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Punto a una distancia del eje en la dirección de una inclinación
+ * (0 grados a la izquierda, TABLERO_RANGO_GRADOS a la derecha)
+ */
+static void PuntoIndicador(float grados, uint16_t radio, uint16_t *x, uint16_t *y)
+{
+    float tita = (float)M_PI * (1.0f - grados / TABLERO_RANGO_GRADOS);
+
+    *x = (uint16_t)lroundf(CENTRO_X + radio * cosf(tita));
+    *y = (uint16_t)lroundf(CENTRO_Y - radio * sinf(tita));
+}
+
+static void DibujarAguja(uint8_t grados, uint16_t color)
+{
+    uint16_t x, y;
+
+    PuntoIndicador(grados, LARGO_AGUJA, &x, &y);
+    ILI9341DrawLine(CENTRO_X, CENTRO_Y, x, y, color);
+}
+
+/** @brief Fila del gráfico para una inclinación media */
+static uint8_t AlturaGrafico(uint16_t media_cdeg)
+{
+    uint32_t alto = (uint32_t)media_cdeg * (ALTO_GRAFICO - 1) / (TABLERO_RANGO_GRADOS * 100);
+
+    return (alto >= ALTO_GRAFICO - 1) ? 0 : (uint8_t)(ALTO_GRAFICO - 1 - alto);
+}
+
+/**
+ * @brief Dibuja una columna del gráfico: la borra, marca el umbral y une la línea con
+ * la columna anterior (si la hay)
+ */
+static void DibujarColumna(uint8_t c)
+{
+    uint16_t x0 = c * ANCHO_COLUMNA, x1 = x0 + ANCHO_COLUMNA - 1;
+    uint8_t umbral = AlturaGrafico(config_tablero.umbral_cdeg);
+    uint8_t y = columnas[c], previa;
+    uint16_t color;
+
+    ILI9341DrawFilledRectangle(x0, GRAFICO_Y, x1, ILI9341_HEIGHT - 1, COLOR_FONDO);
+    ILI9341DrawPixel(x0, GRAFICO_Y + umbral, COLOR_UMBRAL);
+    if (y == SIN_DATO)
+        return;
+    color = (y < umbral) ? COLOR_MARCA_MALA : COLOR_MARCA;
+    previa = (c > 0 && columnas[c - 1] != SIN_DATO) ? columnas[c - 1] : y;
+    ILI9341DrawLine(x0, GRAFICO_Y + previa, x0, GRAFICO_Y + y, color);
+    ILI9341DrawLine(x0, GRAFICO_Y + y, x1, GRAFICO_Y + y, color);
+}
+
+/** @brief Dibuja un minuto nuevo y borra la columna siguiente (separa lo nuevo de lo viejo) */
+static void AgregarMinuto(uint16_t media_cdeg)
+{
+    columnas[columna_actual] = AlturaGrafico(media_cdeg);
+    DibujarColumna(columna_actual);
+    columna_actual = (columna_actual + 1) % COLUMNAS_GRAFICO;
+    columnas[columna_actual] = SIN_DATO;
+    DibujarColumna(columna_actual);
+}
+
+/**
+ * @brief Escribe un valor de 0 a 99 con dos dígitos (como "%02u")
+ */
+static uint8_t FmtDosDigitos(char *texto, uint32_t valor)
+{
+    char *p = texto;
+
+    if (valor < 10)
+        p += FmtStr(p, "0");
+    p += FmtUint(p, valor, 10);
+    return p - texto;
+}
+
+/**
+ * @brief Dibuja todo una vez: la escena completa, las marcas del indicador y el gráfico
+ */
+static void DibujarFondo(void)
+{
+    uint16_t x0, y0, x1, y1;
+
+    ILI9341Init(config_tablero.spi, config_tablero.dc, config_tablero.rst);
+    ILI9341Rotate(ILI9341_Portrait_2);
+    // Escena: los ítems se dibujan en el orden en que se agregan
+    ILI9341SceneInit(COLOR_FONDO);
+    franja_id = ILI9341SceneAddRect(0, 0, ILI9341_WIDTH - 1, ALTO_FRANJA - 1, estados[POSTURE_HISTORY_STATES].fondo);
+    estado_id = ILI9341SceneAddText(10, 10, estados[POSTURE_HISTORY_STATES].texto, &font_30,
+                                    estados[POSTURE_HISTORY_STATES].letra, estados[POSTURE_HISTORY_STATES].fondo);
+    grados_id = ILI9341SceneAddText(GRADOS_X, GRADOS_Y, "0", &font_59, COLOR_TEXTO, COLOR_FONDO);
+    ILI9341SceneAddText(GRADOS_X + 80, GRADOS_Y + 30, "grados", &font_19, COLOR_TEXTO, COLOR_FONDO);
+    ILI9341SceneAddText(10, SESION_Y, "Sesion", &font_22, COLOR_TEXTO, COLOR_FONDO);
+    sesion_id = ILI9341SceneAddText(100, SESION_Y, "00:00:00", &font_22, COLOR_TEXTO, COLOR_FONDO);
+    ILI9341SceneInvalidate(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1);
+    ILI9341SceneFlush();
+
+    // Marcas del indicador, fuera del alcance de la aguja
+    for (uint8_t g = 0; g <= TABLERO_RANGO_GRADOS; g += PASO_MARCAS)
+    {
+        PuntoIndicador(g, RADIO_MARCAS, &x0, &y0);
+        PuntoIndicador(g, RADIO_ARCO, &x1, &y1);
+        ILI9341DrawLine(x0, y0, x1, y1, (g * 100 >= config_tablero.umbral_cdeg) ? COLOR_MARCA_MALA : COLOR_MARCA);
+    }
+    DibujarAguja(0, COLOR_AGUJA);
+    ILI9341DrawFilledCircle(CENTRO_X, CENTRO_Y, RADIO_EJE, COLOR_AGUJA);
+
+    for (uint8_t c = 0; c < COLUMNAS_GRAFICO; c++)
+        DibujarColumna(c);
+}
+
+/**
+ * @brief Tarea del tablero: compara el último dato con lo que está en pantalla y
+ * redibuja sólo las partes que cambiaron.
+ *
+ * Cada ítem se vuelca (ILI9341SceneFlush) apenas cambia: así las zonas sucias de
+ * ítems distintos no se unen en una ventana que pase sobre la aguja o el gráfico,
+ * que no son parte de la escena.
+ */
+static void TareaTablero(void *pvParameter)
+{
+    TickType_t despertar;
+    tablero_dato_t dato;
+    uint8_t estado_mostrado = UINT8_MAX, estado;
+    uint8_t grados_mostrados = 0, grados, aguja;
+    uint32_t segundos_mostrados = 0, segundos;
+    uint16_t media_cdeg;
+    char texto[SCENE_MAX_TEXT + 1], *p;
+
+    DibujarFondo();
+    despertar = xTaskGetTickCount();
+    while (true)
+    {
+        vTaskDelayUntil(&despertar, pdMS_TO_TICKS(TABLERO_PERIODO_MS));
+        SeqlockRead(&dato_tablero, &dato);
+        estado = dato.calibrado ? dato.estado : POSTURE_HISTORY_STATES;
+        if (estado > POSTURE_HISTORY_STATES)
+            estado = POSTURE_HISTORY_STATES;
+        grados = (dato.angulo_cdeg >= 9950) ? 99 : (uint8_t)((dato.angulo_cdeg + 50) / 100);
+        segundos = (uint32_t)(esp_timer_get_time() / 1000000);
+
+        PowerBurstBegin();
+        if (estado != estado_mostrado)
+        {
+            estado_mostrado = estado;
+            ILI9341SceneSetColor(franja_id, estados[estado].fondo, 0);
+            ILI9341SceneSetColor(estado_id, estados[estado].letra, estados[estado].fondo);
+            ILI9341SceneSetText(estado_id, estados[estado].texto);
+            ILI9341SceneFlush();
+        }
+        if (grados != grados_mostrados)
+        {
+            // La aguja sólo se mueve dentro del rango; los grados se muestran siempre
+            aguja = (grados > TABLERO_RANGO_GRADOS) ? TABLERO_RANGO_GRADOS : grados;
+            if (aguja != ((grados_mostrados > TABLERO_RANGO_GRADOS) ? TABLERO_RANGO_GRADOS : grados_mostrados))
+            {
+                DibujarAguja((grados_mostrados > TABLERO_RANGO_GRADOS) ? TABLERO_RANGO_GRADOS : grados_mostrados, COLOR_FONDO);
+                DibujarAguja(aguja, COLOR_AGUJA);
+                ILI9341DrawFilledCircle(CENTRO_X, CENTRO_Y, RADIO_EJE, COLOR_AGUJA);
+            }
+            grados_mostrados = grados;
+            FmtUint(texto, grados, 10);
+            ILI9341SceneSetText(grados_id, texto);
+            ILI9341SceneFlush();
+        }
+        if (segundos != segundos_mostrados)
+        {
+            segundos_mostrados = segundos;
+            p = texto;
+            p += FmtDosDigitos(p, segundos / 3600 % 100);
+            p += FmtStr(p, ":");
+            p += FmtDosDigitos(p, segundos / 60 % 60);
+            p += FmtStr(p, ":");
+            FmtDosDigitos(p, segundos % 60);
+            ILI9341SceneSetText(sesion_id, texto);
+            ILI9341SceneFlush();
+        }
+        while (SpscRingPop(&minutos_tablero, &media_cdeg))
+            AgregarMinuto(media_cdeg);
+        PowerBurstEnd();
+    }
+}
+/*==================[external functions definition]==========================*/
+bool TableroInit(const tablero_config_t *config, const posture_history_ring_t *anillo)
+{
+    uint16_t cantidad = 0, indice;
+
+    config_tablero = *config;
+    for (uint8_t c = 0; c < COLUMNAS_GRAFICO; c++)
+        columnas[c] = SIN_DATO;
+    // Minutos guardados, del más viejo al más nuevo, desde la primera columna
+    if (anillo != NULL)
+        cantidad = (anillo->count < COLUMNAS_GRAFICO - 1) ? anillo->count : COLUMNAS_GRAFICO - 1;
+    for (uint16_t k = 0; k < cantidad; k++)
+    {
+        indice = (anillo->head + POSTURE_HISTORY_LEN - cantidad + k) % POSTURE_HISTORY_LEN;
+        columnas[k] = AlturaGrafico(anillo->entries[indice].mean_cdeg);
+    }
+    columna_actual = cantidad;
+    return xTaskCreate(TareaTablero, "Tablero", PILA_TABLERO, NULL, config->prioridad, NULL) == pdPASS;
+}
+
+void TableroActualizar(const tablero_dato_t *dato)
+{
+    SeqlockWrite(&dato_tablero, dato);
+}
+
+void TableroMinuto(uint16_t media_cdeg)
+{
+    SpscRingPush(&minutos_tablero, &media_cdeg);
+}
+
+/*==================[end of file]============================================*/
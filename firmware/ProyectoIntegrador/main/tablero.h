@@ -0,0 +1,106 @@
+#ifndef TABLERO_H_
+#define TABLERO_H_
+/** \addtogroup Tablero Tablero
+ ** @{ */
+
+/** \brief Tablero de PostureCare en el display ILI9341 (CONFIG_DRIVERS_ILI9341).
+ *
+ * Muestra, de arriba hacia abajo: una franja con el estado de la postura (con el
+ * color del LED que lo indica), un indicador de aguja con la inclinación (0 a
+ * TABLERO_RANGO_GRADOS, con las marcas por encima del umbral en rojo), la
+ * inclinación en grados, el tiempo de sesión y la inclinación media de cada
+ * minuto de las últimas 2 horas (historial por minuto).
+ *
+ * Sólo se redibuja lo que cambia. La franja, los grados y el tiempo son ítems de
+ * la escena (ili9341_scene.h): cambiar el texto marca sólo los caracteres que
+ * cambiaron y cada actualización envía esos caracteres. La aguja y el gráfico del
+ * historial se dibujan directamente, en zonas donde no hay ítems: la aguja se
+ * borra y se vuelve a dibujar (dos líneas) sólo cuando cambia el grado mostrado,
+ * y cada minuto nuevo dibuja una columna del gráfico (barrido, como un monitor).
+ *
+ * Una tarea de prioridad baja inicializa el display y lo actualiza cada
+ * TABLERO_PERIODO_MS con el último dato de TableroActualizar(): con la postura
+ * quieta no envía nada por SPI, y un cambio típico (aguja y dos dígitos) son unos
+ * pocos cientos de píxeles.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ * @author Anahí Chaves (natalia.chaves@ingenieria.uner.edu.ar)
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "spi_mcu.h"
+#include "gpio_mcu.h"
+#include "posture_history.h"
+/*==================[macros]=================================================*/
+/**
+ * @def TABLERO_PERIODO_MS
+ * @brief Período de actualización del tablero en ms
+ */
+#define TABLERO_PERIODO_MS 200
+
+/**
+ * @def TABLERO_RANGO_GRADOS
+ * @brief Inclinación en el extremo derecho del indicador y en el borde superior del gráfico
+ */
+#define TABLERO_RANGO_GRADOS 60
+/*==================[typedef]================================================*/
+/**
+ * @struct tablero_config_t
+ * @brief Conexión del display y umbral de la postura
+ */
+typedef struct
+{
+    spi_dev_t spi;          /**< Dispositivo SPI del display */
+    gpio_t dc;              /**< Pin DC/RS del display */
+    gpio_t rst;             /**< Pin RESET del display */
+    uint16_t umbral_cdeg;   /**< Inclinación de mala postura (centésimas de grado), marcas en rojo */
+    uint8_t prioridad;      /**< Prioridad de la tarea del tablero */
+} tablero_config_t;
+
+/**
+ * @struct tablero_dato_t
+ * @brief Estado de la postura que muestra el tablero
+ */
+typedef struct
+{
+    uint16_t angulo_cdeg;   /**< Inclinación (centésimas de grado) */
+    uint8_t estado;         /**< Estado de la postura (posture_state_t) */
+    bool calibrado;         /**< false mientras se calibra */
+} tablero_dato_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Crea la tarea del tablero, que inicializa el display y dibuja el historial
+ *
+ * @param config Conexión del display y umbral
+ * @param anillo Historial por minuto ya guardado (se copian las medias), NULL si no hay
+ * @return true si se creó la tarea
+ */
+bool TableroInit(const tablero_config_t *config, const posture_history_ring_t *anillo);
+
+/**
+ * @brief Publica el último estado de la postura (de una sola tarea, p. ej. Eventos)
+ *
+ * @param dato Estado de la postura
+ */
+void TableroActualizar(const tablero_dato_t *dato);
+
+/**
+ * @brief Agrega un minuto cerrado al gráfico del historial (de la misma tarea que TableroActualizar)
+ *
+ * @param media_cdeg Inclinación media del minuto (centésimas de grado)
+ */
+void TableroMinuto(uint16_t media_cdeg);
+
+/** @} doxygen end group definition */
+#endif /* TABLERO_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,198 @@
+/**
+ * @file postura_lp.c
+ * @brief Vigilancia de la postura en el núcleo LP mientras el HP duerme (deep sleep)
+ *
+ * El temporizador LP despierta al núcleo cada vigilancia.periodo_ms. En cada despertar
+ * se lee la aceleración del MPU6050 por LP I2C (GPIO_6 SDA, GPIO_7 SCL), se compara con
+ * la posición de referencia mediante los cosenos de los umbrales (un producto escalar y
+ * comparaciones enteras, sin raíz ni arcocoseno) y se actualiza la misma máquina de
+ * estados que usa el HP (middelware/posture_engine). El HP se despierta sólo cuando
+ * cambia el estado, cuando vence la ventana de sincronización BLE o si el sensor deja
+ * de responder.
+ *
+ * @note El ADXL335 no se puede leer desde el núcleo LP (el ESP32-C6 no tiene ADC en el
+ * dominio LP): la vigilancia usa sólo el MPU6050.
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ulp_lp_core_utils.h"
+#include "ulp_lp_core_i2c.h"
+#include "posture_engine.h"
+#include "postura_lp.h"
+/*==================[macros and definitions]=================================*/
+/**
+ * @def MPU6050_DIRECCION
+ * @brief Dirección I2C del MPU6050 (AD0 a GND)
+ */
+#define MPU6050_DIRECCION 0x68
+/**
+ * @def MPU6050_ACCEL_XOUT_H
+ * @brief Primer registro de la aceleración (X, Y, Z en big endian)
+ */
+#define MPU6050_ACCEL_XOUT_H 0x3B
+/**
+ * @def MPU6050_PWR_MGMT_2
+ * @brief Registro de reposo de cada eje del acelerómetro y del giróscopo
+ */
+#define MPU6050_PWR_MGMT_2 0x6C
+/**
+ * @def GIROSCOPO_EN_REPOSO
+ * @brief PWR_MGMT_2 con los tres ejes del giróscopo en reposo (la vigilancia no los usa)
+ */
+#define GIROSCOPO_EN_REPOSO 0x07
+/**
+ * @def TIMEOUT_I2C
+ * @brief Espera máxima de cada transacción LP I2C (ciclos del núcleo LP)
+ */
+#define TIMEOUT_I2C 5000
+/**
+ * @def ERRORES_MAXIMOS
+ * @brief Lecturas fallidas seguidas tras las que se despierta al HP
+ */
+#define ERRORES_MAXIMOS 10
+
+/*==================[internal data definition]===============================*/
+/** @brief Configuración y resultados, compartidos con el HP (ulp_vigilancia) */
+vigilancia_lp_t vigilancia;
+
+/** @brief Máquina de estados, igual a la del HP */
+static posture_engine_t motor;
+/** @brief Marca temporal de la última muestra (us desde que el HP se durmió) */
+static int64_t tiempo_us;
+/** @brief Lecturas fallidas seguidas */
+static uint32_t errores_seguidos;
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Escribe un registro del MPU6050.
+ * @param registro Registro
+ * @param valor Valor
+ */
+static void EscribirRegistro(uint8_t registro, uint8_t valor)
+{
+    uint8_t datos[2] = {registro, valor};
+
+    lp_core_i2c_master_write_to_device(LP_I2C_NUM_0, MPU6050_DIRECCION, datos, sizeof(datos), TIMEOUT_I2C);
+}
+
+/**
+ * @brief Lee la aceleración del MPU6050 (cuentas del conversor, los ejes sin escalar).
+ * @param a Aceleración en X, Y y Z
+ * @return true si la lectura fue exitosa
+ */
+static bool LeerAceleracion(int16_t a[3])
+{
+    uint8_t registro = MPU6050_ACCEL_XOUT_H;
+    uint8_t datos[6];
+
+    if (lp_core_i2c_master_write_read_device(LP_I2C_NUM_0, MPU6050_DIRECCION, &registro, 1,
+                                             datos, sizeof(datos), TIMEOUT_I2C) != ESP_OK)
+        return false;
+    for (uint8_t i = 0; i < 3; i++)
+        a[i] = (int16_t)((datos[2 * i] << 8) | datos[2 * i + 1]);
+    return true;
+}
+
+/**
+ * @brief Verifica si la inclinación supera un umbral, dado por su coseno.
+ *
+ * La inclinación supera el umbral si a·ref < cos·|a| (ref normalizada). Para no calcular
+ * |a| se comparan los cuadrados, teniendo en cuenta los signos.
+ * @param a Aceleración
+ * @param cos_q15 Coseno del umbral (Q15)
+ * @return true si la inclinación supera el umbral
+ */
+static bool SuperaUmbral(const int16_t a[3], int16_t cos_q15)
+{
+    int64_t escalar = 0;
+    uint64_t modulo2 = 0;
+    uint64_t escalar2, limite2;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        escalar += (int32_t)a[i] * vigilancia.ref_q15[i];
+        modulo2 += (uint64_t)((int32_t)a[i] * a[i]);
+    }
+    // escalar está en Q15: su cuadrado y cos² · |a|² quedan los dos en Q30
+    escalar2 = (uint64_t)(escalar * escalar);
+    limite2 = (uint64_t)((int32_t)cos_q15 * cos_q15) * modulo2;
+    if (cos_q15 >= 0)
+        return (escalar < 0) || (escalar2 < limite2);
+    return (escalar < 0) && (escalar2 > limite2);
+}
+
+/**
+ * @brief Ángulo equivalente para la máquina de estados.
+ *
+ * La máquina de estados sólo compara el ángulo con los umbrales de entrada y de salida,
+ * así que alcanza con un valor del lado correcto de cada uno.
+ * @param a Aceleración
+ * @return Ángulo (centésimas de grado) con las mismas comparaciones que el real
+ */
+static uint16_t AnguloEquivalente(const int16_t a[3])
+{
+    if (SuperaUmbral(a, vigilancia.cos_entrada_q15))
+        return vigilancia.config.enter_cdeg + 1;
+    if (SuperaUmbral(a, vigilancia.cos_salida_q15))
+        return vigilancia.config.exit_cdeg;
+    return 0;
+}
+
+/**
+ * @brief Despierta al HP (una sola vez: el HP detiene al núcleo LP al arrancar).
+ * @param motivo Motivo del despertar
+ */
+static void DespertarHp(motivo_despertar_t motivo)
+{
+    if (vigilancia.motivo != DESPERTAR_NINGUNO)
+        return;
+    vigilancia.motivo = motivo;
+    // El HP vuelve a usar el giróscopo
+    EscribirRegistro(MPU6050_PWR_MGMT_2, 0);
+    ulp_lp_core_wakeup_main_processor();
+}
+
+/*==================[external functions definition]==========================*/
+int main(void)
+{
+    int16_t a[3];
+    posture_state_t anterior;
+
+    if (!vigilancia.iniciado)
+    {
+        vigilancia.iniciado = 1;
+        PostureEngineInit(&motor, &vigilancia.config);
+        tiempo_us = 0;
+        errores_seguidos = 0;
+        EscribirRegistro(MPU6050_PWR_MGMT_2, GIROSCOPO_EN_REPOSO);
+    }
+    tiempo_us += vigilancia.periodo_ms * 1000LL;
+    vigilancia.vigilado_ms += vigilancia.periodo_ms;
+
+    if (!LeerAceleracion(a))
+    {
+        vigilancia.errores_i2c++;
+        if (++errores_seguidos >= ERRORES_MAXIMOS)
+            DespertarHp(DESPERTAR_SENSOR);
+        return 0;
+    }
+    errores_seguidos = 0;
+    vigilancia.muestras++;
+
+    anterior = motor.state;
+    vigilancia.estado = PostureEngineUpdate(&motor, AnguloEquivalente(a), tiempo_us);
+    vigilancia.tiempo_mala_ms = PostureEngineBadTime(&motor, tiempo_us);
+    if (vigilancia.tiempo_mala_ms > 0)
+        vigilancia.mala_total_ms += vigilancia.periodo_ms;
+
+    if (vigilancia.estado != anterior)
+        DespertarHp(DESPERTAR_ESTADO);
+    else if (vigilancia.sincronizacion_ms > 0 && vigilancia.vigilado_ms >= vigilancia.sincronizacion_ms)
+        DespertarHp(DESPERTAR_SINCRONIZACION);
+    // Al volver, el núcleo LP se detiene hasta el próximo despertar del temporizador
+    return 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,51 @@
+/**
+ * @file postura_lp.h
+ * @brief Datos compartidos entre PostureCare (núcleo HP) y el programa de vigilancia del núcleo LP
+ *
+ * El HP completa la configuración antes de dormir y lee los resultados al despertar
+ * (ulp_vigilancia, ver EntrarVigilancia() y SalirVigilancia() en ProyectoIntegrador.c).
+ */
+#ifndef POSTURA_LP_H_
+#define POSTURA_LP_H_
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "posture_engine.h"
+/*==================[macros and definitions]=================================*/
+
+/**
+ * @brief Motivo por el que el núcleo LP despertó al HP
+ */
+typedef enum
+{
+    DESPERTAR_NINGUNO = 0,      /**< El HP sigue durmiendo */
+    DESPERTAR_ESTADO,           /**< Cambió el estado de la postura */
+    DESPERTAR_SINCRONIZACION,   /**< Ventana de sincronización BLE */
+    DESPERTAR_SENSOR,           /**< El MPU6050 dejó de responder */
+} motivo_despertar_t;
+
+/**
+ * @struct vigilancia_lp_t
+ * @brief Configuración y resultados de la vigilancia en el núcleo LP
+ */
+typedef struct
+{
+    /* Escrito por el HP antes de dormir */
+    int16_t ref_q15[3];             /**< Posición de referencia del MPU6050, normalizada (Q15) */
+    int16_t cos_entrada_q15;        /**< Coseno del umbral de inclinación (Q15) */
+    int16_t cos_salida_q15;         /**< Coseno del umbral de salida (Q15) */
+    posture_engine_config_t config; /**< Umbrales y tiempos de la máquina de estados */
+    uint32_t periodo_ms;            /**< Período de muestreo (despertares del núcleo LP) */
+    uint32_t sincronizacion_ms;     /**< Despertar al HP cada este tiempo (0: nunca) */
+    uint32_t iniciado;              /**< 0: el núcleo LP inicia su estado en la próxima muestra */
+    /* Escrito por el núcleo LP */
+    uint32_t estado;                /**< posture_state_t de la última muestra */
+    uint32_t tiempo_mala_ms;        /**< Duración del período de mala postura en curso (ms) */
+    uint32_t mala_total_ms;         /**< Tiempo total en mala postura desde que el HP se durmió (ms) */
+    uint32_t vigilado_ms;           /**< Tiempo desde que el HP se durmió (ms) */
+    uint32_t muestras;              /**< Muestras leídas */
+    uint32_t errores_i2c;           /**< Lecturas fallidas */
+    uint32_t motivo;                /**< motivo_despertar_t */
+} vigilancia_lp_t;
+
+#endif /* POSTURA_LP_H_ */
@@ -0,0 +1,341 @@
+/*! @mainpage Benchmark DSP en host
+ *
+ * @section genDesc General Description
+ *
+ * Programa para PC (ver CMakeLists.txt) que pasa la señal de ECG del ejemplo
+ * DSP (examples/ej_dsp/main/ecg.h) por los filtros y la FFT de la capa
+ * middelware, compilados con los kernels ANSI de esp-dsp.
+ *
+ * - Mide el tiempo de cada procesamiento (clock_gettime) y lo imprime como una
+ *   tabla CSV, una fila por medición con el prefijo "BENCH".
+ * - Guarda las salidas de cada procesamiento en un archivo de referencia
+ *   (-g archivo) o las compara con uno guardado antes (-c archivo), para
+ *   detectar cambios en los resultados sin grabar la placa.
+ *
+ * Uso: dsp_host_bench [-g archivo | -c archivo] [-t tolerancia] [-n repeticiones]
+ *
+ * La tolerancia es relativa al máximo valor absoluto de cada salida (1e-4 por
+ * defecto). Si alguna salida difiere de la referencia, o no está en el archivo,
+ * el programa termina con código 1. La referencia de los kernels ANSI está en
+ * dsp_host_bench.ref y ctest la compara (ver CMakeLists.txt).
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ * | 15/10/2026 | FFT de varios canales (FFTMagnitudeMulti)      |
+ * | 15/10/2026 | Espectro de potencia de Welch                  |
+ * | 15/10/2026 | Filtro IIR en punto fijo (IirQ15Filter)        |
+ * | 15/10/2026 | Conversiones de formato por bloque             |
+ * | 15/10/2026 | Salida sin referencia como falla               |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include "iir_filter.h"
+#include "fir_filter.h"
+#include "fft.h"
+#include "welch.h"
+#include "sample_convert.h"
+#include "ecg.h"
+/*==================[macros and definitions]=================================*/
+#define LONG_LENGTH			(8 * ECG_LENGTH)	/*!< ECG repetido, para la FFT de 2048 puntos */
+#define FIR_TAPS			31
+#define REPETITIONS			1000
+#define TOLERANCE			1e-4f
+#define MAX_NAME			32
+#define CHANNELS			4					/*!< Canales de la FFT de varios canales */
+#define CHANNEL_SHIFT		37					/*!< Desfasaje entre canales (muestras) */
+#define WELCH_FRAME			128					/*!< Segmentos de la estimación de Welch */
+#define WELCH_DEPTH			8					/*!< Segmentos promediados */
+
+typedef struct {
+	const char *name;				/*!< Nombre de la salida en el archivo de referencia */
+	const char *funcion;			/*!< Función medida */
+	const char *parametro;			/*!< Parámetros */
+	void (*init)(void);				/*!< Inicialización (no se mide) */
+	void (*run)(void);				/*!< Procesamiento medido */
+	uint16_t samples;				/*!< Muestras procesadas */
+	float *output;					/*!< Salida */
+	uint16_t length;				/*!< Largo de la salida */
+} bench_t;
+/*==================[internal data definition]===============================*/
+static float ecg_long[LONG_LENGTH];
+static float ecg_filt[ECG_LENGTH];
+static float iir_out[ECG_LENGTH];
+static float fir_out[ECG_LENGTH];
+static float fft_out[LONG_LENGTH / 2];
+static float fft_q15_out[ECG_LENGTH / 2];
+static int16_t ecg_q15[ECG_LENGTH];
+static uint16_t fft_q15[ECG_LENGTH / 2];
+static float multi_out[CHANNELS * ECG_LENGTH / 2];
+static float *multi_signals[CHANNELS];
+static float *multi_ffts[CHANNELS];
+static stft_t stft;
+static welch_t welch;
+static float welch_out[WELCH_FRAME / 2];
+static iir_filter_t iir;
+static iir_q15_filter_t iir_q15;
+static int16_t iir_q15_buffer[ECG_LENGTH];
+static float iir_q15_out[ECG_LENGTH];
+static fir_filter_t fir;
+static float fir_coeff[FIR_TAPS];
+/*==================[internal functions declaration]=========================*/
+/* Filtrado del ejemplo DSP: pasa bajos de 40 Hz y pasa altos de 1 Hz, orden 4 */
+static void InitEcgFilter(void){
+	LowPassInit(ECG_SAMPLE_FREQ, 40, ORDER_4);
+	HiPassInit(ECG_SAMPLE_FREQ, 1, ORDER_4);
+}
+
+static void RunEcgFilter(void){
+	LowPassFilter(ecg, ecg_filt, ECG_LENGTH);
+	HiPassFilter(ecg_filt, ecg_filt, ECG_LENGTH);
+}
+
+static void InitIir8(void){
+	IirLowPassInit(&iir, ECG_SAMPLE_FREQ, 20, ORDER_8);
+}
+
+static void RunIir8(void){
+	IirFilter(&iir, ecg, iir_out, ECG_LENGTH);
+}
+
+static void InitIirQ15(void){
+	IirQ15LowPassInit(&iir_q15, ECG_SAMPLE_FREQ, 40, ORDER_4);
+}
+
+static void RunIirQ15(void){
+	IirQ15Filter(&iir_q15, ecg_q15, iir_q15_buffer, ECG_LENGTH);
+	/* de vuelta a cuentas del ADC, para comparar con el filtro en float */
+	SampleConvertI16ToF32(iir_q15_buffer, iir_q15_out, ECG_LENGTH, -128 * 128, 1.0f / 128);
+}
+
+static void InitFir(void){
+	FirLowPassDesign(fir_coeff, FIR_TAPS, ECG_SAMPLE_FREQ, 40, FIR_WINDOW_HAMMING);
+	FirInit(&fir, fir_coeff, FIR_TAPS);
+}
+
+static void RunFir(void){
+	FirFilter(&fir, ecg, fir_out, ECG_LENGTH);
+}
+
+static void InitFFTRadix2(void){
+	FFTInitRadix(FFT_RADIX_2);
+}
+
+static void InitFFTRadix4(void){
+	FFTInitRadix(FFT_RADIX_4);
+}
+
+static void RunFFT256(void){
+	FFTMagnitude(ecg, fft_out, ECG_LENGTH);
+}
+
+static void RunFFT2048(void){
+	FFTMagnitude(ecg_long, fft_out, LONG_LENGTH);
+}
+
+static void RunFFTFiltered(void){
+	FFTMagnitude(ecg_filt, fft_out, ECG_LENGTH);
+}
+
+static void InitFFTQ15(void){
+	FFTInitQ15();
+}
+
+static void RunFFTQ15(void){
+	FFTMagnitudeQ15(ecg_q15, fft_q15, ECG_LENGTH);
+	SampleConvertU16ToF32(fft_q15, fft_q15_out, ECG_LENGTH / 2, 0, 1);
+}
+
+static void RunFFTChannels(void){
+	for(uint8_t c = 0; c < CHANNELS; c++){
+		FFTMagnitude(multi_signals[c], multi_ffts[c], ECG_LENGTH);
+	}
+}
+
+static void RunFFTMulti(void){
+	FFTMagnitudeMulti(multi_signals, multi_ffts, CHANNELS, ECG_LENGTH);
+}
+
+static void CopyWelch(const float *spectrum, uint16_t n_bins, void *param){
+	(void)param;
+	memcpy(welch_out, spectrum, n_bins * sizeof(float));
+}
+
+static void InitWelch(void){
+	FFTInit();
+	StftInit(&stft, WELCH_FRAME, STFT_OVERLAP_50);
+	WelchInit(&welch, &stft, WELCH_DEPTH);
+	WelchSubscribe(&welch, CopyWelch, NULL);
+}
+
+static void RunWelch(void){
+	/* 2048 muestras: 31 segmentos con 50% de solapamiento */
+	for(uint16_t i = 0; i < LONG_LENGTH; i += WELCH_FRAME / 2){
+		StftPushBlock(&stft, &ecg_long[i], WELCH_FRAME / 2);
+		StftProcess(&stft);
+	}
+}
+
+static const bench_t benchs[] = {
+	{"ecg_filtrado", "LowPassFilter+HiPassFilter", "orden=4", InitEcgFilter, RunEcgFilter, ECG_LENGTH, ecg_filt, ECG_LENGTH},
+	{"iir_orden_8", "IirFilter", "orden=8", InitIir8, RunIir8, ECG_LENGTH, iir_out, ECG_LENGTH},
+	{"iir_q15_orden_4", "IirQ15Filter", "orden=4", InitIirQ15, RunIirQ15, ECG_LENGTH, iir_q15_out, ECG_LENGTH},
+	{"fir_31", "FirFilter", "taps=31", InitFir, RunFir, ECG_LENGTH, fir_out, ECG_LENGTH},
+	{"fft_radix2_256", "FFTMagnitude", "radix2 N=256", InitFFTRadix2, RunFFT256, ECG_LENGTH, fft_out, ECG_LENGTH / 2},
+	{"fft_radix2_2048", "FFTMagnitude", "radix2 N=2048", InitFFTRadix2, RunFFT2048, LONG_LENGTH, fft_out, LONG_LENGTH / 2},
+	{"fft_radix4_256", "FFTMagnitude", "radix4 N=256", InitFFTRadix4, RunFFT256, ECG_LENGTH, fft_out, ECG_LENGTH / 2},
+	{"fft_radix4_2048", "FFTMagnitude", "radix4 N=2048", InitFFTRadix4, RunFFT2048, LONG_LENGTH, fft_out, LONG_LENGTH / 2},
+	{"fft_ecg_filtrado", "FFTMagnitude", "N=256", InitFFTRadix2, RunFFTFiltered, ECG_LENGTH, fft_out, ECG_LENGTH / 2},
+	{"fft_q15_256", "FFTMagnitudeQ15", "N=256", InitFFTQ15, RunFFTQ15, ECG_LENGTH, fft_q15_out, ECG_LENGTH / 2},
+	{"fft_4_canales", "FFTMagnitude", "4 canales N=256", InitFFTRadix2, RunFFTChannels, CHANNELS * ECG_LENGTH, multi_out, CHANNELS * ECG_LENGTH / 2},
+	{"fft_multi_4_canales", "FFTMagnitudeMulti", "4 canales N=256", InitFFTRadix2, RunFFTMulti, CHANNELS * ECG_LENGTH, multi_out, CHANNELS * ECG_LENGTH / 2},
+	{"welch_128", "StftProcess+Welch", "N=128 50% prom=8", InitWelch, RunWelch, LONG_LENGTH, welch_out, WELCH_FRAME / 2},
+};
+#define N_BENCHS	(sizeof(benchs) / sizeof(benchs[0]))
+
+static float reference[LONG_LENGTH];
+/*==================[internal functions definition]==========================*/
+static double Milliseconds(void){
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1e3 + now.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief Mide un procesamiento e imprime una fila de la tabla
+ */
+static void BenchRun(const bench_t *bench, uint32_t repetitions){
+	double start, total;
+
+	bench->init();
+	start = Milliseconds();
+	for(uint32_t i = 0; i < repetitions; i++){
+		bench->run();
+	}
+	total = Milliseconds() - start;
+	printf("BENCH,%s,%s,%u,%u,%.3f,%.3f,%.2f\n", bench->funcion, bench->parametro, bench->samples,
+		   repetitions, total, total * 1e3 / repetitions, total * 1e6 / repetitions / bench->samples);
+}
+
+/**
+ * @brief Salida de un procesamiento desde su inicialización
+ */
+static void BenchOutput(const bench_t *bench){
+	bench->init();
+	bench->run();
+}
+
+static void SaveOutput(FILE *file, const bench_t *bench){
+	fprintf(file, "%s %u", bench->name, bench->length);
+	for(uint16_t i = 0; i < bench->length; i++){
+		fprintf(file, " %.9g", bench->output[i]);
+	}
+	fprintf(file, "\n");
+}
+
+/**
+ * @brief Compara una salida con la de referencia
+ *
+ * @return float Máxima diferencia relativa al máximo de la referencia (<0: no está en el archivo)
+ */
+static float CompareOutput(FILE *file, const bench_t *bench){
+	char name[MAX_NAME];
+	unsigned length;
+	float max = 0, error = 0;
+
+	rewind(file);
+	while(fscanf(file, "%31s %u", name, &length) == 2){
+		bool found = (strcmp(name, bench->name) == 0 && length == bench->length);
+		for(uint16_t i = 0; i < length; i++){
+			if(fscanf(file, "%f", found ? &reference[i] : &max) != 1){
+				return -1;
+			}
+		}
+		if(found){
+			max = 0;
+			for(uint16_t i = 0; i < length; i++){
+				max = fmaxf(max, fabsf(reference[i]));
+				error = fmaxf(error, fabsf(bench->output[i] - reference[i]));
+			}
+			return (max > 0) ? error / max : error;
+		}
+	}
+	return -1;
+}
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+	const char *save = NULL, *check = NULL;
+	float tolerance = TOLERANCE, error;
+	uint32_t repetitions = REPETITIONS;
+	FILE *file = NULL;
+	int opt, failed = 0;
+
+	while((opt = getopt(argc, argv, "g:c:t:n:")) != -1){
+		switch(opt){
+			case 'g': save = optarg; break;
+			case 'c': check = optarg; break;
+			case 't': tolerance = strtof(optarg, NULL); break;
+			case 'n': repetitions = strtoul(optarg, NULL, 10); break;
+			default:
+				fprintf(stderr, "Uso: %s [-g archivo | -c archivo] [-t tolerancia] [-n repeticiones]\n", argv[0]);
+				return 2;
+		}
+	}
+	for(uint16_t i = 0; i < LONG_LENGTH; i++){
+		ecg_long[i] = ecg[i % ECG_LENGTH];
+	}
+	for(uint16_t i = 0; i < ECG_LENGTH; i++){
+		/* cuentas del ADC (0 a 255) centradas, en Q15 con 6 bits de margen */
+		ecg_q15[i] = (int16_t)((ecg[i] - 128) * 128);
+	}
+	for(uint8_t c = 0; c < CHANNELS; c++){
+		multi_signals[c] = &ecg_long[c * CHANNEL_SHIFT];
+		multi_ffts[c] = &multi_out[c * ECG_LENGTH / 2];
+	}
+	FFTInit();
+
+	/* Salidas */
+	if(save != NULL || check != NULL){
+		file = fopen(save ? save : check, save ? "w" : "r");
+		if(file == NULL){
+			perror(save ? save : check);
+			return 2;
+		}
+		for(uint8_t j = 0; j < N_BENCHS; j++){
+			BenchOutput(&benchs[j]);
+			if(save != NULL){
+				SaveOutput(file, &benchs[j]);
+				continue;
+			}
+			error = CompareOutput(file, &benchs[j]);
+			if(error < 0){
+				printf("# %s: sin referencia FALLA\n", benchs[j].name);
+				failed = 1;
+			} else {
+				printf("# %s: error %.2e %s\n", benchs[j].name, error, (error > tolerance) ? "FALLA" : "ok");
+				failed |= (error > tolerance);
+			}
+		}
+		fclose(file);
+	}
+
+	/* Tiempos */
+	printf("BENCH,funcion,parametro,unidades,repeticiones,ms_total,us_media,ns_por_unidad\n");
+	for(uint8_t j = 0; j < N_BENCHS; j++){
+		BenchRun(&benchs[j], repetitions);
+	}
+	return failed;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,10 @@
+/**
+ * @file esp_attr.h
+ * @brief Host build: memory placement attributes have no effect
+ */
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
@@ -0,0 +1,5 @@
+/**
+ * @file esp_cpu.h
+ * @brief Host build: no CPU specific code (esp-dsp uses its ANSI kernels)
+ */
+#pragma once
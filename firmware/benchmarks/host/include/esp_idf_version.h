@@ -0,0 +1,8 @@
+/**
+ * @file esp_idf_version.h
+ * @brief Host build: the IDF version the firmware is built with
+ */
+#pragma once
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch)    (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION                             ESP_IDF_VERSION_VAL(5, 2, 0)
@@ -0,0 +1,28 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host build: the FreeRTOS types used by the middelware, on pthreads
+ */
+#pragma once
+#include <stdint.h>
+#include <pthread.h>
+
+typedef uint32_t TickType_t;
+typedef pthread_t TaskHandle_t;
+typedef pthread_mutex_t portMUX_TYPE;
+
+/**
+ * @brief Recursive mutex that knows its holder
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_t holder;
+    uint32_t depth;
+} StaticSemaphore_t;
+typedef StaticSemaphore_t *SemaphoreHandle_t;
+
+#define portMAX_DELAY                   UINT32_MAX
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define portMUX_INITIALIZER_UNLOCKED    PTHREAD_MUTEX_INITIALIZER
+#define taskENTER_CRITICAL(mux)         pthread_mutex_lock(mux)
+#define taskEXIT_CRITICAL(mux)          pthread_mutex_unlock(mux)
@@ -0,0 +1,5 @@
+/**
+ * @file portable.h
+ * @brief Host build: nothing port specific
+ */
+#pragma once
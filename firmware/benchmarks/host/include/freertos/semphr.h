@@ -0,0 +1,41 @@
+/**
+ * @file semphr.h
+ * @brief Host build: static recursive mutexes on pthreads
+ *
+ * Only the calls made by the middelware are provided. Waits are always
+ * unbounded, the tick count is ignored.
+ */
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *buffer){
+    pthread_mutex_init(&buffer->mutex, NULL);
+    buffer->depth = 0;
+    return buffer;
+}
+
+static inline int xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks){
+    (void)ticks;
+    if(semaphore->depth == 0 || !pthread_equal(semaphore->holder, pthread_self())){
+        pthread_mutex_lock(&semaphore->mutex);
+        semaphore->holder = pthread_self();
+    }
+    semaphore->depth++;
+    return pdTRUE;
+}
+
+static inline int xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore){
+    if(semaphore->depth == 0 || !pthread_equal(semaphore->holder, pthread_self())){
+        return pdFALSE;
+    }
+    if(--semaphore->depth == 0){
+        pthread_mutex_unlock(&semaphore->mutex);
+    }
+    return pdTRUE;
+}
+
+/* Holder of a taken mutex, the caller itself compares equal only if it holds it */
+static inline TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t semaphore){
+    return (semaphore->depth > 0) ? semaphore->holder : (TaskHandle_t)0;
+}
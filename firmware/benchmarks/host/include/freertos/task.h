@@ -0,0 +1,8 @@
+/**
+ * @file task.h
+ * @brief Host build: task handles are threads
+ */
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+#define xTaskGetCurrentTaskHandle()     pthread_self()
@@ -0,0 +1,11 @@
+/**
+ * @file power_mcu.h
+ * @brief Host build: no power management, the frequency bursts do nothing
+ */
+#pragma once
+
+static inline void PowerBurstBegin(void){
+}
+
+static inline void PowerBurstEnd(void){
+}
@@ -0,0 +1,13 @@
+/**
+ * @file sdkconfig.h
+ * @brief Host build configuration (menuconfig defaults of the middelware component)
+ */
+#pragma once
+
+#ifndef CONFIG_MIDDELWARE_DSP_SCRATCH_SIZE
+#define CONFIG_MIDDELWARE_DSP_SCRATCH_SIZE  16384
+#endif
+#define CONFIG_MIDDELWARE_DSP_FFT           1
+#define CONFIG_MIDDELWARE_DSP_WINDOWS       1
+#define CONFIG_MIDDELWARE_DSP_IIR           1
+#define CONFIG_MIDDELWARE_DSP_FIR           1
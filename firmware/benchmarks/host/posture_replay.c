@@ -0,0 +1,422 @@
+/*! @mainpage Reproducción de muestras de postura en host
+ *
+ * @section genDesc General Description
+ *
+ * Programa para PC (ver CMakeLists.txt) que pasa muestras crudas del ADXL335
+ * por la detección de postura de PostureCare (middelware/posture_pipeline:
+ * filtros, calibración, inclinación y máquina de estados), con la misma
+ * configuración que ProyectoIntegrador.c y a la velocidad de la PC.
+ *
+ * - Las muestras salen de una grabación descargada de la placa con 'V'
+ *   (bloques flash_log_header_t seguidos de registros de 6 bytes, tal como
+ *   llegan por Bluetooth; "-" lee de la entrada estándar) o de una señal
+ *   sintética de -m minutos (postura correcta con inclinaciones de 20° de
+ *   2, 4 y 8 s, repetidas cada 30 s).
+ * - Imprime los cambios de estado (-e), la cantidad de advertencias y alertas,
+ *   el tiempo en cada estado y las muestras por segundo procesadas.
+ * - Guarda los cambios de estado en un archivo de referencia (-g archivo) o
+ *   los compara con uno guardado antes (-c archivo), para verificar que un
+ *   cambio en la capa middelware no cambia las decisiones.
+ *
+ * - Con -z error_mg comprime cada eje en ventanas de VENTANA_DCT muestras con
+ *   dct_codec (error RMS de error_mg mili-g), imprime el tamaño comprimido y el
+ *   error, y reproduce las muestras descomprimidas: con -c y la referencia de la
+ *   grabación original muestra si la compresión cambia las decisiones.
+ *
+ * Cada una de las -n repeticiones empieza de cero (calibración incluida) y
+ * debe dar exactamente los mismos cambios de estado que la primera.
+ *
+ * Uso: posture_replay [-m minutos | grabacion] [-n repeticiones] [-e] [-z error_mg] [-g archivo | -c archivo]
+ *
+ * Termina con código 1 si alguna repetición o la referencia difieren.
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ * | 15/10/2026 | Rechazo de picos, como ProyectoIntegrador.c	 |
+ * | 15/10/2026 | Clasificador de actividad, como ProyectoIntegrador.c |
+ * | 15/10/2026 | Compresión DCT de la grabación (-z)            |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include "posture_pipeline.h"
+#include "flash_log.h"
+#include "dct_codec.h"
+#include "postura_actividad.h"
+/*==================[macros and definitions]=================================*/
+/* Configuración de ProyectoIntegrador.c */
+#define FRECUENCIA_MUESTREO_AC	400
+#define FRECUENCIA_POSTURA		100
+#define UMBRAL_INCLINACION		12.0f
+#define UMBRAL_SALIDA			10.0f
+#define PERMANENCIA_MINIMA		500
+#define TIEMPO_ADVERTENCIA		3000
+#define TIEMPO_ALERTA			5000
+#define TIEMPO_CALIBRACION		3000
+#define DISPERSION_MAXIMA		0.03f
+#define DERIVA_MAXIMA			0.05f
+
+#define PERIODO_US				(1000000 / FRECUENCIA_MUESTREO_AC)
+#define MAX_EVENTOS				100000
+#define PI						3.14159265f
+#define VENTANA_DCT				64		/* Muestras por bloque comprimido (160 ms) */
+
+/* Registro de la grabación (muestra_cruda_t de ProyectoIntegrador.c) */
+typedef struct __attribute__((packed)) {
+	int16_t ax_mg;
+	int16_t ay_mg;
+	int16_t az_mg;
+} muestra_cruda_t;
+
+/* Cambio de estado de la postura */
+typedef struct {
+	int64_t timestamp_us;
+	uint16_t angulo_cdeg;
+	uint8_t estado;
+} evento_t;
+
+/* Resultado de una reproducción */
+typedef struct {
+	uint32_t decisiones;			/*!< Salidas con calibración */
+	uint32_t advertencias;
+	uint32_t alertas;
+	uint64_t tiempo_estado_us[3];	/*!< Tiempo en cada estado */
+	uint32_t eventos;				/*!< Cambios de estado */
+	uint32_t calibraciones;
+	uint32_t hash;					/*!< Hash de los cambios de estado (FNV-1a) */
+} resultado_t;
+/*==================[internal data definition]===============================*/
+static muestra_cruda_t *muestras = NULL;
+static int64_t *tiempos = NULL;
+static size_t cantidad = 0;
+static evento_t eventos[MAX_EVENTOS];
+
+static const filter_stage_config_t etapas_filtro[] = {
+	{.type = STAGE_SPIKE, .window = 5, .threshold = 0.3f},
+	{.type = STAGE_LOW_PASS, .cut_frec = 5.0f, .order = ORDER_2},
+	{.type = STAGE_DECIMATE, .factor = 4},
+};
+
+static const posture_pipeline_config_t config_postura = {
+	.stages = etapas_filtro,
+	.n_stages = sizeof(etapas_filtro) / sizeof(etapas_filtro[0]),
+	.output_frec = FRECUENCIA_POSTURA,
+	.threshold_deg = UMBRAL_INCLINACION,
+	.calibration_ms = TIEMPO_CALIBRACION,
+	.max_dispersion = DISPERSION_MAXIMA,
+	.max_drift = DERIVA_MAXIMA,
+	.engine = {
+		.enter_cdeg = (uint16_t)(UMBRAL_INCLINACION * 100),
+		.exit_cdeg = (uint16_t)(UMBRAL_SALIDA * 100),
+		.dwell_ms = PERMANENCIA_MINIMA,
+		.warning_ms = TIEMPO_ADVERTENCIA,
+		.alert_ms = TIEMPO_ALERTA,
+	},
+	.activity_model = &postura_actividad,
+};
+/*==================[internal functions declaration]=========================*/
+static bool Agregar(const muestra_cruda_t *muestra, int64_t tiempo_us){
+	static size_t capacidad = 0;
+
+	if(cantidad == capacidad){
+		capacidad = capacidad ? 2 * capacidad : 65536;
+		muestras = realloc(muestras, capacidad * sizeof(muestra_cruda_t));
+		tiempos = realloc(tiempos, capacidad * sizeof(int64_t));
+		if(muestras == NULL || tiempos == NULL){
+			return false;
+		}
+	}
+	muestras[cantidad] = *muestra;
+	tiempos[cantidad] = tiempo_us;
+	cantidad++;
+	return true;
+}
+
+/**
+ * @brief Lee una grabación descargada con 'V' (hasta la cabecera con count = 0)
+ */
+static bool LeerGrabacion(const char *nombre){
+	FILE *archivo = strcmp(nombre, "-") ? fopen(nombre, "rb") : stdin;
+	flash_log_header_t cabecera;
+	muestra_cruda_t muestra;
+	int64_t desplazamiento = 0, ultimo_us = -1, tiempo_us;
+
+	if(archivo == NULL){
+		perror(nombre);
+		return false;
+	}
+	while(fread(&cabecera, sizeof(cabecera), 1, archivo) == 1 && cabecera.magic == FLASH_LOG_MAGIC &&
+		  cabecera.count > 0 && cabecera.record_size == sizeof(muestra_cruda_t)){
+		for(uint16_t i = 0; i < cabecera.count; i++){
+			if(fread(&muestra, sizeof(muestra), 1, archivo) != 1){
+				break;
+			}
+			tiempo_us = (int64_t)cabecera.first_ms * 1000 + (int64_t)i * PERIODO_US + desplazamiento;
+			if(tiempo_us <= ultimo_us){
+				/* otra sesión (la placa se reinició): sigue después de la anterior */
+				desplazamiento += ultimo_us + PERIODO_US - tiempo_us;
+				tiempo_us = ultimo_us + PERIODO_US;
+			}
+			ultimo_us = tiempo_us;
+			if(!Agregar(&muestra, tiempo_us)){
+				return false;
+			}
+		}
+	}
+	if(archivo != stdin){
+		fclose(archivo);
+	}
+	return cantidad > 0;
+}
+
+/**
+ * @brief Señal sintética: postura correcta con inclinaciones hacia adelante de 2, 4 y 8 s cada 30 s
+ */
+static bool GenerarSintetica(uint32_t minutos){
+	const uint32_t inclinacion_s[] = {2, 4, 8};
+	uint32_t semilla = 1;
+	muestra_cruda_t muestra;
+	float angulo, ruido[3];
+	uint32_t segundo, ciclo;
+
+	for(size_t n = 0; n < (size_t)minutos * 60 * FRECUENCIA_MUESTREO_AC; n++){
+		segundo = n / FRECUENCIA_MUESTREO_AC;
+		ciclo = segundo / 30;
+		angulo = (segundo >= 10 && (segundo % 30) < inclinacion_s[ciclo % 3]) ? 20.0f : 0.0f;
+		for(uint8_t eje = 0; eje < 3; eje++){
+			semilla = semilla * 1664525u + 1013904223u;
+			ruido[eje] = ((int32_t)(semilla >> 16) % 21 - 10) / 1000.0f;	/* ±10 mili-g */
+		}
+		muestra.ax_mg = (int16_t)lrintf((sinf(angulo * PI / 180) + ruido[0]) * 1000);
+		muestra.ay_mg = (int16_t)lrintf(ruido[1] * 1000);
+		muestra.az_mg = (int16_t)lrintf((cosf(angulo * PI / 180) + ruido[2]) * 1000);
+		if(!Agregar(&muestra, (int64_t)n * PERIODO_US)){
+			return false;
+		}
+	}
+	return true;
+}
+
+static uint32_t Fnv1a(uint32_t hash, const void *dato, size_t largo){
+	const uint8_t *byte = dato;
+
+	for(size_t i = 0; i < largo; i++){
+		hash = (hash ^ byte[i]) * 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * @brief Pasa todas las muestras por un pipeline nuevo
+ *
+ * @param guardar	Guarda los cambios de estado en eventos[]
+ */
+static void Reproducir(resultado_t *resultado, bool guardar){
+	static posture_pipeline_t pipeline;
+	posture_output_t salida[POSTURE_PIPELINE_BLOCK];
+	posture_cal_result_t calibracion;
+	const float frecuencia = FRECUENCIA_MUESTREO_AC;
+	uint8_t estado = POSTURE_CORRECT, n;
+	int64_t anterior_us = -1;
+	evento_t evento;
+
+	memset(resultado, 0, sizeof(*resultado));
+	resultado->hash = 2166136261u;
+	PosturePipelineInit(&pipeline, &config_postura, &frecuencia, 1);
+	for(size_t i = 0; i < cantidad; i++){
+		n = PosturePipelineAdd(&pipeline, 0, muestras[i].ax_mg / 1000.0f, muestras[i].ay_mg / 1000.0f,
+							   muestras[i].az_mg / 1000.0f, tiempos[i], salida);
+		for(uint8_t k = 0; k < n; k++){
+			if(anterior_us >= 0){
+				resultado->tiempo_estado_us[estado] += salida[k].timestamp_us - anterior_us;
+			}
+			anterior_us = salida[k].timestamp_us;
+			if(!salida[k].calibrated){
+				continue;
+			}
+			resultado->decisiones++;
+			if(salida[k].state != estado){
+				estado = salida[k].state;
+				resultado->advertencias += (estado == POSTURE_WARNING);
+				resultado->alertas += (estado == POSTURE_ALERT);
+				evento.timestamp_us = salida[k].timestamp_us;
+				evento.angulo_cdeg = salida[k].angle_cdeg;
+				evento.estado = estado;
+				resultado->hash = Fnv1a(resultado->hash, &evento.timestamp_us, sizeof(evento.timestamp_us));
+				resultado->hash = Fnv1a(resultado->hash, &evento.estado, sizeof(evento.estado));
+				if(guardar && resultado->eventos < MAX_EVENTOS){
+					eventos[resultado->eventos] = evento;
+				}
+				resultado->eventos++;
+			}
+		}
+		if(PosturePipelineTakeCalibration(&pipeline, &calibracion)){
+			resultado->calibraciones++;
+		}
+	}
+}
+
+/**
+ * @brief Compara los cambios de estado con los de un archivo de referencia
+ *
+ * @return uint32_t Cantidad de diferencias
+ */
+static uint32_t Comparar(FILE *archivo, uint32_t cantidad_eventos){
+	long long tiempo;
+	unsigned estado, angulo;
+	uint32_t i = 0, diferencias = 0;
+
+	while(fscanf(archivo, "%lld %u %u", &tiempo, &estado, &angulo) == 3){
+		if(i >= cantidad_eventos || eventos[i].timestamp_us != tiempo || eventos[i].estado != estado){
+			if(diferencias++ == 0){
+				printf("# primera diferencia: evento %u (%lld ms, estado %u)\n", i, tiempo / 1000, estado);
+			}
+		}
+		i++;
+	}
+	return diferencias + ((i < cantidad_eventos) ? cantidad_eventos - i : 0);
+}
+/*==================[external functions definition]==========================*/
+/**
+ * @brief Comprime y descomprime cada eje de las muestras (reemplaza las muestras)
+ */
+static bool Comprimir(float error_mg){
+	int16_t eje[VENTANA_DCT], salida[VENTANA_DCT];
+	uint8_t bloque[DCT_CODEC_MAX_BYTES(VENTANA_DCT)];
+	size_t bytes = 0, ventanas = cantidad / VENTANA_DCT;
+	double cuadrados = 0;
+	int16_t *campo;
+	uint16_t largo;
+	int maximo = 0;
+
+	if(!DctCodecInit()){
+		return false;
+	}
+	for(size_t v = 0; v < ventanas; v++){
+		for(uint8_t e = 0; e < 3; e++){
+			for(uint16_t i = 0; i < VENTANA_DCT; i++){
+				campo = &muestras[v * VENTANA_DCT + i].ax_mg + e;
+				eje[i] = *campo;
+			}
+			largo = DctCodecEncode(eje, VENTANA_DCT, DCT_CODEC_STEP_FOR_RMS(error_mg), bloque);
+			if(largo == 0 || DctCodecDecode(bloque, largo, VENTANA_DCT, salida) != largo){
+				return false;
+			}
+			bytes += largo;
+			for(uint16_t i = 0; i < VENTANA_DCT; i++){
+				campo = &muestras[v * VENTANA_DCT + i].ax_mg + e;
+				cuadrados += (double)(salida[i] - *campo) * (salida[i] - *campo);
+				maximo = abs(salida[i] - *campo) > maximo ? abs(salida[i] - *campo) : maximo;
+				*campo = salida[i];
+			}
+		}
+	}
+	if(ventanas == 0){
+		return false;
+	}
+	printf("# DCT: %zu ventanas de %u muestras por eje\n", ventanas, VENTANA_DCT);
+	printf("DCT,error_pedido_mg,bytes_crudos,bytes_comprimidos,relacion,error_rms_mg,error_max_mg,bytes_por_hora\n");
+	printf("DCT,%.1f,%zu,%zu,%.1f,%.2f,%d,%.0f\n", error_mg, ventanas * VENTANA_DCT * sizeof(muestra_cruda_t), bytes,
+		   (double)ventanas * VENTANA_DCT * sizeof(muestra_cruda_t) / bytes, sqrt(cuadrados / (3.0 * ventanas * VENTANA_DCT)),
+		   maximo, bytes * 3600.0 * FRECUENCIA_MUESTREO_AC / ((double)ventanas * VENTANA_DCT));
+	return true;
+}
+
+int main(int argc, char *argv[]){
+	const char *save = NULL, *check = NULL;
+	uint32_t repeticiones = 10, minutos = 0, diferencias;
+	float error_mg = 0;
+	bool listar = false;
+	resultado_t resultado, primero;
+	struct timespec inicio, fin;
+	FILE *archivo;
+	double segundos;
+	int opt, failed = 0;
+
+	while((opt = getopt(argc, argv, "m:n:ez:g:c:")) != -1){
+		switch(opt){
+			case 'm': minutos = strtoul(optarg, NULL, 10); break;
+			case 'n': repeticiones = strtoul(optarg, NULL, 10); break;
+			case 'e': listar = true; break;
+			case 'z': error_mg = strtof(optarg, NULL); break;
+			case 'g': save = optarg; break;
+			case 'c': check = optarg; break;
+			default:
+				fprintf(stderr, "Uso: %s [-m minutos | grabacion] [-n repeticiones] [-e] [-z error_mg] [-g archivo | -c archivo]\n",
+						argv[0]);
+				return 2;
+		}
+	}
+	if(minutos > 0 ? !GenerarSintetica(minutos) : (optind >= argc || !LeerGrabacion(argv[optind]))){
+		fprintf(stderr, "Sin muestras (indicar una grabación o -m minutos)\n");
+		return 2;
+	}
+	if(error_mg > 0 && !Comprimir(error_mg)){
+		fprintf(stderr, "No se pudo comprimir (menos de %u muestras o ventana inválida)\n", VENTANA_DCT);
+		return 2;
+	}
+	repeticiones = repeticiones ? repeticiones : 1;
+
+	/* Decisiones */
+	Reproducir(&primero, true);
+	if(listar){
+		printf("EVENTO,ms,estado,angulo_cdeg\n");
+		for(uint32_t i = 0; i < primero.eventos && i < MAX_EVENTOS; i++){
+			printf("EVENTO,%lld,%u,%u\n", (long long)(eventos[i].timestamp_us / 1000), eventos[i].estado,
+				   eventos[i].angulo_cdeg);
+		}
+	}
+	if(save != NULL || check != NULL){
+		archivo = fopen(save ? save : check, save ? "w" : "r");
+		if(archivo == NULL){
+			perror(save ? save : check);
+			return 2;
+		}
+		if(save != NULL){
+			for(uint32_t i = 0; i < primero.eventos && i < MAX_EVENTOS; i++){
+				fprintf(archivo, "%lld %u %u\n", (long long)eventos[i].timestamp_us, eventos[i].estado,
+						eventos[i].angulo_cdeg);
+			}
+		} else {
+			diferencias = Comparar(archivo, primero.eventos);
+			printf("# referencia: %u diferencias %s\n", diferencias, diferencias ? "FALLA" : "ok");
+			failed |= (diferencias > 0);
+		}
+		fclose(archivo);
+	}
+
+	/* Repeticiones: mismas decisiones y tiempo */
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for(uint32_t r = 0; r < repeticiones; r++){
+		Reproducir(&resultado, false);
+		if(resultado.hash != primero.hash || resultado.eventos != primero.eventos){
+			printf("# repeticion %u: decisiones distintas FALLA\n", r);
+			failed = 1;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	segundos = (fin.tv_sec - inicio.tv_sec) + (fin.tv_nsec - inicio.tv_nsec) / 1e9;
+
+	printf("# %zu muestras (%.1f min), %u calibraciones, %u decisiones\n", cantidad,
+		   cantidad / (60.0 * FRECUENCIA_MUESTREO_AC), primero.calibraciones, primero.decisiones);
+	printf("# %u advertencias, %u alertas, %u cambios de estado\n", primero.advertencias, primero.alertas,
+		   primero.eventos);
+	printf("# tiempo en cada estado: correcta %.1f s, advertencia %.1f s, alerta %.1f s\n",
+		   primero.tiempo_estado_us[0] / 1e6, primero.tiempo_estado_us[1] / 1e6, primero.tiempo_estado_us[2] / 1e6);
+	printf("REPLAY,muestras,repeticiones,ms_total,muestras_por_s,veces_tiempo_real\n");
+	printf("REPLAY,%zu,%u,%.1f,%.0f,%.0f\n", cantidad, repeticiones, segundos * 1000,
+		   cantidad * repeticiones / segundos, cantidad * repeticiones / (segundos * FRECUENCIA_MUESTREO_AC));
+	return failed;
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,356 @@
+/*! @mainpage Benchmarks
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto mide en la placa el costo de las funciones de drivers y
+ * middelware más usadas, contando ciclos de CPU (esp_cpu_get_cycle_count):
+ *
+ * - FFTMagnitude de 256, 1024 y 2048 puntos
+ * - LowPassFilter de orden 2 a 8
+ * - PostureAngle y PostureAngleFixed (ángulo de desviación de la postura)
+ * - ILI9341DrawString, ILI9341DrawLine e ILI9341DrawPicture
+ * - BleSendString (costo de encolar el mensaje, no de transmitirlo)
+ * - I2C_readBytes (MPU6050) y SpiWrite (latencia de la transacción)
+ *
+ * Cada medición se repite varias veces y se informa el mínimo y la media de
+ * ciclos por llamada, los ciclos por unidad (muestra, pixel o byte) y el tiempo
+ * medio en microsegundos (esp_timer, incluye el tiempo en que la CPU espera a
+ * los periféricos). Los resultados se imprimen por consola como una tabla CSV,
+ * una fila por medición con el prefijo "BENCH", para poder filtrarla del resto
+ * de los mensajes y compararla entre versiones. Al final de las mediciones del
+ * LCD y del I2C se imprimen los contadores de uso de cada bus (SpiGetStats,
+ * I2C_getStats): comandos frente a bytes de pixels, tiempo de bus y de espera.
+ * Con un dispositivo BLE conectado se imprimen también las estadísticas del
+ * enlace (BleGetLinkStats): MTU, intervalo de conexión, PHY, RSSI y tasas.
+ * Al final se imprime el uso de memoria (MemReportPrint).
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    ILI9341		|   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	SDO/MISO 	| 	GPIO_22		|
+ * | 	LED		 	| 	3V3			|
+ * | 	SCK		 	| 	GPIO_20		|
+ * | 	SDI/MOSI 	| 	GPIO_21		|
+ * | 	DC/RS	 	| 	GPIO_9		|
+ * | 	RESET	 	| 	GPIO_18		|
+ * | 	CS		 	| 	GPIO_19		|
+ * | 	GND		 	| 	GND			|
+ * | 	VCC		 	| 	3V3			|
+ *
+ * El MPU6050 se conecta al bus I2C de la ESP-EDU. Sin el dispositivo la
+ * lectura falla y se mide el tiempo hasta el error.
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ * | 15/10/2026 | Contadores de uso de los buses SPI e I2C       |
+ * | 15/10/2026 | Estadísticas del enlace BLE                    |
+ * | 15/10/2026 | Reporte de uso de memoria                      |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "fft.h"
+#include "iir_filter.h"
+#include "posture_math.h"
+#include "dsp_scratch.h"
+#include "ili9341.h"
+#include "fonts.h"
+#include "spi_mcu.h"
+#include "gpio_mcu.h"
+#include "i2c_mcu.h"
+#include "mpu6050.h"
+#include "ble_mcu.h"
+#include "mem_report.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_FREQ			200
+#define CUT_FREQ			20
+#define FFT_MAX_LENGTH		2048
+#define IIR_LENGTH			256
+#define POSTURE_SAMPLES		64
+#define PIC_SIZE			64			/*!< Lado de la imagen de prueba (pixels) */
+#define REPETITIONS			10
+#define BUS_REPETITIONS		16
+#define BLE_REPETITIONS		4			/*!< Menos que los buffers de transmisión: no bloquea */
+#define BLE_WAIT_S			30			/*!< Espera de la conexión BLE */
+#define I2C_CLOCK			400000
+#define SPI_MAX_LENGTH		1024
+/*==================[internal data definition]===============================*/
+typedef void (*bench_func_t)(void);
+
+static float signal[FFT_MAX_LENGTH];
+static float output[FFT_MAX_LENGTH];
+static float acc_x[POSTURE_SAMPLES], acc_y[POSTURE_SAMPLES], acc_z[POSTURE_SAMPLES];
+static int16_t acc_x_q[POSTURE_SAMPLES], acc_y_q[POSTURE_SAMPLES], acc_z_q[POSTURE_SAMPLES];
+static posture_ref_t posture;
+static volatile float angle_sink;
+static volatile uint16_t angle_fixed_sink;
+/* la de RAM va directo al driver de SPI, la de flash se copia por franjas */
+static uint8_t pic_ram[PIC_SIZE * PIC_SIZE * 2] __attribute__((aligned(4)));
+static const uint8_t pic_flash[PIC_SIZE * PIC_SIZE * 2] = {0xF8, 0x00};
+static char text[] = "ESP-EDU benchmark";
+static const char ble_text[] = "*D123.4*\n";
+static uint8_t bus_data[SPI_MAX_LENGTH];
+static uint16_t bench_length;				/*!< Parámetro de la medición en curso */
+static uint8_t bench_reg;
+static uint16_t line_x1, line_y1;
+static uint32_t overhead;					/*!< Ciclos de una medición vacía */
+/*==================[internal functions declaration]=========================*/
+static void BenchEmpty(void){
+}
+
+static void BenchFFT(void){
+	FFTMagnitude(signal, output, bench_length);
+}
+
+static void BenchLowPass(void){
+	LowPassFilter(signal, output, IIR_LENGTH);
+}
+
+static void BenchPostureAngle(void){
+	for(uint8_t i = 0; i < POSTURE_SAMPLES; i++){
+		angle_sink = PostureAngle(&posture, acc_x[i], acc_y[i], acc_z[i]);
+	}
+}
+
+static void BenchPostureAngleFixed(void){
+	for(uint8_t i = 0; i < POSTURE_SAMPLES; i++){
+		angle_fixed_sink = PostureAngleFixed(&posture, acc_x_q[i], acc_y_q[i], acc_z_q[i]);
+	}
+}
+
+static void BenchDrawString11(void){
+	ILI9341DrawString(0, 0, text, &font_11, ILI9341_WHITE, ILI9341_BLACK);
+}
+
+static void BenchDrawString22(void){
+	ILI9341DrawString(0, 20, text, &font_22, ILI9341_WHITE, ILI9341_BLACK);
+}
+
+static void BenchDrawLine(void){
+	ILI9341DrawLine(0, 0, line_x1, line_y1, ILI9341_RED);
+}
+
+static void BenchDrawPictureRam(void){
+	ILI9341DrawPicture(0, 100, PIC_SIZE, PIC_SIZE, pic_ram);
+}
+
+static void BenchDrawPictureFlash(void){
+	ILI9341DrawPicture(PIC_SIZE, 100, PIC_SIZE, PIC_SIZE, pic_flash);
+}
+
+static void BenchBleSendString(void){
+	BleSendString(ble_text);
+}
+
+static void BenchI2CRead(void){
+	I2C_readBytes(MPU6050_DEFAULT_ADDRESS, bench_reg, bench_length, bus_data, 0);
+}
+
+static void BenchSpiWrite(void){
+	SpiWrite(SPI_1, bus_data, bench_length);
+}
+
+/**
+ * @brief Ciclos de CPU de una llamada a func
+ */
+static __attribute__((noinline)) uint32_t MeasureCycles(bench_func_t func){
+	uint32_t start = esp_cpu_get_cycle_count();
+	func();
+	return esp_cpu_get_cycle_count() - start;
+}
+
+/**
+ * @brief Mide una función e imprime una fila de la tabla
+ *
+ * @param modulo Capa o driver
+ * @param funcion Función medida
+ * @param parametro Parámetro de la medición (tamaño, orden, etc.)
+ * @param unidades Muestras, pixels o bytes procesados por llamada
+ * @param repeticiones Cantidad de llamadas
+ * @param func Función a medir
+ */
+static void BenchRun(const char *modulo, const char *funcion, const char *parametro,
+					 uint32_t unidades, uint16_t repeticiones, bench_func_t func){
+	uint32_t cycles, min = UINT32_MAX;
+	uint64_t total = 0;
+	int64_t start_us, time_us = 0;
+
+	for(uint16_t i = 0; i < repeticiones; i++){
+		start_us = esp_timer_get_time();
+		cycles = MeasureCycles(func);
+		time_us += esp_timer_get_time() - start_us;
+		cycles = (cycles > overhead) ? cycles - overhead : 0;
+		if(cycles < min){
+			min = cycles;
+		}
+		total += cycles;
+	}
+	printf("BENCH,%s,%s,%s,%lu,%u,%lu,%lu,%.2f,%.1f\n", modulo, funcion, parametro,
+		   unidades, repeticiones, min, (uint32_t)(total / repeticiones),
+		   (float)total / repeticiones / unidades, (float)time_us / repeticiones);
+}
+
+static void BenchDsp(void){
+	uint16_t lengths[] = {256, 1024, 2048};
+	filter_order_t orders[] = {ORDER_2, ORDER_4, ORDER_6, ORDER_8};
+	char param[16];
+
+	/* Señal de prueba: suma de dos senoidales */
+	for(uint16_t i = 0; i < FFT_MAX_LENGTH; i++){
+		signal[i] = sinf(2 * (float)M_PI * 5 * i / SAMPLE_FREQ) + 0.5f * sinf(2 * (float)M_PI * 60 * i / SAMPLE_FREQ);
+	}
+	FFTInit();
+	for(uint8_t j = 0; j < sizeof(lengths) / sizeof(lengths[0]); j++){
+		bench_length = lengths[j];
+		sprintf(param, "N=%u", bench_length);
+		BenchRun("middelware", "FFTMagnitude", param, bench_length, REPETITIONS, BenchFFT);
+	}
+	for(uint8_t j = 0; j < sizeof(orders) / sizeof(orders[0]); j++){
+		LowPassInit(SAMPLE_FREQ, CUT_FREQ, orders[j]);
+		sprintf(param, "orden=%d", orders[j]);
+		BenchRun("middelware", "LowPassFilter", param, IIR_LENGTH, REPETITIONS, BenchLowPass);
+	}
+	printf("# DspScratchPeak: %u bytes\n", (unsigned)DspScratchPeak());
+}
+
+static void BenchPosture(void){
+	/* Inclinaciones de 0 a 180 grados alrededor del eje X, en g y en mili-g */
+	for(uint8_t i = 0; i < POSTURE_SAMPLES; i++){
+		float theta = (float)M_PI * i / (POSTURE_SAMPLES - 1);
+		acc_x[i] = 0.05f;
+		acc_y[i] = sinf(theta);
+		acc_z[i] = cosf(theta);
+		acc_x_q[i] = (int16_t)lroundf(1000 * acc_x[i]);
+		acc_y_q[i] = (int16_t)lroundf(1000 * acc_y[i]);
+		acc_z_q[i] = (int16_t)lroundf(1000 * acc_z[i]);
+	}
+	PostureRefInit(&posture, 0, 0, 1, 30);
+	BenchRun("middelware", "PostureAngle", "-", POSTURE_SAMPLES, REPETITIONS, BenchPostureAngle);
+	BenchRun("middelware", "PostureAngleFixed", "-", POSTURE_SAMPLES, REPETITIONS, BenchPostureAngleFixed);
+}
+
+/**
+ * @brief Imprime un histograma de tiempos con bins de potencias de dos
+ */
+static void PrintHistogram(const char *titulo, const uint32_t *bins, uint8_t n_bins, uint32_t primero_us){
+	printf("#   %s:", titulo);
+	for(uint8_t i = 0; i < n_bins; i++){
+		printf(" %s%lu:%lu", (i == 0) ? "<" : "", (i == 0) ? primero_us : primero_us << (i - 1), bins[i]);
+	}
+	printf(" (us:transacciones)\n");
+}
+
+static void BenchLcd(void){
+	spi_stats_t spi_stats;
+
+	char param[16];
+
+	ILI9341Init(SPI_1, GPIO_9, GPIO_18);
+	ILI9341Fill(ILI9341_BLACK);
+	/* SpiWrite sobre el dispositivo del LCD: los bytes llegan como pixels a la ventana actual */
+	for(bench_length = 4; bench_length <= SPI_MAX_LENGTH; bench_length *= 16){
+		sprintf(param, "bytes=%u", bench_length);
+		BenchRun("drivers", "SpiWrite", param, bench_length, BUS_REPETITIONS, BenchSpiWrite);
+	}
+	BenchRun("drivers", "ILI9341DrawString", "font_11", strlen(text), REPETITIONS, BenchDrawString11);
+	BenchRun("drivers", "ILI9341DrawString", "font_22", strlen(text), REPETITIONS, BenchDrawString22);
+	line_x1 = ILI9341_WIDTH - 1;
+	line_y1 = 0;
+	BenchRun("drivers", "ILI9341DrawLine", "horizontal", ILI9341_WIDTH, REPETITIONS, BenchDrawLine);
+	line_x1 = 0;
+	line_y1 = ILI9341_HEIGHT - 1;
+	BenchRun("drivers", "ILI9341DrawLine", "vertical", ILI9341_HEIGHT, REPETITIONS, BenchDrawLine);
+	line_x1 = ILI9341_WIDTH - 1;
+	BenchRun("drivers", "ILI9341DrawLine", "diagonal", ILI9341_HEIGHT, REPETITIONS, BenchDrawLine);
+	for(uint16_t i = 0; i < sizeof(pic_ram); i += 2){
+		pic_ram[i] = i >> 5;
+		pic_ram[i + 1] = i;
+	}
+	sprintf(param, "%ux%u RAM", PIC_SIZE, PIC_SIZE);
+	BenchRun("drivers", "ILI9341DrawPicture", param, PIC_SIZE * PIC_SIZE, REPETITIONS, BenchDrawPictureRam);
+	sprintf(param, "%ux%u flash", PIC_SIZE, PIC_SIZE);
+	BenchRun("drivers", "ILI9341DrawPicture", param, PIC_SIZE * PIC_SIZE, REPETITIONS, BenchDrawPictureFlash);
+	SpiGetStats(SPI_1, &spi_stats, true);
+	printf("# SPI_1: %lu transacciones (%lu comandos), %lu bytes, bus %lu us (%u por mil), espera %lu us\n",
+		   spi_stats.transactions, spi_stats.commands, spi_stats.bytes, spi_stats.busy_us, spi_stats.load,
+		   spi_stats.blocked_us);
+	PrintHistogram("tiempo de bus", spi_stats.time, SPI_TIME_BINS, 8);
+}
+
+static void BenchI2C(void){
+	i2c_stats_t i2c_stats;
+
+	I2C_initialize(I2C_CLOCK);
+	bench_reg = MPU6050_RA_WHO_AM_I;
+	bench_length = 1;
+	BenchRun("drivers", "I2C_readBytes", "bytes=1", bench_length, BUS_REPETITIONS, BenchI2CRead);
+	bench_reg = MPU6050_RA_ACCEL_XOUT_H;
+	bench_length = 14;
+	BenchRun("drivers", "I2C_readBytes", "bytes=14", bench_length, BUS_REPETITIONS, BenchI2CRead);
+	I2C_getStats(NULL, &i2c_stats, true);
+	printf("# I2C: %lu transacciones (%lu errores), %lu bytes, bus %lu us (%u por mil), espera %lu us\n",
+		   i2c_stats.transactions, i2c_stats.errors, i2c_stats.bytes, i2c_stats.busy_us, i2c_stats.load,
+		   i2c_stats.blocked_us);
+	PrintHistogram("latencia", i2c_stats.latency, I2C_LATENCY_BINS, 64);
+}
+
+static void BenchBle(void){
+	ble_link_stats_t link_stats;
+	ble_config_t ble_configuration = {
+		"ESP_EDU_BENCH",
+		BLE_NO_INT
+	};
+
+	BleInit(&ble_configuration);
+	/* sin conexión el mensaje se descarta sin copiarlo */
+	BenchRun("drivers", "BleSendString", "desconectado", strlen(ble_text), BUS_REPETITIONS, BenchBleSendString);
+	printf("# Conectar al dispositivo ESP_EDU_BENCH (%d s)\n", BLE_WAIT_S);
+	for(uint16_t i = 0; i < BLE_WAIT_S * 10 && BleStatus() != BLE_CONNECTED; i++){
+		vTaskDelay(pdMS_TO_TICKS(100));
+	}
+	if(BleStatus() == BLE_CONNECTED){
+		BenchRun("drivers", "BleSendString", "conectado", strlen(ble_text), BLE_REPETITIONS, BenchBleSendString);
+		/* las tasas se calculan cada segundo */
+		vTaskDelay(pdMS_TO_TICKS(1000));
+		BleGetLinkStats(&link_stats);
+		printf("# BLE: MTU %u, intervalo %u x 1.25 ms, latencia %u, PHY tx %u rx %u, RSSI %d dBm\n",
+			   link_stats.mtu, link_stats.interval, link_stats.latency, link_stats.tx_phy, link_stats.rx_phy,
+			   link_stats.rssi);
+		printf("# BLE: %lu notificaciones (%u/s), %lu bytes (%lu/s), cola max %u, eventos max %u, descartados %lu, bloqueados %lu\n",
+			   link_stats.notifications, link_stats.notifications_per_s, link_stats.bytes, link_stats.bytes_per_s,
+			   link_stats.queue_max, link_stats.events_max, link_stats.dropped, link_stats.blocked);
+	}
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	/* costo de la propia medición, se descuenta de cada llamada */
+	overhead = UINT32_MAX;
+	for(uint8_t i = 0; i < REPETITIONS; i++){
+		uint32_t cycles = MeasureCycles(BenchEmpty);
+		if(cycles < overhead){
+			overhead = cycles;
+		}
+	}
+	printf("# CPU: %d MHz, medicion vacia: %lu ciclos\n", CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ, overhead);
+	printf("BENCH,modulo,funcion,parametro,unidades,repeticiones,ciclos_min,ciclos_media,ciclos_por_unidad,us_media\n");
+	BenchDsp();
+	BenchPosture();
+	BenchLcd();
+	BenchI2C();
+	BenchBle();
+	MemReportPrint();
+	printf("# Fin\n");
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,170 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 20:00:00 2026
+
+@author: Albano Peñalva
+
+Genera fuentes e íconos empaquetados (FONT_PACKED / ICON_PACKED, ver fonts.h
+e icons.h) a partir de fonts.c e icons.c:
+
+    - las filas de cada glifo o ícono no se completan a un byte (solo cada
+      glifo o ícono empieza en un byte)
+    - de la fuente se guardan solo los caracteres indicados; el resto usa el
+      glifo de '?' (como ILI9341TextInit)
+    - de los íconos se guardan los del enum icon_t hasta el último indicado
+
+Se generan nombre.c y nombre.h para copiar en la carpeta main del proyecto.
+Si la aplicación usa solo las fuentes generadas (y no font_22, icon_30...)
+el enlazador descarta las de fonts.c e icons.c.
+
+Uso:
+    python font_pack.py nombre --fuente 22 --caracteres "0123456789.:- "
+    python font_pack.py nombre --fuente 30 --de main/app.c --iconos 30 --lista ICON_PLAY,ICON_PAUSE
+
+Con --de se toman los caracteres de los textos entre comillas del archivo.
+"""
+
+# Librerías
+import argparse
+import os
+import re
+
+DIRECTORIO = os.path.dirname(os.path.abspath(__file__))
+PRIMERO, ULTIMO = ' ', '~'
+
+
+def sin_comentarios(texto):
+    return re.sub(r'//[^\n]*|/\*.*?\*/', '', texto, flags=re.S)
+
+
+def arreglo(texto, nombre):
+    """Contenido entre llaves de la definición de un arreglo"""
+    inicio = texto.index('{', re.search(rf'\b{nombre}\[\]\s*=', texto).end())
+    return texto[inicio + 1:texto.index('};', inicio)]
+
+
+def leer_fuente(alto):
+    texto = sin_comentarios(open(os.path.join(DIRECTORIO, 'src', 'fonts.c'), encoding='utf-8').read())
+    datos = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]+', arreglo(texto, f'font{alto}_data'))]
+    info = [(int(a), int(o)) for a, o in re.findall(r'\{\s*(\d+)\s*,\s*(\d+)\s*\}', arreglo(texto, f'font{alto}_info'))]
+    return datos, info
+
+
+def leer_iconos(alto):
+    texto = sin_comentarios(open(os.path.join(DIRECTORIO, 'src', 'icons.c'), encoding='utf-8').read())
+    datos = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]+', arreglo(texto, f'icon{alto}_data'))]
+    alto_, ancho, offset = [int(v) for v in re.search(
+        rf'icon_{alto}\s*=\s*\{{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)', texto).groups()]
+    return datos, alto_, ancho, offset
+
+
+def lista_iconos():
+    """Nombres del enum icon_t, en orden"""
+    texto = sin_comentarios(open(os.path.join(DIRECTORIO, 'inc', 'icons.h'), encoding='utf-8').read())
+    cuerpo = texto[texto.index('typedef enum'):texto.index('icon_t;')]
+    return re.findall(r'\b(ICON_\w+)', cuerpo)
+
+
+def empaquetar(datos, inicio, ancho, alto):
+    """Bits de un mapa de 1 bit por pixel con filas completadas a byte, sin relleno"""
+    bytes_fila = (ancho + 7) // 8
+    bits = []
+    for f in range(alto):
+        fila = datos[inicio + f * bytes_fila:inicio + (f + 1) * bytes_fila]
+        for j in range(ancho):
+            bits.append((fila[j // 8] >> (7 - j % 8)) & 1)
+    bits += [0] * (-len(bits) % 8)
+    return [int(''.join(str(b) for b in bits[i:i + 8]), 2) for i in range(0, len(bits), 8)]
+
+
+def hexa(datos):
+    lineas = []
+    for i in range(0, len(datos), 16):
+        lineas.append('\t' + ', '.join(f'0x{b:02X}' for b in datos[i:i + 16]) + ',')
+    return '\n'.join(lineas)
+
+
+def fuente_empaquetada(nombre, alto, caracteres):
+    datos, info = leer_fuente(alto)
+    caracteres = set(caracteres) | {' ', '?'}
+    salida, tabla, ubicacion = [], [], {}
+    for i, (ancho, offset) in enumerate(info):
+        c = chr(ord(PRIMERO) + i)
+        if c in caracteres:
+            ubicacion[c] = (ancho, len(salida))
+            salida += empaquetar(datos, offset, ancho, alto)
+    for i in range(len(info)):
+        c = chr(ord(PRIMERO) + i)
+        tabla.append(ubicacion.get(c, ubicacion['?']) + (c,))
+    codigo = f'/**\n * @brief {alto} pixels height packed font, {len(caracteres)} characters\n */\n'
+    codigo += f'static const uint8_t {nombre}_data[] = {{\n{hexa(salida)}\n}};\n\n'
+    codigo += f'static char_info_t {nombre}_info[] = {{\n'
+    for ancho, offset, c in tabla:
+        codigo += f'\t{{{ancho}, {offset}}},\t\t/* {c} */\n'
+    codigo += '};\n\n'
+    codigo += f'Font_t {nombre} = {{\n\t{alto},\n\t{nombre}_info,\n\t{nombre}_data,\n\tFONT_PACKED\n}};\n'
+    return codigo, len(datos), len(salida)
+
+
+def iconos_empaquetados(nombre, alto, usados):
+    datos, alto_, ancho, offset = leer_iconos(alto)
+    nombres = lista_iconos()
+    ultimo = max(nombres.index(i) for i in usados)
+    salida = []
+    for i in range(ultimo + 1):
+        salida += empaquetar(datos, i * offset, ancho, alto_)
+    bytes_icono = (ancho * alto_ + 7) // 8
+    codigo = f'/**\n * @brief {ancho}x{alto_} packed icons, {nombres[0]} to {nombres[ultimo]}\n */\n'
+    codigo += f'static const uint8_t {nombre}_data[] = {{\n{hexa(salida)}\n}};\n\n'
+    codigo += f'icon_font_t {nombre} = {{\n\t{alto_},\n\t{ancho},\n\t{bytes_icono},\n\t{nombre}_data,\n\tICON_PACKED\n}};\n'
+    return codigo, len(datos), len(salida)
+
+
+def caracteres_de(archivo):
+    texto = open(archivo, encoding='utf-8').read()
+    textos = re.findall(r'"((?:[^"\\\n]|\\.)*)"', texto)
+    return {c for t in textos for c in t if PRIMERO <= c <= ULTIMO}
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Fuentes e íconos empaquetados para el ILI9341')
+    parser.add_argument('nombre', help='nombre de los archivos .c y .h generados')
+    parser.add_argument('--fuente', type=int, help='alto de la fuente de fonts.c (11, 19, 22, 30, 59, 89)')
+    parser.add_argument('--caracteres', default='', help='caracteres usados')
+    parser.add_argument('--de', action='append', default=[], help='archivo .c del que tomar los caracteres de los textos')
+    parser.add_argument('--iconos', type=int, help='alto de los íconos de icons.c (22, 30, 59, 89)')
+    parser.add_argument('--lista', default='', help='íconos usados, separados por comas (ICON_PLAY,ICON_PAUSE...)')
+    args = parser.parse_args()
+
+    if args.fuente is None and args.iconos is None:
+        parser.error('indicar --fuente y/o --iconos')
+    base = os.path.basename(args.nombre)
+    codigo = '/**\n'
+    codigo += f' * @file {base}.c\n * @brief Packed fonts and icons\n * @note Created with font_pack.py script\n */\n'
+    codigo += f'#include "{base}.h"\n\n'
+    cabecera = f'/**\n * @file {base}.h\n * @brief Packed fonts and icons\n * @note Created with font_pack.py script\n */\n'
+    cabecera += f'#ifndef {base.upper()}_H_\n#define {base.upper()}_H_\n#include "fonts.h"\n#include "icons.h"\n\n'
+
+    if args.fuente is not None:
+        caracteres = set(args.caracteres)
+        for archivo in args.de:
+            caracteres |= caracteres_de(archivo)
+        variable = f'font_{args.fuente}_{base}'
+        texto, antes, despues = fuente_empaquetada(variable, args.fuente, caracteres)
+        codigo += texto + '\n'
+        cabecera += f'extern Font_t {variable};\n'
+        print(f'{variable}: {len(caracteres | {" ", "?"})} caracteres, {antes} -> {despues} bytes')
+    if args.iconos is not None:
+        usados = [i.strip() for i in args.lista.split(',') if i.strip()] or lista_iconos()
+        variable = f'icon_{args.iconos}_{base}'
+        texto, antes, despues = iconos_empaquetados(variable, args.iconos, usados)
+        codigo += texto + '\n'
+        cabecera += f'extern icon_font_t {variable};\n'
+        print(f'{variable}: {antes} -> {despues} bytes')
+
+    cabecera += f'\n#endif /* {base.upper()}_H_ */\n'
+    with open(args.nombre + '.c', 'w', encoding='utf-8') as f:
+        f.write(codigo)
+    with open(args.nombre + '.h', 'w', encoding='utf-8') as f:
+        f.write(cabecera)
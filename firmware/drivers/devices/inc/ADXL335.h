@@ -23,18 +23,48 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261015 v0.0.4 interfaz común de sensores (ADXL335Sensor)
+ * 20261015 v0.0.3 cambio de la frecuencia de muestreo en modo continuo
+ * 20261015 v0.0.2 vigilancia de los ejes con el monitor digital del ADC
  * 20210609 v0.0.1 initials initial version
  */
 
 /*==================[inclusions]=============================================*/
 
+#include <stddef.h>
 #include "gpio_mcu.h"
 #include "analog_io_mcu.h"
+#include "sensor.h"
 
 
 /*==================[macros]=================================================*/
+/** @def ADXL335_FRAME_LEN
+ * @brief Máxima cantidad de muestras XYZ entregadas por ADXL335ReadFrame()
+ */
+#define ADXL335_FRAME_LEN	(ADC_CONT_FRAME_LEN / 3)
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Lote de muestras XYZ alineadas temporalmente (modo continuo)
+ */
+typedef struct {
+	float x[ADXL335_FRAME_LEN];		/*!< Aceleración en el eje x (g) */
+	float y[ADXL335_FRAME_LEN];		/*!< Aceleración en el eje y (g) */
+	float z[ADXL335_FRAME_LEN];		/*!< Aceleración en el eje z (g) */
+	uint16_t len;					/*!< Cantidad de muestras válidas */
+} adxl335_frame_t;
+
+/**
+ * @brief Muestra XYZ con los valores crudos del ADC y convertidos
+ */
+typedef struct {
+	int16_t raw_x;		/*!< Tensión del eje x (mV) */
+	int16_t raw_y;		/*!< Tensión del eje y (mV) */
+	int16_t raw_z;		/*!< Tensión del eje z (mV, con el divisor resistivo compensado) */
+	float x;			/*!< Aceleración en el eje x (g) */
+	float y;			/*!< Aceleración en el eje y (g) */
+	float z;			/*!< Aceleración en el eje z (g) */
+} adxl335_sample_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -45,6 +75,62 @@
  * @return 1 (true) if no error
  */
 bool ADXL335Init();
+/** @fn bool ADXL335InitContinuous(uint16_t sample_frec, uint8_t oversampling, void *func_p, void *param_p)
+ * @brief Función que inicializa el driver en modo continuo: los tres ejes se convierten
+ * por DMA en un único patrón de barrido del ADC.
+ * @param[in] sample_frec Frecuencia de muestreo por eje en Hz
+ * @param[in] oversampling Conversiones promediadas por muestra (0 o 1: sin sobremuestreo, hasta ADC_OVERSAMPLING_MAX)
+ * @param[in] func_p Función llamada (desde la ISR) al completarse cada trama DMA, NULL si no se usa
+ * @param[in] param_p Parámetro de la función func_p
+ * @return 1 (true) if no error
+ */
+bool ADXL335InitContinuous(uint16_t sample_frec, uint8_t oversampling, void *func_p, void *param_p);
+/** @fn bool ADXL335SetFrequency(uint16_t sample_frec)
+ * @brief Función que cambia la frecuencia de muestreo del modo continuo, cada eje conserva su
+ * sobremuestreo. Se pierden las tramas DMA acumuladas; no usar mientras el monitor vigila.
+ * @param[in] sample_frec Frecuencia de muestreo por eje en Hz
+ * @return 1 (true) if no error
+ */
+bool ADXL335SetFrequency(uint16_t sample_frec);
+/** @fn uint16_t ADXL335ReadFrame(adxl335_frame_t *frame)
+ * @brief Función que lee la próxima trama DMA y la entrega como muestras XYZ alineadas (no bloqueante).
+ * @param[out] frame Lote de muestras convertidas en unidades de gravedad
+ * @return Cantidad de muestras XYZ leídas
+ */
+uint16_t ADXL335ReadFrame(adxl335_frame_t *frame);
+/** @fn size_t ADXL335ReadXYZ(adxl335_sample_t *out, size_t n)
+ * @brief Función que lee n muestras de los tres ejes en una sola llamada (reentrante).
+ * @param[out] out Arreglo de al menos n muestras
+ * @param[in] n Cantidad de muestras a leer
+ * @return Cantidad de muestras leídas
+ */
+size_t ADXL335ReadXYZ(adxl335_sample_t *out, size_t n);
+/** @fn const sensor_t *ADXL335Sensor(uint8_t oversampling)
+ * @brief Función que entrega el modo continuo como sensor_t (sensor.h): 3 x float, aceleración
+ * en X, Y y Z (g). Al iniciarlo se configura el modo continuo con la frecuencia del período
+ * pedido; ready se llama desde la ISR al completarse cada trama DMA.
+ * @param[in] oversampling Conversiones promediadas por muestra (0 o 1: sin sobremuestreo)
+ * @return El sensor
+ */
+const sensor_t *ADXL335Sensor(uint8_t oversampling);
+/** @fn bool ADXL335Watch(const float base[3], float band_g, void *func_p, void *param_p)
+ * @brief Función que deja la vigilancia de los ejes al monitor digital del ADC (modo continuo):
+ * func_p se llama (desde la ISR) cuando la aceleración se aleja más de band_g de base.
+ *
+ * El monitor vigila ADC_MONITOR_MAX ejes, los de menor aceleración en base: son los que más
+ * cambian al inclinarse (el tercero, cercano a la gravedad, varía con el coseno del ángulo).
+ * Una inclinación que mueve la aceleración en d g cambia alguno de ellos en al menos d/√6.
+ * @param[in] base Aceleración de referencia en X, Y y Z (g)
+ * @param[in] band_g Semiancho de la ventana de cada eje (g)
+ * @param[in] func_p Función llamada (desde la ISR) la primera vez que un eje sale de su ventana
+ * @param[in] param_p Parámetro de la función func_p
+ * @return 1 (true) si el monitor quedó armado
+ */
+bool ADXL335Watch(const float base[3], float band_g, void *func_p, void *param_p);
+/** @fn void ADXL335WatchEnd(void)
+ * @brief Función que desarma el monitor y descarta las tramas DMA acumuladas mientras vigilaba.
+ */
+void ADXL335WatchEnd(void);
 /** @fn float ReadXValue()
  * @brief Función que lee el pin x del driver y devuelve el valor convertido de analógico a digital en unidades de gravedad.
  * @param[in] No hay parámetros
@@ -28,12 +28,14 @@
 /*******************************************************************************
  * Types/enumerations/variables
  ******************************************************************************/
-// send only one byte per transfer, see WriteRegister functions
+// per-instance scratch bytes (register bursts use the driver buffers, see PCD_Transfer)
 #define BUFFER_SIZE  1 
 // Defined as 4MHz in the original library
 #define MFRC522_BIT_RATE 4000000 
-// Used for ADT object allocation
-#define MFRC_MAX_INSTANCES 2	 
+// Used for ADT object allocation: one reader per SPI chip select (SPI_1..SPI_3)
+#define MFRC_MAX_INSTANCES 3
+// Time for a card to answer a REQA (frame, FDT and ATQA at 106 kbit/s, with margin)
+#define PICC_REQA_ANSWER_US 600
 
 static const uint8_t FIFO_SIZE = 64; // Size of the MFRC522 FIFO
 
@@ -296,6 +298,8 @@ struct MFRC522_T {
 		_resetPowerDownPin; // = {3, 4}; //As default example use GPIO3[4]= P6_5
 	uint8_t Tx_Buf[BUFFER_SIZE];
 	uint8_t Rx_Buf[BUFFER_SIZE];
+	bool irq; // Wait for commands on the IRQ pin instead of polling (PCD_EnableIrq)
+	void *irq_task; // Task waiting for the current command (TaskHandle_t)
 };
 
 // Pointer to a MFRC5222 ADT object
@@ -303,7 +307,7 @@ typedef struct MFRC522_T *MFRC522Ptr_t;
 
 /**
  * Function to setup a MFRC522 ADT object
- * @return an initialized  ADT object
+ * @return an initialized  ADT object, NULL after MFRC_MAX_INSTANCES
  */
 MFRC522Ptr_t MFRC522_Init();
 
@@ -326,7 +330,10 @@ StatusCode PCD_CalculateCRC(MFRC522Ptr_t mfrc, uint8_t *data, uint8_t length,
 * Functions for manipulating the MFRC522
 *******************************************************************************/
 void PCD_Init(MFRC522Ptr_t mfrc);
+void PCD_EnableIrq(MFRC522Ptr_t mfrc, gpio_t irq_pin);
 void PCD_Reset(MFRC522Ptr_t mfrc);
+void PCD_SoftPowerDown(MFRC522Ptr_t mfrc);
+void PCD_SoftPowerUp(MFRC522Ptr_t mfrc);
 void PCD_AntennaOn(MFRC522Ptr_t mfrc);
 void PCD_AntennaOff(MFRC522Ptr_t mfrc);
 uint8_t PCD_GetAntennaGain(MFRC522Ptr_t mfrc);
@@ -350,6 +357,9 @@ StatusCode PICC_WakeupA(MFRC522Ptr_t mfrc, uint8_t *bufferATQA,
 						uint8_t *bufferSize);
 StatusCode PICC_REQA_or_WUPA(MFRC522Ptr_t mfrc, uint8_t command,
 							 uint8_t *bufferATQA, uint8_t *bufferSize);
+void PICC_RequestAStart(MFRC522Ptr_t mfrc);
+StatusCode PICC_RequestAResult(MFRC522Ptr_t mfrc, uint8_t *bufferATQA,
+							   uint8_t *bufferSize);
 StatusCode PICC_Select(MFRC522Ptr_t mfrc, Uid *uid, uint8_t validBits);
 StatusCode PICC_HaltA(MFRC522Ptr_t mfrc);
 
@@ -407,5 +417,6 @@ bool MIFARE_UnbrickUidSector(MFRC522Ptr_t mfrc, bool logErrors);
 *******************************************************************************/
 bool PICC_IsNewCardPresent(MFRC522Ptr_t mfrc);
 bool PICC_ReadCardSerial(MFRC522Ptr_t mfrc);
+uint8_t PICC_Inventory(MFRC522Ptr_t mfrc, Uid *uids, uint8_t maxUids);
 
 #endif
@@ -22,16 +22,21 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261015 v0.3 common sensor interface (Si7007Sensor)
+ * 20261015 v0.2 background averaged sampling
  * 20211006 v0.1 initials initial version Maria Casablanca
  */
 
 /*==================[inclusions]=============================================*/
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "gpio_mcu.h"
 #include "analog_io_mcu.h"
+#include "sensor.h"
 
 /*==================[macros]=================================================*/
+#define SI7007_AVERAGE_MAX	16		/*!< Maximum number of samples averaged in background sampling */
 
 /*==================[typedef]================================================*/
 
@@ -67,6 +72,52 @@ float Si7007MeasureTemperature(void);
  */
 float Si7007MeasureHumidity(void);
 
+/** @fn void Si7007StartSampling(uint32_t period_ms, uint8_t n_average)
+ * @brief Starts reading both outputs in the background (one ADC call every period)
+ * and averaging the last n_average samples. The Get functions return the
+ * averaged values without touching the ADC.
+ * @param[in] period_ms Sampling period (ms)
+ * @param[in] n_average Number of samples averaged (1 to SI7007_AVERAGE_MAX)
+ */
+void Si7007StartSampling(uint32_t period_ms, uint8_t n_average);
+
+/** @fn void Si7007StopSampling(void)
+ * @brief Stops background sampling, the Get functions keep the last values
+ */
+void Si7007StopSampling(void);
+
+/** @fn float Si7007GetTemperature(void)
+ * @brief Averaged temperature from background sampling
+ * @return value of temperature in °C
+ */
+float Si7007GetTemperature(void);
+
+/** @fn float Si7007GetHumidity(void)
+ * @brief Averaged relative humidity from background sampling
+ * @return value of relative humidity in %
+ */
+float Si7007GetHumidity(void);
+
+/** @fn int16_t Si7007GetTemperatureCdeg(void)
+ * @brief Averaged temperature from background sampling, fixed point
+ * @return value of temperature in hundredths of °C
+ */
+int16_t Si7007GetTemperatureCdeg(void);
+
+/** @fn uint16_t Si7007GetHumidityCpct(void)
+ * @brief Averaged relative humidity from background sampling, fixed point
+ * @return value of relative humidity in hundredths of %
+ */
+uint16_t Si7007GetHumidityCpct(void);
+
+/** @fn const sensor_t *Si7007Sensor(uint8_t n_average)
+ * @brief Temperature and humidity as a sensor_t (sensor.h): 2 x int32 in
+ * hundredths of °C and %, each averaged sample of background sampling
+ * @param[in] n_average Number of samples averaged (1 to SI7007_AVERAGE_MAX)
+ * @return the sensor
+ */
+const sensor_t *Si7007Sensor(uint8_t n_average);
+
 
 /** @fn bool Si7007dEInit(Si7007_config *pins);
  * @brief deinitialization function of Si7007.
@@ -0,0 +1,168 @@
+#ifndef ACCEL_SENSOR_H_
+#define ACCEL_SENSOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Accel_Sensor Accel Sensor
+ ** @{ */
+
+/** \brief Common interface for the accelerometers sampled in parallel
+ *
+ * Each sensor is added with its backend (ADXL335 over the ADC in continuous
+ * mode, or MPU6050 over I2C with its FIFO) and all of them are started
+ * together. A single task is notified whenever any sensor has new samples,
+ * and drains every sensor with AccelSensorRead, which delivers a frame of
+ * XYZ samples in g with their timestamps.
+ *
+ * @note Only one sensor of each type: the ADC has a single continuous scan
+ * pattern (CH1 to CH3) and the MPU6050 driver handles one device.
+ *
+ * @note The MPU6050 runs at 1 kHz / n (DLPF enabled), the nearest rate not
+ * higher than the requested one; see AccelSensorFrequency.
+ *
+ * @note The ADXL335 can be left to the digital monitor of the ADC
+ * (AccelSensorWatch): the conversions go on but the task is not notified
+ * until the acceleration leaves a window around a reference, or
+ * AccelSensorWake is called.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | ADXL335 watched by the ADC digital monitor (AccelSensorWatch)			|
+ * | 15/10/2026 | Frame layout documented as a 3 x ACCEL_FRAME_LEN matrix				|
+ * | 15/10/2026 | Sample frequency changed on the run (AccelSensorSetFrequency)			|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+#define ACCEL_SENSOR_MAX    2       /*!< Maximum number of sensors */
+#define ACCEL_FRAME_LEN     32      /*!< Maximum number of samples in a frame */
+/*==================[typedef]================================================*/
+/**
+ * @brief Sensor backend
+ */
+typedef enum {
+    ACCEL_SENSOR_ADXL335,   /*!< Analog accelerometer on CH1 (X), CH2 (Y) and CH3 (Z) */
+    ACCEL_SENSOR_MPU6050    /*!< MPU6050 over I2C, ±2 g range */
+} accel_sensor_type_t;
+
+/**
+ * @brief Sensor configuration
+ */
+typedef struct {
+    accel_sensor_type_t type;   /*!< Backend */
+    uint16_t sample_frec;       /*!< Sample frequency (Hz) */
+    gpio_t int_pin;             /*!< GPIO connected to INT (ACCEL_SENSOR_MPU6050) */
+    uint8_t oversampling;       /*!< ADC conversions averaged per sample (ACCEL_SENSOR_ADXL335, 0 or 1: none) */
+} accel_sensor_config_t;
+
+/**
+ * @brief Frame of XYZ samples, evenly spaced in time
+ *
+ * x, y and z are consecutive: a 3 x ACCEL_FRAME_LEN row major matrix.
+ */
+typedef struct {
+    float x[ACCEL_FRAME_LEN];   /*!< Acceleration in X (g) */
+    float y[ACCEL_FRAME_LEN];   /*!< Acceleration in Y (g) */
+    float z[ACCEL_FRAME_LEN];   /*!< Acceleration in Z (g) */
+    int64_t first_us;           /*!< Timestamp of x[0] (us) */
+    uint32_t period_us;         /*!< Time between samples (us) */
+    uint16_t len;               /*!< Number of valid samples */
+} accel_frame_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Adds a sensor (before AccelSensorStart)
+ * 
+ * @note The MPU6050 is initialized and configured here, so an absent sensor is
+ * detected (I2C_initialize must have been called).
+ * 
+ * @param config    Sensor configuration
+ * @return int8_t   Sensor id, -1 if the sensor is not present or can't be added
+ */
+int8_t AccelSensorAdd(const accel_sensor_config_t *config);
+
+/**
+ * @brief Starts sampling all the added sensors
+ * 
+ * @param task  Task notified (xTaskNotifyGive) whenever a sensor has new samples
+ * @return true     Sampling started
+ * @return false    No sensors, or the MPU6050 acquisition could not be started
+ */
+bool AccelSensorStart(TaskHandle_t task);
+
+/**
+ * @brief Reads the next samples of a sensor (non-blocking)
+ * 
+ * @param id        Sensor id
+ * @param frame     Frame where the samples are stored
+ * @return uint16_t Number of samples read (0 if there are no new samples)
+ */
+uint16_t AccelSensorRead(int8_t id, accel_frame_t *frame);
+
+/**
+ * @brief Stops delivering the samples of a sensor until it moves away from a reference
+ * 
+ * The task is notified again when the acceleration leaves the window (see
+ * ADXL335Watch) or AccelSensorWake is called; the samples in between are
+ * discarded and the timestamps continue from the first new frame.
+ * 
+ * @param id        Sensor id (only ACCEL_SENSOR_ADXL335)
+ * @param base      Reference acceleration in X, Y and Z (g)
+ * @param band_g    Half width of the window of each axis (g)
+ * @return true     The sensor is being watched
+ * @return false    Not an ADXL335, or the ADC monitor could not be armed
+ */
+bool AccelSensorWatch(int8_t id, const float base[3], float band_g);
+
+/**
+ * @brief Ends the watch of a sensor (e.g. when the samples are needed again), no effect if not watched
+ * 
+ * @param id        Sensor id
+ */
+void AccelSensorWake(int8_t id);
+
+/**
+ * @brief Changes the sample frequency of a sensor, before or after AccelSensorStart
+ * 
+ * The samples not read yet are discarded and the timestamps restart from the
+ * next frame. The MPU6050 takes the nearest rate not higher than sample_frec.
+ * 
+ * @param id            Sensor id
+ * @param sample_frec   Sample frequency (Hz)
+ * @return true     Frequency changed (see AccelSensorFrequency)
+ * @return false    Invalid sensor, ADXL335 being watched, or the MPU6050 acquisition could not be restarted
+ */
+bool AccelSensorSetFrequency(int8_t id, uint16_t sample_frec);
+
+/**
+ * @brief Actual sample frequency of a sensor
+ * 
+ * @param id        Sensor id
+ * @return float    Sample frequency (Hz)
+ */
+float AccelSensorFrequency(int8_t id);
+
+/**
+ * @brief Number of sensors added
+ * 
+ * @return uint8_t Number of sensors
+ */
+uint8_t AccelSensorCount(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ACCEL_SENSOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -7,8 +7,12 @@
 /** \addtogroup BUZZER Buzzer
  ** @{ */
 
-/** @brief 
+/** @brief Buzzer driver for the ESP-EDU Board.
  *
+ * Melodies can be played in the background: BuzzerRtttlParse converts an
+ * RTTTL string once into a table of notes, and BuzzerMelodyPlay and
+ * BuzzerMelodyQueue hand the table to a low priority player task, which
+ * sleeps for the duration of each note. The caller never blocks.
  *
  * @author Albano Peñalva
  * 
@@ -17,11 +21,13 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 08/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Background melody player (play/queue/stop)     |
  *
  */
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
 /* Note frequency (in Hz) */
@@ -114,7 +120,15 @@
 #define NOTE_CS8 4435
 #define NOTE_D8  4699
 #define NOTE_DS8 4978
+#define BUZZER_MELODY_QUEUE		4		/*!< Melodies that can wait after the one playing */
 /*==================[typedef]================================================*/
+/**
+ * @brief Note of a melody
+ */
+typedef struct {
+	uint16_t freq;			/*!< Frequency (in Hz), 0 for a rest */
+	uint16_t duration;		/*!< Duration (in ms) */
+} buzzer_note_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -161,6 +175,52 @@ void BuzzerPlayTone(uint16_t freq, uint16_t duration);
  */
 void BuzzerPlayRtttl(const char * rtttl_melody);
 
+/**
+ * @brief Converts a RTTTL melody into a table of notes (once, before playing it).
+ * 
+ * @param rtttl_melody String containing text with a RTTTL melody.
+ * @param notes Table to be filled.
+ * @param max_notes Size of the table (the rest of the melody is discarded).
+ * @return uint16_t Number of notes written.
+ */
+uint16_t BuzzerRtttlParse(const char * rtttl_melody, buzzer_note_t *notes, uint16_t max_notes);
+
+/**
+ * @brief Plays a melody in the background, stopping the current one and
+ * discarding the queued ones.
+ * 
+ * @note The table is not copied: it must stay valid while it is played.
+ * 
+ * @param notes Notes of the melody.
+ * @param length Number of notes.
+ * @param loop true to repeat the melody until BuzzerMelodyStop or another BuzzerMelodyPlay.
+ */
+void BuzzerMelodyPlay(const buzzer_note_t *notes, uint16_t length, bool loop);
+
+/**
+ * @brief Plays a melody in the background after the current and queued ones.
+ * 
+ * @note The table is not copied: it must stay valid while it is played.
+ * 
+ * @param notes Notes of the melody.
+ * @param length Number of notes.
+ * @return true Melody queued.
+ * @return false Queue full (BUZZER_MELODY_QUEUE melodies waiting).
+ */
+bool BuzzerMelodyQueue(const buzzer_note_t *notes, uint16_t length);
+
+/**
+ * @brief Stops the melody that is playing and discards the queued ones.
+ */
+void BuzzerMelodyStop(void);
+
+/**
+ * @brief State of the melody player.
+ * 
+ * @return true A melody is playing.
+ */
+bool BuzzerMelodyIsPlaying(void);
+
 /**
  * @brief Buzzer de-initialization.
  */
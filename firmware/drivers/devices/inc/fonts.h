@@ -14,6 +14,13 @@
  * @note Available characters from " " (ASCII: 32) to "~" (ASCII: 126)
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
+ *
+ * @note Glyphs are 1 bit per pixel, most significant bit first. In the fonts
+ * of fonts.c every row starts on a byte; fonts with the FONT_PACKED flag have
+ * no row padding (only every glyph starts on a byte), which takes 7 to 40%
+ * less flash. drivers/devices/font_pack.py generates packed fonts and icons
+ * with only the characters an application uses: if the application doesn't
+ * reference the fonts of fonts.c the linker drops them.
  * 
  * @author Albano Peñalva
  *
@@ -22,12 +29,22 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 15/10/2026 | Character range of the fonts			         						|
+ * | 15/10/2026 | Packed fonts and row expansion to RGB565	       						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define FONT_FIRST_CHAR		' '		/*!< First character of the fonts (info[0]) */
+#define FONT_LAST_CHAR		'~'		/*!< Last character of the fonts */
+#define FONT_PACKED			0x01	/*!< Flag: glyph rows are not padded to a byte */
+
+/**
+ * @brief  Bits between the start of two rows of a glyph
+ */
+#define FONT_ROW_BITS(width, flags)	(((flags) & FONT_PACKED) ? (uint32_t)(width) : (((uint32_t)(width) + 7) & ~7UL))
 
 /*==================[typedef]================================================*/
 /**
@@ -44,6 +61,7 @@ typedef struct{
 	uint8_t 		font_height;   	/*!< Font height in pixels */
 	char_info_t 	*info;			/*!< Character info array */
 	const uint8_t 	*data; 			/*!< Font array */
+	uint8_t			flags;			/*!< FONT_PACKED or 0 */
 } Font_t;
 
 /*==================[external data declaration]==============================*/
@@ -78,6 +96,16 @@ extern Font_t font_59;
 extern Font_t font_89;
 
 /*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Expand pixels of a 1 bit per pixel bitmap (glyphs and icons)
+ * @param[out] 	pixels: Expanded pixels
+ * @param[in]  	bitmap: Bitmap data
+ * @param[in]  	bit: Index of the first bit (e.g. row * FONT_ROW_BITS(width, flags) + column)
+ * @param[in]  	n: Number of pixels
+ * @param[in]  	foreground: Color of the bits set (stored as is, e.g. ILI9341_STRIP_COLOR)
+ * @param[in]  	background: Color of the bits clear
+ */
+void FontExpandRow(uint16_t *pixels, const uint8_t *bitmap, uint32_t bit, uint16_t n, uint16_t foreground, uint16_t background);
 
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
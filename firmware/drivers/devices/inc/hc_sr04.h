@@ -13,6 +13,11 @@
  * @note Maximun distance: 300cm (118 inches).
  * 
  * @note When disconnected return 0.
+ *
+ * @note HcSr04ReadDistanceIn... functions block the calling task until the
+ * echo is received. In continuous mode (HcSr04StartContinuous) the sensor is
+ * triggered periodically and the echo pulse is timed by the MCPWM capture
+ * peripheral (sub-microsecond resolution, no busy-waiting).
  * 
  * @note When ussing dedicated connector in ESP-EDU:
  * |   HC_SR04      |   EDU-CIAA	|
@@ -29,6 +34,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Continuous mode: periodic trigger, echo timed by MCPWM capture        |
+ * | 15/10/2026 | Common sensor interface (HcSr04Sensor)                                |
  * 
  **/
 
@@ -36,9 +43,17 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "gpio_mcu.h"
+#include "sensor.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
+/**
+ * @brief Function called with each new distance (continuous mode)
+ * 
+ * @note Called from the capture interrupt (or from the trigger timer task
+ * when there was no echo): it must be short, e.g. notify a task.
+ */
+typedef void (*hc_sr04_callback_t)(uint16_t distance_mm, void *param);
 
 /*==================[external data declaration]==============================*/
 
@@ -66,6 +81,41 @@ uint16_t HcSr04ReadDistanceInCentimeters(void);
  */
 uint16_t HcSr04ReadDistanceInInches(void);
 
+/**
+ * @brief Start periodic measurements.
+ * 
+ * @note Measurements should be at least 60 ms apart, so the echo of the
+ * previous one has finished.
+ * 
+ * @param period_ms Time between measurements in ms
+ * @param callback Function called with each distance (can be NULL)
+ * @param param Parameter passed to the callback
+ * @return true if started, false if it was already running
+ */
+bool HcSr04StartContinuous(uint32_t period_ms, hc_sr04_callback_t callback, void *param);
+
+/**
+ * @brief Last distance measured in continuous mode
+ * 
+ * @return uint16_t measured distance in mm (0 when disconnected, 3000 when out of range).
+ */
+uint16_t HcSr04GetDistanceInMillimeters(void);
+
+/**
+ * @brief Stop periodic measurements.
+ * 
+ * @return true if stopped, false if it was not running
+ */
+bool HcSr04StopContinuous(void);
+
+/**
+ * @brief Distance as a sensor_t (sensor.h): 1 x uint16 in mm, the echo of
+ * each trigger of the continuous mode (period rounded to ms, >= 60 ms)
+ * 
+ * @return const sensor_t* 
+ */
+const sensor_t *HcSr04Sensor(void);
+
 /**
  * @brief HC_SR04 de-initialization.
  * 
@@ -57,7 +57,10 @@
 #include <stdint.h>
 #include "stdbool.h"
 
+#define HEART_RATE_BLOCK_SIZE 32 // samples filtered per dsps_fird_s16 call (MAX3010X FIFO depth)
+
 bool checkForBeat(int32_t sample);
+uint8_t checkForBeatBlock(const int32_t *samples, uint16_t len, uint16_t *beats, uint8_t max_beats);
 int16_t averageDCEstimator(int32_t *p, uint16_t x);
 int16_t lowPassFIRFilter(int16_t din);
 int32_t mul16(int16_t x, int16_t y);
@@ -9,6 +9,19 @@
 
 /** \brief The HX711 amplifier is a breakout board that allows you to easily read load cells to measure weight. It communicates with the EDU-ESP
  * board via I2C.
+ *
+ * @note HX711_read and the functions based on it wait for each conversion.
+ * In continuous mode (HX711_startContinuous) a falling edge on DOUT wakes a
+ * driver task that reads the conversion; samples are kept in a ring of
+ * HX711_RING_SIZE values, and the running average and tare are updated with
+ * each one, so the application never waits for the chip. Continuous mode
+ * samples are the signed 24 bit conversions (OFFSET and SCALE must be
+ * obtained in this mode).
+ *
+ * @note Multi-cell mode (HX711_InitMulti): several HX711 share PD_SCK and
+ * each one has its own DOUT. Every clock pulse shifts one bit out of all of
+ * them and one dedicated GPIO read samples the DOUT lines together, so
+ * reading up to HX711_MAX_CELLS cells takes the time of reading one.
  * 
  * @author Juan Ignacio Cerrudo
  *
@@ -17,12 +30,23 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         						|
+ * | 14/10/2026 | Continuous mode: DRDY interrupt, sample ring, incremental average      |
+ * | 14/10/2026 | PD_SCK and DOUT on dedicated GPIO (gpio_fast_out_mcu)					|
+ * | 15/10/2026 | Single precision OFFSET and values (no double emulation)              |
+ * | 15/10/2026 | Common sensor interface (HX711_sensor)                                |
+ * | 15/10/2026 | Multi-cell mode: shared PD_SCK, DOUT lines read in parallel           |
  * 
  **/
 
 /*==================[inclusions]=============================================*/
+#include <stdbool.h>
 #include <gpio_mcu.h>
+#include "sensor.h"
 /*==================[macros]=================================================*/
+#ifndef HX711_RING_SIZE
+#define HX711_RING_SIZE		32		/*!< Samples kept in continuous mode */
+#endif
+#define HX711_MAX_CELLS		8		/*!< Cells of the multi-cell mode (dedicated GPIO inputs) */
 
 /*==================[typedef]================================================*/
 
@@ -65,20 +89,20 @@ uint32_t HX711_read(void);
  */
 uint32_t HX711_readAverage(uint8_t times);
 
-/** @fn HX711_get_value(uint8_t times)
+/** @fn HX711_getValue(uint8_t times)
  * @brief Returns (read_average() - OFFSET), that is the current value without the tare weight
  * @param[in] times How many times to read
  * @return Read value
  */
-double HX711_get_value(uint8_t times);
+float HX711_getValue(uint8_t times);
 
 
-/** @fn HX711_get_units(uint8_t times)
+/** @fn HX711_getUnits(uint8_t times)
  * @brief Returns get_value() divided by SCALE, that is the raw value divided by a value obtained via calibration
  * @param[in] times How many readings to do
  * @return Read value
  */
-float HX711_get_units(uint8_t times);
+float HX711_getUnits(uint8_t times);
 
 /** @fn HX711_tare(uint8_t times)
  * @brief Set the OFFSET value for tare weight
@@ -98,17 +122,91 @@ void HX711_setScale(float scale);
  */
 float HX711_getScale(void);
 
-/** @fn X711_setOffset(double offset)
+/** @fn HX711_setOffset(float offset)
  * @brief Set OFFSET, the value that's subtracted from the actual reading (tare weight)
  * @param[in] offset Offset vlaue
  */
-void HX711_setOffset(double offset);
+void HX711_setOffset(float offset);
 
 /** @fn HX711_getOffset(void)
  * @brief Get the current OFFSET
  * @return Offset value
  */
-double HX711_getOffset(void);
+float HX711_getOffset(void);
+
+/** @fn HX711_startContinuous(uint8_t len)
+ * @brief Starts reading each conversion as soon as it is ready (DOUT interrupt)
+ * @param[in] len Number of samples of the running average (up to HX711_RING_SIZE)
+ */
+void HX711_startContinuous(uint8_t len);
+
+/** @fn HX711_stopContinuous(void)
+ * @brief Stops the continuous mode
+ */
+void HX711_stopContinuous(void);
+
+/** @fn HX711_getSample(int32_t *sample)
+ * @brief Takes the oldest sample not read yet (continuous mode)
+ * @param[out] sample Sample
+ * @return true if there was a sample
+ */
+bool HX711_getSample(int32_t *sample);
+
+/** @fn HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t n_cells)
+ * @brief Multi-cell mode: cells sharing the clock pin, each with its own data pin.
+ * Independent of the single cell functions.
+ * @param[in] gain Gain of every cell (128, 64 or 32)
+ * @param[in] pd_sck Clock pin, connected to every cell
+ * @param[in] dout Data pin of each cell
+ * @param[in] n_cells Number of cells (1 to HX711_MAX_CELLS)
+ * @return false if there are too many cells or no dedicated GPIO channels are free
+ */
+bool HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t n_cells);
+
+/** @fn HX711_isReadyMulti(void)
+ * @brief Check if every cell of the multi-cell mode has a conversion ready
+ * @return true if ready
+ */
+bool HX711_isReadyMulti(void);
+
+/** @fn HX711_readMulti(int32_t *values)
+ * @brief Waits for every cell to be ready and reads all of them at once
+ * @param[out] values Signed 24 bit conversion of each cell (n_cells elements)
+ * @return false if the multi-cell mode was not initialized
+ */
+bool HX711_readMulti(int32_t *values);
+
+/** @fn HX711_sensor(void)
+ * @brief Continuous mode as a sensor_t (sensor.h): 1 x int32 raw conversion.
+ * The rate is set by the RATE pin (10 or 80 Hz), the period given to start
+ * is ignored; the running average length is kept
+ * @return The sensor
+ */
+const sensor_t *HX711_sensor(void);
+
+/** @fn HX711_getAverage(void)
+ * @brief Running average of the last samples (continuous mode)
+ * @return Average value
+ */
+int32_t HX711_getAverage(void);
+
+/** @fn HX711_getUnitsContinuous(void)
+ * @brief Returns (running average - OFFSET) / SCALE (continuous mode)
+ * @return Read value
+ */
+float HX711_getUnitsContinuous(void);
+
+/** @fn HX711_tareContinuous(uint8_t times)
+ * @brief Sets OFFSET with the average of the next samples, without waiting (continuous mode)
+ * @param[in] times How many samples to average
+ */
+void HX711_tareContinuous(uint8_t times);
+
+/** @fn HX711_isTared(void)
+ * @brief Checks if the last HX711_tareContinuous has finished
+ * @return true if OFFSET has been updated
+ */
+bool HX711_isTared(void);
 
 /** @fn HX711_powerDown(void)
  * @brief Puts the chip into power down mode
@@ -12,6 +12,9 @@
  * @note Available sizes: 22x22 pixels, 30x30 pixels, 59x59 pixels, 89x89 pixels.
  * 
  * @note Created with http://www.eran.io/the-dot-factory-an-lcd-font-and-image-generator/
+ *
+ * @note Icons with the ICON_PACKED flag have no row padding (see fonts.h and
+ * drivers/devices/font_pack.py).
  * 
  * @author Albano Peñalva
  *
@@ -20,12 +23,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 05/04/2024 | Document creation		                         						|
+ * | 15/10/2026 | Packed icons				                         						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define ICON_PACKED			0x01	/*!< Flag: icon rows are not padded to a byte */
 
 /*==================[typedef]================================================*/
 /**
@@ -106,6 +111,7 @@ typedef struct{
 	uint8_t 		width;			/*!< Icon width in pixels */
 	uint16_t 		offset;			/*!< Offset between icons in data array */
 	const uint8_t 	*data; 			/*!< Icon data array */
+	uint8_t			flags;			/*!< ICON_PACKED or 0 */
 } icon_font_t;
 
 /*==================[external data declaration]==============================*/
@@ -33,6 +33,15 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 14/10/2026 | Strip rendering with double DMA buffers        |
+ * | 14/10/2026 | Lines and circles drawn as runs, pixel lists   |
+ * | 14/10/2026 | Cache of expanded glyphs for DrawChar          |
+ * | 14/10/2026 | Palette + RLE compressed images                |
+ * | 14/10/2026 | DrawPicture without copies from DMA capable RAM|
+ * | 14/10/2026 | Hardware scrolling                             |
+ * | 15/10/2026 | Measured text objects (ILI9341TextInit)        |
+ * | 15/10/2026 | Glyphs and icons expanded row by row in strips |
+ * | 15/10/2026 | 40MHz SPI clock, MEM_ACC_CTRL sent on change   |
  *
  */
 
@@ -46,6 +55,15 @@
 #define ILI9341_WIDTH       240			/*!< LCD width in pixels */
 #define ILI9341_HEIGHT      320			/*!< LCD height in pixels */
 #define ILI9341_PIXEL_MAX	76800
+#define ILI9341_STRIP_BYTES	3840		/*!< Size of each strip buffer (up to the SPI max transfer size) */
+#ifndef ILI9341_GLYPH_CACHE_BYTES
+#define ILI9341_GLYPH_CACHE_BYTES	32768	/*!< Size of the cache of expanded glyphs (0 to disable it) */
+#endif
+/**
+ * @brief RGB565 color in the byte order sent to the LCD (to be written in strip buffers)
+ */
+#define ILI9341_STRIP_COLOR(color)	((uint16_t)(((color) >> 8) | ((color) << 8)))
+#define ILI9341_TEXT_MAX		32		/*!< Maximum number of characters of a text object */
 /* 16bits colors (RGB565) */			/*	 R,   G,   B */
 #define ILI9341_BLACK          	0x0000  /*   0,   0,   0 */
 #define ILI9341_NAVY           	0x000F 	/*   0,   0, 128 */
@@ -80,6 +98,55 @@ typedef enum ili9341_orientation {
 	ILI9341_Landscape_1, 	/*!< Landscape orientation mode 1 */
 	ILI9341_Landscape_2  	/*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
+
+/**
+ * @brief  Pixel position (see ILI9341DrawPixels)
+ */
+typedef struct {
+	uint16_t x;		/*!< X position */
+	uint16_t y;		/*!< Y position */
+} ili9341_point_t;
+
+/**
+ * @brief  Compressed image (indexed palette + RLE), see ILI9341DrawImage
+ *
+ * Each row is a sequence of tokens. A token byte with bit 7 set is a run:
+ * (byte & 0x7F) + 1 pixels of the palette index in the next byte. Otherwise it
+ * is a literal: byte + 1 palette indexes follow. Rows are encoded separately,
+ * so any row (or part of it) can be decoded on its own.
+ */
+typedef struct {
+	uint16_t width;				/*!< Image width in pixels */
+	uint16_t height;			/*!< Image height in pixels */
+	const uint16_t *palette;	/*!< Colors (RGB565) */
+	const uint32_t *rows;		/*!< Offset of the first token of each row in data */
+	const uint8_t *data;		/*!< Tokens */
+} ili9341_image_t;
+
+/**
+ * @brief  Text measured once (see ILI9341TextInit)
+ *
+ * Keeps the size of the text and the index of each glyph in the font, so a
+ * text drawn many times (titles, labels) is not measured nor looked up again.
+ */
+typedef struct {
+	Font_t *font;						/*!< Font of the text */
+	uint16_t width;						/*!< Text width in pixels (as ILI9341GetStringSize) */
+	uint16_t height;					/*!< Text height in pixels */
+	uint8_t length;						/*!< Number of glyphs */
+	uint8_t glyph[ILI9341_TEXT_MAX];	/*!< Glyph indexes in font->info */
+} ili9341_text_t;
+
+/**
+ * @brief  		Function that draws the pixels of a strip of an area (see ILI9341RenderArea)
+ * @param[out] 	strip: Pixels of the strip, row by row (width * lines), colors converted with ILI9341_STRIP_COLOR
+ * @param[in]  	x0: X position of the first column of the strip
+ * @param[in]  	y0: Y position of the first row of the strip
+ * @param[in]  	width: Strip width in pixels
+ * @param[in]  	lines: Strip height in pixels
+ * @param[in]  	param: Parameter given to ILI9341RenderArea
+ */
+typedef void (*ili9341_render_t)(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param);
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -101,6 +168,17 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst);
  */
 void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 
+/**
+ * @brief  		Draws a list of pixels of the same color
+ * @note		Consecutive points that are neighbours in the same row or column
+ * 				are sent as a single run (one address window and memory write)
+ * @param[in]  	points: Pixel positions
+ * @param[in]  	n: Number of pixels
+ * @param[in]  	color: Color of pixels (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawPixels(const ili9341_point_t *points, uint16_t n, uint16_t color);
+
 /**
  * @brief  		Fills entire LCD with color
  * @param[in]	color: Color to be used in fill (RGB565)
@@ -115,6 +193,34 @@ void ILI9341Fill(uint16_t color);
  */
 void ILI9341Rotate(ili9341_orientation_t orientation);
 
+/**
+ * @brief  		Gets the LCD orientation
+ * @retval 		LCD orientation
+ */
+ili9341_orientation_t ILI9341GetOrientation(void);
+
+/**
+ * @brief  		Defines the hardware scrolling area
+ * @note		The LCD scrolls along its 320 pixels side: rows in portrait modes and
+ * 				columns in landscape modes. The area spans the whole other side.
+ * 				Call it after ILI9341Rotate. ILI9341ScrollArea(0, ILI9341_HEIGHT)
+ * 				restores the normal display.
+ * @param[in]  	first: First row (portrait) or column (landscape) of the area
+ * @param[in]  	lines: Number of rows or columns of the area
+ * @retval 		None
+ */
+void ILI9341ScrollArea(uint16_t first, uint16_t lines);
+
+/**
+ * @brief  		Scrolls the hardware scrolling area
+ * @note		Drawing functions keep using the unscrolled coordinates: after
+ * 				ILI9341Scroll(offset), line first + offset is shown at the start of
+ * 				the area, and lines before it are shown after the last one.
+ * @param[in]  	offset: Scroll offset (0 to lines - 1)
+ * @retval 		None
+ */
+void ILI9341Scroll(uint16_t offset);
+
 /**
  * @brief  		Draw a single character on the LCD
  * @param[in]  	x: X position of top left corner
@@ -174,6 +280,27 @@ void ILI9341DrawString(uint16_t x, uint16_t y, char* str, Font_t *font, uint16_t
  */
 void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* height);
 
+/**
+ * @brief  		Measures a single line text once, for ILI9341DrawText
+ * @note 		Characters out of the font ('\n', accented letters...) are shown as '?'
+ * @param[out] 	text: Text object
+ * @param[in]  	str: String
+ * @param[in]  	font: Pointer to used font
+ * @retval 		true: whole string, false: cut to ILI9341_TEXT_MAX characters
+ */
+bool ILI9341TextInit(ili9341_text_t *text, const char* str, Font_t *font);
+
+/**
+ * @brief  		Draws a text object (no measurement nor character lookup)
+ * @param[in] 	x: X position of top left corner of the text
+ * @param[in]  	y: Y position of top left corner of the text
+ * @param[in]  	text: Text object (see ILI9341TextInit)
+ * @param[in]  	foreground: Color for text (RGB565)
+ * @param[in]  	background: Color for text background (RGB565)
+ * @retval 		None
+ */
+void ILI9341DrawText(uint16_t x, uint16_t y, const ili9341_text_t *text, uint16_t foreground, uint16_t background);
+
 /**
  * @brief  		Draws line on the LCD
  * @param[in]  	x0: X coordinate of starting point
@@ -258,6 +385,9 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  * @note		Pictures must be converted to uint8_t array. 
  * 				For that porpouse you can use http://www.digole.com/tools/PicturetoC_Hex_converter.php, 
  * 				selecting the option "65K Color (2 bytes/pixel)"
+ * @note		Pictures in DMA capable RAM (word aligned) are sent straight to the SPI
+ * 				driver. Pictures in flash (const arrays) are copied to the strip buffers,
+ * 				one strip at a time.
  * @param[in] 	x: X position of top left corner of picture
  * @param[in]  	y: Y position of top left corner of picture
  * @param[in] 	width: Picture width in pixels
@@ -267,6 +397,44 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
 
+/**
+ * @brief  		Draw a compressed image on the LCD
+ * @note		Images are converted with pic_to_edu.py (examples/ej_lcdcolor_ecg).
+ * 				Rows are decoded straight into the strip buffers (see ILI9341RenderArea)
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	img: Compressed image
+ * @retval 		None
+ */
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t *img);
+
+/**
+ * @brief  		Decode part of a row of a compressed image
+ * @param[in]  	img: Compressed image
+ * @param[in]  	row: Row to be decoded
+ * @param[in]  	first: First column to be decoded
+ * @param[in]  	width: Number of pixels to be decoded (first + width <= img->width)
+ * @param[out] 	pixels: Decoded pixels, colors converted with ILI9341_STRIP_COLOR
+ * @retval 		None
+ */
+void ILI9341ImageRow(const ili9341_image_t *img, uint16_t row, uint16_t first, uint16_t width, uint16_t *pixels);
+
+/**
+ * @brief  		Draws an area of the LCD strip by strip
+ * @note		The area is split in strips of up to ILI9341_STRIP_BYTES. Each strip is drawn by
+ * 				the render function into one of two DMA buffers and sent without blocking,
+ * 				while the next strip is drawn into the other buffer. The whole area is sent
+ * 				with a single address window and memory write command.
+ * @param[in] 	x0: X position of top left corner of the area
+ * @param[in]  	y0: Y position of top left corner of the area
+ * @param[in] 	x1: X position of bottom right corner of the area
+ * @param[in]  	y1: Y position of bottom right corner of the area
+ * @param[in]  	render: Function that draws each strip
+ * @param[in]  	param: Parameter passed to the render function
+ * @retval 		None
+ */
+void ILI9341RenderArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ili9341_render_t render, void *param);
+
 /**
  * @brief  	De-initializes ILI9341 LCD
  * @param	None
@@ -0,0 +1,155 @@
+#ifndef ILI9341_SCENE_H_
+#define ILI9341_SCENE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup ILI9341_Scene ILI9341 Scene
+ ** @{
+ * @brief  Retained mode layer over the ILI9341 driver
+ *
+ * @note The screen is described as a list of items (rectangles, texts, icons
+ * and pictures), drawn in the order they were added. Changing an item only
+ * marks its area as dirty; ILI9341SceneFlush merges the dirty areas and
+ * redraws each merged window once, strip by strip (ILI9341RenderArea).
+ * Changing a text only marks the characters that changed.
+ *
+ * @note Merged windows may also redraw the background between nearby items.
+ * Regions drawn directly with the ILI9341 primitives (e.g. plots) must be kept
+ * away from scene items.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 14/10/2026 | Document creation		                         |
+ * | 14/10/2026 | Compressed image items		                 |
+ * | 15/10/2026 | Packed fonts and icons		                 |
+ * | 15/10/2026 | Flush at the maximum CPU frequency             |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ili9341.h"
+/*==================[macros]=================================================*/
+#define SCENE_MAX_ITEMS		16		/*!< Maximum number of items of the scene */
+#define SCENE_MAX_DIRTY		8		/*!< Maximum number of dirty areas kept before merging */
+#define SCENE_MAX_TEXT		16		/*!< Maximum number of characters of a text item */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief  		Initializes an empty scene
+ * @param[in]  	back_color: Color of the pixels not covered by items
+ * @retval 		None
+ */
+void ILI9341SceneInit(uint16_t back_color);
+
+/**
+ * @brief  		Adds a filled rectangle
+ * @param[in]  	x0: X position of top left corner
+ * @param[in]  	y0: Y position of top left corner
+ * @param[in]  	x1: X position of bottom right corner
+ * @param[in]  	y1: Y position of bottom right corner
+ * @param[in]  	color: Rectangle color
+ * @retval 		Item id, -1 if the scene is full
+ */
+int8_t ILI9341SceneAddRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * @brief  		Adds a text (single line, up to SCENE_MAX_TEXT characters)
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in]  	str: Text
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for text
+ * @param[in]  	background: Color for text background
+ * @retval 		Item id, -1 if the scene is full
+ */
+int8_t ILI9341SceneAddText(uint16_t x, uint16_t y, const char* str, Font_t* font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Adds an icon
+ * @param[in]  	x: X position of top left corner
+ * @param[in]  	y: Y position of top left corner
+ * @param[in] 	icon: Icon to be displayed
+ * @param[in]  	icon_font: Pointer to used icon font
+ * @param[in]  	foreground: Color for icon
+ * @param[in]  	background: Color for icon background
+ * @retval 		Item id, -1 if the scene is full
+ */
+int8_t ILI9341SceneAddIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Adds a picture (same format as ILI9341DrawPicture)
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in] 	width: Picture width in pixels
+ * @param[in]  	height: Picture height in pixels
+ * @param[in]  	pic: Pointer to first byte of picture
+ * @retval 		Item id, -1 if the scene is full
+ */
+int8_t ILI9341SceneAddPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic);
+
+/**
+ * @brief  		Adds a compressed image (same format as ILI9341DrawImage)
+ * @param[in] 	x: X position of top left corner of image
+ * @param[in]  	y: Y position of top left corner of image
+ * @param[in]  	img: Compressed image
+ * @retval 		Item id, -1 if the scene is full
+ */
+int8_t ILI9341SceneAddImage(uint16_t x, uint16_t y, const ili9341_image_t *img);
+
+/**
+ * @brief  		Changes the string of a text item
+ * @param[in]  	id: Text item
+ * @param[in]  	str: New text
+ * @retval 		None
+ */
+void ILI9341SceneSetText(int8_t id, const char* str);
+
+/**
+ * @brief  		Changes the colors of an item
+ * @param[in]  	id: Item
+ * @param[in]  	foreground: New color (rectangle color, or text and icon foreground)
+ * @param[in]  	background: New background (texts and icons)
+ * @retval 		None
+ */
+void ILI9341SceneSetColor(int8_t id, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief  		Shows or hides an item
+ * @param[in]  	id: Item
+ * @param[in]  	visible: true to show the item
+ * @retval 		None
+ */
+void ILI9341SceneSetVisible(int8_t id, bool visible);
+
+/**
+ * @brief  		Marks an area to be redrawn on the next flush
+ * @param[in]  	x0: X position of top left corner
+ * @param[in]  	y0: Y position of top left corner
+ * @param[in]  	x1: X position of bottom right corner
+ * @param[in]  	y1: Y position of bottom right corner
+ * @retval 		None
+ */
+void ILI9341SceneInvalidate(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief  		Redraws the dirty areas of the scene
+ * @retval 		None
+ */
+void ILI9341SceneFlush(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ILI9341_SCENE_H_ */
+
+/*==================[end of file]============================================*/
@@ -31,6 +31,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 14/10/2026 | L293SetSpeedRamp (hardware fade), backward fix |
+ * | 15/10/2026 | L293GetSpeed (motion planner)                  |
  *
  */
 
@@ -70,6 +72,23 @@ uint8_t L293Init(void);
  */
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed);
 
+/**
+ * @brief  		Changes the speed of a motor gradually, ramped by the PWM hardware
+ * @note		Returns immediately. A change of direction ramps from stopped.
+ * @param[in]  	motor: 	motor to be configured
+ * @param[in]  	speed: 	target speed, from -100 to 100
+ * @param[in]  	time_ms: duration of the ramp (0: immediate, as L293SetSpeed)
+ * @retval 		0 when success, 1 when fails
+ */
+uint8_t L293SetSpeedRamp(l293_motor_t motor, int8_t speed, uint32_t time_ms);
+
+/**
+ * @brief  		Last speed commanded to a motor
+ * @param[in]  	motor: 	motor
+ * @retval 		speed, from -100 to 100
+ */
+int8_t L293GetSpeed(l293_motor_t motor);
+
 /**
  * @brief  	De-initializes L293 Driver
  * @param	None
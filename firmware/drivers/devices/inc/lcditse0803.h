@@ -30,6 +30,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | BCD lines written at once on dedicated GPIO							|
+ * | 15/10/2026 | Timer driven refresh mode												|
  * 
  **/
 
@@ -73,6 +75,25 @@ bool LcdItsE0803Write(uint16_t value);
  */
 uint16_t LcdItsE0803Read(void);
 
+/**
+ * @brief Starts the background refresh: a soft timer latches one digit every
+ * period from a pin pattern table, and LcdItsE0803Write only updates the table
+ * when the value changes.
+ * 
+ * @note Needs the BCD and SEL lines on dedicated GPIO (7 channels free at
+ * LcdItsE0803Init).
+ * 
+ * @param period_us Time between two digits (in us), every digit is latched each 3 periods
+ * @return true if the refresh started
+ */
+bool LcdItsE0803StartRefresh(uint32_t period_us);
+
+/**
+ * @brief Stops the background refresh, LcdItsE0803Write latches the digits again.
+ * 
+ */
+void LcdItsE0803StopRefresh(void);
+
 /**
  * @brief Turn off display.
  * 
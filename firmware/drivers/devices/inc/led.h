@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | LedsMask and LedsOffAll in one GPIO register operation				|
  * 
  **/
 
@@ -79,6 +80,8 @@ uint8_t LedsOffAll(void);
 /**
  * @brief Turn on or off leds from a mask.
  * 
+ * All the LEDs change together (GPIOWriteMask), without intermediate states.
+ * 
  * @param mask (b0: LED_3, b1: LED_2, b2: LED_1)
  * @return uint8_t 
  */
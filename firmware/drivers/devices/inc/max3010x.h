@@ -13,6 +13,8 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "gpio_mcu.h"
+#include "sensor.h"
 
 #define MAX30105_ADDRESS          0x57 //7-bit I2C Address
 //Note that MAX30102 has the same I2C address and Part ID
@@ -98,6 +100,17 @@
   uint32_t MAX3010X_getFIFOIR(void); //Returns the FIFO sample pointed to by tail
   uint32_t MAX3010X_getFIFOGreen(void); //Returns the FIFO sample pointed to by tail
 
+  //Samples not consumed yet, read in place: each channel is one or two contiguous runs of the ring
+  //(the second one from the start of the storage when the samples wrap). len[1] is 0 when they don't
+  typedef struct {
+    const uint32_t *red[2];
+    const uint32_t *ir[2];
+    const uint32_t *green[2];
+    uint8_t len[2];
+  } max3010x_span_t;
+  uint8_t MAX3010X_getSpan(max3010x_span_t *span); //Fills span with the samples available, returns their number
+  void MAX3010X_consume(uint8_t n); //Advances the tail n samples (up to the samples available)
+
   uint8_t MAX3010X_getWritePointer(void);
   uint8_t MAX3010X_getReadPointer(void);
   void MAX3010X_clearFIFO(void); //Sets the read/write pointers to zero
@@ -113,6 +126,17 @@
   uint8_t MAX3010X_getRevisionID();
   uint8_t MAX3010X_readPartID();
 
+  // Interrupt driven acquisition (A_FULL interrupt on the INT pin)
+  #define MAX3010X_MAX_SUBSCRIBERS 4
+  //Called from the acquisition task with each block drained from the FIFO (unused channels are not written)
+  typedef void (*max3010x_block_cb_t)(const uint32_t *red, const uint32_t *ir, const uint32_t *green, uint8_t samples, void *param);
+  bool MAX3010X_subscribe(max3010x_block_cb_t callback, void *param); //Adds a block consumer
+  bool MAX3010X_startAcquisition(gpio_t int_pin, uint8_t watermark); //watermark: samples per block (17 to 32)
+  void MAX3010X_stopAcquisition(void);
+  //Interrupt driven acquisition as a sensor_t (sensor.h): 2 x uint32 red and IR raw counts. The period
+  //sets the nearest sample rate step (50 Hz to 3.2 kHz), divided by the sample averaging of MAX3010X_setup
+  const sensor_t *MAX3010X_sensor(gpio_t int_pin);
+
   // Setup the IC with user selectable settings
   //void MAX3010X_setup(byte powerLevel = 0x1F, byte sampleAverage = 4, byte ledMode = 3, int sampleRate = 400, int pulseWidth = 411, int adcRange = 4096);
   void MAX3010X_setup(uint8_t powerLevel, uint8_t sampleAverage, uint8_t ledMode, int sampleRate , int pulseWidth, int adcRange);
@@ -128,7 +152,7 @@
 
   void bitMask(uint8_t reg, uint8_t mask, uint8_t thing);
 
-   #define STORAGE_SIZE 4 //Each long is 4 bytes so limit this to fit on your micro
+   #define STORAGE_SIZE 32 //Each long is 4 bytes so limit this to fit on your micro (32: a whole FIFO)
   typedef struct Record
   {
     uint32_t red[STORAGE_SIZE];
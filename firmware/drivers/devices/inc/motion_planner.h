@@ -0,0 +1,139 @@
+#ifndef MOTION_PLANNER_H
+#define MOTION_PLANNER_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Motion_Planner Motion planner
+ ** @{ */
+
+/** \brief Smooth, synchronized movements of servos (servo_sg90.h) and DC motors (l293.h).
+ *
+ * Every axis (a servo position or a motor speed) follows a trapezoidal or
+ * S-curve trajectory, stepped by one periodic soft timer (timer_mcu.h) for all
+ * the axes: no task is involved once a movement is started. The shape of both
+ * profiles is precomputed at MotionInit in a table of the normalized position
+ * (MOTION_TABLE_SIZE points, Q15); every tick each moving axis only reads the
+ * table at its phase and scales it to its duty, with integer math.
+ *
+ * The axes given to one MotionMove start at the same tick and arrive at the same
+ * tick. A later MotionMove retargets its axes from where they are, the rest
+ * keep moving.
+ *
+ * | axis                    | value                   | output                          |
+ * |:------------------------|:------------------------|:--------------------------------|
+ * | MotionAddServo()        | angle, -90 to 90 deg    | PWM duty (full resolution)      |
+ * | MotionAddMotor()        | speed, -100 to 100      | L293SetSpeed                    |
+ *
+ * @note ServoInit / L293Init must be called first. While an axis belongs to
+ * the planner, ServoMove, L293SetSpeed and the ramps must not be called on it.
+ * The tick writes the LEDC duties from the timer interrupt: the LEDC hardware
+ * latches them at the end of the PWM period, so the pulses never glitch. With
+ * the flash cache disabled (flash writes) the tick needs
+ * CONFIG_LEDC_CTRL_FUNC_IN_IRAM (and CONFIG_GPIO_CTRL_FUNC_IN_IRAM for motors).
+ *
+ * @code
+ * ServoInit(SERVO_0, GPIO_19);
+ * ServoInit(SERVO_1, GPIO_18);
+ * MotionInit(20);                                 // one tick per servo frame
+ * int8_t pan = MotionAddServo(SERVO_0);
+ * int8_t tilt = MotionAddServo(SERVO_1);
+ * motion_target_t look[] = {{pan, 45}, {tilt, -30}};
+ * MotionMove(look, 2, 800, MOTION_SCURVE);        // both arrive together
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "servo_sg90.h"
+#include "l293.h"
+/*==================[macros]=================================================*/
+#define MOTION_MAX_AXES		6		/*!< Axes of the planner (4 servos and 2 motors) */
+#define MOTION_TABLE_SIZE	128		/*!< Points of each profile table */
+/*==================[typedef]================================================*/
+/**
+ * @brief Shape of a movement
+ */
+typedef enum {
+	MOTION_TRAPEZOIDAL,		/*!< Constant acceleration in the first and last quarters, constant speed between */
+	MOTION_SCURVE,			/*!< Minimum jerk: acceleration starts and ends at zero */
+} motion_profile_t;
+
+/**
+ * @brief Target of an axis in a movement
+ */
+typedef struct {
+	int8_t axis;			/*!< Axis (MotionAddServo, MotionAddMotor) */
+	int8_t value;			/*!< Angle (degrees) or speed (-100 to 100) */
+} motion_target_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Compute the profile tables and prepare the tick timer
+ *
+ * @param period_ms	Tick period (20 ms, the servo frame, is enough for servos)
+ * @return true		Ready
+ * @return false	Invalid period
+ */
+bool MotionInit(uint16_t period_ms);
+
+/**
+ * @brief Add a servo, held at its current duty
+ *
+ * @param servo		Servo (ServoInit already called)
+ * @return int8_t	Axis, -1 if there are MOTION_MAX_AXES already
+ */
+int8_t MotionAddServo(servo_out_t servo);
+
+/**
+ * @brief Add a DC motor, kept at its current speed
+ *
+ * @param motor		Motor (L293Init already called)
+ * @return int8_t	Axis, -1 if there are MOTION_MAX_AXES already
+ */
+int8_t MotionAddMotor(l293_motor_t motor);
+
+/**
+ * @brief Move some axes together, from their current values to the targets
+ *
+ * Returns immediately, the timer ticks the movement.
+ *
+ * @param targets	Axes and targets
+ * @param n			Number of targets
+ * @param time_ms	Duration (0: at once)
+ * @param profile	Shape of the movement
+ * @return true		Started
+ * @return false	Not initialized or invalid axis
+ */
+bool MotionMove(const motion_target_t *targets, uint8_t n, uint32_t time_ms, motion_profile_t profile);
+
+/**
+ * @brief Stop every movement, the axes hold their current values
+ */
+void MotionStop(void);
+
+/**
+ * @brief Whether an axis is moving
+ *
+ * @param axis		Axis, -1 for any axis
+ * @return true		Moving
+ */
+bool MotionBusy(int8_t axis);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef MOTION_PLANNER_H */
+
+/*==================[end of file]============================================*/
@@ -9,6 +9,11 @@
 
 /** \brief MPU6050 sensor module is a 6-axis Motion Tracking Device. It combines 3-axis Accelerometer and 3-axis Gyroscope. It communicates with the EDU-ESP
  * board via I2C.
+ *
+ * @note MPU6050_initialize enables the register shadow of i2c_mcu: the set*
+ * functions of configuration registers don't read them again once known. A
+ * series of set* calls can be sent together between
+ * I2C_shadowBegin(I2C_getDevice(MPU6050_DEFAULT_ADDRESS)) and I2C_shadowCommit.
  * 
  * @author Juan Ignacio Cerrudo
  *
@@ -17,11 +22,19 @@
  * |   Date	| Description                                    			|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         		|
+ * | 14/10/2026 | FIFO burst acquisition driven by the data ready interrupt	|
+ * | 14/10/2026 | Register shadow (configuration read-modify-writes)		|
+ * | 15/10/2026 | Free fall, motion and zero motion events on the INT pin	|
+ * | 15/10/2026 | DMP image upload and quaternion FIFO packets			|
+ * | 15/10/2026 | Common sensor interface (MPU6050_sensor)			|
+ * | 15/10/2026 | Acquisition task priority from the schedule table		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "i2c_mcu.h"
+#include "gpio_mcu.h"
+#include "sensor.h"
 /*==================[macros]=================================================*/
 #undef pgm_read_byte
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
@@ -407,9 +420,94 @@
 #define MPU6050_DMP_MEMORY_BANKS        8
 #define MPU6050_DMP_MEMORY_BANK_SIZE    256
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
-// note: DMP code memory blocks defined at end of header file
+#define MPU6050_DMP_QUAT_SIZE           16  // quaternion of a DMP packet: 4 x int32 Q30, big endian
+#define MPU6050_DMP_BLOCK_PACKETS       15  // quaternions given per callback (one FIFO burst of 16 byte packets)
+// note: the DMP image is given to MPU6050_dmpLoad(), it is not part of the driver
+
+#define MPU6050_FIFO_SIZE           1024
+#define MPU6050_FIFO_FRAME_SIZE     12  // accel XYZ + gyro XYZ, 16 bits each
+#define MPU6050_BLOCK_FRAMES        (MPU6050_FIFO_SIZE / MPU6050_FIFO_FRAME_SIZE)
+#define MPU6050_MAX_SUBSCRIBERS     4
 
 /*==================[typedef]================================================*/
+/** Block of frames drained from the FIFO, one array per axis (raw values).
+ * Only the first frames elements of each array are valid.
+ */
+typedef struct {
+    int16_t ax[MPU6050_BLOCK_FRAMES];
+    int16_t ay[MPU6050_BLOCK_FRAMES];
+    int16_t az[MPU6050_BLOCK_FRAMES];
+    int16_t gx[MPU6050_BLOCK_FRAMES];
+    int16_t gy[MPU6050_BLOCK_FRAMES];
+    int16_t gz[MPU6050_BLOCK_FRAMES];
+    uint8_t frames;
+} mpu6050_block_t;
+
+/** Block consumer, called from the acquisition task. */
+typedef void (*mpu6050_block_cb_t)(const mpu6050_block_t *block, void *param);
+
+/** Events of the motion detection engines (bit mask). */
+typedef enum {
+    MPU6050_EVENT_FALL = (1 << 0),       // every axis under the free fall threshold for fall_ms
+    MPU6050_EVENT_MOTION = (1 << 1),     // some axis over the motion threshold for motion_ms
+    MPU6050_EVENT_STILL = (1 << 2),      // every axis under the zero motion threshold for still_ms
+    MPU6050_EVENT_STILL_END = (1 << 3)   // the zero motion period ended (enabled with MPU6050_EVENT_STILL)
+} mpu6050_event_t;
+
+/** Configuration of the motion detection engines.
+ * The engines see the accelerometer through the DHPF (see setDHPFMode()):
+ * the free fall one needs MPU6050_DHPF_RESET (the filter off, gravity included),
+ * the motion and zero motion ones a cut off frequency, or MPU6050_DHPF_HOLD to
+ * compare with the sample held when the events start.
+ * Thresholds have a unit of 2 mg, up to 510 mg.
+ */
+typedef struct {
+    uint8_t events;         // MPU6050_EVENT_FALL, MPU6050_EVENT_MOTION and/or MPU6050_EVENT_STILL
+    uint8_t dhpf;           // MPU6050_DHPF_* mode
+    uint16_t fall_mg;       // free fall threshold
+    uint8_t fall_ms;        // free fall duration
+    uint16_t motion_mg;     // motion threshold
+    uint8_t motion_ms;      // motion duration
+    uint16_t still_mg;      // zero motion threshold
+    uint16_t still_ms;      // zero motion duration (unit of 64 ms)
+} mpu6050_events_config_t;
+
+/** DMP firmware image.
+ * The image (InvenSense MotionApps or eMPL) is not distributed with the driver:
+ * the application provides it with the layout of the FIFO packets it writes.
+ */
+typedef struct {
+    const uint8_t *code;        // program memory image
+    uint16_t size;              // image size (bytes, up to MPU6050_DMP_MEMORY_BANKS banks)
+    uint16_t start_address;     // program start address (DMP_CFG_1 and DMP_CFG_2)
+    uint8_t rate_divider;       // SMPLRT_DIV while the DMP runs (4: 200 Hz)
+    uint8_t packet_size;        // FIFO packet size (bytes)
+    uint8_t quat_offset;        // offset of the quaternion in the packet
+} mpu6050_dmp_image_t;
+
+/** Unit quaternion fused by the DMP. */
+typedef struct {
+    float w;
+    float x;
+    float y;
+    float z;
+} mpu6050_quat_t;
+
+/** Quaternions of the DMP packets drained from the FIFO.
+ * Only the first packets elements are valid.
+ */
+typedef struct {
+    mpu6050_quat_t q[MPU6050_DMP_BLOCK_PACKETS];
+    uint8_t packets;
+} mpu6050_quat_block_t;
+
+/** Quaternion consumer, called from the acquisition task. */
+typedef void (*mpu6050_quat_cb_t)(const mpu6050_quat_block_t *block, void *param);
+
+/** Event consumer, called from the acquisition task.
+ * @param events MPU6050_EVENT_* detected since the last call
+ */
+typedef void (*mpu6050_event_cb_t)(uint8_t events, void *param);
 
 /*==================[external data declaration]==============================*/
 
@@ -2669,6 +2767,122 @@ uint8_t MPU6050_getDeviceID();
  */
 void MPU6050_setDeviceID(uint8_t id);
 
+// FIFO burst acquisition
+/** Add a consumer of the blocks drained by the acquisition task.
+ * @param callback Function called with each block
+ * @param param Pointer passed to the callback
+ * @return False if there are already MPU6050_MAX_SUBSCRIBERS consumers
+ * @see MPU6050_startAcquisition()
+ */
+bool MPU6050_subscribe(mpu6050_block_cb_t callback, void *param);
+
+/** Start the FIFO burst acquisition.
+ * Accel and gyro frames are stored in the FIFO at the Sample Rate (see
+ * setRate() and setDLPFMode()) and the data ready interrupt is routed to the
+ * INT pin. Every frames_per_block interrupts the acquisition task reads
+ * FIFO_COUNT and drains the frames with a few I2C_readBytes bursts (21 frames
+ * each), which are given to the subscribers as a mpu6050_block_t. If the FIFO
+ * overflows it is reset and the pending frames are lost.
+ * @param int_pin GPIO connected to INT
+ * @param frames_per_block Frames accumulated before each drain (1 to MPU6050_BLOCK_FRAMES / 2)
+ * @return False if the acquisition task could not be created
+ */
+bool MPU6050_startAcquisition(gpio_t int_pin, uint8_t frames_per_block);
+
+/** Stop the FIFO burst acquisition.
+ * Disables the data ready interrupt and the FIFO. The events keep their
+ * interrupts (see MPU6050_startEvents()).
+ */
+void MPU6050_stopAcquisition(void);
+
+/** Start the detection of motion events by the MPU6050 engines.
+ * The free fall, motion and zero motion interrupts are routed to the INT pin
+ * and the acquisition task reads INT_STATUS and calls callback with the
+ * events. Without the acquisition nothing else drives INT: the host is
+ * idle until the sensor detects an event. With the acquisition running the
+ * events are read once per block (up to 1 / MPU6050 drain rate of delay).
+ * Calling it again replaces the configuration and the callback.
+ * @param int_pin GPIO connected to INT (the same one of MPU6050_startAcquisition())
+ * @param config Engines and thresholds
+ * @param callback Function called with the events
+ * @param param Pointer passed to the callback
+ * @return False if the acquisition task could not be created
+ */
+bool MPU6050_startEvents(gpio_t int_pin, const mpu6050_events_config_t *config,
+                         mpu6050_event_cb_t callback, void *param);
+
+/** Stop the detection of motion events.
+ * Disables the free fall, motion and zero motion interrupts.
+ */
+void MPU6050_stopEvents(void);
+
+// DMP
+/** Write a block of the DMP memory.
+ * The block is written MPU6050_DMP_MEMORY_CHUNK_SIZE bytes at a time, without
+ * crossing the banks.
+ * @param data Bytes to be written
+ * @param size Number of bytes
+ * @param bank First memory bank
+ * @param address First address in the bank
+ * @param verify Read the block back and compare it
+ * @return False if the I2C transfer failed or the verification didn't match
+ */
+bool MPU6050_writeMemoryBlock(const uint8_t *data, uint16_t size, uint8_t bank, uint8_t address, bool verify);
+
+/** Read a block of the DMP memory.
+ * @param data Bytes read
+ * @param size Number of bytes
+ * @param bank First memory bank
+ * @param address First address in the bank
+ * @return False if the I2C transfer failed
+ */
+bool MPU6050_readMemoryBlock(uint8_t *data, uint16_t size, uint8_t bank, uint8_t address);
+
+/** Upload and verify the DMP image, and set its start address.
+ * The DMP is left disabled, see MPU6050_dmpStart().
+ * @param image DMP image (kept until MPU6050_dmpStop(), not copied)
+ * @return False if the image doesn't fit, its packets are too small for the
+ * quaternion or larger than a FIFO burst, or the upload failed
+ */
+bool MPU6050_dmpLoad(const mpu6050_dmp_image_t *image);
+
+/** Start the DMP and give its quaternions.
+ * The DMP fuses the accelerometer and the gyroscope and writes a packet to the
+ * FIFO at its output rate, raising the DMP interrupt on INT. Every
+ * packets_per_block interrupts the acquisition task drains the packets with
+ * one I2C_readBytes burst per MPU6050_DMP_BLOCK_PACKETS (or fewer, for packets
+ * larger than 16 bytes) and gives their quaternions to callback: the host does
+ * no filtering. The raw FIFO acquisition can't run at the same time.
+ * @param int_pin GPIO connected to INT
+ * @param packets_per_block Packets accumulated before each drain (1 to MPU6050_DMP_BLOCK_PACKETS)
+ * @param callback Function called with the quaternions
+ * @param param Pointer passed to the callback
+ * @return False without a loaded image, with the raw acquisition running or
+ * if the acquisition task could not be created
+ */
+bool MPU6050_dmpStart(gpio_t int_pin, uint8_t packets_per_block, mpu6050_quat_cb_t callback, void *param);
+
+/** Stop the DMP.
+ * Disables the DMP, its interrupt and the FIFO. The image stays in the DMP memory.
+ */
+void MPU6050_dmpStop(void);
+
+/** Unpack the quaternion of a DMP packet.
+ * @param packet Quaternion bytes (4 x int32 Q30, big endian, w x y z)
+ * @param q Quaternion
+ */
+void MPU6050_dmpQuaternion(const uint8_t *packet, mpu6050_quat_t *q);
+
+/** FIFO burst acquisition as a sensor_t (sensor.h).
+ * Samples are 6 x int16 raw values: ax, ay, az, gx, gy, gz (scale of the
+ * accelerometer at MPU6050_ACCEL_FS_2, 1/16384 g). Starting it sets the
+ * DLPF to 42 Hz and the Sample Rate to 1 kHz / n, the nearest to the period
+ * not slower than asked, and drains the FIFO about every 10 ms.
+ * @param int_pin GPIO connected to INT
+ * @return The sensor
+ */
+const sensor_t *MPU6050_sensor(gpio_t int_pin);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,143 @@
+#ifndef NEOPIXEL_ANIMATION_H
+#define NEOPIXEL_ANIMATION_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup NeoPixel_Animation NeoPixel_Animation
+ ** @{ */
+
+/** \brief Frame scheduled animations for a NeoPixel stripe (neopixel_stripe.h).
+ *
+ * A task refreshes the stripe at a fixed frame rate. The functions of this
+ * module only store what the stripe should show and mark the frame dirty: the
+ * task computes the colors and starts at most one (asynchronous) refresh per
+ * frame, and only if something changed. A slider that sends 100 values per
+ * second costs a few refreshes, and the caller never waits for the stripe.
+ *
+ * Effects run in the background, in integer math:
+ * - solid color, set at once or faded in a given time
+ * - keyframes: a list of colors, each one reached with a linear transition
+ *   and held (optionally looped: breathing, blinking, color cycles)
+ * - rainbow: a hue gradient that rotates along the stripe
+ * - shift: the stripe contents rotated one position every step
+ *
+ * @note NeoPixelInit must be called first. While the engine runs, the other
+ * neopixel_stripe functions must not be called by the application.
+ *
+ * @code
+ * NeoPixelInit(BUILT_IN_RGB_LED_PIN, BUILT_IN_RGB_LED_LENGTH, &color);
+ * NeoPixelAnimInit(50, 3);
+ * NeoPixelAnimFadeTo(NEOPIXEL_COLOR_BLUE, 300);
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "neopixel_stripe.h"
+/*==================[macros]=================================================*/
+#define NEOPIXEL_ANIM_MAX_KEYFRAMES   16          /*> Keyframes of one animation */
+/*==================[typedef]================================================*/
+/**
+ * @brief Keyframe: color reached in fade_ms (linear transition from the
+ * previous one) and then held for hold_ms
+ */
+typedef struct {
+	neopixel_color_t color;     /*!< 24 bits color */
+	uint16_t fade_ms;           /*!< Transition from the previous color (0: at once) */
+	uint16_t hold_ms;           /*!< Time the color is held */
+} neopixel_keyframe_t;
+
+/**
+ * @brief Frame statistics
+ */
+typedef struct {
+	uint32_t frames;            /*!< Frame ticks */
+	uint32_t refreshes;         /*!< Stripe refreshes started (at most one per frame) */
+	uint32_t updates;           /*!< Calls that changed the animation (coalesced in the refreshes) */
+} neopixel_anim_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the animation task
+ *
+ * @param frame_rate    Frames per second (up to the FreeRTOS tick rate)
+ * @param priority      Priority of the animation task
+ * @return true         Started
+ * @return false        Already started or no memory for the task
+ */
+bool NeoPixelAnimInit(uint16_t frame_rate, uint8_t priority);
+
+/**
+ * @brief Show a color on every NeoPixel from the next frame
+ *
+ * @param color 24 bits color
+ */
+void NeoPixelAnimSetColor(neopixel_color_t color);
+
+/**
+ * @brief Fade every NeoPixel from the current color to a new one
+ *
+ * @param color     24 bits color
+ * @param fade_ms   Transition time
+ */
+void NeoPixelAnimFadeTo(neopixel_color_t color, uint16_t fade_ms);
+
+/**
+ * @brief Play a list of keyframes on every NeoPixel, starting from the current color
+ *
+ * @note The keyframes are copied (up to NEOPIXEL_ANIM_MAX_KEYFRAMES).
+ *
+ * @param keyframes Array of keyframes
+ * @param n         Number of keyframes
+ * @param loop      true: start again after the last one (from its color)
+ */
+void NeoPixelAnimKeyframes(const neopixel_keyframe_t *keyframes, uint8_t n, bool loop);
+
+/**
+ * @brief Rotating rainbow (NeoPixelRainbow moved one step every frame)
+ *
+ * @param period_ms Time of a full turn of the hue
+ * @param sat       Color saturation (HSV color model)
+ * @param val       Color value or brightness (HSV color model)
+ * @param reps      Repetitions of the color pattern along the stripe
+ */
+void NeoPixelAnimRainbow(uint16_t period_ms, uint8_t sat, uint8_t val, uint8_t reps);
+
+/**
+ * @brief Rotate the stripe contents one position every step_ms (NeoPixelShift)
+ *
+ * @param upwards   Shift direction: true: upwards, false: downwards
+ * @param step_ms   Time between shifts
+ */
+void NeoPixelAnimShift(bool upwards, uint16_t step_ms);
+
+/**
+ * @brief Stop the running effect, the stripe keeps its current colors
+ */
+void NeoPixelAnimStop(void);
+
+/**
+ * @brief Get the frame statistics
+ *
+ * @param stats Pointer to the struct where the statistics are copied
+ */
+void NeoPixelAnimGetStats(neopixel_anim_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
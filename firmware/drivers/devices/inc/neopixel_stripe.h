@@ -13,6 +13,14 @@
  * (with no limits in the qty of leds in the array).
  * 
  * @note ESP-EDU have one individual NeoPixel connected to GPIO_8, that can be used with this driver.
+ *
+ * @note The stripe is refreshed in the background (RMT peripheral): functions
+ * return as soon as the transfer is started. The color array must not be
+ * modified by the application until NeoPixelWait returns.
+ *
+ * @note Stripes up to NEOPIXEL_MAX_LENGTH NeoPixels are kept encoded in the
+ * format sent to the leds: only the pixels that change are encoded again.
+ * Longer stripes are encoded on every refresh.
  * 
  * @author Albano Peñalva
  *
@@ -21,6 +29,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Stripe refreshed in the background (ws2812b RMT backend)              |
+ * | 14/10/2026 | Brightness/gamma LUT and pre-encoded frame, updated per pixel         |
  * 
  **/
 
@@ -30,6 +40,9 @@
 #include "esp_err.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#ifndef NEOPIXEL_MAX_LENGTH
+#define NEOPIXEL_MAX_LENGTH           256           /*> Longest stripe kept pre-encoded (3 bytes per NeoPixel) */
+#endif
 #define BUILT_IN_RGB_LED_PIN          GPIO_8        /*> ESP32-C6-DevKitC-1 NeoPixel it's connected at GPIO_8 */
 #define BUILT_IN_RGB_LED_LENGTH       1             /*> ESP32-C6-DevKitC-1 NeoPixel has one pixel */
 
@@ -110,6 +123,13 @@ void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color);
  */
 void NeoPixelSetArray(neopixel_color_t *color_array);
 
+/**
+ * @brief Wait until the stripe refresh is finished.
+ * 
+ * @note Needed only before modifying the color array directly.
+ */
+void NeoPixelWait(void);
+
 /**
  * @brief Shift the all NeoPixel colors in the array 1 position (up or down)
  * 
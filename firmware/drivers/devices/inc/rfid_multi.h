@@ -0,0 +1,105 @@
+#ifndef RFID_MULTI_H_
+#define RFID_MULTI_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup RFID_Multi RFID Multi
+ ** @{ */
+
+/** \brief Polling of several MFRC522 readers on the shared SPI bus
+ *
+ * One task polls every reader (one per SPI chip select, SPI_1 to SPI_3) once
+ * per period. A REQA that nobody answers costs a reader its full 25 ms
+ * timeout, so polling the readers one after the other would take n x 25 ms
+ * per round. Instead the REQA of every reader is started back to back
+ * (PICC_RequestAStart, a few SPI transactions each), all of them are on air
+ * at the same time, and after PICC_REQA_ANSWER_US the answers are collected
+ * (PICC_RequestAResult). Only the readers with a card go on to the
+ * anticollision and select, in round-robin order (starting after the last
+ * reader served) so no antenna is starved. A round with no card takes about
+ * 1 ms of bus time whatever the number of readers, and the latency of any
+ * reader is bounded by the period plus the cards served before it.
+ *
+ * For every card selected the callback is called from the polling task, with
+ * the UID in mfrc->uid and the field on, so it can authenticate and use the
+ * MIFARE functions (rfid_utils.h). The card is halted when the callback
+ * returns: it is reported once, until it leaves the field.
+ *
+ * @code
+ * MFRC522Ptr_t readers[2];
+ * readers[0] = MFRC522_Init();
+ * readers[0]->spi_dev = SPI_1;
+ * ...
+ * PCD_Init(readers[0]);
+ * PCD_Init(readers[1]);
+ * RfidMultiInit(readers, 2, 100, CardSeen, NULL, 5);
+ * @endcode
+ *
+ * @note The readers share the burst buffers of the MFRC522 driver: while
+ * the polling runs, use them only from the callback.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "MFRC522.h"
+/*==================[macros]=================================================*/
+#define RFID_MULTI_MAX		MFRC_MAX_INSTANCES	/*!< Readers polled */
+/*==================[typedef]================================================*/
+/**
+ * @brief Function called for every card selected
+ *
+ * @param reader	Index of the reader in the array given to RfidMultiInit
+ * @param mfrc		Reader, the UID is in mfrc->uid
+ * @param param		Parameter given to RfidMultiInit
+ */
+typedef void (*rfid_multi_cb_t)(uint8_t reader, MFRC522Ptr_t mfrc, void *param);
+
+/**
+ * @brief Polling statistics
+ */
+typedef struct {
+	uint32_t rounds;		/*!< Polling rounds */
+	uint32_t cards;			/*!< Cards selected */
+	uint32_t errors;		/*!< Answers to the REQA that could not be selected (collisions, noise) */
+	uint32_t max_round_us;	/*!< Longest round, callbacks included */
+} rfid_multi_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Starts polling initialized readers (after PCD_Init)
+ *
+ * @param mfrc		Readers (the array is copied)
+ * @param n			Number of readers, up to RFID_MULTI_MAX
+ * @param period_ms	Time between the start of two rounds (ms)
+ * @param func		Function called for every card selected
+ * @param param		Parameter of the function
+ * @param priority	Priority of the polling task
+ * @return true		Polling
+ * @return false	Already running, invalid arguments or no memory for the task
+ */
+bool RfidMultiInit(MFRC522Ptr_t *mfrc, uint8_t n, uint16_t period_ms, rfid_multi_cb_t func, void *param, uint8_t priority);
+
+/**
+ * @brief Get the polling statistics
+ *
+ * @param stats	Pointer to the struct where the statistics are copied
+ * @param reset	true to start counting again
+ */
+void RfidMultiGetStats(rfid_multi_stats_t *stats, bool reset);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RFID_MULTI_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,94 @@
+#ifndef RFID_PRESENCE_H_
+#define RFID_PRESENCE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup RFID_Presence RFID Presence
+ ** @{ */
+
+/** \brief Low-power card presence detection for the MFRC522
+ *
+ * Between probes the MFRC522 stays in soft power-down with the antenna off.
+ * Each probe powers it up, turns the field on just long enough for a card to
+ * answer a REQA and, if one does, selects it at once (the UID is left in
+ * mfrc->uid), so the caller can go straight to PCD_Authenticate() and the
+ * MIFARE functions while the field is still on. Otherwise the field is turned
+ * off again and the interval until the next probe doubles, from
+ * min_interval_ms up to max_interval_ms; every detected card brings it back
+ * to min_interval_ms.
+ *
+ * @note The MFRC522 has no low-power card detection of its own (the RF level
+ * detector only senses external fields), so the field is duty-cycled: with
+ * the default intervals it is on less than 1 % of the time while idle.
+ *
+ * @note A card is reported once: RfidPresenceRelease() halts it, and a halted
+ * card doesn't answer a REQA until it leaves the field.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "MFRC522.h"
+/*==================[macros]=================================================*/
+#define RFID_PRESENCE_FOREVER	UINT32_MAX	/*!< RfidPresenceWait timeout: wait until a card shows up */
+#define RFID_PRESENCE_MIN_MS	100			/*!< Default shortest probe interval (ms) */
+#define RFID_PRESENCE_MAX_MS	1000		/*!< Default longest probe interval (ms) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Presence detection configuration
+ */
+typedef struct {
+	uint16_t min_interval_ms;	/*!< Probe interval after a card was detected (ms, 0: RFID_PRESENCE_MIN_MS) */
+	uint16_t max_interval_ms;	/*!< Longest probe interval while no card shows up (ms, 0: RFID_PRESENCE_MAX_MS) */
+} rfid_presence_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Starts the presence detection on an initialized reader (after
+ * PCD_Init), leaving it powered down with the antenna off
+ *
+ * @param mfrc		Reader
+ * @param config	Probe intervals, NULL for the defaults
+ */
+void RfidPresenceInit(MFRC522Ptr_t mfrc, const rfid_presence_config_t *config);
+
+/**
+ * @brief Blocks the calling task until a card is detected and selected
+ *
+ * @note The task sleeps between probes. On success the field stays on until
+ * RfidPresenceRelease().
+ *
+ * @param timeout_ms	Maximum wait (ms), or RFID_PRESENCE_FOREVER
+ * @return true		A card is selected, its UID is in mfrc->uid
+ * @return false	No card before the timeout
+ */
+bool RfidPresenceWait(uint32_t timeout_ms);
+
+/**
+ * @brief Ends the session with the detected card (HaltA and Crypto1 off) and
+ * powers the reader down until the next probe
+ */
+void RfidPresenceRelease(void);
+
+/**
+ * @brief Current probe interval
+ *
+ * @return uint16_t Time between probes (ms)
+ */
+uint16_t RfidPresenceInterval(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RFID_PRESENCE_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,6 +16,11 @@
 
 #include "MFRC522.h"
 
+// Bytes in a MIFARE Classic block
+#define RFID_BLOCK_SIZE 16
+// Cards whose key is kept by rfidSetCardKey()
+#define RFID_KEY_CACHE_LEN 4
+
 /**
  * Setup an MFRC522_T instance and pin configurations. 
  * Tailored to LPCXpresso4337, to be used in other boards check pin configuration and SPI settings. 
@@ -24,6 +29,49 @@
  */
 void setupRFID(MFRC522Ptr_t* mfrc522);
 
+/**
+ * Stores the key A of a card in the per-UID key cache (RFID_KEY_CACHE_LEN
+ * cards, the oldest entry is replaced). Cards not in the cache use the
+ * factory key FFFFFFFFFFFFh.
+ * @param  uid Card UID
+ * @param  key Key A of the card sectors
+ * @return     0 if no errors
+ */
+int rfidSetCardKey(const Uid *uid, const MIFARE_Key *key);
+
+/**
+ * Reads consecutive blocks of the selected card (mfrc522->uid). Each sector is
+ * authenticated once per session: reads and writes on an already authenticated
+ * sector of the same card skip the Crypto1 handshake.
+ * @param  mfrc522   MFRC522 ADT pointer
+ * @param  blockAddr first block address
+ * @param  count     number of blocks
+ * @param  buffer    caller buffer, count * RFID_BLOCK_SIZE bytes
+ * @return           0 is no error, -1 is authentication error -2 is read error
+ */
+int rfidReadBlocks(MFRC522Ptr_t mfrc522, uint8_t blockAddr, uint8_t count,
+				   uint8_t *buffer);
+
+/**
+ * Writes consecutive blocks of the selected card, see rfidReadBlocks()
+ * @param  mfrc522   MFRC522 ADT pointer
+ * @param  blockAddr first block address
+ * @param  count     number of blocks
+ * @param  buffer    caller buffer, count * RFID_BLOCK_SIZE bytes
+ * @return           0 is no error, -1 is authentication error -2 is write
+ *                   error, -3 if a block is a sector trailer (not written)
+ */
+int rfidWriteBlocks(MFRC522Ptr_t mfrc522, uint8_t blockAddr, uint8_t count,
+					const uint8_t *buffer);
+
+/**
+ * Ends the session with the card: halts it and stops Crypto1 on the PCD.
+ * Call it when done with the card (readCardBalance() and writeCardBalance()
+ * leave the session open).
+ * @param  mfrc522 MFRC522 ADT pointer
+ */
+void rfidSessionClose(MFRC522Ptr_t mfrc522);
+
 /**
  * Example function to read the card  balance, the balance is stored in the 
  * block 4 (sector 1), the first 4 bytes
@@ -0,0 +1,231 @@
+#ifndef SENSOR_H_
+#define SENSOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Devices Drivers devices
+ ** @{ */
+/** \addtogroup Sensor Sensor
+ ** @{ */
+
+/** \brief Common asynchronous interface of the sensor drivers
+ *
+ * Every sensor driver keeps its own API and, besides, gives a sensor_t: a
+ * table of operations (start, read_block, stop) and the format of its
+ * samples. Once started, the driver acquires in the background (timer,
+ * interrupt, DMA or its own task) and calls the ready callback whenever new
+ * samples are waiting; read_block takes them without blocking. Any sensor can
+ * then be scheduled, batched and published the same way (sensor_scheduler,
+ * middelware).
+ *
+ * A sample is format->channels values of format->type, interleaved (e.g. X, Y,
+ * Z, X, Y, Z...). value * format->scale is the measurement in format->unit.
+ *
+ * | driver        | sensor_t                  | values                          | rate                    |
+ * |:--------------|:--------------------------|:--------------------------------|:------------------------|
+ * | hc_sr04.h     | HcSr04Sensor()            | 1 x uint16, mm                  | period (>= 60 ms)       |
+ * | ADXL335.h     | ADXL335Sensor()           | 3 x float, g                    | period                  |
+ * | mpu6050.h     | MPU6050_sensor()          | 6 x int16, accel and gyro raw   | 1 kHz / n               |
+ * | max3010x.h    | MAX3010X_sensor()         | 2 x uint32, red and IR raw      | 50 Hz to 3.2 kHz steps  |
+ * | hx711.h       | HX711_sensor()            | 1 x int32, raw                  | RATE pin (10 or 80 Hz)  |
+ * | Si7007.h      | Si7007Sensor()            | 2 x int32, 0.01 degC and 0.01 % | period                  |
+ *
+ * The drivers initialize their hardware as before (HcSr04Init, HX711_Init,
+ * MPU6050_initialize...) before the sensor is started.
+ *
+ * @note The ready callback may be called from an interrupt: it must only
+ * notify a task. Samples not read in time are dropped, the newest kept
+ * waiting (sensor_queue_t).
+ *
+ * @code
+ * HcSr04Init(GPIO_3, GPIO_2);
+ * const sensor_t *distance = HcSr04Sensor();
+ * SensorStart(distance, 100000, Ready, task);     // 10 Hz
+ * ...
+ * uint16_t mm[8];
+ * uint16_t n = SensorReadBlock(distance, mm, 8);  // from the notified task
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+/**
+ * @brief Define a statically allocated sample queue
+ * @param name      Queue variable name
+ * @param type      Type of each value
+ * @param channels  Values per sample
+ * @param length    Samples kept (power of two)
+ */
+#define SENSOR_QUEUE_DEFINE(name, type, channels, length)										\
+	_Static_assert(((length) & ((length) - 1)) == 0, "The queue length must be a power of two");	\
+	static type name##_storage[(length) * (channels)];											\
+	static sensor_queue_t name = {																\
+		.data = (uint8_t *)name##_storage,														\
+		.sample_size = (channels) * sizeof(type),												\
+		.mask = (length) - 1,																	\
+	}
+/*==================[typedef]================================================*/
+/**
+ * @brief Type of the values of a sample
+ */
+typedef enum {
+	SENSOR_INT16,
+	SENSOR_UINT16,
+	SENSOR_INT32,
+	SENSOR_UINT32,
+	SENSOR_FLOAT,
+} sensor_value_t;
+
+/**
+ * @brief Sample format
+ */
+typedef struct {
+	const char *name;			/*!< Sensor name */
+	sensor_value_t type;		/*!< Type of each value */
+	uint8_t channels;			/*!< Values per sample, interleaved */
+	float scale;				/*!< value * scale = measurement in unit */
+	const char *unit;			/*!< Unit of each channel, comma separated when they differ */
+	uint32_t min_period_us;		/*!< Shortest sample period */
+} sensor_format_t;
+
+typedef struct sensor sensor_t;
+
+/**
+ * @brief Function called when new samples are waiting (may be from an interrupt)
+ */
+typedef void (*sensor_ready_cb_t)(const sensor_t *sensor, void *param);
+
+/**
+ * @brief Operations of a sensor driver
+ */
+typedef struct {
+	/** Start acquiring a sample every period_us (the nearest period the sensor has) */
+	bool (*start)(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+	/** Copy up to max_samples waiting samples, without blocking; returns the number copied */
+	uint16_t (*read_block)(const sensor_t *sensor, void *samples, uint16_t max_samples);
+	/** Stop acquiring (the samples waiting can still be read) */
+	void (*stop)(const sensor_t *sensor);
+} sensor_ops_t;
+
+/**
+ * @brief Samples between the driver (producer) and read_block (consumer)
+ *
+ * Single producer, single consumer, lock-free: the producer may be an
+ * interrupt. When full the new sample is dropped.
+ */
+typedef struct {
+	uint8_t *data;				/*!< Samples */
+	size_t sample_size;			/*!< Bytes of a sample */
+	uint32_t mask;				/*!< Samples kept - 1 */
+	uint32_t head;				/*!< Samples written (producer) */
+	uint32_t tail;				/*!< Samples read (consumer) */
+	uint32_t dropped;			/*!< Samples dropped, queue full */
+	sensor_ready_cb_t ready;	/*!< Callback of the running acquisition, NULL when stopped */
+	void *param;				/*!< Parameter of the callback */
+	const sensor_t *sensor;		/*!< Sensor given to the callback */
+} sensor_queue_t;
+
+/**
+ * @brief Sensor: operations, sample format and queue of a driver
+ */
+struct sensor {
+	const sensor_ops_t *ops;			/*!< Operations */
+	const sensor_format_t *format;		/*!< Sample format */
+	sensor_queue_t *queue;				/*!< Samples waiting (drivers that buffer them) */
+};
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start a sensor
+ *
+ * @param sensor	Sensor
+ * @param period_us	Sample period (us)
+ * @param ready		Function called when new samples are waiting
+ * @param param		Parameter of the function
+ * @return true		Started
+ * @return false	Already running or the hardware did not start
+ */
+static inline bool SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param){
+	return sensor->ops->start(sensor, period_us, ready, param);
+}
+
+/**
+ * @brief Read the samples waiting (non-blocking)
+ *
+ * @param sensor		Sensor
+ * @param samples		Where the samples are copied (max_samples x SensorSampleSize)
+ * @param max_samples	Room in samples
+ * @return uint16_t		Samples copied
+ */
+static inline uint16_t SensorReadBlock(const sensor_t *sensor, void *samples, uint16_t max_samples){
+	return sensor->ops->read_block(sensor, samples, max_samples);
+}
+
+/**
+ * @brief Stop a sensor
+ *
+ * @param sensor	Sensor
+ */
+static inline void SensorStop(const sensor_t *sensor){
+	sensor->ops->stop(sensor);
+}
+
+/**
+ * @brief Bytes of a sample of a format
+ *
+ * @param format	Sample format
+ * @return size_t	Bytes
+ */
+size_t SensorSampleSize(const sensor_format_t *format);
+
+/**
+ * @brief Empty a queue and attach the callback of a starting acquisition (for the drivers)
+ *
+ * @param queue		Queue
+ * @param sensor	Sensor given to the callback
+ * @param ready		Function called when a sample is written
+ * @param param		Parameter of the function
+ */
+void SensorQueueOpen(sensor_queue_t *queue, const sensor_t *sensor, sensor_ready_cb_t ready, void *param);
+
+/**
+ * @brief Detach the callback: samples are no longer written (for the drivers)
+ *
+ * @param queue		Queue
+ */
+void SensorQueueClose(sensor_queue_t *queue);
+
+/**
+ * @brief Write a sample and call the ready callback (for the drivers, ISR safe)
+ *
+ * @param queue		Queue
+ * @param sample	Sample (queue->sample_size bytes)
+ * @param notify	Call the ready callback (false for all but the last sample of a burst)
+ * @return true		Written
+ * @return false	Stopped or full
+ */
+bool SensorQueuePush(sensor_queue_t *queue, const void *sample, bool notify);
+
+/**
+ * @brief read_block of the drivers that use a queue
+ */
+uint16_t SensorQueueReadBlock(const sensor_t *sensor, void *samples, uint16_t max_samples);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SENSOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -18,6 +18,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/01/2024 | Document creation		                         						|
+ * | 14/10/2026 | Full PWM resolution, ServoMoveRamp (hardware fade)					|
+ * | 15/10/2026 | Duty access for the motion planner (motion_planner.h)					|
  * 
  **/
 
@@ -55,6 +57,45 @@ uint8_t ServoInit(servo_out_t servo, gpio_t gpio);
  */
 void ServoMove(servo_out_t servo, int8_t ang);
 
+/**
+ * @brief Move the servo to an angle in a given time, from the current one.
+ * 
+ * The pulse width is ramped by the PWM hardware (PWMFade): the function
+ * returns immediately and no task is needed to step the movement. ServoMove
+ * or a new ramp interrupt it.
+ * 
+ * @param servo Servo number
+ * @param ang Target angle (from -90 to 90 degrees)
+ * @param time_ms Duration of the movement (in ms)
+ */
+void ServoMoveRamp(servo_out_t servo, int8_t ang, uint32_t time_ms);
+
+/**
+ * @brief PWM duty of an angle.
+ * 
+ * @param ang Servo angle (from -90 to 90 degrees)
+ * @return uint16_t Duty (0 to PWM_DUTY_MAX)
+ */
+uint16_t ServoAngleToDuty(int8_t ang);
+
+/**
+ * @brief Set the PWM duty of a servo (ServoMove without the angle conversion).
+ * 
+ * @note Safe from the timer callbacks while no ramp is running.
+ * 
+ * @param servo Servo number
+ * @param duty Duty, from ServoAngleToDuty(-90) to ServoAngleToDuty(90)
+ */
+void ServoSetDuty(servo_out_t servo, uint16_t duty);
+
+/**
+ * @brief Current PWM duty of a servo.
+ * 
+ * @param servo Servo number
+ * @return uint16_t Duty (0 to PWM_DUTY_MAX)
+ */
+uint16_t ServoGetDuty(servo_out_t servo);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -83,10 +83,52 @@
 static  int32_t an_x[ BUFFER_SIZE]; //ir
 static  int32_t an_y[ BUFFER_SIZE]; //red
 
+#define STREAM_RATIO_SIZE 5     // beats used for the SpO2 ratio median (5 at most, sorting network)
+#define STREAM_HR_SIZE 4        // beat intervals averaged for the heart rate
+
+/**
+* \brief        State of the streaming heart rate/SpO2 estimator
+* \par          Details
+*               Same pipeline as maxim_heart_rate_and_oxygen_saturation() (DC removal, 4 pt moving average,
+*               IR valley detection, AC/DC ratio between consecutive valleys) updated sample by sample.
+*               Initialize with maxim_stream_init() and feed every sample to maxim_stream_update().
+*/
+typedef struct {
+  int32_t n_fs;                               // sampling frequency
+  int32_t n_min_distance;                     // minimum distance between valleys (samples)
+  uint8_t uch_dc_shift;                       // DC and threshold averaging time constant (2^n samples)
+  int32_t n_t;                                // sample counter
+  int32_t n_ir_dc;                            // ir DC level (Q8)
+  int32_t n_th;                               // peak threshold average (Q8)
+  uint32_t aun_ir_ma[MA4_SIZE];               // ir moving average line
+  uint32_t aun_red_ma[MA4_SIZE];              // red moving average line
+  uint32_t un_ir_sum, un_red_sum;
+  uint8_t uch_ma_idx;
+  int32_t n_x_prev, n_ir_prev, n_red_prev;    // previous moving average output (x: inverted ir AC)
+  bool b_rising;
+  bool b_cand;                                // valley waiting for n_min_distance to be confirmed
+  int32_t n_cand_t, n_cand_x, n_cand_ir, n_cand_red;
+  bool b_valley;                              // a valley was confirmed
+  int32_t n_valley_t, n_valley_ir, n_valley_red;
+  int32_t n_ir_max, n_ir_max_t, n_red_max, n_red_max_t;                   // maxima from last valley to candidate
+  int32_t n_ir_next_max, n_ir_next_max_t, n_red_next_max, n_red_next_max_t; // maxima after candidate
+  int32_t an_ratio[STREAM_RATIO_SIZE];        // last ratios x100, median taken at every beat
+  uint8_t uch_ratio_count, uch_ratio_idx;
+  int32_t an_interval[STREAM_HR_SIZE];
+  int32_t n_interval_sum;
+  uint8_t uch_interval_count, uch_interval_idx;
+  int32_t n_spo2, n_heart_rate;
+  int8_t ch_spo2_valid, ch_hr_valid;
+} maxim_stream_t;
+
 
 void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
 
 
+void maxim_stream_init(maxim_stream_t *ps, int32_t n_fs);
+bool maxim_stream_update(maxim_stream_t *ps, uint32_t un_ir, uint32_t un_red, int32_t *pn_spo2, int8_t *pch_spo2_valid, int32_t *pn_heart_rate, int8_t *pch_hr_valid);
+
+
 void maxim_find_peaks(int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height, int32_t n_min_distance, int32_t n_max_num);
 void maxim_peaks_above_min_height(int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height);
 void maxim_remove_close_peaks(int32_t *pn_locs, int32_t *pn_npks, int32_t *pn_x, int32_t n_min_distance);
@@ -12,6 +12,27 @@
  * @note ESP-EDU have 2 switches connected to GPIO_4 and GPIO_15. 
  * The latter is also routed to J2 connector.
  *
+ * Besides the raw reads (SwitchesRead) and interrupts (SwitchActivInt), the
+ * driver can deliver debounced events through a queue: the edge interrupt
+ * only takes a timestamp and wakes a driver task, which confirms the press
+ * after SWITCH_DEBOUNCE_MS, follows it with a soft timer (a sample every
+ * SWITCH_POLL_MS while a switch is down) and queues press, long press and
+ * double click events. The application waits on SwitchEventGet from a task:
+ *
+ * @code
+ * SwitchesInit();
+ * SwitchEventsInit(SWITCH_1 | SWITCH_2);
+ * while(true){
+ *     switch_event_t event;
+ *     if(SwitchEventGet(&event, SWITCH_WAIT_FOREVER) && event.type == SWITCH_EVENT_PRESS){
+ *         ...
+ *     }
+ * }
+ * @endcode
+ *
+ * @note A switch handled by SwitchEventsInit can't also use SwitchActivInt
+ * (one interrupt handler per pin).
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,6 +40,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 15/10/2026 | Debounced events (press, long press, double click) through a queue	|
  * 
  **/
 
@@ -26,12 +48,36 @@
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SWITCH_DEBOUNCE_MS		20		/*!< Time a switch must stay still to change state */
+#define SWITCH_POLL_MS			10		/*!< Sample period while a switch is down */
+#define SWITCH_LONG_PRESS_MS	800		/*!< Hold time of a long press */
+#define SWITCH_DOUBLE_CLICK_MS	300		/*!< Longest time from a release to the next press of a double click */
+#define SWITCH_EVENT_QUEUE		8		/*!< Events kept until the application reads them */
+#define SWITCH_WAIT_FOREVER		UINT32_MAX	/*!< SwitchEventGet timeout: wait until an event arrives */
 
 /*==================[typedef]================================================*/
 typedef enum switches {
     SWITCH_1 = (1 << 0),  /**< Routed to GPIO_4 */
     SWITCH_2 = (1 << 1),  /**< Routed to GPIO_15 */
 } switch_t;
+
+/**
+ * @brief Switch event types
+ */
+typedef enum {
+    SWITCH_EVENT_PRESS = 0,     /**< Press confirmed (after SWITCH_DEBOUNCE_MS) */
+    SWITCH_EVENT_LONG_PRESS,    /**< Switch held for SWITCH_LONG_PRESS_MS (after its press event) */
+    SWITCH_EVENT_DOUBLE_CLICK,  /**< Second short press within SWITCH_DOUBLE_CLICK_MS (after its press event) */
+} switch_event_type_t;
+
+/**
+ * @brief Switch event
+ */
+typedef struct {
+    switch_t sw;                /**< Switch */
+    switch_event_type_t type;   /**< Event type */
+    uint32_t time_ms;           /**< Time of the press edge (ms since boot) */
+} switch_event_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -58,6 +104,25 @@ int8_t SwitchesRead(void);
  */
 void SwitchActivInt(switch_t tec, void *ptrIntFunc, void *args);
 
+/**
+ * @brief Start the debounced events of the selected switches (after SwitchesInit)
+ * 
+ * @param switches SWITCH_1, SWITCH_2 or (SWITCH_1 | SWITCH_2)
+ * @return true Events started
+ * @return false No memory for the queue or the driver task
+ */
+bool SwitchEventsInit(uint8_t switches);
+
+/**
+ * @brief Wait for the next switch event (task only)
+ * 
+ * @param event Pointer to the struct where the event is stored
+ * @param timeout_ms Longest wait (0: don't wait, SWITCH_WAIT_FOREVER: no limit)
+ * @return true An event was read
+ * @return false No event before the timeout
+ */
+bool SwitchEventGet(switch_event_t *event, uint32_t timeout_ms);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
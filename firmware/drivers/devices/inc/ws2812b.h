@@ -11,6 +11,12 @@
 /** \brief Driver for handling WS2812B RGB leds.
  *
  * @note For handling NeoPixels arrays use "neopixel_stripe.h".
+ *
+ * @note By default the data signal is generated by the RMT peripheral
+ * (WS2812B_RMT = 1): ws2812bSendArray encodes the colors into RMT symbols
+ * while the stripe is refreshed, so the CPU is free and interrupts do not
+ * affect the timing. With WS2812B_RMT = 0 each bit is bit-banged with a
+ * fast GPIO (blocking, timing tied to the CPU clock).
  * 
  * @author Albano Peñalva
  *
@@ -19,6 +25,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | RMT backend, asynchronous ws2812bSendArray                            |
+ * | 14/10/2026 | ws2812bSendFrame for pre-encoded stripes                              |
  * 
  **/
 
@@ -28,6 +36,9 @@
 #include "esp_err.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
+#ifndef WS2812B_RMT
+#define WS2812B_RMT		1		/*!< 1: RMT peripheral, 0: bit-banged GPIO */
+#endif
 
 /*==================[typedef]================================================*/
 /**
@@ -63,6 +74,43 @@ void ws2812bSend(rgb_led_t led_color);
  */
 void ws2812bSendRet(void);
 
+/**
+ * @brief Send the colors of a whole stripe, followed by a ret command.
+ * 
+ * @note With the RMT backend the function returns as soon as the transfer
+ * is started: colors must not be modified until ws2812bWait returns.
+ * 
+ * @param colors    Array of 24 bits colors (0x00RRGGBB)
+ * @param len       Number of leds
+ * @param bright    Brightness applied to every color (0 to 255)
+ */
+void ws2812bSendArray(const uint32_t *colors, uint16_t len, uint8_t bright);
+
+/**
+ * @brief Send a whole stripe already in wire format, followed by a ret command.
+ * 
+ * @note No brightness nor gamma correction is applied. With the RMT backend
+ * the frame must not be modified until ws2812bWait returns.
+ * 
+ * @param frame     3 bytes per led, in transmission order (green, red, blue)
+ * @param len       Number of leds
+ */
+void ws2812bSendFrame(const uint8_t *frame, uint16_t len);
+
+/**
+ * @brief Gamma correction of a color component.
+ * 
+ * @param component Linear level (0 to 255)
+ * @return uint8_t  Level to be sent to the led
+ */
+uint8_t ws2812bGammaCorrection(uint8_t component);
+
+/**
+ * @brief Wait until the last ws2812bSendArray/ws2812bSendFrame transfer is finished.
+ * 
+ */
+void ws2812bWait(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -11,36 +11,37 @@
 /*
  * modification history (new versions first)
  * -----------------------------------------------------------
+ * 20261015 v0.0.4 interfaz común de sensores (ADXL335Sensor)
+ * 20261015 v0.0.3 cambio de la frecuencia de muestreo en modo continuo
+ * 20261015 v0.0.2 vigilancia de los ejes con el monitor digital del ADC
  * 20210609 v0.0.1 initials initial version
  */
 
 /*==================[inclusions]=============================================*/
+#include <math.h>
 #include "ADXL335.h"
+#include "esp_attr.h"
 
 /*==================[macros and definitions]=================================*/
 /** @def MAX_VOLTAGE
  * @brief Máximo valor de voltaje en mV que puede medir el driver
  */
 #define MAX_VOLTAGE 3300
-/** @def MAX_VALUE
- * @brief Máximo valor de bits
- */
-#define MAX_VALUE 1024
 /** @def OFFSET
  * @brief Mitad del valor máximo de voltaje correspondiente en bits
  */
-#define OFFSET 3300.0/2.0
+#define OFFSET (3300.0f/2.0f)
 /** @def SENSITIVITY
  * @brief Valor de la sensibilidad dado por el driver
  */
-#define SENSITIVITY 300.0
+#define SENSITIVITY 300.0f
+/** @def Z_DIVIDER
+ * @brief Factor del divisor resistivo del eje z
+ */
+#define Z_DIVIDER 4
 
 /*==================[internal data declaration]==============================*/
 
-bool conversion; /**< booleando si realiza o no la conversión*/
-uint16_t valor; /**< Valor convertido*/
-uint8_t canal; /**< Canal de la placa*/
-
 /*==================[internal functions declaration]=========================*/
 
 /**@fn float UnitConvert(uint16_t value)
@@ -49,8 +50,37 @@ uint8_t canal; /**< Canal de la placa*/
  */
 float UnitConvert(uint16_t value);
 
+static bool ADXL335SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static uint16_t ADXL335SensorRead(const sensor_t *sensor, void *samples, uint16_t max_samples);
+static void ADXL335SensorStop(const sensor_t *sensor);
+
 /*==================[internal data definition]===============================*/
+static const sensor_ops_t adxl335_ops = {
+	.start = ADXL335SensorStart,
+	.read_block = ADXL335SensorRead,
+	.stop = ADXL335SensorStop,
+};
+
+static const sensor_format_t adxl335_format = {
+	.name = "ADXL335",
+	.type = SENSOR_FLOAT,
+	.channels = 3,
+	.scale = 1.0f,
+	.unit = "g",
+	.min_period_us = 50,
+};
 
+static const sensor_t adxl335_sensor = {
+	.ops = &adxl335_ops,
+	.format = &adxl335_format,
+	.queue = NULL,
+};
+
+static uint8_t sensor_oversampling = 0;		/**< Sobremuestreo de ADXL335Sensor */
+static sensor_ready_cb_t sensor_ready = NULL;
+static void *sensor_param = NULL;
+static adxl335_frame_t sensor_frame;		/**< Trama DMA que se está leyendo */
+static uint16_t sensor_next = 0;			/**< Próxima muestra de sensor_frame */
 
 
 /*==================[external data definition]===============================*/
@@ -62,13 +92,56 @@ analog_input_config_t my_ad_z = {CH3,ADC_SINGLE}; /**< Typedef configuración pu
 /*==================[internal functions definition]==========================*/
 
 float UnitConvert(uint16_t value){
+	/* Conversión en simple precisión: evita la emulación de double en el ESP32-C6 */
+	return ((float)value - OFFSET) * (1.0f / SENSITIVITY);
+}
 
-	float new_value;
+/**@fn static void ADXL335SensorIsr(void *param)
+ * @brief  Fin de trama DMA: avisa que hay muestras
+ */
+static void IRAM_ATTR ADXL335SensorIsr(void *param){
+	sensor_ready_cb_t ready = sensor_ready;
+
+	if(ready != NULL){
+		ready(&adxl335_sensor, sensor_param);
+	}
+}
 
-	new_value = value - OFFSET;
-	new_value = new_value/SENSITIVITY;
+static bool ADXL335SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param){
+	uint32_t frec = 1000000 / ((period_us < adxl335_format.min_period_us) ? adxl335_format.min_period_us : period_us);
 
-	return new_value;
+	sensor_ready = NULL;
+	sensor_param = param;
+	sensor_frame.len = 0;
+	sensor_next = 0;
+	sensor_ready = ready;
+	return ADXL335InitContinuous((frec == 0) ? 1 : frec, sensor_oversampling, ADXL335SensorIsr, NULL);
+}
+
+/* Las tramas se leen de a una y se entregan intercaladas X, Y, Z */
+static uint16_t ADXL335SensorRead(const sensor_t *sensor, void *samples, uint16_t max_samples){
+	float *out = samples;
+	uint16_t n = 0;
+
+	while(n < max_samples){
+		if(sensor_next == sensor_frame.len){
+			sensor_next = 0;
+			if(ADXL335ReadFrame(&sensor_frame) == 0){
+				break;
+			}
+		}
+		out[3 * n] = sensor_frame.x[sensor_next];
+		out[3 * n + 1] = sensor_frame.y[sensor_next];
+		out[3 * n + 2] = sensor_frame.z[sensor_next];
+		sensor_next++;
+		n++;
+	}
+	return n;
+}
+
+static void ADXL335SensorStop(const sensor_t *sensor){
+	sensor_ready = NULL;
+	AnalogStopContinuous(CH1);
 }
 
 /*==================[external functions definition]==========================*/
@@ -81,33 +154,159 @@ bool ADXL335Init(){
 }
 
 int ReadXValueInt(){
+	uint16_t valor;
 	AnalogInputReadSingle(my_ad_x.input, &valor);
 	return valor;
 }
 
+bool ADXL335InitContinuous(uint16_t sample_frec, uint8_t oversampling, void *func_p, void *param_p){
+	analog_input_config_t ad_x = {CH1, ADC_CONTINUOUS, func_p, param_p, sample_frec, oversampling};
+	analog_input_config_t ad_y = {CH2, ADC_CONTINUOUS, NULL, NULL, sample_frec, oversampling};
+	analog_input_config_t ad_z = {CH3, ADC_CONTINUOUS, NULL, NULL, sample_frec, oversampling};
+
+	AnalogInputInit(&ad_x);
+	AnalogInputInit(&ad_y);
+	AnalogInputInit(&ad_z);
+	AnalogStartContinuous(CH1);
+	return 1;
+}
+
+bool ADXL335SetFrequency(uint16_t sample_frec){
+	if(sample_frec == 0){
+		return 0;
+	}
+	AnalogSetContinuousFrequency(sample_frec);
+	return 1;
+}
+
+uint16_t ADXL335ReadFrame(adxl335_frame_t *frame){
+	uint16_t samples[ADC_CONT_FRAME_LEN];
+	adc_ch_t channels[ADC_CONT_FRAME_LEN];
+	uint16_t n;
+	uint8_t seen = 0;
+
+	frame->len = 0;
+	n = AnalogInputReadFrame(samples, channels);
+	/* Se agrupan las conversiones por eje: una muestra XYZ queda completa al recibir los tres canales */
+	for(uint16_t i = 0; i < n; i++){
+		switch(channels[i]){
+			case CH1:
+				frame->x[frame->len] = UnitConvert(samples[i]);
+				seen |= (1 << 0);
+			break;
+			case CH2:
+				frame->y[frame->len] = UnitConvert(samples[i]);
+				seen |= (1 << 1);
+			break;
+			case CH3:
+				frame->z[frame->len] = UnitConvert(samples[i]*Z_DIVIDER); /* Resistor divider for HCSR-04 */
+				seen |= (1 << 2);
+			break;
+			default:
+			break;
+		}
+		if(seen == 0x07){
+			seen = 0;
+			frame->len++;
+			if(frame->len == ADXL335_FRAME_LEN){
+				break;
+			}
+		}
+	}
+	return frame->len;
+}
+
+size_t ADXL335ReadXYZ(adxl335_sample_t *out, size_t n){
+	const adc_ch_t canales[3] = {my_ad_x.input, my_ad_y.input, my_ad_z.input};
+	uint16_t valores[3];
+	for(size_t i = 0; i < n; i++){
+		/* Los tres ejes en una sola llamada, en mV */
+		AnalogInputReadMulti(canales, valores, 3);
+		out[i].raw_x = valores[0];
+		out[i].raw_y = valores[1];
+		out[i].raw_z = valores[2] * Z_DIVIDER; /* Resistor divider for HCSR-04 */
+		out[i].x = UnitConvert(out[i].raw_x);
+		out[i].y = UnitConvert(out[i].raw_y);
+		out[i].z = UnitConvert(out[i].raw_z);
+	}
+	return n;
+}
+
+/**@fn static uint16_t GravityToMv(float value, uint8_t divider)
+ * @brief  Función que convierte una aceleración en la tensión del pin (inversa de UnitConvert)
+ * @return tensión en mV, saturada al rango del ADC
+ */
+static uint16_t GravityToMv(float value, uint8_t divider){
+	float mv = (value * SENSITIVITY + OFFSET) / divider;
+
+	if(mv < 0){
+		return 0;
+	}
+	return (mv > MAX_VOLTAGE) ? MAX_VOLTAGE : (uint16_t)mv;
+}
+
+const sensor_t *ADXL335Sensor(uint8_t oversampling){
+	sensor_oversampling = oversampling;
+	return &adxl335_sensor;
+}
+
+bool ADXL335Watch(const float base[3], float band_g, void *func_p, void *param_p){
+	const adc_ch_t canales[3] = {CH1, CH2, CH3};
+	const uint8_t divisor[3] = {1, 1, Z_DIVIDER};
+	analog_window_t ventanas[ADC_MONITOR_MAX];
+	uint8_t mayor = 0;
+
+	/* Se descarta el eje de mayor aceleración (ADC_MONITOR_MAX es 2) */
+	for(uint8_t i = 1; i < 3; i++){
+		if(fabsf(base[i]) > fabsf(base[mayor])){
+			mayor = i;
+		}
+	}
+	for(uint8_t i = 0, n = 0; i < 3; i++){
+		if(i == mayor){
+			continue;
+		}
+		ventanas[n].input = canales[i];
+		ventanas[n].low_mv = GravityToMv(base[i] - band_g, divisor[i]);
+		ventanas[n].high_mv = GravityToMv(base[i] + band_g, divisor[i]);
+		n++;
+	}
+	return AnalogMonitorArm(ventanas, ADC_MONITOR_MAX, func_p, param_p);
+}
+
+void ADXL335WatchEnd(void){
+	AnalogMonitorDisarm();
+	AnalogFlushContinuous();
+}
+
 float ReadXValue(){
+	uint16_t valor;
 	AnalogInputReadSingle(my_ad_x.input, &valor);
 	return UnitConvert(valor);
 }
 
 int ReadYValueInt(){
+	uint16_t valor;
     AnalogInputReadSingle(my_ad_y.input, &valor);
 	return valor;
 }
 
 float ReadYValue(){
+	uint16_t valor;
 	AnalogInputReadSingle(my_ad_y.input, &valor);
 	return UnitConvert(valor);
 }
 
 int ReadZValueInt(){
+	uint16_t valor;
     AnalogInputReadSingle(my_ad_z.input, &valor);
-	return valor*4; /* Resistor divider for HCSR-04 */
+	return valor*Z_DIVIDER; /* Resistor divider for HCSR-04 */
 }
 
 float ReadZValue(){
+	uint16_t valor;
 	AnalogInputReadSingle(my_ad_z.input, &valor);
-	return UnitConvert(valor*4); /* Resistor divider for HCSR-04 */
+	return UnitConvert(valor*Z_DIVIDER); /* Resistor divider for HCSR-04 */
 }
 
 bool ADXL335DeInit(gpio_t gSelect1, gpio_t gSelect2){
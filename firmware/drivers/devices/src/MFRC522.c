@@ -9,9 +9,21 @@
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
 #include "uart_mcu.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 
 #define SPI_BR 4000000				/*!< Frequency of sck for SPI communication */
+#define PCD_BURST_LEN 64			/*!< Register bytes per SPI transaction (a full FIFO) */
+#define PCD_FRAME_LEN 68			/*!< Address + PCD_BURST_LEN bytes, rounded up to a word for DMA */
+#define PCD_IRQ_TIMEOUT_MS 36		/*!< Emergency break when waiting on the IRQ pin (same as the polling loop) */
+#define PCD_IRQ_INV 0x80			/*!< ComIEnReg IRqInv: IRQ pin low while an enabled request is set */
+#define PCD_IRQ_PUSH_PULL 0x80		/*!< DivIEnReg IRQPushPull: IRQ pin driven high when idle */
+#define PCD_TIMER_US 25				/*!< Period of the MFRC522 timer (TPrescaler 0x0A9) */
+#define PCD_RELOAD_DEFAULT 1000		/*!< Timeout of the commands: 25 ms */
+#define PICC_INVENTORY_TIMEOUT_US 1000	/*!< Inventory timeout: FDT of ISO 14443-3 (< 100 us) and the 1 ms a HLTA is given */
+#define PICC_INVENTORY_ERRORS 4		/*!< Failed rounds before an inventory gives up */
 
 // ADT object allocation counter
 static int MFRC_Instance_Counter = 0;
@@ -28,8 +40,10 @@ spi_mcu_config_t spi_conf = {
 	.func_p = NULL,
 	.param_p = NULL };
 
-static spi_dev_t mfrc522_spi;							/*!< uC SPI port */
-static gpio_t mfrc522_dc, mfrc522_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
+// Burst transaction buffers (DMA capable), shared by the instances: use
+// every reader from the same task (see rfid_multi.h)
+static WORD_ALIGNED_ATTR uint8_t pcd_tx[PCD_FRAME_LEN];
+static WORD_ALIGNED_ATTR uint8_t pcd_rx[PCD_FRAME_LEN];
 
 
 /**
@@ -42,12 +56,17 @@ MFRC522Ptr_t MFRC522_Init() {
 	//		struct MFRC522_T mfrc_struct;
 	//		Chip_SSP_DATA_SETUP_T data_setup;
 
+	if (MFRC_Instance_Counter >= MFRC_MAX_INSTANCES) {
+		return NULL;
+	}
 	// initialize fields
 	uint16_t i;
 	for (i = 0; i < BUFFER_SIZE; i++) {
 		mfrc_Instances[MFRC_Instance_Counter].Rx_Buf[i] = 0;
 		mfrc_Instances[MFRC_Instance_Counter].Tx_Buf[i] = 0;
 	}
+	mfrc_Instances[MFRC_Instance_Counter].irq = false;
+	mfrc_Instances[MFRC_Instance_Counter].irq_task = NULL;
 
 	// assign values
 	
@@ -61,6 +80,35 @@ MFRC522Ptr_t MFRC522_Init() {
 * Basic interface functions for communicating with the MFRC522
 *******************************************************************************/
 
+/**
+ * Runs a complete register access (address and data) in a single full-duplex
+ * SPI transaction, with the chip select held low around it. The device handle
+ * is created once, in PCD_Init(). rx may be NULL for writes.
+ */
+static void PCD_Transfer(MFRC522Ptr_t mfrc, uint8_t *tx, uint8_t *rx, uint8_t len) {
+	// Select slave
+	GPIOOff(mfrc->_chipSelectPin);
+	if (rx == NULL) {
+		SpiWrite(mfrc->spi_dev, tx, len);
+	} else {
+		SpiReadWrite(mfrc->spi_dev, tx, rx, len);
+	}
+	// Release slave again
+	GPIOOn(mfrc->_chipSelectPin);
+} // End PCD_Transfer()
+
+/**
+ * IRQ pin falling edge: a request enabled in ComIEnReg was set.
+ */
+static void IRAM_ATTR PCD_IrqISR(void *arg) {
+	MFRC522Ptr_t mfrc = arg;
+	BaseType_t woken = pdFALSE;
+	if (mfrc->irq_task != NULL) {
+		vTaskNotifyGiveFromISR(mfrc->irq_task, &woken);
+	}
+	portYIELD_FROM_ISR(woken);
+} // End PCD_IrqISR()
+
 /**
  * Writes a uint8_t to the specified register in the MFRC522 chip.
  * The interface is described in the datasheet section 8.1.2.
@@ -70,24 +118,15 @@ void PCD_WriteRegister(
 	uint8_t reg,  ///< The register to write to. One of the PCD_Register enums.
 	uint8_t value ///< The value to write.
 	) {
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
-	
-	
+	uint8_t frame[2];
+
 	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
 	// 8.1.2.3.
-	// SPI.transfer(reg & 0x7E);
-	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-
-	// SPI.transfer(value);
-	mfrc->Tx_Buf[0] = value;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-	// Release slave again
-    GPIOOn(mfrc522_dc);
+	// SPI.transfer(reg & 0x7E); SPI.transfer(value);
+	// Address and value in a single transaction (small transfers skip DMA)
+	frame[0] = (reg & 0x7E);
+	frame[1] = value;
+	PCD_Transfer(mfrc, frame, NULL, 2);
 
 } // End PCD_WriteRegister()
 
@@ -101,22 +140,20 @@ void PCD_WriteNRegister(
 	uint8_t count, ///< The number of uint8_ts to write to the register
 	uint8_t *values ///< The values to write. uint8_t array.
 	) {
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
+	uint8_t len;
 
 	//	SPI.transfer(reg & 0x7E);
 	// MSB == 0 is for writing. LSB is not used in address. Datasheet section
 	// 8.1.2.3.
-	mfrc->Tx_Buf[0] = (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-	SpiWrite(mfrc522_spi, values, count);
-	
-	// Release slave again
-    GPIOOn(mfrc522_dc);
+	// Address followed by up to a full FIFO of values in each transaction
+	while (count > 0) {
+		len = (count > PCD_BURST_LEN) ? PCD_BURST_LEN : count;
+		pcd_tx[0] = (reg & 0x7E);
+		memcpy(&pcd_tx[1], values, len);
+		PCD_Transfer(mfrc, pcd_tx, NULL, len + 1);
+		values += len;
+		count -= len;
+	}
 
 } // End PCD_WriteRegister()
 
@@ -128,29 +165,19 @@ uint8_t PCD_ReadRegister(
 	MFRC522Ptr_t mfrc,
 	uint8_t reg ///< The register to read from. One of the PCD_Register enums.
 	) {
-	uint8_t value;
-
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-	
-	// Select slave
-	GPIOOff(mfrc522_dc);
+	uint8_t tx_frame[2], rx_frame[2];
 
 	// MSB == 1 is for reading. LSB ==0, not used in address. Datasheet section
 	// 8.1.2.3.
 	//	SPI.transfer(0x80 | (reg & 0x7E));
-	mfrc->Tx_Buf[0] = 0x80 | (reg & 0x7E);
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
 	// Read the value back. Send 0 to stop reading.
 	//	value = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0x00;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	value = mfrc->Rx_Buf[0];
+	// Address and read in a single transaction (small transfers skip DMA)
+	tx_frame[0] = 0x80 | (reg & 0x7E);
+	tx_frame[1] = 0x00;
+	PCD_Transfer(mfrc, tx_frame, rx_frame, 2);
 
-	// Release slave again
-    GPIOOn(mfrc522_dc);
-	return value;
+	return rx_frame[1];
 } // End PCD_ReadRegister()
 
 /**
@@ -174,59 +201,31 @@ void PCD_ReadNRegister(
 										   // not used in address. Datasheet
 										   // section 8.1.2.3.
 	uint8_t index = 0;					   // Index in values array.
+	uint8_t len, i;
 
-	// Set the settings to work with SPI bus
-	SpiInit(&spi_conf);
-
-    // Select slave
-	GPIOOff(mfrc522_dc);
-
-	// One read is performed outside of the loop
-	count--;
-
-	// Tell MFRC522 which address we want to read
-	//	SPI.transfer(address);
-	mfrc->Tx_Buf[0] = address;
-	SpiWrite(mfrc522_spi, mfrc->Tx_Buf, 1);
-
-
+	// Full-duplex burst: the address is sent once per value and the MFRC522
+	// answers each byte with the value of the previous address. Send 0 to stop
+	// reading. That is SPI.transfer(address) ... SPI.transfer(0) in one transaction.
 	while (index < count) {
+		len = (count - index > PCD_BURST_LEN) ? PCD_BURST_LEN : count - index;
+		for (i = 0; i < len; i++) {
+			pcd_tx[i] = address;
+		}
+		pcd_tx[len] = 0;
+		PCD_Transfer(mfrc, pcd_tx, pcd_rx, len + 1);
 		if (index == 0 &&
 			rxAlign) { // Only update bit positions rxAlign..7 in values[0]
 			// Create bit mask for bit positions rxAlign..7
-			uint8_t mask = 0;
-			uint8_t i;
-			for (i = rxAlign; i <= 7; i++) {
-				mask |= (1 << i);
-			}
-
-			// Read value and tell that we want to read the same address again.
-			//			uint8_t value = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			uint8_t value = mfrc->Rx_Buf[0];
-
+			uint8_t mask = (uint8_t)(0xFF << rxAlign);
 			// Apply mask to both current value of values[0] and the new data in
 			// value.
-			values[0] = (values[index] & ~mask) | (value & mask);
-		} else { // Normal case
-			// Read value and tell that we want to read the same address again.
-			//				values[index] = SPI.transfer(address);
-			mfrc->Tx_Buf[0] = address;
-			SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-			values[index] = mfrc->Rx_Buf[0];
+			values[0] = (values[0] & ~mask) | (pcd_rx[1] & mask);
+			memcpy(&values[1], &pcd_rx[2], len - 1);
+		} else {
+			memcpy(&values[index], &pcd_rx[1], len);
 		}
-		index++;
+		index += len;
 	}
-
-	// Read the final uint8_t. Send 0 to stop reading.
-	//	values[index] = SPI.transfer(0);
-	mfrc->Tx_Buf[0] = 0;
-	SpiReadWrite(mfrc522_spi, mfrc->Tx_Buf, mfrc->Rx_Buf, 1);
-	values[index] = mfrc->Rx_Buf[0];
-
-	// Release slave again
-    GPIOOn(mfrc522_dc);
 } // End PCD_ReadRegister()
 
 /**
@@ -309,6 +308,19 @@ PCD_CalculateCRC(MFRC522Ptr_t mfrc,
 * Functions for manipulating the MFRC522
 *******************************************************************************/
 
+/**
+ * Waits for PCD_CommunicateWithPICC() commands on the MFRC522 IRQ pin: the
+ * calling task sleeps on its notification until RxIRq/IdleIRq (or the timer)
+ * instead of polling ComIrqReg. Call after PCD_Init().
+ */
+void PCD_EnableIrq(MFRC522Ptr_t mfrc, gpio_t irq_pin) {
+	PCD_WriteRegister(mfrc, ComIEnReg, PCD_IRQ_INV);		 // No request enabled yet
+	PCD_WriteRegister(mfrc, DivIEnReg, PCD_IRQ_PUSH_PULL); // No pull-up needed
+	GPIOInit(irq_pin, GPIO_INPUT);
+	GPIOActivInt(irq_pin, PCD_IrqISR, false, mfrc);
+	mfrc->irq = true;
+} // End PCD_EnableIrq()
+
 /**
  * Initializes the MFRC522 chip.
  */
@@ -316,18 +328,16 @@ void PCD_Init(MFRC522Ptr_t mfrc) {
 
 	/* SPI configuration */
 	spi_conf.device = mfrc->spi_dev;
-	mfrc522_spi = mfrc->spi_dev;
+	SpiInit(&spi_conf);
 	/* GPIOs configuration and initialization */
-	mfrc522_dc = mfrc->_chipSelectPin;
-	mfrc522_rst = mfrc->_resetPowerDownPin;
-	GPIOInit(mfrc522_dc, GPIO_OUTPUT);
-	GPIOInit(mfrc522_rst, GPIO_OUTPUT);
+	GPIOInit(mfrc->_chipSelectPin, GPIO_OUTPUT);
+	GPIOInit(mfrc->_resetPowerDownPin, GPIO_OUTPUT);
 
 	DelayUs(10);
-	GPIOOn(mfrc522_dc);
+	GPIOOn(mfrc->_chipSelectPin);
 	
-	if (GPIORead(mfrc522_rst) == false) { // The MFRC522 chip is in power down mode.
-		GPIOOn(mfrc522_rst); // Exit power down mode. This triggers a hard reset.
+	if (GPIORead(mfrc->_resetPowerDownPin) == false) { // The MFRC522 chip is in power down mode.
+		GPIOOn(mfrc->_resetPowerDownPin); // Exit power down mode. This triggers a hard reset.
 		// Section 8.8.2 in the datasheet says the oscillator start-up time is
 		// the start up time of the crystal + 37,74�s. Let us be generous: 50ms.
 		//SysTick_Init();
@@ -389,6 +399,26 @@ void PCD_Reset(MFRC522Ptr_t mfrc) {
 	}
 } // End PCD_Reset()
 
+/**
+ * Enters the soft power-down mode (bit 4 of CommandReg): the oscillator and
+ * the analog part are stopped, register values are kept.
+ */
+void PCD_SoftPowerDown(MFRC522Ptr_t mfrc) {
+	PCD_SetRegisterBitMask(mfrc, CommandReg, (1 << 4));
+} // End PCD_SoftPowerDown()
+
+/**
+ * Leaves the soft power-down mode and waits for the oscillator to restart
+ * (section 8.8.2: crystal start-up + 37,74us), for up to ~5ms.
+ */
+void PCD_SoftPowerUp(MFRC522Ptr_t mfrc) {
+	uint8_t i = 50;
+	PCD_ClearRegisterBitMask(mfrc, CommandReg, (1 << 4));
+	while ((PCD_ReadRegister(mfrc, CommandReg) & (1 << 4)) && --i) {
+		DelayUs(100);
+	}
+} // End PCD_SoftPowerUp()
+
 /**
  * Turns the antenna on by enabling pins TX1 and TX2.
  * After a reset these pins are disabled.
@@ -437,6 +467,112 @@ void PCD_SetAntennaGain(MFRC522Ptr_t mfrc, uint8_t mask) {
 /*******************************************************************************
 * Functions for communicating with PICCs
 *******************************************************************************/
+/**
+ * First half of PCD_CommunicateWithPICC(): loads the FIFO and starts the
+ * command, without waiting for it.
+ */
+static void PCD_CommandStart(MFRC522Ptr_t mfrc, uint8_t command,
+							 uint8_t waitIRq, uint8_t *sendData,
+							 uint8_t sendLen, uint8_t txLastBits,
+							 uint8_t rxAlign) {
+	// Prepare values for BitFramingReg
+	uint8_t bitFraming =
+		(rxAlign << 4) + txLastBits; // RxAlign = BitFramingReg[6..4].
+									 // TxLastBits = BitFramingReg[2..0]
+
+	PCD_WriteRegister(mfrc, CommandReg, PCD_Idle); // Stop any active command.
+	PCD_WriteRegister(mfrc, ComIrqReg,
+					  0x7F); // Clear all seven interrupt request bits
+	if (mfrc->irq) {
+		// Drive the IRQ pin with the completion and timer requests only, and
+		// drop any notification left by a previous command
+		PCD_WriteRegister(mfrc, ComIEnReg, PCD_IRQ_INV | waitIRq | 0x01);
+		mfrc->irq_task = xTaskGetCurrentTaskHandle();
+		ulTaskNotifyTake(pdTRUE, 0);
+	}
+	PCD_SetRegisterBitMask(mfrc, FIFOLevelReg,
+						   0x80); // FlushBuffer = 1, FIFO initialization
+	PCD_WriteNRegister(mfrc, FIFODataReg, sendLen,
+					   sendData); // Write sendData to the FIFO
+	PCD_WriteRegister(mfrc, BitFramingReg, bitFraming); // Bit adjustments
+	PCD_WriteRegister(mfrc, CommandReg, command);		// Execute the command
+	if (command == PCD_Transceive) {
+		PCD_SetRegisterBitMask(
+			mfrc, BitFramingReg,
+			0x80); // StartSend=1, transmission of data starts
+	}
+} // End PCD_CommandStart()
+
+/**
+ * Second half of PCD_CommunicateWithPICC(), once the command completed:
+ * checks the errors and reads the answer from the FIFO.
+ */
+static StatusCode PCD_CommandResult(MFRC522Ptr_t mfrc, uint8_t *backData,
+									uint8_t *backLen, uint8_t *validBits,
+									uint8_t rxAlign, bool checkCRC) {
+	uint8_t n, _validBits = 0;
+
+	// Stop now if any errors except collisions were detected.
+	uint8_t errorRegValue =
+		PCD_ReadRegister(mfrc, ErrorReg); // ErrorReg[7..0] bits are: WrErr
+										  // TempErr reserved BufferOvfl CollErr
+										  // CRCErr ParityErr ProtocolErr
+	if (errorRegValue & 0x13) {			  // BufferOvfl ParityErr ProtocolErr
+		return STATUS_ERROR;
+	}
+
+	// If the caller wants data back, get it from the MFRC522.
+	if (backData && backLen) {
+		n = PCD_ReadRegister(mfrc,
+							 FIFOLevelReg); // Number of uint8_ts in the FIFO
+		if (n > *backLen) {
+			return STATUS_NO_ROOM;
+		}
+		*backLen = n; // Number of uint8_ts returned
+		PCD_ReadNRegister(mfrc, FIFODataReg, n, backData,
+						  rxAlign); // Get received data from FIFO
+		_validBits = PCD_ReadRegister(mfrc, ControlReg) &
+					 0x07; // RxLastBits[2:0] indicates the number of valid bits
+						   // in the last received uint8_t. If this value is
+						   // 000b, the whole uint8_t is valid.
+		if (validBits) {
+			*validBits = _validBits;
+		}
+	}
+
+	// Tell about collisions
+	if (errorRegValue & 0x08) { // CollErr
+		return STATUS_COLLISION;
+	}
+
+	// Perform CRC_A validation if requested.
+	if (backData && backLen && checkCRC) {
+		// In this case a MIFARE Classic NAK is not OK.
+		if (*backLen == 1 && _validBits == 4) {
+			return STATUS_MIFARE_NACK;
+		}
+		// We need at least the CRC_A value and all 8 bits of the last uint8_t
+		// must be received.
+		if (*backLen < 2 || _validBits != 0) {
+			return STATUS_CRC_WRONG;
+		}
+		// Verify CRC_A - do our own calculation and store the control in
+		// controlBuffer.
+		uint8_t controlBuffer[2];
+		StatusCode status = PCD_CalculateCRC(mfrc, &backData[0], *backLen - 2,
+											 &controlBuffer[0]);
+		if (status != STATUS_OK) {
+			return status;
+		}
+		if ((backData[*backLen - 2] != controlBuffer[0]) ||
+			(backData[*backLen - 1] != controlBuffer[1])) {
+			return STATUS_CRC_WRONG;
+		}
+	}
+
+	return STATUS_OK;
+} // End PCD_CommandResult()
+
 /**
  * Executes the Transceive command.
  * CRC validation can only be done if backData and backLen are specified.
@@ -499,36 +635,24 @@ StatusCode PCD_CommunicateWithPICC(
 	//		rxAlign=0;
 	//		checkCRC=false;
 
-	uint8_t n, _validBits;
+	uint8_t n;
 	unsigned int i;
 
-	// Prepare values for BitFramingReg
-	uint8_t txLastBits = validBits ? *validBits : 0;
-	uint8_t bitFraming =
-		(rxAlign << 4) + txLastBits; // RxAlign = BitFramingReg[6..4].
-									 // TxLastBits = BitFramingReg[2..0]
-
-	PCD_WriteRegister(mfrc, CommandReg, PCD_Idle); // Stop any active command.
-	PCD_WriteRegister(mfrc, ComIrqReg,
-					  0x7F); // Clear all seven interrupt request bits
-	PCD_SetRegisterBitMask(mfrc, FIFOLevelReg,
-						   0x80); // FlushBuffer = 1, FIFO initialization
-	PCD_WriteNRegister(mfrc, FIFODataReg, sendLen,
-					   sendData); // Write sendData to the FIFO
-	PCD_WriteRegister(mfrc, BitFramingReg, bitFraming); // Bit adjustments
-	PCD_WriteRegister(mfrc, CommandReg, command);		// Execute the command
-	if (command == PCD_Transceive) {
-		PCD_SetRegisterBitMask(
-			mfrc, BitFramingReg,
-			0x80); // StartSend=1, transmission of data starts
-	}
+	PCD_CommandStart(mfrc, command, waitIRq, sendData, sendLen,
+					 validBits ? *validBits : 0, rxAlign);
 
 	// Wait for the command to complete.
 	// In PCD_Init() we set the TAuto flag in TModeReg. This means the timer
 	// automatically starts when the PCD stops transmitting.
 	// Each iteration of the do-while-loop takes 17.86�s.
+	// With the IRQ pin the task sleeps between checks and ComIrqReg is read
+	// once per edge.
 	i = 2000;
+	TickType_t irq_start = xTaskGetTickCount();
 	while (1) {
+		if (mfrc->irq) {
+			ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PCD_IRQ_TIMEOUT_MS) + 1);
+		}
 		n = PCD_ReadRegister(mfrc, ComIrqReg); // ComIrqReg[7..0] bits are: Set1
 											   // TxIRq RxIRq IdleIRq HiAlertIRq
 											   // LoAlertIRq ErrIRq TimerIRq
@@ -539,72 +663,19 @@ StatusCode PCD_CommunicateWithPICC(
 		if (n & 0x01) { // Timer interrupt - nothing received in 25ms
 			return STATUS_TIMEOUT;
 		}
-		if (--i == 0) { // The emergency break. If all other conditions fail we
+		if (mfrc->irq) {
+			if (xTaskGetTickCount() - irq_start > pdMS_TO_TICKS(PCD_IRQ_TIMEOUT_MS)) {
+				return STATUS_TIMEOUT; // The emergency break, no edge on the IRQ pin
+			}
+		} else if (--i == 0) { // The emergency break. If all other conditions fail we
 						// will eventually terminate on this one after 35.7ms.
 						// Communication with the MFRC522 might be down.
 			return STATUS_TIMEOUT;
 		}
 	}
 
-	// Stop now if any errors except collisions were detected.
-	uint8_t errorRegValue =
-		PCD_ReadRegister(mfrc, ErrorReg); // ErrorReg[7..0] bits are: WrErr
-										  // TempErr reserved BufferOvfl CollErr
-										  // CRCErr ParityErr ProtocolErr
-	if (errorRegValue & 0x13) {			  // BufferOvfl ParityErr ProtocolErr
-		return STATUS_ERROR;
-	}
-
-	// If the caller wants data back, get it from the MFRC522.
-	if (backData && backLen) {
-		n = PCD_ReadRegister(mfrc,
-							 FIFOLevelReg); // Number of uint8_ts in the FIFO
-		if (n > *backLen) {
-			return STATUS_NO_ROOM;
-		}
-		*backLen = n; // Number of uint8_ts returned
-		PCD_ReadNRegister(mfrc, FIFODataReg, n, backData,
-						  rxAlign); // Get received data from FIFO
-		_validBits = PCD_ReadRegister(mfrc, ControlReg) &
-					 0x07; // RxLastBits[2:0] indicates the number of valid bits
-						   // in the last received uint8_t. If this value is
-						   // 000b, the whole uint8_t is valid.
-		if (validBits) {
-			*validBits = _validBits;
-		}
-	}
-
-	// Tell about collisions
-	if (errorRegValue & 0x08) { // CollErr
-		return STATUS_COLLISION;
-	}
-
-	// Perform CRC_A validation if requested.
-	if (backData && backLen && checkCRC) {
-		// In this case a MIFARE Classic NAK is not OK.
-		if (*backLen == 1 && _validBits == 4) {
-			return STATUS_MIFARE_NACK;
-		}
-		// We need at least the CRC_A value and all 8 bits of the last uint8_t
-		// must be received.
-		if (*backLen < 2 || _validBits != 0) {
-			return STATUS_CRC_WRONG;
-		}
-		// Verify CRC_A - do our own calculation and store the control in
-		// controlBuffer.
-		uint8_t controlBuffer[2];
-		StatusCode status = PCD_CalculateCRC(mfrc, &backData[0], *backLen - 2,
-											 &controlBuffer[0]);
-		if (status != STATUS_OK) {
-			return status;
-		}
-		if ((backData[*backLen - 2] != controlBuffer[0]) ||
-			(backData[*backLen - 1] != controlBuffer[1])) {
-			return STATUS_CRC_WRONG;
-		}
-	}
-
-	return STATUS_OK;
+	return PCD_CommandResult(mfrc, backData, backLen, validBits, rxAlign,
+							 checkCRC);
 } // End PCD_CommunicateWithPICC()
 
 /**
@@ -682,6 +753,61 @@ StatusCode PICC_REQA_or_WUPA(
 	return STATUS_OK;
 } // End PICC_REQA_or_WUPA()
 
+/**
+ * Sets the timeout of the commands (TAuto timer, started at the end of the
+ * transmission and stopped by the first bits of the answer).
+ */
+static void PCD_SetTimeout(MFRC522Ptr_t mfrc, uint16_t reload) {
+	PCD_WriteRegister(mfrc, TReloadRegH, reload >> 8);
+	PCD_WriteRegister(mfrc, TReloadRegL, reload & 0xFF);
+} // End PCD_SetTimeout()
+
+/**
+ * Starts a REQA without waiting for the answer: the REQA of several readers
+ * can be on air at the same time. Get the answer with PICC_RequestAResult()
+ * once a card had time to answer (PICC_REQA_ANSWER_US).
+ */
+void PICC_RequestAStart(MFRC522Ptr_t mfrc) {
+	uint8_t command = PICC_CMD_REQA;
+
+	PCD_ClearRegisterBitMask(mfrc, CollReg, 0x80); // ValuesAfterColl=1
+	PCD_CommandStart(mfrc, PCD_Transceive, 0x30, &command, 1, 7, 0);
+} // End PICC_RequestAStart()
+
+/**
+ * Answer to the REQA started by PICC_RequestAStart(), without waiting:
+ * STATUS_TIMEOUT if no card answered yet (the command is then stopped).
+ *
+ * @return STATUS_OK or STATUS_COLLISION if a card answered, STATUS_??? otherwise.
+ */
+StatusCode PICC_RequestAResult(
+	MFRC522Ptr_t mfrc,
+	uint8_t *
+		bufferATQA,		///< The buffer to store the ATQA (Answer to request) in
+	uint8_t *bufferSize ///< Buffer size, at least two uint8_ts. Also number of
+						///uint8_ts returned if STATUS_OK.
+	) {
+	uint8_t validBits;
+	StatusCode status;
+
+	if (bufferATQA == NULL || *bufferSize < 2) {
+		return STATUS_NO_ROOM;
+	}
+	if ((PCD_ReadRegister(mfrc, ComIrqReg) & 0x30) == 0) { // RxIRq, IdleIRq
+		PCD_WriteRegister(mfrc, CommandReg, PCD_Idle);
+		return STATUS_TIMEOUT;
+	}
+	status = PCD_CommandResult(mfrc, bufferATQA, bufferSize, &validBits, 0,
+							   false);
+	if (status != STATUS_OK) {
+		return status;
+	}
+	if (*bufferSize != 2 || validBits != 0) { // ATQA must be exactly 16 bits.
+		return STATUS_ERROR;
+	}
+	return STATUS_OK;
+} // End PICC_RequestAResult()
+
 /**
  * Transmits SELECT/ANTICOLLISION commands to select a single PICC.
  * Before calling this function the PICCs must be placed in the READY(*) state
@@ -2303,4 +2429,59 @@ bool PICC_IsNewCardPresent(MFRC522Ptr_t mfrc) {
 bool PICC_ReadCardSerial(MFRC522Ptr_t mfrc) {
 	StatusCode result = PICC_Select(mfrc, &(mfrc->uid), 0);
 	return (result == STATUS_OK);
-} // End
+} // End PICC_ReadCardSerial()
+
+/**
+ * Reads the UIDs of every card in state IDLE in the field: REQA, select (the
+ * anticollision resolves one card per round) and HLTA, until no card answers
+ * the REQA. A card in READY goes back to IDLE when another one is selected,
+ * so every round needs its REQA; the rounds are short because the timeout is
+ * sized for ISO 14443-3 (PICC_INVENTORY_TIMEOUT_US) instead of the 25 ms of
+ * the other commands, which is what the HLTA of each card and the last REQA
+ * would otherwise wait.
+ * Every card is left halted: PICC_WakeupA() and PICC_Select() with its whole
+ * UID (validBits = 8 * size) select one of them again.
+ *
+ * @return The number of UIDs stored in uids.
+ */
+uint8_t PICC_Inventory(MFRC522Ptr_t mfrc,
+					   Uid *uids, ///< Out: the UIDs found
+					   uint8_t maxUids ///< Size of uids
+					   ) {
+	uint8_t bufferATQA[2];
+	uint8_t bufferSize;
+	uint8_t count = 0;
+	uint8_t errors = 0;
+	uint8_t i;
+	StatusCode result;
+
+	PCD_SetTimeout(mfrc, PICC_INVENTORY_TIMEOUT_US / PCD_TIMER_US);
+	while (count < maxUids && errors < PICC_INVENTORY_ERRORS) {
+		bufferSize = sizeof(bufferATQA);
+		result = PICC_RequestA(mfrc, bufferATQA, &bufferSize);
+		if (result == STATUS_TIMEOUT) { // No card left in IDLE
+			break;
+		}
+		// Several cards answer the REQA at once: their ATQA may collide
+		if ((result != STATUS_OK && result != STATUS_COLLISION) ||
+			PICC_Select(mfrc, &uids[count], 0) != STATUS_OK) {
+			errors++;
+			continue;
+		}
+		PICC_HaltA(mfrc);
+		// A card whose HLTA was lost answers the next REQA again
+		for (i = 0; i < count; i++) {
+			if (uids[i].size == uids[count].size &&
+				memcmp(uids[i].uidByte, uids[count].uidByte, uids[i].size) == 0) {
+				break;
+			}
+		}
+		if (i == count) {
+			count++;
+		} else {
+			errors++;
+		}
+	}
+	PCD_SetTimeout(mfrc, PCD_RELOAD_DEFAULT);
+	return count;
+} // End PICC_Inventory()
@@ -50,6 +50,8 @@
  * -----------------------------------------------------------
  * 20210901 v0.1 initials initial version Maria Casablanca
  * 20242703 v1.1 converted to ESP IDF by JC
+ * 20261015 v1.2 single precision math, background averaged sampling
+ * 20261015 v1.3 common sensor interface
  */
 
 /*==================[inclusions]=============================================*/
@@ -58,24 +60,129 @@
 #include "gpio_mcu.h"
 #include <stdio.h>
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /*==================[macros and definitions]=================================*/
 
-#define V_REF 3.3                /**< Tensión de referencia*/
+#define V_REF 3.3f               /**< Tensión de referencia*/
+#define V_REF_MV 3300            /**< Tensión de referencia (mV)*/
 #define TOTAL_BITS 1024          /**< Cantidad total de bits*/
+#define SI7007_TASK_STACK	2048
+#define SI7007_TASK_PRIO	3
+#define SI7007_MIN_PERIOD_US	1000
 
 /*==================[internal data declaration]==============================*/
 
 analog_input_config_t temp_config;
 analog_input_config_t hum_config;
 
+/* Background sampling */
+static TaskHandle_t si7007_task = NULL;
+static volatile bool sampling = false;
+static TickType_t sample_period = 1;
+static uint8_t average_len = 1;
+static uint16_t temp_ring[SI7007_AVERAGE_MAX];	/*!< Last temperature samples (mV) */
+static uint16_t hum_ring[SI7007_AVERAGE_MAX];	/*!< Last humidity samples (mV) */
+static uint8_t ring_head = 0;
+static uint8_t ring_fill = 0;
+static uint32_t temp_sum = 0;					/*!< Sum of the samples in the window (mV) */
+static uint32_t hum_sum = 0;
+static volatile int32_t temp_cdeg = 0;			/*!< Averaged temperature (0.01 °C), 32 bits: atomic read */
+static volatile int32_t hum_cpct = 0;			/*!< Averaged humidity (0.01 %) */
+static uint8_t sensor_average = 1;				/*!< n_average of Si7007Sensor */
+
 /*==================[internal functions declaration]=========================*/
+static bool Si7007SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static void Si7007SensorStop(const sensor_t *sensor);
+static void Si7007SensorPush(void);
+
+/* Datasheet transfer functions on the average of n samples, integer only:
+ * T = -46.85 + 175.71 * V / Vref, RH = -6 + 125 * V / Vref */
+static int32_t Si7007TemperatureCdeg(uint32_t sum_mv, uint8_t n){
+	return -4685 + (int32_t)((17571UL * sum_mv) / ((uint32_t)V_REF_MV * n));
+}
+
+static int32_t Si7007HumidityCpct(uint32_t sum_mv, uint8_t n){
+	return -600 + (int32_t)((12500UL * sum_mv) / ((uint32_t)V_REF_MV * n));
+}
+
+/* Reads both outputs with one ADC call and slides the average window */
+static void Si7007Task(void *arg){
+	const adc_ch_t channels[2] = {temp_config.input, hum_config.input};
+	uint16_t values[2];
+	TickType_t wake = xTaskGetTickCount();
+	while(true){
+		if(!sampling){
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			wake = xTaskGetTickCount();
+			continue;
+		}
+		if(AnalogInputReadMulti(channels, values, 2) == 2){
+			if(ring_fill == average_len){
+				temp_sum -= temp_ring[ring_head];
+				hum_sum -= hum_ring[ring_head];
+			}else{
+				ring_fill++;
+			}
+			temp_ring[ring_head] = values[0];
+			hum_ring[ring_head] = values[1];
+			temp_sum += values[0];
+			hum_sum += values[1];
+			ring_head = (ring_head + 1) % average_len;
+			temp_cdeg = Si7007TemperatureCdeg(temp_sum, ring_fill);
+			hum_cpct = Si7007HumidityCpct(hum_sum, ring_fill);
+			Si7007SensorPush();
+		}
+		vTaskDelayUntil(&wake, sample_period);
+	}
+}
 
 /*==================[internal data definition]===============================*/
+SENSOR_QUEUE_DEFINE(si7007_queue, int32_t, 2, 8);
+
+static const sensor_ops_t si7007_ops = {
+	.start = Si7007SensorStart,
+	.read_block = SensorQueueReadBlock,
+	.stop = Si7007SensorStop,
+};
+
+static const sensor_format_t si7007_format = {
+	.name = "Si7007",
+	.type = SENSOR_INT32,
+	.channels = 2,
+	.scale = 0.01f,
+	.unit = "degC,%",
+	.min_period_us = SI7007_MIN_PERIOD_US,
+};
+
+static const sensor_t si7007_sensor = {
+	.ops = &si7007_ops,
+	.format = &si7007_format,
+	.queue = &si7007_queue,
+};
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void Si7007SensorPush(void){
+	int32_t sample[2] = {temp_cdeg, hum_cpct};
+	SensorQueuePush(&si7007_queue, sample, true);
+}
+
+static bool Si7007SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param){
+	if(period_us < SI7007_MIN_PERIOD_US){
+		period_us = SI7007_MIN_PERIOD_US;
+	}
+	SensorQueueOpen(&si7007_queue, sensor, ready, param);
+	Si7007StartSampling(period_us / 1000, sensor_average);
+	return true;
+}
+
+static void Si7007SensorStop(const sensor_t *sensor){
+	Si7007StopSampling();
+	SensorQueueClose(&si7007_queue);
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -103,8 +210,8 @@ float Si7007MeasureTemperature(void){
 	float valor = 0;
 	
 	AnalogInputReadSingle(temp_config.input, &value);
-	valor = (value/1000.0)/V_REF;
-	temperature = -46.85 + (valor*175.71);
+	valor = (value/1000.0f)/V_REF;
+	temperature = -46.85f + (valor*175.71f);
 	return temperature;
 
 }
@@ -116,12 +223,55 @@ float Si7007MeasureHumidity(void){
 	float valor = 0;
 	
 	AnalogInputReadSingle(hum_config.input, &value);
-	valor = (value/1000.0)/V_REF;
-	humidity = -6 + (valor*125);
+	valor = (value/1000.0f)/V_REF;
+	humidity = -6.0f + (valor*125.0f);
 	return humidity;
 }
 
+void Si7007StartSampling(uint32_t period_ms, uint8_t n_average){
+	/* a sample taken meanwhile just lands in the new window */
+	sampling = false;
+	average_len = (n_average == 0) ? 1 : ((n_average > SI7007_AVERAGE_MAX) ? SI7007_AVERAGE_MAX : n_average);
+	sample_period = (pdMS_TO_TICKS(period_ms) == 0) ? 1 : pdMS_TO_TICKS(period_ms);
+	ring_head = 0;
+	ring_fill = 0;
+	temp_sum = 0;
+	hum_sum = 0;
+	sampling = true;
+	if(si7007_task == NULL){
+		xTaskCreate(Si7007Task, "si7007", SI7007_TASK_STACK, NULL, SI7007_TASK_PRIO, &si7007_task);
+	}else{
+		xTaskNotifyGive(si7007_task);
+	}
+}
+
+void Si7007StopSampling(void){
+	sampling = false;
+}
+
+float Si7007GetTemperature(void){
+	return temp_cdeg / 100.0f;
+}
+
+float Si7007GetHumidity(void){
+	return hum_cpct / 100.0f;
+}
+
+int16_t Si7007GetTemperatureCdeg(void){
+	return (int16_t)temp_cdeg;
+}
+
+uint16_t Si7007GetHumidityCpct(void){
+	return (hum_cpct < 0) ? 0 : (uint16_t)hum_cpct;
+}
+
+const sensor_t *Si7007Sensor(uint8_t n_average){
+	sensor_average = n_average;
+	return &si7007_sensor;
+}
+
 bool Si7007Deinit(Si7007_config *pins){
+	Si7007StopSampling();
 	return true;
 }
 
@@ -0,0 +1,286 @@
+/**
+ * @file accel_sensor.c
+ * @brief Common interface for the accelerometers sampled in parallel (ADXL335 and MPU6050 backends)
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "accel_sensor.h"
+#include "ADXL335.h"
+#include "mpu6050.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define MPU6050_GYRO_RATE       1000        /* gyro output rate with the DLPF enabled (Hz) */
+#define MPU6050_LSB_PER_G       16384.0f    /* ±2 g range */
+#define MPU6050_DRAIN_HZ        20          /* FIFO drains per second */
+#define MPU6050_RING_LEN        128         /* samples buffered between the MPU6050 task and the reader (power of 2) */
+/*==================[internal data declaration]==============================*/
+typedef struct {
+    accel_sensor_type_t type;
+    float sample_frec;
+    uint32_t period_us;
+    volatile int64_t last_data_us;  /*!< Time of the last data ready event */
+    int64_t next_us;                /*!< Timestamp of the next sample read, -1 before the first one */
+} sensor_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static sensor_t sensors[ACCEL_SENSOR_MAX];
+static uint8_t sensors_count = 0;
+static TaskHandle_t notify_task = NULL;
+static int8_t adxl335_id = -1;
+static uint8_t adxl335_oversampling = 1;
+static int8_t mpu6050_id = -1;
+static gpio_t mpu6050_int_pin;
+static adxl335_frame_t adxl335_frame;
+static volatile bool adxl335_watching = false;  /* frames are not delivered, the ADC monitor notifies */
+static volatile bool adxl335_resync = false;     /* the watch ended: stale frames are discarded on the next read */
+/* MPU6050 samples, written by the MPU6050 acquisition task */
+static float mpu6050_ring[3][MPU6050_RING_LEN];
+static volatile uint16_t mpu6050_head = 0;
+static volatile uint16_t mpu6050_tail = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void IRAM_ATTR Adxl335FrameISR(void *param){
+    BaseType_t woken = pdFALSE;
+
+    if(adxl335_watching){
+        return;
+    }
+    sensors[adxl335_id].last_data_us = esp_timer_get_time();
+    vTaskNotifyGiveFromISR(notify_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void IRAM_ATTR Adxl335WatchISR(void *param){
+    BaseType_t woken = pdFALSE;
+
+    adxl335_watching = false;
+    adxl335_resync = true;
+    vTaskNotifyGiveFromISR(notify_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void Mpu6050Block(const mpu6050_block_t *block, void *param){
+    uint16_t head = mpu6050_head;
+
+    for(uint8_t i = 0; i < block->frames; i++){
+        if((uint16_t)(head - mpu6050_tail) == MPU6050_RING_LEN){
+            /* reader too slow: the newest samples are dropped */
+            break;
+        }
+        mpu6050_ring[0][head % MPU6050_RING_LEN] = block->ax[i] / MPU6050_LSB_PER_G;
+        mpu6050_ring[1][head % MPU6050_RING_LEN] = block->ay[i] / MPU6050_LSB_PER_G;
+        mpu6050_ring[2][head % MPU6050_RING_LEN] = block->az[i] / MPU6050_LSB_PER_G;
+        head++;
+    }
+    sensors[mpu6050_id].last_data_us = esp_timer_get_time();
+    mpu6050_head = head;
+    xTaskNotifyGive(notify_task);
+}
+
+static uint16_t Adxl335Read(accel_frame_t *frame){
+    uint16_t len = ADXL335ReadFrame(&adxl335_frame);
+
+    memcpy(frame->x, adxl335_frame.x, len * sizeof(float));
+    memcpy(frame->y, adxl335_frame.y, len * sizeof(float));
+    memcpy(frame->z, adxl335_frame.z, len * sizeof(float));
+    return len;
+}
+
+static uint16_t Mpu6050Read(accel_frame_t *frame){
+    uint16_t tail = mpu6050_tail;
+    uint16_t len = mpu6050_head - tail;
+
+    if(len > ACCEL_FRAME_LEN){
+        len = ACCEL_FRAME_LEN;
+    }
+    for(uint16_t i = 0; i < len; i++, tail++){
+        frame->x[i] = mpu6050_ring[0][tail % MPU6050_RING_LEN];
+        frame->y[i] = mpu6050_ring[1][tail % MPU6050_RING_LEN];
+        frame->z[i] = mpu6050_ring[2][tail % MPU6050_RING_LEN];
+    }
+    mpu6050_tail = tail;
+    return len;
+}
+
+/**
+ * @brief Sets the nearest MPU6050 rate not higher than sample_frec
+ */
+static void Mpu6050Rate(uint16_t sample_frec, sensor_t *sensor){
+    uint8_t divider;
+
+    divider = (sample_frec == 0 || sample_frec >= MPU6050_GYRO_RATE) ?
+              1 : (MPU6050_GYRO_RATE + sample_frec - 1) / sample_frec;
+    MPU6050_setRate(divider - 1);
+    sensor->sample_frec = (float)MPU6050_GYRO_RATE / divider;
+}
+
+static bool Mpu6050Add(const accel_sensor_config_t *config, sensor_t *sensor){
+    MPU6050_initialize();
+    if(!MPU6050_testConnection()){
+        return false;
+    }
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_42);
+    Mpu6050Rate(config->sample_frec, sensor);
+    mpu6050_int_pin = config->int_pin;
+    return MPU6050_subscribe(Mpu6050Block, NULL);
+}
+
+/*==================[external functions definition]==========================*/
+int8_t AccelSensorAdd(const accel_sensor_config_t *config){
+    sensor_t *sensor = &sensors[sensors_count];
+
+    if(sensors_count == ACCEL_SENSOR_MAX || notify_task != NULL){
+        return -1;
+    }
+    sensor->type = config->type;
+    sensor->sample_frec = config->sample_frec;
+    switch(config->type){
+        case ACCEL_SENSOR_ADXL335:
+            if(adxl335_id >= 0){
+                return -1;
+            }
+            adxl335_id = sensors_count;
+            adxl335_oversampling = config->oversampling;
+        break;
+        case ACCEL_SENSOR_MPU6050:
+            if(mpu6050_id >= 0 || !Mpu6050Add(config, sensor)){
+                return -1;
+            }
+            mpu6050_id = sensors_count;
+        break;
+        default:
+            return -1;
+    }
+    sensor->period_us = (uint32_t)(1000000.0f / sensor->sample_frec);
+    sensor->next_us = -1;
+    return sensors_count++;
+}
+
+bool AccelSensorStart(TaskHandle_t task){
+    uint8_t frames;
+
+    if(sensors_count == 0 || task == NULL){
+        return false;
+    }
+    notify_task = task;
+    if(mpu6050_id >= 0){
+        frames = sensors[mpu6050_id].sample_frec / MPU6050_DRAIN_HZ;
+        if(!MPU6050_startAcquisition(mpu6050_int_pin, frames)){
+            return false;
+        }
+    }
+    if(adxl335_id >= 0){
+        ADXL335InitContinuous(sensors[adxl335_id].sample_frec, adxl335_oversampling, Adxl335FrameISR, NULL);
+    }
+    return true;
+}
+
+uint16_t AccelSensorRead(int8_t id, accel_frame_t *frame){
+    sensor_t *sensor;
+
+    frame->len = 0;
+    if(id < 0 || id >= sensors_count){
+        return 0;
+    }
+    sensor = &sensors[id];
+    switch(sensor->type){
+        case ACCEL_SENSOR_ADXL335:
+            if(adxl335_resync){
+                /* frames queued before and during the watch: the timestamps restart from the next one */
+                adxl335_resync = false;
+                ADXL335WatchEnd();
+                sensor->next_us = -1;
+            }
+            frame->len = adxl335_watching ? 0 : Adxl335Read(frame);
+        break;
+        case ACCEL_SENSOR_MPU6050:
+            frame->len = Mpu6050Read(frame);
+        break;
+    }
+    if(frame->len == 0){
+        return 0;
+    }
+    /* samples are evenly spaced: only the first frame is placed at the data ready time */
+    if(sensor->next_us < 0){
+        sensor->next_us = sensor->last_data_us - (int64_t)(frame->len - 1) * sensor->period_us;
+    }
+    frame->first_us = sensor->next_us;
+    frame->period_us = sensor->period_us;
+    sensor->next_us += (int64_t)frame->len * sensor->period_us;
+    return frame->len;
+}
+
+bool AccelSensorWatch(int8_t id, const float base[3], float band_g){
+    if(id < 0 || id != adxl335_id || adxl335_watching || notify_task == NULL){
+        return false;
+    }
+    adxl335_watching = true;
+    if(!ADXL335Watch(base, band_g, Adxl335WatchISR, NULL)){
+        /* the conversion may have been restarted: the time base restarts too */
+        adxl335_watching = false;
+        adxl335_resync = true;
+        return false;
+    }
+    return true;
+}
+
+void AccelSensorWake(int8_t id){
+    if(id < 0 || id != adxl335_id || !adxl335_watching){
+        return;
+    }
+    adxl335_watching = false;
+    adxl335_resync = true;
+    xTaskNotifyGive(notify_task);
+}
+
+bool AccelSensorSetFrequency(int8_t id, uint16_t sample_frec){
+    sensor_t *sensor;
+
+    if(id < 0 || id >= sensors_count || sample_frec == 0){
+        return false;
+    }
+    sensor = &sensors[id];
+    switch(sensor->type){
+        case ACCEL_SENSOR_ADXL335:
+            if(adxl335_watching){
+                return false;
+            }
+            if(notify_task != NULL){
+                ADXL335SetFrequency(sample_frec);
+            }
+            sensor->sample_frec = sample_frec;
+        break;
+        case ACCEL_SENSOR_MPU6050:
+            if(notify_task != NULL){
+                MPU6050_stopAcquisition();
+            }
+            Mpu6050Rate(sample_frec, sensor);
+            /* the buffered samples were taken at the previous rate */
+            mpu6050_tail = mpu6050_head;
+            if(notify_task != NULL &&
+               !MPU6050_startAcquisition(mpu6050_int_pin, sensor->sample_frec / MPU6050_DRAIN_HZ)){
+                return false;
+            }
+        break;
+    }
+    sensor->period_us = (uint32_t)(1000000.0f / sensor->sample_frec);
+    sensor->next_us = -1;
+    return true;
+}
+
+float AccelSensorFrequency(int8_t id){
+    return (id < 0 || id >= sensors_count) ? 0 : sensors[id].sample_frec;
+}
+
+uint8_t AccelSensorCount(void){
+    return sensors_count;
+}
+
+/*==================[end of file]============================================*/
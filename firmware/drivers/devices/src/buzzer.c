@@ -13,15 +13,55 @@
 #include "buzzer.h"
 #include "delay_mcu.h"
 #include "pwm_mcu.h"
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 /*==================[macros and definitions]=================================*/
 #define PWM_BUZZER      PWM_3
 #define PWM_DC          50
 #define OCTAVE_OFFSET   0
+#define PLAYER_STACK    2048
+#define PLAYER_PRIO     2       /*!< Below sampling and communication tasks */
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief RTTTL parser state
+ */
+typedef struct {
+    const char *p;          /*!< Next character */
+    uint8_t default_dur;    /*!< Default note duration (1/n of a whole note) */
+    uint8_t default_oct;    /*!< Default octave */
+    long wholenote;         /*!< Whole note duration (in ms) */
+} rtttl_parser_t;
+
+/**
+ * @brief Melody handed to the player
+ */
+typedef struct {
+    const buzzer_note_t *notes;
+    uint16_t length;
+    bool loop;
+} melody_t;
+
+/**
+ * @brief Player commands
+ */
+typedef enum {
+    PLAYER_PLAY,
+    PLAYER_QUEUE,
+    PLAYER_STOP,
+} player_cmd_type_t;
+
+typedef struct {
+    player_cmd_type_t type;
+    melody_t melody;
+} player_cmd_t;
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static QueueHandle_t player_queue = NULL;      /*!< Commands to the player task */
+static volatile bool playing = false;
 uint16_t notes[] = {
     0,
     NOTE_C4, NOTE_CS4, NOTE_D4, NOTE_DS4, NOTE_E4, NOTE_F4, NOTE_FS4, NOTE_G4, NOTE_GS4, NOTE_A4, NOTE_AS4, NOTE_B4,
@@ -39,45 +79,17 @@ bool isDigit(char c){
         return false;
     }
 }
-/*==================[external functions definition]==========================*/
-void BuzzerInit(gpio_t pin){
-    PWMInit(PWM_BUZZER, pin, NOTE_C4);
-    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
-    PWMOff(PWM_BUZZER);
-}
 
-void BuzzerOn(void){
-    PWMOn(PWM_BUZZER);
-}
-
-void BuzzerOff(void){
-    PWMOff(PWM_BUZZER);
-}
-
-void BuzzerSetFrec(uint16_t freq){
-    PWMSetFreq(PWM_BUZZER, freq);
-}
-
-void BuzzerPlayTone(uint16_t freq, uint16_t duration){
-	PWMSetFreq(PWM_BUZZER, freq);
-	PWMOn(PWM_BUZZER);
-	DelayMs(duration);
-	PWMOff(PWM_BUZZER);
-}
-
-void BuzzerPlayRtttl(const char * rtttl_melody){
-    uint8_t default_dur = 4;
-    uint8_t default_oct = 6;
-    int bpm = 63;
+/* Reads the header of the melody (name and defaults) */
+static void RtttlBegin(rtttl_parser_t *parser, const char *rtttl_melody){
     int num;
-    long wholenote;
-    long duration;
-    uint8_t note;
-    uint8_t scale;
+    int bpm = 63;
+    parser->default_dur = 4;
+    parser->default_oct = 6;
 
     /* find the start (skip name, etc) */
-    while(*rtttl_melody != ':') rtttl_melody++; // ignore name
-    rtttl_melody++;                             // skip ':'
+    while(*rtttl_melody && *rtttl_melody != ':') rtttl_melody++; // ignore name
+    if(*rtttl_melody) rtttl_melody++;                            // skip ':'
 
     /* get default duration */
     if(*rtttl_melody == 'd'){
@@ -87,7 +99,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         while(isDigit(*rtttl_melody)){
         num = (num * 10) + (*rtttl_melody++ - '0');
         }
-        if(num > 0) default_dur = num;
+        if(num > 0) parser->default_dur = num;
         rtttl_melody++;     // skip comma
     }
 
@@ -96,7 +108,7 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         rtttl_melody++; 
         rtttl_melody++;     // skip "o="
         num = *rtttl_melody++ - '0';
-        if(num >= 3 && num <=7) default_oct = num;
+        if(num >= 3 && num <=7) parser->default_oct = num;
         rtttl_melody++;     // skip comma
     }
 
@@ -108,86 +120,268 @@ void BuzzerPlayRtttl(const char * rtttl_melody){
         while(isDigit(*rtttl_melody)){
         num = (num * 10) + (*rtttl_melody++ - '0');
         }
-        bpm = num;
+        if(num > 0) bpm = num;
         rtttl_melody++;     // skip colon
     }
 
     /* BPM usually expresses the number of quarter notes per minute */
-    wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
+    parser->wholenote = (60 * 1000L / bpm) * 4;  // this is the time for whole note (in milliseconds)
+    parser->p = rtttl_melody;
+}
 
-    /* now begin note loop */
-    while(*rtttl_melody){
-        /* first, get note duration, if available */
-        num = 0;
-        while(isDigit(*rtttl_melody)){
-            num = (num * 10) + (*rtttl_melody++ - '0');
-        }
-        if(num){
-            duration = wholenote / num;
-        }else{
-            duration = wholenote / default_dur;  // we will need to check if we are a dotted note after
-        } 
-        /* now get the note */
+/* Reads the next note, false at the end of the melody */
+static bool RtttlNext(rtttl_parser_t *parser, buzzer_note_t *out){
+    const char *rtttl_melody = parser->p;
+    int num;
+    long duration;
+    uint8_t note;
+    uint8_t scale;
+
+    if(*rtttl_melody == 0){
+        return false;
+    }
+    /* first, get note duration, if available */
+    num = 0;
+    while(isDigit(*rtttl_melody)){
+        num = (num * 10) + (*rtttl_melody++ - '0');
+    }
+    if(num){
+        duration = parser->wholenote / num;
+    }else{
+        duration = parser->wholenote / parser->default_dur;  // we will need to check if we are a dotted note after
+    } 
+    /* now get the note */
+    note = 0;
+    switch(*rtttl_melody){
+    case 'c':
+        note = 1;
+        break;
+    case 'd':
+        note = 3;
+        break;
+    case 'e':
+        note = 5;
+        break;
+    case 'f':
+        note = 6;
+        break;
+    case 'g':
+        note = 8;
+        break;
+    case 'a':
+        note = 10;
+        break;
+    case 'b':
+        note = 12;
+        break;
+    case 'p':
+    default:
         note = 0;
-        switch(*rtttl_melody){
-        case 'c':
-            note = 1;
-            break;
-        case 'd':
-            note = 3;
-            break;
-        case 'e':
-            note = 5;
-            break;
-        case 'f':
-            note = 6;
-            break;
-        case 'g':
-            note = 8;
-            break;
-        case 'a':
-            note = 10;
-            break;
-        case 'b':
-            note = 12;
-            break;
-        case 'p':
-        default:
-            note = 0;
-        }
+    }
+    if(*rtttl_melody) rtttl_melody++;
+    /* now, get optional '#' sharp */
+    if(*rtttl_melody == '#'){
+        note++;
+        rtttl_melody++;
+    }
+    /* now, get optional '.' dotted note */
+    if(*rtttl_melody == '.'){
+        duration += duration/2;
         rtttl_melody++;
-        /* now, get optional '#' sharp */
-        if(*rtttl_melody == '#'){
-            note++;
-            rtttl_melody++;
+    }
+    /* now, get scale */
+    if(isDigit(*rtttl_melody)){
+        scale = *rtttl_melody - '0';
+        rtttl_melody++;
+    }else{
+        scale = parser->default_oct;
+    }
+    scale += OCTAVE_OFFSET;
+    /* only octaves 4 to 7 are in the table */
+    if(scale < 4) scale = 4;
+    if(scale > 7) scale = 7;
+
+    if(*rtttl_melody == ','){
+        rtttl_melody++; // skip comma for next note (or we may be at the end)
+    }
+    parser->p = rtttl_melody;
+    out->freq = note ? notes[(scale - 4) * 12 + note] : 0;
+    out->duration = (duration > UINT16_MAX) ? UINT16_MAX : duration;
+    return true;
+}
+
+/* Plays the commanded melodies, sleeping on the command queue for the
+ * duration of each note, so a new command is served immediately */
+static void BuzzerPlayerTask(void *pvParameter){
+    static melody_t pending[BUZZER_MELODY_QUEUE];
+    uint8_t pending_head = 0, pending_count = 0;
+    melody_t current = {0};
+    uint16_t index = 0;
+    TickType_t note_end = 0;
+    player_cmd_t cmd;
+
+    while(true){
+        TickType_t wait = portMAX_DELAY;
+        if(playing){
+            TickType_t now = xTaskGetTickCount();
+            wait = ((TickType_t)(note_end - now) < portMAX_DELAY / 2) ? note_end - now : 0;
+        }
+        if(xQueueReceive(player_queue, &cmd, wait) == pdTRUE){
+            switch(cmd.type){
+            case PLAYER_PLAY:
+                pending_count = 0;
+                current = cmd.melody;
+                index = 0;
+                playing = false;
+                break;
+            case PLAYER_QUEUE:
+                if(!playing && pending_count == 0){
+                    current = cmd.melody;
+                    index = 0;
+                }else{
+                    if(pending_count < BUZZER_MELODY_QUEUE){
+                        pending[(pending_head + pending_count) % BUZZER_MELODY_QUEUE] = cmd.melody;
+                        pending_count++;
+                    }
+                    continue;   // the current note goes on
+                }
+                break;
+            case PLAYER_STOP:
+                pending_count = 0;
+                current.length = 0;
+                PWMOff(PWM_BUZZER);
+                playing = false;
+                continue;
+            }
+        }else{
+            /* end of the note */
+            index++;
+            if(index >= current.length){
+                if(current.loop){
+                    index = 0;
+                }else if(pending_count > 0){
+                    current = pending[pending_head];
+                    pending_head = (pending_head + 1) % BUZZER_MELODY_QUEUE;
+                    pending_count--;
+                    index = 0;
+                }else{
+                    PWMOff(PWM_BUZZER);
+                    playing = false;
+                    continue;
+                }
+            }
         }
-        /* now, get optional '.' dotted note */
-        if(*rtttl_melody == '.'){
-            duration += duration/2;
-            rtttl_melody++;
+        if(index >= current.length){
+            PWMOff(PWM_BUZZER);
+            playing = false;
+            continue;
         }
-        /* now, get scale */
-        if(isDigit(*rtttl_melody)){
-            scale = *rtttl_melody - '0';
-            rtttl_melody++;
+        /* start the note */
+        const buzzer_note_t *note = &current.notes[index];
+        if(note->freq){
+            PWMSetFreq(PWM_BUZZER, note->freq);
+            PWMOn(PWM_BUZZER);
         }else{
-            scale = default_oct;
+            PWMOff(PWM_BUZZER);
         }
-        scale += OCTAVE_OFFSET;
-
-        if(*rtttl_melody == ','){
-            rtttl_melody++; // skip comma for next note (or we may be at the end)
+        if(!playing){
+            note_end = xTaskGetTickCount();
+            playing = true;
         }
+        // from the end of the previous note, so the tempo does not drift
+        note_end += pdMS_TO_TICKS(note->duration);
+    }
+}
+
+static bool BuzzerPlayerSend(player_cmd_t *cmd){
+    if(player_queue == NULL){
+        player_queue = xQueueCreate(BUZZER_MELODY_QUEUE, sizeof(player_cmd_t));
+        xTaskCreate(BuzzerPlayerTask, "buzzer_player", PLAYER_STACK, NULL, PLAYER_PRIO, NULL);
+    }
+    return xQueueSend(player_queue, cmd, 0) == pdTRUE;
+}
+/*==================[external functions definition]==========================*/
+void BuzzerInit(gpio_t pin){
+    PWMInit(PWM_BUZZER, pin, NOTE_C4);
+    PWMSetDutyCycle(PWM_BUZZER, PWM_DC);
+    PWMOff(PWM_BUZZER);
+}
+
+void BuzzerOn(void){
+    PWMOn(PWM_BUZZER);
+}
+
+void BuzzerOff(void){
+    PWMOff(PWM_BUZZER);
+}
+
+void BuzzerSetFrec(uint16_t freq){
+    PWMSetFreq(PWM_BUZZER, freq);
+}
+
+void BuzzerPlayTone(uint16_t freq, uint16_t duration){
+	PWMSetFreq(PWM_BUZZER, freq);
+	PWMOn(PWM_BUZZER);
+	DelayMs(duration);
+	PWMOff(PWM_BUZZER);
+}
+
+void BuzzerPlayRtttl(const char * rtttl_melody){
+    rtttl_parser_t parser;
+    buzzer_note_t note;
+
+    RtttlBegin(&parser, rtttl_melody);
+    while(RtttlNext(&parser, &note)){
         /* now play the note */
-        if(note){
-            BuzzerPlayTone(notes[(scale - 4) * 12 + note], duration);
+        if(note.freq){
+            BuzzerPlayTone(note.freq, note.duration);
         }
         else{
-            DelayMs(duration);
+            DelayMs(note.duration);
         }
     }
 }
 
+uint16_t BuzzerRtttlParse(const char * rtttl_melody, buzzer_note_t *notes, uint16_t max_notes){
+    rtttl_parser_t parser;
+    uint16_t length = 0;
+
+    RtttlBegin(&parser, rtttl_melody);
+    while(length < max_notes && RtttlNext(&parser, &notes[length])){
+        length++;
+    }
+    return length;
+}
+
+void BuzzerMelodyPlay(const buzzer_note_t *notes, uint16_t length, bool loop){
+    player_cmd_t cmd = {
+        .type = PLAYER_PLAY,
+        .melody = {.notes = notes, .length = length, .loop = loop},
+    };
+    BuzzerPlayerSend(&cmd);
+}
+
+bool BuzzerMelodyQueue(const buzzer_note_t *notes, uint16_t length){
+    player_cmd_t cmd = {
+        .type = PLAYER_QUEUE,
+        .melody = {.notes = notes, .length = length, .loop = false},
+    };
+    return BuzzerPlayerSend(&cmd);
+}
+
+void BuzzerMelodyStop(void){
+    player_cmd_t cmd = {
+        .type = PLAYER_STOP,
+    };
+    if(player_queue != NULL){
+        BuzzerPlayerSend(&cmd);
+    }
+}
+
+bool BuzzerMelodyIsPlaying(void){
+    return playing;
+}
+
 void BuzzerDeinit(void){
     
 }
@@ -23653,41 +23653,85 @@ char_info_t font89_info[] = {
 Font_t font_11 = {
 	11,
     font11_info,
-	font11_data
+	font11_data,
+	0
 };
 
 Font_t font_19 = {
 	19,
     font19_info,
-	font19_data
+	font19_data,
+	0
 };
 
 Font_t font_22 = {
 	22,
     font22_info,
-	font22_data
+	font22_data,
+	0
 };
 
 Font_t font_30 = {
 	30,
     font30_info,
-	font30_data
+	font30_data,
+	0
 };
 
 Font_t font_59 = {
 	59,
     font59_info,
-	font59_data
+	font59_data,
+	0
 };
 
 Font_t font_89 = {
 	89,
     font89_info,
-	font89_data
+	font89_data,
+	0
 };
 
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
+void FontExpandRow(uint16_t *pixels, const uint8_t *bitmap, uint32_t bit, uint16_t n, uint16_t foreground, uint16_t background){
+	const uint8_t *src = &bitmap[bit >> 3];
+	uint8_t shift = bit & 7;
+	uint8_t byte, k;
+
+	/* Bits up to the first byte boundary */
+	if (shift != 0 && n > 0){
+		byte = *src++ << shift;
+		k = (8 - shift < n) ? (8 - shift) : n;
+		n -= k;
+		while (k--){
+			*pixels++ = (byte & 0x80) ? foreground : background;
+			byte <<= 1;
+		}
+	}
+	/* Whole bytes */
+	while (n >= 8){
+		byte = *src++;
+		pixels[0] = (byte & 0x80) ? foreground : background;
+		pixels[1] = (byte & 0x40) ? foreground : background;
+		pixels[2] = (byte & 0x20) ? foreground : background;
+		pixels[3] = (byte & 0x10) ? foreground : background;
+		pixels[4] = (byte & 0x08) ? foreground : background;
+		pixels[5] = (byte & 0x04) ? foreground : background;
+		pixels[6] = (byte & 0x02) ? foreground : background;
+		pixels[7] = (byte & 0x01) ? foreground : background;
+		pixels += 8;
+		n -= 8;
+	}
+	/* Last bits */
+	if (n > 0){
+		byte = *src;
+		while (n--){
+			*pixels++ = (byte & 0x80) ? foreground : background;
+			byte <<= 1;
+		}
+	}
+}
 
 /*==================[end of file]============================================*/
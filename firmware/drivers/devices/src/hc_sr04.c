@@ -12,6 +12,9 @@
 /*==================[inclusions]=============================================*/
 #include "hc_sr04.h"
 #include "delay_mcu.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "driver/mcpwm_cap.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_US		17700	/* maximun distance time in us (300cm or 118inch) */
 #define MAX_CM		300		/* maximun distance time in cm */
@@ -19,15 +22,104 @@
 #define US2CM		59		/* scale factor to conver pulse width to cm */
 #define US2INCH		150		/* scale factor to conver pulse width to inch */
 #define WAIT_MAX	5900	/* maximun time to wait for echo signal */
+#define MAX_MM		3000	/* maximun distance in mm */
+#define US2MM_DEN	59		/* mm = us * 10 / 59 */
+#define TRIGGER_US	10		/* trigger pulse width */
+#define MIN_PERIOD_US	60000	/* trigger period that lets the echoes fade */
 /*==================[internal data declaration]==============================*/
 static gpio_t echo_st, trigger_st; /**<  Stores the pin inicilization*/
+static esp_timer_handle_t trigger_timer = NULL;
+static mcpwm_cap_timer_handle_t cap_timer = NULL;
+static mcpwm_cap_channel_handle_t cap_channel = NULL;
+static uint32_t ticks_per_us;
+static volatile uint32_t echo_start;
+static volatile bool echo_high = false;			/* rising edge seen, waiting for the falling one */
+static volatile bool echo_done = true;			/* last trigger already has a distance */
+static volatile uint16_t last_distance = 0;		/* mm */
+static hc_sr04_callback_t distance_cb = NULL;
+static void *distance_param = NULL;
 /*==================[internal functions declaration]=========================*/
-
+static bool HcSr04SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static void HcSr04SensorStop(const sensor_t *sensor);
 /*==================[internal data definition]===============================*/
+SENSOR_QUEUE_DEFINE(distance_queue, uint16_t, 1, 16);
+
+static const sensor_ops_t hc_sr04_ops = {
+	.start = HcSr04SensorStart,
+	.read_block = SensorQueueReadBlock,
+	.stop = HcSr04SensorStop,
+};
+
+static const sensor_format_t hc_sr04_format = {
+	.name = "HC-SR04",
+	.type = SENSOR_UINT16,
+	.channels = 1,
+	.scale = 1.0f,
+	.unit = "mm",
+	.min_period_us = MIN_PERIOD_US,
+};
+
+static const sensor_t hc_sr04_sensor = {
+	.ops = &hc_sr04_ops,
+	.format = &hc_sr04_format,
+	.queue = &distance_queue,
+};
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void IRAM_ATTR HcSr04Publish(uint16_t distance){
+	last_distance = distance;
+	echo_done = true;
+	if(distance_cb != NULL){
+		distance_cb(distance, distance_param);
+	}
+}
+
+/* Echo pulse width from the capture timestamps of both edges */
+static bool IRAM_ATTR HcSr04EchoIsr(mcpwm_cap_channel_handle_t channel, const mcpwm_capture_event_data_t *edata, void *user_data){
+	uint32_t distance;
+	if(edata->cap_edge == MCPWM_CAP_EDGE_POS){
+		echo_start = edata->cap_value;
+		echo_high = true;
+	} else if(echo_high && !echo_done){
+		echo_high = false;
+		distance = (edata->cap_value - echo_start) * 10 / (US2MM_DEN * ticks_per_us);
+		HcSr04Publish(distance > MAX_MM ? MAX_MM : distance);
+	}
+	return false;
+}
+
+/* Periodic trigger: a measurement without echo is published before the next one
+ * (0 if the echo never rose -disconnected-, maximum if it never fell) */
+static void HcSr04Trigger(void *arg){
+	if(!echo_done){
+		HcSr04Publish(echo_high ? MAX_MM : 0);
+	}
+	echo_high = false;
+	echo_done = false;
+	GPIOOn(trigger_st);
+	DelayUs(TRIGGER_US);
+	GPIOOff(trigger_st);
+}
+
+static void IRAM_ATTR HcSr04SensorPush(uint16_t distance_mm, void *param){
+	SensorQueuePush(&distance_queue, &distance_mm, true);
+}
+
+static bool HcSr04SensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param){
+	uint32_t period_ms = (period_us < MIN_PERIOD_US ? MIN_PERIOD_US : period_us + 500) / 1000;
+	if(trigger_timer != NULL){
+		return false;
+	}
+	SensorQueueOpen(&distance_queue, sensor, ready, param);
+	return HcSr04StartContinuous(period_ms, HcSr04SensorPush, NULL);
+}
+
+static void HcSr04SensorStop(const sensor_t *sensor){
+	HcSr04StopContinuous();
+	SensorQueueClose(&distance_queue);
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -86,7 +178,76 @@ uint16_t HcSr04ReadDistanceInInches(void){
 	return (distance/US2INCH);
 }
 
+bool HcSr04StartContinuous(uint32_t period_ms, hc_sr04_callback_t callback, void *param){
+	uint32_t resolution;
+	if(trigger_timer != NULL){
+		return false;
+	}
+	distance_cb = callback;
+	distance_param = param;
+	echo_high = false;
+	echo_done = true;
+
+	/** Echo edges timestamped by the MCPWM capture timer */
+	mcpwm_capture_timer_config_t timer_config = {
+		.clk_src = MCPWM_CAPTURE_CLK_SRC_DEFAULT,
+		.group_id = 0,
+	};
+	ESP_ERROR_CHECK(mcpwm_new_capture_timer(&timer_config, &cap_timer));
+	mcpwm_capture_channel_config_t channel_config = {
+		.gpio_num = echo_st,
+		.prescale = 1,
+		.flags.pos_edge = true,
+		.flags.neg_edge = true,
+	};
+	ESP_ERROR_CHECK(mcpwm_new_capture_channel(cap_timer, &channel_config, &cap_channel));
+	mcpwm_capture_event_callbacks_t cbs = {
+		.on_cap = HcSr04EchoIsr,
+	};
+	ESP_ERROR_CHECK(mcpwm_capture_channel_register_event_callbacks(cap_channel, &cbs, NULL));
+	ESP_ERROR_CHECK(mcpwm_capture_timer_get_resolution(cap_timer, &resolution));
+	ticks_per_us = resolution / 1000000;
+	ESP_ERROR_CHECK(mcpwm_capture_channel_enable(cap_channel));
+	ESP_ERROR_CHECK(mcpwm_capture_timer_enable(cap_timer));
+	ESP_ERROR_CHECK(mcpwm_capture_timer_start(cap_timer));
+
+	/** Periodic trigger */
+	esp_timer_create_args_t trigger_args = {
+		.callback = HcSr04Trigger,
+		.name = "hc_sr04",
+	};
+	ESP_ERROR_CHECK(esp_timer_create(&trigger_args, &trigger_timer));
+	ESP_ERROR_CHECK(esp_timer_start_periodic(trigger_timer, (uint64_t)period_ms * 1000));
+	return true;
+}
+
+uint16_t HcSr04GetDistanceInMillimeters(void){
+	return last_distance;
+}
+
+bool HcSr04StopContinuous(void){
+	if(trigger_timer == NULL){
+		return false;
+	}
+	esp_timer_stop(trigger_timer);
+	esp_timer_delete(trigger_timer);
+	trigger_timer = NULL;
+	mcpwm_capture_timer_stop(cap_timer);
+	mcpwm_capture_timer_disable(cap_timer);
+	mcpwm_capture_channel_disable(cap_channel);
+	mcpwm_del_capture_channel(cap_channel);
+	mcpwm_del_capture_timer(cap_timer);
+	cap_channel = NULL;
+	cap_timer = NULL;
+	return true;
+}
+
+const sensor_t *HcSr04Sensor(void){
+	return &hc_sr04_sensor;
+}
+
 bool HcSr04Deinit(void){
+	HcSr04StopContinuous();
 	GPIODeinit();
 	return true;
 }
@@ -52,6 +52,7 @@
 */
 
 #include "heartRate.h"
+#include "dsps_fir.h"
 
 int16_t IR_AC_Max = 20;
 int16_t IR_AC_Min = -20;
@@ -71,13 +72,22 @@ uint8_t offset = 0;
 
 static const uint16_t FIRCoeffs[12] = {172, 321, 579, 927, 1360, 1858, 2390, 2916, 3391, 3768, 4012, 4096};
 
+//  Block filter: the 23 symmetric taps of lowPassFIRFilter (plus a zero tap) for dsps_fird_s16
+#define FIR_BLOCK_TAPS 24
+static int16_t firBlockCoeffs[FIR_BLOCK_TAPS];
+static int16_t firBlockDelay[FIR_BLOCK_TAPS];
+static fir_s16_t firBlock;
+static bool firBlockReady = false;
+static int16_t acBlock[HEART_RATE_BLOCK_SIZE];
+static int16_t filtBlock[HEART_RATE_BLOCK_SIZE];
+
+static bool detectBeat(void);
+
 //  Heart Rate Monitor functions takes a sample value and the sample number
 //  Returns true if a beat is detected
 //  A running average of four samples is recommended for display on the screen.
 bool checkForBeat(int32_t sample)
 {
-  bool beatDetected = false;
-
   //  Save current state
   IR_AC_Signal_Previous = IR_AC_Signal_Current;
 
@@ -89,6 +99,61 @@ bool checkForBeat(int32_t sample)
   IR_Average_Estimated = averageDCEstimator(&ir_avg_reg, sample);
   IR_AC_Signal_Current = lowPassFIRFilter(sample - IR_Average_Estimated);
 
+  return(detectBeat());
+}
+
+//  Block version of checkForBeat for bursts of samples (e.g. a MAX3010X FIFO read)
+//  Writes the index in the block of each detected beat to beats (up to max_beats)
+//  Returns the number of beats detected
+//  Keeps its own filter state: do not mix with checkForBeat on the same signal
+uint8_t checkForBeatBlock(const int32_t *samples, uint16_t len, uint16_t *beats, uint8_t max_beats)
+{
+  uint8_t beatCount = 0;
+
+  if (!firBlockReady)
+  {
+    for (uint8_t i = 0 ; i < 11 ; i++)
+    {
+      firBlockCoeffs[i] = FIRCoeffs[i];
+      firBlockCoeffs[22 - i] = FIRCoeffs[i];
+    }
+    firBlockCoeffs[11] = FIRCoeffs[11];
+    firBlockCoeffs[23] = 0;
+    dsps_fird_init_s16(&firBlock, firBlockCoeffs, firBlockDelay, FIR_BLOCK_TAPS, 1, 0, 0);
+    firBlockReady = true;
+  }
+
+  for (uint16_t start = 0 ; start < len ; start += HEART_RATE_BLOCK_SIZE)
+  {
+    uint16_t n = len - start;
+    if (n > HEART_RATE_BLOCK_SIZE) n = HEART_RATE_BLOCK_SIZE;
+
+    //  DC removal is recursive, the FIR filter runs over the whole chunk
+    for (uint16_t i = 0 ; i < n ; i++)
+    {
+      IR_Average_Estimated = averageDCEstimator(&ir_avg_reg, samples[start + i]);
+      acBlock[i] = samples[start + i] - IR_Average_Estimated;
+    }
+    dsps_fird_s16(&firBlock, acBlock, filtBlock, n);
+
+    for (uint16_t i = 0 ; i < n ; i++)
+    {
+      IR_AC_Signal_Previous = IR_AC_Signal_Current;
+      IR_AC_Signal_Current = filtBlock[i];
+      if (detectBeat() && (beatCount < max_beats))
+      {
+        beats[beatCount++] = start + i;
+      }
+    }
+  }
+  return(beatCount);
+}
+
+//  Zero crossing beat detection on IR_AC_Signal_Current
+static bool detectBeat(void)
+{
+  bool beatDetected = false;
+
   //  Detect positive zero crossing (rising edge)
   if ((IR_AC_Signal_Previous < 0) & (IR_AC_Signal_Current >= 0))
   {
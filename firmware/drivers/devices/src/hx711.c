@@ -12,19 +12,72 @@
 #include "hx711.h"
 
 #include <delay_mcu.h>
+#include "gpio_fast_out_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
 
 /*==================[macros and definitions]=================================*/
+#define HX711_BITS			24
+#define HX711_SIGN			0x800000
+#define HX711_TASK_STACK	2048
+#define HX711_TASK_PRIO		10
+#define HX711_MIN_PERIOD_US	12500		/* RATE high: 80 Hz */
 
 /*==================[internal data declaration]==============================*/
 uint8_t GAIN;		             /*!<  Amplification factor */
-double OFFSET;	                 /*!<  Used for tare weight */
+float OFFSET;	                 /*!<  Used for tare weight */
 float SCALE;	                 /*!<  Used to return weight in grams, kg, ounces, whatever */ 
 
 
 gpio_t internal_pd_sck;
 gpio_t internal_dout;
+static gpio_fast_t sck_bundle = NULL;		/*!<  PD_SCK as dedicated GPIO (NULL: GPIO driver) */
+static gpio_fast_t dout_bundle = NULL;		/*!<  DOUT as dedicated GPIO (NULL: GPIO driver) */
+
+/* Continuous mode */
+static TaskHandle_t hx711_task = NULL;
+static portMUX_TYPE hx711_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool continuous = false;
+static int32_t ring[HX711_RING_SIZE];		/*!<  Last samples */
+static uint16_t ring_head = 0;				/*!<  Next position to be written */
+static uint16_t ring_count = 0;				/*!<  Samples not read by the application */
+static uint16_t ring_fill = 0;				/*!<  Samples in the average window */
+static uint8_t average_len = 1;
+static int64_t average_sum = 0;			/*!<  Sum of the last average_len samples */
+static int64_t tare_sum = 0;
+static uint8_t tare_times = 0, tare_left = 0;
+static sensor_ready_cb_t sensor_ready = NULL;	/*!<  Callback of HX711_sensor */
+static void *sensor_param = NULL;
+
+/* Multi-cell mode */
+static gpio_fast_t multi_sck = NULL;		/*!<  Shared PD_SCK */
+static gpio_fast_t multi_dout = NULL;		/*!<  DOUT of every cell, bit i is cell i */
+static uint8_t multi_cells = 0;
+static uint8_t multi_gain = 1;				/*!<  Clock pulses after the 24 bits */
 
 /*==================[internal functions declaration]=========================*/
+/* Once PD_SCK is routed to a dedicated channel the GPIO driver no longer
+ * drives it, so every write goes through here */
+static inline void HX711_sck(bool high)
+{
+	if (sck_bundle != NULL)
+	{
+		if (high)
+			GPIOFastSet(sck_bundle, 1);
+		else
+			GPIOFastClear(sck_bundle, 1);
+	}
+	else
+	{
+		GPIOState(internal_pd_sck, high);
+	}
+}
+
+static inline uint32_t HX711_dout(void)
+{
+	return (dout_bundle != NULL) ? GPIOFastReadIn(dout_bundle) : GPIORead(internal_dout);
+}
 
 uint8_t shiftIn(void)
 {
@@ -32,16 +85,192 @@ uint8_t shiftIn(void)
 
     for (uint8_t i = 0; i < 8; ++i)
     {
-    	GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
-        value |= GPIORead(internal_dout) << (7 - i);
-        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    	HX711_sck(true);//PD_SCK_SET_HIGH;
+        value |= HX711_dout() << (7 - i);
+        HX711_sck(false);//PD_SCK_SET_LOW;
     }
     return value;
 }
 
+static bool HX711_sensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static uint16_t HX711_sensorRead(const sensor_t *sensor, void *samples, uint16_t max_samples);
+static void HX711_sensorStop(const sensor_t *sensor);
+
+static const sensor_ops_t hx711_ops = {
+	.start = HX711_sensorStart,
+	.read_block = HX711_sensorRead,
+	.stop = HX711_sensorStop,
+};
+
+static const sensor_format_t hx711_format = {
+	.name = "HX711",
+	.type = SENSOR_INT32,
+	.channels = 1,
+	.scale = 1.0f,
+	.unit = "raw",
+	.min_period_us = HX711_MIN_PERIOD_US,
+};
+
+static const sensor_t hx711_sensor = {
+	.ops = &hx711_ops,
+	.format = &hx711_format,
+	.queue = NULL,
+};
+
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Reads a conversion (24 bits, two's complement) and selects the gain of the
+ * next one. Interrupts are disabled so PD_SCK is never high for more than
+ * a few microseconds (60 us would power down the chip) */
+static int32_t HX711_readRaw(void)
+{
+	uint32_t count = 0;
+	portENTER_CRITICAL(&hx711_mux);
+	for (uint8_t i = 0; i < HX711_BITS; i++)
+	{
+		HX711_sck(true);
+		DelayUs(1);
+		count = (count << 1) | HX711_dout();
+		HX711_sck(false);
+		DelayUs(1);
+	}
+	for (uint8_t i = 0; i < GAIN; i++)
+	{
+		HX711_sck(true);
+		DelayUs(1);
+		HX711_sck(false);
+		DelayUs(1);
+	}
+	portEXIT_CRITICAL(&hx711_mux);
+	if (count & HX711_SIGN)
+	{
+		count |= 0xFF000000;
+	}
+	return (int32_t)count;
+}
+
+/* Clocks the 24 bits of every cell of the multi-cell mode: after each rising
+ * edge one read of the input bundle takes a bit from all of them. The words
+ * are turned into values once interrupts are enabled again */
+static void HX711_readMultiRaw(int32_t *values)
+{
+	uint8_t bits[HX711_BITS];
+	uint32_t count;
+
+	portENTER_CRITICAL(&hx711_mux);
+	for (uint8_t i = 0; i < HX711_BITS; i++)
+	{
+		GPIOFastSet(multi_sck, 1);
+		DelayUs(1);
+		bits[i] = GPIOFastReadIn(multi_dout);
+		GPIOFastClear(multi_sck, 1);
+		DelayUs(1);
+	}
+	for (uint8_t i = 0; i < multi_gain; i++)
+	{
+		GPIOFastSet(multi_sck, 1);
+		DelayUs(1);
+		GPIOFastClear(multi_sck, 1);
+		DelayUs(1);
+	}
+	portEXIT_CRITICAL(&hx711_mux);
+	for (uint8_t c = 0; c < multi_cells; c++)
+	{
+		count = 0;
+		for (uint8_t i = 0; i < HX711_BITS; i++)
+		{
+			count = (count << 1) | ((bits[i] >> c) & 1);
+		}
+		if (count & HX711_SIGN)
+		{
+			count |= 0xFF000000;
+		}
+		values[c] = (int32_t)count;
+	}
+}
+
+/* Stores a sample: running average and tare are updated with it */
+static void HX711_push(int32_t sample)
+{
+	portENTER_CRITICAL(&hx711_mux);
+	if (ring_fill == average_len)
+	{
+		average_sum -= ring[(ring_head + HX711_RING_SIZE - average_len) % HX711_RING_SIZE];
+	}
+	else
+	{
+		ring_fill++;
+	}
+	average_sum += sample;
+	ring[ring_head] = sample;
+	ring_head = (ring_head + 1) % HX711_RING_SIZE;
+	if (ring_count < HX711_RING_SIZE)
+	{
+		ring_count++;			/* when full the oldest sample is lost */
+	}
+	if (tare_left > 0)
+	{
+		tare_sum += sample;
+		if (--tare_left == 0)
+		{
+			OFFSET = (float)tare_sum / tare_times;
+		}
+	}
+	portEXIT_CRITICAL(&hx711_mux);
+}
+
+static void IRAM_ATTR HX711_doutIsr(void *arg)
+{
+	BaseType_t woken = pdFALSE;
+	vTaskNotifyGiveFromISR(hx711_task, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+/* DOUT falling edge: conversion ready. Edges produced while data is clocked
+ * out are ignored, DOUT is high when the readout ends */
+static void HX711_task(void *arg)
+{
+	while (true)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if (continuous && HX711_isReady())
+		{
+			HX711_push(HX711_readRaw());
+			if (sensor_ready != NULL)
+			{
+				sensor_ready(&hx711_sensor, sensor_param);
+			}
+		}
+	}
+}
+
+/* The sensor_t reads the continuous mode ring */
+static bool HX711_sensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param)
+{
+	sensor_ready = NULL;
+	sensor_param = param;
+	sensor_ready = ready;
+	HX711_startContinuous(average_len);
+	return true;
+}
+
+static uint16_t HX711_sensorRead(const sensor_t *sensor, void *samples, uint16_t max_samples)
+{
+	int32_t *out = samples;
+	uint16_t n = 0;
+	while (n < max_samples && HX711_getSample(&out[n]))
+	{
+		n++;
+	}
+	return n;
+}
+
+static void HX711_sensorStop(const sensor_t *sensor)
+{
+	HX711_stopContinuous();
+	sensor_ready = NULL;
+}
 
 /*==================[external functions definition]==========================*/
 void HX711_Init(uint8_t gain, gpio_t pd_sck, gpio_t dout)
@@ -50,13 +279,19 @@ void HX711_Init(uint8_t gain, gpio_t pd_sck, gpio_t dout)
 	internal_dout = dout;
 	GPIOInit(pd_sck, GPIO_OUTPUT);//PD_SCK_SET_OUTPUT;
 	GPIOInit(dout, GPIO_INPUT);//DOUT_SET_INPUT;
+	/* Dedicated GPIO for the bit-banged reads, GPIO driver if no channel is free */
+	if (sck_bundle == NULL)
+	{
+		sck_bundle = GPIOFastBundleInit(&internal_pd_sck, 1, GPIO_FAST_OUTPUT);
+		dout_bundle = GPIOFastBundleInit(&internal_dout, 1, GPIO_FAST_INPUT);
+	}
     HX711_setGain(gain);
 
 }
 
 int HX711_isReady(void)
 {
-    return (GPIORead(internal_dout)) == 0;
+    return (HX711_dout()) == 0;
 }
 
 void HX711_setGain(uint8_t gain)
@@ -74,7 +309,7 @@ void HX711_setGain(uint8_t gain)
 			break;
 	}
 
-	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+	HX711_sck(false);//PD_SCK_SET_LOW;
 	HX711_read();
 }
 
@@ -90,25 +325,25 @@ uint32_t HX711_read(void)
 
     DelayUs(1);
 
-    GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    HX711_sck(false);//PD_SCK_SET_LOW;
     DelayUs(1);
 
     count=0;
-    while(GPIORead(internal_dout));
+    while(HX711_dout());
     for(i=0;i<24;i++)
     {
-    	 GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+    	 HX711_sck(true);//PD_SCK_SET_HIGH;
     	 DelayUs(1);
         count=count<<1;
-        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+        HX711_sck(false);//PD_SCK_SET_LOW;
         DelayUs(1);
-        if(GPIORead(internal_dout))
+        if(HX711_dout())
             count++;
     }
     count = count>>6;
-    GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+    HX711_sck(true);//PD_SCK_SET_HIGH;
     DelayUs(1);
-    GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    HX711_sck(false);//PD_SCK_SET_LOW;
     DelayUs(1);
     count ^= 0x800000;
     return(count);
@@ -125,19 +360,19 @@ uint32_t HX711_readAverage(uint8_t times)
 	return sum / times;
 }
 
-double HX711_getValue(uint8_t times)
+float HX711_getValue(uint8_t times)
 {
 	return HX711_readAverage(times) - OFFSET;
 }
 
 float HX711_getUnits(uint8_t times)
 {
-	return HX711_get_value(times) / SCALE;
+	return HX711_getValue(times) / SCALE;
 }
 
 void HX711_tare(uint8_t times)
 {
-	double sum = HX711_readAverage(times);
+	float sum = HX711_readAverage(times);
 	HX711_setOffset(sum);
 }
 
@@ -151,26 +386,156 @@ float HX711_getScale(void)
 	return SCALE;
 }
 
-void HX711_setOffset(double offset)
+void HX711_setOffset(float offset)
 {
     OFFSET = offset;
 }
 
-double HX711_getOffset(void)
+float HX711_getOffset(void)
 {
 	return OFFSET;
 }
 
+void HX711_startContinuous(uint8_t len)
+{
+	portENTER_CRITICAL(&hx711_mux);
+	average_len = (len == 0) ? 1 : ((len > HX711_RING_SIZE) ? HX711_RING_SIZE : len);
+	ring_head = 0;
+	ring_count = 0;
+	ring_fill = 0;
+	average_sum = 0;
+	tare_left = 0;
+	portEXIT_CRITICAL(&hx711_mux);
+	if (hx711_task == NULL)
+	{
+		xTaskCreate(HX711_task, "hx711", HX711_TASK_STACK, NULL, HX711_TASK_PRIO, &hx711_task);
+		GPIOActivInt(internal_dout, HX711_doutIsr, false, NULL);
+	}
+	continuous = true;
+	/* A conversion may be ready already (DOUT low, no edge to come) */
+	xTaskNotifyGive(hx711_task);
+}
+
+void HX711_stopContinuous(void)
+{
+	continuous = false;
+}
+
+bool HX711_getSample(int32_t *sample)
+{
+	bool available;
+	portENTER_CRITICAL(&hx711_mux);
+	available = (ring_count > 0);
+	if (available)
+	{
+		*sample = ring[(ring_head + HX711_RING_SIZE - ring_count) % HX711_RING_SIZE];
+		ring_count--;
+	}
+	portEXIT_CRITICAL(&hx711_mux);
+	return available;
+}
+
+int32_t HX711_getAverage(void)
+{
+	int64_t sum;
+	uint16_t n;
+	portENTER_CRITICAL(&hx711_mux);
+	sum = average_sum;
+	n = ring_fill;
+	portEXIT_CRITICAL(&hx711_mux);
+	return (n == 0) ? 0 : (int32_t)(sum / n);
+}
+
+float HX711_getUnitsContinuous(void)
+{
+	return (HX711_getAverage() - OFFSET) / SCALE;
+}
+
+void HX711_tareContinuous(uint8_t times)
+{
+	portENTER_CRITICAL(&hx711_mux);
+	tare_sum = 0;
+	tare_times = (times == 0) ? 1 : times;
+	tare_left = tare_times;
+	portEXIT_CRITICAL(&hx711_mux);
+}
+
+bool HX711_isTared(void)
+{
+	return tare_left == 0;
+}
+
+bool HX711_InitMulti(uint8_t gain, gpio_t pd_sck, const gpio_t *dout, uint8_t n_cells)
+{
+	int32_t values[HX711_MAX_CELLS];
+
+	if (n_cells == 0 || n_cells > HX711_MAX_CELLS || multi_sck != NULL)
+	{
+		return false;
+	}
+	GPIOInit(pd_sck, GPIO_OUTPUT);
+	for (uint8_t c = 0; c < n_cells; c++)
+	{
+		GPIOInit(dout[c], GPIO_INPUT);
+	}
+	/* Parallel reads need the dedicated channels, there is no GPIO driver fallback */
+	multi_sck = GPIOFastBundleInit(&pd_sck, 1, GPIO_FAST_OUTPUT);
+	multi_dout = GPIOFastBundleInit(dout, n_cells, GPIO_FAST_INPUT);
+	if (multi_sck == NULL || multi_dout == NULL)
+	{
+		multi_sck = NULL;
+		return false;
+	}
+	multi_cells = n_cells;
+	switch (gain)
+	{
+		case 64:		// channel A, gain factor 64
+			multi_gain = 3;
+			break;
+		case 32:		// channel B, gain factor 32
+			multi_gain = 2;
+			break;
+		default:		// channel A, gain factor 128
+			multi_gain = 1;
+			break;
+	}
+	GPIOFastClear(multi_sck, 1);
+	/* The gain is selected by the pulses after a readout */
+	return HX711_readMulti(values);
+}
+
+bool HX711_isReadyMulti(void)
+{
+	return (multi_dout != NULL) && (GPIOFastReadIn(multi_dout) == 0);
+}
+
+bool HX711_readMulti(int32_t *values)
+{
+	if (multi_sck == NULL)
+	{
+		return false;
+	}
+	// wait for every cell to become ready, a ready cell keeps its conversion until read
+	while (!HX711_isReadyMulti());
+	HX711_readMultiRaw(values);
+	return true;
+}
+
+const sensor_t *HX711_sensor(void)
+{
+	return &hx711_sensor;
+}
+
 void HX711_powerDown(void)
 {
-	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
-	GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+	HX711_sck(false);//PD_SCK_SET_LOW;
+	HX711_sck(true);//PD_SCK_SET_HIGH;
 	DelayUs(70);
 }
 
 void HX711_powerUp(void)
 {
-	GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+	HX711_sck(false);//PD_SCK_SET_LOW;
 }
 
 
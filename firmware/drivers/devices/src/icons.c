@@ -12848,28 +12848,32 @@ icon_font_t icon_22 = {
     22,
     22,
     66,
-    icon22_data
+    icon22_data,
+    0
 };
 
 icon_font_t icon_30 = {
     30,
     30,
     120,
-    icon30_data
+    icon30_data,
+    0
 };
 
 icon_font_t icon_59 = {
     59,
     59,
     472,
-    icon59_data
+    icon59_data,
+    0
 };
 
 icon_font_t icon_89 = {
     89,
     89,
     1068,
-    icon89_data
+    icon89_data,
+    0
 };
 
 /*==================[internal functions definition]==========================*/
@@ -15,10 +15,13 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "esp_attr.h"
+#include "esp_memory_utils.h"
+#include <string.h>
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
-#define SPI_BR 20000000				/*!< Frequency of sck for SPI communication */
+#define SPI_BR 40000000				/*!< Frequency of sck for SPI communication (fastest write clock of the panel, it is never read) */
 #define MAX_PIXEL 320*240*2			/*!< Maximum number of bytes to write on LCD */
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
@@ -27,6 +30,10 @@
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
 #define UP -1						/*!< Vertical grow direction */
+#define GLYPH_CACHE_ENTRIES 48		/*!< Maximum number of glyphs in cache */
+#define RLE_RUN 0x80				/*!< Image token is a run of the same index */
+#define RLE_LENGTH 0x7F				/*!< Image token length (minus 1) */
+#define MADCTL_MY 0x80				/*!< Row Address Order bit of MEM_ACC_CTRL */
 
 /* Command List */
 #define RESET				0x01 	/*!< Resets the commands and parameters to their S/W Reset default values */
@@ -40,7 +47,9 @@
 #define COLUMN_ADDR_SET		0x2A 	/*!< Define columns of frame memory where MCU can access */
 #define PAGE_ADDR_SET		0x2B 	/*!< Define rows of frame memory where MCU can access */
 #define MEM_WRITE			0x2C 	/*!< Transfer data from MCU to frame memory */
+#define VSCROLL_DEF			0x33 	/*!< Defines the vertical scrolling area of the display */
 #define MEM_ACC_CTRL		0x36 	/*!< Defines read/write scanning direction of frame memory */
+#define VSCROLL_START		0x37 	/*!< Line of frame memory shown at the top of the vertical scrolling area */
 #define PIXEL_FORMAT_SET	0x3A 	/*!< Sets the pixel format for the RGB image data used by the interface */
 #define WRITE_DISP_BRIGHT	0x51 	/*!< Adjust the brightness value of the display */
 #define WRITE_CTRL_DISP		0x53 	/*!< Control display brightness */
@@ -74,6 +83,50 @@ typedef struct {
 	ili9341_orientation_t orientation;	/*!< LCD Orientation */
 } orientation_properties_t;
 
+/**
+ * @brief  Glyph expanded to RGB565 in the glyph cache
+ */
+typedef struct {
+	Font_t *font;			/*!< Font */
+	char data;				/*!< Character */
+	uint16_t foreground;	/*!< Foreground color */
+	uint16_t background;	/*!< Background color */
+	uint32_t offset;		/*!< First pixel in the arena */
+	uint32_t pixels;		/*!< Number of pixels */
+	uint32_t last_use;		/*!< Value of the use counter on the last draw */
+} glyph_t;
+
+/**
+ * @brief  Compressed image being drawn (parameter of ImageRender)
+ */
+typedef struct {
+	const ili9341_image_t *img;		/*!< Image */
+	uint16_t x;						/*!< X position of the image */
+	uint16_t y;						/*!< Y position of the image */
+} image_pos_t;
+
+/**
+ * @brief  Raw picture being drawn (parameter of PictureRender)
+ */
+typedef struct {
+	const uint8_t *pic;				/*!< Picture */
+	uint16_t x;						/*!< X position of the picture */
+	uint16_t y;						/*!< Y position of the picture */
+	uint16_t width;					/*!< Picture width */
+} picture_pos_t;
+
+/**
+ * @brief  1 bit per pixel bitmap being drawn (parameter of BitmapRender)
+ */
+typedef struct {
+	const uint8_t *data;			/*!< First byte of the glyph or icon */
+	uint32_t row_bits;				/*!< Bits between the start of two rows */
+	uint16_t x;						/*!< X position of the bitmap */
+	uint16_t y;						/*!< Y position of the bitmap */
+	uint16_t foreground;			/*!< Color of the bits set (ILI9341_STRIP_COLOR order) */
+	uint16_t background;			/*!< Color of the bits clear (ILI9341_STRIP_COLOR order) */
+} bitmap_pos_t;
+
 /**
  * @brief Structure to configure or write LCD
  */
@@ -114,6 +167,56 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Fill a horizontal or vertical run of pixels, clipped to the screen
+ * @param[in]  	x0: Start column
+ * @param[in]  	y0: Start row
+ * @param[in]  	x1: End column
+ * @param[in]  	y1: End row
+ * @param[in]	color: color
+ * @retval 		None
+ */
+static void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/**
+ * @brief  		Fill the eight symmetric runs of a circle outline
+ * @param[in]  	x0: Center X
+ * @param[in]  	y0: Center Y
+ * @param[in]  	x_start: First x offset of the run
+ * @param[in]  	x_end: Last x offset of the run
+ * @param[in]  	y: y offset of the run
+ * @param[in]	color: color
+ * @retval 		None
+ */
+static void CircleRuns(int16_t x0, int16_t y0, int16_t x_start, int16_t x_end, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Render function of ILI9341DrawImage
+ */
+static void ImageRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param);
+
+/**
+ * @brief  		Render function of ILI9341DrawPicture (pictures not accessible by DMA)
+ */
+static void PictureRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param);
+
+/**
+ * @brief  		Render function of glyphs and icons
+ */
+static void BitmapRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param);
+
+#if ILI9341_GLYPH_CACHE_BYTES > 0
+/**
+ * @brief  		Get a glyph expanded to RGB565, expanding it if it isn't in cache
+ * @param[in]  	data: Character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	foreground: Color for char
+ * @param[in]  	background: Color for char background
+ * @retval 		Glyph pixels (ILI9341_STRIP_COLOR order), NULL if it doesn't fit in cache
+ */
+static const uint16_t * GlyphCacheGet(char data, Font_t* font, uint16_t foreground, uint16_t background);
+#endif
+
 /*==================[internal data definition]===============================*/
 /**
  * @brief Initial LCD configuration parameters
@@ -185,6 +288,23 @@ spi_mcu_config_t spi_conf = {
 static spi_dev_t ili9341_spi;				/*!< uC SPI port */
 static gpio_t ili9341_dc, ili9341_rst;		/*!< uC GPIO ports to use as CS, DC and RST */
 
+static bool rows_reversed = false;			/*!< Frame memory rows are addressed from the last one (MY = 1) */
+static uint16_t scroll_first, scroll_lines;	/*!< Vertical scrolling area (frame memory rows) */
+
+static uint16_t window[4];					/*!< Last columns and rows sent to the LCD */
+static bool window_valid = false;			/*!< window holds the LCD address window */
+static uint8_t madctl;						/*!< Last MEM_ACC_CTRL sent to the LCD */
+static bool spi_ready = false;				/*!< The SPI device of the LCD was added to the bus */
+
+DMA_ATTR static uint16_t strip_buffer[2][ILI9341_STRIP_BYTES / 2];	/*!< Strip buffers (one is sent while the other is drawn) */
+
+#if ILI9341_GLYPH_CACHE_BYTES > 0
+DMA_ATTR static uint16_t glyph_arena[ILI9341_GLYPH_CACHE_BYTES / 2];	/*!< Expanded glyphs, stored contiguously in the order of glyph_cache */
+static glyph_t glyph_cache[GLYPH_CACHE_ENTRIES];	/*!< Glyphs in cache */
+static uint8_t glyph_count = 0;						/*!< Number of glyphs in cache */
+static uint32_t glyph_use = 0;						/*!< Use counter (for LRU eviction) */
+#endif
+
 static orientation_properties_t lcd_orientation = {
 		ILI9341_WIDTH,
 		ILI9341_HEIGHT,
@@ -194,7 +314,6 @@ static orientation_properties_t lcd_orientation = {
 /*==================[internal functions definition]==========================*/
 
 void WriteLCD(lcd_cmd_t * data){
-	SpiInit(&spi_conf);
 	/* If command is NULL don't send command */
 	if (data->cmd != NULL){
 		/* Send command */
@@ -227,8 +346,19 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
 	lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
 	uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
 	lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-	WriteLCD(&lcd_columns);
-	WriteLCD(&lcd_rows);
+	/* MEM_WRITE restarts at the window origin, so columns or rows equal to the
+	 * last ones sent don't need to be sent again */
+	if (!window_valid || x0 != window[0] || x1 != window[1]){
+		WriteLCD(&lcd_columns);
+	}
+	if (!window_valid || y0 != window[2] || y1 != window[3]){
+		WriteLCD(&lcd_rows);
+	}
+	window[0] = x0;
+	window[1] = x1;
+	window[2] = y0;
+	window[3] = y1;
+	window_valid = true;
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
@@ -249,15 +379,28 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	bytes_count = (x_dist + 1) * (y_dist + 1) * 2;
 	/* Define area to fill */
 	SetCursorPosition(x0, y0, x1, y1);
-
-	for (i = 0; i < MAX_VALUE_SIZE; i += 2){
-		pixel[i] = HighByte(color);
-		pixel[i + 1] = LowByte(color);
-	}
 	/* Start writing LCD memory */
 	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
 	WriteLCD(&lcd_write);
 
+	/* Large areas: the same strip buffer is queued as many times as needed */
+	if (bytes_count > MAX_VALUE_SIZE){
+		for (i = 0; i < ILI9341_STRIP_BYTES / 2 && i < bytes_count / 2; i++){
+			strip_buffer[0][i] = ILI9341_STRIP_COLOR(color);
+		}
+		GPIOOn(ili9341_dc);
+		while (bytes_count > 0){
+			SpiQueueWrite(ili9341_spi, (uint8_t *)strip_buffer[0], (bytes_count > ILI9341_STRIP_BYTES) ? ILI9341_STRIP_BYTES : bytes_count);
+			bytes_count -= ILI9341_STRIP_BYTES;
+		}
+		SpiWaitAll(ili9341_spi);
+		return;
+	}
+
+	for (i = 0; i < MAX_VALUE_SIZE && i < bytes_count; i += 2){
+		pixel[i] = HighByte(color);
+		pixel[i + 1] = LowByte(color);
+	}
 	while(bytes_count - MAX_VALUE_SIZE > 0){
 		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
 		WriteLCD(&lcd_pixel);
@@ -267,12 +410,149 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	WriteLCD(&lcd_pixel);
 }
 
+static void Span(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+	int16_t aux;
+
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
+	}
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Clip to the screen */
+	if (x0 < 0){
+		x0 = 0;
+	}
+	if (y0 < 0){
+		y0 = 0;
+	}
+	if (x1 >= (int16_t)lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= (int16_t)lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	if (x0 > x1 || y0 > y1){
+		return;
+	}
+	Fill(x0, y0, x1, y1, color);
+}
+
+static void CircleRuns(int16_t x0, int16_t y0, int16_t x_start, int16_t x_end, int16_t y, uint16_t color){
+	/* Top and bottom octants: horizontal runs */
+	Span(x0 + x_start, y0 + y, x0 + x_end, y0 + y, color);
+	Span(x0 - x_end, y0 + y, x0 - x_start, y0 + y, color);
+	Span(x0 + x_start, y0 - y, x0 + x_end, y0 - y, color);
+	Span(x0 - x_end, y0 - y, x0 - x_start, y0 - y, color);
+	/* Left and right octants: vertical runs */
+	Span(x0 + y, y0 + x_start, x0 + y, y0 + x_end, color);
+	Span(x0 + y, y0 - x_end, x0 + y, y0 - x_start, color);
+	Span(x0 - y, y0 + x_start, x0 - y, y0 + x_end, color);
+	Span(x0 - y, y0 - x_end, x0 - y, y0 - x_start, color);
+}
+
+static void ImageRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+	image_pos_t *pos = (image_pos_t *)param;
+
+	for (uint16_t l = 0; l < lines; l++){
+		ILI9341ImageRow(pos->img, y0 + l - pos->y, x0 - pos->x, width, &strip[l * width]);
+	}
+}
+
+static void PictureRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+	picture_pos_t *pos = (picture_pos_t *)param;
+	const uint8_t *src = &pos->pic[2 * ((uint32_t)(y0 - pos->y) * pos->width + (x0 - pos->x))];
+
+	/* Picture bytes are already in the order sent to the LCD */
+	if (width == pos->width){
+		memcpy(strip, src, 2 * width * lines);
+		return;
+	}
+	for (uint16_t l = 0; l < lines; l++){
+		memcpy(&strip[l * width], &src[2 * l * pos->width], 2 * width);
+	}
+}
+
+static void BitmapRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+	bitmap_pos_t *pos = (bitmap_pos_t *)param;
+
+	for (uint16_t l = 0; l < lines; l++){
+		FontExpandRow(&strip[l * width], pos->data, (y0 - pos->y + l) * pos->row_bits + (x0 - pos->x),
+			width, pos->foreground, pos->background);
+	}
+}
+
+#if ILI9341_GLYPH_CACHE_BYTES > 0
+static const uint16_t * GlyphCacheGet(char data, Font_t* font, uint16_t foreground, uint16_t background){
+	uint8_t i, lru;
+	uint32_t j, k, used, pixels;
+	uint16_t width = font->info[data - ' '].width;
+	uint32_t row_bits = FONT_ROW_BITS(width, font->flags);
+	glyph_t *glyph;
+
+	glyph_use++;
+	for (i = 0; i < glyph_count; i++){
+		glyph = &glyph_cache[i];
+		if (glyph->data == data && glyph->font == font && glyph->foreground == foreground && glyph->background == background){
+			glyph->last_use = glyph_use;
+			return &glyph_arena[glyph->offset];
+		}
+	}
+	pixels = (uint32_t)width * font->font_height;
+	if (pixels > ILI9341_GLYPH_CACHE_BYTES / 2){
+		return NULL;
+	}
+	/* Evict the least recently used glyphs until the new one fits. The glyphs
+	 * after the evicted one are moved down, so the free space is always at the end */
+	used = (glyph_count > 0) ? (glyph_cache[glyph_count - 1].offset + glyph_cache[glyph_count - 1].pixels) : 0;
+	while (glyph_count == GLYPH_CACHE_ENTRIES || used + pixels > ILI9341_GLYPH_CACHE_BYTES / 2){
+		lru = 0;
+		for (i = 1; i < glyph_count; i++){
+			if (glyph_cache[i].last_use < glyph_cache[lru].last_use){
+				lru = i;
+			}
+		}
+		k = glyph_cache[lru].pixels;
+		j = glyph_cache[lru].offset + k;
+		memmove(&glyph_arena[glyph_cache[lru].offset], &glyph_arena[j], (used - j) * 2);
+		for (i = lru; i < glyph_count - 1; i++){
+			glyph_cache[i] = glyph_cache[i + 1];
+			glyph_cache[i].offset -= k;
+		}
+		glyph_count--;
+		used -= k;
+	}
+	/* Expand the glyph */
+	for (i = 0; i < font->font_height; i++){
+		FontExpandRow(&glyph_arena[used + i * width], &font->data[font->info[data - ' '].offset], i * row_bits,
+			width, ILI9341_STRIP_COLOR(foreground), ILI9341_STRIP_COLOR(background));
+	}
+	glyph = &glyph_cache[glyph_count++];
+	glyph->font = font;
+	glyph->data = data;
+	glyph->foreground = foreground;
+	glyph->background = background;
+	glyph->offset = used;
+	glyph->pixels = pixels;
+	glyph->last_use = glyph_use;
+	return &glyph_arena[used];
+}
+#endif
+
 /*==================[external functions definition]==========================*/
 
 uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
-	/* SPI configuration */
+	/* SPI configuration (the device is added to the bus only once) */
 	spi_conf.device = spi_dev;
 	ili9341_spi = spi_dev;
+	if (!spi_ready){
+		SpiInit(&spi_conf);
+		spi_ready = true;
+	}
 	/* GPIOs configuration and initialization */
 	ili9341_dc = gpio_dc;
 	ili9341_rst = gpio_rst;
@@ -291,6 +571,9 @@ uint8_t ILI9341Init(spi_dev_t spi_dev, uint8_t gpio_dc, uint8_t gpio_rst){
 	for (uint8_t i = 0; i < sizeof(lcd_init)/sizeof(lcd_cmd_t); i++){
 		WriteLCD(&lcd_init[i]);
 	}
+	window_valid = false;
+	madctl = mem_acc_ctrl[0];
+	rows_reversed = (madctl & MADCTL_MY) != 0;
 	/* It will be necessary to wait 5msec before sending next command after sleep out */
 	WriteLCD(&lcd_sleep_out);
 	DelayMs(10);
@@ -310,6 +593,33 @@ void ILI9341DrawPixel(uint16_t x, uint16_t y, uint16_t color){
 	WriteLCD(&lcd_pixels);
 }
 
+void ILI9341DrawPixels(const ili9341_point_t *points, uint16_t n, uint16_t color){
+	uint16_t i, run;
+	int8_t x_step, y_step;
+
+	i = 0;
+	while (i < n){
+		/* Consecutive neighbour points in a row or a column are sent as a single run */
+		x_step = y_step = 0;
+		run = 1;
+		if (i + 1 < n){
+			if (points[i + 1].y == points[i].y && (points[i + 1].x == points[i].x + 1 || points[i + 1].x + 1 == points[i].x)){
+				x_step = points[i + 1].x - points[i].x;
+			}
+			else if (points[i + 1].x == points[i].x && (points[i + 1].y == points[i].y + 1 || points[i + 1].y + 1 == points[i].y)){
+				y_step = points[i + 1].y - points[i].y;
+			}
+		}
+		if (x_step != 0 || y_step != 0){
+			while (i + run < n && points[i + run].x == points[i + run - 1].x + x_step && points[i + run].y == points[i + run - 1].y + y_step){
+				run++;
+			}
+		}
+		Span(points[i].x, points[i].y, points[i + run - 1].x, points[i + run - 1].y, color);
+		i += run;
+	}
+}
+
 void ILI9341Fill(uint16_t color){
 	Fill(0, 0, lcd_orientation.width, lcd_orientation.height, color);
 }
@@ -345,78 +655,98 @@ void ILI9341Rotate(ili9341_orientation_t orientation){
 		lcd_orientation.orientation = ILI9341_Landscape_2;
 		break;
 	}
+	/* The LCD keeps the scanning direction, it is only sent when it changes */
+	if (mem_acc[0] == madctl){
+		return;
+	}
 	lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
 	WriteLCD(&lcd_mem_acc);
+	madctl = mem_acc[0];
+	/* Columns and rows are swapped in landscape modes */
+	window_valid = false;
+	rows_reversed = (mem_acc[0] & MADCTL_MY) != 0;
+}
+
+void ILI9341ScrollArea(uint16_t first, uint16_t lines){
+	uint16_t bottom;
+
+	if (lines == 0 || first + lines > ILI9341_HEIGHT){
+		return;
+	}
+	/* Frame memory rows are the LCD height in portrait modes and the width in
+	 * landscape modes, in reverse order when MY = 1 */
+	scroll_first = rows_reversed ? (ILI9341_HEIGHT - first - lines) : first;
+	scroll_lines = lines;
+	bottom = ILI9341_HEIGHT - scroll_first - scroll_lines;
+	uint8_t area[] = {HighByte(scroll_first), LowByte(scroll_first), HighByte(scroll_lines),
+		LowByte(scroll_lines), HighByte(bottom), LowByte(bottom)};
+	lcd_cmd_t lcd_area = {VSCROLL_DEF, sizeof(area), area};
+	WriteLCD(&lcd_area);
+	ILI9341Scroll(0);
+}
+
+void ILI9341Scroll(uint16_t offset){
+	uint16_t start;
+
+	if (scroll_lines == 0){
+		return;
+	}
+	offset %= scroll_lines;
+	/* With rows in reverse order the memory moves the other way */
+	if (rows_reversed && offset != 0){
+		offset = scroll_lines - offset;
+	}
+	start = scroll_first + offset;
+	uint8_t start_line[] = {HighByte(start), LowByte(start)};
+	lcd_cmd_t lcd_start = {VSCROLL_START, sizeof(start_line), start_line};
+	WriteLCD(&lcd_start);
+}
+
+ili9341_orientation_t ILI9341GetOrientation(void){
+	return lcd_orientation.orientation;
 }
 
 void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint32_t i, bytes_count;
+	uint16_t lcd_x, lcd_y;
+	char_info_t *info = &font->info[data - ' '];
 
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
 
 	/* If at the end of a line of display, go to new line and set x to 0 position */
-	if ((lcd_x + font->info[data - ' '].width) > lcd_orientation.width)	{
+	if ((lcd_x + info->width) > lcd_orientation.width)	{
 		lcd_y += font->font_height;
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + font->info[data - ' '].width - 1, lcd_y + font->font_height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = font->font_height * font->info[data - ' '].width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < font->font_height; i++)	{
-		/* */
-		char_row = font->info[data - ' '].offset + i * ((font->info[data - ' '].width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < font->info[data - ' '].width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * font->info[data - ' '].width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
+#if ILI9341_GLYPH_CACHE_BYTES > 0
+	/* Cached glyphs are sent straight from the arena */
+	const uint16_t *glyph = GlyphCacheGet(data, font, foreground, background);
+	if (glyph != NULL){
+		SetCursorPosition(lcd_x, lcd_y, lcd_x + info->width - 1, lcd_y + font->font_height - 1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		/* Number of bytes to write. We have to write 2 bytes/pixel */
+		bytes_count = font->font_height * info->width * 2;
+		GPIOOn(ili9341_dc);
+		for (i = 0; i < bytes_count; i += ILI9341_STRIP_BYTES){
+			SpiQueueWrite(ili9341_spi, (const uint8_t *)glyph + i, (bytes_count - i > ILI9341_STRIP_BYTES) ? ILI9341_STRIP_BYTES : (bytes_count - i));
 		}
+		SpiWaitAll(ili9341_spi);
+		return;
 	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+#endif
+
+	/* Glyph rows are expanded into the strip buffers, one strip is expanded while the other is sent */
+	bitmap_pos_t pos = {&font->data[info->offset], FONT_ROW_BITS(info->width, font->flags), lcd_x, lcd_y,
+		ILI9341_STRIP_COLOR(foreground), ILI9341_STRIP_COLOR(background)};
+	ILI9341RenderArea(lcd_x, lcd_y, lcd_x + info->width - 1, lcd_y + font->font_height - 1, BitmapRender, &pos);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
-	static uint32_t i, j, k;
-	static uint32_t char_row;
-	static uint16_t lcd_x, lcd_y;
-	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint16_t lcd_x, lcd_y;
 
 	/* Set coordinates */
 	lcd_x = x;
@@ -428,49 +758,10 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 		lcd_x = 0;
 	}
 
-	SetCursorPosition(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1);
-
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = icon_font->height * icon_font->width * 2;
-
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
-
-	/* Draw font data */
-	/* go through character rows */
-	k = 0;
-	for (i = 0; i < icon_font->height; i++)	{
-		/*  */
-		char_row = icon * icon_font->offset + i * ((icon_font->width + 7) / 8);
-		/* go through character columns */
-		bytes_row = -1;
-		for (j = 0; j < icon_font->width; j++){
-			if(j % 8 == 0){
-				bytes_row++;
-			}
-			/* If exceed buffer size, send buffer */
-			if ((2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE){
-				lcd_cmd_t lcd_pixels = {NULL, MAX_VALUE_SIZE, pixel};
-				WriteLCD(&lcd_pixels);
-				bytes_count -= MAX_VALUE_SIZE;
-				k++;
-			}
-			/* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a character */
-			if (icon_font->data[char_row + bytes_row] & (MSK_BIT8 >> (j % 8))){
-				/* if bit = 1, draw put foreground color */
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-			}
-			else{
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-				pixel[2 * j + i * icon_font->width * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-			}
-		}
-	}
-	/* Send the rest of the buffer */
-	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixels);
+	bitmap_pos_t pos = {&icon_font->data[icon * icon_font->offset],
+		(icon_font->flags & ICON_PACKED) ? icon_font->width : ((icon_font->width + 7) & ~7), lcd_x, lcd_y,
+		ILI9341_STRIP_COLOR(foreground), ILI9341_STRIP_COLOR(background)};
+	ILI9341RenderArea(lcd_x, lcd_y, lcd_x + icon_font->width - 1, lcd_y + icon_font->height - 1, BitmapRender, &pos);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
@@ -534,8 +825,33 @@ void ILI9341GetStringSize(char* str, Font_t* font, uint16_t* width, uint16_t* he
 	*width = w;
 }
 
+bool ILI9341TextInit(ili9341_text_t *text, const char* str, Font_t *font){
+	uint8_t glyph;
+
+	text->font = font;
+	text->height = font->font_height;
+	text->width = 0;
+	text->length = 0;
+	while (*str != '\0' && text->length < ILI9341_TEXT_MAX){
+		glyph = (*str >= FONT_FIRST_CHAR && *str <= FONT_LAST_CHAR) ? *str - FONT_FIRST_CHAR : '?' - FONT_FIRST_CHAR;
+		text->glyph[text->length++] = glyph;
+		text->width += font->info[glyph].width + 1;
+		str++;
+	}
+	return *str == '\0';
+}
+
+void ILI9341DrawText(uint16_t x, uint16_t y, const ili9341_text_t *text, uint16_t foreground, uint16_t background){
+	for (uint8_t i = 0; i < text->length; i++){
+		ILI9341DrawChar(x, y, text->glyph[i] + FONT_FIRST_CHAR, text->font, foreground, background);
+		x += text->font->info[text->glyph[i]].width + 1;
+	}
+}
+
 void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static int16_t x_dist, y_dist, x_grow, y_grow, error, error_2;
+	static int16_t x_next, y_next, x_run, y_run;
+	static bool x_major;
 
 	/* Check for overflow */
 	if (x0 >= lcd_orientation.width){
@@ -576,26 +892,37 @@ void ILI9341DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 	/* Diagonal line */
 	else{
 		error = x_dist - y_dist;
+		/* Pixels are grouped in runs along the major axis, each run is a single fill */
+		x_major = (x_dist >= y_dist);
+		x_run = x0;
+		y_run = y0;
 
-		while (1){
-			/* Draw start point */
-			ILI9341DrawPixel(x0, y0, color);
-			/* Loop ends when start point reaches end point */
-			if (x0 == x1 && y0 == y1){
-				break;
-			}
+		/* Loop ends when start point reaches end point */
+		while (x0 != x1 || y0 != y1){
 			error_2 = 2 * error;
+			x_next = x0;
+			y_next = y0;
 			/* Determine if line must grow in x direction */
 			if (error_2 > -y_dist){
 				error -= y_dist;
-				x0 += x_grow;	/* Move start point */
+				x_next += x_grow;
 			}
 			/* Determine if line must grow in y direction */
 			if (error_2 < x_dist){
 				error += x_dist;
-				y0 += y_grow;	/* Move start point */
+				y_next += y_grow;
 			}
+			/* The run ends when the line moves in the minor axis */
+			if ((x_major && y_next != y0) || (!x_major && x_next != x0)){
+				Fill(x_run, y_run, x0, y0, color);
+				x_run = x_next;
+				y_run = y_next;
+			}
+			/* Move start point */
+			x0 = x_next;
+			y0 = y_next;
 		}
+		Fill(x_run, y_run, x0, y0, color);
 	}
 }
 
@@ -611,21 +938,21 @@ void ILI9341DrawFilledRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 }
 
 void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
-	static int16_t f, ddF_x, ddF_y, x, y;
+	static int16_t f, ddF_x, ddF_y, x, y, x_run;
 
 	f = 1 - r;
 	ddF_x = 1;
 	ddF_y = -2 * r;
 	x = 0;
 	y = r;
+	x_run = 0;
 
-	ILI9341DrawPixel(x0, y0 + r, color);
-	ILI9341DrawPixel(x0, y0 - r, color);
-	ILI9341DrawPixel(x0 + r, y0, color);
-	ILI9341DrawPixel(x0 - r, y0, color);
-
+	/* Consecutive points with the same y are drawn as runs (horizontal on the
+	 * top and bottom octants, vertical on the left and right ones) */
     while (x < y){
         if (f >= 0){
+            CircleRuns(x0, y0, x_run, x, y, color);
+            x_run = x + 1;
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -633,17 +960,8 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         x++;
         ddF_x += 2;
         f += ddF_x;
-
-        ILI9341DrawPixel(x0 + x, y0 + y, color);
-        ILI9341DrawPixel(x0 - x, y0 + y, color);
-        ILI9341DrawPixel(x0 + x, y0 - y, color);
-        ILI9341DrawPixel(x0 - x, y0 - y, color);
-
-        ILI9341DrawPixel(x0 + y, y0 + x, color);
-        ILI9341DrawPixel(x0 - y, y0 + x, color);
-        ILI9341DrawPixel(x0 + y, y0 - x, color);
-        ILI9341DrawPixel(x0 - y, y0 - x, color);
     }
+    CircleRuns(x0, y0, x_run, x, y, color);
 }
 
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
@@ -655,14 +973,13 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
 	x = 0;
 	y = r;
 
-    ILI9341DrawPixel(x0, y0 + r, color);
-    ILI9341DrawPixel(x0, y0 - r, color);
-    ILI9341DrawPixel(x0 + r, y0, color);
-    ILI9341DrawPixel(x0 - r, y0, color);
-    ILI9341DrawLine(x0 - r, y0, x0 + r, y0, color);
+    Span(x0 - r, y0, x0 + r, y0, color);
 
     while (x < y){
         if (f >= 0){
+            /* Rows y0 +/- y are drawn once, with their widest span */
+            Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+            Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -671,12 +988,11 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
         ddF_x += 2;
         f += ddF_x;
 
-        ILI9341DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, color);
-        ILI9341DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, color);
-
-        ILI9341DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, color);
-        ILI9341DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, color);
+        Span(x0 - y, y0 + x, x0 + y, y0 + x, color);
+        Span(x0 - y, y0 - x, x0 + y, y0 - x, color);
     }
+    Span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+    Span(x0 - x, y0 - y, x0 + x, y0 - y, color);
 }
 
 void ILI9341DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
@@ -747,7 +1063,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -761,7 +1077,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_0){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
@@ -778,7 +1094,7 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_0;
 		scanline_y = y_0;
 		while(scanline_y < y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 += invslope1;
 			curx2 += invslope2;
 			scanline_y++;
@@ -790,44 +1106,118 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 		curx2 = x_2;
 		scanline_y = y_2;
 		while(scanline_y > y_1){
-			ILI9341DrawLine((int)curx1, scanline_y, (int)curx2, scanline_y, color);
+			Span((int)curx1, scanline_y, (int)curx2, scanline_y, color);
 			curx1 -= invslope1;
 			curx2 -= invslope2;
 			scanline_y--;
 		}
-		ILI9341DrawLine(x_1, y_1, x_aux, y_aux, color);
+		Span(x_1, y_1, x_aux, y_aux, color);
   	}
 }
 
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
-	static uint16_t i, j;
-	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	picture_pos_t pos = {pic, x, y, width};
+	uint32_t i, bytes_count;
 
-	SetCursorPosition(x, y, x + width - 1, y + height - 1);
+	if (width == 0 || height == 0 || x >= lcd_orientation.width || y >= lcd_orientation.height){
+		return;
+	}
+	/* Pictures in DMA capable RAM (word aligned, not clipped horizontally) are sent
+	 * without copies. Rows clipped at the bottom are just not sent */
+	if (esp_ptr_dma_capable(pic) && ((uintptr_t)pic & 3) == 0 && x + width <= lcd_orientation.width){
+		if (y + height > lcd_orientation.height){
+			height = lcd_orientation.height - y;
+		}
+		bytes_count = (uint32_t)width * height * 2;
+		SetCursorPosition(x, y, x + width - 1, y + height - 1);
+		lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+		WriteLCD(&lcd_write);
+		GPIOOn(ili9341_dc);
+		for (i = 0; i < bytes_count; i += ILI9341_STRIP_BYTES){
+			SpiQueueWrite(ili9341_spi, &pic[i], (bytes_count - i > ILI9341_STRIP_BYTES) ? ILI9341_STRIP_BYTES : (bytes_count - i));
+		}
+		SpiWaitAll(ili9341_spi);
+		return;
+	}
+	/* Pictures in flash are copied to the strip buffers, one strip is copied
+	 * while the other is sent */
+	ILI9341RenderArea(x, y, x + width - 1, y + height - 1, PictureRender, &pos);
+}
 
-	/* Number of bytes to write. We have to write 2 bytes/pixel */
-	bytes_count = width * height * 2;
+void ILI9341DrawImage(uint16_t x, uint16_t y, const ili9341_image_t *img){
+	image_pos_t pos = {img, x, y};
 
-	/* Start writing LCD memory */
-	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
-	WriteLCD(&lcd_write);
+	ILI9341RenderArea(x, y, x + img->width - 1, y + img->height - 1, ImageRender, &pos);
+}
 
-	j = 0;
-	while(bytes_count - MAX_VALUE_SIZE > 0){
-		for (i = 0; i < MAX_VALUE_SIZE; i++){
-			pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+void ILI9341ImageRow(const ili9341_image_t *img, uint16_t row, uint16_t first, uint16_t width, uint16_t *pixels){
+	const uint8_t *data = &img->data[img->rows[row]];
+	uint16_t x = 0, end = first + width, n, j, color;
+
+	while (x < end){
+		n = (*data & RLE_LENGTH) + 1;
+		if (*data++ & RLE_RUN){
+			/* Run: a single palette lookup */
+			color = ILI9341_STRIP_COLOR(img->palette[*data]);
+			data++;
+			for (j = 0; j < n; j++, x++){
+				if (x >= first && x < end){
+					pixels[x - first] = color;
+				}
+			}
+		}
+		else{
+			for (j = 0; j < n; j++, x++, data++){
+				if (x >= first && x < end){
+					pixels[x - first] = ILI9341_STRIP_COLOR(img->palette[*data]);
+				}
+			}
 		}
-		lcd_cmd_t lcd_pixel = {NULL, MAX_VALUE_SIZE, pixel};
-		WriteLCD(&lcd_pixel);
-		bytes_count -= MAX_VALUE_SIZE;
-		j++;
 	}
-	for (i = 0; i < bytes_count; i++){
-		pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+}
+
+void ILI9341RenderArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ili9341_render_t render, void *param){
+	uint16_t aux, width, lines, strip_lines, y;
+	uint8_t buffer = 0;
+
+	if (x0 > x1){
+		aux = x0;
+		x0 = x1;
+		x1 = aux;
 	}
-	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
-	WriteLCD(&lcd_pixel);
+	if (y0 > y1){
+		aux = y0;
+		y0 = y1;
+		y1 = aux;
+	}
+	/* Clip to the screen */
+	if (x1 >= lcd_orientation.width){
+		x1 = lcd_orientation.width - 1;
+	}
+	if (y1 >= lcd_orientation.height){
+		y1 = lcd_orientation.height - 1;
+	}
+	if (x0 > x1 || y0 > y1){
+		return;
+	}
+	width = x1 - x0 + 1;
+	strip_lines = ILI9341_STRIP_BYTES / (2 * width);
+
+	/* Single address window and memory write for the whole area */
+	SetCursorPosition(x0, y0, x1, y1);
+	lcd_cmd_t lcd_write = {MEM_WRITE, NULL, NULL};
+	WriteLCD(&lcd_write);
+	GPIOOn(ili9341_dc);
+
+	for (y = y0; y <= y1; y += lines){
+		lines = (y1 - y + 1 < strip_lines) ? (y1 - y + 1) : strip_lines;
+		/* The strip sent two transactions ago used this buffer: wait for it */
+		SpiWait(ili9341_spi, 1);
+		render(strip_buffer[buffer], x0, y, width, lines, param);
+		SpiQueueWrite(ili9341_spi, (uint8_t *)strip_buffer[buffer], width * lines * 2);
+		buffer ^= 1;
+	}
+	SpiWaitAll(ili9341_spi);
 }
 
 uint8_t ILI9341DeInit(void){
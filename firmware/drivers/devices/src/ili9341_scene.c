@@ -0,0 +1,371 @@
+/**
+ * @file ili9341_scene.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Retained mode layer over the ILI9341 driver
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "ili9341_scene.h"
+#include "power_mcu.h"
+/*==================[macros and definitions]=================================*/
+/*==================[typedef]================================================*/
+/**
+ * @brief  Item types
+ */
+typedef enum {
+	SCENE_RECT,
+	SCENE_TEXT,
+	SCENE_ICON,
+	SCENE_PICTURE,
+	SCENE_IMAGE
+} scene_item_type_t;
+
+/**
+ * @brief  Rectangular area (corners included)
+ */
+typedef struct {
+	uint16_t x0, y0, x1, y1;
+} scene_rect_t;
+
+/**
+ * @brief  Scene item
+ */
+typedef struct {
+	scene_item_type_t type;			/*!< Item type */
+	bool visible;					/*!< Item is drawn */
+	scene_rect_t box;				/*!< Area covered by the item */
+	uint16_t foreground;			/*!< Rectangle color, text or icon foreground */
+	uint16_t background;			/*!< Text or icon background */
+	Font_t *font;					/*!< Text font */
+	char text[SCENE_MAX_TEXT + 1];	/*!< Text string */
+	icon_font_t *icon_font;			/*!< Icon font */
+	icon_t icon;					/*!< Icon */
+	const uint8_t *pic;				/*!< Picture data */
+	const ili9341_image_t *img;		/*!< Compressed image */
+} scene_item_t;
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static scene_item_t items[SCENE_MAX_ITEMS];		/*!< Items, in drawing order */
+static uint8_t n_items;							/*!< Number of items */
+static scene_rect_t dirty[SCENE_MAX_DIRTY];		/*!< Areas to be redrawn */
+static uint8_t n_dirty;							/*!< Number of dirty areas */
+static uint16_t scene_back;						/*!< Color of the pixels not covered by items */
+/*==================[internal functions definition]==========================*/
+
+static uint32_t RectArea(scene_rect_t *r){
+	return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static scene_rect_t RectUnion(scene_rect_t *a, scene_rect_t *b){
+	scene_rect_t u = {
+		(a->x0 < b->x0) ? a->x0 : b->x0,
+		(a->y0 < b->y0) ? a->y0 : b->y0,
+		(a->x1 > b->x1) ? a->x1 : b->x1,
+		(a->y1 > b->y1) ? a->y1 : b->y1
+	};
+	return u;
+}
+
+/* true if the areas overlap or are adjacent */
+static bool RectTouch(scene_rect_t *a, scene_rect_t *b){
+	return (a->x0 <= b->x1 + 1) && (b->x0 <= a->x1 + 1) && (a->y0 <= b->y1 + 1) && (b->y0 <= a->y1 + 1);
+}
+
+static void DirtyRemove(uint8_t i){
+	n_dirty--;
+	dirty[i] = dirty[n_dirty];
+}
+
+/* Adds an area to the dirty list, merging it with the areas it touches. If the
+ * list is full, it is merged with the area that wastes less pixels */
+static void DirtyAdd(scene_rect_t r){
+	uint8_t i, best;
+	uint32_t cost, best_cost;
+	scene_rect_t u;
+
+	i = 0;
+	while (i < n_dirty){
+		if (RectTouch(&r, &dirty[i])){
+			r = RectUnion(&r, &dirty[i]);
+			DirtyRemove(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+	if (n_dirty == SCENE_MAX_DIRTY){
+		best = 0;
+		best_cost = UINT32_MAX;
+		for (i = 0; i < n_dirty; i++){
+			u = RectUnion(&r, &dirty[i]);
+			cost = RectArea(&u) - RectArea(&dirty[i]);
+			if (cost < best_cost){
+				best_cost = cost;
+				best = i;
+			}
+		}
+		r = RectUnion(&r, &dirty[best]);
+		DirtyRemove(best);
+	}
+	dirty[n_dirty++] = r;
+}
+
+static uint16_t TextWidth(Font_t *font, const char *str){
+	uint16_t w = 0;
+
+	while (*str != '\0'){
+		w += font->info[*str - ' '].width + 1;
+		str++;
+	}
+	return w;
+}
+
+static void TextBox(scene_item_t *item){
+	uint16_t w = TextWidth(item->font, item->text);
+
+	item->box.x1 = item->box.x0 + ((w > 1) ? (w - 2) : 0);
+	item->box.y1 = item->box.y0 + item->font->font_height - 1;
+}
+
+static int8_t ItemAdd(scene_item_t *item){
+	if (n_items == SCENE_MAX_ITEMS){
+		return -1;
+	}
+	item->visible = true;
+	items[n_items] = *item;
+	DirtyAdd(item->box);
+	return n_items++;
+}
+
+/* Draws the pixels of a 1 bit per pixel bitmap (fonts and icons) on a row (bit: first bit of the bitmap row) */
+static void BitmapRow(uint16_t *row, int32_t x, uint16_t width, const uint8_t *bits, uint32_t bit,
+		uint16_t bmp_width, uint16_t foreground, uint16_t background){
+	int32_t j0 = (x < 0) ? -x : 0;
+	int32_t j1 = ((x + bmp_width) > width) ? (width - x) : bmp_width;
+
+	if (j1 > j0){
+		FontExpandRow(&row[x + j0], bits, bit + j0, j1 - j0, foreground, background);
+	}
+}
+
+/* Draws the part of an item on one row of a strip (x0: first column of the strip) */
+static void ItemRow(scene_item_t *item, uint16_t *row, uint16_t x0, uint16_t width, uint16_t y){
+	uint16_t r = y - item->box.y0;
+	int32_t x = (int32_t)item->box.x0 - x0;
+	int32_t j0, j1;
+	const char *c;
+	char_info_t *info;
+
+	switch (item->type){
+	case SCENE_RECT:
+		j0 = (x < 0) ? 0 : x;
+		j1 = (int32_t)item->box.x1 - x0 + 1;
+		if (j1 > width){
+			j1 = width;
+		}
+		for (int32_t j = j0; j < j1; j++){
+			row[j] = ILI9341_STRIP_COLOR(item->foreground);
+		}
+		break;
+	case SCENE_TEXT:
+		for (c = item->text; *c != '\0' && x < width; c++){
+			info = &item->font->info[*c - ' '];
+			if (x + info->width > 0){
+				BitmapRow(row, x, width, &item->font->data[info->offset], r * FONT_ROW_BITS(info->width, item->font->flags),
+					info->width, ILI9341_STRIP_COLOR(item->foreground), ILI9341_STRIP_COLOR(item->background));
+			}
+			x += info->width + 1;
+		}
+		break;
+	case SCENE_ICON:
+		BitmapRow(row, x, width, &item->icon_font->data[item->icon * item->icon_font->offset],
+			r * ((item->icon_font->flags & ICON_PACKED) ? item->icon_font->width : ((item->icon_font->width + 7) & ~7)),
+			item->icon_font->width, ILI9341_STRIP_COLOR(item->foreground), ILI9341_STRIP_COLOR(item->background));
+		break;
+	case SCENE_PICTURE:
+		j0 = (x < 0) ? 0 : x;
+		j1 = (int32_t)item->box.x1 - x0 + 1;
+		if (j1 > width){
+			j1 = width;
+		}
+		/* Picture bytes are already in the order sent to the LCD */
+		memcpy(&row[j0], &item->pic[2 * ((uint32_t)r * (item->box.x1 - item->box.x0 + 1) + (j0 - x))], 2 * (j1 - j0));
+		break;
+	case SCENE_IMAGE:
+		j0 = (x < 0) ? 0 : x;
+		j1 = (int32_t)item->box.x1 - x0 + 1;
+		if (j1 > width){
+			j1 = width;
+		}
+		ILI9341ImageRow(item->img, r, j0 - x, j1 - j0, &row[j0]);
+		break;
+	}
+}
+
+/* Render function of ILI9341RenderArea: background and then every item, in order */
+static void SceneRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+	uint16_t *row, y, x1 = x0 + width - 1;
+	scene_item_t *item;
+
+	for (uint16_t l = 0; l < lines; l++){
+		row = &strip[l * width];
+		y = y0 + l;
+		for (uint16_t j = 0; j < width; j++){
+			row[j] = ILI9341_STRIP_COLOR(scene_back);
+		}
+		for (uint8_t i = 0; i < n_items; i++){
+			item = &items[i];
+			if (item->visible && y >= item->box.y0 && y <= item->box.y1 && item->box.x0 <= x1 && item->box.x1 >= x0){
+				ItemRow(item, row, x0, width, y);
+			}
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+
+void ILI9341SceneInit(uint16_t back_color){
+	scene_back = back_color;
+	n_items = 0;
+	n_dirty = 0;
+}
+
+int8_t ILI9341SceneAddRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
+	scene_item_t item = {
+		.type = SCENE_RECT,
+		.box = {(x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0},
+		.foreground = color
+	};
+	return ItemAdd(&item);
+}
+
+int8_t ILI9341SceneAddText(uint16_t x, uint16_t y, const char* str, Font_t* font, uint16_t foreground, uint16_t background){
+	scene_item_t item = {
+		.type = SCENE_TEXT,
+		.box = {x, y, x, y},
+		.foreground = foreground,
+		.background = background,
+		.font = font
+	};
+	strncpy(item.text, str, SCENE_MAX_TEXT);
+	item.text[SCENE_MAX_TEXT] = '\0';
+	TextBox(&item);
+	return ItemAdd(&item);
+}
+
+int8_t ILI9341SceneAddIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
+	scene_item_t item = {
+		.type = SCENE_ICON,
+		.box = {x, y, x + icon_font->width - 1, y + icon_font->height - 1},
+		.foreground = foreground,
+		.background = background,
+		.icon_font = icon_font,
+		.icon = icon
+	};
+	return ItemAdd(&item);
+}
+
+int8_t ILI9341SceneAddPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
+	scene_item_t item = {
+		.type = SCENE_PICTURE,
+		.box = {x, y, x + width - 1, y + height - 1},
+		.pic = pic
+	};
+	return ItemAdd(&item);
+}
+
+int8_t ILI9341SceneAddImage(uint16_t x, uint16_t y, const ili9341_image_t *img){
+	scene_item_t item = {
+		.type = SCENE_IMAGE,
+		.box = {x, y, x + img->width - 1, y + img->height - 1},
+		.img = img
+	};
+	return ItemAdd(&item);
+}
+
+void ILI9341SceneSetText(int8_t id, const char* str){
+	scene_item_t *item = &items[id];
+	uint16_t old_x, new_x, old_w, new_w;
+	scene_rect_t cell;
+	uint8_t i;
+	bool old_end = false, new_end = false;
+
+	/* Only the characters that change (or move) are marked as dirty */
+	old_x = new_x = item->box.x0;
+	cell.y0 = item->box.y0;
+	cell.y1 = item->box.y0 + item->font->font_height - 1;
+	for (i = 0; i < SCENE_MAX_TEXT; i++){
+		old_end = old_end || item->text[i] == '\0';
+		new_end = new_end || str[i] == '\0';
+		if (old_end && new_end){
+			break;
+		}
+		old_w = old_end ? 0 : item->font->info[item->text[i] - ' '].width;
+		new_w = new_end ? 0 : item->font->info[str[i] - ' '].width;
+		if (old_end || new_end || item->text[i] != str[i] || old_x != new_x){
+			cell.x0 = (old_x < new_x) ? old_x : new_x;
+			cell.x1 = ((old_x + old_w > new_x + new_w) ? (old_x + old_w) : (new_x + new_w));
+			cell.x1 = (cell.x1 > cell.x0) ? (cell.x1 - 1) : cell.x0;
+			if (item->visible){
+				DirtyAdd(cell);
+			}
+		}
+		old_x += old_w + 1;
+		new_x += new_w + 1;
+	}
+	strncpy(item->text, str, SCENE_MAX_TEXT);
+	item->text[SCENE_MAX_TEXT] = '\0';
+	TextBox(item);
+}
+
+void ILI9341SceneSetColor(int8_t id, uint16_t foreground, uint16_t background){
+	scene_item_t *item = &items[id];
+
+	if (item->foreground != foreground || item->background != background){
+		item->foreground = foreground;
+		item->background = background;
+		if (item->visible){
+			DirtyAdd(item->box);
+		}
+	}
+}
+
+void ILI9341SceneSetVisible(int8_t id, bool visible){
+	scene_item_t *item = &items[id];
+
+	if (item->visible != visible){
+		item->visible = visible;
+		DirtyAdd(item->box);
+	}
+}
+
+void ILI9341SceneInvalidate(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1){
+	scene_rect_t r = {(x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0};
+	DirtyAdd(r);
+}
+
+void ILI9341SceneFlush(void){
+	scene_rect_t r;
+
+	if (n_dirty == 0){
+		return;
+	}
+	/* the frame deadline holds also while the task waits for the SPI DMA */
+	PowerBurstBegin();
+	while (n_dirty > 0){
+		r = dirty[--n_dirty];
+		ILI9341RenderArea(r.x0, r.y0, r.x1, r.y1, SceneRender, NULL);
+	}
+	PowerBurstEnd();
+}
+
+/*==================[end of file]============================================*/
@@ -31,6 +31,7 @@
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static int8_t motor_speed[N_MOTORS];	/*!< Last commanded speed of each motor */
 
 /*==================[internal functions definition]==========================*/
 
@@ -49,53 +50,60 @@ uint8_t L293Init(void){
 }
 
 uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed){
-	uint8_t err = 0;
+	return L293SetSpeedRamp(motor, speed, 0);
+}
+
+uint8_t L293SetSpeedRamp(l293_motor_t motor, int8_t speed, uint32_t time_ms){
+	pwm_out_t pwm;
+	gpio_t in_a, in_b;
 
 	switch(motor){
 	case MOTOR_1:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOff(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_0, -speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
-		}
+		pwm = PWM_0;
+		in_a = A_1;
+		in_b = A_2;
 		break;
 	case MOTOR_2:
-		if(speed == 0){
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOff(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed > 0){
-			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
-			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
-		if(speed < 0){
-			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
-			PWMSetDutyCycle(PWM_1, -speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
-		}
+		pwm = PWM_1;
+		in_a = A_3;
+		in_b = A_4;
 		break;
 	default:
-		err = 1;
-		break;
+		return 1;
+	}
+	if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
+	if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
+
+	uint16_t duty = ((uint32_t)((speed < 0) ? -speed : speed) * PWM_DUTY_MAX) / MAX_F_SPEED;
+	/* A reversal ramps from stopped: the direction changes with the motor unpowered */
+	if((speed > 0 && motor_speed[motor] < 0) || (speed < 0 && motor_speed[motor] > 0)){
+		PWMSetDuty(pwm, 0);
+	}
+	if(speed == 0 && time_ms == 0){
+		GPIOOff(in_a);
+		GPIOOff(in_b);
 	}
+	if(speed > 0){
+		GPIOOn(in_a);
+		GPIOOff(in_b);
+	}
+	if(speed < 0){
+		GPIOOff(in_a);
+		GPIOOn(in_b);
+	}
+	/* When ramping down to 0 the inputs keep the direction until the next command */
+	if(time_ms == 0){
+		PWMSetDuty(pwm, duty);
+	}else{
+		PWMFade(pwm, duty, time_ms, NULL, NULL);
+	}
+	motor_speed[motor] = speed;
+
+	return 0;
+}
 
-	return err;
+int8_t L293GetSpeed(l293_motor_t motor){
+	return (motor < N_MOTORS) ? motor_speed[motor] : 0;
 }
 
 uint8_t L293DeInit(void){
@@ -12,6 +12,9 @@
 /*==================[inclusions]=============================================*/
 #include "lcditse0803.h"
 #include "gpio_mcu.h"
+#include "gpio_fast_out_mcu.h"
+#include "timer_mcu.h"
+#include "esp_attr.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_BCD_1	GPIO_20
 #define GPIO_BCD_2	GPIO_21
@@ -20,31 +23,94 @@
 #define GPIO_SEL_1	GPIO_19
 #define GPIO_SEL_2	GPIO_18
 #define GPIO_SEL_3	GPIO_9
+#define LCD_DIGITS	3
+#define BCD_MASK	0x0F		/* display_bundle: BCD1..4 in bits 0..3 */
+#define SEL_SHIFT	4			/* display_bundle: SEL1..3 in bits 4..6 */
+#define SEL_MASK	(0x07 << SEL_SHIFT)
 /*==================[internal data definition]===============================*/
 static uint16_t actual_value = 0; /*variable that saves the value to be shown in the display LCD*/
+static const gpio_t bcd_pins[4] = {GPIO_BCD_1, GPIO_BCD_2, GPIO_BCD_3, GPIO_BCD_4};
+static gpio_fast_t bcd_bundle = NULL; /*BCD lines as dedicated GPIO, written at once*/
+static const gpio_t display_pins[7] = {GPIO_BCD_1, GPIO_BCD_2, GPIO_BCD_3, GPIO_BCD_4, GPIO_SEL_1, GPIO_SEL_2, GPIO_SEL_3};
+static gpio_fast_t display_bundle = NULL; /*BCD and SEL lines as dedicated GPIO (refresh mode)*/
+static volatile uint8_t digit_pattern[LCD_DIGITS]; /*BCD value and SEL line of each digit, hundreds first*/
+static uint8_t refresh_digit = 0;
+static soft_timer_t refresh_timer;
+static bool refresh = false;
 /*==================[internal functions declaration]=========================*/
 /** @brief Aux function to load a digit to the LCD Display
  *
  */
 bool LcdItsE0803BCDtoPin(uint8_t value){
+	if(display_bundle != NULL){
+		GPIOFastBundleWrite(display_bundle, BCD_MASK, value);
+		return true;
+	}
+	if(bcd_bundle != NULL){
+		GPIOFastBundleWrite(bcd_bundle, 0x0F, value);
+		return true;
+	}
 	GPIOState(GPIO_BCD_1, (value & (1<<0))>>0);
 	GPIOState(GPIO_BCD_2, (value & (1<<1))>>1);
 	GPIOState(GPIO_BCD_3, (value & (1<<2))>>2);
 	GPIOState(GPIO_BCD_4, (value & (1<<3))>>3);
 	return true;
 }
+/** @brief Precomputes the pin pattern of each digit (refresh mode)
+ *
+ */
+static void LcdItsE0803Patterns(uint16_t value){
+	uint8_t digit = LCD_DIGITS;
+	while(digit > 0){
+		digit--;
+		digit_pattern[digit] = (value % 10) | (1 << (SEL_SHIFT + digit));
+		value /= 10;
+	}
+}
+
+/** @brief Latches one digit per call: its BCD value and SEL line in one write, then SEL low
+ *
+ */
+static void IRAM_ATTR LcdItsE0803Refresh(void *param){
+	GPIOFastBundleWrite(display_bundle, BCD_MASK | SEL_MASK, digit_pattern[refresh_digit]);
+	GPIOFastClear(display_bundle, SEL_MASK);
+	refresh_digit = (refresh_digit + 1 < LCD_DIGITS) ? refresh_digit + 1 : 0;
+}
+/** @brief Aux function to latch the BCD lines in a digit (0: hundreds)
+ *
+ */
+static void LcdItsE0803Latch(uint8_t digit){
+	static const gpio_t sel_pins[LCD_DIGITS] = {GPIO_SEL_1, GPIO_SEL_2, GPIO_SEL_3};
+	if(display_bundle != NULL){
+		GPIOFastSet(display_bundle, 1 << (SEL_SHIFT + digit));
+		GPIOFastClear(display_bundle, SEL_MASK);
+		return;
+	}
+	GPIOOn(sel_pins[digit]);
+	GPIOOff(sel_pins[digit]);
+}
 /*==================[external functions definition]==========================*/
 bool LcdItsE0803Init(void){
-	/* Configuration of pins of data*/
-	GPIOInit(GPIO_BCD_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_3, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_4, GPIO_OUTPUT);
+	/* Configuration of pins of data and control (GPIO driver if no dedicated channel is free)*/
+	if(display_bundle == NULL && bcd_bundle == NULL){
+		display_bundle = GPIOFastBundleInit(display_pins, 7, GPIO_FAST_OUTPUT);
+	}
+	if(display_bundle == NULL && bcd_bundle == NULL){
+		bcd_bundle = GPIOFastBundleInit(bcd_pins, 4, GPIO_FAST_OUTPUT);
+	}
+	if(display_bundle == NULL && bcd_bundle == NULL){
+		GPIOInit(GPIO_BCD_1, GPIO_OUTPUT);
+		GPIOInit(GPIO_BCD_2, GPIO_OUTPUT);
+		GPIOInit(GPIO_BCD_3, GPIO_OUTPUT);
+		GPIOInit(GPIO_BCD_4, GPIO_OUTPUT);
+	}
 
 	/* Configuration of pins of control*/
-	GPIOInit(GPIO_SEL_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
+	if(display_bundle == NULL){
+		GPIOInit(GPIO_SEL_1, GPIO_OUTPUT);
+		GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
+		GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
+	}
 
 	actual_value=0;
 	LcdItsE0803Write(actual_value);
@@ -54,6 +120,14 @@ bool LcdItsE0803Init(void){
 bool LcdItsE0803Write(uint16_t value) {
 	uint8_t units, tens, hundreds;
 	if(value<1000)	 {
+		if(refresh){
+			/* the refresh timer latches it, only on changes the digits are computed */
+			if(value != actual_value){
+				actual_value = value;
+				LcdItsE0803Patterns(value);
+			}
+			return true;
+		}
 		actual_value = value;
 
 		hundreds = value/100;
@@ -62,18 +136,15 @@ bool LcdItsE0803Write(uint16_t value) {
 
 		/* Write hundreds */
 		LcdItsE0803BCDtoPin(hundreds);
-		GPIOOn(GPIO_SEL_1);
-		GPIOOff(GPIO_SEL_1);
+		LcdItsE0803Latch(0);
 
 		/* Write tens */
 		LcdItsE0803BCDtoPin(tens);
-		GPIOOn(GPIO_SEL_2);
-		GPIOOff(GPIO_SEL_2);
+		LcdItsE0803Latch(1);
 
 		/* Write units */
 		LcdItsE0803BCDtoPin(units);
-		GPIOOn(GPIO_SEL_3);
-		GPIOOff(GPIO_SEL_3);
+		LcdItsE0803Latch(2);
 		return true; /* return 1 for values lower than 999 */
 	}
 	else
@@ -84,21 +155,39 @@ uint16_t LcdItsE0803Read(void){
 	return (actual_value);
 }
 
-void LcdItsE0803Off(void){
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_1);
-	GPIOOff(GPIO_SEL_1);
+bool LcdItsE0803StartRefresh(uint32_t period_us){
+	/* the refresh interrupt writes the pins only through the bundle */
+	if(display_bundle == NULL){
+		return false;
+	}
+	if(!refresh){
+		SoftTimerInit(&refresh_timer, LcdItsE0803Refresh, NULL);
+	}
+	LcdItsE0803Patterns(actual_value);
+	refresh = true;
+	SoftTimerStart(&refresh_timer, period_us, period_us);
+	return true;
+}
 
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_2);
-	GPIOOff(GPIO_SEL_2);
+void LcdItsE0803StopRefresh(void){
+	if(refresh){
+		SoftTimerStop(&refresh_timer);
+		refresh = false;
+		/* the last value may not be latched in every digit yet */
+		LcdItsE0803Write(actual_value);
+	}
+}
 
+void LcdItsE0803Off(void){
+	LcdItsE0803StopRefresh();
 	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_3);
-	GPIOOff(GPIO_SEL_3);
+	LcdItsE0803Latch(0);
+	LcdItsE0803Latch(1);
+	LcdItsE0803Latch(2);
 }
 
 bool LcdItsE0803DeInit(void){
+	LcdItsE0803StopRefresh();
 	GPIODeinit();
 	return true;
 }
@@ -16,6 +16,7 @@
 #define GPIO_LED1 GPIO_11
 #define GPIO_LED2 GPIO_10
 #define GPIO_LED3 GPIO_5
+#define GPIO_LEDS ((1UL << GPIO_LED1) | (1UL << GPIO_LED2) | (1UL << GPIO_LED3))
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -103,17 +104,20 @@ uint8_t LedToggle(led_t led){
 }
 
 uint8_t LedsOffAll(void){
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
+	GPIOWriteMask(GPIO_LEDS, 0);
 	
 	return true;
 }
 
 uint8_t LedsMask(uint8_t mask){
-	GPIOState(GPIO_LED1, (mask & LED_1) >> 2);
-	GPIOState(GPIO_LED2, (mask & LED_2) >> 1);
-	GPIOState(GPIO_LED3, (mask & LED_3));
+	uint32_t state = 0;
+	if(mask & LED_1)
+		state |= 1UL << GPIO_LED1;
+	if(mask & LED_2)
+		state |= 1UL << GPIO_LED2;
+	if(mask & LED_3)
+		state |= 1UL << GPIO_LED3;
+	GPIOWriteMask(GPIO_LEDS, state);
 	return true;
 }
 
@@ -11,6 +11,12 @@
 #include "i2c_mcu.h"
 #include "string.h"
 #include "delay_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+
+#define MAX3010X_FIFO_DEPTH	32 //Samples
+#define MAX3010X_SENSOR_WATERMARK	17 //Samples per block of the sensor_t: shortest latency
 
 
 uint8_t activeLEDs; //Gets set during setup. Allows check() to calculate how many bytes to read from FIFO
@@ -19,6 +25,47 @@ uint8_t revisionID;
 
 sense_struct sense;
 
+//Interrupt driven acquisition
+typedef struct {
+  max3010x_block_cb_t callback;
+  void *param;
+} subscriber_t;
+static subscriber_t subscribers[MAX3010X_MAX_SUBSCRIBERS];
+static uint8_t subscribersCount = 0;
+static TaskHandle_t acquisitionTask = NULL;
+static gpio_t acquisitionPin;
+static volatile bool acquisitionRunning = false;
+static uint32_t blockRed[MAX3010X_FIFO_DEPTH], blockIR[MAX3010X_FIFO_DEPTH], blockGreen[MAX3010X_FIFO_DEPTH];
+
+//Common sensor interface
+static bool MAX3010X_sensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static void MAX3010X_sensorStop(const sensor_t *sensor);
+SENSOR_QUEUE_DEFINE(sensorQueue, uint32_t, 2, 2 * MAX3010X_FIFO_DEPTH);
+static const sensor_ops_t sensorOps = {
+  .start = MAX3010X_sensorStart,
+  .read_block = SensorQueueReadBlock,
+  .stop = MAX3010X_sensorStop,
+};
+static const sensor_format_t sensorFormat = {
+  .name = "MAX3010X",
+  .type = SENSOR_UINT32,
+  .channels = 2,
+  .scale = 1.0f,
+  .unit = "raw",
+  .min_period_us = 313, //3200 Hz
+};
+static const sensor_t sensor = {
+  .ops = &sensorOps,
+  .format = &sensorFormat,
+  .queue = &sensorQueue,
+};
+static gpio_t sensorPin;
+static bool sensorSubscribed = false;
+
+//Register shadow: configuration read-modify-writes don't read the bus again
+static i2c_dev_t device = NULL;
+static i2c_shadow_t shadow;
+
 // Status Registers
 static const uint8_t MAX3010X_INTSTAT1 =		0x00;
 static const uint8_t MAX3010X_INTSTAT2 =		0x01;
@@ -149,6 +196,15 @@ bool MAX3010X_begin(void) {
 
 	I2C_initialize(400000);
 
+  // Interrupt enable and configuration registers (not MODECONFIG: its RESET bit clears itself)
+  device = I2C_getDevice(MAX30105_ADDRESS);
+  I2C_shadowEnable(device, &shadow);
+  I2C_shadowCacheable(device, MAX3010X_INTENABLE1, MAX3010X_INTENABLE2);
+  I2C_shadowCacheable(device, MAX3010X_FIFOCONFIG, MAX3010X_FIFOCONFIG);
+  I2C_shadowCacheable(device, MAX3010X_PARTICLECONFIG, MAX3010X_PARTICLECONFIG);
+  I2C_shadowCacheable(device, MAX3010X_LED1_PULSEAMP, MAX3010X_LED3_PULSEAMP);
+  I2C_shadowCacheable(device, MAX3010X_LED_PROX_AMP, MAX3010X_MULTILEDCONFIG2);
+
   // Step 1: Initial Communication and Verification
   // Check that a MAX3010X is connected
   if (MAX3010X_readPartID() != MAX_30105_EXPECTEDPARTID) {
@@ -226,6 +282,7 @@ void MAX3010X_softReset(void) {
     DelayMs(1); //Let's not over burden the I2C bus
     Time++;
   }
+  I2C_shadowInvalidate(device); //Registers back to POR values
 }
 
 void MAX3010X_shutDown(void) {
@@ -396,14 +453,14 @@ float MAX3010X_readTemperature() {
   uint8_t tempFrac = readRegister8(MAX3010X_DIETEMPFRAC); //Causes the clearing of the DIE_TEMP_RDY interrupt
 
   // Step 3: Calculate temperature (datasheet pg. 23)
-  return (float)tempInt + ((float)tempFrac * 0.0625);
+  return (float)tempInt + ((float)tempFrac * 0.0625f);
 }
 
 // Returns die temp in F
 float MAX3010X_readTemperatureF() {
   float temp = MAX3010X_readTemperature();
 
-  if (temp != -999.0) temp = temp * 1.8 + 32.0;
+  if (temp != -999.0f) temp = temp * 1.8f + 32.0f;
 
   return (temp);
 }
@@ -439,6 +496,7 @@ uint8_t MAX3010X_getRevisionID() {
 //Use the default setup if you are just getting started with the MAX3010X sensor
 void MAX3010X_setup(uint8_t powerLevel, uint8_t sampleAverage, uint8_t ledMode, int sampleRate, int pulseWidth, int adcRange) {
 	MAX3010X_softReset(); //Reset all configuration, threshold, and data registers to POR values
+  I2C_shadowBegin(device); //Configuration writes sent together on commit
 
   //FIFO Configuration
   //-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -515,6 +573,7 @@ void MAX3010X_setup(uint8_t powerLevel, uint8_t sampleAverage, uint8_t ledMode,
   //enableSlot(3, SLOT_GREEN_PILOT);
   //-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+  I2C_shadowCommit(device);
   MAX3010X_clearFIFO(); //Reset the FIFO before we begin checking the sensor
 }
 
@@ -589,122 +648,88 @@ void MAX3010X_nextSample(void)
   }
 }
 
+//Point to the samples available, from the tail, without copying them
+uint8_t MAX3010X_getSpan(max3010x_span_t *span)
+{
+  uint8_t n = MAX3010X_available();
+  uint8_t first = STORAGE_SIZE - sense.tail;
+
+  if (first > n) first = n;
+  span->red[0] = &sense.red[sense.tail];
+  span->ir[0] = &sense.IR[sense.tail];
+  span->green[0] = &sense.green[sense.tail];
+  span->len[0] = first;
+  span->red[1] = sense.red;
+  span->ir[1] = sense.IR;
+  span->green[1] = sense.green;
+  span->len[1] = n - first;
+  return n;
+}
+
+//Release n samples of the span
+void MAX3010X_consume(uint8_t n)
+{
+  uint8_t available = MAX3010X_available();
+
+  if (n > available) n = available;
+  sense.tail = (sense.tail + n) % STORAGE_SIZE;
+}
+
 //Polls the sensor for new data
 //Call regularly
 //If new data is available, it updates the head and tail in the main struct
 //Returns number of new samples obtained
-uint16_t MAX3010X_check(void)
+//Reads the pending samples of the FIFO into fifoBytes with two I2C transactions
+//(repeated start, no stop between register and data): the pointers
+//(FIFO_WR_PTR, OVF_COUNTER, FIFO_RD_PTR) -from INTSTAT1 if withStatus, which
+//also clears the interrupts- and then the whole FIFO. Returns number of samples
+static uint8_t fifoBytes[MAX3010X_FIFO_DEPTH * 3 * 3];
+static uint8_t MAX3010X_burstFIFO(bool withStatus)
 {
-  //Read register FIDO_DATA in (3-uint8_t * number of active LED) chunks
-  //Until FIFO_RD_PTR = FIFO_WR_PTR
-
-  uint8_t readPointer = MAX3010X_getReadPointer();
-  uint8_t writePointer = MAX3010X_getWritePointer();
-
-  int numberOfSamples = 0;
-
-  //Do we have new data?
-  if (readPointer != writePointer)
-  {
-    //Calculate the number of readings we need to get from sensor
-    numberOfSamples = writePointer - readPointer;
-    if (numberOfSamples < 0) numberOfSamples += 32; //Wrap condition
-
-    //We now have the number of readings, now calc uint8_ts to read
-    //For this example we are just doing Red and IR (3 uint8_ts each)
-    int uint8_tsLeftToRead = numberOfSamples * activeLEDs * 3;
-
-    //Get ready to read a burst of data from the FIFO register
-    uint8_t transmit_data_buffer;
-    transmit_data_buffer = MAX3010X_FIFODATA;
-    I2C_SelectRegister(MAX30105_ADDRESS, transmit_data_buffer);
-   // _i2cPort->beginTransmission(MAX3010X_ADDRESS);
-   // _i2cPort->write(MAX3010X_FIFODATA);
-   // _i2cPort->endTransmission();
-
-    //We may need to read as many as 288 uint8_ts so we read in blocks no larger than I2C_BUFFER_LENGTH
-    //I2C_BUFFER_LENGTH changes based on the platform. 64 uint8_ts for SAMD21, 32 uint8_ts for Uno.
-    //Wire.requestFrom() is limited to BUFFER_LENGTH which is 32 on the Uno
-    while (uint8_tsLeftToRead > 0)
-    {
-      int toGet = uint8_tsLeftToRead;
-      if (toGet > I2C_BUFFER_LENGTH)
-      {
-        //If toGet is 32 this is bad because we read 6 uint8_ts (Red+IR * 3 = 6) at a time
-        //32 % 6 = 2 left over. We don't want to request 32 uint8_ts, we want to request 30.
-        //32 % 9 (Red+IR+GREEN) = 5 left over. We want to request 27.
-
-        toGet = I2C_BUFFER_LENGTH - (I2C_BUFFER_LENGTH % (activeLEDs * 3)); //Trim toGet to be a multiple of the samples we need to read
-      }
-
-      uint8_tsLeftToRead -= toGet;
-
-      //Request toGet number of uint8_ts from sensor
-      //_i2cPort->requestFrom(MAX3010X_ADDRESS, toGet);
-      uint8_t data_to_read_buffer[32];
-      uint8_t data = 0;
-      //data_to_read_buffer = reg;
-      I2C_requestBytes(MAX30105_ADDRESS, toGet, data_to_read_buffer, 0);
-
-      while (toGet > 0)
-      {
-        sense.head++; //Advance the head of the storage struct
-        sense.head %= STORAGE_SIZE; //Wrap condition
-
-        uint8_t temp[sizeof(uint32_t)]; //Array of 4 uint8_ts that we will convert into long
-        uint32_t tempLong;
-
-        //Burst read three uint8_ts - RED
-        temp[3] = 0;
-        temp[2] = data_to_read_buffer[0];
-        temp[1] = data_to_read_buffer[1];
-        temp[0] = data_to_read_buffer[2];
+  uint8_t regs[7];
+  uint8_t first = withStatus ? MAX3010X_INTSTAT1 : MAX3010X_FIFOWRITEPTR;
+  uint8_t *pointers = &regs[MAX3010X_FIFOWRITEPTR - first];
+  int numberOfSamples;
 
-        //Convert array to long
-        memcpy(&tempLong, temp, sizeof(tempLong));
+  if (!I2C_burstRead(MAX30105_ADDRESS, first, MAX3010X_FIFOREADPTR - first + 1, regs))
+    return 0;
 
-		tempLong &= 0x3FFFF; //Zero out all but 18 bits
+  numberOfSamples = pointers[0] - pointers[2];
+  if (numberOfSamples < 0) numberOfSamples += MAX3010X_FIFO_DEPTH; //Wrap condition
+  if (numberOfSamples == 0 && pointers[1] != 0) numberOfSamples = MAX3010X_FIFO_DEPTH; //FIFO full, samples lost
+  if (numberOfSamples == 0)
+    return 0;
 
-        sense.red[sense.head] = tempLong; //Store this reading into the sense array
-
-        if (activeLEDs > 1)
-        {
-          //Burst read three more uint8_ts - IR
-          temp[3] = 0;
-          temp[2] = data_to_read_buffer[3];
-          temp[1] = data_to_read_buffer[4];
-          temp[0] = data_to_read_buffer[5];
-
-          //Convert array to long
-          memcpy(&tempLong, temp, sizeof(tempLong));
-
-		  tempLong &= 0x3FFFF; //Zero out all but 18 bits
-
-		  sense.IR[sense.head] = tempLong;
-        }
-
-        if (activeLEDs > 2)
-        {
-          //Burst read three more uint8_ts - Green
-          temp[3] = 0;
-          temp[2] = data_to_read_buffer[6];
-          temp[1] = data_to_read_buffer[7];
-          temp[0] = data_to_read_buffer[8];
-
-          //Convert array to long
-          memcpy(&tempLong, temp, sizeof(tempLong));
-
-		  tempLong &= 0x3FFFF; //Zero out all but 18 bits
-
-          sense.green[sense.head] = tempLong;
-        }
+  if (!I2C_burstRead(MAX30105_ADDRESS, MAX3010X_FIFODATA, numberOfSamples * activeLEDs * 3, fifoBytes))
+    return 0;
+  return numberOfSamples;
+}
 
-        toGet -= activeLEDs * 3;
-      }
+//Each channel: 3 bytes, MSB first, 18 bits
+static inline uint32_t MAX3010X_unpack(const uint8_t *p)
+{
+  return ((p[0] << 16) | (p[1] << 8) | p[2]) & 0x3FFFF;
+}
 
-    } //End while (uint8_tsLeftToRead > 0)
+//Call regularly
+//If new data is available, it updates the head and tail in the main struct
+//Returns number of new samples obtained
+uint16_t MAX3010X_check(void)
+{
+  uint8_t numberOfSamples = MAX3010X_burstFIFO(false);
+  const uint8_t *p = fifoBytes;
 
-  } //End readPtr != writePtr
+  for (uint8_t i = 0; i < numberOfSamples; i++, p += activeLEDs * 3)
+  {
+    sense.head++; //Advance the head of the storage struct
+    sense.head %= STORAGE_SIZE; //Wrap condition
+
+    sense.red[sense.head] = MAX3010X_unpack(p);
+    if (activeLEDs > 1)
+      sense.IR[sense.head] = MAX3010X_unpack(p + 3);
+    if (activeLEDs > 2)
+      sense.green[sense.head] = MAX3010X_unpack(p + 6);
+  }
 
   return (numberOfSamples); //Let the world know how much new data we found
 }
@@ -727,6 +752,123 @@ bool MAX3010X_safeCheck(uint8_t maxTimeToCheck)
   }
 }
 
+//
+// Interrupt driven acquisition
+//
+static void IRAM_ATTR MAX3010X_intISR(void *arg)
+{
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(acquisitionTask, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+//Sleeps until INT goes low (FIFO almost full), drains the FIFO and hands the
+//block to the subscribers. INT is open drain and stays low until the status
+//is read, so the FIFO is drained again if it is still low afterwards
+static void MAX3010X_acquisitionTask(void *arg)
+{
+  while (true)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (acquisitionRunning)
+    {
+      uint8_t samples = MAX3010X_burstFIFO(true);
+      const uint8_t *p = fifoBytes;
+      for (uint8_t i = 0; i < samples; i++, p += activeLEDs * 3)
+      {
+        blockRed[i] = MAX3010X_unpack(p);
+        if (activeLEDs > 1) blockIR[i] = MAX3010X_unpack(p + 3);
+        if (activeLEDs > 2) blockGreen[i] = MAX3010X_unpack(p + 6);
+      }
+      for (uint8_t s = 0; s < subscribersCount && samples > 0; s++)
+      {
+        subscribers[s].callback(blockRed, blockIR, blockGreen, samples, subscribers[s].param);
+      }
+      if (GPIORead(acquisitionPin)) break; //INT released
+    }
+  }
+}
+
+bool MAX3010X_subscribe(max3010x_block_cb_t callback, void *param)
+{
+  if (subscribersCount == MAX3010X_MAX_SUBSCRIBERS) return false;
+  subscribers[subscribersCount].callback = callback;
+  subscribers[subscribersCount].param = param;
+  subscribersCount++;
+  return true;
+}
+
+bool MAX3010X_startAcquisition(gpio_t int_pin, uint8_t watermark)
+{
+  if (watermark < MAX3010X_FIFO_DEPTH - 15) watermark = MAX3010X_FIFO_DEPTH - 15;
+  if (watermark > MAX3010X_FIFO_DEPTH) watermark = MAX3010X_FIFO_DEPTH;
+  MAX3010X_setFIFOAlmostFull(MAX3010X_FIFO_DEPTH - watermark); //Empty slots left when INT is asserted
+  MAX3010X_clearFIFO();
+
+  if (acquisitionTask == NULL)
+  {
+    acquisitionPin = int_pin;
+    GPIOInit(int_pin, GPIO_INPUT); //Open drain INT, pulled up
+    if (xTaskCreate(MAX3010X_acquisitionTask, "max3010x", 2048, NULL, 10, &acquisitionTask) != pdPASS)
+      return false;
+    GPIOActivInt(int_pin, MAX3010X_intISR, false, NULL);
+  }
+  acquisitionRunning = true;
+  MAX3010X_enableAFULL();
+  xTaskNotifyGive(acquisitionTask); //INT may be low already: no edge to come
+  return true;
+}
+
+void MAX3010X_stopAcquisition(void)
+{
+  acquisitionRunning = false;
+  MAX3010X_disableAFULL();
+}
+
+//
+// Common sensor interface
+//
+static void MAX3010X_sensorBlock(const uint32_t *red, const uint32_t *ir, const uint32_t *green, uint8_t samples, void *param)
+{
+  for (uint8_t i = 0; i < samples; i++)
+  {
+    uint32_t sample[2] = {red[i], ir[i]};
+    SensorQueuePush(&sensorQueue, sample, i == samples - 1);
+  }
+}
+
+static bool MAX3010X_sensorStart(const sensor_t *s, uint32_t period_us, sensor_ready_cb_t ready, void *param)
+{
+  static const uint16_t rates[] = {50, 100, 200, 400, 800, 1000, 1600, 3200};
+  const uint8_t codes[] = {MAX3010X_SAMPLERATE_50, MAX3010X_SAMPLERATE_100, MAX3010X_SAMPLERATE_200, MAX3010X_SAMPLERATE_400,
+    MAX3010X_SAMPLERATE_800, MAX3010X_SAMPLERATE_1000, MAX3010X_SAMPLERATE_1600, MAX3010X_SAMPLERATE_3200};
+  uint32_t rate = (period_us == 0) ? 3200 : 1000000 / period_us;
+  uint8_t step = 0;
+
+  if (!sensorSubscribed)
+  {
+    if (!MAX3010X_subscribe(MAX3010X_sensorBlock, NULL)) return false;
+    sensorSubscribed = true;
+  }
+  //Nearest step not slower than asked
+  while (step < sizeof(rates) / sizeof(rates[0]) - 1 && rates[step] < rate) step++;
+  MAX3010X_setSampleRate(codes[step]);
+  SensorQueueOpen(&sensorQueue, s, ready, param);
+  return MAX3010X_startAcquisition(sensorPin, MAX3010X_SENSOR_WATERMARK);
+}
+
+static void MAX3010X_sensorStop(const sensor_t *s)
+{
+  MAX3010X_stopAcquisition();
+  SensorQueueClose(&sensorQueue);
+}
+
+const sensor_t *MAX3010X_sensor(gpio_t int_pin)
+{
+  sensorPin = int_pin;
+  return &sensor;
+}
+
 //Given a register, read it, mask it, and then set the thing
 void bitMask(uint8_t reg, uint8_t mask, uint8_t thing)
 {
@@ -0,0 +1,206 @@
+/**
+ * @file motion_planner.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "motion_planner.h"
+#include "timer_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+#define PHASE_END		((uint32_t)MOTION_TABLE_SIZE << 16)	/* Phase of the last table point (Q16) */
+#define PROFILE_ONE		32768								/* Normalized position 1.0 (Q15) */
+#define PROFILES		2
+/*==================[internal data declaration]==============================*/
+typedef enum {
+	AXIS_SERVO,
+	AXIS_MOTOR,
+} axis_kind_t;
+
+typedef struct {
+	axis_kind_t kind;
+	uint8_t out;				/* servo_out_t or l293_motor_t */
+	int32_t value;				/* Output written: duty or speed */
+	int32_t from, delta;		/* Movement, in output units */
+	const uint16_t *table;		/* Profile of the movement */
+	uint32_t phase, step;		/* Position in the table (Q16) and advance per tick */
+	bool moving;
+} motion_axis_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uint16_t profile_table[PROFILES][MOTION_TABLE_SIZE + 1];
+static motion_axis_t axes[MOTION_MAX_AXES];
+static uint8_t n_axes = 0;
+static soft_timer_t tick_timer;
+static uint16_t tick_ms = 0;
+static bool ticking = false;
+static portMUX_TYPE motion_lock = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Normalized position (0 to 1) at normalized time t */
+static float ProfilePosition(motion_profile_t profile, float t){
+	if(profile == MOTION_SCURVE){
+		return t * t * t * (10.0f - 15.0f * t + 6.0f * t * t);
+	}
+	// accelerate for 1/4, cruise at 4/3, decelerate for the last 1/4
+	if(t < 0.25f){
+		return (8.0f / 3.0f) * t * t;
+	}
+	if(t > 0.75f){
+		return 1.0f - (8.0f / 3.0f) * (1.0f - t) * (1.0f - t);
+	}
+	return 1.0f / 6.0f + (4.0f / 3.0f) * (t - 0.25f);
+}
+
+static void IRAM_ATTR MotionWrite(motion_axis_t *a, int32_t value){
+	if(value == a->value){
+		return;
+	}
+	a->value = value;
+	if(a->kind == AXIS_SERVO){
+		ServoSetDuty((servo_out_t)a->out, (uint16_t)value);
+	}else{
+		L293SetSpeed((l293_motor_t)a->out, (int8_t)value);
+	}
+}
+
+/* Every tick: each moving axis reads its profile (linear interpolation between table points) */
+static void IRAM_ATTR MotionTick(void *param){
+	motion_axis_t *a;
+	uint32_t idx, frac;
+	int32_t s, value;
+	bool any = false;
+
+	portENTER_CRITICAL_ISR(&motion_lock);
+	for(uint8_t i = 0; i < n_axes; i++){
+		a = &axes[i];
+		if(!a->moving){
+			continue;
+		}
+		a->phase += a->step;
+		if(a->phase >= PHASE_END){
+			a->moving = false;
+			value = a->from + a->delta;
+		}else{
+			idx = a->phase >> 16;
+			frac = a->phase & 0xFFFF;
+			s = a->table[idx] + (int32_t)(((a->table[idx + 1] - a->table[idx]) * frac) >> 16);
+			value = a->from + ((a->delta * s + PROFILE_ONE / 2) >> 15);
+			any = true;
+		}
+		MotionWrite(a, value);
+	}
+	if(!any){
+		ticking = false;
+		SoftTimerStop(&tick_timer);
+	}
+	portEXIT_CRITICAL_ISR(&motion_lock);
+}
+
+static int8_t MotionAdd(axis_kind_t kind, uint8_t out, int32_t value){
+	if(n_axes >= MOTION_MAX_AXES){
+		return -1;
+	}
+	axes[n_axes] = (motion_axis_t){
+		.kind = kind,
+		.out = out,
+		.value = value,
+		.moving = false,
+	};
+	return (int8_t)n_axes++;
+}
+/*==================[external functions definition]==========================*/
+bool MotionInit(uint16_t period_ms){
+	if(period_ms == 0){
+		return false;
+	}
+	for(uint16_t k = 0; k <= MOTION_TABLE_SIZE; k++){
+		float t = (float)k / MOTION_TABLE_SIZE;
+		profile_table[MOTION_TRAPEZOIDAL][k] = (uint16_t)(ProfilePosition(MOTION_TRAPEZOIDAL, t) * PROFILE_ONE + 0.5f);
+		profile_table[MOTION_SCURVE][k] = (uint16_t)(ProfilePosition(MOTION_SCURVE, t) * PROFILE_ONE + 0.5f);
+	}
+	if(tick_ms == 0){
+		SoftTimerInit(&tick_timer, MotionTick, NULL);
+	}
+	tick_ms = period_ms;
+	return true;
+}
+
+int8_t MotionAddServo(servo_out_t servo){
+	return MotionAdd(AXIS_SERVO, servo, ServoGetDuty(servo));
+}
+
+int8_t MotionAddMotor(l293_motor_t motor){
+	return MotionAdd(AXIS_MOTOR, motor, L293GetSpeed(motor));
+}
+
+bool MotionMove(const motion_target_t *targets, uint8_t n, uint32_t time_ms, motion_profile_t profile){
+	uint32_t ticks, step;
+	int32_t target;
+	motion_axis_t *a;
+	bool start;
+
+	if(tick_ms == 0 || profile >= PROFILES){
+		return false;
+	}
+	for(uint8_t i = 0; i < n; i++){
+		if(targets[i].axis < 0 || targets[i].axis >= n_axes){
+			return false;
+		}
+	}
+	// same step for every axis: they arrive at the same tick
+	ticks = time_ms / tick_ms;
+	step = (ticks > 1) ? PHASE_END / ticks : PHASE_END;
+	if(step == 0){
+		step = 1;
+	}
+	portENTER_CRITICAL(&motion_lock);
+	for(uint8_t i = 0; i < n; i++){
+		a = &axes[targets[i].axis];
+		target = (a->kind == AXIS_SERVO) ? ServoAngleToDuty(targets[i].value) : targets[i].value;
+		a->from = a->value;
+		a->delta = target - a->value;
+		a->table = profile_table[profile];
+		a->phase = 0;
+		a->step = step;
+		a->moving = true;
+	}
+	start = !ticking && n > 0;
+	ticking |= start;
+	portEXIT_CRITICAL(&motion_lock);
+	if(start){
+		SoftTimerStart(&tick_timer, (uint32_t)tick_ms * 1000, (uint32_t)tick_ms * 1000);
+	}
+	return true;
+}
+
+void MotionStop(void){
+	portENTER_CRITICAL(&motion_lock);
+	for(uint8_t i = 0; i < n_axes; i++){
+		axes[i].moving = false;
+	}
+	portEXIT_CRITICAL(&motion_lock);
+}
+
+bool MotionBusy(int8_t axis){
+	if(axis >= 0){
+		return (axis < n_axes) && axes[axis].moving;
+	}
+	for(uint8_t i = 0; i < n_axes; i++){
+		if(axes[i].moving){
+			return true;
+		}
+	}
+	return false;
+}
+
+/*==================[end of file]============================================*/
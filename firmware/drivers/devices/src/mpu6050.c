@@ -13,32 +13,77 @@
 #include "mpu6050.h"
 #include "math.h"
 #include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "rt_schedule_mcu.h"
 /*==================[macros and definitions]=================================*/
-#define I2C_NUM I2C_NUM_0
+#define FIFO_CHUNK_FRAMES   (255 / MPU6050_FIFO_FRAME_SIZE)  /* frames per I2C_readBytes burst */
+#define EVENT_MG_PER_LSB    2       /* FF_THR, MOT_THR and ZRMOT_THR unit */
+#define EVENT_STILL_MS_PER_LSB  64  /* ZRMOT_DUR unit */
+#define DMP_Q30             1073741824.0f   /* 2^30: quaternion scale */
+#define SENSOR_DRAIN_US     10000   /* sensor_t: FIFO drained about every 10 ms */
+#define SENSOR_QUEUE_FRAMES 128     /* sensor_t: frames kept, a drain and a half */
 
 /*==================[internal data definition]===============================*/
 uint8_t devAddr;
 uint8_t buffer[14];
+
+typedef struct {
+    mpu6050_block_cb_t callback;
+    void *param;
+} subscriber_t;
+static subscriber_t subscribers[MPU6050_MAX_SUBSCRIBERS];
+static i2c_dev_t device = NULL;
+static i2c_shadow_t shadow;
+static uint8_t subscribers_count = 0;
+static TaskHandle_t acquisition_task = NULL;
+static volatile bool acquisition_running = false;
+static volatile uint8_t block_frames;
+static volatile uint8_t frames_pending = 0;
+static uint8_t fifo_bytes[FIFO_CHUNK_FRAMES * MPU6050_FIFO_FRAME_SIZE];
+static mpu6050_block_t block;
+static volatile uint8_t event_interrupts = 0;    /* INT_ENABLE bits of the events */
+static mpu6050_event_cb_t event_callback = NULL;
+static void *event_param = NULL;
+static const mpu6050_dmp_image_t *dmp_image = NULL;
+static volatile bool dmp_running = false;
+static mpu6050_quat_cb_t dmp_callback = NULL;
+static void *dmp_param = NULL;
+static mpu6050_quat_block_t quat_block;
 /*==================[internal functions declaration]=========================*/
+static void MPU6050_restartFIFO(void);
+static void MPU6050_drainFIFO(void);
+static void MPU6050_intISR(void *arg);
+static void MPU6050_acquisitionTask(void *arg);
+static bool MPU6050_sensorStart(const sensor_t *sensor, uint32_t period_us, sensor_ready_cb_t ready, void *param);
+static void MPU6050_sensorStop(const sensor_t *sensor);
+
+SENSOR_QUEUE_DEFINE(sensor_queue, int16_t, 6, SENSOR_QUEUE_FRAMES);
+static const sensor_ops_t sensor_ops = {
+    .start = MPU6050_sensorStart,
+    .read_block = SensorQueueReadBlock,
+    .stop = MPU6050_sensorStop,
+};
+static const sensor_format_t sensor_format = {
+    .name = "MPU6050",
+    .type = SENSOR_INT16,
+    .channels = 6,
+    .scale = 1.0f / 16384,
+    .unit = "g,g,g,raw,raw,raw",
+    .min_period_us = 1000,
+};
+static const sensor_t sensor = {
+    .ops = &sensor_ops,
+    .format = &sensor_format,
+    .queue = &sensor_queue,
+};
+static gpio_t sensor_pin;
+static bool sensor_subscribed = false;
 
 /*==================[external functions definition]==========================*/
 void MPU6050_ReadRegister(uint8_t reg, uint8_t *data, uint8_t len){
-	uint8_t dev = 0x68;
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(dev, reg);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (dev << 1) | I2C_MASTER_READ, 1));
-
-	if(len>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, len, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+len-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000));
-	i2c_cmd_link_delete(cmd);
+	I2C_readBytes(MPU6050_DEFAULT_ADDRESS, reg, len, data, I2C_MASTER_TIMEOUT_MS);
 }
 
 void MPU6050_Address(uint8_t address) {
@@ -47,9 +92,20 @@ void MPU6050_Address(uint8_t address) {
 
 void MPU6050_initialize() {
 	devAddr = MPU6050_DEFAULT_ADDRESS;
-    MPU6050_setClockSource(MPU6050_CLOCK_PLL_XGYRO);
+    // configuration registers only changed by the host (not USER_CTRL, PWR_MGMT_1
+    // and SIGNAL_PATH_RESET, with self-clearing reset bits)
+    device = I2C_getDevice(devAddr);
+    I2C_shadowEnable(device, &shadow);
+    I2C_shadowCacheable(device, MPU6050_RA_SMPLRT_DIV, MPU6050_RA_I2C_SLV4_CTRL);
+    I2C_shadowCacheable(device, MPU6050_RA_INT_PIN_CFG, MPU6050_RA_INT_ENABLE);
+    I2C_shadowCacheable(device, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_RA_I2C_MST_DELAY_CTRL);
+    I2C_shadowCacheable(device, MPU6050_RA_PWR_MGMT_2, MPU6050_RA_PWR_MGMT_2);
+
+    I2C_shadowBegin(device);
     MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_250);
     MPU6050_setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
+    I2C_shadowCommit(device);
+    MPU6050_setClockSource(MPU6050_CLOCK_PLL_XGYRO);
     MPU6050_setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
 }
 
@@ -2409,6 +2465,7 @@ void MPU6050_resetSensors() {
  */
 void MPU6050_reset() {
     I2C_writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true);
+    I2C_shadowInvalidate(device); // registers back to their reset values
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2766,4 +2823,366 @@ void MPU6050_setDeviceID(uint8_t id) {
     I2C_writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id);
 }
 
+// FIFO burst acquisition
+
+/** Reset the FIFO (it must be disabled while resetting) and enable it again.
+ */
+static void MPU6050_restartFIFO(void) {
+    MPU6050_setFIFOEnabled(false);
+    MPU6050_resetFIFO();
+    MPU6050_setFIFOEnabled(true);
+}
+/** Read the whole frames stored in the FIFO into block.
+ * One FIFO_COUNT read plus one I2C_readBytes burst every FIFO_CHUNK_FRAMES frames.
+ */
+static void MPU6050_drainFIFO(void) {
+    uint16_t count = MPU6050_getFIFOCount();
+    uint8_t frames, chunk, i;
+    const uint8_t *p;
+
+    block.frames = 0;
+    if (count >= MPU6050_FIFO_SIZE || (count % MPU6050_FIFO_FRAME_SIZE) != 0) {
+        // overflowed (oldest bytes lost) or misaligned: frames can't be recovered
+        MPU6050_restartFIFO();
+        return;
+    }
+    frames = count / MPU6050_FIFO_FRAME_SIZE;
+    while (block.frames < frames) {
+        chunk = frames - block.frames;
+        if (chunk > FIFO_CHUNK_FRAMES) chunk = FIFO_CHUNK_FRAMES;
+        I2C_readBytes(devAddr, MPU6050_RA_FIFO_R_W, chunk * MPU6050_FIFO_FRAME_SIZE, fifo_bytes, I2C_MASTER_TIMEOUT_MS);
+        // frame: ACCEL_XOUT ... ACCEL_ZOUT, GYRO_XOUT ... GYRO_ZOUT, big endian
+        for (i = 0, p = fifo_bytes; i < chunk; i++, p += MPU6050_FIFO_FRAME_SIZE) {
+            block.ax[block.frames] = (((int16_t)p[0]) << 8) | p[1];
+            block.ay[block.frames] = (((int16_t)p[2]) << 8) | p[3];
+            block.az[block.frames] = (((int16_t)p[4]) << 8) | p[5];
+            block.gx[block.frames] = (((int16_t)p[6]) << 8) | p[7];
+            block.gy[block.frames] = (((int16_t)p[8]) << 8) | p[9];
+            block.gz[block.frames] = (((int16_t)p[10]) << 8) | p[11];
+            block.frames++;
+        }
+    }
+}
+/** Read INT_STATUS and hand the events to the event callback.
+ */
+static void MPU6050_serveEvents(void) {
+    uint8_t status = MPU6050_getIntStatus() & event_interrupts;
+    uint8_t events = 0;
+
+    if (status & (1 << MPU6050_INTERRUPT_FF_BIT)) events |= MPU6050_EVENT_FALL;
+    if (status & (1 << MPU6050_INTERRUPT_MOT_BIT)) events |= MPU6050_EVENT_MOTION;
+    // zero motion interrupts on both edges, MOT_DETECT_STATUS tells which one
+    if (status & (1 << MPU6050_INTERRUPT_ZMOT_BIT))
+        events |= MPU6050_getZeroMotionDetected() ? MPU6050_EVENT_STILL : MPU6050_EVENT_STILL_END;
+    if (events != 0 && event_callback != NULL) {
+        event_callback(events, event_param);
+    }
+}
+/** Threshold register value of an event threshold in mg.
+ */
+static uint8_t MPU6050_eventThreshold(uint16_t mg) {
+    uint16_t lsb = (mg + EVENT_MG_PER_LSB / 2) / EVENT_MG_PER_LSB;
+    return (lsb > 255) ? 255 : lsb;
+}
+/** Create the acquisition task and route INT to it (once), INT pulses on every interrupt.
+ */
+static bool MPU6050_startTask(gpio_t int_pin) {
+    // 50 us active high pulse on every interrupt
+    MPU6050_setInterruptMode(MPU6050_INTMODE_ACTIVEHIGH);
+    MPU6050_setInterruptDrive(MPU6050_INTDRV_PUSHPULL);
+    MPU6050_setInterruptLatch(MPU6050_INTLATCH_50USPULSE);
+    if (acquisition_task == NULL) {
+        if (xTaskCreate(MPU6050_acquisitionTask, "mpu6050", 2048, NULL, RtSchedulePriority("mpu6050", 10), &acquisition_task) != pdPASS)
+            return false;
+        GPIOInit(int_pin, GPIO_INPUT);
+        GPIOActivInt(int_pin, MPU6050_intISR, true, NULL);
+    }
+    return true;
+}
+/** Read the whole DMP packets stored in the FIFO and give their quaternions.
+ */
+static void MPU6050_drainDMP(void) {
+    uint16_t count = MPU6050_getFIFOCount();
+    uint8_t size = dmp_image->packet_size;
+    uint8_t burst = sizeof(fifo_bytes) / size;
+    uint16_t packets;
+    uint8_t chunk, i;
+
+    if (burst > MPU6050_DMP_BLOCK_PACKETS) burst = MPU6050_DMP_BLOCK_PACKETS;
+    if (count >= MPU6050_FIFO_SIZE || (count % size) != 0) {
+        // overflowed or misaligned: the packets can't be recovered
+        MPU6050_restartFIFO();
+        return;
+    }
+    for (packets = count / size; packets > 0; packets -= chunk) {
+        chunk = (packets > burst) ? burst : packets;
+        I2C_readBytes(devAddr, MPU6050_RA_FIFO_R_W, chunk * size, fifo_bytes, I2C_MASTER_TIMEOUT_MS);
+        for (i = 0; i < chunk; i++) {
+            MPU6050_dmpQuaternion(&fifo_bytes[i * size + dmp_image->quat_offset], &quat_block.q[i]);
+        }
+        quat_block.packets = chunk;
+        dmp_callback(&quat_block, dmp_param);
+    }
+}
+/** Select the DMP memory bank and the address of the next MEM_R_W access.
+ */
+static void MPU6050_setMemoryAddress(uint8_t bank, uint8_t address) {
+    I2C_writeByte(devAddr, MPU6050_RA_BANK_SEL, bank & 0x1F);
+    I2C_writeByte(devAddr, MPU6050_RA_MEM_START_ADDR, address);
+}
+/** Data ready interrupt: wakes the acquisition task every block_frames frames
+ * (DMP packets with the DMP running). Without the acquisition every pulse is an event.
+ */
+static void IRAM_ATTR MPU6050_intISR(void *arg) {
+    BaseType_t woken = pdFALSE;
+    if (++frames_pending >= block_frames || !(acquisition_running || dmp_running)) {
+        frames_pending = 0;
+        vTaskNotifyGiveFromISR(acquisition_task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+/** Acquisition task: drains the FIFO and hands the block to the subscribers.
+ */
+static void MPU6050_acquisitionTask(void *arg) {
+    uint8_t s;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (event_interrupts != 0) MPU6050_serveEvents();
+        if (dmp_running) {
+            MPU6050_drainDMP();
+            continue;
+        }
+        if (!acquisition_running) continue;
+        MPU6050_drainFIFO();
+        for (s = 0; s < subscribers_count && block.frames > 0; s++) {
+            subscribers[s].callback(&block, subscribers[s].param);
+        }
+    }
+}
+bool MPU6050_subscribe(mpu6050_block_cb_t callback, void *param) {
+    if (subscribers_count == MPU6050_MAX_SUBSCRIBERS) return false;
+    subscribers[subscribers_count].callback = callback;
+    subscribers[subscribers_count].param = param;
+    subscribers_count++;
+    return true;
+}
+bool MPU6050_startAcquisition(gpio_t int_pin, uint8_t frames) {
+    // the FIFO is the DMP's while it runs
+    if (dmp_running) return false;
+    // up to a whole block may arrive while the previous one is being drained
+    if (frames < 1) frames = 1;
+    if (frames > MPU6050_BLOCK_FRAMES / 2) frames = MPU6050_BLOCK_FRAMES / 2;
+    block_frames = frames;
+    frames_pending = 0;
+
+    // accel and gyro frames only
+    MPU6050_setFIFOEnabled(false);
+    MPU6050_setTempFIFOEnabled(false);
+    MPU6050_setSlave0FIFOEnabled(false);
+    MPU6050_setSlave1FIFOEnabled(false);
+    MPU6050_setSlave2FIFOEnabled(false);
+    MPU6050_setAccelFIFOEnabled(true);
+    MPU6050_setXGyroFIFOEnabled(true);
+    MPU6050_setYGyroFIFOEnabled(true);
+    MPU6050_setZGyroFIFOEnabled(true);
+
+    if (!MPU6050_startTask(int_pin))
+        return false;
+    MPU6050_setIntEnabled((1 << MPU6050_INTERRUPT_DATA_RDY_BIT) | event_interrupts);
+    acquisition_running = true;
+    MPU6050_restartFIFO();
+    return true;
+}
+void MPU6050_stopAcquisition(void) {
+    acquisition_running = false;
+    MPU6050_setIntEnabled(event_interrupts);
+    MPU6050_setFIFOEnabled(false);
+}
+bool MPU6050_startEvents(gpio_t int_pin, const mpu6050_events_config_t *config,
+                         mpu6050_event_cb_t callback, void *param) {
+    uint8_t interrupts = 0;
+
+    if (!MPU6050_startTask(int_pin))
+        return false;
+    // the previous events stop while the engines are configured
+    event_interrupts = 0;
+    event_callback = callback;
+    event_param = param;
+    I2C_shadowBegin(device);
+    MPU6050_setDHPFMode(config->dhpf);
+    if (config->events & MPU6050_EVENT_FALL) {
+        MPU6050_setFreefallDetectionThreshold(MPU6050_eventThreshold(config->fall_mg));
+        MPU6050_setFreefallDetectionDuration(config->fall_ms);
+        interrupts |= (1 << MPU6050_INTERRUPT_FF_BIT);
+    }
+    if (config->events & MPU6050_EVENT_MOTION) {
+        MPU6050_setMotionDetectionThreshold(MPU6050_eventThreshold(config->motion_mg));
+        MPU6050_setMotionDetectionDuration(config->motion_ms);
+        interrupts |= (1 << MPU6050_INTERRUPT_MOT_BIT);
+    }
+    if (config->events & MPU6050_EVENT_STILL) {
+        MPU6050_setZeroMotionDetectionThreshold(MPU6050_eventThreshold(config->still_mg));
+        MPU6050_setZeroMotionDetectionDuration((config->still_ms / EVENT_STILL_MS_PER_LSB > 255) ?
+                                               255 : config->still_ms / EVENT_STILL_MS_PER_LSB);
+        interrupts |= (1 << MPU6050_INTERRUPT_ZMOT_BIT);
+    }
+    I2C_shadowCommit(device);
+    MPU6050_setIntEnabled((acquisition_running ? (1 << MPU6050_INTERRUPT_DATA_RDY_BIT) : 0) | interrupts);
+    // events detected before this call are not given
+    MPU6050_getIntStatus();
+    event_interrupts = interrupts;
+    return true;
+}
+void MPU6050_stopEvents(void) {
+    event_interrupts = 0;
+    MPU6050_setIntEnabled(acquisition_running ? (1 << MPU6050_INTERRUPT_DATA_RDY_BIT) :
+                          dmp_running ? (1 << MPU6050_INTERRUPT_DMP_INT_BIT) : 0);
+}
+bool MPU6050_writeMemoryBlock(const uint8_t *data, uint16_t size, uint8_t bank, uint8_t address, bool verify) {
+    uint8_t check[MPU6050_DMP_MEMORY_CHUNK_SIZE];
+    uint16_t i, chunk;
+
+    for (i = 0; i < size; i += chunk) {
+        // chunks don't cross the end of the bank
+        chunk = size - i;
+        if (chunk > MPU6050_DMP_MEMORY_CHUNK_SIZE) chunk = MPU6050_DMP_MEMORY_CHUNK_SIZE;
+        if (chunk > MPU6050_DMP_MEMORY_BANK_SIZE - address) chunk = MPU6050_DMP_MEMORY_BANK_SIZE - address;
+        MPU6050_setMemoryAddress(bank, address);
+        if (!I2C_devWriteRegs(device, MPU6050_RA_MEM_R_W, &data[i], chunk, I2C_MASTER_TIMEOUT_MS))
+            return false;
+        if (verify) {
+            MPU6050_setMemoryAddress(bank, address);
+            if (!I2C_devReadRegs(device, MPU6050_RA_MEM_R_W, check, chunk, I2C_MASTER_TIMEOUT_MS) ||
+                memcmp(check, &data[i], chunk) != 0)
+                return false;
+        }
+        address += chunk;
+        if (address == 0) bank++;   // uint8_t address wrapped at the end of the bank
+    }
+    return true;
+}
+bool MPU6050_readMemoryBlock(uint8_t *data, uint16_t size, uint8_t bank, uint8_t address) {
+    uint16_t i, chunk;
+
+    for (i = 0; i < size; i += chunk) {
+        chunk = size - i;
+        if (chunk > MPU6050_DMP_MEMORY_CHUNK_SIZE) chunk = MPU6050_DMP_MEMORY_CHUNK_SIZE;
+        if (chunk > MPU6050_DMP_MEMORY_BANK_SIZE - address) chunk = MPU6050_DMP_MEMORY_BANK_SIZE - address;
+        MPU6050_setMemoryAddress(bank, address);
+        if (!I2C_devReadRegs(device, MPU6050_RA_MEM_R_W, &data[i], chunk, I2C_MASTER_TIMEOUT_MS))
+            return false;
+        address += chunk;
+        if (address == 0) bank++;
+    }
+    return true;
+}
+bool MPU6050_dmpLoad(const mpu6050_dmp_image_t *image) {
+    if (dmp_running || image->size > MPU6050_DMP_MEMORY_BANKS * MPU6050_DMP_MEMORY_BANK_SIZE ||
+        image->packet_size < image->quat_offset + MPU6050_DMP_QUAT_SIZE ||
+        image->packet_size > sizeof(fifo_bytes)) {
+        return false;
+    }
+    dmp_image = NULL;
+    if (!MPU6050_writeMemoryBlock(image->code, image->size, 0, 0, true))
+        return false;
+    // DMP_CFG_1 and DMP_CFG_2: program start address, big endian
+    I2C_writeWord(devAddr, MPU6050_RA_DMP_CFG_1, image->start_address);
+    dmp_image = image;
+    return true;
+}
+bool MPU6050_dmpStart(gpio_t int_pin, uint8_t packets, mpu6050_quat_cb_t callback, void *param) {
+    if (dmp_image == NULL || acquisition_running || callback == NULL)
+        return false;
+    if (packets < 1) packets = 1;
+    if (packets > MPU6050_DMP_BLOCK_PACKETS) packets = MPU6050_DMP_BLOCK_PACKETS;
+    if (!MPU6050_startTask(int_pin))
+        return false;
+    dmp_callback = callback;
+    dmp_param = param;
+    block_frames = packets;
+    frames_pending = 0;
+
+    // the DMP writes its own packets: no sensor goes to the FIFO
+    I2C_shadowBegin(device);
+    MPU6050_setRate(dmp_image->rate_divider);
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_42);
+    MPU6050_setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+    MPU6050_setTempFIFOEnabled(false);
+    MPU6050_setAccelFIFOEnabled(false);
+    MPU6050_setXGyroFIFOEnabled(false);
+    MPU6050_setYGyroFIFOEnabled(false);
+    MPU6050_setZGyroFIFOEnabled(false);
+    MPU6050_setSlave0FIFOEnabled(false);
+    MPU6050_setSlave1FIFOEnabled(false);
+    MPU6050_setSlave2FIFOEnabled(false);
+    I2C_shadowCommit(device);
+    MPU6050_setIntEnabled((1 << MPU6050_INTERRUPT_DMP_INT_BIT) | event_interrupts);
+
+    MPU6050_setFIFOEnabled(false);
+    MPU6050_resetFIFO();
+    I2C_writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT, 1);
+    dmp_running = true;
+    MPU6050_setFIFOEnabled(true);
+    I2C_writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, 1);
+    return true;
+}
+void MPU6050_dmpStop(void) {
+    dmp_running = false;
+    I2C_writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, 0);
+    MPU6050_setIntEnabled(event_interrupts);
+    MPU6050_setFIFOEnabled(false);
+}
+void MPU6050_dmpQuaternion(const uint8_t *packet, mpu6050_quat_t *q) {
+    int32_t v[4];
+
+    for (uint8_t i = 0; i < 4; i++, packet += 4) {
+        v[i] = (int32_t)(((uint32_t)packet[0] << 24) | ((uint32_t)packet[1] << 16) |
+                         ((uint32_t)packet[2] << 8) | packet[3]);
+    }
+    q->w = v[0] / DMP_Q30;
+    q->x = v[1] / DMP_Q30;
+    q->y = v[2] / DMP_Q30;
+    q->z = v[3] / DMP_Q30;
+}
+/** sensor_t: the frames of each block, interleaved.
+ */
+static void MPU6050_sensorBlock(const mpu6050_block_t *b, void *param) {
+    int16_t sample[6];
+
+    for (uint8_t i = 0; i < b->frames; i++) {
+        sample[0] = b->ax[i];
+        sample[1] = b->ay[i];
+        sample[2] = b->az[i];
+        sample[3] = b->gx[i];
+        sample[4] = b->gy[i];
+        sample[5] = b->gz[i];
+        SensorQueuePush(&sensor_queue, sample, i == b->frames - 1);
+    }
+}
+static bool MPU6050_sensorStart(const sensor_t *s, uint32_t period_us, sensor_ready_cb_t ready, void *param) {
+    uint32_t divider = period_us / 1000;
+    uint32_t frames;
+
+    if (!sensor_subscribed) {
+        if (!MPU6050_subscribe(MPU6050_sensorBlock, NULL)) return false;
+        sensor_subscribed = true;
+    }
+    // 1 kHz Gyroscope Output Rate with the DLPF enabled
+    if (divider < 1) divider = 1;
+    if (divider > 256) divider = 256;
+    frames = SENSOR_DRAIN_US / (divider * 1000);
+    MPU6050_setDLPFMode(MPU6050_DLPF_BW_42);
+    MPU6050_setRate(divider - 1);
+    SensorQueueOpen(&sensor_queue, s, ready, param);
+    return MPU6050_startAcquisition(sensor_pin, (frames == 0) ? 1 : frames);
+}
+static void MPU6050_sensorStop(const sensor_t *s) {
+    MPU6050_stopAcquisition();
+    SensorQueueClose(&sensor_queue);
+}
+const sensor_t *MPU6050_sensor(gpio_t int_pin) {
+    sensor_pin = int_pin;
+    return &sensor;
+}
+
 /*==================[end of file]============================================*/
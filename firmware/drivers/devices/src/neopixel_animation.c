@@ -0,0 +1,225 @@
+/**
+ * @file neopixel_animation.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "neopixel_animation.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+#define RED_OFFSET      16
+#define GREEN_OFFSET    8
+#define BLUE_OFFSET     0
+#define BLEND_ONE       256             /* Weight of the target color at the end of a transition */
+#define ANIM_TASK_STACK 2048
+/*==================[internal data declaration]==============================*/
+typedef enum {
+	ANIM_IDLE,
+	ANIM_KEYFRAMES,                     /* Also a single color, set or faded */
+	ANIM_RAINBOW,
+	ANIM_SHIFT,
+} anim_mode_t;
+
+/* What the stripe should show, written by the setters and read by the task */
+typedef struct {
+	anim_mode_t mode;
+	neopixel_keyframe_t keys[NEOPIXEL_ANIM_MAX_KEYFRAMES];
+	uint8_t n_keys;
+	bool loop;
+	uint16_t period_ms;                 /* Rainbow turn, shift step */
+	uint8_t sat, val, reps;
+	bool upwards;
+	uint32_t version;                   /* Incremented by every setter */
+} anim_effect_t;
+
+/* Position in the keyframes, kept by the task */
+typedef struct {
+	uint8_t key;                        /* Keyframe being played */
+	uint32_t key_start;                 /* Time at which its transition started (ms) */
+	neopixel_color_t from;              /* Color at that time */
+} anim_progress_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static anim_effect_t request;
+static portMUX_TYPE request_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t anim_task = NULL;
+static TickType_t frame_ticks;
+static neopixel_anim_stats_t anim_stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Linear mix of two colors, weight 0 (from) to BLEND_ONE (to), per channel */
+static neopixel_color_t Blend(neopixel_color_t from, neopixel_color_t to, int32_t weight){
+	neopixel_color_t color = 0;
+	for (uint8_t offset = BLUE_OFFSET; offset <= RED_OFFSET; offset += 8){
+		int32_t a = (from >> offset) & 0xFF;
+		int32_t b = (to >> offset) & 0xFF;
+		color |= (neopixel_color_t)(a + (((b - a) * weight) / BLEND_ONE)) << offset;
+	}
+	return color;
+}
+
+/* Color of the keyframes at elapsed_ms, *done once the last one is reached (not looping) */
+static neopixel_color_t KeyframeColor(const anim_effect_t *effect, anim_progress_t *progress, uint32_t elapsed_ms, bool *done){
+	const neopixel_keyframe_t *k;
+	uint32_t segment, t;
+	uint32_t total = 0;
+
+	for (uint8_t i = 0; i < effect->n_keys; i++){
+		total += effect->keys[i].fade_ms + effect->keys[i].hold_ms;
+	}
+	*done = false;
+	while (true){
+		k = &effect->keys[progress->key];
+		segment = k->fade_ms + k->hold_ms;
+		if (elapsed_ms - progress->key_start < segment){
+			break;
+		}
+		progress->from = k->color;
+		progress->key_start += segment;
+		if (++progress->key == effect->n_keys){
+			if (!effect->loop || total == 0){
+				progress->key = effect->n_keys - 1;
+				*done = true;
+				return progress->from;
+			}
+			progress->key = 0;
+		}
+	}
+	t = elapsed_ms - progress->key_start;
+	if (t >= k->fade_ms){
+		return k->color;
+	}
+	return Blend(progress->from, k->color, (int32_t)((t * BLEND_ONE) / k->fade_ms));
+}
+
+/* One frame per period: the latest request is applied, at most one refresh is started */
+static void NeoPixelAnimTask(void *param){
+	anim_effect_t effect = {.mode = ANIM_IDLE, .version = 0};
+	anim_progress_t progress;
+	neopixel_color_t shown = 0, color;
+	TickType_t wake = xTaskGetTickCount(), start = wake;
+	uint32_t elapsed_ms, next_shift = 0;
+	bool done;
+
+	while (true){
+		vTaskDelayUntil(&wake, frame_ticks);
+		anim_stats.frames++;
+		taskENTER_CRITICAL(&request_lock);
+		if (request.version != effect.version){
+			effect = request;
+			start = wake;
+			next_shift = 0;
+			/* transitions start from what the stripe shows now */
+			progress.key = 0;
+			progress.key_start = 0;
+			progress.from = shown;
+		}
+		taskEXIT_CRITICAL(&request_lock);
+		elapsed_ms = (wake - start) * portTICK_PERIOD_MS;
+		switch (effect.mode){
+			case ANIM_KEYFRAMES:
+				color = KeyframeColor(&effect, &progress, elapsed_ms, &done);
+				if (color != shown || elapsed_ms == 0){
+					NeoPixelAllColor(color);
+					shown = color;
+					anim_stats.refreshes++;
+				}
+				if (done){
+					effect.mode = ANIM_IDLE;
+				}
+			break;
+			case ANIM_RAINBOW:
+				NeoPixelRainbow((uint16_t)(((elapsed_ms % effect.period_ms) << 16) / effect.period_ms),
+					effect.sat, effect.val, effect.reps);
+				anim_stats.refreshes++;
+			break;
+			case ANIM_SHIFT:
+				if (elapsed_ms >= next_shift){
+					NeoPixelShift(effect.upwards);
+					next_shift += effect.period_ms;
+					anim_stats.refreshes++;
+				}
+			break;
+			case ANIM_IDLE:
+			break;
+		}
+	}
+}
+
+/* Publishes a new effect, picked up by the next frame */
+static void NeoPixelAnimRequest(const anim_effect_t *effect){
+	uint32_t version;
+
+	taskENTER_CRITICAL(&request_lock);
+	version = request.version;
+	request = *effect;
+	request.version = version + 1;
+	anim_stats.updates++;
+	taskEXIT_CRITICAL(&request_lock);
+}
+
+/*==================[external functions definition]==========================*/
+bool NeoPixelAnimInit(uint16_t frame_rate, uint8_t priority){
+	if (anim_task != NULL || frame_rate == 0){
+		return false;
+	}
+	frame_ticks = pdMS_TO_TICKS(1000 / frame_rate);
+	if (frame_ticks == 0){
+		frame_ticks = 1;
+	}
+	return xTaskCreate(NeoPixelAnimTask, "NeoPixelAnim", ANIM_TASK_STACK, NULL, priority, &anim_task) == pdPASS;
+}
+
+void NeoPixelAnimSetColor(neopixel_color_t color){
+	NeoPixelAnimFadeTo(color, 0);
+}
+
+void NeoPixelAnimFadeTo(neopixel_color_t color, uint16_t fade_ms){
+	neopixel_keyframe_t key = {.color = color, .fade_ms = fade_ms, .hold_ms = 0};
+	NeoPixelAnimKeyframes(&key, 1, false);
+}
+
+void NeoPixelAnimKeyframes(const neopixel_keyframe_t *keyframes, uint8_t n, bool loop){
+	anim_effect_t effect = {.mode = ANIM_KEYFRAMES, .loop = loop};
+	if (n == 0){
+		return;
+	}
+	effect.n_keys = (n > NEOPIXEL_ANIM_MAX_KEYFRAMES) ? NEOPIXEL_ANIM_MAX_KEYFRAMES : n;
+	memcpy(effect.keys, keyframes, effect.n_keys * sizeof(neopixel_keyframe_t));
+	NeoPixelAnimRequest(&effect);
+}
+
+void NeoPixelAnimRainbow(uint16_t period_ms, uint8_t sat, uint8_t val, uint8_t reps){
+	anim_effect_t effect = {
+		.mode = ANIM_RAINBOW,
+		.period_ms = (period_ms == 0) ? 1 : period_ms,
+		.sat = sat, .val = val, .reps = reps,
+	};
+	NeoPixelAnimRequest(&effect);
+}
+
+void NeoPixelAnimShift(bool upwards, uint16_t step_ms){
+	anim_effect_t effect = {.mode = ANIM_SHIFT, .upwards = upwards, .period_ms = step_ms};
+	NeoPixelAnimRequest(&effect);
+}
+
+void NeoPixelAnimStop(void){
+	anim_effect_t effect = {.mode = ANIM_IDLE};
+	NeoPixelAnimRequest(&effect);
+}
+
+void NeoPixelAnimGetStats(neopixel_anim_stats_t *stats){
+	*stats = anim_stats;
+}
+
+/*==================[end of file]============================================*/
@@ -10,6 +10,7 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
 #include "neopixel_stripe.h"
 #include "ws2812b.h"
 /*==================[macros and definitions]=================================*/
@@ -20,11 +21,14 @@
 #define GREEN_OFFSET    8
 #define BLUE_OFFSET     0
 #define MAX_BRIGHT  	255
-#define BRIGHT_OFFSET   8
+#define PIXEL_BYTES     3
 /*==================[internal data declaration]==============================*/
 uint16_t stripe_length;
 uint8_t stripe_bright = MAX_BRIGHT;
 neopixel_color_t *stripe_colors; 
+static uint8_t level_lut[256];                      /* brightness + gamma */
+static uint8_t frame[NEOPIXEL_MAX_LENGTH * PIXEL_BYTES];   /* wire format (G, R, B) */
+static bool frame_synced = false;                   /* frame holds stripe_colors */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -32,84 +36,131 @@ neopixel_color_t *stripe_colors;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void BuildLut(void){
+	for (uint16_t c = 0; c < 256; c++){
+		level_lut[c] = ws2812bGammaCorrection((c * (stripe_bright + 1)) >> 8);
+	}
+}
+
+static void EncodePixel(uint16_t pixel, neopixel_color_t color){
+	uint8_t *wire = &frame[pixel * PIXEL_BYTES];
+	wire[0] = level_lut[(color & GREEN_MSK) >> GREEN_OFFSET];
+	wire[1] = level_lut[(color & RED_MSK) >> RED_OFFSET];
+	wire[2] = level_lut[(color & BLUE_MSK) >> BLUE_OFFSET];
+}
+
+static void EncodeAll(neopixel_color_t *color_array){
+	for (uint16_t i = 0; i < stripe_length; i++){
+		EncodePixel(i, color_array[i]);
+	}
+	frame_synced = (color_array == stripe_colors);
+}
+
+/* Stripes longer than the frame buffer are encoded by ws2812b from the colors */
+static void SendStripe(neopixel_color_t *color_array){
+	if (stripe_length <= NEOPIXEL_MAX_LENGTH){
+		ws2812bSendFrame(frame, stripe_length);
+	} else {
+		ws2812bSendArray(color_array, stripe_length, stripe_bright);
+	}
+}
 
 /*==================[external functions definition]==========================*/
 
 void NeoPixelInit(gpio_t pin, uint16_t len, neopixel_color_t *color_array){
     stripe_length = len;
 	stripe_colors = color_array;
+	frame_synced = false;
+	BuildLut();
     ws2812bInit(pin);
 }
 
 void NeoPixelAllOff(void){
-    rgb_led_t led;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		led.red = 0;
-		led.green = 0;
-		led.blue = 0;
-		ws2812bSend(led);
-	}
-	ws2812bSendRet();
+	/* Stored colors sent with zero brightness */
+	ws2812bSendArray(stripe_colors, stripe_length, 0);
 }
 
 void NeoPixelAllColor(neopixel_color_t color){
+	ws2812bWait();
 	for (uint16_t i = 0; i < stripe_length; i++){
 		stripe_colors[i] = color;
 	}
-	NeoPixelSetArray(stripe_colors);
+	if (stripe_length <= NEOPIXEL_MAX_LENGTH){
+		EncodePixel(0, color);
+		for (uint16_t i = 1; i < stripe_length; i++){
+			memcpy(&frame[i * PIXEL_BYTES], frame, PIXEL_BYTES);
+		}
+		frame_synced = true;
+	}
+	SendStripe(stripe_colors);
 }
 
 void NeoPixelSetPixel(uint16_t pixel, neopixel_color_t color){
+	ws2812bWait();
 	stripe_colors[pixel] = color;
-	NeoPixelSetArray(stripe_colors);
+	if (stripe_length <= NEOPIXEL_MAX_LENGTH){
+		if (frame_synced){
+			EncodePixel(pixel, color);
+		} else {
+			EncodeAll(stripe_colors);
+		}
+	}
+	SendStripe(stripe_colors);
 }
 
 void NeoPixelSetArray(neopixel_color_t *color_array){
-    rgb_led_t led;
-	uint16_t red, green, blue;
-	ws2812bSendRet();
-	ws2812bSendRet();
-	ws2812bSendRet();
-	for (uint16_t i = 0; i < stripe_length; i++){
-		red = ((color_array[i] & RED_MSK) >> RED_OFFSET) * stripe_bright;
-		green = ((color_array[i] & GREEN_MSK) >> GREEN_OFFSET) * stripe_bright;
-		blue = ((color_array[i] & BLUE_MSK) >> BLUE_OFFSET) * stripe_bright;
-		led.red = red >> BRIGHT_OFFSET;
-		led.green = green >> BRIGHT_OFFSET;
-		led.blue = blue >> BRIGHT_OFFSET;
-		ws2812bSend(led);
+	ws2812bWait();
+	if (stripe_length <= NEOPIXEL_MAX_LENGTH){
+		EncodeAll(color_array);
 	}
-	ws2812bSendRet();
+	SendStripe(color_array);
+}
+
+void NeoPixelWait(void){
+	ws2812bWait();
 }
 
 void NeoPixelShift(bool upwards){
 	neopixel_color_t carry;
+	uint8_t wire[PIXEL_BYTES];
+	uint16_t last = stripe_length - 1;
+	bool shift_frame = (stripe_length <= NEOPIXEL_MAX_LENGTH) && frame_synced;
 
+	ws2812bWait();
 	if(upwards){
-		carry = stripe_colors[stripe_length-1];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[stripe_length-1-i] = stripe_colors[stripe_length-2-i]; 
-		}
+		carry = stripe_colors[last];
+		memmove(&stripe_colors[1], &stripe_colors[0], last * sizeof(neopixel_color_t));
 		stripe_colors[0] = carry;
+		if(shift_frame){
+			memcpy(wire, &frame[last * PIXEL_BYTES], PIXEL_BYTES);
+			memmove(&frame[PIXEL_BYTES], &frame[0], last * PIXEL_BYTES);
+			memcpy(&frame[0], wire, PIXEL_BYTES);
+		}
 	}else{
 		carry = stripe_colors[0];
-		for (uint16_t i = 0; i < stripe_length-1; i++){
-			stripe_colors[i] = stripe_colors[i+1]; 
+		memmove(&stripe_colors[0], &stripe_colors[1], last * sizeof(neopixel_color_t));
+		stripe_colors[last] = carry;
+		if(shift_frame){
+			memcpy(wire, &frame[0], PIXEL_BYTES);
+			memmove(&frame[0], &frame[PIXEL_BYTES], last * PIXEL_BYTES);
+			memcpy(&frame[last * PIXEL_BYTES], wire, PIXEL_BYTES);
 		}
-		stripe_colors[stripe_length-1] = carry;
 	}
-	NeoPixelSetArray(stripe_colors);
+	if((stripe_length <= NEOPIXEL_MAX_LENGTH) && !frame_synced){
+		EncodeAll(stripe_colors);
+	}
+	SendStripe(stripe_colors);
 }
 
 void NeoPixelBrightness(uint8_t bright){
+	ws2812bWait();
 	stripe_bright = bright;
+	BuildLut();
 	NeoPixelSetArray(stripe_colors);
 }
 
 void NeoPixelRainbow(uint16_t first_hue, uint8_t sat, uint8_t val, uint8_t reps){
+	ws2812bWait();
 	for (uint16_t i=0; i<stripe_length; i++) {
 		uint16_t hue = first_hue + (i * reps * 65536) / stripe_length;
 		neopixel_color_t color = NeoPixelHSV2Color(hue, sat, val);
@@ -0,0 +1,111 @@
+/**
+ * @file rfid_multi.c
+ * @brief Polling of several MFRC522 readers on the shared SPI bus (overlapped REQA, round-robin select)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "rfid_multi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "delay_mcu.h"
+#include "esp_timer.h"
+/*==================[macros and definitions]=================================*/
+#define RFID_MULTI_STACK	3072
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static MFRC522Ptr_t readers[RFID_MULTI_MAX];
+static uint8_t n_readers = 0;
+static uint8_t next_reader = 0;			/* First reader served in the next round */
+static TickType_t period_ticks;
+static rfid_multi_cb_t card_func = NULL;
+static void *card_param = NULL;
+static TaskHandle_t multi_task = NULL;
+static rfid_multi_stats_t multi_stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* One round: every REQA on air at once, then select the readers that got an answer */
+static void RfidMultiRound(void){
+    uint8_t atqa[2], size, i, k;
+    bool answered[RFID_MULTI_MAX];
+    StatusCode status;
+
+    for(i = 0; i < n_readers; i++){
+        PICC_RequestAStart(readers[i]);
+    }
+    DelayUs(PICC_REQA_ANSWER_US);
+    for(i = 0; i < n_readers; i++){
+        size = sizeof(atqa);
+        status = PICC_RequestAResult(readers[i], atqa, &size);
+        answered[i] = (status == STATUS_OK || status == STATUS_COLLISION);
+    }
+    for(k = 0; k < n_readers; k++){
+        i = (next_reader + k) % n_readers;
+        if(!answered[i]){
+            continue;
+        }
+        if(PICC_ReadCardSerial(readers[i])){
+            multi_stats.cards++;
+            card_func(i, readers[i], card_param);
+            PICC_HaltA(readers[i]);
+            PCD_StopCrypto1(readers[i]);
+        }else{
+            multi_stats.errors++;
+        }
+        next_reader = (i + 1) % n_readers;
+    }
+}
+
+static void RfidMultiTask(void *param){
+    TickType_t wake = xTaskGetTickCount();
+    int64_t start;
+    uint32_t round_us;
+
+    while(true){
+        start = esp_timer_get_time();
+        RfidMultiRound();
+        round_us = (uint32_t)(esp_timer_get_time() - start);
+        multi_stats.rounds++;
+        if(round_us > multi_stats.max_round_us){
+            multi_stats.max_round_us = round_us;
+        }
+        vTaskDelayUntil(&wake, period_ticks);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool RfidMultiInit(MFRC522Ptr_t *mfrc, uint8_t n, uint16_t period_ms, rfid_multi_cb_t func, void *param, uint8_t priority){
+    if(multi_task != NULL || n == 0 || n > RFID_MULTI_MAX || func == NULL){
+        return false;
+    }
+    for(uint8_t i = 0; i < n; i++){
+        if(mfrc[i] == NULL){
+            return false;
+        }
+        readers[i] = mfrc[i];
+    }
+    n_readers = n;
+    next_reader = 0;
+    card_func = func;
+    card_param = param;
+    period_ticks = pdMS_TO_TICKS(period_ms);
+    if(period_ticks == 0){
+        period_ticks = 1;
+    }
+    return xTaskCreate(RfidMultiTask, "RfidMulti", RFID_MULTI_STACK, NULL, priority, &multi_task) == pdPASS;
+}
+
+void RfidMultiGetStats(rfid_multi_stats_t *stats, bool reset){
+    *stats = multi_stats;
+    if(reset){
+        multi_stats = (rfid_multi_stats_t){0};
+    }
+}
+
+/*==================[end of file]============================================*/
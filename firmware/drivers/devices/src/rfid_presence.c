@@ -0,0 +1,93 @@
+/**
+ * @file rfid_presence.c
+ * @brief Low-power card presence detection for the MFRC522 (duty-cycled field, adaptive probe interval)
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "rfid_presence.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define RFID_FIELD_SETTLE_US	5000	/* Field on before the REQA, so the card powers up (ISO 14443-3 guard time) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static MFRC522Ptr_t reader = NULL;
+static uint16_t min_interval_ms = RFID_PRESENCE_MIN_MS;
+static uint16_t max_interval_ms = RFID_PRESENCE_MAX_MS;
+static uint16_t interval_ms = RFID_PRESENCE_MIN_MS;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void RfidPresenceSleep(void){
+    PCD_AntennaOff(reader);
+    PCD_SoftPowerDown(reader);
+}
+
+/* One probe: power up, field on, REQA and, if a card answers, select it */
+static bool RfidPresenceProbe(void){
+    PCD_SoftPowerUp(reader);
+    PCD_AntennaOn(reader);
+    DelayUs(RFID_FIELD_SETTLE_US);
+    if(PICC_IsNewCardPresent(reader) && PICC_ReadCardSerial(reader)){
+        return true;
+    }
+    RfidPresenceSleep();
+    return false;
+}
+
+/*==================[external functions definition]==========================*/
+void RfidPresenceInit(MFRC522Ptr_t mfrc, const rfid_presence_config_t *config){
+    reader = mfrc;
+    if(config != NULL){
+        min_interval_ms = config->min_interval_ms ? config->min_interval_ms : RFID_PRESENCE_MIN_MS;
+        max_interval_ms = config->max_interval_ms ? config->max_interval_ms : RFID_PRESENCE_MAX_MS;
+    }
+    if(max_interval_ms < min_interval_ms){
+        max_interval_ms = min_interval_ms;
+    }
+    interval_ms = min_interval_ms;
+    RfidPresenceSleep();
+}
+
+bool RfidPresenceWait(uint32_t timeout_ms){
+    uint32_t waited_ms = 0;
+
+    if(reader == NULL){
+        return false;
+    }
+    while(true){
+        if(RfidPresenceProbe()){
+            interval_ms = min_interval_ms;
+            return true;
+        }
+        if(timeout_ms != RFID_PRESENCE_FOREVER && waited_ms + interval_ms > timeout_ms){
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(interval_ms));
+        waited_ms += interval_ms;
+        /* nothing in the field: back off */
+        interval_ms = (interval_ms > max_interval_ms / 2) ? max_interval_ms : interval_ms * 2;
+    }
+}
+
+void RfidPresenceRelease(void){
+    if(reader == NULL){
+        return;
+    }
+    PICC_HaltA(reader);
+    PCD_StopCrypto1(reader);
+    RfidPresenceSleep();
+}
+
+uint16_t RfidPresenceInterval(void){
+    return interval_ms;
+}
+
+/*==================[end of file]============================================*/
@@ -5,14 +5,28 @@
 */
 #include "rfid_utils.h"
 #include "uart_mcu.h"
+#include <string.h>
 /****************************************
  * Private variables
  ****************************************/
 
-// auxBuffer used to store the read end write data, each block have 16 bytes,
-// auxBuffer must have 18 slots, see MIFARE_Read()
-static uint8_t auxBuffer[18];
-static uint8_t size = sizeof(auxBuffer);
+// MIFARE_Read() needs 2 extra slots for the CRC_A of the 16 bytes block
+#define BLOCK_READ_SIZE (RFID_BLOCK_SIZE + 2)
+
+// Key cache entry: the key of a card, looked up by UID
+typedef struct {
+	Uid uid;
+	MIFARE_Key key;
+	bool used;
+} key_entry_t;
+
+static key_entry_t keyCache[RFID_KEY_CACHE_LEN];
+static uint8_t keyCacheNext = 0; // entry replaced when the cache is full
+
+// Authenticated session: Crypto1 stays on while the same sector of the same
+// card is accessed, so the handshake isn't repeated
+static Uid sessionUid;
+static int16_t sessionSector = -1; // -1: no session
 
 // return status from MFRC522 functions
 static StatusCode status;
@@ -22,88 +36,70 @@ static StatusCode status;
  * Private Functions
  ****************************************/
 
+static bool sameUid(const Uid *a, const Uid *b) {
+	return a->size == b->size && memcmp(a->uidByte, b->uidByte, a->size) == 0;
+}
+
 /**
- * Read 16 bytes from a block inside a sector
- * @param  mfrc522   MFRC522 ADT pointer
- * @param  sector    card sector, 0 to 15
- * @param  blockAddr card block address, 0 to 63
- * @return           0 is no error, -1 is authentication error -2 is read error
+ * Key used for a card: the one stored with rfidSetCardKey() or, otherwise,
+ * FFFFFFFFFFFFh which is the default at chip delivery from the factory
  */
-static int readCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
-						 uint8_t blockAddr) {
-
-	MIFARE_Key key;
+static void cardKey(const Uid *uid, MIFARE_Key *key) {
 	int i;
-	// using FFFFFFFFFFFFh which is the default at chip delivery from the
-	// factory
-	for (i = 0; i < 6; i++) {
-		key.keybyte[i] = 0xFF;
+	for (i = 0; i < RFID_KEY_CACHE_LEN; i++) {
+		if (keyCache[i].used && sameUid(&keyCache[i].uid, uid)) {
+			*key = keyCache[i].key;
+			return;
+		}
 	}
+	memset(key->keybyte, 0xFF, MF_KEY_SIZE);
+}
 
-	// Authenticate using key A
-	status = (StatusCode)PCD_Authenticate(mfrc522, PICC_CMD_MF_AUTH_KEY_A,
-										  blockAddr, &key, &(mfrc522->uid));
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -1;
+/**
+ * Sector of a block: 4 blocks per sector in the first 32 sectors (MIFARE
+ * Classic 1K and 2K), 16 blocks per sector after them (4K)
+ */
+static uint8_t blockSector(uint8_t blockAddr) {
+	if (blockAddr < 128) {
+		return blockAddr / 4;
 	}
+	return 32 + (blockAddr - 128) / 16;
+}
 
-	// Read data from the block
-	status = (StatusCode)MIFARE_Read(mfrc522, blockAddr, auxBuffer, &size);
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"MIFARE_Read() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -2;
+static bool isSectorTrailer(uint8_t blockAddr) {
+	if (blockAddr < 128) {
+		return (blockAddr % 4) == 3;
 	}
-
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
-	return 0;
+	return (blockAddr % 16) == 15;
 }
 
 /**
- * Write 16 bytes to a block inside a sector
- * @param  mfrc522   MFRC522 ADT pointer
- * @param  sector    card sector, 0 to 15
- * @param  blockAddr card block address, 0 to 63
- * @return           0 is no error, -1 is authentication error -2 is write error
+ * Authenticates the sector of a block with key A, unless the session is
+ * already on that sector of the selected card
+ * @return 0 is no error, -1 is authentication error
  */
-static int writeCardBlock(MFRC522Ptr_t mfrc522, uint8_t sector,
-						  uint8_t blockAddr) {
-
+static int sessionAuthenticate(MFRC522Ptr_t mfrc522, uint8_t blockAddr) {
 	MIFARE_Key key;
-	int i;
-	// using FFFFFFFFFFFF which is the default at chip delivery from the factory
-	for (i = 0; i < 6; i++) {
-		key.keybyte[i] = 0xFF;
-	}
+	uint8_t sector = blockSector(blockAddr);
 
+	// MFCrypto1On (Status2Reg bit 3) is cleared by PCD_StopCrypto1(), so a
+	// card halted elsewhere or selected again always authenticates
+	if (sessionSector == sector && sameUid(&sessionUid, &(mfrc522->uid)) &&
+		(PCD_ReadRegister(mfrc522, Status2Reg) & 0x08)) {
+		return 0;
+	}
+	cardKey(&(mfrc522->uid), &key);
 	// Authenticate using key A
 	status = (StatusCode)PCD_Authenticate(mfrc522, PICC_CMD_MF_AUTH_KEY_A,
 										  blockAddr, &key, &(mfrc522->uid));
 	if (status != STATUS_OK) {
+		sessionSector = -1;
 		UartSendString(UART_PC,"PCD_Authenticate() failed: ");
 		UartSendString(UART_PC,GetStatusCodeName(status));
 		return -1;
 	}
-
-	// Write data from the block, always write 16 bytes
-	status = (StatusCode)MIFARE_Write(mfrc522, blockAddr, auxBuffer, 16);
-	if (status != STATUS_OK) {
-		UartSendString(UART_PC,"MIFARE_Write() failed: ");
-		UartSendString(UART_PC,GetStatusCodeName(status));
-		return -2;
-	}
-
-	// Halt PICC
-    PICC_HaltA(mfrc522);
-    // Stop encryption on PCD
-    PCD_StopCrypto1(mfrc522);
-
+	sessionUid = mfrc522->uid;
+	sessionSector = sector;
 	return 0;
 }
 
@@ -132,6 +128,84 @@ void setupRFID(MFRC522Ptr_t* mfrc522) {
 	PCD_DumpVersionToSerial(*mfrc522); 
 }
 
+int rfidSetCardKey(const Uid *uid, const MIFARE_Key *key) {
+	int i;
+	for (i = 0; i < RFID_KEY_CACHE_LEN; i++) {
+		if (keyCache[i].used && sameUid(&keyCache[i].uid, uid)) {
+			break;
+		}
+	}
+	if (i == RFID_KEY_CACHE_LEN) {
+		i = keyCacheNext;
+		keyCacheNext = (keyCacheNext + 1) % RFID_KEY_CACHE_LEN;
+	}
+	keyCache[i].uid = *uid;
+	keyCache[i].key = *key;
+	keyCache[i].used = true;
+	// A new key invalidates the session on that card
+	if (sameUid(&sessionUid, uid)) {
+		sessionSector = -1;
+	}
+	return 0;
+}
+
+int rfidReadBlocks(MFRC522Ptr_t mfrc522, uint8_t blockAddr, uint8_t count,
+				   uint8_t *buffer) {
+	uint8_t block[BLOCK_READ_SIZE];
+	uint8_t size;
+
+	for (; count > 0; count--, blockAddr++, buffer += RFID_BLOCK_SIZE) {
+		if (sessionAuthenticate(mfrc522, blockAddr) != 0) {
+			return -1;
+		}
+		size = sizeof(block);
+		status = (StatusCode)MIFARE_Read(mfrc522, blockAddr, block, &size);
+		if (status != STATUS_OK) {
+			sessionSector = -1;
+			UartSendString(UART_PC,"MIFARE_Read() failed: ");
+			UartSendString(UART_PC,GetStatusCodeName(status));
+			return -2;
+		}
+		memcpy(buffer, block, RFID_BLOCK_SIZE);
+	}
+	return 0;
+}
+
+int rfidWriteBlocks(MFRC522Ptr_t mfrc522, uint8_t blockAddr, uint8_t count,
+					const uint8_t *buffer) {
+	uint8_t block[RFID_BLOCK_SIZE];
+
+	for (; count > 0; count--, blockAddr++, buffer += RFID_BLOCK_SIZE) {
+		// Sector trailers hold the keys and access bits, a wrong write locks
+		// the sector forever
+		if (isSectorTrailer(blockAddr)) {
+			return -3;
+		}
+		if (sessionAuthenticate(mfrc522, blockAddr) != 0) {
+			return -1;
+		}
+		// Write data from the block, always write 16 bytes
+		memcpy(block, buffer, RFID_BLOCK_SIZE);
+		status = (StatusCode)MIFARE_Write(mfrc522, blockAddr, block,
+										  RFID_BLOCK_SIZE);
+		if (status != STATUS_OK) {
+			sessionSector = -1;
+			UartSendString(UART_PC,"MIFARE_Write() failed: ");
+			UartSendString(UART_PC,GetStatusCodeName(status));
+			return -2;
+		}
+	}
+	return 0;
+}
+
+void rfidSessionClose(MFRC522Ptr_t mfrc522) {
+	// Halt PICC
+	PICC_HaltA(mfrc522);
+	// Stop encryption on PCD
+	PCD_StopCrypto1(mfrc522);
+	sessionSector = -1;
+}
+
 /**
  * Function to read the balance, the balance is stored in the block 4 (sector
  * 1), the first 4 bytes
@@ -140,14 +214,15 @@ void setupRFID(MFRC522Ptr_t* mfrc522) {
  */
 int readCardBalance(MFRC522Ptr_t mfrc522) {
 
+	uint8_t block[RFID_BLOCK_SIZE];
 	int balance;
 
-	int readStatus = readCardBlock(mfrc522, 1, 4);
+	int readStatus = rfidReadBlocks(mfrc522, 4, 1, block);
 
 	if (readStatus == 0) {
 		// convert the balance bytes to an integer, byte[0] is the MSB
-		balance = (int)auxBuffer[3] | (int)(auxBuffer[2] << 8) |
-				  (int)(auxBuffer[1] << 16) | (int)(auxBuffer[0] << 24);
+		balance = (int)block[3] | (int)(block[2] << 8) |
+				  (int)(block[1] << 16) | (int)(block[0] << 24);
 	} else {
 		balance = -999;
 	}
@@ -164,17 +239,16 @@ int readCardBalance(MFRC522Ptr_t mfrc522) {
  */
 int writeCardBalance(MFRC522Ptr_t mfrc522, int newBalance) {
 
-	// set the 16 bytes auxBuffer, auxBuffer[0] is the MSB
-	auxBuffer[0] = newBalance >> 24;
-	auxBuffer[1] = newBalance >> 16;
-	auxBuffer[2] = newBalance >> 8;
-	auxBuffer[3] = newBalance & 0x000000FF;
-	int i;
-	for (i = 4; i < size; i++) {
-		auxBuffer[i] = 0xBB;
-	}
+	uint8_t block[RFID_BLOCK_SIZE];
+
+	// set the 16 bytes block, block[0] is the MSB
+	block[0] = newBalance >> 24;
+	block[1] = newBalance >> 16;
+	block[2] = newBalance >> 8;
+	block[3] = newBalance & 0x000000FF;
+	memset(&block[4], 0xBB, RFID_BLOCK_SIZE - 4);
 
-	int writeStatus = writeCardBlock(mfrc522, 1, 4);
+	int writeStatus = rfidWriteBlocks(mfrc522, 4, 1, block);
 
 	return writeStatus;
 }
@@ -0,0 +1,88 @@
+/**
+ * @file sensor.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sensor.h"
+#include <string.h>
+#include "esp_attr.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const uint8_t value_size[] = {
+	[SENSOR_INT16] = 2,
+	[SENSOR_UINT16] = 2,
+	[SENSOR_INT32] = 4,
+	[SENSOR_UINT32] = 4,
+	[SENSOR_FLOAT] = 4,
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+size_t SensorSampleSize(const sensor_format_t *format){
+	return (size_t)value_size[format->type] * format->channels;
+}
+
+void SensorQueueOpen(sensor_queue_t *queue, const sensor_t *sensor, sensor_ready_cb_t ready, void *param){
+	__atomic_store_n(&queue->ready, NULL, __ATOMIC_RELEASE);
+	queue->tail = queue->head;
+	queue->dropped = 0;
+	queue->sensor = sensor;
+	queue->param = param;
+	__atomic_store_n(&queue->ready, ready, __ATOMIC_RELEASE);
+}
+
+void SensorQueueClose(sensor_queue_t *queue){
+	__atomic_store_n(&queue->ready, NULL, __ATOMIC_RELEASE);
+}
+
+bool IRAM_ATTR SensorQueuePush(sensor_queue_t *queue, const void *sample, bool notify){
+	sensor_ready_cb_t ready = __atomic_load_n(&queue->ready, __ATOMIC_ACQUIRE);
+	uint32_t head = queue->head;
+
+	if(ready == NULL){
+		return false;
+	}
+	if(head - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) > queue->mask){
+		queue->dropped++;
+	}else{
+		memcpy(&queue->data[(head & queue->mask) * queue->sample_size], sample, queue->sample_size);
+		__atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+	}
+	// also when full: the consumer is late, remind it
+	if(notify){
+		ready(queue->sensor, queue->param);
+	}
+	return head != queue->head;
+}
+
+uint16_t SensorQueueReadBlock(const sensor_t *sensor, void *samples, uint16_t max_samples){
+	sensor_queue_t *queue = sensor->queue;
+	uint32_t tail = queue->tail;
+	uint32_t n = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) - tail;
+	uint8_t *out = samples;
+
+	if(n > max_samples){
+		n = max_samples;
+	}
+	for(uint32_t i = 0; i < n; i++){
+		memcpy(&out[i * queue->sample_size], &queue->data[((tail + i) & queue->mask) * queue->sample_size], queue->sample_size);
+	}
+	__atomic_store_n(&queue->tail, tail + n, __ATOMIC_RELEASE);
+	return n;
+}
+
+/*==================[end of file]============================================*/
@@ -6,10 +6,9 @@
 #define SERVO_FREQ 	50
 #define MIN_ANG		-90
 #define MAX_ANG		90
-#define ANG_RANGE	180.0
-#define PERIOD_MS   20.0
-#define PULSEW_MS   1.0
-#define PERCENT   	100.0
+#define PERIOD_MS   20.0f
+#define CENTER_MS	1.5f	/*!< Pulse width at 0 degrees */
+#define MS_PER_DEG	(1.0f / 90.0f)	/*!< Pulse width change per degree (angle x 2 for the available servos) */
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -19,14 +18,21 @@
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-uint8_t Angle2DutyCicle(int8_t angle){
-	static float h_time;
-	static float duty_cicle;
-	static int16_t deg;
-	deg = 2 * angle + MAX_ANG;	// NOTE: adjusted (angle x 2) for the available servos
-	h_time = (float)(deg/ANG_RANGE) + PULSEW_MS;
-	duty_cicle = (float)(h_time/PERIOD_MS) * PERCENT;
-	return (uint8_t) duty_cicle;
+/* Duty with the full PWM resolution (about 0.02 ms steps, instead of 0.2 ms of
+ * the percentage) */
+static uint16_t Angle2Duty(int8_t angle){
+	if(angle < MIN_ANG){
+		angle = MIN_ANG;
+	} else if(angle > MAX_ANG){
+		angle = MAX_ANG;
+	}
+	float h_time = CENTER_MS + angle * MS_PER_DEG;
+	return (uint16_t)((h_time / PERIOD_MS) * PWM_DUTY_MAX + 0.5f);
+}
+
+/* SERVO_n uses PWM_n */
+static inline pwm_out_t Servo2Pwm(servo_out_t servo){
+	return (pwm_out_t)servo;
 }
 /*==================[external functions definition]==========================*/
 
@@ -49,27 +55,23 @@ uint8_t ServoInit(servo_out_t servo, gpio_t gpio){
 }
 
 void ServoMove(servo_out_t servo, int8_t ang){
-	static uint8_t dc;
-	if(ang < MIN_ANG){
-		ang = MIN_ANG;
-	} else if(ang > MAX_ANG){
-		ang = MAX_ANG;
-	}
-	dc = Angle2DutyCicle(ang);
-	switch(servo){
-		case SERVO_0:
-			PWMSetDutyCycle(PWM_0, dc);
-			break;
-		case SERVO_1:
-			PWMSetDutyCycle(PWM_1, dc);
-			break;
-		case SERVO_2:
-			PWMSetDutyCycle(PWM_2, dc);
-			break;
-		case SERVO_3:
-			PWMSetDutyCycle(PWM_3, dc);
-			break;
-	}
+	PWMSetDuty(Servo2Pwm(servo), Angle2Duty(ang));
+}
+
+void ServoMoveRamp(servo_out_t servo, int8_t ang, uint32_t time_ms){
+	PWMFade(Servo2Pwm(servo), Angle2Duty(ang), time_ms, NULL, NULL);
+}
+
+uint16_t ServoAngleToDuty(int8_t ang){
+	return Angle2Duty(ang);
+}
+
+void ServoSetDuty(servo_out_t servo, uint16_t duty){
+	PWMSetDuty(Servo2Pwm(servo), duty);
+}
+
+uint16_t ServoGetDuty(servo_out_t servo){
+	return PWMGetDuty(Servo2Pwm(servo));
 }
 
 /*==================[end of file]============================================*/
@@ -57,9 +57,14 @@
 *******************************************************************************
 */
 
+#include <string.h>
 #include "spo2_algorithm.h"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
+#define RATIO_SORT_SIZE 5   // ratios sorted by maxim_sort5() (batch and streaming)
+#define CSWAP(a,b) { int32_t n_t = MIN(a,b); (b) = ((a)<(b))?(b):(a); (a) = n_t; }   // compare-exchange
+
+_Static_assert(STREAM_RATIO_SIZE <= RATIO_SORT_SIZE, "The ratio median is a 5 input sorting network");
 
 const uint8_t uch_spo2_table[184]={ 95, 95, 95, 96, 96, 96, 97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 99, 99, 99, 99,
               99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
@@ -72,6 +77,55 @@ const uint8_t uch_spo2_table[184]={ 95, 95, 95, 96, 96, 96, 97, 97, 97, 97, 97,
               28, 27, 26, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 7, 6, 5,
               3, 2, 1 } ;
 
+static int32_t maxim_ratio(int64_t n_nume, int64_t n_denom)
+/**
+* \brief        AC/DC ratio x100 with a single 32 bit division
+* \par          Details
+*               Numerator and denominator are shifted right together until both fit in 24 bits, so that
+*               n_nume*100 fits in 32 bits and no 64 bit division (a library call on RV32) is needed.
+*               Ratios inside uch_spo2_table[] keep a denominator of at least 23 bits: the result differs
+*               from (n_nume*100)/n_denom by one unit at most.
+*
+* \param[in]    n_nume                  - ( n_y_ac *n_x_dc_max)
+* \param[in]    n_denom                 - ( n_x_ac *n_y_dc_max), > 0
+*
+* \retval       Ratio x100, INT32_MAX/INT32_MIN when the shifted denominator is 0 (far out of the table)
+*/
+{
+  uint64_t un_mag = (uint64_t)((n_nume < 0) ? -n_nume : n_nume) | (uint64_t)n_denom;
+  int32_t n_shift = 40 - __builtin_clzll(un_mag);   // significant bits above 24
+
+  if (n_shift > 0){
+    n_nume >>= n_shift;
+    n_denom >>= n_shift;
+  }
+  if (n_denom == 0)
+    return (n_nume < 0) ? INT32_MIN : INT32_MAX;
+  return ((int32_t)n_nume*100)/(int32_t)n_denom;
+}
+
+static void maxim_sort5(int32_t *pn_x, int32_t n_size)
+/**
+* \brief        Sort up to RATIO_SORT_SIZE values in ascending order
+* \par          Details
+*               Fixed 9 compare-exchange network, without branches on the data. The unused entries are padded
+*               with INT32_MAX so the n_size values end up first.
+*
+* \param[in,out]  *pn_x                 - RATIO_SORT_SIZE entries, n_size of them used
+* \param[in]      n_size                - Values to sort
+*
+* \retval       None
+*/
+{
+  int32_t k;
+
+  for (k=n_size; k<RATIO_SORT_SIZE; k++)
+    pn_x[k] = INT32_MAX;
+  CSWAP(pn_x[0], pn_x[1]); CSWAP(pn_x[3], pn_x[4]); CSWAP(pn_x[2], pn_x[4]);
+  CSWAP(pn_x[2], pn_x[3]); CSWAP(pn_x[0], pn_x[3]); CSWAP(pn_x[0], pn_x[2]);
+  CSWAP(pn_x[1], pn_x[4]); CSWAP(pn_x[1], pn_x[3]); CSWAP(pn_x[1], pn_x[2]);
+}
+
 void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_ir_buffer_length, uint32_t *pun_red_buffer, int32_t *pn_spo2, int8_t *pch_spo2_valid,
                 int32_t *pn_heart_rate, int8_t *pch_hr_valid)
 /**
@@ -104,7 +158,7 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
   int32_t n_y_dc_max, n_x_dc_max;
   int32_t n_y_dc_max_idx = 0;
   int32_t n_x_dc_max_idx = 0;
-  int32_t an_ratio[5], n_ratio_average;
+  int32_t an_ratio[RATIO_SORT_SIZE], n_ratio_average;
   int32_t n_nume, n_denom ;
 
   // calculates DC mean and subtract DC from ir
@@ -184,15 +238,15 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
       n_x_ac=  an_x[n_y_dc_max_idx] - n_x_ac;      // subracting linear DC compoenents from raw
       n_nume=( n_y_ac *n_x_dc_max)>>7 ; //prepare X100 to preserve floating value
       n_denom= ( n_x_ac *n_y_dc_max)>>7;
-      if (n_denom>0  && n_i_ratio_count <5 &&  n_nume != 0)
+      if (n_denom>0  && n_i_ratio_count <RATIO_SORT_SIZE &&  n_nume != 0)
       {
-        an_ratio[n_i_ratio_count]= (n_nume*100)/n_denom ; //formular is ( n_y_ac *n_x_dc_max) / ( n_x_ac *n_y_dc_max) ;
+        an_ratio[n_i_ratio_count]= maxim_ratio(n_nume, n_denom) ; //formular is ( n_y_ac *n_x_dc_max) / ( n_x_ac *n_y_dc_max) ;
         n_i_ratio_count++;
       }
     }
   }
   // choose median value since PPG signal may varies from beat to beat
-  maxim_sort_ascend(an_ratio, n_i_ratio_count);
+  maxim_sort5(an_ratio, n_i_ratio_count);
   n_middle_idx= n_i_ratio_count/2;
 
   if (n_middle_idx >1)
@@ -212,6 +266,222 @@ void maxim_heart_rate_and_oxygen_saturation(uint32_t *pun_ir_buffer, int32_t n_i
 }
 
 
+void maxim_stream_init(maxim_stream_t *ps, int32_t n_fs)
+/**
+* \brief        Initialize the streaming heart rate and SpO2 estimator
+* \par          Details
+*               Clears the estimator state. DC level and peak threshold are averaged over about one second,
+*               the minimum valley distance is scaled from the batch algorithm (4 samples at FreqS).
+*               The SpO2 ratio is the median of the last STREAM_RATIO_SIZE beats, sorted once per beat.
+*
+* \param[out]   *ps                     - Estimator state
+* \param[in]    n_fs                    - Sampling frequency of the samples passed to maxim_stream_update()
+*
+* \retval       None
+*/
+{
+  memset(ps, 0, sizeof(maxim_stream_t));
+  ps->n_fs = n_fs;
+  ps->n_min_distance = (4*n_fs)/FreqS;
+  if (ps->n_min_distance < 4) ps->n_min_distance = 4;
+  while ((1 << ps->uch_dc_shift) < n_fs) ps->uch_dc_shift++;
+  ps->n_spo2 = -999;
+  ps->n_heart_rate = -999;
+}
+
+static void maxim_stream_beat(maxim_stream_t *ps)
+/**
+* \brief        Process a confirmed valley
+* \par          Details
+*               Updates the heart rate with the interval from the previous valley and the SpO2 with the
+*               AC/DC ratio of the cycle between both valleys (same formula as the batch algorithm).
+*
+* \retval       None
+*/
+{
+  int32_t n_interval, n_ratio_average;
+  int32_t n_y_ac, n_x_ac;
+  int32_t an_ratio[RATIO_SORT_SIZE];
+  int64_t n_nume, n_denom;
+
+  if (ps->b_valley){
+    n_interval = ps->n_cand_t - ps->n_valley_t;
+    if (n_interval > 2*ps->n_fs){
+      // longer than 2 s (under 30 bpm): signal was lost, restart averages
+      ps->n_interval_sum = 0;
+      ps->uch_interval_count = 0;
+      ps->uch_interval_idx = 0;
+      ps->uch_ratio_count = 0;
+    }
+    else{
+      // heart rate from the average of the last beat intervals
+      if (ps->uch_interval_count == STREAM_HR_SIZE)
+        ps->n_interval_sum -= ps->an_interval[ps->uch_interval_idx];
+      else
+        ps->uch_interval_count++;
+      ps->an_interval[ps->uch_interval_idx] = n_interval;
+      ps->n_interval_sum += n_interval;
+      ps->uch_interval_idx = (ps->uch_interval_idx + 1) % STREAM_HR_SIZE;
+
+      // subtract linear DC components between valleys from the maxima
+      n_y_ac = (ps->n_cand_red - ps->n_valley_red)*(ps->n_red_max_t - ps->n_valley_t); //red
+      n_y_ac = ps->n_valley_red + n_y_ac/n_interval;
+      n_y_ac = ps->n_red_max - n_y_ac;
+      n_x_ac = (ps->n_cand_ir - ps->n_valley_ir)*(ps->n_ir_max_t - ps->n_valley_t); // ir
+      n_x_ac = ps->n_valley_ir + n_x_ac/n_interval;
+      n_x_ac = ps->n_ir_max - n_x_ac;
+      n_nume = ((int64_t)n_y_ac*ps->n_ir_max)>>7;
+      n_denom = ((int64_t)n_x_ac*ps->n_red_max)>>7;
+      if (n_interval > 3 && n_denom > 0 && n_nume != 0){
+        ps->an_ratio[ps->uch_ratio_idx] = maxim_ratio(n_nume, n_denom);
+        ps->uch_ratio_idx = (ps->uch_ratio_idx + 1) % STREAM_RATIO_SIZE;
+        if (ps->uch_ratio_count < STREAM_RATIO_SIZE) ps->uch_ratio_count++;
+      }
+    }
+    if (ps->uch_interval_count > 0){
+      ps->n_heart_rate = (ps->n_fs*60*ps->uch_interval_count)/ps->n_interval_sum;
+      ps->ch_hr_valid = 1;
+    }
+    else{
+      ps->n_heart_rate = -999;
+      ps->ch_hr_valid = 0;
+    }
+
+    // median of the last ratios: one sorting network per beat
+    if (ps->uch_ratio_count > 0){
+      memcpy(an_ratio, ps->an_ratio, ps->uch_ratio_count*sizeof(int32_t));
+      maxim_sort5(an_ratio, ps->uch_ratio_count);
+      n_ratio_average = an_ratio[ps->uch_ratio_count/2];
+    }
+    else
+      n_ratio_average = 0;
+    if (n_ratio_average>2 && n_ratio_average <184){
+      ps->n_spo2 = uch_spo2_table[n_ratio_average];
+      ps->ch_spo2_valid = 1;
+    }
+    else{
+      ps->n_spo2 = -999;
+      ps->ch_spo2_valid = 0;
+    }
+  }
+  // the candidate becomes the start of the next cycle
+  ps->b_valley = true;
+  ps->n_valley_t = ps->n_cand_t;
+  ps->n_valley_ir = ps->n_cand_ir;
+  ps->n_valley_red = ps->n_cand_red;
+  ps->n_ir_max = ps->n_ir_next_max;
+  ps->n_ir_max_t = ps->n_ir_next_max_t;
+  ps->n_red_max = ps->n_red_next_max;
+  ps->n_red_max_t = ps->n_red_next_max_t;
+  ps->b_cand = false;
+}
+
+bool maxim_stream_update(maxim_stream_t *ps, uint32_t un_ir, uint32_t un_red, int32_t *pn_spo2, int8_t *pch_spo2_valid,
+                int32_t *pn_heart_rate, int8_t *pch_hr_valid)
+/**
+* \brief        Add a sample to the streaming heart rate and SpO2 estimator
+* \par          Details
+*               Constant time per sample: DC and threshold are exponential averages, the moving average is a
+*               running sum and only the current valley candidate and the cycle maxima are kept.
+*               A new heart rate/SpO2 value is calculated at every beat, n_min_distance samples after its IR valley.
+*
+* \param[in,out] *ps                    - Estimator state
+* \param[in]    un_ir                   - IR sample
+* \param[in]    un_red                  - Red sample
+* \param[out]   *pn_spo2                - Last SpO2 value
+* \param[out]   *pch_spo2_valid         - 1 if the SpO2 value is valid
+* \param[out]   *pn_heart_rate          - Last heart rate value
+* \param[out]   *pch_hr_valid           - 1 if the heart rate value is valid
+*
+* \retval       true if a beat was detected and the values were updated
+*/
+{
+  int32_t n_ir, n_red, n_x, n_th;
+  bool b_beat = false;
+
+  // 4 pt moving average
+  if (ps->n_t == 0){
+    ps->n_ir_dc = (int32_t)un_ir << 8;
+    for (ps->uch_ma_idx=0; ps->uch_ma_idx< MA4_SIZE; ps->uch_ma_idx++){
+      ps->aun_ir_ma[ps->uch_ma_idx] = un_ir;
+      ps->aun_red_ma[ps->uch_ma_idx] = un_red;
+    }
+    ps->un_ir_sum = un_ir*MA4_SIZE;
+    ps->un_red_sum = un_red*MA4_SIZE;
+    ps->uch_ma_idx = 0;
+  }
+  ps->uch_ma_idx = (ps->uch_ma_idx + 1) % MA4_SIZE;
+  ps->un_ir_sum += un_ir - ps->aun_ir_ma[ps->uch_ma_idx];
+  ps->un_red_sum += un_red - ps->aun_red_ma[ps->uch_ma_idx];
+  ps->aun_ir_ma[ps->uch_ma_idx] = un_ir;
+  ps->aun_red_ma[ps->uch_ma_idx] = un_red;
+  n_ir = ps->un_ir_sum/MA4_SIZE;
+  n_red = ps->un_red_sum/MA4_SIZE;
+
+  // remove DC and invert signal so that we can use peak detector as valley detector
+  ps->n_ir_dc += (((int32_t)un_ir << 8) - ps->n_ir_dc) >> ps->uch_dc_shift;
+  n_x = (ps->n_ir_dc >> 8) - n_ir;
+  ps->n_th += (n_x*256 - ps->n_th) >> ps->uch_dc_shift;
+  n_th = ps->n_th >> 8;
+  if( n_th<30) n_th=30; // min allowed
+  if( n_th>60) n_th=60; // max allowed
+
+  if (ps->n_t < MA4_SIZE){
+    // moving average not filled yet
+    ps->n_ir_max = ps->n_ir_next_max = n_ir;
+    ps->n_red_max = ps->n_red_next_max = n_red;
+    ps->n_ir_max_t = ps->n_ir_next_max_t = ps->n_red_max_t = ps->n_red_next_max_t = ps->n_t;
+  }
+  else{
+    if (n_x < ps->n_x_prev && ps->b_rising && ps->n_x_prev > n_th){
+      // previous sample is a valley: keep the largest one within n_min_distance
+      if (!ps->b_cand || ps->n_x_prev > ps->n_cand_x){
+        if (ps->b_cand){
+          // the old candidate is dropped, its samples go back to the current cycle
+          if (ps->n_ir_next_max > ps->n_ir_max) { ps->n_ir_max = ps->n_ir_next_max; ps->n_ir_max_t = ps->n_ir_next_max_t; }
+          if (ps->n_red_next_max > ps->n_red_max) { ps->n_red_max = ps->n_red_next_max; ps->n_red_max_t = ps->n_red_next_max_t; }
+        }
+        ps->b_cand = true;
+        ps->n_cand_t = ps->n_t - 1;
+        ps->n_cand_x = ps->n_x_prev;
+        ps->n_cand_ir = ps->n_ir_prev;
+        ps->n_cand_red = ps->n_red_prev;
+        ps->n_ir_next_max = ps->n_ir_prev;
+        ps->n_ir_next_max_t = ps->n_t - 1;
+        ps->n_red_next_max = ps->n_red_prev;
+        ps->n_red_next_max_t = ps->n_t - 1;
+      }
+    }
+    if (n_x > ps->n_x_prev) ps->b_rising = true;
+    else if (n_x < ps->n_x_prev) ps->b_rising = false;    // flat peaks keep the left edge
+
+    // cycle maxima
+    if (ps->b_cand){
+      if (n_ir > ps->n_ir_next_max) { ps->n_ir_next_max = n_ir; ps->n_ir_next_max_t = ps->n_t; }
+      if (n_red > ps->n_red_next_max) { ps->n_red_next_max = n_red; ps->n_red_next_max_t = ps->n_t; }
+      if (ps->n_t - ps->n_cand_t >= ps->n_min_distance){
+        maxim_stream_beat(ps);
+        b_beat = true;
+      }
+    }
+    else{
+      if (n_ir > ps->n_ir_max) { ps->n_ir_max = n_ir; ps->n_ir_max_t = ps->n_t; }
+      if (n_red > ps->n_red_max) { ps->n_red_max = n_red; ps->n_red_max_t = ps->n_t; }
+    }
+  }
+  ps->n_x_prev = n_x;
+  ps->n_ir_prev = n_ir;
+  ps->n_red_prev = n_red;
+  ps->n_t++;
+
+  *pn_spo2 = ps->n_spo2;
+  *pch_spo2_valid = ps->ch_spo2_valid;
+  *pn_heart_rate = ps->n_heart_rate;
+  *pch_hr_valid = ps->ch_hr_valid;
+  return b_beat;
+}
+
+
 void maxim_find_peaks( int32_t *pn_locs, int32_t *n_npks,  int32_t  *pn_x, int32_t n_size, int32_t n_min_height, int32_t n_min_distance, int32_t n_max_num )
 /**
 * \brief        Find peaks
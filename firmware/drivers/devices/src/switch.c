@@ -12,18 +12,153 @@
 /*==================[inclusions]=============================================*/
 #include "switch.h"
 #include "gpio_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "timestamp_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_SWITCH1 GPIO_4
 #define GPIO_SWITCH2 GPIO_15
+#define SWITCH_QTY			2
+#define SWITCH_TASK_STACK	2048
+#define SWITCH_TASK_PRIO	6		/*!< Above the application tasks, events are short */
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief Debounce state of a switch
+ */
+typedef enum {
+	SW_UP,				/*!< Released, waiting for an edge */
+	SW_BOUNCE,			/*!< Edge seen, waiting SWITCH_DEBOUNCE_MS to confirm it */
+	SW_DOWN,			/*!< Press confirmed, sampled until released */
+} sw_state_t;
 
+typedef struct {
+	gpio_t pin;
+	switch_t sw;
+	sw_state_t state;
+	volatile bool edge;			/*!< Edge time taken (ISR), cleared when the switch is up again */
+	volatile int64_t edge_us;	/*!< Time of the first edge of the press */
+	int64_t release_us;			/*!< Time of the last release */
+	bool click;					/*!< Last press was short and not a double click: the next one can make one */
+	bool long_sent;				/*!< Long press event already sent */
+	uint8_t up_samples;			/*!< Consecutive samples released */
+} sw_debounce_t;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+static sw_debounce_t sw_debounce[SWITCH_QTY] = {
+	{.pin = GPIO_SWITCH1, .sw = SWITCH_1},
+	{.pin = GPIO_SWITCH2, .sw = SWITCH_2},
+};
+static TaskHandle_t switch_task_handle = NULL;
+static QueueHandle_t switch_queue = NULL;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Edge interrupt: only the timestamp, the debounce is done by the task
+ */
+static void SwitchEdgeIsr(void *param){
+	sw_debounce_t *d = param;
+	BaseType_t woken = pdFALSE;
+
+	if(!d->edge){
+		d->edge_us = TimestampUs();
+		d->edge = true;
+	}
+	xTaskNotifyFromISR(switch_task_handle, d->sw, eSetBits, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+static void SwitchEventSend(sw_debounce_t *d, switch_event_type_t type){
+	switch_event_t event = {
+		.sw = d->sw,
+		.type = type,
+		.time_ms = d->edge_us / 1000,
+	};
+	xQueueSend(switch_queue, &event, 0);
+}
+
+/**
+ * @brief Advance the debounce of a switch, one sample
+ * @return true The switch needs more samples
+ */
+static bool SwitchDebounce(sw_debounce_t *d, int64_t now){
+	bool pressed = !GPIORead(d->pin);
+
+	switch(d->state){
+		case SW_UP:
+			if(!d->edge){
+				return false;
+			}
+			d->state = SW_BOUNCE;
+			/* fall through */
+		case SW_BOUNCE:
+			if(now - d->edge_us < SWITCH_DEBOUNCE_MS * 1000LL){
+				return true;
+			}
+			if(!pressed){
+				// Glitch: no press
+				d->state = SW_UP;
+				d->edge = false;
+				return false;
+			}
+			d->state = SW_DOWN;
+			d->long_sent = false;
+			d->up_samples = 0;
+			SwitchEventSend(d, SWITCH_EVENT_PRESS);
+			if(d->click && d->edge_us - d->release_us <= SWITCH_DOUBLE_CLICK_MS * 1000LL){
+				SwitchEventSend(d, SWITCH_EVENT_DOUBLE_CLICK);
+				d->click = false;
+			} else{
+				d->click = true;
+			}
+			return true;
+		case SW_DOWN:
+			if(pressed){
+				d->up_samples = 0;
+				if(!d->long_sent && now - d->edge_us >= SWITCH_LONG_PRESS_MS * 1000LL){
+					SwitchEventSend(d, SWITCH_EVENT_LONG_PRESS);
+					d->long_sent = true;
+				}
+				return true;
+			}
+			if(++d->up_samples * SWITCH_POLL_MS < SWITCH_DEBOUNCE_MS){
+				return true;
+			}
+			/* Released: only a short press can start a double click */
+			if(d->long_sent){
+				d->click = false;
+			}
+			d->release_us = now;
+			d->state = SW_UP;
+			d->edge = false;
+			return false;
+	}
+	return false;
+}
+
+/**
+ * @brief Sleeps until an edge, then samples the switches every SWITCH_POLL_MS
+ * until all of them are up again
+ */
+static void SwitchTask(void *param){
+	uint8_t switches = (uintptr_t)param;
+	TickType_t wait = portMAX_DELAY;
+	uint32_t bits;
+	bool busy;
+
+	while(true){
+		xTaskNotifyWait(0, UINT32_MAX, &bits, wait);
+		busy = false;
+		for(uint8_t i = 0; i < SWITCH_QTY; i++){
+			if(switches & sw_debounce[i].sw){
+				busy |= SwitchDebounce(&sw_debounce[i], TimestampUs());
+			}
+		}
+		wait = busy ? pdMS_TO_TICKS(SWITCH_POLL_MS) : portMAX_DELAY;
+	}
+}
 
 /*==================[external functions definition]==========================*/
 int8_t SwitchesInit(void){
@@ -54,4 +189,34 @@ void SwitchActivInt(switch_t sw, void *ptr_int_func, void *args){
 		break;
 	}
 }
+
+bool SwitchEventsInit(uint8_t switches){
+	if(switch_queue == NULL){
+		switch_queue = xQueueCreate(SWITCH_EVENT_QUEUE, sizeof(switch_event_t));
+		if(switch_queue == NULL){
+			return false;
+		}
+	}
+	if(switch_task_handle == NULL){
+		if(xTaskCreate(SwitchTask, "Switch", SWITCH_TASK_STACK, (void *)(uintptr_t)switches,
+				SWITCH_TASK_PRIO, &switch_task_handle) != pdPASS){
+			return false;
+		}
+	}
+	for(uint8_t i = 0; i < SWITCH_QTY; i++){
+		if(switches & sw_debounce[i].sw){
+			GPIOActivInt(sw_debounce[i].pin, SwitchEdgeIsr, false, &sw_debounce[i]);
+		}
+	}
+	return true;
+}
+
+bool SwitchEventGet(switch_event_t *event, uint32_t timeout_ms){
+	TickType_t ticks = (timeout_ms == SWITCH_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+
+	if(switch_queue == NULL){
+		return false;
+	}
+	return xQueueReceive(switch_queue, event, ticks) == pdTRUE;
+}
 /*==================[end of file]============================================*/
@@ -16,12 +16,52 @@
 #include "freertos/task.h"
 #include "gpio_fast_out_mcu.h"
 #include "delay_mcu.h"
+#if WS2812B_RMT
+#include "driver/rmt_tx.h"
+#include "driver/rmt_encoder.h"
+#include "soc/soc_caps.h"
+#endif
 /*==================[macros and definitions]=================================*/
 #define RET_CMD (50)    // ret command 50us low
 #define BIT_0   (1)     // bit 0
 #define BIT_7   (1<<7)  // bit 0
+#define RED(c)          (((c) >> 16) & 0xFF)
+#define GREEN(c)        (((c) >> 8) & 0xFF)
+#define BLUE(c)         ((c) & 0xFF)
+#define BRIGHT(c, b)    (((c) * ((b) + 1)) >> 8)
+
+#if WS2812B_RMT
+#define RMT_RESOLUTION  10000000    // 0.1us ticks
+#define T0H             4           // bit 0: 0.4us high, 0.8us low
+#define T0L             8
+#define T1H             8           // bit 1: 0.8us high, 0.4us low
+#define T1L             4
+#define LED_SYMBOLS     24          // one symbol per bit
+#if SOC_RMT_SUPPORT_DMA
+#define RMT_DMA         true
+#define RMT_MEM_SYMBOLS 1024
+#else
+#define RMT_DMA         false       // refilled from the RMT interrupt (ping-pong)
+#define RMT_MEM_SYMBOLS SOC_RMT_MEM_WORDS_PER_CHANNEL
+#endif
+#endif
 /*==================[internal data declaration]==============================*/
 gpio_t pin_number;
+#if WS2812B_RMT
+typedef struct{
+    uint8_t bright;     /* brightness of the transfer */
+    bool ret;           /* ret command at the end of the transfer */
+    bool raw;           /* data already in wire format (3 bytes per led) */
+} ws2812b_tx_t;
+
+static rmt_channel_handle_t rmt_channel = NULL;
+static rmt_encoder_handle_t rmt_encoder = NULL;
+static ws2812b_tx_t tx;
+static uint32_t single_led;
+static const rmt_symbol_word_t symbol_bit0 = {.level0 = 1, .duration0 = T0H, .level1 = 0, .duration1 = T0L};
+static const rmt_symbol_word_t symbol_bit1 = {.level0 = 1, .duration0 = T1H, .level1 = 0, .duration1 = T1L};
+static const rmt_symbol_word_t symbol_ret = {.level0 = 0, .duration0 = RET_CMD*5, .level1 = 0, .duration1 = RET_CMD*5};
+#endif
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -47,6 +87,62 @@ static const uint8_t gamma_table[256] = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+uint8_t ws2812bGammaCorrection(uint8_t component){
+    return gamma_table[component];
+}
+
+#if WS2812B_RMT
+/* RMT encoder callback: converts as many leds as fit in the free symbols
+ * (24 symbols per led, G R B, MSB first) and ends with the ret command */
+static size_t ws2812bEncode(const void *data, size_t data_size, size_t symbols_written,
+    size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg){
+    const uint32_t *colors = (const uint32_t *)data;
+    ws2812b_tx_t *t = (ws2812b_tx_t *)arg;
+    size_t len = t->raw ? data_size / 3 : data_size / sizeof(uint32_t);
+    size_t led = symbols_written / LED_SYMBOLS;
+    size_t n = 0;
+    uint8_t bytes[3];
+    const uint8_t *wire;
+    while (led < len && symbols_free - n >= LED_SYMBOLS){
+        if (t->raw){
+            wire = (const uint8_t *)data + 3*led;
+        } else {
+            bytes[0] = ws2812bGammaCorrection(BRIGHT(GREEN(colors[led]), t->bright));
+            bytes[1] = ws2812bGammaCorrection(BRIGHT(RED(colors[led]), t->bright));
+            bytes[2] = ws2812bGammaCorrection(BRIGHT(BLUE(colors[led]), t->bright));
+            wire = bytes;
+        }
+        for (uint8_t b=0; b<3; b++){
+            for (uint8_t i=0; i<=7; i++){
+                symbols[n++] = (wire[b] & (BIT_7>>i)) ? symbol_bit1 : symbol_bit0;
+            }
+        }
+        led++;
+    }
+    if (led == len){
+        if (!t->ret){
+            *done = true;
+        } else if (symbols_free > n){
+            symbols[n++] = symbol_ret;
+            *done = true;
+        }
+    }
+    return n;
+}
+
+/* Starts an asynchronous transfer (previous one must be finished) */
+static void ws2812bTransmit(const void *data, size_t size, uint8_t bright, bool ret, bool raw){
+    rmt_transmit_config_t tx_config = {
+        .loop_count = 0,
+        .flags.eot_level = 0,
+    };
+    tx.bright = bright;
+    tx.ret = ret;
+    tx.raw = raw;
+    ESP_ERROR_CHECK(rmt_transmit(rmt_channel, rmt_encoder, data, size, &tx_config));
+}
+
+#else
 void IRAM_ATTR ws2812bSendHigh(gpio_t pin){
     GPIOFastWrite(1);
     //delay 0.8us
@@ -326,40 +422,75 @@ void IRAM_ATTR ws2812bSendLow(gpio_t pin){
     __asm__ __volatile__ ("nop");   // 94
 }
 
-uint8_t ws2812bGammaCorrection(uint8_t component){
-    return gamma_table[component];
-}
+#endif
 
 /*==================[external functions definition]==========================*/
-
+#if WS2812B_RMT
 void ws2812bInit(gpio_t pin){
     pin_number = pin;
-    GPIOFastInit(&pin, 1);
+    if (rmt_channel != NULL){
+        ws2812bWait();
+        rmt_disable(rmt_channel);
+        rmt_del_channel(rmt_channel);
+        rmt_del_encoder(rmt_encoder);
+    }
+    rmt_tx_channel_config_t channel_config = {
+        .gpio_num = pin,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = RMT_RESOLUTION,
+        .mem_block_symbols = RMT_MEM_SYMBOLS,
+        .trans_queue_depth = 1,
+        .flags.with_dma = RMT_DMA,
+    };
+    ESP_ERROR_CHECK(rmt_new_tx_channel(&channel_config, &rmt_channel));
+    rmt_simple_encoder_config_t encoder_config = {
+        .callback = ws2812bEncode,
+        .arg = &tx,
+        .min_chunk_size = LED_SYMBOLS,
+    };
+    ESP_ERROR_CHECK(rmt_new_simple_encoder(&encoder_config, &rmt_encoder));
+    ESP_ERROR_CHECK(rmt_enable(rmt_channel));
 }
 
 void ws2812bSend(rgb_led_t led_color){
-    uint8_t i;
-	// Blue
-	for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.green) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
-    }
-	// Red
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.red) & (BIT_7>>i)){
-            ws2812bSendHigh(pin_number);
-        }
-        else{
-            ws2812bSendLow(pin_number);
-        }
+    /* Single led without ret: the next one follows after a gap of a few
+     * microseconds, shorter than the ret command */
+    ws2812bWait();
+    single_led = (led_color.red << 16) | (led_color.green << 8) | led_color.blue;
+    ws2812bTransmit(&single_led, sizeof(single_led), 255, false, false);
+    ws2812bWait();
+}
+
+void ws2812bSendRet(void){
+    ws2812bWait();
+    DelayUs(RET_CMD);
+}
+
+void ws2812bSendArray(const uint32_t *colors, uint16_t len, uint8_t bright){
+    ws2812bWait();
+    ws2812bTransmit(colors, len * sizeof(uint32_t), bright, true, false);
+}
+
+void ws2812bSendFrame(const uint8_t *frame, uint16_t len){
+    ws2812bWait();
+    ws2812bTransmit(frame, len * 3, 0, true, true);
+}
+
+void ws2812bWait(void){
+    if (rmt_channel != NULL){
+        ESP_ERROR_CHECK(rmt_tx_wait_all_done(rmt_channel, -1));
     }
-	// Green
-    for(i=0; i<=7; i++){
-        if(ws2812bGammaCorrection(led_color.blue) & (BIT_7>>i)){
+}
+
+#else
+void ws2812bInit(gpio_t pin){
+    pin_number = pin;
+    GPIOFastInit(&pin, 1);
+}
+
+static void ws2812bSendByte(uint8_t byte){
+    for(uint8_t i=0; i<=7; i++){
+        if(byte & (BIT_7>>i)){
             ws2812bSendHigh(pin_number);
         }
         else{
@@ -368,9 +499,37 @@ void ws2812bSend(rgb_led_t led_color){
     }
 }
 
+void ws2812bSend(rgb_led_t led_color){
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.green));
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.red));
+    ws2812bSendByte(ws2812bGammaCorrection(led_color.blue));
+}
+
 void ws2812bSendRet(void){
     GPIOFastWrite(0);
     DelayUs(RET_CMD);
 }
 
+void ws2812bSendArray(const uint32_t *colors, uint16_t len, uint8_t bright){
+    rgb_led_t led;
+    for (uint16_t i = 0; i < len; i++){
+        led.red = BRIGHT(RED(colors[i]), bright);
+        led.green = BRIGHT(GREEN(colors[i]), bright);
+        led.blue = BRIGHT(BLUE(colors[i]), bright);
+        ws2812bSend(led);
+    }
+    ws2812bSendRet();
+}
+
+void ws2812bSendFrame(const uint8_t *frame, uint16_t len){
+    for (uint16_t i = 0; i < 3*len; i++){
+        ws2812bSendByte(frame[i]);
+    }
+    ws2812bSendRet();
+}
+
+void ws2812bWait(void){
+}
+#endif
+
 /*==================[end of file]============================================*/
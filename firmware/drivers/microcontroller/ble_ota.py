@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 21:00:00 2026
+
+@author: Albano Peñalva
+
+Actualización del firmware por BLE (ble_ota_mcu.h, CONFIG_DRIVERS_BLE_OTA).
+Envía la imagen (build/<proyecto>.bin) a la siguiente partición OTA del
+dispositivo:
+
+    1. BEGIN con el tamaño de la imagen; la respuesta trae la ventana inicial
+       (bytes que se pueden enviar sin esperar) y el tamaño máximo de cada
+       escritura (MTU - 3).
+    2. Escrituras sin respuesta en la característica de datos, una tras otra,
+       hasta el límite de crédito. Cada vez que el dispositivo graba un buffer
+       notifica un crédito nuevo (límite y bytes grabados) y el envío sigue.
+    3. END: el dispositivo verifica la imagen, la elige para el próximo
+       arranque y se reinicia.
+
+Uso:
+    python ble_ota.py ESP_EDU_1 build/proyecto.bin
+
+Requiere bleak. Imprime el avance y, al final, la velocidad de la transferencia.
+"""
+
+# Librerías
+import argparse
+import asyncio
+import struct
+import sys
+import time
+
+from bleak import BleakClient, BleakScanner
+
+CONTROL = '0000ffe3-0000-1000-8000-00805f9b34fb'   # comandos y notificaciones
+DATOS = '0000ffe4-0000-1000-8000-00805f9b34fb'     # imagen (escritura sin respuesta)
+CMD_BEGIN = 0x01
+CMD_END = 0x02
+CMD_ABORT = 0x03
+CREDITO = 0x04
+ERROR = 0x05
+ESTADOS = ['OK', 'fuera de orden', 'partición', 'tamaño', 'crédito excedido',
+           'escritura', 'imagen inválida', 'desconexión']
+ESPERA_S = 10       # máximo sin respuesta del dispositivo (borrado y verificación incluidos)
+
+
+class Actualizacion:
+    """Lleva el límite de crédito y las respuestas de los comandos."""
+
+    def __init__(self):
+        self.limite = 0
+        self.grabados = 0
+        self.credito = asyncio.Event()
+        self.respuestas = asyncio.Queue()
+        self.error = None
+
+    def notificacion(self, _, datos):
+        datos = bytes(datos)
+        if datos[0] == CREDITO:
+            self.limite, self.grabados = struct.unpack_from('<II', datos, 1)
+            self.credito.set()
+        elif datos[0] == ERROR:
+            self.error = datos[1]
+            self.credito.set()
+        else:
+            self.respuestas.put_nowait(datos)
+
+    async def respuesta(self, comando):
+        datos = await asyncio.wait_for(self.respuestas.get(), ESPERA_S)
+        if datos[0] != comando:
+            sys.exit(f'respuesta inesperada {datos.hex()}')
+        if datos[1] != 0:
+            sys.exit(f'el dispositivo rechazó el comando: {ESTADOS[datos[1]]}')
+        return datos
+
+
+async def actualizar(nombre, imagen):
+    dispositivo = await BleakScanner.find_device_by_name(nombre)
+    if dispositivo is None:
+        sys.exit(f'no se encontró {nombre}')
+    async with BleakClient(dispositivo) as cliente:
+        act = Actualizacion()
+        await cliente.start_notify(CONTROL, act.notificacion)
+        await cliente.write_gatt_char(CONTROL, struct.pack('<BI', CMD_BEGIN, len(imagen)), response=True)
+        _, _, ventana, bloque = struct.unpack('<BBHH', await act.respuesta(CMD_BEGIN))
+        act.limite = ventana
+        print(f'{len(imagen)} bytes, ventana {ventana}, escrituras de {bloque} bytes')
+        inicio = time.monotonic()
+        enviados = 0
+        while enviados < len(imagen):
+            if act.error is not None:
+                sys.exit(f'actualización cancelada: {ESTADOS[act.error]}')
+            if enviados >= act.limite:
+                # sin crédito: espera a que el dispositivo grabe un buffer
+                act.credito.clear()
+                await asyncio.wait_for(act.credito.wait(), ESPERA_S)
+                continue
+            n = min(bloque, act.limite - enviados, len(imagen) - enviados)
+            await cliente.write_gatt_char(DATOS, imagen[enviados:enviados + n], response=False)
+            enviados += n
+            print(f'\r{100 * enviados // len(imagen)} %', end='', flush=True)
+        await cliente.write_gatt_char(CONTROL, bytes([CMD_END]), response=True)
+        await act.respuesta(CMD_END)
+        duracion = time.monotonic() - inicio
+        print(f'\r{len(imagen)} bytes en {duracion:.1f} s ({len(imagen) / duracion / 1024:.1f} kB/s), reiniciando')
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Actualización del firmware por BLE')
+    parser.add_argument('nombre', help='nombre del dispositivo BLE')
+    parser.add_argument('imagen', help='imagen de la aplicación (build/<proyecto>.bin)')
+    args = parser.parse_args()
+
+    with open(args.imagen, 'rb') as archivo:
+        datos = archivo.read()
+    try:
+        asyncio.run(actualizar(args.nombre, datos))
+    except KeyboardInterrupt:
+        pass
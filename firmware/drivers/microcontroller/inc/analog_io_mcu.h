@@ -14,6 +14,22 @@
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
  *
+ * @note In continuous mode each channel can average several conversions per
+ * sample (oversampling): the ADC converts faster and the DMA frames grow
+ * accordingly, so the interrupts and CPU work per delivered sample stay the
+ * same while the noise decreases (by the square root of the oversampling).
+ *
+ * @note Every reading (single, multi and continuous) is returned in mV: each input
+ * has its own curve fitting calibration, cached at init in a lookup table (one
+ * point every 16 codes, linear interpolation in between). Without eFuse
+ * calibration the ideal 0-3300 mV transfer function is used.
+ *
+ * @note In continuous mode the digital monitor of the ADC can watch up to
+ * ADC_MONITOR_MAX channels with a window each (AnalogMonitorArm): the
+ * conversions go on by DMA and a callback is called only when one of them
+ * leaves its window, so the application doesn't need to process the frames
+ * while the inputs don't change.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,11 +37,17 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 14/10/2026 | Continuous mode: multi-channel DMA scan with frame callback           |
+ * | 14/10/2026 | Channel registry with per-channel calibration (mV), multi-channel read |
+ * | 14/10/2026 | Per-channel oversampling in continuous mode                           |
+ * | 15/10/2026 | Digital monitor windows in continuous mode                            |
+ * | 15/10/2026 | Continuous mode sample frequency changed on the run                   |
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +62,10 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_CONT_FRAME_LEN	64		/*!< Samples (all channels) delivered by one DMA frame (continuous mode) */
+#define ADC_OVERSAMPLING_MAX	16	/*!< Maximum conversions averaged per sample (continuous mode) */
+#define ADC_MONITOR_MAX		2		/*!< Channels watched at the same time by the digital monitor (continuous mode) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -48,11 +74,22 @@ typedef enum adc_mode {
 typedef struct {			
 	adc_ch_t input;			/*!< Inputs: CH0, CH1, CH2, CH3 */
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
-	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
+	void *func_p;			/*!< Pointer to callback function for DMA frame end, called from ISR (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint16_t sample_frec;	/*!< Sample frequency per channel in Hz (only for continuous mode) */
+	uint8_t oversampling;	/*!< Conversions averaged per sample, up to ADC_OVERSAMPLING_MAX (only for continuous mode, 0 or 1: none) */
 } analog_input_config_t;	
 
+/**
+ * @brief Digital monitor window of a channel (continuous mode)
+ * 
+ */
+typedef struct {
+	adc_ch_t input;			/*!< Input: CH0, CH1, CH2, CH3 (initialized in ADC_CONTINUOUS mode) */
+	uint16_t low_mv;		/*!< Lower limit of the window (mV) */
+	uint16_t high_mv;		/*!< Upper limit of the window (mV) */
+} analog_window_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -80,9 +117,24 @@ void AnalogOutputInit(void);
  */
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 
+/**
+ * @brief Read several channels (initialized in ADC_SINGLE mode) with one call (reentrant).
+ * 
+ * @param channels Channels selected
+ * @param values Read variable array (in mV), 0 for the channels that couldn't be read
+ * @param n Number of channels
+ * @return uint8_t Number of channels read
+ */
+uint8_t AnalogInputReadMulti(const adc_ch_t *channels, uint16_t *values, uint8_t n);
+
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * @note All the channels initialized in ADC_CONTINUOUS mode are converted
+ * in a single scan pattern, so they must be initialized before the first call.
+ * Every channel is converted at the highest sample_frec times oversampling of
+ * the pattern; with equal settings each channel delivers sample_frec samples per second.
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -95,12 +147,63 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the samples of a single channel from the next DMA frame (non-blocking).
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (in mV, at least ADC_CONT_FRAME_LEN elements)
+ * @return uint16_t Number of samples read
+ */
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Change the sample frequency of the channels in continuous mode.
+ * 
+ * @note Every channel of the scan pattern takes the new sample_frec, each one keeps
+ * its oversampling. If the conversion is running it's restarted: the DMA frame in
+ * progress and the stored frames are lost.
+ * 
+ * @param sample_frec Sample frequency of each channel (Hz)
+ */
+void AnalogSetContinuousFrequency(uint16_t sample_frec);
+
+/**
+ * @brief Read the next DMA frame with the samples of all the channels in the scan pattern (non-blocking).
+ * 
+ * @param values Read variable array (in mV, at least ADC_CONT_FRAME_LEN elements)
+ * @param channels Channel of each sample (at least ADC_CONT_FRAME_LEN elements)
+ * @return uint16_t Number of samples read
+ */
+uint16_t AnalogInputReadFrame(uint16_t *values, adc_ch_t *channels);
+
+/**
+ * @brief Discard the DMA frames stored by the driver (e.g. after ignoring them for a while).
+ * 
+ */
+void AnalogFlushContinuous(void);
+
+/**
+ * @brief Arm the digital monitor: func_p is called (from ISR) the first time a conversion
+ * of the channels leaves its window.
+ * 
+ * @note The monitor compares every conversion, before the oversampling average,
+ * so the windows must be wider than the noise of a single conversion.
+ * 
+ * @note The monitors can only be configured with the conversion stopped: if it is
+ * running it's restarted, and the samples of the DMA frame in progress are lost.
+ * 
+ * @param windows Window of each channel (replacing the ones armed before)
+ * @param n Number of channels, up to ADC_MONITOR_MAX
+ * @param func_p Pointer to callback function, called once until the monitor is armed again
+ * @param param_p Pointer to callback function parameters
+ * @return true if the monitor was armed
+ */
+bool AnalogMonitorArm(const analog_window_t *windows, uint8_t n, void *func_p, void *param_p);
+
+/**
+ * @brief Disarm the digital monitor (the conversion goes on).
+ * 
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+void AnalogMonitorDisarm(void);
 
 /**
  * @brief Digital-to-Analog convert.
@@ -0,0 +1,131 @@
+#ifndef AUDIO_OUT_MCU_H
+#define AUDIO_OUT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Audio_Out Audio Out
+ ** @{ */
+
+/** \brief Block audio output through the analog output (DMA).
+ *
+ * Audio is streamed to the analog output pin (DAC, shared with CH0) by the I2S
+ * peripheral in PDM mode: the DMA reads 16 bit PCM samples from a double
+ * buffer and the PCM to PDM converter drives the pin (one line DAC mode, same
+ * RC filter as AnalogOutputWrite). The CPU is not involved in each sample:
+ * while one block plays the application writes the next one, and a callback
+ * tells it when a block has been sent. Sample rates from 8 to 48 kSPS.
+ *
+ * Samples are 8 bit unsigned (0 to 255, 128 is silence), like
+ * AnalogOutputWrite. When the application doesn't write a block in time the
+ * DMA sends silence and the underrun is counted (AudioOutUnderruns).
+ *
+ * @code
+ * void BlockFree(void *param){
+ *     vTaskNotifyGiveFromISR(feed_task_handle, NULL);
+ * }
+ * ...
+ * audio_out_config_t audio = {.sample_frec = 16000, .block_len = 512, .func_p = BlockFree};
+ * AudioOutInit(&audio);
+ * AudioOutStart();
+ * while(true){
+ *     ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+ *     AudioOutWrite(&song[index], 512, 0);
+ *     index += 512;
+ * }
+ * @endcode
+ *
+ * @note AudioOutInit and AnalogOutputInit take the same pin: use only one of them.
+ * Compiled only with CONFIG_DRIVERS_AUDIO_OUT (menuconfig: Drivers).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | 16 bit PCM write for decoded audio                                    |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "stdint.h"
+#include "stdbool.h"
+/*==================[macros]=================================================*/
+#define AUDIO_OUT_BLOCK_MAX		1024	/*!< Maximum samples per block (one DMA buffer) */
+#define AUDIO_OUT_BLOCKS		2		/*!< DMA buffers: one plays while the other is written */
+#define AUDIO_OUT_FREC_MIN		8000	/*!< Lowest sample frequency (Hz) */
+#define AUDIO_OUT_FREC_MAX		48000	/*!< Highest sample frequency (Hz) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Audio output config structure
+ *
+ */
+typedef struct {
+	uint32_t sample_frec;	/*!< Sample frequency in Hz, AUDIO_OUT_FREC_MIN to AUDIO_OUT_FREC_MAX */
+	uint16_t block_len;		/*!< Samples per block, up to AUDIO_OUT_BLOCK_MAX */
+	void *func_p;			/*!< Pointer to callback function for block sent (a block is free), called from ISR (NULL: none) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} audio_out_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Audio output initialization
+ *
+ * @param config Audio output config structure
+ * @return true Output initialized
+ * @return false Invalid configuration or I2S channel not available
+ */
+bool AudioOutInit(const audio_out_config_t *config);
+
+/**
+ * @brief Start the audio output: silence is sent until the first block is written
+ *
+ * @note The block callback is called for every block sent, silence included,
+ * so the application can write the first blocks from it.
+ */
+void AudioOutStart(void);
+
+/**
+ * @brief Stop the audio output (the blocks not sent yet are discarded)
+ */
+void AudioOutStop(void);
+
+/**
+ * @brief Write samples in the free blocks (task only)
+ *
+ * @param samples Samples (0 to 255)
+ * @param n Number of samples
+ * @param timeout_ms Longest wait for a free block (0: write only while there is room)
+ * @return uint32_t Number of samples written
+ */
+uint32_t AudioOutWrite(const uint8_t *samples, uint32_t n, uint32_t timeout_ms);
+
+/**
+ * @brief Write 16 bit PCM samples in the free blocks, without conversion (task only)
+ *
+ * @note For decoded audio (e.g. AdpcmDecodeBlock): the samples go straight
+ * to the DMA buffers, with the full 16 bit resolution.
+ *
+ * @param pcm Samples (-32768 to 32767)
+ * @param n Number of samples
+ * @param timeout_ms Longest wait for a free block (0: write only while there is room)
+ * @return uint32_t Number of samples written
+ */
+uint32_t AudioOutWritePcm(const int16_t *pcm, uint32_t n, uint32_t timeout_ms);
+
+/**
+ * @brief Blocks of silence sent because no samples were written in time since AudioOutStart
+ *
+ * @return uint32_t Number of underruns
+ */
+uint32_t AudioOutUnderruns(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef AUDIO_OUT_MCU_H */
+
+/*==================[end of file]============================================*/
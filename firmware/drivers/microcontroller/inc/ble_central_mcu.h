@@ -0,0 +1,135 @@
+#ifndef BLE_CENTRAL_MCU_H
+#define BLE_CENTRAL_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup BLE_Central BLE central (gateway)
+ ** @{ */
+
+/** \brief BLE central role: connects to several ESP-EDU peripherals and collects their data.
+ *
+ * The counterpart of ble_mcu.h: the board scans for the devices advertising a
+ * given name (the device_name of their BleInit, e.g. "PostureCare"), connects
+ * to up to max_peers of them, enables the notifications of their serial
+ * characteristic (0xFFE1), optionally writes a start command to each one
+ * ("B" asks PostureCare for binary frames) and hands every notification to
+ * func_p with the index of the peer. Lost peers are scanned for again.
+ *
+ * Connection scheduling: every link gets the same connection interval,
+ * BLE_CENTRAL_SLOT_UNITS per connected peer (7.5 ms at least), so the
+ * controller places the anchor of each link in its own slot of the interval.
+ * Each peer gets one event per interval without overlapping the others, and
+ * the aggregate throughput grows with each peer until the air time is full,
+ * instead of collapsing on colliding events. The intervals of the links are
+ * updated on each connection and disconnection.
+ *
+ * @code
+ * ble_central_config_t gateway = {
+ * 	.peer_name = "PostureCare", .max_peers = 4,
+ * 	.start_cmd = (const uint8_t *)"B", .start_cmd_len = 1,
+ * 	.func_p = Recibir,
+ * };
+ * BleCentralInit(&gateway);
+ * @endcode
+ *
+ * @note Bluedroid backend only, compiled with CONFIG_DRIVERS_BLE_CENTRAL
+ * (menuconfig: Drivers). It owns the BLE stack: do not use it together with
+ * BleInit. The number of links is also limited by CONFIG_BT_ACL_CONNECTIONS
+ * and CONFIG_BT_LE_MAX_CONNECTIONS.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define BLE_CENTRAL_MAX_PEERS	8		/*!< Peripherals handled at most */
+#define BLE_CENTRAL_SLOT_UNITS	2		/*!< Connection interval share of each peer (1.25 ms units) */
+#define BLE_CENTRAL_NO_PEER		0xFF	/*!< Index of an unused peer */
+/*==================[typedef]================================================*/
+/**
+ * @brief Prototype of callback function for the notifications of the peers
+ *
+ * @note Called from the Bluetooth task: keep it short (e.g. copy the data to a queue).
+ *
+ * @param peer      index of the peer (0 to max_peers - 1)
+ * @param data      pointer to received data array
+ * @param length    number of bytes of received data
+ */
+typedef void (*ble_central_func) (uint8_t peer, const uint8_t * data, uint16_t length);
+
+/**
+ * @brief BLE central configuration struct
+ */
+typedef struct {
+	const char * peer_name;		/*!< Name advertised by the peripherals to connect to */
+	uint8_t max_peers;			/*!< Peripherals connected at once (up to BLE_CENTRAL_MAX_PEERS) */
+	const uint8_t * start_cmd;	/*!< Written to each peer once subscribed (NULL: nothing) */
+	uint8_t start_cmd_len;		/*!< Number of bytes of start_cmd */
+	ble_central_func func_p;	/*!< Pointer to callback function to call when a peer notifies data */
+} ble_central_config_t;
+
+/**
+ * @brief Status and statistics of a peer
+ */
+typedef struct {
+	bool connected;				/*!< Subscribed and receiving */
+	uint8_t addr[6];			/*!< Address of the peripheral */
+	uint16_t interval;			/*!< Connection interval (1.25 ms units, 0 if not connected) */
+	uint32_t notifications;		/*!< Notifications received */
+	uint32_t bytes;				/*!< Bytes received */
+	uint32_t connections;		/*!< Times this slot was connected */
+} ble_central_peer_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief BLE central initialization: starts the stack and the scanning
+ *
+ * @note NVS is initialized here too (bonding keys), as in BleInit.
+ *
+ * @param config BLE central configuration struct (the strings must outlive the driver)
+ * @return true on success
+ */
+bool BleCentralInit(const ble_central_config_t * config);
+
+/**
+ * @brief Gets the number of peers connected and subscribed
+ *
+ * @return uint8_t Connected peers
+ */
+uint8_t BleCentralPeers(void);
+
+/**
+ * @brief Gets the status and statistics of a peer
+ *
+ * @param peer Index of the peer (0 to max_peers - 1)
+ * @param info Pointer to the struct where the status is stored
+ */
+void BleCentralGetPeer(uint8_t peer, ble_central_peer_t * info);
+
+/**
+ * @brief Writes data to the serial characteristic of a peer (write without response)
+ *
+ * @param peer Index of the peer
+ * @param data Pointer to array of data to be transmitted
+ * @param length Number of bytes to be sended (up to the MTU - 3)
+ * @return true Data handed to the stack, false if the peer is not connected
+ */
+bool BleCentralSend(uint8_t peer, const uint8_t * data, uint16_t length);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BLE_CENTRAL_MCU_H */
+
+/*==================[end of file]============================================*/
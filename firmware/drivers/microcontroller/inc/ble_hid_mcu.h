@@ -1,5 +1,5 @@
-#ifndef BLE_MCU_H
-#define BLE_MCU_H
+#ifndef BLE_HID_MCU_H
+#define BLE_HID_MCU_H
 /** \addtogroup Drivers_Programable Drivers Programable
  ** @{ */
 /** \addtogroup Drivers_Microcontroller Drivers microcontroller
@@ -12,6 +12,16 @@
  * @note This driver emulates HM-10 functionalities (same services and characteristics),
  * so it can be used to communicate with common Android apps, like "Bluetooth Electronics"
  * (https://play.google.com/store/apps/details?id=com.keuwl.arduinobluetooth)
+ *
+ * @note Reports are queued and sent by a task, up to 4 per connection interval
+ * (7.5 - 15 ms, requested on connection). Mouse movements queued while the link
+ * is busy are merged into a single report (as long as the buttons don't change
+ * and the sum fits in a report), so fast motion neither floods the link nor
+ * loses displacement.
+ *
+ * @note With the NimBLE backend (see ble_mcu.h) BleInit() with ble_config_t.hid
+ * set registers this service next to the serial one; BleHidInit() alone
+ * registers only the HID service.
  * 
  * @author Albano Peñalva
  *
@@ -20,24 +30,20 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Report queue: merged mouse deltas, pipelined keys, short interval     |
+ * | 14/10/2026 | NimBLE backend, shared with the serial service                        |
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "ble_mcu.h"
 /*==================[macros]=================================================*/
+#define BLE_HID_QUEUE_SIZE	32		/*!< Reports waiting to be sent */
 
 
 /*==================[typedef]================================================*/
-/**
- * @brief BLE connection status
- */
-typedef enum ble_status {
-	BLE_OFF,				/*!< BLE inactive */
-	BLE_DISCONNECTED,		/*!< BLE device disconnected */
-	BLE_CONNECTED			/*!< BLE device connected */
-} ble_status_t;
 /**
  * @brief Keyboard/Keypad Usage IDs
  */
@@ -194,6 +200,9 @@ ble_status_t BleHidStatus(void);
 /**
  * @brief Send a group of keys to be pressed together
  * 
+ * @note Press and release reports are queued; if the queue is full it waits
+ * up to 100 ms for room.
+ * 
  * @param special_key_mask      Modifier keys mask
  * @param keyboard_cmd          Array with keys (max: 6)
  * @param num_key               Number of keys (in keyboard_cmd array) to be pressed together (max: 6)
@@ -203,6 +212,8 @@ void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cm
 /**
  * @brief Send mouse position and click event
  * 
+ * @note Non blocking: the movement is queued or merged with the last queued one.
+ * 
  * @param mouse_button      Button to be clicked
  * @param delta_x           X cursor relative position
  * @param delta_y           Y cursor relative position
@@ -212,6 +223,6 @@ void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y);
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
-#endif /* BLE_MCU_H */
+#endif /* BLE_HID_MCU_H */
 
 /*==================[end of file]============================================*/
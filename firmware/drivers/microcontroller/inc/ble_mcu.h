@@ -13,6 +13,33 @@
  * so it can be used to communicate with common Android apps, like "Bluetooth Electronics"
  * (https://play.google.com/store/apps/details?id=com.keuwl.arduinobluetooth)
  * 
+ * @note Two backends implement this driver and the HID one (ble_hid_mcu.h):
+ * Bluedroid (ble_mcu.c and ble_hid_mcu.c, the default) and NimBLE
+ * (ble_nimble_mcu.c, selected with CONFIG_BT_NIMBLE_ENABLED). Only the NimBLE
+ * backend can run both services at once: set ble_config_t.hid to expose the
+ * serial service and the HID service from the same device and connection.
+ * 
+ * @note Besides the HM-10 data characteristic (0xFFE1) the serial service has a
+ * read only link statistics characteristic (0xFFE2), so the link can be tuned
+ * from the phone: its value is a ble_link_stats_t packed in the field order,
+ * little endian (35 bytes, read with long reads when the MTU is 23).
+ * 
+ * @note The read only state characteristic (BLE_STATE_UUID) holds the last
+ * value given to BleSetState(), e.g. the application state encoded once per
+ * change: a central reads it whenever it wants, without subscribing to the
+ * data stream, and the stack answers the read without calling the application.
+ * 
+ * @note Up to BLE_MAX_CONNECTIONS centrals can be connected at once (e.g. a
+ * phone and a logging gateway), the device keeps advertising while there is
+ * room. Each one gets the notifications once it enables them in the data
+ * characteristic CCCD: every transmission buffer is filled once and notified
+ * to each subscribed device in chunks of its own MTU. A slow device loses the
+ * buffers it can't take in time without holding back the others. The NimBLE
+ * backend accepts a single connection.
+ * 
+ * @note With CONFIG_DRIVERS_BLE_OTA the serial service also takes firmware
+ * updates (ble_ota_mcu.h), Bluedroid backend only.
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -20,14 +47,32 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 22/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | MTU exchange, DLE, 2M PHY and batched transmission                    |
+ * | 14/10/2026 | Transmission buffer pool, zero-copy and non-blocking send             |
+ * | 14/10/2026 | Congestion driven flow control and transmission statistics            |
+ * | 14/10/2026 | Fast and low power link profiles                                      |
+ * | 14/10/2026 | NimBLE backend, serial and HID services together                      |
+ * | 15/10/2026 | Asynchronous initialization and directed advertising reconnection     |
+ * | 15/10/2026 | Received data ring and command dispatch table                         |
+ * | 15/10/2026 | Link statistics (BleGetLinkStats) and link statistics characteristic  |
+ * | 15/10/2026 | Static task and queue storage (CONFIG_DRIVERS_STATIC_ALLOCATION)       |
+ * | 15/10/2026 | Several connections at once, notified to every subscribed device      |
+ * | 15/10/2026 | Stack events logged with LOG_DEFER (log_mcu)                          |
+ * | 15/10/2026 | Firmware update service (ble_ota_mcu.h, CONFIG_DRIVERS_BLE_OTA)       |
+ * | 15/10/2026 | Read only state characteristic with a cached value (BleSetState)      |
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include "ble_ota_mcu.h"
 /*==================[macros]=================================================*/
 #define BLE_NO_INT	0		/*!< Flag used when no reading interruption is required */
+#define BLE_RSSI_UNKNOWN	127		/*!< RSSI not read yet (no connection) */
+#define BLE_MAX_CONNECTIONS	3		/*!< Centrals connected at once (CONFIG_BT_LE_MAX_CONNECTIONS of the controller) */
+#define BLE_STATE_UUID		0xFFE5	/*!< Read only state characteristic of the serial service (BleSetState) */
+#define BLE_STATE_MAX_LEN	20		/*!< Largest value of the state characteristic (one read at the default MTU) */
 /*==================[typedef]================================================*/
 /**
  * @brief Prototype of callback function for reading received data 
@@ -37,12 +82,39 @@
  */
 typedef void (*read_func) (uint8_t * data, uint8_t length);
 
+/**
+ * @brief Prototype of callback function called once BLE is up and advertising
+ */
+typedef void (*ready_func) (void);
+
+/**
+ * @brief Prototype of command handler function
+ * 
+ * @param id        command character (several commands may share a handler)
+ * @param arg       pointer to the command argument (the bytes after id, not null terminated)
+ * @param length    number of bytes of the argument
+ */
+typedef void (*command_func) (char id, uint8_t * arg, uint8_t length);
+
+/**
+ * @brief Entry of the received commands dispatch table
+ */
+typedef struct {
+	char id;				/*!< First character of the command */
+	command_func func_p;	/*!< Handler of the command */
+} ble_command_t;
+
 /**
  * @brief BLE configuration struct
  */
 typedef struct {			
 	char * device_name;		/*!< BLE device name */
 	read_func func_p;		/*!< Pointer to callback function to call when receiving data (= BLE_NO_INT if not requiered) */
+	bool hid;				/*!< Also expose the HID service (BleHidSendKeyboard, BleHidSendMouse), NimBLE backend only */
+	ready_func ready_p;		/*!< Pointer to callback function to call when advertising starts (NULL if not requiered) */
+	const ble_command_t * commands;	/*!< Received commands dispatch table (NULL: every write goes to func_p) */
+	uint8_t n_commands;		/*!< Number of entries of the dispatch table */
+	ota_func ota_p;			/*!< Firmware update events (CONFIG_DRIVERS_BLE_OTA, NULL if not requiered) */
 } ble_config_t;
 
 /**
@@ -51,15 +123,74 @@ typedef struct {
 typedef enum ble_status {
 	BLE_OFF,				/*!< BLE inactive */
 	BLE_DISCONNECTED,		/*!< BLE device disconnected */
-	BLE_CONNECTED			/*!< BLE device connected */
+	BLE_CONNECTED			/*!< BLE device connected (at least one) */
 } ble_status_t;
+/**
+ * @brief Result of a non-blocking transmission
+ */
+typedef enum ble_tx_result {
+	BLE_TX_OK,				/*!< Data queued for transmission */
+	BLE_TX_BUSY,			/*!< No free transmission buffer, data discarded */
+	BLE_TX_NOT_CONNECTED	/*!< No device connected, data discarded */
+} ble_tx_result_t;
+
+/**
+ * @brief Advertising and connection timing
+ */
+typedef enum ble_link_profile {
+	BLE_LINK_FAST,			/*!< Advertising every 20-40 ms, connection interval 7.5-20 ms (default) */
+	BLE_LINK_LOW_POWER		/*!< Advertising every 1-1.2 s, connection interval 100-200 ms with 4 skippable events */
+} ble_link_profile_t;
+
+/**
+ * @brief Transmission statistics
+ */
+typedef struct {
+	uint16_t queue_depth;		/*!< Buffers waiting to be sent */
+	uint16_t queue_max;			/*!< Maximum number of buffers waiting to be sent */
+	uint32_t notifications;		/*!< Notifications handed to the BLE stack */
+	uint32_t dropped;			/*!< Buffers discarded (pool exhausted, link timeout or disconnection) */
+	bool congested;				/*!< The link is currently congested */
+} ble_tx_stats_t;
+
+/**
+ * @brief Link statistics, rates computed every second
+ */
+typedef struct {
+	uint16_t mtu;					/*!< Negotiated GATT MTU */
+	uint16_t interval;				/*!< Connection interval (1.25 ms units, 0 if not connected) */
+	uint16_t latency;				/*!< Connection events the peripheral may skip */
+	uint8_t tx_phy;					/*!< Transmission PHY: 1 (1M), 2 (2M) or 3 (coded) */
+	uint8_t rx_phy;					/*!< Reception PHY: 1 (1M), 2 (2M) or 3 (coded) */
+	int8_t rssi;					/*!< Signal strength of the connection (dBm), BLE_RSSI_UNKNOWN if not read */
+	uint16_t notifications_per_s;	/*!< Notifications sent during the last second */
+	uint32_t bytes_per_s;			/*!< Bytes sent during the last second */
+	uint32_t notifications;			/*!< Notifications sent */
+	uint32_t bytes;					/*!< Bytes sent */
+	uint16_t events_max;			/*!< Maximum number of events waiting in the driver task queue */
+	uint16_t queue_max;				/*!< Maximum number of buffers waiting to be sent */
+	uint32_t dropped;				/*!< Buffers discarded (pool exhausted, link timeout or disconnection) */
+	uint32_t blocked;				/*!< Sends that waited for a free transmission buffer */
+} ble_link_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Bluetooth initialization
  * 
- * @note It'll start advertising automatically after initialization.
+ * @note It returns right after initializing NVS and creating the driver tasks,
+ * the BLE stack starts in the background. Status is BLE_OFF until it is
+ * advertising, then ble_config_t.ready_p is called (once). Data sent before that
+ * is discarded.
+ * 
+ * @note The last bonded central is stored in NVS: advertising is first directed
+ * to it (high duty cycle, 1.28 s) so it reconnects right away, then it falls back
+ * to regular advertising.
+ * 
+ * @note Received writes wait in a 1 KB ring for the reading task. With a
+ * command table each write is split in commands separated by ';', '\r' or '\n'
+ * (e.g. "U15;S12;P2000") and every command goes to the handler of its first
+ * character; commands without handler go to func_p.
  * 
  * @param ble_device BLE configuration struct
  */
@@ -94,6 +225,112 @@ void BleSendString(const char *msg);
  */
 void BleSendBuffer(const char *data, uint8_t nbytes);
 
+/**
+ * @brief Send multiple bytes without blocking the calling task
+ * 
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended (up to 244)
+ * @return ble_tx_result_t BLE_TX_BUSY if every transmission buffer is in use
+ */
+ble_tx_result_t BleTrySend(const char *data, uint16_t nbytes);
+
+/**
+ * @brief Takes a free transmission buffer to be filled in place (zero-copy, non-blocking)
+ * 
+ * @note The buffer holds up to 244 bytes and must be handed back with BleTxBufferSend().
+ * 
+ * @return uint8_t* Pointer to the buffer, NULL if none is free or no device is connected
+ */
+uint8_t * BleTxBufferGet(void);
+
+/**
+ * @brief Queues a buffer obtained with BleTxBufferGet() for transmission
+ * 
+ * @note The buffer goes back to the pool once it has been sent.
+ * 
+ * @param buffer Pointer returned by BleTxBufferGet()
+ * @param nbytes Number of bytes written in the buffer
+ */
+void BleTxBufferSend(uint8_t *buffer, uint16_t nbytes);
+
+/**
+ * @brief Gets the GATT MTU negotiated with the connected device
+ * 
+ * @note Each notification carries up to (MTU - 3) bytes. The MTU is 23 until the
+ * central requests a bigger one. With several devices connected it is the
+ * smallest of their MTUs, so data packed for it fits every device.
+ * 
+ * @return uint16_t Negotiated MTU (in bytes)
+ */
+uint16_t BleGetMtu(void);
+
+/**
+ * @brief Gets the number of connected devices
+ * 
+ * @return uint8_t Connected centrals (up to BLE_MAX_CONNECTIONS)
+ */
+uint8_t BleConnections(void);
+
+/**
+ * @brief Send an array of fixed size frames packing as many frames as
+ * possible in each notification (up to the negotiated MTU)
+ * 
+ * @note A frame is never split between two notifications, so the receiver can
+ * decode every notification on its own. Use frame_size = 1 for a plain byte stream.
+ * 
+ * @param frames Pointer to array of frames to be transmitted
+ * @param frame_size Size of each frame (in bytes)
+ * @param n_frames Number of frames to be sended
+ */
+void BleSendBatch(const void *frames, uint16_t frame_size, uint16_t n_frames);
+
+/**
+ * @brief Gets the transmission queue statistics
+ * 
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void BleGetTxStats(ble_tx_stats_t *stats);
+
+/**
+ * @brief Gets the link statistics
+ * 
+ * @note The connection parameters are the ones chosen by the central, they may
+ * differ from the link profile ones. The RSSI is read once per second while
+ * connected. With several devices connected the connection parameters, PHY
+ * and RSSI are the last ones reported (RSSI of the first device); the counters
+ * cover every device.
+ * 
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void BleGetLinkStats(ble_link_stats_t *stats);
+
+/**
+ * @brief Selects the advertising and connection timing
+ * 
+ * @note The connection parameters are requested to the central, which may
+ * keep its own ones. The low power profile delays notifications up to 200 ms
+ * and received data up to 1 s, use it while there is little to send.
+ * 
+ * @param profile Link profile
+ */
+void BleSetLinkProfile(ble_link_profile_t profile);
+
+/**
+ * @brief Sets the value of the state characteristic (BLE_STATE_UUID)
+ * 
+ * @note The value is copied into the attribute table, reads are answered by
+ * the stack from that copy. A value equal to the current one returns without
+ * reaching the stack, so it can be called for every sample and only the
+ * changes cost anything. Can be called before BleInit() or while nobody is
+ * connected. Not from an ISR.
+ * 
+ * @param data	Encoded value
+ * @param len	Bytes of the value, up to BLE_STATE_MAX_LEN
+ * @return true		Value stored (or unchanged)
+ * @return false	Value too long
+ */
+bool BleSetState(const void *data, uint16_t len);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
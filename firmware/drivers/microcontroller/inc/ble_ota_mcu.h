@@ -0,0 +1,132 @@
+#ifndef BLE_OTA_MCU_H
+#define BLE_OTA_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup BLE_OTA BLE firmware update
+ ** @{ */
+
+/** \brief Firmware update through the BLE serial service (CONFIG_DRIVERS_BLE_OTA).
+ *
+ * Two characteristics are added to the serial service of ble_mcu.h (Bluedroid
+ * backend):
+ *
+ * | UUID   | Properties             | Use                                             |
+ * |:------:|:-----------------------|:------------------------------------------------|
+ * | 0xFFE3 | write, notify          | Control: commands and their answers, credits    |
+ * | 0xFFE4 | write without response | Image data, any length up to (MTU - 3)          |
+ *
+ * The image is written to the next OTA app partition as it arrives, without
+ * holding it in RAM: the data goes into one of two BLE_OTA_BUFFER_SIZE buffers
+ * (a flash sector) while a task writes the other one with esp_ota_write (which
+ * erases each sector right before writing it). The central never waits for an
+ * answer per packet: it may send up to a credit limit, which grows by one
+ * buffer every time a buffer is written. While the flash keeps up with the link
+ * the limit stays ahead of the data and the writes without response flow back
+ * to back, several per connection event.
+ *
+ * Control commands (first byte, multibyte fields little endian):
+ *
+ * | Command               | Arguments        | Answer (notification)                                 |
+ * |:----------------------|:-----------------|:------------------------------------------------------|
+ * | BLE_OTA_CMD_BEGIN     | size (4)         | BLE_OTA_CMD_BEGIN, status (1), window (2), chunk (2)   |
+ * | BLE_OTA_CMD_END       | -                | BLE_OTA_CMD_END, status (1)                           |
+ * | BLE_OTA_CMD_ABORT     | -                | BLE_OTA_CMD_ABORT, status (1)                         |
+ *
+ * During the transfer the device notifies BLE_OTA_CREDIT, limit (4), written (4):
+ * the central may send data up to offset limit. An error in the middle of the
+ * transfer is notified as BLE_OTA_ERROR, status (1) and cancels the update.
+ * BEGIN answers with the first limit (window bytes) and the largest write
+ * (chunk bytes, MTU - 3). END writes the last partial buffer, checks the image
+ * (esp_ota_end), selects it for the next boot and, if everything went right,
+ * restarts the device BLE_OTA_RESTART_MS later.
+ *
+ * BEGIN also asks the central for the fast connection timing (BLE_LINK_FAST),
+ * whatever the active link profile. drivers/microcontroller/ble_ota.py sends an
+ * image from a PC.
+ *
+ * @note The partition table needs two OTA app partitions (ota_0, ota_1) and
+ * otadata. Only one update at a time, from any connected device.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define BLE_OTA_BUFFER_SIZE		4096	/*!< Size of each of the two image buffers (a flash sector) */
+#define BLE_OTA_RESTART_MS		500		/*!< Delay between the END answer and the restart */
+
+#define BLE_OTA_CMD_BEGIN		0x01	/*!< Start an update: image size */
+#define BLE_OTA_CMD_END			0x02	/*!< Whole image sent: check and select it */
+#define BLE_OTA_CMD_ABORT		0x03	/*!< Cancel the update */
+#define BLE_OTA_CREDIT			0x04	/*!< Notification: new credit limit */
+#define BLE_OTA_ERROR			0x05	/*!< Notification: the update failed */
+/*==================[typedef]================================================*/
+/**
+ * @brief Status of the answers and of BLE_OTA_ERROR
+ */
+typedef enum ble_ota_status {
+	BLE_OTA_OK = 0,				/*!< Done */
+	BLE_OTA_ERR_STATE,			/*!< Command out of order (e.g. BEGIN during an update, data before BEGIN) */
+	BLE_OTA_ERR_PARTITION,		/*!< No OTA partition to write, or esp_ota_begin failed */
+	BLE_OTA_ERR_SIZE,			/*!< Image bigger than the partition, or END before the whole image */
+	BLE_OTA_ERR_OVERFLOW,		/*!< Data beyond the credit limit */
+	BLE_OTA_ERR_WRITE,			/*!< esp_ota_write failed */
+	BLE_OTA_ERR_IMAGE,			/*!< The image is not valid (esp_ota_end) */
+	BLE_OTA_ERR_DISCONNECTED,	/*!< The device that started the update disconnected */
+} ble_ota_status_t;
+
+/**
+ * @brief Update events, see ble_config_t.ota_p
+ */
+typedef enum ble_ota_event {
+	BLE_OTA_EVENT_BEGIN,		/*!< Update started, param: image size */
+	BLE_OTA_EVENT_DONE,			/*!< Image selected for the next boot, the device restarts after the callback */
+	BLE_OTA_EVENT_FAILED,		/*!< Update cancelled, param: ble_ota_status_t */
+} ble_ota_event_t;
+
+/**
+ * @brief Prototype of the update events callback (called from the writing task)
+ *
+ * @param event	Event
+ * @param param	Image size (BLE_OTA_EVENT_BEGIN) or status (BLE_OTA_EVENT_FAILED)
+ */
+typedef void (*ota_func) (ble_ota_event_t event, uint32_t param);
+
+/**
+ * @brief Update progress
+ */
+typedef struct {
+	bool active;				/*!< An update is in progress */
+	uint32_t size;				/*!< Image size */
+	uint32_t received;			/*!< Bytes received */
+	uint32_t written;			/*!< Bytes written to the flash */
+	uint32_t elapsed_ms;		/*!< Time since BEGIN (until END, for the last update) */
+	ble_ota_status_t status;	/*!< Result of the last update (BLE_OTA_OK while active) */
+} ble_ota_progress_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Gets the progress of the current (or last) update
+ *
+ * @param progress Pointer to the struct where the progress is stored
+ */
+void BleOtaGetProgress(ble_ota_progress_t *progress);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BLE_OTA_MCU_H */
+
+/*==================[end of file]============================================*/
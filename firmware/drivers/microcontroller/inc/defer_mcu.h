@@ -0,0 +1,132 @@
+#ifndef DEFER_MCU_H
+#define DEFER_MCU_H
+
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Defer Deferred work
+ ** @{ */
+
+/** \brief Deferred work executor for the driver callbacks.
+ *
+ * The timer, GPIO, SPI and UART drivers call the application callbacks in
+ * interrupt context. Work that takes longer than notifying a task can be
+ * deferred: the interrupt only queues a (function, parameter) pair and a
+ * worker task runs it. There is one worker per level (DEFER_HIGH,
+ * DEFER_LOW), each with its own priority (DeferInit) and its own lock-free
+ * queue, where any number of interrupts and tasks can add work.
+ *
+ * Any driver callback can be deferred without changing the driver, by
+ * passing DeferIsr as the callback and a deferred_t as its parameter:
+ *
+ * @code
+ * static deferred_t block_work = DEFERRED_INIT(ProcessBlock, NULL, DEFER_LOW);
+ *
+ * DeferInit(DEFER_LOW, 5);
+ * timer_config_t timer = {
+ *     .timer = TIMER_A,
+ *     .period = 4000,
+ *     .func_p = DeferIsr,         // ProcessBlock(NULL) runs in the DEFER_LOW worker
+ *     .param_p = &block_work,
+ * };
+ * @endcode
+ *
+ * @note Work is run in the order it was queued. When a queue is full the
+ * new work is dropped and counted (DeferGetStats).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "stdint.h"
+#include "stdbool.h"
+/*==================[macros]=================================================*/
+#define DEFER_QUEUE_LENGTH	32		/*!< Pending work of each level (power of two) */
+#define DEFER_STACK			3072	/*!< Stack of each worker task (bytes) */
+
+/**
+ * @brief Initializer of a deferred_t
+ *
+ * @param func	Function to run in the worker
+ * @param param	Function parameter
+ * @param lvl	Worker level (defer_level_t)
+ */
+#define DEFERRED_INIT(func, param, lvl)	{.func_p = (func), .param_p = (param), .level = (lvl)}
+/*==================[typedef]================================================*/
+/**
+ * @brief Worker levels
+ */
+typedef enum {
+	DEFER_HIGH,				/*!< Short, latency sensitive work */
+	DEFER_LOW,				/*!< Longer work (filtering, display, communication) */
+	DEFER_LEVELS
+} defer_level_t;
+/**
+ * @brief Work run by a worker, used as the parameter of DeferIsr
+ */
+typedef struct {
+	void (*func_p)(void*);	/*!< Function to run in the worker */
+	void *param_p;			/*!< Function parameter */
+	defer_level_t level;	/*!< Worker level */
+} deferred_t;
+/**
+ * @brief Statistics of a worker
+ */
+typedef struct {
+	uint32_t executed;		/*!< Work run */
+	uint32_t dropped;		/*!< Work dropped because the queue was full */
+	uint16_t max_pending;	/*!< Maximum work waiting in the queue */
+} defer_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Create the worker task of a level
+ *
+ * @param level		Worker level
+ * @param priority	Priority of the worker task
+ * @return true		Worker running
+ * @return false	The task could not be created
+ */
+bool DeferInit(defer_level_t level, uint8_t priority);
+
+/**
+ * @brief Queue a function to be run by a worker (from an interrupt or a task)
+ *
+ * @param level		Worker level
+ * @param func_p	Function
+ * @param param_p	Function parameter
+ * @return true		Work queued
+ * @return false	Queue full (or worker not initialized), the work is dropped
+ */
+bool Defer(defer_level_t level, void (*func_p)(void*), void *param_p);
+
+/**
+ * @brief Driver callback that queues a deferred_t
+ *
+ * @param param		Pointer to a deferred_t
+ */
+void DeferIsr(void *param);
+
+/**
+ * @brief Statistics of a worker
+ *
+ * @param level		Worker level
+ * @param stats		Statistics
+ */
+void DeferGetStats(defer_level_t level, defer_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -9,10 +9,12 @@
 
 /** \brief Functions to generate delays.
  *
- * This driver provide functions to generate delays FreeRTOS friendly, using one timer.
+ * This driver provide functions to generate delays FreeRTOS friendly, using
+ * one-shot soft timers of the timer driver (no gptimer of its own).
  * 
  * @note All delays will block the current RTOS task, with the exception of 
- * DelayUs with usec < 50.
+ * DelayNs and DelayUs with usec <= 50, that busy wait on the CPU cycle counter
+ * (the cost of the call is calibrated on first use and discounted).
  *
  * @author Albano Peñalva
  *
@@ -21,6 +23,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Short delays on soft timers, several tasks can wait at once			|
+ * | 14/10/2026 | Calibrated busy wait for short delays, DelayNs						|
  * 
  **/
 
@@ -54,6 +58,15 @@ void DelayMs(uint16_t msec);
  */
 void DelayUs(uint16_t usec);
 
+/**
+ * @brief Delay in nanoseconds (busy wait, for bit-banged protocols)
+ * @note The resolution is one CPU cycle plus the interrupt latency, so
+ * interrupts may lengthen the delay.
+ * @param[in] nsec nanoseconds to be in delay
+ * @return None
+ */
+void DelayNs(uint16_t nsec);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,144 @@
+#ifndef ESPNOW_MCU_H
+#define ESPNOW_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup ESPNOW ESP-NOW
+ ** @{ */
+
+/** \brief ESP-NOW: connectionless frames between boards, without access point.
+ *
+ * Frames of up to ESPNOW_FRAME_MAX bytes go straight from one board to
+ * another (or to every board on the channel) as Wi-Fi action frames: there is
+ * no connection to set up and no access point, so a frame is delivered in a
+ * fraction of a millisecond. Unicast frames are acknowledged and retried by
+ * the radio; broadcast frames are not.
+ *
+ * The radio is started on a fixed channel, that must be the same in every
+ * board. If the Wi-Fi station (wifi_mcu.h) is already connected, the channel
+ * of its access point is used instead and config.channel is ignored.
+ *
+ * Several modules can share the radio: frames whose first byte was registered
+ * with EspNowAddHandler go to that handler, the rest to config.func_p.
+ *
+ * @code
+ * espnow_config_t espnow = {.channel = 1, .func_p = Recibir};
+ * EspNowInit(&espnow);
+ * EspNowAddPeer(mac_central);
+ * EspNowSend(mac_central, datos, largo);
+ * @endcode
+ *
+ * @note Compiled only with CONFIG_DRIVERS_ESPNOW (menuconfig: Drivers).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Handlers by first byte, EspNowInit may be called again				|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "stdint.h"
+#include "stdbool.h"
+/*==================[macros]=================================================*/
+#define ESPNOW_FRAME_MAX		250		/*!< Largest frame (bytes) */
+#define ESPNOW_BROADCAST		NULL	/*!< Destination of the frames for every board on the channel */
+#define ESPNOW_NO_INT			0		/*!< Flag used when no reception callback is required */
+#define ESPNOW_HANDLERS			4		/*!< Handlers registered with EspNowAddHandler */
+/*==================[typedef]================================================*/
+/**
+ * @brief Prototype of callback function for the received frames
+ *
+ * @note Called from the Wi-Fi task: keep it short (e.g. copy the data to a queue).
+ *
+ * @param mac       address of the sender (6 bytes)
+ * @param data      pointer to the frame
+ * @param length    number of bytes of the frame
+ */
+typedef void (*espnow_read_func) (const uint8_t *mac, const uint8_t *data, uint8_t length);
+
+/**
+ * @brief ESP-NOW configuration struct
+ */
+typedef struct {
+	uint8_t channel;				/*!< Wi-Fi channel (1 to 13), the same in every board */
+	espnow_read_func func_p;		/*!< Pointer to callback function to call when a frame is received (= ESPNOW_NO_INT if not requiered) */
+} espnow_config_t;
+
+/**
+ * @brief Frame statistics
+ */
+typedef struct {
+	uint32_t sent;					/*!< Frames handed to the radio */
+	uint32_t failed;				/*!< Unicast frames not acknowledged by the receiver after the retries */
+	uint32_t busy;					/*!< Frames discarded, radio queue full */
+	uint32_t received;				/*!< Frames received */
+} espnow_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief ESP-NOW initialization: starts the radio (if the Wi-Fi station is not running) and ESP-NOW
+ *
+ * @note NVS is initialized here too (Wi-Fi calibration data), as in WifiInit.
+ * Once started, further calls return true and keep the channel and callback
+ * of the first one: modules sharing the radio use EspNowAddHandler instead.
+ *
+ * @param config ESP-NOW configuration struct
+ * @return true on success or if it was already started
+ */
+bool EspNowInit(const espnow_config_t *config);
+
+/**
+ * @brief Registers the callback of the frames that start with a given byte
+ * (before or after EspNowInit)
+ *
+ * @param id First byte of the frames
+ * @param func_p Callback function, called from the Wi-Fi task
+ * @return true on success, false if ESPNOW_HANDLERS are already registered
+ */
+bool EspNowAddHandler(uint8_t id, espnow_read_func func_p);
+
+/**
+ * @brief Adds a board to which unicast frames are sent (not needed for broadcast)
+ *
+ * @param mac Address of the board (6 bytes, EspNowGetMac on that board)
+ * @return true on success or if it was already added
+ */
+bool EspNowAddPeer(const uint8_t *mac);
+
+/**
+ * @brief Sends a frame (non-blocking: it is queued to the radio)
+ *
+ * @param mac Address of an added board, or ESPNOW_BROADCAST
+ * @param data Frame
+ * @param length Frame length (up to ESPNOW_FRAME_MAX)
+ * @return true Frame queued, false if the radio queue is full or the board is not added
+ */
+bool EspNowSend(const uint8_t *mac, const uint8_t *data, uint8_t length);
+
+/**
+ * @brief Gets the address of this board
+ *
+ * @param mac Array of 6 bytes where the address is stored
+ */
+void EspNowGetMac(uint8_t *mac);
+
+/**
+ * @brief Gets the frame statistics
+ *
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void EspNowGetStats(espnow_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,18 @@
  ** @{ */
 
 /** \brief GPIO driver to use gpio ouputs with faster functions than gpio_mcu.
+ * 
+ * Pins are grouped in bundles of dedicated GPIO channels, which the CPU
+ * drives through its own registers (RISC-V CSRs) instead of the GPIO matrix.
+ * Set, clear and write are inline and use CSR set/clear instructions: each
+ * one changes only the bits of its mask, atomically, so they can be used from
+ * ISRs and several tasks without locks (except on the same pins).
+ * 
+ * Bit i of masks and values is the i-th pin of the list given to
+ * GPIOFastBundleInit.
+ * 
+ * @note The ESP32-C6 has 8 dedicated output and 8 input channels, shared by
+ * all the bundles.
  * 
  * @author Albano Peñalva
  *
@@ -16,33 +28,128 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 14/10/2026 | Several bundles, masked set/clear/toggle/write, inputs					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 #include "gpio_mcu.h"
+#include "driver/dedic_gpio.h"
+#include "hal/dedic_gpio_cpu_ll.h"
 /*==================[macros]=================================================*/
-
+#define GPIO_FAST_MAX_BUNDLES	4		/*!< Bundles that can be created */
+#define GPIO_FAST_MAX_PINS		8		/*!< Pins of a bundle (dedicated channels) */
 /*==================[typedef]================================================*/
-
+/**
+ * @brief Bundle direction
+ */
+typedef enum {
+	GPIO_FAST_OUTPUT,			/*!< Outputs */
+	GPIO_FAST_INPUT,			/*!< Inputs */
+} gpio_fast_dir_t;
+/**
+ * @brief Bundle of dedicated GPIO channels (use the handle from GPIOFastBundleInit)
+ */
+typedef struct {
+	dedic_gpio_bundle_handle_t bundle;	/*!< ESP-IDF bundle */
+	uint32_t mask;						/*!< Pins of the bundle (bits from 0) */
+	uint8_t offset;						/*!< First CPU channel of the bundle */
+	gpio_fast_dir_t dir;				/*!< Direction of the pins */
+} gpio_fast_bundle_t;
+/**
+ * @brief Bundle handle
+ */
+typedef gpio_fast_bundle_t *gpio_fast_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
+/**
+ * @brief Create a bundle
+ * 
+ * @param pin_list Pins of the bundle, bit i of masks and values is pin_list[i]
+ * @param pin_qty Number of pins (up to GPIO_FAST_MAX_PINS)
+ * @param dir Direction of the pins
+ * @return gpio_fast_t Bundle handle, NULL if no bundle or channel is free
+ */
+gpio_fast_t GPIOFastBundleInit(const gpio_t *pin_list, uint8_t pin_qty, gpio_fast_dir_t dir);
+
+/**
+ * @brief Set to high the pins of the mask (one CSR instruction)
+ * 
+ * @param bundle Output bundle
+ * @param mask Pins to be set
+ */
+static inline void GPIOFastSet(gpio_fast_t bundle, uint32_t mask){
+	uint32_t channels = (mask & bundle->mask) << bundle->offset;
+	dedic_gpio_cpu_ll_write_mask(channels, channels);
+}
+
+/**
+ * @brief Set to low the pins of the mask (one CSR instruction)
+ * 
+ * @param bundle Output bundle
+ * @param mask Pins to be cleared
+ */
+static inline void GPIOFastClear(gpio_fast_t bundle, uint32_t mask){
+	dedic_gpio_cpu_ll_write_mask((mask & bundle->mask) << bundle->offset, 0);
+}
+
+/**
+ * @brief Write the pins of the mask, the others keep their state
+ * 
+ * @param bundle Output bundle
+ * @param mask Pins to be written
+ * @param value New state of the pins
+ */
+static inline void GPIOFastBundleWrite(gpio_fast_t bundle, uint32_t mask, uint32_t value){
+	dedic_gpio_cpu_ll_write_mask((mask & bundle->mask) << bundle->offset, value << bundle->offset);
+}
+
+/**
+ * @brief Invert the pins of the mask, the others keep their state
+ * 
+ * @param bundle Output bundle
+ * @param mask Pins to be inverted
+ */
+static inline void GPIOFastToggle(gpio_fast_t bundle, uint32_t mask){
+	uint32_t channels = (mask & bundle->mask) << bundle->offset;
+	uint32_t out = dedic_gpio_cpu_ll_read_out();
+	dedic_gpio_cpu_ll_write_mask(channels, ~out);
+}
+
+/**
+ * @brief Read the pins of a bundle
+ * 
+ * @param bundle Input bundle (or output bundle, to read the written state)
+ * @return uint32_t State of the pins (bit i is pin_list[i])
+ */
+uint32_t GPIOFastBundleRead(gpio_fast_t bundle);
+
+/**
+ * @brief Read the pins of an input bundle (inline)
+ * 
+ * @param bundle Input bundle
+ * @return uint32_t State of the pins (bit i is pin_list[i])
+ */
+static inline uint32_t GPIOFastReadIn(gpio_fast_t bundle){
+	return (dedic_gpio_cpu_ll_read_in() >> bundle->offset) & bundle->mask;
+}
 
 /**
- * @brief 
+ * @brief Output bundle initialization (kept for compatibility, uses one bundle)
  * 
- * @param pin_list 
- * @param pin_qty 
+ * @param pin_list Pins of the bundle
+ * @param pin_qty Number of pins
  */
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
 
 /**
- * @brief 
+ * @brief Write all the pins of the bundle created with GPIOFastInit
  * 
- * @param value 
+ * @param value New state of the pins (bit i is pin_list[i])
  */
 void GPIOFastWrite(uint16_t value);
 
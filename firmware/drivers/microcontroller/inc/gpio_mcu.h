@@ -26,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | GPIOWriteMask: several outputs in one register operation				|
  * 
  **/
 
@@ -115,6 +116,18 @@ void GPIOState(gpio_t pin, bool state);
  */
 void GPIOToggle(gpio_t pin);
 
+/**
+ * @brief Change the state of several outputs at once
+ * 
+ * Uses the set and clear registers (out_w1ts / out_w1tc): the pins that go
+ * high change in one write and the ones that go low in the next, the rest
+ * of the outputs are not touched, so no read-modify-write nor lock is needed.
+ * 
+ * @param pin_mask Pins to be written (bit n: GPIO_n)
+ * @param state_mask New state of the pins (bit n: GPIO_n)
+ */
+void GPIOWriteMask(uint32_t pin_mask, uint32_t state_mask);
+
 /**
  * @brief Reads GPIO state
  * 
@@ -127,6 +140,9 @@ bool GPIORead(gpio_t pin);
 /**
  * @brief Configure GPIO input interruption
  * 
+ * @note The callback runs in interrupt context. Pass DeferIsr and a
+ * deferred_t (defer_mcu.h) to run the work in a worker task instead.
+ * 
  * @param pin GPIO number
  * @param ptr_int_func Pointer to callback function
  * @param edge true: positive edge - false: negative edge
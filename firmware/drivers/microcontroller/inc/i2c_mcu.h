@@ -14,6 +14,31 @@
  * 
  * @note ESP-EDU have 4 I2C connector in the board (J4, J5, J6 and J8), but all of them are routed to the same I2C port.
  *
+ * @note Built on the IDF i2c_master bus driver. Each device gets a handle with
+ * its own clock (I2C_addDevice); the functions with a devAddr create it the
+ * first time at the I2C_initialize clock. Register reads are a single
+ * transaction (register written and data read with a repeated start).
+ *
+ * @note All transactions go through a scheduler task that owns the bus. Each
+ * device has its own queue, served in order; between devices the one with the
+ * highest priority (I2C_setPriority) goes first, devices of equal priority take
+ * turns. Blocking functions queue the transaction and wait for it, the *Async
+ * ones return at once and the scheduler calls the completion callback.
+ * Devices with coalescing enabled get back-to-back reads covering a contiguous
+ * register range merged into a single transaction (only for registers with
+ * auto increment, not for FIFO data registers). I2C_getStats reports the bus
+ * time used by each device (or the whole bus), the time its callers were
+ * blocked and a histogram of the latency of its requests, from the call to
+ * the end of the transaction (queue wait included). The counters are always on.
+ *
+ * @note A device can have a register shadow (I2C_shadowEnable): the registers
+ * declared cacheable (configuration registers only changed by the host, no
+ * status, data or self-clearing bits) are kept in RAM, so the read of a
+ * read-modify-write (I2C_writeBit, I2C_writeBits) doesn't go to the bus once
+ * the value is known. Between I2C_shadowBegin and I2C_shadowCommit the writes
+ * to cacheable registers are only stored, and on commit (or before any other
+ * transfer to the device) they are written in bursts of consecutive registers.
+ *
  * @author Juan Ignacio Cerrudo
  * 
  * @section changelog
@@ -21,6 +46,11 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 30/01/2024 | Document creation		                         |
+ * | 14/10/2026 | I2C_burstRead (repeated start)                 |
+ * | 14/10/2026 | i2c_master bus driver, device handles, async   |
+ * | 14/10/2026 | Transaction scheduler, per-device queues/stats |
+ * | 14/10/2026 | Register shadow cache and batched writes       |
+ * | 15/10/2026 | Request latency histogram and blocked time     |
  *
  */
 
@@ -28,7 +58,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_log.h"
-#include "driver/i2c.h"
+#include "driver/i2c_master.h"
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 
@@ -39,7 +69,42 @@
 #define I2C_MASTER_FREQ_HZ          400000  /*!< I2C master clock frequency */
 #define I2C_MASTER_TX_BUF_DISABLE   0       /*!< I2C master doesn't need buffer */
 #define I2C_MASTER_RX_BUF_DISABLE   0       /*!< I2C master doesn't need buffer */
-#define I2C_MASTER_TIMEOUT_MS       1000
+#define I2C_MASTER_TIMEOUT_MS       1000    /*!< Default transaction timeout (timeout = 0) */
+#define I2C_SHADOW_REGS             256     /*!< Registers of a device shadow */
+#define I2C_LATENCY_BINS            8       /*!< Bins of the request latency histogram */
+
+typedef struct i2c_device_s *i2c_dev_t;    /*!< Device on the I2C bus */
+
+/** @brief Completion callback of an asynchronous transaction (called from the scheduler task)
+ * @note It may call the blocking functions (run at once), but shouldn't wait for anything else
+ * @param ok true if the transaction succeeded
+ * @param param Pointer given with the transaction
+ */
+typedef void (*i2c_done_cb_t)(bool ok, void *param);
+
+/** @brief Bus usage of a device
+ */
+typedef struct {
+	uint32_t transactions;      /*!< Transactions run on the bus */
+	uint32_t requests;          /*!< Transactions asked by the clients (> transactions when reads are merged) */
+	uint32_t errors;            /*!< Failed transactions */
+	uint32_t bytes;             /*!< Data bytes transferred */
+	uint32_t busy_us;           /*!< Bus time used */
+	uint32_t blocked_us;        /*!< Time the callers of blocking functions waited */
+	uint32_t period_us;         /*!< Time since the statistics were reset */
+	uint16_t load;              /*!< busy_us / period_us, per mille */
+	uint32_t latency[I2C_LATENCY_BINS]; /*!< Requests by latency: < 64, 64-127, ..., 2048-4095, >= 4096 us */
+} i2c_stats_t;
+
+/** @brief Register shadow of a device (storage given by the device driver, managed by I2C_shadow*)
+ */
+typedef struct {
+	uint8_t value[I2C_SHADOW_REGS];             /*!< Known register values */
+	uint32_t cacheable[I2C_SHADOW_REGS / 32];   /*!< Registers that can be kept */
+	uint32_t valid[I2C_SHADOW_REGS / 32];       /*!< Registers with a known value */
+	uint32_t dirty[I2C_SHADOW_REGS / 32];       /*!< Registers not yet written to the device */
+	bool batch;                                 /*!< Writes delayed until commit */
+} i2c_shadow_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -186,6 +251,131 @@ bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr);
  */
 int8_t I2C_requestBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout);
 
+/** @fn I2C_burstRead(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data)
+ * @brief Read multiple bytes starting at a register, in a single transaction
+ * (register selected and data read with a repeated start, no stop in between)
+ * @param devAddr I2C slave device address
+ * @param regAddr First register to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Status of operation (true = success)
+ */
+bool I2C_burstRead(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
+
+/** @fn I2C_addDevice(uint8_t devAddr, uint32_t clockRateHz)
+ * @brief Add a device to the bus (or change its clock, keeping the handle)
+ * @param devAddr I2C slave device address
+ * @param clockRateHz SCL frequency used with this device
+ * @return Device handle, NULL on error
+ */
+i2c_dev_t I2C_addDevice(uint8_t devAddr, uint32_t clockRateHz);
+
+/** @fn I2C_getDevice(uint8_t devAddr)
+ * @brief Device handle of an address (added at the I2C_initialize clock if needed)
+ * @param devAddr I2C slave device address
+ * @return Device handle, NULL on error
+ */
+i2c_dev_t I2C_getDevice(uint8_t devAddr);
+
+/** @fn I2C_setPriority(i2c_dev_t dev, uint8_t priority, bool coalesce)
+ * @brief Scheduling of a device (devices start with priority 0 and no coalescing)
+ * @param dev Device handle
+ * @param priority Higher values are served first
+ * @param coalesce true to merge back-to-back reads of contiguous registers
+ */
+void I2C_setPriority(i2c_dev_t dev, uint8_t priority, bool coalesce);
+
+/** @fn I2C_getStats(i2c_dev_t dev, i2c_stats_t *stats, bool reset)
+ * @brief Bus usage of a device since the last reset
+ * @param dev Device handle, NULL for the sum of all the devices (the period is the longest one)
+ * @param stats Statistics
+ * @param reset true to start a new measurement period
+ */
+void I2C_getStats(i2c_dev_t dev, i2c_stats_t *stats, bool reset);
+
+/** @fn I2C_shadowEnable(i2c_dev_t dev, i2c_shadow_t *shadow)
+ * @brief Enable the register shadow of a device, with no cacheable registers
+ * @param dev Device handle
+ * @param shadow Shadow storage (NULL to disable)
+ */
+void I2C_shadowEnable(i2c_dev_t dev, i2c_shadow_t *shadow);
+
+/** @fn I2C_shadowCacheable(i2c_dev_t dev, uint8_t first, uint8_t last)
+ * @brief Declare a range of registers as cacheable
+ * @param dev Device handle
+ * @param first First register of the range
+ * @param last Last register of the range
+ */
+void I2C_shadowCacheable(i2c_dev_t dev, uint8_t first, uint8_t last);
+
+/** @fn I2C_shadowInvalidate(i2c_dev_t dev)
+ * @brief Forget the shadowed values (e.g. after a device reset), pending writes are dropped
+ * @param dev Device handle
+ */
+void I2C_shadowInvalidate(i2c_dev_t dev);
+
+/** @fn I2C_shadowBegin(i2c_dev_t dev)
+ * @brief Start delaying the writes to cacheable registers
+ * @param dev Device handle
+ */
+void I2C_shadowBegin(i2c_dev_t dev);
+
+/** @fn I2C_shadowCommit(i2c_dev_t dev)
+ * @brief Write the delayed registers (bursts of consecutive registers) and stop delaying
+ * @note Consecutive registers are written in one transaction: the device must auto increment the register address
+ * @param dev Device handle
+ * @return Status of operation (true = success)
+ */
+bool I2C_shadowCommit(i2c_dev_t dev);
+
+/** @fn I2C_devReadRegs(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, uint16_t timeout)
+ * @brief Read multiple bytes starting at a register (write then read, single transaction)
+ * @param dev Device handle
+ * @param regAddr First register to read from
+ * @param data Buffer to store read data in
+ * @param length Number of bytes to read
+ * @param timeout Timeout in milliseconds (0 = I2C_MASTER_TIMEOUT_MS)
+ * @return Status of operation (true = success)
+ */
+bool I2C_devReadRegs(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, uint16_t timeout);
+
+/** @fn I2C_devWriteRegs(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, uint16_t timeout)
+ * @brief Write multiple bytes starting at a register (up to 64 bytes)
+ * @param dev Device handle
+ * @param regAddr First register to write to
+ * @param data Bytes to write
+ * @param length Number of bytes to write
+ * @param timeout Timeout in milliseconds (0 = I2C_MASTER_TIMEOUT_MS)
+ * @return Status of operation (true = success)
+ */
+bool I2C_devWriteRegs(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, uint16_t timeout);
+
+/** @fn I2C_devReadRegsAsync(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param)
+ * @brief Queue a register read, returns without waiting for the transaction
+ * @note data must stay valid until the callback is called
+ * @param dev Device handle
+ * @param regAddr First register to read from
+ * @param data Buffer to store read data in
+ * @param length Number of bytes to read
+ * @param callback Called when the transaction ends (may be NULL)
+ * @param param Pointer passed to the callback
+ * @return false if the queue is full
+ */
+bool I2C_devReadRegsAsync(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param);
+
+/** @fn I2C_devWriteRegsAsync(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param)
+ * @brief Queue a register write (up to 64 bytes), returns without waiting for the transaction
+ * @note data must stay valid until the callback is called
+ * @param dev Device handle
+ * @param regAddr First register to write to
+ * @param data Bytes to write
+ * @param length Number of bytes to write
+ * @param callback Called when the transaction ends (may be NULL)
+ * @param param Pointer passed to the callback
+ * @return false if the queue is full
+ */
+bool I2C_devWriteRegsAsync(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
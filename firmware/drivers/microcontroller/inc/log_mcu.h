@@ -0,0 +1,166 @@
+#ifndef LOG_MCU_H
+#define LOG_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Log Log
+ ** @{ */
+
+/** \brief Deferred logging: messages formatted away from the hot paths.
+ *
+ * printf and ESP_LOG format the message on the caller's thread: a "%f" costs
+ * thousands of cycles and the console write may block. LOG_DEFER only stores
+ * the address of the format string (its id, the string stays in flash) and
+ * the raw arguments, 32 bits each, in a lock-free RAM ring: a few dozen
+ * cycles, from tasks and interrupts alike. A low priority task (LogDeferInit)
+ * formats the entries later and prints them on the console, in order.
+ *
+ * When the ring is full the new entries are dropped and counted; the task
+ * reports how many were lost. LOG_DEFER evaluates to false when its entry was
+ * dropped, so a caller that can wait (e.g. a one-shot dump) may retry.
+ *
+ * Arguments (up to LOG_DEFER_MAX_ARGS):
+ * - integers and characters of up to 32 bits (%d %i %u %x %X %o %c, with the
+ *   h, hh, l and z modifiers)
+ * - float and double, stored as float (%f %e %g %a)
+ * - pointers (%p, cast to void *) and strings (%s): only the pointer is
+ *   stored, so the string must outlive the entry (literals, constant names)
+ *
+ * 64 bit integers (%lld, PRIu64) and '*' widths are not supported.
+ *
+ * @note Compiled only with CONFIG_DRIVERS_LOG_DEFER (menuconfig: Drivers),
+ * the ring length is CONFIG_DRIVERS_LOG_DEFER_ENTRIES. Without it LOG_DEFER
+ * is a plain printf, so it can stay in the code.
+ *
+ * @code
+ * LogDeferInit(1);
+ * ...
+ * LOG_DEFER("sensor %u: %.2f g\r\n", s, accel);		// in the sampling task
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#if !CONFIG_DRIVERS_LOG_DEFER
+#include <stdio.h>
+#include <stdarg.h>
+#endif
+/*==================[macros]=================================================*/
+#define LOG_DEFER_MAX_ARGS		6		/*!< Arguments of one entry */
+
+#if CONFIG_DRIVERS_LOG_DEFER
+/** @cond */
+#define LOG_ARG(x)			_Generic((x),									\
+								float: LogArgFloat, double: LogArgFloat,	\
+								char *: LogArgPtr, const char *: LogArgPtr,	\
+								void *: LogArgPtr, const void *: LogArgPtr,	\
+								default: LogArgInt)(x)
+#define LOG_NARGS(...)		LOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, n, ...)	n
+#define LOG_CAT(a, b)		LOG_CAT_(a, b)
+#define LOG_CAT_(a, b)		a##b
+#define LOG_MAP_0()
+#define LOG_MAP_1(a)					LOG_ARG(a)
+#define LOG_MAP_2(a, b)					LOG_ARG(a), LOG_ARG(b)
+#define LOG_MAP_3(a, b, c)				LOG_MAP_2(a, b), LOG_ARG(c)
+#define LOG_MAP_4(a, b, c, d)			LOG_MAP_3(a, b, c), LOG_ARG(d)
+#define LOG_MAP_5(a, b, c, d, e)		LOG_MAP_4(a, b, c, d), LOG_ARG(e)
+#define LOG_MAP_6(a, b, c, d, e, f)		LOG_MAP_5(a, b, c, d, e), LOG_ARG(f)
+/** @endcond */
+
+/** Store a message for the logging task (printf-like, true if it was stored) */
+#define LOG_DEFER(fmt, ...)	LogDeferRecord((fmt), LOG_NARGS(__VA_ARGS__),						\
+								(const uint32_t[LOG_DEFER_MAX_ARGS]){							\
+									LOG_CAT(LOG_MAP_, LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)})
+#else
+#define LOG_DEFER(fmt, ...)	LogPrintf((fmt), ##__VA_ARGS__)
+#endif
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+#if CONFIG_DRIVERS_LOG_DEFER
+/** @cond */
+static inline uint32_t LogArgInt(uint32_t x){
+	return x;
+}
+
+static inline uint32_t LogArgFloat(float x){
+	union {float f; uint32_t u;} bits = {.f = x};
+	return bits.u;
+}
+
+static inline uint32_t LogArgPtr(const void *x){
+	return (uint32_t)(uintptr_t)x;
+}
+/** @endcond */
+
+/**
+ * @brief Store an entry in the ring (use LOG_DEFER)
+ *
+ * @param fmt	Format string (not copied, its address is the id of the message)
+ * @param n		Number of arguments
+ * @param args	Arguments, 32 bits each
+ * @return true		Stored
+ * @return false	Ring full, the entry was dropped
+ */
+bool LogDeferRecord(const char *fmt, uint8_t n, const uint32_t *args);
+
+/**
+ * @brief Start the task that formats and prints the stored entries
+ *
+ * @param priority	Priority of the logging task (below the tasks that log)
+ * @return true		Started (or already running)
+ * @return false	No memory for the task
+ */
+bool LogDeferInit(uint8_t priority);
+
+/**
+ * @brief Format and print the stored entries on the calling task
+ *
+ * For a dump before a reset or a deep sleep. Does nothing if the logging
+ * task is printing at the same time.
+ */
+void LogDeferFlush(void);
+
+/**
+ * @brief Entries dropped because the ring was full
+ *
+ * @return uint32_t Entries dropped since startup
+ */
+uint32_t LogDeferDropped(void);
+#else
+/** @cond */
+static inline __attribute__((format(printf, 1, 2))) bool LogPrintf(const char *fmt, ...){
+	va_list args;
+	va_start(args, fmt);
+	vprintf(fmt, args);
+	va_end(args);
+	return true;
+}
+/** @endcond */
+
+static inline bool LogDeferInit(uint8_t priority){return true;}
+static inline void LogDeferFlush(void){}
+static inline uint32_t LogDeferDropped(void){return 0;}
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* LOG_MCU_H */
+
+/*==================[end of file]============================================*/
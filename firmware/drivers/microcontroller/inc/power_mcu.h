@@ -0,0 +1,85 @@
+#ifndef POWER_MCU_H
+#define POWER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup POWER Power management
+ ** @{ */
+
+/** \brief Power management driver for the ESP-EDU Board.
+ *
+ * Configures dynamic frequency scaling and automatic light sleep: the CPU
+ * runs at the maximum frequency while some task is ready, drops to the minimum
+ * one when idle and, with light sleep enabled, sleeps until the next FreeRTOS
+ * timeout when no peripheral needs the clocks.
+ * 
+ * @note Requires CONFIG_PM_ENABLE, and CONFIG_FREERTOS_USE_TICKLESS_IDLE for
+ * light sleep, in the project's sdkconfig.
+ * 
+ * @note Drivers hold the chip awake while they need it (e.g. ADC continuous
+ * mode, an enabled gptimer or a BLE connection event), so light sleep only
+ * happens between their activity.
+ *
+ * @note Code that must finish in time (a DSP burst, a display flush) is
+ * enclosed in PowerBurstBegin / PowerBurstEnd: the CPU stays at max_freq_mhz
+ * for the whole burst, also while the task waits for a DMA transfer, and
+ * drops as soon as the last burst ends. Without power management they do
+ * nothing.
+ * 
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Maximum frequency bursts (PowerBurstBegin / PowerBurstEnd)            |
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Power management configuration
+ */
+typedef struct {
+	uint16_t max_freq_mhz;		/*!< CPU frequency while some task is ready (MHz) */
+	uint16_t min_freq_mhz;		/*!< CPU frequency when idle (MHz), usually the XTAL frequency (40 MHz) */
+	bool light_sleep;			/*!< Enter light sleep when idle */
+} power_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+
+/**
+ * @brief Power management initialization.
+ * 
+ * @param config Power management configuration
+ * @return true Configuration applied
+ * @return false Power management not enabled in sdkconfig, or invalid frequencies
+ */
+bool PowerInit(power_config_t *config);
+
+/**
+ * @brief Hold the maximum CPU frequency until PowerBurstEnd (nestable, any task)
+ * 
+ * @note Call PowerInit before the tasks that use bursts are started.
+ */
+void PowerBurstBegin(void);
+
+/**
+ * @brief End a burst: the frequency scaling resumes once every burst ended
+ */
+void PowerBurstEnd(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POWER_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -14,6 +14,10 @@
  * @note It can setup up to 4 PWM outputs, with independet duty 
  * cycle and frequency configuration
  *
+ * @note Duty changes can be done by the LEDC hardware fade (PWMFade): the
+ * duty ramps to the target in the given time with no CPU involvement, and an
+ * optional callback is called (from an interrupt) when the ramp ends.
+ *
  * @author Albano Peñalva
  * 
  * @section changelog
@@ -21,13 +25,16 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 23/01/2024 | Document creation		                         |
+ * | 14/10/2026 | 10 bit duty (PWMSetDuty) and hardware fades    |
  *
  */
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stddef.h>
 #include <gpio_mcu.h>
 /*==================[macros]=================================================*/
+#define PWM_DUTY_MAX	1023	/*!< Full scale duty of PWMSetDuty and PWMFade (10 bits) */
 
 /*==================[typedef]================================================*/
 typedef enum pwm_out {
@@ -74,6 +81,44 @@ void PWMOff(pwm_out_t out);
  */
 void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle);
 
+/**
+ * @brief Change PWM duty of an PWM output, with full resolution
+ * 
+ * @note Stops a fade in progress.
+ * 
+ * @param out PWM output 
+ * @param duty duty (0 to PWM_DUTY_MAX)
+ */
+void PWMSetDuty(pwm_out_t out, uint16_t duty);
+
+/**
+ * @brief Current duty of an PWM output (also during a fade)
+ * 
+ * @param out PWM output 
+ * @return uint16_t duty (0 to PWM_DUTY_MAX)
+ */
+uint16_t PWMGetDuty(pwm_out_t out);
+
+/**
+ * @brief Ramp the duty of an PWM output in hardware (returns immediately)
+ * 
+ * A fade in progress is stopped and the new one starts from the current duty.
+ * 
+ * @param out PWM output 
+ * @param duty Target duty (0 to PWM_DUTY_MAX)
+ * @param time_ms Duration of the ramp (in ms)
+ * @param func_p Function called when the ramp ends, from an interrupt (NULL if not required)
+ * @param param_p Pointer to callback function parameters
+ */
+void PWMFade(pwm_out_t out, uint16_t duty, uint32_t time_ms, void *func_p, void *param_p);
+
+/**
+ * @brief Stop a fade in progress, the duty stays at its current value
+ * 
+ * @param out PWM output 
+ */
+void PWMFadeStop(pwm_out_t out);
+
 /**
  * @brief Change frequency of an PWM output
  * 
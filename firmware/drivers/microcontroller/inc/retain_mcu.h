@@ -0,0 +1,99 @@
+#ifndef RETAIN_MCU_H
+#define RETAIN_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Retain Retain
+ ** @{ */
+
+/** \brief State retained in RTC memory across deep sleep
+ *
+ * The HP RAM is lost in deep sleep, but the RTC (LP) RAM keeps its content.
+ * The application saves its state in records of a RTC memory area before
+ * esp_deep_sleep_start, and loads it back on wake up instead of starting from
+ * scratch (or from the flash, that wears and takes milliseconds to write).
+ *
+ * Each record has an id, its size and a CRC-32 of its content: a record is
+ * loaded only if it was saved with the same size (the same version of the
+ * struct) and the CRC matches. After any reset other than a deep sleep wake
+ * up (power on, brown out, panic, watchdog, software reset) RetainInit
+ * discards every record, so a stale or half written state is never used.
+ *
+ * The area takes CONFIG_DRIVERS_RETAIN_SIZE bytes of RTC RAM (menuconfig,
+ * Drivers); each record takes 8 bytes more than its content, rounded up to 4.
+ *
+ * @code
+ * RetainInit();
+ * if(!RetainLoad(STATE_ID, &state, sizeof(state))){
+ *     StateDefault(&state);
+ * }
+ * ...
+ * RetainSave(STATE_ID, &state, sizeof(state));
+ * esp_deep_sleep_start();
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Keep the records if the chip woke up from deep sleep, discard them otherwise
+ *
+ * Call it once at startup, before RetainLoad.
+ *
+ * @return true		Woke up from deep sleep with a valid area
+ * @return false	Records discarded
+ */
+bool RetainInit(void);
+
+/**
+ * @brief Save a record (replaces the one with the same id)
+ *
+ * @param id		Record id (application defined, 0 is not valid)
+ * @param data		Content
+ * @param size		Bytes of the content
+ * @return true		Saved
+ * @return false	Invalid id, or no room left in the area
+ */
+bool RetainSave(uint16_t id, const void *data, size_t size);
+
+/**
+ * @brief Load a record
+ *
+ * @param id		Record id
+ * @param data		Where the content is copied
+ * @param size		Bytes expected
+ * @return true		Record found, with the same size and a valid CRC
+ * @return false	No valid record (data is not modified)
+ */
+bool RetainLoad(uint16_t id, void *data, size_t size);
+
+/**
+ * @brief Discard every record
+ */
+void RetainClear(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
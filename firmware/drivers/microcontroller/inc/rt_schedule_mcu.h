@@ -0,0 +1,154 @@
+#ifndef RT_SCHEDULE_MCU_H
+#define RT_SCHEDULE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup RT_Schedule RT schedule
+ ** @{ */
+
+/** \brief Central table of the real-time tasks: priorities and schedulability
+ *
+ * The application describes every task in one table: period (the minimum
+ * interval between activations for event driven tasks), relative deadline
+ * and an estimate of the worst case execution time (WCET) of an activation.
+ * RtScheduleInit assigns the priorities (deadline monotonic: the shorter the
+ * deadline, the higher the priority; with deadlines equal to the periods it
+ * is rate monotonic) and checks at boot that every deadline holds:
+ * - utilization U = sum(WCET / period), compared with the Liu & Layland
+ *   bound n (2^(1/n) - 1), under which the set is always schedulable
+ * - worst case response time of each task (response time analysis: its
+ *   WCET plus the activations of the tasks of higher or equal priority that
+ *   may run before it), compared with its deadline
+ *
+ * The result is logged, and each task that misses its deadline is logged as a warning.
+ *
+ * Tasks are found by name: TaskCreateStored (rtos_alloc_mcu.h), and so the
+ * tasks of the drivers (Bluetooth, UART), takes the priority of the table
+ * instead of its own default, and RtSchedulePriority gives it to the tasks
+ * created with xTaskCreate (names are compared up to the length FreeRTOS
+ * keeps, configMAX_TASK_NAME_LEN - 1). Call RtScheduleInit first in app_main, before
+ * the drivers create their tasks. Entries with a priority other than 0 keep
+ * it (tasks whose priority can't change, e.g. ESP-IDF ones) and only take part
+ * in the analysis.
+ *
+ * The task profiler (task_profiler.h) prints the estimated load of each task
+ * next to the measured one, and warns when a task runs longer than its WCET
+ * allows.
+ *
+ * @note Interrupts, tasks out of the table (ESP-IDF, Bluetooth controller)
+ * and the tick (tasks blocked on a timeout wake up on a tick) are not part of
+ * the analysis: keep the priorities of the table below those of ESP-IDF
+ * (esp_timer is at 22) and leave margin below 100 %.
+ *
+ * @code
+ * static rt_task_t plan[] = {
+ *     {.name = "Sampling", .period_us = 5000, .wcet_us = 800},
+ *     {.name = "Display", .period_us = 200000, .wcet_us = 30000},
+ *     {.name = "bluetooth_events", .period_us = 20000, .deadline_us = 20000, .wcet_us = 500},
+ * };
+ * RtScheduleInit(plan, sizeof(plan) / sizeof(plan[0]), 1, 12);
+ * xTaskCreate(Sampling, "Sampling", 3072, NULL, RtSchedulePriority("Sampling", 5), NULL);
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define RT_SCHEDULE_MAX_TASKS	16			/*!< Tasks in the table */
+#define RT_SCHEDULE_UNBOUNDED	UINT32_MAX	/*!< Response time that grows beyond the deadline */
+/*==================[typedef]================================================*/
+/**
+ * @brief Task of the schedule
+ */
+typedef struct {
+	const char *name;			/*!< Task name, as given to xTaskCreate (constant, not copied) */
+	uint32_t period_us;			/*!< Period, or minimum interval between activations (us) */
+	uint32_t deadline_us;		/*!< Relative deadline (us), 0: the period */
+	uint32_t wcet_us;			/*!< Worst case execution time of an activation, estimated (us) */
+	uint8_t priority;			/*!< 0: assigned by RtScheduleInit, otherwise kept */
+	uint32_t response_us;		/*!< Worst case response time, from RtScheduleInit (us) */
+} rt_task_t;
+
+/**
+ * @brief Result of the analysis
+ */
+typedef struct {
+	uint16_t utilization;		/*!< Sum of WCET / period (tenths of %) */
+	uint16_t bound;				/*!< Liu & Layland bound for the number of tasks (tenths of %) */
+	uint8_t n_tasks;			/*!< Tasks in the table */
+	uint8_t misses;				/*!< Tasks whose response time exceeds the deadline */
+} rt_schedule_summary_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Assign the priorities, check the deadlines and log the result
+ *
+ * Distinct deadlines get distinct priorities, from highest down; when there
+ * are more deadlines than priorities the rest share the lowest one.
+ *
+ * @param tasks		Table of tasks (kept by the module, not copied)
+ * @param n			Number of tasks (up to RT_SCHEDULE_MAX_TASKS)
+ * @param lowest	Lowest priority to assign (above the idle task, 0)
+ * @param highest	Highest priority to assign
+ * @return true		Every deadline holds
+ * @return false	Invalid table, or some task may miss its deadline
+ */
+bool RtScheduleInit(rt_task_t *tasks, uint8_t n, uint8_t lowest, uint8_t highest);
+
+/**
+ * @brief Priority of a task
+ *
+ * @param name		Task name
+ * @param priority	Priority if the task is not in the table
+ * @return uint8_t	Priority assigned by RtScheduleInit, or the one given
+ */
+uint8_t RtSchedulePriority(const char *name, uint8_t priority);
+
+/**
+ * @brief Find a task of the table
+ *
+ * @param name		Task name
+ * @return const rt_task_t*	Task, NULL if it is not in the table
+ */
+const rt_task_t *RtScheduleFind(const char *name);
+
+/**
+ * @brief Estimated load of a task, WCET / period
+ *
+ * @param task		Task of the table
+ * @return uint16_t	Load (tenths of %)
+ */
+uint16_t RtScheduleLoad(const rt_task_t *task);
+
+/**
+ * @brief Get the result of the analysis
+ *
+ * @param summary	Pointer to the struct where the result is copied
+ * @return true		Result copied
+ * @return false	RtScheduleInit was not called
+ */
+bool RtScheduleGetSummary(rt_schedule_summary_t *summary);
+
+/**
+ * @brief Print the table, with priorities and response times, on the console
+ */
+void RtSchedulePrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -7,17 +7,12 @@
 /** \addtogroup RTC Real Time Clock
  ** @{ */
 
-/** \brief GPIO driver for the ESP-EDU Board.
+/** \brief Real time clock driver for the ESP-EDU Board.
  *
- * This driver provide functions to configure and handle the ESP-EDU General
- * Purpose Input-Outputs .
- * 
- * @note GPIO_4 and GPIO_15 are connected to ESP-EDU switches (only GPIO_15 is available in headers)
- * 
- * @note GPIO_5, GPIO_10 and GPIO_11 are connected to ESP-EDU LEDs.
- * 
- * @note GPIO_12 and GPIO_13 are not recommended for use, because using them will
- * overwrite the flash and debug functionalities via USB.
+ * Date and time are kept as an offset of the monotonic time base
+ * (timestamp_mcu.h): RtcConfig sets it and RtcRead converts it to a date,
+ * computing the calendar at most once per second. To stamp samples or events
+ * use TimestampUs and convert only when showing them.
  * 
  * @author Albano Peñalva
  *
@@ -26,6 +21,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 15/10/2026 | Wall clock over the monotonic time base, cached calendar				|
  * 
  **/
 
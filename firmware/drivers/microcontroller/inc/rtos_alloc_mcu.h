@@ -0,0 +1,145 @@
+#ifndef RTOS_ALLOC_MCU_H
+#define RTOS_ALLOC_MCU_H
+
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup RTOS_Alloc RTOS allocation
+ ** @{ */
+
+/** \brief Tasks and queues with their storage fixed at link time
+ *
+ * TASK_STORAGE_DEFINE and QUEUE_STORAGE_DEFINE declare the stack, control
+ * block and queue storage of a task or queue; TaskCreateStored and
+ * QueueCreateStored create it. With CONFIG_DRIVERS_STATIC_ALLOCATION
+ * (menuconfig, Drivers) they use xTaskCreateStatic and xQueueCreateStatic
+ * on that storage: the memory is counted in the static RAM of the image
+ * (see the mem_report target) and nothing is taken from the heap at startup.
+ * Otherwise only the sizes are kept and the heap is used as before.
+ *
+ * @note A task listed in the schedule table (rt_schedule_mcu.h) is created
+ * with the priority assigned there instead of the one given.
+ * @note Each storage holds one task or queue at a time: a task created on it
+ * must have deleted itself before the storage is used again.
+ * @note Stack sizes are in bytes (as xTaskCreate in ESP-IDF). Check the
+ * margin left with the task profiler (stack_free in TaskProfilerGetReport) before
+ * reducing them.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Priorities from the schedule table (RtSchedulePriority)				|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "rt_schedule_mcu.h"
+/*==================[macros]=================================================*/
+#if CONFIG_DRIVERS_STATIC_ALLOCATION
+/**
+ * @brief Define the stack and control block of a task
+ *
+ * @param name          Storage variable name
+ * @param bytes         Stack size (in bytes)
+ */
+#define TASK_STORAGE_DEFINE(name, bytes)                                                \
+    static StackType_t name##_stack[((bytes) + sizeof(StackType_t) - 1) / sizeof(StackType_t)]; \
+    static StaticTask_t name##_tcb;                                                     \
+    static const task_storage_t name = {                                                \
+        .stack = name##_stack,                                                          \
+        .stack_bytes = sizeof(name##_stack),                                            \
+        .tcb = &name##_tcb,                                                             \
+    }
+/**
+ * @brief Define the item storage and control block of a queue
+ *
+ * @param name          Storage variable name
+ * @param n_items       Number of items
+ * @param size          Size of each item (in bytes)
+ */
+#define QUEUE_STORAGE_DEFINE(name, n_items, size)                                       \
+    static uint8_t name##_items[(n_items) * (size)];                                    \
+    static StaticQueue_t name##_qcb;                                                    \
+    static const queue_storage_t name = {                                               \
+        .items = name##_items,                                                          \
+        .length = (n_items),                                                            \
+        .item_size = (size),                                                            \
+        .qcb = &name##_qcb,                                                             \
+    }
+#else
+#define TASK_STORAGE_DEFINE(name, bytes)                                                \
+    static const task_storage_t name = {.stack = NULL, .stack_bytes = (bytes), .tcb = NULL}
+#define QUEUE_STORAGE_DEFINE(name, n_items, size)                                       \
+    static const queue_storage_t name = {.items = NULL, .length = (n_items), .item_size = (size), .qcb = NULL}
+#endif
+/*==================[typedef]================================================*/
+/**
+ * @brief Task storage (use TASK_STORAGE_DEFINE to create one)
+ */
+typedef struct {
+    StackType_t *stack;         /*!< Stack (NULL: taken from the heap) */
+    uint32_t stack_bytes;       /*!< Stack size (in bytes) */
+    StaticTask_t *tcb;          /*!< Task control block */
+} task_storage_t;
+/**
+ * @brief Queue storage (use QUEUE_STORAGE_DEFINE to create one)
+ */
+typedef struct {
+    uint8_t *items;             /*!< Item storage (NULL: taken from the heap) */
+    UBaseType_t length;         /*!< Number of items */
+    UBaseType_t item_size;      /*!< Size of each item (in bytes) */
+    StaticQueue_t *qcb;         /*!< Queue control block */
+} queue_storage_t;
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Create a task on its storage
+ *
+ * @param storage   Task storage
+ * @param func      Task function
+ * @param name      Task name
+ * @param param     Task parameter
+ * @param priority  Task priority, if the task is not in the schedule table
+ * @param handle    Task handle (can be NULL)
+ * @return pdPASS if the task was created
+ */
+static inline BaseType_t TaskCreateStored(const task_storage_t *storage, TaskFunction_t func, const char *name,
+                                          void *param, UBaseType_t priority, TaskHandle_t *handle){
+    priority = RtSchedulePriority(name, priority);
+#if CONFIG_DRIVERS_STATIC_ALLOCATION
+    TaskHandle_t task = xTaskCreateStatic(func, name, storage->stack_bytes, param, priority, storage->stack, storage->tcb);
+    if(handle != NULL){
+        *handle = task;
+    }
+    return (task != NULL) ? pdPASS : pdFAIL;
+#else
+    return xTaskCreate(func, name, storage->stack_bytes, param, priority, handle);
+#endif
+}
+
+/**
+ * @brief Create a queue on its storage
+ *
+ * @param storage   Queue storage
+ * @return Queue handle (NULL if it could not be created)
+ */
+static inline QueueHandle_t QueueCreateStored(const queue_storage_t *storage){
+#if CONFIG_DRIVERS_STATIC_ALLOCATION
+    return xQueueCreateStatic(storage->length, storage->item_size, storage->items, storage->qcb);
+#else
+    return xQueueCreate(storage->length, storage->item_size);
+#endif
+}
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
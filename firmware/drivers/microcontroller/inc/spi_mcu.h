@@ -14,6 +14,12 @@
  * 
  * @note MISO: GPIO_22, MOSI: GPIO_21, SCLK: GPIO_20, CS1: GPIO_19, CS2: GPIO_18, CS3: GPIO_9
  * 
+ * @note Each device counts its transactions, bytes and bus time, the time its
+ * callers were blocked and a histogram of the bus time of the transactions
+ * (SpiGetStats). Transactions of up to 4 bytes are counted apart as commands,
+ * so e.g. the command overhead of a display can be told from its pixel data.
+ * The counters are always on (a few instructions per transaction).
+ * 
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,12 +27,18 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 09/02/2024 | Document creation		                         						|
+ * | 14/10/2026 | Queued (non blocking) writes                                          |
+ * | 14/10/2026 | Transfers up to 4 bytes without DMA                                   |
+ * | 15/10/2026 | Bus usage counters and transaction time histogram (SpiGetStats)       |
+ * | 15/10/2026 | Write only devices above 26MHz (no dummy cycle check)                 |
  * 
  **/
 /*==================[inclusions]=============================================*/
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
+#define SPI_QUEUE_SIZE	8		/*!< Transactions that can be queued on each device */
+#define SPI_TIME_BINS	8		/*!< Bins of the transaction time histogram */
 
 /*==================[typedef]================================================*/
 
@@ -64,11 +76,24 @@ typedef enum {
 typedef struct{
 	spi_dev_t device;				/*!< SPI device number */
 	clk_mode_t clk_mode;			/*!< Mode: phase and polarity */
-	uint32_t bitrate;				/*!< Transfer speed (up to 26MHz) */
+	uint32_t bitrate;				/*!< Transfer speed (up to 26MHz, 40MHz for write only devices) */
 	transfer_mode_t transfer_mode;	/*!< Transfer mode */
 	void *func_p;					/*!< Pointer to callback function for transaction end */
 	void *param_p;					/*!< Pointer to callback parameter */
 } spi_mcu_config_t;
+/**
+ * @brief Bus usage of a device
+ */
+typedef struct {
+	uint32_t transactions;				/*!< Transactions run on the bus */
+	uint32_t commands;					/*!< Transactions of up to 4 bytes (commands and parameters) */
+	uint32_t bytes;						/*!< Data bytes transferred */
+	uint32_t busy_us;					/*!< Bus time used (from the start to the end of each transaction) */
+	uint32_t blocked_us;				/*!< Time the callers waited for their transactions */
+	uint32_t period_us;					/*!< Time since the statistics were reset */
+	uint16_t load;						/*!< busy_us / period_us, per mille */
+	uint32_t time[SPI_TIME_BINS];		/*!< Transactions by bus time: < 8, 8-15, 16-31, ..., >= 512 us */
+} spi_stats_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -108,6 +133,49 @@ void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size);
  */
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size);
 
+/**
+ * @brief Queue a write on SPI port, without waiting for it to end
+ * 
+ * @note tx_buffer must be DMA capable and must not be modified until the
+ * transaction ends (see SpiWait and SpiWaitAll). Writes of up to 4 bytes are
+ * copied into the transaction, so their buffer can be reused at once. If
+ * SPI_QUEUE_SIZE transactions are already queued, waits for the oldest one to end.
+ * 
+ * @param device SPI device to write to
+ * @param tx_buffer pointer to buffer where data is stored
+ * @param tx_buffer_size numbers of bytes to write (up to 4092)
+ * @return true 	Transaction queued
+ * @return false 	Transaction could not be queued
+ */
+bool SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size);
+
+/**
+ * @brief Wait until no more than max_pending queued transactions are left.
+ * Transactions end in the order they were queued.
+ * 
+ * @param device SPI device
+ * @param max_pending number of queued transactions that may still be running
+ */
+void SpiWait(spi_dev_t device, uint8_t max_pending);
+
+/**
+ * @brief Wait until every queued transaction ends
+ * 
+ * @note SpiRead, SpiWrite and SpiReadWrite call it before transmitting.
+ * 
+ * @param device SPI device
+ */
+void SpiWaitAll(spi_dev_t device);
+
+/**
+ * @brief Bus usage of a device since the last reset
+ * 
+ * @param device SPI device
+ * @param stats pointer to the struct where the statistics are copied
+ * @param reset true to start a new measurement period
+ */
+void SpiGetStats(spi_dev_t device, spi_stats_t *stats, bool reset);
+
 /**
  * @brief De-Initialize SPI module with the corresponding configuration
  * 
@@ -9,6 +9,23 @@
  ** @{ */
 
 /** \brief Timer driver for the ESP-EDU Board.
+ * 
+ * All the timers are software timers multiplexed over a single gptimer: a
+ * free running 1 MHz counter whose alarm is always programmed at the nearest
+ * deadline. Any number of one-shot or periodic soft timers (soft_timer_t,
+ * allocated by the caller) can be started, from tasks or from interrupts
+ * (including from the callbacks of other soft timers). TIMER_A, TIMER_B and
+ * TIMER_C are kept as periodic soft timers with the original API.
+ * 
+ * @note Callbacks run in the interrupt of the shared gptimer, one after the
+ * other when several deadlines coincide; they must be short (e.g. notify a
+ * task) and placed in IRAM. Longer work can be run in a worker task by
+ * passing DeferIsr as the callback (defer_mcu.h).
+ * 
+ * @note The gptimer holds a PM lock that prevents light sleep while it is
+ * enabled, so it is only enabled (and counting) while some soft timer is
+ * active. A soft timer started from an interrupt while none is active waits
+ * for the FreeRTOS timer task to enable it: its delay is counted from then.
  * 
  * @author Albano Peñalva
  *
@@ -17,11 +34,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/10/2023 | Document creation		                         						|
+ * | 14/10/2026 | Soft timers multiplexed over one gptimer								|
+ * | 15/10/2026 | gptimer disabled (no PM lock) while no soft timer is active			|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 
 /*==================[typedef]================================================*/
@@ -42,6 +62,17 @@ typedef struct {
 	void *func_p;			/*!< Pointer to callback function to call periodically */
 	void *param_p;			/*!< Pointer to callback function parameter */
 } timer_config_t;
+/**
+ * @brief Soft timer (allocated by the caller, initialized with SoftTimerInit)
+ */
+typedef struct soft_timer_s {
+	uint64_t deadline;				/*!< Next expiration (us, shared counter) */
+	uint32_t period;				/*!< Reload period (in us), 0 for one-shot */
+	void (*func_p)(void*);			/*!< Callback function */
+	void *param_p;					/*!< Callback function parameter */
+	struct soft_timer_s *next;		/*!< Next soft timer by deadline */
+	bool active;					/*!< Scheduled */
+} soft_timer_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -98,6 +129,50 @@ void TimerReset(timer_mcu_t timer);
  */
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period);
 
+/**
+ * @brief Soft timer initialization (stopped)
+ * 
+ * @param soft_timer Soft timer
+ * @param func_p Callback function, called from the timer interrupt
+ * @param param_p Callback function parameter
+ */
+void SoftTimerInit(soft_timer_t *soft_timer, void (*func_p)(void*), void *param_p);
+
+/**
+ * @brief Schedule a soft timer (restarts it if already scheduled)
+ * 
+ * @note Can be called from interrupts and from soft timer callbacks.
+ * 
+ * @param soft_timer Soft timer
+ * @param delay First expiration, from now (in us)
+ * @param period Reload period (in us), 0 for one-shot
+ */
+void SoftTimerStart(soft_timer_t *soft_timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief Cancel a soft timer
+ * 
+ * @note Can be called from interrupts and from soft timer callbacks.
+ * 
+ * @param soft_timer Soft timer
+ */
+void SoftTimerStop(soft_timer_t *soft_timer);
+
+/**
+ * @brief Time until the next expiration of a soft timer
+ * 
+ * @param soft_timer Soft timer
+ * @return uint32_t Time (in us), 0 if it is not scheduled
+ */
+uint32_t SoftTimerRemaining(soft_timer_t *soft_timer);
+
+/**
+ * @brief Current value of the shared counter
+ * 
+ * @return uint64_t Time counted while some soft timer was active (in us)
+ */
+uint64_t SoftTimerNow(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,137 @@
+#ifndef TIMESTAMP_MCU_H
+#define TIMESTAMP_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup TIMESTAMP Timestamp
+ ** @{ */
+
+/** \brief Monotonic time base shared by drivers, middleware and applications.
+ *
+ * TimestampUs is a 64 bit microsecond clock from boot (esp_timer): it never
+ * goes back nor wraps, it keeps counting in light sleep and it can be read
+ * from tasks and interrupts at the cost of a couple of register reads.
+ * Samples, events and logs stamped with it can be compared with each other
+ * directly.
+ *
+ * The wall clock is kept as an offset from that base, set once (RtcConfig
+ * or TimestampSetEpoch): a timestamp is converted to date and time only when
+ * it is shown, instead of reading the calendar with every sample.
+ *
+ * @code
+ * int64_t t = TimestampUs();            // stamp the sample
+ * ...
+ * int64_t epoch_us = TimestampToEpochUs(t);   // only to show it
+ * @endcode
+ *
+ * Boards sampling together share a second time base, the sync time, kept by
+ * a time synchronization protocol (e.g. time_sync.h) as the local time plus an
+ * offset and a rate correction (the crystals of two boards differ by tens of
+ * ppm, tens of microseconds per second). TimestampSyncAdjust takes each new
+ * estimate: the first one (or an error above TIMESTAMP_STEP_US) steps the sync
+ * time, the next ones are slewed, corrected over TIMESTAMP_SLEW_US with a rate
+ * change of up to TIMESTAMP_RATE_MAX_PPB, so the sync time doesn't go back
+ * nor jump between two samples. Before the first estimate it is the local time.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Sync time shared between boards, slewed with offset and drift        	|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TIMESTAMP_STEP_US       500         /*!< Sync time errors above this are stepped instead of slewed */
+#define TIMESTAMP_SLEW_US       1000000     /*!< Time over which a sync time error is slewed */
+#define TIMESTAMP_RATE_MAX_PPB  500000      /*!< Largest rate correction of the sync time (drift plus slew) */
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Monotonic time from boot (task or ISR)
+ *
+ * @return int64_t Microseconds
+ */
+int64_t TimestampUs(void);
+
+/**
+ * @brief Monotonic time from boot, in milliseconds (wraps after 49 days)
+ *
+ * @return uint32_t Milliseconds
+ */
+uint32_t TimestampMs(void);
+
+/**
+ * @brief Set the wall clock: the current time is epoch_us
+ *
+ * @param epoch_us Microseconds since 01/01/1970 00:00:00
+ */
+void TimestampSetEpoch(int64_t epoch_us);
+
+/**
+ * @brief The wall clock was set since boot
+ *
+ * @return true TimestampSetEpoch was called
+ * @return false The epoch counts from boot
+ */
+bool TimestampEpochValid(void);
+
+/**
+ * @brief Convert a timestamp to wall clock time (task or ISR)
+ *
+ * @param timestamp_us Timestamp from TimestampUs
+ * @return int64_t Microseconds since 01/01/1970 00:00:00 (since boot if the
+ * wall clock was not set)
+ */
+int64_t TimestampToEpochUs(int64_t timestamp_us);
+
+/**
+ * @brief New estimate of the sync time
+ *
+ * @param timestamp_us Timestamp (TimestampUs) at which the offset was measured
+ * @param offset_us Sync time minus local time at timestamp_us
+ * @param drift_ppb Rate of the sync time relative to the local time, in parts
+ * per billion (positive: the sync clock runs faster)
+ */
+void TimestampSyncAdjust(int64_t timestamp_us, int64_t offset_us, int32_t drift_ppb);
+
+/**
+ * @brief The sync time was set since boot
+ *
+ * @return true TimestampSyncAdjust was called
+ * @return false The sync time is the local time
+ */
+bool TimestampSyncValid(void);
+
+/**
+ * @brief Convert a timestamp to sync time (task or ISR)
+ *
+ * @param timestamp_us Timestamp from TimestampUs
+ * @return int64_t Sync time in microseconds (local time if not synchronized)
+ */
+int64_t TimestampToSyncUs(int64_t timestamp_us);
+
+/**
+ * @brief Current sync time (task or ISR)
+ *
+ * @return int64_t Microseconds
+ */
+int64_t TimestampSyncUs(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TIMESTAMP_MCU_H */
+
+/*==================[end of file]============================================*/
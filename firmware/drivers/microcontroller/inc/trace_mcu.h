@@ -0,0 +1,194 @@
+#ifndef TRACE_MCU_H
+#define TRACE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Trace Trace
+ ** @{ */
+
+/** \brief Trace points for interrupt and task timing.
+ *
+ * Trace points (TRACE_INSTANT, TRACE_BEGIN, TRACE_END) write 8 byte events,
+ * stamped with the CPU cycle counter, in a RAM ring. The write is lock-free
+ * (one atomic increment reserves the slot), so trace points can be placed in
+ * interrupts and tasks alike; when the ring is full the oldest events are
+ * overwritten. The recorded events are analyzed on the target (TraceLatency)
+ * or dumped on the console (TraceDump) in the Chrome JSON trace format, which
+ * Perfetto (ui.perfetto.dev) and chrome://tracing open: each event id is a
+ * track, with its instants and begin/end slices.
+ *
+ * The drivers have trace points in their interrupts:
+ *
+ * | id                | where                      | kind        | arg                         |
+ * |:-----------------:|:---------------------------|:-----------:|:----------------------------|
+ * | TRACE_TIMER       | soft timer callbacks       | begin / end | delay from the deadline (us) |
+ * | TRACE_GPIO        | GPIO interrupts (GPIOActivInt) | instant | pin                         |
+ * | TRACE_SPI         | SPI post transfer callbacks | instant    | device                      |
+ * | TRACE_ADC         | ADC continuous frame done  | instant     | 0                           |
+ * | TRACE_AUDIO       | audio output block sent    | instant     | block number                |
+ *
+ * Applications use the ids from TRACE_ID_USER on and name them with TraceName.
+ *
+ * @note Compiled only with CONFIG_DRIVERS_TRACE (menuconfig: Drivers), the
+ * ring length is CONFIG_DRIVERS_TRACE_EVENTS. Without it the trace points
+ * expand to nothing and the functions are empty, so they can stay in the code.
+ * Times are computed from the cycle counter at the CPU frequency of the dump:
+ * events more than 2^31 cycles apart (13 s at 160 MHz) lose their relative
+ * time, and dynamic frequency scaling must be disabled while tracing.
+ *
+ * @code
+ * TraceName(TRACE_ID_USER, "dac");
+ * ...
+ * TRACE_INSTANT(TRACE_ID_USER, sample);		// in the timer callback
+ * ...
+ * trace_latency_t period;
+ * TraceStop();
+ * TraceLatency(TRACE_ID_USER, TRACE_ID_USER, 130000, &period);	// jitter of the 125 us period
+ * TraceDump();
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Audio output trace point                                              |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#if CONFIG_DRIVERS_TRACE
+#include "freertos/FreeRTOS.h"
+#include "esp_cpu.h"
+#endif
+/*==================[macros]=================================================*/
+#define TRACE_TIMER			0x01	/*!< Soft timer callback (timer_mcu) */
+#define TRACE_GPIO			0x02	/*!< GPIO interrupt (gpio_mcu) */
+#define TRACE_SPI			0x03	/*!< SPI transfer done (spi_mcu) */
+#define TRACE_ADC			0x04	/*!< ADC continuous frame done (analog_io_mcu) */
+#define TRACE_AUDIO			0x05	/*!< Audio output block sent (audio_out_mcu) */
+#define TRACE_ID_USER		0x10	/*!< First id for the application */
+
+#define TRACE_PHASE_INSTANT	0		/*!< Instant event */
+#define TRACE_PHASE_BEGIN	1		/*!< Start of a slice */
+#define TRACE_PHASE_END		2		/*!< End of a slice */
+#define TRACE_FLAG_ISR		0x80	/*!< Event recorded in an interrupt */
+
+#if CONFIG_DRIVERS_TRACE
+#define TRACE_INSTANT(id, arg)	TraceRecord((id), TRACE_PHASE_INSTANT, (arg))	/*!< Record an instant event */
+#define TRACE_BEGIN(id, arg)	TraceRecord((id), TRACE_PHASE_BEGIN, (arg))		/*!< Record the start of a slice */
+#define TRACE_END(id, arg)		TraceRecord((id), TRACE_PHASE_END, (arg))		/*!< Record the end of a slice */
+#else
+#define TRACE_INSTANT(id, arg)	((void)0)
+#define TRACE_BEGIN(id, arg)	((void)0)
+#define TRACE_END(id, arg)		((void)0)
+#endif
+/*==================[typedef]================================================*/
+/**
+ * @brief Event of the ring
+ */
+typedef struct {
+	uint32_t cycles;			/*!< CPU cycle counter */
+	uint8_t id;					/*!< Trace point id */
+	uint8_t flags;				/*!< Phase and TRACE_FLAG_ISR */
+	uint16_t arg;				/*!< Argument of the trace point */
+} trace_event_t;
+
+/**
+ * @brief Latency statistics (TraceLatency)
+ */
+typedef struct {
+	uint32_t count;				/*!< Measured intervals */
+	uint32_t min_ns;			/*!< Minimum (ns) */
+	uint32_t mean_ns;			/*!< Mean (ns) */
+	uint32_t max_ns;			/*!< Maximum (ns) */
+	uint32_t over;				/*!< Intervals longer than the deadline */
+} trace_latency_t;
+/*==================[external data declaration]==============================*/
+#if CONFIG_DRIVERS_TRACE
+extern trace_event_t trace_events[CONFIG_DRIVERS_TRACE_EVENTS];
+extern uint32_t trace_head;
+extern volatile bool trace_enabled;
+#endif
+/*==================[external functions declaration]=========================*/
+#if CONFIG_DRIVERS_TRACE
+/**
+ * @brief Record an event (use the TRACE_ macros)
+ *
+ * About 20 instructions: a slot is reserved with an atomic increment, so an
+ * interrupt between the reservation and the write keeps its own slot.
+ */
+static inline void TraceRecord(uint8_t id, uint8_t phase, uint16_t arg){
+	if(!trace_enabled){
+		return;
+	}
+	uint32_t slot = __atomic_fetch_add(&trace_head, 1, __ATOMIC_RELAXED) & (CONFIG_DRIVERS_TRACE_EVENTS - 1);
+	trace_event_t *event = &trace_events[slot];
+	event->cycles = esp_cpu_get_cycle_count();
+	event->id = id;
+	event->flags = phase | (xPortInIsrContext() ? TRACE_FLAG_ISR : 0);
+	event->arg = arg;
+}
+
+/**
+ * @brief Name a trace point id (shown as the track name in the dump)
+ *
+ * @param id	Trace point id
+ * @param name	Name (string constant, not copied)
+ */
+void TraceName(uint8_t id, const char *name);
+
+/**
+ * @brief Clear the ring and start recording (recording starts enabled)
+ */
+void TraceStart(void);
+
+/**
+ * @brief Stop recording, keeping the events
+ */
+void TraceStop(void);
+
+/**
+ * @brief Latency between two trace points
+ *
+ * For each event of "to", the time since the last previous event of "from".
+ * With from == to, the interval between consecutive events (period jitter).
+ *
+ * @note Stop the recording first (TraceStop).
+ *
+ * @param from			Trace point where the interval starts
+ * @param to			Trace point where the interval ends
+ * @param deadline_ns	Intervals longer than this are counted as over
+ * @param stats			Pointer to the struct where the statistics are stored
+ * @return true			At least one interval measured
+ * @return false		No pair of events found
+ */
+bool TraceLatency(uint8_t from, uint8_t to, uint32_t deadline_ns, trace_latency_t *stats);
+
+/**
+ * @brief Print the recorded events in Chrome JSON trace format on the console
+ *
+ * Stops the recording. Save the lines from the opening to the closing brace
+ * as a .json file and open it in ui.perfetto.dev.
+ */
+void TraceDump(void);
+#else
+static inline void TraceName(uint8_t id, const char *name){}
+static inline void TraceStart(void){}
+static inline void TraceStop(void){}
+static inline bool TraceLatency(uint8_t from, uint8_t to, uint32_t deadline_ns, trace_latency_t *stats){return false;}
+static inline void TraceDump(void){}
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TRACE_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -9,6 +9,13 @@
  ** @{ */
 
 /** \brief UART driver for the ESP-EDU Board.
+ *
+ * @note Streaming mode (UartStreamInit): the port gets a large RX ring (bytes
+ * are moved from the FIFO by the driver interrupt every 64 bytes) and a task
+ * that reads it in chunks into UART_STREAM_CHUNKS buffers. Each record (a raw
+ * chunk, a line or a fixed length frame) is handed to the callback, or kept
+ * until borrowed with UartStreamBorrow, without copying it again.
+ * UartStreamWrite queues any number of bytes on a TX ring.
  * 
  * @author Albano Peñalva
  *
@@ -17,13 +24,18 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 02/07/2024 | Document creation		                         						|
+ * | 14/10/2026 | Streaming mode: RX ring, borrowed records, line/frame callbacks		|
+ * | 15/10/2026 | Static task and queue storage (CONFIG_DRIVERS_STATIC_ALLOCATION)		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 #define UART_NO_INT	0		/*!< Flag used when no reading interruption is required */
+#define UART_STREAM_CHUNKS		4		/*!< Record buffers of each streaming port */
+#define UART_STREAM_CHUNK_SIZE	256		/*!< Size of a record buffer (maximum line or frame length) */
 /*==================[typedef]================================================*/
 /**
  * @brief List of UART ports available in ESP-EDU
@@ -41,6 +53,31 @@ typedef struct {
 	void *func_p;			/*!< Pointer to callback function to call when receiving data (= UART_NO_INT if not requiered)*/
 	void *param_p;			/*!< Pointer to callback function parameters */
 } serial_config_t;
+/**
+ * @brief How the received stream is split in records
+ */
+typedef enum {
+	UART_STREAM_RAW,		/*!< Chunks as they arrive */
+	UART_STREAM_LINE,		/*!< Lines ended by a delimiter (not included, empty lines dropped) */
+	UART_STREAM_FRAME,		/*!< Frames of fixed length */
+} uart_stream_mode_t;
+/**
+ * @brief Function called with each received record (from the stream task, the buffer is reused on return)
+ */
+typedef void (*uart_stream_cb_t)(const uint8_t *data, uint16_t length, void *param);
+/**
+ * @brief Streaming serial port configuration struct
+ */
+typedef struct {
+	uart_mcu_port_t port;	/*!< port */
+	uint32_t baud_rate;		/*!< baudrate (bits per second) */
+	uart_stream_mode_t mode;	/*!< record splitting */
+	uint8_t delimiter;		/*!< line delimiter (UART_STREAM_LINE) */
+	uint16_t frame_length;	/*!< frame length (UART_STREAM_FRAME, up to UART_STREAM_CHUNK_SIZE) */
+	uint32_t rx_ring;		/*!< RX ring size in bytes (0: 8192) */
+	uart_stream_cb_t func_p;	/*!< Function called with each record (NULL to borrow them with UartStreamBorrow) */
+	void *param_p;			/*!< Pointer to callback function parameters */
+} serial_stream_config_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -95,11 +132,53 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
  * @param data Pointer to array of data to be transmitted
  * @param nbytes Number of bytes to be sended
  */
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes);
+
+/**
+ * @brief Serial port initialization in streaming mode (instead of UartInit)
+ * 
+ * @param stream_config 
+ * @return true on success
+ */
+bool UartStreamInit(serial_stream_config_t *stream_config);
+
+/**
+ * @brief Take the next received record, without copying it
+ * 
+ * @note The record must be given back with UartStreamRelease (reception stops when all buffers are borrowed)
+ * 
+ * @param port Streaming port
+ * @param data Pointer to the record (NULL if there is none)
+ * @param timeout_ms Maximum wait for a record
+ * @return uint16_t Record length (0 if there is none)
+ */
+uint16_t UartStreamBorrow(uart_mcu_port_t port, const uint8_t **data, uint32_t timeout_ms);
+
+/**
+ * @brief Give back a borrowed record
+ * 
+ * @param port Streaming port
+ * @param data Pointer returned by UartStreamBorrow
+ */
+void UartStreamRelease(uart_mcu_port_t port, const uint8_t *data);
+
+/**
+ * @brief Queue bytes for transmission on a streaming port (waits while the TX ring is full)
+ * 
+ * @param port Streaming port
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended
+ * @return uint16_t Bytes queued
+ */
+uint16_t UartStreamWrite(uart_mcu_port_t port, const uint8_t *data, uint16_t nbytes);
 
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
+ * @note Returns a static buffer, overwritten by the next call: not reentrant.
+ * Where several tasks format text use FmtUint (middelware text_format), which
+ * writes into a buffer given by the caller.
+ * 
  * @param val Number to be converted
  * @param base Base of the converted number (2: binary, 10: decimal, 16: hexadecimal)
  * @return uint8_t* 
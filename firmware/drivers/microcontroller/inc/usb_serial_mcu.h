@@ -0,0 +1,99 @@
+#ifndef USB_SERIAL_MCU_H
+#define USB_SERIAL_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup USB_Serial USB Serial
+ ** @{ */
+
+/** \brief USB Serial/JTAG driver for the ESP-EDU Board.
+ *
+ * The ESP32-C6 has a native USB Serial/JTAG controller: the USB connector of
+ * the board shows up on the PC as a CDC serial port (/dev/ttyACM0, COMx), with
+ * no baud rate, as fast as full-speed USB (about 1 MB/s in practice), without
+ * the USB-UART bridge.
+ *
+ * Writes never wait: the bytes are queued whole on a TX ring emptied by the
+ * driver interrupt in 64 byte USB packets, or not at all. While no host is
+ * connected, or the host doesn't read the port, UsbSerialWrite returns 0 and
+ * the caller decides what is lost.
+ *
+ * @note The USB Serial/JTAG is also the secondary console of the default
+ * sdkconfig: for a binary stream set "Channel for console secondary output"
+ * to "No secondary console" (CONFIG_ESP_CONSOLE_SECONDARY_NONE), or the log
+ * messages are mixed with the data.
+ *
+ * @code
+ * UsbSerialInit(16384, 0);
+ * UsbSerialWrite(block, sizeof(block));
+ * @endcode
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define USB_SERIAL_TX_RING		8192	/*!< Default TX ring (bytes) */
+#define USB_SERIAL_RX_RING		1024	/*!< Default RX ring (bytes) */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Install the USB Serial/JTAG driver
+ *
+ * @param tx_ring	TX ring size in bytes (0: USB_SERIAL_TX_RING), the burst a
+ * 					slow host may leave unread before writes are refused
+ * @param rx_ring	RX ring size in bytes (0: USB_SERIAL_RX_RING)
+ * @return true		Driver installed (or already installed)
+ * @return false	No memory for the rings
+ */
+bool UsbSerialInit(uint32_t tx_ring, uint32_t rx_ring);
+
+/**
+ * @brief Whether a host is connected (the controller receives its USB frames)
+ *
+ * @note A connected host may still not read the port: writes are refused
+ * once the TX ring is full.
+ *
+ * @return true		Host connected
+ */
+bool UsbSerialConnected(void);
+
+/**
+ * @brief Queue a block for transmission, without waiting
+ *
+ * @param data		Pointer to array of data to be transmitted
+ * @param nbytes	Number of bytes to be sent
+ * @return uint32_t	nbytes if queued, 0 if not connected or the TX ring has
+ * 					no room for the whole block
+ */
+uint32_t UsbSerialWrite(const uint8_t *data, uint32_t nbytes);
+
+/**
+ * @brief Read the bytes received from the host
+ *
+ * @param data		Pointer to array where the data is stored
+ * @param nbytes	Maximum number of bytes to read
+ * @param timeout_ms Maximum wait for the first byte
+ * @return uint32_t	Bytes read
+ */
+uint32_t UsbSerialRead(uint8_t *data, uint32_t nbytes, uint32_t timeout_ms);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* USB_SERIAL_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,141 @@
+#ifndef WIFI_MCU_H
+#define WIFI_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup WiFi WiFi
+ ** @{ */
+
+/** \brief Wi-Fi station with Target Wake Time and a UDP socket, for periodic uplinks.
+ *
+ * The board joins an access point as a station and keeps the connection in
+ * the background (reconnects after every disconnection). Once it has an IP
+ * address it asks the access point for an individual Target Wake Time
+ * agreement (Wi-Fi 6): the radio sleeps and wakes up only every
+ * wake_interval_ms for a short service period, so a device that reports every
+ * few seconds keeps the radio on about 1% of the time, and the access point
+ * spreads the wake times of many devices. Without a Wi-Fi 6 access point (or
+ * if it rejects the agreement) the driver falls back to modem sleep, waking
+ * up for the beacons every wake_interval_ms.
+ *
+ * The application writes whole datagrams to one UDP server (WifiUdpOpen,
+ * WifiUdpSend); they are never queued by the driver, a datagram sent while
+ * disconnected is discarded.
+ *
+ * @code
+ * wifi_mcu_config_t wifi = {.ssid = "taller", .password = "clave", .wake_interval_ms = 5000};
+ * WifiInit(&wifi);
+ * WifiUdpOpen("192.168.1.10", 5005);
+ * ...
+ * WifiUdpSend(datagram, length);
+ * @endcode
+ *
+ * @note Compiled only with CONFIG_DRIVERS_WIFI (menuconfig: Drivers).
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include "stdint.h"
+#include "stdbool.h"
+/*==================[macros]=================================================*/
+#define WIFI_DATAGRAM_MAX		1400	/*!< Largest datagram (no IP fragmentation) */
+#define WIFI_TWT_WAKE_MS		33		/*!< Awake time of each TWT service period (ms) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Wi-Fi configuration struct
+ */
+typedef struct {
+	const char *ssid;				/*!< Access point name */
+	const char *password;			/*!< Access point password (WPA2/WPA3, NULL or "" for an open network) */
+	uint32_t wake_interval_ms;		/*!< Time between wake ups of the radio (0: always on) */
+} wifi_mcu_config_t;
+
+/**
+ * @brief Wi-Fi status
+ */
+typedef enum wifi_status {
+	WIFI_OFF,						/*!< Not initialized */
+	WIFI_CONNECTING,				/*!< Joining the access point or waiting for an IP address */
+	WIFI_CONNECTED					/*!< IP address assigned, datagrams can be sent */
+} wifi_status_t;
+
+/**
+ * @brief Link statistics
+ */
+typedef struct {
+	bool twt;						/*!< A Target Wake Time agreement is active */
+	uint32_t wake_interval_us;		/*!< Wake interval agreed with the access point (us, 0 without TWT) */
+	int8_t rssi;					/*!< Signal strength of the access point (dBm, 0 if not connected) */
+	uint32_t datagrams;				/*!< Datagrams sent */
+	uint32_t bytes;					/*!< Bytes sent (UDP payload) */
+	uint32_t dropped;				/*!< Datagrams discarded (not connected or socket error) */
+	uint32_t reconnections;			/*!< Connections lost since WifiInit */
+} wifi_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Wi-Fi initialization: starts the station and the connection in the background
+ *
+ * @note NVS is initialized here too (Wi-Fi calibration data), as in BleInit.
+ *
+ * @param config Wi-Fi configuration struct (the strings are copied)
+ * @return true on success
+ */
+bool WifiInit(const wifi_mcu_config_t *config);
+
+/**
+ * @brief Gets Wi-Fi connection status
+ *
+ * @return wifi_status_t Connection status
+ */
+wifi_status_t WifiStatus(void);
+
+/**
+ * @brief Gets the MAC address of the station (device identifier)
+ *
+ * @param mac Array of 6 bytes where the address is stored
+ */
+void WifiGetMac(uint8_t mac[6]);
+
+/**
+ * @brief Sets the server of the datagrams
+ *
+ * @param host IPv4 address of the server ("192.168.1.10")
+ * @param port UDP port of the server
+ * @return true on success, false with an invalid address
+ */
+bool WifiUdpOpen(const char *host, uint16_t port);
+
+/**
+ * @brief Sends a datagram to the server (non-blocking)
+ *
+ * @param data Datagram
+ * @param length Datagram length (up to WIFI_DATAGRAM_MAX)
+ * @return true Datagram handed to the network stack
+ * @return false Not connected, no server or no room: the datagram is discarded
+ */
+bool WifiUdpSend(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Gets the link statistics
+ *
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void WifiGetStats(wifi_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -16,16 +16,80 @@
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_continuous.h"
+#include "soc/soc_caps.h"
+#if SOC_ADC_MONITOR_SUPPORTED
+#include "esp_adc/adc_monitor.h"
+#endif
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CONT_FRAMES		4							// DMA frames stored by the driver ring buffer
+#define ADC_CH_QTY			4							// Analog inputs (CH0-CH3), CHn is ADC1 channel n
+#define ADC_MAX_RAW			((1 << ADC_BITWIDTH) - 1)
+#define ADC_FULL_SCALE_MV	3300						// Ideal full scale, used when there is no calibration
+#define ADC_LUT_SHIFT		4							// One calibration point every 16 codes
+#define ADC_LUT_LEN			((1 << (ADC_BITWIDTH - ADC_LUT_SHIFT)) + 1)
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+/** Analog input registry: ADC channel and calibration of each input */
+typedef struct {
+	adc_channel_t adc_channel;			/* ADC1 channel of the input */
+	adc_cali_handle_t calibration;		/* NULL if the calibration scheme is not available */
+	uint16_t lut[ADC_LUT_LEN];			/* Voltage (mV) of every (1 << ADC_LUT_SHIFT) codes, for linear interpolation */
+	bool lut_ready;
+	bool single;						/* Configured in the oneshot unit */
+	uint8_t oversampling;				/* Conversions averaged per sample (continuous mode) */
+	uint8_t acc_count;					/* Conversions accumulated for the next sample */
+	uint32_t acc_sum;					/* Sum of the accumulated conversions (raw) */
+} adc_input_t;
 adc_oneshot_unit_handle_t adc1_single; 
 adc_continuous_handle_t adc2_cont;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+adc_continuous_handle_t adc1_cont = NULL;
+bool adc1_cont_running = false;
+uint8_t adc_cont_channels = 0;							/* Bit mask of channels in the scan pattern */
+uint32_t adc_cont_frec = 0;							/* Conversion frequency per channel (Hz): sample frequency times oversampling */
+uint8_t adc_cont_min_oversampling = ADC_OVERSAMPLING_MAX;	/* Lowest oversampling of the scan pattern */
+uint32_t adc_cont_frame_bytes = 0;					/* DMA frame size: ADC_CONT_FRAME_LEN samples at the lowest oversampling */
+void (*adc_cont_isr_p)(void*) = NULL;				/* Pointer to frame done callback */
+void *adc_cont_param_p = NULL;						/* Frame done callback parameter */
+static adc_input_t adc_inputs[ADC_CH_QTY] = {
+	[CH0] = {.adc_channel = ADC_CHANNEL_0},
+	[CH1] = {.adc_channel = ADC_CHANNEL_1},
+	[CH2] = {.adc_channel = ADC_CHANNEL_2},
+	[CH3] = {.adc_channel = ADC_CHANNEL_3},
+};
+uint8_t adc_cont_buffer[ADC_CONT_FRAME_LEN * ADC_OVERSAMPLING_MAX * SOC_ADC_DIGI_RESULT_BYTES];
+#if SOC_ADC_MONITOR_SUPPORTED
+static adc_monitor_handle_t adc_monitors[ADC_MONITOR_MAX];	/* Monitors created by the last AnalogMonitorArm() */
+static uint8_t adc_monitors_num = 0;
+static bool adc_monitors_enabled = false;
+#endif
+static volatile bool adc_monitor_armed = false;		/* The next monitor event is reported */
+static void (*adc_monitor_isr_p)(void*) = NULL;		/* Pointer to window exit callback */
+static void *adc_monitor_param_p = NULL;			/* Window exit callback parameter */
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_cont_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	TRACE_INSTANT(TRACE_ADC, 0);
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_param_p);
+	}
+	return false;
+}
+
+#if SOC_ADC_MONITOR_SUPPORTED
+static bool IRAM_ATTR adc_monitor_isr(adc_monitor_handle_t handle, const adc_monitor_evt_data_t *edata, void *user_data){
+	/* the event repeats with every conversion out of the window until the monitor is disarmed: only the first one is reported */
+	if(adc_monitor_armed){
+		adc_monitor_armed = false;
+		if(adc_monitor_isr_p != NULL){
+			adc_monitor_isr_p(adc_monitor_param_p);
+		}
+	}
+	return false;
+}
+#endif
 
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
@@ -39,11 +103,89 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Creates the calibration of an input and caches it in a lookup table
+ * 
+ * adc_cali_raw_to_voltage is evaluated once every (1 << ADC_LUT_SHIFT) codes at
+ * init; conversions then take a table lookup and a linear interpolation.
+ */
+static void AdcCalibrationInit(adc_input_t *input){
+	int voltage;
+	uint32_t raw;
+
+	if(input->lut_ready){
+		return;
+	}
+	adc_cali_curve_fitting_config_t cali_config = {
+		.unit_id = ADC_UNIT_1,
+		.chan = input->adc_channel,
+		.atten = ADC_ATTENUATION,
+		.bitwidth = ADC_BITWIDTH,
+	};
+	if(adc_cali_create_scheme_curve_fitting(&cali_config, &input->calibration) != ESP_OK){
+		input->calibration = NULL;
+	}
+	for(uint16_t i = 0; i < ADC_LUT_LEN; i++){
+		raw = (uint32_t)i << ADC_LUT_SHIFT;
+		if(raw > ADC_MAX_RAW){
+			raw = ADC_MAX_RAW;
+		}
+		if(input->calibration == NULL || adc_cali_raw_to_voltage(input->calibration, raw, &voltage) != ESP_OK){
+			/* no eFuse calibration: ideal transfer function */
+			voltage = (raw * ADC_FULL_SCALE_MV) / ADC_MAX_RAW;
+		}
+		input->lut[i] = voltage;
+	}
+	input->lut_ready = true;
+}
+
+/**
+ * @brief Converts a raw conversion to mV with the lookup table of its input
+ */
+static inline uint16_t AdcRawToMv(const adc_input_t *input, uint16_t raw){
+	uint16_t i = raw >> ADC_LUT_SHIFT;
+	uint16_t frac = raw & ((1 << ADC_LUT_SHIFT) - 1);
+	int32_t step;
+
+	if(i >= ADC_LUT_LEN - 1){
+		return input->lut[ADC_LUT_LEN - 1];
+	}
+	step = (int32_t)input->lut[i + 1] - input->lut[i];
+	return input->lut[i] + ((step * frac + (1 << (ADC_LUT_SHIFT - 1))) >> ADC_LUT_SHIFT);
+}
+
+/**
+ * @brief Converts a voltage (mV) to the raw conversion of an input, inverting its lookup table
+ */
+static uint16_t AdcMvToRaw(const adc_input_t *input, uint16_t mv){
+	uint32_t raw;
+	uint16_t i = 1;
+
+	if(mv <= input->lut[0]){
+		return 0;
+	}
+	while(i < ADC_LUT_LEN && input->lut[i] < mv){
+		i++;
+	}
+	if(i == ADC_LUT_LEN){
+		return ADC_MAX_RAW;
+	}
+	/* lut[i - 1] < mv <= lut[i] */
+	raw = ((uint32_t)(i - 1) << ADC_LUT_SHIFT) +
+		  (((uint32_t)(mv - input->lut[i - 1]) << ADC_LUT_SHIFT) / (input->lut[i] - input->lut[i - 1]));
+	return (raw > ADC_MAX_RAW) ? ADC_MAX_RAW : raw;
+}
 
 /*==================[external functions definition]==========================*/
 
 void AnalogInputInit(analog_input_config_t *config){
-	
+	adc_input_t *input;
+
+	if(config->input >= ADC_CH_QTY){
+		return;
+	}
+	input = &adc_inputs[config->input];
+	AdcCalibrationInit(input);
 	// config adc channels
 	switch(config->mode){
 		case ADC_SINGLE:
@@ -51,67 +193,31 @@ void AnalogInputInit(analog_input_config_t *config){
 				adc_oneshot_new_unit(&init_config_single, &adc1_single);
 				adc1_single_used = true;
 			}
-			switch(config->input){
-				case CH0:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
-				break;
-				case CH1:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
-				break;
-				case CH2:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
-				break;
-				case CH3:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
-				break;
-			}
+			adc_oneshot_config_channel(adc1_single, input->adc_channel, &adc_config_single);
+			input->single = true;
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			// channels are added to the scan pattern, the unit is configured on AnalogStartContinuous()
+			adc_cont_channels |= (1 << config->input);
+			input->oversampling = config->oversampling;
+			if(input->oversampling == 0){
+				input->oversampling = 1;
+			}
+			if(input->oversampling > ADC_OVERSAMPLING_MAX){
+				input->oversampling = ADC_OVERSAMPLING_MAX;
+			}
+			input->acc_count = 0;
+			input->acc_sum = 0;
+			// every channel is converted at the highest sample frequency times oversampling
+			if((uint32_t)config->sample_frec * input->oversampling > adc_cont_frec){
+				adc_cont_frec = (uint32_t)config->sample_frec * input->oversampling;
+			}
+			if(input->oversampling < adc_cont_min_oversampling){
+				adc_cont_min_oversampling = input->oversampling;
+			}
+			if(config->func_p != NULL){
+				adc_cont_isr_p = config->func_p;
+				adc_cont_param_p = config->param_p;
 			}
 		break;
 	}
@@ -128,32 +234,249 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
+	AnalogInputReadMulti(&channel, value, 1);
+}
+
+uint8_t AnalogInputReadMulti(const adc_ch_t *channels, uint16_t *values, uint8_t n){
+	const adc_input_t *input;
+	int raw;	/* adc_oneshot_read() writes an int, not an uint16_t */
+	uint8_t count = 0;
+
+	/* the registry is only written by AnalogInputInit: any task may read (adc_oneshot_read is thread safe) */
+	for(uint8_t i = 0; i < n; i++){
+		values[i] = 0;
+		if(channels[i] >= ADC_CH_QTY){
+			continue;
+		}
+		input = &adc_inputs[channels[i]];
+		if(!input->single || adc_oneshot_read(adc1_single, input->adc_channel, &raw) != ESP_OK){
+			continue;
+		}
+		values[i] = AdcRawToMv(input, raw);
+		count++;
 	}
+	return count;
 }
 
-void AnalogStartContinuous(adc_ch_t channel){
+/**
+ * @brief Configures the scan pattern of the continuous mode at adc_cont_frec (conversion stopped)
+ */
+static void AdcContinuousConfig(void){
+	adc_digi_pattern_config_t adc_pattern[ADC_CH_QTY] = {0};
+	uint8_t pattern_num = 0;
+	uint32_t sample_freq;
 
+	// scan pattern: every registered channel is converted once per sample period
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		if(adc_cont_channels & (1 << ch)){
+			adc_pattern[pattern_num].atten = ADC_ATTENUATION;
+			adc_pattern[pattern_num].channel = adc_inputs[ch].adc_channel;
+			adc_pattern[pattern_num].unit = ADC_UNIT_1;
+			adc_pattern[pattern_num].bit_width = ADC_BITWIDTH;
+			pattern_num++;
+		}
+	}
+	sample_freq = adc_cont_frec * pattern_num;
+	if(sample_freq < SOC_ADC_SAMPLE_FREQ_THRES_LOW){
+		sample_freq = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+	}
+	if(sample_freq > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+		sample_freq = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+	}
+	adc_continuous_config_t dig_config = {
+		.pattern_num = pattern_num,
+		.adc_pattern = adc_pattern,
+		.sample_freq_hz = sample_freq,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc1_cont, &dig_config));
+}
+
+void AnalogStartContinuous(adc_ch_t channel){
+	if(adc1_cont_running || !(adc_cont_channels & (1 << channel))){
+		return;
+	}
+	if(adc1_cont == NULL){
+		// one DMA frame gives up to ADC_CONT_FRAME_LEN samples (oversampled channels need more conversions
+		// per sample, so the interrupts per sample don't grow), the driver keeps a ring of ADC_CONT_FRAMES frames
+		adc_cont_frame_bytes = ADC_CONT_FRAME_LEN * adc_cont_min_oversampling * SOC_ADC_DIGI_RESULT_BYTES;
+		adc_continuous_handle_cfg_t handle_config = {
+			.max_store_buf_size = ADC_CONT_FRAMES * adc_cont_frame_bytes,
+			.conv_frame_size = adc_cont_frame_bytes,
+		};
+		ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc1_cont));
+		AdcContinuousConfig();
+		adc_continuous_evt_cbs_t cbs = {
+			.on_conv_done = adc_cont_isr,
+		};
+		ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc1_cont, &cbs, NULL));
+	}
+	ESP_ERROR_CHECK(adc_continuous_start(adc1_cont));
+	adc1_cont_running = true;
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	if(adc1_cont_running){
+		adc_continuous_stop(adc1_cont);
+		adc1_cont_running = false;
+	}
+}
 
+void AnalogSetContinuousFrequency(uint16_t sample_frec){
+	bool running = adc1_cont_running;
+	uint8_t oversampling = 1;
+
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		if((adc_cont_channels & (1 << ch)) && adc_inputs[ch].oversampling > oversampling){
+			oversampling = adc_inputs[ch].oversampling;
+		}
+	}
+	adc_cont_frec = (uint32_t)sample_frec * oversampling;
+	if(adc1_cont == NULL){
+		return;		// configured by AnalogStartContinuous()
+	}
+	// the pattern is configured with the conversion stopped
+	if(running){
+		adc_continuous_stop(adc1_cont);
+		adc1_cont_running = false;
+	}
+	AdcContinuousConfig();
+	// the stored frames were converted at the previous frequency
+	AnalogFlushContinuous();
+	if(running){
+		ESP_ERROR_CHECK(adc_continuous_start(adc1_cont));
+		adc1_cont_running = true;
+	}
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	adc_ch_t channels[ADC_CONT_FRAME_LEN];
+	uint16_t samples[ADC_CONT_FRAME_LEN];
+	uint16_t n, count = 0;
+
+	n = AnalogInputReadFrame(samples, channels);
+	for(uint16_t i = 0; i < n; i++){
+		if(channels[i] == channel){
+			values[count++] = samples[i];
+		}
+	}
+	return count;
+}
 
+uint16_t AnalogInputReadFrame(uint16_t *values, adc_ch_t *channels){
+	uint32_t ret_num = 0;
+	uint16_t count = 0;
+	adc_digi_output_data_t *p;
+	adc_input_t *input;
+
+	if(!adc1_cont_running){
+		return 0;
+	}
+	if(adc_continuous_read(adc1_cont, adc_cont_buffer, adc_cont_frame_bytes, &ret_num, 0) != ESP_OK){
+		return 0;
+	}
+	for(uint32_t i = 0; i < ret_num; i += SOC_ADC_DIGI_RESULT_BYTES){
+		p = (adc_digi_output_data_t*)&adc_cont_buffer[i];
+		if(p->type2.channel >= ADC_CH_QTY){
+			continue;
+		}
+		input = &adc_inputs[p->type2.channel];
+		// oversampling: average of the last conversions (carried over between frames)
+		input->acc_sum += p->type2.data;
+		if(++input->acc_count < input->oversampling){
+			continue;
+		}
+		values[count] = AdcRawToMv(input, (input->acc_sum + input->oversampling / 2) / input->oversampling);
+		channels[count] = p->type2.channel;
+		count++;
+		input->acc_sum = 0;
+		input->acc_count = 0;
+	}
+	return count;
+}
+
+void AnalogFlushContinuous(void){
+	if(adc1_cont == NULL){
+		return;
+	}
+	adc_continuous_flush_pool(adc1_cont);
+	// the partial oversampling sums belong to the discarded frames
+	for(uint8_t ch = 0; ch < ADC_CH_QTY; ch++){
+		adc_inputs[ch].acc_sum = 0;
+		adc_inputs[ch].acc_count = 0;
+	}
+}
+
+bool AnalogMonitorArm(const analog_window_t *windows, uint8_t n, void *func_p, void *param_p){
+#if SOC_ADC_MONITOR_SUPPORTED
+	bool running = adc1_cont_running;
+	bool armed = true;
+	const adc_input_t *input;
+	adc_monitor_evt_cbs_t cbs = {
+		.on_over_high_thresh = adc_monitor_isr,
+		.on_below_low_thresh = adc_monitor_isr,
+	};
+
+	if(adc1_cont == NULL || n == 0 || n > ADC_MONITOR_MAX){
+		return false;
+	}
+	for(uint8_t i = 0; i < n; i++){
+		if(windows[i].input >= ADC_CH_QTY || !(adc_cont_channels & (1 << windows[i].input))){
+			return false;
+		}
+	}
+	AnalogMonitorDisarm();
+	// monitors are created with the conversion stopped
+	if(running){
+		adc_continuous_stop(adc1_cont);
+		adc1_cont_running = false;
+	}
+	while(adc_monitors_num > 0){
+		adc_del_continuous_monitor(adc_monitors[--adc_monitors_num]);
+	}
+	adc_monitor_isr_p = func_p;
+	adc_monitor_param_p = param_p;
+	for(uint8_t i = 0; i < n && armed; i++){
+		input = &adc_inputs[windows[i].input];
+		adc_monitor_config_t monitor_config = {
+			.adc_unit = ADC_UNIT_1,
+			.channel = input->adc_channel,
+			.h_threshold = AdcMvToRaw(input, windows[i].high_mv),
+			.l_threshold = AdcMvToRaw(input, windows[i].low_mv),
+		};
+		armed = adc_new_continuous_monitor(adc1_cont, &monitor_config, &adc_monitors[adc_monitors_num]) == ESP_OK;
+		if(armed){
+			adc_monitors_num++;
+			armed = adc_continuous_monitor_register_event_callbacks(adc_monitors[adc_monitors_num - 1], &cbs, NULL) == ESP_OK &&
+					adc_continuous_monitor_enable(adc_monitors[adc_monitors_num - 1]) == ESP_OK;
+		}
+	}
+	adc_monitors_enabled = true;
+	if(!armed){
+		AnalogMonitorDisarm();
+	}
+	adc_monitor_armed = armed;
+	if(running){
+		ESP_ERROR_CHECK(adc_continuous_start(adc1_cont));
+		adc1_cont_running = true;
+	}
+	return armed;
+#else
+	return false;
+#endif
+}
+
+void AnalogMonitorDisarm(void){
+	adc_monitor_armed = false;
+#if SOC_ADC_MONITOR_SUPPORTED
+	if(adc_monitors_enabled){
+		for(uint8_t i = 0; i < adc_monitors_num; i++){
+			adc_continuous_monitor_disable(adc_monitors[i]);
+		}
+		adc_monitors_enabled = false;
+	}
+#endif
 }
 
 void AnalogOutputWrite(uint8_t value){
@@ -0,0 +1,158 @@
+/**
+ * @file audio_out_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "audio_out_mcu.h"
+#include "analog_io_mcu.h"
+#include "driver/i2s_pdm.h"
+#include "freertos/FreeRTOS.h"
+#include "trace_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define AUDIO_OUT_PORT		I2S_NUM_0
+#define AUDIO_OUT_SHIFT		8				// 8 bit samples to 16 bit PCM
+#define AUDIO_OUT_ZERO		128				// Silence (8 bit samples)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+i2s_chan_handle_t audio_out_tx = NULL;
+bool audio_out_running = false;
+uint16_t audio_out_block_len = 0;
+void (*audio_out_isr_p)(void*) = NULL;			/* Pointer to block sent callback */
+void *audio_out_param_p = NULL;					/* Block sent callback parameter */
+static volatile uint32_t audio_out_blocks = 0;		/* Blocks sent since AudioOutStart */
+static volatile uint32_t audio_out_underruns = 0;	/* Blocks sent without samples since AudioOutStart */
+static int16_t audio_out_pcm[AUDIO_OUT_BLOCK_MAX];	/* Conversion of the samples being written */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool IRAM_ATTR audio_out_sent_isr(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx){
+	TRACE_INSTANT(TRACE_AUDIO, audio_out_blocks);
+	audio_out_blocks++;
+	if(audio_out_isr_p != NULL){
+		audio_out_isr_p(audio_out_param_p);
+	}
+	return false;
+}
+
+/* The DMA finished a block but the free blocks queue was full: no samples were written in time */
+static bool IRAM_ATTR audio_out_underrun_isr(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx){
+	audio_out_underruns++;
+	return false;
+}
+
+/**
+ * @brief Write 16 bit PCM samples in the free blocks
+ *
+ * @return uint32_t Number of samples written
+ */
+static uint32_t audio_out_write_pcm(const int16_t *pcm, uint32_t n, uint32_t timeout_ms){
+	size_t written = 0;
+
+	i2s_channel_write(audio_out_tx, pcm, n * sizeof(int16_t), &written, timeout_ms);
+	return written / sizeof(int16_t);
+}
+/*==================[external functions definition]==========================*/
+bool AudioOutInit(const audio_out_config_t *config){
+	i2s_chan_config_t chan_config = I2S_CHANNEL_DEFAULT_CONFIG(AUDIO_OUT_PORT, I2S_ROLE_MASTER);
+	i2s_pdm_tx_config_t pdm_config = {
+		.clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(config->sample_frec),
+		.slot_cfg = I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+		.gpio_cfg = {
+			.clk = I2S_GPIO_UNUSED,
+			.dout = DAC,
+		},
+	};
+	i2s_event_callbacks_t callbacks = {
+		.on_sent = audio_out_sent_isr,
+		.on_send_q_ovf = audio_out_underrun_isr,
+	};
+
+	if(audio_out_tx != NULL || config->block_len == 0 || config->block_len > AUDIO_OUT_BLOCK_MAX ||
+	   config->sample_frec < AUDIO_OUT_FREC_MIN || config->sample_frec > AUDIO_OUT_FREC_MAX){
+		return false;
+	}
+	chan_config.dma_desc_num = AUDIO_OUT_BLOCKS;
+	chan_config.dma_frame_num = config->block_len;
+	chan_config.auto_clear = true;			// a block not written in time plays silence, not the previous one
+#if SOC_I2S_HW_VERSION_2
+	pdm_config.slot_cfg.line_mode = I2S_PDM_TX_ONE_LINE_DAC;	// PDM stream for an RC filter, no clock line
+#endif
+	if(i2s_new_channel(&chan_config, &audio_out_tx, NULL) != ESP_OK){
+		audio_out_tx = NULL;
+		return false;
+	}
+	if(i2s_channel_init_pdm_tx_mode(audio_out_tx, &pdm_config) != ESP_OK ||
+	   i2s_channel_register_event_callback(audio_out_tx, &callbacks, NULL) != ESP_OK){
+		i2s_del_channel(audio_out_tx);
+		audio_out_tx = NULL;
+		return false;
+	}
+	audio_out_block_len = config->block_len;
+	audio_out_isr_p = config->func_p;
+	audio_out_param_p = config->param_p;
+	return true;
+}
+
+void AudioOutStart(void){
+	if(audio_out_tx == NULL || audio_out_running){
+		return;
+	}
+	audio_out_blocks = 0;
+	audio_out_underruns = 0;
+	ESP_ERROR_CHECK(i2s_channel_enable(audio_out_tx));
+	audio_out_running = true;
+}
+
+void AudioOutStop(void){
+	if(audio_out_running){
+		i2s_channel_disable(audio_out_tx);
+		audio_out_running = false;
+	}
+}
+
+uint32_t AudioOutWrite(const uint8_t *samples, uint32_t n, uint32_t timeout_ms){
+	uint32_t count = 0, written;
+	uint16_t len;
+
+	if(!audio_out_running){
+		return 0;
+	}
+	while(count < n){
+		len = (n - count < audio_out_block_len) ? (n - count) : audio_out_block_len;
+		for(uint16_t i = 0; i < len; i++){
+			audio_out_pcm[i] = (int16_t)((samples[count + i] - AUDIO_OUT_ZERO) * (1 << AUDIO_OUT_SHIFT));
+		}
+		written = audio_out_write_pcm(audio_out_pcm, len, timeout_ms);
+		count += written;
+		if(written < len){
+			break;
+		}
+	}
+	return count;
+}
+
+uint32_t AudioOutWritePcm(const int16_t *pcm, uint32_t n, uint32_t timeout_ms){
+	if(!audio_out_running){
+		return 0;
+	}
+	return audio_out_write_pcm(pcm, n, timeout_ms);
+}
+
+uint32_t AudioOutUnderruns(void){
+	return audio_out_underruns;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,449 @@
+/**
+ * @file ble_central_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ble_central_mcu.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "nvs_flash.h"
+#include "esp_log.h"
+
+#include "esp_bt.h"
+#include "esp_gap_ble_api.h"
+#include "esp_gattc_api.h"
+#include "esp_gatt_defs.h"
+#include "esp_bt_defs.h"
+#include "esp_bt_main.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "ble_central_mcu"
+#define CENTRAL_APP_ID			0x57
+#define MTU_LOCAL				247		/* GATT MTU requested to the peers (one 251 bytes LL packet with DLE) */
+#define DLE_TX_OCTETS			251		/* Data Length Extension maximum LL payload */
+#define CONN_INT_MIN			0x06	/* Shortest connection interval (7.5 ms) */
+#define CONN_TIMEOUT			400		/* Supervision timeout (4 s) */
+#define SCAN_INTERVAL			0x50	/* 50 ms */
+#define SCAN_WINDOW				0x30	/* 30 ms, the rest of the time is left to the links */
+#define UUID_SERIAL_SERVICE		0xFFE0	/* ble_mcu.c serial service */
+#define UUID_SERIAL_DATA		0xFFE1	/* ble_mcu.c data characteristic (notify, write without response) */
+/*==================[typedef]================================================*/
+/* Link with one peripheral, the index in peers[] is the peer index */
+typedef struct {
+	bool used;					/* Slot taken (connecting or connected) */
+	bool ready;					/* Subscribed: notifications are delivered */
+	uint16_t conn_id;
+	esp_bd_addr_t bda;
+	uint16_t start_handle;		/* Serial service handle range */
+	uint16_t end_handle;
+	uint16_t data_handle;		/* Data characteristic value */
+	uint16_t interval;			/* Current connection interval (1.25 ms units) */
+	uint32_t notifications;
+	uint32_t bytes;
+	uint32_t connections;
+} peer_t;
+/*==================[internal data declaration]==============================*/
+static ble_central_config_t central_config;
+static peer_t peers[BLE_CENTRAL_MAX_PEERS];
+static esp_gatt_if_t central_gattc_if = ESP_GATT_IF_NONE;
+/* Peer being set up (connection to subscription): one at a time, the stack
+ * reports the notification registration by handle only, and the handles of
+ * every peer are the same */
+static uint8_t setup_peer = BLE_CENTRAL_NO_PEER;
+static bool scanning = false;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static esp_ble_scan_params_t scan_params = {
+	.scan_type			= BLE_SCAN_TYPE_ACTIVE,		/* the name comes in the scan response */
+	.own_addr_type		= BLE_ADDR_TYPE_PUBLIC,
+	.scan_filter_policy	= BLE_SCAN_FILTER_ALLOW_ALL,
+	.scan_interval		= SCAN_INTERVAL,
+	.scan_window		= SCAN_WINDOW,
+	.scan_duplicate		= BLE_SCAN_DUPLICATE_DISABLE,
+};
+static esp_bt_uuid_t service_uuid = {
+	.len = ESP_UUID_LEN_16,
+	.uuid = {.uuid16 = UUID_SERIAL_SERVICE},
+};
+static esp_bt_uuid_t data_uuid = {
+	.len = ESP_UUID_LEN_16,
+	.uuid = {.uuid16 = UUID_SERIAL_DATA},
+};
+static esp_bt_uuid_t cccd_uuid = {
+	.len = ESP_UUID_LEN_16,
+	.uuid = {.uuid16 = ESP_GATT_UUID_CHAR_CLIENT_CONFIG},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint8_t ble_central_peer_by_conn(uint16_t conn_id){
+	for(uint8_t i = 0; i < central_config.max_peers; i++){
+		if(peers[i].used && peers[i].conn_id == conn_id){
+			return i;
+		}
+	}
+	return BLE_CENTRAL_NO_PEER;
+}
+
+static uint8_t ble_central_peer_by_bda(const esp_bd_addr_t bda){
+	for(uint8_t i = 0; i < central_config.max_peers; i++){
+		if(peers[i].used && memcmp(peers[i].bda, bda, sizeof(esp_bd_addr_t)) == 0){
+			return i;
+		}
+	}
+	return BLE_CENTRAL_NO_PEER;
+}
+
+static uint8_t ble_central_used(void){
+	uint8_t used = 0;
+	for(uint8_t i = 0; i < central_config.max_peers; i++){
+		used += peers[i].used;
+	}
+	return used;
+}
+
+/* Connection interval for n links: one slot each, so the anchors don't overlap */
+static uint16_t ble_central_interval(uint8_t n){
+	uint16_t interval = n * BLE_CENTRAL_SLOT_UNITS;
+	return (interval < CONN_INT_MIN) ? CONN_INT_MIN : interval;
+}
+
+/* Moves every connected link to the interval of the current number of links */
+static void ble_central_schedule(void){
+	esp_ble_conn_update_params_t params = {
+		.latency = 0,
+		.timeout = CONN_TIMEOUT,
+	};
+	params.min_int = params.max_int = ble_central_interval(ble_central_used());
+	for(uint8_t i = 0; i < central_config.max_peers; i++){
+		if(peers[i].ready && peers[i].interval != params.min_int){
+			memcpy(params.bda, peers[i].bda, sizeof(esp_bd_addr_t));
+			esp_ble_gap_update_conn_params(&params);
+		}
+	}
+}
+
+/* Scans while there are free slots and no peer is being set up */
+static void ble_central_scan(void){
+	if(!scanning && setup_peer == BLE_CENTRAL_NO_PEER && ble_central_used() < central_config.max_peers){
+		scanning = true;
+		esp_ble_gap_start_scanning(0);		/* until a peer is found */
+	}
+}
+
+/* End of the set up of setup_peer, successful or not */
+static void ble_central_setup_done(bool ok){
+	uint8_t peer = setup_peer;
+
+	setup_peer = BLE_CENTRAL_NO_PEER;
+	if(peer != BLE_CENTRAL_NO_PEER){
+		if(ok){
+			peers[peer].ready = true;
+			peers[peer].connections++;
+			ESP_LOGI(TAG, "peer %d subscribed", peer);
+		}else{
+			esp_ble_gattc_close(central_gattc_if, peers[peer].conn_id);
+		}
+	}
+	ble_central_schedule();
+	ble_central_scan();
+}
+
+static bool ble_central_name_match(esp_ble_gap_cb_param_t *param){
+	uint8_t length = 0;
+	uint8_t *name = esp_ble_resolve_adv_data_by_type(param->scan_rst.ble_adv,
+		param->scan_rst.adv_data_len + param->scan_rst.scan_rsp_len, ESP_BLE_AD_TYPE_NAME_CMPL, &length);
+	if(name == NULL){
+		name = esp_ble_resolve_adv_data_by_type(param->scan_rst.ble_adv,
+			param->scan_rst.adv_data_len + param->scan_rst.scan_rsp_len, ESP_BLE_AD_TYPE_NAME_SHORT, &length);
+	}
+	return name != NULL && length == strlen(central_config.peer_name) &&
+		memcmp(name, central_config.peer_name, length) == 0;
+}
+
+static void ble_central_connect(esp_ble_gap_cb_param_t *param){
+	uint8_t peer;
+	uint16_t interval;
+
+	if(setup_peer != BLE_CENTRAL_NO_PEER || ble_central_peer_by_bda(param->scan_rst.bda) != BLE_CENTRAL_NO_PEER ||
+	   !ble_central_name_match(param)){
+		return;
+	}
+	for(peer = 0; peer < central_config.max_peers && peers[peer].used; peer++){
+	}
+	if(peer == central_config.max_peers){
+		return;
+	}
+	memset(&peers[peer], 0, offsetof(peer_t, notifications));
+	peers[peer].used = true;
+	memcpy(peers[peer].bda, param->scan_rst.bda, sizeof(esp_bd_addr_t));
+	setup_peer = peer;
+	esp_ble_gap_stop_scanning();
+	/* the new link starts at the interval it will share with the others */
+	interval = ble_central_interval(ble_central_used());
+	esp_ble_gap_set_prefer_conn_params(peers[peer].bda, interval, interval, 0, CONN_TIMEOUT);
+	esp_ble_gattc_open(central_gattc_if, peers[peer].bda, param->scan_rst.ble_addr_type, true);
+}
+
+static void ble_central_gap_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param){
+	uint8_t peer;
+
+	switch(event){
+		case ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT:
+			ble_central_scan();
+			break;
+		case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
+			if(param->scan_start_cmpl.status != ESP_BT_STATUS_SUCCESS){
+				ESP_LOGE(TAG, "scan start failed, status %x", param->scan_start_cmpl.status);
+				scanning = false;
+			}
+			break;
+		case ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT:
+			scanning = false;
+			/* a set up may have finished while stopping */
+			ble_central_scan();
+			break;
+		case ESP_GAP_BLE_SCAN_RESULT_EVT:
+			if(param->scan_rst.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT){
+				ble_central_connect(param);
+			}else if(param->scan_rst.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT){
+				scanning = false;
+				ble_central_scan();
+			}
+			break;
+		case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+			peer = ble_central_peer_by_bda(param->update_conn_params.bda);
+			if(peer != BLE_CENTRAL_NO_PEER && param->update_conn_params.status == ESP_BT_STATUS_SUCCESS){
+				peers[peer].interval = param->update_conn_params.conn_int;
+			}
+			break;
+		case ESP_GAP_BLE_SEC_REQ_EVT:
+			/* the peripherals ask for encryption on every connection */
+			esp_ble_gap_security_rsp(param->ble_security.ble_req.bd_addr, true);
+			break;
+		case ESP_GAP_BLE_NC_REQ_EVT:
+			esp_ble_confirm_reply(param->ble_security.ble_req.bd_addr, true);
+			break;
+		default:
+			break;
+	}
+}
+
+static void ble_central_gattc_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param){
+	uint8_t peer;
+	uint16_t count;
+	esp_gattc_char_elem_t data_char;
+	esp_gattc_descr_elem_t cccd;
+	uint8_t notify_on[2] = {0x01, 0x00};
+
+	switch(event){
+		case ESP_GATTC_REG_EVT:
+			central_gattc_if = gattc_if;
+			esp_ble_gatt_set_local_mtu(MTU_LOCAL);
+			esp_ble_gap_set_scan_params(&scan_params);
+			break;
+		case ESP_GATTC_CONNECT_EVT:
+			peer = ble_central_peer_by_bda(param->connect.remote_bda);
+			if(peer != BLE_CENTRAL_NO_PEER){
+				peers[peer].conn_id = param->connect.conn_id;
+				peers[peer].interval = param->connect.conn_params.interval;
+				esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, DLE_TX_OCTETS);
+				esp_ble_gap_set_preferred_phy(param->connect.remote_bda, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+					ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+			}
+			break;
+		case ESP_GATTC_OPEN_EVT:
+			if(param->open.status != ESP_GATT_OK){
+				ESP_LOGW(TAG, "connection failed, status %x", param->open.status);
+				if(setup_peer != BLE_CENTRAL_NO_PEER){
+					peers[setup_peer].used = false;
+					setup_peer = BLE_CENTRAL_NO_PEER;
+				}
+				ble_central_scan();
+				break;
+			}
+			esp_ble_gattc_send_mtu_req(gattc_if, param->open.conn_id);
+			break;
+		case ESP_GATTC_CFG_MTU_EVT:
+			/* with the old MTU if it failed */
+			esp_ble_gattc_search_service(gattc_if, param->cfg_mtu.conn_id, &service_uuid);
+			break;
+		case ESP_GATTC_SEARCH_RES_EVT:
+			peer = ble_central_peer_by_conn(param->search_res.conn_id);
+			if(peer != BLE_CENTRAL_NO_PEER && param->search_res.srvc_id.uuid.len == ESP_UUID_LEN_16 &&
+			   param->search_res.srvc_id.uuid.uuid.uuid16 == UUID_SERIAL_SERVICE){
+				peers[peer].start_handle = param->search_res.start_handle;
+				peers[peer].end_handle = param->search_res.end_handle;
+			}
+			break;
+		case ESP_GATTC_SEARCH_CMPL_EVT:
+			peer = ble_central_peer_by_conn(param->search_cmpl.conn_id);
+			if(peer == BLE_CENTRAL_NO_PEER || peer != setup_peer){
+				break;
+			}
+			count = 1;
+			if(peers[peer].start_handle == 0 ||
+			   esp_ble_gattc_get_char_by_uuid(gattc_if, peers[peer].conn_id, peers[peer].start_handle,
+				   peers[peer].end_handle, data_uuid, &data_char, &count) != ESP_GATT_OK || count == 0){
+				ESP_LOGW(TAG, "peer %d has no serial service", peer);
+				ble_central_setup_done(false);
+				break;
+			}
+			peers[peer].data_handle = data_char.char_handle;
+			esp_ble_gattc_register_for_notify(gattc_if, peers[peer].bda, data_char.char_handle);
+			break;
+		case ESP_GATTC_REG_FOR_NOTIFY_EVT:
+			if(setup_peer == BLE_CENTRAL_NO_PEER){
+				break;
+			}
+			peer = setup_peer;
+			count = 1;
+			if(param->reg_for_notify.status != ESP_GATT_OK ||
+			   esp_ble_gattc_get_descr_by_char_handle(gattc_if, peers[peer].conn_id, peers[peer].data_handle,
+				   cccd_uuid, &cccd, &count) != ESP_GATT_OK || count == 0){
+				ble_central_setup_done(false);
+				break;
+			}
+			esp_ble_gattc_write_char_descr(gattc_if, peers[peer].conn_id, cccd.handle, sizeof(notify_on), notify_on,
+				ESP_GATT_WRITE_TYPE_RSP, ESP_GATT_AUTH_REQ_NONE);
+			break;
+		case ESP_GATTC_WRITE_DESCR_EVT:
+			peer = ble_central_peer_by_conn(param->write.conn_id);
+			if(peer == BLE_CENTRAL_NO_PEER || peer != setup_peer){
+				break;
+			}
+			if(param->write.status == ESP_GATT_OK && central_config.start_cmd != NULL){
+				esp_ble_gattc_write_char(gattc_if, peers[peer].conn_id, peers[peer].data_handle,
+					central_config.start_cmd_len, (uint8_t *)central_config.start_cmd,
+					ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE);
+			}
+			ble_central_setup_done(param->write.status == ESP_GATT_OK);
+			break;
+		case ESP_GATTC_NOTIFY_EVT:
+			peer = ble_central_peer_by_conn(param->notify.conn_id);
+			if(peer != BLE_CENTRAL_NO_PEER && peers[peer].ready){
+				peers[peer].notifications++;
+				peers[peer].bytes += param->notify.value_len;
+				if(central_config.func_p != NULL){
+					central_config.func_p(peer, param->notify.value, param->notify.value_len);
+				}
+			}
+			break;
+		case ESP_GATTC_DISCONNECT_EVT:
+			peer = ble_central_peer_by_conn(param->disconnect.conn_id);
+			if(peer == BLE_CENTRAL_NO_PEER){
+				break;
+			}
+			ESP_LOGI(TAG, "peer %d disconnected, reason %x", peer, param->disconnect.reason);
+			peers[peer].used = false;
+			peers[peer].ready = false;
+			peers[peer].interval = 0;
+			if(peer == setup_peer){
+				setup_peer = BLE_CENTRAL_NO_PEER;
+			}
+			/* the remaining links share the freed slot */
+			ble_central_schedule();
+			ble_central_scan();
+			break;
+		default:
+			break;
+	}
+}
+
+static bool ble_central_stack_start(void){
+	esp_ble_auth_req_t auth_req = ESP_LE_AUTH_REQ_SC_BOND;
+	esp_ble_io_cap_t iocap = ESP_IO_CAP_NONE;
+	uint8_t key_size = 16;
+	uint8_t init_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
+	uint8_t rsp_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
+	esp_err_t ret;
+
+	ESP_ERROR_CHECK(esp_bt_controller_mem_release(ESP_BT_MODE_CLASSIC_BT));
+	esp_bt_controller_config_t bt_cfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+	ret = esp_bt_controller_init(&bt_cfg);
+	if(ret == ESP_OK){
+		ret = esp_bt_controller_enable(ESP_BT_MODE_BLE);
+	}
+	if(ret == ESP_OK){
+		ret = esp_bluedroid_init();
+	}
+	if(ret == ESP_OK){
+		ret = esp_bluedroid_enable();
+	}
+	if(ret == ESP_OK){
+		ret = esp_ble_gap_register_callback(ble_central_gap_handler);
+	}
+	if(ret == ESP_OK){
+		ret = esp_ble_gattc_register_callback(ble_central_gattc_handler);
+	}
+	if(ret == ESP_OK){
+		ret = esp_ble_gattc_app_register(CENTRAL_APP_ID);
+	}
+	if(ret != ESP_OK){
+		ESP_LOGE(TAG, "%s failed: %s", __func__, esp_err_to_name(ret));
+		return false;
+	}
+	/* Just Works bonding, as the peripherals (no input or output) */
+	esp_ble_gap_set_security_param(ESP_BLE_SM_AUTHEN_REQ_MODE, &auth_req, sizeof(uint8_t));
+	esp_ble_gap_set_security_param(ESP_BLE_SM_IOCAP_MODE, &iocap, sizeof(uint8_t));
+	esp_ble_gap_set_security_param(ESP_BLE_SM_MAX_KEY_SIZE, &key_size, sizeof(uint8_t));
+	esp_ble_gap_set_security_param(ESP_BLE_SM_SET_INIT_KEY, &init_key, sizeof(uint8_t));
+	esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
+	return true;
+}
+/*==================[external functions definition]==========================*/
+bool BleCentralInit(const ble_central_config_t * config){
+	esp_err_t ret;
+
+	if(central_gattc_if != ESP_GATT_IF_NONE || config->peer_name == NULL ||
+	   config->max_peers == 0 || config->max_peers > BLE_CENTRAL_MAX_PEERS){
+		return false;
+	}
+	central_config = *config;
+	ret = nvs_flash_init();
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		ret = nvs_flash_init();
+	}
+	ESP_ERROR_CHECK(ret);
+	return ble_central_stack_start();
+}
+
+uint8_t BleCentralPeers(void){
+	uint8_t ready = 0;
+	for(uint8_t i = 0; i < central_config.max_peers; i++){
+		ready += peers[i].ready;
+	}
+	return ready;
+}
+
+void BleCentralGetPeer(uint8_t peer, ble_central_peer_t * info){
+	memset(info, 0, sizeof(*info));
+	if(peer >= central_config.max_peers){
+		return;
+	}
+	info->connected = peers[peer].ready;
+	memcpy(info->addr, peers[peer].bda, sizeof(info->addr));
+	info->interval = peers[peer].ready ? peers[peer].interval : 0;
+	info->notifications = peers[peer].notifications;
+	info->bytes = peers[peer].bytes;
+	info->connections = peers[peer].connections;
+}
+
+bool BleCentralSend(uint8_t peer, const uint8_t * data, uint16_t length){
+	if(peer >= central_config.max_peers || !peers[peer].ready){
+		return false;
+	}
+	return esp_ble_gattc_write_char(central_gattc_if, peers[peer].conn_id, peers[peer].data_handle, length,
+		(uint8_t *)data, ESP_GATT_WRITE_TYPE_NO_RSP, ESP_GATT_AUTH_REQ_NONE) == ESP_OK;
+}
+
+/*==================[end of file]============================================*/
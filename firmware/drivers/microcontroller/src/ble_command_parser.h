@@ -0,0 +1,51 @@
+/**
+ * @file ble_command_parser.h
+ * @brief Received data framing and command dispatch shared by the Bluedroid
+ * (ble_mcu.c) and NimBLE (ble_nimble_mcu.c) serial services
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * Each write is one or more commands separated by ';', '\\r' or '\\n'. The
+ * first character of a command selects its handler in the ble_config_t table,
+ * the rest is its argument. Commands without handler go to ble_config_t.func_p.
+ *
+ */
+#ifndef BLE_COMMAND_PARSER_H
+#define BLE_COMMAND_PARSER_H
+#include <stdint.h>
+#include <stddef.h>
+#include "ble_mcu.h"
+
+#define RX_RING_SIZE		1024	/* Received bytes waiting for read_task (writes plus 4 bytes length each) */
+
+static inline bool BleCommandSeparator(uint8_t c){
+	return (c == ';') || (c == '\r') || (c == '\n');
+}
+
+static void BleCommandDispatch(const ble_command_t *table, uint8_t n_commands, read_func func_p,
+							   uint8_t *data, size_t length){
+	size_t start = 0, end;
+	uint8_t i;
+
+	/* no table: the whole write goes to the callback, as before the parser */
+	if(table == NULL){
+		if(func_p != BLE_NO_INT){
+			func_p(data, length);
+		}
+		return;
+	}
+	while(start < length){
+		for(end = start; end < length && !BleCommandSeparator(data[end]); end++);
+		if(end > start){
+			for(i = 0; i < n_commands && table[i].id != (char)data[start]; i++);
+			if(i < n_commands){
+				table[i].func_p(table[i].id, &data[start + 1], end - start - 1);
+			}else if(func_p != BLE_NO_INT){
+				func_p(&data[start], end - start);
+			}
+		}
+		start = end + 1;
+	}
+}
+
+#endif /* BLE_COMMAND_PARSER_H */
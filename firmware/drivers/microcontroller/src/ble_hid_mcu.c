@@ -11,6 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include "ble_hid_mcu.h"
+#include "ble_hid_report_map.h"
 #include <stdint.h>
 #include <string.h>
 
@@ -101,6 +102,13 @@
 #define HID_REPORT_TYPE_INPUT       		1
 #define HID_REPORT_TYPE_OUTPUT      		2
 #define HID_REPORT_TYPE_FEATURE     		3
+
+#define HID_REPORTS_PER_EVENT       		4         // Reports sent per connection interval (pipelined)
+#define HID_QUEUE_WAIT_MS           		100       // Maximum wait for room in the report queue (keyboard)
+#define HID_CONN_INT_MIN            		0x06      // 7.5 ms (1.25 ms units)
+#define HID_CONN_INT_MAX            		0x0C      // 15 ms
+#define HID_CONN_LATENCY            		0
+#define HID_CONN_TIMEOUT            		400       // 4 s (10 ms units)
 /// HID Service Attributes Indexes
 enum {
     HIDD_LE_IDX_SVC,
@@ -432,7 +440,13 @@ struct gatts_profile_inst {
     uint16_t conn_id;
 };
 hidd_le_env_t hidd_le_env;
-char * device_name;         /* Device name */
+static char * device_name;         /* Device name */
+/* Input report waiting to be sent */
+typedef struct {
+    uint8_t id;                                 /* HID_RPT_ID_MOUSE_IN or HID_RPT_ID_KEY_IN */
+    uint8_t len;
+    uint8_t data[HID_KEYBOARD_IN_RPT_LEN];
+} hid_report_t;
 
 /*==================[internal functions declaration]=========================*/
 /********************esp_hidd_prf_api**********************/
@@ -508,142 +522,6 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
 
 
 /*************************hidd_le**************************/
-// HID Report Map characteristic value
-// Keyboard report descriptor (using format for Boot interface descriptor)
-static const uint8_t hidReportMap[] = {
-    0x05, 0x01,  // Usage Page (Generic Desktop)
-    0x09, 0x02,  // Usage (Mouse)
-    0xA1, 0x01,  // Collection (Application)
-    0x85, 0x01,  // Report Id (1)
-    0x09, 0x01,  //   Usage (Pointer)
-    0xA1, 0x00,  //   Collection (Physical)
-    0x05, 0x09,  //     Usage Page (Buttons)
-    0x19, 0x01,  //     Usage Minimum (01) - Button 1
-    0x29, 0x03,  //     Usage Maximum (03) - Button 3
-    0x15, 0x00,  //     Logical Minimum (0)
-    0x25, 0x01,  //     Logical Maximum (1)
-    0x75, 0x01,  //     Report Size (1)
-    0x95, 0x03,  //     Report Count (3)
-    0x81, 0x02,  //     Input (Data, Variable, Absolute) - Button states
-    0x75, 0x05,  //     Report Size (5)
-    0x95, 0x01,  //     Report Count (1)
-    0x81, 0x01,  //     Input (Constant) - Padding or Reserved bits
-    0x05, 0x01,  //     Usage Page (Generic Desktop)
-    0x09, 0x30,  //     Usage (X)
-    0x09, 0x31,  //     Usage (Y)
-    0x09, 0x38,  //     Usage (Wheel)
-    0x15, 0x81,  //     Logical Minimum (-127)
-    0x25, 0x7F,  //     Logical Maximum (127)
-    0x75, 0x08,  //     Report Size (8)
-    0x95, 0x03,  //     Report Count (3)
-    0x81, 0x06,  //     Input (Data, Variable, Relative) - X & Y coordinate
-    0xC0,        //   End Collection
-    0xC0,        // End Collection
-
-    0x05, 0x01,  // Usage Pg (Generic Desktop)
-    0x09, 0x06,  // Usage (Keyboard)
-    0xA1, 0x01,  // Collection: (Application)
-    0x85, 0x02,  // Report Id (2)
-    //
-    0x05, 0x07,  //   Usage Pg (Key Codes)
-    0x19, 0xE0,  //   Usage Min (224)
-    0x29, 0xE7,  //   Usage Max (231)
-    0x15, 0x00,  //   Log Min (0)
-    0x25, 0x01,  //   Log Max (1)
-    //
-    //   Modifier byte
-    0x75, 0x01,  //   Report Size (1)
-    0x95, 0x08,  //   Report Count (8)
-    0x81, 0x02,  //   Input: (Data, Variable, Absolute)
-    //
-    //   Reserved byte
-    0x95, 0x01,  //   Report Count (1)
-    0x75, 0x08,  //   Report Size (8)
-    0x81, 0x01,  //   Input: (Constant)
-    //
-    //   LED report
-    0x05, 0x08,  //   Usage Pg (LEDs)
-    0x19, 0x01,  //   Usage Min (1)
-    0x29, 0x05,  //   Usage Max (5)
-    0x95, 0x05,  //   Report Count (5)
-    0x75, 0x01,  //   Report Size (1)
-    0x91, 0x02,  //   Output: (Data, Variable, Absolute)
-    //
-    //   LED report padding
-    0x95, 0x01,  //   Report Count (1)
-    0x75, 0x03,  //   Report Size (3)
-    0x91, 0x01,  //   Output: (Constant)
-    //
-    //   Key arrays (6 bytes)
-    0x95, 0x06,  //   Report Count (6)
-    0x75, 0x08,  //   Report Size (8)
-    0x15, 0x00,  //   Log Min (0)
-    0x25, 0x65,  //   Log Max (101)
-    0x05, 0x07,  //   Usage Pg (Key Codes)
-    0x19, 0x00,  //   Usage Min (0)
-    0x29, 0x65,  //   Usage Max (101)
-    0x81, 0x00,  //   Input: (Data, Array)
-    //
-    0xC0,        // End Collection
-    //
-    0x05, 0x0C,   // Usage Pg (Consumer Devices)
-    0x09, 0x01,   // Usage (Consumer Control)
-    0xA1, 0x01,   // Collection (Application)
-    0x85, 0x03,   // Report Id (3)
-    0x09, 0x02,   //   Usage (Numeric Key Pad)
-    0xA1, 0x02,   //   Collection (Logical)
-    0x05, 0x09,   //     Usage Pg (Button)
-    0x19, 0x01,   //     Usage Min (Button 1)
-    0x29, 0x0A,   //     Usage Max (Button 10)
-    0x15, 0x01,   //     Logical Min (1)
-    0x25, 0x0A,   //     Logical Max (10)
-    0x75, 0x04,   //     Report Size (4)
-    0x95, 0x01,   //     Report Count (1)
-    0x81, 0x00,   //     Input (Data, Ary, Abs)
-    0xC0,         //   End Collection
-    0x05, 0x0C,   //   Usage Pg (Consumer Devices)
-    0x09, 0x86,   //   Usage (Channel)
-    0x15, 0xFF,   //   Logical Min (-1)
-    0x25, 0x01,   //   Logical Max (1)
-    0x75, 0x02,   //   Report Size (2)
-    0x95, 0x01,   //   Report Count (1)
-    0x81, 0x46,   //   Input (Data, Var, Rel, Null)
-    0x09, 0xE9,   //   Usage (Volume Up)
-    0x09, 0xEA,   //   Usage (Volume Down)
-    0x15, 0x00,   //   Logical Min (0)
-    0x75, 0x01,   //   Report Size (1)
-    0x95, 0x02,   //   Report Count (2)
-    0x81, 0x02,   //   Input (Data, Var, Abs)
-    0x09, 0xE2,   //   Usage (Mute)
-    0x09, 0x30,   //   Usage (Power)
-    0x09, 0x83,   //   Usage (Recall Last)
-    0x09, 0x81,   //   Usage (Assign Selection)
-    0x09, 0xB0,   //   Usage (Play)
-    0x09, 0xB1,   //   Usage (Pause)
-    0x09, 0xB2,   //   Usage (Record)
-    0x09, 0xB3,   //   Usage (Fast Forward)
-    0x09, 0xB4,   //   Usage (Rewind)
-    0x09, 0xB5,   //   Usage (Scan Next)
-    0x09, 0xB6,   //   Usage (Scan Prev)
-    0x09, 0xB7,   //   Usage (Stop)
-    0x15, 0x01,   //   Logical Min (1)
-    0x25, 0x0C,   //   Logical Max (12)
-    0x75, 0x04,   //   Report Size (4)
-    0x95, 0x01,   //   Report Count (1)
-    0x81, 0x00,   //   Input (Data, Ary, Abs)
-    0x09, 0x80,   //   Usage (Selection)
-    0xA1, 0x02,   //   Collection (Logical)
-    0x05, 0x09,   //     Usage Pg (Button)
-    0x19, 0x01,   //     Usage Min (Button 1)
-    0x29, 0x03,   //     Usage Max (Button 3)
-    0x15, 0x01,   //     Logical Min (1)
-    0x25, 0x03,   //     Logical Max (3)
-    0x75, 0x02,   //     Report Size (2)
-    0x81, 0x00,   //     Input (Data, Ary, Abs)
-    0xC0,           //   End Collection
-    0x81, 0x03,   //   Input (Const, Var, Abs)
-    0xC0,            // End Collectionq
-};
 // HID report map length
 uint8_t hidReportMapLen = sizeof(hidReportMap);
 uint8_t hidProtocolMode = HID_PROTOCOL_MODE_REPORT;
@@ -951,7 +829,14 @@ static esp_ble_adv_params_t hidd_adv_params = {
 };
 static uint16_t hid_conn_id = 0;
 static bool sec_conn = false;
-ble_status_t status = BLE_OFF;
+static ble_status_t status = BLE_OFF;
+/* Report queue (ring), shared by the API functions and the transmission task */
+static hid_report_t hid_queue[BLE_HID_QUEUE_SIZE];
+static uint8_t hid_queue_head = 0;
+static uint8_t hid_queue_count = 0;
+static portMUX_TYPE hid_queue_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t hid_tx_task = NULL;
+static volatile bool hid_congested = false;
 
 /*==================[external data definition]===============================*/
 /********************esp_hidd_prf_api**********************/
@@ -1080,6 +965,13 @@ void esp_hidd_prf_cb_hdl(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
         case ESP_GATTS_CONF_EVT: {
             break;
         }
+        case ESP_GATTS_CONGEST_EVT: {
+            hid_congested = param->congest.congested;
+            if(!hid_congested && hid_tx_task != NULL) {
+                xTaskNotifyGive(hid_tx_task);
+            }
+            break;
+        }
         case ESP_GATTS_CREATE_EVT:
             break;
         case ESP_GATTS_CONNECT_EVT: {
@@ -1089,6 +981,15 @@ void esp_hidd_prf_cb_hdl(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
             cb_param.connect.conn_id = param->connect.conn_id;
             hidd_clcb_alloc(param->connect.conn_id, param->connect.remote_bda);
             esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_NO_MITM);
+            /* short connection interval: one report period per HID_CONN_INT_MIN..MAX */
+            esp_ble_conn_update_params_t conn_params = {
+                .min_int = HID_CONN_INT_MIN,
+                .max_int = HID_CONN_INT_MAX,
+                .latency = HID_CONN_LATENCY,
+                .timeout = HID_CONN_TIMEOUT,
+            };
+            memcpy(conn_params.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+            esp_ble_gap_update_conn_params(&conn_params);
             if(hidd_le_env.hidd_cb != NULL) {
                 (hidd_le_env.hidd_cb)(ESP_HIDD_EVENT_BLE_CONNECT, &cb_param);
             }
@@ -1310,6 +1211,10 @@ static void hidd_event_callback(esp_hidd_cb_event_t event, esp_hidd_cb_param_t *
         case ESP_HIDD_EVENT_BLE_DISCONNECT: {
             status = BLE_DISCONNECTED;
             sec_conn = false;
+            hid_congested = false;
+            portENTER_CRITICAL(&hid_queue_mux);
+            hid_queue_count = 0;
+            portEXIT_CRITICAL(&hid_queue_mux);
             ESP_LOGI(TAG, "ESP_HIDD_EVENT_BLE_DISCONNECT");
             status = BLE_DISCONNECTED;
             esp_ble_gap_start_advertising(&hidd_adv_params);
@@ -1362,10 +1267,83 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
     }
 }
 
+/*************************report queue**************************/
+static bool HidQueuePush(const hid_report_t *report){
+    bool ok = false;
+    portENTER_CRITICAL(&hid_queue_mux);
+    if(hid_queue_count < BLE_HID_QUEUE_SIZE){
+        hid_queue[(hid_queue_head + hid_queue_count) % BLE_HID_QUEUE_SIZE] = *report;
+        hid_queue_count++;
+        ok = true;
+    }
+    portEXIT_CRITICAL(&hid_queue_mux);
+    if(ok){
+        xTaskNotifyGive(hid_tx_task);
+    }
+    return ok;
+}
+
+static bool HidQueuePop(hid_report_t *report){
+    bool ok = false;
+    portENTER_CRITICAL(&hid_queue_mux);
+    if(hid_queue_count > 0){
+        *report = hid_queue[hid_queue_head];
+        hid_queue_head = (hid_queue_head + 1) % BLE_HID_QUEUE_SIZE;
+        hid_queue_count--;
+        ok = true;
+    }
+    portEXIT_CRITICAL(&hid_queue_mux);
+    return ok;
+}
+
+/* Adds a mouse movement to the last queued report, if it is a mouse report with
+ * the same buttons and the sum still fits in it (so no movement is lost) */
+static bool HidQueueMergeMouse(uint8_t buttons, int8_t delta_x, int8_t delta_y){
+    bool ok = false;
+    hid_report_t *last;
+    int16_t x, y;
+    portENTER_CRITICAL(&hid_queue_mux);
+    if(hid_queue_count > 0){
+        last = &hid_queue[(hid_queue_head + hid_queue_count - 1) % BLE_HID_QUEUE_SIZE];
+        x = (int8_t)last->data[1] + delta_x;
+        y = (int8_t)last->data[2] + delta_y;
+        if(last->id == HID_RPT_ID_MOUSE_IN && last->data[0] == buttons &&
+           x >= INT8_MIN && x <= INT8_MAX && y >= INT8_MIN && y <= INT8_MAX){
+            last->data[1] = (uint8_t)x;
+            last->data[2] = (uint8_t)y;
+            ok = true;
+        }
+    }
+    portEXIT_CRITICAL(&hid_queue_mux);
+    return ok;
+}
+
+/* Sends up to HID_REPORTS_PER_EVENT reports per tick (about one connection
+ * interval) while the link is not congested. Mouse movements queued meanwhile
+ * are merged, so fast motion doesn't flood the link */
+static void BleHidTxTask(void *arg){
+    hid_report_t report;
+    uint8_t sent;
+    while(1){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while(hid_queue_count > 0 && status == BLE_CONNECTED){
+            for(sent = 0; sent < HID_REPORTS_PER_EVENT && !hid_congested; sent++){
+                if(!HidQueuePop(&report)){
+                    break;
+                }
+                hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
+                                    report.id, HID_REPORT_TYPE_INPUT, report.len, report.data);
+            }
+            vTaskDelay(1);
+        }
+    }
+}
+
 /*==================[external functions definition]==========================*/
 void BleHidInit(char * hid_dev_name){
     esp_err_t ret;
     device_name = hid_dev_name;
+    xTaskCreate(BleHidTxTask, "ble_hid_tx", 1024*3, NULL, 9, &hid_tx_task);
     // Initialize NVS.
     ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -1423,35 +1401,36 @@ void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cm
         ESP_LOGE(TAG, "%s(), the number key should not be more than %d", __func__, HID_KEYBOARD_IN_RPT_LEN);
         return;
     }
-    uint8_t buffer[HID_KEYBOARD_IN_RPT_LEN] = {0};
+    hid_report_t report = {.id = HID_RPT_ID_KEY_IN, .len = HID_KEYBOARD_IN_RPT_LEN};
+    uint8_t wait;
     if(status == BLE_CONNECTED){
-        buffer[0] = special_key_mask;
+        // press and release reports, queued back to back
+        report.data[0] = special_key_mask;
         for (int i = 0; i < num_key; i++) {
-            buffer[i+2] = keyboard_cmd[i];
+            report.data[i+2] = keyboard_cmd[i];
+        }
+        for (wait = 0; !HidQueuePush(&report) && wait < HID_QUEUE_WAIT_MS / portTICK_PERIOD_MS; wait++) {
+            vTaskDelay(1);
         }
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT, HID_KEYBOARD_IN_RPT_LEN, buffer);
         for (int i = 0; i < num_key; i++) {
-            buffer[i+2] = 0;
+            report.data[i+2] = 0;
+        }
+        for (wait = 0; !HidQueuePush(&report) && wait < HID_QUEUE_WAIT_MS / portTICK_PERIOD_MS; wait++) {
+            vTaskDelay(1);
         }
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT, HID_KEYBOARD_IN_RPT_LEN, buffer);
     }
     return;
 }
 
 void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y){
-    uint8_t buffer[HID_MOUSE_IN_RPT_LEN];
-    buffer[0] = mouse_button;       // Buttons
-    buffer[1] = delta_x;            // X
-    buffer[2] = delta_y;            // Y
-    buffer[3] = 0;                  // Wheel
-    buffer[4] = 0;                  // AC Pan
-    if(status == BLE_CONNECTED){
-        hid_dev_send_report(hidd_le_env.gatt_if, hid_conn_id,
-                            HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT, HID_MOUSE_IN_RPT_LEN, buffer);
+    hid_report_t report = {.id = HID_RPT_ID_MOUSE_IN, .len = HID_MOUSE_IN_RPT_LEN};
+    if(status == BLE_CONNECTED && !HidQueueMergeMouse(mouse_button, delta_x, delta_y)){
+        report.data[0] = mouse_button;       // Buttons
+        report.data[1] = delta_x;            // X
+        report.data[2] = delta_y;            // Y
+        report.data[3] = 0;                  // Wheel
+        report.data[4] = 0;                  // AC Pan
+        HidQueuePush(&report);
     }
     return;
 }
-
-/*==================[end of file]============================================*/
\ No newline at end of file
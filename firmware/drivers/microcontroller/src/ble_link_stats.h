@@ -0,0 +1,58 @@
+/**
+ * @file ble_link_stats.h
+ * @brief Link statistics characteristic shared by the Bluedroid (ble_mcu.c)
+ * and NimBLE (ble_nimble_mcu.c) serial services
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * The characteristic value is the ble_link_stats_t fields in order, packed
+ * little endian, so a phone app decodes it without padding rules.
+ *
+ */
+#ifndef BLE_LINK_STATS_H
+#define BLE_LINK_STATS_H
+#include <stdint.h>
+#include "ble_mcu.h"
+
+#define STATS_UUID			0xFFE2	/* Link statistics characteristic */
+#define STATS_INTERVAL_MS	1000	/* Rates and RSSI update period */
+
+/* Value of the link statistics characteristic */
+typedef struct __attribute__((packed)) {
+	uint16_t mtu;
+	uint16_t interval;
+	uint16_t latency;
+	uint8_t tx_phy;
+	uint8_t rx_phy;
+	int8_t rssi;
+	uint16_t notifications_per_s;
+	uint32_t bytes_per_s;
+	uint32_t notifications;
+	uint32_t bytes;
+	uint16_t events_max;
+	uint16_t queue_max;
+	uint32_t dropped;
+	uint32_t blocked;
+} ble_link_record_t;
+
+_Static_assert(sizeof(ble_link_record_t) == 35, "link statistics characteristic is 35 bytes");
+
+/* The CPU is little endian: the fields are copied as they are */
+static inline void BleLinkStatsPack(const ble_link_stats_t *stats, ble_link_record_t *record){
+	record->mtu = stats->mtu;
+	record->interval = stats->interval;
+	record->latency = stats->latency;
+	record->tx_phy = stats->tx_phy;
+	record->rx_phy = stats->rx_phy;
+	record->rssi = stats->rssi;
+	record->notifications_per_s = stats->notifications_per_s;
+	record->bytes_per_s = stats->bytes_per_s;
+	record->notifications = stats->notifications;
+	record->bytes = stats->bytes;
+	record->events_max = stats->events_max;
+	record->queue_max = stats->queue_max;
+	record->dropped = stats->dropped;
+	record->blocked = stats->blocked;
+}
+
+#endif /* BLE_LINK_STATS_H */
@@ -11,10 +11,20 @@
 
 /*==================[inclusions]=============================================*/
 #include "ble_mcu.h"
+#include "ble_command_parser.h"
+#include "ble_link_stats.h"
+#if CONFIG_DRIVERS_BLE_OTA
+#include "ble_ota.h"
+#endif
+#include "rtos_alloc_mcu.h"
+#include "log_mcu.h"
 #include <stdint.h>
+#include <stddef.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include "nvs_flash.h"
+#include "nvs.h"
 
 #include "esp_log.h"
 
@@ -23,19 +33,36 @@
 #include "esp_gatts_api.h"
 #include "esp_bt_defs.h"
 #include "esp_bt_main.h"
+#include "mbedtls/aes.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "freertos/message_buffer.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "ble_mcu"
-#define MTU_MAX_BYTES		20	 /* GATT Maximum Transmission Unit */
-#define PAYLOAD_SIZE        128  /* Maximun number of bytes transmitted in one transaction */
-#define SPP_PROFILE_NUM     1       
+#define MTU_DEFAULT			ESP_GATT_DEF_BLE_MTU_SIZE	/* GATT MTU before the exchange (23 bytes) */
+#define MTU_LOCAL			247	 /* GATT MTU requested by this device (one 251 bytes LL packet with DLE) */
+#define ATT_HEADER_BYTES	3	 /* ATT notification header (opcode + handle) */
+#define DLE_TX_OCTETS		251	 /* Data Length Extension maximum LL payload */
+#define PAYLOAD_SIZE        (MTU_LOCAL - ATT_HEADER_BYTES)  /* Maximun number of bytes transmitted in one transaction */
+#define TX_POOL_SIZE        8       /* Number of preallocated transmission buffers */
+#define EVENTS_QUEUE_SIZE   (10 + TX_POOL_SIZE)
+#define TX_CREDITS          4       /* Notifications handed to the stack waiting for their send-complete event */
+#define TX_WAIT_MS          500     /* Maximum time waiting for the controller before dropping a buffer */
+#define SPP_PROFILE_NUM     1
 #define SPP_PROFILE_APP_IDX 0
 #define ESP_SPP_APP_ID      0x56
 #define SPP_SVC_INST_ID     0
-#define SPP_DATA_MAX_LEN    (128) /* Maximun number of bytes transmitted in one transaction */
+#define SPP_DATA_MAX_LEN    (PAYLOAD_SIZE) /* Maximun number of bytes transmitted in one transaction */
+#define DIRECTED_ADV_MS     1280    /* High duty cycle directed advertising length (Core spec limit) */
+#define PEER_NVS_NAMESPACE  "ble_mcu"
+#define PEER_NVS_KEY        "peer"  /* Identity address of the last bonded central */
+#define READ_TASK_STACK     4096    /* Stack of each driver task (bytes) */
+#define EVENTS_TASK_STACK   4096
+#define INIT_TASK_STACK     4096
 /* List of attributes to be added to the service database */
 enum{
     SPP_IDX_SVC,
@@ -44,6 +71,17 @@ enum{
     SPP_IDX_SPP_DATA_NOTIFY_CFG,
     SPP_IDX_SPP_DATA_RECV_VAL,
     SPP_IDX_SPP_DATA_RECV_CFG,
+    SPP_IDX_STATS_CHAR,
+    SPP_IDX_STATS_VAL,
+    SPP_IDX_STATE_CHAR,
+    SPP_IDX_STATE_VAL,
+#if CONFIG_DRIVERS_BLE_OTA
+    SPP_IDX_OTA_CTRL_CHAR,
+    SPP_IDX_OTA_CTRL_VAL,
+    SPP_IDX_OTA_CTRL_CFG,
+    SPP_IDX_OTA_DATA_CHAR,
+    SPP_IDX_OTA_DATA_VAL,
+#endif
     SPP_IDX_NB,
 };
 /* Characteristics UUID */
@@ -57,23 +95,56 @@ enum{
 typedef enum {
     CMD_BLUETOOTH_CONNECT,       /* bt connection */
     CMD_BLUETOOTH_AUTH,          /* device authentification */
-    CMD_BLUETOOTH_DATA,          /* data reception */
     CMD_BLUETOOTH_DISCONNECT,    /* device disconnection */
+    CMD_BLUETOOTH_MTU,           /* MTU exchanged with a device */
+    CMD_BLUETOOTH_SUBSCRIBE,     /* notifications enabled or disabled by a device */
     CMD_SEND_DATA,               /* data transmission */
 } comd_bt_ev_t;
-/* Struct used to handle Bluetooth events */
+/* Transmission buffer, taken from the TX pool and given back once it has been sent */
+typedef struct {
+	uint16_t length;
+	uint16_t frame_size;	/* Frames are never split between notifications (0 or 1: byte stream) */
+	uint8_t payload[PAYLOAD_SIZE];
+} tx_buffer_t;
+/* Struct used to handle Bluetooth events (only a pointer to the data travels through the queue) */
 typedef struct {
 	uint16_t spp_conn_id;
-	esp_gatt_if_t spp_gatts_if;
 	uint16_t command;
-	size_t length;
-	uint8_t payload[PAYLOAD_SIZE];
-	TaskHandle_t taskHandle;
+	uint16_t value;			/* MTU (CMD_BLUETOOTH_MTU), CCCD (CMD_BLUETOOTH_SUBSCRIBE) or success (CMD_BLUETOOTH_AUTH) */
+	esp_bd_addr_t bda;		/* Device address (CMD_BLUETOOTH_CONNECT and CMD_BLUETOOTH_AUTH) */
+	tx_buffer_t *tx_buffer;	/* Data to be transmitted (CMD_SEND_DATA) */
 } CMD_t;
+/* A connected central, owned by bluetooth_events_task */
+typedef struct {
+	bool used;
+	bool authenticated;		/* Security procedure finished: data can be sent */
+	bool subscribed;		/* Notifications enabled in the data CCCD */
+	volatile bool congested;	/* Set from the GATT callback */
+	uint16_t conn_id;
+	uint16_t mtu;
+	esp_bd_addr_t bda;
+} ble_conn_t;
+/* Advertising and connection timing of a link profile */
+typedef struct {
+	uint16_t adv_int_min;	/* Advertising interval (0.625 ms units) */
+	uint16_t adv_int_max;
+	uint16_t conn_int_min;	/* Connection interval (1.25 ms units) */
+	uint16_t conn_int_max;
+	uint16_t latency;		/* Connection events the peripheral may skip */
+	uint16_t timeout;		/* Supervision timeout (10 ms units) */
+} link_params_t;
+/* Last bonded central, kept in NVS to reconnect with directed advertising */
+typedef struct {
+	esp_bd_addr_t addr;
+	esp_ble_addr_type_t addr_type;
+} ble_peer_t;
 /*==================[internal data declaration]==============================*/
 char * device_name; /* Device name */
 void (*ble_read_isr_p)(uint8_t * data, uint8_t length);  /* Pointer to callback function for reading data */
+static const ble_command_t *ble_commands = NULL;	/* Received commands dispatch table */
+static uint8_t ble_n_commands = 0;
 ble_status_t status = BLE_OFF;
+static uint16_t ble_mtu = MTU_DEFAULT;			/* Negotiated GATT MTU */
 static uint16_t spp_handle_table[SPP_IDX_NB];   /* Service database table */
 /* GATT profile struct */
 struct gatts_profile_inst {
@@ -91,11 +162,46 @@ struct gatts_profile_inst {
 	esp_bt_uuid_t descr_uuid;
 };
 QueueHandle_t xQueueEvents = NULL;  /* Queue for handling Bluettoth events */
-QueueHandle_t xQueueRead = NULL;    /* Queue for handling received data */
+static MessageBufferHandle_t rx_ring = NULL;	/* Received writes, only their own length is copied */
+QueueHandle_t xQueueTxFree = NULL;  /* Free transmission buffers of the TX pool */
+static tx_buffer_t tx_pool[TX_POOL_SIZE];
+static SemaphoreHandle_t tx_credits = NULL;		/* One credit per notification the stack can accept */
+static SemaphoreHandle_t tx_uncongested = NULL;	/* Given when the link leaves the congested state */
+static volatile bool tx_congested = false;
+static volatile uint32_t tx_notifications = 0;	/* Notifications sent */
+static volatile uint32_t tx_dropped = 0;		/* Buffers discarded (pool exhausted, timeout or disconnection) */
+static volatile uint16_t tx_queue_max = 0;		/* Maximum number of buffers waiting to be sent */
+static volatile uint32_t tx_bytes = 0;			/* Bytes sent */
+static volatile uint32_t tx_blocked = 0;		/* Sends that waited for a free buffer */
+static uint16_t events_max = 0;					/* Maximum number of events waiting in xQueueEvents */
+static ble_link_stats_t link_stats = {			/* Connection parameters and rates (BleStatsTimer) */
+	.tx_phy = ESP_BLE_GAP_PHY_1M, .rx_phy = ESP_BLE_GAP_PHY_1M, .rssi = BLE_RSSI_UNKNOWN,
+};
+static TimerHandle_t stats_timer = NULL;		/* Rates, RSSI and link statistics characteristic */
+static ble_link_profile_t link_profile = BLE_LINK_FAST;
+static ble_conn_t conns[BLE_MAX_CONNECTIONS];	/* Connected centrals, each one gets every notification */
+static volatile uint8_t conns_count = 0;
+static void (*ble_ready_p)(void) = NULL;		/* Called once the device is advertising */
+static TaskHandle_t ble_init_task = NULL;		/* Stack bring-up, waits for the first advertising */
+static ble_peer_t last_peer;
+static bool last_peer_valid = false;
+static volatile bool directed_adv = false;		/* Directed advertising to last_peer in progress */
+static TimerHandle_t directed_timer = NULL;		/* Falls back to undirected advertising */
+TASK_STORAGE_DEFINE(read_storage, READ_TASK_STACK);
+TASK_STORAGE_DEFINE(events_storage, EVENTS_TASK_STACK);
+TASK_STORAGE_DEFINE(init_storage, INIT_TASK_STACK);
+QUEUE_STORAGE_DEFINE(events_queue_storage, EVENTS_QUEUE_SIZE, sizeof(CMD_t));
+QUEUE_STORAGE_DEFINE(tx_free_storage, TX_POOL_SIZE, sizeof(tx_buffer_t *));
 
 /*==================[internal functions declaration]=========================*/
 static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 										esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
+static void BleUpdateConnParams(const esp_bd_addr_t bda, ble_link_profile_t profile);
+#if CONFIG_DRIVERS_BLE_OTA
+static uint16_t BleConnMtu(uint16_t conn_id);
+#endif
+static void BleStartAdvertising(void);
+static void BleStateUpdate(void);
 /*==================[internal data definition]===============================*/
 static const uint16_t spp_service_uuid = ESP_GATT_UUID_SPP_SERVICE; /* Service ID */
 /* Advertising data */
@@ -116,6 +222,19 @@ static esp_ble_adv_params_t spp_adv_params = {
 	.channel_map		= ADV_CHNL_ALL,
 	.adv_filter_policy	= ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY,
 };
+/* Link profiles timing, the supervision timeout covers the skipped events with margin */
+static const link_params_t link_params[] = {
+	[BLE_LINK_FAST] = {
+		.adv_int_min = 0x20, .adv_int_max = 0x40,			/* 20 - 40 ms */
+		.conn_int_min = 0x06, .conn_int_max = 0x10,			/* 7.5 - 20 ms */
+		.latency = 0, .timeout = 400,						/* 4 s */
+	},
+	[BLE_LINK_LOW_POWER] = {
+		.adv_int_min = 0x640, .adv_int_max = 0x780,			/* 1 - 1.2 s */
+		.conn_int_min = 0x50, .conn_int_max = 0xA0,			/* 100 - 200 ms */
+		.latency = 4, .timeout = 600,						/* 6 s */
+	},
+};
 /* Service UUID */
 static uint8_t sec_service_uuid[16] = {
 	/* LSB <--------------------------------------------------------------------------------> MSB */
@@ -162,6 +281,20 @@ static const uint8_t  spp_data_receive_val[20] = {0x00};
 static const uint16_t spp_data_notify_uuid = ESP_GATT_UUID_SPP_DATA_RECEIVE_NOTIFY;
 static const uint8_t  spp_data_notify_val[20] = {0x00};
 static const uint8_t  spp_data_notify_ccc[2] = {0x00, 0x00};
+static const uint8_t char_prop_read = ESP_GATT_CHAR_PROP_BIT_READ;
+static const uint16_t stats_uuid = STATS_UUID;
+static const ble_link_record_t stats_val = {0};
+static const uint16_t state_uuid = BLE_STATE_UUID;
+static uint8_t state_val[BLE_STATE_MAX_LEN];	/* Last value given to BleSetState */
+static uint16_t state_len = 0;
+static portMUX_TYPE state_lock = portMUX_INITIALIZER_UNLOCKED;
+#if CONFIG_DRIVERS_BLE_OTA
+static const uint8_t char_prop_write_notify = ESP_GATT_CHAR_PROP_BIT_WRITE|ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static const uint8_t char_prop_write_nr = ESP_GATT_CHAR_PROP_BIT_WRITE_NR;
+static const uint16_t ota_ctrl_uuid = OTA_CTRL_UUID;
+static const uint16_t ota_data_uuid = OTA_DATA_UUID;
+static const uint8_t ota_ctrl_val[1] = {0x00};
+#endif
 /* Full HRS Database Description - Used to add attributes into the database */
 static const esp_gatts_attr_db_t spp_gatt_db[SPP_IDX_NB] = {
 	/* SPP -  Service Declaration */
@@ -193,10 +326,126 @@ static const esp_gatts_attr_db_t spp_gatt_db[SPP_IDX_NB] = {
 	[SPP_IDX_SPP_DATA_RECV_CFG]		  =
 	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_description_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
 	sizeof(uint16_t),sizeof(spp_data_notify_ccc), (uint8_t *)spp_data_notify_ccc}},
+
+	/* Link statistics characteristic Declaration */
+	[SPP_IDX_STATS_CHAR]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_read}},
+
+	/* Link statistics characteristic Value, refreshed by BleStatsTimer */
+	[SPP_IDX_STATS_VAL]					=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&stats_uuid, ESP_GATT_PERM_READ,
+	sizeof(ble_link_record_t), sizeof(stats_val), (uint8_t *)&stats_val}},
+
+	/* State characteristic Declaration */
+	[SPP_IDX_STATE_CHAR]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_read}},
+
+	/* State characteristic Value, set by BleSetState (empty until then) */
+	[SPP_IDX_STATE_VAL]					=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&state_uuid, ESP_GATT_PERM_READ,
+	BLE_STATE_MAX_LEN, 0, state_val}},
+#if CONFIG_DRIVERS_BLE_OTA
+	/* Firmware update control characteristic Declaration */
+	[SPP_IDX_OTA_CTRL_CHAR]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_write_notify}},
+
+	/* Firmware update control characteristic Value, commands and their answers */
+	[SPP_IDX_OTA_CTRL_VAL]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&ota_ctrl_uuid, ESP_GATT_PERM_WRITE,
+	SPP_DATA_MAX_LEN, sizeof(ota_ctrl_val), (uint8_t *)ota_ctrl_val}},
+
+	/* Firmware update control characteristic - Client Characteristic Configuration Descriptor */
+	[SPP_IDX_OTA_CTRL_CFG]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_client_config_uuid, ESP_GATT_PERM_READ|ESP_GATT_PERM_WRITE,
+	sizeof(uint16_t), sizeof(spp_data_notify_ccc), (uint8_t *)spp_data_notify_ccc}},
+
+	/* Firmware update data characteristic Declaration */
+	[SPP_IDX_OTA_DATA_CHAR]				=
+	{{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t *)&character_declaration_uuid, ESP_GATT_PERM_READ,
+	sizeof(uint8_t), sizeof(uint8_t), (uint8_t *)&char_prop_write_nr}},
+
+	/* Firmware update data characteristic Value: handled by the application, so
+	 * the stack doesn't copy every write into the attribute database */
+	[SPP_IDX_OTA_DATA_VAL]				=
+	{{ESP_GATT_RSP_BY_APP}, {ESP_UUID_LEN_16, (uint8_t *)&ota_data_uuid, ESP_GATT_PERM_WRITE,
+	SPP_DATA_MAX_LEN, 0, NULL}},
+#endif
 };
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Reads the last bonded central, Bluedroid keeps its keys (LTK, IRK) on its own */
+static void BlePeerLoad(void){
+	nvs_handle_t nvs;
+	size_t len = sizeof(last_peer);
+	if(nvs_open(PEER_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK){
+		return;
+	}
+	last_peer_valid = (nvs_get_blob(nvs, PEER_NVS_KEY, &last_peer, &len) == ESP_OK && len == sizeof(last_peer));
+	nvs_close(nvs);
+}
+
+static void BlePeerSave(const esp_bd_addr_t addr, esp_ble_addr_type_t addr_type){
+	nvs_handle_t nvs;
+	if(last_peer_valid && last_peer.addr_type == addr_type && memcmp(last_peer.addr, addr, sizeof(esp_bd_addr_t)) == 0){
+		return;
+	}
+	memcpy(last_peer.addr, addr, sizeof(esp_bd_addr_t));
+	last_peer.addr_type = addr_type;
+	last_peer_valid = true;
+	if(nvs_open(PEER_NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK){
+		return;
+	}
+	if(nvs_set_blob(nvs, PEER_NVS_KEY, &last_peer, sizeof(last_peer)) == ESP_OK){
+		nvs_commit(nvs);
+	}
+	nvs_close(nvs);
+}
+
+static void BlePeerForget(void){
+	nvs_handle_t nvs;
+	if(!last_peer_valid){
+		return;
+	}
+	last_peer_valid = false;
+	if(nvs_open(PEER_NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK){
+		return;
+	}
+	nvs_erase_key(nvs, PEER_NVS_KEY);
+	nvs_commit(nvs);
+	nvs_close(nvs);
+}
+
+/* Directed advertising to the last bonded central first: it reconnects within
+ * a few ms of high duty advertising, anyone else finds the device afterwards */
+static void BleStartAdvertising(void){
+	esp_ble_adv_params_t adv_params;
+	if(!last_peer_valid){
+		directed_adv = false;
+		esp_ble_gap_start_advertising(&spp_adv_params);
+		return;
+	}
+	adv_params = spp_adv_params;
+	adv_params.adv_type = ADV_TYPE_DIRECT_IND_HIGH;
+	memcpy(adv_params.peer_addr, last_peer.addr, sizeof(esp_bd_addr_t));
+	adv_params.peer_addr_type = last_peer.addr_type;
+	directed_adv = true;
+	esp_ble_gap_start_advertising(&adv_params);
+	xTimerReset(directed_timer, 0);
+}
+
+static void BleDirectedTimeout(TimerHandle_t timer){
+	if(!directed_adv){
+		return;
+	}
+	directed_adv = false;
+	esp_ble_gap_stop_advertising();
+	esp_ble_gap_start_advertising(&spp_adv_params);
+}
+
 static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) {
 	CMD_t cmdBuf;
 	static uint8_t adv_config_done = 0;
@@ -204,14 +453,14 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 		case ESP_GAP_BLE_SCAN_RSP_DATA_SET_COMPLETE_EVT:
 			adv_config_done &= (~SCAN_RSP_CONFIG_FLAG);
 			if (adv_config_done == 0){
-				esp_ble_gap_start_advertising(&spp_adv_params);
+				BleStartAdvertising();
 				status = BLE_DISCONNECTED;
 			}
 			break;
 		case ESP_GAP_BLE_ADV_DATA_SET_COMPLETE_EVT:
 			adv_config_done &= (~ADV_CONFIG_FLAG);
 			if (adv_config_done == 0){
-				esp_ble_gap_start_advertising(&spp_adv_params);
+				BleStartAdvertising();
 				status = BLE_DISCONNECTED;
 			}
 			break;
@@ -221,7 +470,10 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 				ESP_LOGE(__FUNCTION__, "advertising start failed, error status = %x", param->adv_start_cmpl.status);
 				break;
 			}
-			ESP_LOGI(TAG, "Advertising start");
+			LOG_DEFER(TAG ": Advertising start%s\r\n", directed_adv ? " (directed)" : "");
+			if(ble_init_task != NULL){
+				xTaskNotifyGive(ble_init_task);
+			}
 			break;
 		case ESP_GAP_BLE_PASSKEY_REQ_EVT:							/* passkey request event */
 			
@@ -255,10 +507,39 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
 
 			break;
 		case ESP_GAP_BLE_AUTH_CMPL_EVT: {
+			if(param->ble_security.auth_cmpl.success){
+				BlePeerSave(param->ble_security.auth_cmpl.bd_addr, param->ble_security.auth_cmpl.addr_type);
+			}else{
+				/* the central may have lost the bond: stop directing the advertising to it */
+				BlePeerForget();
+			}
 			cmdBuf.command = CMD_BLUETOOTH_AUTH;
-			xQueueSend(xQueueEvents, &cmdBuf, 0);
+			cmdBuf.value = param->ble_security.auth_cmpl.success;
+			memcpy(cmdBuf.bda, param->ble_security.auth_cmpl.bd_addr, sizeof(esp_bd_addr_t));
+			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
 			break;
 	}
+	case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+		LOG_DEFER(TAG ": Data length: tx %d rx %d\r\n", param->pkt_data_length_cmpl.params.tx_len, param->pkt_data_length_cmpl.params.rx_len);
+		break;
+	case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+		LOG_DEFER(TAG ": PHY: tx %d rx %d\r\n", param->phy_update.tx_phy, param->phy_update.rx_phy);
+		if(param->phy_update.status == ESP_BT_STATUS_SUCCESS){
+			link_stats.tx_phy = param->phy_update.tx_phy;
+			link_stats.rx_phy = param->phy_update.rx_phy;
+		}
+		break;
+	case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+		if(param->update_conn_params.status == ESP_BT_STATUS_SUCCESS){
+			link_stats.interval = param->update_conn_params.conn_int;
+			link_stats.latency = param->update_conn_params.latency;
+		}
+		break;
+	case ESP_GAP_BLE_READ_RSSI_COMPLETE_EVT:
+		if(param->read_rssi_cmpl.status == ESP_BT_STATUS_SUCCESS && status == BLE_CONNECTED){
+			link_stats.rssi = param->read_rssi_cmpl.rssi;
+		}
+		break;
 	case ESP_GAP_BLE_REMOVE_BOND_DEV_COMPLETE_EVT: {
 		ESP_LOGD(__FUNCTION__, "ESP_GAP_BLE_REMOVE_BOND_DEV_COMPLETE_EVT status = %d", param->remove_bond_dev_cmpl.status);
 		ESP_LOGI(__FUNCTION__, "ESP_GAP_BLE_REMOVE_BOND_DEV");
@@ -306,16 +587,47 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_READ_EVT:
 			break;
 		case ESP_GATTS_WRITE_EVT:
-			cmdBuf.command = CMD_BLUETOOTH_DATA;
-			memcpy(cmdBuf.payload, param->write.value, param->write.len);
-			cmdBuf.length = param->write.len;
-			xQueueSend(xQueueRead, &cmdBuf, 0);
+			if(param->write.handle == spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_CFG] && param->write.len == 2){
+				/* subscription of this device only, the others keep theirs */
+				cmdBuf.command = CMD_BLUETOOTH_SUBSCRIBE;
+				cmdBuf.spp_conn_id = param->write.conn_id;
+				cmdBuf.value = param->write.value[0] | (param->write.value[1] << 8);
+				xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+				break;
+			}
+#if CONFIG_DRIVERS_BLE_OTA
+			if(param->write.handle == spp_handle_table[SPP_IDX_OTA_DATA_VAL]){
+				BleOtaData(param->write.conn_id, param->write.value, param->write.len);
+				break;
+			}
+			if(param->write.handle == spp_handle_table[SPP_IDX_OTA_CTRL_VAL]){
+				if(param->write.len > 0 && param->write.value[0] == BLE_OTA_CMD_BEGIN){
+					/* the transfer goes at the fastest timing whatever the active profile */
+					BleUpdateConnParams(param->write.bda, BLE_LINK_FAST);
+				}
+				BleOtaControl(param->write.conn_id, param->write.value, param->write.len,
+					BleConnMtu(param->write.conn_id));
+				break;
+			}
+			if(param->write.handle == spp_handle_table[SPP_IDX_OTA_CTRL_CFG]){
+				break;
+			}
+#endif
+			xMessageBufferSend(rx_ring, param->write.value,
+				(param->write.len > PAYLOAD_SIZE) ? PAYLOAD_SIZE : param->write.len, 0);
 			break;
 		case ESP_GATTS_EXEC_WRITE_EVT:
 			break;
 		case ESP_GATTS_MTU_EVT:
+			LOG_DEFER(TAG ": MTU: %d\r\n", param->mtu.mtu);
+			cmdBuf.command = CMD_BLUETOOTH_MTU;
+			cmdBuf.spp_conn_id = param->mtu.conn_id;
+			cmdBuf.value = param->mtu.mtu;
+			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
 			break;
 		case ESP_GATTS_CONF_EVT:
+			/* send-complete: the stack can take another notification */
+			xSemaphoreGive(tx_credits);
 			break;
 		case ESP_GATTS_UNREG_EVT:
 			break;
@@ -328,17 +640,31 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 		case ESP_GATTS_CONNECT_EVT:
 			/* start security connect with peer device when receive the connect event sent by the master */
 			esp_ble_set_encryption(param->connect.remote_bda, ESP_BLE_SEC_ENCRYPT_MITM);
+			/* ask for longer LL packets and 2M PHY, the peer keeps the old values if not supported */
+			esp_ble_gap_set_pkt_data_len(param->connect.remote_bda, DLE_TX_OCTETS);
+			esp_ble_gap_set_preferred_phy(param->connect.remote_bda, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+				ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+			directed_adv = false;
+			xTimerStop(directed_timer, 0);
+			/* the central chooses the first parameters, ask for the active profile ones */
+			link_stats.interval = param->connect.conn_params.interval;
+			link_stats.latency = param->connect.conn_params.latency;
+			if(link_profile != BLE_LINK_FAST){
+				BleUpdateConnParams(param->connect.remote_bda, link_profile);
+			}
 			cmdBuf.command = CMD_BLUETOOTH_CONNECT;
 			cmdBuf.spp_conn_id = p_data->connect.conn_id;
-			cmdBuf.spp_gatts_if = gatts_if;
+			memcpy(cmdBuf.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
 			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
 			break;
 		case ESP_GATTS_DISCONNECT_EVT:
+			/* advertising and the link statistics are handled by bluetooth_events_task */
+#if CONFIG_DRIVERS_BLE_OTA
+			BleOtaDisconnect(param->disconnect.conn_id);
+#endif
 			cmdBuf.command = CMD_BLUETOOTH_DISCONNECT;
-			status = BLE_DISCONNECTED;
+			cmdBuf.spp_conn_id = param->disconnect.conn_id;
 			xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
-			/* start advertising again when missing the connect */
-			esp_ble_gap_start_advertising(&spp_adv_params);
 			break;
 		case ESP_GATTS_OPEN_EVT:
 			break;
@@ -348,14 +674,28 @@ static void gatts_profile_event_handler(esp_gatts_cb_event_t event,
 			break;
 		case ESP_GATTS_LISTEN_EVT:
 			break;
-		case ESP_GATTS_CONGEST_EVT:
+		case ESP_GATTS_CONGEST_EVT: {
+			bool congested = false;
+			for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+				if(conns[i].used && conns[i].conn_id == param->congest.conn_id){
+					conns[i].congested = param->congest.congested;
+				}
+				congested |= conns[i].used && conns[i].congested;
+			}
+			tx_congested = congested;
+			if(!param->congest.congested){
+				xSemaphoreGive(tx_uncongested);
+			}
 			break;
+		}
 		case ESP_GATTS_CREAT_ATTR_TAB_EVT: {
 			if (param->create.status == ESP_GATT_OK){
 				if(param->add_attr_tab.num_handle == SPP_IDX_NB) {
 					memcpy(spp_handle_table, param->add_attr_tab.handles,
 					sizeof(spp_handle_table));
 					esp_ble_gatts_start_service(spp_handle_table[SPP_IDX_SVC]);
+					/* value set before the table existed */
+					BleStateUpdate();
 				}else{
 					ESP_LOGE(__FUNCTION__, "Create attribute table abnormally, num_handle (%d) doesn't equal to SPP_IDX_NB(%d)",
 						param->add_attr_tab.num_handle, SPP_IDX_NB);
@@ -394,108 +734,455 @@ static void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_
 }
 
 static void read_task(void* pvParameters) {
-	CMD_t cmdBuf;
+	uint8_t data[PAYLOAD_SIZE];
+	size_t length;
 	while(1) {
-		xQueueReceive(xQueueRead, &cmdBuf, portMAX_DELAY);
-		if(ble_read_isr_p != BLE_NO_INT){
-            ble_read_isr_p(cmdBuf.payload, cmdBuf.length);
-        }
+		length = xMessageBufferReceive(rx_ring, data, sizeof(data), portMAX_DELAY);
+		if(length > 0){
+			BleCommandDispatch(ble_commands, ble_n_commands, ble_read_isr_p, data, length);
+		}
 	} 
 }
 
+static tx_buffer_t * TxBufferTake(TickType_t wait){
+	tx_buffer_t *buffer = NULL;
+	uint16_t depth;
+	if(xQueueTxFree == NULL){
+		return NULL;
+	}
+	if(xQueueReceive(xQueueTxFree, &buffer, 0) != pdTRUE){
+		if(wait == 0){
+			return NULL;
+		}
+		/* the pool is exhausted: the caller blocks until a buffer is sent */
+		tx_blocked++;
+		if(xQueueReceive(xQueueTxFree, &buffer, wait) != pdTRUE){
+			return NULL;
+		}
+	}
+	depth = TX_POOL_SIZE - uxQueueMessagesWaiting(xQueueTxFree);
+	if(depth > tx_queue_max){
+		tx_queue_max = depth;
+	}
+	return buffer;
+}
+
+static void TxBufferRelease(tx_buffer_t *buffer){
+	xQueueSend(xQueueTxFree, &buffer, 0);
+}
+
+static void TxBufferQueue(tx_buffer_t *buffer){
+	CMD_t cmdBuf = {
+		.command = CMD_SEND_DATA,
+		.tx_buffer = buffer,
+	};
+	/* never blocks: the events queue has room for every buffer of the pool */
+	xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+}
+
+/* Copy data into a pool buffer and queue it (wait: ticks to wait for a free buffer) */
+static bool TxCopyAndQueue(const void *data, uint16_t nbytes, uint16_t frame_size, TickType_t wait){
+	tx_buffer_t *buffer;
+	if(status != BLE_CONNECTED){
+		return false;
+	}
+	buffer = TxBufferTake(wait);
+	if(buffer == NULL){
+		tx_dropped++;
+		return false;
+	}
+	buffer->length = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes;
+	buffer->frame_size = frame_size;
+	memcpy(buffer->payload, data, buffer->length);
+	TxBufferQueue(buffer);
+	return true;
+}
+
+/* Hand one notification to the stack as soon as it can accept it */
+static bool TxNotify(ble_conn_t *conn, uint8_t *data, uint16_t len){
+	while(conn->congested){
+		if(xSemaphoreTake(tx_uncongested, pdMS_TO_TICKS(TX_WAIT_MS)) != pdTRUE){
+			return false;
+		}
+	}
+	if(xSemaphoreTake(tx_credits, pdMS_TO_TICKS(TX_WAIT_MS)) != pdTRUE){
+		return false;
+	}
+	if(esp_ble_gatts_send_indicate(spp_profile_tab[SPP_PROFILE_APP_IDX].gatts_if, conn->conn_id,
+			spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], len, data, false) != ESP_OK){
+		xSemaphoreGive(tx_credits);
+		return false;
+	}
+	tx_notifications++;
+	tx_bytes += len;
+	return true;
+}
+
+/* Pending send-complete events are lost on disconnection */
+static void TxResetFlowControl(void){
+	while(xSemaphoreGive(tx_credits) == pdTRUE);
+	tx_congested = false;
+	xSemaphoreGive(tx_uncongested);
+}
+
+static ble_conn_t * BleConnFind(uint16_t conn_id){
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(conns[i].used && conns[i].conn_id == conn_id){
+			return &conns[i];
+		}
+	}
+	return NULL;
+}
+
+/* Whether a resolvable private address was generated with the IRK (Core spec
+   Vol 3 Part H 2.2.2: hash = e(IRK, prand) mod 2^24). Bluedroid keeps the IRK
+   least significant byte first, e() takes the key and the data the other way */
+static bool BleRpaMatch(const esp_bd_addr_t rpa, const uint8_t *irk){
+	mbedtls_aes_context aes;
+	uint8_t key[ESP_BT_OCTET16_LEN], block[16] = {0}, out[16];
+	int ret;
+
+	if((rpa[0] & 0xC0) != 0x40){
+		return false;		/* not a resolvable private address */
+	}
+	for(uint8_t i = 0; i < ESP_BT_OCTET16_LEN; i++){
+		key[i] = irk[ESP_BT_OCTET16_LEN - 1 - i];
+	}
+	memcpy(&block[13], rpa, 3);		/* prand, zero padded */
+	mbedtls_aes_init(&aes);
+	ret = mbedtls_aes_setkey_enc(&aes, key, 128);
+	if(ret == 0){
+		ret = mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, block, out);
+	}
+	mbedtls_aes_free(&aes);
+	return ret == 0 && memcmp(&out[13], &rpa[3], 3) == 0;
+}
+
+/* Link of a central that finished pairing: the one with its address or, when
+   Bluedroid reports the identity address of a central that connected with a
+   resolvable private address, the one whose address resolves with its IRK */
+static ble_conn_t * BleConnFindAuth(const esp_bd_addr_t bda){
+	esp_ble_bond_dev_t *bonds;
+	ble_conn_t *conn = NULL;
+	int count;
+
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(conns[i].used && memcmp(conns[i].bda, bda, sizeof(esp_bd_addr_t)) == 0){
+			return &conns[i];
+		}
+	}
+	count = esp_ble_get_bond_device_num();
+	if(count <= 0){
+		return NULL;
+	}
+	/* only on pairing: the list is not kept */
+	bonds = malloc(count * sizeof(esp_ble_bond_dev_t));
+	if(bonds == NULL){
+		return NULL;
+	}
+	if(esp_ble_get_bond_device_list(&count, bonds) == ESP_OK){
+		for(int b = 0; b < count && conn == NULL; b++){
+			if(memcmp(bonds[b].bd_addr, bda, sizeof(esp_bd_addr_t)) != 0 || !(bonds[b].bond_key.key_mask & ESP_LE_KEY_PID)){
+				continue;
+			}
+			for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS && conn == NULL; i++){
+				if(conns[i].used && BleRpaMatch(conns[i].bda, bonds[b].bond_key.pid_key.irk)){
+					conn = &conns[i];
+				}
+			}
+		}
+	}
+	free(bonds);
+	return conn;
+}
+
+#if CONFIG_DRIVERS_BLE_OTA
+/* MTU of one device (not the smallest of all, as ble_mtu) */
+static uint16_t BleConnMtu(uint16_t conn_id){
+	ble_conn_t *conn = BleConnFind(conn_id);
+	return (conn == NULL || conn->mtu == 0) ? MTU_DEFAULT : conn->mtu;
+}
+
+/* Firmware update answers and credits, from the update task (never from the GATT callback) */
+static void BleOtaNotify(uint16_t conn_id, const uint8_t *data, uint16_t len){
+	if(xSemaphoreTake(tx_credits, pdMS_TO_TICKS(TX_WAIT_MS)) != pdTRUE){
+		return;
+	}
+	if(esp_ble_gatts_send_indicate(spp_profile_tab[SPP_PROFILE_APP_IDX].gatts_if, conn_id,
+			spp_handle_table[SPP_IDX_OTA_CTRL_VAL], len, (uint8_t *)data, false) != ESP_OK){
+		xSemaphoreGive(tx_credits);
+	}
+}
+#endif
+
+/* Status, connection count and the MTU every device can take */
+static void BleConnUpdate(void){
+	uint8_t count = 0;
+	uint16_t mtu = 0;
+	bool ready = false;
+
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(!conns[i].used){
+			continue;
+		}
+		count++;
+		ready |= conns[i].authenticated;
+		if(mtu == 0 || conns[i].mtu < mtu){
+			mtu = conns[i].mtu;
+		}
+	}
+	conns_count = count;
+	ble_mtu = (mtu == 0) ? MTU_DEFAULT : mtu;
+	status = ready ? BLE_CONNECTED : BLE_DISCONNECTED;
+}
+
+static void BleConnAdd(const CMD_t *cmd){
+	uint8_t i;
+
+	for(i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(!conns[i].used){
+			conns[i].conn_id = cmd->spp_conn_id;
+			conns[i].mtu = MTU_DEFAULT;
+			conns[i].authenticated = false;
+			conns[i].subscribed = false;
+			conns[i].congested = false;
+			memcpy(conns[i].bda, cmd->bda, sizeof(esp_bd_addr_t));
+			conns[i].used = true;
+			break;
+		}
+	}
+	if(i == BLE_MAX_CONNECTIONS){
+		/* more links than BLE_MAX_CONNECTIONS allowed by the controller */
+		esp_ble_gatts_close(spp_profile_tab[SPP_PROFILE_APP_IDX].gatts_if, cmd->spp_conn_id);
+		return;
+	}
+	BleConnUpdate();
+	/* advertising stops with each connection: keep it going while there is room */
+	if(conns_count < BLE_MAX_CONNECTIONS){
+		esp_ble_gap_start_advertising(&spp_adv_params);
+	}
+}
+
+static void BleConnRemove(uint16_t conn_id){
+	ble_conn_t *conn = BleConnFind(conn_id);
+	bool was_full = (conns_count == BLE_MAX_CONNECTIONS);
+
+	if(conn == NULL){
+		return;		/* closed by BleConnAdd, never counted */
+	}
+	conn->used = false;
+	conn->congested = false;
+	BleConnUpdate();
+	/* its pending send-complete events are lost, the other devices may resume */
+	TxResetFlowControl();
+	if(conns_count == 0){
+		link_stats.interval = 0;
+		link_stats.latency = 0;
+		link_stats.tx_phy = ESP_BLE_GAP_PHY_1M;
+		link_stats.rx_phy = ESP_BLE_GAP_PHY_1M;
+		link_stats.rssi = BLE_RSSI_UNKNOWN;
+		/* nobody left: directed advertising to the last central again */
+		if(!was_full){
+			esp_ble_gap_stop_advertising();
+		}
+		BleStartAdvertising();
+	}else if(was_full){
+		esp_ble_gap_start_advertising(&spp_adv_params);
+	}
+}
+
+/* The same buffer is notified to every subscribed device, in chunks of its own MTU */
+static void TxFanOut(tx_buffer_t *tx){
+	int data_sent, chunk;
+	bool sent = false;
+
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		ble_conn_t *conn = &conns[i];
+		if(!conn->used || !conn->authenticated || !conn->subscribed){
+			continue;
+		}
+		/* biggest notification allowed by the negotiated MTU, holding only whole frames */
+		chunk = conn->mtu - ATT_HEADER_BYTES;
+		if(tx->frame_size > 1 && chunk >= tx->frame_size){
+			chunk -= chunk % tx->frame_size;
+		}
+		data_sent = 0;
+		while(data_sent < tx->length){
+			if((tx->length - data_sent) < chunk){
+				chunk = tx->length - data_sent;
+			}
+			if(!TxNotify(conn, &tx->payload[data_sent], chunk)){
+				/* a slow device loses this buffer, the others still get it */
+				tx_dropped++;
+				break;
+			}
+			data_sent += chunk;
+		}
+		sent = true;
+	}
+	if(!sent){
+		tx_dropped++;
+	}
+}
+
 void bluetooth_events_task(void * arg) {
 	CMD_t cmdBuf;
-	uint16_t spp_conn_id = 0xffff;
-	esp_gatt_if_t spp_gatts_if = 0xff;
-	int data_sent, i;
+	ble_conn_t *conn;
+	uint16_t waiting;
 
 	while(1){
-		vTaskDelay(50 / portTICK_PERIOD_MS);
 		xQueueReceive(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		waiting = uxQueueMessagesWaiting(xQueueEvents) + 1;
+		if(waiting > events_max){
+			events_max = waiting;
+		}
         switch(cmdBuf.command){
             case CMD_BLUETOOTH_CONNECT:
-                spp_conn_id = cmdBuf.spp_conn_id;
-                spp_gatts_if = cmdBuf.spp_gatts_if;
+                BleConnAdd(&cmdBuf);
             break;
             case CMD_BLUETOOTH_AUTH:
-                ESP_LOGI(TAG, "Device connected");
-				status = BLE_CONNECTED;
+				if(!cmdBuf.value){
+					/* the link stays unauthenticated: nothing is sent to it */
+					LOG_DEFER(TAG ": Pairing failed\r\n");
+					break;
+				}
+				conn = BleConnFindAuth(cmdBuf.bda);
+				if(conn == NULL){
+					LOG_DEFER(TAG ": Paired device without link\r\n");
+					break;
+				}
+                LOG_DEFER(TAG ": Device connected\r\n");
+				conn->authenticated = true;
+				BleConnUpdate();
             break;
             case CMD_BLUETOOTH_DISCONNECT:
-                ESP_LOGI(TAG, "Device disconnected");
-				status = BLE_DISCONNECTED;
+                LOG_DEFER(TAG ": Device disconnected\r\n");
+				BleConnRemove(cmdBuf.spp_conn_id);
+            break;
+            case CMD_BLUETOOTH_MTU:
+				conn = BleConnFind(cmdBuf.spp_conn_id);
+				if(conn != NULL){
+					conn->mtu = cmdBuf.value;
+					BleConnUpdate();
+				}
+            break;
+            case CMD_BLUETOOTH_SUBSCRIBE:
+				conn = BleConnFind(cmdBuf.spp_conn_id);
+				if(conn != NULL){
+					conn->subscribed = (cmdBuf.value & 0x0001) != 0;
+				}
             break;
             case CMD_SEND_DATA:
-                if (status == BLE_CONNECTED) {
-					data_sent = 0;
-					i = 0;
-					while(data_sent < cmdBuf.length){
-						if((cmdBuf.length - data_sent) > MTU_MAX_BYTES){
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], MTU_MAX_BYTES, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-							i++;
-						}else{
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], cmdBuf.length - data_sent, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
-							data_sent += MTU_MAX_BYTES;
-						}
-					}
+                if (status != BLE_CONNECTED) {
+					tx_dropped++;
+				} else {
+					TxFanOut(cmdBuf.tx_buffer);
                 }
-            break;
-            case CMD_BLUETOOTH_DATA:
-                xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
+                /* the stack keeps its own copy of each notification: the buffer can be reused */
+                TxBufferRelease(cmdBuf.tx_buffer);
             break;
         }
 	} 
 }
 
-/*==================[external functions definition]==========================*/
-void BleInit(ble_config_t * ble_device){
-esp_err_t ret;
-    device_name = ble_device->device_name;
-    ble_read_isr_p = ble_device->func_p;
-	/* Initialize NVS. */
-	ret = nvs_flash_init();
-	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-		ESP_ERROR_CHECK(nvs_flash_erase());
-		ret = nvs_flash_init();
+/* Rates of the last second, RSSI request and link statistics characteristic value */
+static void BleStatsTimer(TimerHandle_t timer){
+	static uint32_t last_notifications = 0, last_bytes = 0;
+	ble_link_stats_t stats;
+	ble_link_record_t record;
+	uint32_t notifications = tx_notifications, bytes = tx_bytes;
+
+	link_stats.notifications_per_s = notifications - last_notifications;
+	link_stats.bytes_per_s = bytes - last_bytes;
+	last_notifications = notifications;
+	last_bytes = bytes;
+	/* the value arrives with ESP_GAP_BLE_READ_RSSI_COMPLETE_EVT, of the first connected device */
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(conns[i].used){
+			esp_ble_gap_read_rssi(conns[i].bda);
+			break;
+		}
 	}
-	ESP_ERROR_CHECK(ret);
+	if(spp_handle_table[SPP_IDX_STATS_VAL] != 0){
+		BleGetLinkStats(&stats);
+		BleLinkStatsPack(&stats, &record);
+		esp_ble_gatts_set_attr_value(spp_handle_table[SPP_IDX_STATS_VAL], sizeof(record), (const uint8_t *)&record);
+	}
+}
+
+/* Copies the cached state into the attribute table, the stack keeps its own copy */
+static void BleStateUpdate(void){
+	uint8_t value[BLE_STATE_MAX_LEN];
+	uint16_t len;
+
+	if(spp_handle_table[SPP_IDX_STATE_VAL] == 0){
+		return;
+	}
+	portENTER_CRITICAL(&state_lock);
+	len = state_len;
+	memcpy(value, state_val, len);
+	portEXIT_CRITICAL(&state_lock);
+	esp_ble_gatts_set_attr_value(spp_handle_table[SPP_IDX_STATE_VAL], len, value);
+}
+
+/* Asks a central for the connection timing of a profile */
+static void BleUpdateConnParams(const esp_bd_addr_t bda, ble_link_profile_t profile){
+	esp_ble_conn_update_params_t conn_params = {
+		.min_int = link_params[profile].conn_int_min,
+		.max_int = link_params[profile].conn_int_max,
+		.latency = link_params[profile].latency,
+		.timeout = link_params[profile].timeout,
+	};
+	memcpy(conn_params.bda, bda, sizeof(esp_bd_addr_t));
+	esp_ble_gap_update_conn_params(&conn_params);
+}
+
+/* Controller and Bluedroid bring-up and GATT registration, the table, the
+ * advertising data and the advertising itself follow from the stack events */
+static bool BleStackStart(void){
+	esp_err_t ret;
+	/* the stack events are logged with LOG_DEFER, printed by a low priority task */
+	LogDeferInit(tskIDLE_PRIORITY + 1);
 	ESP_ERROR_CHECK(esp_bt_controller_mem_release(ESP_BT_MODE_CLASSIC_BT));
 	esp_bt_controller_config_t bt_cfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
 	ret = esp_bt_controller_init(&bt_cfg);
 	if (ret) {
 		ESP_LOGE(TAG, "%s init controller failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bt_controller_enable(ESP_BT_MODE_BLE);
 	if (ret) {
 		ESP_LOGE(TAG, "%s enable controller failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bluedroid_init();
 	if (ret) {
 		ESP_LOGE(TAG, "%s init bluetooth failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_bluedroid_enable();
 	if (ret) {
 		ESP_LOGE(TAG, "%s enable bluetooth failed: %s", __func__, esp_err_to_name(ret));
-		return;
+		return false;
 	}
 	ret = esp_ble_gatts_register_callback(gatts_event_handler);
 	if (ret){
 		ESP_LOGE(TAG, "gatts register error, error code = %x", ret);
-		return;
+		return false;
 	}
 	ret = esp_ble_gap_register_callback(gap_event_handler);
 	if (ret){
 		ESP_LOGE(TAG, "gap register error, error code = %x", ret);
-		return;
+		return false;
 	}
 	ret = esp_ble_gatts_app_register(ESP_SPP_APP_ID);
 	if (ret){
 		ESP_LOGE(TAG, "gatts app register error, error code = %x", ret);
-		return;
+		return false;
+	}
+	ret = esp_ble_gatt_set_local_mtu(MTU_LOCAL);
+	if (ret){
+		ESP_LOGE(TAG, "set local MTU failed, error code = %x", ret);
 	}
 	/* set the security iocap & auth_req & key size & init key response key parameters to the stack*/
 	esp_ble_auth_req_t auth_req = ESP_LE_AUTH_REQ_SC_MITM_BOND;		//bonding with peer device after authentication
@@ -515,16 +1202,69 @@ esp_err_t ret;
 	esp_ble_gap_set_security_param(ESP_BLE_SM_OOB_SUPPORT, &oob_support, sizeof(uint8_t));
 	esp_ble_gap_set_security_param(ESP_BLE_SM_SET_INIT_KEY, &init_key, sizeof(uint8_t));
 	esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
-	
+	return true;
+}
+
+/* Starts the stack without blocking BleInit() and reports when it is advertising */
+static void BleInitTask(void *arg){
+	/* before the stack starts: the first advertising already targets the last central */
+	BlePeerLoad();
+	if(BleStackStart()){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if(ble_ready_p != NULL){
+			ble_ready_p();
+		}
+	}
+	ble_init_task = NULL;
+	vTaskDelete(NULL);
+}
+
+/*==================[external functions definition]==========================*/
+void BleInit(ble_config_t * ble_device){
+	esp_err_t ret;
+    device_name = ble_device->device_name;
+    ble_read_isr_p = ble_device->func_p;
+	ble_ready_p = ble_device->ready_p;
+	ble_commands = ble_device->commands;
+	ble_n_commands = ble_device->n_commands;
+	if(ble_device->hid){
+		ESP_LOGE(TAG, "%s: serial and HID services together need the NimBLE host (CONFIG_BT_NIMBLE_ENABLED)", __func__);
+	}
+	/* Initialize NVS (synchronous, the application can use it as soon as BleInit returns) */
+	ret = nvs_flash_init();
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		ret = nvs_flash_init();
+	}
+	ESP_ERROR_CHECK(ret);
+	directed_timer = xTimerCreate("ble_directed", pdMS_TO_TICKS(DIRECTED_ADV_MS), pdFALSE, NULL, BleDirectedTimeout);
+	configASSERT(directed_timer);
+	stats_timer = xTimerCreate("ble_stats", pdMS_TO_TICKS(STATS_INTERVAL_MS), pdTRUE, NULL, BleStatsTimer);
+	configASSERT(stats_timer);
+	xTimerStart(stats_timer, 0);
     /* Create Queue */
-	xQueueEvents = xQueueCreate(10, sizeof(CMD_t));
+	xQueueEvents = QueueCreateStored(&events_queue_storage);
 	configASSERT(xQueueEvents);
-	xQueueRead = xQueueCreate( 10, sizeof(CMD_t) );
-	configASSERT(xQueueRead);
+	rx_ring = xMessageBufferCreate(RX_RING_SIZE);
+	configASSERT(rx_ring);
+	xQueueTxFree = QueueCreateStored(&tx_free_storage);
+	configASSERT(xQueueTxFree);
+	tx_credits = xSemaphoreCreateCounting(TX_CREDITS, TX_CREDITS);
+	configASSERT(tx_credits);
+	tx_uncongested = xSemaphoreCreateBinary();
+	configASSERT(tx_uncongested);
+	for(uint8_t i = 0; i < TX_POOL_SIZE; i++){
+		tx_buffer_t *buffer = &tx_pool[i];
+		xQueueSend(xQueueTxFree, &buffer, 0);
+	}
 
 	/* Start tasks */
-	xTaskCreate(read_task, "read", 1024*4, NULL, 2, NULL);
-	xTaskCreate(bluetooth_events_task, "bluetooth_events", 1024*4, NULL, 10, NULL);
+	TaskCreateStored(&read_storage, read_task, "read", NULL, 2, NULL);
+	TaskCreateStored(&events_storage, bluetooth_events_task, "bluetooth_events", NULL, 10, NULL);
+	TaskCreateStored(&init_storage, BleInitTask, "ble_init", NULL, 5, &ble_init_task);
+#if CONFIG_DRIVERS_BLE_OTA
+	BleOtaInit(BleOtaNotify, ble_device->ota_p);
+#endif
 }
 
 ble_status_t BleStatus(void){
@@ -532,35 +1272,133 @@ ble_status_t BleStatus(void){
 }
 
 void BleSendByte(const char *data){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 1;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
-	}
+	TxCopyAndQueue(data, 1, 0, portMAX_DELAY);
 }
 
 void BleSendString(const char *msg){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = 0;
-		while(msg[cmdBuf.length] != '\0'){
-			cmdBuf.length++;
+	TxCopyAndQueue(msg, strlen(msg), 0, portMAX_DELAY);
+}
+
+void BleSendBuffer(const char *data, uint8_t nbytes){
+	TxCopyAndQueue(data, nbytes, 0, portMAX_DELAY);
+}
+
+ble_tx_result_t BleTrySend(const char *data, uint16_t nbytes){
+	if(status != BLE_CONNECTED){
+		return BLE_TX_NOT_CONNECTED;
+	}
+	if(!TxCopyAndQueue(data, nbytes, 0, 0)){
+		return BLE_TX_BUSY;
+	}
+	return BLE_TX_OK;
+}
+
+uint8_t * BleTxBufferGet(void){
+	tx_buffer_t *buffer;
+	if(status != BLE_CONNECTED){
+		return NULL;
+	}
+	buffer = TxBufferTake(0);
+	if(buffer == NULL){
+		return NULL;
+	}
+	return buffer->payload;
+}
+
+void BleTxBufferSend(uint8_t *buffer, uint16_t nbytes){
+	tx_buffer_t *tx = (tx_buffer_t *)(buffer - offsetof(tx_buffer_t, payload));
+	tx->length = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes;
+	tx->frame_size = 0;
+	TxBufferQueue(tx);
+}
+
+uint16_t BleGetMtu(void){
+	return ble_mtu;
+}
+
+uint8_t BleConnections(void){
+	return conns_count;
+}
+
+void BleSendBatch(const void *frames, uint16_t frame_size, uint16_t n_frames){
+	const uint8_t *data = frames;
+	size_t total, sent = 0;
+	uint16_t max_len = PAYLOAD_SIZE, len;
+
+	if(status != BLE_CONNECTED || frame_size == 0 || frame_size > PAYLOAD_SIZE){
+		return;
+	}
+	/* every queued transaction carries only whole frames */
+	if(frame_size > 1){
+		max_len -= PAYLOAD_SIZE % frame_size;
+	}
+	total = (size_t)frame_size * n_frames;
+	while(sent < total){
+		len = ((total - sent) > max_len) ? max_len : (total - sent);
+		if(!TxCopyAndQueue(&data[sent], len, frame_size, portMAX_DELAY)){
+			return;
 		}
-		memcpy(cmdBuf.payload, msg, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		sent += len;
 	}
 }
 
-void BleSendBuffer(const char *data, uint8_t nbytes){
-	CMD_t cmdBuf;
-	if(status == BLE_CONNECTED){
-		cmdBuf.command = CMD_SEND_DATA;
-		cmdBuf.length = nbytes;
-		memcpy(cmdBuf.payload, data, cmdBuf.length);
-		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+void BleGetTxStats(ble_tx_stats_t *stats){
+	stats->queue_depth = (xQueueTxFree == NULL) ? 0 : TX_POOL_SIZE - uxQueueMessagesWaiting(xQueueTxFree);
+	stats->queue_max = tx_queue_max;
+	stats->notifications = tx_notifications;
+	stats->dropped = tx_dropped;
+	stats->congested = tx_congested;
+}
+
+void BleGetLinkStats(ble_link_stats_t *stats){
+	*stats = link_stats;
+	stats->mtu = ble_mtu;
+	stats->notifications = tx_notifications;
+	stats->bytes = tx_bytes;
+	stats->events_max = events_max;
+	stats->queue_max = tx_queue_max;
+	stats->dropped = tx_dropped;
+	stats->blocked = tx_blocked;
+}
+
+bool BleSetState(const void *data, uint16_t len){
+	bool changed;
+
+	if(len > BLE_STATE_MAX_LEN){
+		return false;
+	}
+	portENTER_CRITICAL(&state_lock);
+	changed = (len != state_len) || memcmp(state_val, data, len) != 0;
+	if(changed){
+		memcpy(state_val, data, len);
+		state_len = len;
+	}
+	portEXIT_CRITICAL(&state_lock);
+	if(changed){
+		BleStateUpdate();
+	}
+	return true;
+}
+
+void BleSetLinkProfile(ble_link_profile_t profile){
+	if(profile == link_profile){
+		return;
+	}
+	link_profile = profile;
+	spp_adv_params.adv_int_min = link_params[profile].adv_int_min;
+	spp_adv_params.adv_int_max = link_params[profile].adv_int_max;
+	for(uint8_t i = 0; i < BLE_MAX_CONNECTIONS; i++){
+		if(conns[i].used){
+			BleUpdateConnParams(conns[i].bda, profile);
+		}
+	}
+	if(status != BLE_OFF && conns_count < BLE_MAX_CONNECTIONS){
+		/* restart advertising with the new interval */
+		if(!directed_adv){
+			esp_ble_gap_stop_advertising();
+			esp_ble_gap_start_advertising(&spp_adv_params);
+		}
 	}
 }
-/*==================[end of file]============================================*/
\ No newline at end of file
+
+/*==================[end of file]============================================*/
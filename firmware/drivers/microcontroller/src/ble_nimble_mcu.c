@@ -0,0 +1,1150 @@
+/**
+ * @file ble_nimble_mcu.c
+ * @brief BLE (ble_mcu.h) and BLE HID (ble_hid_mcu.h) drivers on the NimBLE host:
+ * the serial data service and the HID service share one host stack, one
+ * advertising set and one connection
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ble_mcu.h"
+#include "ble_hid_mcu.h"
+#include "ble_hid_report_map.h"
+#include "ble_command_parser.h"
+#include "ble_link_stats.h"
+#include "rtos_alloc_mcu.h"
+#include "log_mcu.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "nvs_flash.h"
+
+#include "esp_log.h"
+
+#include "nimble/nimble_port.h"
+#include "nimble/nimble_port_freertos.h"
+#include "host/ble_hs.h"
+#include "host/util/util.h"
+#include "services/gap/ble_svc_gap.h"
+#include "services/gatt/ble_svc_gatt.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/timers.h"
+#include "freertos/message_buffer.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "ble_nimble_mcu"
+#define MTU_DEFAULT			BLE_ATT_MTU_DFLT	/* GATT MTU before the exchange (23 bytes) */
+#define MTU_LOCAL			247	 /* GATT MTU requested by this device (one 251 bytes LL packet with DLE) */
+#define ATT_HEADER_BYTES	3	 /* ATT notification header (opcode + handle) */
+#define DLE_TX_OCTETS		251	 /* Data Length Extension maximum LL payload */
+#define DLE_TX_TIME			2120 /* Air time of a 251 bytes LL packet on the 1M PHY (us) */
+#define PAYLOAD_SIZE        (MTU_LOCAL - ATT_HEADER_BYTES)  /* Maximun number of bytes transmitted in one transaction */
+#define TX_POOL_SIZE        8       /* Number of preallocated transmission buffers */
+#define TX_WAIT_MS          500     /* Maximum time waiting for the controller before dropping a buffer */
+#define DIRECTED_ADV_MS     1280    /* High duty cycle directed advertising length (Core spec limit) */
+#define MAX_BONDED_PEERS    8
+#define READ_TASK_STACK     4096    /* Stack of each driver task (bytes) */
+#define TX_TASK_STACK       4096
+#define HID_TX_TASK_STACK   3072
+/* Serial data service (HM-10 compatible) */
+#define SPP_SERVICE_UUID			0xFFE0
+#define SPP_DATA_UUID				0xFFE1
+/* HID over GATT */
+#define HID_SERVICE_UUID			0x1812
+#define HID_INFORMATION_UUID		0x2A4A
+#define HID_REPORT_MAP_UUID			0x2A4B
+#define HID_CONTROL_POINT_UUID		0x2A4C
+#define HID_REPORT_UUID				0x2A4D
+#define HID_PROTOCOL_MODE_UUID		0x2A4E
+#define HID_REPORT_REF_UUID			0x2908
+#define BATTERY_SERVICE_UUID		0x180F
+#define BATTERY_LEVEL_UUID			0x2A19
+#define DEVICE_INFO_SERVICE_UUID	0x180A
+#define PNP_ID_UUID					0x2A50
+#define HID_APPEARANCE				0x03C0	/* Generic HID */
+#define HID_RPT_ID_MOUSE_IN			1
+#define HID_RPT_ID_KEY_IN			2
+#define HID_RPT_ID_CC_IN			3
+#define HID_RPT_ID_LED_OUT			2
+#define HID_REPORT_TYPE_INPUT		1
+#define HID_REPORT_TYPE_OUTPUT		2
+#define HID_KEYBOARD_IN_RPT_LEN		8
+#define HID_MOUSE_IN_RPT_LEN		5
+#define HID_CC_IN_RPT_LEN			2
+#define HID_PROTOCOL_MODE_REPORT	0x01
+#define HID_FLAGS_REMOTE_WAKE		0x01
+#define HID_REPORTS_PER_EVENT		4		/* Reports sent per connection interval (pipelined) */
+#define HID_QUEUE_WAIT_MS			100		/* Maximum wait for room in the report queue (keyboard) */
+/*==================[typedef]================================================*/
+/* Transmission buffer, taken from the TX pool and given back once it has been sent */
+typedef struct {
+	uint16_t length;
+	uint16_t frame_size;	/* Frames are never split between notifications (0 or 1: byte stream) */
+	uint8_t payload[PAYLOAD_SIZE];
+} tx_buffer_t;
+/* Advertising and connection timing of a link profile */
+typedef struct {
+	uint16_t adv_int_min;	/* Advertising interval (0.625 ms units) */
+	uint16_t adv_int_max;
+	uint16_t conn_int_min;	/* Connection interval (1.25 ms units) */
+	uint16_t conn_int_max;
+	uint16_t latency;		/* Connection events the peripheral may skip */
+	uint16_t timeout;		/* Supervision timeout (10 ms units) */
+} link_params_t;
+/* Input report waiting to be sent */
+typedef struct {
+	uint8_t id;								/* HID_RPT_ID_MOUSE_IN or HID_RPT_ID_KEY_IN */
+	uint8_t len;
+	uint8_t data[HID_KEYBOARD_IN_RPT_LEN];
+} hid_report_t;
+/* Attributes served by HidAccess() */
+typedef enum {
+	HID_ATTR_INFO,
+	HID_ATTR_REPORT_MAP,
+	HID_ATTR_CONTROL_POINT,
+	HID_ATTR_PROTOCOL_MODE,
+	HID_ATTR_MOUSE_IN,
+	HID_ATTR_KEY_IN,
+	HID_ATTR_LED_OUT,
+	HID_ATTR_CC_IN,
+	HID_ATTR_BATTERY_LEVEL,
+	HID_ATTR_PNP_ID,
+} hid_attr_t;
+/*==================[internal data declaration]==============================*/
+static char * device_name;						/* Device name */
+static read_func ble_read_isr_p = BLE_NO_INT;	/* Pointer to callback function for reading data */
+static ready_func ble_ready_p = NULL;			/* Called once the device is advertising */
+static const ble_command_t *ble_commands = NULL;	/* Received commands dispatch table */
+static uint8_t ble_n_commands = 0;
+static volatile ble_status_t status = BLE_OFF;
+static bool spp_enabled = false;				/* Serial data service registered */
+static bool hid_enabled = false;				/* HID service registered */
+static bool host_started = false;
+static uint8_t own_addr_type;
+static bool adv_directed = false;				/* Directed advertising to the last bonded central in progress */
+static uint16_t conn_handle = BLE_HS_CONN_HANDLE_NONE;
+static uint16_t ble_mtu = MTU_DEFAULT;			/* Negotiated GATT MTU */
+static uint16_t spp_val_handle;					/* Serial data characteristic value */
+static uint16_t hid_mouse_in_handle;
+static uint16_t hid_key_in_handle;
+static MessageBufferHandle_t rx_ring = NULL;	/* Received writes, only their own length is copied */
+static QueueHandle_t xQueueTx = NULL;			/* Buffers waiting to be sent */
+static QueueHandle_t xQueueTxFree = NULL;		/* Free transmission buffers of the TX pool */
+static tx_buffer_t tx_pool[TX_POOL_SIZE];
+static volatile bool tx_congested = false;		/* The host ran out of buffers */
+static volatile uint32_t tx_notifications = 0;	/* Notifications sent */
+static volatile uint32_t tx_dropped = 0;		/* Buffers discarded (pool exhausted, timeout or disconnection) */
+static volatile uint16_t tx_queue_max = 0;		/* Maximum number of buffers waiting to be sent */
+static volatile uint32_t tx_bytes = 0;			/* Bytes sent */
+static volatile uint32_t tx_blocked = 0;		/* Sends that waited for a free buffer */
+static uint16_t events_max = 0;					/* Maximum number of buffers waiting in xQueueTx */
+static ble_link_stats_t link_stats = {			/* Connection parameters and rates (BleStatsTimer) */
+	.tx_phy = BLE_GAP_LE_PHY_1M, .rx_phy = BLE_GAP_LE_PHY_1M, .rssi = BLE_RSSI_UNKNOWN,
+};
+static TimerHandle_t stats_timer = NULL;		/* Rates and RSSI */
+static ble_link_profile_t link_profile = BLE_LINK_FAST;
+/* HID input reports waiting to be sent: one ring for both report types */
+static hid_report_t hid_queue[BLE_HID_QUEUE_SIZE];
+static uint8_t hid_queue_head = 0;
+static volatile uint8_t hid_queue_count = 0;
+static bool hid_queue_sending = false;			/* The head report is being sent, don't merge into it */
+static portMUX_TYPE hid_queue_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t state_val[BLE_STATE_MAX_LEN];	/* Last value given to BleSetState */
+static uint16_t state_len = 0;
+static portMUX_TYPE state_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t hid_tx_task = NULL;
+TASK_STORAGE_DEFINE(read_storage, READ_TASK_STACK);
+TASK_STORAGE_DEFINE(tx_storage, TX_TASK_STACK);
+TASK_STORAGE_DEFINE(hid_tx_storage, HID_TX_TASK_STACK);
+QUEUE_STORAGE_DEFINE(tx_queue_storage, TX_POOL_SIZE, sizeof(tx_buffer_t *));
+QUEUE_STORAGE_DEFINE(tx_free_storage, TX_POOL_SIZE, sizeof(tx_buffer_t *));
+static uint8_t hid_protocol_mode = HID_PROTOCOL_MODE_REPORT;
+static uint8_t hid_led_out = 0;
+static uint8_t battery_level = 100;
+
+/*==================[internal functions declaration]=========================*/
+static int SppAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int StatsAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int StateAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int HidAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg);
+static int BleGapEvent(struct ble_gap_event *event, void *arg);
+/*==================[internal data definition]===============================*/
+/* Link profiles timing, the supervision timeout covers the skipped events with margin */
+static const link_params_t link_params[] = {
+	[BLE_LINK_FAST] = {
+		.adv_int_min = 0x20, .adv_int_max = 0x40,			/* 20 - 40 ms */
+		.conn_int_min = 0x06, .conn_int_max = 0x10,			/* 7.5 - 20 ms */
+		.latency = 0, .timeout = 400,						/* 4 s */
+	},
+	[BLE_LINK_LOW_POWER] = {
+		.adv_int_min = 0x640, .adv_int_max = 0x780,			/* 1 - 1.2 s */
+		.conn_int_min = 0x50, .conn_int_max = 0xA0,			/* 100 - 200 ms */
+		.latency = 4, .timeout = 600,						/* 6 s */
+	},
+};
+/* HID Information: bcdHID 1.11, no country code, remote wake */
+static const uint8_t hid_info[] = {0x11, 0x01, 0x00, HID_FLAGS_REMOTE_WAKE};
+/* PnP ID: USB vendor ID source, Espressif VID, product 0x0000, version 1.0 */
+static const uint8_t pnp_id[] = {0x02, 0xE5, 0x02, 0x00, 0x00, 0x00, 0x01};
+/* Report Reference descriptors (report ID, report type) */
+static const uint8_t hid_ref_mouse_in[] = {HID_RPT_ID_MOUSE_IN, HID_REPORT_TYPE_INPUT};
+static const uint8_t hid_ref_key_in[] = {HID_RPT_ID_KEY_IN, HID_REPORT_TYPE_INPUT};
+static const uint8_t hid_ref_led_out[] = {HID_RPT_ID_LED_OUT, HID_REPORT_TYPE_OUTPUT};
+static const uint8_t hid_ref_cc_in[] = {HID_RPT_ID_CC_IN, HID_REPORT_TYPE_INPUT};
+/* Serial data service database */
+static const struct ble_gatt_svc_def spp_svcs[] = {
+	{
+		.type = BLE_GATT_SVC_TYPE_PRIMARY,
+		.uuid = BLE_UUID16_DECLARE(SPP_SERVICE_UUID),
+		.characteristics = (struct ble_gatt_chr_def[]) {
+			{
+				.uuid = BLE_UUID16_DECLARE(SPP_DATA_UUID),
+				.access_cb = SppAccess,
+				.val_handle = &spp_val_handle,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_NO_RSP |
+						 BLE_GATT_CHR_F_NOTIFY,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(STATS_UUID),
+				.access_cb = StatsAccess,
+				.flags = BLE_GATT_CHR_F_READ,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(BLE_STATE_UUID),
+				.access_cb = StateAccess,
+				.flags = BLE_GATT_CHR_F_READ,
+			},
+			{0},
+		},
+	},
+	{0},
+};
+/* HID, battery and device information services database (reports need an encrypted link) */
+static const struct ble_gatt_svc_def hid_svcs[] = {
+	{
+		.type = BLE_GATT_SVC_TYPE_PRIMARY,
+		.uuid = BLE_UUID16_DECLARE(HID_SERVICE_UUID),
+		.characteristics = (struct ble_gatt_chr_def[]) {
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_INFORMATION_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_INFO,
+				.flags = BLE_GATT_CHR_F_READ,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_REPORT_MAP_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_REPORT_MAP,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_READ_ENC,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_CONTROL_POINT_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_CONTROL_POINT,
+				.flags = BLE_GATT_CHR_F_WRITE_NO_RSP,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_PROTOCOL_MODE_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_PROTOCOL_MODE,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE_NO_RSP,
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_REPORT_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_MOUSE_IN,
+				.val_handle = &hid_mouse_in_handle,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_READ_ENC | BLE_GATT_CHR_F_NOTIFY,
+				.descriptors = (struct ble_gatt_dsc_def[]) {
+					{
+						.uuid = BLE_UUID16_DECLARE(HID_REPORT_REF_UUID),
+						.att_flags = BLE_ATT_F_READ,
+						.access_cb = HidAccess,
+						.arg = (void *)hid_ref_mouse_in,
+					},
+					{0},
+				},
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_REPORT_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_KEY_IN,
+				.val_handle = &hid_key_in_handle,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_READ_ENC | BLE_GATT_CHR_F_NOTIFY,
+				.descriptors = (struct ble_gatt_dsc_def[]) {
+					{
+						.uuid = BLE_UUID16_DECLARE(HID_REPORT_REF_UUID),
+						.att_flags = BLE_ATT_F_READ,
+						.access_cb = HidAccess,
+						.arg = (void *)hid_ref_key_in,
+					},
+					{0},
+				},
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_REPORT_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_LED_OUT,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_READ_ENC | BLE_GATT_CHR_F_WRITE |
+						 BLE_GATT_CHR_F_WRITE_NO_RSP | BLE_GATT_CHR_F_WRITE_ENC,
+				.descriptors = (struct ble_gatt_dsc_def[]) {
+					{
+						.uuid = BLE_UUID16_DECLARE(HID_REPORT_REF_UUID),
+						.att_flags = BLE_ATT_F_READ,
+						.access_cb = HidAccess,
+						.arg = (void *)hid_ref_led_out,
+					},
+					{0},
+				},
+			},
+			{
+				.uuid = BLE_UUID16_DECLARE(HID_REPORT_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_CC_IN,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_READ_ENC | BLE_GATT_CHR_F_NOTIFY,
+				.descriptors = (struct ble_gatt_dsc_def[]) {
+					{
+						.uuid = BLE_UUID16_DECLARE(HID_REPORT_REF_UUID),
+						.att_flags = BLE_ATT_F_READ,
+						.access_cb = HidAccess,
+						.arg = (void *)hid_ref_cc_in,
+					},
+					{0},
+				},
+			},
+			{0},
+		},
+	},
+	{
+		.type = BLE_GATT_SVC_TYPE_PRIMARY,
+		.uuid = BLE_UUID16_DECLARE(BATTERY_SERVICE_UUID),
+		.characteristics = (struct ble_gatt_chr_def[]) {
+			{
+				.uuid = BLE_UUID16_DECLARE(BATTERY_LEVEL_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_BATTERY_LEVEL,
+				.flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
+			},
+			{0},
+		},
+	},
+	{
+		.type = BLE_GATT_SVC_TYPE_PRIMARY,
+		.uuid = BLE_UUID16_DECLARE(DEVICE_INFO_SERVICE_UUID),
+		.characteristics = (struct ble_gatt_chr_def[]) {
+			{
+				.uuid = BLE_UUID16_DECLARE(PNP_ID_UUID),
+				.access_cb = HidAccess,
+				.arg = (void *)HID_ATTR_PNP_ID,
+				.flags = BLE_GATT_CHR_F_READ,
+			},
+			{0},
+		},
+	},
+	{0},
+};
+/*==================[external data definition]===============================*/
+void ble_store_config_init(void);
+
+/*==================[internal functions definition]==========================*/
+/*************************GATT access**************************/
+static int SppAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg){
+	uint8_t data[PAYLOAD_SIZE];
+	uint16_t len;
+
+	switch(ctxt->op){
+		case BLE_GATT_ACCESS_OP_READ_CHR:
+			return 0;
+		case BLE_GATT_ACCESS_OP_WRITE_CHR:
+			/* longer than a notification: keep the first PAYLOAD_SIZE bytes, as the Bluedroid driver */
+			len = OS_MBUF_PKTLEN(ctxt->om);
+			if(len > PAYLOAD_SIZE){
+				len = PAYLOAD_SIZE;
+			}
+			/* a write usually fits in one mbuf: straight from it into the ring */
+			if(ctxt->om->om_len >= len){
+				xMessageBufferSend(rx_ring, ctxt->om->om_data, len, 0);
+			}else if(os_mbuf_copydata(ctxt->om, 0, len, data) == 0){
+				xMessageBufferSend(rx_ring, data, len, 0);
+			}
+			return 0;
+		default:
+			return BLE_ATT_ERR_UNLIKELY;
+	}
+}
+
+/* The host serves the long reads from the whole value */
+static int StatsAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg){
+	ble_link_stats_t stats;
+	ble_link_record_t record;
+
+	if(ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR){
+		return BLE_ATT_ERR_UNLIKELY;
+	}
+	BleGetLinkStats(&stats);
+	BleLinkStatsPack(&stats, &record);
+	return (os_mbuf_append(ctxt->om, &record, sizeof(record)) == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+/* Answered from the cached value, the application is not involved */
+static int StateAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg){
+	uint8_t value[BLE_STATE_MAX_LEN];
+	uint16_t len;
+
+	if(ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR){
+		return BLE_ATT_ERR_UNLIKELY;
+	}
+	portENTER_CRITICAL(&state_lock);
+	len = state_len;
+	memcpy(value, state_val, len);
+	portEXIT_CRITICAL(&state_lock);
+	return (os_mbuf_append(ctxt->om, value, len) == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+static int HidAppend(struct ble_gatt_access_ctxt *ctxt, const void *data, uint16_t len){
+	return (os_mbuf_append(ctxt->om, data, len) == 0) ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+static int HidAccess(uint16_t conn, uint16_t attr_handle, struct ble_gatt_access_ctxt *ctxt, void *arg){
+	static const uint8_t zeros[HID_KEYBOARD_IN_RPT_LEN] = {0};
+
+	/* descriptors: arg points to the Report Reference value */
+	if(ctxt->op == BLE_GATT_ACCESS_OP_READ_DSC){
+		return HidAppend(ctxt, arg, 2);
+	}
+	switch((hid_attr_t)(uintptr_t)arg){
+		case HID_ATTR_INFO:
+			return HidAppend(ctxt, hid_info, sizeof(hid_info));
+		case HID_ATTR_REPORT_MAP:
+			return HidAppend(ctxt, hidReportMap, sizeof(hidReportMap));
+		case HID_ATTR_CONTROL_POINT:
+			/* suspend / exit suspend: nothing to do */
+			return 0;
+		case HID_ATTR_PROTOCOL_MODE:
+			if(ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR){
+				return ble_hs_mbuf_to_flat(ctxt->om, &hid_protocol_mode, 1, NULL) == 0 ? 0 : BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+			}
+			return HidAppend(ctxt, &hid_protocol_mode, 1);
+		case HID_ATTR_MOUSE_IN:
+			return HidAppend(ctxt, zeros, HID_MOUSE_IN_RPT_LEN);
+		case HID_ATTR_KEY_IN:
+			return HidAppend(ctxt, zeros, HID_KEYBOARD_IN_RPT_LEN);
+		case HID_ATTR_CC_IN:
+			return HidAppend(ctxt, zeros, HID_CC_IN_RPT_LEN);
+		case HID_ATTR_LED_OUT:
+			if(ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR){
+				return ble_hs_mbuf_to_flat(ctxt->om, &hid_led_out, 1, NULL) == 0 ? 0 : BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+			}
+			return HidAppend(ctxt, &hid_led_out, 1);
+		case HID_ATTR_BATTERY_LEVEL:
+			return HidAppend(ctxt, &battery_level, 1);
+		case HID_ATTR_PNP_ID:
+			return HidAppend(ctxt, pnp_id, sizeof(pnp_id));
+		default:
+			return BLE_ATT_ERR_UNLIKELY;
+	}
+}
+
+/*************************GAP**************************/
+/* The store keeps the bonds in pairing order: the last one is the most recent central */
+static bool BleLastPeer(ble_addr_t *peer){
+	ble_addr_t peers[MAX_BONDED_PEERS];
+	int n_peers = 0;
+	if(ble_store_util_bonded_peers(peers, &n_peers, MAX_BONDED_PEERS) != 0 || n_peers == 0){
+		return false;
+	}
+	*peer = peers[n_peers - 1];
+	return true;
+}
+
+/* directed: try the last bonded central first, it reconnects within a few ms of
+ * high duty advertising; regular advertising follows when it doesn't answer */
+static void BleAdvertise(bool directed){
+	struct ble_hs_adv_fields fields;
+	struct ble_hs_adv_fields rsp_fields;
+	struct ble_gap_adv_params adv_params;
+	ble_uuid16_t uuids[2];
+	ble_addr_t peer;
+	uint8_t n_uuids = 0;
+	int rc;
+
+	memset(&adv_params, 0, sizeof(adv_params));
+	adv_directed = directed && BleLastPeer(&peer);
+	if(adv_directed){
+		adv_params.conn_mode = BLE_GAP_CONN_MODE_DIR;
+		adv_params.high_duty_cycle = 1;
+		rc = ble_gap_adv_start(own_addr_type, &peer, DIRECTED_ADV_MS, &adv_params, BleGapEvent, NULL);
+		if(rc == 0){
+			LOG_DEFER(TAG ": Advertising start (directed)\r\n");
+			return;
+		}
+		adv_directed = false;
+	}
+
+	memset(&fields, 0, sizeof(fields));
+	fields.flags = BLE_HS_ADV_F_DISC_GEN | BLE_HS_ADV_F_BREDR_UNSUP;
+	fields.tx_pwr_lvl_is_present = 1;
+	fields.tx_pwr_lvl = BLE_HS_ADV_TX_PWR_LVL_AUTO;
+	if(spp_enabled){
+		uuids[n_uuids++] = (ble_uuid16_t)BLE_UUID16_INIT(SPP_SERVICE_UUID);
+	}
+	if(hid_enabled){
+		uuids[n_uuids++] = (ble_uuid16_t)BLE_UUID16_INIT(HID_SERVICE_UUID);
+		fields.appearance = HID_APPEARANCE;
+		fields.appearance_is_present = 1;
+	}
+	fields.uuids16 = uuids;
+	fields.num_uuids16 = n_uuids;
+	fields.uuids16_is_complete = 1;
+	rc = ble_gap_adv_set_fields(&fields);
+	if(rc != 0){
+		ESP_LOGE(TAG, "set advertising data failed, error code = %d", rc);
+		return;
+	}
+	/* the name goes in the scan response, there is no room left in the advertising data */
+	memset(&rsp_fields, 0, sizeof(rsp_fields));
+	rsp_fields.name = (uint8_t *)device_name;
+	rsp_fields.name_len = strlen(device_name);
+	rsp_fields.name_is_complete = 1;
+	rc = ble_gap_adv_rsp_set_fields(&rsp_fields);
+	if(rc != 0){
+		ESP_LOGE(TAG, "set scan response failed, error code = %d", rc);
+		return;
+	}
+	adv_params.conn_mode = BLE_GAP_CONN_MODE_UND;
+	adv_params.disc_mode = BLE_GAP_DISC_MODE_GEN;
+	adv_params.itvl_min = link_params[link_profile].adv_int_min;
+	adv_params.itvl_max = link_params[link_profile].adv_int_max;
+	rc = ble_gap_adv_start(own_addr_type, NULL, BLE_HS_FOREVER, &adv_params, BleGapEvent, NULL);
+	if(rc != 0){
+		ESP_LOGE(TAG, "advertising start failed, error code = %d", rc);
+		return;
+	}
+	LOG_DEFER(TAG ": Advertising start\r\n");
+}
+
+/* Asks the central for the connection timing of the active profile */
+static void BleUpdateConnParams(void){
+	struct ble_gap_upd_params params = {
+		.itvl_min = link_params[link_profile].conn_int_min,
+		.itvl_max = link_params[link_profile].conn_int_max,
+		.latency = link_params[link_profile].latency,
+		.supervision_timeout = link_params[link_profile].timeout,
+	};
+	ble_gap_update_params(conn_handle, &params);
+}
+
+
+static void HidQueueClear(void){
+	portENTER_CRITICAL(&hid_queue_mux);
+	hid_queue_count = 0;
+	portEXIT_CRITICAL(&hid_queue_mux);
+}
+
+static int BleGapEvent(struct ble_gap_event *event, void *arg){
+	struct ble_gap_conn_desc desc;
+
+	switch(event->type){
+		case BLE_GAP_EVENT_CONNECT:
+			if(event->connect.status != 0){
+				BleAdvertise(false);
+				break;
+			}
+			conn_handle = event->connect.conn_handle;
+			adv_directed = false;
+			if(ble_gap_conn_find(conn_handle, &desc) == 0){
+				link_stats.interval = desc.conn_itvl;
+				link_stats.latency = desc.conn_latency;
+			}
+			/* encryption first: HID reports and bonding need it */
+			ble_gap_security_initiate(conn_handle);
+			/* ask for longer LL packets and 2M PHY, the peer keeps the old values if not supported */
+			ble_gap_set_data_len(conn_handle, DLE_TX_OCTETS, DLE_TX_TIME);
+			ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK,
+										BLE_GAP_LE_PHY_CODED_ANY);
+			/* the central chooses the first parameters; HID needs the short interval */
+			if(hid_enabled || link_profile != BLE_LINK_FAST){
+				BleUpdateConnParams();
+			}
+			break;
+		case BLE_GAP_EVENT_ENC_CHANGE:
+			LOG_DEFER(TAG ": Device connected (encryption status %d)\r\n", event->enc_change.status);
+			status = BLE_CONNECTED;
+			break;
+		case BLE_GAP_EVENT_DISCONNECT:
+			LOG_DEFER(TAG ": Device disconnected\r\n");
+			status = BLE_DISCONNECTED;
+			conn_handle = BLE_HS_CONN_HANDLE_NONE;
+			ble_mtu = MTU_DEFAULT;
+			tx_congested = false;
+			link_stats.interval = 0;
+			link_stats.latency = 0;
+			link_stats.tx_phy = BLE_GAP_LE_PHY_1M;
+			link_stats.rx_phy = BLE_GAP_LE_PHY_1M;
+			link_stats.rssi = BLE_RSSI_UNKNOWN;
+			HidQueueClear();
+			/* start advertising again when missing the connect */
+			BleAdvertise(true);
+			break;
+		case BLE_GAP_EVENT_ADV_COMPLETE:
+			/* the directed advertising timed out */
+			BleAdvertise(false);
+			break;
+		case BLE_GAP_EVENT_MTU:
+			ble_mtu = event->mtu.value;
+			LOG_DEFER(TAG ": MTU: %d\r\n", ble_mtu);
+			break;
+		case BLE_GAP_EVENT_CONN_UPDATE:
+			if(ble_gap_conn_find(event->conn_update.conn_handle, &desc) == 0){
+				LOG_DEFER(TAG ": Connection interval %d, latency %d\r\n", desc.conn_itvl, desc.conn_latency);
+				link_stats.interval = desc.conn_itvl;
+				link_stats.latency = desc.conn_latency;
+			}
+			break;
+		case BLE_GAP_EVENT_PHY_UPDATE_COMPLETE:
+			LOG_DEFER(TAG ": PHY: tx %d rx %d\r\n", event->phy_updated.tx_phy, event->phy_updated.rx_phy);
+			if(event->phy_updated.status == 0){
+				link_stats.tx_phy = event->phy_updated.tx_phy;
+				link_stats.rx_phy = event->phy_updated.rx_phy;
+			}
+			break;
+		case BLE_GAP_EVENT_REPEAT_PAIRING:
+			/* the central lost its keys: forget the old bond and pair again */
+			if(ble_gap_conn_find(event->repeat_pairing.conn_handle, &desc) == 0){
+				ble_store_util_delete_peer(&desc.peer_id_addr);
+			}
+			return BLE_GAP_REPEAT_PAIRING_RETRY;
+		default:
+			break;
+	}
+	return 0;
+}
+
+/*************************host**************************/
+static void BleOnSync(void){
+	ble_hs_util_ensure_addr(0);
+	ble_hs_id_infer_auto(0, &own_addr_type);
+	status = BLE_DISCONNECTED;
+	BleAdvertise(true);
+	if(ble_ready_p != NULL){
+		ble_ready_p();
+		ble_ready_p = NULL;
+	}
+}
+
+static void BleOnReset(int reason){
+	ESP_LOGE(TAG, "host reset, reason = %d", reason);
+}
+
+static void BleHostTask(void *param){
+	/* returns only when nimble_port_stop() is called */
+	nimble_port_run();
+	nimble_port_freertos_deinit();
+}
+
+/* Registers the enabled services and starts the host (both drivers call it) */
+static void BleHostStart(void){
+	esp_err_t ret;
+	int rc;
+
+	if(host_started){
+		return;
+	}
+	host_started = true;
+	/* the host events are logged with LOG_DEFER, printed by a low priority task */
+	LogDeferInit(tskIDLE_PRIORITY + 1);
+	/* Initialize NVS. */
+	ret = nvs_flash_init();
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		ret = nvs_flash_init();
+	}
+	ESP_ERROR_CHECK(ret);
+	ret = nimble_port_init();
+	if (ret) {
+		ESP_LOGE(TAG, "%s init nimble failed: %s", __func__, esp_err_to_name(ret));
+		return;
+	}
+	ble_hs_cfg.sync_cb = BleOnSync;
+	ble_hs_cfg.reset_cb = BleOnReset;
+	ble_hs_cfg.store_status_cb = ble_store_util_status_rr;
+	/* bonding with Secure Connections, no input or output (just works) */
+	ble_hs_cfg.sm_io_cap = BLE_SM_IO_CAP_NO_IO;
+	ble_hs_cfg.sm_bonding = 1;
+	ble_hs_cfg.sm_sc = 1;
+	ble_hs_cfg.sm_our_key_dist = BLE_SM_PAIR_KEY_DIST_ENC | BLE_SM_PAIR_KEY_DIST_ID;
+	ble_hs_cfg.sm_their_key_dist = BLE_SM_PAIR_KEY_DIST_ENC | BLE_SM_PAIR_KEY_DIST_ID;
+
+	ble_svc_gap_init();
+	ble_svc_gatt_init();
+	if(spp_enabled){
+		rc = ble_gatts_count_cfg(spp_svcs);
+		if(rc == 0){
+			rc = ble_gatts_add_svcs(spp_svcs);
+		}
+		if(rc != 0){
+			ESP_LOGE(TAG, "serial service register error, error code = %d", rc);
+		}
+	}
+	if(hid_enabled){
+		rc = ble_gatts_count_cfg(hid_svcs);
+		if(rc == 0){
+			rc = ble_gatts_add_svcs(hid_svcs);
+		}
+		if(rc != 0){
+			ESP_LOGE(TAG, "HID service register error, error code = %d", rc);
+		}
+		ble_svc_gap_device_appearance_set(HID_APPEARANCE);
+	}
+	ble_svc_gap_device_name_set(device_name);
+	ble_att_set_preferred_mtu(MTU_LOCAL);
+	ble_store_config_init();
+	nimble_port_freertos_init(BleHostTask);
+}
+
+/*************************serial data**************************/
+static void read_task(void* pvParameters) {
+	uint8_t data[PAYLOAD_SIZE];
+	size_t length;
+	while(1) {
+		length = xMessageBufferReceive(rx_ring, data, sizeof(data), portMAX_DELAY);
+		if(length > 0){
+			BleCommandDispatch(ble_commands, ble_n_commands, ble_read_isr_p, data, length);
+		}
+	}
+}
+
+static tx_buffer_t * TxBufferTake(TickType_t wait){
+	tx_buffer_t *buffer = NULL;
+	uint16_t depth;
+	if(xQueueTxFree == NULL){
+		return NULL;
+	}
+	if(xQueueReceive(xQueueTxFree, &buffer, 0) != pdTRUE){
+		if(wait == 0){
+			return NULL;
+		}
+		/* the pool is exhausted: the caller blocks until a buffer is sent */
+		tx_blocked++;
+		if(xQueueReceive(xQueueTxFree, &buffer, wait) != pdTRUE){
+			return NULL;
+		}
+	}
+	depth = TX_POOL_SIZE - uxQueueMessagesWaiting(xQueueTxFree);
+	if(depth > tx_queue_max){
+		tx_queue_max = depth;
+	}
+	return buffer;
+}
+
+static void TxBufferRelease(tx_buffer_t *buffer){
+	xQueueSend(xQueueTxFree, &buffer, 0);
+}
+
+static void TxBufferQueue(tx_buffer_t *buffer){
+	/* never blocks: the queue has room for every buffer of the pool */
+	xQueueSend(xQueueTx, &buffer, portMAX_DELAY);
+}
+
+/* Copy data into a pool buffer and queue it (wait: ticks to wait for a free buffer) */
+static bool TxCopyAndQueue(const void *data, uint16_t nbytes, uint16_t frame_size, TickType_t wait){
+	tx_buffer_t *buffer;
+	if(status != BLE_CONNECTED){
+		return false;
+	}
+	buffer = TxBufferTake(wait);
+	if(buffer == NULL){
+		tx_dropped++;
+		return false;
+	}
+	buffer->length = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes;
+	buffer->frame_size = frame_size;
+	memcpy(buffer->payload, data, buffer->length);
+	TxBufferQueue(buffer);
+	return true;
+}
+
+/* Hand one notification to the host as soon as it can accept it. The host
+ * has no congestion event: it runs out of mbufs while the controller is busy,
+ * then the send is retried every tick */
+static bool TxNotify(const uint8_t *data, uint16_t len){
+	struct os_mbuf *om;
+	TickType_t start = xTaskGetTickCount();
+
+	while(status == BLE_CONNECTED){
+		om = ble_hs_mbuf_from_flat(data, len);
+		/* the host frees the mbuf even if the notification fails */
+		if(om != NULL && ble_gatts_notify_custom(conn_handle, spp_val_handle, om) == 0){
+			tx_congested = false;
+			tx_notifications++;
+			tx_bytes += len;
+			return true;
+		}
+		tx_congested = true;
+		if((xTaskGetTickCount() - start) > pdMS_TO_TICKS(TX_WAIT_MS)){
+			break;
+		}
+		vTaskDelay(1);
+	}
+	return false;
+}
+
+static void tx_task(void * arg) {
+	int data_sent, chunk;
+	tx_buffer_t *tx;
+	uint16_t waiting;
+
+	while(1){
+		xQueueReceive(xQueueTx, &tx, portMAX_DELAY);
+		waiting = uxQueueMessagesWaiting(xQueueTx) + 1;
+		if(waiting > events_max){
+			events_max = waiting;
+		}
+		if (status != BLE_CONNECTED) {
+			tx_dropped++;
+		} else {
+			/* biggest notification allowed by the negotiated MTU, holding only whole frames */
+			chunk = ble_mtu - ATT_HEADER_BYTES;
+			if(tx->frame_size > 1 && chunk >= tx->frame_size){
+				chunk -= chunk % tx->frame_size;
+			}
+			data_sent = 0;
+			while(data_sent < tx->length){
+				if((tx->length - data_sent) < chunk){
+					chunk = tx->length - data_sent;
+				}
+				if(!TxNotify(&tx->payload[data_sent], chunk)){
+					tx_dropped++;
+					break;
+				}
+				data_sent += chunk;
+			}
+		}
+		/* the host keeps its own copy of each notification: the buffer can be reused */
+		TxBufferRelease(tx);
+	}
+}
+
+/* Rates of the last second and RSSI, the characteristic is read from StatsAccess() */
+static void BleStatsTimer(TimerHandle_t timer){
+	static uint32_t last_notifications = 0, last_bytes = 0;
+	uint32_t notifications = tx_notifications, bytes = tx_bytes;
+	int8_t rssi;
+
+	link_stats.notifications_per_s = notifications - last_notifications;
+	link_stats.bytes_per_s = bytes - last_bytes;
+	last_notifications = notifications;
+	last_bytes = bytes;
+	if(status == BLE_CONNECTED && ble_gap_conn_rssi(conn_handle, &rssi) == 0){
+		link_stats.rssi = rssi;
+	}
+}
+
+/*************************report queue**************************/
+static bool HidQueuePush(const hid_report_t *report){
+	bool ok = false;
+	portENTER_CRITICAL(&hid_queue_mux);
+	if(hid_queue_count < BLE_HID_QUEUE_SIZE){
+		hid_queue[(hid_queue_head + hid_queue_count) % BLE_HID_QUEUE_SIZE] = *report;
+		hid_queue_count++;
+		ok = true;
+	}
+	portEXIT_CRITICAL(&hid_queue_mux);
+	if(ok){
+		xTaskNotifyGive(hid_tx_task);
+	}
+	return ok;
+}
+
+/* Copies the oldest report, it stays queued until HidQueueDrop() */
+static bool HidQueuePeek(hid_report_t *report){
+	bool ok = false;
+	portENTER_CRITICAL(&hid_queue_mux);
+	if(hid_queue_count > 0){
+		*report = hid_queue[hid_queue_head];
+		hid_queue_sending = true;
+		ok = true;
+	}
+	portEXIT_CRITICAL(&hid_queue_mux);
+	return ok;
+}
+
+static void HidQueueDrop(bool sent){
+	portENTER_CRITICAL(&hid_queue_mux);
+	if(sent && hid_queue_count > 0){
+		hid_queue_head = (hid_queue_head + 1) % BLE_HID_QUEUE_SIZE;
+		hid_queue_count--;
+	}
+	hid_queue_sending = false;
+	portEXIT_CRITICAL(&hid_queue_mux);
+}
+
+/* Adds a mouse movement to the last queued report, if it is a mouse report with
+ * the same buttons, it is not being sent and the sum still fits in it (so no
+ * movement is lost) */
+static bool HidQueueMergeMouse(uint8_t buttons, int8_t delta_x, int8_t delta_y){
+	bool ok = false;
+	hid_report_t *last;
+	int16_t x, y;
+	portENTER_CRITICAL(&hid_queue_mux);
+	if(hid_queue_count > (hid_queue_sending ? 1 : 0)){
+		last = &hid_queue[(hid_queue_head + hid_queue_count - 1) % BLE_HID_QUEUE_SIZE];
+		x = (int8_t)last->data[1] + delta_x;
+		y = (int8_t)last->data[2] + delta_y;
+		if(last->id == HID_RPT_ID_MOUSE_IN && last->data[0] == buttons &&
+		   x >= INT8_MIN && x <= INT8_MAX && y >= INT8_MIN && y <= INT8_MAX){
+			last->data[1] = (uint8_t)x;
+			last->data[2] = (uint8_t)y;
+			ok = true;
+		}
+	}
+	portEXIT_CRITICAL(&hid_queue_mux);
+	return ok;
+}
+
+/* Sends up to HID_REPORTS_PER_EVENT reports per tick (about one connection
+ * interval). A report the host can't take (out of mbufs) stays at the head of
+ * the queue and is retried on the next tick, so none is lost */
+static void BleHidTxTask(void *arg){
+	hid_report_t report;
+	struct os_mbuf *om;
+	uint16_t handle;
+	uint8_t sent;
+	bool ok;
+	while(1){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while(hid_queue_count > 0 && status == BLE_CONNECTED){
+			for(sent = 0; sent < HID_REPORTS_PER_EVENT && HidQueuePeek(&report); sent++){
+				handle = (report.id == HID_RPT_ID_MOUSE_IN) ? hid_mouse_in_handle : hid_key_in_handle;
+				om = ble_hs_mbuf_from_flat(report.data, report.len);
+				ok = (om != NULL && ble_gatts_notify_custom(conn_handle, handle, om) == 0);
+				HidQueueDrop(ok);
+				if(!ok){
+					break;
+				}
+			}
+			vTaskDelay(1);
+		}
+	}
+}
+
+/*==================[external functions definition]==========================*/
+void BleInit(ble_config_t * ble_device){
+	if(host_started){
+		ESP_LOGE(TAG, "%s: the host is already running, call BleInit before BleHidInit", __func__);
+		return;
+	}
+	device_name = ble_device->device_name;
+	ble_read_isr_p = ble_device->func_p;
+	ble_ready_p = ble_device->ready_p;
+	ble_commands = ble_device->commands;
+	ble_n_commands = ble_device->n_commands;
+	spp_enabled = true;
+
+	/* Create Queue */
+	rx_ring = xMessageBufferCreate(RX_RING_SIZE);
+	configASSERT(rx_ring);
+	xQueueTx = QueueCreateStored(&tx_queue_storage);
+	configASSERT(xQueueTx);
+	xQueueTxFree = QueueCreateStored(&tx_free_storage);
+	configASSERT(xQueueTxFree);
+	for(uint8_t i = 0; i < TX_POOL_SIZE; i++){
+		tx_buffer_t *buffer = &tx_pool[i];
+		xQueueSend(xQueueTxFree, &buffer, 0);
+	}
+	stats_timer = xTimerCreate("ble_stats", pdMS_TO_TICKS(STATS_INTERVAL_MS), pdTRUE, NULL, BleStatsTimer);
+	configASSERT(stats_timer);
+	xTimerStart(stats_timer, 0);
+
+	/* Start tasks */
+	TaskCreateStored(&read_storage, read_task, "read", NULL, 2, NULL);
+	TaskCreateStored(&tx_storage, tx_task, "ble_tx", NULL, 10, NULL);
+	if(ble_device->hid){
+		BleHidInit(ble_device->device_name);
+	}else{
+		BleHostStart();
+	}
+}
+
+ble_status_t BleStatus(void){
+	return status;
+}
+
+void BleSendByte(const char *data){
+	TxCopyAndQueue(data, 1, 0, portMAX_DELAY);
+}
+
+void BleSendString(const char *msg){
+	TxCopyAndQueue(msg, strlen(msg), 0, portMAX_DELAY);
+}
+
+void BleSendBuffer(const char *data, uint8_t nbytes){
+	TxCopyAndQueue(data, nbytes, 0, portMAX_DELAY);
+}
+
+ble_tx_result_t BleTrySend(const char *data, uint16_t nbytes){
+	if(status != BLE_CONNECTED){
+		return BLE_TX_NOT_CONNECTED;
+	}
+	if(!TxCopyAndQueue(data, nbytes, 0, 0)){
+		return BLE_TX_BUSY;
+	}
+	return BLE_TX_OK;
+}
+
+uint8_t * BleTxBufferGet(void){
+	tx_buffer_t *buffer;
+	if(status != BLE_CONNECTED){
+		return NULL;
+	}
+	buffer = TxBufferTake(0);
+	if(buffer == NULL){
+		return NULL;
+	}
+	return buffer->payload;
+}
+
+void BleTxBufferSend(uint8_t *buffer, uint16_t nbytes){
+	tx_buffer_t *tx = (tx_buffer_t *)(buffer - offsetof(tx_buffer_t, payload));
+	tx->length = (nbytes > PAYLOAD_SIZE) ? PAYLOAD_SIZE : nbytes;
+	tx->frame_size = 0;
+	TxBufferQueue(tx);
+}
+
+uint16_t BleGetMtu(void){
+	return ble_mtu;
+}
+
+uint8_t BleConnections(void){
+	/* a single connection with this backend */
+	return (conn_handle != BLE_HS_CONN_HANDLE_NONE) ? 1 : 0;
+}
+
+void BleSendBatch(const void *frames, uint16_t frame_size, uint16_t n_frames){
+	const uint8_t *data = frames;
+	size_t total, sent = 0;
+	uint16_t max_len = PAYLOAD_SIZE, len;
+
+	if(status != BLE_CONNECTED || frame_size == 0 || frame_size > PAYLOAD_SIZE){
+		return;
+	}
+	/* every queued transaction carries only whole frames */
+	if(frame_size > 1){
+		max_len -= PAYLOAD_SIZE % frame_size;
+	}
+	total = (size_t)frame_size * n_frames;
+	while(sent < total){
+		len = ((total - sent) > max_len) ? max_len : (total - sent);
+		if(!TxCopyAndQueue(&data[sent], len, frame_size, portMAX_DELAY)){
+			return;
+		}
+		sent += len;
+	}
+}
+
+void BleGetTxStats(ble_tx_stats_t *stats){
+	stats->queue_depth = (xQueueTxFree == NULL) ? 0 : TX_POOL_SIZE - uxQueueMessagesWaiting(xQueueTxFree);
+	stats->queue_max = tx_queue_max;
+	stats->notifications = tx_notifications;
+	stats->dropped = tx_dropped;
+	stats->congested = tx_congested;
+}
+
+void BleGetLinkStats(ble_link_stats_t *stats){
+	*stats = link_stats;
+	stats->mtu = ble_mtu;
+	stats->notifications = tx_notifications;
+	stats->bytes = tx_bytes;
+	stats->events_max = events_max;
+	stats->queue_max = tx_queue_max;
+	stats->dropped = tx_dropped;
+	stats->blocked = tx_blocked;
+}
+
+void BleSetLinkProfile(ble_link_profile_t profile){
+	if(profile == link_profile){
+		return;
+	}
+	link_profile = profile;
+	if(status == BLE_CONNECTED){
+		BleUpdateConnParams();
+	}else if(status == BLE_DISCONNECTED){
+		/* restart advertising with the new interval */
+		if(!adv_directed){
+			ble_gap_adv_stop();
+			BleAdvertise(false);
+		}
+	}
+}
+
+bool BleSetState(const void *data, uint16_t len){
+	if(len > BLE_STATE_MAX_LEN){
+		return false;
+	}
+	portENTER_CRITICAL(&state_lock);
+	memcpy(state_val, data, len);
+	state_len = len;
+	portEXIT_CRITICAL(&state_lock);
+	return true;
+}
+
+void BleHidInit(char * hid_dev_name){
+	if(host_started){
+		ESP_LOGE(TAG, "%s: the host is already running, use BleInit with .hid = true", __func__);
+		return;
+	}
+	if(device_name == NULL){
+		device_name = hid_dev_name;
+	}
+	hid_enabled = true;
+	TaskCreateStored(&hid_tx_storage, BleHidTxTask, "ble_hid_tx", NULL, 9, &hid_tx_task);
+	BleHostStart();
+}
+
+ble_status_t BleHidStatus(void){
+	return status;
+}
+
+void BleHidSendKeyboard(key_mask_t special_key_mask, keyboard_cmd_t *keyboard_cmd, uint8_t num_key){
+	if (num_key > HID_KEYBOARD_IN_RPT_LEN - 2) {
+		ESP_LOGE(TAG, "%s(), the number key should not be more than %d", __func__, HID_KEYBOARD_IN_RPT_LEN);
+		return;
+	}
+	hid_report_t report = {.id = HID_RPT_ID_KEY_IN, .len = HID_KEYBOARD_IN_RPT_LEN};
+	uint8_t wait;
+	if(status == BLE_CONNECTED && hid_enabled){
+		// press and release reports, queued back to back
+		report.data[0] = special_key_mask;
+		for (int i = 0; i < num_key; i++) {
+			report.data[i+2] = keyboard_cmd[i];
+		}
+		for (wait = 0; !HidQueuePush(&report) && wait < HID_QUEUE_WAIT_MS / portTICK_PERIOD_MS; wait++) {
+			vTaskDelay(1);
+		}
+		for (int i = 0; i < num_key; i++) {
+			report.data[i+2] = 0;
+		}
+		for (wait = 0; !HidQueuePush(&report) && wait < HID_QUEUE_WAIT_MS / portTICK_PERIOD_MS; wait++) {
+			vTaskDelay(1);
+		}
+	}
+}
+
+void BleHidSendMouse(mouse_cmd_t mouse_button, int8_t delta_x, int8_t delta_y){
+	hid_report_t report = {.id = HID_RPT_ID_MOUSE_IN, .len = HID_MOUSE_IN_RPT_LEN};
+	if(status == BLE_CONNECTED && hid_enabled && !HidQueueMergeMouse(mouse_button, delta_x, delta_y)){
+		report.data[0] = mouse_button;       // Buttons
+		report.data[1] = delta_x;            // X
+		report.data[2] = delta_y;            // Y
+		report.data[3] = 0;                  // Wheel
+		report.data[4] = 0;                  // AC Pan
+		HidQueuePush(&report);
+	}
+}
+
+/*==================[end of file]============================================*/
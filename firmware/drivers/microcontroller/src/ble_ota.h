@@ -0,0 +1,36 @@
+/**
+ * @file ble_ota.h
+ * @brief Firmware update engine behind the OTA characteristics of the serial
+ * service (ble_mcu.c), see ble_ota_mcu.h
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * The GATT callback hands the control and data writes over as they arrive;
+ * the flash writes and every notification happen in the update task, so the
+ * BLE stack task never blocks.
+ *
+ */
+#ifndef BLE_OTA_H
+#define BLE_OTA_H
+#include <stdint.h>
+#include "ble_mcu.h"
+
+#define OTA_CTRL_UUID		0xFFE3	/* Control characteristic: commands, answers and credits */
+#define OTA_DATA_UUID		0xFFE4	/* Data characteristic: image bytes, write without response */
+
+/* Sends a notification of the control characteristic to a device (from the update task) */
+typedef void (*ble_ota_notify_t)(uint16_t conn_id, const uint8_t *data, uint16_t len);
+
+/* Creates the update task (from BleInit) */
+void BleOtaInit(ble_ota_notify_t notify, ota_func event_p);
+
+/* Write to the control characteristic (GATT callback), mtu of the connection */
+void BleOtaControl(uint16_t conn_id, const uint8_t *data, uint16_t len, uint16_t mtu);
+
+/* Write to the data characteristic (GATT callback) */
+void BleOtaData(uint16_t conn_id, const uint8_t *data, uint16_t len);
+
+/* A device disconnected: cancels its update (GATT callback) */
+void BleOtaDisconnect(uint16_t conn_id);
+
+#endif /* BLE_OTA_H */
@@ -0,0 +1,392 @@
+/**
+ * @file ble_ota_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Firmware update through the BLE serial service: double buffered
+ * streaming into esp_ota_write with credit based flow control
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "ble_ota_mcu.h"
+#include "ble_ota.h"
+#include "rtos_alloc_mcu.h"
+#include "log_mcu.h"
+#include <string.h>
+
+#include "esp_ota_ops.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+/*==================[macros and definitions]=================================*/
+#define TAG "ble_ota"
+#define OTA_BUFFERS			2
+#define OTA_NO_BUFFER		0xFF
+#define OTA_WINDOW			(OTA_BUFFERS * BLE_OTA_BUFFER_SIZE)	/* First credit limit: every buffer free */
+#define OTA_QUEUE_SIZE		(OTA_BUFFERS + 4)	/* Every buffer plus BEGIN, END and the aborts */
+#define OTA_TASK_STACK		4096
+#define OTA_TASK_PRIORITY	4		/* Below the BLE events task: notifications go first */
+#define ATT_HEADER_BYTES	3
+
+_Static_assert(OTA_WINDOW <= UINT16_MAX, "window field of the BEGIN answer is 16 bits");
+/*==================[typedef]================================================*/
+/* Messages from the GATT callback to the update task, handled in order */
+typedef enum {
+	OTA_MSG_BEGIN,			/* param: image size */
+	OTA_MSG_WRITE,			/* buffer full */
+	OTA_MSG_END,			/* last partial buffer (OTA_NO_BUFFER if none) */
+	OTA_MSG_ABORT,			/* param: BLE_OTA_OK if asked by the central, else the error */
+} ota_msg_type_t;
+
+typedef struct {
+	uint8_t type;
+	uint8_t buffer;
+	uint16_t length;		/* Bytes in the buffer */
+	uint16_t conn_id;
+	uint16_t mtu;
+	uint32_t param;
+} ota_msg_t;
+/*==================[internal data declaration]==============================*/
+static ble_ota_notify_t ota_notify = NULL;
+static ota_func ota_event_p = NULL;
+static QueueHandle_t ota_queue = NULL;
+static portMUX_TYPE ota_lock = portMUX_INITIALIZER_UNLOCKED;
+/* Static: the GATT callback may still be copying into them when the update fails */
+static uint8_t ota_buffers[OTA_BUFFERS][BLE_OTA_BUFFER_SIZE];
+/* Receiving side, owned by the GATT callback; the counters and the free
+ * buffers are shared with the update task under ota_lock */
+static bool ota_receiving = false;
+static uint16_t ota_conn_id;
+static uint8_t ota_current = OTA_NO_BUFFER;		/* Buffer being filled */
+static uint16_t ota_fill;						/* Bytes in the current buffer */
+static uint8_t ota_free;						/* Mask of the free buffers */
+static uint32_t ota_limit;						/* Credit limit granted to the central */
+/* Writing side, owned by the update task */
+static esp_ota_handle_t ota_handle = 0;
+static ble_ota_progress_t ota_progress;
+static int64_t ota_start_us;
+TASK_STORAGE_DEFINE(ota_storage, OTA_TASK_STACK);
+QUEUE_STORAGE_DEFINE(ota_queue_storage, OTA_QUEUE_SIZE, sizeof(ota_msg_t));
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* From the GATT callback: never blocks (the queue has room for every message of an update) */
+static void OtaPost(ota_msg_type_t type, uint16_t conn_id, uint8_t buffer, uint16_t length, uint32_t param, uint16_t mtu){
+	ota_msg_t msg = {
+		.type = type,
+		.buffer = buffer,
+		.length = length,
+		.conn_id = conn_id,
+		.mtu = mtu,
+		.param = param,
+	};
+	xQueueSend(ota_queue, &msg, 0);
+}
+
+static void OtaAnswer(uint16_t conn_id, uint8_t command, ble_ota_status_t status){
+	uint8_t answer[2] = {command, status};
+	ota_notify(conn_id, answer, sizeof(answer));
+}
+
+static void OtaPut32(uint8_t *dst, uint32_t value){
+	dst[0] = value;
+	dst[1] = value >> 8;
+	dst[2] = value >> 16;
+	dst[3] = value >> 24;
+}
+
+static void OtaElapsed(void){
+	ota_progress.elapsed_ms = (uint32_t)((esp_timer_get_time() - ota_start_us) / 1000);
+}
+
+/* Cancels the update in progress and frees the buffers */
+static void OtaFail(uint16_t conn_id, ble_ota_status_t status, bool answer_abort){
+	if(ota_handle != 0){
+		esp_ota_abort(ota_handle);
+		ota_handle = 0;
+	}
+	portENTER_CRITICAL(&ota_lock);
+	ota_receiving = false;
+	ota_progress.active = false;
+	ota_progress.status = status;
+	portEXIT_CRITICAL(&ota_lock);
+	OtaElapsed();
+	if(answer_abort){
+		OtaAnswer(conn_id, BLE_OTA_CMD_ABORT, BLE_OTA_OK);
+	}else if(status != BLE_OTA_ERR_DISCONNECTED){
+		OtaAnswer(conn_id, BLE_OTA_ERROR, status);
+	}
+	LOG_DEFER(TAG ": update cancelled (%u)\r\n", status);
+	if(ota_event_p != NULL){
+		ota_event_p(BLE_OTA_EVENT_FAILED, status);
+	}
+}
+
+static void OtaBegin(const ota_msg_t *msg){
+	const esp_partition_t *partition;
+	uint8_t answer[6] = {BLE_OTA_CMD_BEGIN, BLE_OTA_OK};
+	ble_ota_status_t status = BLE_OTA_OK;
+	uint16_t chunk = msg->mtu - ATT_HEADER_BYTES;
+
+	partition = esp_ota_get_next_update_partition(NULL);
+	if(ota_handle != 0){
+		status = BLE_OTA_ERR_STATE;
+	}else if(partition == NULL){
+		status = BLE_OTA_ERR_PARTITION;
+	}else if(msg->param == 0 || msg->param > partition->size){
+		status = BLE_OTA_ERR_SIZE;
+	}else if(esp_ota_begin(partition, OTA_WITH_SEQUENTIAL_WRITES, &ota_handle) != ESP_OK){
+		/* sequential writes: each sector is erased right before it is written,
+		 * not the whole partition up front */
+		ota_handle = 0;
+		status = BLE_OTA_ERR_PARTITION;
+	}
+	if(status != BLE_OTA_OK){
+		OtaAnswer(msg->conn_id, BLE_OTA_CMD_BEGIN, status);
+		return;
+	}
+	ota_start_us = esp_timer_get_time();
+	portENTER_CRITICAL(&ota_lock);
+	ota_progress = (ble_ota_progress_t){
+		.active = true,
+		.size = msg->param,
+		.status = BLE_OTA_OK,
+	};
+	ota_conn_id = msg->conn_id;
+	ota_current = OTA_NO_BUFFER;
+	ota_fill = 0;
+	ota_free = (1 << OTA_BUFFERS) - 1;
+	ota_limit = OTA_WINDOW;
+	ota_receiving = true;
+	portEXIT_CRITICAL(&ota_lock);
+	answer[2] = OTA_WINDOW & 0xFF;
+	answer[3] = OTA_WINDOW >> 8;
+	answer[4] = chunk & 0xFF;
+	answer[5] = chunk >> 8;
+	ota_notify(msg->conn_id, answer, sizeof(answer));
+	LOG_DEFER(TAG ": update of %lu bytes to %s\r\n", (unsigned long)msg->param, partition->label);
+	if(ota_event_p != NULL){
+		ota_event_p(BLE_OTA_EVENT_BEGIN, msg->param);
+	}
+}
+
+/* Writes a buffer and gives it back, the central gets one more buffer of credit */
+static bool OtaWrite(const ota_msg_t *msg){
+	uint8_t credit[9] = {BLE_OTA_CREDIT};
+	uint32_t limit;
+	esp_err_t err;
+
+	err = esp_ota_write(ota_handle, ota_buffers[msg->buffer], msg->length);
+	ota_progress.written += msg->length;
+	portENTER_CRITICAL(&ota_lock);
+	ota_free |= 1 << msg->buffer;
+	ota_limit += BLE_OTA_BUFFER_SIZE;
+	limit = ota_limit;
+	portEXIT_CRITICAL(&ota_lock);
+	if(err != ESP_OK){
+		OtaFail(msg->conn_id, BLE_OTA_ERR_WRITE, false);
+		return false;
+	}
+	if(msg->type == OTA_MSG_WRITE){
+		OtaPut32(&credit[1], limit);
+		OtaPut32(&credit[5], ota_progress.written);
+		ota_notify(msg->conn_id, credit, sizeof(credit));
+	}
+	return true;
+}
+
+static void OtaEnd(const ota_msg_t *msg){
+	const esp_partition_t *partition;
+	esp_err_t err;
+
+	if(msg->buffer != OTA_NO_BUFFER && !OtaWrite(msg)){
+		return;
+	}
+	if(ota_progress.written != ota_progress.size){
+		OtaFail(msg->conn_id, BLE_OTA_ERR_SIZE, false);
+		return;
+	}
+	partition = esp_ota_get_next_update_partition(NULL);
+	/* checks the image (and its hash); the handle is released even if it fails */
+	err = esp_ota_end(ota_handle);
+	ota_handle = 0;
+	if(err != ESP_OK){
+		OtaFail(msg->conn_id, BLE_OTA_ERR_IMAGE, false);
+		return;
+	}
+	if(esp_ota_set_boot_partition(partition) != ESP_OK){
+		OtaFail(msg->conn_id, BLE_OTA_ERR_PARTITION, false);
+		return;
+	}
+	OtaElapsed();
+	ota_progress.active = false;
+	OtaAnswer(msg->conn_id, BLE_OTA_CMD_END, BLE_OTA_OK);
+	LOG_DEFER(TAG ": %lu bytes in %lu ms, restarting\r\n", (unsigned long)ota_progress.size,
+		(unsigned long)ota_progress.elapsed_ms);
+	if(ota_event_p != NULL){
+		ota_event_p(BLE_OTA_EVENT_DONE, 0);
+	}
+	vTaskDelay(pdMS_TO_TICKS(BLE_OTA_RESTART_MS));
+	esp_restart();
+}
+
+static void OtaTask(void *arg){
+	ota_msg_t msg;
+
+	while(1){
+		xQueueReceive(ota_queue, &msg, portMAX_DELAY);
+		switch(msg.type){
+			case OTA_MSG_BEGIN:
+				OtaBegin(&msg);
+			break;
+			case OTA_MSG_WRITE:
+				/* buffers queued before a failure are dropped with it */
+				if(ota_handle != 0){
+					OtaWrite(&msg);
+				}
+			break;
+			case OTA_MSG_END:
+				if(ota_handle == 0){
+					OtaAnswer(msg.conn_id, BLE_OTA_CMD_END, BLE_OTA_ERR_STATE);
+				}else{
+					OtaEnd(&msg);
+				}
+			break;
+			case OTA_MSG_ABORT:
+				if(ota_handle == 0){
+					if(msg.param == BLE_OTA_OK){
+						OtaAnswer(msg.conn_id, BLE_OTA_CMD_ABORT, BLE_OTA_ERR_STATE);
+					}
+				}else{
+					OtaFail(msg.conn_id, msg.param, msg.param == BLE_OTA_OK);
+				}
+			break;
+		}
+	}
+}
+
+/* Stops taking data from the central (GATT callback), the queued buffers are still handled */
+static bool OtaStopReceiving(uint16_t conn_id){
+	bool stopped;
+
+	portENTER_CRITICAL(&ota_lock);
+	stopped = ota_receiving && ota_conn_id == conn_id;
+	if(stopped){
+		ota_receiving = false;
+	}
+	portEXIT_CRITICAL(&ota_lock);
+	return stopped;
+}
+
+/*==================[external functions definition]==========================*/
+void BleOtaInit(ble_ota_notify_t notify, ota_func event_p){
+	ota_notify = notify;
+	ota_event_p = event_p;
+	ota_queue = QueueCreateStored(&ota_queue_storage);
+	configASSERT(ota_queue);
+	TaskCreateStored(&ota_storage, OtaTask, "ble_ota", NULL, OTA_TASK_PRIORITY, NULL);
+}
+
+void BleOtaControl(uint16_t conn_id, const uint8_t *data, uint16_t len, uint16_t mtu){
+	uint32_t size;
+
+	if(len == 0){
+		return;
+	}
+	switch(data[0]){
+		case BLE_OTA_CMD_BEGIN:
+			size = (len < 5) ? 0 : (data[1] | (data[2] << 8) | (data[3] << 16) | ((uint32_t)data[4] << 24));
+			OtaPost(OTA_MSG_BEGIN, conn_id, OTA_NO_BUFFER, 0, size, mtu);
+		break;
+		case BLE_OTA_CMD_END:
+			if(OtaStopReceiving(conn_id)){
+				/* the last buffer goes with END, even if it is partial */
+				OtaPost(OTA_MSG_END, conn_id, ota_current, ota_fill, 0, mtu);
+				ota_current = OTA_NO_BUFFER;
+			}else{
+				OtaPost(OTA_MSG_END, conn_id, OTA_NO_BUFFER, 0, 0, mtu);
+			}
+		break;
+		case BLE_OTA_CMD_ABORT:
+			OtaStopReceiving(conn_id);
+			OtaPost(OTA_MSG_ABORT, conn_id, OTA_NO_BUFFER, 0, BLE_OTA_OK, mtu);
+		break;
+		default:
+		break;
+	}
+}
+
+void BleOtaData(uint16_t conn_id, const uint8_t *data, uint16_t len){
+	ble_ota_status_t status = BLE_OTA_OK;
+	uint16_t n;
+	uint8_t i;
+
+	portENTER_CRITICAL(&ota_lock);
+	if(!ota_receiving || ota_conn_id != conn_id){
+		portEXIT_CRITICAL(&ota_lock);
+		return;
+	}
+	if(ota_progress.received + len > ota_progress.size){
+		status = BLE_OTA_ERR_SIZE;
+	}else if(ota_progress.received + len > ota_limit){
+		status = BLE_OTA_ERR_OVERFLOW;
+	}
+	if(status != BLE_OTA_OK){
+		ota_receiving = false;
+		portEXIT_CRITICAL(&ota_lock);
+		OtaPost(OTA_MSG_ABORT, conn_id, OTA_NO_BUFFER, 0, status, 0);
+		return;
+	}
+	ota_progress.received += len;
+	portEXIT_CRITICAL(&ota_lock);
+	/* within the credit limit there is always a free buffer when the current one fills */
+	while(len > 0){
+		if(ota_current == OTA_NO_BUFFER){
+			portENTER_CRITICAL(&ota_lock);
+			for(i = 0; !(ota_free & (1 << i)); i++);
+			ota_free &= ~(1 << i);
+			portEXIT_CRITICAL(&ota_lock);
+			ota_current = i;
+			ota_fill = 0;
+		}
+		n = BLE_OTA_BUFFER_SIZE - ota_fill;
+		if(n > len){
+			n = len;
+		}
+		memcpy(&ota_buffers[ota_current][ota_fill], data, n);
+		ota_fill += n;
+		data += n;
+		len -= n;
+		if(ota_fill == BLE_OTA_BUFFER_SIZE){
+			OtaPost(OTA_MSG_WRITE, conn_id, ota_current, BLE_OTA_BUFFER_SIZE, 0, 0);
+			ota_current = OTA_NO_BUFFER;
+		}
+	}
+}
+
+void BleOtaDisconnect(uint16_t conn_id){
+	if(OtaStopReceiving(conn_id)){
+		OtaPost(OTA_MSG_ABORT, conn_id, OTA_NO_BUFFER, 0, BLE_OTA_ERR_DISCONNECTED, 0);
+	}
+}
+
+void BleOtaGetProgress(ble_ota_progress_t *progress){
+	portENTER_CRITICAL(&ota_lock);
+	*progress = ota_progress;
+	portEXIT_CRITICAL(&ota_lock);
+	if(progress->active){
+		progress->elapsed_ms = (uint32_t)((esp_timer_get_time() - ota_start_us) / 1000);
+	}
+}
+
+/*==================[end of file]============================================*/
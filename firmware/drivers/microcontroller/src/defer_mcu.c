@@ -0,0 +1,158 @@
+/**
+ * @file defer_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Deferred work executor for the driver callbacks
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "defer_mcu.h"
+#include <stddef.h>
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "rtos_alloc_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define QUEUE_MASK	(DEFER_QUEUE_LENGTH - 1)
+_Static_assert((DEFER_QUEUE_LENGTH & QUEUE_MASK) == 0, "DEFER_QUEUE_LENGTH must be a power of two");
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Queue slot: seq tells who owns it (see DeferPush and DeferPop)
+ */
+typedef struct {
+	uint32_t seq;				/*!< pos: free for the producer of pos, pos + 1: ready for the consumer */
+	void (*func_p)(void*);
+	void *param_p;
+} defer_slot_t;
+/**
+ * @brief Bounded multiple producer, single consumer queue of a worker
+ */
+typedef struct {
+	defer_slot_t slots[DEFER_QUEUE_LENGTH];
+	uint32_t head;				/*!< Next position to reserve (producers) */
+	uint32_t tail;				/*!< Next position to run (worker) */
+	TaskHandle_t task;			/*!< Worker task */
+	defer_stats_t stats;
+} defer_worker_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static defer_worker_t workers[DEFER_LEVELS];
+TASK_STORAGE_DEFINE(high_storage, DEFER_STACK);
+TASK_STORAGE_DEFINE(low_storage, DEFER_STACK);
+static const task_storage_t *const storages[DEFER_LEVELS] = {&high_storage, &low_storage};
+static const char *const names[DEFER_LEVELS] = {"defer_high", "defer_low"};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Reserve a slot with a compare and swap on head, fill it and hand
+ * it to the worker (any number of producers, ISR safe)
+ */
+static bool IRAM_ATTR DeferPush(defer_worker_t *worker, void (*func_p)(void*), void *param_p){
+	uint32_t pos = __atomic_load_n(&worker->head, __ATOMIC_RELAXED);
+	defer_slot_t *slot;
+
+	while(true){
+		slot = &worker->slots[pos & QUEUE_MASK];
+		int32_t diff = (int32_t)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+		if(diff == 0){
+			if(__atomic_compare_exchange_n(&worker->head, &pos, pos + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+				break;
+			}
+		}else if(diff < 0){
+			// the worker has not run the work queued DEFER_QUEUE_LENGTH positions ago
+			__atomic_add_fetch(&worker->stats.dropped, 1, __ATOMIC_RELAXED);
+			return false;
+		}else{
+			pos = __atomic_load_n(&worker->head, __ATOMIC_RELAXED);
+		}
+	}
+	slot->func_p = func_p;
+	slot->param_p = param_p;
+	// publish the slot only after it has been completely written
+	__atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Take the oldest work (worker only)
+ */
+static bool DeferPop(defer_worker_t *worker, void (**func_p)(void*), void **param_p){
+	uint32_t pos = worker->tail;
+	defer_slot_t *slot = &worker->slots[pos & QUEUE_MASK];
+
+	if(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1){
+		return false;
+	}
+	*func_p = slot->func_p;
+	*param_p = slot->param_p;
+	// free the slot for the producer of the position DEFER_QUEUE_LENGTH ahead
+	__atomic_store_n(&slot->seq, pos + DEFER_QUEUE_LENGTH, __ATOMIC_RELEASE);
+	worker->tail = pos + 1;
+	return true;
+}
+
+static void DeferWorkerTask(void *param){
+	defer_worker_t *worker = param;
+	void (*func_p)(void*);
+	void *param_p;
+	uint16_t pending;
+
+	while(true){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		pending = (uint16_t)(__atomic_load_n(&worker->head, __ATOMIC_RELAXED) - worker->tail);
+		if(pending > worker->stats.max_pending){
+			worker->stats.max_pending = pending;
+		}
+		while(DeferPop(worker, &func_p, &param_p)){
+			func_p(param_p);
+			worker->stats.executed++;
+		}
+	}
+}
+/*==================[external functions definition]==========================*/
+bool DeferInit(defer_level_t level, uint8_t priority){
+	defer_worker_t *worker = &workers[level];
+
+	if(worker->task != NULL){
+		return true;
+	}
+	for(uint32_t i = 0; i < DEFER_QUEUE_LENGTH; i++){
+		worker->slots[i].seq = i;
+	}
+	worker->head = 0;
+	worker->tail = 0;
+	return TaskCreateStored(storages[level], DeferWorkerTask, names[level], worker, priority, &worker->task) == pdPASS;
+}
+
+bool IRAM_ATTR Defer(defer_level_t level, void (*func_p)(void*), void *param_p){
+	defer_worker_t *worker = &workers[level];
+	BaseType_t woken = pdFALSE;
+
+	if(worker->task == NULL || !DeferPush(worker, func_p, param_p)){
+		return false;
+	}
+	if(xPortInIsrContext()){
+		vTaskNotifyGiveFromISR(worker->task, &woken);
+		portYIELD_FROM_ISR(woken);
+	}else{
+		xTaskNotifyGive(worker->task);
+	}
+	return true;
+}
+
+void IRAM_ATTR DeferIsr(void *param){
+	const deferred_t *work = param;
+	Defer(work->level, work->func_p, work->param_p);
+}
+
+void DeferGetStats(defer_level_t level, defer_stats_t *stats){
+	*stats = workers[level].stats;
+}
+
+/*==================[end of file]============================================*/
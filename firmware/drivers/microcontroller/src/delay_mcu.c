@@ -11,24 +11,64 @@
 
 /*==================[inclusions]=============================================*/
 #include "delay_mcu.h"
-#include "driver/gptimer.h"
+#include "timer_mcu.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_rom_sys.h"
+#include "esp_cpu.h"
 /*==================[macros and definitions]=================================*/
-#define US_RESOLUTION_HZ	1000000	/*!< 1usec */
 #define MSEC				1000	/*!< 1msec = 1000usec */
 #define SEC					1000000	/*!< 1sec = 1000msec */
-#define MIN_US				50	    /*!< minimun delay in usec to use gptimer */
+#define MIN_US				50	    /*!< minimun delay in usec to use a soft timer */
 #define MIN_MS				100	    /*!< minimun delay in msec to use vTaskDelay */
 /*==================[internal data declaration]==============================*/
-SemaphoreHandle_t xDelaySemaphore = NULL;
+static uint32_t overhead_cycles = UINT32_MAX;	/*!< Cycles of a zero length busy wait, measured on first use */
 /*==================[internal functions declaration]=========================*/
-static bool IRAM_ATTR delay_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+/**
+ * @brief Busy wait on the CPU cycle counter
+ *
+ * The cycles per us are read on every call, so the wait stays right if the
+ * CPU frequency changes; the fixed cost of the call is measured once and
+ * discounted.
+ */
+static void IRAM_ATTR DelayCycles(uint32_t nsec){
+	uint32_t start = esp_cpu_get_cycle_count();
+	uint32_t cycles = (nsec * esp_rom_get_cpu_ticks_per_us()) / 1000;
+	cycles = (cycles > overhead_cycles) ? cycles - overhead_cycles : 0;
+	while((esp_cpu_get_cycle_count() - start) < cycles){
+	}
+}
+
+static void DelayCalibrate(void){
+	uint32_t start;
+	overhead_cycles = UINT32_MAX;
+	DelayCycles(0);		// warm up the cache
+	start = esp_cpu_get_cycle_count();
+	DelayCycles(0);
+	overhead_cycles = esp_cpu_get_cycle_count() - start;
+}
+
+static void IRAM_ATTR DelayIsr(void *param){
 	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-	gptimer_stop(timer);
-	xSemaphoreGiveFromISR(xDelaySemaphore, &xHigherPriorityTaskWoken);
-	return (xHigherPriorityTaskWoken == pdTRUE);
+	xSemaphoreGiveFromISR((SemaphoreHandle_t)param, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * @brief Block the calling task on a one-shot soft timer
+ *
+ * The semaphore and the soft timer live in the stack of the caller, so
+ * several tasks can wait at the same time.
+ */
+static void DelaySoftTimer(uint32_t usec){
+	StaticSemaphore_t semaphore_buffer;
+	SemaphoreHandle_t semaphore = xSemaphoreCreateBinaryStatic(&semaphore_buffer);
+	soft_timer_t delay_timer;
+	SoftTimerInit(&delay_timer, DelayIsr, semaphore);
+	SoftTimerStart(&delay_timer, usec, 0);
+	xSemaphoreTake(semaphore, portMAX_DELAY);
+	vSemaphoreDelete(semaphore);
 }
 /*==================[internal data definition]===============================*/
 
@@ -42,73 +82,30 @@ void DelaySec(uint16_t sec){
 }
 
 void DelayMs(uint16_t msec){
-    // If the delay is too short, use the ESP32's internal timer
+    // If the delay is too short, use a soft timer (shared gptimer)
     if(msec<=MIN_MS){ 
-        if(xDelaySemaphore == NULL){
-            xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = msec*MSEC, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        DelaySoftTimer(msec*MSEC);
     }else{       
         // If the delay is longer than the minimum delay, use vTaskDelay
         vTaskDelay(msec / portTICK_PERIOD_MS);
     }
 }
 
+void DelayNs(uint16_t nsec){
+    if(overhead_cycles == UINT32_MAX){
+        DelayCalibrate();
+    }
+    DelayCycles(nsec);
+}
+
 void DelayUs(uint16_t usec){
     if(usec<=MIN_US){
-        /* If the delay is too short, use the ROM delay function */
-        esp_rom_delay_us(usec);
+        /* If the delay is too short, busy wait on the cycle counter */
+        DelayNs(usec * MSEC);
     }else{
-        /* If the delay is longer than the minimum, use the ESP32's internal timer */
-        if(xDelaySemaphore == NULL){
-	        xDelaySemaphore = xSemaphoreCreateBinary();
-            gptimer_handle_t delay_timer = NULL;
-            gptimer_config_t delay_timer_config = {
-                .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-                .direction = GPTIMER_COUNT_UP,
-                .resolution_hz = US_RESOLUTION_HZ,
-            };
-            gptimer_new_timer(&delay_timer_config, &delay_timer);
-            gptimer_event_callbacks_t delay_alarm = {
-                .on_alarm = delay_isr,
-            };
-            gptimer_register_event_callbacks(delay_timer, &delay_alarm, NULL);
-            gptimer_enable(delay_timer);
-            gptimer_alarm_config_t alarm_config = {
-                .alarm_count = usec, 
-            };
-            gptimer_set_alarm_action(delay_timer, &alarm_config);
-            gptimer_start(delay_timer);
-            if(xDelaySemaphore != NULL){
-                /* Wait for the timer to finish */
-                xSemaphoreTake(xDelaySemaphore, portMAX_DELAY);
-                xDelaySemaphore = NULL;
-            }
-            gptimer_disable(delay_timer);
-            gptimer_del_timer(delay_timer);
-        }
+        /* If the delay is longer than the minimum, use a soft timer (shared gptimer) */
+        DelaySoftTimer(usec);
     }
 }
 
+/*==================[end of file]============================================*/
@@ -0,0 +1,166 @@
+/**
+ * @file espnow_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "sdkconfig.h"
+#include "espnow_mcu.h"
+#include "esp_wifi.h"
+#include "esp_now.h"
+#include "esp_event.h"
+#include "esp_mac.h"
+#include "nvs_flash.h"
+#if CONFIG_DRIVERS_WIFI
+#include "wifi_mcu.h"
+#endif
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+typedef struct {
+	uint8_t id;						/* first byte of the frames */
+	espnow_read_func func_p;
+} espnow_handler_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const uint8_t espnow_broadcast[ESP_NOW_ETH_ALEN] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static espnow_read_func espnow_read_p = NULL;
+static espnow_handler_t espnow_handlers[ESPNOW_HANDLERS];
+static uint8_t espnow_handlers_count = 0;
+static bool espnow_started = false;
+static espnow_stats_t espnow_stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void espnow_send_cb(const esp_now_send_info_t *tx_info, esp_now_send_status_t status){
+	if(status != ESP_NOW_SEND_SUCCESS){
+		espnow_stats.failed++;
+	}
+}
+
+static void espnow_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int length){
+	espnow_stats.received++;
+	if(length <= 0){
+		return;
+	}
+	for(uint8_t i = 0; i < __atomic_load_n(&espnow_handlers_count, __ATOMIC_ACQUIRE); i++){
+		if(espnow_handlers[i].id == data[0]){
+			espnow_handlers[i].func_p(info->src_addr, data, length);
+			return;
+		}
+	}
+	if(espnow_read_p != NULL){
+		espnow_read_p(info->src_addr, data, length);
+	}
+}
+
+/* Radio on a fixed channel without access point, the lowest latency setting */
+static bool espnow_radio_start(uint8_t channel){
+	wifi_init_config_t init = WIFI_INIT_CONFIG_DEFAULT();
+	esp_err_t ret;
+
+	ret = nvs_flash_init();
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		ret = nvs_flash_init();
+	}
+	ESP_ERROR_CHECK(ret);
+	ret = esp_event_loop_create_default();
+	if(ret != ESP_OK && ret != ESP_ERR_INVALID_STATE){	/* the default loop may already exist */
+		return false;
+	}
+	if(esp_wifi_init(&init) != ESP_OK){
+		return false;
+	}
+	esp_wifi_set_storage(WIFI_STORAGE_RAM);
+	esp_wifi_set_mode(WIFI_MODE_STA);
+	if(esp_wifi_start() != ESP_OK){
+		return false;
+	}
+	/* no power save: the receiver listens all the time */
+	esp_wifi_set_ps(WIFI_PS_NONE);
+	return esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE) == ESP_OK;
+}
+/*==================[external functions definition]==========================*/
+bool EspNowInit(const espnow_config_t *config){
+	if(espnow_started){
+		return true;
+	}
+#if CONFIG_DRIVERS_WIFI
+	if(WifiStatus() == WIFI_OFF && !espnow_radio_start(config->channel)){
+		return false;
+	}
+#else
+	if(!espnow_radio_start(config->channel)){
+		return false;
+	}
+#endif
+	espnow_read_p = config->func_p;
+	if(esp_now_init() != ESP_OK){
+		return false;
+	}
+	esp_now_register_send_cb(espnow_send_cb);
+	esp_now_register_recv_cb(espnow_recv_cb);
+	espnow_started = true;
+	return EspNowAddPeer(espnow_broadcast);
+}
+
+bool EspNowAddHandler(uint8_t id, espnow_read_func func_p){
+	if(espnow_handlers_count == ESPNOW_HANDLERS){
+		return false;
+	}
+	espnow_handlers[espnow_handlers_count].id = id;
+	espnow_handlers[espnow_handlers_count].func_p = func_p;
+	/* published after the slot is written: the Wi-Fi task may be reading the table */
+	__atomic_store_n(&espnow_handlers_count, espnow_handlers_count + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+bool EspNowAddPeer(const uint8_t *mac){
+	esp_now_peer_info_t peer = {
+		.channel = 0,				/* the current channel */
+		.ifidx = WIFI_IF_STA,
+		.encrypt = false,
+	};
+
+	if(esp_now_is_peer_exist(mac)){
+		return true;
+	}
+	memcpy(peer.peer_addr, mac, ESP_NOW_ETH_ALEN);
+	return esp_now_add_peer(&peer) == ESP_OK;
+}
+
+bool EspNowSend(const uint8_t *mac, const uint8_t *data, uint8_t length){
+	esp_err_t ret;
+
+	if(!espnow_started || length > ESPNOW_FRAME_MAX){
+		return false;
+	}
+	ret = esp_now_send((mac == ESPNOW_BROADCAST) ? espnow_broadcast : mac, data, length);
+	if(ret != ESP_OK){
+		if(ret == ESP_ERR_ESPNOW_NO_MEM){
+			espnow_stats.busy++;
+		}
+		return false;
+	}
+	espnow_stats.sent++;
+	return true;
+}
+
+void EspNowGetMac(uint8_t *mac){
+	esp_read_mac(mac, ESP_MAC_WIFI_STA);
+}
+
+void EspNowGetStats(espnow_stats_t *stats){
+	*stats = espnow_stats;
+}
+
+/*==================[end of file]============================================*/
@@ -13,14 +13,15 @@
 #include "gpio_fast_out_mcu.h"
 #include "gpio_mcu.h"
 #include <stdint.h>
-#include <string.h>
+#include <stddef.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
-dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+static gpio_fast_bundle_t bundles[GPIO_FAST_MAX_BUNDLES];
+static uint8_t bundles_qty = 0;
+static gpio_fast_t legacy_bundle = NULL;	/*!< Bundle of GPIOFastInit */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -30,29 +31,61 @@ int bundleA_gpios[16];
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
+gpio_fast_t GPIOFastBundleInit(const gpio_t *pin_list, uint8_t pin_qty, gpio_fast_dir_t dir){
+    int gpios[GPIO_FAST_MAX_PINS];
+    gpio_fast_t bundle;
+    uint32_t offset;
 
-void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
+    if(bundles_qty == GPIO_FAST_MAX_BUNDLES || pin_qty == 0 || pin_qty > GPIO_FAST_MAX_PINS){
+        return NULL;
+    }
+    bundle = &bundles[bundles_qty];
     gpio_config_t io_conf = {
-        .mode = GPIO_MODE_OUTPUT,
+        .mode = (dir == GPIO_FAST_OUTPUT) ? GPIO_MODE_OUTPUT : GPIO_MODE_INPUT,
     };
-    for (int i = 0; i < pin_qty; i++) {
-        io_conf.pin_bit_mask = 1ULL << bundleA_gpios[i];
+    for(uint8_t i = 0; i < pin_qty; i++){
+        // one by one: gpio_t is an enum, not a byte
+        gpios[i] = pin_list[i];
+        io_conf.pin_bit_mask = 1ULL << gpios[i];
         gpio_config(&io_conf);
     }
-    // Create bundleA, output only
-    dedic_gpio_bundle_config_t bundleA_config = {
-        .gpio_array = bundleA_gpios,
+    dedic_gpio_bundle_config_t bundle_config = {
+        .gpio_array = gpios,
         .array_size = pin_qty,
         .flags = {
-            .out_en = 1,
+            .out_en = (dir == GPIO_FAST_OUTPUT),
+            .in_en = (dir == GPIO_FAST_INPUT),
         },
     };
-    ESP_ERROR_CHECK(dedic_gpio_new_bundle(&bundleA_config, &bundleA));
+    if(dedic_gpio_new_bundle(&bundle_config, &bundle->bundle) != ESP_OK){
+        return NULL;
+    }
+    if(dir == GPIO_FAST_OUTPUT){
+        dedic_gpio_get_out_offset(bundle->bundle, &offset);
+    }else{
+        dedic_gpio_get_in_offset(bundle->bundle, &offset);
+    }
+    bundle->offset = offset;
+    bundle->dir = dir;
+    bundle->mask = (1UL << pin_qty) - 1;
+    bundles_qty++;
+    return bundle;
+}
+
+uint32_t GPIOFastBundleRead(gpio_fast_t bundle){
+    if(bundle->dir == GPIO_FAST_OUTPUT){
+        return dedic_gpio_bundle_read_out(bundle->bundle);
+    }
+    return dedic_gpio_bundle_read_in(bundle->bundle);
+}
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+    legacy_bundle = GPIOFastBundleInit(pin_list, pin_qty, GPIO_FAST_OUTPUT);
+    ESP_ERROR_CHECK(legacy_bundle == NULL ? ESP_FAIL : ESP_OK);
 }
 
 void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+    GPIOFastBundleWrite(legacy_bundle, legacy_bundle->mask, value);
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
@@ -14,6 +14,8 @@
 #include <stdint.h>
 #include "driver/gpio.h"
 #include "driver/gpio_filter.h"
+#include "soc/gpio_struct.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_QTY 	24
 #define FILTER_QTY	8
@@ -24,10 +26,22 @@ typedef struct{
 	bool state;					/*!< GPIO output state */
 } digital_io_t;
 /*==================[internal data declaration]==============================*/
+#if CONFIG_DRIVERS_TRACE
+/**
+ * @brief Interrupt handler of a pin, called after its trace point
+ */
+typedef struct{
+	void (*func_p)(void*);		/*!< Handler of the application */
+	void *args;					/*!< Handler parameter */
+} gpio_isr_t;
+#endif
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+#if CONFIG_DRIVERS_TRACE
+static gpio_isr_t gpio_isr[GPIO_QTY];
+#endif
 digital_io_t gpio_list[GPIO_QTY] = {
 	{GPIO_NUM_0, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO0*/
 	{GPIO_NUM_1, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO1*/
@@ -62,6 +76,16 @@ gpio_flex_glitch_filter_config_t filter_config = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+#if CONFIG_DRIVERS_TRACE
+/**
+ * @brief Trace point of the GPIO interrupts (arg: pin), before the handler
+ */
+static void IRAM_ATTR GPIOTraceIsr(void *param){
+	gpio_isr_t *isr = param;
+	TRACE_INSTANT(TRACE_GPIO, isr - gpio_isr);
+	isr->func_p(isr->args);
+}
+#endif
 
 /*==================[external functions definition]==========================*/
 void GPIOInit(gpio_t pin, io_t io){
@@ -98,6 +122,18 @@ void GPIOToggle(gpio_t pin){
 	gpio_set_level(gpio_list[pin].pin, gpio_list[pin].state);
 }
 
+void GPIOWriteMask(uint32_t pin_mask, uint32_t state_mask){
+	uint32_t set = pin_mask & state_mask;
+	uint32_t clear = pin_mask & ~state_mask;
+	GPIO.out_w1ts.val = set;
+	GPIO.out_w1tc.val = clear;
+	// keep the state used by GPIOToggle
+	for(uint32_t pins = pin_mask & ((1UL << GPIO_QTY) - 1); pins; pins &= pins - 1){
+		uint8_t pin = __builtin_ctz(pins);
+		gpio_list[pin].state = (set >> pin) & 1;
+	}
+}
+
 bool GPIORead(gpio_t pin){
 	return gpio_get_level(gpio_list[pin].pin);
 }
@@ -113,7 +149,13 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
 		gpio_install_isr_service(0);
 		isr_service_installed = true;
 	}
+#if CONFIG_DRIVERS_TRACE
+	gpio_isr[pin].func_p = ptr_int_func;
+	gpio_isr[pin].args = args;
+	gpio_isr_handler_add(gpio_list[pin].pin, GPIOTraceIsr, &gpio_isr[pin]);
+#else
     gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+#endif
 }
 
 void GPIOInputFilter(gpio_t pin){
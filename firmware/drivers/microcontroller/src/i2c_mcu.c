@@ -10,47 +10,624 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
 #include <esp_log.h>
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <esp_timer.h>
 //#include "sdkconfig.h"
 
 #include "i2c_mcu.h"
 /*==================[macros and definitions]=================================*/
-#define I2C_NUM I2C_NUM_0
+#define I2C_MAX_DEVICES     8       /*!< Devices on the bus */
+#define I2C_MAX_WRITE       64      /*!< Maximum data bytes of a register write */
+#define I2C_DEV_QUEUE       4       /*!< Pending transactions of each device */
+#define I2C_MERGE_MAX       4       /*!< Maximum reads merged in one transaction */
+#define I2C_MERGE_BYTES     64      /*!< Maximum length of a merged read */
+#define I2C_GLITCH_CNT      7       /*!< Glitch filter (APB cycles) */
+#define I2C_SCHED_PRIORITY  11      /*!< Priority of the scheduler task */
 
-#undef ESP_ERROR_CHECK
-#define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
+#define SHADOW_BIT(map, r)  ((map)[(r) >> 5] & (1UL << ((r) & 31)))
+#define SHADOW_SET(map, r)  ((map)[(r) >> 5] |= (1UL << ((r) & 31)))
+#define SHADOW_CLR(map, r)  ((map)[(r) >> 5] &= ~(1UL << ((r) & 31)))
+
+static const char *TAG = "i2c_mcu";
 
 /*==================[internal data definition]===============================*/
+typedef enum {
+	I2C_OP_READ,        /*!< Register write then read (repeated start) */
+	I2C_OP_WRITE,       /*!< Register and data in a single write */
+	I2C_OP_RECEIVE,     /*!< Plain read */
+} i2c_op_t;
+
+typedef struct {
+	i2c_op_t op;
+	uint8_t regAddr;
+	uint8_t *data;
+	uint16_t length;
+	uint16_t timeout;
+	i2c_done_cb_t callback;
+	void *param;
+	bool *result;               /*!< Blocking calls: result and completion signal */
+	SemaphoreHandle_t done;
+	int64_t queued;             /*!< Time of the request (us) */
+} i2c_trans_t;
+
+struct i2c_device_s {
+	uint8_t addr;
+	i2c_master_dev_handle_t handle;
+	uint8_t priority;
+	bool coalesce;
+	QueueHandle_t queue;        /*!< Pending transactions, in order */
+	SemaphoreHandle_t lock;     /*!< One blocking call at a time */
+	SemaphoreHandle_t done;
+	i2c_shadow_t *shadow;       /*!< Register shadow, NULL if disabled */
+	i2c_stats_t stats;
+	int64_t stats_start;
+};
+
+static i2c_master_bus_handle_t bus = NULL;
+static uint32_t bus_clock = I2C_MASTER_FREQ_HZ;
+static struct i2c_device_s devices[I2C_MAX_DEVICES];
+static uint8_t devices_count = 0;
+static SemaphoreHandle_t devices_mutex;  /*!< Device table */
+static SemaphoreHandle_t bus_mutex;      /*!< Device handles, held while a transaction runs */
+static SemaphoreHandle_t pending;        /*!< Transactions queued on all devices */
+static TaskHandle_t sched_task = NULL;
+static uint8_t sched_last = 0;
+static uint8_t merge_buf[I2C_MERGE_BYTES];
 
 /*==================[internal functions declaration]=========================*/
 
+/*==================[internal functions definition]==========================*/
+
+/** Timeout in ms for the IDF transfer functions (0 = default timeout)
+ */
+static int I2C_timeout(uint16_t timeout) {
+	return (timeout == 0) ? I2C_MASTER_TIMEOUT_MS : timeout;
+}
+
+/** Runs a transaction on the bus
+ */
+static bool I2C_execute(i2c_dev_t dev, const i2c_trans_t *t) {
+	uint8_t tx[I2C_MAX_WRITE + 1];
+	esp_err_t err;
+
+	switch (t->op) {
+	case I2C_OP_READ:
+		err = i2c_master_transmit_receive(dev->handle, &t->regAddr, 1, t->data, t->length, I2C_timeout(t->timeout));
+		break;
+	case I2C_OP_WRITE:
+		tx[0] = t->regAddr;
+		memcpy(&tx[1], t->data, t->length);
+		err = i2c_master_transmit(dev->handle, tx, t->length + 1, I2C_timeout(t->timeout));
+		break;
+	default:
+		err = i2c_master_receive(dev->handle, t->data, t->length, I2C_timeout(t->timeout));
+		break;
+	}
+	if (err != ESP_OK) {
+		ESP_LOGE(TAG, "dev 0x%02x reg 0x%02x: %s", dev->addr, t->regAddr, esp_err_to_name(err));
+	}
+	return err == ESP_OK;
+}
+
+/** Runs a transaction on the bus and counts it (bus_mutex held)
+ */
+static bool I2C_executeCounted(i2c_dev_t dev, const i2c_trans_t *t, uint8_t requests) {
+	int64_t start = esp_timer_get_time();
+	bool ok = I2C_execute(dev, t);
+
+	dev->stats.busy_us += esp_timer_get_time() - start;
+	dev->stats.transactions++;
+	dev->stats.requests += requests;
+	dev->stats.bytes += t->length;
+	if (!ok) {
+		dev->stats.errors++;
+	}
+	return ok;
+}
+
+/** Counts the latency of a request, from the call to the end of its transaction (bus_mutex held)
+ */
+static void I2C_latency(i2c_dev_t dev, const i2c_trans_t *t, int64_t end) {
+	uint32_t latency = end - t->queued;
+	// < 64 us, then one bin per power of two
+	uint8_t bin = (latency < 64) ? 0 : 26 - __builtin_clz(latency);
+
+	dev->stats.latency[(bin < I2C_LATENCY_BINS) ? bin : I2C_LATENCY_BINS - 1]++;
+	if (t->done != NULL) {
+		dev->stats.blocked_us += latency;
+	}
+}
+
+/** Signals the end of a transaction to its client
+ */
+static void I2C_complete(const i2c_trans_t *t, bool ok) {
+	if (t->done != NULL) {
+		*t->result = ok;
+		xSemaphoreGive(t->done);
+	} else if (t->callback != NULL) {
+		t->callback(ok, t->param);
+	}
+}
+
+/** Next device to serve: highest priority with pending transactions,
+ * round robin between devices of the same priority
+ */
+static i2c_dev_t I2C_nextDevice(void) {
+	i2c_dev_t dev = NULL;
+	uint8_t n, i;
+
+	xSemaphoreTake(devices_mutex, portMAX_DELAY);
+	n = devices_count;
+	for (uint8_t k = 1; k <= n; k++) {
+		i = (sched_last + k) % n;
+		if (uxQueueMessagesWaiting(devices[i].queue) != 0 &&
+				(dev == NULL || devices[i].priority > dev->priority)) {
+			dev = &devices[i];
+		}
+	}
+	if (dev != NULL) {
+		sched_last = dev - devices;
+	}
+	xSemaphoreGive(devices_mutex);
+	return dev;
+}
+
+/** Serves the device queues. Back-to-back reads of a device with coalescing
+ * enabled covering a contiguous register range are done in one transaction.
+ */
+static void I2C_schedTask(void *pvParameters) {
+	i2c_trans_t batch[I2C_MERGE_MAX], next;
+	i2c_trans_t merged;
+	i2c_dev_t dev;
+	uint8_t n;
+	uint16_t end;
+	int64_t now;
+	bool ok;
+
+	while (true) {
+		xSemaphoreTake(pending, portMAX_DELAY);
+		if ((dev = I2C_nextDevice()) == NULL) {
+			continue;
+		}
+		xQueueReceive(dev->queue, &batch[0], 0);
+		n = 1;
+		if (dev->coalesce && batch[0].op == I2C_OP_READ && batch[0].length <= I2C_MERGE_BYTES) {
+			merged = batch[0];
+			end = batch[0].regAddr + batch[0].length;
+			while (n < I2C_MERGE_MAX && xQueuePeek(dev->queue, &next, 0) == pdTRUE &&
+					next.op == I2C_OP_READ && next.regAddr >= merged.regAddr && next.regAddr <= end &&
+					next.regAddr + next.length - merged.regAddr <= I2C_MERGE_BYTES) {
+				xQueueReceive(dev->queue, &batch[n++], 0);
+				xSemaphoreTake(pending, 0);
+				if (next.regAddr + next.length > end) {
+					end = next.regAddr + next.length;
+				}
+			}
+			merged.data = merge_buf;
+			merged.length = end - merged.regAddr;
+		}
+
+		xSemaphoreTake(bus_mutex, portMAX_DELAY);
+		ok = I2C_executeCounted(dev, (n > 1) ? &merged : &batch[0], n);
+		now = esp_timer_get_time();
+		for (uint8_t i = 0; i < n; i++) {
+			I2C_latency(dev, &batch[i], now);
+		}
+		xSemaphoreGive(bus_mutex);
+
+		for (uint8_t i = 0; i < n; i++) {
+			if (n > 1) {
+				memcpy(batch[i].data, &merge_buf[batch[i].regAddr - merged.regAddr], batch[i].length);
+			}
+			I2C_complete(&batch[i], ok);
+		}
+	}
+}
+
+/** Queues a transaction on its device
+ */
+static bool I2C_submit(i2c_dev_t dev, i2c_trans_t *t, TickType_t wait) {
+	if (dev == NULL || (t->op == I2C_OP_WRITE && t->length > I2C_MAX_WRITE)) {
+		ESP_LOGE(TAG, "transaction not supported");
+		return false;
+	}
+	t->queued = esp_timer_get_time();
+	if (xQueueSend(dev->queue, t, wait) != pdTRUE) {
+		return false;
+	}
+	xSemaphoreGive(pending);
+	return true;
+}
+
+/** Runs a transaction through the scheduler and waits for it (device lock held)
+ */
+static bool I2C_transfer(i2c_dev_t dev, i2c_op_t op, uint8_t regAddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+	bool ok = false;
+	i2c_trans_t t = {
+		.op = op,
+		.regAddr = regAddr,
+		.data = data,
+		.length = length,
+		.timeout = timeout,
+		.result = &ok,
+	};
+
+	if (xTaskGetCurrentTaskHandle() == sched_task) {
+		// called from a completion callback: run it now, ahead of the queues
+		t.queued = esp_timer_get_time();
+		xSemaphoreTake(bus_mutex, portMAX_DELAY);
+		ok = I2C_executeCounted(dev, &t, 1);
+		I2C_latency(dev, &t, esp_timer_get_time());
+		xSemaphoreGive(bus_mutex);
+		return ok;
+	}
+	t.done = dev->done;
+	if (I2C_submit(dev, &t, portMAX_DELAY)) {
+		xSemaphoreTake(dev->done, portMAX_DELAY);
+	}
+	return ok;
+}
+
+/** One blocking call at a time on each device (the scheduler task, running a
+ * callback, doesn't wait: the lock may be held by a task waiting for it)
+ */
+static void I2C_lock(i2c_dev_t dev) {
+	if (xTaskGetCurrentTaskHandle() != sched_task) {
+		xSemaphoreTake(dev->lock, portMAX_DELAY);
+	}
+}
+
+static void I2C_unlock(i2c_dev_t dev) {
+	if (xTaskGetCurrentTaskHandle() != sched_task) {
+		xSemaphoreGive(dev->lock);
+	}
+}
+
+/** true if all the registers of the range are set in the map
+ */
+static bool I2C_shadowAll(const uint32_t *map, uint8_t regAddr, uint16_t length) {
+	if (length == 0 || regAddr + length > I2C_SHADOW_REGS) {
+		return false;
+	}
+	for (uint16_t r = regAddr; r < regAddr + length; r++) {
+		if (!SHADOW_BIT(map, r)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/** Updates the shadow after a transfer: stores the cacheable registers (ok) or forgets them
+ */
+static void I2C_shadowStore(i2c_shadow_t *shadow, uint8_t regAddr, const uint8_t *data, uint16_t length, bool ok) {
+	for (uint16_t i = 0; i < length && regAddr + i < I2C_SHADOW_REGS; i++) {
+		uint16_t r = regAddr + i;
+		if (!SHADOW_BIT(shadow->cacheable, r)) {
+			continue;
+		}
+		if (ok) {
+			shadow->value[r] = data[i];
+			SHADOW_SET(shadow->valid, r);
+		} else {
+			SHADOW_CLR(shadow->valid, r);
+		}
+		SHADOW_CLR(shadow->dirty, r);
+	}
+}
+
+/** Writes the dirty registers, in bursts that also cover the known registers between them
+ */
+static bool I2C_shadowFlush(i2c_dev_t dev) {
+	i2c_shadow_t *shadow = dev->shadow;
+	uint16_t r = 0, start, last;
+	bool ok = true, burst_ok;
+
+	while (r < I2C_SHADOW_REGS) {
+		if (!SHADOW_BIT(shadow->dirty, r)) {
+			r++;
+			continue;
+		}
+		start = last = r;
+		for (r = start + 1; r < I2C_SHADOW_REGS && r - start < I2C_MAX_WRITE && SHADOW_BIT(shadow->valid, r); r++) {
+			if (SHADOW_BIT(shadow->dirty, r)) {
+				last = r;
+			}
+		}
+		burst_ok = I2C_transfer(dev, I2C_OP_WRITE, start, &shadow->value[start], last - start + 1, 0);
+		I2C_shadowStore(shadow, start, &shadow->value[start], last - start + 1, burst_ok);
+		ok = ok && burst_ok;
+		r = last + 1;
+	}
+	return ok;
+}
+
+/** Blocking transaction, served from the register shadow when possible
+ */
+static bool I2C_access(i2c_dev_t dev, i2c_op_t op, uint8_t regAddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+	i2c_shadow_t *shadow;
+	bool ok = true;
+
+	if (dev == NULL) {
+		return false;
+	}
+	I2C_lock(dev);
+	shadow = dev->shadow;
+	if (shadow == NULL) {
+		ok = I2C_transfer(dev, op, regAddr, data, length, timeout);
+	} else if (op == I2C_OP_READ && I2C_shadowAll(shadow->valid, regAddr, length)) {
+		memcpy(data, &shadow->value[regAddr], length);
+	} else if (op == I2C_OP_READ && I2C_shadowAll(shadow->cacheable, regAddr, length)) {
+		// configuration registers don't depend on the delayed writes: no flush
+		ok = I2C_transfer(dev, op, regAddr, data, length, timeout);
+		for (uint16_t i = 0; i < length; i++) {
+			uint16_t r = regAddr + i;
+			if (SHADOW_BIT(shadow->dirty, r)) {
+				data[i] = shadow->value[r];
+			} else if (ok) {
+				shadow->value[r] = data[i];
+				SHADOW_SET(shadow->valid, r);
+			}
+		}
+	} else if (op == I2C_OP_WRITE && shadow->batch && I2C_shadowAll(shadow->cacheable, regAddr, length)) {
+		// written on commit (or before the next bus access)
+		I2C_shadowStore(shadow, regAddr, data, length, true);
+		for (uint16_t r = regAddr; r < regAddr + length; r++) {
+			SHADOW_SET(shadow->dirty, r);
+		}
+	} else {
+		// keep the order of the writes: dirty registers go first
+		ok = I2C_shadowFlush(dev);
+		ok = I2C_transfer(dev, op, regAddr, data, length, timeout) && ok;
+		if (op != I2C_OP_RECEIVE) {
+			I2C_shadowStore(shadow, regAddr, data, length, ok);
+		}
+	}
+	I2C_unlock(dev);
+	return ok;
+}
+
 /*==================[external functions definition]==========================*/
 
+i2c_dev_t I2C_getDevice(uint8_t devAddr) {
+	i2c_dev_t dev = NULL;
+
+	xSemaphoreTake(devices_mutex, portMAX_DELAY);
+	for (uint8_t i = 0; i < devices_count; i++) {
+		if (devices[i].addr == devAddr) {
+			dev = &devices[i];
+			break;
+		}
+	}
+	xSemaphoreGive(devices_mutex);
+	if (dev == NULL) {
+		dev = I2C_addDevice(devAddr, bus_clock);
+	}
+	return dev;
+}
+
 /** Initialize I2C0
  */
 bool I2C_initialize( uint32_t clockRateHz )
 {
-	int i2c_master_port = I2C_MASTER_NUM;
+	i2c_master_bus_config_t conf = {
+		.i2c_port = I2C_MASTER_NUM,
+		.sda_io_num = I2C_MASTER_SDA_IO,
+		.scl_io_num = I2C_MASTER_SCL_IO,
+		.clk_source = I2C_CLK_SRC_DEFAULT,
+		.glitch_ignore_cnt = I2C_GLITCH_CNT,
+		.flags.enable_internal_pullup = true,
+	};
+
+	bus_clock = clockRateHz;
+	if (bus != NULL) {
+		return true;
+	}
+	if (i2c_new_master_bus(&conf, &bus) != ESP_OK) {
+		bus = NULL;
+		return false;
+	}
+	devices_mutex = xSemaphoreCreateMutex();
+	bus_mutex = xSemaphoreCreateMutex();
+	pending = xSemaphoreCreateCounting(I2C_MAX_DEVICES * I2C_DEV_QUEUE, 0);
+	xTaskCreate(I2C_schedTask, "i2c_sched", 2048, NULL, I2C_SCHED_PRIORITY, &sched_task);
+	return true;
+}
 
-    i2c_config_t conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = clockRateHz,
-    };
+i2c_dev_t I2C_addDevice(uint8_t devAddr, uint32_t clockRateHz) {
+	i2c_device_config_t conf = {
+		.dev_addr_length = I2C_ADDR_BIT_LEN_7,
+		.device_address = devAddr,
+		.scl_speed_hz = clockRateHz,
+	};
+	i2c_master_dev_handle_t handle = NULL;
+	i2c_dev_t dev = NULL;
+	uint8_t i;
+
+	if (bus == NULL) {
+		return NULL;
+	}
+	xSemaphoreTake(devices_mutex, portMAX_DELAY);
+	for (i = 0; i < devices_count; i++) {
+		if (devices[i].addr == devAddr) {
+			dev = &devices[i];
+			break;
+		}
+	}
+	if (dev != NULL) {
+		// the clock of a handle can't be changed: add it again, between transactions
+		xSemaphoreTake(bus_mutex, portMAX_DELAY);
+		i2c_master_bus_rm_device(dev->handle);
+		if (i2c_master_bus_add_device(bus, &conf, &dev->handle) != ESP_OK) {
+			conf.scl_speed_hz = bus_clock;
+			i2c_master_bus_add_device(bus, &conf, &dev->handle);
+			dev = NULL;
+		}
+		xSemaphoreGive(bus_mutex);
+	} else if (devices_count < I2C_MAX_DEVICES && i2c_master_bus_add_device(bus, &conf, &handle) == ESP_OK) {
+		dev = &devices[devices_count];
+		if (dev->queue == NULL) {
+			dev->queue = xQueueCreate(I2C_DEV_QUEUE, sizeof(i2c_trans_t));
+			dev->lock = xSemaphoreCreateMutex();
+			dev->done = xSemaphoreCreateBinary();
+		}
+		dev->addr = devAddr;
+		dev->handle = handle;
+		dev->priority = 0;
+		dev->coalesce = false;
+		dev->shadow = NULL;
+		memset(&dev->stats, 0, sizeof(dev->stats));
+		dev->stats_start = esp_timer_get_time();
+		devices_count++;
+	}
+	xSemaphoreGive(devices_mutex);
+	if (dev == NULL) {
+		ESP_LOGE(TAG, "can't add device 0x%02x", devAddr);
+	}
+	return dev;
+}
 
-    i2c_param_config(i2c_master_port, &conf);
+void I2C_setPriority(i2c_dev_t dev, uint8_t priority, bool coalesce) {
+	if (dev != NULL) {
+		dev->priority = priority;
+		dev->coalesce = coalesce;
+	}
+}
 
-    return i2c_driver_install(i2c_master_port, conf.mode, I2C_MASTER_RX_BUF_DISABLE, I2C_MASTER_TX_BUF_DISABLE, 0);
-	return true;
-};
+void I2C_getStats(i2c_dev_t dev, i2c_stats_t *stats, bool reset) {
+	int64_t now = esp_timer_get_time();
+	int64_t start = now;
+	uint8_t first = 0, last = 0;
+
+	memset(stats, 0, sizeof(*stats));
+	if (bus == NULL) {
+		return;
+	}
+	if (dev == NULL) {
+		last = devices_count;
+	} else {
+		first = dev - devices;
+		last = first + 1;
+	}
+	xSemaphoreTake(bus_mutex, portMAX_DELAY);
+	for (uint8_t i = first; i < last; i++) {
+		i2c_stats_t *d = &devices[i].stats;
+		stats->transactions += d->transactions;
+		stats->requests += d->requests;
+		stats->errors += d->errors;
+		stats->bytes += d->bytes;
+		stats->busy_us += d->busy_us;
+		stats->blocked_us += d->blocked_us;
+		for (uint8_t b = 0; b < I2C_LATENCY_BINS; b++) {
+			stats->latency[b] += d->latency[b];
+		}
+		if (devices[i].stats_start < start) {
+			start = devices[i].stats_start;
+		}
+		if (reset) {
+			memset(d, 0, sizeof(*d));
+			devices[i].stats_start = now;
+		}
+	}
+	xSemaphoreGive(bus_mutex);
+	stats->period_us = now - start;
+	stats->load = (stats->period_us == 0) ? 0 : (uint16_t)((uint64_t)stats->busy_us * 1000 / stats->period_us);
+}
+
+void I2C_shadowEnable(i2c_dev_t dev, i2c_shadow_t *shadow) {
+	if (dev == NULL) {
+		return;
+	}
+	if (shadow != NULL) {
+		memset(shadow, 0, sizeof(*shadow));
+	}
+	I2C_lock(dev);
+	dev->shadow = shadow;
+	I2C_unlock(dev);
+}
+
+void I2C_shadowCacheable(i2c_dev_t dev, uint8_t first, uint8_t last) {
+	if (dev == NULL || dev->shadow == NULL) {
+		return;
+	}
+	I2C_lock(dev);
+	for (uint16_t r = first; r <= last; r++) {
+		SHADOW_SET(dev->shadow->cacheable, r);
+	}
+	I2C_unlock(dev);
+}
+
+void I2C_shadowInvalidate(i2c_dev_t dev) {
+	if (dev == NULL || dev->shadow == NULL) {
+		return;
+	}
+	I2C_lock(dev);
+	memset(dev->shadow->valid, 0, sizeof(dev->shadow->valid));
+	memset(dev->shadow->dirty, 0, sizeof(dev->shadow->dirty));
+	I2C_unlock(dev);
+}
+
+void I2C_shadowBegin(i2c_dev_t dev) {
+	if (dev != NULL && dev->shadow != NULL) {
+		dev->shadow->batch = true;
+	}
+}
+
+bool I2C_shadowCommit(i2c_dev_t dev) {
+	bool ok;
+
+	if (dev == NULL || dev->shadow == NULL) {
+		return dev != NULL;
+	}
+	I2C_lock(dev);
+	ok = I2C_shadowFlush(dev);
+	dev->shadow->batch = false;
+	I2C_unlock(dev);
+	return ok;
+}
+
+bool I2C_devReadRegs(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+	return I2C_access(dev, I2C_OP_READ, regAddr, data, length, timeout);
+}
+
+bool I2C_devWriteRegs(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+	return I2C_access(dev, I2C_OP_WRITE, regAddr, (uint8_t *)data, length, timeout);
+}
 
+bool I2C_devReadRegsAsync(i2c_dev_t dev, uint8_t regAddr, uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param) {
+	i2c_trans_t t = {
+		.op = I2C_OP_READ,
+		.regAddr = regAddr,
+		.data = data,
+		.length = length,
+		.callback = callback,
+		.param = param,
+	};
+	return I2C_submit(dev, &t, 0);
+}
 
+bool I2C_devWriteRegsAsync(i2c_dev_t dev, uint8_t regAddr, const uint8_t *data, uint16_t length, i2c_done_cb_t callback, void *param) {
+	if (dev != NULL && dev->shadow != NULL) {
+		// not tracked by the shadow: forget the registers written
+		I2C_lock(dev);
+		I2C_shadowStore(dev->shadow, regAddr, data, length, false);
+		I2C_unlock(dev);
+	}
+	i2c_trans_t t = {
+		.op = I2C_OP_WRITE,
+		.regAddr = regAddr,
+		.data = (uint8_t *)data,
+		.length = length,
+		.callback = callback,
+		.param = param,
+	};
+	return I2C_submit(dev, &t, 0);
+}
 
 /** Enable or disable I2C
  * @param isEnabled true = enable, false = disable
@@ -124,22 +701,10 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	I2C_SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
+	// register address and data in a single transaction (repeated start)
+	if (!I2C_devReadRegs(I2C_getDevice(devAddr), regAddr, data, length, timeout)) {
+		return 0;
+	}
 	return length;
 }
 
@@ -151,21 +716,9 @@ int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
 int8_t I2C_requestBytes(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
+	if (!I2C_access(I2C_getDevice(devAddr), I2C_OP_RECEIVE, 0, data, length, timeout)) {
+		return 0;
+	}
 	return length;
 }
 
@@ -176,16 +729,12 @@ bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 	return true;
 }
 
-void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
-	i2c_cmd_handle_t cmd;
+bool I2C_burstRead(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data){
+	return I2C_devReadRegs(I2C_getDevice(devAddr), regAddr, data, length, 0);
+}
 
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, reg, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
+	I2C_writeREG(devAddr, reg);
 }
 
 /** write a single bit in an 8-bit device register.
@@ -238,18 +787,7 @@ bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t l
  * @return Status of operation (true = success)
  */
 bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
-	return true;
+	return I2C_devWriteRegs(I2C_getDevice(devAddr), regAddr, &data, 1, 0);
 }
 
 /** Write single byte to an 8-bit device register.
@@ -260,31 +798,11 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  * @return Status of operation (true = success)
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
-	return true;
+	return I2C_devWriteRegs(I2C_getDevice(devAddr), regAddr, data, length, 0);
 }
 
 bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
-	i2c_cmd_link_delete(cmd);
-	return true;
+	return I2C_access(I2C_getDevice(devAddr), I2C_OP_WRITE, regAddr, NULL, 0, 0);
 }
 
 /**
@@ -297,7 +815,7 @@ bool I2C_writeREG(uint8_t devAddr, uint8_t regAddr){
  */
 int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout){
 	uint8_t msb[2] = {0,0};
-	I2C_readBytes(devAddr, regAddr, 2, msb, 0);
+	int8_t count = I2C_readBytes(devAddr, regAddr, 2, msb, timeout);
 	*data = (int16_t)((msb[0] << 8) | msb[1]);
-	return 0;
+	return count;
 }
\ No newline at end of file
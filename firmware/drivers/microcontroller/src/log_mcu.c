@@ -0,0 +1,189 @@
+/**
+ * @file log_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "log_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+#define LOG_MASK		(CONFIG_DRIVERS_LOG_DEFER_ENTRIES - 1)
+#define LOG_TASK_STACK	3072
+#define LOG_PERIOD_MS	20			/* Ring polled by the logging task */
+#define LOG_LINE_MAX	256			/* Formatted message, longer ones are cut */
+#define LOG_SPEC_MAX	16			/* One conversion specification */
+
+_Static_assert((CONFIG_DRIVERS_LOG_DEFER_ENTRIES & LOG_MASK) == 0, "CONFIG_DRIVERS_LOG_DEFER_ENTRIES must be a power of two");
+/*==================[internal data declaration]==============================*/
+/* Entry of the ring: seq tells whose turn it is (Vyukov bounded queue):
+ * position for the writer that reserves it, position + 1 once written. It is
+ * stored minus the index, so the zeroed ring is ready before LogDeferInit */
+typedef struct {
+	uint32_t seq;
+	const char *fmt;
+	uint8_t n;
+	uint32_t args[LOG_DEFER_MAX_ARGS];
+} log_entry_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static log_entry_t log_ring[CONFIG_DRIVERS_LOG_DEFER_ENTRIES];
+static uint32_t log_head = 0;			/* Next position to write */
+static uint32_t log_tail = 0;			/* Next position to print (logging task only) */
+static uint32_t log_dropped = 0;
+static uint32_t log_busy = 0;			/* An entry is being printed */
+static TaskHandle_t log_task = NULL;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline uint32_t LogSeqLoad(uint32_t pos){
+	return __atomic_load_n(&log_ring[pos & LOG_MASK].seq, __ATOMIC_ACQUIRE) + (pos & LOG_MASK);
+}
+
+static inline void LogSeqStore(uint32_t pos, uint32_t seq){
+	__atomic_store_n(&log_ring[pos & LOG_MASK].seq, seq - (pos & LOG_MASK), __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Format an entry: each conversion of fmt is printed with snprintf
+ * and its argument in the type the conversion expects
+ */
+static void LogFormat(const log_entry_t *entry, char *line){
+	const char *p = entry->fmt;
+	char spec[LOG_SPEC_MAX];
+	size_t len = 0, spec_len;
+	uint8_t arg = 0;
+	uint32_t value;
+	union {uint32_t u; float f;} bits;
+
+	while(*p != '\0' && len < LOG_LINE_MAX - 1){
+		if(*p != '%'){
+			line[len++] = *p++;
+			continue;
+		}
+		if(p[1] == '%'){
+			line[len++] = '%';
+			p += 2;
+			continue;
+		}
+		// the specification up to its conversion character
+		spec_len = strcspn(p + 1, "diouxXcsfFeEgGaAp") + 2;
+		if(p[spec_len - 1] == '\0' || spec_len >= LOG_SPEC_MAX || arg >= entry->n){
+			break;
+		}
+		memcpy(spec, p, spec_len);
+		spec[spec_len] = '\0';
+		p += spec_len;
+		value = entry->args[arg++];
+		switch(spec[spec_len - 1]){
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+				bits.u = value;
+				len += snprintf(line + len, LOG_LINE_MAX - len, spec, (double)bits.f);
+			break;
+			case 's':
+				len += snprintf(line + len, LOG_LINE_MAX - len, spec, (const char *)(uintptr_t)value);
+			break;
+			case 'p':
+				len += snprintf(line + len, LOG_LINE_MAX - len, spec, (void *)(uintptr_t)value);
+			break;
+			default:
+				len += snprintf(line + len, LOG_LINE_MAX - len, spec, value);
+			break;
+		}
+	}
+	if(len > LOG_LINE_MAX - 1){
+		len = LOG_LINE_MAX - 1;
+	}
+	line[len] = '\0';
+}
+
+/**
+ * @brief Print the entries written so far, in order
+ */
+static void LogDrain(void){
+	static char line[LOG_LINE_MAX];
+	static uint32_t dropped_reported = 0;
+	uint32_t dropped;
+
+	if(__atomic_exchange_n(&log_busy, 1, __ATOMIC_ACQUIRE)){
+		return;
+	}
+	while(true){
+		if(LogSeqLoad(log_tail) != log_tail + 1){
+			break;
+		}
+		LogFormat(&log_ring[log_tail & LOG_MASK], line);
+		// the entry is free again for the writer one lap ahead
+		LogSeqStore(log_tail, log_tail + CONFIG_DRIVERS_LOG_DEFER_ENTRIES);
+		log_tail++;
+		fputs(line, stdout);
+	}
+	dropped = __atomic_load_n(&log_dropped, __ATOMIC_RELAXED);
+	if(dropped != dropped_reported){
+		printf("log_mcu: %lu messages dropped\r\n", (unsigned long)(dropped - dropped_reported));
+		dropped_reported = dropped;
+	}
+	fflush(stdout);
+	__atomic_store_n(&log_busy, 0, __ATOMIC_RELEASE);
+}
+
+static void LogDeferTask(void *param){
+	while(true){
+		LogDrain();
+		vTaskDelay(pdMS_TO_TICKS(LOG_PERIOD_MS));
+	}
+}
+/*==================[external functions definition]==========================*/
+bool LogDeferRecord(const char *fmt, uint8_t n, const uint32_t *args){
+	uint32_t pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+	log_entry_t *entry;
+	int32_t diff;
+
+	while(true){
+		diff = (int32_t)(LogSeqLoad(pos) - pos);
+		if(diff == 0){
+			// the entry is free: reserve it, or retry from the position another writer left
+			if(__atomic_compare_exchange_n(&log_head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+				break;
+			}
+		}else if(diff < 0){
+			// not printed yet: full
+			__atomic_fetch_add(&log_dropped, 1, __ATOMIC_RELAXED);
+			return false;
+		}else{
+			pos = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+		}
+	}
+	entry = &log_ring[pos & LOG_MASK];
+	entry->fmt = fmt;
+	entry->n = n;
+	memcpy(entry->args, args, n * sizeof(uint32_t));
+	LogSeqStore(pos, pos + 1);
+	return true;
+}
+
+bool LogDeferInit(uint8_t priority){
+	if(log_task != NULL){
+		return true;
+	}
+	return xTaskCreate(LogDeferTask, "LogDefer", LOG_TASK_STACK, NULL, priority, &log_task) == pdPASS;
+}
+
+void LogDeferFlush(void){
+	LogDrain();
+}
+
+uint32_t LogDeferDropped(void){
+	return __atomic_load_n(&log_dropped, __ATOMIC_RELAXED);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,58 @@
+/**
+ * @file power_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "power_mcu.h"
+#include "esp_pm.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static esp_pm_lock_handle_t burst_lock = NULL;	/* NULL without power management */
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool PowerInit(power_config_t *config){
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = config->max_freq_mhz,
+        .min_freq_mhz = config->min_freq_mhz,
+        .light_sleep_enable = config->light_sleep,
+    };
+    /* ESP_ERR_NOT_SUPPORTED without CONFIG_PM_ENABLE (or light sleep without tickless idle) */
+    if(esp_pm_configure(&pm_config) != ESP_OK){
+        return false;
+    }
+    if(burst_lock == NULL){
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "burst", &burst_lock);
+    }
+    return true;
+}
+
+void PowerBurstBegin(void){
+    /* the lock counts the acquisitions: bursts of several tasks overlap */
+    if(burst_lock != NULL){
+        esp_pm_lock_acquire(burst_lock);
+    }
+}
+
+void PowerBurstEnd(void){
+    if(burst_lock != NULL){
+        esp_pm_lock_release(burst_lock);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -11,10 +11,13 @@
 
 /*==================[inclusions]=============================================*/
 #include "pwm_mcu.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include "driver/ledc.h"
 /*==================[macros and definitions]=================================*/
-#define DC_MAX  1023
+#define DC_MAX  PWM_DUTY_MAX
 #define DC_100  100
+#define PWM_QTY 4       /*!< PWM_n uses LEDC timer n and LEDC channel n */
 /*==================[internal data declaration]==============================*/
 static ledc_timer_config_t pwm_timer_cfg = {
     .speed_mode       = LEDC_LOW_SPEED_MODE,
@@ -27,6 +30,10 @@ static ledc_channel_config_t ledc_channel_cfg = {
     .duty           = 0,       /*!< Starts in 0% */
     .hpoint         = 0
 };
+static bool fade_installed = false;                 /*!< LEDC fade service installed */
+static volatile bool fading[PWM_QTY];               /*!< Fade in progress */
+static void (*fade_func_p[PWM_QTY])(void*);         /*!< Fade end callbacks */
+static void *fade_param_p[PWM_QTY];                 /*!< Fade end callbacks parameters */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -34,6 +41,16 @@ static ledc_channel_config_t ledc_channel_cfg = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static bool IRAM_ATTR PWMFadeEnd(const ledc_cb_param_t *param, void *user_arg){
+    pwm_out_t out = (pwm_out_t)(uintptr_t)user_arg;
+    if(param->event == LEDC_FADE_END_EVT){
+        fading[out] = false;
+        if(fade_func_p[out] != NULL){
+            fade_func_p[out](fade_param_p[out]);
+        }
+    }
+    return false;
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t PWMInit(pwm_out_t out, gpio_t gpio, uint16_t freq){
@@ -116,24 +133,47 @@ void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
     if(duty_cycle > DC_100){
         duty_cycle = DC_100;
     }
-    uint32_t dc = ((uint32_t)duty_cycle * DC_MAX) / DC_100;
-    switch(out){
-        case PWM_0:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_0);
-            break;
-        case PWM_1:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_1);
-            break;
-        case PWM_2:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_2);
-            break;
-        case PWM_3:
-            ledc_set_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3, dc);
-            ledc_update_duty(LEDC_LOW_SPEED_MODE, LEDC_TIMER_3);
-            break;
+    PWMSetDuty(out, ((uint32_t)duty_cycle * DC_MAX) / DC_100);
+}
+
+void PWMSetDuty(pwm_out_t out, uint16_t duty){
+    if(duty > DC_MAX){
+        duty = DC_MAX;
+    }
+    PWMFadeStop(out);
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out, duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out);
+}
+
+uint16_t PWMGetDuty(pwm_out_t out){
+    return ledc_get_duty(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out);
+}
+
+void PWMFade(pwm_out_t out, uint16_t duty, uint32_t time_ms, void *func_p, void *param_p){
+    if(duty > DC_MAX){
+        duty = DC_MAX;
+    }
+    if(!fade_installed){
+        ledc_fade_func_install(0);
+        fade_installed = true;
+    }
+    // a new fade would wait for the running one to end: retarget from the current duty
+    PWMFadeStop(out);
+    fade_func_p[out] = func_p;
+    fade_param_p[out] = param_p;
+    ledc_cbs_t callbacks = {
+        .fade_cb = PWMFadeEnd,
+    };
+    ledc_cb_register(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out, &callbacks, (void *)(uintptr_t)out);
+    ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out, duty, time_ms);
+    fading[out] = true;
+    ledc_fade_start(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out, LEDC_FADE_NO_WAIT);
+}
+
+void PWMFadeStop(pwm_out_t out){
+    if(fading[out]){
+        ledc_fade_stop(LEDC_LOW_SPEED_MODE, (ledc_channel_t)out);
+        fading[out] = false;
     }
 }
 
@@ -0,0 +1,136 @@
+/**
+ * @file retain_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief State retained in RTC memory across deep sleep
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "retain_mcu.h"
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_system.h"
+#include "esp_rom_crc.h"
+/*==================[macros and definitions]=================================*/
+#define RETAIN_MAGIC		0x52544E31			/* "RTN1" */
+#define ALIGN4(n)			(((n) + 3) & ~3u)
+
+/* Record header, followed by the content rounded up to 4 bytes */
+typedef struct {
+	uint16_t id;
+	uint16_t size;
+	uint32_t crc;
+} record_t;
+
+/* RTC memory area: its header and the records one after the other */
+typedef struct {
+	uint32_t magic;
+	uint32_t used;				/* Bytes of the records */
+	uint8_t records[CONFIG_DRIVERS_RETAIN_SIZE - 8];
+} area_t;
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/* not initialized at boot: keeps its content across deep sleep */
+static RTC_NOINIT_ATTR area_t retain;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t RecordLength(const record_t *record){
+	return sizeof(record_t) + ALIGN4(record->size);
+}
+
+static uint32_t RecordCrc(uint16_t id, uint16_t size, const void *data){
+	uint16_t header[2] = {id, size};
+
+	return esp_rom_crc32_le(esp_rom_crc32_le(0, (const uint8_t *)header, sizeof(header)), data, size);
+}
+
+/**
+ * @brief Record with the id, NULL if there is none or the area is corrupted
+ */
+static record_t *RecordFind(uint16_t id){
+	uint32_t offset = 0;
+	record_t *record;
+
+	while(offset + sizeof(record_t) <= retain.used){
+		record = (record_t *)&retain.records[offset];
+		if(offset + RecordLength(record) > retain.used){
+			return NULL;
+		}
+		if(record->id == id){
+			return record;
+		}
+		offset += RecordLength(record);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Remove a record, moving the following ones down
+ */
+static void RecordRemove(record_t *record){
+	uint32_t offset = (uint8_t *)record - retain.records;
+	uint32_t length = RecordLength(record);
+
+	memmove(record, (uint8_t *)record + length, retain.used - offset - length);
+	retain.used -= length;
+}
+/*==================[external functions definition]==========================*/
+bool RetainInit(void){
+	if(esp_reset_reason() == ESP_RST_DEEPSLEEP && retain.magic == RETAIN_MAGIC &&
+	   retain.used <= sizeof(retain.records)){
+		return true;
+	}
+	RetainClear();
+	return false;
+}
+
+bool RetainSave(uint16_t id, const void *data, size_t size){
+	record_t *record;
+
+	if(id == 0 || size > UINT16_MAX){
+		return false;
+	}
+	record = RecordFind(id);
+	if(record != NULL && record->size != size){
+		RecordRemove(record);
+		record = NULL;
+	}
+	if(record == NULL){
+		if(retain.used + sizeof(record_t) + ALIGN4(size) > sizeof(retain.records)){
+			return false;
+		}
+		record = (record_t *)&retain.records[retain.used];
+		record->id = id;
+		record->size = size;
+		retain.used += RecordLength(record);
+	}
+	memcpy(record + 1, data, size);
+	record->crc = RecordCrc(id, size, data);
+	return true;
+}
+
+bool RetainLoad(uint16_t id, void *data, size_t size){
+	record_t *record = RecordFind(id);
+
+	if(id == 0 || record == NULL || record->size != size || record->crc != RecordCrc(id, size, record + 1)){
+		return false;
+	}
+	memcpy(data, record + 1, size);
+	return true;
+}
+
+void RetainClear(void){
+	retain.magic = RETAIN_MAGIC;
+	retain.used = 0;
+}
+
+/*==================[end of file]============================================*/
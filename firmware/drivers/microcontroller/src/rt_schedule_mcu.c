@@ -0,0 +1,171 @@
+/**
+ * @file rt_schedule_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Central table of the real-time tasks: priorities and schedulability
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "rt_schedule_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+/*==================[macros and definitions]=================================*/
+#define PERMILLE(part, total)	((uint16_t)(((uint64_t)(part) * 1000 + (total) / 2) / (total)))
+
+static const char *TAG = "rt_schedule";
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static rt_task_t *table = NULL;
+static uint8_t table_n = 0;
+static rt_schedule_summary_t summary;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t Deadline(const rt_task_t *task){
+	return (task->deadline_us == 0) ? task->period_us : task->deadline_us;
+}
+
+/**
+ * @brief Worst case response time: the WCET plus every activation of the
+ * tasks of higher or equal priority within that time (fixed point iteration)
+ */
+static uint32_t ResponseTime(uint8_t i){
+	uint64_t response = table[i].wcet_us, next;
+
+	while(true){
+		next = table[i].wcet_us;
+		for(uint8_t j = 0; j < table_n; j++){
+			if(j != i && table[j].priority >= table[i].priority){
+				next += ((response + table[j].period_us - 1) / table[j].period_us) * table[j].wcet_us;
+			}
+		}
+		if(next == response){
+			return (uint32_t)response;
+		}
+		if(next > Deadline(&table[i])){
+			return RT_SCHEDULE_UNBOUNDED;
+		}
+		response = next;
+	}
+}
+/*==================[external functions definition]==========================*/
+bool RtScheduleInit(rt_task_t *tasks, uint8_t n, uint8_t lowest, uint8_t highest){
+	uint8_t order[RT_SCHEDULE_MAX_TASKS];
+	uint8_t level, k, m = 0;
+	uint32_t utilization = 0, last = 0;
+
+	if(tasks == NULL || n == 0 || n > RT_SCHEDULE_MAX_TASKS || lowest == 0 || lowest > highest ||
+	   highest >= configMAX_PRIORITIES){
+		return false;
+	}
+	for(uint8_t i = 0; i < n; i++){
+		if(tasks[i].name == NULL || tasks[i].period_us == 0 || Deadline(&tasks[i]) > tasks[i].period_us ||
+		   tasks[i].priority >= configMAX_PRIORITIES){
+			ESP_LOGE(TAG, "%s: invalid period, deadline or priority", tasks[i].name ? tasks[i].name : "?");
+			return false;
+		}
+	}
+	/* tasks to assign, by deadline (insertion sort, ties keep the table order) */
+	for(uint8_t i = 0; i < n; i++){
+		if(tasks[i].priority != 0){
+			continue;
+		}
+		for(k = m; k > 0 && Deadline(&tasks[order[k - 1]]) > Deadline(&tasks[i]); k--){
+			order[k] = order[k - 1];
+		}
+		order[k] = i;
+		m++;
+	}
+	level = highest;
+	for(k = 0; k < m; k++){
+		if(k > 0 && Deadline(&tasks[order[k]]) != last && level > lowest){
+			level--;
+		}
+		last = Deadline(&tasks[order[k]]);
+		tasks[order[k]].priority = level;
+	}
+	table = tasks;
+	table_n = n;
+
+	summary.n_tasks = n;
+	summary.misses = 0;
+	for(uint8_t i = 0; i < n; i++){
+		utilization += RtScheduleLoad(&tasks[i]);
+		tasks[i].response_us = ResponseTime(i);
+		if(tasks[i].response_us == RT_SCHEDULE_UNBOUNDED){
+			summary.misses++;
+			ESP_LOGW(TAG, "%s may miss its deadline of %lu us (priority %u)", tasks[i].name,
+					 Deadline(&tasks[i]), tasks[i].priority);
+		}
+	}
+	summary.utilization = (utilization > UINT16_MAX) ? UINT16_MAX : utilization;
+	summary.bound = (uint16_t)lroundf(1000.0f * n * (powf(2.0f, 1.0f / n) - 1.0f));
+	ESP_LOGI(TAG, "%u tasks, utilization %u.%u%% (bound %u.%u%%), %u deadlines at risk", n,
+			 summary.utilization / 10, summary.utilization % 10, summary.bound / 10, summary.bound % 10,
+			 summary.misses);
+	return summary.misses == 0;
+}
+
+uint8_t RtSchedulePriority(const char *name, uint8_t priority){
+	const rt_task_t *task = RtScheduleFind(name);
+
+	return (task != NULL) ? task->priority : priority;
+}
+
+const rt_task_t *RtScheduleFind(const char *name){
+	if(name == NULL){
+		return NULL;
+	}
+	for(uint8_t i = 0; i < table_n; i++){
+		/* FreeRTOS keeps configMAX_TASK_NAME_LEN - 1 characters of the name */
+		if(strncmp(table[i].name, name, configMAX_TASK_NAME_LEN - 1) == 0){
+			return &table[i];
+		}
+	}
+	return NULL;
+}
+
+uint16_t RtScheduleLoad(const rt_task_t *task){
+	return PERMILLE(task->wcet_us, task->period_us);
+}
+
+bool RtScheduleGetSummary(rt_schedule_summary_t *summary_p){
+	if(table == NULL){
+		return false;
+	}
+	*summary_p = summary;
+	return true;
+}
+
+void RtSchedulePrint(void){
+	uint16_t load;
+
+	if(table == NULL){
+		return;
+	}
+	printf("Task              Priority  Period us  Deadline us  WCET us  Load%%  Response us\r\n");
+	for(uint8_t i = 0; i < table_n; i++){
+		load = RtScheduleLoad(&table[i]);
+		if(table[i].response_us == RT_SCHEDULE_UNBOUNDED){
+			printf("%-16s %9u %10lu %12lu %8lu %4u.%u %12s\r\n", table[i].name, table[i].priority, table[i].period_us,
+				   Deadline(&table[i]), table[i].wcet_us, load / 10, load % 10, "missed");
+		} else{
+			printf("%-16s %9u %10lu %12lu %8lu %4u.%u %12lu\r\n", table[i].name, table[i].priority, table[i].period_us,
+				   Deadline(&table[i]), table[i].wcet_us, load / 10, load % 10, table[i].response_us);
+		}
+	}
+	printf("Utilization %u.%u%% (bound %u.%u%%), %u deadlines at risk\r\n", summary.utilization / 10,
+		   summary.utilization % 10, summary.bound / 10, summary.bound % 10, summary.misses);
+}
+
+/*==================[end of file]============================================*/
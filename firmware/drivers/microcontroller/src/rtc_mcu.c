@@ -12,7 +12,10 @@
 /*==================[inclusions]=============================================*/
 #include "rtc_mcu.h"
 #include <stdint.h>
+#include <time.h>
 #include "sys/time.h"
+#include "timestamp_mcu.h"
+#include "freertos/FreeRTOS.h"
 /*==================[macros and definitions]=================================*/
 
 /*==================[internal data declaration]==============================*/
@@ -20,6 +23,9 @@
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static time_t cached_sec = -1;          /*!< Second of the cached date and time */
+static rtc_t cached_rtc;
+static portMUX_TYPE cache_lock = portMUX_INITIALIZER_UNLOCKED;
 
 /*==================[external data definition]===============================*/
 
@@ -44,21 +50,40 @@ bool RtcConfig(rtc_t * rtc){
     time_t t = mktime(&tm);
     struct timeval now = { .tv_sec = t };
     settimeofday(&now, NULL);
+    TimestampSetEpoch((int64_t)t * 1000000);
+    portENTER_CRITICAL(&cache_lock);
+    cached_sec = -1;
+    portEXIT_CRITICAL(&cache_lock);
 
     return true;
 }
 
 void RtcRead(rtc_t * rtc){
-    time_t now;
+    time_t now = TimestampToEpochUs(TimestampUs()) / 1000000;
     struct tm timeinfo;
-    time(&now);
+    rtc_t fresh;
+
+    /* The calendar (localtime_r) is computed once per second */
+    portENTER_CRITICAL(&cache_lock);
+    if(now == cached_sec){
+        *rtc = cached_rtc;
+        portEXIT_CRITICAL(&cache_lock);
+        return;
+    }
+    portEXIT_CRITICAL(&cache_lock);
+
     localtime_r(&now, &timeinfo);
-    rtc->year = timeinfo.tm_year;
-    rtc->month = timeinfo.tm_mon;
-    rtc->mday = timeinfo.tm_mday;
-    rtc->wday = timeinfo.tm_wday;
-    rtc->hour = timeinfo.tm_hour;
-    rtc->min = timeinfo.tm_min;
-    rtc->sec = timeinfo.tm_sec;
+    fresh.year = timeinfo.tm_year;
+    fresh.month = timeinfo.tm_mon;
+    fresh.mday = timeinfo.tm_mday;
+    fresh.wday = timeinfo.tm_wday;
+    fresh.hour = timeinfo.tm_hour;
+    fresh.min = timeinfo.tm_min;
+    fresh.sec = timeinfo.tm_sec;
+    portENTER_CRITICAL(&cache_lock);
+    cached_sec = now;
+    cached_rtc = fresh;
+    portEXIT_CRITICAL(&cache_lock);
+    *rtc = fresh;
 }
 /*==================[end of file]============================================*/
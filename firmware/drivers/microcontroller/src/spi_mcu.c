@@ -14,7 +14,9 @@
 #include <stdint.h>
 #include <string.h>
 #include "driver/spi_master.h"
+#include "esp_timer.h"
 #include "gpio_mcu.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
 #define PIN_NUM_MOSI	GPIO_21	/*!<  */
@@ -22,6 +24,9 @@
 #define PIN_NUM_CS1		GPIO_19	/*!<  */
 #define PIN_NUM_CS2		GPIO_18	/*!<  */
 #define PIN_NUM_CS3		GPIO_9	/*!<  */
+#define SPI_N_DEVICES	3		/*!< Devices that share the SPI port */
+#define SPI_SMALL_SIZE	4		/*!< Transfers up to this size (bytes) are stored in the transaction (no DMA) */
+#define SPI_READ_MAX_BR	26000000	/*!< Fastest clock at which MISO is sampled correctly through the GPIO matrix */
 /*==================[internal data declaration]==============================*/
 spi_device_handle_t spi_1, spi_2, spi_3;
 const spi_bus_config_t bus_cfg = {
@@ -39,21 +44,150 @@ void (*spi_3_isr_p)(void*);	/*!<  */
 void *spi_1_user_data;	    /*!<  */
 void *spi_2_user_data;	    /*!<  */
 void *spi_3_user_data;	    /*!<  */
+/**
+ * @brief Transactions queued with SpiQueueWrite (one pool per device).
+ * Results are returned in order, so the slots are reused as a ring.
+ */
+typedef struct {
+    spi_transaction_t trans[SPI_QUEUE_SIZE];	/*!< Transactions pool */
+    uint8_t next;								/*!< Next free slot */
+    uint8_t pending;							/*!< Transactions queued and not yet finished */
+} spi_queue_t;
+static spi_queue_t spi_queue[SPI_N_DEVICES];
+/**
+ * @brief Statistics of a device
+ */
+typedef struct {
+    spi_stats_t stats;          /*!< Counters */
+    int64_t start;              /*!< Start of the transaction on the bus */
+    int64_t stats_start;        /*!< Start of the measurement period */
+} spi_counters_t;
+static spi_counters_t spi_counters[SPI_N_DEVICES];
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
 static void IRAM_ATTR spi_1_isr(spi_transaction_t *t){
+	TRACE_INSTANT(TRACE_SPI, SPI_1);
 	spi_1_isr_p(spi_1_user_data);
 }
 static void IRAM_ATTR spi_2_isr(spi_transaction_t *t){
+	TRACE_INSTANT(TRACE_SPI, SPI_2);
 	spi_2_isr_p(spi_2_user_data);
 }
 static void IRAM_ATTR spi_3_isr(spi_transaction_t *t){
+	TRACE_INSTANT(TRACE_SPI, SPI_3);
 	spi_3_isr_p(spi_3_user_data);
 }
+
+/* Bin of the bus time histogram: < 8 us, then one bin per power of two */
+static inline uint8_t IRAM_ATTR SpiTimeBin(uint32_t time_us){
+    uint8_t bin = (time_us < 8) ? 0 : 29 - __builtin_clz(time_us);
+    return (bin < SPI_TIME_BINS) ? bin : SPI_TIME_BINS - 1;
+}
+
+/* Start of every transaction (the device is in t->user) */
+static void IRAM_ATTR SpiPreCb(spi_transaction_t *t){
+    spi_counters[(uint32_t)t->user].start = esp_timer_get_time();
+}
+
+/* End of every transaction: counters, then the callback of the interrupt mode */
+static void IRAM_ATTR SpiPostCb(spi_transaction_t *t){
+    spi_dev_t device = (spi_dev_t)(uint32_t)t->user;
+    spi_counters_t *counters = &spi_counters[device];
+    uint32_t time_us = esp_timer_get_time() - counters->start;
+    uint32_t bytes = t->length / 8;
+
+    portENTER_CRITICAL_SAFE(&stats_lock);
+    counters->stats.transactions++;
+    counters->stats.commands += (bytes <= SPI_SMALL_SIZE);
+    counters->stats.bytes += bytes;
+    counters->stats.busy_us += time_us;
+    counters->stats.time[SpiTimeBin(time_us)]++;
+    portEXIT_CRITICAL_SAFE(&stats_lock);
+    switch(device){
+        case SPI_1:
+            if(transfer_mode_1 == SPI_INTERRUPT && spi_1_isr_p != NULL){
+                spi_1_isr(t);
+            }
+            break;
+        case SPI_2:
+            if(transfer_mode_2 == SPI_INTERRUPT && spi_2_isr_p != NULL){
+                spi_2_isr(t);
+            }
+            break;
+        case SPI_3:
+            if(transfer_mode_3 == SPI_INTERRUPT && spi_3_isr_p != NULL){
+                spi_3_isr(t);
+            }
+            break;
+    }
+}
+
+/* Time the caller waited since start */
+static void SpiBlocked(spi_dev_t device, int64_t start){
+    uint32_t blocked_us = esp_timer_get_time() - start;
+    portENTER_CRITICAL_SAFE(&stats_lock);
+    spi_counters[device].stats.blocked_us += blocked_us;
+    portEXIT_CRITICAL_SAFE(&stats_lock);
+}
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static spi_device_handle_t SpiHandle(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return spi_1;
+        case SPI_2:
+            return spi_2;
+        case SPI_3:
+        default:
+            return spi_3;
+    }
+}
+
+static transfer_mode_t SpiTransferMode(spi_dev_t device){
+    switch(device){
+        case SPI_1:
+            return transfer_mode_1;
+        case SPI_2:
+            return transfer_mode_2;
+        case SPI_3:
+        default:
+            return transfer_mode_3;
+    }
+}
+
+/* Write transaction. Up to SPI_SMALL_SIZE bytes are copied into the transaction
+ * itself (no DMA descriptor setup, and the caller's buffer can be reused at once) */
+static void SpiFillWrite(spi_transaction_t *t, const uint8_t * tx_buffer, uint32_t tx_buffer_size){
+    memset(t, 0, sizeof(spi_transaction_t));    // Zero out the transaction
+    t->length = tx_buffer_size * 8;             // tx_buffer_size is in bytes, transaction length is in bits.
+    if(tx_buffer_size <= SPI_SMALL_SIZE){
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, tx_buffer, tx_buffer_size);
+    } else {
+        t->tx_buffer = tx_buffer;               // Data
+    }
+}
+
+/* Blocking transmission, after the queued transactions of the device end */
+static void SpiTransmit(spi_dev_t device, spi_transaction_t *t){
+    int64_t start;
+
+    SpiWaitAll(device);
+    t->user = (void *)device;
+    start = esp_timer_get_time();
+    switch(SpiTransferMode(device)){
+        case SPI_POLLING:
+            spi_device_polling_transmit(SpiHandle(device), t);
+            break;
+        case SPI_INTERRUPT:
+            spi_device_transmit(SpiHandle(device), t);
+            break;
+    }
+    SpiBlocked(device, start);
+}
 
 /*==================[external functions definition]==========================*/
 uint8_t SpiInit(spi_mcu_config_t* spi){
@@ -65,35 +199,34 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 	spi_device_interface_config_t dev_cfg = {
         .clock_speed_hz = spi->bitrate,     	
         .mode = spi->clk_mode,                  
-        .queue_size = 8,                        
+        .queue_size = SPI_QUEUE_SIZE,
+        .pre_cb = SpiPreCb,
+        .post_cb = SpiPostCb,
     };
+    /* Faster devices are only written (reads would need a dummy cycle, not possible in full-duplex) */
+    if(spi->bitrate > SPI_READ_MAX_BR){
+        dev_cfg.flags = SPI_DEVICE_NO_DUMMY;
+    }
+    memset(&spi_counters[spi->device], 0, sizeof(spi_counters_t));
+    spi_counters[spi->device].stats_start = esp_timer_get_time();
     switch(spi->device){
         case SPI_1:
             dev_cfg.spics_io_num = PIN_NUM_CS1;
             transfer_mode_1 = spi->transfer_mode;
-            if(transfer_mode_1 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_1_isr;
-            } 
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_1);
             spi_1_isr_p = spi->func_p;
             spi_1_user_data = spi->param_p;
             break;
         case SPI_2:
             dev_cfg.spics_io_num = PIN_NUM_CS2;
-            if(transfer_mode_2 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_2_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_2 = spi->transfer_mode;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_2);
             spi_2_isr_p = spi->func_p;
             spi_2_user_data = spi->param_p;
             break;
         case SPI_3:
             dev_cfg.spics_io_num = PIN_NUM_CS3;
-            if(transfer_mode_3 == SPI_INTERRUPT){
-                dev_cfg.post_cb = spi_3_isr;
-            } 
-            transfer_mode_1 = spi->transfer_mode;
+            transfer_mode_3 = spi->transfer_mode;
             spi_bus_add_device(SPI2_HOST, &dev_cfg, &spi_3);
             spi_3_isr_p = spi->func_p;
             spi_3_user_data = spi->param_p;
@@ -107,119 +240,90 @@ void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
-    t.rx_buffer = rx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
+    if(rx_buffer_size <= SPI_SMALL_SIZE){
+        t.flags = SPI_TRANS_USE_RXDATA;
+    } else {
+        t.rx_buffer = rx_buffer;    // Data
+    }
+    SpiTransmit(device, &t);
+    if(t.flags & SPI_TRANS_USE_RXDATA){
+        memcpy(rx_buffer, t.rx_data, rx_buffer_size);
     }
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
-    memset(&t, 0, sizeof(t));       // Zero out the transaction
-    t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
-    t.tx_buffer = tx_buffer;        // Data
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
-    }
+    SpiFillWrite(&t, tx_buffer, tx_buffer_size);
+    SpiTransmit(device, &t);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
-    memset(&t, 0, sizeof(t));       // Zero out the transaction
-    t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
+    SpiFillWrite(&t, tx_buffer, buffer_size);
     t.rxlength = buffer_size * 8;
-    t.tx_buffer = tx_buffer;        // Data
-    t.rx_buffer = rx_buffer;        
-    switch(device){
-        case SPI_1:
-            switch(transfer_mode_1){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
-                    break;
-            }
-            break;
-        case SPI_2:
-            switch(transfer_mode_2){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
-                    break;
-            }
-            break;
-        case SPI_3:
-            switch(transfer_mode_3){
-                case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
-                    break;
-                case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
-                    break;
-            }
-            break;
+    if(buffer_size <= SPI_SMALL_SIZE){
+        t.flags |= SPI_TRANS_USE_RXDATA;
+    } else {
+        t.rx_buffer = rx_buffer;
+    }
+    SpiTransmit(device, &t);
+    if(t.flags & SPI_TRANS_USE_RXDATA){
+        memcpy(rx_buffer, t.rx_data, buffer_size);
+    }
+}
+
+bool SpiQueueWrite(spi_dev_t device, const uint8_t * tx_buffer, uint32_t tx_buffer_size){
+    spi_queue_t *queue = &spi_queue[device];
+    spi_transaction_t *t;
+
+    /* All slots in use: wait for the oldest transaction to free its slot */
+    if(queue->pending == SPI_QUEUE_SIZE){
+        SpiWait(device, SPI_QUEUE_SIZE - 1);
+    }
+    t = &queue->trans[queue->next];
+    SpiFillWrite(t, tx_buffer, tx_buffer_size);
+    t->user = (void *)device;
+    if(spi_device_queue_trans(SpiHandle(device), t, portMAX_DELAY) != ESP_OK){
+        return false;
+    }
+    queue->next = (queue->next + 1) % SPI_QUEUE_SIZE;
+    queue->pending++;
+    return true;
+}
+
+void SpiWait(spi_dev_t device, uint8_t max_pending){
+    spi_queue_t *queue = &spi_queue[device];
+    spi_transaction_t *t;
+    int64_t start;
+
+    if(queue->pending <= max_pending){
+        return;
+    }
+    start = esp_timer_get_time();
+    while(queue->pending > max_pending){
+        spi_device_get_trans_result(SpiHandle(device), &t, portMAX_DELAY);
+        queue->pending--;
+    }
+    SpiBlocked(device, start);
+}
+
+void SpiWaitAll(spi_dev_t device){
+    SpiWait(device, 0);
+}
+
+void SpiGetStats(spi_dev_t device, spi_stats_t *stats, bool reset){
+    spi_counters_t *counters = &spi_counters[device];
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&stats_lock);
+    *stats = counters->stats;
+    stats->period_us = now - counters->stats_start;
+    if(reset){
+        memset(&counters->stats, 0, sizeof(spi_stats_t));
+        counters->stats_start = now;
     }
+    portEXIT_CRITICAL(&stats_lock);
+    stats->load = (stats->period_us == 0) ? 0 : (uint16_t)((uint64_t)stats->busy_us * 1000 / stats->period_us);
 }
 
 uint8_t SpiDeInit(spi_dev_t device){
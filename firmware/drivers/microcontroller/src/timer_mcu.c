@@ -11,180 +11,326 @@
 
 /*==================[inclusions]=============================================*/
 #include "timer_mcu.h"
+#include <stddef.h>
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "trace_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define US_RESOLUTION_HZ	1000000	/*!< 1usec */
-#define RESET_COUNT_VALUE	0		/*!< Reset timer count to 0 */
+#define LEGACY_TIMERS		3		/*!< TIMER_A, TIMER_B and TIMER_C */
 /*==================[internal data declaration]==============================*/
-gptimer_handle_t timer_a = NULL;	/*!< Handle for timer A */	
-gptimer_handle_t timer_b = NULL;	/*!< Handle for timer B */			
-gptimer_handle_t timer_c = NULL;	/*!< Handle for timer C */	
+/**
+ * @brief Original timers, on top of the soft timers
+ */
+typedef struct {
+	soft_timer_t soft;			/*!< Periodic soft timer */
+	uint32_t period;			/*!< Period (in us) */
+	uint32_t elapsed;			/*!< Time counted when stopped (in us) */
+} legacy_timer_t;
+/*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR SoftTimerIsr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data);
+static void SoftTimerPower(void *param, uint32_t unused);
+/*==================[internal data definition]===============================*/
+static gptimer_handle_t shared_timer = NULL;	/*!< gptimer shared by all the soft timers */
+static soft_timer_t *timer_list = NULL;			/*!< Scheduled soft timers, sorted by deadline */
+static portMUX_TYPE timer_lock = portMUX_INITIALIZER_UNLOCKED;
+static legacy_timer_t legacy[LEGACY_TIMERS];
+static bool timer_running = false;				/*!< The counter runs (changed with timer_lock taken) */
+static bool timer_enabled = false;				/*!< The gptimer is enabled and holds its PM lock */
+static SemaphoreHandle_t timer_power = NULL;	/*!< Serializes SoftTimerPower */
+static StaticSemaphore_t timer_power_buffer;
 /**
  * @brief Configuration for the timer
  * 
  * @details The configuration for the timer specifies the clock source,
  *          count direction, and resolution in Hz.
  */
-const gptimer_config_t timer_config = {
+static const gptimer_config_t timer_config = {
     .clk_src = GPTIMER_CLK_SRC_DEFAULT,	/*!< Default clock source */
     .direction = GPTIMER_COUNT_UP,		/*!< Count up */
     .resolution_hz = US_RESOLUTION_HZ,	/*!< Resolution in Hz */
 };
-void (*timer_a_isr_p)(void*);	        /*!< Pointer to the ISR function for timer A */	
-void (*timer_b_isr_p)(void*);	        /*!< Pointer to the ISR function for timer B */	
-void (*timer_c_isr_p)(void*);	        /*!< Pointer to the ISR function for timer C */	
+/*==================[external data definition]===============================*/
 
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Create the shared gptimer (first soft timer initialized), it is
+ * enabled while some soft timer is active (see SoftTimerPower)
+ */
+static void SoftTimerServiceInit(void){
+	if(shared_timer != NULL){
+		return;
+	}
+	timer_power = xSemaphoreCreateMutexStatic(&timer_power_buffer);
+	gptimer_new_timer(&timer_config, &shared_timer);
+	gptimer_event_callbacks_t alarm = {
+		.on_alarm = SoftTimerIsr,
+	};
+	gptimer_register_event_callbacks(shared_timer, &alarm, NULL);
+}
 
-void *timer_a_user_data;	            /*!< User data for timer A */	
-void *timer_b_user_data;	            /*!< User data for timer B */	
-void *timer_c_user_data;	            /*!< User data for timer C */	
+/**
+ * @brief Enable and start the gptimer when some soft timer is active, stop and
+ * disable it when none is
+ *
+ * An enabled gptimer holds a PM lock that prevents light sleep, so it is only
+ * enabled while it is needed. gptimer_enable and gptimer_disable can't run in
+ * an interrupt: from interrupts (and from the callbacks) this function is
+ * pended to the FreeRTOS timer task. The count stands still while stopped, so
+ * the deadlines stay relative to it.
+ */
+static void SoftTimerPower(void *param, uint32_t unused){
+	bool needed;
 
-gptimer_alarm_config_t alarm_config_a;  /*!< Configuration for alarm A */
-gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
-gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
-/*==================[internal functions declaration]=========================*/
-static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_a_isr_p(timer_a_user_data);
-	return true;
+	xSemaphoreTake(timer_power, portMAX_DELAY);
+	portENTER_CRITICAL(&timer_lock);
+	needed = (timer_list != NULL);
+	if(!needed && timer_running){
+		gptimer_stop(shared_timer);
+		timer_running = false;
+	}
+	portEXIT_CRITICAL(&timer_lock);
+	if(needed && !timer_enabled){
+		gptimer_enable(shared_timer);
+		timer_enabled = true;
+	}else if(!needed && timer_enabled){
+		gptimer_disable(shared_timer);
+		timer_enabled = false;
+	}
+	if(needed){
+		portENTER_CRITICAL(&timer_lock);
+		if(!timer_running){
+			gptimer_start(shared_timer);
+			timer_running = true;
+		}
+		portEXIT_CRITICAL(&timer_lock);
+	}
+	xSemaphoreGive(timer_power);
 }
-static bool IRAM_ATTR timer_b_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_b_isr_p(timer_b_user_data);
-	return true;
+
+/**
+ * @brief Run SoftTimerPower now, or from the timer task in an interrupt
+ */
+static void IRAM_ATTR SoftTimerPowerRequest(void){
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	if(xPortInIsrContext()){
+		xTimerPendFunctionCallFromISR(SoftTimerPower, NULL, 0, &xHigherPriorityTaskWoken);
+		portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+	}else{
+		SoftTimerPower(NULL, 0);
+	}
 }
-static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
-	timer_c_isr_p(timer_c_user_data);
-	return true;
+
+static inline uint64_t IRAM_ATTR SoftTimerCount(void){
+	uint64_t count = 0;
+	gptimer_get_raw_count(shared_timer, &count);
+	return count;
 }
-/*==================[internal data definition]===============================*/
 
-/*==================[external data definition]===============================*/
+/**
+ * @brief Program the alarm at the nearest deadline (called with timer_lock taken)
+ */
+static void IRAM_ATTR SoftTimerArm(void){
+	if(timer_list == NULL){
+		gptimer_set_alarm_action(shared_timer, NULL);
+	}else{
+		gptimer_alarm_config_t alarm_config = {
+			.alarm_count = timer_list->deadline,
+		};
+		gptimer_set_alarm_action(shared_timer, &alarm_config);
+	}
+}
 
-/*==================[internal functions definition]==========================*/
+/**
+ * @brief Remove a soft timer from the list (called with timer_lock taken)
+ */
+static void IRAM_ATTR SoftTimerUnlink(soft_timer_t *soft_timer){
+	soft_timer_t **link = &timer_list;
+	while(*link != NULL){
+		if(*link == soft_timer){
+			*link = soft_timer->next;
+			break;
+		}
+		link = &(*link)->next;
+	}
+	soft_timer->active = false;
+}
+
+/**
+ * @brief Insert a soft timer sorted by deadline, after the ones with the same
+ * deadline (called with timer_lock taken)
+ */
+static void IRAM_ATTR SoftTimerLink(soft_timer_t *soft_timer){
+	soft_timer_t **link = &timer_list;
+	while(*link != NULL && (*link)->deadline <= soft_timer->deadline){
+		link = &(*link)->next;
+	}
+	soft_timer->next = *link;
+	*link = soft_timer;
+	soft_timer->active = true;
+}
 
+static bool IRAM_ATTR SoftTimerIsr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	uint64_t now = edata->count_value;
+	soft_timer_t *expired;
+
+	while(true){
+		portENTER_CRITICAL_ISR(&timer_lock);
+		expired = timer_list;
+		if(expired == NULL || expired->deadline > now){
+			SoftTimerArm();
+			portEXIT_CRITICAL_ISR(&timer_lock);
+			// deadlines reached in the meantime are served now, not in another interrupt
+			now = SoftTimerCount();
+			if(expired == NULL){
+				// no soft timer left: release the gptimer (and its PM lock)
+				SoftTimerPowerRequest();
+				break;
+			}
+			if(expired->deadline > now){
+				break;
+			}
+			continue;
+		}
+		timer_list = expired->next;
+		TRACE_BEGIN(TRACE_TIMER, (now - expired->deadline > UINT16_MAX) ? UINT16_MAX : now - expired->deadline);
+		if(expired->period){
+			// keep the phase, skipping the periods already lost
+			expired->deadline += expired->period;
+			if(expired->deadline <= now){
+				expired->deadline += ((now - expired->deadline) / expired->period + 1) * expired->period;
+			}
+			SoftTimerLink(expired);
+		}else{
+			expired->active = false;
+		}
+		portEXIT_CRITICAL_ISR(&timer_lock);
+		// outside the lock: the callback may start or stop soft timers
+		expired->func_p(expired->param_p);
+		TRACE_END(TRACE_TIMER, 0);
+	}
+	return true;
+}
 /*==================[external functions definition]==========================*/
-void TimerInit(timer_config_t *timer_ini){
-	switch(timer_ini->timer){
-	 	case TIMER_A:
-			timer_a_isr_p = timer_ini->func_p;
-			timer_a_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_a);
-			alarm_config_a.alarm_count = timer_ini->period; 
-			alarm_config_a.reload_count = RESET_COUNT_VALUE;
-			alarm_config_a.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_a, &alarm_config_a);
-			gptimer_event_callbacks_t alarm_a = {
-				.on_alarm = timer_a_isr,
-			};
-			gptimer_register_event_callbacks(timer_a, &alarm_a, NULL);
-			gptimer_enable(timer_a);
-	 	break;
-
-	 	case TIMER_B:
-			timer_b_isr_p = timer_ini->func_p;
-			timer_b_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_b);
-			alarm_config_b.alarm_count = timer_ini->period; 
-			alarm_config_b.reload_count = RESET_COUNT_VALUE;
-			alarm_config_b.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_b, &alarm_config_b);
-			gptimer_event_callbacks_t alarm_b = {
-				.on_alarm = timer_b_isr,
-			};
-			gptimer_register_event_callbacks(timer_b, &alarm_b, NULL);
-			gptimer_enable(timer_b);
-	 	break;
-
-	 	case TIMER_C:
-			timer_c_isr_p = timer_ini->func_p;
-			timer_c_user_data = timer_ini->param_p;
-	 		gptimer_new_timer(&timer_config, &timer_c);
-			alarm_config_c.alarm_count = timer_ini->period; 
-			alarm_config_c.reload_count = RESET_COUNT_VALUE;
-			alarm_config_c.flags.auto_reload_on_alarm = true;
-			gptimer_set_alarm_action(timer_c, &alarm_config_c);
-			gptimer_event_callbacks_t alarm_c = {
-				.on_alarm = timer_c_isr,
-			};
-			gptimer_register_event_callbacks(timer_c, &alarm_c, NULL);
-			gptimer_enable(timer_c);
-	 	break;
+void SoftTimerInit(soft_timer_t *soft_timer, void (*func_p)(void*), void *param_p){
+	SoftTimerServiceInit();
+	soft_timer->func_p = func_p;
+	soft_timer->param_p = param_p;
+	soft_timer->period = 0;
+	soft_timer->next = NULL;
+	soft_timer->active = false;
+}
+
+void IRAM_ATTR SoftTimerStart(soft_timer_t *soft_timer, uint32_t delay, uint32_t period){
+	bool stopped;
+
+	portENTER_CRITICAL_SAFE(&timer_lock);
+	if(soft_timer->active){
+		SoftTimerUnlink(soft_timer);
 	}
+	soft_timer->period = period;
+	soft_timer->deadline = SoftTimerCount() + delay;
+	SoftTimerLink(soft_timer);
+	if(timer_list == soft_timer){
+		SoftTimerArm();
+	}
+	stopped = !timer_running;
+	portEXIT_CRITICAL_SAFE(&timer_lock);
+	if(stopped){
+		SoftTimerPowerRequest();
+	}
+}
+
+void IRAM_ATTR SoftTimerStop(soft_timer_t *soft_timer){
+	bool idle = false;
+
+	portENTER_CRITICAL_SAFE(&timer_lock);
+	if(soft_timer->active){
+		bool head = (timer_list == soft_timer);
+		SoftTimerUnlink(soft_timer);
+		if(head){
+			SoftTimerArm();
+		}
+		idle = (timer_list == NULL);
+	}
+	portEXIT_CRITICAL_SAFE(&timer_lock);
+	if(idle){
+		SoftTimerPowerRequest();
+	}
+}
+
+uint32_t IRAM_ATTR SoftTimerRemaining(soft_timer_t *soft_timer){
+	uint32_t remaining = 0;
+	portENTER_CRITICAL_SAFE(&timer_lock);
+	if(soft_timer->active){
+		uint64_t now = SoftTimerCount();
+		if(soft_timer->deadline > now){
+			remaining = soft_timer->deadline - now;
+		}
+	}
+	portEXIT_CRITICAL_SAFE(&timer_lock);
+	return remaining;
+}
+
+uint64_t IRAM_ATTR SoftTimerNow(void){
+	return (shared_timer == NULL) ? 0 : SoftTimerCount();
+}
+
+void TimerInit(timer_config_t *timer_ini){
+	legacy_timer_t *t = &legacy[timer_ini->timer];
+	SoftTimerInit(&t->soft, timer_ini->func_p, timer_ini->param_p);
+	t->period = timer_ini->period;
+	t->elapsed = 0;
 }
 
 void TimerStart(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_start(timer_a);
-		break;
-	 	case TIMER_B:
-	 		gptimer_start(timer_b);
-		break;
-	 	case TIMER_C:
-	 		gptimer_start(timer_c);
-		break;
+	legacy_timer_t *t = &legacy[timer];
+	if(!t->soft.active){
+		// resume from the count kept by TimerStop
+		SoftTimerStart(&t->soft, t->period - t->elapsed, t->period);
 	}
 }
 
 uint32_t TimerRead(timer_mcu_t timer){
-	uint64_t raw_count = 0;
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_get_raw_count(timer_a, &raw_count);
-	 	break;
-	 	case TIMER_B:
-	 		gptimer_get_raw_count(timer_b, &raw_count);
-	 	break;
-	 	case TIMER_C:
-	 		gptimer_get_raw_count(timer_c, &raw_count);
-	 	break;
+	legacy_timer_t *t = &legacy[timer];
+	if(!t->soft.active){
+		return t->elapsed;
 	}
-	return raw_count;
+	return t->period - SoftTimerRemaining(&t->soft);
 }
 
 void TimerStop(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-	 		gptimer_stop(timer_a);
-	 	break;
-	 	case TIMER_B:
-	 		gptimer_stop(timer_b);
-	 	break;
-	 	case TIMER_C:
-	 		gptimer_stop(timer_c);
-	 	break;
+	legacy_timer_t *t = &legacy[timer];
+	if(t->soft.active){
+		t->elapsed = TimerRead(timer);
+		SoftTimerStop(&t->soft);
 	}
 }
 
 void TimerReset(timer_mcu_t timer){
-	switch(timer){
-	 	case TIMER_A:
-			gptimer_set_raw_count(timer_a, RESET_COUNT_VALUE);
-	 	break;
-	 	case TIMER_B:
-			gptimer_set_raw_count(timer_b, RESET_COUNT_VALUE);
-	 	break;
-	 	case TIMER_C:
-			gptimer_set_raw_count(timer_c, RESET_COUNT_VALUE);
-	 	break;
+	legacy_timer_t *t = &legacy[timer];
+	t->elapsed = 0;
+	if(t->soft.active){
+		SoftTimerStart(&t->soft, t->period, t->period);
 	}
 }
 
 void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
-	switch(timer){
-	 	case TIMER_A:
-			alarm_config_a.alarm_count = period;
-			gptimer_set_alarm_action(timer_a, &alarm_config_a);
-	 	break;
-	 	case TIMER_B:
-			alarm_config_b.alarm_count = period;
-			gptimer_set_alarm_action(timer_b, &alarm_config_b);
-	 	break;
-	 	case TIMER_C:
-			alarm_config_c.alarm_count = period;
-			gptimer_set_alarm_action(timer_c, &alarm_config_c);
-	 	break;
+	legacy_timer_t *t = &legacy[timer];
+	uint32_t elapsed = TimerRead(timer);
+	t->period = period;
+	if(elapsed > period){
+		elapsed = period;
+	}
+	if(t->soft.active){
+		// the count goes on: the next alarm is the new period after the last one
+		SoftTimerStart(&t->soft, period - elapsed, period);
+	}else{
+		t->elapsed = elapsed;
 	}
 }
 
@@ -0,0 +1,129 @@
+/**
+ * @file timestamp_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief 
+ * @version 0.1
+ * @date 2026-10-15
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "timestamp_mcu.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+/*==================[macros and definitions]=================================*/
+#define PPB     1000000000LL
+/*==================[internal data declaration]==============================*/
+/** Sync time as a line from the last estimate: sync = base_sync + dt + dt * rate, plus the slew */
+typedef struct {
+    int64_t base_us;            /*!< Local time of the last estimate */
+    int64_t base_sync_us;       /*!< Sync time at base_us */
+    int32_t rate_ppb;           /*!< Drift of the sync time */
+    int32_t slew_ppb;           /*!< Extra rate during TIMESTAMP_SLEW_US after base_us */
+} sync_line_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static int64_t epoch_offset_us = 0;     /*!< Wall clock minus monotonic time */
+static bool epoch_valid = false;
+static portMUX_TYPE epoch_lock = portMUX_INITIALIZER_UNLOCKED;   /*!< 64 bit offset, two words on RISC-V */
+static sync_line_t sync_line = {0, 0, 0, 0};
+static bool sync_valid = false;
+static portMUX_TYPE sync_lock = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static int64_t sync_from_line(const sync_line_t *line, int64_t timestamp_us){
+    int64_t dt = timestamp_us - line->base_us;
+    int64_t slewed = (dt < 0) ? 0 : (dt < TIMESTAMP_SLEW_US) ? dt : TIMESTAMP_SLEW_US;
+
+    return line->base_sync_us + dt + dt * line->rate_ppb / PPB + slewed * line->slew_ppb / PPB;
+}
+
+static int32_t sync_clamp(int64_t ppb){
+    return (ppb > TIMESTAMP_RATE_MAX_PPB) ? TIMESTAMP_RATE_MAX_PPB :
+           (ppb < -TIMESTAMP_RATE_MAX_PPB) ? -TIMESTAMP_RATE_MAX_PPB : (int32_t)ppb;
+}
+
+/*==================[external functions definition]==========================*/
+int64_t TimestampUs(void){
+    return esp_timer_get_time();
+}
+
+uint32_t TimestampMs(void){
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void TimestampSetEpoch(int64_t epoch_us){
+    int64_t offset = epoch_us - esp_timer_get_time();
+
+    portENTER_CRITICAL_SAFE(&epoch_lock);
+    epoch_offset_us = offset;
+    epoch_valid = true;
+    portEXIT_CRITICAL_SAFE(&epoch_lock);
+}
+
+bool TimestampEpochValid(void){
+    return epoch_valid;
+}
+
+int64_t TimestampToEpochUs(int64_t timestamp_us){
+    int64_t offset;
+
+    portENTER_CRITICAL_SAFE(&epoch_lock);
+    offset = epoch_offset_us;
+    portEXIT_CRITICAL_SAFE(&epoch_lock);
+    return timestamp_us + offset;
+}
+
+void TimestampSyncAdjust(int64_t timestamp_us, int64_t offset_us, int32_t drift_ppb){
+    sync_line_t line;
+    int64_t now = esp_timer_get_time();
+    int64_t target, error;
+
+    drift_ppb = sync_clamp(drift_ppb);
+    /* the estimate, carried from the measurement to now */
+    target = now + offset_us + (now - timestamp_us) * drift_ppb / PPB;
+    portENTER_CRITICAL_SAFE(&sync_lock);
+    line = sync_line;
+    portEXIT_CRITICAL_SAFE(&sync_lock);
+    error = target - sync_from_line(&line, now);
+    line.base_us = now;
+    line.rate_ppb = drift_ppb;
+    if(!sync_valid || error > TIMESTAMP_STEP_US || error < -TIMESTAMP_STEP_US){
+        line.base_sync_us = target;
+        line.slew_ppb = 0;
+    }else{
+        /* continuous at now, the error corrected over the slew time */
+        line.base_sync_us = target - error;
+        line.slew_ppb = sync_clamp(drift_ppb + error * PPB / TIMESTAMP_SLEW_US) - drift_ppb;
+    }
+    portENTER_CRITICAL_SAFE(&sync_lock);
+    sync_line = line;
+    sync_valid = true;
+    portEXIT_CRITICAL_SAFE(&sync_lock);
+}
+
+bool TimestampSyncValid(void){
+    return sync_valid;
+}
+
+int64_t TimestampToSyncUs(int64_t timestamp_us){
+    sync_line_t line;
+
+    if(!sync_valid){
+        return timestamp_us;
+    }
+    portENTER_CRITICAL_SAFE(&sync_lock);
+    line = sync_line;
+    portEXIT_CRITICAL_SAFE(&sync_lock);
+    return sync_from_line(&line, timestamp_us);
+}
+
+int64_t TimestampSyncUs(void){
+    return TimestampToSyncUs(esp_timer_get_time());
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,131 @@
+/**
+ * @file trace_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "trace_mcu.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_rom_sys.h"
+/*==================[macros and definitions]=================================*/
+#define TRACE_MASK		(CONFIG_DRIVERS_TRACE_EVENTS - 1)
+#define TRACE_IDS		256
+
+_Static_assert((CONFIG_DRIVERS_TRACE_EVENTS & TRACE_MASK) == 0, "CONFIG_DRIVERS_TRACE_EVENTS must be a power of two");
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const char *trace_names[TRACE_IDS] = {
+	[TRACE_TIMER] = "timer",
+	[TRACE_GPIO] = "gpio",
+	[TRACE_SPI] = "spi",
+	[TRACE_ADC] = "adc",
+	[TRACE_AUDIO] = "audio",
+};
+static const char trace_phases[] = {'i', 'B', 'E'};
+/*==================[external data definition]===============================*/
+trace_event_t trace_events[CONFIG_DRIVERS_TRACE_EVENTS];
+uint32_t trace_head = 0;				/*!< Events recorded since TraceStart (the slot is head & TRACE_MASK) */
+volatile bool trace_enabled = true;
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Number of the oldest event still in the ring
+ */
+static uint32_t TraceFirst(void){
+	return (trace_head > CONFIG_DRIVERS_TRACE_EVENTS) ? trace_head - CONFIG_DRIVERS_TRACE_EVENTS : 0;
+}
+/*==================[external functions definition]==========================*/
+void TraceName(uint8_t id, const char *name){
+	trace_names[id] = name;
+}
+
+void TraceStart(void){
+	trace_enabled = false;
+	trace_head = 0;
+	memset(trace_events, 0, sizeof(trace_events));
+	trace_enabled = true;
+}
+
+void TraceStop(void){
+	trace_enabled = false;
+}
+
+bool TraceLatency(uint8_t from, uint8_t to, uint32_t deadline_ns, trace_latency_t *stats){
+	uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+	uint64_t sum = 0;
+	uint32_t start = 0, ns;
+	bool started = false;
+
+	memset(stats, 0, sizeof(trace_latency_t));
+	stats->min_ns = UINT32_MAX;
+	for(uint32_t i = TraceFirst(); i < trace_head; i++){
+		const trace_event_t *event = &trace_events[i & TRACE_MASK];
+		if(event->id == to && started){
+			int32_t cycles = (int32_t)(event->cycles - start);
+			// an interrupt between the slot reservation and the time stamp can swap two events
+			if(cycles >= 0){
+				ns = (uint32_t)(((uint64_t)cycles * 1000) / ticks_per_us);
+				sum += ns;
+				stats->count++;
+				stats->min_ns = (ns < stats->min_ns) ? ns : stats->min_ns;
+				stats->max_ns = (ns > stats->max_ns) ? ns : stats->max_ns;
+				stats->over += (ns > deadline_ns);
+			}
+			started = (from == to);
+		}
+		if(event->id == from){
+			start = event->cycles;
+			started = true;
+		}
+	}
+	if(stats->count == 0){
+		stats->min_ns = 0;
+		return false;
+	}
+	stats->mean_ns = sum / stats->count;
+	return true;
+}
+
+void TraceDump(void){
+	uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+	uint32_t first = TraceFirst(), last = 0;
+	int64_t cycles = 0;
+	uint64_t ts;
+	bool used[TRACE_IDS] = {false};
+
+	TraceStop();
+	printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	for(uint32_t i = first; i < trace_head; i++){
+		const trace_event_t *event = &trace_events[i & TRACE_MASK];
+		// 64 bit time from the oldest event, the counter wraps every 2^32 cycles
+		if(i != first){
+			cycles += (int32_t)(event->cycles - last);
+		}
+		last = event->cycles;
+		ts = (cycles > 0) ? cycles : 0;
+		used[event->id] = true;
+		printf("{\"name\":\"%s\",\"ph\":\"%c\",\"s\":\"t\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%u,\"args\":{\"arg\":%u,\"isr\":%u}},\n",
+			   trace_names[event->id] ? trace_names[event->id] : "event", trace_phases[event->flags & 0x03],
+			   ts / ticks_per_us, (ts % ticks_per_us) * 1000 / ticks_per_us,
+			   event->id, event->arg, (event->flags & TRACE_FLAG_ISR) ? 1 : 0);
+	}
+	// track names, then the process name closes the list (no trailing comma)
+	for(uint16_t id = 0; id < TRACE_IDS; id++){
+		if(used[id]){
+			printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}},\n",
+				   id, trace_names[id] ? trace_names[id] : "event");
+		}
+	}
+	printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"ESP-EDU\"}}\n]}\n");
+}
+
+/*==================[end of file]============================================*/
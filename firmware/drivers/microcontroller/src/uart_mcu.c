@@ -12,10 +12,13 @@
 /*==================[inclusions]=============================================*/
 #include "uart_mcu.h"
 #include "gpio_mcu.h"
+#include "rtos_alloc_mcu.h"
 #include "driver/uart.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/task.h"
 #include "esp_log.h"
+#include <string.h>
 /*==================[macros and definitions]=================================*/
 #define UART_CONN_TX        GPIO_18         /*!<  */
 #define UART_CONN_RX        GPIO_19         /*!<  */
@@ -23,6 +26,11 @@
 #define RX_BUFFER_SIZE      256             /*!<  */
 #define EVENT_QUEUE_SIZE    16              /*!<  */
 #define READ_TIMEOUT        100             /*!<  */
+#define STREAM_RX_RING      8192            /*!< Default RX ring of the streaming mode */
+#define STREAM_TX_RING      4096            /*!< TX ring of the streaming mode */
+#define STREAM_RX_THRESHOLD 64              /*!< RX FIFO bytes before moving them to the ring */
+#define STREAM_READ_WAIT    10              /*!< Wait for more data before handing a raw chunk (ms) */
+#define EVENT_TASK_STACK    2048            /*!< Stack of the event and stream tasks (bytes) */
 /*==================[internal data declaration]==============================*/
 void (*uart_pc_isr_p)(void*);	            /*!<  */
 void (*uart_conn_isr_p)(void*);	            /*!<  */
@@ -30,6 +38,32 @@ void *uart_pc_user_data;	                /*!<  */
 void *uart_conn_user_data;	                /*!<  */
 static QueueHandle_t uart_pc_queue;         /*!<  */
 static QueueHandle_t uart_conn_queue;       /*!<  */
+
+typedef struct {
+    uint8_t chunk;                          /*!< Chunk index */
+    uint16_t length;                        /*!< Bytes of the record */
+} stream_record_t;
+
+typedef struct {
+    uart_port_t uart_num;
+    uart_stream_mode_t mode;
+    uint8_t delimiter;
+    uint16_t frame_length;
+    uart_stream_cb_t callback;
+    void *param;
+    QueueHandle_t free_queue;               /*!< Chunks available to the stream task */
+    QueueHandle_t ready_queue;              /*!< Records waiting to be borrowed */
+    uint8_t chunks[UART_STREAM_CHUNKS][UART_STREAM_CHUNK_SIZE];
+} uart_stream_t;
+static uart_stream_t streams[2];            /*!< Streaming state of UART_PC and UART_CONNECTOR */
+TASK_STORAGE_DEFINE(pc_event_storage, EVENT_TASK_STACK);
+TASK_STORAGE_DEFINE(conn_event_storage, EVENT_TASK_STACK);
+TASK_STORAGE_DEFINE(pc_stream_storage, EVENT_TASK_STACK);
+TASK_STORAGE_DEFINE(conn_stream_storage, EVENT_TASK_STACK);
+QUEUE_STORAGE_DEFINE(pc_free_storage, UART_STREAM_CHUNKS, sizeof(uint8_t));
+QUEUE_STORAGE_DEFINE(conn_free_storage, UART_STREAM_CHUNKS, sizeof(uint8_t));
+QUEUE_STORAGE_DEFINE(pc_ready_storage, UART_STREAM_CHUNKS, sizeof(stream_record_t));
+QUEUE_STORAGE_DEFINE(conn_ready_storage, UART_STREAM_CHUNKS, sizeof(stream_record_t));
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -102,6 +136,75 @@ static void uart_conn_event_task(void *pvParameters){
         }
     }
 }
+static uint8_t uart_stream_take(uart_stream_t *stream){
+    uint8_t chunk;
+    xQueueReceive(stream->free_queue, &chunk, portMAX_DELAY);
+    return chunk;
+}
+
+static void uart_stream_publish(uart_stream_t *stream, uint8_t chunk, uint16_t length){
+    stream_record_t record = {chunk, length};
+    if(stream->callback != NULL){
+        stream->callback(stream->chunks[chunk], length, stream->param);
+        xQueueSend(stream->free_queue, &chunk, 0);
+    }else{
+        xQueueSend(stream->ready_queue, &record, portMAX_DELAY);
+    }
+}
+
+/* The driver ring is read in chunks straight into the record buffers: raw
+ * mode hands each chunk as read, delimited modes split it in records and
+ * move only the bytes after the end of a record to the next chunk. */
+static void uart_stream_task(void *pvParameters){
+    uart_stream_t *stream = pvParameters;
+    uint8_t cur = uart_stream_take(stream), next;
+    uint16_t fill = 0, pos, rest;
+    int n;
+    bool end;
+    while(1){
+        n = uart_read_bytes(stream->uart_num, &stream->chunks[cur][fill], UART_STREAM_CHUNK_SIZE - fill,
+            pdMS_TO_TICKS(STREAM_READ_WAIT));
+        if(n <= 0){
+            continue;
+        }
+        if(stream->mode == UART_STREAM_RAW){
+            uart_stream_publish(stream, cur, n);
+            cur = uart_stream_take(stream);
+            continue;
+        }
+        pos = fill;
+        fill += n;
+        while(pos < fill){
+            if(stream->mode == UART_STREAM_LINE){
+                end = (stream->chunks[cur][pos] == stream->delimiter);
+            }else{
+                end = (pos + 1 == stream->frame_length);
+            }
+            if(!end){
+                pos++;
+                continue;
+            }
+            rest = fill - (pos + 1);
+            if(stream->mode == UART_STREAM_LINE && pos == 0){
+                // empty line: drop the delimiter
+                memmove(stream->chunks[cur], &stream->chunks[cur][1], rest);
+            }else{
+                next = uart_stream_take(stream);
+                memcpy(stream->chunks[next], &stream->chunks[cur][pos + 1], rest);
+                uart_stream_publish(stream, cur, (stream->mode == UART_STREAM_LINE) ? pos : pos + 1);
+                cur = next;
+            }
+            fill = rest;
+            pos = 0;
+        }
+        if(fill == UART_STREAM_CHUNK_SIZE){
+            // line longer than a chunk: handed in pieces
+            uart_stream_publish(stream, cur, fill);
+            cur = uart_stream_take(stream);
+            fill = 0;
+        }
+    }
+}
 /*==================[external functions definition]==========================*/
 
 void UartInit(serial_config_t *port_config){
@@ -120,7 +223,7 @@ void UartInit(serial_config_t *port_config){
             if(port_config->func_p != UART_NO_INT){
                 uart_pc_isr_p = port_config->func_p;
                 uart_pc_queue = port_config->param_p;
-                xTaskCreate(uart_pc_event_task, "uart_pc_event_task", 2048, NULL, 12, 0);
+                TaskCreateStored(&pc_event_storage, uart_pc_event_task, "uart_pc_event_task", NULL, 12, NULL);
             }else{
                 uart_driver_install(UART_NUM_0, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
             }
@@ -131,7 +234,7 @@ void UartInit(serial_config_t *port_config){
             if(port_config->func_p != UART_NO_INT){
                 uart_conn_isr_p = port_config->func_p;
                 uart_conn_queue = port_config->param_p;
-                xTaskCreate(uart_conn_event_task, "uart_conn_event_task", 2048, NULL, 12, NULL);
+                TaskCreateStored(&conn_event_storage, uart_conn_event_task, "uart_conn_event_task", NULL, 12, NULL);
             }else{
                 uart_driver_install(UART_NUM_1, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0);
             }
@@ -206,7 +309,7 @@ void UartSendString(uart_mcu_port_t port, const char *msg){
 	}
 }
 
-void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes){
     uart_port_t uart_num = UART_NUM_0;
     switch(port){
         case UART_PC:
@@ -219,6 +322,80 @@ void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
     uart_tx_chars(uart_num, data, nbytes);
 }
 
+bool UartStreamInit(serial_stream_config_t *stream_config){
+    uart_stream_t *stream = &streams[stream_config->port];
+    uart_port_t uart_num = (stream_config->port == UART_PC) ? UART_NUM_0 : UART_NUM_1;
+    uint32_t rx_ring = (stream_config->rx_ring != 0) ? stream_config->rx_ring : STREAM_RX_RING;
+    uart_config_t uart_config = {
+        .baud_rate = stream_config->baud_rate,
+        .data_bits = UART_DATA_8_BITS,
+        .parity = UART_PARITY_DISABLE,
+        .stop_bits = UART_STOP_BITS_1,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_DEFAULT,
+    };
+    if(stream->free_queue != NULL){
+        return false;
+    }
+    uart_param_config(uart_num, &uart_config);
+    if(stream_config->port == UART_PC){
+        uart_set_pin(uart_num, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    }else{
+        uart_set_pin(uart_num, UART_CONN_TX, UART_CONN_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    }
+    if(uart_driver_install(uart_num, rx_ring, STREAM_TX_RING, 0, NULL, 0) != ESP_OK){
+        return false;
+    }
+    uart_set_rx_full_threshold(uart_num, STREAM_RX_THRESHOLD);
+
+    stream->uart_num = uart_num;
+    stream->mode = stream_config->mode;
+    stream->delimiter = stream_config->delimiter;
+    stream->frame_length = stream_config->frame_length;
+    if(stream->frame_length == 0 || stream->frame_length > UART_STREAM_CHUNK_SIZE){
+        stream->frame_length = UART_STREAM_CHUNK_SIZE;
+    }
+    stream->callback = stream_config->func_p;
+    stream->param = stream_config->param_p;
+    if(stream_config->port == UART_PC){
+        stream->free_queue = QueueCreateStored(&pc_free_storage);
+        stream->ready_queue = QueueCreateStored(&pc_ready_storage);
+    }else{
+        stream->free_queue = QueueCreateStored(&conn_free_storage);
+        stream->ready_queue = QueueCreateStored(&conn_ready_storage);
+    }
+    for(uint8_t i = 0; i < UART_STREAM_CHUNKS; i++){
+        xQueueSend(stream->free_queue, &i, 0);
+    }
+    TaskCreateStored((stream_config->port == UART_PC) ? &pc_stream_storage : &conn_stream_storage,
+                     uart_stream_task, "uart_stream_task", stream, 12, NULL);
+    return true;
+}
+
+uint16_t UartStreamBorrow(uart_mcu_port_t port, const uint8_t **data, uint32_t timeout_ms){
+    stream_record_t record;
+    if(streams[port].ready_queue == NULL ||
+        xQueueReceive(streams[port].ready_queue, &record, pdMS_TO_TICKS(timeout_ms)) != pdTRUE){
+        *data = NULL;
+        return 0;
+    }
+    *data = streams[port].chunks[record.chunk];
+    return record.length;
+}
+
+void UartStreamRelease(uart_mcu_port_t port, const uint8_t *data){
+    uint8_t chunk;
+    if(data != NULL){
+        chunk = (data - streams[port].chunks[0]) / UART_STREAM_CHUNK_SIZE;
+        xQueueSend(streams[port].free_queue, &chunk, 0);
+    }
+}
+
+uint16_t UartStreamWrite(uart_mcu_port_t port, const uint8_t *data, uint16_t nbytes){
+    int sent = uart_write_bytes((port == UART_PC) ? UART_NUM_0 : UART_NUM_1, data, nbytes);
+    return (sent < 0) ? 0 : sent;
+}
+
 uint8_t* UartItoa(uint32_t val, uint8_t base){
 	static uint8_t buf[32] = {0};
 	uint32_t i = 30;
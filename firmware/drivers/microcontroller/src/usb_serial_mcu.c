@@ -0,0 +1,64 @@
+/**
+ * @file usb_serial_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "usb_serial_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "driver/usb_serial_jtag.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static bool installed = false;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool UsbSerialInit(uint32_t tx_ring, uint32_t rx_ring){
+	usb_serial_jtag_driver_config_t config = {
+		.tx_buffer_size = (tx_ring == 0) ? USB_SERIAL_TX_RING : tx_ring,
+		.rx_buffer_size = (rx_ring == 0) ? USB_SERIAL_RX_RING : rx_ring,
+	};
+
+	if(installed){
+		return true;
+	}
+	installed = (usb_serial_jtag_driver_install(&config) == ESP_OK);
+	return installed;
+}
+
+bool UsbSerialConnected(void){
+	return usb_serial_jtag_is_connected();
+}
+
+uint32_t UsbSerialWrite(const uint8_t *data, uint32_t nbytes){
+	// without a host the packets would only fill the ring
+	if(!installed || !usb_serial_jtag_is_connected()){
+		return 0;
+	}
+	return (usb_serial_jtag_write_bytes(data, nbytes, 0) == (int)nbytes) ? nbytes : 0;
+}
+
+uint32_t UsbSerialRead(uint8_t *data, uint32_t nbytes, uint32_t timeout_ms){
+	int n;
+
+	if(!installed){
+		return 0;
+	}
+	n = usb_serial_jtag_read_bytes(data, nbytes, pdMS_TO_TICKS(timeout_ms));
+	return (n > 0) ? n : 0;
+}
+
+/*==================[end of file]============================================*/
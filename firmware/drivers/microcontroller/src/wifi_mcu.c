@@ -0,0 +1,202 @@
+/**
+ * @file wifi_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "wifi_mcu.h"
+#include "esp_wifi.h"
+#include "esp_wifi_he.h"
+#include "esp_netif.h"
+#include "esp_event.h"
+#include "esp_mac.h"
+#include "nvs_flash.h"
+#include "lwip/sockets.h"
+/*==================[macros and definitions]=================================*/
+#define WIFI_BEACON_MS			102		/* Usual beacon interval (100 TU) */
+#define WIFI_LISTEN_MAX			50		/* Beacons skipped at most in modem sleep (about 5 s) */
+#define WIFI_TWT_TIMEOUT_MS		5000	/* Wait for the answer of the access point */
+#define WIFI_TWT_DURA_UNIT_US	256		/* Unit of min_wake_dura with wake_duration_unit 0 */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static volatile wifi_status_t wifi_status = WIFI_OFF;
+static uint32_t wifi_wake_interval_ms = 0;
+static int wifi_socket = -1;
+static struct sockaddr_in wifi_server;
+static bool wifi_server_set = false;
+static wifi_stats_t wifi_stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Asks the access point for an individual TWT agreement: wake interval
+ * = mantissa * 2^exponent us, the mantissa in 16 bits
+ */
+static void wifi_twt_request(void){
+	uint32_t interval_us = wifi_wake_interval_ms * 1000;
+	uint8_t exponent = 0;
+	wifi_itwt_setup_config_t setup = {
+		.setup_cmd = TWT_REQUEST,
+		.trigger = 1,
+		.flow_type = 0,			/* announced: the station tells when it is awake */
+		.flow_id = 0,
+		.twt_id = 0,
+		.wake_duration_unit = 0,
+		.min_wake_dura = (WIFI_TWT_WAKE_MS * 1000) / WIFI_TWT_DURA_UNIT_US,
+		.timeout_time_ms = WIFI_TWT_TIMEOUT_MS,
+	};
+
+	while(interval_us > UINT16_MAX){
+		interval_us >>= 1;
+		exponent++;
+	}
+	setup.wake_invl_expn = exponent;
+	setup.wake_invl_mant = interval_us;
+	if(esp_wifi_sta_itwt_setup(&setup) != ESP_OK){
+		/* the access point is not Wi-Fi 6: sleep between beacons instead */
+		esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+	}
+}
+
+static void wifi_event_handler(void *arg, esp_event_base_t base, int32_t id, void *data){
+	if(base == IP_EVENT && id == IP_EVENT_STA_GOT_IP){
+		wifi_status = WIFI_CONNECTED;
+		if(wifi_wake_interval_ms > 0){
+			wifi_twt_request();
+		}
+		return;
+	}
+	switch(id){
+		case WIFI_EVENT_STA_START:
+			esp_wifi_connect();
+			break;
+		case WIFI_EVENT_STA_DISCONNECTED:
+			if(wifi_status == WIFI_CONNECTED){
+				wifi_stats.reconnections++;
+			}
+			wifi_status = WIFI_CONNECTING;
+			wifi_stats.twt = false;
+			wifi_stats.wake_interval_us = 0;
+			if(wifi_wake_interval_ms > 0){
+				/* back to the mode that accepts a new agreement */
+				esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+			}
+			esp_wifi_connect();
+			break;
+		case WIFI_EVENT_ITWT_SETUP:{
+			wifi_event_sta_itwt_setup_t *setup = data;
+			if(setup->status == ITWT_SETUP_SUCCESS){
+				wifi_stats.twt = true;
+				wifi_stats.wake_interval_us = (uint32_t)setup->config.wake_invl_mant << setup->config.wake_invl_expn;
+			}else{
+				esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+			}
+			break;
+		}
+		case WIFI_EVENT_ITWT_TEARDOWN:
+			wifi_stats.twt = false;
+			wifi_stats.wake_interval_us = 0;
+			esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+			break;
+		default:
+			break;
+	}
+}
+/*==================[external functions definition]==========================*/
+bool WifiInit(const wifi_mcu_config_t *config){
+	wifi_init_config_t init = WIFI_INIT_CONFIG_DEFAULT();
+	wifi_config_t station = {0};
+	uint32_t listen;
+	esp_err_t ret;
+
+	if(wifi_status != WIFI_OFF){
+		return false;
+	}
+	ret = nvs_flash_init();
+	if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		ret = nvs_flash_init();
+	}
+	ESP_ERROR_CHECK(ret);
+	ESP_ERROR_CHECK(esp_netif_init());
+	ret = esp_event_loop_create_default();
+	if(ret != ESP_OK && ret != ESP_ERR_INVALID_STATE){	/* the default loop may already exist */
+		return false;
+	}
+	esp_netif_create_default_wifi_sta();
+	if(esp_wifi_init(&init) != ESP_OK){
+		return false;
+	}
+	esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_event_handler, NULL, NULL);
+	esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, wifi_event_handler, NULL, NULL);
+
+	strlcpy((char *)station.sta.ssid, config->ssid, sizeof(station.sta.ssid));
+	if(config->password != NULL && config->password[0] != '\0'){
+		strlcpy((char *)station.sta.password, config->password, sizeof(station.sta.password));
+		station.sta.threshold.authmode = WIFI_AUTH_WPA2_PSK;
+	}
+	/* beacons skipped in modem sleep, used only without TWT */
+	listen = config->wake_interval_ms / WIFI_BEACON_MS;
+	station.sta.listen_interval = (listen == 0) ? 1 : (listen > WIFI_LISTEN_MAX) ? WIFI_LISTEN_MAX : listen;
+	wifi_wake_interval_ms = config->wake_interval_ms;
+
+	esp_wifi_set_mode(WIFI_MODE_STA);
+	esp_wifi_set_config(WIFI_IF_STA, &station);
+	/* TWT needs modem sleep enabled */
+	esp_wifi_set_ps((wifi_wake_interval_ms > 0) ? WIFI_PS_MIN_MODEM : WIFI_PS_NONE);
+	wifi_status = WIFI_CONNECTING;
+	return esp_wifi_start() == ESP_OK;
+}
+
+wifi_status_t WifiStatus(void){
+	return wifi_status;
+}
+
+void WifiGetMac(uint8_t mac[6]){
+	esp_read_mac(mac, ESP_MAC_WIFI_STA);
+}
+
+bool WifiUdpOpen(const char *host, uint16_t port){
+	memset(&wifi_server, 0, sizeof(wifi_server));
+	wifi_server.sin_family = AF_INET;
+	wifi_server.sin_port = htons(port);
+	if(inet_pton(AF_INET, host, &wifi_server.sin_addr) != 1){
+		wifi_server_set = false;
+		return false;
+	}
+	if(wifi_socket < 0){
+		wifi_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	}
+	wifi_server_set = (wifi_socket >= 0);
+	return wifi_server_set;
+}
+
+bool WifiUdpSend(const uint8_t *data, uint16_t length){
+	if(wifi_status != WIFI_CONNECTED || !wifi_server_set || length > WIFI_DATAGRAM_MAX ||
+	   sendto(wifi_socket, data, length, MSG_DONTWAIT, (struct sockaddr *)&wifi_server, sizeof(wifi_server)) != length){
+		wifi_stats.dropped++;
+		return false;
+	}
+	wifi_stats.datagrams++;
+	wifi_stats.bytes += length;
+	return true;
+}
+
+void WifiGetStats(wifi_stats_t *stats){
+	wifi_ap_record_t ap;
+
+	*stats = wifi_stats;
+	stats->rssi = (wifi_status == WIFI_CONNECTED && esp_wifi_sta_get_ap_info(&ap) == ESP_OK) ? ap.rssi : 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,124 @@
+/*! @mainpage Ejemplo Osciloscopio ADC
+ *
+ * @section genDesc General Description
+ *
+ * Modo osciloscopio para depurar sensores en el banco: los canales CH1 y CH2
+ * se convierten en modo continuo (DMA) y se envían sin procesar, en 12 bits
+ * (dos muestras cada tres bytes), por el sumidero de telemetría a la UART_PC,
+ * al USB Serial/JTAG o por BLE (adc_scope, middelware).
+ *
+ * La frecuencia de muestreo se adapta sola al enlace: crece mientras no se
+ * pierden muestras y baja cuando el enlace no da abasto. Cada 500 ms se envía
+ * un estado con la frecuencia y las muestras por segundo que llegaron al
+ * enlace; con BLE el estado también se imprime por la UART_PC. En la PC las
+ * tramas se decodifican con middelware/telemetry/adc_scope.py.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	Señal 1	 	| 	CH1			|
+ * | 	Señal 2	 	| 	CH2			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ * | 15/10/2026 | Enlace por USB Serial/JTAG                     |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "led.h"
+#include "uart_mcu.h"
+#include "usb_serial_mcu.h"
+#include "ble_mcu.h"
+
+#include "telemetry.h"
+#include "adc_scope.h"
+#include "text_format.h"
+/*==================[macros and definitions]=================================*/
+#define ENLACE              TELEMETRY_UART_PC   /* TELEMETRY_UART_PC, TELEMETRY_USB o TELEMETRY_BLE */
+#define COLA_USB            32768       /* Bytes que la PC puede dejar sin leer (TELEMETRY_USB) */
+#define BAUDIOS             921600
+#define FRECUENCIA_MIN      100         /* Muestreo inicial de cada canal (Hz) */
+#define FRECUENCIA_MAX      40000       /* Muestreo máximo de cada canal (Hz) */
+#define SOBREMUESTREO       1
+#define LED_ESTADO          LED_1
+/*==================[internal data definition]===============================*/
+static const adc_ch_t canales[] = {CH1, CH2};
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Imprime el estado del osciloscopio por la UART_PC (sólo con BLE: con
+ * la UART el estado viaja entre las muestras)
+ */
+static void InformarEstado(const adc_scope_stats_t *estado){
+    char msg[96];
+    char *p = msg;
+
+    p += FmtUint(p, estado->sample_frec, 10);
+    p += FmtStr(p, " Hz por canal, ");
+    p += FmtUint(p, estado->delivered, 10);
+    p += FmtStr(p, " muestras/s, ");
+    p += FmtUint(p, estado->lost, 10);
+    p += FmtStr(p, " perdidas\r\n");
+    UartSendString(UART_PC, msg);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    adc_scope_stats_t estado;
+    adc_scope_config_t osciloscopio = {
+        .channels = canales,
+        .n_channels = sizeof(canales) / sizeof(canales[0]),
+        .min_frec = FRECUENCIA_MIN,
+        .max_frec = FRECUENCIA_MAX,
+        .oversampling = SOBREMUESTREO,
+        .priority = 3
+    };
+    serial_config_t uart_pc = {
+        .port = UART_PC,
+        .baud_rate = BAUDIOS,
+        .func_p = UART_NO_INT,
+        .param_p = NULL
+    };
+    ble_config_t ble_configuration = {
+        .device_name = "ESP_EDU_1",
+        .func_p = BLE_NO_INT
+    };
+
+    LedsInit();
+    UartInit(&uart_pc);
+    if(ENLACE == TELEMETRY_BLE){
+        BleInit(&ble_configuration);
+    }
+    if(ENLACE == TELEMETRY_USB){
+        UsbSerialInit(COLA_USB, 0);
+    }
+    TelemetryInit(ENLACE, 1);   // Prioridad baja: sólo vacía la cola
+    AdcScopeInit(&osciloscopio);
+
+    while(1){
+        vTaskDelay(ADC_SCOPE_ADAPT_MS / portTICK_PERIOD_MS);
+        AdcScopeGetStats(&estado);
+        if(estado.lost > 0){
+            LedOn(LED_ESTADO);
+        } else{
+            LedOff(LED_ESTADO);
+        }
+        if(ENLACE == TELEMETRY_BLE){
+            InformarEstado(&estado);
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,143 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 23:00:00 2026
+
+@author: Albano Peñalva
+
+Decodificador del gateway BLE (ej_ble_gateway). Los registros del gateway
+llegan por el sumidero de telemetría (telemetry.h), en tramas por la UART o en
+datagramas UDP:
+
+    0x60 par        par (1) y datos de una notificación: tramas de postura de
+                    16 bytes (trama_postura_t de ProyectoIntegrador)
+    0x61 estado     por cada par: conectado (1), intervalo de conexión en
+                    unidades de 1,25 ms (2) y notificaciones recibidas (4)
+
+Uso:
+    python gateway.py --puerto /dev/ttyUSB0 --baudios 921600   (requiere pyserial)
+    python gateway.py --udp 5005                                (datagramas UDP)
+
+Imprime una trama de postura por línea ("par,secuencia,ms,ax,ay,az,ángulo,
+estado", aceleraciones en g y ángulo en grados) y los estados por stderr.
+"""
+
+# Librerías
+import argparse
+import os
+import socket
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', '..', 'middelware', 'telemetry'))
+from adc_scope import crc16, cobs_decodificar      # noqa: E402
+from telemetry_server import decodificar           # noqa: E402
+
+TIPO_PAR = 0x60
+TIPO_ESTADO = 0x61
+SYNC_TRAMA = 0xA5
+TRAMA = struct.Struct('<BBIhhhhBB')
+
+
+class Gateway:
+    """Arma las tramas de postura de cada par y cuenta las perdidas."""
+
+    def __init__(self):
+        self.pendiente = {}         # bytes recibidos de cada par, sin trama completa
+        self.secuencia = {}
+        self.perdidas = {}
+        self.erroneas = 0
+
+    def registro(self, tipo, datos):
+        if tipo == TIPO_PAR:
+            self.par(datos[0], datos[1:])
+        elif tipo == TIPO_ESTADO:
+            partes = []
+            for i in range(0, len(datos) - 6, 7):
+                conectado, intervalo, notificaciones = struct.unpack_from('<BHI', datos, i)
+                if conectado:
+                    partes.append(f'par {i // 7}: {intervalo * 1.25:.2f} ms, {notificaciones} notif.')
+            print('; '.join(partes) or 'sin pares', file=sys.stderr)
+
+    def par(self, par, datos):
+        pendiente = self.pendiente.setdefault(par, bytearray()) + datos
+        while len(pendiente) >= TRAMA.size:
+            if pendiente[0] != SYNC_TRAMA:
+                del pendiente[0]
+                self.erroneas += 1
+                continue
+            trama = bytes(pendiente[:TRAMA.size])
+            checksum = 0
+            for byte in trama[:-1]:
+                checksum ^= byte
+            if checksum != trama[-1]:
+                del pendiente[0]
+                self.erroneas += 1
+                continue
+            del pendiente[:TRAMA.size]
+            _, seq, ms, ax, ay, az, angulo, estado, _ = TRAMA.unpack(trama)
+            if par in self.secuencia:
+                self.perdidas[par] = self.perdidas.get(par, 0) + ((seq - self.secuencia[par] - 1) & 0xFF)
+            self.secuencia[par] = seq
+            print(f'{par},{seq},{ms},{ax / 1000:.3f},{ay / 1000:.3f},{az / 1000:.3f},{angulo / 100:.2f},{estado}')
+        self.pendiente[par] = pendiente
+
+    def resumen(self):
+        for par in sorted(self.secuencia):
+            print(f'par {par}: {self.perdidas.get(par, 0)} tramas perdidas', file=sys.stderr)
+        if self.erroneas:
+            print(f'{self.erroneas} bytes descartados', file=sys.stderr)
+
+
+class ReceptorSerie:
+    """Separa las tramas del sumidero del flujo de bytes de la UART."""
+
+    def __init__(self, gateway):
+        self.gateway = gateway
+        self.pendiente = bytearray()
+
+    def recibir(self, datos):
+        self.pendiente += datos
+        while 0 in self.pendiente:
+            fin = self.pendiente.index(0)
+            codificada = bytes(self.pendiente[:fin])
+            del self.pendiente[:fin + 1]
+            try:
+                trama = cobs_decodificar(codificada)
+            except ValueError:
+                continue
+            if len(trama) >= 5 and crc16(trama[:-2]) == struct.unpack_from('<H', trama, len(trama) - 2)[0]:
+                self.gateway.registro(trama[2], trama[3:-2])
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decodificador del gateway BLE')
+    parser.add_argument('--puerto', help='puerto serie (UART_PC)')
+    parser.add_argument('--baudios', type=int, default=921600, help='velocidad del puerto serie')
+    parser.add_argument('--udp', type=int, metavar='PUERTO', help='puerto UDP donde escuchar')
+    args = parser.parse_args()
+
+    gateway = Gateway()
+    try:
+        if args.puerto:
+            import serial
+            receptor = ReceptorSerie(gateway)
+            with serial.Serial(args.puerto, args.baudios, timeout=0.1) as conexion:
+                while True:
+                    receptor.recibir(conexion.read(4096))
+        elif args.udp:
+            servidor = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+            servidor.bind(('', args.udp))
+            while True:
+                datagrama, _ = servidor.recvfrom(2048)
+                try:
+                    _, _, _, registros, _ = decodificar(datagrama)
+                except (ValueError, IndexError, struct.error):
+                    continue
+                for tipo, datos in registros:
+                    gateway.registro(tipo, datos)
+        else:
+            parser.error('indicar --puerto o --udp')
+    except KeyboardInterrupt:
+        pass
+    gateway.resumen()
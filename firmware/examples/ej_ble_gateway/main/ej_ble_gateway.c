@@ -0,0 +1,166 @@
+/*! @mainpage Ejemplo Gateway BLE
+ *
+ * @section genDesc General Description
+ *
+ * Una placa ESP-EDU como gateway de una sala: se conecta como central a
+ * varios PostureCare (ProyectoIntegrador) a la vez, les pide la telemetría
+ * binaria (comando "B") y reenvía las tramas de todos por un único enlace, la
+ * UART_PC o Wi-Fi (datagramas UDP a un servidor), a través del sumidero de
+ * telemetría.
+ *
+ * Cada notificación recibida viaja en un registro TIPO_PAR con el número de
+ * par (0 a PARES_MAX - 1) seguido de los datos; cada 5 s se envía un registro
+ * TIPO_ESTADO con la conexión, el intervalo y las notificaciones de cada par.
+ * En la PC se decodifican con gateway.py.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * Sin conexiones: los PostureCare se encuentran por Bluetooth.
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "sdkconfig.h"
+#include "led.h"
+#include "uart_mcu.h"
+#include "ble_central_mcu.h"
+#if CONFIG_DRIVERS_WIFI
+#include "wifi_mcu.h"
+#endif
+
+#include "telemetry.h"
+#include "spsc_ring.h"
+/*==================[macros and definitions]=================================*/
+#define ENLACE              TELEMETRY_UART_PC   /* TELEMETRY_UART_PC o TELEMETRY_UDP (CONFIG_DRIVERS_WIFI) */
+#define BAUDIOS             921600
+#define NOMBRE_PARES        "PostureCare"       /* device_name de los periféricos */
+#define PARES_MAX           4
+#define WIFI_RED            "taller"
+#define WIFI_CLAVE          "clave"
+#define SERVIDOR_IP         "192.168.1.10"
+#define SERVIDOR_PUERTO     5005
+#define PERIODO_UDP_MS      200                 /* Un datagrama cada 200 ms */
+#define PERIODO_ESTADO_MS   5000
+#define TIPO_PAR            0x60                /* Par (1) y datos de una notificación */
+#define TIPO_ESTADO         0x61                /* Por par: conectado (1), intervalo (2), notificaciones (4) */
+#define LED_PARES           LED_1
+/*==================[internal data definition]===============================*/
+/* Una cola por productor: las notificaciones llegan en la tarea de Bluetooth,
+ * los estados en app_main */
+SPSC_RING_DEFINE(cola_pares, telemetry_record_t, 64);
+SPSC_RING_DEFINE(cola_estado, telemetry_record_t, 4);
+static const uint8_t comando_binario[] = {'B'};
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Reenvía una notificación de un par, partida en registros de hasta
+ * TELEMETRY_PAYLOAD_MAX bytes (par incluido)
+ */
+static void RecibirPar(uint8_t par, const uint8_t *datos, uint16_t largo){
+    uint8_t registro[TELEMETRY_PAYLOAD_MAX];
+    uint16_t parte;
+
+    registro[0] = par;
+    while(largo > 0){
+        parte = (largo < TELEMETRY_PAYLOAD_MAX - 1) ? largo : TELEMETRY_PAYLOAD_MAX - 1;
+        memcpy(&registro[1], datos, parte);
+        TelemetryPush(&cola_pares, TIPO_PAR, registro, parte + 1);
+        datos += parte;
+        largo -= parte;
+    }
+}
+
+/**
+ * @brief Envía el estado de cada par
+ */
+static void EnviarEstado(void){
+    ble_central_peer_t par;
+    uint8_t estado[PARES_MAX * 7];
+    uint8_t *p = estado;
+
+    for(uint8_t i = 0; i < PARES_MAX; i++){
+        BleCentralGetPeer(i, &par);
+        *p++ = par.connected;
+        *p++ = par.interval & 0xFF;
+        *p++ = par.interval >> 8;
+        for(uint8_t j = 0; j < 4; j++){
+            *p++ = (par.notifications >> (8 * j)) & 0xFF;
+        }
+    }
+    TelemetryPush(&cola_estado, TIPO_ESTADO, estado, sizeof(estado));
+}
+
+/**
+ * @brief Inicia el enlace hacia la PC o el servidor
+ */
+static bool IniciarEnlace(void){
+#if CONFIG_DRIVERS_WIFI
+    if(ENLACE == TELEMETRY_UDP){
+        wifi_mcu_config_t wifi = {
+            .ssid = WIFI_RED,
+            .password = WIFI_CLAVE,
+            .wake_interval_ms = 0       // Gateway alimentado: radio siempre encendida
+        };
+        telemetry_udp_config_t servidor = {
+            .host = SERVIDOR_IP,
+            .port = SERVIDOR_PUERTO,
+            .period_ms = PERIODO_UDP_MS
+        };
+        return WifiInit(&wifi) && TelemetryInitUdp(&servidor, 1);
+    }
+#endif
+    return TelemetryInit(ENLACE, 1);   // Prioridad baja: sólo vacía las colas
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    serial_config_t uart_pc = {
+        .port = UART_PC,
+        .baud_rate = BAUDIOS,
+        .func_p = UART_NO_INT,
+        .param_p = NULL
+    };
+    ble_central_config_t gateway = {
+        .peer_name = NOMBRE_PARES,
+        .max_peers = PARES_MAX,
+        .start_cmd = comando_binario,
+        .start_cmd_len = sizeof(comando_binario),
+        .func_p = RecibirPar
+    };
+
+    LedsInit();
+    UartInit(&uart_pc);
+    TelemetryAddSource(&cola_pares);
+    TelemetryAddSource(&cola_estado);
+    if(!IniciarEnlace()){
+        printf("No se pudo iniciar el enlace\r\n");
+        return;
+    }
+    BleCentralInit(&gateway);
+
+    while(1){
+        vTaskDelay(PERIODO_ESTADO_MS / portTICK_PERIOD_MS);
+        EnviarEstado();
+        if(BleCentralPeers() > 0){
+            LedOn(LED_PARES);
+        } else{
+            LedOff(LED_PARES);
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
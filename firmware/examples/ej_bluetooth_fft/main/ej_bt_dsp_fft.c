@@ -5,13 +5,18 @@
  * Este proyecto ejemplifica el uso del módulo de comunicación 
  * Bluetooth Low Energy (BLE), junto con el de cálculo de la FFT 
  * de una señal.
- * Permite graficar en una aplicación móvil la FFT de una señal. 
+ * Permite graficar en una aplicación móvil la FFT de una señal
+ * (comando 'E'), o enviar solo sus características espectrales
+ * (comando 'R'): frecuencia dominante, centroide, SNR y potencia
+ * en bandas, menos de 100 bytes en lugar de unos 4 kB.
  *
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Formato de texto sin sprintf (text_format)     |
+ * | 15/10/2026 | Características espectrales en el dispositivo  |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -31,12 +36,16 @@
 #include "delay_mcu.h"
 
 #include "fft.h"
+#include "spectral_features.h"
 #include "iir_filter.h"
+#include "text_format.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
 #define LED_BT	            LED_1
 #define BUFFER_SIZE         256
 #define SAMPLE_FREQ	        220
+#define BATCH_SIZE          240     /* Bytes packed in each BLE transaction */
+#define N_BANDAS            4
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -64,19 +73,56 @@ static float ecg_filt[BUFFER_SIZE];
 static float ecg_fft[BUFFER_SIZE/2];
 static float ecg_filt_fft[BUFFER_SIZE/2];
 static float f[BUFFER_SIZE/2];
+/* Bandas del ECG: ondas P y T, QRS, músculo y ruido */
+static const float bordes_bandas[N_BANDAS + 1] = {0.5, 5, 15, 40, SAMPLE_FREQ / 2};
+static const char id_bandas[N_BANDAS] = {'T', 'Q', 'M', 'N'};
+static spectral_config_t espectral;
+static bool enviar_espectro = false;
 TaskHandle_t fft_task_handle = NULL;
 /*==================[internal functions declaration]=========================*/
 /**
- * @brief Función a ejecutarse ante un interrupción de recepción 
- * a través de la conexión BLE.
+ * @brief Comandos 'R' y 'E' recibidos a través de la conexión BLE: 
+ * piden las características espectrales o el espectro completo.
  * 
- * @param data      Puntero a array de datos recibidos
- * @param length    Longitud del array de datos recibidos
+ * @param id        Caracter del comando
+ * @param arg       Puntero al argumento del comando (no se usa)
+ * @param length    Longitud del argumento
  */
-void read_data(uint8_t * data, uint8_t length){
-	if(data[0] == 'R'){
-        xTaskNotifyGive(fft_task_handle);
+static void PedirFft(char id, uint8_t * arg, uint8_t length){
+    enviar_espectro = (id == 'E');
+    xTaskNotifyGive(fft_task_handle);
+}
+/* Comandos recibidos por BLE */
+static const ble_command_t comandos[] = {
+    {'R', PedirFft},
+    {'E', PedirFft},
+};
+
+/**
+ * @brief Envía las características espectrales de la señal filtrada,
+ * un campo de texto de la aplicación por valor.
+ * 
+ */
+static void EnviarCaracteristicas(void){
+    spectral_features_t carac;
+    char msg[BATCH_SIZE];
+    char *p = msg;
+
+    SpectralFeatures(&espectral, ecg_filt_fft, &carac);
+    p += FmtStr(p, "*F");
+    p += FmtFloat(p, carac.dominant_freq, 2);
+    p += FmtStr(p, "*\n*C");
+    p += FmtFloat(p, carac.centroid, 2);
+    p += FmtStr(p, "*\n*S");
+    p += FmtFloat(p, carac.snr, 1);
+    p += FmtStr(p, "*\n");
+    for(uint8_t b=0; b<N_BANDAS; b++){
+        *p++ = '*';
+        *p++ = id_bandas[b];
+        p += FmtFloat(p, carac.band_power[b], 2);
+        p += FmtStr(p, "*\n");
     }
+    BleSendBatch(msg, 1, p - msg);
 }
 
 /**
@@ -86,34 +132,63 @@ void read_data(uint8_t * data, uint8_t length){
  */
 static void FftTask(void *pvParameter){
     char msg[48];
+    char batch[BATCH_SIZE];
+    uint16_t batch_len;
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        FFTMagnitude(ecg, ecg_fft, BUFFER_SIZE);
         HiPassFilter(ecg, ecg_filt, BUFFER_SIZE);
         LowPassFilter(ecg_filt, ecg_filt, BUFFER_SIZE);
         FFTFrequency(SAMPLE_FREQ, BUFFER_SIZE, f);
-        FFTMagnitude(ecg_filt, ecg_filt_fft, BUFFER_SIZE);
+        /* Ambos espectros con una única FFT compleja */
+        FFTMagnitudeDual(ecg, ecg_filt, ecg_fft, ecg_filt_fft, BUFFER_SIZE);
+        if(!enviar_espectro){
+            EnviarCaracteristicas();
+            continue;
+        }
+        batch_len = 0;
         for(int16_t i=0; i<BUFFER_SIZE/2; i++){
             /* Formato de datos para que sean graficados en la aplicación móvil */
-            sprintf(msg, "*HX%2.2fY%2.2f,X%2.2fY%2.2f*\n", f[i], ecg_fft[i], f[i], ecg_filt_fft[i]);
-            BleSendString(msg);
+            char *p = msg;
+            p += FmtStr(p, "*HX");
+            p += FmtFloat(p, f[i], 2);
+            p += FmtStr(p, "Y");
+            p += FmtFloat(p, ecg_fft[i], 2);
+            p += FmtStr(p, ",X");
+            p += FmtFloat(p, f[i], 2);
+            p += FmtStr(p, "Y");
+            p += FmtFloat(p, ecg_filt_fft[i], 2);
+            p += FmtStr(p, "*\n");
+            int len = p - msg;
+            /* Se agrupan varias líneas por transacción, hasta completar la MTU negociada */
+            if(batch_len + len > BATCH_SIZE){
+                BleSendBatch(batch, 1, batch_len);
+                batch_len = 0;
+            }
+            memcpy(&batch[batch_len], msg, len);
+            batch_len += len;
+        }
+        if(batch_len > 0){
+            BleSendBatch(batch, 1, batch_len);
         }
     }
 }
 /*==================[external functions definition]==========================*/
 void app_main(void){
     ble_config_t ble_configuration = {
-        "ESP_EDU_1",
-        read_data
+        .device_name = "ESP_EDU_1",
+        .func_p = BLE_NO_INT,
+        .commands = comandos,
+        .n_commands = sizeof(comandos) / sizeof(comandos[0]),
     };
 
     LedsInit();  
     FFTInit();  
+    SpectralInit(&espectral, SAMPLE_FREQ, BUFFER_SIZE, bordes_bandas, N_BANDAS);
     LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
     HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
     BleInit(&ble_configuration);
 
-    xTaskCreate(&FftTask, "FFT", 2048, NULL, 5, &fft_task_handle);
+    xTaskCreate(&FftTask, "FFT", 3072, NULL, 5, &fft_task_handle);
 
     while(1){
         vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
@@ -4,13 +4,27 @@
  *
  * This section describes how the program works.
  *
+ * El ECG (filtrado o no) se envía por BLE en texto para la aplicación
+ * Bluetooth Electronics ("*G12.34*" por muestra) o, con el comando 'B', en
+ * bloques binarios (sample_stream, diferencias con código Rice): cada muestra
+ * en décimas ocupa alrededor de 9 bits en lugar de 9 bytes, por lo que la
+ * misma conexión admite una frecuencia de muestreo varias veces mayor. Con 'b' se
+ * vuelve al texto. Los bloques se decodifican en la PC con
+ * middelware/telemetry/sample_stream.py.
+ *
+ * Con ECG_EN_VIVO el ECG se adquiere del amplificador conectado a CH1: el ADC
+ * muestrea en modo continuo a FRECUENCIA_ECG por DMA y cada trama completa
+ * (ADC_CONT_FRAME_LEN muestras) se convierte en bloque a mV, se filtra (notch
+ * de la línea, pasa altos y pasa bajos) y se envía. Sin ECG_EN_VIVO se
+ * reproduce la tabla ecg[] con un timer.
+ *
  * <a href="https://drive.google.com/...">Operation Example</a>
  *
  * @section hardConn Hardware Connection
  *
  * |    Peripheral  |   ESP32   	|
  * |:--------------:|:--------------|
- * | 	PIN_X	 	| 	GPIO_X		|
+ * | Salida del amplificador de ECG	| 	CH1		|
  *
  *
  * @section changelog Changelog
@@ -18,6 +32,14 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 14/10/2026 | Formato de texto sin sprintf (text_format)     |
+ * | 15/10/2026 | Filtrado con signal_pipeline, sin copias       |
+ * | 15/10/2026 | Envío binario por bloques (sample_stream)      |
+ * | 15/10/2026 | Compresión Rice del envío binario              |
+ * | 15/10/2026 | Procesamiento diferido del timer (defer_mcu), |
+ * | 			| sin tarea ni notificaciones propias			 |
+ * | 15/10/2026 | Adquisición del ECG por ADC continuo, con     |
+ * | 			| notch de línea en el filtrado				     |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -27,6 +49,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <math.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -35,15 +58,36 @@
 #include "neopixel_stripe.h"
 #include "ble_mcu.h"
 #include "timer_mcu.h"
+#include "analog_io_mcu.h"
+#include "defer_mcu.h"
 
-#include "iir_filter.h"
+#include "signal_pipeline.h"
+#include "text_format.h"
+#include "sample_stream.h"
+#include "sample_convert.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
 #define LED_BT	            LED_1
 #define BUFFER_SIZE         256
-#define SAMPLE_FREQ	        200
 #define T_SENIAL            4000 
 #define CHUNK               4 
+#define ECG_ESCALA          10          /* Muestras binarias en décimas */
+#define ECG_FLUJO           0           /* Id del flujo binario */
+#define ECG_EN_VIVO         1           /* 1: ECG adquirido por el ADC, 0: tabla ecg[] reproducida con el timer */
+#define CANAL_ECG           CH1
+#define FRECUENCIA_ECG      500         /* Muestreo del ADC (Hz), de 250 a 1000 */
+#define SOBREMUESTREO_ECG   4           /* Conversiones promediadas por muestra */
+#define ECG_REPOSO_MV       1650        /* Salida del amplificador sin señal (mV) */
+#define FRECUENCIA_RED      50          /* Interferencia de línea (Hz) */
+#define Q_NOTCH             10          /* Ancho del notch: FRECUENCIA_RED / Q_NOTCH */
+#define MUESTRAS_TEXTO      8           /* Muestras por mensaje de texto */
+#if ECG_EN_VIVO
+#define SAMPLE_FREQ         FRECUENCIA_ECG
+#define BLOQUE_MAX          ADC_CONT_FRAME_LEN
+#else
+#define SAMPLE_FREQ         200
+#define BLOQUE_MAX          CHUNK
+#endif
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -67,9 +111,17 @@ float ecg[] = {
      69,  75,  79,  75,  68,  68,  76,  76,  69,  67,  74,  81,  77,
      71,  72,  82,  82,  76,  77,  76,  76,  75
 };
-static float ecg_filt[CHUNK];
-TaskHandle_t fft_task_handle = NULL;
+/* Notch de la línea, pasa altos de 1 Hz y pasa bajos de 30 Hz, en un único pipeline */
+static const pipeline_stage_config_t etapas[] = {
+    {.type = PIPE_NOTCH, .cut_frec = FRECUENCIA_RED, .q = Q_NOTCH},
+    {.type = PIPE_HI_PASS, .cut_frec = 1, .order = ORDER_2},
+    {.type = PIPE_LOW_PASS, .cut_frec = 30, .order = ORDER_2},
+};
+static uint8_t arena[1024] __attribute__((aligned(16)));
+static pipeline_t pipeline;
 bool filter = false;
+bool binario = false;
+static sample_stream_t flujo_ecg;
 /*==================[internal functions declaration]=========================*/
 void read_data(uint8_t * data, uint8_t length){
     switch(data[0]){
@@ -79,35 +131,78 @@ void read_data(uint8_t * data, uint8_t length){
         case 'a':
             filter = false;
             break;
+        case 'B':
+            binario = true;
+            break;
+        case 'b':
+            binario = false;
+            break;
     }
 }
 
-void FuncTimerSenial(void* param){
-    xTaskNotifyGive(fft_task_handle);
-}
-
-static void FftTask(void *pvParameter){
+/**
+ * @brief Filtra (con el filtro activado) y envía un bloque de muestras: en
+ * texto, de a MUESTRAS_TEXTO por mensaje, o en el flujo binario, en décimas
+ */
+static void EnviarBloque(const float *muestras, uint16_t n){
     char msg[128];
-    char msg_chunk[24];
-    static uint8_t indice = 0;
-    while(true){
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        if(filter){
-            HiPassFilter(&ecg[indice], ecg_filt, CHUNK);
-            LowPassFilter(ecg_filt, ecg_filt, CHUNK);
-        } else{
-            memcpy(ecg_filt, &ecg[indice], CHUNK*sizeof(float));
-        }
-        strcpy(msg, "");
-        for(uint8_t i=0; i<CHUNK; i++){
-            sprintf(msg_chunk, "*G%.2f*", ecg_filt[i]);
-            strcat(msg, msg_chunk);
+    int16_t decimas[BLOQUE_MAX];
+    const float *ecg_filt = muestras;
+
+    if(filter){
+        PipelineProcess(&pipeline, muestras, n, &ecg_filt);
+    }
+    if(binario){
+        SampleConvertF32ToI16(ecg_filt, decimas, n, 0, ECG_ESCALA);
+        SampleStreamWrite(&flujo_ecg, decimas, n);
+    } else{
+        /* Lo que quedó del flujo binario sale antes que el texto */
+        SampleStreamFlush(&flujo_ecg);
+        for(uint16_t i=0; i<n; i+=MUESTRAS_TEXTO){
+            char *p = msg;
+            for(uint16_t j=i; j<n && j<i+MUESTRAS_TEXTO; j++){
+                p += FmtStr(p, "*G");
+                p += FmtFloat(p, ecg_filt[j], 2);
+                p += FmtStr(p, "*");
+            }
+            BleSendString(msg);
         }
-        indice += CHUNK;
+    }
+}
+
+#if ECG_EN_VIVO
+/**
+ * @brief Convierte a mV y envía las tramas completas del ADC. La interrupción
+ * de fin de trama la encola y la ejecuta la tarea de trabajo diferido
+ * DEFER_LOW; lee hasta vaciar las tramas pendientes, así el retardo queda
+ * acotado a una trama (ADC_CONT_FRAME_LEN / FRECUENCIA_ECG, 128 ms a 500 Hz)
+ * más el procesamiento.
+ */
+static void ProcesarTrama(void *param){
+    static uint16_t trama_mv[ADC_CONT_FRAME_LEN];
+    static float trama[ADC_CONT_FRAME_LEN];
+    uint16_t n;
 
-        BleSendString(msg);
+    while((n = AnalogInputReadContinuous(CANAL_ECG, trama_mv)) > 0){
+        SampleConvertU16ToF32(trama_mv, trama, n, ECG_REPOSO_MV, 1.0f);
+        EnviarBloque(trama, n);
     }
 }
+static deferred_t bloque = DEFERRED_INIT(ProcesarTrama, NULL, DEFER_LOW);
+#else
+/**
+ * @brief Envía el siguiente bloque de la tabla. El timer la encola en cada
+ * período y la ejecuta la tarea de trabajo diferido DEFER_LOW, fuera de la
+ * interrupción.
+ */
+static void ProcesarBloque(void *param){
+    static uint8_t indice = 0;
+
+    EnviarBloque(&ecg[indice], CHUNK);
+    indice += CHUNK;
+}
+static deferred_t bloque = DEFERRED_INIT(ProcesarBloque, NULL, DEFER_LOW);
+#endif
 /*==================[external functions definition]==========================*/
 void app_main(void){
     uint8_t blink = 0;
@@ -116,23 +211,39 @@ void app_main(void){
         "ESP_EDU_1",
         read_data
     };
+#if ECG_EN_VIVO
+    analog_input_config_t adc_ecg = {
+        .input = CANAL_ECG,
+        .mode = ADC_CONTINUOUS,
+        .func_p = DeferIsr,
+        .param_p = &bloque,
+        .sample_frec = FRECUENCIA_ECG,
+        .oversampling = SOBREMUESTREO_ECG
+    };
+#else
     timer_config_t timer_senial = {
         .timer = TIMER_B,
         .period = T_SENIAL*CHUNK,
-        .func_p = FuncTimerSenial,
-        .param_p = NULL
+        .func_p = DeferIsr,
+        .param_p = &bloque
     };
+#endif
 
     NeoPixelInit(BUILT_IN_RGB_LED_PIN, BUILT_IN_RGB_LED_LENGTH, &color);
     NeoPixelAllOff();
-    TimerInit(&timer_senial);
     LedsInit();  
-    LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
-    HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
+    PipelineInit(&pipeline, arena, sizeof(arena), SAMPLE_FREQ, BLOQUE_MAX, etapas, sizeof(etapas) / sizeof(etapas[0]));
     BleInit(&ble_configuration);
+    SampleStreamInit(&flujo_ecg, ECG_FLUJO, SAMPLE_STREAM_RICE);
 
-    xTaskCreate(&FftTask, "FFT", 4096, NULL, 5, &fft_task_handle);
+    DeferInit(DEFER_LOW, 5);
+#if ECG_EN_VIVO
+    AnalogInputInit(&adc_ecg);
+    AnalogStartContinuous(CANAL_ECG);
+#else
+    TimerInit(&timer_senial);
     TimerStart(timer_senial.timer);
+#endif
 
     while(1){
         vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
@@ -7,11 +7,18 @@
  * Permite manejar la tonalidad e intensidad del LED RGB incluído en la placa ESP-EDU, 
  * mediante una aplicación móvil.
  *
+ * Los "slidebar" envían decenas de valores por segundo: la recepción sólo
+ * guarda el nuevo color y el motor de animación (neopixel_animation.h) lo
+ * alcanza con una transición suave, con a lo sumo un refresco del LED por
+ * cuadro. La realimentación de los valores se envía desde el lazo principal,
+ * una vez por período y sólo si cambiaron.
+ *
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 15/10/2026 | Motor de animación y realimentación agrupada   |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -27,11 +34,16 @@
 
 #include "led.h"
 #include "neopixel_stripe.h"
+#include "neopixel_animation.h"
 #include "ble_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
 #define LED_BT	LED_1
+#define CUADROS_POR_SEGUNDO 50
+#define TRANSICION_MS       120     /* Tiempo para alcanzar cada nuevo color */
 /*==================[internal data definition]===============================*/
+static volatile uint8_t red = 0, green = 0, blue = 0;
+static volatile bool cambio = false;   /* Valores aún no informados a la aplicación */
 
 /*==================[internal functions declaration]=========================*/
 /**
@@ -43,13 +55,11 @@
  */
 void read_data(uint8_t * data, uint8_t length){
 	uint8_t i = 1;
-    static uint8_t red = 0, green = 0, blue = 0;
-	char msg[30];
 
 	if(data[0] == 'R'){
         /* El slidebar Rojo envía los datos con el formato "R" + value + "A" */
 		red = 0;
-		while(data[i] != 'A'){
+		while(i < length && data[i] != 'A'){
             /* Convertir el valor ASCII a un valor entero */
 			red = red * 10;
 			red = red + (data[i] - '0');
@@ -58,7 +68,7 @@ void read_data(uint8_t * data, uint8_t length){
 	}else if(data[0] == 'G'){   
         /* El slidebar Verde envía los datos con el formato "G" + value + "A" */
 		green = 0;
-		while(data[i] != 'A'){
+		while(i < length && data[i] != 'A'){
             /* Convertir el valor ASCII a un valor entero */
 			green = green * 10;
 			green = green + (data[i] - '0');
@@ -67,17 +77,16 @@ void read_data(uint8_t * data, uint8_t length){
 	}else if(data[0] == 'B'){
         /* El slidebar Azul envía los datos con el formato "B" + value + "A" */
 		blue = 0;
-		while(data[i] != 'A'){
+		while(i < length && data[i] != 'A'){
             /* Convertir el valor ASCII a un valor entero */
 			blue = blue * 10;
 			blue = blue + (data[i] - '0');
 			i++;
 		}
 	}
-    NeoPixelAllColor(NeoPixelRgb2Color(red, green, blue));
-    /* Se envía una realimentación de los valores actuales de brillo del LED */
-    sprintf(msg, "R: %d, G: %d, B: %d\n", red, green, blue);
-    BleSendString(msg);
+    /* Sólo se marca el nuevo color: el LED se refresca en el próximo cuadro */
+    NeoPixelAnimFadeTo(NeoPixelRgb2Color(red, green, blue), TRANSICION_MS);
+    cambio = true;
 }
 
 /*==================[external functions definition]==========================*/
@@ -87,14 +96,22 @@ void app_main(void){
         "ESP_EDU_1",
         read_data
     };
+    char msg[30];
 
     LedsInit();
     BleInit(&ble_configuration);
     /* Se inicializa el LED RGB de la placa */
     NeoPixelInit(BUILT_IN_RGB_LED_PIN, BUILT_IN_RGB_LED_LENGTH, &color);
     NeoPixelAllOff();
+    NeoPixelAnimInit(CUADROS_POR_SEGUNDO, 3);
     while(1){
         vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
+        if(cambio){
+            /* Una realimentación por período con los últimos valores de brillo del LED */
+            cambio = false;
+            sprintf(msg, "R: %d, G: %d, B: %d\n", red, green, blue);
+            BleSendString(msg);
+        }
         switch(BleStatus()){
             case BLE_OFF:
                 LedOff(LED_BT);
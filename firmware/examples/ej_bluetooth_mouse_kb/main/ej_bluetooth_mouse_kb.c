@@ -7,6 +7,14 @@
  * click izquierdo). Además emula las teclas "barra espaciadora" y "flecha abajo" a partir 
  * de las teclas de la ESP-EDU (teclas "TECLA_1 y "TECLA_2" respectivamente).
  *
+ * El joystick se convierte en modo continuo (DMA) a FRECUENCIA_JOYSTICK con sobremuestreo,
+ * de modo que cada trama llega cada PERIODO_TRAMA ms, del orden del intervalo de conexión
+ * BLE. Por cada trama se promedian las muestras de cada eje, se resta el centro (medido al
+ * iniciar), y la desviación pasa por una zona muerta y una curva de aceleración tabulada
+ * (velocidad en fracciones de píxel). Las fracciones se acumulan entre tramas, de modo que
+ * los movimientos lentos no se pierden, y se envía un único reporte por trama con el
+ * desplazamiento entero acumulado.
+ *
  * @section hardConn Hardware Connection
  *
  * |   	Joystick	|   ESP-EDU		|
@@ -22,6 +30,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 15/10/2026 | Teclas por eventos sin rebote, fuera de la ISR |
+ * | 15/10/2026 | Puntero: ADC continuo, curva de aceleración y acumulación subpíxel |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -31,9 +41,12 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_attr.h"
 
 #include "gpio_mcu.h"
 #include "led.h"
@@ -42,77 +55,180 @@
 #include "analog_io_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define CONFIG_BLINK_PERIOD 500
-#define DELAY_MEASURE       50
 #define LED_BT	            LED_1
+#define CANAL_X             CH1
+#define CANAL_Y             CH3
+/** @brief Frecuencia de muestreo de cada eje (Hz): una trama de ADC_CONT_FRAME_LEN muestras (2 ejes) cada 8 ms */
+#define FRECUENCIA_JOYSTICK 4000
+/** @brief Conversiones promediadas por muestra */
+#define SOBREMUESTREO       4
+/** @brief Período de cada trama (ms), cercano al intervalo de conexión (7,5 - 15 ms) */
+#define PERIODO_TRAMA       ((ADC_CONT_FRAME_LEN / 2) * 1000 / FRECUENCIA_JOYSTICK)
+/** @brief Tramas promediadas para medir el centro del joystick al iniciar */
+#define TRAMAS_CENTRO       16
+/** @brief Desviación máxima respecto al centro (mV) */
+#define EXCURSION_MV        1650
+/** @brief Zona muerta, fracción de EXCURSION_MV */
+#define ZONA_MUERTA         0.08f
+/** @brief Exponente de la curva de aceleración (1: lineal) */
+#define EXPONENTE_CURVA     2.2f
+/** @brief Velocidad con el joystick a fondo (píxeles por trama) */
+#define VELOCIDAD_MAX       20.0f
+/** @brief Puntos de la tabla de la curva de aceleración */
+#define PUNTOS_CURVA        33
+/** @brief Bits de fracción de píxel de la velocidad y los acumuladores */
+#define BITS_SUBPIXEL       8
 /*==================[internal data definition]===============================*/
 TaskHandle_t joystick_task_handle = NULL;
+TaskHandle_t teclas_task_handle = NULL;
 analog_input_config_t adc_x, adc_y;
 bool click = false;
+/** @brief Velocidad (píxeles por trama, con BITS_SUBPIXEL de fracción) de cada punto de la desviación */
+static int32_t curva[PUNTOS_CURVA];
 /*==================[internal functions declaration]=========================*/
 /**
- * @brief 
+ * @brief Tarea que envía una tecla por cada pulsación (eventos ya sin rebote):
+ * TECLA_1 la barra espaciadora y TECLA_2 la flecha abajo.
  * 
+ * @param pvParameter 
  */
-void FuncTecla1(void){
-    keyboard_cmd_t space = HID_KEY_SPACEBAR;
-    BleHidSendKeyboard(0, &space, 1);
+void TeclasTask(void *pvParameter){
+    switch_event_t evento;
+    keyboard_cmd_t tecla;
+    while(true){
+        if(SwitchEventGet(&evento, SWITCH_WAIT_FOREVER) && evento.type == SWITCH_EVENT_PRESS){
+            tecla = (evento.sw == SWITCH_1) ? HID_KEY_SPACEBAR : HID_KEY_DOWN_ARROW;
+            BleHidSendKeyboard(0, &tecla, 1);
+        }
+    }
 }
 /**
- * @brief 
+ * @brief Función del pulsador del joystick (ISR).
  * 
  */
-void FuncTecla2(void){
-    keyboard_cmd_t down = HID_KEY_DOWN_ARROW;
-    BleHidSendKeyboard(0, &down, 1);
+void FuncTecJoy(void){
+    click = true;
 }
 /**
- * @brief 
+ * @brief Función de fin de trama del ADC (ISR): despierta a la tarea del joystick.
  * 
+ * @param param No se usa
  */
-void FuncTecJoy(void){
-    click = true;
+static void IRAM_ATTR TramaJoystick(void *param){
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(joystick_task_handle, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+/**
+ * @brief Tabula la curva de aceleración: cero en la zona muerta y luego
+ * VELOCIDAD_MAX * d^EXPONENTE_CURVA, con d la desviación fuera de la zona muerta (0 a 1).
+ * 
+ */
+static void CalcularCurva(void){
+    float d;
+    for(uint8_t i = 0; i < PUNTOS_CURVA; i++){
+        d = ((float)i / (PUNTOS_CURVA - 1) - ZONA_MUERTA) / (1.0f - ZONA_MUERTA);
+        curva[i] = (d <= 0.0f) ? 0 : lrintf(VELOCIDAD_MAX * powf(d, EXPONENTE_CURVA) * (1 << BITS_SUBPIXEL));
+    }
+}
+/**
+ * @brief Velocidad de un eje a partir de su desviación, interpolando la curva.
+ * 
+ * @param desvio Desviación respecto al centro (mV)
+ * @return int32_t Velocidad con signo (píxeles por trama, con BITS_SUBPIXEL de fracción)
+ */
+static int32_t Velocidad(int32_t desvio){
+    uint32_t d = abs(desvio);
+    uint32_t pos, i, frac;
+    int32_t v;
+
+    if(d > EXCURSION_MV){
+        d = EXCURSION_MV;
+    }
+    pos = d * (PUNTOS_CURVA - 1);
+    i = pos / EXCURSION_MV;
+    frac = pos % EXCURSION_MV;
+    v = curva[i];
+    if(i < PUNTOS_CURVA - 1){
+        v += (int32_t)(((int64_t)(curva[i + 1] - curva[i]) * frac) / EXCURSION_MV);
+    }
+    return (desvio < 0) ? -v : v;
 }
 /**
- * @brief 
+ * @brief Saca del acumulador la parte entera que cabe en un reporte, la fracción queda.
  * 
- * @param analog_data 
- * @return int8_t 
+ * @param acumulado Acumulador (píxeles, con BITS_SUBPIXEL de fracción)
+ * @return int8_t Desplazamiento a enviar (píxeles)
  */
-void UpdateMouse(int8_t * pos, uint16_t analog_data){
-    if(analog_data < 50){
-        *pos = - 30;
-    }else if(analog_data < 1000){
-        *pos = - 10;
-    }else if(analog_data < 2300){
-        *pos = 0;
-    }else if(analog_data < 3250){
-        *pos = 10;
-    }else{
-        *pos = 30;
+static int8_t TomarPixeles(int32_t *acumulado){
+    int32_t pixeles = *acumulado / (1 << BITS_SUBPIXEL);    /* trunca hacia cero: el resto conserva el signo */
+
+    if(pixeles > INT8_MAX){
+        pixeles = INT8_MAX;
+    }else if(pixeles < -INT8_MAX){
+        pixeles = -INT8_MAX;
     }
+    *acumulado -= pixeles * (1 << BITS_SUBPIXEL);
+    return (int8_t)pixeles;
 }
 /**
- * @brief 
+ * @brief Tarea del puntero: promedia cada eje en cada trama del ADC, mide el centro en las
+ * primeras TRAMAS_CENTRO tramas y luego envía un reporte por trama.
  * 
  * @param pvParameter 
  */
 void JoystickTask(void *pvParameter){
-    static int8_t mouse_x = 0, mouse_y = 0;
-    uint16_t joystick_x, joystick_y;
+    static uint16_t muestras[ADC_CONT_FRAME_LEN];
+    static adc_ch_t canales[ADC_CONT_FRAME_LEN];
+    int32_t suma[2], cuenta[2];
+    int32_t centro[2] = {0, 0};
+    int32_t acumulado[2] = {0, 0};
+    uint16_t tramas_centro = 0;
+    uint16_t n;
+    uint8_t eje;
+    int8_t mouse_x, mouse_y;
+
     while(true){
-        if(BleHidStatus() == BLE_CONNECTED){
-            AnalogInputReadSingle(adc_y.input, &joystick_y);
-            AnalogInputReadSingle(adc_x.input, &joystick_x);
-            UpdateMouse(&mouse_x, joystick_x);
-            UpdateMouse(&mouse_y, joystick_y);
-            if(click){
-                BleHidSendMouse(HID_MOUSE_LEFT, mouse_x, mouse_y);
-                click = false;
-            }else{
-                BleHidSendMouse(0, mouse_x, mouse_y);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        suma[0] = suma[1] = 0;
+        cuenta[0] = cuenta[1] = 0;
+        // Todas las tramas pendientes forman un único reporte
+        while((n = AnalogInputReadFrame(muestras, canales)) > 0){
+            for(uint16_t i = 0; i < n; i++){
+                eje = (canales[i] == CANAL_X) ? 0 : 1;
+                suma[eje] += muestras[i];
+                cuenta[eje]++;
             }
         }
-		vTaskDelay(DELAY_MEASURE / portTICK_PERIOD_MS);
+        if(cuenta[0] == 0 || cuenta[1] == 0){
+            continue;
+        }
+        if(tramas_centro < TRAMAS_CENTRO){
+            // Joystick suelto al iniciar: centro promedio de las primeras tramas
+            for(eje = 0; eje < 2; eje++){
+                centro[eje] += suma[eje] / cuenta[eje];
+            }
+            if(++tramas_centro == TRAMAS_CENTRO){
+                centro[0] /= TRAMAS_CENTRO;
+                centro[1] /= TRAMAS_CENTRO;
+            }
+            continue;
+        }
+        if(BleHidStatus() != BLE_CONNECTED){
+            acumulado[0] = acumulado[1] = 0;
+            continue;
+        }
+        for(eje = 0; eje < 2; eje++){
+            acumulado[eje] += Velocidad(suma[eje] / cuenta[eje] - centro[eje]);
+        }
+        mouse_x = TomarPixeles(&acumulado[0]);
+        mouse_y = TomarPixeles(&acumulado[1]);
+        if(click){
+            BleHidSendMouse(HID_MOUSE_LEFT, mouse_x, mouse_y);
+            click = false;
+        }else if(mouse_x != 0 || mouse_y != 0){
+            BleHidSendMouse(0, mouse_x, mouse_y);
+        }
     }
 }
 /*==================[external functions definition]==========================*/
@@ -121,17 +237,24 @@ void app_main(void){
     GPIOInit(GPIO_23, GPIO_INPUT);
     GPIOActivInt(GPIO_23, FuncTecJoy, false, NULL);
     SwitchesInit();
-    SwitchActivInt(SWITCH_1, FuncTecla1, 0);
-    SwitchActivInt(SWITCH_2, FuncTecla2, 0);
+    SwitchEventsInit(SWITCH_1 | SWITCH_2);
     BleHidInit("EP_HID");
-    adc_x.input = CH1;
-    adc_x.mode = ADC_SINGLE;
+    CalcularCurva();
+    adc_x.input = CANAL_X;
+    adc_x.mode = ADC_CONTINUOUS;
+    adc_x.func_p = TramaJoystick;
+    adc_x.param_p = NULL;
+    adc_x.sample_frec = FRECUENCIA_JOYSTICK;
+    adc_x.oversampling = SOBREMUESTREO;
     AnalogInputInit(&adc_x);
-    adc_y.input = CH3;
-    adc_y.mode = ADC_SINGLE;
+    adc_y = adc_x;
+    adc_y.input = CANAL_Y;
+    adc_y.func_p = NULL;
     AnalogInputInit(&adc_y);
 
     xTaskCreate(&JoystickTask, "JOYSTICK", 4096, NULL, 5, &joystick_task_handle);
+    AnalogStartContinuous(CANAL_X);
+    xTaskCreate(&TeclasTask, "TECLAS", 4096, NULL, 4, &teclas_task_handle);
 
     while(1){
         vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
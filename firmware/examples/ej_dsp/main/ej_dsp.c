@@ -14,6 +14,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 02/04/2024 | Document creation		                         |
+ * | 15/10/2026 | Señal de ECG en ecg.h                          |
+ * | 15/10/2026 | Valores impresos con LOG_DEFER (log_mcu)       |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -24,40 +26,35 @@
 #include <stdint.h>
 #include <iir_filter.h>
 #include <fft.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "log_mcu.h"
+#include "ecg.h"
 /*==================[macros and definitions]=================================*/
-#define BUFFER_SIZE 256
-#define SAMPLE_FREQ	200
+#define BUFFER_SIZE ECG_LENGTH
+#define SAMPLE_FREQ	ECG_SAMPLE_FREQ
 /*==================[internal data definition]===============================*/
-float ecg[BUFFER_SIZE] = {
-     76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
-     86,  93,  93,  85,  87,  94,  98,  93,  87,  95, 104,  99,  91,
-     93, 102, 104,  99,  96, 101, 106, 102,  96,  97, 104, 106,  97,
-     94, 100, 103, 101,  91,  95, 103, 100,  94,  90,  98, 104,  94,
-     87,  93,  99,  97,  87,  86,  96,  98,  90,  83,  90,  96,  89,
-     81,  80,  87,  92,  82,  78,  84,  89,  80,  72,  78,  82,  82,
-     73,  72,  81,  82,  79,  69,  77,  82,  81,  76,  68,  78,  80,
-     76,  73,  78,  82,  82,  75,  72,  86,  84,  78,  76,  85,  95,
-     88,  81,  83,  93,  90,  86,  83,  88,  93,  86,  82,  82,  92,
-     89,  82,  82,  88,  94,  84,  82,  90,  98,  94,  87,  91,  95,
-     98,  93,  90,  97, 104, 105,  96,  93, 107, 116, 118, 127, 148,
-    181, 208, 231, 252, 241, 198, 139,  76,  43,  32,  29,  42,  65,
-     86,  90,  88,  93, 101, 107, 102,  98, 103, 110, 104,  98,  99,
-    107, 109,  96,  95, 103, 107, 102,  95,  95, 102, 105,  94,  94,
-    102, 102,  99,  94,  96, 102,  99,  90,  92, 100, 102,  95,  90,
-     98, 104,  97,  89,  94, 102, 103,  97,  93, 100, 105, 102,  93,
-     97, 104, 104, 100,  96, 108, 111, 104,  99, 101, 108, 102,  96,
-     97, 104, 104,  97,  89,  91, 100,  91,  81,  79,  85,  86,  73,
-     69,  75,  79,  75,  68,  68,  76,  76,  69,  67,  74,  81,  77,
-     71,  72,  82,  82,  76,  77,  76,  76,  75
-};
 float freq[BUFFER_SIZE];
 float ecg_filt[BUFFER_SIZE];
 float ecg_fft[BUFFER_SIZE/2];
 float f[BUFFER_SIZE/2];
 /*==================[internal functions declaration]=========================*/
 
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Imprime dos columnas con LOG_DEFER: el formato lo hace la tarea de
+ * registro. Si el anillo se llena se espera a que lo vacíe, para no perder valores.
+ */
+static void ImprimirColumnas(const float *a, const float *b, uint16_t n){
+	for(uint16_t i=0; i<n; i++){
+		while(!LOG_DEFER("%f, %f\n", a[i], b[i])){
+			vTaskDelay(1);
+		}
+	}
+}
 /*==================[external functions definition]==========================*/
 void app_main(void){
+	LogDeferInit(1);
     /* Filtro pasa bajo de orden 4 con frecuencia de corte en 40Hz */
 	LowPassInit(SAMPLE_FREQ, 40, ORDER_4);
     /* Filtro pasa altos de orden 4 con frecuencia de corte en 1Hz */
@@ -66,11 +63,9 @@ void app_main(void){
 	LowPassFilter(ecg, ecg_filt, BUFFER_SIZE);
 	HiPassFilter(ecg_filt, ecg_filt, BUFFER_SIZE);
     /* Se imprimen por consola los valores de la señal sin filtrar y filtrada */
-    printf("****Filtros****\n");
-    printf("ECG, ECG_filtrado\n");
-	for(int16_t i=0; i<BUFFER_SIZE; i++){
-		printf("%f, %f\n", ecg[i], ecg_filt[i]);
-	}
+    LOG_DEFER("****Filtros****\n");
+    LOG_DEFER("ECG, ECG_filtrado\n");
+	ImprimirColumnas(ecg, ecg_filt, BUFFER_SIZE);
 
     /* Inicialización del módulo para cálculo de la FFT */
     FFTInit();
@@ -79,10 +74,8 @@ void app_main(void){
     /* Cálculo de la magnitud de la FFT */
     FFTMagnitude(ecg, ecg_fft, BUFFER_SIZE);
     /* Se imprimen por consola los valores de frequencia y magnitud correspondiente */
-    printf("****FFT****\n");
-    printf("Frecuencia, Magnitud\n");
-	for(int16_t i=0; i<BUFFER_SIZE/2; i++){
-		printf("%f, %f\n", f[i], ecg_fft[i]);
-	}
+    LOG_DEFER("****FFT****\n");
+    LOG_DEFER("Frecuencia, Magnitud\n");
+	ImprimirColumnas(f, ecg_fft, BUFFER_SIZE/2);
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -0,0 +1,81 @@
+/*! @mainpage Benchmark DSP
+ *
+ * @section genDesc General Description
+ *
+ * Este proyecto mide el costo de las funcionalidades de Procesamiento Digital
+ * de Señales (DSP) de la capa middelware.
+ * Se filtra una señal de prueba con filtros pasa bajos de orden 2 a 8 de dos
+ * formas: con el kernel de secciones en cascada (IirFilter, una sola pasada por
+ * la señal) y con una llamada a dsps_biquad_f32 por sección (IirFilterMultiPass).
+ * Por consola se imprimen los ciclos de CPU por muestra de cada camino y la
+ * máxima diferencia entre ambas salidas.
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 14/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "esp_cpu.h"
+#include <iir_filter.h>
+/*==================[macros and definitions]=================================*/
+#define BUFFER_SIZE 1024
+#define SAMPLE_FREQ	200
+#define CUT_FREQ	20
+#define REPETITIONS 10
+/*==================[internal data definition]===============================*/
+float signal[BUFFER_SIZE];
+float out_fused[BUFFER_SIZE];
+float out_multipass[BUFFER_SIZE];
+iir_filter_t filter_fused, filter_multipass;
+/*==================[internal functions declaration]=========================*/
+typedef void (*filter_func_t)(iir_filter_t *, float *, float *, int16_t);
+
+/**
+ * @brief Filtra la señal de prueba REPETITIONS veces
+ * 
+ * @param func Función de filtrado a medir
+ * @param filter Filtro a utilizar
+ * @param output Señal filtrada
+ * @return float Ciclos de CPU por muestra
+ */
+static float MeasureCycles(filter_func_t func, iir_filter_t *filter, float *output){
+	uint32_t start, cycles = 0;
+	for(uint8_t i = 0; i < REPETITIONS; i++){
+		start = esp_cpu_get_cycle_count();
+		func(filter, signal, output, BUFFER_SIZE);
+		cycles += esp_cpu_get_cycle_count() - start;
+	}
+	return (float)cycles / (REPETITIONS * BUFFER_SIZE);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	filter_order_t orders[] = {ORDER_2, ORDER_4, ORDER_6, ORDER_8};
+	float fused, multipass, error;
+
+	/* Señal de prueba: suma de dos senoidales */
+	for(int16_t i = 0; i < BUFFER_SIZE; i++){
+		signal[i] = sinf(2 * M_PI * 5 * i / SAMPLE_FREQ) + 0.5f * sinf(2 * M_PI * 60 * i / SAMPLE_FREQ);
+	}
+	printf("****Filtros IIR (ciclos por muestra)****\n");
+	printf("Orden, Una pasada, Una pasada por seccion, Error maximo\n");
+	for(uint8_t j = 0; j < sizeof(orders) / sizeof(orders[0]); j++){
+		/* ambos caminos parten del mismo estado para poder comparar las salidas */
+		IirLowPassInit(&filter_fused, SAMPLE_FREQ, CUT_FREQ, orders[j]);
+		IirLowPassInit(&filter_multipass, SAMPLE_FREQ, CUT_FREQ, orders[j]);
+		fused = MeasureCycles(IirFilter, &filter_fused, out_fused);
+		multipass = MeasureCycles(IirFilterMultiPass, &filter_multipass, out_multipass);
+		error = 0;
+		for(int16_t i = 0; i < BUFFER_SIZE; i++){
+			error = fmaxf(error, fabsf(out_fused[i] - out_multipass[i]));
+		}
+		printf("%d, %.1f, %.1f, %e\n", orders[j], fused, multipass, error);
+	}
+}
+/*==================[end of file]============================================*/
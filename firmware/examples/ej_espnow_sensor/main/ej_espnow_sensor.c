@@ -0,0 +1,255 @@
+/*! @mainpage Ejemplo Sensores distribuidos por ESP-NOW
+ *
+ * @section genDesc General Description
+ *
+ * Dos placas con acelerómetro, una en el pecho y otra en la espalda, fusionadas
+ * en una sola: la placa de la espalda (ROL_NODO) envía cada muestra por
+ * ESP-NOW a través del sumidero de telemetría (TELEMETRY_ESPNOW), sin conexión
+ * ni punto de acceso, y la del pecho (ROL_CENTRAL) las recibe con
+ * TelemetryEspNowListen y las combina con las propias.
+ *
+ * Las dos placas comparten la base de tiempo (time_sync.h): la central es el
+ * maestro y el nodo le pide la hora cada segundo, así cada muestra de la
+ * espalda lleva el instante en que se tomó en el tiempo de la central, que
+ * calcula con él la antigüedad de la muestra al recibirla.
+ *
+ * Cada segundo la central imprime por la UART_PC la inclinación de cada placa,
+ * la diferencia entre ambas (curvatura de la espalda), las muestras recibidas
+ * y perdidas y la antigüedad media y máxima de las muestras de la espalda. El mismo programa sirve para las dos placas: sólo cambia ROL.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	ADXL335 X	| 	CH1			|
+ * | 	ADXL335 Y	| 	CH2			|
+ * | 	ADXL335 Z	| 	CH3			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 15/10/2026 | Document creation		                         |
+ * | 15/10/2026 | Base de tiempo común (time_sync)               |
+ *
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "led.h"
+#include "uart_mcu.h"
+#include "accel_sensor.h"
+#include "espnow_mcu.h"
+#include "timestamp_mcu.h"
+
+#include "telemetry.h"
+#include "spsc_ring.h"
+#include "text_format.h"
+#include "time_sync.h"
+/*==================[macros and definitions]=================================*/
+#define ROL_NODO            0       /* Espalda: envía sus muestras */
+#define ROL_CENTRAL         1       /* Pecho: recibe y fusiona */
+#define ROL                 ROL_CENTRAL
+#define CANAL               1       /* Canal Wi-Fi, el mismo en las dos placas */
+#define LOTE_ACK            4       /* Tramas por confirmación de la central (0: sin confirmaciones) */
+#define FRECUENCIA_MUESTREO 100     /* Hz */
+#define TIPO_MUESTRA        0x70    /* ax, ay, az en mili-g (int16) e instante en us (uint32, tiempo común) */
+#define LARGO_MUESTRA       10
+#define PERIODO_INFORME_MS  1000
+#define PERIODO_SYNC_MS     1000
+#define LED_RECEPCION       LED_1
+#define RAD_A_GRADOS        57.2958f
+/*==================[internal data definition]===============================*/
+SPSC_RING_DEFINE(cola_muestras, telemetry_record_t, 32);
+static TaskHandle_t tarea_muestreo = NULL;
+static int8_t sensor;
+/* Última muestra de la espalda (escrita en la tarea de Wi-Fi) */
+static volatile int16_t espalda_mg[3];
+static volatile bool espalda_nueva = false;
+/* Antigüedad de las muestras de la espalda al recibirlas (us) */
+static volatile uint32_t antiguedad_suma = 0;
+static volatile uint32_t antiguedad_max = 0;
+static volatile uint16_t antiguedad_n = 0;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Inclinación respecto de la vertical (°)
+ */
+static float Inclinacion(float x, float y, float z){
+    float modulo = sqrtf(x * x + y * y + z * z);
+    return (modulo > 0.0f) ? acosf(z / modulo) * RAD_A_GRADOS : 0.0f;
+}
+
+/**
+ * @brief Muestra recibida de la espalda (tarea de Wi-Fi: sólo la copia)
+ */
+static void RecibirMuestra(const uint8_t *mac, const telemetry_record_t *registro){
+    uint32_t instante, antiguedad;
+
+    if(registro->type != TIPO_MUESTRA || registro->length != LARGO_MUESTRA){
+        return;
+    }
+    for(uint8_t i = 0; i < 3; i++){
+        espalda_mg[i] = registro->payload[2 * i] | (registro->payload[2 * i + 1] << 8);
+    }
+    memcpy(&instante, &registro->payload[6], sizeof(instante));
+    antiguedad = (uint32_t)TimestampSyncUs() - instante;
+    antiguedad_suma += antiguedad;
+    antiguedad_max = (antiguedad > antiguedad_max) ? antiguedad : antiguedad_max;
+    antiguedad_n++;
+    espalda_nueva = true;
+}
+
+/**
+ * @brief Lee las muestras del acelerómetro; el nodo las envía y la central
+ * conserva la última
+ */
+static void Muestreo(void *pvParameter){
+    static accel_frame_t trama;
+    uint8_t muestra[LARGO_MUESTRA];
+    int16_t mg[3];
+    uint32_t instante;
+    float *pecho = pvParameter;
+    uint16_t n;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while((n = AccelSensorRead(sensor, &trama)) > 0){
+            if(ROL == ROL_NODO){
+                // El lote se leyó recién: la última muestra es de ahora
+                instante = (uint32_t)TimestampSyncUs() - (n - 1) * (1000000 / FRECUENCIA_MUESTREO);
+                for(uint16_t i = 0; i < n; i++){
+                    mg[0] = trama.x[i] * 1000.0f;
+                    mg[1] = trama.y[i] * 1000.0f;
+                    mg[2] = trama.z[i] * 1000.0f;
+                    memcpy(muestra, mg, sizeof(mg));
+                    memcpy(&muestra[6], &instante, sizeof(instante));
+                    instante += 1000000 / FRECUENCIA_MUESTREO;
+                    TelemetryPush(&cola_muestras, TIPO_MUESTRA, muestra, sizeof(muestra));
+                }
+            } else{
+                pecho[0] = trama.x[n - 1];
+                pecho[1] = trama.y[n - 1];
+                pecho[2] = trama.z[n - 1];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Imprime la inclinación de las dos placas y el estado del enlace
+ */
+static void Informar(const float *pecho){
+    telemetry_stats_t enlace;
+    char msg[192];
+    char *p = msg;
+    float angulo_pecho = Inclinacion(pecho[0], pecho[1], pecho[2]);
+    float angulo_espalda = Inclinacion(espalda_mg[0], espalda_mg[1], espalda_mg[2]);
+
+    TelemetryGetStats(&enlace);
+    p += FmtStr(p, "Pecho ");
+    p += FmtFloat(p, angulo_pecho, 1);
+    p += FmtStr(p, " grados, espalda ");
+    p += FmtFloat(p, angulo_espalda, 1);
+    p += FmtStr(p, " grados, diferencia ");
+    p += FmtFloat(p, angulo_pecho - angulo_espalda, 1);
+    p += FmtStr(p, " (");
+    p += FmtUint(p, enlace.received, 10);
+    p += FmtStr(p, " recibidas, ");
+    p += FmtUint(p, enlace.gaps, 10);
+    p += FmtStr(p, " tramas perdidas)");
+    if(antiguedad_n > 0){
+        p += FmtStr(p, ", antigüedad ");
+        p += FmtUint(p, antiguedad_suma / antiguedad_n, 10);
+        p += FmtStr(p, " us, máx. ");
+        p += FmtUint(p, antiguedad_max, 10);
+        p += FmtStr(p, " us");
+        antiguedad_suma = 0;
+        antiguedad_max = 0;
+        antiguedad_n = 0;
+    }
+    p += FmtStr(p, "\r\n");
+    UartSendString(UART_PC, msg);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+    static float pecho[3];
+    serial_config_t uart_pc = {
+        .port = UART_PC,
+        .baud_rate = 115200,
+        .func_p = UART_NO_INT,
+        .param_p = NULL
+    };
+    accel_sensor_config_t adxl335 = {
+        .type = ACCEL_SENSOR_ADXL335,
+        .sample_frec = FRECUENCIA_MUESTREO,
+        .oversampling = 4
+    };
+    telemetry_espnow_config_t espnow = {
+        .peer = NULL,               // A todas las placas del canal
+        .channel = CANAL,
+        .ack_batch = LOTE_ACK
+    };
+    time_sync_config_t sync = {
+        .role = (ROL == ROL_NODO) ? TIME_SYNC_CLIENT : TIME_SYNC_MASTER,
+        .master = NULL,             // Pedidos a todas las placas: la central contesta
+        .channel = CANAL,
+        .period_ms = PERIODO_SYNC_MS
+    };
+    uint8_t mac[6];
+    char msg[32];
+    char *p = msg;
+    bool ok;
+
+    LedsInit();
+    UartInit(&uart_pc);
+    if(ROL == ROL_NODO){
+        TelemetryAddSource(&cola_muestras);
+        ok = TelemetryInitEspNow(&espnow, 4);   // Prioridad alta: la latencia manda
+    } else{
+        ok = TelemetryEspNowListen(CANAL, RecibirMuestra);
+    }
+    ok = ok && TimeSyncInit(&sync, 3);
+    if(!ok){
+        UartSendString(UART_PC, "No se pudo iniciar ESP-NOW\r\n");
+        return;
+    }
+    EspNowGetMac(mac);
+    p += FmtStr(p, "MAC ");
+    for(uint8_t i = 0; i < 6; i++){
+        if(mac[i] < 0x10){
+            p += FmtStr(p, "0");
+        }
+        p += FmtUint(p, mac[i], 16);
+        p += FmtStr(p, (i < 5) ? ":" : "\r\n");
+    }
+    UartSendString(UART_PC, msg);
+
+    sensor = AccelSensorAdd(&adxl335);
+    xTaskCreate(Muestreo, "Muestreo", 3072, pecho, 5, &tarea_muestreo);
+    AccelSensorStart(tarea_muestreo);
+
+    while(1){
+        vTaskDelay(PERIODO_INFORME_MS / portTICK_PERIOD_MS);
+        if(ROL == ROL_CENTRAL){
+            Informar(pecho);
+            if(espalda_nueva){
+                LedToggle(LED_RECEPCION);
+                espalda_nueva = false;
+            } else{
+                LedOff(LED_RECEPCION);
+            }
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,179 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 18:00:00 2026
+
+@author: Albano Peñalva
+
+Codificador IMA-ADPCM (4 bits por muestra) para el reproductor de audio.
+Genera un archivo .h con la canción en bloques independientes, que se
+decodifican en la placa con AdpcmDecodeBlock (adpcm.h, middelware):
+
+    bytes 0-1   predictor antes de la primera muestra (int16, little endian)
+    byte 2      índice de paso antes de la primera muestra (0 a 88)
+    byte 3      reservado (0)
+    bytes 4...  muestras, dos por byte, la primera en el nibble bajo
+
+La canción ocupa la mitad que en PCM de 8 bits (song.h de wav_to_edu.py).
+El último bloque se completa con silencio; N_SONG es el largo real.
+
+Uso:
+    python adpcm_encoder.py cancion.wav --inicio 0 --fin 58
+    python adpcm_encoder.py main/song.h          (PCM de 8 bits de wav_to_edu.py)
+
+Con --verificar se decodifica el resultado y se imprime la relación señal a
+ruido de la codificación.
+"""
+
+# Librerías
+import argparse
+import math
+import re
+
+INDICES = [-1, -1, -1, -1, 2, 4, 6, 8]
+PASOS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+CABECERA = 4
+
+
+def decodificar_nibble(estado, codigo):
+    """Igual que DecodeNibble (adpcm.c): el codificador sigue al decodificador."""
+    predictor, indice = estado
+    paso = PASOS[indice]
+    dif = paso >> 3
+    if codigo & 4:
+        dif += paso
+    if codigo & 2:
+        dif += paso >> 1
+    if codigo & 1:
+        dif += paso >> 2
+    predictor = predictor - dif if codigo & 8 else predictor + dif
+    predictor = max(-32768, min(32767, predictor))
+    indice = max(0, min(88, indice + INDICES[codigo & 7]))
+    return predictor, indice
+
+
+def codificar_muestra(estado, muestra):
+    predictor, indice = estado
+    paso = PASOS[indice]
+    dif = muestra - predictor
+    codigo = 0
+    if dif < 0:
+        codigo = 8
+        dif = -dif
+    if dif >= paso:
+        codigo |= 4
+        dif -= paso
+    if dif >= paso >> 1:
+        codigo |= 2
+        dif -= paso >> 1
+    if dif >= paso >> 2:
+        codigo |= 1
+    return codigo, decodificar_nibble(estado, codigo)
+
+
+def codificar(pcm, bloque):
+    """Codifica muestras de 16 bits en bloques de 'bloque' muestras."""
+    resto = len(pcm) % bloque
+    if resto:
+        pcm = pcm + [0] * (bloque - resto)
+    salida = bytearray()
+    estado = (0, 0)
+    for inicio in range(0, len(pcm), bloque):
+        # Cabecera: estado al comenzar el bloque (bloques independientes)
+        predictor, indice = estado
+        salida += int(predictor).to_bytes(2, 'little', signed=True)
+        salida += bytes([indice, 0])
+        for i in range(inicio, inicio + bloque, 2):
+            bajo, estado = codificar_muestra(estado, pcm[i])
+            alto, estado = codificar_muestra(estado, pcm[i + 1])
+            salida.append(bajo | (alto << 4))
+    return bytes(salida)
+
+
+def decodificar(datos, bloque, n):
+    tam = CABECERA + bloque // 2
+    pcm = []
+    for inicio in range(0, len(datos), tam):
+        estado = (int.from_bytes(datos[inicio:inicio + 2], 'little', signed=True), datos[inicio + 2])
+        for byte in datos[inicio + CABECERA:inicio + tam]:
+            for codigo in (byte & 0x0F, byte >> 4):
+                estado = decodificar_nibble(estado, codigo)
+                pcm.append(estado[0])
+    return pcm[:n]
+
+
+def leer_wav(archivo, inicio, fin, frecuencia):
+    """Recorte, submuestreo y escalado a 16 bits, como wav_to_edu.py."""
+    import numpy as np
+    from scipy import signal
+    from scipy.io import wavfile
+    fs, datos = wavfile.read(archivo)
+    senial = datos[:, 0] if datos.ndim > 1 else datos
+    senial = senial[int(inicio * fs):int(fin * fs) if fin else None].astype(np.float64)
+    senial = signal.resample(senial, int(len(senial) * frecuencia / fs))
+    senial = senial / np.max(np.abs(senial))
+    return [int(v) for v in np.round(senial * 32767)]
+
+
+def leer_song_h(archivo):
+    """Muestras de 8 bits (0 a 255) del song.h de wav_to_edu.py, a 16 bits."""
+    texto = open(archivo).read()
+    n = int(re.search(r'#define N_SONG (\d+)', texto).group(1))
+    valores = texto[texto.index('{') + 1:texto.index('}')].split(',')
+    muestras = [int(float(v)) for v in valores if v.strip()][:n]
+    return [(m - 128) * 256 for m in muestras]
+
+
+def guardar(salida, datos, n, bloque, nombre, artista, frecuencia):
+    with open(salida, 'w') as f:
+        f.write('/**\n')
+        f.write(' * @file song_adpcm.h\n')
+        f.write(f' * @brief Audio signal of "{nombre}" song, IMA-ADPCM blocks (see adpcm.h).\n')
+        f.write(' * @note Created with adpcm_encoder.py script\n')
+        f.write(' */\n')
+        f.write(f'#define N_SONG {n}\n')
+        f.write(f'#define SONG_NAME "{nombre}"\n')
+        f.write(f'#define SONG_ARTIST "{artista}"\n')
+        f.write(f'#define SONG_FREC {frecuencia}\n')
+        f.write(f'#define SONG_BLOCK {bloque}\n')
+        f.write(f'#define SONG_BLOCKS {(n + bloque - 1) // bloque}\n')
+        f.write('const uint8_t song_adpcm[] = {\n')
+        for i in range(0, len(datos), 32):
+            f.write(','.join(str(b) for b in datos[i:i + 32]) + ',\n')
+        f.write('};\n')
+
+
+# %% Programa principal
+parser = argparse.ArgumentParser(description='Codificador IMA-ADPCM para el reproductor de audio')
+parser.add_argument('entrada', help='archivo .wav o song.h (PCM de 8 bits de wav_to_edu.py)')
+parser.add_argument('-o', '--salida', default='main/song_adpcm.h', help='archivo .h generado')
+parser.add_argument('-b', '--bloque', type=int, default=1024, help='muestras por bloque (par)')
+parser.add_argument('-f', '--frecuencia', type=int, default=8000, help='frecuencia de muestreo (solo .wav)')
+parser.add_argument('--inicio', type=float, default=0, help='inicio del recorte en segundos (solo .wav)')
+parser.add_argument('--fin', type=float, default=0, help='fin del recorte en segundos, 0: hasta el final (solo .wav)')
+parser.add_argument('--nombre', default='Mariposa Teknicolor')
+parser.add_argument('--artista', default='Fito Paez')
+parser.add_argument('--verificar', action='store_true', help='decodificar e imprimir la relación señal a ruido')
+args = parser.parse_args()
+
+if args.bloque % 2:
+    parser.error('el bloque debe tener una cantidad par de muestras')
+if args.entrada.lower().endswith('.wav'):
+    pcm = leer_wav(args.entrada, args.inicio, args.fin, args.frecuencia)
+else:
+    pcm = leer_song_h(args.entrada)
+datos = codificar(pcm, args.bloque)
+guardar(args.salida, datos, len(pcm), args.bloque, args.nombre, args.artista, args.frecuencia)
+print(f'{len(pcm)} muestras, {len(datos)} bytes ({len(pcm) / len(datos):.2f} muestras por byte)')
+if args.verificar:
+    decodificada = decodificar(datos, args.bloque, len(pcm))
+    ruido = sum((a - b) ** 2 for a, b in zip(pcm, decodificada))
+    snr = 10 * math.log10(sum(a ** 2 for a in pcm) / max(ruido, 1))
+    print(f'SNR {snr:.1f} dB')
@@ -3,6 +3,53 @@
  *
  * @section genDesc General Description
  *
+ * El audio sale por la salida analógica mediante DMA (audio_out_mcu): el
+ * periférico reproduce un bloque de 1024 muestras mientras la tarea Audio
+ * escribe el siguiente, avisada por el callback de bloque enviado. No hay una
+ * interrupción por muestra, por lo que la frecuencia de muestreo puede subir
+ * hasta 48 kSPS (la canción está grabada a 8 kSPS).
+ *
+ * La canción está guardada en flash en IMA-ADPCM (4 bits por muestra, la
+ * mitad que en PCM de 8 bits; song_adpcm.h, generado con adpcm_encoder.py):
+ * la tarea Audio decodifica cada bloque (AdpcmDecodeBlock) justo antes de
+ * escribirlo en la salida.
+ *
+ * La canción, las fuentes y los íconos no se compilan con el programa: están
+ * en un paquete de recursos (asset_pack.h) que el build genera y graba en la
+ * partición "assets". El programa lo mapea al iniciar y los usa directamente
+ * desde la flash, así la imagen de la aplicación es más chica y se compila y
+ * graba más rápido (idf.py app-flash no vuelve a grabar los recursos).
+ *
+ * El vúmetro se calcula en tres etapas encadenadas:
+ * 1. Audio: cuando un bloque empieza a sonar (aviso de bloque enviado) copia
+ *    sus muestras decodificadas en una cola sin bloqueos (spsc_ring).
+ * 2. Analisis: calcula la FFT y la altura de las barras de cada bloque de la
+ *    cola y publica el cuadro resultante (seqlock).
+ * 3. Plot: dibuja el último cuadro publicado; si la pantalla es lenta, los
+ *    cuadros intermedios se descartan (gana el más reciente).
+ * Así una pantalla lenta no atrasa el análisis ni el audio, y lo que se
+ * dibuja corresponde al bloque que está sonando.
+ *
+ * Con CONFIG_DRIVERS_TRACE (menuconfig: Drivers) se registran el envío de
+ * cada bloque, su entrega al análisis, el análisis y la graficación. Al
+ * terminar la canción se imprimen el período de los bloques (128 ms), la
+ * latencia entre la entrega y el fin del análisis y entre la entrega y la
+ * graficación, los bloques y cuadros descartados, y el trazado en formato JSON
+ * para abrir en ui.perfetto.dev.
+ *
+ * El envío de bloques se supervisa con period_monitor: al terminar la canción
+ * se imprimen el período medido, el histograma de jitter, los bloques atrasados
+ * o perdidos y los bloques de silencio enviados porque la tarea Audio no
+ * escribió a tiempo.
+ *
+ * Las prioridades de las cuatro tareas salen de plan_tareas (rt_schedule_mcu.h):
+ * período, plazo y tiempo de ejecución estimado de cada una. Al arrancar se
+ * asignan por plazo (Audio, Analisis, Plot y Teclas, en ese orden) y se
+ * verifica que se cumplan todos los plazos.
+ *
+ * También se imprime el uso de memoria (MemReportPrint): variables estáticas
+ * y heap libre y mínimo por capacidad. La pila de 32 KB de la tarea Plot se
+ * toma del heap interno.
  *
  * @section hardConn Hardware Connection
  *
@@ -29,6 +76,17 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 14/10/2026 | Marcadores de pico en el vúmetro               |
+ * | 15/10/2026 | Puntos de trazado del DAC y la graficación     |
+ * | 15/10/2026 | Supervisión del período de muestra del DAC     |
+ * | 15/10/2026 | Reporte de uso de memoria                      |
+ * | 15/10/2026 | Salida de audio por bloques con DMA            |
+ * | 15/10/2026 | Canción en IMA-ADPCM decodificada por bloques  |
+ * | 15/10/2026 | Análisis y graficación del vúmetro separados   |
+ * | 15/10/2026 | Tecla de inicio por eventos sin rebote         |
+ * | 15/10/2026 | Título y artista medidos una sola vez          |
+ * | 15/10/2026 | Canción, fuentes e íconos en partición aparte  |
+ * | 15/10/2026 | Prioridades desde un plan de tareas            |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -40,10 +98,11 @@
 #include <string.h>
 #include <math.h>
 
-#include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
-#include "analog_io_mcu.h"
+#include "audio_out_mcu.h"
+#include "trace_mcu.h"
+#include "rt_schedule_mcu.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -52,55 +111,176 @@
 #include "ili9341.h"
 
 #include "vumeter.h"
-#include "song.h"
 
 #include "fft.h"
+#include "adpcm.h"
+#include "band_energy.h"
+#include "period_monitor.h"
+#include "mem_report.h"
+#include "spsc_ring.h"
+#include "seqlock.h"
+#include "asset_pack.h"
 /*==================[macros and definitions]=================================*/
-#define SAMPLE_FREQ	        8000        /* 8 kSPS */
-#define T_SENIAL            125         /* 0.125 ms */
-#define CHUNK               1024 
-#define MAX_DAC             256        /* DAC: 8 bits*/
+#define SAMPLE_FREQ	        8000        /* 8 kSPS, el de la canción */
+#define CHUNK               1024        /* Muestras por bloque de DMA y de ADPCM, el de la canción */
+#define PARTICION_RECURSOS  "assets"    /* Partición con el paquete de recursos (partitions.csv) */
+#define T_BLOQUE            (CHUNK * 1000000UL / SAMPLE_FREQ)  /* 128 ms */
+#define Q15_SHIFT           8          /* escala de las barras */
 #define VUM_BARS            16
 #define COLOR_MAIN_1        0x3e98
 #define COLOR_MAIN_2        0x5419
 #define COLOR_MAIN_3        0x6ab8
 #define COLOR_MAIN_4        0x71b9
 #define COLOR_BG_1          0x0884
+#define TRACE_ANALISIS      TRACE_ID_USER       /* Análisis de un bloque */
+#define TRACE_AVISO         (TRACE_ID_USER + 1) /* Entrega de un bloque al análisis */
+#define TRACE_GRAFICO       (TRACE_ID_USER + 2) /* Graficación de un bloque */
+#define PLAZO_BLOQUE_NS     128500000           /* Período de bloque con 0,5 ms de tolerancia */
+#define TOLERANCIA_BLOQUE   500                 /* Atraso aceptado de un bloque (us) */
+#define COLA_ANALISIS       4                   /* Bloques en espera de análisis (3 útiles) */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Bloque que empieza a sonar, entregado al análisis
+ */
+typedef struct {
+    uint32_t bloque;                /* Número de bloque de la canción */
+    bool fin;                       /* Fin de la canción (sin muestras) */
+    int16_t muestras[CHUNK];        /* Muestras decodificadas (Q15) */
+} bloque_audio_t;
+
+/**
+ * @brief Cuadro del vúmetro, publicado por el análisis
+ */
+typedef struct {
+    uint32_t bloque;                /* Bloque analizado */
+    bool fin;                       /* Fin de la canción: resetear pantalla */
+    uint8_t barras[VUM_BARS];       /* Altura de las barras */
+} cuadro_t;
+/**
+ * @brief Tareas del plan (índices de plan_tareas)
+ */
+enum {
+    TAREA_AUDIO,
+    TAREA_ANALISIS,
+    TAREA_PLOT,
+    TAREA_TECLAS,
+    CANTIDAD_TAREAS
+};
 /*==================[internal data definition]===============================*/
+/* Plan de tareas (us): una activación de Audio, Analisis y Plot por bloque */
+static rt_task_t plan_tareas[CANTIDAD_TAREAS] = {
+    /* Escribe el bloque siguiente mucho antes de que se termine el que suena */
+    [TAREA_AUDIO] = {.name = "Audio", .period_us = T_BLOQUE, .deadline_us = 20000, .wcet_us = 3000},
+    /* El cuadro tiene que estar antes de que empiece a sonar el bloque siguiente */
+    [TAREA_ANALISIS] = {.name = "Analisis", .period_us = T_BLOQUE, .deadline_us = 64000, .wcet_us = 8000},
+    [TAREA_PLOT] = {.name = "Plot", .period_us = T_BLOQUE, .wcet_us = 40000},
+    /* A lo sumo una pulsación cada 200 ms */
+    [TAREA_TECLAS] = {.name = "Teclas", .period_us = 200000, .wcet_us = 200},
+};
 TaskHandle_t plot_task_handle = NULL;
-static float fft[CHUNK/2];
-static float chunk[CHUNK];
+TaskHandle_t audio_task_handle = NULL;
+TaskHandle_t analisis_task_handle = NULL;
+TaskHandle_t teclas_task_handle = NULL;
+static uint16_t fft[CHUNK/2];
+static int16_t chunk[CHUNK];
+static int16_t pcm[2][CHUNK];           /* Bloques decodificados: el último escrito y el siguiente */
+static uint16_t bands[VUM_BARS];
+static band_map_t bands_map;
 static uint32_t song_index = 0;
-static bool reset = false;
+static volatile bool pedido_inicio = false;
+static period_monitor_t monitor_audio;
+static uint32_t cuadros_publicados = 0;
+static uint32_t cuadros_dibujados = 0;
+static ili9341_text_t titulo, artista;
+/* Recursos: apuntan a la partición mapeada */
+static asset_audio_t cancion;
+static const uint8_t *song_adpcm;
+static Font_t fuente_19, fuente_22;
+static icon_font_t iconos_22, iconos_30;
+SPSC_RING_DEFINE(cola_analisis, bloque_audio_t, COLA_ANALISIS);
+SEQLOCK_DEFINE(ultimo_cuadro, cuadro_t);
 /*==================[internal functions declaration]=========================*/
 /**
- * @brief Función ejecutada en la interrupción de la tecla 1.
- * Inicializa el Timer.
+ * @brief Función ejecutada en la interrupción de bloque enviado de la salida
+ * de audio: hay lugar para un bloque más.
  * 
  */
-void FuncSwitchStart(void *param){
-    reset = false;
-    TimerStart(TIMER_B);
+void FuncBloqueLibre(void* param){
+    PeriodMonitorTick(&monitor_audio);
+    xTaskNotifyGive(audio_task_handle);
 }
 
 /**
- * @brief Función ejecutada en la interrupción del Timer. 
- * Reproduce la señal de audio mediante el DAC.
+ * @brief Entrega un bloque (o el fin de la canción) a la tarea de análisis.
  * 
+ * @param bloque Número de bloque, sus muestras están en pcm[bloque % 2]
+ * @param fin Fin de la canción
  */
-void FuncTimerSenial(void* param){
-    AnalogOutputWrite(song[song_index]);
-    song_index++;
-    if(song_index%CHUNK == 0){
-        /* Graficar cada 1024 (CHUNK) muestras reproducidas */
-        xTaskNotifyGive(plot_task_handle);
+static void EntregarBloque(uint32_t bloque, bool fin){
+    static bloque_audio_t entrega;      /* 2 KB: fuera de la pila de la tarea Audio */
+
+    entrega.bloque = bloque;
+    entrega.fin = fin;
+    if(!fin){
+        memcpy(entrega.muestras, pcm[bloque % 2], sizeof(entrega.muestras));
     }
-    if(song_index == N_SONG){
-        song_index = 0;
-        TimerStop(TIMER_B);
-        reset = true;
-        /* Resetear pantalla */
-        xTaskNotifyGive(plot_task_handle);
+    TRACE_INSTANT(TRACE_AVISO, bloque);
+    /* Con la cola llena el bloque se descarta (SpscRingDropped): el audio no espera */
+    SpscRingPush(&cola_analisis, &entrega);
+    xTaskNotifyGive(analisis_task_handle);
+}
+
+/**
+ * @brief Tarea encargada de decodificar la canción y escribirla en la salida
+ * de audio, un bloque (CHUNK muestras) por cada bloque enviado.
+ * 
+ * En cada aviso de bloque enviado empieza a sonar el bloque escrito en el
+ * aviso anterior: ese es el que se entrega al análisis.
+ * 
+ * @param pvParameter 
+ */
+static void AudioTask(void *pvParameter){
+    bool reproduciendo = false;
+    uint8_t bloques_finales = 0;
+    int32_t pendiente = -1;             /* Bloque escrito que empieza a sonar en el próximo aviso */
+    uint32_t n, escritas, bloque;
+
+    while(true){
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        if(!reproduciendo){
+            if(pedido_inicio){
+                pedido_inicio = false;
+                reproduciendo = true;
+                song_index = 0;
+                bloques_finales = 0;
+                pendiente = -1;
+                PeriodMonitorReset(&monitor_audio);
+                AudioOutStart();
+            }
+            continue;
+        }
+        if(pendiente >= 0){
+            EntregarBloque(pendiente, false);
+            pendiente = -1;
+        }
+        if(song_index < cancion.samples){
+            bloque = song_index / CHUNK;
+            if(song_index % CHUNK == 0){
+                AdpcmDecodeBlock(&song_adpcm[bloque * ADPCM_BLOCK_BYTES(CHUNK)], CHUNK, pcm[bloque % 2]);
+            }
+            n = ((bloque + 1) * CHUNK < cancion.samples) ? (bloque + 1) * CHUNK - song_index : cancion.samples - song_index;
+            escritas = AudioOutWritePcm(&pcm[bloque % 2][song_index % CHUNK], n, 0);
+            song_index += escritas;
+            if(escritas > 0 && (song_index % CHUNK == 0 || song_index == cancion.samples)){
+                pendiente = bloque;
+            }
+        }else if(++bloques_finales > AUDIO_OUT_BLOCKS){
+            /* Los últimos bloques escritos ya se enviaron */
+            AudioOutStop();
+            reproduciendo = false;
+            /* Resetear pantalla */
+            EntregarBloque(0, true);
+        }
     }
 }
 
@@ -108,28 +288,19 @@ void FuncTimerSenial(void* param){
  * @brief Calcula la altura de cada una de las barras del vúmetro a partir
  * del análisis de un segmento de la señal.
  * 
- * @param song Puntero a segmento de la señal
+ * @param song Puntero a segmento de la señal (decodificado, Q15)
  * @param bars Puntero a array con la altura de las barras
  */
-void Song2Bars(const uint8_t* song, uint8_t* bars){
-    float aux;
-    uint16_t steps;
+void Song2Bars(const int16_t* song, uint8_t* bars){
+    uint32_t aux;
 
-    /* Restar continua */
-    for(uint16_t i=0; i<CHUNK; i++){
-        chunk[i] = song[i] - (MAX_DAC/2);
-    }
-    /* Calculo de FFT */
-    FFTMagnitude(chunk, fft, CHUNK);
+    memcpy(chunk, song, sizeof(chunk));
+    /* Calculo de FFT en punto fijo */
+    FFTMagnitudeQ15(chunk, fft, CHUNK);
     /* Calcular la altura de las barras a partir de los valores de la FFT */
-    steps = (CHUNK / 2) / VUM_BARS;
+    BandEnergyQ15(&bands_map, fft, bands);
     for(uint8_t i=0; i<VUM_BARS; i++){
-        aux = 0;
-        for(uint16_t j=0; j<steps; j++){
-            /* Acumulado para cada barra */
-            aux += fft[steps*i+j] / steps;
-        }
-        aux = aux * 100;      /* ajustar en pantalla */
+        aux = ((uint32_t)bands[i] * 100) >> Q15_SHIFT;      /* ajustar en pantalla */
         if(aux < 255){
             bars[i] = (uint8_t) aux;
         }else{
@@ -139,34 +310,90 @@ void Song2Bars(const uint8_t* song, uint8_t* bars){
 }
 
 /**
- * @brief Tarea encargada de la graficación en el display LCD.
+ * @brief Imprime los tiempos registrados durante la canción y el trazado.
+ */
+static void MostrarTrazado(void){
+    trace_latency_t periodo, analisis, despertar;
+
+    TraceStop();
+    if(TraceLatency(TRACE_AUDIO, TRACE_AUDIO, PLAZO_BLOQUE_NS, &periodo)){
+        printf("Audio: periodo %lu ns (min %lu, max %lu), %lu de %lu fuera de plazo\r\n", periodo.mean_ns,
+               periodo.min_ns, periodo.max_ns, periodo.over, periodo.count);
+    }
+    if(TraceLatency(TRACE_AVISO, TRACE_ANALISIS, UINT32_MAX, &analisis)){
+        printf("Analisis: latencia %lu ns (min %lu, max %lu)\r\n", analisis.mean_ns,
+               analisis.min_ns, analisis.max_ns);
+    }
+    if(TraceLatency(TRACE_AVISO, TRACE_GRAFICO, UINT32_MAX, &despertar)){
+        printf("Graficacion: latencia %lu ns (min %lu, max %lu)\r\n", despertar.mean_ns,
+               despertar.min_ns, despertar.max_ns);
+    }
+    TraceDump();
+    TraceStart();
+}
+
+/**
+ * @brief Tarea encargada del análisis de los bloques que empiezan a sonar:
+ * publica un cuadro del vúmetro por bloque.
+ * 
+ * @param pvParameter 
+ */
+static void AnalisisTask(void *pvParameter){
+    static bloque_audio_t entrega;
+    static cuadro_t cuadro;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while(SpscRingPop(&cola_analisis, &entrega)){
+            cuadro.bloque = entrega.bloque;
+            cuadro.fin = entrega.fin;
+            if(!entrega.fin){
+                Song2Bars(entrega.muestras, cuadro.barras);
+            }
+            TRACE_INSTANT(TRACE_ANALISIS, entrega.bloque);
+            SeqlockWrite(&ultimo_cuadro, &cuadro);
+            cuadros_publicados++;
+            xTaskNotifyGive(plot_task_handle);
+        }
+    }
+}
+
+/**
+ * @brief Tarea encargada de la graficación en el display LCD: dibuja el
+ * último cuadro publicado por el análisis.
  * 
  * @param pvParameter 
  */
 static void PlotTask(void *pvParameter){
     vumeter_t* vum = (vumeter_t*)pvParameter; 
     static uint16_t progress_bar, progress_bar_index = 0;
-    static uint8_t bars[VUM_BARS];
-    progress_bar = N_SONG / CHUNK;
+    static cuadro_t cuadro;
+    bool reproduciendo = false;
+    uint32_t secuencia, ultima = 0;
+    progress_bar = cancion.samples / CHUNK;
     
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        if(!reset){
-            if(song_index-CHUNK == 0){
-                /* Título canción */
-                uint16_t width, height;
-                ILI9341GetStringSize(SONG_NAME, &font_22, &width, &height);
-                ILI9341DrawString(120-width/2, 45, SONG_NAME, &font_22, COLOR_MAIN_1, COLOR_BG_1);
-                ILI9341GetStringSize(SONG_ARTIST, &font_19, &width, &height);
-                ILI9341DrawString(120-width/2, 75, SONG_ARTIST, &font_19, COLOR_MAIN_2, COLOR_BG_1);
-                ILI9341DrawIcon(105, 255, ICON_PAUSE, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
+        secuencia = SeqlockRead(&ultimo_cuadro, &cuadro);
+        if(secuencia == ultima){
+            continue;       /* Cuadro ya dibujado */
+        }
+        ultima = secuencia;
+        cuadros_dibujados++;
+        TRACE_BEGIN(TRACE_GRAFICO, cuadro.bloque);
+        if(!cuadro.fin){
+            if(!reproduciendo){
+                /* Título canción (medido en app_main) */
+                ILI9341DrawText(120-titulo.width/2, 45, &titulo, COLOR_MAIN_1, COLOR_BG_1);
+                ILI9341DrawText(120-artista.width/2, 75, &artista, COLOR_MAIN_2, COLOR_BG_1);
+                ILI9341DrawIcon(105, 255, ICON_PAUSE, &iconos_30, COLOR_MAIN_1, COLOR_BG_1);
+                reproduciendo = true;
             }
             /* Vúmetro */
-            Song2Bars(&song[song_index-CHUNK], bars);
-            VumeterUpdate(vum, bars);
-            /* Progress bar */
+            VumeterUpdate(vum, cuadro.barras);
+            /* Progress bar (hasta el bloque del cuadro, aunque se hayan descartado cuadros) */
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
-            progress_bar_index++;
+            progress_bar_index = (cuadro.bloque + 1 < progress_bar) ? cuadro.bloque + 1 : progress_bar;
             ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_MAIN_2);
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_MAIN_3);
         }else{
@@ -174,27 +401,74 @@ static void PlotTask(void *pvParameter){
             ILI9341DrawFilledCircle(20+200*progress_bar_index/progress_bar, 223, 7, COLOR_BG_1);
             ILI9341DrawFilledRectangle(20, 220, 20+200*progress_bar_index/progress_bar, 226, COLOR_BG_1);
             ILI9341DrawRectangle(20, 220, 220, 226, COLOR_MAIN_1);
-            ILI9341DrawIcon(107, 255, ICON_PLAY, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
+            ILI9341DrawIcon(107, 255, ICON_PLAY, &iconos_30, COLOR_MAIN_1, COLOR_BG_1);
             ILI9341DrawFilledRectangle(0, 45, 240, 100, COLOR_BG_1);
             VumeterInit(vum);
             progress_bar_index = 0;
-        }     
+            reproduciendo = false;
+        }
+        TRACE_END(TRACE_GRAFICO, 0);
+        if(cuadro.fin){
+            printf("Audio: %lu bloques de silencio por falta de muestras\r\n", AudioOutUnderruns());
+            printf("Vumetro: %lu bloques descartados por el analisis, %lu de %lu cuadros dibujados\r\n",
+                   SpscRingDropped(&cola_analisis), cuadros_dibujados, cuadros_publicados);
+            PeriodMonitorPrint();
+            MemReportPrint();
+            MostrarTrazado();
+        }
+    }
+}
+/**
+ * @brief Tarea que espera los eventos de las teclas (ya sin rebote).
+ * La tecla 1 pide a la tarea Audio que comience la reproducción.
+ * 
+ */
+static void TeclasTask(void *pvParameter){
+    switch_event_t evento;
+
+    while(true){
+        if(SwitchEventGet(&evento, SWITCH_WAIT_FOREVER) &&
+           evento.sw == SWITCH_1 && evento.type == SWITCH_EVENT_PRESS){
+            pedido_inicio = true;
+            xTaskNotifyGive(audio_task_handle);
+        }
     }
 }
 /*==================[external functions definition]==========================*/
 void app_main(void){
-    /* Configuración de timer */
-    timer_config_t timer_senial = {
-        .timer = TIMER_B,
-        .period = T_SENIAL,
-        .func_p = FuncTimerSenial,
+    /* Prioridades de las tareas (3 a 6) */
+    if(!RtScheduleInit(plan_tareas, CANTIDAD_TAREAS, 3, 6)){
+        printf("Plan de tareas: hay plazos que pueden no cumplirse\r\n");
+    }
+    /* Recursos */
+    song_adpcm = NULL;
+    if(AssetPackOpen(PARTICION_RECURSOS)){
+        song_adpcm = AssetGetAudio("cancion", &cancion);
+    }
+    if(song_adpcm == NULL || cancion.format != ASSET_AUDIO_ADPCM || cancion.block != CHUNK ||
+       cancion.sample_freq != SAMPLE_FREQ || !AssetGetFont("fuente_19", &fuente_19) ||
+       !AssetGetFont("fuente_22", &fuente_22) || !AssetGetIcons("iconos_22", &iconos_22) ||
+       !AssetGetIcons("iconos_30", &iconos_30)){
+        printf("No se encontraron los recursos en la particion \"%s\" (grabar con idf.py flash)\r\n",
+               PARTICION_RECURSOS);
+        return;
+    }
+    /* Trazado */
+    TraceName(TRACE_ANALISIS, "analisis");
+    TraceName(TRACE_AVISO, "entrega");
+    TraceName(TRACE_GRAFICO, "grafico");
+    /* Salida de audio */
+    audio_out_config_t audio = {
+        .sample_frec = SAMPLE_FREQ,
+        .block_len = CHUNK,
+        .func_p = FuncBloqueLibre,
         .param_p = NULL
     };
-    TimerInit(&timer_senial);
-    /* DAC */
-    AnalogOutputInit();
+    AudioOutInit(&audio);
+    PeriodMonitorInit(&monitor_audio, "audio", T_BLOQUE, TOLERANCIA_BLOQUE);
     /* FFT */
-    FFTInit();
+    FFTInitQ15();
+    BandMapInitLinear(&bands_map, CHUNK/2, VUM_BARS);
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
@@ -211,21 +485,24 @@ void app_main(void){
         .step_color_2 = COLOR_MAIN_2,
         .step_color_3 = COLOR_MAIN_3,
         .step_color_4 = COLOR_MAIN_4,
-        .back_color = COLOR_BG_1
+        .back_color = COLOR_BG_1,
+        .peak_color = ILI9341_WHITE,
+        .peak_hold = 8,             /* ~1 s (128 ms por bloque) */
+        .peak_decay = 4             /* 1/4 de escalón por bloque */
     };
     VumeterInit(&v);
     /* Iconos */
-    ILI9341DrawString(10, 8, "10:20", &font_22, COLOR_MAIN_2, COLOR_BG_1);
-    ILI9341DrawIcon(180, 8, ICON_WIFI_3, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
-    ILI9341DrawIcon(210, 8, ICON_BAT_3, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawString(10, 8, "10:20", &fuente_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(180, 8, ICON_WIFI_3, &iconos_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(210, 8, ICON_BAT_3, &iconos_22, COLOR_MAIN_2, COLOR_BG_1);
     /* Progress bar */
     ILI9341DrawRectangle(20, 220, 220, 226, COLOR_MAIN_1);
     /* Botones */
-    ILI9341DrawIcon(107, 255, ICON_PLAY, &icon_30, COLOR_MAIN_1, COLOR_BG_1);
-    ILI9341DrawIcon(163, 259, ICON_FAST_FOWARD, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
-    ILI9341DrawIcon(55, 259, ICON_REWIND, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
-    ILI9341DrawIcon(204, 259, ICON_JUMP_END, &icon_22, COLOR_MAIN_2, COLOR_BG_1);
-    ILI9341DrawIcon(14, 259, ICON_JUMP_START, &icon_22,COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(107, 255, ICON_PLAY, &iconos_30, COLOR_MAIN_1, COLOR_BG_1);
+    ILI9341DrawIcon(163, 259, ICON_FAST_FOWARD, &iconos_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(55, 259, ICON_REWIND, &iconos_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(204, 259, ICON_JUMP_END, &iconos_22, COLOR_MAIN_2, COLOR_BG_1);
+    ILI9341DrawIcon(14, 259, ICON_JUMP_START, &iconos_22,COLOR_MAIN_2, COLOR_BG_1);
     ILI9341DrawCircle(120, 270, 29, COLOR_MAIN_1);
     ILI9341DrawCircle(120, 270, 28, COLOR_MAIN_1);
     ILI9341DrawCircle(120, 270, 27, COLOR_MAIN_1);
@@ -238,12 +515,22 @@ void app_main(void){
     ILI9341DrawCircle(215, 270, 19, COLOR_MAIN_2);
     ILI9341DrawCircle(215, 270, 18, COLOR_MAIN_2);
 
+    /* Textos fijos: se miden una sola vez */
+    ILI9341TextInit(&titulo, cancion.title, &fuente_22);
+    ILI9341TextInit(&artista, cancion.artist, &fuente_19);
+
     /* Teclas */
     SwitchesInit();
-    SwitchActivInt(SWITCH_1, FuncSwitchStart, NULL);
+    SwitchEventsInit(SWITCH_1);
     
     /* Tarea para actualizar pantalla */
-    xTaskCreate(&PlotTask, "Plot", 32768, &v, 5, &plot_task_handle);
+    xTaskCreate(&PlotTask, "Plot", 32768, &v, plan_tareas[TAREA_PLOT].priority, &plot_task_handle);
+    /* Tarea para analizar los bloques (entre el audio y la graficación) */
+    xTaskCreate(&AnalisisTask, "Analisis", 4096, NULL, plan_tareas[TAREA_ANALISIS].priority, &analisis_task_handle);
+    /* Tarea para escribir la canción (la más prioritaria) */
+    xTaskCreate(&AudioTask, "Audio", 2048, NULL, plan_tareas[TAREA_AUDIO].priority, &audio_task_handle);
+    /* Tarea para los eventos de las teclas */
+    xTaskCreate(&TeclasTask, "Teclas", 2048, NULL, plan_tareas[TAREA_TECLAS].priority, &teclas_task_handle);
 }
 
 /*==================[end of file]============================================*/
@@ -0,0 +1,7334 @@
+/**
+ * @file song_adpcm.h
+ * @brief Audio signal of "Mariposa Teknicolor" song, IMA-ADPCM blocks (see adpcm.h).
+ * @note Created with adpcm_encoder.py script
+ */
+#define N_SONG 464000
+#define SONG_NAME "Mariposa Teknicolor"
+#define SONG_ARTIST "Fito Paez"
+#define SONG_FREC 8000
+#define SONG_BLOCK 1024
+#define SONG_BLOCKS 454
+const uint8_t song_adpcm[] = {
+0,0,0,0,240,242,243,95,61,59,76,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,
+59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,
+75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,
+60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,
+59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,
+75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,
+60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,
+59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,
+75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,
+60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,
+59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,59,12,8,8,8,8,128,8,8,128,8,
+128,8,128,8,8,8,8,128,128,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,112,122,123,123,123,11,136,0,136,0,136,0,136,128,128,128,128,0,8,8,8,8,8,9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,122,123,123,123,75,75,
+59,60,75,59,60,75,59,60,75,59,60,75,59,60,75,8,60,60,128,60,75,59,60,75,59,60,75,59,12,8,8,8,
+8,120,91,59,60,75,59,60,75,59,12,8,88,8,8,140,64,192,60,72,59,112,203,59,64,27,121,128,47,128,170,154,
+98,24,65,152,251,1,51,0,61,9,114,144,25,159,149,24,10,167,224,134,153,24,128,57,203,49,42,0,24,61,1,138,
+20,170,89,153,134,137,163,212,144,0,144,144,1,184,91,155,108,136,131,138,131,20,25,2,179,166,185,58,154,192,4,176,
+82,159,129,144,154,26,25,243,160,129,20,57,50,45,48,40,145,36,242,57,32,30,59,168,162,224,136,172,65,137,40,184,
+145,15,130,209,106,16,8,129,132,57,33,73,13,18,154,216,40,137,250,1,177,9,42,232,132,138,16,16,211,128,5,8,
+0,75,161,38,59,89,26,154,130,60,202,59,28,233,162,160,147,24,138,67,56,31,0,145,20,49,74,171,16,203,21,232,
+25,20,41,226,200,131,58,9,16,40,173,3,145,227,40,8,248,145,16,2,8,186,74,182,90,16,158,184,18,149,179,131,
+8,49,164,17,1,8,189,67,240,137,32,169,201,57,171,160,159,27,5,152,179,8,180,161,39,144,17,152,54,72,56,177,
+167,16,24,200,154,193,11,192,153,177,1,157,40,29,148,186,137,140,7,48,131,59,54,146,179,1,6,18,131,73,152,30,
+152,155,250,10,192,169,153,43,204,17,186,18,2,131,72,131,52,115,151,64,17,3,1,129,72,147,30,138,233,145,155,171,
+219,194,1,176,153,170,41,135,152,57,34,7,18,3,33,2,50,67,51,143,63,160,41,211,169,176,243,170,130,137,16,59,
+167,58,0,128,232,131,177,69,161,219,85,27,72,154,16,138,242,152,2,59,56,138,76,185,82,136,160,20,107,145,17,139,
+149,139,13,137,160,196,16,185,132,136,160,166,34,227,64,180,137,164,144,81,27,1,225,129,41,138,24,248,137,153,105,176,
+21,138,128,243,1,49,10,0,141,149,128,17,29,137,128,10,163,0,31,32,9,64,195,49,184,97,185,137,1,76,26,138,
+132,181,136,163,158,16,29,184,136,198,4,26,0,145,137,151,73,0,145,145,2,11,234,19,139,8,79,153,128,177,18,13,
+33,91,31,0,9,129,25,136,124,168,2,136,130,137,25,92,0,170,33,160,130,175,134,192,19,58,24,26,57,0,202,133,
+154,45,137,129,154,160,173,52,12,63,73,145,144,131,43,48,28,25,8,199,1,24,41,168,5,146,194,80,224,25,193,130,
+153,225,25,8,58,10,41,241,156,246,54,0,57,161,57,3,72,25,33,168,135,163,49,130,162,7,138,130,63,156,146,160,
+27,242,26,8,24,142,129,145,76,169,145,214,56,0,152,48,169,99,25,57,66,136,17,183,56,137,8,161,171,242,42,155,
+25,202,242,177,72,170,56,145,8,176,128,151,1,180,1,88,35,170,37,195,3,148,65,169,208,179,193,160,112,169,177,30,
+144,16,137,162,30,160,145,40,42,122,136,107,10,8,129,162,21,25,64,25,32,128,112,45,129,128,192,137,130,128,30,137,
+172,162,128,11,60,11,83,59,175,43,34,187,132,3,120,41,56,104,48,137,32,131,143,64,169,32,11,56,64,139,188,12,
+184,188,3,151,28,137,42,75,62,40,46,153,177,130,42,48,12,87,11,48,9,40,34,178,48,67,11,200,120,29,8,57,
+142,24,31,153,137,145,1,169,168,182,33,8,42,126,137,148,18,128,163,11,243,5,0,50,174,34,13,29,18,249,16,9,
+9,24,145,57,146,168,137,122,81,169,4,162,8,153,171,78,144,129,26,136,189,24,138,167,17,86,138,1,144,136,35,29,
+13,136,17,160,3,250,209,144,144,8,8,50,48,232,164,65,45,136,148,24,80,8,177,130,145,159,160,34,194,158,34,14,
+1,184,129,49,224,35,160,74,176,144,8,147,151,163,17,140,153,56,199,61,24,26,144,49,91,202,227,145,34,9,8,3,
+144,225,144,1,233,146,178,112,27,145,184,40,63,56,42,161,200,50,32,43,183,152,160,17,153,113,169,179,231,0,144,16,
+162,146,27,61,42,62,16,184,147,208,19,160,80,43,25,47,89,138,161,24,177,25,4,91,72,30,91,26,177,1,153,153,
+167,162,90,193,128,128,48,184,133,128,194,1,140,67,141,17,59,43,92,27,129,25,136,136,152,125,177,2,160,73,154,180,
+162,40,194,144,165,192,82,140,16,57,201,16,41,45,144,181,20,144,178,162,17,201,149,137,42,154,63,169,177,50,40,191,
+149,194,51,59,26,194,197,130,40,170,181,1,5,29,25,10,147,10,17,45,145,157,131,153,1,168,138,179,179,55,42,62,
+179,122,10,59,57,10,162,167,48,152,61,137,18,202,120,154,164,56,138,75,152,60,139,160,133,130,135,8,146,74,43,10,
+47,144,128,18,30,13,128,148,193,3,27,16,222,255,45,0,73,42,227,128,128,57,160,168,120,77,75,25,27,56,169,128,
+121,26,28,178,41,60,40,40,47,17,139,224,146,57,139,112,107,10,136,149,25,75,26,10,161,105,26,13,3,119,212,226,
+164,41,137,136,129,24,28,16,10,246,178,128,2,136,18,129,89,75,40,184,146,20,13,25,176,160,167,185,185,34,216,129,
+40,131,106,50,11,88,57,15,2,25,48,174,162,41,91,168,160,137,148,177,68,216,144,131,10,133,162,179,184,6,209,49,
+44,210,0,178,42,34,237,137,162,59,5,144,128,18,132,92,208,130,24,161,195,0,43,136,212,137,137,3,177,16,139,111,
+0,44,184,51,76,136,107,152,49,10,8,0,227,145,168,145,218,173,133,128,0,26,16,130,97,145,183,17,10,144,48,26,
+202,40,203,176,209,21,47,41,137,49,170,49,200,3,9,17,215,17,24,161,137,186,50,176,78,15,145,144,136,136,145,124,
+32,138,148,179,146,98,137,32,25,174,164,168,24,90,43,152,8,243,8,16,137,56,130,211,129,196,165,9,57,178,133,90,
+153,42,145,56,170,92,203,24,128,170,135,24,74,176,210,20,80,193,16,12,0,136,176,161,42,29,129,17,242,132,13,1,
+136,163,107,130,43,56,31,145,0,24,10,136,48,234,227,162,162,121,137,129,153,178,65,76,152,1,139,149,1,74,168,129,
+139,225,25,178,124,144,148,40,138,16,8,185,135,73,154,129,12,168,194,64,137,65,107,137,8,145,121,44,128,9,152,43,
+146,88,154,147,161,197,178,19,90,201,32,176,153,153,178,71,42,11,134,25,17,141,64,161,9,171,139,48,47,26,210,145,
+17,8,120,177,1,32,152,56,76,139,0,243,74,136,105,171,150,162,128,25,138,49,154,133,15,1,58,169,130,196,33,162,
+161,48,233,145,171,17,64,108,217,1,48,152,180,164,24,74,184,197,0,8,25,12,2,185,167,40,137,1,16,187,183,19,
+160,137,37,43,192,42,170,84,28,152,185,147,7,179,90,192,11,8,161,34,73,45,179,179,17,27,7,144,80,161,153,8,
+185,224,45,2,57,47,27,29,20,43,139,34,159,9,24,121,106,144,233,42,32,60,184,119,136,9,130,240,138,20,153,61,
+1,153,168,7,209,1,28,40,24,129,32,168,193,24,56,148,43,57,73,0,251,179,16,169,180,153,194,136,39,136,25,123,
+25,8,137,41,33,47,153,147,144,133,28,74,29,184,2,144,3,25,152,130,162,12,22,185,211,151,128,0,16,170,129,241,
+40,176,40,8,164,27,194,121,177,163,185,4,181,151,145,16,42,141,8,24,8,171,43,227,96,128,42,136,176,33,36,152,
+165,211,129,25,144,121,11,136,241,40,128,58,29,44,163,11,40,133,75,57,146,56,41,10,181,173,3,224,1,58,47,153,
+16,33,188,180,128,74,64,48,121,25,59,138,73,30,10,128,152,212,33,44,27,200,131,165,16,10,144,67,160,131,59,210,
+149,211,209,34,139,25,170,24,9,151,185,3,57,183,144,66,12,1,162,242,128,40,0,161,242,162,163,57,243,138,136,133,
+145,0,74,176,130,146,64,243,41,75,10,129,184,179,19,220,2,42,176,18,10,151,242,130,16,89,170,148,0,152,129,42,
+8,94,152,41,184,8,9,215,16,107,137,162,161,72,161,227,147,40,153,179,35,250,178,168,179,161,183,130,160,32,178,242,
+4,1,153,182,146,16,136,162,152,152,242,195,184,164,163,146,232,24,24,135,43,162,49,74,75,153,20,31,136,138,19,178,
+13,16,10,179,59,63,43,185,133,137,3,146,51,228,76,0,16,75,192,25,126,10,8,136,25,136,16,168,120,26,44,24,
+136,129,32,130,9,168,32,63,19,222,146,146,169,133,137,130,44,138,50,211,32,8,164,36,14,154,130,25,194,192,148,41,
+135,186,145,164,132,168,145,195,210,162,66,29,146,195,129,194,75,27,164,74,26,146,201,36,155,49,142,177,6,72,138,128,
+242,0,0,42,2,156,225,147,17,49,30,217,130,40,137,58,200,165,1,9,53,141,24,129,1,203,146,68,137,194,59,192,
+48,216,1,185,227,33,57,139,28,27,209,163,151,131,41,152,113,168,179,1,169,195,34,56,30,176,1,172,132,211,72,154,
+0,15,130,42,144,201,104,75,42,40,107,24,128,136,72,171,9,88,194,193,184,150,129,40,42,11,3,145,140,149,156,131,
+161,212,16,8,180,168,72,42,59,12,152,162,23,37,10,30,25,137,1,4,145,161,8,47,44,10,16,145,248,145,13,136,
+10,40,148,130,23,148,1,144,0,225,137,9,161,24,3,15,40,169,184,27,115,243,53,0,43,84,57,72,93,168,178,9,
+133,136,130,10,15,42,162,48,32,160,6,202,43,9,18,38,136,142,48,128,193,128,106,152,168,0,146,249,156,178,152,18,
+20,128,112,145,112,144,8,10,56,162,88,136,132,248,152,160,128,193,88,153,26,31,24,128,34,152,160,120,192,49,16,139,
+10,18,181,18,16,28,170,91,44,24,185,22,172,1,17,176,58,201,232,132,178,145,19,202,59,134,138,122,144,57,40,19,
+12,91,210,32,139,170,8,82,6,154,138,8,48,63,40,249,26,146,25,3,153,19,15,163,0,130,150,25,26,65,28,12,
+16,248,25,163,128,170,129,169,23,146,133,1,161,9,173,128,50,176,16,207,96,10,49,192,149,152,161,9,8,200,138,166,
+24,18,90,96,24,137,26,59,192,41,248,25,145,161,176,134,17,178,56,61,59,112,136,4,172,179,168,192,74,188,66,203,
+7,168,17,0,8,34,91,170,128,184,48,150,0,115,137,153,160,139,67,155,129,175,34,152,62,161,145,1,196,66,154,72,
+140,1,142,1,26,1,121,153,20,17,170,1,12,58,57,210,182,163,43,144,112,138,171,134,152,29,152,131,74,253,128,1,
+8,24,177,112,50,123,150,41,26,152,164,168,9,13,24,136,243,26,41,152,128,214,129,130,25,42,136,137,1,10,58,225,
+66,136,151,24,2,49,40,32,15,129,130,24,57,202,131,242,9,177,141,0,176,13,24,252,16,144,10,26,177,164,17,132,
+136,149,32,160,1,148,163,243,179,23,138,66,145,26,83,26,41,25,59,156,193,1,242,209,152,144,26,146,43,46,169,147,
+166,26,8,151,168,148,177,164,162,128,192,193,48,188,145,4,8,90,56,130,0,116,144,132,177,89,0,24,57,11,226,26,
+163,1,201,194,144,152,241,170,178,169,241,146,184,131,185,14,17,168,134,178,2,167,0,0,132,153,163,193,212,34,0,146,
+96,128,33,153,4,64,157,17,130,9,66,155,194,139,132,171,188,152,217,154,241,184,171,149,43,154,160,58,42,55,174,1,
+0,57,225,129,4,88,80,41,129,147,51,2,113,41,160,147,43,24,9,143,216,168,169,2,172,178,224,25,18,250,1,26,
+192,160,128,192,9,26,150,184,1,38,168,80,152,160,9,16,49,195,44,49,177,35,34,122,63,255,47,0,53,36,40,33,
+82,0,9,27,244,128,180,138,113,170,144,169,25,157,161,203,200,192,192,24,156,161,40,59,18,160,150,177,7,128,34,184,
+147,20,147,65,83,89,151,1,49,169,133,146,16,17,139,1,242,168,128,136,190,145,178,248,0,155,172,209,137,155,17,171,
+146,179,122,130,164,25,149,224,18,145,40,40,99,0,131,133,88,27,137,8,146,1,67,180,65,25,1,164,114,130,96,154,
+24,171,232,161,11,14,170,165,153,196,137,145,44,154,160,24,68,9,130,26,145,244,131,40,168,129,181,34,12,135,144,25,
+138,145,130,65,137,52,71,16,130,129,163,25,243,128,210,147,178,10,30,12,210,146,26,140,177,178,194,169,193,136,241,59,
+155,177,164,163,120,146,20,144,1,25,124,41,152,128,33,145,34,65,4,25,1,132,169,7,194,195,161,224,8,130,155,151,
+24,0,145,168,217,161,146,89,144,169,221,137,1,217,136,9,153,171,16,76,40,138,58,8,51,119,129,50,17,49,98,128,
+32,224,57,178,18,40,151,32,44,49,17,192,1,164,22,156,153,192,216,136,188,200,153,153,1,154,208,145,50,162,2,131,
+39,12,8,29,130,151,1,145,25,35,160,120,16,128,205,145,33,16,135,1,148,146,1,129,137,151,200,24,10,161,132,130,
+194,170,2,191,145,10,162,251,136,211,9,163,169,162,90,169,180,168,138,135,18,8,42,227,12,51,52,28,144,33,242,19,
+137,130,150,144,72,27,160,162,35,158,165,40,40,138,149,40,2,242,128,153,136,170,187,3,180,83,182,147,42,56,183,137,
+160,226,35,136,172,30,162,184,40,181,225,160,130,234,145,0,147,8,130,131,51,240,17,2,176,6,40,128,6,195,73,10,
+202,37,144,152,182,145,56,137,202,166,168,17,130,162,234,128,151,138,130,185,132,1,240,131,145,16,143,128,145,168,162,219,
+133,144,25,1,8,130,138,128,4,136,76,134,169,133,18,2,151,17,128,22,129,131,1,200,12,65,152,154,130,175,128,29,
+9,203,147,172,42,204,137,160,137,162,232,16,180,8,133,16,135,2,33,1,132,194,131,130,149,40,130,162,8,55,2,178,
+131,192,51,64,184,188,236,169,172,192,137,42,224,25,160,218,3,200,145,186,131,192,48,180,8,180,151,8,39,249,42,0,
+148,196,1,1,162,34,179,8,4,183,60,128,162,2,67,150,3,8,2,184,180,72,151,10,40,224,33,170,10,240,153,184,
+193,128,8,128,243,152,200,1,42,176,195,243,3,8,11,182,3,168,128,135,128,130,162,134,18,34,176,51,200,132,192,150,
+1,33,176,151,152,145,138,243,138,169,170,176,11,192,8,8,4,61,151,195,35,170,160,8,195,128,180,131,64,75,8,8,
+53,8,180,124,59,25,28,76,137,130,244,129,43,24,185,135,121,10,128,145,79,209,25,16,13,150,176,150,136,48,168,27,
+2,177,194,121,131,9,121,130,40,8,248,32,15,27,128,145,232,178,192,16,40,137,129,11,148,160,57,33,2,120,24,81,
+41,67,185,7,26,129,148,16,208,49,137,184,18,9,203,121,243,129,137,162,178,1,194,3,73,248,1,145,153,21,138,41,
+25,156,167,33,156,196,148,75,136,160,128,1,211,138,178,34,30,30,16,9,169,128,21,138,5,185,28,41,65,5,11,140,
+10,5,9,176,150,9,146,25,28,25,9,8,183,136,25,209,120,9,147,154,96,185,148,33,107,154,164,8,145,19,161,59,
+176,109,208,179,34,242,2,10,17,140,17,30,180,145,179,163,123,153,8,41,59,244,32,136,24,40,31,136,136,144,183,1,
+193,16,9,91,152,145,0,209,49,153,33,31,129,137,74,208,164,162,17,60,9,25,31,34,202,134,42,168,33,138,147,56,
+241,40,208,3,10,164,44,40,109,153,1,26,152,32,27,81,143,33,139,146,59,210,212,33,136,73,176,57,185,165,179,147,
+41,172,113,74,10,57,139,73,11,1,58,80,11,9,200,3,249,196,131,160,167,0,169,163,130,26,147,152,112,152,42,10,
+1,77,10,184,39,43,201,123,144,128,145,227,147,0,17,45,209,41,194,196,146,1,9,0,59,202,135,209,163,1,152,0,
+40,140,161,165,179,164,161,160,51,157,242,131,178,195,212,2,58,153,42,26,0,243,149,152,56,10,128,25,26,215,165,145,
+129,177,195,128,16,17,243,0,25,161,225,2,152,129,162,2,42,201,137,213,130,242,164,128,128,16,74,76,154,181,0,145,
+48,26,125,45,8,8,128,26,162,2,60,45,128,145,160,152,165,166,9,24,177,130,24,170,146,106,13,16,243,48,161,26,
+16,253,70,0,177,112,139,160,166,17,8,202,35,62,25,169,150,9,145,0,136,56,46,168,3,225,18,187,133,77,136,128,
+147,41,137,210,2,168,199,161,1,1,128,210,161,2,129,250,48,106,10,9,25,129,176,211,145,163,24,210,40,216,50,176,
+105,186,7,153,16,136,21,14,40,10,146,161,90,136,106,153,0,243,131,184,19,28,16,43,154,3,28,129,31,41,47,136,
+0,214,146,211,1,136,56,27,43,129,25,151,154,20,45,145,59,144,179,196,128,178,17,48,47,11,136,178,209,163,72,17,
+47,153,56,194,42,130,106,25,156,199,179,148,41,25,137,148,209,163,226,132,42,136,25,162,136,244,163,1,185,181,178,50,
+140,147,136,2,27,1,202,36,171,211,180,21,169,179,131,124,184,179,147,2,248,196,162,180,178,146,128,56,155,49,142,2,
+224,130,16,40,227,24,161,0,243,17,44,16,160,40,140,146,183,1,138,129,166,42,75,42,179,76,46,24,168,33,47,9,
+128,106,27,161,164,57,153,227,148,42,9,0,34,78,42,25,25,59,141,163,148,43,152,228,131,10,192,148,17,47,152,1,
+41,44,225,3,176,162,147,128,123,169,0,176,38,12,163,42,122,26,185,2,129,212,129,144,17,193,210,164,2,171,151,8,
+26,153,148,89,152,16,44,128,77,152,0,152,33,200,151,128,129,145,241,16,8,178,177,50,201,148,139,57,121,185,56,137,
+165,153,145,18,34,187,163,115,15,164,145,184,165,165,0,136,72,25,60,14,2,74,154,16,106,43,144,59,8,152,57,48,
+15,217,18,176,167,178,145,17,160,76,41,25,28,17,76,72,10,56,78,155,113,44,25,59,41,27,9,160,120,152,154,132,
+136,243,145,129,56,177,57,30,1,60,40,155,161,112,27,17,79,10,0,168,32,129,144,56,47,226,18,185,180,19,154,16,
+16,47,11,32,60,160,0,91,72,15,72,27,168,181,2,168,165,1,58,193,208,133,9,193,1,0,26,227,0,0,152,58,
+25,0,77,170,167,33,10,152,32,110,10,162,136,40,193,130,8,57,160,165,138,123,192,148,136,145,163,96,45,58,169,129,
+177,148,155,34,95,137,193,130,144,146,145,125,10,128,129,136,1,25,1,153,90,161,132,28,28,163,16,46,169,150,17,13,
+161,161,130,170,73,230,65,0,167,16,33,29,168,66,61,184,176,148,97,45,137,32,10,16,176,122,92,10,144,24,40,168,
+130,58,77,160,194,180,40,169,179,122,136,129,153,2,75,248,179,48,74,193,144,163,105,225,131,138,166,146,136,25,24,176,
+242,195,33,176,48,46,59,224,131,10,148,130,26,12,1,163,10,232,34,194,48,216,33,160,16,15,1,17,136,162,9,166,
+29,153,49,195,123,160,162,161,153,248,20,40,138,0,9,129,173,197,72,129,43,177,40,50,15,192,4,24,144,16,26,123,
+187,166,58,41,168,149,42,43,45,176,34,32,195,129,41,61,141,57,62,73,155,149,24,75,139,146,24,161,6,0,176,178,
+129,94,28,41,185,135,128,128,152,128,169,148,120,58,137,226,1,59,10,90,155,167,130,9,160,130,178,49,111,41,26,169,
+162,24,44,137,168,135,146,192,161,193,181,18,92,40,25,184,144,24,11,148,12,50,74,154,42,249,148,24,75,32,131,208,
+128,144,229,178,144,4,2,10,29,152,57,30,58,72,17,25,15,136,152,2,156,166,131,161,210,163,128,129,9,112,88,9,
+169,177,1,76,202,50,42,24,203,195,152,180,196,112,41,9,136,128,26,137,243,32,75,161,26,137,152,196,131,121,73,176,
+178,105,10,16,140,32,59,164,57,141,225,130,168,82,11,151,136,8,168,33,154,25,227,35,28,9,194,49,12,123,26,133,
+25,137,168,89,12,193,164,48,138,144,210,1,57,74,137,49,8,10,166,63,169,178,64,75,26,136,40,28,27,136,22,56,
+243,162,146,42,184,152,56,61,147,43,80,47,169,58,91,41,146,210,17,140,163,156,18,91,146,74,184,161,183,129,17,145,
+38,44,8,157,2,13,128,24,32,92,138,208,146,0,129,195,83,11,147,11,27,26,11,35,79,43,128,209,160,8,178,7,
+24,2,131,13,210,16,141,148,73,136,16,216,161,75,153,180,82,75,60,153,106,10,152,130,58,213,129,160,179,161,181,164,
+32,72,74,29,8,137,128,28,24,0,18,15,160,26,130,165,74,161,66,27,200,160,130,72,234,149,194,33,170,24,90,24,
+12,2,80,43,17,13,59,45,169,134,194,146,144,192,56,152,192,134,16,184,147,25,61,60,26,80,43,43,25,31,24,180,
+178,4,57,192,132,13,144,161,249,246,67,0,9,2,148,41,138,169,47,147,193,113,26,144,147,185,243,145,145,89,0,10,
+33,143,8,0,8,104,42,16,88,169,137,195,27,123,2,62,136,136,155,35,171,40,134,11,132,178,11,77,59,109,74,153,
+130,152,168,19,139,96,44,129,16,225,161,145,9,90,1,155,196,211,161,2,129,17,90,12,89,160,42,185,33,92,1,28,
+24,90,15,16,137,130,1,11,50,72,47,8,171,129,150,193,148,16,141,17,184,17,16,250,33,1,140,0,153,56,51,200,
+56,33,207,17,178,105,40,10,9,21,218,179,194,136,20,10,91,42,170,90,177,16,148,137,10,7,225,24,241,1,0,0,
+10,72,138,77,137,128,147,26,177,6,163,152,210,128,49,13,146,107,9,9,194,8,180,178,74,41,64,30,170,9,83,152,
+195,130,144,76,137,192,20,153,0,147,21,13,128,13,73,161,161,193,164,144,104,168,65,170,145,40,198,147,137,169,121,136,
+56,140,3,140,32,225,34,26,138,128,84,168,24,184,42,162,56,14,122,9,138,148,144,130,241,193,3,163,153,26,11,67,
+34,31,25,137,25,136,51,165,184,216,135,19,12,40,143,2,60,136,144,177,162,149,228,146,40,169,16,32,194,136,121,171,
+80,200,0,210,209,129,180,113,1,136,92,44,12,8,128,0,128,146,72,177,166,193,137,75,121,9,32,25,153,25,57,251,
+18,138,195,130,40,30,8,144,144,17,120,176,34,209,192,163,164,57,10,177,164,24,0,12,145,57,250,164,163,132,152,48,
+232,16,41,62,25,186,150,17,169,164,164,8,88,153,75,154,2,74,169,57,92,43,56,78,123,152,40,138,56,162,12,42,
+153,0,47,27,17,131,140,4,192,34,28,64,210,161,64,27,146,208,1,9,235,2,25,146,10,48,187,16,240,83,33,47,
+0,161,145,40,142,136,1,45,136,209,146,59,147,81,168,18,157,133,155,52,123,152,129,42,138,48,12,28,46,1,91,184,
+8,58,146,90,177,178,201,65,136,23,139,195,180,65,9,161,9,122,141,144,152,19,154,72,168,5,41,185,166,89,0,75,
+161,43,153,132,178,46,242,0,24,59,154,147,131,107,1,17,168,52,143,137,148,45,160,161,130,24,160,177,135,27,148,136,
+17,47,137,25,34,30,40,152,28,89,138,1,23,251,69,0,33,28,2,129,249,64,192,40,41,28,168,89,76,10,32,13,
+49,154,34,58,2,15,210,136,25,208,1,162,168,163,152,124,58,24,35,42,134,160,1,154,198,137,144,169,91,176,1,211,
+145,197,17,130,17,148,43,28,27,182,8,170,170,122,42,128,183,177,37,136,56,26,12,233,182,162,16,128,42,73,44,155,
+150,129,105,136,8,57,45,138,161,9,80,27,216,73,26,128,194,4,8,149,128,130,25,202,226,18,154,50,142,56,12,41,
+75,144,91,32,58,24,170,19,47,43,25,41,143,209,1,16,25,192,33,6,11,165,130,73,31,8,9,16,11,161,182,160,
+196,163,161,48,209,149,1,44,57,186,41,109,152,9,8,24,152,34,77,90,200,3,57,42,11,64,79,27,160,128,59,200,
+165,18,45,41,144,16,48,28,242,0,43,41,130,153,63,154,194,18,110,26,162,40,136,227,179,24,75,170,148,17,27,200,
+167,16,9,8,130,161,162,197,165,25,170,179,147,169,179,199,165,1,136,0,32,78,25,177,195,131,140,146,107,44,192,178,
+148,24,136,56,0,26,25,209,3,112,142,0,17,27,153,129,74,106,43,60,24,26,41,56,28,107,185,73,75,192,133,41,
+27,93,10,41,73,26,136,90,10,128,168,75,40,169,153,58,94,44,162,74,17,194,178,33,167,128,242,128,8,145,9,40,
+128,168,20,15,128,164,195,16,131,163,229,152,145,146,161,153,196,162,162,153,7,194,164,144,131,168,166,9,137,148,9,10,
+165,144,3,154,66,148,32,159,49,30,24,154,43,148,147,170,194,164,1,10,123,132,105,12,16,24,74,203,0,0,168,129,
+145,178,123,58,61,19,60,29,74,144,32,232,160,17,25,154,18,136,124,153,128,6,75,201,130,1,56,184,138,130,78,27,
+146,128,128,215,1,56,153,145,137,195,49,232,61,59,9,210,0,161,0,19,61,5,193,180,26,129,144,182,169,20,29,25,
+10,146,146,132,201,7,40,27,232,148,16,128,13,24,42,60,60,9,43,16,233,150,130,0,201,149,0,144,209,2,137,17,
+46,42,8,136,144,134,33,12,153,89,137,2,240,144,17,152,179,60,137,162,243,18,81,59,141,64,43,8,176,193,213,17,
+153,41,57,74,44,56,57,41,141,42,24,197,193,129,25,152,149,243,64,0,125,10,128,33,27,0,0,42,137,60,121,130,
+26,173,104,11,74,10,129,145,128,2,183,151,43,152,17,1,185,184,211,123,28,136,152,132,57,136,7,42,27,139,163,120,
+193,179,8,17,12,193,162,65,139,148,80,42,139,56,184,145,231,146,160,32,27,1,41,15,180,129,33,9,198,16,152,20,
+179,129,58,197,138,12,192,181,162,163,160,193,187,24,152,123,137,28,177,77,41,43,153,163,4,33,38,0,97,9,1,64,
+128,144,215,130,9,129,241,145,145,144,3,17,29,186,5,59,177,169,151,41,138,25,211,145,178,165,19,9,25,160,129,95,
+146,184,135,59,137,25,160,43,226,212,88,137,144,160,74,170,151,168,131,43,136,41,74,139,210,2,56,164,57,208,50,219,
+151,161,56,171,150,74,44,26,8,136,89,145,8,168,2,162,83,169,124,128,24,42,153,196,89,60,152,146,128,181,176,163,
+20,74,157,167,129,145,152,144,2,171,163,134,193,56,24,136,1,137,242,132,27,144,177,249,1,224,148,41,42,42,61,11,
+5,9,171,134,16,168,177,226,146,177,24,65,24,30,56,8,43,48,225,24,161,164,5,185,1,91,162,155,120,176,8,144,
+131,33,108,75,125,137,152,1,136,200,17,1,152,131,168,135,169,161,3,79,44,9,128,57,137,40,153,26,15,148,59,28,
+146,181,179,165,0,65,156,88,138,145,26,80,185,34,177,193,165,8,169,6,152,58,40,41,45,63,153,145,27,0,178,184,
+62,166,180,129,17,105,168,73,161,8,156,34,32,234,133,25,41,201,164,32,184,136,120,16,58,13,129,12,209,162,20,27,
+26,32,146,214,129,137,2,59,27,148,140,249,133,136,1,144,57,217,146,32,162,208,104,129,145,176,48,15,136,11,35,136,
+157,122,24,1,59,216,1,163,161,5,8,31,41,144,128,40,47,170,32,9,112,138,27,135,128,136,144,8,45,154,163,68,
+240,128,17,130,75,155,16,152,34,29,67,45,12,40,192,151,8,153,128,17,56,169,176,134,56,168,9,151,28,157,148,17,
+160,45,168,134,0,136,137,162,88,9,57,193,40,47,24,129,41,29,187,151,147,24,170,165,17,129,193,146,136,15,42,32,
+0,28,186,23,16,153,186,5,169,163,4,34,139,140,128,53,28,156,177,122,128,252,71,0,90,136,9,40,8,24,162,43,
+243,232,144,66,136,176,136,41,122,163,42,91,152,145,96,8,145,155,144,114,136,193,137,138,161,131,58,128,128,29,135,32,
+136,218,13,90,0,41,184,145,5,66,141,161,9,154,81,130,82,139,154,36,1,9,250,210,0,16,10,1,162,60,130,48,
+12,43,255,146,18,44,136,144,74,32,212,40,240,146,8,150,41,8,154,34,16,178,186,61,140,121,152,16,26,185,135,48,
+9,152,173,24,88,192,147,144,57,112,136,42,160,156,193,7,9,128,152,73,40,195,161,42,139,168,135,44,128,211,147,121,
+144,162,155,24,106,10,177,2,9,16,133,89,176,200,8,56,162,1,227,63,48,161,179,224,40,138,121,156,147,136,40,75,
+163,149,138,140,2,162,136,227,145,20,32,187,7,26,31,8,128,129,8,138,81,33,45,162,154,176,66,188,56,56,155,120,
+16,34,219,249,24,2,153,1,44,160,6,128,75,176,224,64,60,161,162,128,61,133,161,18,140,152,129,0,205,148,177,97,
+59,162,196,25,155,18,213,40,138,131,72,41,176,146,170,13,24,48,216,62,177,135,57,24,153,0,58,11,241,57,26,56,
+198,34,25,219,128,73,10,153,241,50,92,41,136,41,60,12,179,40,0,14,193,51,25,163,0,168,109,154,193,57,28,60,
+146,65,42,152,154,45,1,248,177,33,48,16,4,44,41,203,40,28,148,14,161,66,57,146,137,2,43,186,153,207,163,123,
+1,40,197,162,136,11,130,154,202,128,19,3,23,10,2,16,15,170,151,137,144,64,48,64,170,144,21,157,24,240,128,10,
+5,136,49,137,210,162,42,154,136,156,123,131,65,169,3,243,1,156,40,226,161,56,72,137,147,178,60,19,13,202,24,243,
+49,146,58,129,241,128,144,160,10,182,141,19,132,128,8,1,61,8,15,16,192,136,105,146,128,147,160,1,224,152,153,192,
+136,116,152,33,128,168,10,130,143,128,185,120,33,136,9,35,141,16,233,40,136,185,1,70,8,128,197,128,161,225,145,8,
+153,49,151,73,136,136,8,77,170,162,192,137,4,130,179,50,227,144,179,31,130,185,130,112,130,59,164,27,161,169,91,141,
+57,15,3,144,21,25,136,12,144,43,208,185,6,0,17,0,131,156,131,207,34,139,8,90,225,243,69,0,65,59,163,184,
+179,193,138,155,5,174,84,136,50,169,129,158,16,11,129,233,48,58,49,152,114,170,1,219,51,186,163,143,36,0,50,140,
+74,185,144,240,16,203,129,131,98,16,1,186,74,169,176,242,41,186,23,0,129,146,0,234,105,153,0,138,74,132,19,9,
+9,177,15,138,41,156,33,168,87,40,40,138,185,192,72,203,28,152,72,33,34,16,75,220,2,160,57,13,131,138,87,136,
+9,8,27,170,41,156,90,240,1,4,19,139,179,137,27,218,160,44,153,66,5,17,106,192,160,152,130,234,148,137,98,40,
+160,16,10,170,137,200,153,183,194,83,4,136,8,10,14,160,160,138,147,217,39,0,128,25,137,46,24,152,106,153,106,17,
+41,153,145,201,40,12,13,32,14,32,84,27,57,184,26,58,45,11,128,203,121,3,27,130,58,171,82,27,28,129,31,120,
+8,145,0,138,28,195,138,16,225,161,69,136,128,130,171,32,216,168,16,240,154,23,136,0,162,177,65,138,225,18,169,58,
+5,161,147,211,240,130,10,144,0,11,124,130,162,3,154,26,242,136,9,179,219,113,24,8,1,137,43,196,177,57,144,170,
+67,51,106,168,153,107,187,164,1,160,45,51,17,3,10,33,31,159,161,178,233,40,33,33,132,153,0,149,142,0,163,153,
+57,130,52,18,240,43,249,128,152,144,192,114,8,2,146,74,9,172,168,50,249,137,48,57,52,137,11,84,188,10,5,138,
+25,130,34,5,241,26,146,154,29,150,138,40,33,136,22,27,145,185,240,90,168,27,42,48,81,40,26,106,136,13,48,169,
+91,26,41,96,1,140,56,155,171,113,140,25,19,40,96,8,10,24,189,11,36,15,9,128,132,65,139,16,2,143,9,147,
+138,16,9,65,7,11,16,226,137,90,184,136,19,41,88,148,26,8,241,139,65,155,42,161,104,88,160,128,64,170,153,149,
+137,0,192,72,115,169,128,18,157,91,152,168,32,184,96,20,153,0,131,159,57,161,140,73,11,64,3,153,32,148,143,48,
+201,129,40,139,98,180,40,153,244,128,1,138,137,132,10,68,193,162,32,250,161,147,153,137,197,56,65,25,153,132,168,152,
+198,129,136,193,1,134,24,137,129,27,42,232,162,161,177,114,180,18,92,154,9,8,43,14,129,10,67,147,71,10,67,0,
+0,1,201,11,130,157,73,44,45,112,8,0,8,139,40,209,41,27,9,62,22,8,0,137,47,10,136,10,8,185,120,36,
+44,8,24,29,24,201,1,136,28,88,131,57,75,208,58,26,139,225,147,27,113,129,0,161,232,16,8,170,9,242,144,22,
+136,165,1,154,32,177,171,151,184,128,7,128,161,163,10,146,137,169,194,176,41,119,41,160,209,145,136,25,28,168,26,82,
+34,88,136,160,137,105,156,40,233,16,48,2,89,8,171,146,0,14,152,180,169,70,41,1,138,173,163,177,169,48,248,0,
+34,82,136,166,28,129,185,24,160,170,167,35,194,20,224,17,41,13,42,129,13,48,131,132,10,184,139,81,159,40,137,58,
+75,112,144,33,186,48,137,192,43,187,121,43,66,72,18,240,165,128,160,19,224,19,156,131,75,60,12,74,11,143,161,144,
+160,33,32,10,164,9,144,213,136,161,134,136,34,34,17,3,73,41,227,89,42,128,0,21,180,144,179,11,218,169,59,12,
+145,43,84,209,149,8,28,128,193,153,107,152,40,114,43,0,165,152,176,176,195,104,11,1,99,138,26,146,137,159,153,179,
+131,186,131,71,42,136,140,0,27,203,128,39,153,129,177,72,3,144,170,50,191,40,173,90,18,148,136,132,152,153,188,11,
+52,41,201,114,163,56,202,19,149,194,43,32,25,140,162,72,39,8,163,137,242,25,232,8,18,35,138,163,146,202,235,143,
+18,0,176,146,7,57,186,25,50,45,233,0,16,75,186,146,84,9,161,176,146,30,168,170,98,121,144,0,136,0,217,139,
+107,16,177,128,66,58,192,27,64,57,248,136,17,10,161,8,120,131,17,27,44,45,137,137,92,17,2,161,210,16,209,232,
+26,72,128,25,8,50,148,248,24,9,180,168,17,8,208,144,123,17,161,131,168,189,179,210,25,17,7,3,136,14,162,168,
+14,1,132,136,128,9,4,128,31,8,64,139,16,217,16,25,44,48,105,0,163,219,9,0,157,0,113,33,146,154,60,137,
+159,24,73,145,3,201,32,146,171,32,114,195,0,176,187,147,26,122,1,5,1,200,218,16,138,42,24,39,51,249,176,32,
+154,170,161,23,16,177,169,113,138,160,24,82,32,192,203,24,10,146,50,121,4,163,235,8,137,9,168,84,2,166,185,128,
+163,255,67,0,25,170,224,130,134,179,168,89,136,152,161,36,18,178,221,25,8,8,9,4,82,4,187,47,10,152,160,50,
+83,36,217,43,152,137,155,179,6,20,138,47,24,137,192,2,34,83,187,13,144,10,169,23,129,21,9,187,195,10,241,32,
+129,114,160,160,177,8,11,11,64,133,179,140,1,91,138,72,129,84,137,138,153,28,29,58,34,121,145,138,24,12,29,9,
+34,81,17,155,161,29,143,1,25,112,9,160,128,9,152,176,151,80,145,137,128,28,156,146,34,81,164,168,17,172,241,147,
+145,18,132,128,44,200,217,56,9,129,151,128,153,144,193,48,178,150,21,44,10,168,200,25,40,132,7,153,128,145,155,94,
+136,129,18,57,10,145,235,61,145,136,52,43,170,10,32,159,132,145,114,10,136,8,153,15,0,131,122,144,0,25,168,156,
+150,129,56,9,136,40,170,206,49,152,105,177,148,136,136,202,35,149,24,166,32,154,160,248,144,3,8,167,40,160,177,242,
+16,129,145,180,17,161,243,153,41,194,161,135,24,152,145,154,74,162,178,53,43,128,212,176,12,164,1,96,58,42,24,31,
+11,129,131,40,73,27,88,15,11,40,41,77,58,41,59,155,47,48,42,43,66,59,79,44,11,57,137,24,17,73,62,138,
+184,64,88,11,17,1,41,250,160,16,74,186,151,3,9,184,208,1,0,243,2,18,138,242,177,1,128,193,18,35,217,198,
+145,8,8,196,146,2,152,195,27,44,168,183,0,49,8,226,136,136,145,34,79,16,9,160,45,59,25,25,45,3,40,74,
+15,42,26,34,47,80,43,26,140,25,9,33,31,56,16,8,140,58,29,1,137,97,41,24,158,41,144,163,153,113,0,130,
+216,0,138,33,136,120,178,146,242,27,137,3,241,48,25,147,185,138,136,33,213,123,130,161,192,9,0,74,169,105,146,32,
+192,59,10,58,160,121,6,137,145,29,153,40,136,78,128,17,129,27,142,40,128,46,33,48,201,45,25,43,162,45,35,40,
+8,30,144,156,34,91,64,42,42,174,144,43,131,12,65,73,16,12,137,31,1,137,67,48,169,219,177,8,20,185,112,89,
+152,160,161,169,144,34,52,36,226,211,168,10,136,193,148,33,164,167,176,136,161,136,40,22,162,169,144,15,34,46,25,33,
+128,57,1,175,140,251,66,0,136,40,104,56,145,44,139,172,90,41,46,76,72,43,9,12,124,160,151,73,27,171,1,211,
+34,138,24,72,145,147,31,139,40,73,40,48,184,149,29,10,57,138,200,89,8,131,136,58,159,80,169,32,2,147,24,172,
+136,61,152,152,113,181,1,161,44,200,176,88,129,164,8,195,8,91,240,146,16,8,164,128,10,136,12,149,145,132,26,144,
+172,2,48,63,168,65,168,49,219,130,163,114,43,32,27,201,244,137,146,138,146,80,32,128,227,129,29,145,145,17,196,146,
+24,44,147,31,8,16,144,211,144,136,45,57,24,120,9,8,168,148,0,79,152,145,129,160,91,12,88,138,0,0,192,164,
+136,153,3,105,168,134,18,217,147,25,138,26,88,27,0,162,136,46,31,144,40,160,35,195,161,120,9,168,48,153,66,75,
+156,130,31,9,10,161,134,129,40,26,57,13,0,170,23,0,153,179,144,250,64,138,57,167,128,209,0,137,16,152,104,145,
+161,131,11,129,177,132,45,151,128,193,40,171,128,1,24,7,213,8,128,152,28,136,179,23,41,92,152,144,185,21,138,150,
+153,128,168,148,42,89,8,17,154,194,152,40,50,197,149,147,242,0,26,12,152,195,24,50,107,154,146,145,249,182,17,1,
+136,144,169,19,10,10,61,1,135,27,152,171,145,133,193,21,146,16,13,137,0,168,164,89,196,160,180,32,76,168,8,33,
+17,159,162,59,129,157,165,17,6,184,146,177,90,137,40,16,98,12,168,128,12,153,153,145,70,176,48,168,124,137,136,42,
+114,136,9,152,42,169,56,44,80,132,42,14,26,145,0,29,90,149,32,153,29,144,136,59,74,131,145,73,143,8,136,25,
+106,130,162,178,14,129,9,16,79,130,136,18,218,178,9,136,130,115,161,1,235,129,152,58,11,120,9,149,0,26,185,121,
+60,8,136,130,241,168,132,162,129,129,154,165,168,0,72,105,168,49,198,147,137,139,43,225,18,89,0,177,136,74,46,58,
+153,73,57,25,91,47,27,136,56,24,24,35,138,144,218,128,136,47,167,17,57,29,202,146,9,144,51,183,56,192,211,40,
+136,154,150,148,24,10,209,144,181,163,162,4,200,145,136,123,24,137,32,17,60,29,154,88,8,168,10,35,16,79,153,107,
+10,25,10,133,168,58,160,90,26,248,68,0,128,90,240,132,129,25,8,154,16,9,226,132,149,169,177,0,137,148,137,131,
+83,173,180,44,145,17,179,52,40,170,158,29,24,128,24,110,0,25,144,9,11,146,91,58,82,144,32,15,10,8,192,128,
+66,177,131,142,32,170,24,41,39,10,200,170,18,134,9,171,69,176,151,9,0,25,152,10,5,185,224,164,41,56,43,28,
+88,144,161,176,181,25,195,176,39,16,185,138,14,145,17,208,113,128,128,184,212,130,144,145,104,0,168,136,194,16,136,232,
+48,178,163,225,149,168,16,184,48,5,200,210,1,73,27,209,128,5,162,128,41,10,138,234,80,17,196,176,0,58,9,176,
+140,53,128,201,32,57,128,224,43,7,48,189,25,25,136,162,153,53,66,184,25,124,154,178,1,80,90,192,136,56,75,224,
+128,24,24,177,0,40,185,183,136,81,162,228,9,58,42,194,0,48,33,228,0,41,176,241,177,18,145,149,224,16,25,56,
+30,42,161,4,137,43,194,212,144,33,1,147,203,41,169,120,11,90,40,65,170,0,178,29,176,40,135,17,156,74,8,58,
+138,74,29,65,192,58,161,169,185,50,123,36,208,168,0,11,177,89,0,23,177,72,8,201,161,57,59,20,198,26,9,154,
+213,129,153,132,2,137,113,154,144,43,144,18,134,139,128,225,162,98,29,8,131,168,89,137,185,166,1,58,131,186,34,12,
+170,34,249,113,73,138,129,225,193,147,137,17,113,14,128,16,138,130,144,73,129,145,194,151,152,145,146,48,112,43,9,138,
+47,76,200,129,0,160,193,24,154,81,169,177,51,171,11,131,146,137,7,146,55,92,26,16,155,24,98,138,18,145,32,243,
+179,9,163,157,129,150,145,8,185,88,136,187,115,160,11,107,25,138,20,203,21,145,25,136,144,174,35,128,106,146,27,146,
+10,153,132,234,43,20,136,16,248,25,0,224,17,146,240,128,32,185,35,154,41,23,192,131,59,189,8,4,59,33,138,16,
+40,31,153,9,207,50,147,48,171,146,178,3,62,128,198,137,88,145,40,9,129,84,160,33,173,209,137,82,153,20,24,41,
+139,152,192,91,249,16,20,24,192,129,136,169,146,130,2,13,45,131,29,28,145,49,161,66,13,154,189,49,25,18,129,165,
+35,175,168,177,224,8,83,129,128,29,177,225,43,218,71,0,32,0,17,136,172,178,150,210,64,58,1,97,137,11,186,26,
+56,81,33,164,2,207,131,138,27,200,20,50,16,27,12,144,31,162,1,130,141,8,51,224,154,180,166,33,177,193,144,28,
+10,4,64,56,57,251,48,10,14,192,17,50,145,177,9,130,175,17,128,65,143,8,41,18,29,40,176,66,72,154,203,160,
+225,4,163,51,72,185,173,3,13,169,32,121,17,145,242,17,155,10,146,96,136,137,146,74,144,27,165,59,99,44,168,29,
+9,41,88,8,67,137,249,161,129,200,129,57,37,57,225,161,162,141,145,32,128,0,180,196,2,169,163,210,67,153,182,170,
+41,75,48,128,68,40,249,137,26,184,168,144,71,64,8,139,32,173,8,9,33,27,121,10,97,11,8,162,77,136,1,249,
+136,32,41,163,49,21,192,154,46,153,26,169,52,98,145,0,28,208,168,161,161,19,136,167,33,194,0,147,155,41,105,201,
+201,72,73,33,8,120,160,193,186,129,27,193,1,85,129,161,128,154,27,46,224,88,9,128,130,128,144,134,168,153,20,170,
+154,14,33,20,17,75,133,177,141,137,10,60,185,98,20,129,138,128,154,13,169,154,38,176,49,104,152,16,179,201,122,136,
+216,160,161,36,3,160,115,1,204,8,10,170,2,90,98,129,137,26,144,203,162,193,10,167,16,18,178,194,19,242,8,145,
+10,143,128,32,36,145,193,23,169,176,160,225,0,152,35,37,144,154,19,156,13,136,139,136,180,113,2,24,27,150,153,9,
+194,155,76,42,83,0,128,123,163,155,26,170,200,57,123,49,32,169,72,216,192,16,11,171,7,41,17,0,162,104,12,184,
+150,136,13,136,18,18,146,179,23,138,155,200,209,128,161,4,7,144,192,130,160,136,208,176,19,137,151,130,1,128,180,200,
+4,225,225,128,32,1,146,25,19,196,169,9,12,249,1,40,65,162,145,74,138,192,8,15,10,18,57,104,128,145,64,14,
+24,8,171,29,129,148,66,26,1,5,28,140,42,11,44,74,57,6,58,28,129,138,137,217,169,3,33,94,16,24,107,137,
+41,41,26,159,42,146,81,24,41,81,138,138,12,184,14,40,9,36,50,136,26,209,184,140,171,122,40,9,33,135,16,210,
+145,169,180,241,9,146,17,2,130,52,8,232,11,184,240,129,51,238,66,0,136,4,35,145,26,107,155,176,153,14,32,0,
+10,23,40,1,59,58,9,208,207,0,41,72,48,81,16,74,14,10,218,0,9,0,81,131,128,178,179,172,10,174,163,34,
+200,37,4,178,9,193,152,146,15,186,130,130,37,82,162,149,200,144,176,42,15,8,56,82,1,11,178,29,137,201,225,17,
+128,9,37,146,25,58,241,2,153,171,136,144,146,119,179,130,16,157,161,170,169,136,17,67,119,137,128,152,26,11,10,140,
+4,136,112,49,154,0,208,40,58,140,30,25,168,96,4,25,56,185,176,225,192,160,17,27,100,163,177,2,155,192,128,216,
+41,178,90,113,0,57,153,129,138,212,170,209,178,89,36,144,17,161,9,31,201,161,8,128,113,51,40,26,169,121,60,168,
+180,181,77,12,195,131,137,227,144,128,29,9,0,11,33,48,59,16,235,40,27,177,3,18,70,123,17,0,144,32,139,122,
+9,26,42,57,85,27,27,129,142,57,9,11,56,143,49,66,46,25,74,137,8,139,44,128,76,1,19,27,201,136,185,121,
+169,208,18,140,41,72,130,27,24,155,60,157,30,160,16,121,132,24,24,170,12,148,60,138,32,172,38,0,129,27,171,88,
+155,10,106,201,18,33,16,90,178,242,24,144,137,58,45,123,18,128,130,48,156,146,10,241,194,128,132,51,145,43,143,144,
+17,192,25,152,12,73,135,161,144,146,160,213,9,168,168,9,53,65,152,18,219,8,152,157,160,33,11,7,148,131,169,187,
+37,170,154,134,12,128,50,163,135,160,1,122,154,152,232,161,133,34,40,73,170,168,209,176,57,139,122,129,67,192,19,30,
+153,26,160,129,89,153,124,16,128,41,144,10,160,13,136,185,58,69,34,18,12,242,138,153,145,137,121,176,19,147,146,193,
+138,123,9,11,130,242,128,49,131,132,11,135,170,209,145,154,48,184,84,33,34,137,206,40,185,210,8,161,130,135,32,16,
+170,224,177,51,188,16,195,56,54,177,0,181,177,179,232,75,184,145,21,132,132,160,177,153,155,128,205,35,163,200,116,136,
+152,25,153,44,169,130,240,161,149,51,24,43,132,170,142,1,156,165,161,16,39,9,178,152,194,161,251,146,163,163,146,4,
+132,202,164,176,17,154,138,164,128,26,150,7,1,202,128,184,96,26,14,32,121,242,70,0,72,49,1,155,45,11,11,227,
+17,17,12,65,32,12,9,153,89,14,144,137,25,92,24,34,60,145,154,202,58,155,167,180,16,67,130,18,155,156,240,153,
+49,8,186,130,55,131,176,173,131,153,43,232,145,144,122,134,129,8,8,154,240,40,12,8,32,89,89,0,136,24,186,188,
+181,17,40,184,121,80,25,43,161,25,142,146,16,154,26,128,39,33,152,42,191,90,10,144,8,154,55,0,129,170,161,137,
+143,65,28,144,89,129,36,139,9,146,233,26,128,1,139,43,115,135,24,42,201,216,1,56,171,168,6,65,1,186,17,188,
+154,133,185,82,140,33,67,146,12,195,161,140,164,178,243,145,17,20,32,9,170,232,152,145,160,163,243,34,7,152,9,160,
+241,25,40,153,194,145,120,1,161,17,154,171,56,19,159,228,0,34,33,140,2,185,170,161,167,57,13,24,134,130,25,144,
+195,154,138,211,20,155,44,134,147,138,8,240,146,9,19,200,176,88,32,145,148,146,141,176,50,200,148,248,65,32,168,178,
+16,156,26,162,3,240,138,64,81,153,169,163,10,56,248,145,136,10,84,18,123,42,184,152,121,9,201,161,121,16,0,178,
+129,154,234,18,25,0,203,2,115,8,153,163,128,168,224,131,216,11,1,97,41,24,153,167,25,137,160,241,129,33,36,8,
+168,76,224,17,60,136,208,178,49,16,176,197,16,26,57,10,188,200,210,82,2,144,243,144,40,136,161,176,169,112,51,177,
+180,209,162,16,41,227,242,144,129,112,9,9,128,128,16,138,162,240,43,32,35,56,185,160,180,47,107,170,185,133,122,16,
+137,136,8,8,8,105,152,217,196,50,41,153,144,132,24,152,145,189,138,243,6,129,176,162,211,33,27,155,193,145,88,147,
+32,62,140,178,151,24,136,224,17,74,8,162,128,77,136,146,128,152,203,178,97,40,8,177,148,24,10,92,170,46,145,162,
+6,24,139,195,32,155,24,233,2,136,179,7,152,73,136,164,9,32,157,170,181,33,113,144,145,40,185,163,61,30,168,161,
+5,33,152,224,164,145,137,160,241,34,138,24,2,146,25,212,182,32,153,184,180,145,80,195,165,147,160,208,131,26,14,129,
+195,34,1,202,73,144,9,32,204,3,208,16,121,169,145,8,147,106,152,152,154,167,128,64,118,1,67,0,1,168,134,160,
+27,26,8,65,248,147,4,160,193,162,72,156,181,2,169,178,243,3,177,137,148,211,136,243,162,144,164,57,179,33,59,18,
+0,141,170,107,57,232,145,150,163,24,182,138,210,131,136,32,13,17,32,154,167,136,128,176,148,232,196,144,163,51,45,8,
+179,137,129,171,183,144,24,121,178,145,148,145,194,105,13,1,152,145,34,186,182,147,128,139,161,76,17,14,16,128,193,18,
+130,75,142,1,242,179,177,65,48,28,0,43,128,234,195,17,8,58,107,40,176,196,2,155,177,200,134,26,146,25,132,48,
+1,120,143,9,144,136,128,169,23,152,3,58,1,15,176,128,2,138,24,112,48,152,33,248,40,203,3,12,144,121,162,128,
+146,180,128,140,60,10,128,170,114,136,18,9,134,144,172,42,1,213,178,2,81,136,24,192,57,187,17,170,243,8,98,41,
+72,152,180,216,145,128,160,226,56,133,17,155,33,154,60,15,154,132,192,145,83,161,32,196,56,217,9,10,17,192,66,32,
+152,35,34,191,25,153,16,231,136,1,49,10,16,9,194,234,200,131,25,30,104,16,137,179,33,208,194,169,17,41,137,82,
+8,121,24,42,11,242,8,162,8,184,7,129,58,41,161,155,170,26,97,203,26,68,25,96,45,176,17,156,75,26,8,57,
+105,162,32,178,13,8,123,75,26,128,24,132,60,169,97,10,29,10,42,129,12,88,74,132,45,145,153,178,152,161,129,141,
+120,64,11,147,11,19,143,163,42,89,12,3,24,137,138,6,138,59,156,165,152,129,42,23,75,72,10,0,140,27,155,179,
+44,112,152,131,42,24,204,150,16,40,170,130,131,178,31,16,40,58,185,163,241,30,137,6,16,72,139,164,160,136,29,137,
+41,92,16,43,153,73,216,2,59,97,154,178,64,57,45,170,34,8,153,94,152,26,171,21,1,37,9,152,146,169,29,219,
+160,32,67,81,160,28,184,41,156,23,160,177,145,19,27,249,160,36,89,12,194,41,186,105,8,114,128,161,129,176,138,193,
+160,90,16,40,194,145,176,44,177,125,146,168,160,49,58,137,186,47,5,169,197,145,161,26,146,123,35,26,0,57,172,185,
+130,159,104,152,133,9,0,10,211,27,67,8,8,9,160,228,168,176,98,136,16,28,192,137,152,80,64,149,236,14,69,0,
+152,17,226,160,8,10,59,149,19,177,177,136,137,200,122,134,136,144,129,169,72,171,107,0,129,30,146,154,185,146,60,87,
+136,24,24,13,177,145,154,0,149,146,18,248,16,161,10,39,193,161,32,26,176,152,156,99,3,12,40,249,144,192,41,65,
+18,137,32,170,217,152,40,138,135,58,123,200,16,41,61,89,1,128,137,44,59,137,59,137,39,136,9,170,12,170,79,41,
+65,194,129,146,171,169,59,153,183,197,18,43,107,160,16,28,18,197,163,152,27,160,112,27,2,227,146,40,138,194,139,62,
+34,194,19,32,13,184,73,13,168,147,131,8,204,149,32,12,34,1,130,44,221,129,74,128,72,148,25,153,177,162,225,11,
+133,18,17,16,186,168,75,154,136,186,13,35,161,243,25,241,19,72,180,32,190,17,153,161,120,145,3,152,93,169,162,137,
+25,64,163,98,42,209,193,145,88,185,0,18,60,10,130,168,79,138,132,40,185,248,144,3,91,160,21,136,43,138,145,171,
+92,144,4,81,25,168,136,184,120,168,147,41,157,33,138,35,111,169,40,1,144,155,171,131,29,52,11,52,140,26,49,159,
+24,172,20,66,168,50,186,61,10,32,249,48,152,105,138,73,42,128,28,5,226,16,57,15,24,136,29,17,111,32,155,151,
+10,45,160,16,144,131,184,132,18,29,128,193,42,124,16,160,0,144,193,194,80,137,201,2,136,153,4,165,137,16,154,122,
+128,17,10,138,32,45,10,80,76,9,40,224,147,154,178,0,59,133,10,17,113,160,193,162,74,43,128,145,129,122,235,51,
+42,216,211,40,25,27,147,48,143,128,64,13,132,137,131,145,32,202,3,209,169,137,145,89,140,132,179,80,25,176,62,163,
+146,177,64,141,161,7,184,130,16,203,0,145,140,129,48,139,123,48,209,90,152,64,128,17,224,56,136,218,160,113,136,58,
+27,8,185,122,59,75,163,41,179,33,32,31,8,193,210,24,57,140,17,157,42,89,40,153,20,157,150,8,152,50,177,35,
+171,168,113,218,145,24,130,26,130,168,125,200,129,211,17,152,144,147,40,9,16,148,81,15,8,1,43,185,138,167,10,80,
+43,144,132,10,169,183,131,180,17,131,141,211,74,137,24,75,8,24,30,144,1,227,162,34,154,181,200,144,35,9,151,128,
+68,7,68,0,128,90,153,11,138,241,66,90,160,152,131,74,14,8,131,24,194,24,16,124,139,146,144,40,178,89,153,170,
+45,128,33,74,209,133,25,42,73,28,140,4,58,194,132,226,128,136,136,194,128,179,3,26,193,62,25,72,133,34,11,139,
+14,136,58,44,162,134,13,161,16,160,169,133,25,83,155,151,8,139,32,42,194,51,250,18,11,56,137,146,21,25,201,192,
+192,228,2,41,144,130,244,129,152,32,138,210,34,0,226,2,185,150,0,138,25,73,30,137,32,9,18,33,161,198,18,241,
+145,210,1,75,152,18,139,58,60,152,146,10,195,146,113,25,144,241,130,0,138,243,144,25,195,58,165,32,138,97,144,48,
+141,43,162,178,37,11,196,160,177,25,240,163,9,52,88,8,107,185,184,165,161,179,162,138,56,77,137,32,176,181,133,4,
+32,154,161,248,147,138,128,153,228,19,29,152,195,129,135,40,24,152,40,234,147,128,136,250,128,136,105,10,18,145,146,5,
+12,243,0,152,130,40,8,10,169,160,43,23,152,245,149,1,137,129,176,17,59,153,8,136,204,123,138,8,160,20,150,33,
+168,149,139,61,74,8,40,168,176,156,177,184,147,23,161,35,134,163,9,63,137,56,24,216,209,212,0,128,145,128,34,63,
+8,162,42,153,154,60,19,91,216,18,185,122,0,12,64,45,56,154,147,2,156,17,35,251,25,154,59,136,5,8,84,30,
+144,132,128,160,153,194,80,137,10,168,42,177,10,131,121,136,121,17,145,161,11,40,95,8,176,8,44,192,58,185,122,65,
+60,57,144,164,169,210,89,24,41,31,26,152,24,128,128,132,25,104,26,163,59,141,9,22,12,44,154,149,8,178,149,32,
+25,144,33,17,143,152,24,2,26,31,42,155,243,3,153,120,9,75,41,41,26,43,24,106,27,152,31,136,56,26,9,57,
+18,92,112,57,200,153,144,16,150,161,153,180,163,184,3,73,140,209,164,166,178,145,144,8,151,0,28,41,185,211,17,147,
+123,10,130,16,181,9,47,8,145,32,47,41,10,8,129,209,18,44,25,1,18,47,30,25,145,162,8,200,32,27,200,4,
+130,56,31,130,149,136,138,160,4,200,163,24,178,183,170,34,146,160,1,64,151,0,224,149,129,0,201,137,177,242,210,32,
+32,8,128,131,24,9,63,0,130,209,170,9,131,81,187,74,42,197,138,135,33,44,137,138,20,145,138,162,123,0,200,136,
+0,176,242,178,21,136,144,240,132,145,169,194,20,91,152,154,34,8,189,147,66,25,9,43,113,194,147,185,34,59,168,61,
+13,2,184,152,113,10,16,76,56,160,193,161,172,151,24,8,91,168,1,172,18,132,61,45,57,136,120,43,153,167,163,144,
+25,24,44,61,42,145,8,152,130,183,18,138,63,42,8,14,56,59,144,26,77,129,9,226,1,0,130,43,25,56,28,47,
+153,16,144,146,46,167,130,153,146,64,26,26,176,134,129,139,241,178,33,27,217,3,210,2,31,130,73,137,145,145,196,8,
+242,129,0,26,10,151,146,24,26,17,16,89,47,11,33,12,26,42,132,8,15,2,128,26,203,166,181,146,128,177,133,28,
+9,145,150,136,137,129,145,56,47,194,163,19,75,138,73,47,8,26,145,40,171,130,121,161,225,32,56,178,90,27,128,174,
+145,33,137,147,225,104,152,195,17,10,192,132,18,155,180,147,128,170,148,151,200,44,129,132,43,129,24,4,57,47,161,42,
+143,8,162,2,169,73,128,59,121,46,137,42,49,128,4,187,32,44,169,150,195,186,40,67,32,42,47,194,132,25,146,224,
+137,0,0,33,242,9,25,227,2,168,144,137,83,57,65,200,25,185,29,2,226,208,136,36,136,18,59,195,129,136,23,170,
+169,44,1,1,195,160,92,176,61,179,176,178,24,114,18,144,25,43,191,164,145,137,140,144,151,34,27,96,8,9,147,2,
+240,155,144,132,147,25,26,25,137,128,176,121,10,99,2,7,200,192,210,24,16,13,10,44,131,1,179,81,160,161,134,19,
+13,156,41,177,18,144,41,146,201,146,215,178,210,35,17,20,136,74,235,192,180,128,153,201,133,1,32,161,35,153,45,4,
+24,140,142,136,148,33,44,73,44,26,26,28,152,8,32,7,20,24,160,169,9,138,142,143,8,58,1,35,104,161,160,65,
+40,242,140,176,131,1,162,80,233,145,145,16,168,58,105,121,0,18,8,156,153,162,26,159,136,56,32,76,81,9,153,128,
+16,20,159,154,16,148,146,0,147,171,241,176,3,57,140,34,55,34,1,174,184,161,194,160,217,19,75,1,53,48,142,153,
+18,163,29,14,137,56,41,96,186,13,68,0,10,177,9,60,13,8,59,60,115,16,19,136,157,160,0,142,27,0,193,19,
+24,55,160,160,184,135,161,200,184,196,165,129,16,144,144,27,184,5,193,192,17,21,19,18,188,184,241,160,9,9,0,47,
+162,68,131,42,28,104,153,10,152,8,131,25,106,163,11,174,146,225,17,45,42,32,50,89,144,170,184,131,205,26,193,49,
+177,114,52,10,155,72,179,184,209,14,3,43,57,24,48,172,44,144,210,9,61,136,7,66,26,43,11,169,13,250,1,136,
+32,168,39,72,138,40,144,163,159,145,130,8,138,183,167,129,9,136,161,144,41,45,131,48,133,16,184,136,216,240,153,129,
+40,61,50,1,178,169,64,193,193,171,131,131,215,32,16,1,155,129,149,241,42,153,147,161,135,19,9,128,14,234,161,8,
+8,144,7,49,24,27,26,17,250,192,40,16,46,9,34,59,144,61,24,8,187,25,125,73,8,33,1,136,10,218,219,153,
+137,199,1,130,134,144,144,0,129,142,160,18,138,17,28,134,162,160,81,200,178,137,146,90,145,35,67,58,14,193,169,11,
+26,155,112,17,49,112,27,25,144,140,29,76,137,25,26,35,17,144,43,212,225,128,8,73,3,184,20,148,32,15,200,136,
+25,168,3,179,6,20,145,131,169,217,248,24,10,9,194,48,122,1,11,163,28,248,129,24,48,8,160,71,42,9,187,89,
+31,161,8,40,73,9,51,75,44,9,249,16,137,128,139,40,88,196,162,33,201,193,49,12,16,145,229,17,131,137,170,24,
+13,162,11,165,165,129,37,9,129,24,248,42,177,73,155,17,138,7,195,8,147,154,10,243,131,60,25,58,21,91,170,154,
+232,4,193,33,66,0,162,23,1,143,209,161,1,137,161,58,31,153,146,41,9,176,45,144,9,160,131,74,5,4,146,72,
+28,49,27,121,56,1,58,120,146,16,129,157,163,168,64,140,176,0,89,11,161,148,29,177,178,130,128,248,146,37,62,26,
+192,17,137,184,146,5,42,43,35,66,45,171,193,17,174,137,168,160,148,151,41,72,141,168,130,24,186,181,197,162,134,136,
+160,8,26,74,46,26,16,137,129,182,149,128,179,194,195,8,59,58,77,90,128,131,40,176,170,166,56,57,153,180,23,25,
+144,26,137,178,215,161,0,162,57,52,122,153,165,34,68,0,128,138,137,138,194,65,184,0,162,135,33,27,27,9,233,131,
+76,170,178,194,180,56,14,184,194,242,24,74,26,0,149,2,152,195,10,138,27,195,145,75,104,3,128,43,199,161,192,19,
+72,8,90,24,243,128,128,137,16,155,1,57,244,162,51,136,89,45,138,200,168,162,2,200,17,114,160,8,161,162,132,141,
+113,138,129,241,3,128,144,128,41,153,156,162,41,165,120,32,1,184,197,194,178,168,40,29,136,8,6,144,161,149,60,12,
+89,176,48,184,18,8,94,10,153,195,144,178,147,80,76,74,1,1,43,16,30,28,76,153,146,177,48,48,29,90,28,144,
+178,162,72,45,75,57,57,154,209,164,43,26,31,145,17,194,5,148,8,136,153,179,173,130,57,153,47,4,153,25,129,164,
+59,122,155,194,0,18,192,4,123,58,139,137,184,42,171,52,125,49,10,17,184,210,200,0,58,59,9,67,198,177,179,19,
+26,128,172,3,241,177,149,129,129,32,217,144,217,176,146,180,97,18,163,41,42,162,242,141,9,34,185,41,23,129,59,57,
+61,184,26,138,24,23,11,80,27,0,193,14,241,129,60,58,25,0,6,128,74,24,58,159,154,130,128,75,136,7,137,128,
+146,197,18,11,58,75,26,122,144,24,8,25,250,227,145,168,148,1,49,16,138,18,59,28,159,9,40,154,214,20,144,136,
+128,18,185,162,160,43,121,160,73,56,155,5,137,177,217,218,41,80,226,21,168,146,146,145,155,11,193,184,51,169,71,27,
+138,82,241,195,1,137,24,152,120,128,144,40,76,9,157,163,194,56,16,64,104,154,227,146,144,152,41,153,2,184,51,51,
+191,89,1,160,26,145,204,72,1,195,7,8,152,40,43,77,141,25,56,9,81,8,9,42,161,241,16,186,170,149,162,150,
+166,0,91,57,140,16,137,9,24,43,98,171,199,147,145,160,144,0,47,16,58,120,58,28,144,129,184,0,224,129,25,89,
+1,27,42,91,145,43,16,29,141,227,49,56,25,28,48,77,11,153,192,131,161,114,17,25,27,153,9,44,46,139,8,128,
+22,177,213,162,3,137,8,176,141,144,89,81,10,8,214,146,160,162,184,178,104,42,67,8,8,29,0,44,28,184,178,212,
+65,33,43,74,76,74,11,25,28,27,28,32,2,193,196,145,83,249,67,0,130,43,170,0,154,20,96,5,91,11,58,0,
+232,168,178,226,179,5,163,195,195,18,160,25,61,27,47,136,34,44,10,144,17,136,232,164,168,91,40,36,74,10,138,32,
+141,28,137,177,136,35,7,162,128,89,144,162,184,215,160,145,18,144,150,177,32,17,143,137,152,161,18,148,151,179,154,98,
+136,13,41,27,59,40,111,41,144,153,4,24,154,18,31,43,138,2,17,26,122,0,139,144,230,8,25,1,32,129,168,8,
+17,190,210,131,193,145,162,135,195,177,35,57,187,213,144,128,160,179,151,18,169,149,162,137,160,212,41,40,25,151,25,61,
+136,144,153,0,171,33,240,16,135,129,75,57,136,232,32,60,59,75,44,145,210,131,163,225,163,146,29,16,42,41,57,40,
+209,165,248,178,130,42,26,168,38,43,42,122,57,29,42,152,57,139,171,151,2,58,33,75,44,107,136,2,26,24,21,144,
+163,7,250,177,8,59,154,144,60,59,220,40,1,248,161,0,144,209,168,3,88,193,35,72,136,16,136,148,134,211,17,50,
+73,136,105,139,40,192,160,80,154,144,65,153,1,227,139,122,9,9,90,140,1,211,128,16,179,17,47,8,10,128,11,121,
+128,16,58,249,146,177,176,56,128,105,107,9,25,178,168,10,165,33,14,152,9,182,144,160,5,24,59,42,240,131,186,32,
+36,19,46,154,225,161,194,145,148,147,57,88,153,146,226,144,5,1,153,41,248,179,164,161,5,129,57,60,170,195,194,57,
+1,151,40,27,216,193,148,25,42,129,57,109,137,161,0,43,25,16,33,47,203,147,18,29,58,16,123,46,152,194,146,10,
+41,66,75,138,153,180,145,45,137,49,153,107,146,132,144,185,149,34,24,143,145,128,8,130,33,2,66,251,130,152,210,169,
+160,117,8,145,138,17,203,193,33,45,146,192,132,0,178,184,48,121,144,9,27,29,208,148,104,43,162,162,160,59,212,161,
+59,121,56,8,29,43,177,193,74,42,163,0,77,58,180,168,124,25,16,43,28,26,224,146,48,129,32,40,13,155,198,128,
+8,24,50,41,28,154,225,180,160,131,18,137,210,0,5,209,128,18,80,138,160,142,154,181,130,51,105,152,164,168,10,163,
+140,90,56,4,146,47,10,164,185,48,73,169,160,27,132,167,160,106,56,200,24,1,68,0,129,12,168,180,152,112,0,162,
+32,59,187,166,176,44,17,19,97,31,168,147,137,43,32,195,49,31,152,33,9,13,18,133,43,139,156,0,44,59,22,17,
+1,152,232,9,202,192,20,18,20,177,187,123,169,185,99,145,1,242,128,129,161,193,96,32,138,145,141,26,160,138,115,2,
+136,147,200,184,163,170,63,97,58,56,203,40,144,170,10,55,25,74,156,128,35,15,138,68,8,44,201,128,145,153,42,39,
+0,9,177,138,129,15,10,35,19,122,242,160,130,136,185,66,147,57,224,160,20,11,137,33,7,136,225,177,1,28,28,64,
+19,46,144,136,136,139,10,161,55,10,149,184,8,91,140,56,33,42,162,248,0,16,176,160,55,145,161,187,138,59,220,64,
+68,128,0,202,145,10,218,8,52,1,97,12,11,74,138,11,112,17,40,141,152,16,26,29,96,24,17,140,186,1,137,187,
+115,134,17,169,196,145,138,8,41,21,74,200,210,144,1,170,19,51,106,216,210,129,57,138,41,51,104,185,240,16,59,169,
+128,23,73,168,145,145,26,45,138,51,168,19,220,24,59,168,137,51,39,169,233,179,146,161,61,81,132,128,201,10,216,40,
+12,66,33,2,170,242,162,10,75,76,32,56,208,178,168,123,10,40,33,25,176,240,24,44,137,1,53,0,225,208,145,26,
+168,81,105,8,161,194,16,139,137,145,22,145,179,194,10,155,162,17,99,16,197,192,194,162,153,147,82,165,1,186,9,15,
+152,16,49,21,41,9,154,241,153,41,48,19,105,26,154,201,91,59,8,134,56,74,156,8,59,168,66,135,16,185,232,144,
+185,129,2,39,128,131,29,137,201,168,2,68,210,17,153,161,200,146,72,2,180,4,139,28,185,41,123,35,179,130,188,232,
+232,162,130,147,151,1,136,168,160,27,26,67,196,19,153,212,128,30,136,147,165,72,42,138,153,73,168,4,2,49,240,184,
+24,47,153,34,130,112,137,152,26,155,184,80,50,78,152,1,25,31,26,74,24,42,163,16,13,26,184,37,80,26,1,202,
+176,13,168,104,162,5,162,1,155,187,226,129,18,0,151,24,154,12,193,0,150,161,151,145,152,184,147,0,130,133,148,160,
+186,155,212,74,130,4,132,0,154,156,195,138,7,24,129,184,146,84,127,57,11,241,138,16,20,205,81,0,129,129,9,16,
+64,48,201,0,175,1,104,58,1,11,180,144,9,133,45,13,40,42,56,224,2,170,2,192,147,64,17,209,8,41,156,129,
+17,160,84,145,57,205,160,177,74,73,24,89,33,28,42,173,1,160,21,40,26,137,11,240,17,163,145,41,243,153,89,170,
+4,168,66,74,137,120,11,44,146,57,73,43,196,192,152,144,184,0,121,18,146,163,185,153,130,4,77,89,16,11,192,2,
+217,16,91,9,161,203,156,34,74,106,160,36,57,155,183,161,40,59,90,10,89,169,192,166,160,32,209,1,162,57,26,226,
+25,50,104,40,59,171,184,140,43,73,194,178,135,57,15,25,26,129,0,34,76,178,17,123,26,25,184,88,25,129,45,128,
+31,184,18,25,136,21,169,124,138,176,130,194,5,128,128,179,241,161,161,17,48,90,138,0,31,27,160,16,132,64,160,149,
+44,42,169,2,136,112,59,43,142,129,129,57,184,134,146,136,26,143,160,132,129,96,153,164,194,9,8,144,17,8,246,129,
+16,27,152,0,146,151,195,129,154,32,42,41,88,67,10,192,31,186,128,161,7,16,0,184,200,144,154,7,2,48,184,162,
+120,11,13,41,40,17,146,162,221,154,128,166,17,49,33,11,9,15,0,11,147,112,160,18,15,176,195,162,2,56,184,15,
+1,40,224,32,57,0,33,43,61,189,165,1,40,91,211,33,153,128,14,154,130,25,7,42,40,12,194,26,10,72,33,145,
+136,40,45,142,25,33,151,128,107,138,43,185,32,210,39,57,154,8,155,179,10,0,112,196,129,25,30,0,137,8,7,146,
+12,25,153,145,136,40,22,34,248,160,154,145,44,1,21,133,192,24,193,136,144,8,145,84,129,145,217,227,128,177,18,4,
+152,154,227,163,2,169,12,23,184,0,170,144,112,139,19,64,129,45,139,154,0,105,60,67,201,147,161,155,35,14,29,147,
+151,128,137,144,146,11,89,17,65,171,225,194,41,9,27,37,132,200,162,25,185,185,65,112,48,11,216,195,162,56,138,17,
+7,136,136,29,0,9,181,106,16,11,224,177,129,144,24,195,23,24,138,27,146,139,233,131,23,0,138,224,1,153,144,17,
+5,129,138,29,90,170,164,146,115,9,153,160,9,41,61,129,83,211,8,43,13,136,160,0,33,21,28,11,28,249,65,0,
+152,212,34,11,17,151,128,193,10,0,42,185,20,23,10,153,242,162,185,3,33,22,73,186,177,89,139,185,147,39,41,202,
+128,162,26,169,80,64,133,138,30,130,168,244,129,18,16,139,193,32,44,43,176,5,130,242,128,57,46,9,144,66,41,137,
+203,145,160,34,62,88,16,224,193,32,43,24,153,133,19,169,234,145,229,146,0,32,1,16,29,152,193,144,153,164,151,18,
+139,8,200,145,24,9,37,56,31,26,177,128,160,199,132,146,42,139,160,56,31,146,3,0,209,144,129,137,90,208,65,56,
+171,161,194,194,164,162,80,17,170,170,178,62,136,194,121,131,168,185,210,33,186,151,32,56,25,46,144,25,201,195,1,131,
+149,8,137,145,61,26,16,147,167,60,138,242,162,129,176,52,8,25,15,192,56,43,152,167,150,128,136,176,129,18,154,48,
+132,9,143,16,12,131,169,151,163,195,193,146,0,32,202,112,17,152,234,146,26,74,168,19,146,35,175,164,153,163,180,49,
+1,107,202,32,156,80,25,73,58,195,168,9,26,76,227,16,128,35,141,138,161,49,91,63,25,163,128,75,140,128,160,26,
+160,87,128,61,184,130,136,61,74,40,57,30,144,57,9,59,25,38,171,139,210,129,1,61,74,73,177,58,139,196,145,201,
+1,6,161,160,242,33,153,124,27,131,17,176,130,32,131,96,225,41,43,187,213,128,160,208,144,76,145,136,138,153,41,14,
+32,123,56,45,137,145,179,4,160,37,107,25,17,9,162,24,27,130,23,137,242,152,128,179,129,40,145,130,240,136,105,142,
+161,0,134,136,144,24,128,75,11,16,60,168,34,183,178,193,19,137,67,47,26,30,137,32,152,24,89,129,200,243,1,154,
+8,184,22,25,17,140,3,138,152,212,8,177,56,210,104,168,145,211,147,1,192,200,0,0,145,33,120,104,10,128,57,170,
+31,10,81,24,56,138,150,9,42,128,43,168,32,149,24,0,63,9,161,134,25,155,140,80,16,8,193,115,25,152,177,210,
+232,136,148,131,1,154,147,27,153,60,15,58,61,16,136,3,143,8,146,144,150,10,140,75,0,41,145,122,16,9,24,209,
+184,169,112,146,20,193,163,16,241,128,162,144,128,147,180,165,9,169,4,10,3,128,190,217,18,152,151,56,56,18,15,136,
+78,6,69,0,137,156,75,2,120,144,24,75,184,58,168,16,28,57,164,135,0,185,64,184,18,193,226,136,121,27,144,147,
+40,4,202,131,200,154,140,134,56,146,128,89,152,14,152,129,162,107,145,33,8,157,33,181,56,42,192,241,0,152,131,182,
+17,88,176,136,10,138,204,149,64,8,195,161,19,141,193,146,129,92,128,40,58,168,200,151,57,152,162,226,40,153,195,3,
+136,49,166,168,184,197,225,17,25,1,130,152,41,177,15,44,128,160,5,16,24,177,201,32,242,64,25,176,153,33,30,0,
+211,19,35,169,242,152,224,161,130,64,131,226,163,129,171,240,131,43,32,161,132,90,12,193,131,9,8,197,0,59,11,226,
+5,9,33,129,59,30,186,226,32,0,80,129,24,138,137,233,57,139,40,35,33,67,159,178,43,128,186,7,26,25,106,153,
+1,40,10,23,137,43,234,177,152,38,74,2,8,60,14,152,26,41,26,99,162,41,240,161,144,88,11,3,10,26,47,40,
+74,58,128,33,26,47,152,142,137,34,3,80,129,153,170,152,157,194,212,64,16,19,138,186,163,185,180,90,196,168,24,26,
+135,40,41,10,48,176,12,143,169,104,73,129,167,1,153,170,9,162,57,11,23,81,42,13,161,8,8,9,131,196,170,128,
+148,52,27,169,131,178,74,249,173,90,73,160,135,1,152,138,169,35,154,241,145,22,24,161,153,24,144,188,7,24,154,12,
+131,66,209,146,136,18,155,244,152,168,17,134,16,0,195,160,144,141,149,153,136,113,146,1,10,193,178,0,12,131,210,184,
+18,130,115,27,58,200,3,31,176,138,138,70,168,20,8,160,249,144,48,138,128,43,39,177,2,30,8,9,169,35,16,234,
+153,83,128,147,16,153,129,45,61,143,137,57,36,58,33,91,157,153,136,152,212,128,114,1,25,138,16,12,10,9,80,44,
+154,105,144,131,24,177,73,137,170,140,9,189,103,9,16,56,184,232,161,145,136,9,74,84,26,185,4,192,24,200,1,146,
+208,26,22,58,42,1,161,8,248,168,107,27,90,129,1,89,8,154,28,138,145,161,193,83,130,161,123,56,187,161,152,194,
+164,234,48,56,130,131,151,137,163,187,142,162,176,151,132,146,132,194,138,176,195,161,128,91,98,168,136,149,211,128,9,128,
+41,186,156,7,108,247,69,0,130,40,32,240,147,153,185,178,136,25,55,146,96,128,141,144,128,185,162,146,121,4,10,2,
+145,170,27,242,74,184,248,3,17,1,17,208,74,40,143,41,43,153,48,18,40,7,170,145,168,138,184,164,60,55,10,90,
+163,137,154,0,14,16,218,10,53,9,96,9,136,24,249,160,33,217,0,20,8,37,170,153,56,15,176,131,138,97,128,161,
+135,128,138,128,58,89,32,159,34,32,33,2,33,240,140,15,168,164,176,162,212,163,0,11,9,75,157,32,154,16,131,16,
+114,48,216,1,145,34,88,187,20,82,8,17,148,91,161,160,137,24,143,136,2,88,129,244,16,138,211,128,144,152,179,131,
+112,129,154,128,89,139,151,139,170,17,132,53,152,232,16,11,128,208,147,26,169,5,0,72,168,186,134,12,138,26,82,75,
+129,161,165,192,145,3,178,25,204,200,82,65,9,26,26,122,13,184,2,227,161,19,129,34,248,161,50,152,61,168,49,47,
+129,32,162,2,205,150,24,176,162,185,67,28,49,78,26,24,184,160,41,144,169,77,51,153,199,177,17,145,200,33,170,176,
+3,112,43,66,159,1,136,177,195,178,9,150,149,40,161,41,232,16,11,3,47,26,122,24,128,153,136,164,16,27,153,138,
+130,64,149,181,179,136,49,76,31,42,140,16,97,11,17,136,41,89,240,8,8,10,25,151,0,0,153,145,64,143,16,26,
+138,148,163,130,163,43,92,61,27,137,225,146,3,146,72,75,27,137,165,152,201,0,8,83,16,179,2,171,145,140,175,34,
+225,32,2,49,186,246,8,178,147,136,34,143,0,25,136,135,8,180,17,12,41,203,130,131,163,135,168,56,107,137,138,161,
+0,208,195,149,147,17,152,75,156,200,164,160,56,148,33,62,10,193,149,177,212,162,153,105,136,147,3,152,76,168,57,47,
+184,162,135,25,128,1,138,0,213,161,129,9,160,64,25,113,139,162,178,131,234,129,8,75,216,132,163,129,243,129,48,140,
+40,170,178,131,167,4,193,145,73,184,58,32,138,12,81,10,179,121,42,33,159,24,168,241,2,24,32,41,30,42,8,10,
+163,201,73,129,169,134,180,148,181,0,136,153,62,139,17,112,128,26,40,74,208,177,145,177,1,90,90,152,181,145,165,24,
+11,59,143,164,195,179,20,11,14,252,74,0,1,77,138,146,176,130,24,139,113,128,146,179,198,144,176,162,128,179,98,129,
+40,29,176,178,210,149,177,161,56,232,34,152,131,28,168,64,240,193,9,149,41,33,144,194,167,161,145,24,44,44,9,130,
+151,194,162,130,25,168,11,177,88,154,135,128,178,146,242,4,138,193,137,178,33,162,135,40,10,56,205,128,152,181,148,129,
+64,8,168,80,168,164,184,160,13,148,2,82,9,73,59,14,152,177,226,179,130,74,90,90,25,152,137,9,201,147,43,62,
+136,7,40,209,161,162,160,24,64,76,11,40,149,130,200,163,145,128,63,155,195,145,64,149,195,32,12,8,10,160,45,193,
+40,50,149,154,164,25,241,0,184,17,232,165,66,8,43,152,49,13,210,160,160,49,10,23,24,177,145,243,8,9,27,75,
+210,32,165,130,137,56,156,40,12,12,49,31,74,16,162,8,211,160,162,176,97,137,44,57,113,168,130,44,60,43,138,73,
+232,179,131,135,8,137,0,11,1,27,226,146,155,115,72,139,0,208,129,194,177,48,28,44,66,1,152,178,170,182,163,168,
+128,160,185,103,146,0,176,210,131,44,141,16,59,77,0,198,162,129,9,128,137,9,160,196,128,23,152,144,1,185,17,216,
+163,24,241,40,22,9,24,26,44,192,180,33,61,15,40,17,25,160,177,181,137,0,144,25,47,122,130,58,11,137,137,27,
+75,240,146,136,97,129,24,90,13,136,1,58,59,142,178,98,160,164,145,145,26,194,128,184,161,91,23,57,153,137,9,12,
+27,210,128,176,4,7,145,10,42,32,143,146,8,169,242,146,23,136,144,8,209,1,137,195,146,138,112,1,152,73,10,208,
+128,144,1,224,40,64,146,9,177,72,157,18,27,41,159,184,115,8,146,128,161,41,12,161,90,202,1,20,5,153,129,140,
+48,152,208,163,203,24,55,0,60,26,168,73,9,31,200,136,106,147,144,178,57,28,0,184,81,31,176,34,64,136,194,145,
+8,193,160,195,145,185,71,128,0,136,243,178,162,0,152,43,15,34,146,176,151,9,48,47,153,16,156,40,80,57,43,10,
+45,1,29,193,130,168,50,44,182,131,128,56,152,10,164,252,162,122,8,0,128,10,19,186,144,194,176,29,32,135,195,177,
+161,50,47,154,16,30,145,33,179,145,227,129,55,252,67,0,151,144,177,145,187,132,112,168,19,28,130,128,202,149,185,181,
+130,1,146,16,169,32,240,128,40,189,5,10,195,132,192,163,81,27,9,10,12,161,2,166,66,140,33,11,211,193,3,154,
+64,56,93,43,210,0,145,209,1,225,1,152,162,195,4,185,4,161,0,12,225,0,136,129,80,10,128,17,18,74,31,169,
+177,196,150,178,3,76,137,161,178,8,137,24,120,24,9,210,179,166,163,200,17,28,153,147,107,42,137,145,114,9,11,169,
+42,8,32,18,117,43,43,145,30,153,123,26,129,0,32,129,24,41,156,243,40,29,160,208,1,130,80,8,210,2,10,140,
+8,9,61,144,35,64,201,163,91,153,75,177,40,11,116,26,80,43,75,152,152,75,30,153,24,24,4,17,1,8,245,24,
+13,145,0,176,114,10,106,138,136,146,153,16,91,10,1,178,166,147,163,40,90,159,40,9,59,24,32,114,25,56,28,208,
+200,180,17,192,32,25,16,24,193,178,240,24,8,57,141,130,180,20,72,170,41,156,171,38,28,128,91,8,112,128,136,41,
+217,8,164,128,153,164,34,72,25,43,11,63,30,129,153,146,145,167,3,200,145,225,144,89,137,72,28,74,25,1,57,42,
+27,172,146,128,245,32,128,122,9,1,41,154,44,25,73,29,144,129,164,2,184,130,240,9,40,26,168,93,24,121,136,16,
+27,232,0,145,146,43,160,83,192,132,1,153,91,43,41,209,138,105,41,107,144,58,209,145,152,16,196,137,32,4,88,25,
+12,168,9,61,0,31,152,1,162,147,150,163,40,47,136,58,28,59,92,128,1,137,179,128,137,10,134,169,72,90,1,92,
+76,153,8,10,74,11,225,1,8,178,52,9,136,170,168,50,161,63,77,136,18,208,181,162,160,0,67,11,8,75,57,57,
+162,181,243,184,147,177,241,176,2,135,56,24,64,142,177,10,162,40,14,129,17,178,180,241,2,59,128,179,227,56,152,5,
+0,2,136,249,88,28,160,184,146,51,40,130,148,64,241,176,145,26,12,138,50,56,159,165,0,27,9,34,41,30,133,162,
+209,133,128,224,32,10,145,169,144,123,1,48,17,32,153,242,138,176,179,243,16,128,1,10,32,235,150,144,33,170,106,25,
+177,176,151,162,138,195,2,169,140,193,66,162,5,165,130,9,116,14,63,0,41,187,43,244,178,20,128,26,45,25,10,230,
+2,162,25,8,195,1,13,131,9,176,75,233,10,136,56,66,41,6,17,130,187,128,191,179,56,122,24,136,138,128,176,151,
+152,98,75,136,129,32,142,24,0,129,59,170,220,12,9,32,150,34,21,59,187,168,240,146,144,162,37,138,168,59,3,46,
+8,66,17,80,157,3,33,143,17,208,32,10,170,31,136,123,128,129,72,57,170,145,145,139,62,168,123,17,185,193,2,25,
+136,162,34,56,246,1,1,176,227,19,28,32,232,152,137,162,130,135,73,24,128,152,160,195,241,17,137,32,160,203,193,151,
+128,40,26,16,48,143,146,131,153,73,160,149,42,233,0,200,49,73,129,18,4,26,14,128,43,142,145,129,135,153,128,41,
+170,162,42,151,163,209,104,26,136,25,128,48,179,227,30,168,129,144,99,60,164,16,169,48,185,226,76,42,48,144,168,58,
+170,16,32,79,89,152,44,42,162,192,0,106,17,154,188,57,139,129,34,20,115,40,163,29,9,153,184,192,104,150,144,26,
+16,152,243,129,34,208,129,9,42,15,179,42,119,243,146,42,28,138,40,16,43,1,25,3,4,235,144,12,72,150,129,24,
+129,12,9,40,62,137,160,128,106,153,177,149,91,8,58,0,137,133,249,2,136,147,10,166,136,128,129,43,202,0,56,61,
+201,131,182,33,208,165,130,139,33,128,161,48,228,0,130,177,168,44,224,153,18,169,39,42,153,164,108,155,150,0,129,25,
+136,41,186,33,159,129,168,50,143,96,152,72,25,11,163,179,195,148,160,1,26,194,7,160,193,1,11,123,154,137,56,145,
+194,151,9,1,128,18,89,138,161,242,161,48,12,128,107,169,9,164,136,73,46,26,49,41,1,133,17,241,128,26,40,24,
+202,176,131,46,208,128,91,24,56,171,193,88,24,130,166,129,192,66,170,177,145,10,74,65,13,11,97,13,145,42,50,138,
+161,171,135,32,146,160,162,133,89,153,10,61,24,203,129,162,34,159,162,88,227,144,163,24,80,24,31,24,41,192,9,145,
+33,139,41,193,131,244,162,64,25,32,79,138,162,129,168,35,107,42,136,156,160,160,107,40,91,24,26,155,183,130,208,146,
+17,24,130,43,149,201,2,177,74,123,12,162,194,57,43,30,56,18,200,165,185,255,70,0,19,242,43,40,74,24,26,128,
+243,24,27,60,11,24,2,240,165,145,160,49,63,40,160,225,147,152,57,57,72,26,161,169,72,136,159,73,24,89,152,58,
+40,216,146,2,138,32,126,153,129,144,129,10,145,44,105,139,24,201,67,170,81,75,75,138,161,133,9,201,66,9,120,137,
+153,5,11,8,58,26,63,138,1,193,2,9,148,40,91,145,186,165,160,160,25,120,43,27,152,166,161,128,218,35,48,112,
+152,195,192,35,46,136,25,154,33,145,181,182,91,41,91,25,26,209,8,0,10,145,106,42,176,245,163,161,8,16,92,32,
+9,137,224,131,153,32,26,168,168,167,148,162,8,16,30,96,8,128,168,162,178,193,1,144,199,180,179,24,176,91,42,10,
+5,24,137,30,0,76,168,136,211,8,179,80,144,8,129,144,22,41,59,155,241,3,160,242,145,8,165,145,144,129,152,48,
+116,177,161,15,40,9,170,133,138,137,210,129,64,63,128,128,3,3,24,15,26,145,128,227,162,154,162,160,151,136,75,16,
+25,67,4,43,30,74,138,168,179,148,44,208,146,144,0,42,183,150,0,137,12,16,137,8,1,130,160,46,106,73,9,42,
+42,73,147,146,10,121,90,12,186,193,225,131,32,48,41,142,0,179,151,179,160,44,58,153,145,194,163,168,169,121,163,154,
+65,178,151,148,146,60,74,58,154,177,216,195,208,1,97,44,42,0,18,130,192,169,48,91,141,177,153,164,130,169,51,14,
+63,144,33,132,144,169,132,17,31,200,128,160,17,137,64,17,28,145,72,150,132,169,26,41,18,31,13,128,128,138,91,147,
+24,169,48,151,179,162,146,56,44,28,143,154,0,128,17,72,53,157,33,148,131,169,187,16,120,16,10,219,168,144,144,37,
+32,47,44,18,4,160,0,138,2,201,235,10,251,146,145,112,0,56,31,40,129,209,146,10,40,16,153,89,201,180,1,27,
+104,24,140,40,132,196,0,128,105,26,138,8,234,162,144,130,123,24,137,25,20,146,209,128,63,136,144,144,136,136,16,120,
+154,132,144,9,82,40,0,136,28,19,185,219,192,156,136,16,160,117,26,25,2,135,136,145,12,89,153,12,161,160,19,41,
+176,122,27,27,184,23,2,10,25,120,73,138,160,197,152,148,136,16,107,9,160,18,130,44,44,17,63,0,188,64,57,25,
+15,59,217,163,180,24,33,192,180,132,195,133,9,44,72,43,11,58,172,181,145,41,148,72,74,60,48,140,210,8,210,19,
+138,152,132,145,181,4,8,105,91,139,9,75,60,10,74,8,248,184,144,194,129,9,160,135,152,147,49,156,163,88,9,3,
+131,8,37,9,150,162,34,170,151,24,152,149,1,210,24,192,133,12,139,152,132,59,153,80,24,26,93,177,145,137,1,197,
+65,140,129,177,195,18,152,145,145,75,154,23,10,227,16,27,147,186,218,184,20,186,162,123,129,152,75,161,146,201,50,161,
+68,242,25,59,128,210,195,146,73,27,25,120,9,179,57,211,18,152,141,10,144,167,147,90,1,160,73,168,151,177,24,73,
+57,216,17,136,168,131,59,194,59,31,48,129,145,151,169,162,32,146,29,157,66,74,128,74,10,64,14,0,24,242,25,176,
+80,176,8,152,192,146,152,132,15,129,40,58,138,148,180,73,10,33,189,176,0,243,133,136,162,19,145,18,203,7,9,18,
+77,24,27,138,131,137,160,123,218,1,144,136,227,17,17,152,193,34,11,248,89,137,48,26,176,115,11,89,156,2,9,144,
+227,33,168,138,195,58,162,16,243,24,73,73,0,200,7,161,161,42,41,186,12,160,0,35,152,126,144,57,208,0,57,57,
+25,31,17,27,128,189,133,56,26,139,67,12,104,153,105,129,128,26,27,136,200,244,16,130,177,145,163,62,152,1,61,48,
+137,185,49,143,19,170,107,0,136,210,193,149,128,2,26,99,192,161,10,128,128,58,63,94,137,9,130,137,146,129,194,18,
+136,193,144,170,7,136,14,90,128,9,26,40,177,3,90,122,178,8,9,138,24,243,128,145,5,25,25,169,212,136,211,50,
+130,11,59,13,73,140,184,200,134,25,9,10,3,197,5,25,2,137,154,163,62,145,138,137,113,196,128,177,177,198,33,41,
+8,56,130,57,220,149,41,157,8,177,165,16,184,148,57,59,128,244,0,57,203,16,74,41,0,180,33,27,249,129,17,200,
+38,152,56,56,140,27,74,156,88,216,146,73,170,65,26,211,50,195,136,41,240,27,163,18,45,177,56,154,9,143,17,42,
+120,130,48,169,183,153,160,148,29,178,178,164,151,24,40,40,28,0,170,196,18,157,33,106,128,145,218,178,150,241,66,0,
+19,251,17,58,136,19,136,132,24,172,59,46,155,164,154,24,82,132,89,137,3,160,167,59,73,139,60,25,134,10,216,2,
+75,184,26,208,165,24,148,34,58,42,143,162,136,169,161,171,114,34,137,130,164,160,180,59,138,199,43,74,49,176,167,41,
+154,3,13,41,45,192,20,17,129,146,248,24,154,160,194,169,136,114,49,25,107,153,24,153,145,128,220,42,50,135,161,161,
+10,137,195,10,0,58,77,116,16,57,169,10,176,240,144,192,136,43,23,130,0,144,168,8,107,11,184,15,8,38,177,131,
+138,11,176,193,128,138,176,39,54,24,179,169,14,161,168,242,128,11,49,6,18,41,169,1,249,162,194,184,11,112,147,1,
+137,192,176,9,88,12,160,177,116,2,130,144,25,13,137,201,177,27,29,68,18,24,162,161,240,24,75,185,187,42,71,1,
+160,24,45,171,130,144,168,30,40,100,32,136,161,170,27,73,248,44,154,49,51,150,16,136,168,12,1,152,139,175,112,32,
+129,91,169,136,154,131,145,156,137,120,5,2,144,186,136,140,211,43,155,145,68,97,1,144,144,154,57,144,225,219,144,39,
+33,168,24,58,175,24,136,129,28,27,23,34,24,217,144,187,33,13,184,25,123,19,65,25,161,176,10,28,180,170,143,56,
+5,3,9,29,194,137,41,0,14,194,112,40,1,144,8,171,184,16,203,11,216,135,48,3,8,29,11,9,56,172,185,46,
+49,37,8,200,164,176,193,65,136,137,31,20,64,128,152,169,153,26,242,136,9,58,51,97,33,25,141,156,41,137,216,154,
+74,20,21,160,41,168,12,92,9,160,241,64,32,1,0,208,144,139,130,28,12,138,37,32,66,16,27,141,25,155,160,75,
+205,4,112,25,144,10,168,24,154,212,0,27,52,3,49,152,240,219,16,58,137,142,41,53,146,132,42,161,136,172,152,181,
+169,45,113,48,168,160,200,128,16,107,12,152,121,136,131,32,9,29,172,18,25,142,184,66,64,1,8,180,25,29,161,136,
+42,159,148,50,17,59,154,176,34,190,226,34,14,32,19,145,0,204,225,32,43,200,129,139,23,0,162,40,10,224,130,137,
+40,234,128,121,18,144,176,24,144,212,16,13,40,160,23,128,25,153,25,143,130,177,177,170,105,5,129,26,161,145,10,0,
+95,2,58,0,46,155,61,10,23,1,25,154,44,16,169,241,129,17,109,0,0,160,128,11,196,18,171,154,160,101,57,128,
+9,17,13,136,249,129,11,201,20,5,129,138,152,16,41,174,162,122,9,51,24,163,156,208,1,25,160,192,233,17,22,17,
+139,57,128,194,30,128,185,140,129,23,147,137,152,75,160,16,13,240,130,2,65,0,11,169,161,227,34,141,200,9,82,34,
+152,138,149,35,186,137,186,206,160,38,34,136,154,43,3,170,243,172,9,37,57,19,209,193,144,1,91,154,153,159,161,23,
+2,137,24,48,136,185,227,242,8,26,67,129,139,209,131,0,154,152,234,90,8,19,149,44,9,136,161,56,218,250,16,105,
+16,144,144,51,26,233,0,136,158,129,64,21,168,138,16,136,194,1,217,8,3,67,33,216,168,168,96,152,162,207,136,146,
+82,129,209,32,25,164,208,1,187,168,148,114,17,169,153,83,136,138,194,8,41,138,39,148,171,212,33,152,24,140,141,16,
+40,4,162,42,136,113,155,128,234,136,152,83,35,170,186,49,7,153,184,10,10,123,3,21,185,0,44,3,56,251,241,136,
+1,65,144,0,8,89,161,178,243,12,152,41,35,145,209,152,35,32,240,154,9,44,8,116,161,42,153,4,132,154,232,9,
+0,48,4,161,146,28,3,8,164,207,176,16,51,49,185,172,121,1,194,169,153,8,194,82,6,170,176,112,40,138,168,172,
+129,8,23,1,9,16,148,9,147,158,156,152,36,130,182,160,2,32,89,185,184,142,146,9,38,8,11,154,23,144,209,216,
+24,144,33,64,144,26,2,196,50,202,218,42,40,3,98,216,129,1,17,178,169,252,32,169,34,23,11,185,66,129,177,220,
+137,164,58,147,135,136,152,133,25,145,11,189,2,89,16,195,152,49,1,129,10,143,157,147,16,83,178,176,73,133,0,216,
+202,40,144,146,120,144,161,32,161,151,192,184,44,0,1,49,209,145,80,1,137,169,250,1,178,34,98,8,172,51,17,192,
+234,11,58,72,225,5,128,137,34,90,12,138,203,130,2,1,49,29,8,36,241,161,136,139,89,41,24,132,208,129,35,72,
+204,169,128,48,227,88,40,144,128,166,163,168,248,9,40,146,24,195,1,121,128,137,169,185,180,161,149,66,0,157,19,147,
+8,206,136,24,76,231,66,0,49,234,22,129,25,8,17,136,175,168,130,64,27,51,154,57,134,243,144,137,27,138,73,40,
+21,224,16,65,153,241,10,129,0,144,73,65,169,17,40,88,185,173,154,82,160,64,144,34,50,160,2,223,144,137,144,80,
+48,197,26,32,16,170,251,136,144,179,179,113,131,59,193,35,178,253,8,26,17,10,36,0,32,178,97,171,9,189,129,128,
+19,23,160,42,5,32,251,138,145,128,171,182,38,154,162,18,1,241,171,160,50,209,148,49,145,148,137,147,28,31,176,16,
+75,16,212,0,56,130,130,175,49,153,149,58,106,1,48,92,144,27,175,144,128,144,162,208,166,24,168,56,139,233,145,177,
+2,2,32,81,74,64,0,243,40,144,33,137,5,2,166,131,56,1,251,136,169,18,184,160,112,144,161,41,196,185,0,169,
+43,250,166,17,146,131,131,192,158,1,163,9,33,106,194,148,9,150,162,142,8,8,161,128,136,181,5,154,88,10,185,8,
+208,197,2,11,57,17,1,66,204,176,2,156,26,80,129,56,192,151,2,219,26,16,34,8,216,164,35,194,73,17,9,141,
+184,149,8,152,75,67,34,59,243,137,144,211,43,72,56,24,240,19,129,241,11,24,34,155,227,57,1,40,31,33,137,184,
+145,144,24,144,159,6,18,154,145,44,137,16,191,1,73,56,210,42,1,178,238,33,24,136,10,43,18,146,241,74,65,9,
+152,15,146,8,217,52,74,160,40,154,130,34,190,64,75,0,145,25,209,33,186,123,74,136,192,169,35,36,171,109,25,145,
+144,209,8,16,153,108,58,147,185,163,8,80,201,90,139,19,2,186,137,115,192,137,74,146,128,141,9,36,128,153,59,112,
+8,11,15,18,202,24,128,68,10,152,12,50,164,140,24,122,57,43,8,42,176,35,175,64,89,184,156,35,148,152,44,106,
+42,8,171,17,178,144,47,88,24,168,169,18,166,8,10,46,58,5,155,8,4,42,46,58,57,129,174,16,5,16,170,29,
+80,146,155,9,150,154,42,57,73,19,174,42,50,33,159,44,16,130,153,41,17,12,73,29,40,51,174,14,50,17,184,26,
+136,54,152,159,16,130,184,138,114,18,155,15,17,129,184,136,169,112,2,14,8,146,144,11,80,89,10,12,152,133,3,154,
+139,113,1,202,145,131,161,47,131,247,71,0,41,64,136,233,129,35,162,13,27,3,161,217,147,50,153,30,10,32,2,221,
+138,52,34,171,169,107,148,136,156,48,83,186,200,82,3,233,26,32,19,138,248,40,58,179,13,40,20,202,210,17,56,155,
+10,139,70,130,184,30,72,144,217,24,34,225,136,57,34,176,203,8,114,147,138,46,32,144,154,16,105,178,0,31,17,128,
+155,12,80,18,137,29,26,163,136,141,74,5,138,187,53,145,200,154,64,21,153,200,0,132,152,153,56,69,154,154,34,34,
+156,217,28,69,136,192,136,132,128,155,61,96,168,153,9,22,9,171,26,100,160,168,128,19,10,137,170,115,129,201,136,20,
+1,234,139,112,18,169,177,32,128,194,187,113,149,137,137,49,129,248,10,57,5,26,12,144,195,194,160,2,22,27,45,177,
+149,176,168,129,116,25,10,144,162,129,188,17,115,25,170,24,4,210,202,16,114,8,154,2,152,160,170,72,65,24,250,130,
+8,162,233,25,104,1,152,0,152,1,219,8,98,130,152,12,4,24,234,160,65,33,152,137,178,0,174,211,34,49,216,106,
+10,8,184,240,33,48,8,26,137,152,240,193,147,35,42,42,11,48,215,224,0,51,8,10,144,41,242,184,18,35,41,29,
+128,153,244,209,1,57,49,59,201,153,9,228,144,96,136,16,137,136,162,176,242,120,8,145,24,169,145,153,160,116,152,1,
+1,138,26,42,14,76,147,49,195,59,157,24,139,128,167,56,163,30,59,169,144,171,55,64,8,11,29,209,179,145,134,40,
+136,74,139,192,163,160,7,42,98,139,185,178,132,168,113,26,32,27,217,195,0,153,96,25,17,138,240,145,8,26,97,10,
+129,163,177,153,28,24,122,128,134,194,128,10,26,74,45,163,148,179,161,61,153,136,145,151,150,129,137,44,27,176,193,150,
+2,8,137,43,10,186,183,133,56,40,10,157,146,160,198,34,40,16,45,155,0,176,162,18,113,128,164,140,144,225,9,2,
+81,152,128,169,240,179,88,44,33,10,130,241,24,45,23,42,153,243,208,128,130,178,24,160,5,5,153,8,250,40,41,34,
+2,170,195,168,27,21,11,15,56,10,17,224,131,154,60,242,35,58,128,178,153,60,43,156,99,136,72,26,129,192,155,176,
+128,135,153,134,129,0,44,153,40,162,34,131,224,35,64,0,173,5,143,0,41,196,1,25,217,161,144,16,17,0,212,4,
+178,0,184,164,112,41,136,42,42,156,143,57,137,17,112,27,18,10,185,63,24,2,123,26,145,26,192,129,144,195,106,137,
+24,128,159,16,25,3,0,16,152,3,142,198,2,130,212,8,144,161,176,16,41,146,58,15,105,27,192,89,153,3,2,33,
+128,208,195,29,9,1,73,12,41,216,176,240,132,163,50,31,8,129,144,137,48,72,160,168,167,163,184,42,59,64,14,41,
+76,0,129,186,34,11,164,243,88,136,176,178,17,65,10,172,18,131,9,31,15,8,1,128,80,162,1,14,136,165,131,28,
+25,163,163,226,59,168,165,145,24,162,178,76,15,56,136,194,146,72,59,160,160,136,50,179,124,177,10,154,141,7,57,28,
+43,40,19,14,194,178,21,10,41,18,185,225,241,178,35,137,122,152,129,152,26,138,146,113,27,147,160,179,154,0,7,28,
+10,18,33,29,28,15,129,8,34,146,8,42,143,161,35,129,112,12,17,44,170,49,155,144,147,166,5,204,144,146,32,45,
+57,0,0,160,10,168,166,183,147,166,145,136,160,26,141,150,40,136,1,227,196,128,144,129,57,40,5,208,146,28,160,180,
+148,129,64,172,146,155,1,144,122,161,82,26,27,202,177,18,79,129,129,161,75,10,193,106,9,8,34,180,9,27,156,89,
+0,57,20,168,201,209,56,61,44,160,6,152,162,153,77,12,129,131,162,33,156,148,78,137,128,193,131,64,152,10,76,139,
+150,129,128,129,26,28,9,161,135,24,26,50,152,189,152,143,136,135,33,1,170,43,26,13,144,166,40,58,164,128,185,171,
+57,23,72,48,200,168,194,16,60,129,208,67,56,171,210,13,145,9,35,5,33,143,168,128,184,33,170,151,81,137,181,10,
+42,59,147,20,74,159,129,42,0,24,178,50,126,10,146,170,107,26,0,36,8,154,209,176,148,177,194,64,144,41,164,188,
+58,30,17,149,133,185,56,13,58,145,162,34,48,226,179,250,9,0,2,4,19,218,152,139,105,161,2,147,120,137,128,178,
+220,129,41,2,104,225,128,152,9,131,169,49,72,195,165,180,218,16,58,120,0,162,153,26,13,18,26,57,168,167,0,193,
+184,16,177,115,195,5,186,25,26,1,183,161,132,25,137,185,49,243,63,0,216,26,16,35,39,65,156,10,154,74,145,160,
+38,74,136,144,241,137,128,25,38,72,28,169,184,145,21,137,48,57,137,243,152,168,138,11,117,1,128,154,209,41,9,162,
+94,24,40,137,210,161,59,152,112,1,195,160,184,129,106,162,10,68,137,42,186,136,29,225,131,7,162,152,154,24,154,19,
+186,54,42,58,153,159,144,136,144,87,128,152,154,59,58,121,129,91,145,145,168,137,27,25,140,116,150,144,153,153,57,42,
+195,16,150,144,152,209,144,184,151,72,17,137,28,185,73,195,165,56,40,45,137,177,139,178,1,120,100,136,27,155,136,162,
+17,169,55,170,131,177,155,196,75,62,33,180,138,144,141,149,40,138,32,196,129,16,143,128,160,32,36,149,144,184,140,131,
+9,9,80,21,10,2,158,9,170,146,52,52,203,176,185,64,209,2,96,74,11,144,9,14,9,144,96,120,137,144,160,40,
+152,153,120,89,10,0,136,58,45,138,80,88,8,169,138,10,130,144,37,121,153,152,9,59,47,184,18,113,145,136,11,10,
+184,197,2,123,0,184,130,57,141,128,40,80,147,131,170,121,42,2,122,57,209,192,176,195,194,136,179,194,166,26,176,59,
+171,129,73,17,66,187,16,60,181,193,4,197,20,129,129,42,176,18,132,1,72,169,147,221,132,208,17,10,67,163,154,142,
+180,10,168,113,26,160,137,2,1,31,76,137,24,128,20,155,129,136,21,25,26,21,141,153,105,153,8,168,50,134,26,170,
+136,235,153,49,178,7,177,2,129,185,77,154,11,17,133,226,145,194,163,146,208,82,186,24,29,18,11,130,42,135,146,0,
+0,172,208,80,16,90,161,72,144,163,26,137,15,144,7,41,137,152,25,124,9,24,162,154,192,20,152,74,153,149,83,12,
+24,10,155,45,4,152,148,25,193,132,154,1,137,174,66,1,42,208,24,137,132,140,149,200,144,128,178,96,26,144,120,161,
+16,140,200,144,49,129,66,136,40,8,189,1,81,159,0,4,16,160,9,154,67,155,130,133,15,9,128,25,0,195,49,151,
+0,137,186,159,72,177,20,16,57,60,170,10,88,169,143,50,90,161,193,129,2,169,177,21,139,169,166,0,80,26,45,1,
+72,168,176,234,25,129,168,7,144,148,209,161,17,56,191,34,24,146,8,59,34,254,62,0,120,26,185,149,3,218,161,152,
+3,149,177,135,24,17,171,217,28,129,160,82,1,81,184,184,0,10,242,28,16,50,161,200,96,152,160,10,51,14,176,58,
+76,49,153,132,80,57,216,136,14,152,162,147,37,73,162,155,9,26,228,28,58,88,145,152,89,9,136,201,80,176,181,154,
+2,32,168,82,122,137,130,137,139,171,80,168,1,7,133,169,26,8,48,12,15,32,40,184,146,20,155,181,28,167,8,184,
+48,62,43,49,153,3,160,197,9,11,29,1,168,112,33,163,29,10,136,164,202,18,128,166,41,18,156,6,12,40,25,168,
+201,33,249,19,0,56,208,131,152,200,218,19,176,41,23,18,217,129,192,33,154,60,25,34,218,50,136,75,193,40,197,128,
+210,58,185,122,148,25,129,1,194,9,171,139,5,172,67,129,6,28,137,9,197,168,2,128,162,89,193,129,50,154,123,152,
+1,14,152,137,38,43,17,24,17,140,203,233,18,11,74,4,48,176,144,217,34,14,185,149,17,27,146,194,134,145,11,167,
+41,10,152,232,49,130,0,48,148,11,248,192,40,145,170,99,1,16,10,208,105,137,138,0,56,219,65,153,32,6,169,48,
+10,241,137,184,10,39,8,48,56,209,168,217,136,67,140,91,2,163,129,8,249,34,155,170,131,167,73,137,128,34,144,139,
+180,74,143,193,192,51,1,27,133,34,15,176,168,18,8,14,34,32,0,208,213,32,144,138,0,0,201,131,211,65,80,170,
+16,144,224,144,152,43,38,153,164,4,177,10,156,11,164,176,58,55,129,9,146,141,148,170,1,128,130,47,129,160,69,136,
+59,136,163,143,10,219,67,129,40,19,131,156,12,142,41,153,156,36,66,43,163,224,145,196,136,178,19,15,32,10,88,147,
+137,0,152,152,157,177,31,149,129,35,32,176,11,174,42,145,241,32,48,1,89,42,171,227,177,32,138,243,26,16,43,23,
+129,24,12,161,185,58,191,21,1,105,129,162,137,170,138,2,153,157,150,3,17,89,155,1,137,10,195,146,191,40,138,84,
+4,137,212,16,137,12,169,153,20,18,52,120,10,154,160,27,160,8,61,162,23,41,147,44,200,161,50,31,169,74,11,2,
+114,128,64,14,144,8,153,201,148,16,34,49,8,241,42,13,0,61,44,8,40,147,98,27,91,21,68,0,169,145,90,184,
+147,187,17,76,2,7,40,232,177,1,76,155,10,147,48,21,19,153,143,192,161,2,9,145,128,104,49,130,171,160,136,89,
+141,186,168,183,89,35,18,9,188,243,24,152,140,131,145,69,16,211,160,128,219,147,152,144,194,179,133,69,186,130,146,42,
+185,40,191,18,201,99,34,42,193,144,29,16,217,0,34,33,98,66,170,148,226,17,15,184,178,49,28,32,9,31,12,137,
+144,0,225,8,145,58,72,147,145,40,226,32,80,10,145,34,19,23,148,25,129,27,77,43,40,12,137,24,23,11,2,12,
+138,59,200,128,208,142,113,25,56,26,168,160,148,218,130,42,76,96,0,137,129,203,152,2,0,121,176,154,21,200,0,0,
+24,47,128,171,17,248,161,134,129,144,145,136,10,25,139,149,129,196,135,128,0,153,25,25,160,17,145,249,107,148,144,146,
+164,0,28,178,76,162,139,51,68,27,88,186,144,40,241,48,155,136,120,147,8,9,203,162,105,138,145,1,137,84,42,194,
+57,202,160,134,169,132,233,129,80,41,137,147,15,136,179,170,150,25,193,51,153,64,217,41,152,131,138,147,137,12,7,72,
+9,194,144,19,200,44,180,168,64,164,17,25,136,159,7,155,32,26,241,64,144,128,16,11,42,58,153,74,195,218,37,59,
+25,9,28,42,4,143,147,29,144,3,128,0,2,158,35,203,17,213,128,9,6,10,17,192,10,3,177,13,83,13,73,136,
+25,24,193,9,81,202,40,153,0,8,165,129,17,250,32,162,43,152,92,137,104,128,145,149,10,130,24,171,80,192,130,1,
+73,46,148,75,138,165,138,128,25,154,106,33,106,184,72,153,9,139,1,26,152,37,144,18,172,123,60,155,77,128,136,162,
+2,96,58,178,217,5,202,147,160,124,10,131,26,4,26,209,16,29,26,128,161,90,161,131,212,48,234,163,144,129,25,145,
+107,59,106,144,16,26,184,24,8,63,153,19,161,97,1,138,80,159,128,161,148,168,18,57,66,139,155,26,177,30,5,30,
+160,1,16,166,48,192,56,188,25,196,48,158,132,56,24,42,168,144,12,105,128,154,109,144,17,144,56,156,17,140,122,136,
+24,27,56,0,8,149,140,243,129,161,25,144,42,21,25,41,169,242,152,162,147,144,240,16,166,148,41,24,56,11,66,0,
+44,161,41,144,136,250,65,162,25,66,153,28,59,88,12,153,143,33,148,144,17,177,129,136,47,125,137,10,40,1,129,145,
+171,167,144,161,33,219,0,82,75,137,147,153,227,177,149,162,208,128,134,128,8,40,25,176,200,164,5,172,162,131,165,41,
+58,74,26,46,9,193,224,33,128,162,16,41,90,171,48,137,145,143,66,74,153,50,153,227,144,32,89,187,155,114,56,209,
+147,44,9,136,41,24,248,8,165,64,138,131,155,180,128,164,19,159,9,33,163,129,249,50,59,143,1,146,202,48,145,21,
+76,153,130,209,144,0,213,144,147,32,129,74,138,120,140,42,32,153,11,130,134,41,208,227,133,27,42,8,144,47,129,8,
+131,9,128,0,25,31,1,186,33,78,0,16,0,45,0,140,66,156,9,44,65,26,19,201,163,128,47,8,144,185,89,58,
+112,58,139,144,196,144,1,235,162,128,4,48,18,11,121,186,41,128,45,240,164,147,33,184,146,148,137,176,35,47,31,160,
+2,17,192,147,145,210,25,228,128,136,32,42,48,138,2,161,159,96,28,200,1,48,91,40,153,148,160,178,75,178,173,196,
+19,64,25,10,209,3,13,40,170,57,138,135,89,73,11,152,177,64,44,138,29,0,148,57,40,47,160,144,145,105,170,144,
+145,52,107,24,184,131,213,24,42,139,163,8,36,124,144,177,195,161,74,91,156,146,147,32,16,74,202,148,240,56,26,170,
+163,164,64,56,162,139,149,154,75,9,141,145,135,32,121,10,138,148,9,8,8,141,32,0,128,67,41,31,161,170,67,202,
+9,24,114,75,8,184,65,185,138,130,170,31,56,42,51,120,186,3,184,108,27,169,19,57,42,165,151,60,8,153,2,73,
+143,128,129,73,40,138,17,18,221,32,168,28,74,208,35,0,136,43,166,156,130,192,162,3,177,7,145,25,75,176,176,4,
+234,162,2,17,121,177,41,34,251,144,16,138,41,208,52,131,242,152,51,141,42,9,31,48,10,131,57,217,57,212,209,146,
+128,24,176,211,132,147,152,18,40,172,162,241,33,46,0,131,178,40,10,197,153,130,188,135,26,161,4,195,40,32,141,176,
+144,192,179,8,125,0,144,163,32,155,194,180,76,136,193,49,129,177,196,51,15,136,226,147,144,137,34,19,14,147,228,1,
+92,20,74,0,137,152,193,2,47,1,145,2,42,153,169,32,15,1,218,112,41,152,161,3,29,152,152,112,42,138,25,65,
+9,24,56,79,43,185,179,179,152,32,131,120,48,184,200,154,210,35,27,79,107,9,128,136,184,164,200,131,80,153,27,130,
+132,195,132,137,32,31,43,89,139,169,131,6,2,25,138,217,24,136,182,177,163,68,43,73,61,12,153,24,48,146,240,136,
+65,41,178,178,162,218,225,72,152,42,29,50,40,131,154,210,61,152,41,244,129,0,33,25,24,61,156,57,136,66,139,185,
+89,65,58,59,145,12,156,26,225,128,157,66,2,165,163,192,144,74,42,44,160,9,135,146,182,16,186,177,35,89,154,160,
+139,116,0,152,165,137,136,160,194,72,235,0,20,80,9,9,139,58,177,145,183,153,164,0,3,63,192,137,33,76,8,194,
+161,25,21,136,131,169,128,202,132,47,144,170,112,32,0,193,196,176,33,43,147,136,45,58,33,159,163,155,49,43,164,128,
+246,144,33,1,16,0,63,13,129,137,130,248,146,34,16,160,18,143,41,137,18,168,177,153,39,29,129,184,32,137,147,243,
+4,139,75,130,4,192,148,248,1,139,40,26,25,48,16,161,67,156,144,125,40,138,130,234,132,168,16,8,65,28,57,44,
+41,168,224,32,98,152,8,232,2,186,178,177,4,136,34,120,60,176,212,161,34,176,1,185,25,160,167,144,72,8,107,75,
+45,145,162,26,112,144,0,154,32,249,0,26,0,195,32,40,9,183,18,155,40,165,24,226,145,168,59,218,72,147,170,212,
+2,1,16,12,64,21,30,144,57,185,12,161,33,65,156,179,82,16,57,194,10,3,47,176,122,138,184,163,128,0,148,241,
+90,9,129,129,184,37,136,194,25,210,224,129,24,0,243,162,32,0,41,33,171,38,139,194,40,208,154,56,136,124,177,148,
+11,72,59,51,172,122,25,145,168,88,202,9,177,89,160,128,192,34,144,115,16,77,137,144,179,9,169,26,196,24,148,48,
+187,60,19,113,16,47,128,2,216,162,145,12,9,152,33,63,170,145,151,89,0,136,177,33,184,161,168,31,136,152,66,77,
+169,179,150,56,2,154,32,90,168,210,40,14,152,177,96,136,193,162,65,43,5,41,60,43,200,1,0,175,2,41,46,136,
+0,8,92,139,19,231,68,0,52,26,27,33,144,8,43,191,132,29,42,130,128,28,105,160,51,26,195,131,56,31,177,170,
+10,130,243,56,56,155,168,244,2,21,154,91,32,139,226,145,26,137,209,49,178,169,3,33,26,55,160,121,137,160,132,201,
+138,24,144,78,0,177,32,42,28,54,130,202,17,162,136,15,138,48,154,31,73,144,45,9,16,72,130,24,131,153,93,9,
+29,11,8,44,153,164,121,136,8,56,7,26,25,17,75,156,10,25,128,142,17,211,145,24,73,27,37,41,26,195,45,24,
+233,216,18,11,144,130,33,89,144,44,114,144,41,152,17,169,226,200,18,13,152,147,33,140,17,144,112,5,57,10,75,28,
+160,139,59,10,186,181,74,40,36,143,123,32,9,128,43,57,26,203,41,192,45,144,144,150,105,76,43,32,25,1,11,60,
+127,56,11,178,31,75,139,105,25,128,10,80,41,11,128,242,0,136,133,8,152,40,169,193,66,144,234,17,194,145,163,50,
+232,161,177,121,128,16,137,241,146,130,154,34,130,210,130,180,9,169,137,232,163,32,8,163,112,24,168,170,135,128,145,195,
+32,224,178,209,33,160,210,146,43,130,29,132,178,2,129,181,34,28,34,47,160,91,9,16,15,168,160,129,56,125,8,128,
+32,154,144,56,155,26,161,38,250,67,152,41,45,25,196,161,128,11,178,211,1,128,227,20,26,40,193,18,128,201,135,129,
+42,13,163,176,168,11,210,2,227,18,161,73,73,41,53,232,24,200,16,160,163,225,1,28,168,194,130,1,129,17,20,27,
+29,4,36,76,26,233,168,166,8,16,25,224,163,145,104,153,146,0,27,1,45,154,59,41,32,51,228,33,203,166,146,2,
+248,164,178,0,152,153,212,18,128,43,196,131,48,170,24,151,128,25,176,80,31,9,8,9,227,17,16,11,91,161,209,130,
+0,72,137,128,164,154,9,217,164,243,129,121,137,178,145,33,75,77,152,146,33,156,130,137,17,56,61,11,13,160,133,57,
+74,42,200,211,145,196,56,171,66,153,160,120,42,26,168,20,17,153,26,240,196,8,59,137,40,40,58,98,0,24,41,30,
+200,97,160,194,132,128,29,184,75,162,193,2,105,43,161,194,3,96,155,8,106,138,208,146,129,41,0,132,57,159,163,144,
+144,48,18,122,75,10,168,177,37,246,63,0,25,16,135,211,64,176,193,56,10,35,138,192,122,42,143,136,16,8,180,132,
+24,128,15,24,25,1,161,194,20,43,187,58,31,163,32,162,25,50,109,12,129,16,89,26,184,197,195,168,129,8,147,212,
+3,34,170,248,146,178,210,131,48,41,232,0,63,61,153,129,1,41,145,149,41,138,226,162,2,154,182,162,74,46,16,9,
+88,26,136,26,109,25,24,8,40,201,227,144,0,168,146,136,33,224,131,41,77,24,24,121,59,25,154,155,137,179,33,32,
+120,196,0,1,185,177,146,53,9,97,76,153,155,10,24,11,83,162,36,216,32,18,61,153,20,161,159,153,11,184,43,145,
+54,3,170,7,225,49,139,56,112,9,209,161,136,59,153,106,94,25,160,162,17,153,131,0,82,26,243,144,11,10,16,130,
+171,132,3,175,34,63,41,26,107,136,129,153,41,9,195,129,242,131,212,146,136,144,50,16,106,75,8,168,155,204,197,147,
+8,65,161,146,9,226,180,131,73,8,146,216,170,228,162,152,0,8,49,90,26,129,161,166,8,4,65,139,141,25,107,154,
+144,161,3,2,90,45,128,166,145,131,145,135,186,42,46,128,10,161,147,149,170,44,1,120,58,107,24,144,168,11,11,58,
+34,10,124,58,57,12,176,132,115,62,58,9,177,153,75,137,176,214,130,56,61,26,144,212,148,32,74,25,200,194,161,128,
+57,137,216,131,107,58,45,128,145,163,56,64,210,193,160,16,26,9,61,137,19,16,63,25,152,134,25,134,129,240,24,26,
+136,25,153,1,11,5,28,210,128,147,106,9,146,182,136,60,25,16,218,146,41,1,44,9,183,4,73,107,137,178,136,176,
+162,57,11,227,211,18,76,153,1,1,133,16,177,48,249,153,193,196,144,177,132,10,1,24,162,72,160,134,5,178,152,217,
+162,216,146,25,0,24,244,131,129,129,56,91,18,195,194,160,160,169,17,46,136,224,161,169,197,33,48,77,42,148,161,192,
+25,40,30,27,178,195,130,90,26,145,0,35,134,66,42,140,14,128,59,29,177,195,4,8,10,58,8,135,197,35,59,27,
+30,169,178,192,181,160,163,147,131,161,88,74,128,147,7,27,172,129,137,241,131,192,65,45,25,40,136,58,130,5,74,161,
+192,177,212,11,130,168,88,24,208,40,225,129,62,242,68,0,177,150,16,2,200,41,145,234,1,0,169,50,140,10,50,169,
+87,9,2,112,138,13,16,155,25,164,161,40,129,92,146,43,88,160,9,105,48,201,41,240,0,244,162,16,160,144,128,130,
+41,1,74,20,0,218,3,159,154,18,145,42,50,178,7,155,73,147,44,43,53,168,28,137,107,152,44,144,25,156,77,32,
+152,50,154,23,59,160,242,168,176,162,149,177,82,8,26,25,28,132,141,48,73,150,184,179,40,25,200,24,140,163,144,105,
+144,113,10,121,24,136,152,169,144,74,10,163,59,136,151,227,161,145,41,61,106,56,160,153,59,56,185,11,13,183,147,241,
+165,146,128,17,48,144,41,187,142,176,130,181,131,202,6,178,243,179,129,168,146,35,34,203,14,3,184,144,42,196,74,156,
+50,0,241,1,80,129,144,128,15,26,74,9,57,58,75,65,156,145,145,241,40,33,160,166,137,8,164,193,161,16,30,152,
+180,147,146,184,4,133,1,181,217,193,0,160,17,0,178,114,152,2,43,154,154,21,8,50,208,12,64,161,241,1,155,104,
+9,26,33,208,161,6,144,17,202,9,45,43,10,18,184,120,149,16,137,192,225,2,0,48,58,15,73,58,138,43,56,141,
+144,132,25,64,12,65,130,144,212,25,15,24,9,0,25,58,166,129,9,40,248,137,129,3,179,210,25,163,243,163,129,249,
+147,128,128,145,133,64,73,59,193,212,152,176,48,11,165,129,151,16,9,9,153,42,42,200,149,180,40,184,161,196,144,193,
+183,162,17,144,73,27,133,73,227,162,8,216,160,146,18,75,72,128,18,233,164,24,169,58,73,196,128,136,161,150,41,28,
+17,172,162,16,0,42,161,48,151,149,75,185,159,146,1,26,82,41,72,241,146,40,185,152,112,161,57,176,193,56,26,145,
+1,212,10,163,1,76,50,12,179,19,15,161,220,178,72,28,48,1,44,164,163,41,137,15,9,5,26,56,249,145,130,144,
+106,152,28,16,2,162,165,10,10,6,9,72,15,152,0,25,17,179,211,49,24,129,161,157,143,146,8,124,137,137,146,2,
+152,151,184,41,74,42,49,26,137,113,129,108,184,184,8,32,26,51,172,147,135,8,131,62,139,25,209,73,179,26,185,81,
+25,8,240,28,147,129,144,165,16,9,135,160,130,202,25,25,176,245,60,0,170,114,145,24,58,134,146,136,47,138,129,28,
+33,137,176,74,104,1,210,169,72,41,160,19,29,31,48,145,42,249,145,43,128,136,166,162,43,67,129,132,13,136,25,209,
+82,154,137,153,21,1,194,9,29,0,162,165,147,28,48,77,162,161,208,154,32,47,152,129,138,81,19,163,128,158,40,27,
+8,200,181,136,105,89,129,226,168,17,40,177,148,139,146,17,6,179,171,185,147,15,148,178,25,31,20,50,169,170,45,161,
+136,176,16,30,57,79,16,8,186,17,76,25,90,200,129,0,147,135,160,11,0,136,46,144,163,180,120,89,160,178,144,211,
+161,0,74,155,194,24,113,9,152,161,25,161,49,208,42,153,48,23,80,187,128,59,30,195,129,139,72,64,82,0,14,177,
+73,26,8,224,16,26,41,4,164,153,11,33,123,9,154,128,58,104,1,177,138,218,177,41,226,212,195,1,35,147,226,8,
+10,227,2,136,26,216,131,98,144,176,161,24,137,164,183,90,12,1,18,8,25,170,27,47,8,216,144,25,35,134,8,0,
+8,240,25,56,154,241,8,49,129,163,8,30,9,194,2,130,15,178,112,128,162,178,185,145,200,19,61,31,24,83,136,0,
+170,180,128,168,152,202,168,123,148,35,161,41,186,163,170,146,255,180,80,16,0,144,137,40,170,242,1,10,232,50,4,32,
+154,176,177,49,191,67,140,10,52,20,166,163,197,10,248,178,131,153,194,33,26,31,152,57,139,177,8,56,156,145,135,72,
+16,146,145,96,153,145,2,136,120,34,130,51,203,145,34,14,27,193,128,123,136,1,25,14,153,178,160,26,198,136,130,64,
+163,147,42,62,0,171,73,218,132,42,134,40,179,209,146,152,168,45,153,58,57,6,0,14,138,168,146,186,51,142,200,72,
+129,3,72,46,41,169,170,169,160,153,55,81,40,153,12,154,144,216,5,26,88,58,146,104,128,128,161,152,90,139,152,64,
+117,24,146,129,32,168,157,218,17,153,149,65,49,61,168,24,160,90,141,24,8,129,135,144,1,184,32,217,3,159,16,12,
+25,50,9,121,10,136,202,192,153,17,137,72,112,192,33,153,24,13,137,30,131,24,25,67,29,17,43,202,33,200,122,193,
+129,2,32,43,64,146,44,138,142,89,10,152,32,151,41,145,146,225,145,157,207,232,69,0,72,9,194,34,152,57,8,240,
+24,160,137,130,16,156,39,153,64,129,241,162,184,145,148,160,24,135,32,59,180,144,144,141,58,182,144,89,128,228,2,8,
+26,153,9,108,152,193,33,73,140,131,0,26,203,162,34,26,143,132,131,44,147,1,177,138,171,21,249,8,40,35,122,129,
+136,9,171,46,178,178,49,122,178,56,19,172,225,44,41,40,13,43,33,128,81,144,180,41,156,61,128,170,10,150,33,35,
+73,219,199,24,8,160,212,16,16,57,0,136,176,241,193,18,27,216,18,1,73,168,6,10,169,139,135,137,169,33,129,5,
+42,162,212,152,123,8,153,152,129,131,131,49,210,169,232,113,11,177,184,38,74,152,16,194,0,139,56,26,242,152,17,20,
+9,64,29,154,41,195,10,218,1,96,40,195,148,42,156,16,225,32,46,9,40,20,42,194,144,209,131,201,1,138,43,83,
+147,106,9,107,44,9,27,160,192,129,82,152,2,176,129,45,225,145,27,60,74,82,24,25,152,152,89,141,161,9,137,64,
+135,32,42,60,185,130,177,28,171,27,55,129,34,128,185,153,73,31,12,12,136,134,163,48,41,202,165,146,11,143,145,42,
+66,43,133,16,138,168,183,136,27,201,18,7,56,26,195,9,73,201,192,8,9,1,151,2,105,152,24,153,75,188,136,200,
+83,161,4,161,33,171,24,176,31,153,74,130,52,141,149,144,144,144,161,8,77,45,17,164,57,56,137,242,136,153,208,161,
+72,80,24,57,59,25,220,179,136,45,12,195,6,136,145,33,58,47,10,152,137,160,18,135,130,40,145,243,160,163,11,154,
+43,65,37,144,180,67,248,162,208,145,168,162,33,113,9,136,165,128,153,137,208,16,186,7,132,41,9,147,162,63,142,128,
+144,160,20,18,73,28,195,180,8,60,12,128,9,112,8,8,8,146,160,10,11,13,129,60,114,25,43,40,162,155,155,202,
+216,179,18,117,128,41,73,160,226,9,128,27,242,1,51,43,208,2,179,153,25,15,136,41,146,22,129,184,150,242,145,26,
+28,136,161,66,17,40,29,33,208,192,178,25,152,226,5,32,58,44,90,168,137,168,162,137,197,52,25,129,42,2,248,192,
+24,10,137,57,54,89,154,147,131,235,153,193,57,13,128,22,152,163,162,7,11,139,8,169,32,233,62,0,25,105,3,132,
+177,179,150,168,30,137,152,129,81,33,146,32,136,165,189,161,200,176,192,68,16,64,28,40,137,43,159,193,178,165,19,145,
+35,75,154,195,138,28,12,139,148,68,160,149,146,1,225,152,136,42,31,25,35,72,153,33,147,171,31,171,211,24,8,23,
+145,24,28,161,226,25,139,193,178,34,37,144,149,16,178,241,177,145,155,169,55,49,11,56,1,177,191,161,144,186,144,71,
+20,138,33,145,141,42,200,147,44,153,103,129,16,202,195,161,138,192,8,24,31,152,130,137,26,243,160,40,10,208,131,74,
+65,197,129,88,24,184,49,10,9,244,129,83,144,1,32,25,140,241,152,8,177,35,34,29,24,241,152,25,145,130,61,140,
+65,146,140,1,149,129,43,154,144,192,174,38,163,40,42,144,27,171,159,146,211,16,72,179,128,145,221,131,145,129,138,192,
+106,50,219,131,129,146,26,28,61,161,252,32,19,0,26,74,12,178,241,0,0,9,123,32,10,162,226,57,0,145,25,8,
+218,135,163,58,130,32,45,27,13,162,193,12,7,2,136,9,137,145,169,143,19,40,28,75,129,145,138,158,6,16,26,153,
+137,26,90,12,20,49,139,168,232,1,141,188,20,81,24,128,137,58,141,234,18,1,153,0,130,81,11,249,2,18,137,128,
+155,58,61,243,3,20,129,27,186,34,31,204,16,35,4,129,168,49,31,186,144,149,128,57,140,67,43,248,161,19,0,43,
+249,0,152,160,129,53,18,138,224,146,9,250,184,49,52,17,152,64,28,248,168,49,48,44,154,64,8,201,137,121,18,26,
+154,47,9,169,0,49,53,25,155,47,42,248,152,129,36,16,168,0,162,240,136,16,19,152,208,57,32,240,177,180,7,145,
+144,10,152,208,128,18,115,8,152,184,128,224,137,59,112,17,8,9,91,192,168,161,50,3,138,142,88,194,9,58,121,129,
+8,138,25,209,11,1,96,147,32,13,27,169,12,184,88,134,1,168,58,16,15,10,74,35,26,203,92,128,153,160,97,19,
+8,186,44,145,189,1,120,3,0,193,138,180,185,192,56,21,130,162,154,149,184,185,144,39,196,194,153,148,160,144,25,23,
+146,160,185,3,248,137,144,23,145,0,138,147,170,156,144,39,129,57,184,5,153,171,201,7,16,25,170,48,46,5,60,0,
+9,158,169,54,33,169,249,2,8,157,160,37,1,32,157,48,155,250,161,20,48,26,152,129,144,217,225,4,48,24,30,26,
+136,225,177,51,120,25,138,144,211,160,192,19,48,57,11,41,192,249,184,19,112,42,168,146,165,144,140,130,65,8,137,25,
+209,192,216,5,48,16,137,152,130,13,15,136,147,4,161,72,10,193,203,147,96,41,8,43,179,177,205,34,8,34,147,138,
+28,14,142,0,18,81,132,11,144,152,190,0,18,65,20,60,59,139,191,130,147,2,67,45,25,11,203,66,136,105,64,28,
+138,153,201,144,21,130,51,29,26,144,251,137,66,26,50,42,170,148,236,8,33,178,37,144,9,162,243,29,129,24,48,179,
+186,243,161,12,64,26,66,0,193,9,243,137,42,128,81,16,25,154,161,143,59,3,90,3,128,227,144,141,40,160,104,33,
+161,27,168,174,17,227,64,1,130,27,136,174,145,17,89,18,160,24,154,221,9,19,58,1,67,43,241,203,146,18,192,51,
+149,168,241,144,26,146,130,100,56,140,178,211,153,178,1,67,104,155,195,136,186,2,165,50,106,184,163,224,9,136,18,44,
+82,137,160,26,159,130,16,128,116,177,146,137,155,9,137,96,112,136,9,24,141,9,40,0,82,144,33,232,186,144,66,136,
+49,50,75,63,159,0,42,128,56,36,152,154,249,177,0,40,81,131,10,29,185,138,242,5,56,2,42,145,219,153,25,88,
+58,67,193,25,251,25,10,65,93,24,130,152,170,139,161,64,45,3,19,234,8,27,153,49,27,55,130,195,209,224,161,17,
+128,18,4,11,202,154,154,7,137,134,35,176,153,219,16,75,136,98,56,9,202,137,13,129,0,48,83,1,155,172,143,40,
+25,121,0,17,186,137,235,50,11,19,84,0,137,137,186,154,89,108,1,56,154,138,154,60,105,107,90,25,128,220,41,159,
+71,138,146,0,157,160,163,129,8,1,17,4,199,130,9,249,145,32,17,89,9,138,8,40,157,147,136,162,177,134,193,128,
+42,154,164,53,8,153,151,11,26,180,162,18,88,156,164,137,195,75,43,2,156,148,136,131,56,176,124,161,16,136,242,146,
+152,163,120,152,131,185,124,138,8,136,41,180,2,130,28,129,30,181,9,134,8,25,153,144,8,11,240,148,24,56,144,193,
+116,238,71,0,32,44,9,82,162,110,138,136,1,128,17,9,179,225,136,140,167,168,18,155,21,59,152,161,97,41,137,18,
+168,128,186,5,142,138,24,58,180,145,242,32,44,152,184,135,33,147,20,25,240,153,17,186,35,180,241,129,161,184,1,42,
+133,19,138,229,0,136,41,136,116,138,16,140,162,8,138,184,209,23,10,136,177,18,76,40,122,10,41,152,61,40,139,73,
+49,73,42,12,186,195,24,14,56,32,243,0,163,224,1,25,56,148,128,138,122,140,144,128,48,56,152,219,64,250,3,27,
+17,0,83,12,25,226,25,0,61,65,41,155,138,227,8,25,209,36,8,56,250,2,137,26,186,85,25,16,142,2,28,42,
+152,18,74,136,169,21,140,154,168,113,33,42,152,123,43,25,10,120,25,24,172,48,10,216,179,40,20,121,12,72,169,25,
+178,32,133,178,249,128,195,129,145,40,129,149,168,10,177,227,145,176,134,149,194,0,178,145,8,41,114,16,187,202,151,144,
+161,153,5,33,153,170,133,136,45,136,48,164,0,233,131,249,129,145,17,18,24,29,152,217,147,144,32,6,128,184,32,192,
+138,168,22,6,136,202,33,194,185,181,0,82,24,186,97,154,137,176,34,20,227,194,130,136,216,177,128,68,42,138,74,154,
+90,187,133,18,35,250,161,147,60,168,41,22,123,170,16,129,43,139,165,20,40,171,154,132,63,28,0,2,90,11,193,147,
+137,154,194,34,112,8,58,75,46,12,128,32,8,1,168,134,152,154,61,129,49,60,79,25,10,41,45,25,17,144,27,4,
+184,168,78,56,43,130,141,134,169,144,10,179,104,130,140,164,195,1,28,32,72,24,15,40,137,138,208,167,2,16,154,129,
+162,28,169,5,176,21,194,164,0,11,176,164,225,48,160,8,137,216,0,121,75,24,180,0,145,171,241,147,1,17,18,10,
+152,175,25,107,17,107,152,128,152,129,14,0,148,8,3,25,32,172,169,42,215,163,151,177,1,153,26,60,168,130,51,154,
+120,24,31,168,163,196,134,152,1,59,29,152,162,147,18,129,45,43,138,194,150,40,58,88,29,136,12,130,136,145,65,148,
+184,193,156,162,16,153,121,5,152,144,156,19,26,10,106,133,160,33,170,138,59,182,8,135,24,42,202,42,1,121,28,80,
+10,25,137,193,65,247,67,0,129,226,161,5,178,57,192,16,11,136,154,39,137,76,160,185,181,149,177,52,153,160,177,192,
+33,59,248,112,128,144,25,43,42,176,181,122,16,192,195,8,128,130,152,122,128,208,130,26,57,13,196,56,145,160,181,161,
+59,137,131,90,34,154,164,161,30,41,160,42,7,144,210,176,3,58,185,8,55,42,26,249,1,139,148,24,52,201,129,233,
+129,137,178,42,116,9,41,186,136,241,48,201,115,136,1,154,136,153,128,148,122,162,2,192,26,192,50,155,81,165,40,170,
+91,200,17,216,33,164,209,180,161,146,44,161,89,178,1,196,9,160,128,182,42,2,162,183,176,147,152,18,31,19,160,164,
+156,130,136,130,160,113,128,121,138,75,12,16,201,52,153,32,43,46,169,19,13,121,137,145,144,74,154,131,177,50,180,129,
+240,137,146,227,1,107,16,136,176,161,16,59,241,2,4,8,192,178,145,78,43,42,49,45,160,209,128,75,137,144,68,57,
+139,233,41,161,161,228,4,145,178,9,60,57,154,128,114,1,168,192,185,165,146,212,50,8,24,11,12,44,160,163,114,162,
+196,162,154,193,196,179,33,35,9,46,141,41,25,46,73,129,196,128,42,128,164,40,17,134,18,201,28,219,181,130,9,181,
+227,0,29,136,8,128,160,33,178,57,157,194,2,57,41,5,133,129,137,72,58,145,2,7,34,139,208,132,137,0,152,113,
+128,209,9,137,9,248,164,130,146,8,11,41,188,167,40,41,49,208,178,145,26,72,200,149,20,75,30,9,161,136,25,58,
+20,139,171,224,184,177,73,75,113,58,10,184,196,24,106,11,3,197,162,145,153,57,75,201,20,145,26,154,161,28,24,15,
+81,146,137,194,24,62,10,178,36,3,10,176,183,128,128,145,115,18,153,161,168,154,226,182,3,5,27,8,168,209,194,163,
+122,32,10,136,193,0,201,163,89,65,139,153,196,8,45,9,9,51,200,161,210,160,10,128,43,113,8,210,178,162,78,26,
+136,35,145,200,72,62,47,136,145,50,58,138,144,73,31,25,160,82,24,136,137,93,29,136,144,17,1,200,162,16,27,26,
+41,124,16,136,26,17,174,130,145,17,7,160,211,129,155,92,43,136,5,161,168,2,171,154,197,49,65,57,156,129,224,9,
+144,8,39,162,160,90,186,59,86,244,62,0,168,133,65,56,29,27,161,31,9,40,2,36,169,27,128,143,136,129,36,81,
+10,44,0,31,10,41,1,133,176,136,163,143,138,32,130,84,11,58,136,220,128,130,148,34,197,25,129,28,139,3,179,37,
+145,189,150,192,129,25,3,16,148,12,40,14,170,195,151,1,129,10,178,210,153,24,88,74,41,138,105,28,154,178,167,129,
+131,9,8,128,155,104,123,43,56,200,1,136,153,25,148,32,4,153,60,144,221,40,65,153,147,243,146,144,185,59,122,160,
+64,8,25,152,241,160,150,144,163,131,152,163,194,140,114,169,132,129,41,137,215,160,18,136,177,149,40,138,161,154,121,176,
+1,16,125,43,168,144,73,128,75,24,57,13,160,43,122,8,57,24,123,10,24,155,106,24,42,56,139,132,10,186,78,145,
+24,129,40,0,194,250,1,35,47,8,177,179,178,44,28,3,218,151,0,128,58,202,162,5,27,57,176,134,128,153,136,83,
+171,180,149,33,61,154,168,21,27,209,164,129,40,139,201,65,208,162,132,72,28,225,161,2,137,160,165,18,137,160,145,32,
+242,227,149,40,26,152,177,19,26,160,120,41,137,243,161,74,136,152,5,107,26,9,27,91,42,26,122,25,160,211,128,136,
+56,140,65,152,164,128,27,26,56,27,49,151,226,146,186,167,16,8,106,8,56,30,136,144,0,42,10,135,41,9,11,16,
+45,169,163,4,40,187,231,163,177,179,145,36,58,186,243,128,136,1,226,20,145,128,137,145,26,192,50,127,25,24,184,48,
+29,59,44,89,26,160,195,160,181,0,160,51,145,210,152,58,31,75,59,60,34,170,229,178,196,162,16,24,49,9,44,59,
+60,29,136,146,151,162,144,210,1,137,72,44,64,59,28,139,176,1,160,146,23,3,29,11,74,141,129,154,135,146,210,177,
+179,195,2,25,88,24,27,75,10,193,148,162,130,167,179,192,161,160,133,75,57,0,211,136,153,242,163,162,105,0,16,140,
+25,154,1,77,60,179,195,160,72,45,74,75,59,32,26,27,141,193,18,16,76,18,40,12,9,171,32,56,175,7,162,161,
+10,227,89,137,26,18,0,42,173,162,136,48,249,22,8,43,28,139,16,41,8,50,135,169,180,211,42,32,30,32,41,48,
+31,76,10,105,10,57,9,177,162,217,147,163,18,252,59,0,151,32,24,29,11,26,155,5,193,8,35,128,152,245,41,8,
+178,16,104,153,26,136,146,121,138,10,7,24,29,130,30,9,17,145,195,179,2,214,163,147,160,8,131,39,64,91,173,195,
+9,91,107,153,8,10,185,129,145,177,134,153,146,1,31,25,136,167,130,163,2,195,147,25,48,162,180,112,89,10,168,80,
+42,186,148,3,44,141,8,16,42,41,194,136,200,147,242,152,131,133,25,42,48,45,171,26,5,33,250,164,163,24,11,195,
+163,62,44,184,165,144,40,242,145,128,145,161,227,40,136,90,11,16,180,166,16,161,176,144,136,125,153,48,73,24,202,49,
+45,176,161,195,20,25,40,46,8,26,145,50,245,2,10,40,137,130,151,162,128,128,137,47,208,32,8,76,226,163,162,42,
+10,16,93,25,10,40,11,32,28,154,2,106,42,153,162,43,95,42,24,73,29,128,148,201,178,162,162,135,161,1,146,192,
+130,161,109,11,161,80,42,128,60,138,32,41,144,58,11,158,44,198,165,147,193,16,56,154,41,141,16,106,40,152,163,92,
+46,9,144,136,178,129,33,197,9,144,213,17,0,28,145,1,11,123,137,148,145,42,59,146,240,136,105,138,2,128,16,194,
+218,33,9,56,211,165,24,1,128,218,165,9,34,138,58,75,140,57,97,155,5,184,88,201,195,42,27,8,121,16,40,144,
+210,160,74,193,146,1,10,112,40,186,132,172,133,16,42,161,154,74,108,24,41,153,152,179,6,249,144,24,24,35,144,123,
+160,200,16,137,129,227,144,120,42,169,3,43,26,57,241,147,194,177,9,132,180,135,139,2,9,129,15,168,179,35,148,195,
+183,194,129,75,10,40,90,60,57,176,130,170,180,132,136,9,24,44,30,73,0,96,139,16,160,136,208,176,226,147,133,146,
+24,192,162,24,77,8,200,164,89,0,184,165,42,41,43,9,41,155,226,136,135,56,8,43,77,92,27,152,168,147,3,179,
+165,149,25,30,144,146,146,169,212,147,146,196,168,163,2,194,164,195,1,47,128,1,24,153,152,149,211,193,129,77,26,17,
+56,77,27,153,1,59,40,218,144,121,146,161,145,43,25,167,25,8,153,232,35,64,42,27,26,128,74,201,168,248,33,82,
+40,138,163,243,8,137,40,75,31,76,16,0,137,192,195,131,137,7,69,0,58,154,145,140,78,0,130,17,28,136,132,25,
+169,190,17,64,25,163,164,1,29,161,29,128,192,209,3,80,168,128,0,35,251,148,25,24,172,165,3,2,242,129,129,145,
+185,245,145,128,17,0,8,130,152,145,170,80,143,144,194,151,146,152,210,132,152,129,41,57,156,195,131,16,178,130,192,129,
+159,229,162,0,128,88,25,1,144,193,242,147,177,193,179,49,128,49,155,88,152,179,90,13,128,154,144,151,150,168,164,130,
+144,152,25,91,139,129,66,24,151,10,9,137,152,227,177,200,21,56,26,108,57,170,64,141,195,136,160,19,1,24,91,162,
+16,173,128,43,12,3,124,128,32,42,137,232,34,45,107,11,72,152,146,8,180,1,44,11,89,137,140,147,66,24,9,243,
+16,25,47,27,136,128,108,24,136,132,136,160,145,60,29,195,26,147,152,164,179,135,27,168,243,3,13,152,49,33,138,6,
+154,130,185,145,136,228,73,41,130,97,136,137,201,2,216,130,141,145,3,75,0,22,10,61,169,130,210,168,128,151,129,17,
+240,2,137,57,171,146,136,123,57,24,89,170,227,129,9,44,153,128,135,32,153,5,10,137,197,129,58,155,145,41,135,16,
+144,160,135,186,227,179,2,29,130,131,88,11,26,168,131,186,146,233,131,114,24,138,1,176,179,76,143,162,160,164,150,147,
+56,138,179,139,41,15,59,170,32,151,132,40,24,188,0,161,76,171,164,128,113,128,33,224,162,25,144,164,9,27,64,51,
+43,148,47,145,12,140,9,49,15,148,48,8,160,147,137,123,31,136,8,177,2,131,145,4,10,107,15,145,24,10,201,84,
+138,146,160,2,154,152,10,74,140,17,100,129,8,48,46,45,153,152,192,17,146,100,136,24,161,137,250,1,153,136,161,122,
+3,40,73,43,168,44,153,47,136,41,56,96,8,49,15,176,162,200,146,107,25,75,179,163,179,41,32,143,153,168,231,130,
+40,161,131,10,131,161,29,169,61,192,195,4,130,40,8,131,10,242,153,170,49,9,115,146,56,235,67,218,177,162,144,130,
+123,2,89,185,17,178,185,9,202,229,1,24,149,19,169,146,144,224,128,171,45,178,21,145,131,168,58,184,93,185,128,139,
+88,50,50,135,169,57,41,172,195,13,161,182,4,105,177,144,144,180,200,130,97,249,68,0,155,2,138,135,19,129,186,20,
+192,24,217,129,63,41,16,2,185,73,51,174,160,43,200,0,40,112,24,145,155,54,141,139,195,11,34,16,66,108,26,58,
+17,15,25,59,141,32,2,64,1,31,41,8,152,28,138,29,48,105,144,165,0,9,146,155,41,156,43,131,20,104,145,193,
+130,194,170,121,28,11,148,129,113,10,25,8,9,170,145,170,28,130,53,34,8,250,67,232,144,178,153,57,107,106,58,8,
+1,162,194,61,192,194,56,137,132,146,32,43,210,248,16,144,154,18,122,136,149,144,40,152,186,149,168,161,161,7,25,179,
+165,40,25,250,178,160,9,34,129,4,137,243,180,1,30,177,153,17,132,147,20,147,242,56,233,0,8,26,92,26,57,19,
+160,154,165,186,58,196,153,123,128,88,24,128,8,146,159,40,160,208,3,144,112,57,42,46,162,139,24,152,152,48,187,120,
+163,182,64,10,186,49,201,0,34,15,32,19,216,19,168,143,146,152,128,146,48,112,16,8,49,235,170,145,170,124,136,41,
+133,17,11,48,12,170,179,10,112,153,33,166,145,136,192,145,187,134,201,147,131,22,17,201,32,185,162,142,106,13,144,40,
+65,41,28,16,76,138,10,1,92,45,144,18,32,59,43,192,72,28,152,152,77,57,1,144,50,31,137,192,41,203,165,0,
+4,24,243,148,145,128,184,213,0,161,161,132,129,129,0,217,131,156,168,49,202,178,167,34,8,195,8,104,173,164,1,137,
+9,135,129,8,176,148,130,140,128,49,31,107,8,24,42,154,48,141,42,61,144,25,104,41,162,82,13,41,138,24,58,248,
+144,80,75,8,145,59,144,216,132,42,248,144,17,32,16,193,153,128,209,178,149,10,136,151,130,35,184,210,8,12,177,1,
+12,202,7,3,32,153,58,202,56,200,181,184,1,73,135,194,136,16,145,91,27,216,1,26,81,179,162,28,146,243,1,58,
+187,193,35,124,136,137,72,24,171,8,121,28,10,25,113,10,144,8,129,9,178,133,30,24,128,20,8,194,9,160,122,136,
+242,136,144,2,132,9,27,179,146,1,78,225,0,128,72,194,131,29,136,161,163,136,192,164,194,67,177,180,144,136,142,146,
+0,200,208,130,98,161,209,146,147,25,195,56,45,139,152,55,26,154,136,129,123,209,162,0,80,251,69,0,25,43,7,58,
+11,144,243,72,10,160,177,41,124,1,152,24,24,9,72,45,26,139,24,110,128,136,8,59,9,150,9,29,144,178,68,42,
+154,24,60,30,195,145,74,11,210,21,8,154,180,2,59,225,196,130,26,153,135,129,9,168,164,33,139,248,147,16,27,150,
+146,42,27,243,1,25,138,177,18,109,0,177,0,9,227,147,40,11,209,161,104,8,192,129,74,9,243,130,44,153,147,104,
+42,169,147,56,47,161,179,25,60,209,4,106,11,145,32,91,138,211,16,43,29,146,2,10,136,226,35,43,201,181,129,25,
+34,182,8,26,186,151,56,155,243,194,115,9,226,130,27,12,1,32,27,136,59,50,128,137,242,46,42,180,134,24,10,176,
+0,80,10,169,160,130,25,167,41,137,186,7,74,24,138,5,43,46,136,41,44,40,136,88,9,25,240,17,137,185,182,129,
+130,163,180,0,160,2,160,72,140,192,163,62,121,8,152,24,46,129,137,11,161,146,16,36,59,248,149,32,152,181,147,170,
+198,163,0,137,58,187,80,42,195,35,250,9,16,135,176,2,0,193,48,11,17,249,145,10,151,17,155,139,148,136,131,195,
+112,11,17,136,64,59,92,185,9,144,157,0,48,128,96,10,42,121,26,154,49,28,193,19,81,58,200,9,41,120,154,153,
+0,46,168,9,65,123,160,19,46,26,0,176,34,60,1,176,73,192,151,0,12,153,227,0,90,152,145,24,74,178,179,64,
+30,136,3,11,58,228,163,10,0,180,164,129,219,212,131,129,192,180,148,144,144,166,2,176,193,131,89,154,144,131,76,12,
+152,132,16,41,43,60,8,168,165,26,93,185,162,6,8,32,10,74,28,178,178,76,27,184,168,72,81,1,157,32,17,208,
+165,26,9,210,145,73,179,150,41,152,161,129,241,169,179,151,33,44,195,150,25,153,146,152,9,153,3,24,216,228,165,131,
+25,209,130,9,145,162,2,58,221,167,129,16,25,200,2,10,40,137,123,11,160,24,121,9,25,168,32,44,120,138,40,57,
+154,66,63,153,3,10,27,58,77,41,45,136,184,130,93,130,161,1,45,193,130,18,12,91,171,177,20,2,162,194,176,167,
+128,136,229,195,129,8,128,3,162,137,138,199,1,41,172,194,161,17,162,23,16,25,216,145,25,60,185,5,84,254,70,0,
+60,77,138,130,18,8,59,146,45,28,226,146,58,45,152,4,145,72,43,138,30,41,41,18,63,139,0,121,89,10,136,153,
+9,56,8,122,45,161,144,80,74,138,8,26,27,59,80,59,248,152,129,49,25,179,151,145,154,32,34,233,217,150,24,137,
+2,180,146,128,241,146,128,145,226,128,176,180,52,25,10,210,195,1,8,161,243,168,180,132,72,25,145,128,152,61,123,27,
+153,153,16,24,122,8,130,129,136,63,29,40,44,9,74,76,74,8,8,0,26,12,27,163,33,15,0,76,24,33,26,10,
+1,143,8,165,128,169,162,166,17,165,161,226,129,136,9,33,160,154,26,9,90,151,163,2,180,211,41,210,147,44,13,43,
+9,151,144,146,145,24,155,162,135,56,47,42,138,18,178,32,178,214,144,2,195,42,11,138,88,66,152,74,12,136,178,149,
+176,74,31,24,9,80,136,33,40,144,14,138,228,41,136,8,32,105,128,74,176,145,154,185,134,161,179,136,240,1,133,58,
+25,28,152,93,161,136,146,139,183,34,130,42,0,203,150,152,144,165,129,142,163,1,89,43,160,195,147,76,8,177,88,12,
+144,1,66,142,35,171,1,153,2,137,81,159,40,42,124,168,147,144,72,171,50,154,73,203,128,40,51,242,35,128,13,197,
+57,137,41,240,57,152,48,163,33,129,121,160,46,194,184,149,60,9,1,145,90,24,43,163,14,194,130,178,62,160,129,66,
+29,146,8,161,155,135,27,104,140,146,128,33,139,132,168,8,249,34,60,8,202,2,8,49,209,34,208,35,158,18,185,2,
+242,32,59,24,160,80,177,121,170,56,224,18,138,94,138,17,144,56,137,130,243,16,152,41,26,14,163,33,164,56,241,179,
+180,26,41,12,243,24,41,42,18,138,50,154,183,209,163,138,149,29,129,8,148,32,136,72,122,155,152,210,147,26,18,152,
+113,138,131,160,18,174,161,136,35,249,164,147,106,41,75,208,3,154,9,0,0,139,134,201,163,134,128,128,56,154,60,13,
+41,240,146,0,41,162,40,241,50,144,29,160,164,160,1,179,138,22,57,80,57,194,145,167,65,30,11,24,60,26,56,29,
+46,136,139,194,130,136,29,162,128,98,9,128,146,49,30,128,130,89,28,56,144,134,129,164,168,5,139,177,40,138,155,135,
+236,20,71,0,59,74,211,147,169,21,171,0,156,18,193,32,168,83,128,112,10,73,176,155,10,109,137,72,169,26,132,49,
+27,59,184,26,233,170,151,60,160,90,8,56,137,41,149,43,59,29,212,136,148,184,21,27,136,137,132,28,144,155,112,11,
+16,153,17,192,38,26,96,139,160,162,166,176,64,171,64,35,131,155,54,185,107,152,17,203,177,227,33,40,90,168,1,165,
+161,9,8,187,79,177,144,151,1,178,32,152,128,173,27,36,171,176,160,82,60,180,164,27,139,141,16,91,27,210,129,120,
+56,9,16,29,139,163,227,72,26,1,10,50,46,195,130,58,161,184,56,61,157,130,6,76,26,178,2,9,32,219,145,60,
+0,156,122,0,9,64,89,12,152,147,27,170,162,176,139,111,48,0,16,28,184,146,72,188,166,169,169,131,113,34,144,178,
+16,242,1,184,184,138,0,136,148,119,9,145,25,9,201,176,33,140,178,34,60,120,35,128,136,173,210,144,153,132,200,145,
+3,68,108,0,136,29,177,40,170,168,165,16,73,90,161,161,51,139,129,184,219,154,150,152,80,25,164,3,123,58,144,58,
+15,177,0,155,2,171,23,40,89,171,132,32,152,169,17,191,137,165,36,24,168,184,66,7,60,184,138,185,0,140,7,16,
+128,160,152,81,16,188,137,210,61,144,65,17,147,176,224,131,128,129,217,17,93,138,1,36,27,130,157,11,24,91,136,177,
+56,12,33,167,122,128,184,148,153,1,145,132,58,14,42,4,11,40,192,169,99,139,171,7,130,11,193,146,9,75,185,149,
+162,8,241,1,66,146,156,130,163,24,211,140,2,33,240,41,160,81,184,163,49,72,156,184,151,8,16,158,178,24,147,18,
+131,120,169,210,18,2,156,186,160,145,112,50,59,148,163,242,26,140,146,171,179,32,175,17,7,1,128,170,176,148,40,13,
+59,225,18,25,64,7,0,138,136,153,10,67,143,18,185,25,45,67,128,1,203,130,200,172,35,24,146,60,157,123,4,41,
+139,8,128,130,153,113,144,11,28,62,152,36,152,75,227,153,9,41,212,1,170,136,151,32,34,137,33,139,184,188,7,155,
+146,161,150,2,19,153,7,169,12,154,209,72,11,130,67,225,8,2,81,153,177,140,18,30,24,145,128,49,168,15,66,144,
+13,129,12,24,170,249,64,0,123,169,50,177,152,154,57,81,168,61,9,2,159,35,30,33,25,208,136,181,33,58,160,144,
+133,31,160,4,137,57,233,179,130,131,152,151,25,141,1,128,131,137,193,18,249,18,181,0,128,169,154,7,24,25,130,241,
+129,169,49,152,194,218,130,59,135,25,10,129,201,163,92,136,17,242,32,26,180,16,58,129,136,74,15,0,2,59,28,16,
+152,112,154,161,16,15,44,24,32,123,27,41,129,48,62,128,10,61,28,145,16,9,140,36,145,91,185,50,140,1,251,177,
+130,138,136,151,130,179,178,167,150,137,144,24,24,128,241,128,132,146,146,105,26,26,139,61,32,171,216,128,96,64,160,24,
+152,57,28,75,59,45,219,129,66,16,130,184,16,241,19,142,1,28,176,0,56,42,183,50,168,243,160,56,27,226,164,168,
+130,162,165,73,0,210,48,31,8,129,25,12,24,72,122,137,0,145,90,28,128,160,72,14,0,24,136,161,146,97,59,200,
+179,19,27,218,129,48,12,215,131,8,136,195,163,57,169,213,0,9,184,167,40,9,208,165,16,25,176,146,27,57,181,135,
+25,25,193,1,108,9,160,24,60,9,130,49,142,145,161,64,155,165,164,76,28,0,16,91,137,144,2,46,208,146,131,57,
+153,160,3,109,184,17,58,15,128,16,73,28,192,0,32,56,209,162,152,152,242,49,43,226,149,25,24,8,16,46,25,160,
+148,62,136,161,163,75,25,138,120,9,16,152,40,143,145,32,144,43,226,163,34,75,40,225,1,29,193,130,160,200,148,149,
+130,179,128,178,211,233,147,129,153,242,146,147,147,196,128,25,33,139,144,33,47,157,56,74,121,0,24,58,26,157,9,122,
+41,26,44,41,58,184,34,42,137,31,16,78,160,177,129,178,49,197,133,153,180,193,129,129,196,161,56,154,2,243,129,144,
+182,162,168,193,149,162,9,227,128,145,112,42,163,168,9,9,19,123,44,177,16,27,123,41,32,60,29,10,56,60,44,152,
+122,41,138,146,57,26,140,163,66,27,138,2,127,138,192,3,56,169,212,162,129,0,138,18,142,162,196,34,57,156,160,32,
+25,19,138,176,172,151,128,127,136,144,136,40,128,133,43,10,9,65,27,46,195,179,74,9,193,148,24,169,182,179,161,10,
+151,17,9,208,196,131,8,160,229,255,67,0,177,196,0,168,84,137,209,178,147,1,40,209,129,240,145,10,120,137,128,0,
+90,41,11,144,48,139,131,30,92,0,144,89,77,136,25,144,90,152,144,11,24,146,3,80,47,145,9,8,25,176,32,203,
+226,23,153,129,136,18,152,149,193,8,155,242,145,4,169,161,8,54,184,161,184,49,141,133,11,32,226,136,109,0,128,25,
+144,16,16,15,10,129,180,121,26,136,1,11,19,145,106,142,176,19,2,47,154,132,32,44,161,129,9,155,242,35,42,234,
+210,132,56,138,129,74,57,202,181,90,44,177,178,66,42,217,130,40,43,160,128,63,75,145,48,77,137,193,129,72,9,137,
+43,94,136,130,59,74,42,194,42,16,186,193,194,211,197,131,154,3,165,147,192,211,180,162,144,194,181,130,193,181,132,128,
+153,128,1,59,185,177,24,122,208,4,73,44,9,25,122,27,137,58,74,60,128,58,123,8,24,43,90,28,26,27,25,17,
+152,137,36,214,131,153,162,168,197,128,0,177,179,164,133,151,177,209,131,160,145,192,192,131,2,128,65,152,137,8,80,8,
+250,200,24,24,17,160,121,40,73,26,123,75,13,144,25,32,26,154,105,32,40,152,25,57,176,165,141,48,141,152,33,4,
+32,187,176,85,139,210,192,178,80,193,145,132,56,13,146,120,27,152,208,17,25,160,128,80,74,168,164,121,11,137,0,76,
+26,136,136,123,56,152,0,74,11,178,130,31,152,129,1,105,0,145,138,40,180,226,145,216,163,164,145,193,150,9,130,144,
+165,0,187,160,19,3,177,246,1,128,64,8,123,13,144,128,72,25,27,138,80,128,8,16,63,11,8,24,79,137,24,136,
+49,168,148,41,26,208,160,33,31,162,33,176,36,243,176,148,144,163,224,177,0,150,8,144,136,35,144,134,136,129,159,0,
+59,1,139,240,3,97,137,162,177,17,141,129,60,72,31,152,16,48,25,210,10,24,224,162,9,17,200,132,33,104,153,163,
+128,65,224,137,43,18,169,133,27,132,180,6,184,163,240,8,139,35,168,91,12,66,75,2,153,41,8,142,153,20,185,74,
+186,85,58,40,169,121,10,10,155,123,138,24,145,88,153,4,162,123,152,128,10,58,234,3,43,92,162,4,161,8,243,129,
+176,8,243,128,136,56,164,65,168,136,147,26,182,9,62,0,160,153,245,25,136,11,23,56,160,8,160,74,136,156,181,8,
+209,40,2,124,0,11,0,10,144,42,72,143,0,139,5,0,133,152,16,12,130,140,33,170,146,30,80,42,80,184,32,138,
+131,154,97,139,91,174,65,41,24,41,59,217,32,210,41,1,11,224,35,130,51,146,147,150,121,219,145,27,60,186,162,135,
+160,242,176,212,0,136,168,130,195,128,178,20,32,57,241,131,128,130,181,148,17,195,131,34,5,153,178,16,13,62,153,9,
+40,169,43,123,65,168,193,9,26,46,40,75,13,8,1,92,33,9,128,26,169,42,107,13,0,27,123,9,50,192,164,152,
+169,136,137,243,129,154,24,123,65,136,0,208,194,137,128,243,129,144,25,138,70,128,8,152,25,140,176,183,8,10,177,181,
+97,130,179,146,32,13,152,200,180,57,61,152,65,18,36,128,138,196,160,192,48,173,197,8,41,18,34,48,155,169,60,24,
+156,13,45,203,51,82,8,106,136,137,57,76,29,153,8,76,27,49,24,10,120,8,10,27,130,15,58,157,2,92,25,16,
+10,17,25,234,2,161,176,185,153,7,2,1,193,9,35,232,148,153,193,224,178,4,130,3,9,216,131,167,147,168,177,212,
+144,1,3,166,8,128,138,176,167,163,138,153,24,61,24,100,27,26,42,31,58,18,154,137,44,25,120,57,106,28,60,43,
+44,90,0,137,10,57,107,56,26,11,26,30,43,136,17,2,241,146,97,136,128,43,26,138,216,26,75,121,178,148,153,151,
+130,152,130,154,154,161,74,225,149,161,24,150,161,149,168,160,195,178,57,27,140,5,145,134,146,194,145,161,144,146,204,184,
+74,56,72,135,0,8,9,210,136,8,13,58,203,56,58,117,24,145,136,24,156,40,59,15,42,28,8,121,50,42,42,185,
+11,136,171,50,15,11,47,107,72,129,128,8,184,176,165,153,152,193,194,122,32,73,24,210,8,160,177,177,162,242,128,185,
+35,32,65,113,152,194,145,152,185,167,160,160,50,144,64,37,8,60,192,137,168,162,219,162,122,1,10,123,16,130,59,10,
+188,91,9,26,41,37,15,129,17,123,144,41,140,8,43,8,177,48,0,44,16,115,73,45,192,58,184,136,8,20,137,147,
+145,159,134,130,144,178,184,140,132,48,165,210,145,42,176,6,229,7,67,0,133,155,179,193,10,20,227,128,162,169,182,17,
+58,129,181,168,162,141,5,162,145,8,194,28,33,162,20,186,156,152,132,18,33,220,24,46,155,20,120,27,9,10,88,91,
+136,40,25,155,128,10,73,67,216,129,82,171,66,152,177,179,172,235,2,210,134,128,160,147,213,17,162,193,129,185,169,151,
+130,24,1,244,146,128,145,194,145,9,160,193,49,27,49,150,194,56,140,226,2,26,154,1,154,89,112,145,147,152,169,17,
+34,249,146,168,232,128,121,0,17,168,149,137,75,178,12,57,176,232,72,58,57,149,50,31,185,132,41,26,26,218,43,123,
+0,2,104,11,144,128,152,49,172,242,56,45,145,18,76,25,136,176,32,12,225,147,43,153,147,99,89,8,145,146,14,28,
+164,144,25,145,200,96,8,161,147,178,11,242,2,25,248,179,132,59,41,147,42,125,137,177,33,11,226,195,130,24,184,163,
+112,44,8,16,45,11,177,178,18,43,243,132,74,136,161,64,77,154,0,72,45,10,148,144,57,161,136,105,41,153,177,75,
+30,177,19,49,141,193,3,10,125,160,128,59,184,150,40,136,161,196,146,17,202,180,1,184,178,52,14,148,177,166,144,152,
+211,1,11,167,178,1,40,152,179,52,143,128,161,48,138,177,2,0,60,134,3,47,138,210,32,107,138,144,57,8,152,150,
+16,74,233,147,41,11,129,184,27,114,128,64,92,43,226,1,26,25,184,147,90,45,144,19,77,137,136,24,43,27,152,16,
+28,41,17,120,24,179,163,110,138,178,131,25,233,198,130,57,25,195,180,160,8,225,179,199,7,59,184,243,8,128,40,145,
+144,34,0,60,244,177,9,33,25,82,9,152,192,0,210,162,153,41,60,72,8,9,90,47,0,26,41,163,35,142,137,2,
+11,196,48,88,59,156,165,8,44,46,41,16,43,41,146,152,129,31,194,179,18,194,145,25,42,90,149,18,30,45,153,168,
+4,9,41,138,16,134,57,32,31,1,180,160,34,31,27,171,163,177,57,18,125,129,41,41,249,130,33,26,10,145,65,137,
+178,199,160,41,121,27,9,171,164,41,5,58,58,153,120,44,176,166,129,24,91,154,40,8,26,24,241,130,10,122,28,130,
+138,8,25,135,24,179,73,140,177,8,128,33,243,128,129,28,136,137,72,146,125,245,66,0,122,177,136,129,17,172,135,19,
+177,194,152,0,9,9,15,169,130,214,136,132,146,136,212,164,2,26,168,129,48,154,28,147,26,167,136,185,198,0,107,24,
+136,128,160,163,2,43,73,92,139,193,106,24,168,216,35,40,72,186,244,129,16,168,194,49,137,1,137,108,144,208,164,146,
+17,8,192,26,2,208,152,34,216,21,141,136,196,146,24,48,1,134,184,26,1,60,142,152,180,18,169,105,192,179,137,34,
+104,73,136,25,41,14,160,145,128,136,165,56,58,155,190,120,24,2,18,47,26,168,208,2,2,48,208,128,107,13,9,41,
+128,135,161,144,129,160,193,131,28,33,8,155,125,138,136,144,35,6,128,177,144,180,248,24,155,16,178,181,49,192,149,58,
+16,108,8,128,137,129,188,146,152,166,151,145,16,169,145,59,75,92,160,179,49,179,217,0,1,250,132,9,57,208,160,40,
+57,209,20,147,179,179,217,123,153,130,9,170,26,97,128,169,211,17,123,162,163,133,216,26,8,137,41,212,33,58,10,9,
+34,79,9,147,0,88,233,136,129,160,17,210,16,73,217,144,57,0,57,21,57,138,246,0,137,145,168,7,152,129,162,45,
+139,164,17,16,130,24,151,171,144,210,8,10,167,145,130,44,153,148,57,137,39,8,146,141,144,192,59,26,132,56,90,186,
+25,114,59,185,38,9,40,141,57,43,156,144,88,57,123,170,41,8,16,12,113,56,9,217,144,8,57,2,161,1,43,152,
+175,167,129,192,88,128,1,186,192,164,129,75,41,177,151,194,24,59,75,152,66,150,162,160,138,137,154,10,2,162,167,211,
+131,62,106,154,16,35,1,193,140,27,168,179,3,126,152,145,128,152,129,194,62,72,128,18,75,28,152,169,2,16,208,162,
+139,243,184,167,40,40,19,128,153,142,1,106,10,152,194,132,138,197,147,147,42,48,151,194,9,170,27,193,2,121,8,16,
+216,2,144,88,30,8,146,164,1,138,12,169,148,56,56,129,44,106,142,129,26,0,18,167,128,128,25,185,177,40,123,10,
+152,81,185,164,57,59,0,135,161,128,225,1,75,14,130,41,152,88,9,40,139,192,21,32,26,140,224,161,136,136,23,136,
+160,73,9,75,43,146,32,135,56,159,128,152,128,145,34,144,228,41,16,30,8,152,130,135,228,7,69,0,146,25,169,137,
+9,128,125,161,8,42,176,16,225,19,145,135,146,168,194,139,41,192,123,162,161,88,152,40,217,133,73,42,0,27,46,10,
+140,147,121,41,184,163,166,0,10,146,90,42,144,57,44,30,184,166,32,153,164,136,166,161,8,8,78,160,130,146,144,152,
+168,97,27,4,153,41,8,245,24,60,57,176,149,1,168,161,27,14,91,57,74,28,17,128,45,41,138,4,136,130,209,148,
+170,169,243,18,107,44,0,162,162,128,128,192,129,192,132,40,172,182,32,24,123,43,74,153,243,0,136,1,160,149,2,25,
+138,12,2,136,35,31,75,176,211,0,91,129,1,144,2,165,225,129,192,167,130,17,28,138,24,79,10,40,59,13,200,145,
+178,144,144,242,131,136,41,8,145,164,123,40,40,41,2,104,160,1,10,4,33,228,48,9,147,203,147,72,25,8,137,131,
+193,240,47,192,162,162,129,56,192,197,24,2,40,59,28,123,152,9,27,179,129,144,24,162,123,243,162,18,76,27,184,129,
+26,171,60,45,105,45,25,40,9,128,138,165,18,154,214,163,165,129,27,59,154,9,16,137,6,242,128,25,136,196,164,129,
+148,163,58,29,152,163,130,77,57,1,155,112,74,144,130,208,2,211,136,72,155,179,144,121,90,10,136,48,74,57,153,170,
+3,23,153,211,168,3,208,137,51,43,143,145,1,120,140,137,163,134,138,162,225,130,42,168,130,147,31,160,197,1,58,27,
+177,23,26,152,216,148,16,10,25,48,157,129,180,4,144,177,179,55,171,136,225,2,185,167,25,32,27,161,150,24,128,209,
+195,99,153,41,170,48,176,180,26,120,184,180,163,144,131,218,145,112,129,44,144,57,169,88,12,40,185,145,151,160,146,19,
+13,92,130,43,136,12,147,41,173,74,196,40,137,1,24,130,26,78,33,170,80,11,128,26,3,79,9,43,42,25,92,25,
+194,42,7,9,8,154,57,59,0,191,6,44,26,152,147,72,154,227,21,177,40,152,25,154,129,235,35,201,160,132,44,129,
+150,200,20,146,177,195,9,9,51,251,40,137,60,92,25,24,8,153,122,149,152,129,27,201,131,162,8,145,155,69,47,59,
+89,139,56,90,152,1,152,137,64,171,60,40,187,20,1,105,186,146,58,55,10,152,154,138,104,45,168,17,216,253,60,0,
+251,2,160,209,148,146,1,18,151,0,208,136,128,131,170,4,240,178,145,195,163,1,137,51,182,17,3,190,244,2,10,40,
+216,1,0,137,8,146,17,32,88,178,151,140,196,130,152,105,152,60,10,40,152,106,29,145,3,25,40,249,195,24,32,75,
+160,46,25,42,10,65,43,145,20,64,40,204,178,42,169,144,23,15,145,144,16,128,168,6,33,44,41,192,161,208,130,163,
+196,184,165,179,161,16,244,17,41,16,56,169,31,9,161,128,34,248,178,8,136,146,241,48,18,0,24,112,11,217,32,76,
+41,185,8,113,139,145,148,91,10,1,162,65,31,9,58,28,74,145,44,43,17,58,106,15,129,1,168,65,137,136,43,33,
+24,208,153,73,208,58,76,10,194,19,136,20,194,11,154,197,130,3,241,160,178,131,136,161,4,150,179,42,151,160,192,24,
+177,148,208,56,128,144,201,37,169,2,16,88,8,240,178,0,153,104,17,142,160,49,11,40,57,66,41,175,135,161,168,26,
+128,18,160,15,130,161,28,80,0,59,91,0,161,160,47,153,212,130,132,184,129,9,147,40,169,3,97,158,34,18,31,140,
+16,163,33,140,16,168,12,2,151,8,42,76,40,8,44,42,11,170,121,129,9,217,4,153,243,18,57,186,136,21,26,154,
+43,34,79,168,32,18,156,177,133,8,75,60,160,51,15,16,42,12,123,0,138,25,43,195,129,108,40,9,12,34,177,162,
+30,58,128,192,10,34,192,32,95,16,9,144,162,33,141,40,169,248,129,148,209,144,24,18,44,176,7,128,186,1,7,137,
+153,160,165,148,152,131,192,161,123,147,58,10,138,179,211,57,123,200,161,88,136,145,57,63,176,130,64,177,136,185,120,192,
+132,9,136,24,240,164,179,197,145,17,136,144,152,3,203,56,195,243,145,211,147,0,176,164,149,0,192,5,26,43,40,120,
+140,144,16,241,144,130,147,136,177,130,211,165,209,56,153,19,78,136,145,136,65,139,10,105,8,217,164,33,139,16,26,148,
+160,199,162,8,25,42,161,26,179,213,132,57,63,25,176,17,137,165,161,145,44,16,160,0,121,192,2,48,28,56,141,96,
+27,186,166,131,184,90,25,133,8,137,65,0,89,59,142,177,26,90,137,40,14,137,242,136,24,25,44,10,16,26,226,18,
+104,196,70,0,106,41,76,137,130,41,8,72,32,9,148,49,42,10,124,209,130,1,160,40,156,9,131,248,149,25,129,152,
+132,12,211,144,34,58,15,128,17,11,48,249,16,27,178,1,133,28,153,242,147,129,1,40,45,15,144,145,9,146,1,11,
+56,234,150,41,123,57,153,129,10,162,153,161,79,24,160,1,162,0,1,79,46,8,145,56,185,1,74,91,27,178,132,10,
+21,61,74,29,136,130,17,76,137,161,32,138,29,162,106,44,128,162,56,13,25,80,73,58,209,41,13,0,153,56,92,169,
+130,208,17,153,17,108,56,26,27,76,13,145,9,72,43,25,123,59,26,162,1,44,146,162,177,31,28,32,90,58,44,41,
+60,9,27,130,123,137,132,194,18,41,171,0,177,26,0,9,159,184,7,224,16,43,5,24,88,11,9,200,162,161,35,160,
+61,201,133,137,145,90,40,35,154,152,143,154,240,161,167,164,128,9,129,144,165,136,56,72,9,9,208,162,17,146,212,181,
+25,194,146,200,180,32,145,88,59,57,149,153,136,45,139,244,178,162,4,24,154,196,146,197,33,0,16,128,139,29,26,133,
+201,197,17,136,137,145,193,164,195,148,24,145,144,43,136,150,209,195,128,32,73,178,210,181,180,144,162,145,242,146,147,193,
+129,9,27,129,213,179,146,56,144,8,151,183,180,129,144,8,153,242,161,130,0,44,90,26,136,2,24,177,211,210,162,50,
+193,244,180,131,152,57,75,42,60,42,25,57,75,202,16,32,240,212,179,130,184,34,72,73,59,14,129,40,138,43,74,32,
+12,171,145,146,194,213,164,130,144,140,50,65,145,60,75,76,28,61,28,144,146,177,165,179,147,92,41,8,152,8,12,89,
+57,61,153,18,194,89,44,152,144,24,1,169,17,89,140,33,8,63,153,132,200,88,75,57,45,26,26,144,164,168,161,5,
+152,30,136,74,89,76,44,136,0,144,58,106,89,136,8,145,176,25,154,155,124,24,60,9,163,40,92,91,41,26,26,138,
+129,210,133,136,2,128,140,56,30,26,73,60,30,41,184,56,25,17,200,180,212,162,145,105,72,44,25,73,75,11,168,17,
+49,61,155,136,171,5,8,128,57,144,232,144,23,25,65,10,145,60,169,202,107,40,138,16,24,226,209,167,33,169,16,217,
+146,40,43,106,74,1,69,0,9,80,139,130,42,138,177,182,17,141,32,184,120,136,197,164,1,10,25,137,41,17,186,6,
+62,26,144,227,179,165,195,128,0,11,195,3,8,128,57,12,3,243,3,24,144,229,145,161,27,192,130,195,243,2,153,0,
+16,49,77,27,200,130,57,44,161,115,25,227,196,130,44,137,129,128,25,154,1,124,41,160,180,163,137,144,225,4,8,162,
+194,80,59,10,137,0,194,241,147,29,16,168,166,162,130,176,41,160,10,211,98,0,11,181,195,195,8,18,44,168,146,42,
+161,50,139,22,9,175,42,41,1,4,89,130,200,151,25,59,77,144,184,162,209,5,9,16,193,134,27,138,145,129,61,9,
+147,136,42,180,242,8,105,160,40,43,63,42,161,18,108,26,138,2,153,196,195,18,74,45,24,43,188,132,165,16,43,152,
+16,145,145,79,41,58,31,42,161,129,153,99,168,3,137,200,144,49,139,61,141,0,163,58,58,145,167,75,137,121,26,153,
+120,24,139,18,128,75,10,180,43,128,216,128,76,26,33,144,194,137,195,22,28,184,135,0,74,74,154,136,2,226,2,152,
+92,10,128,128,16,26,175,32,61,129,185,129,151,130,16,42,141,56,17,48,143,24,138,40,178,67,243,144,242,146,145,136,
+27,33,3,161,180,148,184,33,242,17,242,0,154,35,57,60,136,169,199,129,161,161,57,25,164,73,44,47,43,128,211,146,
+144,74,62,152,131,32,177,31,136,129,17,208,165,163,162,179,167,9,41,26,42,123,60,140,129,148,161,194,162,130,24,152,
+181,58,136,65,9,23,26,157,17,176,133,186,229,145,129,145,145,145,10,76,75,24,26,136,2,183,20,11,201,3,130,147,
+248,0,24,45,24,8,24,44,140,128,96,58,240,179,2,48,177,144,44,58,178,167,129,76,140,89,41,75,200,147,8,13,
+193,144,18,26,227,4,57,60,44,25,73,61,152,8,9,43,193,19,0,27,248,51,90,46,9,137,34,92,192,0,40,73,
+153,200,146,160,17,129,123,24,138,128,160,120,136,160,196,50,75,90,142,58,42,161,162,168,146,153,23,25,107,27,41,44,
+60,44,11,16,0,167,131,146,29,2,64,12,42,12,161,42,243,129,179,129,193,194,35,11,108,58,57,61,2,217,16,145,
+145,152,185,180,228,162,26,88,193,0,67,0,42,75,154,160,19,138,0,216,164,81,148,155,3,40,57,30,24,154,17,244,
+34,16,12,225,136,137,176,193,7,10,17,51,45,26,137,4,88,12,193,178,145,169,132,210,129,160,148,18,31,138,24,88,
+56,128,217,145,1,225,130,61,43,136,179,89,137,163,179,35,139,247,162,16,0,10,120,26,184,16,24,162,169,167,44,32,
+136,72,9,88,168,75,11,140,208,3,177,132,135,130,43,24,11,58,63,9,30,168,194,147,146,56,157,113,11,17,140,19,
+13,50,160,17,153,25,209,121,138,59,153,105,44,25,0,32,156,149,210,17,11,146,25,114,128,27,137,125,137,129,169,33,
+25,57,128,43,185,242,162,45,26,28,129,76,57,133,145,40,137,2,152,161,173,228,180,128,130,179,183,25,42,139,145,9,
+226,132,135,130,9,192,179,145,146,185,179,163,60,28,19,104,42,139,167,145,56,139,157,40,116,10,152,26,26,56,153,194,
+124,138,16,1,56,91,29,11,16,136,12,226,16,67,4,137,9,25,11,0,139,29,58,143,35,26,136,182,184,131,163,192,
+240,182,56,21,9,27,57,153,163,208,200,24,241,25,146,163,210,148,152,3,200,40,9,14,97,1,136,144,163,29,162,163,
+129,209,178,80,128,28,168,145,11,109,12,74,9,155,23,129,129,74,136,57,58,171,162,209,156,112,178,16,153,138,137,72,
+62,139,8,61,54,26,137,1,218,146,166,145,9,140,129,65,177,144,21,139,2,249,131,138,154,144,71,184,3,209,16,58,
+162,153,24,140,100,137,26,128,42,14,129,139,57,172,33,99,22,139,72,169,106,9,9,176,91,15,130,161,41,1,201,132,
+59,153,162,244,17,33,195,129,88,140,161,195,0,184,193,33,32,184,128,135,137,196,195,181,16,139,129,6,137,24,193,17,
+72,160,242,128,137,2,177,179,78,169,136,146,26,241,152,33,99,146,192,81,11,1,168,163,168,241,0,64,137,153,147,75,
+139,177,210,24,43,114,83,10,41,145,42,72,185,153,31,25,32,152,225,48,161,120,28,27,193,160,176,113,16,138,146,148,
+137,18,29,162,91,153,40,197,16,11,184,56,26,90,188,166,56,112,137,24,74,136,24,162,128,235,163,209,82,27,8,25,
+44,40,29,176,12,33,82,2,26,130,161,61,1,14,58,0,72,10,142,29,10,57,193,162,200,6,24,128,152,249,2,152,
+20,27,48,108,176,4,178,145,169,18,15,128,210,144,24,8,56,44,154,202,151,18,49,29,179,20,139,180,196,2,12,161,
+136,89,43,218,150,9,9,128,208,64,10,128,181,34,136,180,25,122,9,185,19,13,179,145,164,91,160,162,16,12,201,165,
+144,129,180,23,113,43,2,159,170,18,56,60,24,77,161,4,171,160,225,0,114,42,24,169,18,202,146,148,57,159,33,139,
+130,209,150,152,16,168,17,88,160,144,57,10,25,41,92,178,135,136,48,219,137,192,33,154,149,161,69,28,42,160,73,11,
+88,26,137,129,26,24,181,2,19,15,8,200,75,92,137,24,26,177,121,41,11,133,25,25,177,96,10,11,201,5,155,32,
+121,137,32,25,217,33,9,152,25,34,130,13,90,60,169,181,18,128,169,169,27,125,161,16,16,104,184,41,129,144,180,120,
+11,10,15,145,9,131,130,26,130,63,1,144,63,10,57,146,0,150,155,49,12,8,73,141,105,224,32,9,24,10,80,9,
+8,162,201,3,137,3,65,10,63,176,10,149,10,178,48,221,132,147,169,17,228,33,160,137,185,50,45,73,166,176,147,57,
+186,132,200,16,240,16,121,137,40,57,138,2,195,74,29,193,0,73,137,75,163,44,144,9,89,61,138,32,166,1,9,57,
+28,153,177,73,49,8,139,217,131,124,139,45,184,133,24,162,45,73,58,192,131,24,90,168,33,9,42,176,18,176,175,177,
+114,45,10,1,27,193,76,73,130,136,33,120,169,129,41,14,137,0,2,200,180,72,155,242,180,145,16,93,10,129,130,73,
+91,10,210,1,138,129,177,130,163,200,48,58,235,74,178,19,27,40,161,7,168,3,179,12,3,15,17,25,159,5,160,144,
+8,208,209,162,165,129,179,131,88,161,178,164,106,138,161,8,1,174,130,89,152,169,163,152,144,0,201,84,160,97,164,145,
+132,10,8,123,144,140,128,136,90,137,170,104,193,148,162,144,0,48,140,73,34,176,113,154,57,185,212,160,167,163,129,9,
+152,146,155,185,8,124,123,137,128,129,132,10,19,29,0,9,177,120,139,41,152,137,9,149,40,248,132,12,132,44,136,33,
+177,4,185,150,2,177,184,160,180,29,16,75,74,26,154,144,121,244,59,0,180,72,240,146,4,18,10,63,138,40,10,170,
+124,136,16,160,145,80,11,60,172,3,58,109,27,73,32,8,8,44,122,10,162,10,162,64,28,145,154,137,0,8,96,203,
+144,198,130,17,164,181,148,129,152,165,138,10,185,149,161,169,226,164,1,9,0,152,33,12,56,97,53,168,200,64,60,169,
+48,8,124,153,136,27,75,59,200,132,168,161,42,93,24,64,132,1,41,209,226,144,146,168,131,152,149,139,152,226,178,164,
+9,187,5,130,65,183,147,0,46,8,193,146,136,9,8,144,49,143,178,2,33,160,78,26,72,28,153,52,60,76,58,24,
+185,147,139,195,177,210,25,73,9,132,41,155,29,63,48,168,196,132,3,12,164,226,144,25,26,178,146,144,32,31,43,56,
+235,146,106,91,24,144,164,4,136,58,30,177,160,146,123,57,139,194,129,75,8,244,0,0,144,40,11,16,148,134,91,9,
+176,179,136,160,51,169,46,144,210,136,176,226,144,129,109,145,161,130,50,160,4,58,232,32,155,91,137,243,1,200,32,0,
+169,32,140,41,19,18,240,132,34,107,59,8,140,184,168,23,26,160,28,129,98,10,208,136,178,56,214,146,26,1,128,165,
+129,209,195,1,73,58,154,193,192,163,149,10,105,29,8,56,160,0,27,65,89,144,56,15,144,161,21,11,137,176,2,122,
+209,162,25,11,161,151,162,48,107,145,16,153,193,177,194,96,138,1,141,42,137,151,145,8,137,136,72,28,225,147,32,16,
+180,4,10,9,200,23,58,12,169,144,73,139,243,130,9,26,151,130,9,176,132,80,123,10,136,129,8,194,146,9,153,218,
+167,16,10,10,152,3,145,40,30,128,5,2,196,41,9,11,129,182,41,241,17,43,180,130,8,194,72,34,168,199,167,8,
+152,194,146,144,195,128,75,14,8,26,184,17,28,42,152,136,17,214,131,144,133,132,49,40,45,24,160,150,129,136,161,8,
+163,183,2,44,138,24,137,133,13,160,16,16,146,176,69,47,26,42,194,148,43,10,56,56,60,192,160,162,168,81,143,24,
+65,137,20,140,160,210,160,35,13,138,13,136,58,153,194,160,162,146,7,152,138,51,37,151,161,136,107,26,153,130,169,42,
+12,129,152,243,32,79,75,43,136,56,78,25,1,16,41,75,144,0,75,18,86,24,60,0,216,181,1,57,42,43,186,105,
+138,141,210,40,8,130,166,195,148,16,176,130,32,2,28,15,58,29,41,26,11,193,228,40,57,44,43,25,20,8,72,14,
+152,144,75,57,14,26,128,176,33,90,107,12,177,0,104,10,0,3,146,33,49,63,13,128,128,180,44,43,180,145,19,47,
+58,154,249,129,48,26,106,128,148,178,148,24,138,160,56,186,50,189,193,45,72,32,27,235,161,33,92,27,49,131,122,42,
+8,243,177,128,72,44,26,184,144,16,77,9,160,176,152,66,123,8,132,163,106,10,41,138,10,195,147,225,129,16,137,123,
+63,26,9,168,41,128,88,57,80,195,1,130,57,144,156,0,47,9,200,213,129,0,129,152,200,179,144,130,91,21,129,195,
+58,27,243,227,161,1,40,152,138,32,28,56,44,164,224,129,9,120,128,146,128,132,1,42,172,168,40,73,27,42,242,146,
+185,37,43,248,185,16,122,91,128,2,145,24,136,50,249,243,128,128,128,154,194,24,8,16,106,58,29,168,162,133,34,131,
+161,195,197,162,144,128,200,72,31,42,9,177,105,41,128,209,193,130,3,25,165,165,180,33,46,9,144,8,8,137,152,131,
+203,227,146,129,137,248,193,161,149,56,146,65,26,19,11,19,143,154,132,152,58,234,227,148,0,43,9,12,56,123,160,97,
+25,16,136,128,61,169,145,144,65,15,0,9,160,32,147,120,139,139,210,20,59,74,8,130,89,15,8,160,162,225,148,25,
+24,138,144,20,31,8,8,26,32,11,133,20,130,128,58,63,136,242,144,32,26,170,163,153,1,167,0,8,31,27,88,42,
+128,6,161,2,169,16,9,241,160,163,93,27,153,43,49,43,225,194,152,35,32,58,62,131,40,74,42,46,136,58,57,146,
+158,59,47,107,25,27,153,177,178,114,41,27,5,131,146,74,29,8,29,25,16,139,185,184,243,5,168,145,243,129,40,58,
+168,163,6,128,167,8,9,43,226,18,10,169,180,152,72,184,150,129,153,160,148,33,76,25,66,73,25,13,211,58,9,146,
+32,154,169,243,20,14,136,8,154,133,57,17,79,137,147,163,146,137,170,57,40,142,169,201,138,49,88,73,26,158,162,149,
+88,136,8,3,55,160,152,139,154,52,27,26,203,154,11,183,8,136,56,29,99,138,17,136,53,255,55,0,30,23,32,169,
+152,225,163,19,186,32,12,184,90,185,25,44,31,8,145,146,210,180,20,99,10,184,0,1,122,10,10,90,10,9,145,185,
+165,129,170,21,216,19,58,12,112,17,160,152,40,45,163,240,162,0,140,19,218,147,32,9,75,128,40,27,171,122,21,152,
+144,154,137,133,145,27,130,240,107,178,200,162,10,73,48,152,16,147,30,114,16,56,139,186,131,151,226,128,160,11,80,138,
+58,210,8,91,145,129,145,60,57,55,17,153,187,242,36,12,9,136,169,78,137,168,130,200,33,133,9,137,144,160,113,163,
+130,133,76,25,145,160,1,27,251,50,219,147,201,145,123,8,136,24,0,24,23,9,17,156,182,50,138,168,145,137,47,16,
+141,145,26,46,34,140,136,144,168,23,0,48,177,153,122,0,168,57,29,187,52,136,59,26,158,17,167,145,9,8,171,55,
+137,17,195,160,120,8,136,1,192,46,146,75,11,200,226,50,10,153,130,145,122,161,149,32,10,27,134,137,139,208,161,124,
+8,184,147,0,41,160,177,123,129,161,51,73,74,184,168,94,128,177,2,169,13,16,184,225,4,42,121,25,10,9,152,16,
+34,57,9,150,75,57,64,155,16,237,128,177,194,88,153,10,144,243,16,128,73,58,148,148,8,168,180,151,2,201,180,152,
+17,136,11,107,77,153,161,194,0,129,72,9,6,146,178,9,11,67,44,26,91,28,106,11,152,227,146,9,16,130,171,131,
+43,75,195,146,56,5,147,134,43,220,147,42,12,25,147,74,241,136,193,150,136,180,163,122,8,40,26,107,138,146,195,137,
+164,160,145,26,160,131,178,30,48,129,125,41,169,163,167,146,193,19,45,58,28,139,162,216,130,148,41,139,164,25,147,144,
+31,18,209,135,16,9,56,154,41,168,161,0,3,252,32,153,44,154,196,28,150,145,1,17,154,83,73,153,1,243,57,192,
+129,152,212,169,131,136,8,133,156,144,147,64,107,168,193,7,8,161,0,138,73,153,149,57,248,128,146,48,13,146,28,146,
+42,169,4,138,57,23,2,90,155,184,133,32,152,144,13,74,42,28,11,243,176,133,0,91,26,9,65,72,153,136,210,16,
+42,76,137,145,232,129,144,105,60,137,136,17,2,153,215,1,40,48,169,161,60,154,51,62,28,139,245,17,211,0,72,0,
+24,9,144,193,8,163,164,64,60,60,57,131,27,248,162,152,35,12,227,144,184,73,41,41,28,11,73,132,106,28,136,32,
+115,9,128,152,25,10,0,93,138,137,216,18,24,25,46,45,56,8,178,8,128,34,135,178,181,225,129,57,136,136,137,27,
+138,167,177,194,128,227,2,192,164,152,148,120,144,33,185,178,144,164,104,28,25,140,1,146,147,168,62,10,88,137,58,76,
+16,112,9,80,13,24,11,179,146,160,152,59,58,11,176,121,59,78,25,40,192,147,195,7,161,144,138,129,137,183,178,136,
+137,73,243,129,160,40,176,80,8,26,180,112,73,0,24,169,90,185,35,15,136,42,193,121,154,128,225,3,42,128,16,27,
+56,136,135,34,11,168,197,1,10,233,194,146,144,178,196,24,75,169,18,178,96,154,166,56,49,91,12,90,27,130,160,128,
+25,139,108,169,147,154,18,31,16,40,187,33,8,86,24,226,162,180,16,209,129,152,122,155,130,57,140,144,162,82,41,185,
+209,2,24,6,56,14,136,195,34,43,12,171,197,145,164,24,10,49,58,18,79,154,74,169,37,8,211,24,168,64,169,18,
+13,42,60,8,57,188,152,179,23,144,196,192,131,32,1,89,12,56,216,151,136,161,176,227,0,8,152,136,24,2,167,16,
+59,47,128,2,148,147,168,17,92,43,60,28,26,28,161,144,226,40,106,41,138,180,144,24,34,76,16,178,128,40,57,241,
+198,177,177,131,9,25,157,185,6,56,169,243,194,148,32,41,89,138,161,20,43,75,169,26,91,75,10,192,169,163,22,42,
+107,45,25,57,10,18,193,180,18,176,149,137,138,140,34,45,139,245,146,18,137,177,211,129,32,152,64,59,43,193,21,11,
+232,182,162,1,137,128,60,47,75,41,25,152,226,148,32,43,41,161,1,96,9,58,14,24,138,17,44,139,200,179,6,152,
+210,130,152,80,42,72,26,164,16,1,136,251,145,27,194,1,171,29,12,72,48,24,186,243,17,122,25,152,40,106,56,128,
+0,30,27,9,2,10,241,177,153,22,138,179,8,42,57,180,120,28,16,145,135,146,225,162,152,17,184,146,46,11,56,161,
+147,224,195,1,49,138,164,91,93,57,136,8,45,44,10,2,240,162,179,0,65,27,33,29,61,76,136,24,128,8,145,39,
+115,36,68,0,160,147,1,122,123,138,43,29,138,178,130,210,210,194,128,129,145,26,184,16,65,106,138,152,8,90,40,178,
+135,136,1,80,16,32,152,195,3,34,180,165,73,60,40,178,25,142,192,8,75,156,227,194,145,146,163,148,26,9,72,16,
+27,195,197,51,56,169,195,128,136,26,179,159,140,169,16,152,185,0,15,138,3,211,18,12,131,81,146,178,160,107,143,148,
+152,136,155,176,19,81,200,176,177,176,23,148,59,107,16,1,48,44,171,199,0,3,153,162,144,58,124,17,144,58,11,123,
+32,144,42,24,8,55,168,128,192,26,123,41,140,27,45,154,134,0,42,41,168,48,1,30,201,134,24,24,144,26,26,249,
+32,42,14,152,41,47,8,144,160,145,241,18,19,13,89,8,74,25,138,26,10,184,44,209,177,165,161,40,20,137,96,153,
+26,121,56,168,135,179,130,18,209,8,9,152,49,12,157,160,242,136,131,193,34,136,28,51,138,79,24,0,40,80,31,136,
+152,153,2,232,17,11,42,43,151,59,12,162,136,23,28,24,17,25,24,193,208,4,153,176,132,241,146,162,162,123,25,59,
+152,8,44,163,9,166,4,192,131,24,168,121,10,62,9,136,25,145,136,72,73,12,33,170,152,8,104,65,161,208,48,176,
+130,176,143,42,145,161,62,185,242,133,16,9,178,149,74,8,0,64,10,12,163,57,141,212,144,8,1,156,4,10,9,120,
+42,42,10,160,107,146,2,36,41,173,166,136,41,43,45,93,27,169,146,144,137,151,129,57,144,232,3,56,107,129,152,144,
+148,195,145,152,186,48,138,78,41,232,144,149,144,162,146,144,50,129,36,121,45,43,8,144,88,155,216,19,138,128,145,187,
+112,2,155,73,15,169,6,0,32,24,154,121,144,136,144,27,240,131,136,136,9,243,64,9,0,10,8,93,195,18,24,193,
+176,20,26,202,130,27,63,9,176,73,45,137,148,130,42,161,167,123,9,1,2,26,14,129,144,137,177,240,33,91,138,128,
+145,25,162,227,130,9,160,151,131,50,16,155,77,72,28,138,193,169,165,178,177,64,10,73,180,16,63,28,41,72,25,179,
+167,160,33,136,170,57,43,47,177,41,15,0,176,150,0,169,166,129,89,26,128,49,153,138,149,161,59,138,242,2,24,14,
+40,0,79,9,251,254,69,0,160,161,17,29,130,18,41,64,153,73,48,175,24,162,12,145,241,195,2,153,104,8,10,0,
+136,75,73,43,1,181,226,3,137,169,161,136,122,25,168,42,107,43,5,169,129,177,183,18,25,40,128,16,95,25,138,27,
+43,9,147,30,28,161,163,112,57,171,136,89,90,129,129,40,0,227,132,137,186,228,129,33,157,224,129,0,24,17,145,11,
+168,180,5,90,136,133,131,64,59,188,8,154,32,178,186,191,129,28,5,81,184,25,168,23,152,184,16,7,41,152,145,178,
+2,31,25,25,138,30,153,147,3,178,249,210,72,41,10,146,112,152,3,129,75,141,184,3,33,171,172,131,40,18,48,10,
+15,184,7,211,16,28,132,80,9,136,26,139,77,144,146,172,176,211,34,58,164,165,25,77,24,137,42,90,56,147,138,13,
+139,213,49,10,200,160,41,106,56,184,18,13,8,5,137,193,57,19,120,129,144,41,13,11,131,186,235,153,162,23,152,128,
+26,121,75,128,136,41,40,80,34,169,241,145,184,131,243,184,144,8,9,18,45,121,153,163,130,17,140,25,74,113,1,41,
+43,139,90,105,139,185,193,32,1,244,161,56,11,130,179,123,44,145,81,57,136,200,165,42,25,211,226,41,139,2,17,25,
+27,129,35,14,44,240,145,24,132,5,184,91,203,241,71,140,164,129,153,160,27,35,137,179,10,7,163,176,25,47,26,19,
+182,2,25,11,176,168,50,248,160,95,10,40,25,88,201,1,136,40,89,16,138,74,12,129,168,32,9,8,176,160,135,235,
+1,60,8,161,32,81,193,32,8,64,58,26,122,43,61,29,44,41,42,124,138,162,136,2,45,163,136,40,45,169,22,58,
+58,177,16,217,4,160,10,204,211,146,17,61,161,162,3,192,209,4,25,152,34,144,130,178,183,177,179,40,13,139,172,228,
+4,9,146,194,49,41,47,0,24,146,105,168,209,0,139,50,192,177,129,219,146,65,8,25,229,72,24,9,65,160,42,192,
+42,184,243,163,2,24,143,160,128,8,2,121,40,153,243,33,24,57,187,149,17,44,1,12,130,141,160,182,56,152,187,167,
+32,128,160,128,49,31,164,2,59,141,17,18,24,178,240,26,59,224,194,80,138,73,25,24,160,168,84,27,27,176,81,10,
+45,16,164,33,172,122,42,25,161,12,70,0,153,178,129,136,45,161,121,59,57,240,17,58,163,41,31,136,33,153,144,241,
+163,179,42,72,185,16,163,40,151,169,2,61,242,161,17,170,3,17,123,169,4,27,169,181,195,133,152,57,192,149,160,163,
+24,161,11,123,152,16,155,133,128,195,0,179,120,45,24,27,179,8,227,131,43,240,1,197,24,128,145,42,56,61,145,60,
+12,177,167,161,144,179,144,4,59,182,73,28,73,137,130,128,242,0,1,25,40,62,138,42,192,150,160,132,154,180,56,176,
+2,42,107,11,25,64,201,25,149,196,131,33,142,146,145,154,160,48,76,155,145,128,51,31,208,164,16,96,170,163,20,168,
+17,224,107,153,148,32,11,63,154,18,10,163,145,1,59,129,62,44,160,242,6,9,0,137,25,76,160,41,11,107,154,50,
+91,24,41,143,40,170,133,25,42,16,167,129,27,42,186,133,138,88,128,145,80,169,42,180,60,29,132,160,145,42,192,37,
+76,27,145,211,162,128,24,73,31,139,164,163,56,25,168,88,16,140,198,40,42,146,161,146,123,12,160,128,161,17,137,123,
+129,178,163,65,15,136,136,128,18,59,96,33,186,128,201,42,151,145,128,27,15,72,152,0,211,162,59,193,17,42,196,162,
+135,8,8,129,161,93,152,90,60,12,26,128,148,128,181,169,24,1,90,161,57,63,1,9,44,76,137,2,130,232,165,161,
+90,168,194,148,0,138,129,162,129,208,161,88,64,60,42,123,44,26,8,8,42,201,165,180,162,194,195,1,48,30,25,57,
+27,80,144,44,8,216,16,178,40,145,24,44,82,13,192,162,16,91,146,74,75,10,91,2,136,136,59,250,19,224,161,146,
+194,72,9,9,58,89,154,16,192,194,196,179,52,210,181,162,8,41,162,144,12,60,140,152,132,227,211,180,129,146,178,149,
+25,60,3,146,9,28,194,2,25,220,196,179,16,128,57,177,62,137,3,129,155,32,245,65,152,161,160,19,110,137,8,43,
+136,43,161,195,146,147,139,112,160,240,180,74,76,40,160,1,26,41,106,138,152,195,161,123,144,177,167,128,41,16,9,10,
+184,8,120,17,42,176,178,32,144,202,182,136,184,135,176,145,75,154,100,168,16,90,44,106,26,177,162,176,10,182,197,146,
+128,26,56,25,59,129,45,109,58,184,148,9,241,251,66,0,9,19,244,146,129,137,89,25,10,195,162,63,8,137,161,33,
+47,40,9,168,150,193,2,41,169,165,24,9,88,168,144,25,139,81,176,138,164,8,123,145,160,194,178,44,50,154,151,167,
+128,146,176,194,32,63,75,57,138,0,192,161,4,224,211,163,24,106,138,1,73,43,44,160,1,26,165,153,150,144,193,164,
+58,106,42,153,17,26,26,8,177,25,245,164,17,128,138,228,145,57,0,137,137,19,27,21,63,44,41,10,104,46,136,144,
+179,129,227,147,0,226,130,146,1,24,73,160,7,48,143,9,137,107,153,129,10,43,248,130,152,177,25,141,16,128,162,9,
+0,18,115,136,133,64,136,5,32,129,2,5,25,133,144,137,195,43,129,123,30,137,57,10,40,46,10,242,146,161,178,16,
+136,128,6,57,61,46,177,1,145,8,10,163,225,163,180,64,45,184,179,3,59,30,177,144,147,216,147,41,173,165,165,26,
+27,212,146,132,160,145,146,63,25,41,59,45,136,145,56,11,201,231,145,162,162,131,74,11,88,89,43,137,227,130,0,8,
+152,130,213,149,162,24,9,153,130,130,212,129,161,58,50,58,93,57,44,128,56,240,145,2,136,19,161,107,47,44,42,41,
+28,9,26,25,33,172,42,162,226,148,148,137,75,44,168,19,200,18,12,219,1,144,58,143,194,32,161,148,11,180,200,151,
+2,59,92,59,58,8,145,128,24,156,149,147,26,13,162,33,40,28,160,127,27,145,164,0,41,152,49,120,43,140,24,137,
+164,212,161,0,192,166,128,8,41,43,28,41,160,64,106,169,131,211,16,200,180,0,89,25,45,72,11,8,16,91,44,144,
+57,26,45,153,2,136,181,183,162,64,152,194,2,139,60,16,44,120,9,160,41,224,181,164,128,161,180,161,50,29,168,129,
+10,64,137,153,8,225,0,162,4,169,135,57,89,26,76,136,0,9,148,25,232,129,171,83,43,90,10,152,120,137,16,60,
+136,42,16,31,32,9,146,27,242,164,24,233,145,163,58,24,160,152,95,154,163,18,61,137,179,82,76,152,56,59,76,176,
+196,40,26,194,16,40,155,8,177,120,59,227,128,16,25,73,243,178,195,128,48,184,194,58,8,144,121,160,200,150,40,73,
+192,195,40,11,160,131,3,41,73,108,61,192,179,89,28,136,151,247,66,0,194,3,77,137,16,25,128,170,165,123,25,128,
+177,2,45,146,144,193,0,177,121,61,168,130,136,74,59,160,49,14,179,40,211,34,200,34,47,160,0,193,73,30,73,42,
+136,168,162,80,9,178,177,193,16,131,33,121,26,139,122,25,177,229,1,42,59,176,147,74,30,130,16,9,137,241,147,147,
+176,135,9,58,25,168,1,29,137,58,196,40,233,179,58,167,24,26,75,11,166,147,32,8,232,130,128,42,24,41,31,104,
+27,58,155,243,148,164,8,160,8,60,41,27,134,72,139,1,209,129,168,197,162,131,58,138,8,62,16,177,180,128,203,183,
+166,32,137,193,129,65,28,160,129,44,58,145,0,63,171,35,18,27,216,146,121,58,176,132,57,31,8,130,44,153,176,147,
+52,249,211,16,43,32,210,17,29,136,128,18,25,177,183,57,24,211,128,75,30,161,147,43,153,211,163,98,201,165,24,43,
+8,196,18,59,225,147,130,26,232,146,57,9,213,130,42,12,162,133,42,169,196,1,32,10,196,18,45,136,178,147,61,186,
+149,146,162,153,225,72,90,24,10,185,0,129,146,32,179,146,113,3,47,44,31,8,17,136,8,169,208,50,161,49,154,13,
+56,227,163,72,154,130,134,128,90,171,136,34,137,216,165,12,0,147,214,131,138,8,0,57,78,160,17,90,41,13,195,160,
+146,181,129,40,201,0,1,128,57,200,62,91,24,160,35,12,32,88,200,2,233,178,3,128,25,27,236,2,3,9,40,142,
+26,146,165,162,21,45,146,0,42,26,159,16,32,161,208,243,59,26,1,145,149,26,40,108,60,43,160,35,129,130,185,180,
+45,147,27,130,79,172,34,44,41,28,244,130,144,16,160,72,44,163,129,88,27,248,1,0,26,226,163,58,8,184,182,146,
+152,150,25,90,27,8,108,144,128,176,20,62,170,3,176,165,176,226,50,75,211,161,128,145,179,75,46,32,184,131,121,169,
+182,73,137,128,209,162,179,8,181,51,13,152,104,90,42,8,145,136,17,137,51,111,186,178,80,28,184,33,140,153,184,180,
+41,47,57,10,24,29,162,128,164,129,149,146,163,33,135,1,92,152,130,177,133,152,33,41,65,156,211,17,140,128,8,227,
+147,9,228,2,42,140,17,29,32,76,25,42,26,144,196,164,25,137,9,16,192,11,64,0,180,0,43,153,123,57,186,130,
+157,24,60,16,26,10,47,151,144,192,32,203,3,0,34,185,56,95,137,162,154,0,28,130,108,9,8,152,113,152,179,73,
+137,9,182,128,19,45,128,17,73,156,1,8,122,152,35,194,73,186,135,161,161,177,160,5,152,56,45,10,62,89,137,26,
+152,10,164,164,164,153,162,67,40,15,59,43,91,170,48,178,88,31,40,9,137,10,219,5,128,145,59,16,122,26,162,184,
+151,153,147,163,2,65,30,161,66,233,128,136,24,24,153,166,1,144,177,7,168,24,27,41,44,9,60,131,4,139,167,136,
+169,227,16,12,17,146,10,120,92,192,8,128,145,178,40,64,57,145,10,111,169,179,184,65,28,179,33,155,72,41,1,143,
+145,195,1,209,131,18,92,26,27,145,28,192,180,4,30,1,8,161,64,28,210,48,156,0,210,132,44,128,18,9,32,140,
+164,208,163,128,74,34,161,89,44,166,139,152,24,66,31,152,130,129,133,63,9,153,178,129,168,147,44,19,107,168,64,170,
+162,149,2,31,26,25,8,2,210,5,27,62,28,161,152,146,4,179,149,137,162,26,106,47,137,33,10,136,72,210,162,194,
+194,145,32,153,89,59,32,123,137,129,176,10,137,133,9,80,62,0,146,161,168,241,1,27,168,128,163,53,186,134,17,95,
+139,145,16,176,145,146,181,130,166,179,16,30,139,40,153,144,80,34,88,60,153,180,176,128,12,41,28,18,44,113,57,154,
+24,154,153,131,31,45,81,25,152,16,128,184,15,9,129,24,89,20,41,128,93,43,176,28,10,74,171,18,17,183,149,146,
+41,154,58,31,76,60,40,24,145,195,162,8,143,74,10,161,40,19,51,185,56,142,147,142,0,46,137,16,90,106,40,41,
+28,152,152,225,32,13,1,18,17,137,16,40,143,31,8,8,59,58,17,5,42,155,164,195,129,173,196,168,72,49,129,33,
+45,59,11,1,47,171,145,50,51,139,167,179,209,138,240,131,186,40,68,18,72,154,40,186,17,236,129,43,248,34,18,40,
+244,128,168,162,129,193,59,154,23,146,16,242,162,16,11,169,183,57,11,135,130,162,25,225,1,139,8,216,162,73,2,132,
+178,89,12,211,145,8,168,242,18,17,90,8,9,170,136,243,146,11,144,99,130,8,144,228,125,0,72,0,129,128,43,192,
+0,11,124,0,129,24,210,128,177,2,45,154,41,48,33,210,5,12,43,26,58,62,12,144,37,131,91,169,129,137,9,128,
+233,28,45,97,128,16,12,176,17,145,41,218,226,162,67,0,163,152,219,41,40,32,159,42,33,38,0,208,128,184,24,25,
+184,240,209,48,51,64,200,136,168,160,5,136,15,144,120,40,24,152,169,58,45,145,160,59,204,22,19,24,139,211,152,60,
+177,184,140,93,88,1,40,28,137,136,32,30,153,178,128,83,179,147,27,12,14,2,153,47,137,49,67,24,227,129,184,0,
+9,28,28,15,32,66,8,25,185,160,129,160,172,164,243,49,2,18,241,8,31,16,152,41,144,15,132,2,128,128,185,168,
+16,241,130,217,144,52,131,48,141,26,73,24,13,144,201,161,7,3,161,192,152,25,0,156,185,57,121,20,32,144,242,128,
+25,0,140,227,184,34,36,177,146,155,180,33,242,42,11,155,18,39,147,243,153,128,1,225,163,128,92,0,164,0,145,136,
+225,146,137,178,233,33,108,145,129,160,24,42,214,128,128,184,130,81,16,43,74,31,58,137,177,16,29,131,1,179,82,233,
+0,74,10,9,201,58,76,133,1,26,26,128,212,176,145,152,134,75,17,146,9,152,63,153,8,152,28,0,121,18,168,147,
+170,133,176,210,152,30,137,49,36,25,154,123,73,137,152,185,138,76,131,7,26,168,42,17,41,14,12,56,59,112,178,80,
+138,106,168,145,144,139,241,1,2,163,179,43,121,153,211,8,137,9,212,134,129,160,152,129,40,152,161,11,94,160,135,41,
+137,9,131,154,8,15,25,42,33,131,120,27,122,176,0,152,90,170,1,129,148,130,43,45,196,128,138,75,42,176,5,147,
+5,11,120,217,130,168,136,137,56,51,44,199,0,2,29,209,128,129,152,129,33,33,15,161,65,27,137,152,58,17,47,148,
+17,212,41,180,59,208,136,195,144,130,19,145,11,39,186,0,172,183,161,130,144,38,140,16,176,164,153,209,130,162,2,75,
+132,107,26,56,249,16,186,50,157,2,0,164,130,34,16,159,168,124,144,24,192,65,160,90,168,2,176,136,9,177,130,46,
+48,65,152,75,147,143,226,40,225,1,8,72,153,17,0,25,156,194,131,140,132,170,7,60,8,75,16,14,165,245,74,0,
+144,163,130,201,18,164,64,10,48,250,48,13,129,11,33,11,133,25,130,137,152,250,49,137,26,228,88,176,48,176,35,187,
+145,75,73,12,107,58,25,146,46,211,192,146,74,177,41,144,96,8,48,152,25,169,41,199,153,129,168,23,59,162,42,181,
+15,0,9,178,9,82,194,35,28,74,201,1,10,57,204,150,8,32,144,2,106,139,184,17,8,29,169,97,9,147,180,2,
+200,137,196,17,155,41,135,132,1,12,164,11,168,73,160,139,194,19,132,4,177,180,160,192,229,129,152,74,130,90,161,74,
+241,128,9,16,178,153,66,160,151,1,43,27,225,24,24,156,161,120,48,24,160,0,45,169,176,18,59,159,7,8,17,169,
+195,57,27,154,197,25,45,3,2,178,131,245,162,170,18,224,129,59,145,6,33,27,187,150,169,161,212,178,72,137,4,161,
+64,142,147,26,16,185,244,18,25,146,146,147,47,193,128,128,42,217,34,89,24,176,162,123,154,160,147,32,143,148,40,72,
+43,225,40,25,10,210,129,59,129,134,41,108,139,16,139,72,154,129,10,36,1,179,40,29,2,187,58,95,184,73,25,80,
+153,148,171,148,184,148,137,177,132,163,151,56,162,63,176,25,193,16,189,50,2,2,168,167,25,144,139,11,135,30,161,32,
+148,108,152,40,136,60,138,128,9,88,16,210,51,140,24,248,17,28,144,10,67,91,168,17,136,41,186,244,32,169,57,178,
+114,138,164,169,5,11,161,25,74,11,3,165,56,244,40,160,58,249,17,153,64,24,17,43,177,226,163,0,171,151,42,9,
+72,180,105,186,3,243,16,139,145,146,56,48,177,36,15,144,176,165,46,176,130,33,72,184,195,80,26,184,176,122,28,145,
+136,67,28,178,40,57,187,244,146,73,152,33,2,107,154,4,139,42,250,180,24,128,16,149,0,139,181,8,0,11,242,131,
+138,67,177,178,42,166,177,0,12,186,7,153,133,162,162,25,200,0,154,56,30,167,58,66,153,160,112,153,145,168,1,47,
+177,57,35,75,218,65,12,16,186,180,88,209,32,1,24,28,163,26,193,154,226,80,154,49,145,1,45,210,16,168,27,192,
+5,156,51,8,163,123,168,16,176,26,141,135,10,49,144,212,34,155,56,187,56,47,211,9,134,136,144,17,144,128,154,193,
+36,244,64,0,106,152,60,3,89,169,130,137,129,219,195,49,232,56,130,33,46,8,140,180,58,242,32,200,64,8,145,16,
+201,129,193,127,181,16,160,43,79,169,1,41,0,26,0,17,29,144,243,0,90,131,153,178,195,145,201,20,176,12,64,138,
+136,19,150,157,146,160,4,58,17,16,203,147,152,15,82,11,128,97,186,180,130,42,10,163,41,47,152,34,170,80,152,1,
+105,10,0,193,58,175,151,8,8,24,184,165,162,161,133,169,130,144,200,21,90,40,152,136,210,176,151,192,161,9,130,57,
+57,128,7,41,61,15,3,11,129,73,168,57,8,194,128,136,168,196,57,187,106,121,42,138,18,26,46,161,147,161,114,153,
+180,17,203,152,32,17,47,137,184,162,5,128,146,65,169,74,136,121,168,130,0,0,144,1,30,43,28,174,149,140,150,24,
+24,56,136,0,26,43,149,192,144,138,3,212,2,161,89,61,156,24,1,28,0,74,244,146,129,17,137,136,58,1,29,76,
+41,56,233,178,149,153,163,152,89,10,130,129,58,179,124,25,25,152,181,160,32,200,146,20,8,159,0,76,41,33,158,24,
+0,243,147,145,35,140,42,63,8,10,163,153,181,24,145,148,243,160,161,163,0,121,49,25,224,50,27,155,152,128,143,176,
+131,4,34,28,130,58,251,16,1,14,123,10,146,146,148,41,160,168,136,226,136,16,176,180,66,186,37,217,17,46,0,137,
+21,169,72,186,66,58,10,8,1,240,176,148,26,137,130,168,112,152,120,24,25,142,1,136,66,169,1,192,225,17,18,12,
+60,152,58,128,89,30,57,217,146,129,57,147,161,82,140,163,122,138,60,144,177,136,66,178,20,60,12,178,17,200,58,241,
+137,56,80,17,163,184,63,128,45,26,201,3,225,145,5,145,8,136,144,152,56,14,60,41,29,161,36,145,41,224,179,240,
+147,128,10,65,11,40,56,7,177,152,168,33,202,216,199,1,8,16,58,21,10,187,144,146,58,151,210,163,42,192,164,40,
+33,173,179,49,130,48,249,25,138,171,91,106,65,27,42,136,201,1,108,152,162,137,1,107,34,24,169,148,12,58,136,200,
+243,26,72,155,55,145,152,144,161,194,203,194,24,9,162,7,134,129,144,168,8,156,136,209,2,30,56,8,112,128,128,160,
+192,128,40,156,9,235,64,0,32,160,96,40,112,129,8,172,1,139,141,130,147,160,62,161,67,167,129,8,138,153,177,165,
+129,177,138,35,152,23,130,248,27,34,144,63,140,10,161,33,59,87,136,10,32,153,26,29,137,25,47,90,41,1,17,165,
+153,11,176,25,134,169,140,1,137,39,51,136,28,240,162,161,169,74,154,144,88,34,65,26,144,185,147,143,9,225,226,130,
+49,57,1,194,178,249,24,42,170,145,135,0,25,24,135,147,155,25,123,155,16,0,41,46,137,17,19,134,154,179,139,29,
+25,168,123,9,16,49,74,148,168,241,8,163,168,75,138,184,166,144,66,179,16,0,123,241,146,200,145,1,73,59,0,133,
+32,59,77,153,26,248,177,146,17,28,56,135,2,10,128,153,154,186,112,43,46,192,164,151,129,128,9,128,154,152,16,59,
+62,9,162,7,64,11,25,217,145,242,136,131,128,165,8,97,58,9,176,162,169,12,61,24,0,164,160,37,8,180,145,41,
+159,8,153,80,30,8,177,51,16,17,216,32,217,178,242,130,9,8,138,123,72,26,152,17,209,162,170,35,91,137,152,35,
+35,49,28,197,229,128,11,16,176,148,128,123,90,24,1,9,169,154,217,210,181,147,162,49,109,9,144,160,32,29,184,1,
+177,179,152,130,71,10,64,26,136,140,216,24,146,130,200,167,66,160,88,43,26,29,11,42,41,150,128,26,56,165,131,152,
+160,74,175,136,32,147,168,212,131,162,131,57,73,78,11,8,203,132,77,11,146,132,129,6,152,136,212,130,16,43,202,161,
+124,58,43,25,10,203,153,210,194,33,10,160,177,37,152,20,48,144,29,25,131,122,145,65,10,97,130,145,65,57,158,161,
+10,9,41,144,243,131,25,59,9,164,242,11,170,122,9,17,162,148,17,130,16,76,26,157,208,32,168,0,2,48,24,183,
+165,137,204,162,0,24,184,154,158,133,128,50,74,0,224,47,8,57,208,162,144,162,18,9,183,148,160,27,41,73,16,155,
+208,8,125,57,144,148,144,137,139,122,145,195,178,147,90,16,181,34,136,9,176,122,57,13,176,2,43,24,135,16,184,193,
+193,9,72,169,144,1,61,25,132,113,10,184,26,11,64,144,16,155,3,90,160,164,231,8,12,176,131,209,65,138,2,137,
+151,128,0,168,153,212,129,164,171,240,67,0,107,152,147,129,0,40,240,131,168,129,145,165,153,35,184,152,82,90,10,216,
+227,128,16,44,168,146,132,73,56,160,166,40,31,160,128,165,8,43,58,41,51,2,1,249,184,46,10,11,12,25,57,147,
+23,67,9,201,176,184,132,42,31,74,169,212,34,72,91,153,160,10,128,8,241,164,0,130,120,42,144,146,232,128,25,73,
+154,0,161,146,112,16,166,146,177,9,170,178,146,78,152,24,130,88,147,3,73,156,171,241,179,9,196,10,153,66,131,37,
+60,137,168,136,28,31,129,153,18,146,151,2,180,160,162,0,14,44,43,42,91,40,120,42,33,185,145,233,177,225,130,128,
+145,75,49,152,65,40,11,235,211,176,106,187,18,225,5,128,0,73,41,185,162,145,60,30,24,162,65,144,106,12,24,211,
+147,58,61,186,164,132,42,24,137,211,89,161,129,9,129,211,194,0,46,176,196,3,26,57,56,40,137,244,168,26,27,146,
+49,27,45,179,166,18,212,56,12,177,26,150,16,43,136,130,210,145,52,46,145,43,160,48,59,167,177,58,232,203,34,161,
+131,167,48,62,136,144,180,153,65,187,152,41,135,10,132,145,9,165,180,41,139,249,1,208,81,145,129,73,136,137,0,156,
+73,40,31,59,43,73,36,224,2,24,44,12,129,152,59,153,60,164,80,16,16,136,72,216,137,1,29,31,8,139,27,21,
+137,4,180,195,129,153,16,244,24,25,8,43,38,128,144,147,186,194,244,178,128,152,137,179,5,66,3,16,208,242,177,129,
+138,24,144,160,89,0,115,130,193,212,178,137,25,208,162,73,28,56,41,36,128,196,137,144,216,146,146,44,57,42,77,108,
+0,41,24,11,201,195,56,8,155,147,114,45,41,2,40,45,186,129,168,9,241,130,123,58,153,49,112,43,160,184,8,171,
+231,146,146,128,227,1,56,17,176,177,40,233,144,136,64,138,183,16,161,1,150,0,138,193,195,153,48,198,148,136,137,177,
+21,58,24,169,161,47,168,149,163,136,57,192,60,32,130,232,48,15,41,10,104,44,8,137,17,29,48,132,59,11,43,193,
+122,11,56,26,76,13,129,51,90,155,9,131,45,152,9,149,76,169,16,16,64,160,42,57,92,201,169,51,200,198,160,162,
+73,180,161,181,0,176,2,16,137,180,232,148,239,243,69,0,176,131,133,132,169,167,144,145,160,193,146,129,192,196,146,5,
+130,16,141,129,186,147,154,132,0,156,45,37,1,49,158,129,25,45,30,9,8,57,12,24,113,8,128,24,75,44,138,138,
+121,41,154,48,44,50,0,88,45,155,137,57,124,26,152,74,59,25,132,72,154,210,195,32,30,161,25,41,74,152,129,49,
+194,151,227,8,168,146,153,74,59,162,145,124,33,161,146,168,248,180,145,10,0,179,35,79,9,34,154,144,209,149,136,201,
+195,20,40,30,136,17,41,10,194,1,28,202,181,4,74,10,144,106,74,154,129,1,28,152,242,32,41,153,145,97,44,25,
+144,80,41,187,179,144,41,144,130,105,26,185,115,50,140,144,240,152,146,165,138,2,180,178,130,0,183,148,152,144,196,147,
+138,42,135,177,169,131,167,145,42,186,210,16,177,36,210,34,29,192,147,148,161,160,161,125,16,27,136,57,140,64,128,40,
+8,157,81,11,129,74,136,152,17,46,92,29,162,17,9,161,151,10,26,136,243,24,48,140,164,27,25,57,151,57,10,176,
+195,225,35,137,18,15,136,161,21,42,137,145,137,137,20,224,35,159,177,18,35,26,211,163,94,138,129,160,3,158,178,146,
+113,137,129,131,60,187,150,152,72,202,179,40,73,168,4,18,77,169,129,26,8,232,136,106,74,160,19,40,28,152,64,46,
+138,210,0,73,136,178,96,26,58,210,17,13,144,194,32,10,128,167,8,16,176,167,57,11,136,161,42,12,151,193,49,154,
+162,4,72,155,180,180,28,184,132,131,107,152,129,146,49,241,162,130,15,138,18,16,29,178,164,0,80,168,40,168,13,192,
+3,56,76,193,130,24,25,196,0,26,15,152,90,8,26,148,48,62,8,152,48,153,249,129,108,25,25,128,56,169,149,24,
+75,138,243,0,43,130,153,96,75,152,130,25,28,192,181,24,9,196,130,8,8,161,81,45,169,197,144,146,160,166,41,9,
+146,130,113,10,176,33,14,137,146,148,9,160,165,32,124,137,1,41,44,186,18,105,29,160,131,73,44,145,0,75,45,200,
+18,91,27,160,18,62,8,178,33,77,139,176,89,75,137,212,32,9,0,146,105,27,137,160,41,124,169,2,41,136,161,151,
+24,137,160,146,91,139,182,2,59,8,209,149,8,8,243,17,107,17,72,0,47,8,144,129,41,160,179,2,26,194,229,24,
+27,179,194,66,13,129,145,48,28,211,128,17,172,166,147,74,139,130,17,123,168,147,128,45,27,145,16,45,185,133,16,57,
+211,147,25,91,202,2,9,27,165,56,62,57,162,32,26,174,242,42,144,129,180,107,8,178,5,40,26,201,168,26,146,212,
+17,63,193,132,145,16,152,178,152,27,185,19,99,143,3,0,2,155,167,148,176,155,0,196,64,25,137,58,131,232,20,176,
+169,232,162,152,51,47,57,58,144,6,25,58,160,240,57,169,24,13,72,77,1,25,105,25,169,146,136,11,25,217,89,145,
+131,121,57,43,17,173,75,152,210,0,10,25,53,42,75,179,177,141,61,193,165,152,26,162,132,88,24,24,128,186,46,210,
+18,140,152,166,147,128,1,17,35,172,158,179,50,152,73,171,76,42,8,21,2,240,10,178,19,9,137,155,10,82,95,24,
+58,170,11,42,113,170,40,210,210,130,162,131,81,193,59,27,128,147,155,10,23,194,73,72,137,167,152,170,18,211,41,25,
+192,132,8,3,33,215,26,138,32,89,27,27,160,4,59,7,152,194,169,232,1,1,152,8,163,121,123,24,144,129,155,169,
+195,132,184,165,2,67,15,17,1,41,13,171,144,88,153,130,147,48,13,3,22,56,157,170,169,121,136,177,16,56,186,82,
+50,106,155,185,28,42,240,163,129,1,194,150,134,128,161,136,138,10,192,147,60,1,192,130,23,147,147,241,153,168,180,40,
+138,147,160,48,116,33,145,186,154,225,16,153,219,197,145,18,99,128,128,137,187,57,10,129,142,176,8,195,71,1,128,152,
+203,17,29,145,137,128,40,141,49,103,8,128,170,152,26,33,28,163,173,12,18,101,40,136,203,146,25,49,29,137,169,26,
+170,87,128,148,184,9,137,32,187,113,138,185,163,68,209,132,195,0,168,130,192,2,58,185,136,123,51,160,212,144,232,18,
+177,48,170,160,160,116,48,74,201,44,136,0,147,129,240,24,196,1,35,43,200,9,62,82,25,8,124,138,41,45,42,9,
+128,142,152,200,0,152,146,91,168,106,129,145,193,137,44,60,4,64,90,25,129,17,35,80,193,160,184,129,212,135,144,25,
+136,160,132,33,139,201,233,176,166,0,129,152,1,145,80,32,73,11,46,138,61,6,67,0,139,130,162,132,130,137,96,67,
+168,51,159,170,170,136,11,149,145,163,19,115,21,155,170,153,157,128,240,128,16,211,18,67,146,136,187,140,128,155,159,168,
+0,7,178,50,50,193,228,0,9,0,144,12,128,195,36,121,1,48,136,155,88,9,9,170,136,142,132,4,131,163,90,31,
+136,129,179,200,153,137,46,73,148,129,136,184,24,183,163,168,170,170,197,40,65,148,41,45,73,10,129,153,28,136,14,152,
+5,2,132,185,46,57,9,10,24,31,26,137,33,66,163,201,178,65,133,209,1,136,137,142,134,8,48,169,225,161,4,137,
+0,163,17,155,24,184,53,31,43,200,35,145,152,50,146,191,33,27,0,31,26,156,53,141,33,195,2,176,24,240,19,154,
+47,177,33,25,28,164,1,136,16,244,178,179,138,176,23,25,13,16,0,57,88,153,0,153,185,247,130,0,11,178,88,0,
+74,48,11,162,10,250,32,128,187,167,144,64,74,130,1,163,172,160,155,16,242,162,9,1,122,112,128,129,138,184,168,165,
+184,146,227,164,16,48,49,121,170,128,139,32,157,26,244,3,153,16,149,18,16,11,248,40,139,59,146,25,184,9,164,103,
+146,160,137,10,160,44,137,18,143,91,146,128,21,40,154,32,241,156,24,26,128,41,48,152,38,81,41,170,167,138,29,9,
+146,137,73,57,17,112,16,152,145,173,25,188,165,130,56,73,17,42,106,16,17,45,15,176,144,9,19,180,18,11,218,33,
+54,12,12,153,57,154,89,130,16,10,138,226,39,129,171,8,41,155,186,21,2,124,9,153,72,32,17,186,81,216,11,155,
+99,194,165,136,24,128,50,181,10,144,15,136,25,131,91,155,2,211,176,150,163,146,140,144,193,131,120,58,137,130,142,144,
+80,130,26,171,198,18,41,0,184,181,170,8,74,55,10,169,32,33,154,60,217,130,186,137,142,99,0,131,226,148,153,184,
+146,163,243,128,170,81,57,65,9,144,242,41,138,130,243,144,137,18,182,88,25,0,128,42,28,170,166,74,137,129,162,139,
+120,33,163,91,11,170,136,34,47,12,196,24,26,65,163,17,12,154,129,14,9,200,130,61,200,50,7,40,58,209,129,139,
+152,169,7,10,169,147,97,49,24,195,57,175,168,146,17,9,240,9,20,17,2,33,45,172,144,3,65,0,176,200,17,160,
+160,181,50,16,19,105,121,152,12,138,11,129,164,26,129,215,129,4,1,146,24,143,58,152,160,45,57,42,145,3,121,165,
+41,136,137,217,146,158,18,4,10,8,8,133,36,137,187,195,30,12,128,130,17,168,12,151,66,26,178,153,185,171,243,132,
+24,163,195,212,33,16,145,161,144,189,0,136,8,6,179,162,168,167,151,129,176,192,128,24,40,216,135,137,128,136,166,1,
+128,176,178,192,130,147,8,145,24,241,178,9,7,128,162,209,147,45,145,107,28,136,58,152,113,8,16,128,26,29,17,172,
+136,73,76,27,25,104,2,24,75,185,43,138,185,213,65,154,96,154,34,105,138,163,152,176,58,240,193,148,128,225,1,32,
+144,164,1,161,169,183,162,138,179,197,177,147,82,130,72,176,10,228,177,8,193,180,136,162,32,52,130,121,137,25,28,139,
+192,161,225,131,75,41,134,24,1,96,203,160,24,169,25,225,57,121,128,34,10,122,185,16,29,57,60,155,18,123,168,132,
+8,41,57,154,89,58,143,148,26,57,26,177,3,20,242,241,121,176,5,59,169,155,59,147,164,48,27,82,42,147,143,10,
+184,19,164,134,129,26,24,11,24,25,158,45,160,179,3,120,176,41,145,45,72,50,47,136,168,192,129,137,149,36,137,160,
+147,241,176,145,57,61,44,48,160,194,132,152,144,52,43,160,29,12,154,112,42,40,232,2,138,41,162,98,28,9,16,25,
+137,149,25,151,184,21,45,24,216,177,0,9,8,56,131,145,164,167,44,1,16,29,59,145,24,74,44,168,129,41,131,47,
+14,153,57,75,209,20,138,149,42,16,136,148,161,184,181,162,25,36,63,153,153,128,30,1,130,192,129,9,151,33,16,165,
+170,177,193,128,56,63,137,72,170,161,76,129,40,73,47,144,1,26,179,90,211,65,155,1,42,209,25,140,4,11,147,58,
+11,5,59,193,6,46,144,9,146,3,233,146,144,34,130,123,139,56,142,25,16,61,152,152,148,40,210,147,166,129,128,44,
+48,13,170,62,48,185,133,25,73,73,138,242,32,170,180,56,136,104,136,152,48,137,66,186,9,10,31,240,129,130,16,88,
+169,18,153,170,115,241,130,8,9,25,0,168,92,145,152,1,168,197,81,141,0,144,16,145,179,34,93,9,194,12,70,0,
+128,9,202,4,153,181,0,184,2,44,211,164,148,163,0,9,31,74,8,144,195,146,106,154,49,145,60,200,193,195,162,41,
+49,139,176,167,149,16,25,187,59,177,156,23,145,113,60,184,130,152,208,163,16,9,56,170,34,124,139,164,146,112,27,177,
+243,129,24,8,8,51,46,171,2,128,29,136,138,7,1,0,137,176,213,40,77,25,26,225,146,1,9,136,42,73,147,168,
+129,124,136,129,43,60,144,242,131,45,41,169,148,74,0,0,25,9,171,167,179,75,75,24,48,152,241,213,130,26,8,168,
+4,152,129,161,4,77,12,152,137,129,76,144,2,147,167,161,17,11,248,180,1,88,138,128,58,40,137,243,48,28,129,162,
+145,129,206,4,25,162,147,162,9,161,243,41,31,59,16,75,48,128,230,128,144,160,147,194,161,132,178,40,189,194,149,35,
+59,195,166,8,208,145,144,32,142,149,8,40,26,27,34,72,137,137,18,31,200,197,33,25,42,177,132,26,9,143,25,32,
+216,132,16,76,168,179,16,64,218,147,160,11,171,120,91,96,9,0,152,139,180,130,43,161,139,48,123,139,167,16,74,88,
+9,0,10,156,161,9,16,32,72,79,42,185,146,138,184,113,16,82,91,139,152,42,152,33,9,64,25,220,160,57,143,34,
+2,18,16,31,24,75,10,160,243,0,0,153,209,130,41,122,48,138,2,248,8,9,8,2,178,57,59,160,145,170,143,128,
+113,22,25,218,243,145,0,1,0,144,40,188,9,11,161,97,113,17,10,211,145,139,130,209,146,40,24,42,139,245,192,179,
+97,128,131,160,160,106,27,128,60,144,176,183,145,137,225,147,56,105,0,194,145,136,153,0,26,152,197,182,16,9,242,1,
+56,91,16,169,152,194,210,132,10,152,149,128,9,153,212,2,56,107,0,145,216,180,178,145,178,177,151,1,137,41,203,164,
+178,131,98,17,170,164,178,129,194,170,245,2,11,59,12,8,178,51,113,1,160,168,18,79,13,24,152,147,42,108,9,26,
+128,24,122,32,193,170,164,105,59,138,24,49,26,15,24,153,130,169,113,74,128,152,26,129,24,44,138,182,19,203,41,249,
+228,1,16,3,0,152,28,193,129,192,196,178,3,10,171,5,57,10,48,115,50,141,138,32,29,155,136,112,58,26,75,108,
+182,21,75,0,9,137,128,123,25,144,152,56,91,168,8,58,136,194,74,47,144,162,0,92,24,145,10,58,167,146,8,138,
+177,167,9,11,148,196,40,58,17,197,128,153,148,163,26,137,162,147,143,185,150,130,226,148,2,130,168,211,18,130,26,225,
+167,9,185,244,130,8,161,212,1,10,152,152,129,56,140,146,57,42,241,145,65,73,153,132,48,33,177,4,124,58,152,2,
+90,26,192,145,91,43,177,57,78,9,144,40,44,10,161,25,57,235,196,57,45,152,164,17,25,167,131,137,26,212,165,8,
+9,145,129,43,161,178,2,92,248,165,146,10,161,193,2,28,128,148,41,155,213,195,49,139,211,147,73,10,8,57,79,169,
+178,148,136,144,210,1,91,136,128,89,74,184,148,33,46,144,40,58,46,160,129,25,59,167,163,16,0,179,131,93,140,179,
+40,75,10,244,1,41,10,130,0,91,169,181,1,75,155,166,162,16,9,24,62,137,184,5,42,139,196,147,57,60,248,2,
+41,137,193,145,41,138,170,114,10,209,130,64,26,211,211,17,136,144,162,43,184,3,12,127,25,145,0,40,144,161,160,74,
+193,161,73,29,152,132,1,95,9,128,8,10,129,33,93,12,162,1,57,141,194,1,42,27,150,144,60,139,134,32,43,169,
+19,42,46,248,132,25,26,10,149,24,26,225,2,129,152,196,3,138,25,217,129,57,10,250,20,0,210,179,18,178,229,178,
+17,136,128,25,76,153,211,145,66,193,196,129,57,136,146,160,59,178,9,59,47,243,129,59,40,177,197,106,28,1,24,60,
+41,144,42,61,170,150,56,31,24,144,129,43,168,51,40,139,242,182,16,41,170,166,144,138,129,4,9,128,210,83,73,217,
+180,130,43,43,218,132,8,144,129,180,165,179,162,78,136,128,145,72,155,146,169,48,153,214,1,48,153,210,163,62,131,0,
+60,44,224,18,27,154,182,129,106,26,8,41,43,77,130,16,73,138,243,16,10,170,180,33,47,25,0,57,75,153,150,40,
+10,176,197,41,10,139,132,91,8,128,18,61,168,245,2,8,145,176,162,105,136,42,10,144,197,162,17,202,167,162,1,0,
+163,132,9,186,179,216,42,240,166,0,40,170,132,16,75,136,4,74,60,170,16,30,43,169,34,109,42,168,48,61,26,146,
+81,28,9,160,221,253,63,0,121,27,152,162,89,75,26,161,90,154,180,132,56,25,242,146,91,138,152,129,74,200,179,180,
+57,9,197,3,24,180,130,160,31,176,194,49,15,163,163,164,9,162,129,88,27,196,164,16,154,144,160,145,249,165,16,58,
+186,165,17,72,0,130,18,10,248,42,156,16,200,148,41,72,44,76,43,144,165,88,90,27,153,16,11,24,129,77,26,24,
+224,56,60,25,32,90,90,9,145,63,27,177,164,91,27,136,177,25,177,151,34,76,136,165,129,28,9,176,3,14,192,130,
+146,137,182,150,0,144,196,2,8,170,178,129,64,234,165,1,160,176,164,16,8,212,147,48,41,202,16,27,130,243,160,58,
+192,227,129,56,73,162,65,74,129,154,62,44,168,178,9,61,145,160,92,8,17,49,95,59,129,144,30,42,25,9,44,153,
+34,43,47,58,17,123,10,0,17,130,15,137,40,9,154,177,150,16,158,147,33,58,137,167,151,130,200,129,8,9,224,178,
+129,128,241,164,130,1,144,130,48,130,240,160,128,200,196,178,16,144,225,17,32,24,59,121,57,162,211,138,24,200,195,8,
+46,128,144,123,74,9,8,104,42,146,0,46,42,12,41,60,29,72,10,41,59,0,44,73,24,2,121,14,25,144,24,8,
+171,178,167,161,18,193,194,132,2,17,17,216,226,0,153,193,228,161,18,168,179,151,136,16,129,179,148,25,225,163,176,209,
+181,144,146,196,162,164,144,210,166,146,146,195,211,145,144,162,193,130,145,0,57,137,144,61,124,16,32,44,11,57,47,9,
+1,93,137,8,25,137,41,76,58,58,88,90,45,9,58,42,14,9,144,56,43,48,129,152,132,94,57,153,9,193,89,61,
+169,128,73,193,64,0,168,145,179,32,216,134,40,138,210,129,177,169,50,130,216,130,176,233,4,176,116,2,16,154,243,24,
+0,0,233,128,44,192,179,136,148,243,24,41,168,8,139,0,130,240,138,17,145,28,167,33,146,18,176,71,57,153,32,41,
+120,12,137,57,161,92,208,33,136,178,200,134,136,161,179,144,177,152,241,41,64,8,180,8,153,160,128,115,58,9,18,220,
+32,176,153,124,144,179,161,41,197,128,182,42,129,144,178,186,161,135,184,146,183,161,148,26,166,128,177,104,161,144,144,73,
+136,73,140,43,129,76,25,76,125,243,72,0,57,44,8,43,131,46,19,160,197,17,138,27,56,57,76,91,8,139,32,29,
+115,138,16,184,0,60,176,76,24,29,106,27,75,42,58,193,66,137,130,193,10,161,213,177,56,216,178,129,41,17,161,211,
+33,208,0,147,105,46,42,186,17,41,152,21,130,166,153,200,146,135,57,144,137,194,33,15,136,33,162,41,194,33,31,17,
+153,6,27,178,242,145,27,153,151,145,56,26,160,129,138,195,151,17,28,136,161,43,41,199,163,40,26,184,167,32,168,136,
+147,28,12,20,168,80,12,2,44,13,128,179,6,10,160,179,130,189,165,135,128,9,161,144,121,139,147,144,0,153,211,129,
+60,144,167,18,41,184,147,145,77,216,146,89,43,162,8,89,60,243,130,8,25,177,163,73,140,198,145,0,26,195,2,8,
+0,198,128,24,152,164,8,14,136,177,136,121,32,161,42,41,225,148,92,25,129,160,25,140,8,152,74,89,184,6,58,160,
+136,16,73,243,177,34,15,177,162,4,137,128,177,52,12,184,131,120,29,145,160,40,202,131,1,1,26,167,210,49,41,154,
+168,112,170,66,154,92,144,24,27,17,217,18,59,33,224,148,161,28,242,72,8,9,161,48,26,129,168,111,138,160,164,24,
+75,138,148,74,41,10,128,123,137,161,195,73,42,10,130,59,56,176,145,127,8,177,129,61,16,10,242,8,177,24,0,2,
+65,30,137,25,134,144,148,11,147,10,157,11,162,161,52,248,134,136,1,8,66,153,209,10,64,44,28,26,128,64,74,27,
+144,164,28,162,65,24,130,143,42,27,195,162,90,58,64,210,16,3,44,143,1,136,177,216,16,0,195,242,146,17,178,105,
+9,128,168,24,0,129,8,217,42,58,167,130,3,146,120,155,8,48,158,168,177,39,16,11,249,148,72,28,40,153,16,59,
+225,1,43,13,17,72,74,138,209,148,56,42,203,130,75,170,198,16,73,26,128,72,58,41,153,97,58,218,213,129,25,154,
+129,64,26,8,144,112,49,154,162,45,11,192,149,137,11,131,110,26,8,137,2,57,64,139,137,184,165,43,28,107,26,0,
+92,8,131,193,130,149,128,211,42,217,147,136,80,11,26,169,66,194,134,16,25,169,60,227,8,201,50,169,41,179,176,68,
+146,181,130,43,159,145,49,185,169,182,19,75,83,255,62,0,172,151,2,25,25,168,88,106,156,164,136,1,9,162,41,8,
+106,163,120,10,59,138,25,45,172,130,96,0,225,146,24,18,9,34,47,140,25,25,26,47,136,24,25,136,181,7,128,32,
+154,163,46,10,168,17,193,33,137,41,1,127,161,16,193,8,168,131,160,208,176,56,163,196,2,138,84,57,147,107,184,168,
+218,193,212,129,128,147,161,9,56,37,34,46,147,137,232,128,216,128,196,33,153,144,17,121,17,208,64,27,136,208,146,58,
+26,136,5,62,28,58,64,25,28,168,134,9,160,176,130,138,74,137,113,44,41,129,18,29,169,145,163,8,15,129,24,17,
+60,242,33,131,164,226,2,170,107,154,42,10,90,41,1,209,90,17,132,160,60,172,17,200,48,27,28,136,112,10,0,145,
+65,57,171,131,76,141,137,148,140,24,129,34,106,59,80,148,138,8,243,1,141,168,24,3,30,72,137,24,123,16,16,136,
+170,162,182,194,168,209,146,147,40,44,129,56,51,75,242,16,218,58,145,162,169,59,76,18,224,33,133,145,153,42,49,196,
+197,138,152,130,160,146,170,23,20,160,163,171,94,43,104,28,136,12,0,17,0,156,2,23,41,170,26,161,40,200,24,76,
+152,249,2,57,88,9,18,42,45,8,31,129,42,168,194,148,169,149,9,19,166,161,171,164,151,161,9,128,177,179,147,67,
+29,128,18,134,144,189,136,120,9,136,13,57,137,16,17,41,144,134,18,160,244,144,58,106,169,144,26,9,135,41,24,132,
+211,177,152,3,145,208,10,90,40,26,45,153,18,123,49,152,217,107,24,24,153,140,186,2,20,9,136,16,114,74,137,168,
+34,60,42,233,16,217,186,53,50,241,129,17,43,202,24,20,45,201,2,8,161,184,247,2,1,129,145,184,184,167,3,9,
+163,251,136,32,25,192,160,120,33,153,10,90,144,17,10,128,216,168,121,1,8,128,162,25,243,145,144,26,43,60,129,73,
+76,27,8,115,121,58,12,154,20,168,129,9,155,73,28,89,41,12,136,36,130,188,178,24,122,128,184,193,163,108,0,25,
+144,16,152,73,89,211,160,226,163,178,137,193,134,145,144,149,148,168,136,17,164,144,217,227,1,59,57,146,10,42,88,149,
+9,46,10,160,33,74,251,144,105,129,152,147,41,17,216,129,116,0,64,0,48,170,154,50,147,209,249,148,109,152,145,2,
+136,153,130,97,60,137,138,8,137,122,128,59,46,32,8,160,194,160,8,144,26,50,159,61,4,90,44,138,16,121,26,152,
+180,25,58,197,161,16,152,195,163,48,58,213,194,2,178,179,147,44,232,227,131,58,192,137,34,73,144,180,10,129,89,140,
+2,14,26,56,136,129,156,120,56,137,58,42,139,15,34,91,10,161,109,25,136,24,89,43,161,179,122,11,209,0,16,8,
+194,211,40,136,19,40,41,248,162,0,28,161,245,136,129,1,178,41,155,151,32,59,138,242,130,41,25,9,2,15,18,178,
+16,123,58,139,210,147,136,29,74,152,81,44,41,184,33,59,98,195,208,25,145,196,16,42,154,196,1,91,139,168,18,98,
+184,244,1,9,128,161,50,155,160,80,8,11,144,22,61,1,73,28,25,171,18,122,30,144,130,10,41,145,38,137,169,72,
+144,47,152,131,44,145,137,193,1,157,67,17,28,200,176,1,130,148,177,198,168,151,160,32,8,133,145,136,43,178,208,137,
+135,144,59,74,140,147,89,91,130,10,43,89,170,129,59,46,16,40,27,25,187,125,2,139,176,162,13,128,144,104,182,25,
+130,130,219,131,34,181,212,145,57,200,193,130,18,14,1,9,41,146,33,83,10,234,165,9,24,136,177,58,91,138,50,15,
+42,51,168,152,240,138,132,9,184,5,45,59,210,129,56,25,21,164,25,14,177,40,41,176,145,151,28,201,148,129,37,160,
+177,89,138,0,26,75,73,240,144,128,136,1,4,49,184,177,47,74,153,9,121,11,9,44,139,34,154,70,56,42,11,200,
+10,17,56,31,133,184,8,41,31,18,3,26,160,232,24,26,139,135,179,0,194,210,136,195,150,131,177,154,176,167,162,146,
+216,2,136,184,211,2,48,135,176,196,146,9,25,8,144,18,45,47,24,26,0,135,162,0,155,137,130,106,28,56,8,59,
+189,178,134,48,33,154,243,57,30,57,106,138,145,160,41,45,137,137,7,18,184,42,29,25,8,208,35,202,211,129,145,49,
+4,18,9,242,168,145,56,170,167,194,178,180,193,194,148,151,129,153,163,178,180,193,197,211,195,81,200,33,129,59,187,31,
+8,17,136,9,123,16,146,200,144,154,2,116,74,24,27,27,43,10,179,91,192,12,73,0,143,129,128,56,128,112,29,41,
+10,1,121,25,26,10,10,162,130,9,1,179,122,57,144,31,169,58,185,18,8,5,242,164,146,25,168,4,182,16,154,41,
+176,162,134,128,25,142,163,153,18,168,133,147,25,131,167,162,177,6,138,137,65,208,155,170,67,210,40,106,152,195,161,137,
+177,134,41,29,1,163,34,72,9,200,24,31,161,9,216,91,8,130,0,140,34,162,183,132,75,24,9,184,56,30,137,20,
+91,186,10,212,1,2,18,141,58,8,130,59,92,138,16,193,61,57,168,32,57,33,14,159,26,164,2,74,10,130,57,15,
+104,161,136,2,59,8,25,35,200,250,0,152,144,242,65,32,137,210,58,62,11,16,56,129,14,148,9,136,10,16,151,168,
+145,152,29,10,19,48,121,11,179,59,242,180,148,24,137,151,58,63,42,152,128,92,136,1,137,40,26,178,91,145,12,145,
+80,16,75,29,41,144,203,128,152,49,18,151,12,25,27,183,144,130,162,167,146,184,163,49,58,152,250,18,25,1,248,128,
+181,164,176,2,164,0,34,75,146,47,153,26,202,64,145,131,176,165,14,25,9,166,16,44,16,152,162,120,138,56,26,43,
+185,130,43,58,58,35,83,175,177,98,136,59,61,58,152,132,48,92,0,152,241,41,11,10,38,154,88,12,178,41,27,225,
+150,3,12,136,176,147,48,12,4,44,42,172,148,226,33,18,248,161,32,128,153,195,51,154,16,184,132,13,24,122,129,161,
+26,146,46,240,3,27,130,90,176,19,157,130,66,140,57,13,194,146,160,74,185,179,4,24,28,162,121,17,169,178,182,28,
+144,135,161,40,59,136,160,9,76,34,78,43,26,196,161,128,145,1,26,48,8,25,47,166,91,10,184,129,129,128,135,145,
+44,138,72,31,153,132,32,10,186,165,180,56,43,130,180,136,104,11,196,8,195,165,168,130,9,80,26,1,32,155,73,15,
+130,43,41,106,160,57,63,44,144,1,89,11,128,139,176,181,48,185,5,248,147,9,129,32,0,233,17,56,136,131,91,147,
+124,185,129,45,56,63,153,128,2,184,165,195,24,33,16,199,128,128,62,25,25,10,179,131,18,143,192,178,48,41,168,167,
+42,24,29,144,73,152,165,147,130,9,194,19,243,192,184,6,43,0,137,167,0,41,168,193,177,242,67,0,2,124,8,0,
+168,152,147,148,26,176,179,199,178,128,193,50,28,136,137,73,44,59,73,1,45,9,34,15,24,184,6,40,138,193,130,60,
+91,26,24,74,75,154,178,146,105,128,161,200,178,57,66,123,8,41,190,65,170,166,162,147,2,216,128,29,41,57,128,40,
+154,6,240,162,227,130,2,9,8,25,30,57,26,193,164,195,16,138,0,26,7,8,24,16,15,40,42,194,162,154,99,12,
+25,45,147,82,12,137,169,165,24,90,137,8,72,154,243,129,48,60,42,160,144,8,44,129,183,145,160,65,91,154,8,132,
+32,232,147,161,162,41,247,147,9,25,25,137,16,243,149,162,41,153,163,130,0,75,240,26,178,161,152,81,145,182,211,162,
+59,26,124,136,147,58,75,62,138,128,24,33,136,0,47,153,8,35,91,154,160,166,24,170,165,34,3,139,213,56,14,40,
+59,162,176,163,9,15,11,164,6,128,8,43,28,184,135,1,168,74,176,17,202,123,57,2,10,12,146,28,128,66,200,196,
+145,17,9,26,57,244,4,43,168,128,192,99,43,43,170,149,152,44,73,9,135,152,144,209,146,0,130,177,76,42,154,145,
+44,107,1,166,1,136,28,192,51,10,43,158,132,144,9,56,150,18,153,144,184,57,31,64,64,202,145,160,17,204,147,38,
+168,152,170,56,60,90,59,41,15,243,146,129,26,48,18,20,25,136,58,123,83,123,172,177,25,75,10,32,90,153,232,128,
+136,144,24,26,195,136,212,24,170,98,0,149,16,24,9,148,49,122,153,145,19,58,187,19,153,100,41,11,26,155,197,164,
+161,218,16,154,1,27,225,35,135,25,136,59,192,37,43,148,168,208,163,43,195,112,57,26,186,8,144,33,15,144,77,140,
+152,176,130,26,80,50,10,141,10,130,10,134,129,0,44,172,98,13,41,56,128,41,140,176,164,57,18,60,194,29,168,180,
+134,80,56,138,136,9,145,194,114,59,208,161,146,90,28,177,7,146,10,152,16,145,0,137,196,130,152,48,169,11,123,23,
+136,137,77,137,162,130,73,139,142,145,129,155,212,22,9,10,153,2,9,155,50,229,161,137,137,0,10,120,20,137,138,76,
+136,152,16,19,25,240,164,0,30,137,7,16,137,9,145,152,160,135,160,25,58,9,170,31,64,131,136,28,42,1,62,0,
+161,212,144,48,1,176,226,88,139,152,75,19,136,172,49,233,178,146,51,47,12,131,25,28,140,7,147,168,8,130,144,139,
+48,18,45,45,128,72,30,41,134,179,145,200,195,161,88,8,11,43,32,12,140,0,133,130,186,135,152,144,75,57,179,225,
+56,11,152,1,41,7,180,8,8,139,49,95,45,138,164,147,42,188,167,19,41,25,152,60,31,16,129,41,45,152,198,24,
+25,144,130,146,160,242,146,91,59,160,161,18,11,169,12,4,123,177,48,140,146,145,135,75,169,147,176,194,10,34,73,73,
+145,145,172,153,7,129,58,27,51,226,40,61,1,94,138,144,145,41,47,160,129,136,75,154,25,42,7,138,7,59,185,146,
+25,65,76,11,137,3,192,177,120,144,1,177,167,42,10,72,160,131,59,122,28,128,154,150,8,129,33,225,152,170,82,153,
+136,75,162,59,250,50,153,5,0,160,123,154,16,200,130,137,6,26,185,121,177,0,40,104,139,10,128,21,28,136,91,144,
+130,241,132,8,136,152,165,128,168,50,177,4,15,8,60,60,60,160,146,145,88,140,195,177,182,179,0,72,75,9,8,40,
+42,73,129,138,235,129,40,195,129,242,72,10,1,12,165,136,19,122,28,25,26,17,28,152,76,24,184,178,5,153,210,164,
+2,43,8,144,5,172,196,56,58,29,226,131,40,16,138,144,63,154,130,160,91,43,164,48,43,121,169,51,61,161,193,33,
+47,152,178,192,32,152,19,75,122,154,4,138,128,176,192,16,194,164,11,104,75,168,32,153,3,197,146,160,4,16,154,194,
+184,128,112,193,227,147,193,148,194,32,29,144,56,57,46,200,35,42,128,232,149,56,152,209,130,42,139,129,200,88,29,163,
+129,129,26,66,1,141,40,192,32,47,0,155,228,16,130,9,155,50,16,24,61,136,16,244,33,59,138,12,6,25,42,60,
+73,25,200,130,40,15,170,151,136,42,92,8,128,137,64,41,128,30,211,1,26,9,129,160,42,122,8,153,25,1,51,232,
+58,128,198,144,130,26,27,46,132,128,136,108,32,192,176,132,145,58,140,164,152,160,121,169,147,41,83,10,139,123,9,168,
+8,121,152,169,2,5,168,242,17,34,185,243,32,10,42,11,4,12,168,64,146,42,202,23,130,0,28,179,58,157,145,129,
+217,1,58,0,28,60,146,161,14,76,17,144,169,35,18,31,9,209,178,40,95,136,160,146,33,2,45,45,137,176,133,9,
+128,169,48,67,31,9,89,2,160,184,19,25,240,128,129,25,142,41,25,161,122,107,24,153,162,146,136,194,18,139,31,152,
+34,13,10,96,131,8,184,135,24,140,42,0,10,47,60,0,144,24,48,149,0,153,1,217,211,0,178,145,11,38,154,41,
+122,17,139,13,146,8,29,8,209,227,129,16,24,201,167,3,241,22,128,123,26,202,24,44,25,0,56,12,149,35,30,9,
+185,19,125,128,8,160,40,138,169,22,138,153,80,11,16,136,50,143,42,194,33,41,128,179,63,10,146,73,42,137,195,147,
+26,227,208,152,8,163,97,43,57,33,94,10,42,42,40,11,183,32,170,153,166,34,186,19,138,144,74,11,151,8,73,162,
+196,20,153,148,147,60,217,160,167,154,210,40,43,28,144,17,57,128,202,41,151,144,145,18,193,132,129,19,250,162,73,72,
+139,161,20,16,74,171,135,0,129,56,195,192,194,145,0,169,88,156,17,2,31,42,202,82,43,153,144,228,32,136,35,89,
+25,138,163,154,248,146,123,42,154,8,160,138,146,135,128,162,8,0,153,240,151,40,152,129,160,130,31,129,161,64,155,145,
+161,168,167,129,56,15,161,178,163,122,177,50,13,132,138,162,73,144,162,201,131,179,89,64,168,183,6,26,144,136,129,123,
+153,32,137,154,196,193,50,141,130,144,163,2,204,34,11,212,129,130,123,26,41,75,42,41,209,9,11,16,242,211,145,146,
+24,140,18,25,88,76,105,9,168,164,145,24,45,9,179,227,147,41,25,58,225,146,129,136,24,209,167,145,2,170,136,19,
+210,19,79,59,156,210,195,18,58,44,152,146,9,56,128,212,181,165,17,138,8,160,1,128,123,170,145,40,137,42,169,135,
+179,32,26,137,231,178,133,136,144,146,195,3,184,64,76,12,10,145,90,27,75,177,197,163,146,152,180,195,165,17,92,27,
+8,25,41,74,138,41,152,165,145,104,90,136,178,32,44,44,184,113,11,26,139,51,63,27,136,130,164,177,161,2,188,135,
+177,49,203,165,165,128,26,177,166,128,59,16,27,92,74,225,162,177,18,145,161,120,161,2,27,109,11,160,128,73,43,152,
+88,136,11,152,75,234,64,0,150,163,144,145,148,145,186,149,40,192,44,0,64,45,80,1,240,177,17,9,152,212,131,160,
+224,148,145,16,9,149,0,10,57,241,130,44,8,32,139,9,147,183,128,41,177,215,16,107,27,160,0,34,12,169,96,26,
+210,130,2,56,219,131,128,185,43,26,2,175,149,48,9,74,11,21,61,43,24,242,180,160,165,1,192,3,136,106,46,8,
+136,136,0,193,212,146,129,145,16,160,2,59,43,79,129,58,186,133,10,160,12,151,16,44,91,9,137,0,1,196,147,128,
+24,248,181,56,27,57,170,35,63,26,25,179,146,244,195,145,144,178,151,0,42,26,145,9,153,151,198,129,8,144,144,16,
+75,138,8,76,90,42,25,92,25,136,145,56,26,13,136,56,9,44,42,129,124,25,123,136,162,9,40,13,224,130,144,40,
+0,123,58,27,195,129,40,44,44,144,57,10,111,43,152,146,130,74,11,164,181,161,145,42,43,46,75,16,107,43,42,194,
+194,181,131,161,161,8,162,123,28,74,9,152,128,228,179,195,148,1,144,9,128,57,47,43,160,181,162,195,164,130,144,165,
+179,72,47,59,153,130,9,16,168,160,149,227,163,65,93,10,152,1,43,9,90,25,178,242,129,57,153,178,183,3,75,43,
+138,243,179,196,146,128,145,146,19,63,26,146,193,193,130,91,28,136,146,129,11,197,3,90,77,75,25,26,9,136,161,128,
+136,162,96,79,43,137,179,65,77,43,138,162,179,178,145,72,170,199,130,24,77,25,128,178,180,160,129,176,214,146,129,73,
+43,25,8,145,18,147,241,193,212,130,9,57,59,136,74,43,24,28,165,179,197,147,168,163,16,45,62,26,41,42,8,210,
+181,163,162,242,32,152,72,168,18,62,27,75,10,2,192,4,168,214,146,146,58,45,26,24,24,8,0,136,122,200,150,146,
+9,137,193,166,42,75,27,161,1,176,163,80,25,146,215,1,42,75,137,25,58,16,11,45,176,215,130,53,26,12,160,129,
+176,182,157,48,8,129,196,146,138,4,130,140,193,163,49,60,146,199,179,145,9,96,42,26,154,4,46,9,202,148,145,41,
+75,24,152,16,163,122,75,106,26,25,208,16,57,44,10,169,132,145,150,13,32,0,136,24,63,9,194,147,136,16,144,8,
+242,144,146,112,91,43,184,145,27,248,69,0,136,10,26,179,166,18,91,90,136,56,24,195,1,159,16,160,145,185,98,45,
+44,59,184,183,88,24,42,177,24,228,164,1,136,144,193,33,11,8,27,49,30,171,24,145,165,177,167,2,107,59,178,146,
+57,123,40,11,12,41,138,212,136,129,58,29,122,9,57,45,17,16,12,72,208,146,137,19,9,138,59,45,123,138,179,227,
+129,8,145,179,8,21,137,153,76,130,57,12,112,137,8,217,164,74,62,42,152,162,144,48,74,26,144,134,8,16,62,59,
+46,25,57,28,9,0,199,161,161,2,2,240,8,24,90,26,73,138,161,152,135,160,178,3,17,177,171,90,136,41,47,152,
+144,209,19,60,24,46,18,91,75,27,9,178,43,148,9,244,32,24,25,61,8,106,43,75,26,184,176,17,164,177,176,23,
+41,155,75,34,59,157,181,160,19,63,137,16,209,17,41,193,129,242,146,162,3,154,128,152,66,28,156,17,72,141,162,199,
+165,130,24,25,27,26,106,137,168,9,18,25,242,165,161,133,41,184,161,176,51,79,137,8,160,19,216,196,146,0,210,147,
+136,108,43,42,42,152,92,176,82,44,41,169,133,40,138,25,42,75,137,184,32,94,26,44,24,58,109,153,1,144,184,148,
+163,0,219,133,40,25,138,210,49,8,120,169,160,185,135,161,1,0,140,183,57,88,29,25,160,88,60,63,179,184,7,153,
+180,139,129,129,166,128,32,137,66,14,145,12,129,1,148,3,12,161,75,12,17,137,152,160,108,24,10,4,15,129,9,130,
+106,0,168,128,136,32,140,147,128,72,92,144,162,12,28,40,200,34,107,58,192,145,0,9,209,67,26,169,41,140,123,177,
+20,90,185,128,177,48,75,170,160,182,48,136,180,130,242,6,136,16,28,24,171,160,0,45,200,133,182,1,136,24,152,129,
+163,26,121,168,0,130,150,160,12,211,40,136,93,138,41,184,135,9,0,56,139,131,73,195,59,0,123,154,129,138,151,160,
+40,188,34,225,147,160,131,129,80,106,152,147,217,148,153,4,187,133,42,161,136,143,17,24,24,32,28,177,199,130,0,178,
+194,65,43,138,144,2,178,243,152,129,56,154,199,144,33,216,164,152,167,16,16,145,209,130,60,136,136,123,136,25,177,155,
+227,166,40,40,58,201,2,152,3,60,209,129,59,0,67,0,32,217,144,166,32,243,32,11,74,168,131,139,2,128,160,153,
+243,2,34,20,26,128,56,78,15,58,138,146,57,210,60,137,8,149,163,27,162,4,231,16,160,1,10,43,10,133,57,137,
+144,167,24,155,164,1,96,153,145,26,35,43,251,109,9,16,9,0,24,154,143,3,73,58,63,10,0,154,3,148,160,146,
+230,129,9,41,1,136,136,72,43,47,187,7,161,162,144,146,74,200,131,91,59,60,177,1,59,42,163,164,73,15,8,106,
+75,10,128,8,89,154,136,163,20,177,212,0,123,43,28,48,10,209,8,129,24,232,130,131,8,8,123,0,44,10,41,77,
+155,195,148,41,136,33,147,28,243,4,26,44,176,147,177,58,168,199,17,177,149,144,128,61,200,0,72,161,24,24,74,28,
+29,58,144,53,75,57,140,177,28,59,192,178,133,59,182,136,3,111,10,144,40,10,57,178,181,73,185,163,8,10,8,39,
+123,152,130,138,58,143,146,1,185,23,136,25,30,168,150,40,11,56,200,146,56,152,186,194,17,208,5,73,32,74,185,104,
+10,25,72,9,214,0,25,59,171,160,122,24,16,9,48,30,129,25,209,1,185,149,73,128,60,41,24,43,224,1,138,129,
+241,131,161,146,76,27,137,2,34,74,45,199,40,169,165,161,130,10,226,148,137,8,152,167,1,147,90,43,9,193,32,9,
+57,201,33,30,76,168,228,2,9,130,9,18,122,10,75,25,41,13,25,1,148,10,210,152,232,138,193,17,138,164,136,176,
+57,17,123,163,81,152,18,105,146,128,144,18,131,179,161,113,28,167,72,28,42,26,0,58,217,4,129,138,171,182,147,56,
+201,0,49,31,46,152,128,42,128,180,146,57,148,97,184,2,161,56,30,177,163,136,224,240,136,9,129,42,48,45,128,10,
+78,10,41,25,181,148,136,178,5,137,80,28,164,152,169,137,138,195,72,16,31,193,18,144,123,10,130,0,90,57,136,1,
+26,154,131,41,126,129,57,60,57,130,106,47,9,169,4,45,9,145,136,16,176,133,33,25,170,244,33,138,146,137,177,25,
+226,133,11,11,136,23,26,138,57,197,25,169,35,218,195,200,150,0,136,50,139,26,45,128,108,43,42,137,152,73,137,177,
+33,52,48,152,51,149,160,41,63,136,47,57,76,28,74,59,253,5,65,0,56,15,161,40,0,27,209,134,136,152,24,148,
+153,145,6,195,16,10,41,73,218,0,1,47,44,25,44,128,76,129,152,146,129,192,196,162,180,176,167,1,160,17,59,108,
+137,161,145,17,27,211,129,177,155,243,150,25,56,77,145,9,26,144,24,209,3,162,129,234,19,169,82,62,91,9,24,169,
+128,73,154,153,183,145,16,132,26,193,20,216,148,176,211,137,164,129,227,242,69,153,24,187,20,14,128,34,44,153,40,163,
+161,88,30,10,130,2,129,130,144,174,16,57,89,202,160,32,219,5,40,192,136,128,96,8,1,128,172,16,48,169,15,36,
+12,24,65,27,154,193,211,146,168,152,2,135,178,131,44,169,151,160,4,138,147,185,50,12,120,10,29,16,11,1,30,146,
+56,136,40,166,40,78,10,17,177,24,176,176,218,196,25,57,75,48,74,145,154,130,168,7,170,121,129,209,33,128,161,168,
+105,249,145,144,32,170,138,84,128,145,25,133,28,50,13,32,59,249,162,18,169,42,164,30,137,144,49,123,59,153,19,10,
+57,33,179,135,158,180,18,153,161,166,9,8,160,184,9,170,55,136,75,25,17,123,58,1,31,32,184,24,208,40,0,213,
+137,8,136,18,233,65,144,161,162,73,155,41,115,90,137,41,42,89,156,136,147,177,132,139,152,9,230,33,148,45,9,17,
+8,154,104,29,147,176,181,8,161,1,192,147,42,18,156,212,129,161,149,144,124,169,3,10,18,25,193,41,10,170,10,39,
+10,146,25,245,41,26,40,160,68,62,58,187,167,136,16,136,48,76,154,48,60,138,9,243,8,129,2,161,72,10,150,91,
+155,18,202,178,166,147,136,136,243,161,72,26,56,64,61,26,8,153,56,225,177,1,56,181,179,198,41,8,226,146,168,49,
+30,0,90,138,73,168,1,8,2,19,241,152,162,146,181,0,30,10,137,73,78,9,57,72,10,130,152,162,44,153,3,152,
+54,159,180,130,42,73,144,24,140,59,62,16,10,162,140,161,120,176,164,145,5,42,40,47,138,177,165,32,43,75,141,163,
+76,91,59,15,0,16,156,87,10,8,128,15,160,18,138,18,137,132,72,75,46,152,10,0,164,18,42,192,160,4,44,208,
+164,40,168,106,161,12,163,32,27,8,1,179,121,185,2,197,128,136,32,152,82,253,70,0,7,137,169,1,154,152,226,134,
+8,179,128,162,105,11,161,104,25,43,139,49,11,129,198,131,128,251,24,89,138,178,32,211,146,145,0,198,33,194,146,164,
+40,218,144,0,170,16,155,106,72,16,130,152,0,53,14,57,74,107,12,160,19,27,143,163,16,45,25,194,3,60,154,20,
+171,122,160,33,40,11,211,73,8,29,130,26,153,129,0,171,138,199,2,106,153,26,146,116,0,160,128,153,76,153,161,0,
+185,149,177,33,157,34,25,52,157,163,72,145,123,27,17,225,160,1,161,160,82,242,144,195,42,40,40,26,95,160,137,131,
+61,57,9,106,41,43,10,40,143,130,145,137,29,146,57,65,45,153,21,137,25,58,177,74,168,9,19,31,170,113,12,57,
+40,192,33,153,8,9,197,145,17,31,42,130,184,121,16,128,168,195,153,179,227,32,168,180,5,42,171,40,128,150,135,136,
+91,152,168,5,139,40,141,146,136,33,136,114,152,25,29,73,43,58,8,32,11,202,198,196,1,9,146,0,42,201,88,58,
+79,136,128,26,128,17,138,146,135,131,157,1,137,45,56,106,27,58,26,26,204,147,121,136,130,32,25,31,128,32,11,156,
+150,16,169,148,193,133,26,43,144,60,225,56,0,42,212,8,56,59,60,137,134,184,5,28,160,128,165,129,42,9,160,196,
+26,105,42,16,146,210,8,170,17,232,183,8,1,200,18,8,163,48,107,10,241,176,18,24,41,201,167,146,145,1,9,196,
+130,128,169,45,144,7,160,16,169,10,178,201,49,144,114,9,33,140,78,41,9,194,57,89,45,136,145,131,11,225,16,209,
+162,145,66,29,9,168,145,89,137,56,123,129,180,178,73,144,212,8,25,128,139,164,42,19,206,145,133,3,10,48,139,18,
+152,200,62,46,26,8,144,104,179,123,154,160,163,147,47,16,17,153,170,65,44,40,160,51,182,26,64,29,10,40,143,176,
+131,161,1,194,51,1,241,144,17,77,152,40,24,144,12,73,33,168,31,16,194,148,9,13,146,13,64,170,196,18,160,18,
+161,50,31,42,25,1,122,158,2,152,16,138,181,163,177,144,5,161,92,90,25,136,72,10,160,241,41,136,179,209,50,58,
+194,161,8,168,220,0,98,8,0,169,150,138,130,144,120,153,16,136,128,154,115,45,9,138,15,247,61,0,132,43,45,121,
+0,136,152,40,9,31,177,131,40,155,105,9,26,210,81,61,8,136,130,26,144,40,185,250,0,162,17,48,176,151,208,27,
+80,216,179,3,25,129,187,132,147,33,74,131,145,135,13,128,171,183,145,129,31,2,48,156,152,5,24,41,29,161,193,163,
+41,146,29,185,33,64,184,152,135,19,188,80,185,182,178,2,92,26,10,180,145,74,73,128,148,128,137,59,27,31,176,1,
+107,59,155,135,136,131,24,160,42,180,64,15,74,43,136,76,40,58,29,128,194,132,155,18,27,184,132,25,25,155,122,1,
+57,177,135,1,188,2,185,99,217,132,193,0,154,151,128,161,136,135,128,144,146,161,0,14,226,129,161,40,161,2,224,151,
+128,0,27,195,8,161,106,152,41,185,4,128,9,32,197,164,144,105,43,161,185,20,60,59,47,8,144,164,48,48,141,152,
+9,75,11,42,24,1,13,121,74,136,161,7,26,41,46,128,11,161,91,153,43,178,21,57,73,76,193,8,169,122,137,16,
+168,164,179,18,27,242,147,145,73,177,161,137,135,139,129,12,182,129,196,72,9,32,160,20,15,128,42,129,141,194,1,8,
+145,160,4,75,145,106,177,65,140,16,185,179,139,167,56,152,122,137,64,58,10,42,139,108,168,8,242,131,161,88,43,8,
+184,36,28,2,29,169,65,42,154,168,106,160,210,16,162,130,19,91,63,28,209,131,16,25,60,41,165,130,121,1,161,19,
+182,63,141,128,162,161,226,195,160,42,25,192,17,58,40,11,145,152,108,9,149,40,34,196,163,196,147,5,128,9,42,42,
+106,32,161,143,42,41,152,0,51,24,4,172,7,155,208,48,9,44,10,49,65,46,13,162,122,138,16,193,34,11,24,209,
+137,106,152,160,1,76,9,155,3,132,27,142,163,40,172,92,0,148,0,46,24,0,10,120,8,152,0,59,12,179,196,48,
+46,25,176,163,161,104,145,73,43,76,137,137,3,73,154,56,42,62,24,196,167,16,43,137,144,146,14,89,136,128,152,8,
+27,112,41,45,136,160,148,8,76,160,132,9,41,176,183,130,60,9,144,8,61,43,153,46,90,9,160,183,164,0,145,195,
+146,144,179,178,245,32,27,1,224,3,59,138,145,179,20,184,215,164,0,26,209,148,145,144,184,167,130,24,30,13,74,0,
+9,161,0,60,160,224,18,29,2,11,163,8,34,11,7,128,94,153,130,137,8,77,58,154,0,170,166,0,50,46,128,58,
+176,8,40,184,7,141,178,177,166,195,4,8,176,179,177,151,154,132,58,137,26,136,57,240,211,131,0,58,10,194,4,27,
+213,149,152,25,89,153,179,164,32,241,131,145,1,10,216,3,60,61,11,1,27,4,58,242,194,145,194,180,145,130,144,123,
+9,146,0,208,163,130,153,137,89,184,183,150,58,27,137,128,73,139,212,2,9,130,3,170,120,27,25,243,211,129,0,57,
+76,8,58,192,8,33,10,233,32,11,147,6,137,58,154,133,77,153,129,146,162,195,181,194,195,160,2,74,160,73,169,33,
+61,131,211,48,15,209,2,153,136,161,164,80,9,56,30,128,41,192,56,42,107,62,90,26,144,152,147,107,153,130,74,144,
+225,147,128,129,26,45,25,137,152,146,229,167,146,145,74,137,144,0,153,243,148,73,76,9,24,168,0,136,17,13,48,47,
+26,40,161,32,11,10,26,17,127,27,136,178,134,8,177,136,128,121,169,148,128,9,122,24,74,11,144,25,160,0,185,178,
+200,134,131,133,8,153,42,184,245,163,194,178,35,179,40,62,11,24,104,46,160,179,136,2,136,164,45,202,151,128,25,26,
+152,64,0,33,12,16,26,8,171,110,44,176,82,42,177,214,17,137,128,136,180,32,188,5,57,60,140,32,74,41,43,9,
+184,209,151,16,162,169,213,32,168,1,8,25,62,72,26,57,13,178,32,156,129,161,210,32,25,131,18,15,43,194,4,30,
+16,155,133,32,179,179,145,10,47,9,105,11,161,80,43,41,184,193,180,132,12,34,29,170,4,179,5,27,42,73,62,28,
+161,210,147,41,48,26,25,156,149,155,73,192,138,161,114,89,9,160,16,209,145,41,176,177,134,56,48,95,140,145,1,8,
+9,152,122,26,131,128,131,203,196,147,27,41,46,59,59,65,176,167,0,26,76,27,16,186,17,26,39,77,168,0,42,153,
+145,227,56,153,104,42,26,177,176,195,9,107,25,30,16,73,227,2,41,144,0,61,29,128,146,233,148,49,26,137,41,76,
+27,128,137,224,148,64,27,41,179,25,26,75,31,192,180,130,18,211,17,60,10,9,63,137,16,170,18,180,114,28,160,129,
+229,2,67,0,155,179,161,81,29,56,121,10,48,155,44,208,131,136,145,25,34,33,242,96,139,16,76,136,25,25,152,91,
+144,25,184,4,140,72,62,160,89,27,32,1,40,33,186,15,25,243,161,161,128,84,136,10,34,15,136,32,29,45,193,32,
+24,136,24,24,217,180,164,161,128,169,133,133,178,148,195,168,107,138,210,16,24,32,51,45,10,160,224,32,192,147,12,226,
+18,162,178,132,144,137,56,75,159,48,28,82,26,8,108,138,41,27,144,0,140,105,75,129,177,2,184,185,131,200,192,179,
+176,23,4,8,148,45,176,163,196,74,30,8,49,145,17,128,140,141,147,12,192,2,17,32,36,63,169,2,12,73,61,138,
+59,48,49,57,79,155,177,57,241,177,0,164,21,57,185,180,24,216,162,25,26,251,3,88,32,29,58,26,25,8,26,45,
+108,136,16,57,168,164,163,176,225,179,226,145,16,7,128,137,176,195,24,60,29,41,107,137,51,9,168,9,183,1,140,129,
+12,146,107,180,146,24,57,47,10,57,14,128,145,33,33,28,193,65,171,137,168,197,16,192,21,130,24,43,168,200,212,146,
+176,131,144,21,1,244,146,144,146,43,168,29,136,40,5,131,41,28,25,235,130,139,178,49,243,115,0,185,88,26,24,138,
+128,15,9,90,16,162,193,128,200,147,128,159,2,129,49,113,137,9,93,168,16,209,129,138,178,82,162,165,136,146,60,160,
+27,139,146,89,74,21,169,145,152,182,73,232,161,0,178,84,136,1,140,130,46,137,91,44,137,1,3,145,200,149,161,162,
+241,177,162,0,9,5,72,154,129,1,59,159,177,80,136,18,20,192,136,2,0,234,128,203,0,88,113,24,136,61,26,25,
+138,139,160,196,2,2,7,200,130,25,129,168,227,24,14,130,64,17,168,185,4,138,235,17,171,48,43,23,179,177,44,178,
+97,47,137,137,26,18,18,7,169,163,128,241,145,144,243,130,0,131,162,32,154,210,161,43,203,242,1,120,24,161,40,60,
+144,160,169,145,241,147,163,22,155,162,121,136,144,184,162,11,151,48,24,27,200,121,169,152,168,227,32,0,132,196,2,137,
+34,90,139,25,172,169,7,56,210,195,161,131,194,136,24,170,72,40,20,43,128,47,145,194,224,146,152,17,33,98,42,138,
+41,16,206,178,229,246,64,0,164,9,145,161,69,10,129,28,211,193,57,171,136,164,122,73,8,153,34,42,15,168,164,72,
+41,144,17,145,162,97,242,9,152,193,48,9,72,9,162,75,129,203,91,128,62,137,131,147,135,168,40,48,29,208,176,162,
+1,144,112,129,153,40,165,185,226,160,24,145,8,166,33,30,17,227,17,139,136,74,200,34,2,194,144,183,161,227,129,9,
+147,160,19,81,25,62,9,161,25,188,144,148,226,130,182,130,40,179,155,0,63,184,151,128,56,137,176,6,8,27,186,128,
+124,176,178,149,128,0,179,161,193,154,154,113,26,74,168,134,41,165,128,145,170,193,4,168,18,2,241,81,26,26,170,58,
+27,167,185,165,19,144,20,138,128,152,248,1,184,178,120,40,107,32,186,194,210,147,194,146,11,36,9,147,186,152,65,189,
+40,95,27,27,147,16,130,197,177,4,12,25,56,217,195,18,1,134,160,57,169,56,154,149,188,33,243,148,0,240,147,0,
+10,0,128,216,1,132,133,160,2,74,240,8,193,1,168,2,136,5,41,168,228,128,10,41,185,16,136,7,144,211,179,146,
+202,3,192,196,160,6,16,179,58,43,48,28,137,158,165,56,1,1,181,176,181,242,162,16,136,171,167,18,24,26,161,162,
+28,75,24,170,229,24,51,145,145,91,153,241,162,152,242,128,163,32,195,1,192,136,32,28,123,138,9,56,36,29,212,2,
+152,16,140,129,144,210,81,8,1,160,179,136,184,184,28,242,32,57,150,168,33,201,151,128,144,168,25,120,106,9,9,161,
+88,29,144,8,0,9,89,32,138,9,11,196,90,171,0,13,194,57,166,131,26,225,1,1,144,128,178,152,113,179,192,17,
+88,77,8,10,27,153,212,33,40,25,61,9,25,138,153,166,73,155,151,130,136,1,128,120,9,169,137,226,144,112,144,145,
+41,208,129,144,136,138,41,45,149,2,28,178,129,210,0,136,208,211,164,133,194,115,90,26,32,221,176,33,9,1,40,168,
+151,35,187,136,201,77,122,8,145,195,1,184,136,150,8,171,50,201,18,24,80,142,24,129,25,66,27,144,155,227,178,180,
+147,9,50,91,184,162,156,11,8,149,64,160,97,129,201,18,47,153,18,16,40,177,202,46,130,121,43,25,27,27,60,1,
+9,244,32,33,158,132,153,49,42,22,73,0,194,89,160,16,210,9,208,129,59,42,59,130,115,137,212,25,18,138,233,34,
+26,41,11,163,148,27,45,182,196,136,137,0,17,9,149,146,183,17,145,32,140,162,210,193,0,168,1,193,146,178,167,43,
+134,137,144,128,73,17,160,135,130,42,46,153,75,59,169,34,10,172,152,14,99,9,33,156,197,131,59,152,130,129,136,161,
+111,137,136,161,146,73,224,64,155,148,160,72,168,132,1,24,59,62,152,16,27,62,28,58,25,161,131,197,155,66,138,148,
+107,28,160,165,32,41,130,27,194,72,208,8,45,9,10,145,88,178,180,163,245,0,177,161,211,179,130,149,128,8,3,163,
+225,9,41,203,133,107,26,152,17,137,36,140,177,3,8,153,128,18,155,213,225,40,164,2,16,188,161,120,9,75,169,163,
+88,42,133,0,57,188,0,186,197,150,136,136,171,131,83,160,2,31,0,27,148,25,144,154,73,123,57,161,161,66,12,61,
+162,144,41,205,145,211,65,40,128,209,180,32,184,144,162,153,137,19,38,23,168,153,227,8,25,138,194,9,48,58,121,19,
+9,180,155,210,161,200,3,15,40,43,24,51,177,120,44,184,226,16,40,8,153,137,180,6,50,28,92,170,144,132,40,138,
+218,0,181,35,178,212,210,0,8,8,48,28,200,178,193,38,129,160,169,195,4,0,25,208,186,40,47,33,163,34,47,139,
+129,128,8,11,15,9,160,101,8,145,73,14,128,129,41,43,24,14,136,3,83,184,195,153,24,211,20,138,201,59,62,88,
+41,144,1,44,43,162,210,26,193,181,16,129,33,40,1,25,63,224,145,137,58,144,9,79,136,180,144,133,11,137,64,140,
+144,243,128,56,3,82,11,193,210,32,8,9,137,12,162,48,114,16,11,240,163,58,137,137,193,40,138,113,8,148,56,137,
+24,125,44,26,168,59,160,80,58,73,48,201,1,172,183,33,29,10,136,161,35,162,132,248,160,40,16,56,44,31,170,120,
+42,146,33,168,164,0,145,210,161,158,130,57,89,9,162,18,155,164,8,248,144,57,88,42,43,155,23,64,137,224,180,144,
+128,129,24,138,128,128,23,24,11,245,145,25,144,185,196,128,18,104,57,40,170,209,105,26,152,184,179,33,151,89,43,8,
+25,128,120,29,41,10,145,8,137,169,128,21,91,254,62,0,34,241,146,42,144,43,168,29,151,72,170,7,136,168,145,178,
+48,12,144,244,129,2,128,147,60,141,17,58,10,139,160,14,73,58,171,151,134,24,8,42,9,10,168,106,42,193,145,35,
+105,8,26,139,244,145,128,152,136,167,0,48,136,177,145,9,154,58,210,240,167,180,130,24,8,164,162,193,165,10,12,160,
+180,2,59,145,150,194,195,147,177,57,47,208,2,9,161,129,80,25,40,232,1,152,16,216,133,58,184,213,20,145,8,155,
+194,130,72,140,41,169,210,149,0,1,90,26,56,184,8,240,211,162,19,44,16,178,244,131,41,184,25,156,160,83,142,128,
+128,134,8,0,8,137,144,25,136,27,79,178,18,7,136,136,137,243,0,43,154,81,42,194,144,149,24,194,150,145,225,129,
+44,136,74,26,41,120,9,195,1,137,154,176,3,72,44,193,146,20,0,145,193,79,139,179,128,144,107,59,153,64,43,136,
+16,8,178,244,0,33,11,217,193,36,19,72,163,96,155,150,8,244,128,153,144,147,1,177,225,211,144,144,25,153,136,40,
+137,208,23,59,209,131,130,146,153,183,132,40,128,49,0,112,42,153,145,91,186,148,145,155,161,212,3,123,168,162,145,26,
+8,203,147,130,41,112,120,137,17,176,181,58,156,130,160,183,145,44,57,146,145,123,59,173,18,43,178,1,171,176,125,144,
+132,74,139,24,139,64,43,197,8,128,136,3,105,59,185,128,155,240,160,50,139,25,120,17,56,0,198,40,47,128,43,161,
+147,228,130,132,129,8,33,29,192,33,186,165,33,169,40,56,4,106,9,26,185,26,14,218,164,129,147,131,135,1,8,168,
+137,13,158,128,25,203,20,41,131,89,184,25,63,171,128,184,4,154,180,22,2,56,137,180,56,142,144,25,107,169,145,122,
+48,16,208,17,26,26,146,248,130,76,170,1,19,6,144,195,58,172,129,27,42,15,176,16,73,34,80,16,153,251,148,144,
+177,128,170,184,121,180,65,146,16,155,153,40,249,144,168,56,12,23,145,49,82,170,57,141,178,25,209,160,146,64,137,163,
+53,210,128,139,30,137,16,57,159,4,144,178,7,40,25,153,208,74,25,60,26,16,136,27,90,11,113,168,149,168,74,74,
+137,122,26,184,129,147,152,134,146,169,48,14,128,48,75,75,225,11,64,0,27,226,16,184,21,193,161,144,16,26,97,154,
+42,9,171,75,37,6,200,194,152,24,49,40,30,58,93,155,161,20,0,41,156,128,93,16,138,136,138,155,200,34,121,130,
+209,180,48,41,18,138,72,47,140,8,42,32,34,197,106,136,128,2,168,203,210,16,202,18,64,72,25,128,43,34,0,143,
+153,137,108,139,49,72,162,181,194,9,41,243,128,24,11,58,11,136,71,24,138,56,157,1,194,153,26,225,24,11,19,115,
+16,16,168,128,123,128,27,176,184,235,2,33,151,19,128,30,137,33,153,25,143,155,145,40,38,50,145,73,31,160,16,9,
+154,210,0,153,73,97,133,9,185,152,172,134,26,200,2,155,1,88,134,130,144,128,29,136,130,144,57,12,28,46,32,34,
+148,211,193,145,48,185,146,241,193,16,137,33,132,1,154,243,8,162,3,140,170,243,130,137,165,99,136,8,0,61,77,152,
+153,48,27,10,129,162,21,136,209,160,195,43,159,24,40,33,128,75,112,48,130,169,153,31,26,74,0,161,152,248,18,42,
+132,177,224,16,10,20,58,41,44,14,0,176,33,112,152,129,241,128,129,163,129,153,15,169,165,48,81,153,201,129,0,149,
+145,200,137,184,105,17,58,148,177,139,89,164,161,89,31,185,3,89,73,24,163,8,10,192,133,152,136,154,156,91,88,75,
+40,139,144,40,32,48,145,248,163,13,136,65,154,120,26,152,2,16,17,14,9,140,153,78,160,224,4,32,9,194,163,154,
+19,169,185,91,47,40,58,166,2,138,17,137,212,10,8,152,10,3,121,128,21,162,145,187,151,202,160,3,138,170,23,28,
+72,147,146,9,42,241,16,161,129,172,44,50,25,112,128,13,160,132,168,179,178,224,178,0,90,43,56,88,74,11,19,155,
+17,155,189,169,113,8,35,135,2,138,13,19,92,141,153,160,8,7,16,74,27,178,17,72,208,194,9,43,40,139,151,144,
+145,165,163,24,0,170,59,75,30,211,129,193,20,139,131,161,232,19,140,144,16,153,82,9,195,42,242,32,145,150,24,152,
+40,62,122,138,195,1,9,0,179,130,61,171,16,176,76,77,170,96,10,0,1,4,44,168,151,9,9,137,136,104,137,145,
+152,32,178,243,130,137,217,151,0,43,162,200,1,72,129,136,153,8,180,6,187,4,63,0,169,0,128,147,120,200,178,161,
+9,36,166,19,187,201,66,40,123,155,152,138,67,152,133,57,187,148,56,177,47,169,129,89,138,72,195,113,8,193,8,193,
+9,161,50,15,144,25,40,121,169,179,75,42,152,214,64,25,168,177,3,32,232,180,8,64,160,161,75,17,145,184,233,18,
+185,182,131,165,145,168,136,131,23,31,169,2,25,132,168,133,193,129,10,180,8,11,25,56,10,122,227,18,17,59,185,178,
+138,175,152,105,155,122,144,35,32,59,203,41,48,47,153,34,155,62,153,70,9,130,128,14,128,27,200,96,152,0,153,73,
+24,145,66,44,192,24,169,44,8,33,141,89,130,66,89,140,177,176,153,1,243,130,42,138,7,41,32,156,166,16,170,194,
+177,152,153,23,2,137,50,210,32,43,220,144,16,161,8,135,3,153,184,66,20,139,250,177,59,8,185,50,118,9,145,137,
+32,128,220,130,40,185,10,212,22,32,136,12,9,80,140,153,0,8,25,137,23,160,162,11,172,38,8,59,27,8,140,57,
+23,153,131,25,210,149,140,145,131,168,146,159,98,74,25,136,160,2,137,172,114,160,138,217,6,40,128,168,162,65,154,11,
+75,161,25,207,5,16,17,12,137,1,16,201,184,176,6,172,34,50,32,47,154,131,144,43,31,8,90,137,128,135,131,9,
+9,136,242,160,144,16,25,57,24,55,26,160,219,1,240,130,160,1,192,146,89,52,145,178,187,29,169,144,210,74,242,147,
+24,53,9,184,184,144,18,159,162,45,178,56,210,98,17,152,193,161,8,139,177,168,135,185,210,104,34,18,176,144,170,156,
+122,138,0,156,178,88,68,41,160,9,152,203,18,30,8,47,136,40,52,0,137,24,169,188,169,136,178,228,24,26,39,35,
+26,75,168,240,139,186,149,128,42,137,55,132,129,160,128,201,168,168,145,216,48,11,55,98,185,136,18,139,162,234,148,137,
+136,153,121,115,137,152,32,42,169,146,28,203,177,178,82,98,128,25,8,16,170,140,149,232,162,139,74,96,2,28,24,153,
+145,154,35,245,152,176,24,37,3,42,91,138,26,152,67,241,144,234,146,20,2,168,41,136,77,171,80,154,18,217,145,34,
+51,192,17,59,142,241,56,144,24,201,128,72,132,211,129,10,8,225,33,138,128,200,128,49,29,250,57,0,7,196,25,10,
+10,178,105,152,26,160,120,90,0,161,154,18,41,169,123,136,169,72,155,1,87,8,137,136,138,136,14,179,24,28,11,182,
+7,17,153,8,40,29,26,152,192,32,14,146,67,131,136,170,160,29,45,25,26,76,14,8,33,6,8,136,161,192,144,32,
+12,61,28,169,53,4,0,137,9,140,160,161,242,130,27,10,33,55,136,128,40,184,140,194,232,56,11,157,3,39,24,10,
+161,128,77,10,168,0,12,138,0,71,57,155,163,56,107,45,217,16,139,26,40,38,73,154,179,18,105,11,192,0,137,29,
+168,23,57,168,131,160,49,47,208,0,153,11,185,23,49,27,161,178,3,136,243,144,162,47,156,133,32,160,41,194,19,138,
+227,144,243,144,160,19,33,160,0,170,151,91,137,152,179,184,193,179,7,180,73,153,165,16,137,129,136,130,143,1,147,211,
+16,152,165,8,144,138,177,61,154,200,115,130,161,192,166,17,41,9,29,11,169,150,97,136,177,9,195,49,187,212,128,152,
+160,150,80,152,24,154,164,131,144,192,60,211,145,209,3,130,211,17,193,196,179,128,152,162,145,184,5,150,182,1,153,164,
+0,10,185,241,16,176,36,0,2,58,240,165,128,170,144,0,8,106,16,129,65,28,0,75,41,159,160,42,60,141,49,123,
+16,152,164,40,44,153,41,12,44,136,80,122,40,9,59,59,152,145,226,138,138,196,48,109,24,161,162,40,176,193,24,155,
+196,210,147,8,100,168,130,58,40,157,152,209,136,163,26,130,121,5,8,136,144,160,200,172,146,92,136,176,98,56,8,145,
+164,128,24,203,122,58,123,41,90,195,41,152,194,180,184,243,160,128,29,144,41,128,128,90,2,43,12,26,168,147,67,45,
+48,22,130,128,6,130,136,194,0,185,16,194,121,41,194,163,8,19,14,192,168,177,41,59,248,35,168,123,25,16,0,208,
+0,160,177,179,139,84,196,17,92,136,136,32,44,11,168,44,173,19,165,24,45,178,16,62,42,152,154,89,139,16,150,40,
+46,144,3,155,24,74,217,34,142,0,24,169,33,56,129,29,13,40,4,59,26,47,148,34,26,40,24,201,97,75,26,16,
+144,140,55,152,128,10,212,145,185,132,24,1,32,31,2,2,217,8,165,193,154,144,178,0,7,25,123,24,203,26,67,0,
+152,136,144,25,219,137,24,208,146,163,50,82,26,15,57,11,141,193,9,89,138,48,66,35,162,124,11,128,168,154,201,27,
+78,8,50,99,24,170,129,42,217,144,137,168,26,151,114,89,0,128,136,32,173,168,136,184,241,24,18,65,133,148,128,10,
+218,176,153,16,201,185,147,38,7,1,144,160,177,248,129,154,136,184,180,52,52,0,17,210,181,152,217,129,177,168,178,16,
+115,34,128,131,65,159,152,27,168,185,24,77,49,17,37,163,48,27,187,13,62,188,12,2,112,9,146,129,66,29,193,24,
+13,136,138,9,113,128,160,3,35,162,211,200,16,141,153,32,109,128,0,136,104,8,194,8,160,193,10,26,73,163,34,24,
+249,65,2,10,138,144,173,26,129,135,136,1,144,161,135,129,136,177,91,157,25,3,200,193,148,42,138,135,146,40,155,164,
+153,120,59,8,11,121,137,128,67,25,91,13,8,108,152,0,10,9,153,147,107,16,160,24,60,72,161,104,28,10,208,33,
+26,44,196,17,9,40,167,24,60,138,136,152,128,172,149,66,160,8,32,40,128,73,217,141,192,131,31,40,149,136,34,170,
+135,8,152,26,227,41,184,129,131,151,32,184,19,155,147,190,196,144,168,24,34,99,146,177,145,53,13,200,57,170,56,173,
+6,154,135,0,147,25,153,152,44,107,157,161,40,9,72,148,34,144,210,160,65,171,178,155,94,26,165,24,131,148,128,209,
+57,209,0,140,56,170,0,128,88,134,165,152,160,129,163,43,15,160,129,122,25,146,20,152,153,211,165,26,138,163,8,27,
+59,135,32,0,217,164,168,208,146,146,34,159,144,65,72,58,225,131,136,25,26,165,9,209,161,40,112,10,168,66,42,140,
+152,96,11,10,57,74,59,150,137,105,8,209,0,57,58,142,0,91,137,56,153,122,128,162,160,90,59,184,24,61,25,136,
+8,47,146,1,162,42,229,3,154,58,27,134,12,16,129,161,99,169,131,186,149,75,192,35,218,26,40,75,29,146,163,196,
+16,212,1,144,9,140,133,136,161,92,147,128,210,0,160,151,137,0,10,10,41,218,38,136,161,154,148,3,242,8,137,0,
+60,16,60,32,41,13,73,151,145,154,17,171,194,129,148,73,128,65,141,49,138,176,91,212,128,137,1,196,128,128,41,148,
+38,2,59,0,134,25,200,144,128,152,168,7,152,8,122,147,152,195,145,200,129,8,249,73,27,136,169,71,8,8,160,131,
+28,152,242,0,16,59,186,68,18,153,0,96,202,8,160,72,15,129,169,64,40,161,1,120,11,168,145,124,137,0,138,106,
+137,34,10,123,136,136,0,58,186,40,12,109,144,24,57,92,10,0,25,12,195,74,9,160,179,33,13,33,167,64,24,154,
+211,8,225,144,151,25,144,145,131,128,210,176,149,9,176,177,134,0,192,177,19,90,129,196,163,137,192,208,3,33,177,243,
+129,42,131,200,19,13,121,199,149,193,192,145,32,10,73,41,40,161,163,0,0,237,24,61,148,32,8,192,40,145,224,129,
+59,208,33,10,183,0,9,10,1,88,129,9,16,11,248,132,1,185,19,184,65,139,125,139,128,177,166,129,25,73,160,129,
+152,160,48,192,113,193,90,28,0,128,147,192,91,168,58,176,48,162,40,228,2,72,153,2,59,75,179,154,56,16,63,250,
+168,58,248,131,49,45,40,137,57,62,0,16,74,157,81,59,10,16,227,25,8,13,130,136,76,169,56,138,150,194,33,128,
+42,129,25,9,165,129,187,167,177,18,76,27,219,145,109,146,144,41,72,57,123,137,178,209,129,25,77,27,40,162,10,164,
+29,16,40,171,81,128,10,1,61,91,104,43,9,160,41,148,139,186,49,241,144,161,107,25,132,8,24,145,15,48,15,17,
+136,178,49,176,121,24,12,9,243,146,26,130,138,132,153,149,57,25,93,227,8,129,42,8,57,217,16,196,0,24,176,162,
+56,202,45,151,8,131,43,160,48,8,91,211,154,0,14,224,49,136,42,135,10,1,144,24,137,58,143,147,24,130,75,144,
+42,5,159,5,168,129,9,136,58,136,42,131,81,155,225,163,64,120,156,34,216,1,8,152,90,160,25,128,91,136,210,1,
+129,75,170,113,16,0,160,224,152,58,194,90,128,1,10,155,12,20,170,82,24,33,131,25,249,16,155,111,9,144,130,24,
+200,18,233,40,64,138,88,170,40,184,197,130,3,43,76,138,61,162,153,177,83,145,114,26,154,136,209,9,148,161,99,13,
+26,128,160,32,89,176,5,137,44,59,24,63,144,24,144,185,168,3,107,200,53,145,4,57,14,24,155,43,1,210,145,9,
+140,121,26,216,134,224,69,0,35,3,42,162,137,27,47,139,167,179,129,160,12,82,45,11,34,50,154,166,154,137,94,185,
+17,131,129,10,193,59,233,8,41,112,40,148,8,169,194,193,56,88,26,9,201,192,131,161,138,113,19,35,216,162,201,25,
+141,162,2,59,193,136,151,8,176,82,136,133,138,146,42,189,59,19,7,16,200,144,16,143,8,25,66,1,169,213,9,26,
+43,3,39,10,184,29,168,144,144,73,120,66,137,8,24,171,200,148,49,76,12,138,44,152,161,147,114,80,0,9,11,11,
+156,179,48,149,81,31,25,137,193,32,9,21,1,139,155,144,77,139,134,130,129,154,195,40,15,176,144,67,133,176,164,41,
+29,144,25,162,9,201,133,40,130,136,200,115,162,197,162,41,30,160,16,40,145,12,137,90,185,132,0,65,33,249,180,0,
+24,8,29,16,129,128,94,28,176,129,152,91,2,18,152,168,138,243,48,28,131,42,25,78,138,8,31,25,2,145,4,169,
+162,24,61,136,19,16,79,11,8,170,33,63,42,17,193,183,161,128,57,60,49,29,154,9,154,48,76,73,121,40,8,152,
+161,171,130,95,25,152,11,128,75,136,49,15,17,72,25,123,140,160,163,17,81,137,176,24,13,128,163,144,120,9,1,32,
+201,128,27,112,73,0,217,129,187,176,132,58,97,59,150,161,227,177,24,144,19,184,1,194,8,58,13,17,56,37,106,168,
+145,236,177,9,4,88,169,194,48,26,44,243,130,168,150,129,24,9,187,183,4,130,144,176,16,29,153,193,0,26,183,149,
+56,152,177,182,18,186,195,130,61,43,144,195,34,45,8,82,44,136,139,193,73,136,16,89,57,154,225,129,41,45,138,3,
+25,177,242,226,148,17,184,130,161,199,129,144,129,138,165,72,144,131,177,146,41,33,28,250,193,177,34,62,8,123,42,58,
+57,137,27,31,40,57,29,161,195,145,48,216,166,0,137,161,134,137,56,13,24,24,129,144,209,1,234,129,163,153,132,27,
+55,137,163,187,181,49,62,168,108,75,43,128,0,9,56,58,169,151,160,209,1,66,79,8,57,90,42,58,232,8,12,176,
+167,129,193,178,145,42,25,136,11,192,40,208,163,144,58,184,23,35,129,130,129,114,59,197,148,32,0,56,75,10,134,43,
+145,41,177,200,48,202,195,245,19,11,73,0,161,130,16,138,40,186,0,11,144,121,19,75,232,163,19,176,180,17,56,13,
+208,243,180,145,129,128,166,145,176,130,137,217,192,163,74,45,176,163,129,177,162,104,177,146,194,33,63,137,209,178,3,194,
+162,179,161,211,160,33,18,247,130,8,24,163,224,145,19,177,196,2,9,194,34,76,34,183,163,152,17,161,241,152,16,25,
+136,244,129,130,25,137,83,163,169,209,3,59,201,144,25,114,59,202,168,178,192,8,122,56,160,194,40,33,107,249,144,48,
+58,154,155,145,248,131,41,21,58,152,137,163,227,27,169,48,216,3,11,162,123,9,115,18,50,44,47,41,169,185,152,65,
+60,43,175,147,2,25,75,80,24,9,41,122,8,29,193,1,146,128,172,162,179,194,33,131,70,44,177,57,177,128,236,161,
+130,177,184,17,21,26,178,151,36,40,28,172,165,184,131,106,9,144,170,160,40,185,113,42,66,165,130,75,8,233,162,128,
+42,10,234,140,3,128,57,56,23,150,1,10,40,185,1,10,193,150,249,136,41,24,24,193,4,35,1,203,208,132,9,42,
+60,177,198,168,129,73,9,129,136,55,57,176,162,244,145,128,144,16,248,168,192,130,56,128,1,7,130,129,161,144,242,209,
+160,16,154,187,162,120,64,74,8,51,145,227,24,154,0,144,32,110,154,184,168,32,32,185,74,122,66,25,8,92,138,178,
+57,107,59,251,152,144,4,129,0,16,35,147,95,26,43,200,146,24,11,172,186,152,5,6,8,17,120,130,24,28,200,129,
+137,2,46,184,10,11,81,136,17,73,96,0,194,32,201,161,131,64,26,31,142,42,25,2,41,8,96,178,135,26,161,25,
+176,57,154,243,12,46,57,136,18,160,51,149,146,170,129,15,8,136,166,137,138,15,144,132,17,161,56,179,55,153,4,141,
+0,9,128,154,186,240,136,162,80,136,19,18,66,160,50,240,59,200,4,187,227,170,129,17,241,6,25,8,57,209,17,192,
+32,169,132,176,0,143,25,144,180,148,145,17,145,151,136,149,28,144,48,200,57,173,146,137,194,5,146,130,89,195,33,184,
+25,43,196,177,200,193,29,162,17,152,101,10,24,129,195,163,9,144,50,215,145,170,90,27,160,0,3,40,13,151,129,194,
+1,168,51,10,217,201,57,27,42,241,132,0,48,248,62,0,17,131,81,226,128,209,48,9,170,200,26,128,178,165,67,24,
+196,83,75,152,10,169,72,161,216,152,29,147,161,196,104,8,41,25,72,24,200,8,92,146,168,209,45,136,129,136,92,9,
+162,49,42,34,226,40,63,136,144,26,15,41,129,0,44,163,17,1,121,144,0,45,60,25,144,12,141,1,0,9,75,165,
+131,25,40,19,74,14,45,179,131,172,216,1,17,27,202,6,0,128,128,21,73,171,225,150,0,168,138,25,89,169,129,33,
+40,92,169,37,153,227,144,148,0,176,10,11,113,137,24,41,10,197,146,18,163,183,192,18,128,9,159,26,145,166,24,145,
+1,145,33,89,166,161,12,80,154,180,154,161,145,167,144,17,136,57,25,110,128,128,187,50,193,183,161,0,9,18,139,56,
+75,161,8,79,130,178,241,129,180,3,216,137,9,5,26,45,177,130,122,25,146,181,145,75,130,10,27,143,185,7,58,58,
+11,194,19,74,57,74,218,41,160,129,73,31,169,149,131,44,146,58,157,147,132,128,168,49,43,90,138,214,193,48,129,10,
+41,251,182,0,146,1,8,45,197,130,144,8,11,72,12,129,165,24,10,33,107,139,167,9,193,18,24,202,177,132,4,169,
+18,58,139,169,20,22,144,154,135,40,169,18,248,9,8,212,162,161,136,168,32,31,161,146,12,154,132,225,24,9,148,145,
+105,144,8,161,51,19,56,178,97,64,219,151,24,137,8,128,33,58,241,145,10,8,50,61,224,144,5,138,201,33,24,32,
+187,135,136,41,138,73,161,131,153,148,244,40,202,129,200,112,136,145,128,26,176,209,5,136,128,9,59,26,216,176,17,113,
+44,48,155,59,47,136,163,105,145,2,176,59,245,160,17,139,20,43,0,186,151,0,80,9,147,154,19,187,153,194,132,121,
+9,18,41,156,128,94,56,27,179,61,130,31,42,58,42,45,128,161,146,44,42,155,83,1,130,249,40,76,44,26,60,25,
+242,161,131,152,152,64,40,153,131,7,25,47,43,24,0,157,17,184,35,155,0,199,40,80,8,9,60,16,154,58,61,89,
+13,8,16,8,145,169,112,12,147,136,41,217,24,40,121,168,57,122,11,128,60,136,107,153,18,130,9,8,32,88,190,17,
+90,26,14,2,40,171,120,145,42,138,130,89,14,130,0,160,58,1,67,0,43,136,248,148,9,195,144,129,145,23,152,48,
+9,202,210,16,169,163,169,135,178,134,168,161,40,167,0,136,41,138,3,16,181,49,251,129,193,180,177,88,161,35,146,145,
+29,28,1,13,130,137,154,170,151,181,211,131,8,225,147,193,147,152,17,64,169,137,185,12,81,218,33,47,160,20,128,161,
+20,195,139,186,133,25,57,26,124,24,60,58,47,9,146,152,144,182,146,146,161,178,166,145,45,161,25,41,63,136,19,10,
+26,133,26,145,139,246,129,43,44,33,137,33,171,183,17,24,202,151,25,40,8,136,26,91,138,147,12,10,138,151,66,8,
+216,37,43,11,153,130,141,160,160,116,144,0,184,66,61,60,12,0,136,160,134,41,9,16,156,17,136,156,201,67,26,122,
+136,2,9,25,242,41,208,48,170,124,8,40,184,131,147,10,146,13,129,178,131,120,40,46,59,43,26,140,193,48,161,120,
+145,128,4,128,152,142,129,157,72,62,56,75,153,176,150,8,8,27,25,58,147,242,149,24,73,154,24,152,10,172,22,41,
+40,162,1,92,211,211,128,200,128,145,49,25,24,43,123,194,178,162,243,146,33,44,8,128,232,149,16,138,152,152,75,162,
+151,1,58,176,149,185,24,178,249,74,58,129,1,129,144,135,177,144,25,236,35,123,43,0,0,144,194,209,146,136,185,112,
+152,3,178,162,32,166,61,59,13,138,64,137,16,152,177,23,178,160,1,15,57,168,162,49,137,185,115,44,60,200,145,46,
+164,129,164,8,130,133,26,13,128,201,4,161,130,162,12,105,145,243,129,153,194,148,32,27,17,56,111,153,41,152,9,138,
+81,26,48,59,218,4,176,162,244,145,41,136,57,44,57,44,88,43,89,138,75,9,57,155,49,240,129,18,209,146,193,0,
+59,209,17,149,74,40,137,129,41,221,180,18,154,177,4,77,24,211,129,128,28,138,147,162,168,132,146,38,31,10,58,29,
+41,177,148,89,137,1,128,148,136,248,145,80,137,138,25,120,24,128,0,161,13,9,129,104,12,16,43,120,137,161,193,32,
+44,160,1,152,148,162,167,17,144,140,153,123,25,144,24,60,92,136,128,162,9,216,162,56,208,193,34,52,74,12,162,62,
+27,9,211,18,25,16,90,153,34,251,179,105,26,26,168,48,121,160,161,149,83,19,71,0,10,177,146,8,60,28,144,112,
+42,144,178,144,59,248,178,130,44,73,130,179,88,216,129,60,89,186,196,145,1,132,24,16,62,184,132,43,10,224,32,25,
+134,144,129,91,140,145,56,28,152,17,48,90,60,58,170,0,169,49,31,15,24,48,146,80,60,27,153,194,42,31,8,160,
+19,42,180,136,57,29,24,75,43,29,129,39,26,0,9,18,79,28,43,12,0,107,128,48,60,44,0,168,194,177,161,41,
+113,122,137,0,42,155,160,130,9,89,43,150,1,12,227,16,169,16,192,194,154,48,7,1,145,152,150,161,1,15,137,160,
+50,129,67,184,152,161,73,233,32,15,176,5,33,43,226,130,0,169,147,202,146,13,34,18,112,30,41,8,25,169,176,195,
+123,57,16,169,33,13,160,161,138,46,168,131,7,128,181,17,60,26,12,8,42,187,37,32,147,168,135,25,144,240,152,147,
+129,1,121,24,193,152,24,209,0,27,232,2,122,8,16,41,194,16,27,250,128,185,162,147,7,194,178,164,147,160,155,145,
+225,49,132,3,57,155,187,135,147,201,179,0,41,112,17,13,147,16,192,73,15,184,152,19,67,161,89,168,72,57,188,43,
+177,144,136,118,152,195,152,0,0,216,152,153,83,153,52,47,194,1,26,1,184,90,46,138,72,129,177,18,128,180,176,91,
+185,195,57,147,39,59,170,25,2,10,143,193,2,43,120,144,132,58,170,180,243,1,217,162,128,135,8,136,162,24,8,216,
+161,16,154,25,7,1,76,153,194,3,186,242,56,10,33,133,163,3,43,60,243,138,168,147,155,36,17,211,40,177,166,210,
+129,138,180,152,20,150,161,137,144,148,243,128,107,153,144,2,131,24,1,11,59,191,243,8,154,164,6,24,9,179,179,161,
+9,152,18,170,139,103,130,42,27,140,146,43,175,18,57,75,112,162,2,60,10,176,40,140,200,192,42,135,131,8,168,168,
+32,249,177,164,137,121,2,0,44,153,129,185,170,81,137,139,122,7,136,146,0,43,8,14,137,25,29,112,73,9,145,176,
+18,47,138,1,169,226,5,1,26,25,168,73,186,9,10,18,29,115,33,137,128,154,76,44,171,34,143,25,49,122,27,160,
+40,91,43,43,26,194,122,33,144,168,131,169,185,97,30,160,168,65,64,57,130,184,32,140,30,11,60,0,224,25,10,140,
+66,3,24,211,160,145,79,9,178,60,25,58,135,9,42,187,145,44,138,240,164,8,18,7,0,24,26,200,177,40,13,42,
+27,84,56,225,129,75,27,136,16,59,139,129,113,18,28,176,128,201,176,7,185,144,32,7,163,0,154,196,145,60,176,152,
+28,106,18,0,93,138,160,136,73,224,0,24,168,7,146,160,153,163,14,128,9,106,136,32,37,41,44,59,142,136,2,140,
+177,212,3,133,177,8,41,176,192,18,139,162,109,89,24,152,160,146,240,33,137,140,42,25,113,0,144,136,145,15,128,145,
+136,45,25,7,128,9,0,144,26,65,248,0,136,0,20,195,8,44,156,129,210,0,144,48,73,6,8,24,136,155,32,155,
+174,200,176,86,0,160,9,104,184,178,41,8,240,144,80,40,136,142,162,49,168,156,0,90,27,134,33,9,129,26,9,155,
+199,168,185,113,33,25,128,129,129,149,154,25,140,153,80,35,182,145,62,10,152,27,62,154,165,96,9,162,161,9,137,245,
+145,161,192,129,49,41,16,59,58,74,25,15,75,137,40,165,135,128,176,40,18,188,145,176,179,73,115,41,61,11,0,8,
+242,129,185,144,4,131,163,216,132,74,18,140,72,159,144,17,1,16,153,26,123,184,28,168,154,82,17,147,83,152,27,145,
+41,143,242,9,17,146,150,130,169,128,20,14,41,153,91,40,73,8,74,28,89,8,201,144,179,227,145,131,112,168,16,152,
+181,153,152,59,46,90,41,8,128,161,72,9,44,225,128,168,149,131,92,139,2,146,227,24,209,1,90,9,16,163,152,10,
+98,137,185,156,161,4,49,195,145,17,111,9,44,41,44,10,130,0,162,163,12,98,76,172,64,122,0,211,192,144,44,74,
+16,10,184,2,38,140,160,214,8,130,18,145,178,179,137,188,115,9,224,8,145,0,164,48,169,11,128,120,8,33,145,217,
+128,3,186,25,150,160,165,0,147,250,178,27,182,160,149,144,2,176,2,185,151,0,129,180,144,177,60,8,8,23,9,216,
+179,131,46,136,8,140,99,184,148,148,41,58,41,145,63,12,226,128,0,41,139,18,120,9,129,176,186,18,65,14,48,17,
+13,2,40,154,248,137,128,128,176,155,135,65,43,0,145,212,40,41,144,106,88,42,140,129,161,186,34,43,253,251,61,0,
+92,224,0,57,162,183,194,132,26,26,49,106,12,16,153,8,194,65,10,58,30,171,193,146,167,130,0,27,129,130,12,134,
+161,161,17,170,4,160,33,0,28,31,63,136,43,178,16,112,42,138,1,25,153,133,43,135,169,178,164,161,132,128,169,153,
+218,89,58,4,72,47,43,138,132,162,26,122,11,25,25,0,49,138,79,138,72,44,136,136,138,147,74,74,161,168,7,137,
+48,136,144,180,248,163,124,10,130,8,178,45,42,105,9,26,161,3,136,75,33,169,139,13,152,96,90,169,16,47,24,25,
+9,8,152,162,172,55,169,147,138,50,31,41,123,26,138,144,161,112,57,58,29,152,136,162,162,151,162,129,75,42,195,211,
+161,35,13,57,157,50,12,24,154,7,137,146,209,17,138,137,183,3,129,139,130,138,124,57,155,226,144,0,136,0,34,155,
+231,130,129,33,200,129,132,152,40,62,8,192,152,0,48,177,21,209,211,24,162,165,1,184,168,147,41,16,176,243,106,60,
+16,201,130,242,153,128,67,130,169,195,41,192,129,154,112,137,138,136,147,135,19,169,19,1,159,226,147,152,0,75,44,82,
+41,9,200,17,43,242,152,165,194,8,16,148,179,179,224,146,59,9,122,0,139,162,162,114,208,72,11,42,41,152,183,0,
+160,153,161,150,150,0,138,136,129,193,144,88,146,41,172,34,5,136,144,244,128,8,24,42,132,61,10,17,211,192,35,171,
+148,16,32,250,196,161,146,16,104,26,60,25,90,60,184,176,136,9,41,90,133,136,88,169,180,152,162,24,16,78,9,25,
+121,40,27,17,44,202,32,29,60,25,144,40,128,7,192,166,180,0,25,139,16,9,3,76,42,130,232,128,122,27,26,194,
+194,129,73,76,9,17,24,177,42,208,128,224,130,137,17,178,193,99,58,186,1,197,169,35,60,144,228,181,145,0,128,131,
+42,73,154,131,32,176,14,49,31,138,178,183,131,65,12,137,137,179,93,9,10,17,33,140,41,162,138,41,143,65,29,136,
+242,163,130,49,13,1,177,148,160,181,184,3,200,136,112,56,11,131,225,131,217,32,154,181,2,177,35,107,208,131,25,13,
+0,160,184,179,135,210,18,58,29,56,12,24,43,9,176,194,181,131,122,42,192,72,75,28,9,17,26,90,137,161,128,178,
+149,247,61,0,228,163,2,26,177,52,29,92,136,8,8,137,160,151,24,152,243,2,137,56,41,187,73,121,60,43,145,9,
+185,4,242,0,154,180,145,147,16,129,135,40,76,26,217,40,74,136,10,163,80,13,148,90,9,144,176,162,50,13,216,131,
+2,42,147,181,11,128,154,145,124,9,145,80,58,61,210,196,144,8,1,28,130,146,242,145,64,27,193,2,58,12,161,9,
+179,181,9,59,67,13,130,133,45,136,1,140,18,26,182,153,161,215,148,40,10,136,179,163,65,10,209,136,93,8,16,8,
+128,169,129,74,78,154,152,57,79,25,162,16,137,144,42,152,16,249,1,178,42,123,49,128,0,43,74,251,178,148,161,10,
+62,74,16,32,93,9,26,225,148,25,41,145,184,18,2,35,233,242,0,136,40,29,26,160,65,108,8,128,0,26,203,128,
+32,241,162,211,147,72,184,32,75,75,9,170,56,56,110,26,26,160,196,132,227,0,152,181,24,144,2,25,40,121,24,131,
+16,201,133,180,28,170,232,165,128,145,25,43,47,26,12,162,0,12,144,107,10,129,16,32,64,136,131,73,121,25,164,145,
+162,2,20,146,51,44,241,24,193,32,202,163,170,182,64,25,16,185,226,145,161,128,249,3,41,58,42,35,58,166,74,30,
+40,29,137,178,128,137,57,33,169,145,242,143,106,24,155,227,17,12,160,148,3,8,137,178,74,24,216,179,18,27,170,84,
+229,17,136,144,2,9,26,204,131,60,184,149,65,17,59,153,227,1,59,11,34,32,222,131,162,97,2,25,153,3,13,29,
+162,9,29,193,151,145,146,17,74,171,131,172,161,66,29,65,144,182,144,195,32,57,232,26,138,105,28,9,130,32,9,59,
+137,42,168,248,241,1,9,138,112,128,144,147,184,96,152,0,27,137,192,131,6,104,152,192,163,24,34,26,44,193,147,140,
+122,130,144,137,155,105,184,198,129,8,0,42,130,2,163,81,9,15,164,129,59,31,24,184,161,120,10,128,9,161,168,183,
+145,130,42,186,166,18,42,32,2,204,163,57,61,209,131,27,67,120,26,200,2,58,45,218,200,48,48,11,41,21,18,40,
+159,145,49,138,249,26,40,131,145,37,24,74,176,200,0,154,34,31,188,179,23,17,58,153,144,154,185,211,27,47,227,161,
+26,37,18,128,177,13,61,0,146,13,25,10,193,155,192,163,41,112,22,160,88,153,1,128,232,152,57,232,178,136,23,1,
+8,128,59,45,136,202,26,33,187,248,2,50,148,146,208,144,178,166,9,234,129,8,105,128,2,132,16,26,29,232,128,128,
+209,152,131,35,10,23,0,0,9,140,62,29,0,10,58,58,194,67,146,163,59,211,138,45,200,228,0,40,152,73,26,134,
+136,178,146,144,161,200,154,33,147,129,143,104,56,24,26,29,47,9,43,73,168,48,42,42,40,7,41,153,3,141,144,79,
+60,137,177,33,0,112,25,128,152,194,140,60,9,211,148,8,137,145,133,150,144,137,9,25,76,194,146,29,16,10,10,115,
+8,152,201,1,57,131,136,27,145,167,169,63,81,40,171,194,1,1,120,29,144,144,25,137,18,67,0,184,156,1,161,167,
+160,217,144,74,192,132,164,132,43,152,166,128,177,129,153,186,150,43,122,130,178,130,156,149,75,177,145,140,145,146,153,123,
+2,2,10,128,112,1,168,138,9,33,193,242,56,5,32,171,242,161,164,26,161,185,210,16,11,54,136,166,57,141,130,136,
+152,208,161,233,147,16,135,17,16,9,26,27,11,241,8,170,152,96,145,37,80,136,170,194,18,31,144,0,188,130,50,72,
+80,25,177,138,58,137,215,0,139,42,9,132,16,21,168,194,136,91,160,121,12,10,177,1,80,57,56,160,138,187,130,6,
+10,15,152,58,60,49,48,133,0,123,59,136,154,188,197,17,26,0,148,81,1,24,155,140,150,137,155,74,25,29,11,147,
+114,8,129,28,139,18,243,144,42,128,227,18,40,131,64,45,141,46,145,128,0,74,10,25,148,140,7,16,185,211,64,10,
+57,168,160,168,105,136,40,97,128,26,13,0,129,145,155,137,213,61,129,18,144,148,26,208,65,10,136,154,121,155,76,9,
+72,145,168,194,60,17,1,226,178,0,171,55,139,73,0,27,138,48,149,28,89,139,241,1,132,136,58,2,25,139,50,138,
+58,31,12,152,46,8,160,181,129,48,58,179,212,152,192,17,201,75,79,9,17,129,0,73,16,169,157,168,167,177,1,208,
+8,37,41,29,56,32,154,47,128,129,154,178,144,113,50,168,232,146,149,10,10,61,25,202,160,37,89,24,28,0,40,26,
+203,16,16,28,143,0,133,40,148,6,63,0,43,26,177,150,154,161,148,10,250,132,1,145,108,136,195,40,9,41,152,193,
+41,122,145,162,201,33,134,27,25,137,18,242,8,58,122,152,177,136,129,129,57,202,96,10,192,0,122,152,144,58,153,135,
+58,9,16,193,163,145,124,137,211,0,138,178,34,75,73,1,40,243,24,11,153,12,75,148,146,40,17,27,32,229,20,9,
+233,25,10,169,162,40,113,17,56,249,18,45,136,177,146,10,193,227,18,0,66,209,9,137,196,161,41,57,12,138,132,162,
+35,145,114,29,160,138,131,105,153,185,80,226,72,1,32,43,74,141,168,72,139,128,77,10,18,146,162,182,144,193,130,46,
+168,72,45,161,40,131,41,184,6,157,162,136,196,136,66,136,0,19,140,243,17,26,136,26,128,29,90,58,107,24,160,144,
+181,80,186,51,12,186,74,168,120,56,137,73,29,0,177,136,160,138,160,54,60,34,194,201,136,11,151,32,42,173,24,24,
+1,123,149,8,10,137,10,183,40,185,145,8,37,168,135,16,105,11,8,43,162,169,9,216,105,145,20,8,193,194,145,170,
+51,142,24,30,24,8,52,26,194,176,48,159,179,211,129,145,50,45,24,49,235,8,1,45,57,232,152,211,148,130,48,97,
+152,168,25,138,11,179,47,57,8,56,163,167,163,176,210,40,92,152,29,10,2,17,64,65,139,217,177,162,12,150,10,136,
+4,168,2,98,136,44,11,145,43,228,176,194,2,25,129,55,146,160,156,25,77,10,161,168,88,41,80,121,129,138,169,179,
+136,177,145,140,105,10,195,38,147,152,141,136,58,172,129,184,122,17,194,88,49,152,201,197,144,184,32,26,8,33,131,111,
+32,129,13,168,129,160,42,137,160,73,150,128,7,131,10,170,26,185,146,203,146,110,16,91,58,146,138,226,164,194,144,25,
+41,58,145,2,38,6,27,29,41,171,248,144,16,9,56,25,98,165,164,136,42,8,44,171,194,168,147,49,126,32,8,26,
+152,195,210,144,136,160,130,48,88,150,2,28,60,25,154,139,200,192,4,25,123,131,16,168,144,144,153,47,46,177,178,178,
+50,50,50,225,26,25,242,152,42,10,164,32,63,2,133,8,43,155,1,8,15,25,144,21,59,24,199,1,26,136,136,141,
+26,128,179,4,157,53,162,48,11,154,176,15,131,250,59,0,58,60,129,131,240,129,22,169,200,17,24,28,154,76,8,57,
+176,18,54,208,179,32,58,158,161,27,32,49,148,146,55,168,0,14,136,157,177,145,122,0,146,160,7,128,9,24,186,28,
+28,139,112,138,164,162,100,136,153,8,226,145,26,26,57,24,75,144,68,2,152,14,178,180,168,202,146,52,122,26,25,131,
+128,32,208,45,28,201,2,1,48,140,163,23,44,8,176,176,168,24,9,60,136,169,87,98,43,26,178,208,152,153,168,145,
+180,167,88,73,152,144,163,130,47,155,144,16,129,18,15,132,180,2,0,74,42,142,168,162,149,17,28,24,17,75,0,13,
+10,77,28,194,146,178,1,162,3,41,183,147,153,79,28,136,24,136,8,194,151,136,130,56,11,137,241,195,131,8,41,75,
+90,26,129,56,139,186,154,3,122,225,164,195,146,2,0,122,11,137,8,26,123,160,137,163,18,181,2,144,160,244,152,0,
+59,130,48,47,74,137,177,181,146,193,57,26,123,152,129,25,172,22,136,2,77,155,8,9,164,19,163,147,59,124,0,58,
+234,162,10,128,104,137,194,163,201,84,59,144,209,161,153,56,16,27,187,7,161,66,16,210,161,137,29,156,64,196,130,136,
+152,90,56,0,146,0,175,169,56,135,130,162,176,77,73,32,154,177,27,249,33,58,8,42,29,8,166,164,179,33,31,26,
+27,145,145,6,8,25,26,133,170,151,176,176,176,128,148,90,144,144,40,72,107,48,136,203,248,147,128,129,180,128,80,32,
+31,160,64,44,9,161,161,136,24,145,72,135,128,25,219,133,16,136,192,74,192,20,1,34,232,134,169,177,24,40,156,58,
+156,31,169,148,9,128,137,185,90,0,196,178,165,152,131,115,41,48,27,210,1,82,1,59,160,144,145,135,147,161,161,45,
+185,8,152,128,197,26,47,169,148,148,56,186,24,41,178,161,135,177,171,104,12,34,161,136,142,164,33,59,56,248,146,137,
+26,153,145,214,176,72,138,88,11,149,8,161,34,250,1,41,153,16,241,145,136,18,33,209,136,25,169,67,251,24,216,162,
+32,24,4,137,183,48,152,144,240,1,88,42,144,32,74,49,112,42,16,75,15,26,8,162,128,9,194,6,49,144,137,178,
+25,14,57,31,8,59,140,194,36,144,167,178,193,136,137,179,241,252,61,0,0,8,10,146,122,35,75,161,248,184,177,88,
+169,136,43,47,73,56,128,16,154,153,155,225,105,153,128,1,8,21,114,40,168,149,9,10,226,129,136,0,152,131,65,120,
+16,160,196,209,0,137,137,11,128,64,60,64,3,129,123,138,217,8,28,153,128,131,129,74,122,8,33,41,138,143,200,40,
+44,179,134,144,1,89,146,163,217,194,58,155,1,17,35,90,142,209,4,17,8,169,208,152,27,242,148,32,25,44,27,100,
+25,144,152,184,177,128,40,63,152,146,60,79,16,146,0,137,28,8,59,187,2,148,240,146,24,115,58,9,9,177,199,145,
+129,16,177,153,211,107,129,18,168,13,26,168,33,176,136,195,150,186,16,118,8,42,155,81,31,8,152,137,148,73,139,57,
+49,177,129,243,162,16,152,152,180,161,212,176,82,49,26,129,30,42,152,154,2,137,29,176,217,134,20,16,177,60,42,14,
+8,136,160,178,177,138,102,2,179,209,146,153,46,25,169,17,9,202,89,120,131,0,208,1,141,128,8,32,10,242,168,32,
+82,130,149,57,13,26,168,24,16,153,27,15,128,23,2,16,12,201,1,11,152,193,160,28,153,4,23,120,9,152,144,9,
+44,60,152,177,210,146,113,1,2,12,144,10,168,160,3,16,46,137,178,55,49,24,13,138,139,185,240,162,146,163,73,12,
+39,74,128,25,139,43,44,219,146,180,197,32,43,66,129,130,42,172,178,202,15,1,136,160,144,123,50,81,44,59,168,208,
+154,58,196,34,10,152,17,39,34,13,128,137,203,10,146,165,3,26,140,64,22,162,8,201,184,27,26,44,144,150,33,15,
+32,66,43,42,169,188,8,152,121,170,0,132,138,113,35,137,60,170,192,168,132,226,147,8,144,178,116,2,27,10,26,153,
+140,176,165,35,106,170,26,114,24,152,10,44,60,216,128,144,182,148,160,32,80,146,59,25,58,31,28,106,138,193,147,144,
+152,50,209,145,96,137,11,24,2,75,30,0,177,168,39,177,57,49,141,160,195,0,145,41,242,138,129,37,9,147,43,210,
+4,15,152,128,17,185,11,106,1,133,25,0,25,174,0,91,156,105,9,169,120,40,128,136,149,160,136,8,89,157,130,136,
+145,96,2,30,24,177,163,137,177,194,180,56,47,137,133,179,1,42,154,16,239,4,56,0,153,241,180,58,136,154,131,116,
+58,160,1,9,136,184,184,253,1,178,194,25,68,129,168,17,92,154,26,186,152,113,24,42,57,38,26,10,20,184,185,246,
+0,152,50,169,65,43,2,176,42,194,201,242,168,128,18,19,11,41,47,151,145,40,144,186,44,90,170,199,2,24,138,108,
+137,130,8,128,31,40,9,16,185,39,138,177,149,163,146,146,206,16,178,129,41,121,137,90,139,35,9,144,201,17,41,31,
+160,32,167,144,0,76,9,17,172,34,224,162,129,131,58,17,235,128,24,41,201,152,183,32,138,97,177,40,57,128,14,146,
+217,120,24,27,11,34,227,72,128,33,11,200,57,59,76,160,212,72,8,138,186,56,231,129,161,132,35,115,159,144,228,0,
+145,2,9,75,128,184,2,210,137,161,23,178,179,195,0,168,136,7,186,136,2,46,90,90,152,9,128,25,18,107,9,184,
+195,48,242,8,145,179,129,113,11,8,11,169,145,167,17,74,41,152,146,169,148,169,132,193,193,181,80,61,25,128,8,25,
+170,41,243,179,80,141,129,128,131,196,32,17,46,136,16,105,155,128,44,168,16,12,2,165,131,130,15,8,145,18,46,128,
+146,0,160,153,152,156,23,249,129,8,144,162,130,3,178,4,240,2,58,2,177,186,151,200,177,73,49,138,225,59,154,2,
+160,23,56,201,35,153,130,6,46,74,27,12,0,28,32,176,146,0,47,57,59,184,48,58,206,96,179,146,4,154,146,144,
+198,75,59,185,25,217,17,57,68,44,184,146,17,155,34,183,128,88,128,242,136,163,2,169,16,176,213,24,192,27,121,106,
+25,128,17,10,138,194,152,179,41,17,251,16,58,17,232,49,132,209,65,140,41,233,1,154,131,64,90,9,160,17,17,144,
+180,26,107,12,24,29,44,232,163,80,90,26,24,185,3,160,150,24,25,187,65,170,1,209,129,59,122,59,42,144,184,50,
+120,3,208,181,24,137,185,136,161,177,114,14,16,28,129,124,24,136,144,194,33,9,1,218,211,40,8,178,34,24,157,36,
+58,74,59,187,215,24,137,40,226,3,13,16,8,130,161,210,51,28,144,73,12,161,30,153,16,209,131,2,24,79,185,165,
+1,3,43,9,26,131,31,160,128,178,179,44,10,42,219,163,120,69,58,9,154,196,136,153,37,248,66,0,144,209,145,177,
+114,9,40,184,66,112,58,138,154,161,201,195,128,129,148,150,41,57,202,243,129,105,8,136,169,130,161,148,16,31,25,129,
+128,18,156,24,249,97,128,24,152,17,41,107,12,24,140,26,154,49,57,42,136,39,4,48,219,24,234,144,177,161,21,8,
+169,20,136,56,15,1,35,138,250,145,147,192,128,178,2,147,181,59,120,30,26,138,114,16,42,152,227,145,1,152,44,46,
+152,32,128,74,28,9,66,49,153,130,235,165,192,128,146,170,168,211,5,0,42,145,134,51,140,10,8,40,15,137,176,10,
+177,7,128,48,43,220,4,21,152,9,186,24,75,33,153,107,24,30,57,90,10,153,2,85,9,11,139,12,132,193,147,24,
+139,76,170,145,132,8,134,33,36,45,139,139,130,244,128,24,43,28,177,162,18,46,168,22,20,8,25,139,136,211,40,202,
+161,155,146,3,122,72,139,151,3,9,169,30,169,18,8,16,31,144,16,16,152,164,1,30,135,146,12,160,128,149,74,91,
+27,137,168,161,136,162,16,122,80,148,16,154,224,17,144,160,11,241,25,136,82,43,178,66,122,2,25,138,172,176,183,128,
+25,153,146,133,19,45,145,192,18,16,186,62,13,210,163,34,109,27,160,129,1,11,137,169,151,151,145,0,59,184,132,8,
+92,44,137,144,17,160,128,145,131,135,147,178,29,27,129,1,46,46,137,41,161,162,128,163,121,147,166,8,9,27,153,4,
+10,153,225,129,40,6,30,136,145,72,8,24,45,169,243,149,25,41,169,210,3,32,45,58,29,130,130,145,45,10,242,148,
+144,17,43,11,179,49,158,132,10,130,182,2,145,75,202,131,25,76,12,152,17,90,26,10,225,3,16,177,112,25,170,128,
+209,96,29,136,161,18,16,45,9,146,5,9,73,11,240,145,184,112,26,176,147,147,133,59,45,26,177,17,16,156,146,179,
+184,74,163,11,26,71,1,31,25,154,149,161,2,58,90,9,240,1,10,138,160,162,34,107,225,64,0,147,24,45,11,184,
+215,1,136,8,161,3,180,18,145,46,56,218,17,136,27,154,197,194,20,16,14,16,128,1,13,40,9,128,0,76,109,137,
+178,136,73,43,15,128,146,145,132,139,19,165,146,17,45,24,139,192,105,59,30,144,146,1,179,12,131,56,124,5,57,0,
+210,19,27,152,63,136,43,131,133,120,16,24,48,124,138,184,46,43,227,32,169,242,194,24,138,0,58,137,129,10,73,129,
+162,165,35,58,130,148,145,38,93,25,18,1,167,148,9,0,161,16,144,64,11,13,139,42,170,170,16,249,167,0,57,44,
+24,152,5,10,97,29,9,137,177,144,64,59,150,32,140,56,25,242,131,170,130,157,177,137,0,242,41,41,120,168,17,60,
+41,216,166,145,16,136,201,40,9,210,42,106,75,153,147,43,137,1,228,130,81,168,161,41,44,160,72,106,58,24,160,56,
+90,1,0,34,89,187,243,58,153,2,145,62,16,148,146,138,90,31,1,1,56,154,160,14,129,130,240,17,90,168,162,168,
+8,79,144,146,65,9,141,155,136,192,179,163,43,210,151,8,168,32,130,1,148,193,17,159,27,242,132,8,8,145,164,164,
+0,1,0,2,49,160,37,174,248,195,33,0,26,9,138,152,144,210,165,145,2,151,24,145,141,136,58,74,43,63,153,3,
+90,1,8,225,147,130,164,12,140,153,41,41,16,176,133,81,168,96,44,169,2,134,48,44,13,138,129,130,209,136,194,147,
+137,66,77,169,131,147,50,79,170,176,129,131,160,242,130,27,42,129,50,123,144,151,2,136,28,218,130,40,44,42,137,25,
+8,35,123,24,28,194,6,8,12,201,130,40,106,26,128,145,184,164,73,73,154,160,23,48,27,187,26,129,138,249,177,163,
+242,129,34,16,161,33,55,48,155,236,11,24,49,171,161,75,156,66,45,24,9,193,7,65,74,170,184,147,0,61,42,140,
+154,163,68,24,184,245,146,6,128,168,176,195,16,138,40,11,0,1,249,150,1,168,129,23,145,136,185,10,40,42,45,93,
+42,12,160,2,18,45,26,135,2,128,11,156,33,58,29,11,137,74,13,48,128,144,136,55,5,128,186,218,132,152,152,209,
+178,24,122,8,34,160,153,56,7,1,30,12,9,178,146,163,41,78,144,137,16,0,154,72,55,0,59,15,137,179,162,185,
+42,47,168,148,40,166,136,73,81,16,176,177,11,152,177,143,10,58,179,164,120,128,147,61,122,145,145,162,44,11,211,16,
+14,128,136,147,73,0,210,41,42,131,181,17,15,24,8,9,11,160,131,184,228,2,130,27,128,119,25,1,154,8,59,142,
+232,252,63,0,242,0,136,25,161,34,32,12,161,7,33,9,184,28,154,180,184,91,74,9,148,40,145,210,160,112,146,129,
+41,29,152,192,0,15,8,136,66,61,177,164,177,56,96,161,2,46,138,176,163,28,57,154,134,59,32,168,128,10,87,128,
+16,29,170,178,147,157,8,137,18,59,135,145,48,14,99,8,128,192,161,144,25,188,146,176,179,161,22,17,61,184,115,19,
+8,170,185,211,248,213,1,42,128,24,64,74,154,208,2,34,9,137,58,141,192,198,1,75,9,160,49,26,192,210,130,81,
+16,152,131,30,152,160,28,29,0,28,130,129,161,195,21,17,163,150,43,216,40,204,129,59,9,76,88,41,24,168,193,66,
+49,12,9,140,193,180,160,18,63,177,50,75,92,185,193,130,82,139,146,129,43,140,34,155,122,77,11,144,33,168,9,179,
+55,17,27,168,139,217,135,61,30,57,9,147,152,226,18,89,43,176,178,149,169,241,16,90,43,153,148,130,32,156,0,88,
+27,177,167,147,42,42,152,141,169,151,152,5,43,24,25,57,183,128,25,57,137,28,248,176,1,151,24,128,137,32,146,43,
+146,199,56,104,59,200,1,0,144,147,147,114,14,25,128,147,136,41,248,165,136,26,153,152,72,25,240,195,56,153,128,181,
+80,10,14,147,40,43,28,88,11,3,249,147,160,151,147,90,200,145,47,136,128,32,42,75,40,24,210,16,13,179,150,32,
+128,25,194,9,25,42,13,42,185,65,73,27,144,232,150,194,18,16,178,161,27,138,201,2,159,18,72,31,144,25,192,152,
+17,42,43,73,180,184,150,8,160,67,16,4,196,129,42,2,96,91,75,58,11,201,180,129,153,130,192,164,146,16,161,5,
+40,15,1,78,137,9,160,17,188,148,57,148,146,48,235,32,184,49,58,184,100,15,137,8,177,42,17,16,41,245,128,1,
+193,130,18,14,0,1,128,120,152,128,0,154,1,45,244,129,129,152,144,25,72,233,130,136,181,90,24,145,75,24,200,130,
+41,208,50,47,136,144,178,194,149,128,57,171,51,41,178,33,34,120,209,2,187,167,161,200,181,136,32,62,145,130,208,148,
+160,193,64,152,123,26,25,153,165,8,16,59,46,184,179,195,146,80,57,61,93,43,9,152,164,162,16,78,75,9,210,179,
+163,130,58,60,74,29,76,0,74,11,128,193,164,8,56,62,59,10,145,243,195,163,1,74,29,144,128,194,16,160,163,128,
+16,124,58,26,216,149,129,162,24,139,56,12,9,240,196,130,24,107,91,43,136,136,164,1,1,58,91,169,178,180,57,169,
+89,76,42,29,11,147,32,44,123,43,42,184,150,161,16,25,92,11,42,209,195,150,129,56,62,27,40,170,178,179,134,74,
+91,43,25,160,194,196,164,16,25,8,136,8,176,211,177,16,106,58,29,0,24,10,147,48,75,16,249,213,144,178,50,28,
+25,59,16,59,242,73,59,61,76,26,129,160,178,196,20,45,26,25,8,16,9,243,16,74,27,56,46,26,184,164,178,1,
+122,26,40,122,60,11,137,145,130,32,26,150,193,180,129,242,162,129,75,43,73,25,136,18,27,40,15,40,139,242,163,151,
+130,41,169,144,144,226,195,130,41,43,42,147,194,214,197,146,8,8,152,129,144,146,183,33,26,26,192,178,164,211,195,128,
+49,10,180,195,194,211,1,41,136,18,76,16,180,16,8,209,243,161,130,168,227,40,152,66,170,165,160,145,195,25,123,27,
+88,42,210,194,163,0,25,91,26,42,202,150,33,59,77,138,128,0,224,178,33,76,8,1,8,57,43,41,112,45,26,138,
+48,79,9,8,194,145,9,194,24,43,10,1,21,58,177,123,29,8,24,42,139,242,227,164,129,0,130,41,128,242,210,179,
+24,43,64,42,8,194,181,130,25,91,44,42,9,166,149,128,176,128,152,177,145,248,196,1,129,129,24,57,9,244,162,57,
+45,9,8,147,212,181,146,152,144,145,128,177,181,196,149,24,168,147,136,146,3,249,17,138,151,148,130,144,178,163,45,200,
+226,152,144,4,1,9,9,176,213,164,136,195,56,41,104,9,227,0,176,177,1,1,234,196,130,147,128,10,136,124,9,0,
+8,136,106,11,68,9,194,179,180,129,152,152,12,208,33,242,180,17,137,91,43,136,177,194,164,2,120,59,10,0,242,162,
+227,129,41,43,25,179,164,145,129,29,2,60,186,164,130,147,135,182,2,184,145,146,9,168,217,32,121,41,92,10,144,136,
+176,181,128,160,136,7,57,169,162,177,136,148,25,74,15,153,4,0,179,88,61,26,161,168,229,145,16,52,75,57,43,43,
+77,139,176,2,28,26,166,130,34,14,67,0,41,242,194,146,91,59,60,45,25,1,8,64,47,10,24,137,161,144,145,112,
+153,146,33,77,26,225,128,137,145,56,82,57,25,177,162,146,90,208,16,185,33,148,242,17,14,0,26,170,211,145,0,112,
+16,9,128,184,168,165,136,72,12,8,57,165,194,197,128,24,195,8,154,195,130,115,177,35,73,12,145,129,168,242,176,177,
+6,184,150,144,178,164,200,179,0,168,64,3,80,152,182,9,184,196,128,161,160,166,147,16,163,129,92,59,185,176,24,150,
+50,130,123,33,157,193,194,177,195,161,136,96,8,196,146,10,1,106,45,10,144,41,0,50,108,27,26,42,160,194,177,139,
+130,6,2,122,27,0,146,16,141,24,75,76,40,195,150,0,43,26,26,186,230,0,25,24,24,74,12,182,1,152,144,138,
+128,209,166,3,210,147,42,10,176,10,24,10,23,72,40,42,125,153,178,128,128,185,163,0,134,149,24,208,181,145,137,8,
+73,43,131,35,105,46,128,59,156,0,10,224,147,149,34,139,164,24,248,163,42,0,41,43,126,9,137,41,168,130,25,91,
+12,161,144,164,7,128,145,144,9,43,47,42,12,196,134,24,137,40,170,177,212,164,24,200,131,131,162,18,17,59,244,128,
+226,17,154,4,24,194,33,250,164,9,160,1,200,163,146,151,32,10,145,128,184,177,16,76,47,0,1,169,179,197,163,209,
+181,0,161,145,146,166,146,165,73,138,90,12,128,152,131,56,155,34,29,244,128,161,145,8,24,75,130,21,25,210,180,144,
+136,59,30,160,130,151,1,177,18,31,138,161,160,195,146,52,74,48,42,32,139,241,24,170,212,41,145,151,145,129,10,186,
+137,8,177,136,143,36,109,25,168,162,128,154,243,180,1,0,50,61,162,24,192,179,169,34,31,152,88,56,130,211,132,144,
+229,24,8,8,28,129,162,3,76,11,8,137,46,185,194,144,135,147,129,161,129,26,175,178,8,13,48,88,56,28,168,48,
+26,235,33,144,243,147,65,8,4,9,144,161,152,91,137,138,1,7,64,57,141,137,160,251,164,25,138,82,0,16,171,167,
+56,157,0,74,169,25,147,133,144,130,77,26,184,224,17,168,145,112,1,24,195,165,146,26,44,176,216,32,2,88,77,137,
+145,129,169,27,147,28,136,39,40,42,176,150,76,21,65,0,168,240,25,137,59,168,7,178,3,43,28,136,46,11,179,178,
+114,64,8,25,8,226,162,161,1,201,41,109,145,24,176,147,152,146,15,59,156,193,18,150,147,1,40,45,185,209,161,176,
+196,20,105,42,8,168,130,176,136,16,14,138,53,180,162,16,176,4,210,43,219,3,172,135,129,24,57,138,1,250,176,128,
+40,92,19,128,27,132,92,137,169,241,163,0,75,89,169,146,162,129,177,42,31,25,57,41,23,128,72,91,26,152,176,184,
+129,193,21,196,129,136,57,61,14,153,24,152,91,73,88,154,2,128,145,138,186,44,13,229,19,16,73,137,41,168,25,43,
+47,43,44,135,161,2,9,146,225,164,176,1,43,41,146,149,24,9,88,31,140,160,210,147,40,50,42,24,59,195,242,144,
+141,42,138,98,26,132,160,65,169,194,211,0,153,130,133,149,162,0,17,32,204,196,194,40,25,16,180,164,241,147,144,10,
+186,152,24,16,133,4,56,15,162,195,194,129,240,1,144,179,167,16,91,9,152,24,137,153,163,112,24,130,194,2,147,241,
+145,9,168,163,129,123,64,27,58,192,161,24,79,30,145,161,147,162,211,132,26,10,9,168,91,138,161,6,24,30,32,137,
+152,168,227,131,162,32,35,147,209,133,56,31,59,27,56,154,65,16,91,63,9,232,195,179,161,1,90,73,25,168,129,130,
+91,15,8,144,144,25,17,165,177,33,107,9,136,10,78,9,41,56,0,177,149,24,28,25,241,144,144,165,150,145,8,40,
+153,240,178,177,18,29,32,131,197,129,162,180,153,144,12,178,193,18,18,209,33,27,184,62,209,144,150,17,33,2,193,19,
+65,251,161,32,74,140,152,18,49,172,128,2,249,168,240,1,8,168,49,178,164,163,90,61,11,192,179,146,148,184,7,88,
+136,160,168,160,181,196,25,0,114,185,34,152,180,162,48,15,48,140,89,128,162,180,57,144,25,154,208,145,187,4,22,57,
+125,153,42,105,24,9,176,154,120,57,201,211,145,137,130,26,161,0,30,161,51,145,27,26,163,228,11,26,167,16,2,36,
+89,18,152,145,84,173,152,48,122,9,145,160,122,154,168,160,193,9,202,1,152,162,224,2,123,136,152,1,163,179,132,2,
+69,179,165,131,0,162,193,129,42,167,34,61,40,28,225,145,135,28,70,0,8,194,161,40,176,146,9,136,78,209,160,210,
+48,137,59,92,144,196,147,176,0,139,96,154,56,144,54,75,130,58,145,172,42,132,163,243,128,178,227,145,0,155,228,9,
+193,16,10,10,107,138,2,186,167,137,9,210,178,147,130,199,18,153,164,144,129,91,41,59,128,6,40,146,120,24,2,171,
+36,8,149,161,88,160,34,216,56,44,11,142,9,153,90,26,45,161,73,26,10,30,129,26,44,140,35,27,107,43,40,187,
+121,58,61,153,72,160,98,43,41,128,44,25,136,5,162,16,42,168,112,26,9,174,162,169,88,29,40,156,35,169,21,161,
+142,129,1,195,144,165,24,194,0,160,216,164,42,42,33,131,125,41,0,146,49,12,47,162,16,153,64,243,1,24,25,153,
+201,154,169,151,9,57,45,146,0,2,29,218,152,146,8,181,17,24,73,145,179,122,172,179,16,24,46,17,65,1,35,163,
+200,184,55,153,164,89,58,91,210,131,155,137,156,152,145,137,159,160,131,17,19,193,9,31,32,76,27,152,243,131,137,5,
+75,177,152,160,17,26,82,128,33,124,128,181,2,32,43,136,24,17,107,192,3,242,43,186,78,152,128,153,177,132,41,121,
+11,153,27,243,32,128,49,10,136,168,132,152,201,30,31,8,16,18,163,199,2,131,40,144,184,163,129,214,145,66,59,60,
+160,154,168,192,208,18,29,25,45,50,90,177,216,178,25,145,8,201,210,161,229,4,2,58,156,177,144,167,177,162,0,40,
+16,51,1,10,41,193,135,148,128,122,138,130,249,2,160,146,136,59,46,9,212,147,179,0,138,94,8,74,153,25,169,48,
+193,0,76,139,155,128,7,161,163,122,75,76,160,0,177,17,136,122,89,25,8,178,180,145,178,27,11,47,185,177,149,2,
+1,91,9,42,154,216,165,1,24,143,82,9,0,137,192,8,137,26,144,152,240,211,20,132,32,12,16,153,3,195,179,77,
+24,27,73,132,138,168,160,129,163,234,144,130,105,185,8,3,133,44,122,11,168,40,25,224,16,250,25,40,128,179,0,173,
+65,16,120,9,24,155,35,112,49,146,44,180,128,217,16,172,8,208,8,18,1,24,18,150,42,224,168,132,10,138,57,242,
+48,167,0,161,160,200,26,129,58,200,248,17,19,134,0,162,11,162,30,131,168,5,62,0,196,226,16,136,32,49,13,0,
+186,242,160,35,31,24,153,3,40,17,184,164,136,124,170,48,152,16,202,32,78,57,184,3,128,92,141,17,1,8,176,32,
+105,122,1,42,144,41,157,128,24,14,169,224,2,0,147,137,17,31,145,44,40,169,176,129,88,65,149,24,8,45,224,146,
+16,29,178,169,145,163,7,33,147,160,164,176,2,151,40,11,137,72,2,225,198,162,168,152,162,144,17,220,193,135,16,8,
+129,27,42,172,146,195,25,168,74,79,25,129,137,148,41,170,3,106,74,128,59,76,146,96,145,65,60,168,24,74,170,228,
+24,27,75,144,24,74,201,161,146,40,208,164,200,105,58,17,42,137,152,160,15,27,194,160,193,162,162,39,10,133,34,11,
+136,163,145,1,242,209,149,132,136,164,146,10,184,161,199,129,176,177,48,121,193,195,147,169,16,75,41,47,184,177,0,151,
+129,16,43,171,177,151,2,153,145,75,61,8,151,33,59,8,129,75,33,186,241,152,12,10,132,8,41,140,16,23,60,179,
+163,47,153,168,150,1,43,241,243,16,25,8,24,0,141,36,16,0,165,144,152,42,172,226,0,42,133,202,56,26,184,148,
+123,168,145,16,133,10,40,130,24,177,19,225,73,153,183,1,194,0,162,56,18,159,34,12,154,128,32,15,160,208,50,10,
+0,241,72,59,58,12,59,79,26,0,42,1,64,0,91,11,226,3,41,128,25,0,63,11,194,65,169,25,192,129,29,44,
+24,45,8,184,132,48,139,7,144,74,154,146,65,140,11,160,27,120,178,150,145,41,160,197,2,25,128,129,65,25,151,19,
+128,218,211,145,184,232,193,129,136,129,144,19,25,129,194,90,42,177,2,95,10,144,64,90,9,184,16,155,179,8,130,159,
+1,97,57,122,9,32,8,48,42,24,60,30,8,40,30,154,180,136,42,169,215,136,128,8,176,129,162,6,16,108,136,144,
+132,8,43,9,216,136,0,181,131,32,31,140,132,128,129,155,19,133,3,21,65,169,144,178,193,177,226,171,91,156,0,144,
+179,184,164,132,90,46,10,41,154,48,33,30,97,43,129,42,77,25,26,25,80,45,41,26,26,40,148,15,48,0,75,64,
+10,144,8,3,143,177,75,153,187,163,211,243,129,130,40,10,152,61,216,197,130,178,179,146,23,235,64,0,144,135,145,195,
+179,163,184,0,134,11,210,164,197,146,164,1,8,162,19,161,162,64,187,140,241,193,130,0,144,104,27,138,156,25,10,219,
+9,163,26,58,119,128,145,132,8,106,28,137,74,8,145,145,80,57,128,176,145,152,13,19,94,57,41,45,43,197,147,25,
+138,13,176,192,56,184,149,8,128,144,132,194,194,212,195,178,24,8,50,138,121,162,177,7,162,160,178,197,177,163,162,200,
+19,107,89,25,32,146,161,164,243,161,128,216,8,9,25,46,40,130,9,137,15,8,27,60,11,0,121,106,43,56,60,168,
+2,224,2,137,8,104,10,16,25,40,63,1,10,128,0,176,166,5,57,168,42,74,201,57,40,201,29,40,188,152,196,16,
+74,185,90,154,40,179,133,211,128,243,162,132,168,130,9,0,30,146,19,40,190,163,165,194,166,147,145,16,129,128,114,128,
+59,176,153,3,248,144,145,128,15,161,136,96,176,138,57,42,28,56,154,34,248,26,112,139,33,0,11,123,161,8,24,176,
+15,146,28,34,32,104,65,48,27,65,170,41,209,203,192,24,209,49,72,56,26,143,25,161,155,199,161,24,8,57,128,7,
+160,145,185,25,164,171,176,195,231,129,163,32,36,160,57,185,33,154,151,1,197,8,184,7,26,19,144,200,129,27,184,8,
+139,175,161,76,16,88,129,56,26,143,48,29,136,128,204,130,25,57,114,24,41,44,171,122,41,44,136,24,57,80,136,67,
+163,185,16,143,90,27,138,9,18,42,57,42,37,96,218,136,169,145,48,141,146,136,148,156,6,129,196,136,192,0,43,11,
+122,139,136,24,146,23,19,168,66,193,161,32,162,60,227,154,178,195,82,164,9,60,137,173,48,160,8,128,163,111,25,178,
+5,128,153,184,169,122,75,169,24,0,168,32,113,8,2,205,0,40,178,65,107,43,56,185,26,38,178,200,24,172,35,177,
+138,48,249,13,145,24,23,146,154,18,1,14,131,240,145,128,13,128,146,147,17,242,2,160,128,130,164,56,94,136,25,2,
+65,75,106,140,42,25,11,74,138,193,32,232,59,19,107,59,171,43,91,33,15,129,11,1,144,16,83,179,251,131,160,105,
+178,152,17,162,242,3,146,66,179,212,16,163,140,147,194,137,180,234,161,134,226,130,177,128,160,2,11,145,217,242,63,0,
+240,1,163,11,7,128,9,129,241,25,145,154,137,34,43,126,23,8,75,153,140,89,137,57,168,9,135,9,0,1,152,91,
+249,16,89,25,136,128,137,176,122,131,141,167,129,136,42,186,161,33,40,141,90,211,130,128,89,137,8,2,144,137,152,74,
+64,250,1,176,133,1,152,153,183,147,193,179,57,129,44,150,64,170,34,128,250,185,2,8,59,25,168,229,148,164,128,196,
+128,56,138,3,11,57,47,16,46,10,153,0,44,56,24,18,164,144,120,26,74,200,0,64,61,33,28,56,141,152,40,131,
+137,161,62,77,138,16,178,146,10,57,24,199,192,1,73,137,128,132,209,148,155,51,138,24,231,3,152,2,163,130,194,164,
+193,8,185,195,233,162,136,9,169,88,242,1,200,147,32,161,195,162,6,57,176,163,162,42,47,9,154,43,107,141,8,88,
+58,73,136,89,0,40,72,41,153,124,136,9,74,11,0,57,40,31,9,57,169,92,168,33,12,66,11,9,144,9,75,8,
+217,43,131,188,151,131,201,165,181,128,211,179,147,161,40,182,133,16,17,240,130,153,193,193,196,129,128,194,145,163,8,178,
+65,217,16,152,17,186,4,41,201,132,162,25,25,72,207,130,164,24,42,161,63,32,160,161,83,59,124,57,91,26,8,9,
+9,32,60,41,31,137,152,1,122,12,8,32,11,16,145,129,62,10,208,149,27,163,241,161,193,163,148,129,168,150,168,130,
+129,182,160,7,169,19,146,163,162,165,186,49,224,177,200,3,43,121,9,145,195,40,10,140,168,83,235,19,153,120,25,8,
+145,40,216,60,152,92,168,8,0,76,128,32,145,42,176,18,45,121,168,33,24,29,131,90,59,43,243,58,128,42,242,144,
+0,0,145,33,77,170,164,8,33,171,198,25,128,201,165,32,8,168,179,8,184,214,3,138,160,227,133,74,147,179,97,43,
+176,146,136,13,144,243,40,0,0,179,33,143,130,153,106,154,177,2,123,136,131,176,121,168,145,138,57,204,148,25,75,184,
+66,24,58,154,92,24,93,160,32,74,73,169,98,153,25,152,24,60,41,136,94,9,28,131,58,136,10,226,41,144,179,148,
+45,154,164,195,90,178,185,132,139,195,193,178,109,145,8,16,41,149,128,17,152,134,177,16,141,180,42,24,29,19,26,41,
+236,20,64,0,174,132,160,34,235,18,11,72,1,34,42,46,170,2,186,44,225,154,57,105,11,80,138,89,9,28,26,40,
+25,124,129,24,34,92,128,58,185,58,187,29,40,153,147,161,151,114,131,140,129,139,169,2,162,15,147,225,131,24,19,201,
+152,143,131,202,2,157,20,161,131,42,23,184,18,168,161,146,65,237,3,184,17,192,151,145,2,200,163,185,34,217,0,192,
+2,208,38,160,16,209,1,152,58,248,24,152,58,145,88,128,43,164,72,160,47,144,26,32,123,0,105,0,27,1,25,154,
+141,160,61,0,44,136,89,18,24,144,142,178,152,132,186,132,26,130,143,7,152,130,139,161,152,133,219,4,153,50,12,35,
+184,53,142,2,153,50,216,131,184,20,218,35,160,57,240,16,202,49,248,2,168,16,185,66,179,73,170,48,194,47,161,40,
+152,61,208,64,8,10,16,60,10,78,137,73,128,59,1,92,146,32,146,62,0,29,144,58,56,12,163,47,32,170,50,31,
+152,27,24,11,18,152,6,11,148,185,35,220,131,203,48,172,177,18,21,137,21,196,16,1,242,162,33,153,149,243,16,161,
+131,136,8,241,178,177,24,2,200,163,48,145,120,163,107,153,160,152,16,241,40,136,137,138,106,104,59,168,9,40,142,130,
+145,129,11,177,123,66,56,89,44,29,137,145,168,34,156,18,75,33,113,8,60,192,168,136,0,88,137,105,153,21,153,56,
+168,234,137,128,168,3,225,25,166,179,132,33,197,136,168,137,195,16,72,184,227,34,146,136,148,249,177,192,113,19,77,25,
+156,43,2,8,227,178,132,41,176,2,1,255,164,136,104,129,138,132,152,16,137,27,136,153,56,172,98,28,178,8,90,40,
+161,49,58,15,42,41,24,1,183,16,62,12,32,16,139,192,75,45,40,131,34,31,144,176,74,40,240,178,145,40,11,6,
+27,10,9,10,200,147,7,9,152,128,132,20,58,25,28,148,59,9,56,67,139,166,155,229,56,64,138,153,137,25,211,96,
+152,144,160,184,98,130,26,219,43,41,142,132,41,137,192,74,195,146,104,26,26,50,41,75,40,130,175,147,132,49,10,60,
+25,61,9,31,129,153,10,58,97,194,57,17,159,2,13,147,28,152,138,18,161,10,92,210,0,163,136,192,104,195,89,144,
+132,152,1,130,137,37,70,0,144,154,226,146,160,67,203,148,163,176,134,161,184,179,24,242,128,148,185,162,150,136,144,1,
+241,224,130,145,24,10,146,193,7,144,160,49,10,32,27,89,59,128,249,36,58,56,76,128,16,178,139,16,121,25,241,8,
+42,47,8,42,9,61,11,137,56,60,45,41,169,56,0,80,153,132,157,163,153,16,2,195,192,55,154,2,33,243,161,162,
+112,8,194,177,166,1,136,146,89,177,160,136,57,210,140,91,154,147,248,32,42,144,224,128,144,32,48,139,58,88,8,62,
+15,32,24,136,146,82,41,59,216,121,128,25,24,25,75,65,59,24,162,184,122,46,137,136,184,24,216,32,48,186,192,138,
+176,31,33,232,144,179,162,144,135,1,210,216,130,41,163,1,165,133,160,128,179,151,130,178,166,163,149,145,146,146,195,140,
+224,9,129,152,129,162,2,185,209,132,58,251,16,12,44,25,32,139,113,153,160,20,139,42,136,13,124,24,1,48,58,44,
+2,28,120,136,152,65,10,153,40,34,47,137,59,56,10,210,176,147,29,233,9,113,138,145,24,153,25,243,144,16,168,211,
+144,26,134,144,137,57,161,182,144,133,137,133,128,17,179,37,50,88,192,163,8,139,243,194,26,26,142,16,51,89,193,10,
+41,216,161,19,186,47,152,42,59,112,8,89,139,140,146,8,25,164,137,132,152,108,33,88,75,24,11,73,9,136,162,160,
+59,226,72,121,25,27,25,41,13,129,176,44,153,242,130,17,136,161,8,76,194,169,133,209,154,195,162,138,7,176,4,59,
+24,17,137,41,213,162,49,1,147,180,7,27,147,224,59,168,232,179,16,8,165,197,2,161,147,154,186,168,114,144,16,161,
+147,30,201,163,5,141,11,25,136,122,16,10,34,168,160,52,115,40,24,14,26,26,72,8,178,172,129,200,65,7,152,144,
+153,152,64,139,34,242,176,8,227,179,36,194,185,150,10,27,75,152,178,210,146,134,129,32,164,161,178,128,129,55,170,193,
+194,197,136,210,132,145,144,8,8,49,155,106,28,16,203,209,164,132,136,145,25,89,9,170,112,60,28,8,169,18,16,152,
+97,90,153,34,62,58,9,144,41,63,128,136,1,42,202,129,75,62,152,24,30,136,18,148,90,28,193,128,8,42,154,146,
+62,26,154,48,96,152,147,194,106,241,60,0,75,9,130,87,136,152,131,31,0,130,164,8,138,152,41,17,159,177,148,43,
+27,8,116,32,137,144,136,45,146,204,72,153,202,136,48,88,75,216,1,8,168,0,90,176,24,81,57,37,11,80,168,242,
+16,144,26,42,192,66,16,29,96,144,56,168,180,153,19,45,139,24,178,145,143,137,58,243,25,224,8,193,129,2,17,194,
+26,51,217,131,135,163,139,193,169,179,16,213,4,154,37,8,40,194,184,19,153,146,208,180,148,39,154,40,129,9,28,232,
+29,17,184,152,128,146,200,17,26,38,250,146,16,154,9,35,144,50,167,249,145,147,197,32,192,73,136,40,129,160,35,51,
+10,159,112,11,42,177,196,33,213,25,145,152,146,210,0,90,178,9,8,30,25,75,42,40,194,157,20,76,124,163,74,59,
+203,8,0,153,129,148,144,121,56,31,128,153,161,51,163,132,147,208,210,129,136,184,16,73,15,128,168,26,25,172,150,35,
+154,50,74,173,48,4,192,51,193,2,160,161,45,26,44,144,96,45,145,40,178,2,171,19,44,198,162,178,24,136,58,18,
+31,42,31,168,25,161,184,151,136,18,193,36,28,108,0,136,50,137,211,152,194,42,170,64,232,48,28,24,11,194,59,163,
+0,122,152,17,177,9,144,71,91,139,144,74,11,15,8,0,25,10,145,48,194,17,17,74,135,48,15,2,160,58,9,48,
+29,8,188,18,177,160,49,225,7,32,178,96,185,139,17,248,180,3,169,4,8,140,137,130,132,193,242,0,162,1,57,169,
+6,128,194,162,134,138,128,40,146,158,3,184,167,152,56,202,65,154,26,145,130,155,0,112,114,168,61,152,49,216,0,201,
+19,28,80,11,146,177,138,147,36,128,31,12,24,177,35,141,7,152,17,8,153,151,138,169,19,179,152,228,19,161,60,176,
+0,133,144,153,241,177,130,9,82,161,183,144,145,130,12,212,128,146,0,224,40,161,146,50,138,99,176,195,146,52,15,152,
+128,2,168,2,45,161,13,24,58,136,240,29,32,58,32,12,121,138,0,24,44,64,141,90,57,8,0,11,27,88,28,8,
+9,34,30,24,56,226,56,171,48,39,136,43,139,199,128,136,137,40,161,89,169,148,10,128,152,56,156,121,9,129,56,4,
+219,66,146,15,160,0,155,1,184,122,2,12,80,235,64,0,200,66,41,150,8,136,20,187,68,136,25,17,138,45,32,172,
+184,97,10,0,157,128,133,152,17,26,10,25,140,137,135,130,12,48,148,129,171,242,153,240,136,25,8,217,40,167,37,240,
+35,123,154,162,163,180,46,145,160,1,138,18,240,148,160,130,64,26,25,75,137,226,64,184,2,26,156,146,195,1,144,216,
+0,155,23,2,41,137,216,133,168,147,1,180,137,49,44,128,243,137,232,132,1,42,139,147,152,24,1,180,88,10,177,125,
+176,74,0,8,123,154,40,40,11,90,10,9,9,92,128,56,138,129,128,124,49,139,129,27,15,40,192,24,123,136,160,49,
+144,15,2,40,40,28,160,17,62,43,25,224,162,200,8,64,242,40,9,0,129,147,146,44,160,128,38,75,170,184,153,62,
+151,128,152,56,0,168,3,66,210,125,128,26,162,24,8,170,151,29,73,138,160,147,136,162,184,141,49,32,97,160,145,57,
+19,202,92,185,8,68,13,10,18,218,1,152,41,26,199,25,130,129,49,178,53,123,178,3,152,216,136,178,216,58,28,226,
+57,169,0,213,32,56,161,130,169,183,56,168,4,160,137,201,60,243,137,162,0,212,2,34,28,145,43,39,27,146,154,65,
+177,170,144,91,242,2,17,138,185,76,78,152,128,185,1,90,16,49,10,130,60,105,17,29,168,160,12,106,138,179,25,26,
+165,1,104,28,24,184,50,56,120,187,147,32,210,0,14,1,9,169,59,25,242,152,97,136,180,32,136,3,130,139,10,221,
+67,11,225,2,177,75,128,16,226,1,139,112,144,193,146,25,27,160,135,48,160,11,130,1,34,153,42,123,249,168,25,203,
+104,136,162,123,145,8,132,72,26,169,196,1,152,128,11,202,8,64,113,155,146,177,120,41,162,148,161,192,148,8,108,153,
+161,136,33,186,4,200,56,42,34,57,113,234,128,133,42,176,91,154,59,162,26,180,80,248,11,120,136,115,10,147,251,32,
+154,129,88,40,172,66,137,74,24,187,133,44,184,48,148,24,48,168,16,138,192,225,211,9,3,211,104,154,57,129,138,36,
+152,48,232,8,162,49,145,43,233,56,142,162,197,41,42,210,154,96,153,0,145,132,152,162,151,128,144,41,176,56,35,250,
+216,160,5,8,57,46,24,9,152,194,7,169,65,31,17,26,223,19,79,0,25,184,148,1,136,59,45,58,153,88,146,19,
+31,9,137,146,81,186,32,232,24,18,89,169,9,140,152,80,3,14,137,41,226,18,128,146,32,187,39,137,152,170,122,41,
+140,34,156,25,105,152,203,48,32,60,1,97,17,161,145,176,39,187,163,24,187,241,184,34,194,153,106,153,33,15,1,72,
+128,24,161,50,146,156,164,128,50,159,12,45,24,138,24,90,162,43,123,24,177,58,46,25,40,75,108,43,40,160,41,132,
+168,179,225,128,146,8,157,67,41,32,28,169,112,200,144,19,42,42,203,160,112,27,28,128,146,40,148,194,72,160,240,132,
+17,10,8,129,19,143,155,152,192,2,177,213,25,130,9,41,7,60,136,132,178,49,138,212,4,193,146,162,148,14,144,177,
+130,59,200,8,58,59,241,211,50,16,74,9,8,88,161,250,9,3,10,227,178,32,139,144,2,128,151,187,135,43,57,202,
+48,161,148,150,16,153,169,26,108,129,17,152,18,0,129,121,43,131,165,180,141,195,138,41,16,42,168,151,145,226,152,41,
+27,52,145,80,241,9,144,40,73,144,60,26,75,169,21,29,168,57,60,0,155,169,225,56,208,133,180,129,160,5,161,130,
+192,48,40,7,2,59,218,24,28,10,58,2,241,137,3,28,123,11,1,162,195,145,46,27,56,111,45,164,169,5,128,137,
+186,48,162,17,213,44,180,145,129,75,45,43,32,146,3,129,47,139,33,60,128,224,72,185,35,145,50,234,25,25,29,136,
+132,129,187,97,10,2,24,61,26,149,144,161,173,145,160,145,1,167,88,165,9,192,167,26,145,16,137,179,177,146,24,91,
+129,242,58,25,8,146,161,249,128,23,60,8,0,161,166,40,160,16,94,185,130,10,144,26,9,5,0,11,161,32,175,165,
+162,49,56,8,65,141,149,140,2,44,137,209,136,73,28,195,144,1,49,171,2,166,132,137,34,59,9,232,114,186,0,41,
+153,139,200,19,105,44,148,131,145,147,18,203,134,43,10,8,30,180,73,193,41,88,11,154,154,165,32,74,1,156,183,16,
+48,31,178,24,136,146,42,185,88,0,178,41,137,154,59,7,240,129,56,141,163,115,136,25,140,147,186,36,137,140,160,41,
+168,151,112,128,40,17,130,25,171,146,63,232,153,40,167,153,132,176,107,136,134,244,75,0,58,144,160,104,136,184,48,50,
+175,88,146,128,75,41,12,8,187,7,208,148,16,137,56,26,143,41,128,195,128,147,149,161,129,194,162,195,40,197,179,35,
+15,168,67,171,17,129,161,64,173,3,145,9,128,245,1,145,9,172,151,128,8,57,41,58,139,2,25,123,26,144,176,147,
+59,251,123,178,42,162,147,29,8,75,40,2,184,7,138,18,203,241,73,40,10,25,6,128,176,24,129,165,59,177,24,143,
+148,200,153,151,8,9,2,153,133,25,129,24,202,68,176,17,184,204,12,5,144,152,151,16,58,152,56,194,56,184,208,40,
+9,228,249,65,9,144,162,129,90,43,11,194,33,128,20,25,162,12,160,41,231,144,64,137,57,10,42,136,154,150,64,13,
+73,0,138,47,131,43,46,0,42,145,176,3,153,66,35,226,154,13,241,129,50,154,104,130,139,43,121,202,131,138,167,129,
+160,50,170,29,18,26,175,22,27,8,24,137,16,160,99,184,17,171,165,46,40,160,128,162,17,152,195,66,154,178,121,242,
+42,164,128,152,32,42,144,154,36,28,25,58,253,162,7,9,1,43,9,209,56,33,29,24,20,142,16,200,0,162,211,18,
+11,136,240,160,41,1,143,56,137,9,21,156,144,5,9,147,0,168,135,209,17,48,26,8,121,43,48,45,57,41,25,169,
+245,148,26,196,152,130,153,25,42,184,36,11,163,120,180,0,187,165,137,137,14,112,128,41,64,138,32,224,168,129,168,44,
+130,56,51,128,78,0,187,60,158,145,136,148,130,49,48,99,170,1,250,139,121,26,32,32,184,18,43,135,138,137,185,16,
+242,4,25,178,9,136,135,24,13,152,45,17,137,82,162,26,3,9,57,249,218,129,146,73,128,181,27,3,9,64,187,47,
+25,168,112,16,185,180,73,104,138,162,219,34,10,24,48,41,60,156,136,7,136,140,40,138,181,132,162,64,10,88,177,130,
+240,16,139,50,10,144,212,9,169,100,168,8,8,157,5,139,4,145,184,33,169,34,145,27,191,99,172,50,162,144,32,15,
+48,162,248,129,192,16,129,122,177,16,216,32,130,16,154,202,16,177,162,7,80,140,137,24,36,74,240,24,8,25,41,33,
+226,2,186,59,65,136,1,235,137,44,131,77,49,172,2,202,16,20,132,138,153,186,168,22,195,243,72,0,56,112,154,169,
+147,170,71,136,0,10,154,187,135,145,36,31,136,138,1,16,51,138,156,192,9,181,18,211,49,186,28,41,68,43,132,157,
+56,27,177,68,209,34,170,186,80,57,41,177,59,223,19,187,84,138,131,209,9,24,40,128,134,168,154,9,74,24,121,195,
+128,241,1,25,24,1,0,250,130,138,19,61,64,171,89,200,25,19,25,146,138,201,59,215,48,17,137,168,40,140,121,145,
+24,132,217,136,194,34,17,168,89,12,12,0,74,160,97,224,25,177,2,131,136,3,46,185,41,74,24,65,155,167,31,128,
+25,130,16,152,10,136,28,164,34,144,151,10,11,152,123,6,12,40,169,128,144,132,74,229,0,145,152,57,24,1,58,41,
+15,40,208,18,194,130,128,180,43,9,40,81,143,136,74,152,42,9,151,161,178,18,140,73,58,16,176,108,13,18,14,18,
+153,129,146,194,10,58,1,165,128,61,161,62,137,34,158,5,138,8,168,147,19,193,154,166,106,41,9,48,152,40,11,44,
+186,113,181,177,177,19,201,33,96,8,139,58,219,77,75,32,138,187,135,145,136,66,216,32,9,169,195,104,57,58,159,33,
+184,136,5,8,91,153,210,144,34,48,210,44,8,25,12,97,153,24,10,136,11,132,5,208,42,56,170,123,3,41,144,28,
+201,41,35,134,233,1,160,25,72,56,0,217,184,137,41,112,162,171,132,185,57,39,0,41,173,141,19,2,128,72,140,74,
+186,49,67,136,201,251,136,20,128,16,166,170,136,72,17,89,210,186,137,35,180,164,2,208,11,144,55,40,145,142,136,8,
+132,129,10,2,251,42,2,48,16,250,26,128,32,48,177,159,165,11,48,83,210,136,154,144,18,192,100,169,152,25,0,133,
+163,12,10,144,136,4,130,242,170,146,115,16,178,12,33,174,50,25,170,8,225,0,19,165,12,243,32,177,65,9,17,188,
+72,16,161,57,217,41,128,25,96,211,29,160,48,18,200,217,82,171,131,42,135,170,8,32,1,162,15,16,33,136,91,147,
+31,170,1,32,164,219,146,3,136,3,161,219,147,153,103,168,44,144,128,27,37,160,187,152,56,55,12,176,48,146,16,4,
+128,248,153,58,39,153,202,16,144,3,136,135,155,154,97,147,41,249,25,153,67,130,176,201,200,113,8,130,185,33,76,0,
+155,25,9,7,42,163,172,202,99,129,145,156,160,64,1,1,21,189,10,36,9,5,157,153,73,147,16,144,249,8,17,51,
+128,202,185,98,24,32,138,241,30,1,130,145,184,30,144,83,136,10,128,154,40,23,11,210,170,20,33,153,129,30,185,96,
+17,136,200,0,10,69,192,152,26,161,48,146,1,156,203,77,23,176,137,17,185,120,145,152,153,145,74,7,153,136,0,12,
+4,177,18,10,233,48,132,138,187,51,186,6,75,144,138,139,38,211,153,56,147,9,133,12,184,41,90,36,154,251,16,128,
+64,161,137,0,233,74,7,10,153,32,154,34,45,129,144,188,39,129,186,32,133,11,132,28,129,13,136,38,171,144,0,138,
+36,176,8,147,240,76,2,137,192,90,128,41,154,49,241,170,83,163,203,16,4,10,16,10,131,175,163,98,160,169,40,177,
+73,7,170,64,160,171,39,169,25,152,130,73,216,24,131,188,112,148,153,25,18,153,49,161,64,251,8,80,160,137,144,145,
+58,148,139,51,200,219,69,152,170,140,22,137,145,24,130,221,40,22,184,10,48,216,72,177,64,192,8,58,163,154,40,211,
+41,4,188,64,165,185,113,162,154,193,48,8,161,29,52,250,24,18,161,154,33,196,40,145,60,164,31,8,131,169,58,144,
+25,6,192,25,163,140,112,0,153,160,41,72,169,9,66,248,139,68,144,156,17,160,89,162,26,21,159,16,132,137,136,146,
+138,52,155,58,151,13,57,149,138,8,153,1,166,153,48,225,25,64,130,170,129,2,42,148,9,7,248,136,64,128,170,3,
+11,9,133,154,96,169,184,23,160,138,144,2,89,10,128,80,174,152,39,137,27,129,137,33,160,50,160,159,9,6,160,25,
+25,184,112,26,136,34,189,57,22,176,155,24,180,17,89,42,2,237,73,3,225,40,128,153,48,18,156,133,203,123,129,160,
+128,128,137,33,145,93,146,203,89,131,225,25,16,139,40,132,137,162,141,58,19,211,140,17,140,83,146,11,51,238,8,36,
+152,26,24,171,40,20,145,148,208,171,120,136,146,176,0,14,0,20,24,16,203,155,23,129,43,2,226,168,35,25,24,185,
+142,105,9,144,16,9,28,49,177,35,165,207,32,129,152,128,212,0,16,16,41,216,218,35,160,136,22,170,108,145,136,163,
+24,5,71,0,160,47,24,144,129,153,2,4,155,99,16,201,172,148,40,144,10,123,162,8,35,202,149,48,156,24,134,161,
+13,1,26,161,72,137,184,148,61,0,193,89,179,11,39,170,28,18,202,145,33,10,150,13,40,169,162,90,176,9,116,168,
+25,131,153,132,56,141,18,140,32,241,41,88,200,0,34,10,232,17,153,168,90,9,34,136,24,169,67,28,21,216,50,32,
+240,56,168,137,107,168,43,178,160,34,143,8,23,185,72,130,232,48,136,27,171,149,17,42,144,198,25,136,130,225,17,2,
+154,93,145,144,59,160,152,243,49,178,172,148,132,1,75,26,214,24,32,140,25,162,42,128,4,179,161,44,125,160,8,3,
+193,153,132,24,141,180,192,163,148,64,12,152,2,17,12,134,128,30,129,136,176,130,42,184,74,35,222,3,29,161,129,4,
+24,30,17,136,9,149,226,145,74,56,169,41,10,160,212,35,57,174,2,192,137,81,11,40,8,18,195,163,43,4,172,55,
+153,169,134,25,139,64,185,193,40,76,178,241,40,89,44,58,129,184,132,26,192,16,40,138,76,123,10,41,169,8,26,123,
+0,243,1,1,137,74,8,201,146,73,40,12,177,64,27,93,152,167,129,0,216,1,0,61,9,162,16,73,139,164,210,18,
+160,194,120,42,138,160,147,169,88,10,182,163,145,106,137,26,129,162,128,193,34,13,240,130,73,26,168,8,197,144,160,1,
+128,163,41,55,88,140,148,9,168,169,21,170,137,105,146,59,192,135,136,163,59,171,4,15,0,128,16,73,179,130,181,40,
+17,31,44,9,33,233,152,5,8,26,99,157,145,146,171,50,128,124,74,140,132,129,176,152,16,141,40,41,152,183,2,160,
+52,216,152,42,2,63,41,91,137,169,133,33,217,9,129,129,60,130,136,27,228,32,21,203,193,1,8,121,179,32,13,8,
+45,0,8,186,34,73,90,72,161,15,9,136,21,152,168,2,128,140,37,187,16,137,161,51,128,255,49,138,40,48,137,140,
+34,148,73,155,26,92,24,186,117,184,25,144,177,66,178,143,40,145,40,147,200,26,35,157,115,176,13,130,144,16,132,185,
+8,26,33,180,34,175,25,20,40,136,249,160,2,134,25,33,158,152,20,154,1,225,137,64,73,8,137,161,187,39,128,145,
+57,240,1,128,245,26,77,0,40,42,15,9,18,145,141,178,233,35,130,155,98,170,92,129,152,0,196,136,65,136,140,149,
+170,64,129,153,32,202,73,164,145,107,176,194,66,1,13,129,170,48,1,232,18,216,8,148,128,139,2,11,120,16,156,35,
+155,125,145,129,58,128,12,131,129,10,242,152,56,80,171,128,228,40,129,144,24,161,15,132,145,28,17,184,50,153,26,131,
+191,121,161,161,58,2,31,164,144,73,192,129,2,24,13,136,164,76,145,136,40,192,137,133,8,155,129,180,81,25,169,17,
+43,31,134,163,44,33,173,133,144,41,168,161,48,33,232,27,162,30,51,26,61,144,250,50,136,187,167,129,91,128,0,24,
+29,139,134,136,25,0,208,35,168,41,228,57,25,128,131,15,41,184,4,25,128,210,168,56,51,204,16,107,139,33,4,11,
+11,240,49,51,250,33,152,75,32,185,43,160,201,114,33,172,129,185,16,37,209,24,228,152,33,8,0,11,128,30,34,146,
+29,177,169,106,3,169,0,41,155,121,181,58,131,159,48,146,138,2,29,137,149,9,133,185,129,203,19,2,9,141,148,48,
+47,131,9,16,234,48,131,168,5,185,58,140,67,40,142,1,10,153,59,153,39,156,129,3,75,187,27,162,123,163,153,55,
+188,3,10,147,131,190,147,135,27,0,152,44,114,28,1,40,174,33,168,24,18,170,114,168,91,161,11,152,121,10,136,72,
+177,50,185,5,16,138,185,53,27,242,10,145,112,9,144,106,194,136,128,153,19,140,8,20,171,132,42,177,63,194,25,18,
+185,75,130,141,18,181,91,146,140,34,208,169,82,160,57,16,212,56,137,138,149,224,17,128,11,147,30,177,40,136,89,42,
+7,11,0,147,171,53,140,32,26,130,14,178,155,39,59,140,5,13,2,169,16,1,172,65,192,17,145,168,61,179,15,18,
+0,140,19,156,48,168,209,7,152,24,177,128,58,130,155,193,101,28,41,128,168,165,2,157,1,176,168,134,43,130,139,152,
+117,153,16,3,172,36,153,24,8,200,1,8,250,81,169,17,113,156,49,138,155,7,154,32,152,136,146,91,13,16,170,36,
+16,9,106,11,138,131,29,1,161,74,200,120,144,24,162,0,62,179,136,90,176,24,59,249,64,161,136,170,210,89,160,16,
+122,145,41,130,156,83,139,153,221,244,69,0,22,28,24,144,225,64,152,138,36,171,64,138,217,51,200,0,131,192,19,169,
+13,72,140,162,57,196,1,129,178,81,157,210,18,32,200,121,169,42,178,24,75,150,152,32,178,1,82,251,57,144,9,128,
+194,31,129,136,91,19,139,4,169,89,129,146,28,184,133,26,128,62,160,128,144,88,72,160,185,34,43,226,162,204,21,170,
+16,8,12,98,200,16,128,56,160,146,59,183,58,251,17,26,133,11,132,0,141,51,155,64,243,152,80,168,26,195,0,24,
+146,15,18,140,0,37,139,33,171,90,25,19,46,152,24,201,20,139,56,12,210,0,17,9,165,59,170,71,139,160,88,186,
+51,233,27,132,185,88,147,58,162,137,202,39,154,2,171,184,114,169,56,145,176,112,128,73,180,9,136,145,157,151,26,128,
+17,138,33,29,29,144,131,136,145,16,197,67,217,146,16,194,58,40,159,41,152,12,23,145,130,137,209,49,232,144,128,137,
+122,128,41,17,203,128,150,153,50,139,202,68,168,52,240,136,32,9,140,48,11,184,6,8,23,169,176,18,9,28,29,1,
+152,164,16,38,156,171,34,179,140,19,7,59,154,80,177,202,42,67,219,72,17,185,131,210,98,186,153,65,2,142,17,129,
+29,0,136,20,220,24,1,194,57,147,208,129,146,96,177,13,57,58,208,72,145,138,8,35,65,233,160,146,18,139,67,170,
+142,73,3,17,142,139,0,7,138,132,176,168,64,48,217,152,41,72,185,121,1,142,8,132,16,169,9,130,128,184,23,201,
+58,24,72,0,188,138,145,51,91,6,219,131,128,67,192,187,113,153,128,33,0,142,128,104,146,154,42,148,154,3,129,248,
+25,17,66,152,11,42,211,106,128,24,240,32,8,4,172,168,19,41,155,19,133,175,48,17,181,30,136,2,136,24,18,234,
+27,36,25,209,153,24,48,14,19,136,174,66,128,49,187,171,84,153,139,22,169,139,99,137,135,140,40,129,152,33,136,203,
+9,35,99,201,10,18,26,10,55,170,170,106,32,3,221,0,131,10,128,18,153,190,80,131,163,143,40,129,144,32,1,174,
+137,22,8,168,218,49,9,185,70,152,155,65,16,33,251,11,36,169,24,132,202,57,32,145,7,173,56,163,154,83,160,141,
+1,24,98,216,9,50,171,129,36,202,152,1,138,250,71,0,19,35,207,136,21,155,16,147,169,152,128,23,152,173,65,129,
+160,50,40,191,40,1,17,241,170,112,160,9,64,176,138,50,128,66,241,156,83,184,41,2,171,74,147,16,17,251,43,5,
+138,48,178,219,32,179,120,163,143,48,161,24,0,193,9,10,33,37,248,10,80,152,25,32,154,27,161,68,128,249,44,33,
+128,24,0,186,45,65,27,20,237,8,3,138,129,131,186,89,0,120,146,158,40,164,136,131,208,26,131,168,38,185,29,33,
+192,72,128,154,25,0,26,87,201,9,49,185,51,169,44,128,139,112,148,154,27,81,169,34,176,170,0,168,115,163,191,2,
+4,24,130,152,13,41,184,120,164,173,56,180,25,2,169,41,161,88,115,153,142,32,161,74,145,153,56,225,88,1,185,42,
+57,9,67,14,160,16,154,121,149,176,43,2,128,130,75,156,136,139,39,0,240,25,2,170,5,145,139,146,28,50,162,250,
+57,40,105,152,40,27,225,11,22,128,250,1,9,32,129,59,42,204,112,0,41,186,131,168,65,144,177,149,159,50,9,19,
+159,128,0,24,146,24,17,174,132,98,152,29,161,144,64,153,129,136,27,178,116,184,107,193,9,19,185,65,202,32,137,20,
+208,64,11,8,145,25,36,221,18,153,132,154,146,12,105,10,16,129,28,132,12,150,26,195,136,2,24,9,195,42,139,123,
+180,59,152,145,147,193,112,194,136,145,52,188,67,202,57,161,144,49,15,18,11,134,140,132,155,66,153,41,164,27,144,57,
+162,62,218,104,128,10,18,152,136,137,50,252,17,169,48,153,96,43,193,65,184,5,172,34,168,145,131,192,112,136,27,91,
+163,172,147,44,148,136,176,55,200,16,48,11,57,163,31,152,160,139,167,44,3,137,129,5,146,153,169,158,112,168,10,1,
+48,56,146,58,226,44,144,152,58,159,17,145,74,23,138,154,74,184,19,143,8,16,179,105,51,176,8,177,31,0,157,24,
+58,152,36,24,90,161,160,57,230,136,0,160,40,7,154,19,144,24,142,168,106,200,16,57,1,16,32,50,219,41,220,1,
+139,8,121,0,27,20,114,155,11,136,145,45,153,80,132,141,2,32,44,240,136,17,9,152,18,130,112,1,154,25,235,40,
+210,57,25,18,172,55,24,140,209,24,24,44,136,33,8,75,217,14,70,0,19,189,198,42,152,144,134,57,8,56,160,166,
+76,157,2,160,131,77,25,144,148,24,24,232,8,18,45,208,17,10,65,44,137,152,217,18,186,151,40,152,40,160,164,3,
+31,12,0,2,1,41,136,133,148,62,176,195,144,34,128,145,97,154,64,141,180,26,27,136,148,41,1,178,29,182,49,30,
+42,241,17,128,32,12,132,24,12,25,193,178,76,24,1,9,105,137,11,212,25,136,40,194,56,168,82,185,181,105,28,24,
+160,130,44,34,14,162,48,140,144,155,135,25,136,40,177,81,59,241,136,42,48,201,7,26,40,11,149,130,13,9,146,162,
+112,184,17,152,57,40,250,211,57,10,48,211,9,72,9,162,34,45,159,17,193,51,139,131,141,178,84,170,177,28,49,25,
+133,11,161,92,160,3,14,194,42,195,80,152,16,202,2,40,136,60,157,73,210,35,27,145,28,162,20,144,243,26,48,26,
+18,128,209,44,72,32,15,208,129,145,88,144,144,169,130,35,153,122,142,0,145,88,137,0,170,1,114,168,128,15,32,8,
+2,75,153,44,0,19,235,147,45,40,11,134,8,154,75,57,18,158,180,43,18,61,163,25,208,56,89,32,155,224,41,4,
+60,179,41,233,32,57,145,15,177,57,129,121,176,25,138,32,2,18,31,248,32,8,33,169,128,170,48,115,128,15,168,18,
+16,57,145,171,152,25,54,1,159,184,2,50,72,241,26,136,152,83,56,175,162,0,18,57,226,10,129,58,39,136,143,162,
+0,2,24,194,26,161,26,20,72,191,146,40,3,26,225,41,152,26,22,145,159,147,25,2,40,241,41,152,24,35,161,159,
+164,40,32,160,176,2,143,1,67,136,190,148,24,33,154,193,146,10,24,112,129,189,147,18,49,218,17,169,128,151,48,133,
+143,146,145,49,185,33,201,169,49,131,7,175,129,2,129,202,132,184,16,2,128,38,191,147,33,136,42,208,145,129,1,57,
+23,191,4,0,9,0,201,2,42,145,121,162,143,2,128,136,136,177,179,160,151,48,178,15,1,163,25,163,187,5,128,178,
+88,151,140,17,162,57,216,145,128,9,26,38,200,47,1,168,1,152,152,181,194,17,50,176,159,3,160,65,140,41,179,192,
+89,50,209,31,1,144,162,16,154,178,192,37,16,202,62,129,152,129,128,156,47,212,71,0,4,13,19,33,249,41,72,42,
+168,40,56,176,15,21,40,251,17,128,0,9,10,25,232,64,136,129,218,131,161,33,185,146,18,220,130,85,184,141,49,144,
+1,27,74,176,217,82,131,202,92,24,209,17,144,41,160,76,16,145,158,40,8,73,9,156,52,187,32,120,211,11,146,17,
+130,25,58,130,175,36,33,248,59,145,40,161,129,30,129,14,150,32,187,40,9,16,136,210,72,185,89,33,163,206,48,152,
+50,152,28,145,187,114,4,185,29,33,154,5,160,24,8,158,51,32,173,27,243,17,2,29,41,169,137,36,149,184,72,139,
+17,150,129,41,156,92,16,146,216,0,41,27,6,138,129,249,129,40,2,200,128,28,25,35,185,130,143,152,114,130,9,169,
+129,138,132,56,171,156,167,32,134,136,11,8,185,7,0,185,65,28,74,16,243,9,16,156,18,137,11,146,166,33,65,161,
+13,147,138,57,91,184,122,129,8,148,0,225,16,154,26,183,128,136,25,16,81,27,141,162,145,8,142,165,136,195,72,164,
+24,32,170,26,135,154,144,0,137,104,194,128,162,24,133,35,31,25,170,144,132,250,40,155,49,1,181,49,143,3,144,18,
+137,142,145,1,25,151,48,129,152,58,180,29,29,169,76,163,9,17,18,17,164,201,142,177,227,2,201,80,42,128,90,147,
+193,74,154,170,7,168,24,9,132,96,10,130,202,129,11,57,121,161,27,163,198,16,16,169,28,145,184,21,41,161,89,64,
+171,40,5,242,59,137,12,25,146,145,150,153,45,64,136,146,12,138,105,16,56,60,200,169,17,39,129,171,137,179,27,119,
+9,8,43,218,34,33,1,191,161,3,153,23,169,128,168,42,66,18,121,218,9,129,24,33,208,145,153,168,22,131,24,153,
+159,64,152,36,139,185,106,154,17,151,129,9,142,32,177,88,0,171,16,8,122,128,152,164,159,131,129,24,129,184,8,124,
+8,1,10,1,251,17,33,28,144,177,25,0,129,7,160,91,217,48,0,146,90,152,28,177,180,98,138,144,242,40,33,30,
+129,0,171,132,152,4,42,168,240,24,50,154,147,160,170,61,132,97,185,17,233,74,56,176,152,163,186,166,165,18,136,75,
+216,32,33,155,8,144,140,149,208,64,161,178,225,74,2,13,0,128,184,133,25,66,138,144,193,4,71,0,240,27,6,169,
+2,128,61,138,148,80,152,48,251,40,1,144,152,144,162,147,17,49,120,190,195,41,21,11,0,27,154,150,136,34,160,242,
+184,83,56,187,81,138,57,76,144,9,148,41,175,129,150,136,24,9,73,137,9,32,50,188,47,2,196,129,25,187,132,193,
+48,65,60,189,40,96,9,58,153,9,8,18,8,209,132,174,104,1,8,193,41,13,64,9,24,0,218,8,88,144,24,179,
+174,35,40,145,57,148,189,24,7,152,18,140,153,179,48,146,104,185,142,48,25,132,28,209,0,1,8,148,165,248,10,35,
+153,32,162,171,144,115,42,56,194,240,24,128,145,3,141,145,25,129,7,32,141,155,58,4,33,168,241,152,18,59,58,23,
+232,11,33,19,29,64,186,145,2,162,104,152,241,153,17,40,56,144,249,57,136,106,160,35,203,152,120,144,17,195,186,16,
+32,31,2,17,248,43,0,56,128,4,141,160,177,82,136,48,240,153,33,48,58,152,248,26,1,73,144,149,176,12,169,6,
+0,129,154,121,137,122,136,146,162,153,25,163,9,83,224,136,129,184,97,60,145,154,196,25,42,112,168,163,9,163,177,144,
+51,191,72,12,20,27,1,29,129,58,211,130,209,8,40,140,19,227,56,170,3,30,80,156,2,137,179,4,28,24,160,209,
+33,17,30,153,20,28,130,177,83,154,1,42,161,202,132,203,130,150,75,187,35,244,24,48,12,129,195,34,171,33,140,194,
+28,35,31,193,34,154,121,153,129,136,146,32,210,57,74,200,153,53,29,24,58,201,72,152,25,178,167,57,162,44,193,146,
+153,104,27,145,88,137,42,131,147,192,34,137,199,176,18,210,75,60,25,209,32,193,24,105,139,8,144,147,4,10,58,52,
+175,24,209,195,64,152,42,128,162,210,130,2,150,10,28,49,174,32,152,67,15,146,137,33,137,212,129,24,129,11,198,48,
+8,30,129,56,155,51,173,57,131,184,18,243,18,209,128,120,152,138,2,46,184,4,169,121,152,128,179,130,129,178,225,121,
+137,152,130,9,153,81,26,156,19,178,139,1,135,162,24,45,185,166,17,3,143,49,12,153,2,210,0,0,27,66,178,185,
+18,157,33,122,10,80,240,177,34,24,73,224,145,131,137,73,41,154,43,152,212,32,1,170,241,3,192,129,152,245,69,0,
+164,48,152,47,16,153,144,16,170,79,146,168,48,146,240,144,2,123,40,155,194,3,154,122,177,0,161,226,0,146,152,50,
+47,11,133,144,49,170,24,45,161,168,7,177,12,65,57,200,64,160,42,200,146,82,29,184,180,185,39,10,42,130,202,1,
+49,29,49,12,137,136,243,179,50,173,17,193,9,50,195,168,25,47,19,225,130,48,188,18,210,211,163,163,228,65,43,147,
+143,138,130,33,41,75,44,1,18,143,153,180,24,5,57,58,12,146,138,81,186,8,170,167,72,169,73,152,12,34,208,17,
+1,27,132,57,11,128,251,131,3,209,25,132,140,154,48,34,47,28,41,130,160,73,137,30,1,161,36,27,29,248,33,145,
+40,161,182,145,49,184,133,168,13,0,232,131,129,8,75,34,142,152,67,155,41,47,176,193,17,2,48,193,43,202,55,9,
+26,233,68,140,32,137,130,202,42,72,28,193,16,8,185,7,91,160,128,43,134,41,161,129,74,154,59,170,167,48,156,58,
+32,192,162,151,25,11,34,241,56,24,193,180,0,2,218,107,144,17,12,17,141,146,74,153,4,9,145,171,7,13,132,25,
+17,169,128,49,224,147,32,242,42,138,33,202,131,10,13,18,0,92,224,40,144,164,0,49,13,193,0,176,4,185,166,25,
+73,40,60,128,1,187,1,167,42,177,146,232,40,144,32,144,88,105,47,8,26,227,40,152,193,64,152,8,57,152,32,225,
+84,11,129,160,2,245,40,128,25,29,137,130,160,22,139,163,130,193,112,172,18,12,144,130,40,40,42,43,161,22,168,92,
+234,3,29,145,40,144,128,36,153,92,136,145,60,249,1,153,16,32,9,147,40,3,138,120,243,58,141,129,168,132,160,20,
+8,57,146,146,161,63,248,16,162,75,8,107,192,49,169,32,139,185,135,28,24,153,164,145,135,26,129,60,25,25,61,242,
+145,1,26,130,44,149,26,152,18,185,164,124,155,2,176,146,2,105,168,0,209,34,136,235,52,15,0,152,129,130,41,26,
+24,11,135,0,208,19,31,9,1,160,149,58,168,57,169,4,9,203,151,10,58,25,162,214,50,155,18,12,146,58,232,165,
+25,40,139,147,212,35,12,176,81,168,72,155,197,24,25,8,90,176,132,8,137,32,8,176,47,244,0,144,24,56,168,149,
+74,4,78,0,9,168,20,128,1,92,224,162,16,8,89,138,179,0,10,33,137,196,63,200,161,129,1,80,29,164,8,9,
+33,155,179,122,156,131,160,130,64,47,129,168,73,2,139,226,72,139,194,130,161,50,62,152,177,40,32,161,233,21,15,145,
+161,145,149,58,128,154,67,144,163,226,81,29,153,162,162,133,41,26,28,32,27,2,235,34,15,25,24,145,196,48,160,28,
+2,90,138,152,197,90,27,24,177,167,56,177,10,132,137,16,251,132,26,91,152,129,147,106,200,128,24,3,138,177,183,58,
+11,58,129,165,72,200,2,26,21,137,248,150,9,24,136,26,165,48,186,48,138,34,45,248,148,12,8,48,185,149,1,10,
+1,43,135,42,240,17,28,8,8,144,3,128,10,49,172,146,107,216,37,143,146,128,161,19,27,178,168,131,135,60,225,89,
+11,128,144,162,82,140,130,129,152,3,145,195,105,14,146,153,163,98,11,128,42,193,18,26,0,47,218,1,161,1,67,142,
+147,160,147,41,162,48,159,161,145,196,72,41,160,42,166,10,26,148,113,12,8,184,132,122,11,146,161,179,147,12,20,47,
+137,161,161,146,124,10,16,145,162,178,33,18,24,220,134,170,0,73,27,134,27,161,25,136,65,10,202,160,147,143,131,136,
+20,41,57,41,140,135,137,212,0,136,59,240,130,162,41,56,14,24,32,163,26,137,48,59,234,209,162,178,179,149,0,9,
+34,31,146,150,90,153,46,147,16,169,40,161,81,232,33,137,138,25,129,114,156,3,187,150,152,145,0,0,56,241,1,25,
+9,126,168,56,137,144,11,131,128,151,144,147,9,28,56,0,15,16,161,123,176,48,26,18,31,180,136,176,3,184,66,143,
+16,26,146,121,8,8,25,145,146,26,43,251,41,195,133,232,16,90,9,57,34,154,225,57,136,130,186,130,15,24,74,152,
+34,16,23,44,121,153,0,31,9,161,168,163,25,177,96,200,17,217,163,16,74,27,178,56,172,39,152,162,98,144,136,147,
+42,217,131,242,82,27,17,43,136,4,10,234,17,154,26,144,245,16,130,41,75,2,42,242,152,128,202,64,61,153,32,181,
+0,129,98,26,186,18,157,144,128,227,131,2,9,64,10,135,171,25,168,173,32,132,62,19,26,160,5,41,2,143,160,137,
+168,105,61,18,175,27,75,0,27,146,65,28,130,189,195,10,154,105,176,6,192,35,11,147,128,243,48,188,33,155,180,52,
+170,67,12,130,129,242,91,184,57,176,16,20,128,73,11,17,180,9,122,156,8,168,24,52,139,68,140,148,146,216,49,158,
+17,168,2,2,42,35,159,133,136,144,60,184,145,186,50,61,24,162,152,19,148,31,28,227,177,178,49,74,57,195,57,227,
+81,28,74,171,145,41,187,71,11,2,12,165,16,8,59,187,162,73,41,89,9,32,156,181,35,138,110,192,16,177,48,59,
+144,148,152,16,123,9,172,179,128,11,121,40,136,150,153,163,16,29,152,225,0,8,10,53,160,50,15,163,16,177,13,210,
+26,136,1,41,134,33,141,18,43,160,235,166,74,9,74,160,149,1,136,48,59,170,243,179,28,0,31,163,146,32,72,153,
+129,136,208,17,159,24,200,131,3,33,139,20,138,166,152,28,155,9,10,132,112,40,243,56,162,17,169,121,218,1,168,129,
+65,12,19,11,181,32,185,44,243,41,154,64,8,3,34,145,16,72,60,157,229,9,9,58,1,178,65,25,72,43,25,248,
+40,158,56,154,19,209,81,137,64,168,1,185,66,159,129,160,40,145,106,177,49,208,19,172,48,192,152,168,65,73,27,135,
+10,148,91,177,26,213,24,136,25,49,186,22,154,19,60,147,235,20,142,146,152,147,8,73,184,81,186,5,168,32,157,130,
+160,18,25,122,226,48,169,17,8,73,248,24,153,33,136,0,3,31,193,56,177,16,225,27,2,10,151,128,97,154,130,25,
+164,152,33,159,2,169,131,129,56,12,131,234,20,184,108,152,160,17,9,17,57,164,29,194,25,16,171,229,42,147,46,18,
+169,37,170,48,26,194,217,3,143,17,184,4,8,32,169,49,139,149,210,59,173,16,182,32,24,41,135,25,160,21,138,154,
+196,44,145,75,24,8,150,26,161,41,146,219,180,29,0,43,166,1,50,171,33,10,151,139,32,175,2,184,133,0,74,161,
+32,210,3,155,75,240,0,184,18,24,72,132,139,165,57,8,28,225,40,184,74,2,129,66,185,130,109,162,202,131,31,0,
+26,161,35,40,154,130,90,225,210,32,143,130,153,130,16,88,161,24,3,195,242,40,156,0,200,17,8,65,194,24,130,3,
+173,64,158,0,192,33,16,26,199,238,69,0,4,57,185,117,184,57,201,146,152,130,106,136,131,12,4,9,145,76,251,17,
+168,16,57,168,22,185,50,162,139,124,217,0,144,40,74,10,20,170,2,17,155,122,217,130,152,146,104,154,66,186,148,40,
+152,93,217,17,168,18,41,129,73,193,131,49,232,74,210,26,0,144,58,131,45,0,136,104,210,28,162,10,168,36,156,5,
+26,145,33,44,1,143,164,8,144,74,177,1,136,130,75,168,4,235,147,153,49,15,146,33,24,25,27,11,162,242,26,129,
+46,208,67,40,16,28,151,0,48,9,202,3,13,152,169,181,73,157,65,185,130,56,177,35,75,131,172,4,25,250,0,161,
+25,108,42,128,160,4,201,3,56,12,161,188,4,185,72,96,202,49,176,152,196,8,128,44,96,129,192,67,17,8,41,28,
+33,171,189,250,32,14,145,25,20,32,139,6,136,136,78,9,161,153,148,8,146,1,158,149,181,162,40,61,176,144,187,135,
+0,171,68,139,16,16,60,152,130,56,0,29,47,132,75,17,56,31,25,176,162,248,195,57,136,66,45,136,152,194,105,169,
+32,168,8,133,168,35,42,41,47,129,192,162,148,41,208,122,177,148,40,144,10,36,217,136,156,211,134,10,1,177,26,32,
+31,0,9,168,144,180,89,9,27,130,132,58,194,57,167,8,160,17,162,123,128,104,146,184,34,8,13,74,228,128,24,129,
+43,179,44,9,161,210,33,13,145,137,151,105,136,0,208,56,210,8,128,26,144,194,132,62,178,9,33,169,9,57,210,57,
+219,135,26,32,44,168,196,147,12,163,41,76,145,138,151,163,152,25,164,29,129,28,195,147,178,72,20,185,105,184,0,128,
+128,192,3,165,57,166,137,89,138,224,1,195,1,42,161,120,57,216,129,209,0,137,130,58,1,42,4,33,243,137,168,248,
+16,129,57,74,60,90,26,195,30,194,128,8,0,16,163,193,38,26,152,91,154,12,72,192,19,28,146,3,176,144,32,141,
+14,146,27,134,8,16,162,98,219,147,200,16,57,42,244,48,25,137,130,185,135,156,1,160,33,185,53,158,20,153,56,169,
+160,19,240,49,153,180,32,6,188,19,169,41,43,145,134,169,130,148,48,207,35,15,8,1,58,177,73,128,128,182,152,163,
+45,192,1,112,200,48,25,25,160,28,196,136,41,214,78,0,177,132,144,8,65,139,82,201,104,185,32,161,209,133,8,161,
+129,50,250,34,13,24,8,28,182,24,177,1,1,248,3,139,49,12,122,192,1,136,144,149,138,164,42,194,16,89,169,49,
+171,2,179,141,167,137,1,8,104,139,51,171,131,193,42,215,24,147,169,6,28,17,28,0,160,42,225,1,168,129,34,15,
+132,43,32,154,1,241,130,176,129,18,47,2,47,0,152,24,208,131,168,178,4,75,137,90,136,10,89,241,1,136,145,17,
+29,2,75,58,145,12,196,40,226,145,40,41,136,94,8,136,152,194,128,147,41,106,29,18,29,144,1,186,151,42,0,45,
+40,26,8,9,148,144,225,18,44,27,25,121,12,2,184,19,128,184,114,141,17,42,41,178,129,195,177,2,32,63,170,10,
+160,199,180,19,200,129,64,139,106,216,131,168,165,146,8,32,46,41,176,9,183,136,129,16,41,77,58,27,26,145,193,243,
+57,8,91,74,137,35,155,41,4,248,65,14,40,26,25,128,195,195,162,34,137,61,154,144,176,131,199,131,177,18,91,144,
+77,240,129,178,129,130,75,40,28,8,2,220,165,128,128,24,73,62,136,26,147,0,192,148,93,137,57,58,137,17,184,164,
+146,225,112,12,57,27,144,195,180,130,177,49,11,92,170,164,129,211,164,1,161,76,24,152,40,240,1,192,145,3,41,58,
+12,41,178,13,214,146,136,17,91,60,24,61,144,146,192,4,44,9,73,75,43,129,153,129,131,218,113,29,41,9,59,193,
+131,184,166,17,176,123,26,24,44,144,228,2,168,16,16,138,123,168,128,177,179,167,129,144,17,75,9,10,245,146,168,150,
+129,24,24,26,57,136,170,199,129,161,24,107,43,24,9,9,135,155,165,58,137,89,75,42,0,10,129,162,209,147,63,26,
+30,48,12,130,8,160,5,202,4,44,10,57,10,136,131,184,134,40,162,121,47,8,9,24,226,18,152,144,96,169,89,28,
+136,24,153,166,129,161,40,33,29,89,29,144,136,145,211,18,216,18,40,172,113,139,1,153,145,165,0,128,146,40,138,96,
+143,163,160,1,242,65,153,16,40,177,73,170,145,160,195,177,135,153,2,72,170,120,138,128,136,176,135,145,144,2,17,157,
+65,142,146,9,136,181,162,130,182,64,169,65,14,160,24,129,56,244,76,0,193,18,145,208,83,218,50,141,0,128,8,210,
+35,202,132,32,187,51,15,145,137,48,192,50,187,133,132,201,131,76,154,16,42,226,3,184,148,163,186,150,42,169,58,53,
+13,146,25,242,4,186,151,25,152,32,26,74,144,41,168,133,168,182,42,8,192,96,11,34,45,153,133,139,180,41,137,2,
+74,56,129,47,57,243,57,242,16,137,144,33,137,130,60,58,176,46,226,1,152,24,179,89,210,32,58,192,105,186,130,9,
+1,146,74,211,130,72,218,18,31,144,8,0,195,120,169,131,16,186,52,143,130,8,0,152,21,140,147,40,155,167,60,160,
+24,24,176,4,13,2,128,154,214,16,8,160,80,27,164,59,145,129,62,240,17,153,0,147,57,225,32,26,193,106,170,131,
+75,177,146,89,225,32,128,168,51,14,136,56,26,180,88,153,1,0,232,132,30,128,42,136,136,6,10,160,4,187,151,26,
+128,32,76,152,130,11,180,131,202,199,16,144,152,96,138,131,11,130,133,13,196,24,168,162,64,137,163,32,16,195,77,242,
+16,152,0,2,29,146,9,8,179,78,192,128,129,128,162,123,177,16,0,160,123,208,1,144,9,147,75,162,10,64,163,31,
+168,146,137,32,178,122,211,0,8,210,41,208,18,11,18,148,24,144,132,42,183,75,209,128,9,178,197,16,195,1,168,18,
+26,243,25,152,152,135,152,4,137,128,3,175,165,8,136,161,48,24,146,45,164,90,170,180,42,178,58,105,139,80,26,89,
+42,154,37,13,128,16,43,1,59,58,42,63,194,92,140,129,24,43,162,20,168,176,34,199,90,138,152,3,185,135,8,9,
+160,90,164,13,165,128,152,146,161,96,184,40,0,41,157,182,9,146,8,96,10,2,40,186,115,217,19,28,137,48,77,153,
+147,10,162,41,243,106,137,128,136,57,210,34,155,2,146,1,47,208,24,160,176,7,136,136,132,170,113,170,147,136,153,2,
+2,28,3,14,24,17,241,3,28,146,161,123,128,56,43,138,24,183,41,169,74,45,43,147,25,194,34,233,50,47,160,41,
+154,49,132,139,183,8,17,25,13,164,29,131,185,64,160,129,16,201,120,242,1,154,147,25,128,146,49,141,5,8,193,122,
+184,18,154,16,149,58,168,17,29,146,47,196,25,0,168,17,90,168,64,170,254,240,74,0,50,217,150,27,144,9,32,60,
+146,46,129,32,248,50,15,129,137,24,146,2,13,178,72,242,89,153,1,24,25,193,50,202,132,8,128,92,200,0,128,137,
+148,40,194,0,136,50,175,147,9,144,146,82,59,149,45,145,41,188,149,26,169,3,48,155,23,43,160,18,253,19,155,152,
+131,44,147,147,120,176,56,196,40,139,162,72,40,240,82,10,153,64,248,48,186,2,9,25,166,56,139,19,10,165,61,184,
+130,139,162,197,65,201,3,138,179,123,241,0,129,152,132,26,128,32,186,4,31,193,130,8,130,146,120,193,40,144,16,29,
+226,16,136,160,3,42,227,0,24,130,143,163,8,154,147,135,41,211,40,144,163,31,243,16,137,128,19,29,146,128,153,21,
+15,178,129,10,129,131,29,180,16,144,132,62,192,48,137,160,6,43,163,136,8,164,77,217,1,9,144,35,28,161,80,137,
+210,108,168,16,9,137,4,42,168,130,40,243,106,170,1,41,9,179,105,168,1,1,240,64,170,160,33,60,196,32,8,146,
+72,242,17,13,161,16,73,200,18,25,169,113,186,132,44,160,129,89,168,147,42,161,97,141,164,59,128,152,66,13,147,42,
+137,35,159,181,41,168,162,66,42,241,1,8,194,91,209,32,137,144,20,28,146,128,137,166,75,209,129,9,32,160,122,152,
+0,40,225,72,185,130,8,152,148,16,8,152,121,200,34,142,145,1,42,226,18,137,16,57,204,6,29,24,168,65,137,1,
+9,193,81,140,162,90,153,129,34,15,17,26,25,17,15,193,64,152,179,134,138,26,138,161,167,32,233,18,0,160,165,24,
+29,130,17,242,48,142,164,8,40,144,168,9,181,17,170,7,12,128,146,57,24,178,160,129,160,74,244,57,10,40,147,40,
+227,144,59,146,79,185,40,73,72,176,81,10,26,72,157,150,139,147,26,121,137,130,10,0,58,28,210,145,17,216,97,28,
+131,42,16,147,31,243,8,178,144,161,48,153,144,80,226,72,155,149,9,0,179,56,136,56,74,234,18,45,153,145,121,169,
+132,26,160,20,30,179,26,128,209,65,60,209,17,136,145,93,184,33,137,0,163,57,240,18,136,227,64,140,145,41,24,177,
+64,184,2,169,197,18,47,152,25,89,170,18,10,146,97,200,164,40,169,2,24,46,160,56,243,12,74,0,8,73,15,180,
+25,160,210,33,42,8,106,152,18,13,130,25,145,212,131,59,177,32,155,165,63,226,0,24,200,133,10,0,128,16,178,75,
+208,131,59,11,199,40,179,8,56,177,125,185,1,0,152,164,8,145,152,75,145,105,156,132,9,146,166,42,208,17,32,24,
+110,169,130,144,161,130,11,176,99,10,49,31,161,152,26,195,195,33,200,81,26,136,59,245,0,146,144,18,44,193,0,59,
+130,157,166,0,25,25,48,143,164,44,17,10,160,132,153,146,24,120,26,3,171,133,128,193,88,155,136,104,46,193,17,153,
+130,138,51,30,177,1,136,144,183,121,168,8,33,136,11,151,152,128,184,81,12,146,40,12,17,193,32,74,15,32,27,177,
+6,138,0,161,52,30,211,128,128,146,130,27,225,25,18,10,242,149,43,25,138,96,185,131,48,28,162,195,92,168,176,35,
+176,145,4,193,0,211,89,202,165,0,152,146,64,156,132,27,57,213,129,72,155,0,194,64,177,51,154,177,7,26,139,228,
+136,57,169,134,41,9,58,184,82,187,167,40,11,16,8,152,21,142,65,176,177,52,15,8,9,136,146,17,91,43,152,32,
+139,13,8,30,166,2,41,144,91,8,146,136,16,187,63,147,1,177,134,142,16,195,8,130,31,136,194,64,137,16,41,177,
+148,184,181,60,248,32,146,168,5,8,25,162,218,147,29,152,146,132,105,136,75,177,128,144,25,74,248,146,33,160,20,56,
+130,156,18,218,41,15,176,122,16,9,2,169,148,225,8,136,27,211,132,56,136,145,34,208,31,162,169,64,209,34,9,128,
+17,153,146,250,160,10,153,1,37,94,17,137,129,9,173,18,156,4,129,51,31,65,152,0,59,157,27,153,0,136,183,18,
+147,11,7,42,27,153,137,232,137,67,129,123,179,180,48,185,153,232,192,56,28,2,4,146,32,210,59,152,159,194,129,41,
+35,160,52,184,5,106,136,139,8,248,16,137,133,43,162,18,91,160,58,156,217,128,168,35,99,57,202,37,29,147,173,149,
+128,44,129,144,2,128,152,181,41,8,63,185,147,138,72,47,41,162,129,164,128,60,193,148,1,162,168,124,146,57,152,179,
+15,177,19,139,165,10,16,157,72,136,16,0,152,198,149,8,2,140,145,1,159,132,136,0,57,168,147,27,153,249,63,0,
+167,8,242,1,9,138,9,41,66,168,23,162,9,210,165,73,9,193,75,146,28,162,130,156,162,33,187,39,186,6,154,0,
+17,11,4,141,146,162,42,131,241,24,35,142,50,241,128,40,169,56,11,243,160,3,74,32,155,136,196,89,168,65,193,168,
+81,41,60,24,201,8,149,137,80,26,141,129,75,144,96,11,0,152,1,130,27,144,194,62,136,106,137,198,145,0,178,73,
+0,176,40,164,29,41,137,10,1,242,163,33,160,91,62,163,56,242,177,1,35,15,146,128,187,97,11,49,91,216,129,25,
+162,40,226,17,153,1,153,196,65,169,42,60,209,32,167,152,24,166,58,162,136,184,22,13,145,9,200,34,43,134,26,145,
+27,43,135,155,165,128,0,64,184,24,130,249,80,9,10,56,168,201,199,132,25,145,41,160,40,208,196,16,168,136,163,2,
+137,55,156,128,34,204,21,138,136,96,186,18,25,11,105,138,25,145,160,228,32,81,138,105,153,16,8,182,26,1,209,41,
+147,45,145,146,29,136,107,169,16,209,18,139,147,25,226,132,201,3,45,160,82,11,194,82,170,88,153,211,56,200,16,168,
+161,144,132,56,211,64,144,25,60,161,75,130,24,93,148,9,40,160,153,167,138,24,49,15,145,107,152,40,136,146,30,177,
+40,154,34,241,163,58,130,120,160,208,145,182,25,130,9,152,149,59,0,140,144,178,95,160,0,129,177,73,181,42,32,136,
+216,6,153,16,0,154,112,152,146,48,10,186,139,137,159,135,25,160,96,137,57,58,202,129,26,91,123,8,160,144,150,153,
+19,44,232,4,153,41,43,26,17,9,162,4,27,243,26,165,169,50,1,154,55,153,144,53,202,89,139,152,72,152,64,157,
+148,137,131,76,152,192,163,161,104,137,9,145,163,161,5,41,159,64,141,34,137,178,89,8,138,33,154,46,168,0,8,33,
+50,244,64,233,18,144,146,76,145,137,88,24,153,164,17,170,132,27,175,121,185,50,169,166,24,145,56,155,146,172,192,51,
+202,38,57,218,80,208,16,136,145,59,163,26,160,179,42,132,108,137,42,41,200,107,129,11,7,8,136,20,186,122,8,11,
+128,32,139,5,137,164,13,162,41,192,81,171,64,10,9,49,31,25,24,25,16,25,240,153,38,31,16,24,169,33,171,131,
+105,254,66,0,170,185,82,45,17,139,6,17,173,5,139,2,129,216,52,138,40,16,241,16,40,155,24,144,241,192,33,160,
+147,90,211,92,152,0,137,211,144,24,17,9,22,144,202,5,155,48,10,242,64,153,128,8,184,121,153,130,9,0,40,233,
+98,152,137,4,161,73,2,186,51,189,57,8,129,129,7,72,203,8,192,162,77,145,156,5,153,32,153,129,61,179,176,23,
+0,157,105,168,16,8,1,62,8,184,147,152,91,169,74,152,80,1,192,107,128,10,18,146,30,4,153,41,4,15,130,8,
+9,50,15,128,11,162,57,234,36,187,65,193,16,40,12,139,49,196,72,2,248,16,146,29,1,41,170,147,184,56,142,137,
+135,26,0,193,34,26,14,18,153,48,88,201,99,193,8,17,171,80,138,162,56,24,43,250,146,42,192,122,177,58,195,176,
+1,72,13,41,165,152,134,168,144,82,141,129,129,177,88,160,152,147,28,129,203,19,136,67,75,201,122,184,18,40,179,107,
+130,140,80,200,1,128,1,29,146,25,243,41,137,2,47,129,170,50,27,10,192,193,160,39,11,81,136,216,81,12,24,25,
+177,57,145,155,128,208,80,217,49,137,73,74,176,123,136,144,17,129,144,7,168,48,208,57,144,123,153,18,10,195,11,128,
+210,26,20,187,81,138,160,161,197,168,115,185,2,165,0,76,168,8,41,24,185,69,13,136,210,129,152,91,178,0,33,17,
+143,49,140,17,165,161,82,170,160,151,26,129,58,144,75,128,161,171,136,183,177,51,224,108,144,25,136,137,168,120,178,40,
+149,10,8,195,9,49,46,10,56,173,16,210,58,130,28,164,161,24,52,204,67,170,17,88,144,89,179,154,5,171,1,43,
+164,155,151,73,200,16,137,161,41,134,13,2,139,145,24,202,122,129,138,147,133,232,18,155,33,1,129,138,179,241,33,141,
+121,27,57,160,1,98,216,8,181,8,0,8,168,3,224,88,153,128,8,148,11,3,98,233,16,25,8,44,130,171,67,156,
+40,27,168,15,20,146,35,9,244,57,192,137,24,0,16,187,25,131,163,76,167,73,40,142,4,152,136,24,240,130,41,149,
+41,152,10,211,21,10,32,187,63,128,11,185,147,164,69,81,169,211,24,90,25,9,171,11,234,24,29,194,32,139,133,121,
+136,40,154,51,190,10,73,0,28,243,41,184,25,18,24,82,40,136,51,232,49,46,3,168,205,17,153,153,35,56,144,121,
+209,2,9,11,77,211,153,163,73,137,40,2,180,43,114,12,1,144,160,113,184,10,3,185,161,97,138,41,8,15,194,24,
+72,58,57,251,184,112,170,0,51,200,1,1,139,18,143,148,48,224,0,27,146,29,24,4,140,130,146,139,82,28,17,0,
+242,144,8,146,75,136,21,184,8,7,170,19,32,154,67,161,191,145,26,57,208,97,147,153,57,224,160,148,17,161,50,185,
+79,141,145,129,42,35,40,140,209,177,13,132,56,25,162,2,159,27,192,144,50,64,18,11,234,179,217,65,66,59,48,242,
+137,153,0,168,3,57,85,154,185,19,141,9,66,64,144,2,174,216,144,19,11,120,130,160,176,128,59,142,3,35,160,17,
+129,255,43,210,132,144,64,152,129,139,179,72,155,150,49,0,0,33,222,136,33,129,27,113,154,24,216,193,35,11,56,130,
+130,64,29,219,138,144,114,25,106,193,1,201,1,0,194,1,32,42,28,33,236,137,2,34,155,121,163,208,137,1,73,138,
+33,2,18,160,21,253,161,49,41,136,107,177,90,170,168,133,161,128,81,136,25,8,249,8,24,16,33,47,147,138,248,129,
+129,164,56,74,137,152,160,186,47,130,72,9,41,149,11,217,16,34,176,56,106,121,160,162,138,42,20,24,184,96,242,139,
+129,152,81,0,154,34,3,43,251,12,58,148,42,133,153,5,172,144,19,2,24,43,75,66,189,187,9,59,23,56,58,128,
+242,158,1,50,41,137,1,73,148,241,154,2,49,1,72,16,249,168,159,35,1,42,129,169,72,243,139,152,20,33,8,46,
+1,250,24,138,36,40,153,130,147,224,192,156,48,50,28,35,153,201,174,34,9,36,34,170,129,195,189,140,52,90,130,49,
+177,225,155,10,51,250,51,144,94,8,216,10,17,40,145,1,32,225,219,17,176,53,10,72,56,192,184,170,58,49,194,121,
+16,217,161,138,56,150,49,13,24,2,249,169,49,56,136,81,128,176,224,56,40,146,194,83,14,0,209,154,18,24,61,146,
+130,184,170,64,88,185,6,169,104,160,153,137,16,123,1,26,17,233,139,24,130,52,208,57,17,25,200,175,64,129,136,34,
+161,172,128,11,23,131,32,179,19,37,65,0,161,128,160,255,43,34,169,6,0,169,154,140,21,136,131,67,172,49,201,142,
+128,25,22,152,40,35,175,25,136,24,16,166,64,11,24,201,202,48,137,35,80,128,3,222,42,32,178,65,4,161,17,33,
+191,201,179,32,48,27,38,185,158,2,10,145,133,32,48,186,65,190,157,5,137,48,0,56,40,251,0,152,11,136,7,89,
+9,10,24,158,133,136,10,18,74,9,145,27,147,196,65,1,73,169,146,153,252,165,136,25,130,16,145,160,106,144,9,28,
+40,50,250,128,144,203,7,152,56,105,138,72,136,138,10,201,19,74,128,48,200,32,175,37,185,13,35,40,15,179,178,16,
+129,64,17,161,80,9,138,175,134,152,12,148,128,152,144,4,0,59,2,41,79,160,128,26,175,1,178,10,22,145,57,130,
+171,104,140,0,80,10,132,249,9,32,26,136,33,3,234,163,131,157,136,7,16,129,2,242,155,41,169,18,129,16,167,12,
+73,137,25,23,184,19,88,202,153,45,56,185,66,133,186,57,9,11,6,163,8,162,18,251,173,112,8,9,50,139,225,136,
+17,73,8,163,9,57,156,15,42,133,128,130,163,249,26,145,136,53,152,171,54,44,157,145,51,9,144,131,186,175,2,128,
+65,8,184,113,146,203,177,37,137,24,96,152,173,1,148,26,32,145,122,42,236,128,17,137,128,130,77,10,177,3,40,216,
+130,80,17,221,1,34,171,113,145,138,72,16,160,32,26,137,41,148,175,10,151,161,41,162,187,33,133,56,154,156,96,145,
+170,11,121,56,8,2,219,138,35,193,131,145,171,81,135,251,128,3,136,17,8,141,9,49,74,171,107,0,2,5,219,33,
+1,209,35,251,8,0,136,130,169,13,6,24,241,8,56,144,57,58,142,27,21,136,9,129,146,49,200,175,130,131,24,163,
+241,137,32,56,128,169,91,65,17,240,31,57,145,40,17,141,42,5,8,152,193,1,147,162,251,153,82,24,171,131,14,24,
+20,9,129,141,73,132,155,13,32,128,5,168,208,152,34,164,225,0,161,129,34,250,27,104,0,25,26,138,40,0,9,212,
+153,67,2,32,240,153,36,181,176,181,137,40,5,140,40,171,35,50,172,47,9,4,136,138,178,217,82,2,202,18,26,129,
+210,240,128,65,25,136,153,43,13,19,130,171,61,227,68,0,2,5,128,56,255,161,5,137,2,144,187,52,48,153,57,14,
+5,8,217,137,91,129,160,73,177,169,82,145,136,8,45,66,192,232,24,0,17,1,152,202,40,51,9,159,145,20,92,137,
+233,8,3,73,152,178,59,137,132,48,250,58,81,177,4,171,192,69,154,129,144,193,41,25,131,216,12,67,41,144,243,10,
+57,178,34,28,156,130,149,73,8,128,26,90,10,131,190,201,36,26,178,65,142,32,136,146,40,139,150,168,123,145,27,128,
+243,49,128,168,51,240,1,161,178,72,217,57,9,139,113,136,153,150,144,25,193,56,178,218,67,130,158,130,72,58,28,0,
+8,224,162,56,173,131,8,210,49,25,42,62,184,112,153,144,3,187,135,146,75,128,130,41,180,58,73,11,31,177,26,18,
+186,92,129,195,179,43,41,135,28,18,176,46,2,13,145,129,41,145,25,168,182,169,112,186,65,9,193,57,41,152,29,211,
+17,144,176,83,158,133,162,42,35,26,10,134,12,48,9,31,146,13,32,200,8,163,164,0,24,178,68,143,32,153,43,82,
+140,1,152,2,160,176,129,183,137,90,211,25,26,57,77,160,48,137,193,8,17,240,0,226,1,82,140,19,58,154,50,12,
+56,43,250,130,187,49,212,154,65,180,57,11,16,88,187,120,0,156,34,194,144,2,153,5,139,168,151,43,59,3,143,128,
+128,168,151,8,128,58,11,4,136,61,162,40,126,153,56,161,128,65,194,25,146,200,122,153,136,50,172,41,24,43,145,184,
+39,181,12,2,170,9,149,90,25,161,49,232,153,32,154,10,7,10,212,40,153,33,28,147,24,160,82,170,28,11,57,110,
+165,129,0,195,57,162,75,26,9,63,177,155,163,147,157,115,137,177,32,168,7,139,3,11,30,81,12,8,0,128,162,210,
+32,155,180,82,217,49,156,146,40,243,0,41,177,128,165,184,146,24,40,19,75,105,60,161,167,42,129,0,61,1,15,41,
+8,218,3,0,8,107,8,9,185,49,145,142,5,137,0,8,59,25,243,74,152,194,176,181,57,59,18,14,195,148,24,145,
+60,42,240,1,144,45,34,24,88,72,234,18,25,9,91,170,18,218,146,194,136,123,128,161,3,42,91,161,136,0,250,17,
+147,144,170,161,167,145,107,26,9,74,148,152,211,41,208,19,169,9,70,0,155,128,89,168,49,154,24,47,25,97,128,176,
+34,177,24,244,26,128,0,45,160,62,40,179,31,3,145,59,50,187,244,9,16,28,26,179,146,113,137,130,49,175,146,132,
+140,40,12,146,136,130,77,0,48,108,152,152,33,42,143,136,32,152,3,104,168,140,4,2,136,224,57,1,203,72,28,156,
+19,0,195,128,25,39,160,184,160,250,117,153,145,160,16,30,74,42,24,24,24,56,170,226,128,218,193,36,57,32,138,147,
+10,178,230,136,178,152,109,8,176,72,153,16,129,65,146,137,42,170,243,11,148,146,50,24,89,248,162,2,41,141,192,243,
+1,162,129,129,40,89,168,136,7,26,138,161,204,147,179,132,122,137,0,9,27,148,136,138,160,162,90,244,17,34,9,210,
+57,12,179,24,158,194,8,108,0,194,2,9,136,131,62,136,149,12,146,210,73,128,161,148,136,10,180,25,81,177,46,137,
+210,50,40,12,145,137,44,145,1,112,184,28,137,208,52,58,184,194,25,75,41,129,5,136,14,60,192,51,129,153,200,10,
+57,18,147,132,191,43,25,8,119,10,10,178,16,88,136,57,144,240,25,2,10,135,153,11,129,26,66,137,8,165,143,17,
+144,17,147,204,20,9,40,161,202,113,186,17,42,137,36,233,136,147,130,122,153,129,161,155,65,137,97,138,224,17,48,9,
+210,0,49,242,61,128,40,160,161,44,177,48,145,201,6,144,142,48,200,34,226,9,131,24,56,168,31,4,202,74,0,26,
+133,138,152,149,128,129,172,65,146,159,2,144,56,194,11,34,145,4,149,138,99,233,41,24,144,33,202,59,164,177,18,141,
+129,7,220,33,8,8,17,185,107,2,26,9,129,58,150,159,2,162,144,179,154,35,184,49,138,159,69,232,43,64,153,49,
+186,46,19,152,17,194,128,151,217,33,161,48,26,202,122,144,9,0,43,34,168,207,36,169,2,176,152,18,132,41,184,66,
+0,251,44,34,9,8,249,58,133,168,16,136,57,194,15,40,165,169,147,170,50,7,137,2,9,34,251,10,115,153,1,10,
+170,112,193,0,128,57,177,142,1,130,9,145,202,52,160,17,60,180,7,250,24,16,8,16,154,10,133,161,152,11,114,160,
+173,66,194,32,153,169,80,144,32,11,49,54,250,25,3,75,9,185,58,151,134,26,77,0,136,136,137,82,225,169,80,161,
+57,184,184,17,53,142,1,41,150,185,160,37,138,128,200,40,32,176,45,131,123,161,157,17,2,176,146,188,5,56,232,48,
+145,7,156,41,34,136,9,240,0,48,153,12,132,1,176,15,72,136,145,138,9,20,178,25,216,36,8,249,40,164,0,9,
+186,64,3,243,168,24,6,203,40,49,168,137,168,79,1,136,25,168,98,144,157,34,145,5,153,201,36,25,10,144,224,135,
+185,41,148,8,128,160,12,20,168,153,3,36,16,223,34,128,161,160,137,56,64,140,146,136,2,249,156,23,160,0,12,24,
+106,160,136,9,4,136,28,49,181,178,130,156,17,35,29,10,51,168,241,31,17,145,24,219,73,144,148,25,9,121,178,140,
+33,17,26,160,249,32,0,26,168,132,49,250,60,129,1,160,184,143,35,9,161,0,76,131,191,2,134,128,129,10,59,134,
+128,9,26,112,224,153,50,25,41,170,249,34,144,24,25,200,21,241,137,34,24,8,9,140,66,177,42,141,132,1,205,58,
+134,0,144,136,140,66,184,145,56,40,178,175,40,23,25,152,153,0,84,155,144,136,66,248,138,49,8,131,153,249,48,33,
+140,136,146,3,220,138,68,24,179,137,13,41,151,144,168,34,16,191,58,51,57,144,234,10,105,181,8,144,1,147,189,41,
+22,56,169,144,137,120,144,152,9,49,245,12,48,161,2,144,232,0,35,154,128,9,19,220,140,114,152,131,8,171,0,6,
+137,152,57,150,220,0,4,136,17,152,28,59,167,129,128,42,177,173,64,3,16,0,158,144,17,3,177,42,63,242,11,96,
+8,0,0,171,27,21,9,42,211,17,220,136,113,9,0,1,140,9,3,161,3,156,21,173,154,23,136,16,177,152,11,150,
+48,25,139,18,191,128,6,40,41,210,130,29,89,136,136,42,162,235,136,132,8,178,148,169,75,10,176,81,152,42,224,128,
+90,16,32,133,10,60,196,1,25,35,139,243,24,9,146,18,50,206,18,216,16,65,170,137,136,184,83,26,129,122,169,16,
+155,56,192,146,57,8,152,24,183,180,180,84,131,143,130,163,41,24,12,163,4,136,192,230,0,153,25,152,58,153,233,160,
+151,0,48,160,177,50,249,8,129,90,139,137,40,88,169,179,34,168,68,159,145,130,24,28,1,227,65,0,44,32,46,145,
+33,153,72,163,9,120,0,178,64,44,4,24,122,137,162,161,243,25,128,74,152,201,33,27,128,134,27,0,73,224,8,148,
+8,10,10,184,2,52,184,112,16,157,147,41,170,56,250,26,161,64,154,208,66,233,49,232,16,56,184,130,153,68,8,5,
+0,32,157,161,161,161,11,0,206,43,165,184,112,8,1,140,148,41,106,153,209,128,32,24,25,18,26,167,42,56,14,0,
+24,14,136,145,8,16,62,129,157,50,147,186,84,155,75,146,4,25,18,151,144,43,160,137,132,143,1,138,26,43,42,112,
+210,8,42,146,25,172,2,145,12,124,193,3,33,208,56,160,129,145,11,142,148,42,76,168,162,147,142,164,49,26,202,120,
+16,42,155,50,89,65,168,178,183,132,138,192,176,1,9,154,168,112,60,42,128,162,57,176,152,151,128,249,17,144,49,169,
+151,128,1,27,147,62,137,106,43,74,14,177,136,133,144,152,179,195,65,153,8,72,74,128,145,55,74,200,18,156,17,217,
+136,2,224,146,168,25,67,200,24,137,121,57,168,32,169,9,210,142,99,144,8,48,232,17,145,14,0,168,145,216,56,50,
+156,163,57,15,51,186,132,18,177,24,11,84,150,160,147,152,91,9,186,29,149,24,173,8,148,128,1,10,194,3,226,40,
+58,2,158,59,12,21,146,40,26,161,58,243,153,72,200,144,47,57,137,209,2,10,25,84,202,20,129,9,184,33,49,37,
+136,145,168,150,192,57,159,16,26,235,32,130,137,148,153,145,149,210,130,24,64,204,44,0,129,147,196,16,129,136,50,251,
+145,1,189,73,137,163,9,75,10,0,121,193,18,134,128,141,40,50,33,136,135,152,16,128,249,176,65,154,201,57,178,28,
+48,168,43,100,168,136,164,34,251,139,32,2,132,34,59,42,128,245,8,63,144,154,42,40,26,136,164,168,32,69,169,32,
+7,0,173,72,1,40,65,128,155,132,178,61,217,16,194,141,75,1,10,90,138,41,50,160,59,75,106,201,159,50,137,32,
+1,201,0,133,177,180,168,21,143,25,0,137,129,152,10,7,145,1,1,2,134,173,65,145,32,33,185,56,121,29,8,153,
+9,224,155,2,179,56,225,144,2,151,40,40,42,73,204,10,65,12,128,131,10,57,164,153,6,184,122,187,9,238,63,0,
+185,6,8,184,164,0,56,26,195,38,25,0,186,107,96,42,162,132,128,169,196,24,24,171,130,142,28,161,33,11,65,152,
+145,149,145,165,138,136,190,144,96,43,144,151,0,74,153,130,10,153,26,250,33,10,200,106,144,4,152,180,48,16,49,18,
+58,112,178,89,10,148,41,140,187,132,143,160,212,32,178,0,138,167,18,25,169,161,149,29,41,43,42,32,173,148,133,57,
+138,184,120,139,184,147,32,28,242,0,59,72,163,147,25,96,25,46,145,162,129,2,47,224,181,130,192,179,34,186,24,24,
+208,66,11,149,32,43,9,241,130,56,191,69,171,195,4,141,18,138,89,152,0,136,181,128,90,152,123,170,167,72,154,163,
+0,138,35,12,196,2,232,66,141,148,58,184,18,27,194,33,140,166,128,56,185,131,40,240,0,136,104,137,152,4,169,163,
+32,46,128,154,3,59,192,131,46,197,16,185,21,60,137,9,211,16,1,26,44,131,130,11,7,12,24,141,1,10,161,195,
+24,132,81,185,53,201,130,169,42,43,50,248,9,112,60,177,64,168,224,193,41,153,136,133,138,6,26,1,24,9,45,217,
+129,24,121,161,162,35,59,128,32,249,16,141,1,24,0,51,156,96,43,209,131,137,185,74,217,50,0,57,202,17,121,184,
+140,182,57,10,90,144,136,148,152,97,137,208,2,138,24,27,145,17,151,137,8,97,169,57,250,17,168,56,8,24,10,57,
+161,114,249,179,44,2,59,50,143,147,211,56,34,74,28,208,137,18,160,4,28,170,8,81,17,76,156,192,145,135,24,129,
+12,136,145,81,129,75,170,192,146,19,32,8,174,184,80,48,2,77,218,160,16,18,32,160,173,10,131,80,81,43,242,11,
+8,49,16,129,186,251,65,72,40,28,196,140,1,1,40,161,172,0,59,4,51,143,150,140,1,1,41,129,171,168,128,38,
+17,141,166,171,3,3,73,192,12,129,25,67,144,170,167,13,33,40,136,193,186,1,90,3,177,152,183,46,17,41,1,184,
+203,36,26,131,177,183,192,9,35,75,128,172,169,130,112,41,153,183,137,57,3,61,178,201,25,4,0,25,130,231,42,40,
+0,136,177,168,41,0,128,128,114,247,41,41,8,136,179,169,32,64,152,178,97,231,57,24,24,137,178,136,17,10,40,185,
+51,3,65,0,20,245,44,16,160,0,178,171,81,32,26,41,72,231,42,24,2,27,176,153,2,57,12,130,49,231,30,33,
+136,128,162,188,20,0,144,40,74,166,15,16,145,161,162,138,56,129,177,3,65,7,175,2,131,152,147,205,64,24,137,162,
+163,68,175,0,3,152,0,201,40,16,168,162,148,115,159,0,18,8,9,187,72,131,177,41,2,121,248,144,50,160,41,185,
+170,20,211,168,48,115,233,160,17,133,9,184,136,5,164,160,1,83,200,200,16,19,26,186,157,16,5,169,43,121,161,193,
+27,114,25,169,8,25,34,145,28,80,177,163,191,65,1,152,138,216,34,130,169,60,199,4,172,48,16,168,136,193,40,66,
+154,57,230,34,185,26,50,179,42,169,28,115,168,60,192,97,169,137,32,161,16,136,219,20,130,28,242,80,177,11,57,149,
+153,145,176,48,130,173,167,56,33,174,8,132,8,16,12,0,18,217,148,75,18,204,136,51,153,25,12,59,81,169,181,74,
+51,209,157,34,131,0,140,152,35,160,225,92,0,8,159,17,129,161,137,176,64,16,211,30,3,2,252,0,33,0,139,128,
+32,129,18,159,2,49,251,26,49,128,186,178,144,132,149,15,2,16,241,11,65,32,11,160,40,3,6,142,2,24,179,174,
+131,49,186,161,186,20,36,191,3,56,177,174,24,23,9,137,0,137,37,187,24,145,37,234,138,98,152,128,10,153,114,184,
+1,8,3,192,143,49,129,137,25,154,113,194,10,129,2,132,189,57,7,152,136,160,104,144,136,136,2,1,250,10,83,8,
+10,169,107,129,26,169,81,34,241,140,48,130,27,186,60,148,17,201,33,17,135,173,0,5,160,144,43,145,80,168,26,19,
+135,204,9,4,128,138,59,146,113,128,153,58,69,217,138,33,3,169,43,200,65,163,171,57,85,137,190,24,6,160,10,161,
+16,5,185,10,82,165,218,8,83,144,11,144,26,52,170,170,114,24,168,159,66,145,153,0,139,21,160,171,82,1,129,175,
+3,20,170,145,185,37,136,184,60,17,65,248,12,34,152,144,170,68,26,169,43,36,49,211,159,49,162,128,186,145,18,229,
+168,17,18,4,252,9,3,148,169,1,26,16,161,153,114,81,168,143,56,34,202,24,153,33,0,234,32,19,131,239,136,6,
+160,128,160,25,191,223,76,0,34,200,129,18,33,249,12,65,129,27,136,140,32,148,139,32,65,9,239,18,131,8,153,216,
+17,37,139,16,1,17,251,12,66,152,152,29,136,49,136,139,168,54,234,8,74,3,162,174,18,129,49,157,162,65,178,154,
+157,112,129,154,152,48,123,176,41,136,35,57,207,48,163,152,241,72,144,130,10,129,17,2,248,139,114,161,8,58,16,25,
+240,9,18,40,137,175,58,134,136,138,16,2,144,169,17,67,135,175,144,36,144,154,73,25,1,169,184,82,120,154,142,32,
+5,139,8,0,129,130,249,17,32,137,236,129,35,177,153,56,74,43,150,12,34,40,217,139,114,129,138,24,138,147,148,201,
+64,10,163,250,25,36,184,60,176,16,34,192,77,144,16,185,45,64,4,156,17,11,2,130,172,8,64,134,175,18,3,170,
+24,185,35,17,187,29,56,104,242,43,35,32,12,8,41,83,176,220,104,0,136,157,33,1,169,144,176,97,178,153,45,33,
+65,252,16,2,128,137,128,13,134,152,137,33,56,248,10,49,129,10,45,184,21,177,139,32,82,128,191,2,134,9,128,169,
+32,147,28,161,105,34,251,152,114,9,128,153,128,19,186,57,75,49,241,169,80,129,8,201,168,4,145,40,12,59,23,189,
+2,3,25,160,217,17,145,24,45,177,71,233,24,48,25,10,138,26,16,120,156,129,80,192,10,72,0,8,9,219,35,48,
+160,161,113,149,187,16,133,137,184,212,24,16,9,139,17,23,233,136,18,58,136,137,15,49,136,152,57,115,192,170,113,136,
+8,136,155,65,160,0,10,121,211,153,56,163,41,178,220,56,148,128,24,58,23,188,0,6,137,129,168,9,132,1,26,184,
+101,249,8,33,10,16,170,12,132,57,144,24,120,226,26,32,8,40,170,204,21,9,129,26,40,167,157,18,145,16,185,232,
+50,24,90,24,10,20,175,1,146,59,162,249,0,17,41,130,155,55,204,1,65,11,17,202,0,129,0,36,249,65,201,8,
+73,136,40,216,152,129,0,50,168,75,183,155,49,128,1,243,153,147,25,114,161,137,151,201,0,146,17,129,156,25,10,124,
+146,136,32,225,28,0,0,1,1,173,18,25,38,42,24,134,189,1,161,40,19,217,73,186,41,130,128,71,184,142,24,185,
+36,18,154,19,185,15,17,16,2,16,71,0,35,170,15,200,128,72,1,136,20,154,159,17,146,17,58,217,137,226,17,8,
+132,3,171,139,150,128,16,153,123,128,25,128,128,99,200,176,21,152,60,160,155,134,8,10,34,44,2,158,136,135,137,24,
+43,192,1,162,75,107,146,13,130,0,154,145,45,181,161,20,41,29,18,216,152,50,176,15,57,200,129,148,9,41,130,1,
+200,65,32,160,159,135,0,129,66,141,17,8,217,16,0,27,14,146,154,132,8,169,35,58,40,207,81,41,172,19,160,132,
+33,186,17,73,243,184,2,144,15,130,168,18,32,154,32,31,151,9,13,49,156,40,130,154,97,178,76,24,146,42,160,56,
+193,32,201,163,210,113,27,153,40,161,187,74,197,8,33,154,6,57,138,58,212,48,177,201,153,134,154,197,130,136,18,140,
+32,25,241,16,225,57,147,178,26,53,45,185,32,138,164,42,15,41,129,136,164,18,48,146,31,4,209,73,176,153,64,128,
+168,48,160,32,28,220,7,10,168,73,152,32,160,241,17,145,62,160,163,25,148,14,1,50,171,17,178,122,10,176,178,196,
+80,12,152,16,132,186,96,8,169,66,185,41,1,184,179,113,136,151,58,57,152,140,198,0,136,26,149,156,3,198,8,48,
+59,139,145,176,66,142,96,184,145,35,226,0,57,200,147,167,132,46,8,15,24,136,130,8,8,34,10,243,32,173,33,48,
+43,5,10,152,44,40,12,227,24,201,19,106,169,1,184,18,106,9,193,19,168,0,63,128,161,154,134,16,9,1,203,56,
+218,147,62,128,106,161,144,4,187,150,24,168,131,107,139,49,26,242,130,161,160,65,29,74,138,1,139,148,89,152,161,0,
+242,35,62,137,27,18,171,89,152,163,9,53,142,19,60,45,27,73,152,41,42,2,192,64,28,105,29,24,138,48,137,8,
+19,129,138,11,186,123,56,109,10,58,25,145,143,162,1,24,232,3,186,166,27,58,147,132,136,106,10,68,218,64,26,26,
+168,144,196,145,136,5,153,16,137,123,128,40,170,24,32,136,122,24,186,39,169,74,129,163,180,10,202,22,154,81,29,8,
+210,0,168,130,178,57,192,151,129,40,27,144,197,25,137,176,182,178,242,132,41,41,59,153,165,168,130,152,225,146,197,2,
+128,32,195,144,227,8,178,1,234,163,210,146,192,213,73,0,150,16,144,130,194,180,198,32,153,144,211,128,130,129,0,16,
+243,242,146,136,144,162,195,33,152,130,146,114,200,193,195,128,161,25,195,144,33,211,134,16,145,138,196,161,41,139,195,25,
+209,5,1,8,4,250,179,75,155,211,148,24,129,50,24,17,151,201,131,13,137,177,131,10,160,134,17,59,166,241,16,138,
+137,32,25,48,10,33,135,168,7,217,32,11,170,146,64,60,144,74,2,225,81,201,17,10,184,152,36,108,25,25,24,184,
+4,200,56,59,141,144,88,76,0,57,0,24,72,248,41,10,168,0,41,78,24,60,32,152,122,152,44,136,209,1,57,46,
+1,27,0,129,108,160,59,137,160,75,121,28,17,137,145,2,58,24,15,160,128,63,74,138,17,176,132,41,75,32,143,146,
+1,47,32,12,32,161,8,32,11,51,158,9,1,15,73,155,80,136,128,49,156,51,143,144,131,14,80,139,40,130,168,17,
+137,121,137,136,145,187,112,153,24,150,144,40,42,122,169,161,18,159,64,137,9,4,152,1,24,106,136,153,51,159,105,152,
+8,2,168,129,128,75,192,152,2,235,123,145,136,34,184,32,16,59,196,160,64,143,76,128,152,2,178,144,16,44,182,168,
+50,13,63,161,160,4,161,0,128,42,180,185,120,138,44,180,176,135,145,24,128,41,181,144,105,138,27,167,144,17,144,41,
+168,24,167,137,73,154,28,166,144,18,168,16,144,74,198,24,91,153,9,164,161,18,136,24,145,76,197,8,25,224,0,179,
+9,3,168,48,243,56,226,26,8,241,2,146,25,149,128,129,8,65,226,75,152,240,146,145,24,147,27,0,208,36,184,94,
+153,177,147,129,56,32,47,136,144,134,184,90,153,184,151,145,56,25,45,144,128,4,170,123,153,136,180,130,32,154,89,152,
+9,7,169,89,138,10,181,2,32,10,73,160,76,146,176,0,203,89,209,48,32,156,88,168,107,129,192,1,184,72,168,72,
+16,157,18,176,105,144,168,163,240,88,153,48,1,172,67,138,91,178,152,197,177,88,154,48,16,172,34,42,124,161,152,165,
+168,65,154,72,1,203,3,152,123,128,154,166,176,80,138,73,0,170,3,137,105,144,169,167,152,48,138,92,129,153,17,10,
+72,179,217,150,153,48,138,77,1,169,18,138,41,149,170,6,75,24,76,0,186,88,136,61,2,168,0,242,1,1,136,57,
+186,78,9,44,19,153,25,210,58,3,184,225,166,43,56,31,2,128,152,163,25,56,163,242,56,46,12,136,32,129,144,32,
+13,42,66,242,90,43,169,49,168,20,128,43,137,153,66,165,155,120,140,58,178,26,135,136,24,154,57,50,30,123,184,153,
+134,153,20,136,58,153,138,35,57,46,179,175,131,226,48,16,137,74,12,128,88,9,75,139,161,131,137,100,138,24,26,9,
+123,89,169,161,128,138,210,121,128,136,72,138,27,81,144,139,151,152,16,193,66,24,26,3,159,24,131,250,18,169,152,40,
+44,2,9,82,15,137,67,139,179,148,11,44,176,64,2,25,104,143,32,137,130,93,169,0,144,8,2,131,61,240,17,168,
+35,187,151,26,137,129,74,3,9,169,65,188,22,8,16,208,130,44,169,22,9,153,17,188,64,40,211,72,13,42,136,91,
+34,172,50,218,8,49,146,63,184,152,17,201,36,200,80,224,0,24,147,160,162,42,200,147,72,210,32,242,160,24,3,128,
+108,170,177,33,136,51,76,176,133,11,67,40,173,182,144,41,160,57,41,244,1,154,17,33,248,33,154,42,160,0,51,245,
+73,184,33,32,225,56,200,137,131,170,99,209,25,178,40,48,147,15,178,185,33,241,64,178,25,145,8,104,146,155,150,185,
+104,144,58,151,10,145,0,59,151,155,147,153,42,32,15,134,10,162,40,136,135,170,131,154,57,58,13,7,154,129,144,8,
+22,218,2,152,42,17,14,133,136,137,2,138,5,200,0,136,29,1,153,135,152,145,32,168,84,216,17,10,9,56,217,6,
+152,144,57,9,64,216,128,137,41,25,200,23,152,137,48,28,19,217,0,27,30,1,225,35,10,128,78,8,0,176,130,30,
+27,130,193,36,185,17,46,128,18,240,32,12,27,129,146,96,9,8,107,1,0,192,2,12,28,130,177,82,27,13,41,56,
+8,203,130,15,10,2,181,112,10,0,43,50,11,185,130,158,57,209,148,121,137,57,139,66,137,176,136,129,15,161,148,107,
+136,24,26,34,144,201,164,27,29,131,24,122,145,24,59,4,24,241,41,201,136,16,1,95,136,152,178,52,10,160,59,233,
+161,33,106,47,161,152,148,16,24,178,139,178,233,131,72,63,177,1,8,147,252,10,70,0,16,132,14,153,176,165,57,63,
+177,24,144,165,24,132,30,161,128,129,56,46,146,24,178,133,145,16,139,216,25,1,143,8,161,42,167,0,1,131,24,168,
+202,6,31,10,180,41,128,130,178,18,42,195,28,150,27,14,179,136,147,42,183,16,136,49,12,163,139,185,215,16,128,9,
+167,0,17,0,9,135,138,177,181,0,193,40,144,145,9,195,16,130,29,244,130,27,165,42,195,129,8,137,77,48,156,213,
+18,138,147,27,130,43,169,74,60,60,200,199,1,0,146,42,3,12,145,128,62,45,192,195,16,137,4,25,130,72,177,72,
+59,75,232,213,1,153,2,10,17,26,161,123,10,40,243,194,2,152,32,138,41,9,194,90,137,9,199,163,0,41,72,139,
+33,8,210,41,10,156,228,178,49,187,113,153,16,91,178,24,144,0,184,151,59,179,94,128,24,128,4,26,160,25,213,0,
+25,10,44,160,76,185,133,25,193,146,179,147,106,160,122,152,72,169,131,26,224,8,227,0,41,145,60,194,40,152,36,186,
+134,138,183,40,28,162,41,168,16,138,17,168,134,160,7,8,59,1,16,145,35,159,130,12,226,128,161,49,143,145,17,192,
+122,176,19,43,161,8,164,107,169,8,27,131,15,181,56,11,145,184,23,61,152,128,162,49,186,134,25,144,11,184,122,76,
+137,210,32,9,152,167,17,26,24,9,122,74,137,16,138,163,11,167,57,138,42,9,125,44,128,25,160,34,155,150,128,56,
+13,136,122,27,41,138,1,128,225,147,33,27,147,63,90,11,0,177,8,72,159,2,8,208,19,155,122,42,42,0,161,35,
+185,98,73,168,40,185,73,46,169,41,154,165,178,40,0,18,31,18,47,152,146,152,166,162,144,82,46,0,27,25,152,153,
+181,153,36,144,225,104,152,56,192,32,153,194,49,251,33,8,184,66,62,0,136,75,161,179,129,240,32,33,155,123,153,131,
+176,194,19,145,90,136,198,57,188,130,33,8,167,240,88,154,144,145,144,128,192,58,1,201,150,0,43,148,58,130,66,168,
+150,146,47,1,164,8,146,9,56,220,33,145,228,90,128,137,130,184,144,151,10,75,195,192,34,43,44,178,20,42,129,129,
+155,121,184,149,152,48,14,128,19,41,15,1,42,28,8,171,135,29,153,164,128,56,176,149,173,246,75,0,123,160,17,155,
+178,128,168,200,7,24,209,19,185,50,0,243,137,9,192,128,96,152,165,1,153,2,58,50,207,25,162,74,75,166,41,129,
+42,0,96,25,155,136,194,77,8,16,137,129,153,196,121,24,155,178,64,30,1,8,136,32,185,129,121,24,188,180,16,11,
+16,164,146,47,179,24,152,112,241,128,0,152,128,131,42,25,136,152,75,5,129,174,195,131,137,112,0,144,194,19,46,24,
+74,224,145,40,138,136,147,227,131,59,152,75,50,243,139,48,216,32,74,146,25,26,185,152,39,147,189,0,1,47,28,133,
+176,17,42,187,48,7,210,9,89,139,152,20,145,42,75,10,157,7,146,160,25,178,10,105,2,170,17,28,153,107,19,209,
+201,18,152,168,20,163,232,0,106,12,33,0,184,138,164,16,139,115,242,24,41,177,136,20,145,173,33,58,140,1,133,26,
+219,49,136,128,66,242,138,48,41,186,52,1,209,75,90,8,16,130,233,44,56,160,138,133,179,174,64,8,16,16,46,12,
+161,1,212,130,17,160,13,32,176,4,16,158,25,1,176,88,180,136,26,138,151,3,128,155,26,31,162,192,6,16,15,16,
+152,16,34,201,26,162,163,227,4,89,10,11,24,1,48,137,220,10,35,251,65,1,185,42,161,146,114,129,14,59,153,180,
+130,17,19,174,8,2,129,67,232,15,145,161,0,21,10,136,25,11,52,131,45,205,179,0,162,1,3,161,31,41,225,54,
+137,171,32,152,72,74,163,10,8,222,149,18,136,169,153,40,57,31,66,137,28,168,146,104,132,201,160,0,25,40,1,121,
+8,141,0,2,163,183,192,25,0,169,35,56,62,27,156,18,37,209,42,156,0,150,128,17,33,172,136,2,21,131,141,31,
+0,185,3,146,128,209,177,42,7,147,29,154,24,64,184,33,18,250,25,8,164,22,200,11,73,136,152,64,8,24,139,14,
+6,16,153,138,28,149,194,24,49,153,15,161,17,34,177,142,57,129,168,82,32,74,217,177,4,2,24,158,29,129,178,152,
+115,9,137,168,131,112,128,171,11,133,176,130,121,8,136,202,5,24,1,139,157,65,193,136,48,129,155,210,50,76,163,216,
+59,160,148,137,195,51,200,128,80,9,166,129,143,17,17,233,18,24,160,128,16,137,135,136,13,8,8,243,55,238,78,0,
+41,136,130,9,58,194,2,5,251,16,130,152,29,129,129,42,40,9,133,164,8,219,3,41,189,180,72,42,45,145,177,23,
+136,153,89,152,168,3,30,40,41,91,0,131,131,180,77,11,178,185,153,56,31,179,57,91,179,37,44,176,32,217,136,186,
+194,4,185,97,162,113,10,8,144,192,17,156,152,131,41,172,7,72,40,74,138,211,144,178,13,56,11,244,0,17,16,73,
+128,41,171,132,10,60,138,50,221,133,16,146,65,192,58,171,145,31,176,16,169,81,10,35,48,2,245,2,47,153,0,138,
+128,74,193,64,24,0,194,148,128,62,10,210,152,40,8,137,122,25,197,33,145,40,141,35,204,129,16,42,29,130,1,11,
+23,9,137,90,240,0,26,16,140,129,2,26,65,147,40,93,217,161,16,10,169,72,144,9,133,48,64,8,197,160,128,242,
+24,46,161,26,178,37,43,26,135,168,1,152,32,14,144,9,210,121,160,24,148,145,24,184,49,15,194,24,169,66,138,41,
+150,162,48,200,97,139,152,24,185,60,180,28,150,128,26,144,52,14,136,25,177,10,164,137,147,194,53,141,99,40,154,73,
+176,8,145,224,132,152,146,2,105,41,128,76,176,24,216,26,164,138,25,240,72,136,1,16,146,10,150,14,146,0,10,176,
+40,30,16,32,160,131,151,8,162,169,107,170,106,139,128,43,167,152,132,144,35,43,91,152,78,200,19,27,146,9,164,25,
+162,121,42,136,31,193,146,43,144,225,131,160,51,107,26,24,56,234,146,152,128,209,166,41,72,153,123,144,0,32,201,160,
+164,10,131,176,123,145,9,34,45,211,5,13,145,145,40,168,81,74,140,146,8,144,131,193,42,187,0,201,114,57,8,44,
+138,199,17,25,193,41,41,158,65,9,41,227,128,1,193,16,65,174,148,152,92,128,9,1,192,164,32,139,4,9,24,228,
+136,64,138,163,1,209,147,128,91,176,3,27,141,161,131,154,151,164,41,152,24,138,83,242,40,171,161,183,1,195,164,40,
+137,168,81,24,218,165,26,168,197,131,24,176,3,11,161,4,16,245,162,40,11,167,32,42,160,161,76,153,163,165,137,227,
+152,49,137,17,91,169,1,193,145,151,129,8,249,130,56,28,130,8,44,227,177,133,8,194,24,11,9,131,90,193,145,18,
+207,6,71,0,201,181,147,51,249,17,62,138,132,25,137,181,162,129,184,151,32,13,160,128,73,144,24,144,162,133,156,64,
+8,17,47,186,147,3,12,133,9,122,153,136,64,58,186,131,15,0,177,1,144,4,73,30,26,120,41,140,179,1,10,3,
+43,122,8,9,59,77,25,161,60,140,161,147,128,104,58,93,139,32,91,136,160,146,45,24,168,123,0,152,32,63,10,17,
+41,12,224,130,57,26,72,75,27,25,10,136,6,162,45,76,153,48,9,34,154,120,139,177,50,41,251,0,60,79,152,56,
+137,24,129,154,128,7,58,31,177,8,17,10,48,93,153,145,153,65,128,136,78,28,136,2,153,17,147,26,171,163,69,94,
+169,16,44,90,9,57,177,182,130,137,8,17,90,15,194,40,0,11,130,33,30,146,10,108,0,201,2,27,136,163,227,148,
+162,73,137,138,66,160,240,129,8,60,194,17,8,177,164,11,0,149,166,61,176,177,151,129,24,16,153,1,184,2,135,233,
+32,10,176,4,169,50,177,156,4,248,3,16,188,148,181,24,41,0,9,194,211,194,50,28,146,172,166,32,154,2,178,176,
+147,241,17,25,146,241,149,41,40,12,146,16,176,196,65,139,3,153,181,24,27,72,15,168,4,202,33,1,192,129,135,136,
+43,0,144,202,132,144,60,185,7,209,3,56,156,0,161,193,40,43,61,225,130,144,51,45,56,185,178,17,1,15,57,128,
+244,178,98,26,8,57,210,168,32,25,15,136,147,224,18,90,10,24,1,161,10,56,47,200,130,193,64,61,136,0,0,0,
+9,42,141,194,146,235,67,28,10,2,17,59,48,56,143,179,2,242,90,9,1,11,18,128,61,48,10,188,163,216,88,13,
+0,144,40,130,89,26,32,167,9,9,79,138,177,1,0,26,27,134,185,135,64,139,91,169,179,8,106,138,177,131,163,132,
+90,17,62,153,130,26,10,41,241,130,153,134,9,40,109,176,128,24,8,185,73,177,225,49,73,25,78,161,164,26,16,137,
+201,144,196,1,77,25,9,179,149,17,10,153,196,178,138,112,44,153,8,151,0,128,49,170,144,130,153,31,41,136,158,150,
+1,136,17,40,177,153,148,61,171,18,142,179,24,32,81,28,163,4,202,49,28,144,159,149,8,26,24,146,161,20,32,27,
+92,177,140,145,2,248,68,0,145,161,9,122,161,74,18,217,22,11,209,149,10,42,138,24,9,130,151,107,136,134,186,4,
+24,12,27,0,209,17,40,9,25,37,176,183,130,77,156,9,32,145,148,25,169,35,163,80,189,240,147,17,64,58,43,216,
+176,34,248,132,41,155,163,0,43,130,123,106,200,145,146,16,40,161,210,162,168,124,8,0,32,200,208,0,154,21,16,168,
+56,31,9,196,146,2,169,17,59,11,20,19,122,158,179,161,160,19,168,72,31,184,34,138,114,128,145,44,28,8,165,32,
+26,193,187,132,128,165,24,133,192,136,16,30,3,144,193,179,144,56,25,149,34,9,254,40,42,10,133,137,89,153,160,17,
+132,34,178,122,217,162,136,65,26,128,25,248,8,32,200,33,147,176,234,195,145,34,4,16,153,170,75,143,104,145,128,162,
+218,161,1,40,57,50,218,30,145,16,65,163,40,195,190,145,145,122,133,12,128,154,8,32,52,29,64,144,141,0,1,74,
+2,26,26,158,40,145,72,56,14,129,156,10,193,115,153,56,8,187,120,8,56,24,9,144,250,0,128,121,0,9,10,139,
+91,137,98,193,137,134,170,41,130,90,1,26,137,187,35,185,114,33,30,17,233,16,145,57,20,189,35,218,58,1,57,34,
+186,81,208,44,184,144,53,202,50,154,29,146,169,100,192,40,148,172,131,225,48,145,24,10,170,147,16,51,181,202,135,249,
+1,144,73,146,153,49,234,16,130,137,165,177,33,194,74,168,163,6,176,17,232,9,132,170,51,169,77,164,141,130,144,48,
+162,177,132,249,0,32,59,24,201,5,249,17,136,137,7,184,32,192,24,24,128,48,176,24,167,157,130,195,57,163,27,176,
+11,163,132,5,151,60,2,217,24,32,11,7,152,9,193,144,64,154,66,155,32,192,139,171,22,48,169,19,59,175,106,147,
+59,17,9,164,14,138,148,93,128,144,27,32,173,50,129,179,76,179,217,193,34,28,18,72,13,168,211,16,129,164,56,130,
+171,17,31,16,148,1,146,219,28,74,161,67,136,17,223,17,139,1,51,9,25,186,89,159,19,32,29,80,201,25,137,164,
+32,33,27,168,169,138,106,120,26,40,243,26,153,17,91,1,194,17,14,137,129,136,83,25,56,15,145,129,41,163,144,50,
+159,161,32,168,1,123,59,184,126,253,68,0,24,3,251,80,209,128,146,144,24,91,9,24,164,176,163,128,137,162,185,163,
+125,10,61,17,242,34,27,24,208,17,224,1,44,136,12,17,160,147,41,88,192,72,151,144,2,129,136,8,139,1,158,72,
+217,146,35,157,130,128,155,17,182,129,196,120,154,24,72,27,40,144,224,130,178,9,26,65,241,26,49,168,60,194,130,76,
+226,17,154,1,212,41,41,8,8,1,43,155,135,10,243,48,180,25,35,138,154,23,29,161,1,89,154,58,179,159,89,136,
+176,19,226,129,16,43,153,120,9,138,120,169,129,146,128,25,160,120,225,24,180,152,56,179,28,128,148,137,72,41,160,31,
+163,25,10,1,242,194,130,145,56,75,146,194,84,27,76,26,137,177,166,25,32,27,210,17,137,154,122,128,140,180,40,29,
+18,27,133,187,7,43,138,19,153,144,146,24,63,160,2,172,7,170,131,144,163,48,249,121,10,25,2,170,132,192,136,163,
+0,161,85,15,0,136,178,131,132,152,8,1,249,50,59,59,90,188,6,171,82,10,137,130,216,129,40,10,164,163,129,15,
+89,185,49,211,1,8,168,136,197,146,147,192,163,8,203,7,40,137,33,251,179,179,181,128,50,219,194,3,26,73,144,144,
+177,199,24,210,3,195,162,80,169,16,16,44,146,145,32,250,59,169,42,178,167,129,8,192,148,163,80,11,91,225,152,131,
+152,64,8,192,144,165,88,61,41,168,209,146,0,12,132,210,0,17,61,169,72,128,160,49,155,224,131,209,132,25,25,161,
+31,1,0,124,0,144,17,176,34,73,11,232,41,200,169,21,11,11,166,154,129,10,91,154,26,151,152,88,153,40,128,133,
+80,138,121,138,48,16,144,32,144,28,210,40,27,164,91,208,144,145,136,43,197,32,176,121,170,105,152,130,42,145,26,128,
+144,209,82,26,76,9,137,5,155,120,9,24,168,1,31,19,46,9,128,128,144,136,9,138,151,42,9,88,142,130,137,179,
+2,185,36,191,133,9,40,32,138,33,224,131,153,18,9,0,48,214,145,74,224,18,226,130,152,129,208,130,129,16,8,76,
+145,187,183,132,26,179,57,240,130,162,157,23,153,145,162,42,131,43,56,245,1,160,24,9,161,136,199,48,217,18,27,171,
+39,154,1,27,169,132,176,81,177,72,184,145,4,248,68,0,28,213,32,137,146,137,163,122,208,104,137,16,11,128,128,163,
+18,0,135,154,133,43,168,1,140,165,153,50,141,89,139,51,9,184,106,154,49,9,138,151,169,16,138,30,165,56,200,133,
+42,168,48,9,24,58,9,159,195,47,0,75,24,132,11,3,40,12,163,141,33,158,178,92,138,129,18,57,162,73,29,147,
+240,1,8,139,1,192,194,133,66,58,146,33,168,243,75,11,168,0,27,224,65,16,64,160,150,8,188,146,9,12,16,137,
+112,153,96,10,16,49,177,142,185,0,154,129,112,193,4,25,8,9,166,146,141,144,145,156,35,40,8,113,136,161,176,70,
+155,138,129,243,8,24,35,45,193,3,140,49,25,160,159,129,42,200,112,128,40,59,3,45,129,6,154,153,144,211,27,134,
+1,200,88,137,26,90,2,141,170,16,137,56,83,177,176,147,16,30,113,168,168,29,163,9,56,132,193,25,4,160,153,70,
+140,138,26,130,137,50,80,241,89,26,160,34,176,29,28,0,144,65,74,168,12,129,33,25,101,155,200,57,25,107,136,132,
+139,180,122,137,3,194,8,27,128,248,2,32,161,58,153,196,65,178,176,173,32,10,56,48,41,201,195,120,45,34,202,184,
+59,25,148,48,17,8,157,18,197,96,130,172,169,56,160,148,81,138,179,164,153,73,65,196,186,26,147,155,7,51,15,56,
+139,9,72,130,173,9,25,179,97,136,128,62,180,146,16,55,155,216,72,152,57,137,165,168,33,11,210,113,176,136,12,145,
+136,161,23,153,16,24,193,106,18,141,168,48,10,152,18,177,24,128,74,177,55,13,188,0,33,177,81,2,218,49,242,129,
+64,129,173,9,161,3,77,128,64,168,0,170,128,23,225,9,42,40,59,74,26,179,90,192,129,32,135,138,152,72,162,57,
+14,16,161,132,10,3,66,234,161,28,130,140,193,41,57,195,104,26,16,17,248,169,40,192,48,26,16,33,8,108,25,133,
+147,142,178,75,139,168,161,19,75,4,154,147,7,17,154,217,74,25,204,4,25,130,137,130,73,25,151,29,184,146,25,243,
+128,72,176,81,25,18,105,176,73,172,132,136,153,130,129,16,161,97,136,131,18,175,30,193,16,11,129,16,165,1,129,33,
+65,200,45,158,146,0,30,136,179,1,3,8,73,18,178,31,29,5,68,0,156,33,200,24,153,23,137,0,130,1,67,192,
+47,139,128,160,11,59,167,40,40,166,74,148,8,12,42,168,192,41,9,148,51,77,165,1,48,1,157,26,136,203,104,139,
+5,152,17,193,5,90,170,136,43,25,154,75,26,181,66,153,130,148,48,15,209,90,136,136,10,33,28,151,10,164,1,16,
+139,248,32,153,144,16,25,80,160,121,162,137,37,170,154,19,217,193,129,106,153,40,20,139,8,39,142,145,9,9,10,163,
+5,25,18,145,51,8,7,143,144,56,171,59,166,145,77,136,130,40,42,214,74,153,162,138,179,8,67,42,45,147,137,65,
+242,136,140,147,176,129,2,6,153,162,163,167,2,8,200,79,153,177,1,24,162,18,57,195,135,33,171,160,110,144,192,105,
+8,9,42,8,25,178,181,153,192,145,140,178,2,31,179,49,11,5,131,0,11,216,130,129,72,46,122,137,1,24,1,122,
+161,58,241,162,128,186,18,1,184,151,73,144,34,45,161,155,150,169,43,24,41,56,240,36,60,1,9,188,3,160,170,29,
+166,1,208,35,8,122,144,168,168,178,107,154,57,27,183,1,177,32,97,25,184,41,177,211,139,135,25,17,48,31,129,8,
+148,193,177,74,209,136,153,130,89,26,91,144,35,169,150,139,33,200,11,24,243,16,129,50,10,21,107,169,57,139,243,177,
+24,130,24,93,180,0,1,136,26,42,143,210,0,152,8,144,20,152,148,121,9,0,43,0,203,97,12,9,146,153,167,177,
+120,136,144,129,130,44,184,89,43,138,179,197,19,139,129,151,16,16,193,107,128,59,152,226,40,137,1,161,185,134,145,8,
+90,8,40,15,40,139,0,181,154,167,161,137,131,131,56,24,79,169,8,32,241,162,196,32,140,129,165,40,57,176,17,59,
+15,56,210,59,200,131,168,128,112,144,1,56,224,163,3,62,156,163,147,218,1,178,64,32,9,176,120,139,186,163,182,163,
+160,196,7,9,1,3,59,107,139,169,65,173,150,144,17,128,8,17,200,90,138,169,124,169,72,152,40,129,160,36,192,163,
+153,30,8,176,90,72,9,58,44,163,167,178,17,216,176,130,138,122,57,56,13,32,170,134,9,208,144,0,168,8,151,33,
+177,109,128,16,28,145,10,193,0,208,131,145,16,25,49,126,137,41,186,161,116,210,73,0,144,2,160,7,57,209,3,40,
+49,143,163,139,128,47,146,88,154,164,48,144,8,186,165,224,90,153,17,58,227,1,162,49,217,145,160,60,28,144,90,145,
+164,176,64,137,135,11,163,43,153,176,124,145,32,146,168,0,147,202,81,175,149,136,24,57,26,65,185,35,3,159,89,233,
+147,161,48,11,56,171,163,4,48,47,89,233,145,178,56,0,75,179,128,146,99,15,16,168,162,163,60,40,41,8,240,130,
+105,168,76,169,129,152,89,32,29,1,176,148,16,0,14,210,144,16,10,50,62,162,210,16,26,50,15,177,0,27,145,89,
+136,4,177,49,208,1,174,19,31,153,131,24,145,80,75,168,195,81,185,89,11,208,147,33,26,88,28,160,0,1,177,63,
+242,145,161,41,131,90,137,2,27,130,130,143,165,152,17,139,35,45,2,27,145,34,108,13,128,28,9,232,50,176,65,169,
+3,90,129,13,17,143,152,162,129,164,106,161,16,184,51,186,96,172,178,162,48,48,31,148,136,131,56,139,14,196,42,185,
+97,42,136,147,128,148,136,132,201,132,31,160,25,131,169,22,11,136,146,148,208,96,171,131,186,3,17,122,144,40,169,21,
+138,60,197,16,42,41,11,76,164,43,144,80,160,186,182,75,152,10,132,160,21,138,128,123,1,185,97,203,130,152,164,0,
+90,177,1,27,122,177,25,228,56,138,56,10,128,150,168,132,25,160,201,6,31,129,9,129,160,18,136,145,128,32,213,73,
+218,3,138,3,10,66,156,41,24,152,132,14,183,74,153,56,136,129,180,40,176,2,147,251,53,142,1,136,129,9,132,29,
+128,41,128,241,56,241,0,136,72,8,57,184,81,12,130,160,154,164,47,128,10,132,144,149,25,168,0,148,137,88,157,148,
+184,35,184,84,138,17,10,58,12,138,242,24,0,26,164,121,160,72,153,16,178,193,16,15,0,137,132,144,150,27,165,144,
+17,10,92,201,1,152,34,152,81,144,33,12,121,153,136,195,76,136,27,2,138,133,91,160,136,179,136,123,156,3,185,99,
+11,64,154,148,136,33,25,158,179,73,170,105,136,56,176,73,152,73,180,144,17,14,177,169,135,24,64,12,2,156,19,138,
+59,240,2,200,72,24,91,176,49,185,115,137,153,19,143,147,10,148,144,18,42,177,28,132,180,32,70,0,9,92,251,2,
+184,2,0,106,176,0,176,37,153,24,179,31,152,58,160,24,135,41,226,57,0,153,105,187,149,136,2,138,112,168,2,10,
+3,152,12,214,41,153,73,24,153,149,128,178,33,149,168,120,157,130,128,40,136,2,140,148,138,35,160,13,231,129,9,57,
+25,56,192,64,137,2,0,200,151,45,144,25,145,0,149,59,160,48,48,143,41,240,1,154,18,42,81,187,65,8,106,8,
+170,183,42,137,10,165,41,165,24,137,72,152,210,48,141,1,208,18,128,131,139,135,10,18,185,74,240,8,9,40,145,72,
+243,32,161,32,160,162,184,47,128,171,53,185,151,8,129,28,164,9,17,158,0,176,34,162,112,184,83,138,17,153,129,249,
+17,137,90,128,24,181,58,152,121,208,145,163,30,145,25,129,178,20,29,131,139,135,152,74,186,163,153,4,9,88,176,88,
+138,34,10,12,244,32,153,24,32,176,35,91,201,64,177,200,3,143,145,24,194,165,18,137,1,136,131,213,25,156,132,170,
+133,129,91,145,42,152,130,160,61,243,76,137,24,16,25,18,44,179,57,166,169,64,30,161,25,165,128,34,157,131,153,149,
+176,121,186,132,154,3,16,91,10,18,218,36,153,29,211,41,168,32,74,24,0,27,243,56,136,216,50,31,162,26,146,146,
+17,8,243,24,180,136,123,187,4,168,130,16,88,11,3,14,132,9,12,227,32,184,65,9,58,162,75,170,66,11,208,148,
+45,176,24,4,137,20,42,212,40,146,185,121,138,178,160,133,0,90,185,133,138,132,26,43,249,2,153,49,89,29,161,33,
+200,81,153,137,179,60,184,64,26,145,151,10,179,91,145,185,52,143,162,24,130,161,88,144,144,10,150,184,121,217,17,137,
+130,56,75,136,18,157,20,136,13,178,40,248,34,25,138,3,41,248,33,137,168,148,143,196,16,24,0,40,0,211,41,164,
+152,64,219,149,26,146,16,74,137,16,171,7,27,59,240,32,172,5,8,24,128,1,208,97,138,153,195,75,184,72,160,48,
+162,9,243,105,9,168,3,29,162,59,182,128,132,25,195,75,161,137,57,173,34,203,135,136,18,139,5,155,5,153,41,201,
+2,176,80,25,107,152,32,170,66,202,64,240,16,153,56,75,25,147,56,200,112,144,27,198,57,168,73,9,138,8,77,0,
+8,147,10,144,17,147,238,150,27,146,43,131,144,18,11,164,121,136,176,32,175,4,155,131,161,36,155,149,75,152,25,57,
+174,5,170,3,179,48,192,51,14,132,11,42,250,1,11,19,25,72,194,72,10,18,26,46,240,32,170,82,43,25,161,16,
+168,82,139,12,215,57,168,89,26,0,178,33,178,41,33,249,165,59,161,60,145,179,5,12,179,90,162,200,65,159,147,137,
+180,2,33,171,5,11,20,140,56,250,1,152,1,25,123,136,0,137,18,155,59,244,57,193,40,64,43,194,64,169,80,138,
+168,213,24,152,58,88,10,163,1,144,88,153,152,183,61,144,41,58,226,148,136,128,32,144,232,19,15,129,58,152,145,5,
+137,17,73,192,178,97,173,4,11,130,144,65,154,2,31,146,136,90,218,18,170,18,9,112,168,64,138,3,27,25,242,25,
+184,104,9,91,160,74,176,50,154,169,183,74,136,90,9,41,147,11,150,24,161,171,135,46,9,26,16,136,133,137,130,57,
+0,220,114,12,128,25,129,136,4,139,34,30,129,177,73,157,131,184,4,168,112,153,32,42,2,112,47,161,9,248,1,128,
+16,136,16,8,164,40,156,230,24,25,16,40,176,132,168,210,19,137,218,149,42,152,131,59,200,130,56,226,96,137,146,25,
+142,147,27,181,1,0,130,32,172,150,43,11,184,166,136,18,194,65,141,18,201,5,161,43,209,32,138,18,8,109,9,57,
+217,16,148,160,211,56,153,1,105,144,1,9,182,0,164,168,32,143,160,144,178,131,1,131,130,137,3,206,125,184,132,200,
+132,193,18,153,161,73,41,24,31,210,40,209,16,129,57,200,50,201,19,26,168,1,45,153,93,40,11,148,140,150,9,129,
+24,60,10,128,209,2,180,82,140,147,184,21,141,17,170,146,178,178,36,79,9,41,170,34,210,128,165,91,184,34,25,43,
+18,140,165,137,133,29,16,14,163,152,149,145,8,24,9,153,114,168,73,216,32,154,1,41,107,152,1,10,240,5,10,16,
+28,161,41,129,185,7,137,178,146,113,44,75,217,131,176,2,25,105,28,161,145,2,128,139,166,59,144,76,177,89,194,0,
+177,178,4,154,120,155,146,241,132,9,32,10,193,32,130,160,152,166,25,209,32,60,25,164,0,177,149,17,217,125,153,146,
+46,4,82,0,145,160,129,32,139,131,12,34,8,30,244,16,168,57,56,138,195,18,216,4,56,13,49,143,178,128,0,161,
+5,13,164,0,74,137,74,224,2,9,9,57,77,152,17,144,162,42,209,133,45,136,160,64,138,179,0,145,177,98,217,112,
+154,178,195,17,160,97,29,128,8,25,163,92,200,131,152,0,18,47,145,16,160,145,3,12,163,31,146,141,34,12,148,10,
+147,208,97,138,40,13,146,168,18,232,51,13,130,144,72,168,120,187,18,184,2,178,121,137,2,232,33,177,92,176,16,193,
+17,136,109,9,8,178,8,148,44,227,40,152,8,48,47,144,40,209,16,1,139,166,42,177,136,131,61,196,41,162,41,130,
+47,180,61,144,160,34,138,134,42,144,25,164,155,135,61,152,8,161,137,5,26,8,176,133,138,150,46,8,10,32,170,151,
+57,193,129,130,153,148,27,136,73,58,141,134,59,26,160,167,42,197,41,136,24,25,137,165,56,27,145,150,11,197,16,160,
+76,145,59,144,81,140,1,162,60,242,16,9,42,194,40,146,91,128,27,179,122,240,2,152,24,145,42,129,16,9,131,151,
+61,225,1,169,64,184,82,154,32,153,16,225,88,202,19,138,27,166,56,154,18,185,67,186,114,156,3,11,1,201,21,27,
+152,130,33,175,22,141,2,137,16,152,3,29,160,2,48,31,164,59,193,137,66,155,132,58,201,50,8,143,150,10,145,8,
+130,61,164,27,144,32,48,15,180,57,168,8,3,15,147,107,193,56,146,29,163,41,153,58,165,59,146,28,211,161,19,141,
+151,60,152,9,48,138,146,41,242,16,129,169,134,59,137,44,19,15,147,10,162,162,48,218,135,44,161,42,57,153,33,155,
+135,29,18,216,33,27,179,41,160,168,7,139,1,25,43,165,120,172,135,137,8,145,1,10,131,29,25,18,29,198,24,168,
+33,11,80,152,59,146,137,96,209,3,59,176,169,98,154,163,123,168,40,128,216,98,155,129,144,10,182,17,154,134,169,16,
+82,141,179,18,188,18,129,61,195,8,1,27,17,224,148,62,8,154,80,160,146,106,152,153,20,168,122,184,130,9,194,179,
+122,192,18,152,136,17,184,183,89,138,40,58,28,178,32,185,106,162,145,113,141,146,128,161,163,49,28,17,30,41,131,13,
+227,164,153,3,5,16,77,0,136,61,145,16,136,26,0,242,48,47,152,57,25,176,179,35,242,44,34,184,123,192,130,153,
+147,193,4,11,1,177,122,8,42,243,56,201,129,2,75,8,57,172,49,146,189,23,46,128,9,128,26,165,16,184,2,130,
+201,82,47,26,137,50,235,4,9,160,24,2,209,49,31,145,137,32,241,18,169,133,10,1,195,73,169,3,14,16,193,33,
+154,49,45,10,197,56,248,131,10,128,144,96,169,48,12,129,163,43,244,2,154,17,8,106,184,65,140,64,137,137,213,1,
+152,1,25,57,242,48,153,89,9,25,243,40,152,0,136,48,201,34,154,122,176,89,224,130,8,24,208,81,154,146,0,24,
+184,120,170,164,128,24,145,80,155,132,169,52,170,81,142,147,26,2,12,3,184,163,8,6,141,163,139,177,17,2,63,130,
+29,2,27,132,14,228,32,169,146,2,25,137,65,9,58,91,47,184,2,186,5,184,21,169,49,170,52,157,82,15,0,136,
+0,168,133,152,1,168,5,217,133,44,128,10,33,11,131,44,178,88,168,160,167,153,129,8,18,43,120,140,18,58,201,120,
+200,2,153,18,184,20,26,128,137,97,184,106,14,130,137,0,210,2,184,133,10,3,13,2,15,130,60,25,58,145,200,133,
+152,163,192,151,137,146,59,16,77,152,0,144,123,160,57,225,1,160,128,130,93,152,24,145,89,160,107,208,0,161,128,146,
+88,138,129,8,32,153,95,168,16,200,18,209,72,152,16,192,51,203,96,27,9,144,56,177,17,57,170,183,80,208,18,29,
+128,152,32,42,145,77,168,144,4,217,4,44,26,152,48,185,35,59,25,27,167,176,167,76,9,26,129,40,216,96,26,138,
+132,216,133,27,16,11,16,41,211,56,27,129,210,0,151,60,59,185,18,10,167,74,168,1,145,26,5,47,137,8,16,185,
+6,169,146,128,133,153,4,14,129,26,128,161,134,9,196,32,137,164,88,248,2,27,145,144,49,185,133,44,177,40,160,215,
+56,154,1,152,121,160,40,9,24,41,192,49,157,152,49,43,168,7,137,194,48,139,167,42,213,24,144,152,148,57,195,56,
+12,17,41,248,81,12,128,9,57,169,135,9,178,24,144,2,184,164,57,232,16,57,59,161,62,9,48,42,53,143,209,1,
+153,179,133,40,193,65,186,18,197,17,69,0,17,225,122,139,148,10,56,160,64,11,195,192,33,176,230,33,11,161,41,16,
+12,34,45,144,184,36,26,242,18,30,161,0,41,10,50,30,160,8,40,96,171,183,8,179,137,132,61,146,25,41,169,4,
+81,14,209,130,192,1,178,80,200,18,152,42,1,195,125,154,130,137,152,149,56,169,133,11,162,50,216,34,47,176,129,73,
+168,20,43,226,130,26,4,140,197,16,26,9,24,138,166,40,44,168,33,210,122,200,1,137,146,16,41,178,0,27,208,22,
+169,98,15,145,41,152,130,57,208,130,0,8,16,139,215,56,139,2,42,58,146,75,56,141,148,209,81,157,147,136,145,1,
+106,184,3,185,19,161,9,199,76,169,48,24,25,179,24,129,29,80,169,120,218,150,25,136,146,48,170,2,138,146,20,14,
+198,89,154,129,8,40,9,41,160,41,89,226,32,14,179,25,162,73,162,9,194,56,128,167,41,240,48,141,129,0,0,160,
+4,12,130,88,171,133,47,144,24,25,8,130,91,152,40,58,243,40,186,150,137,16,193,49,139,132,28,17,160,16,240,57,
+140,1,180,80,200,65,154,48,161,41,176,126,169,1,128,40,178,123,160,57,128,59,8,15,212,40,168,34,153,40,194,24,
+32,152,140,244,131,30,161,48,152,145,164,89,26,163,184,181,79,153,24,128,17,144,65,13,128,18,169,121,142,147,10,130,
+136,3,44,164,137,1,178,144,243,1,142,33,138,20,28,3,10,25,177,167,42,141,128,128,131,18,145,123,128,75,56,169,
+128,244,152,193,33,192,50,172,7,137,16,8,41,62,29,144,9,163,128,165,72,152,0,161,194,144,215,41,25,8,24,120,
+169,66,27,40,1,232,122,140,161,130,161,129,195,0,152,8,8,128,171,121,142,162,24,89,58,17,8,56,161,224,36,154,
+195,109,176,8,164,33,153,35,31,129,25,145,137,164,46,153,129,163,128,151,25,0,62,145,145,128,2,143,32,186,5,10,
+129,74,225,17,176,50,155,146,47,240,16,145,76,160,16,177,129,11,135,9,72,140,129,43,160,32,60,168,151,144,17,16,
+160,14,168,148,27,1,14,67,187,20,137,149,40,212,105,185,130,26,128,26,20,139,148,0,197,1,129,13,160,177,1,74,
+24,122,26,178,19,12,132,91,170,196,130,137,174,250,75,0,72,41,43,166,129,184,52,13,2,158,149,26,161,106,168,129,
+129,8,136,26,32,43,154,181,138,184,205,83,177,19,24,144,74,137,27,7,143,164,91,184,72,177,1,160,97,138,1,176,
+72,152,9,144,25,225,1,182,123,160,33,153,40,153,19,219,19,158,195,16,137,193,80,193,33,192,3,42,32,220,37,142,
+146,136,0,24,129,42,133,28,2,25,161,168,114,172,8,192,4,169,6,42,128,42,145,152,193,2,46,11,171,165,129,225,
+66,75,128,41,162,0,144,17,233,193,208,146,129,60,40,211,1,48,122,10,40,233,17,9,226,24,192,16,144,132,89,8,
+136,210,146,128,147,26,145,219,184,2,170,45,125,145,40,24,0,19,234,148,48,249,17,12,177,16,224,49,136,41,18,180,
+0,128,112,169,10,195,176,144,90,93,137,145,195,147,42,2,155,151,138,166,41,155,42,248,2,194,33,8,16,1,226,2,
+153,49,62,139,56,216,61,176,32,154,23,11,147,73,136,41,136,16,150,76,139,194,194,152,146,1,146,58,135,152,17,91,
+152,46,242,18,170,1,26,192,1,24,149,40,106,128,25,145,192,96,176,91,169,147,45,128,144,48,202,68,154,6,58,138,
+195,41,241,16,12,145,153,162,196,65,137,17,58,242,18,184,1,48,250,18,187,50,140,58,168,112,168,130,74,19,203,4,
+160,24,91,142,149,12,146,60,128,58,162,3,193,49,8,160,64,235,5,155,56,155,243,26,193,19,10,132,65,201,2,90,
+10,16,26,198,57,217,164,41,152,8,17,145,56,112,138,65,30,129,41,145,26,176,210,41,15,25,42,41,138,22,9,16,
+128,24,201,192,135,153,146,59,216,128,41,79,145,9,182,64,184,130,57,177,160,18,129,31,184,56,248,42,177,81,9,18,
+0,182,145,8,2,44,176,179,74,250,76,152,28,193,131,146,18,33,152,180,43,133,46,147,43,241,1,152,144,136,212,1,
+26,150,57,129,169,21,184,3,74,144,72,219,131,169,251,0,8,157,134,73,152,1,128,33,13,160,131,136,24,42,176,146,
+47,217,165,41,59,17,187,135,89,168,48,26,59,242,75,194,56,155,81,188,4,10,1,58,0,129,130,35,42,169,41,31,
+11,240,33,47,226,32,136,25,138,138,49,153,18,55,30,0,163,9,73,0,73,200,33,44,128,162,32,43,168,45,173,113,
+170,19,139,134,16,27,20,170,128,26,242,25,131,42,25,233,132,10,140,182,25,177,123,152,2,56,25,40,48,174,3,25,
+203,52,13,24,0,141,164,44,58,170,33,2,128,73,3,36,143,195,144,0,89,9,75,196,8,1,204,130,43,188,166,40,
+19,11,32,77,146,41,24,147,225,73,162,201,4,9,41,25,30,25,160,31,129,1,137,18,202,135,24,25,56,202,106,177,
+8,40,149,31,178,10,212,16,10,130,160,50,25,193,89,16,154,131,176,209,6,153,136,151,153,132,136,27,137,185,105,218,
+65,176,34,12,135,8,24,41,169,1,144,26,144,152,79,160,153,2,32,15,148,136,135,9,9,34,169,161,179,7,31,146,
+25,152,24,233,17,9,139,144,218,74,209,18,136,1,193,7,42,0,89,153,131,160,17,89,129,13,133,200,129,0,28,195,
+136,147,41,157,97,193,16,161,130,25,0,159,150,128,25,129,74,156,163,184,34,157,5,10,161,40,167,0,40,16,184,2,
+163,61,161,130,45,161,252,2,44,153,33,216,3,141,40,43,194,2,33,137,89,180,46,211,2,216,3,25,11,176,137,59,
+228,40,147,62,168,5,41,25,24,26,16,172,112,160,148,156,7,137,0,57,10,163,152,35,31,154,35,204,3,8,179,80,
+12,41,182,128,144,80,154,25,184,8,155,167,107,177,0,145,151,43,18,27,177,7,138,2,138,165,27,195,129,169,124,154,
+148,144,162,40,138,211,130,24,210,57,41,157,10,166,33,171,5,57,177,138,145,122,192,66,168,144,8,5,31,24,58,11,
+165,137,34,41,224,25,149,168,17,63,154,2,136,131,155,123,146,9,3,160,106,153,169,75,243,17,139,2,75,136,225,128,
+72,144,76,178,24,2,177,125,16,12,1,137,145,57,162,147,173,6,152,11,123,9,1,176,145,8,11,195,168,23,176,112,
+160,136,152,167,0,144,74,24,232,152,0,11,132,28,167,24,146,16,28,2,139,164,1,28,105,176,41,13,2,9,77,42,
+154,5,144,41,138,2,160,161,98,193,123,168,25,170,7,10,163,75,146,160,200,40,9,129,28,167,41,179,90,77,161,8,
+163,18,140,67,184,18,141,51,13,45,43,177,178,161,24,184,49,240,35,0,36,12,62,0,200,114,139,137,184,167,57,144,
+93,177,178,25,162,76,161,33,184,164,166,41,45,179,161,163,17,14,2,201,56,224,49,152,76,154,181,130,144,0,57,0,
+141,132,88,8,61,144,184,177,151,24,152,41,130,228,153,73,168,32,137,20,144,183,61,0,9,225,50,137,25,3,177,105,
+139,34,137,43,143,167,136,0,26,153,149,169,66,41,26,25,147,155,215,17,9,41,11,150,170,34,143,193,80,153,0,24,
+145,47,129,146,161,81,27,8,136,160,64,219,120,10,144,185,135,9,0,59,146,161,212,64,57,10,140,5,155,195,49,192,
+32,140,148,25,11,58,249,66,154,34,128,195,63,177,3,153,51,13,1,1,1,29,177,32,58,204,177,167,138,65,141,17,
+41,200,32,129,164,10,165,57,241,105,154,1,137,129,74,216,16,201,52,171,49,130,153,31,18,8,25,137,88,137,192,16,
+171,226,40,4,27,169,7,12,2,43,144,149,217,64,146,211,57,162,9,209,113,11,128,136,145,130,141,161,168,51,27,90,
+2,13,155,23,137,34,27,1,88,168,66,30,146,27,151,137,146,130,143,132,139,16,56,142,16,129,177,176,66,168,177,73,
+144,121,168,76,24,171,160,17,124,160,106,162,10,139,6,11,147,45,130,144,200,5,12,162,89,178,40,137,73,13,33,11,
+128,33,174,34,197,128,144,33,200,121,26,168,56,208,17,152,147,186,19,47,163,73,163,8,142,21,45,128,24,145,178,128,
+89,154,161,32,179,77,178,60,12,147,217,97,152,137,16,199,17,137,72,185,17,27,211,40,185,16,169,195,152,196,105,184,
+36,16,11,76,178,32,152,56,160,215,26,130,12,32,128,60,210,179,59,141,65,240,49,169,128,33,146,123,152,32,152,33,
+13,211,129,168,128,72,241,57,140,57,1,152,21,153,11,148,131,72,209,21,137,8,58,242,8,144,24,160,164,173,146,18,
+158,36,169,144,96,194,147,9,146,24,241,0,34,140,209,130,25,185,194,42,176,151,8,20,15,163,56,152,57,152,151,152,
+41,74,249,19,10,40,0,184,153,60,149,29,17,138,152,149,197,17,26,168,134,26,152,35,156,4,15,164,128,152,59,129,
+131,10,52,143,162,80,138,165,0,144,16,201,66,157,32,11,32,168,181,171,21,169,242,1,105,234,72,0,241,112,161,130,
+9,27,157,163,178,34,8,17,76,194,34,13,232,160,50,128,113,136,160,136,147,210,130,128,74,30,128,194,145,144,136,176,
+7,152,177,52,142,0,41,138,49,26,152,21,12,161,194,136,165,10,147,60,136,2,42,186,56,166,133,107,43,144,77,137,
+133,9,209,32,216,146,25,210,163,16,58,128,77,225,147,16,178,122,11,147,136,178,57,12,185,2,41,106,49,47,153,10,
+34,47,177,58,212,34,152,96,138,40,9,160,64,162,203,65,233,48,154,145,9,132,136,1,25,213,73,224,56,152,145,25,
+132,13,72,186,131,9,183,32,26,8,128,179,121,153,91,145,0,203,18,43,124,137,195,130,128,58,11,195,0,169,21,74,
+169,36,12,232,81,26,160,91,176,162,136,48,136,49,158,134,154,133,9,11,0,27,165,24,0,92,3,224,145,132,41,12,
+129,1,89,225,48,169,1,11,196,8,163,155,40,78,208,17,137,8,56,184,49,13,151,75,226,32,160,16,9,8,184,35,
+31,152,129,136,26,51,251,1,92,152,48,138,19,152,196,89,208,16,168,149,25,129,9,178,154,240,68,139,161,16,197,32,
+155,19,9,48,248,148,136,160,72,153,59,155,226,43,2,125,178,1,176,19,139,183,34,2,0,41,43,143,165,137,193,40,
+136,168,144,165,225,96,139,136,73,136,41,8,45,4,10,225,132,10,1,58,42,27,61,9,74,144,28,212,130,155,5,24,
+0,26,3,1,140,121,184,180,195,130,12,132,28,130,188,151,88,138,8,136,178,56,177,18,26,129,242,80,11,25,26,249,
+2,137,194,131,160,145,135,25,24,25,2,76,123,2,9,32,173,182,1,168,128,153,164,11,104,170,180,65,155,145,8,199,
+64,186,51,154,131,155,38,13,129,26,177,3,157,4,30,145,152,4,45,136,40,144,57,75,146,1,169,64,251,50,155,149,
+152,130,76,225,160,147,33,12,163,57,243,16,128,91,153,3,208,34,140,18,187,41,227,10,88,168,148,210,132,168,131,43,
+17,73,58,151,122,168,40,176,19,156,17,169,136,10,195,9,185,124,152,90,42,56,192,152,178,135,9,1,106,153,90,27,
+160,146,10,145,91,144,242,149,10,129,75,178,89,9,34,47,146,153,180,88,12,0,152,1,40,30,185,19,23,248,69,0,
+10,180,132,138,149,153,164,41,144,32,165,96,155,19,15,145,10,11,81,12,2,184,19,43,137,34,183,73,3,26,35,60,
+187,39,29,9,42,193,42,29,193,9,148,10,147,227,76,195,136,146,80,138,56,209,56,153,1,42,160,59,204,5,14,128,
+164,75,42,136,128,149,57,169,132,152,133,138,167,40,161,32,142,162,60,9,74,0,46,194,130,137,4,27,195,33,140,18,
+8,43,211,248,8,148,153,24,16,141,20,200,104,168,48,9,147,122,137,49,138,161,19,201,16,201,181,192,16,91,27,27,
+18,175,151,136,129,161,160,35,169,122,0,57,75,185,162,26,197,137,227,2,140,82,186,80,10,8,129,194,48,241,32,145,
+136,211,4,59,60,27,153,130,171,81,186,150,176,167,32,138,49,13,163,40,43,123,168,56,243,144,128,147,12,162,179,128,
+2,92,9,28,4,176,51,43,89,27,243,49,137,123,27,144,162,208,130,160,24,241,180,129,178,123,152,24,137,148,42,161,
+92,161,10,167,24,9,0,138,18,170,49,16,47,29,160,150,9,2,45,210,72,9,9,145,33,46,128,144,146,8,27,181,
+145,80,141,2,9,10,18,173,150,0,76,128,41,137,242,25,16,10,8,33,139,89,27,181,178,73,19,15,4,27,132,90,
+217,51,140,210,3,10,128,168,164,136,43,144,130,244,162,56,11,152,113,30,196,2,10,129,136,48,11,41,24,57,249,210,
+34,235,34,44,9,40,155,19,185,123,57,186,150,33,44,184,98,176,131,137,34,185,5,152,243,192,163,56,15,163,60,177,
+9,176,20,235,147,10,0,25,185,4,134,41,216,96,152,1,132,59,1,211,1,129,48,146,46,121,169,121,27,0,10,128,
+137,161,11,180,192,19,172,21,201,32,181,0,136,137,130,198,144,147,89,26,192,193,134,184,50,153,162,19,203,36,187,72,
+144,248,17,9,75,170,122,136,144,25,229,16,145,9,131,146,76,152,41,17,139,167,161,129,3,203,1,216,178,48,30,128,
+208,2,184,51,140,135,25,128,1,16,28,90,194,32,10,61,225,33,137,128,10,164,73,129,15,130,73,28,32,26,129,11,
+167,178,25,131,12,72,187,144,21,44,136,27,167,232,5,9,1,8,128,16,154,73,185,185,183,32,185,128,106,154,128,51,
+221,5,65,0,158,19,42,170,88,74,138,24,141,151,42,180,0,8,49,31,75,209,0,17,139,146,145,178,227,58,177,17,
+42,194,0,135,142,5,10,144,144,42,52,31,145,131,12,164,136,129,137,18,59,250,34,128,57,142,3,26,241,32,153,123,
+144,137,33,216,146,128,193,146,40,57,16,93,128,177,243,33,28,152,0,16,188,135,45,160,49,169,4,136,56,140,168,34,
+9,234,64,136,10,167,49,168,146,170,104,192,17,57,155,145,131,183,197,18,185,49,31,136,131,178,27,128,248,48,140,49,
+147,30,17,13,145,129,131,106,12,42,201,49,16,40,136,240,17,201,24,112,153,17,242,9,0,8,147,184,88,226,42,162,
+72,9,163,9,130,141,0,226,80,145,41,80,141,8,1,137,148,128,91,240,128,146,1,11,136,129,244,34,8,8,27,9,
+15,180,1,40,160,184,194,164,40,47,2,58,201,130,145,32,91,161,194,16,31,0,104,12,1,11,194,49,9,57,240,152,
+160,33,25,96,26,192,81,169,49,24,9,225,150,26,144,148,160,168,74,145,31,130,58,160,162,192,52,140,129,152,19,30,
+0,125,154,16,25,177,40,8,121,200,161,48,25,11,56,227,199,48,153,16,137,178,153,151,10,72,169,161,35,157,20,12,
+32,74,136,49,168,122,9,144,146,146,109,153,74,9,169,17,208,56,176,129,161,226,16,0,47,162,0,168,22,170,49,203,
+132,192,131,168,17,49,249,0,8,178,25,193,74,198,24,24,9,129,42,73,28,74,76,8,27,144,18,164,18,123,193,179,
+24,135,60,26,9,146,74,163,155,43,171,148,249,5,29,0,168,1,178,16,185,128,6,185,196,7,27,41,8,144,19,31,
+144,145,60,210,137,150,8,9,137,40,179,15,17,28,130,145,138,7,16,154,130,133,1,194,74,9,65,0,173,146,18,139,
+46,25,242,146,27,64,11,194,152,6,10,24,58,171,180,1,161,48,157,35,140,25,192,104,15,146,178,163,17,195,194,1,
+217,3,176,122,42,25,140,2,42,152,164,35,47,213,129,17,128,33,184,96,32,170,129,24,143,211,128,2,138,169,1,41,
+187,123,27,109,176,162,131,145,24,9,227,0,195,2,78,75,26,137,0,24,160,176,163,145,225,165,169,21,44,57,138,128,
+48,14,9,165,137,248,59,0,227,18,137,147,227,0,51,192,195,75,56,144,9,48,170,241,211,0,147,234,196,32,24,177,
+8,27,90,43,18,29,153,34,192,152,146,212,48,138,163,152,240,34,241,8,145,18,184,9,88,46,176,40,26,167,232,133,
+144,17,12,0,129,165,128,153,48,115,152,0,13,18,16,224,194,196,148,153,1,40,155,129,184,150,0,154,147,213,2,75,
+152,160,181,17,136,42,42,60,73,251,133,138,32,12,1,144,197,40,8,9,8,185,135,184,56,145,133,192,49,248,37,46,
+145,162,18,202,49,132,62,218,148,57,73,248,64,29,136,128,16,170,147,11,32,184,120,168,89,130,31,226,33,8,144,130,
+57,168,0,178,56,150,8,40,159,194,17,40,136,179,29,160,216,37,11,148,40,244,25,9,17,0,72,192,8,169,25,179,
+22,41,164,31,184,48,41,40,179,154,233,170,32,82,34,90,172,209,8,24,4,40,10,249,144,42,33,35,88,248,8,27,
+16,128,21,185,1,153,172,149,52,25,194,29,185,136,18,120,8,24,139,201,72,65,40,32,141,201,8,2,17,23,153,177,
+168,154,134,4,33,232,27,216,25,56,50,129,41,249,152,56,97,129,56,250,137,10,154,6,33,160,128,187,169,2,7,18,
+178,251,161,9,64,105,24,136,9,187,42,162,123,5,144,11,225,8,130,19,33,169,225,11,26,65,20,165,178,139,187,57,
+65,56,147,234,141,41,43,65,38,43,212,58,156,8,146,19,146,232,145,187,147,133,35,48,202,47,157,129,40,50,144,152,
+33,158,32,120,1,18,217,0,203,128,48,40,164,153,233,10,42,104,19,40,233,76,216,24,17,48,17,156,196,152,144,32,
+3,10,134,188,146,46,0,48,121,138,25,154,9,48,83,144,36,152,154,178,107,161,160,130,143,170,27,128,164,7,128,136,
+58,74,156,18,140,82,152,8,161,151,136,129,168,150,169,3,43,28,58,27,201,91,136,149,130,40,146,177,250,66,3,60,
+42,8,217,0,91,136,43,46,176,24,30,34,57,28,9,58,57,30,72,160,232,146,147,64,90,43,137,28,168,35,40,200,
+139,194,189,167,131,133,33,168,178,8,73,9,47,137,166,11,152,72,60,1,35,30,10,28,154,17,1,57,200,199,146,161,
+148,1,128,242,152,59,33,144,131,247,63,0,35,77,170,74,24,146,25,80,153,152,184,38,164,35,217,232,161,16,42,25,
+188,1,125,10,16,35,9,140,59,1,76,0,137,208,168,16,153,115,8,43,187,199,16,8,128,10,18,53,142,16,211,65,
+8,1,1,44,216,160,58,9,2,94,139,26,45,33,168,34,76,9,15,225,48,0,180,18,154,162,11,40,160,167,138,160,
+28,43,57,23,0,159,180,42,24,32,36,153,146,26,81,136,81,152,138,204,32,216,72,202,149,41,155,151,8,161,129,130,
+13,8,48,104,144,9,226,25,33,43,164,153,227,137,144,25,72,148,96,173,147,75,56,129,2,176,243,136,154,3,34,51,
+196,143,216,16,57,24,20,141,136,169,56,136,23,35,235,162,141,129,130,65,152,129,168,220,3,33,80,152,25,251,8,0,
+72,33,25,145,172,42,163,7,160,9,193,153,153,123,131,129,16,241,25,8,18,140,194,145,1,10,49,138,216,64,30,130,
+33,250,128,152,152,35,73,149,40,144,136,24,23,160,57,242,137,161,9,56,24,77,144,155,65,249,32,9,152,41,24,83,
+24,164,176,129,72,228,76,154,144,58,45,40,57,43,104,249,32,176,161,148,153,64,144,131,38,168,130,151,75,128,140,136,
+201,0,137,162,64,130,136,7,30,146,137,33,251,16,0,129,35,242,41,128,27,150,26,153,226,9,59,168,112,129,24,16,
+171,67,136,58,5,46,48,141,24,145,25,1,217,65,233,153,130,153,33,1,15,149,42,32,169,81,162,185,145,248,73,146,
+136,133,153,28,146,26,23,169,26,152,15,16,32,121,161,128,145,153,114,144,25,25,251,16,137,16,5,10,8,193,42,133,
+168,48,248,26,128,25,121,161,145,1,186,22,153,25,16,219,34,12,160,6,26,48,136,93,146,169,9,243,32,0,192,80,
+186,1,17,137,37,170,201,34,159,3,0,138,151,137,24,196,64,145,154,9,185,28,2,148,73,154,136,66,169,55,9,152,
+144,142,34,153,32,17,177,177,149,16,194,243,75,233,129,16,171,0,74,7,56,137,19,203,168,2,15,40,16,58,159,0,
+130,17,38,140,169,182,171,132,33,74,145,9,195,152,112,32,168,24,249,153,32,8,129,165,244,128,56,9,56,75,193,138,
+40,10,122,137,133,177,0,2,41,188,183,193,139,218,78,0,1,0,76,25,8,193,1,144,82,232,130,184,177,18,108,8,
+42,145,9,131,106,168,17,252,16,0,42,72,136,152,155,135,56,128,44,240,136,17,57,144,48,160,169,35,123,106,61,184,
+192,131,128,147,26,179,224,162,122,40,28,152,153,32,137,34,77,24,241,18,136,49,15,178,10,1,177,113,45,9,160,16,
+161,83,186,148,14,41,147,88,45,0,144,144,148,33,186,132,142,161,179,121,10,32,10,170,131,88,152,72,157,193,148,16,
+136,88,136,137,129,64,160,63,203,131,129,24,152,121,152,26,146,65,145,63,232,0,130,16,160,72,136,27,193,67,153,78,
+185,128,129,56,161,106,128,154,227,50,194,75,185,40,153,56,166,123,24,155,147,57,167,26,209,24,144,129,147,108,9,136,
+24,25,7,45,192,40,136,177,165,73,144,8,26,0,166,10,178,75,26,184,7,28,146,40,44,9,134,154,161,92,169,146,
+148,145,33,11,25,8,7,200,16,47,144,8,1,147,129,29,136,145,6,216,56,14,0,136,17,136,49,10,153,128,167,196,
+24,154,16,192,32,194,81,58,45,139,35,243,137,8,8,137,146,167,17,16,60,161,33,183,144,154,41,16,188,7,168,74,
+25,75,42,7,155,8,138,145,224,151,146,0,128,42,176,36,184,10,156,72,173,18,162,2,2,156,132,18,199,9,16,61,
+42,10,147,35,41,41,8,145,199,208,75,41,26,11,181,12,16,177,57,33,199,132,11,2,26,152,9,59,11,115,46,140,
+135,144,145,145,144,10,8,186,40,112,46,129,34,145,20,153,0,208,168,242,160,105,10,128,40,129,24,64,17,175,147,241,
+128,136,56,75,152,32,9,50,120,136,188,151,168,161,17,156,34,210,1,32,112,27,1,137,225,16,26,184,1,152,199,129,
+120,144,24,24,192,128,26,184,0,11,199,33,25,56,16,184,4,248,0,152,60,203,147,136,4,64,10,36,162,160,167,42,
+15,162,168,147,17,40,75,26,7,184,19,107,14,168,17,169,41,80,138,1,1,181,3,9,130,250,128,27,152,10,16,13,
+128,135,25,5,25,152,178,138,234,4,106,13,146,145,17,17,106,24,128,193,224,0,91,170,0,144,144,56,34,138,114,167,
+177,17,138,43,41,153,224,154,7,41,60,178,131,129,162,15,103,254,73,0,171,35,186,144,97,75,60,179,20,1,130,40,
+187,208,168,242,32,45,185,34,17,1,40,176,141,12,184,183,66,9,11,26,24,149,129,48,15,90,153,178,132,144,27,12,
+1,228,130,33,14,9,148,8,194,50,27,138,21,162,177,67,31,10,73,11,10,74,27,27,8,183,212,32,152,130,41,147,
+156,72,26,62,138,181,179,24,164,42,40,168,129,152,109,60,12,4,144,1,17,29,40,16,248,193,19,31,9,17,168,130,
+130,10,136,48,230,145,72,27,42,43,146,15,16,8,43,32,243,192,130,24,10,48,2,28,33,57,95,155,150,161,145,49,
+143,17,128,160,161,50,143,40,57,250,33,25,11,17,129,181,211,50,140,58,58,241,41,24,138,60,144,215,0,1,152,9,
+145,181,106,60,177,122,169,133,42,160,34,140,17,24,186,131,57,15,56,73,142,163,105,138,8,195,130,200,81,139,32,16,
+202,3,56,172,199,32,176,147,42,192,93,161,128,8,16,60,144,42,146,26,149,5,31,164,41,168,17,185,88,12,179,160,
+38,136,193,183,193,8,0,74,44,176,34,41,58,240,49,141,145,33,129,34,15,176,106,169,129,144,8,3,1,74,17,31,
+232,32,154,133,152,4,26,177,17,24,130,158,164,27,195,1,240,131,8,178,2,59,180,89,218,130,45,128,128,2,162,147,
+137,128,167,122,240,1,26,177,32,0,61,168,32,145,82,30,193,32,139,132,8,34,143,130,27,163,32,140,200,57,128,33,
+164,88,204,35,29,72,144,177,146,10,145,93,0,25,186,72,153,26,135,161,56,14,0,152,50,147,170,24,46,137,55,12,
+152,139,8,149,8,5,157,1,29,2,104,144,160,8,140,19,161,21,187,161,140,16,112,130,0,15,138,2,80,42,200,0,
+10,0,20,163,1,159,240,2,73,136,192,24,26,144,34,164,1,175,164,2,49,155,248,1,25,131,128,130,0,191,17,177,
+52,29,232,16,24,129,136,67,208,58,16,152,35,156,248,129,147,194,41,32,241,24,145,0,0,60,249,145,131,179,44,131,
+242,128,17,136,48,47,154,161,132,128,170,134,193,57,41,176,5,43,170,148,35,152,44,121,193,44,161,179,65,28,186,148,
+148,162,10,48,164,15,128,130,64,45,200,17,16,144,12,136,5,204,146,3,68,247,73,0,90,168,208,32,147,32,137,152,
+54,241,10,18,176,150,184,58,149,144,16,140,88,8,15,0,144,80,11,138,36,137,58,136,58,52,191,17,161,57,225,160,
+80,137,136,24,41,121,216,8,48,26,162,43,126,128,8,0,8,56,242,10,57,176,146,92,12,0,128,24,130,41,21,143,
+25,17,10,91,44,8,8,0,72,152,67,159,168,5,9,75,10,144,42,137,66,16,89,192,201,114,136,42,48,140,42,136,
+8,66,139,179,175,88,145,59,88,169,169,1,152,114,8,65,204,24,3,61,58,162,218,128,128,72,130,73,241,138,33,75,
+25,132,169,161,41,48,121,57,193,140,136,73,41,34,232,160,137,40,80,24,147,235,184,48,26,7,179,192,137,137,80,64,
+17,155,188,76,138,6,24,144,153,169,56,112,18,25,243,27,208,4,128,131,137,169,186,24,99,0,130,159,177,130,128,21,
+145,177,193,44,9,113,16,171,242,146,144,1,56,153,73,142,145,25,20,153,241,33,9,32,58,148,25,216,133,10,5,138,
+244,8,144,0,137,19,9,138,64,171,36,138,199,0,24,57,155,65,168,136,177,197,149,168,183,144,58,41,170,9,4,42,
+130,82,129,202,7,57,12,32,169,227,1,136,8,41,48,253,150,40,170,1,136,40,11,177,130,96,74,217,4,56,10,41,
+168,154,241,144,144,44,35,250,132,90,9,72,27,184,146,211,34,12,5,186,133,91,9,32,26,176,27,128,28,242,17,241,
+2,75,160,48,152,16,10,44,136,25,49,241,74,13,163,41,0,0,145,0,161,13,88,234,64,29,162,104,9,129,144,161,
+51,140,24,232,73,140,147,26,177,34,153,35,121,24,122,185,56,158,147,144,146,57,137,26,24,183,122,168,88,155,130,8,
+17,26,48,15,178,18,59,181,125,137,24,144,146,25,0,141,129,26,24,184,124,153,5,26,128,57,40,248,164,145,9,178,
+125,168,1,9,128,60,8,152,145,56,46,179,107,177,146,16,33,61,40,160,194,129,137,183,78,152,128,152,132,25,57,30,
+144,194,1,195,107,152,146,9,147,41,107,176,8,128,74,177,79,225,17,138,1,27,1,168,33,202,133,50,15,150,40,138,
+17,137,56,168,8,204,32,136,143,167,16,138,130,136,32,145,123,169,74,145,26,150,0,138,199,0,70,0,160,129,144,50,
+31,138,44,146,63,195,0,160,32,153,23,137,19,29,137,20,30,129,41,12,74,200,17,194,16,154,0,3,156,135,25,75,
+154,180,131,160,105,169,59,18,141,148,123,27,161,194,2,24,11,80,59,1,31,146,90,192,1,177,1,8,170,123,27,64,
+137,40,61,194,106,169,130,178,25,73,156,51,202,64,123,8,44,161,0,0,29,24,186,50,156,147,48,23,128,171,138,0,
+31,122,152,18,171,129,129,22,50,249,137,129,29,56,160,96,216,145,128,80,24,161,29,26,169,1,4,144,243,128,168,80,
+3,130,233,193,144,16,8,134,137,26,184,24,23,56,8,158,9,0,9,6,192,1,192,9,51,1,73,129,191,16,225,34,
+0,154,177,169,104,148,152,20,217,9,16,57,137,49,188,43,195,55,153,88,153,170,128,132,193,149,193,136,17,89,129,59,
+1,250,137,19,218,20,160,139,17,129,17,73,75,218,12,112,137,129,178,152,8,134,144,130,73,249,152,50,201,17,179,13,
+1,3,128,73,41,224,154,115,152,160,4,141,17,129,136,25,48,249,169,114,169,128,132,12,40,2,9,24,24,241,185,113,
+144,137,129,29,0,2,136,57,41,240,170,82,144,185,134,28,17,130,1,74,41,249,160,67,9,216,0,13,17,1,128,74,
+24,189,178,98,137,0,128,15,17,130,24,41,17,207,128,34,136,177,210,12,48,1,160,65,145,175,145,20,9,1,178,142,
+98,144,146,58,149,158,128,131,8,137,168,43,124,0,9,40,3,191,147,149,136,25,194,42,48,56,184,122,2,159,128,147,
+0,154,161,156,115,25,145,57,20,159,129,131,9,145,169,192,113,136,146,25,4,159,8,130,1,28,152,169,51,177,163,131,
+103,173,0,129,32,44,137,192,64,128,162,145,23,203,154,5,40,169,33,155,108,1,144,146,22,219,136,17,8,153,3,224,
+26,150,40,152,50,208,171,9,23,137,9,178,169,21,168,164,20,8,251,138,35,138,146,166,27,40,147,40,67,32,241,159,
+65,136,128,129,202,17,146,10,53,10,149,191,16,129,130,24,216,16,1,193,36,8,65,221,8,129,129,128,169,25,25,136,
+112,16,52,248,13,41,130,16,26,152,146,162,81,147,37,153,175,168,20,8,169,130,12,26,1,33,113,129,32,29,68,0,
+252,137,34,17,168,97,11,137,73,26,65,144,161,207,40,33,169,34,154,233,64,25,88,129,24,251,9,66,128,16,16,202,
+60,144,88,24,40,240,141,72,144,0,17,169,29,0,89,128,0,131,175,24,130,32,1,178,158,24,42,130,97,0,236,9,
+0,16,19,17,142,128,25,19,121,128,0,159,152,18,49,16,186,184,172,162,37,135,25,217,169,89,41,3,73,155,10,154,
+106,3,40,178,221,43,3,52,59,243,136,154,137,7,24,1,243,138,130,32,41,19,11,234,155,130,17,53,163,191,16,128,
+152,135,1,144,139,137,75,64,149,185,138,1,140,4,48,146,189,162,209,128,23,152,9,17,225,130,1,146,40,129,136,192,
+82,154,173,146,211,152,32,150,233,32,160,130,72,152,33,1,232,129,144,209,180,9,194,130,72,13,48,45,9,16,15,163,
+169,40,241,132,17,153,66,2,177,72,217,16,153,9,188,134,25,169,32,181,2,136,160,120,156,41,168,56,122,137,8,7,
+152,2,176,146,26,12,140,16,92,141,8,48,160,130,163,115,186,17,160,120,41,248,0,3,178,1,169,16,196,130,13,128,
+136,232,27,0,3,40,176,19,17,121,0,47,17,171,141,16,212,72,136,136,153,19,60,35,210,0,159,0,1,8,73,113,
+170,58,146,73,5,200,168,180,144,129,160,60,131,31,136,74,3,132,171,145,224,48,186,49,139,14,128,152,134,135,0,128,
+160,44,8,138,178,242,24,1,18,49,42,21,198,160,146,44,138,172,161,26,4,18,208,5,20,8,91,140,8,192,200,178,
+4,144,160,42,7,32,128,12,178,154,232,9,18,210,146,152,39,32,48,136,41,156,15,152,3,141,161,152,133,17,25,68,
+56,205,145,9,134,9,25,76,129,148,160,107,106,201,32,140,0,209,8,152,131,161,56,154,52,225,144,45,145,24,56,32,
+93,3,137,0,1,183,0,187,96,9,168,1,10,22,41,169,43,135,141,177,48,168,34,14,74,163,56,137,161,180,210,210,
+76,146,137,0,8,211,120,153,56,145,185,133,61,152,0,137,162,7,138,146,42,178,10,241,78,128,26,9,1,209,34,225,
+33,128,138,161,61,128,75,186,112,194,17,168,33,153,17,224,60,1,154,32,136,135,40,248,33,152,136,178,45,160,131,11,
+82,218,70,0,40,135,24,160,18,27,195,181,15,133,10,128,40,194,64,154,33,42,242,16,171,165,24,176,91,134,26,177,
+96,153,17,138,152,147,160,152,171,23,152,144,109,24,138,25,140,179,81,201,24,133,128,152,33,57,194,138,159,133,26,144,
+43,148,73,208,1,18,227,41,218,131,16,8,12,68,27,161,48,24,162,31,234,131,137,128,160,82,43,179,47,2,136,74,
+251,2,9,163,8,49,138,148,46,40,1,30,217,48,154,1,136,16,18,176,11,71,42,59,248,73,152,2,154,98,169,147,
+186,83,25,10,234,90,138,33,184,88,1,224,0,17,130,42,192,47,152,1,40,74,9,161,136,186,119,185,16,31,144,16,
+129,42,17,8,59,168,86,169,1,142,162,161,16,139,23,44,144,9,64,193,25,168,209,146,40,194,120,144,9,144,105,0,
+10,153,209,131,156,7,44,1,10,8,57,131,158,2,152,56,169,114,27,32,170,129,171,70,185,59,9,137,201,120,8,121,
+144,137,161,50,176,61,184,162,180,25,33,125,26,136,154,65,180,139,181,144,145,1,32,122,0,146,13,34,8,216,162,11,
+161,192,106,161,0,167,154,33,3,201,32,44,202,6,27,147,24,17,140,58,66,192,184,143,196,1,176,35,28,64,202,57,
+34,129,9,154,59,49,245,72,162,17,241,8,168,51,185,46,138,138,151,9,1,49,137,155,149,88,131,31,160,9,32,153,
+74,48,139,244,0,136,19,187,17,31,139,135,160,88,160,16,128,152,21,162,138,10,242,40,178,61,130,10,168,179,73,40,
+178,143,210,17,162,73,27,178,151,42,41,81,43,141,216,3,24,27,128,9,129,160,33,93,121,136,153,72,136,130,154,209,
+49,186,39,141,88,24,186,24,162,56,178,27,136,248,5,185,19,75,148,43,211,41,208,57,216,177,5,177,24,146,144,88,
+130,27,147,31,144,24,11,67,13,150,152,131,57,181,43,28,129,159,17,10,59,2,25,40,197,67,130,9,24,251,43,168,
+41,175,51,143,131,32,184,81,128,144,25,227,24,136,46,152,32,28,135,25,1,34,219,4,170,10,32,202,57,201,152,17,
+82,10,6,163,50,216,177,25,139,224,17,200,104,136,185,21,128,176,5,169,136,10,243,0,8,139,135,0,131,1,1,131,
+7,172,2,170,185,14,67,0,45,178,156,43,180,41,130,131,66,133,241,130,9,128,9,193,155,35,142,121,128,192,36,168,
+40,48,205,177,129,169,16,80,12,166,16,161,67,153,81,202,129,1,216,105,160,144,26,162,11,6,152,161,24,241,34,139,
+132,16,208,56,144,58,58,129,239,4,10,9,32,208,33,152,0,88,153,88,154,18,155,134,141,133,10,145,17,216,49,144,
+12,17,210,58,160,4,140,132,11,18,27,178,78,240,33,168,0,32,217,8,3,137,32,67,175,131,43,161,74,8,60,161,
+48,136,167,90,176,1,41,164,47,8,9,12,49,217,88,26,152,130,226,149,9,1,170,113,139,35,30,8,40,171,33,160,
+153,50,242,56,143,131,60,9,40,169,134,8,146,121,202,21,27,129,58,137,57,170,18,13,177,105,248,18,153,130,42,43,
+11,128,176,19,159,98,219,19,139,164,48,170,165,145,129,32,168,69,240,65,11,18,59,200,16,168,132,27,181,90,208,89,
+137,17,26,178,29,146,74,139,145,89,224,56,137,148,40,161,9,35,153,43,242,106,224,40,10,145,89,153,130,16,8,3,
+246,57,216,17,155,132,58,144,128,0,35,44,133,11,241,92,170,131,41,145,40,41,42,152,7,9,208,45,210,0,74,129,
+41,8,128,128,146,96,241,41,10,137,17,180,49,177,48,170,1,50,167,15,209,128,42,32,170,134,8,144,16,24,4,218,
+0,138,185,135,24,176,133,24,139,65,0,63,200,145,28,146,168,20,160,150,1,26,148,107,161,145,187,5,28,10,129,17,
+184,18,151,31,163,0,201,131,152,9,74,25,1,33,167,45,161,35,171,226,148,138,138,32,128,41,135,12,178,34,137,23,
+170,132,10,28,130,43,7,138,196,16,154,50,160,176,193,169,59,28,7,11,151,57,11,1,8,20,250,144,146,28,32,28,
+167,40,160,41,153,80,177,136,184,1,75,13,135,16,168,19,171,65,179,129,240,137,145,188,133,18,10,148,168,16,162,121,
+161,155,134,188,133,42,25,19,186,150,1,154,67,168,178,222,132,43,136,32,163,9,151,40,139,19,37,191,131,9,138,105,
+24,26,178,147,194,27,20,208,177,41,193,59,91,147,49,44,147,15,16,185,23,156,161,1,137,8,82,168,50,154,145,250,
+84,10,153,25,182,137,40,4,189,26,73,0,152,41,4,175,48,24,194,11,146,224,162,32,133,9,104,169,8,40,2,153,
+138,250,212,145,48,8,88,201,3,138,136,68,225,136,24,138,162,57,68,185,65,161,242,128,4,185,42,28,193,152,82,160,
+24,1,179,12,134,17,184,202,66,250,40,129,128,1,146,9,194,90,51,175,128,10,136,240,33,179,32,178,134,10,21,24,
+176,217,89,200,26,3,161,177,96,169,24,32,134,233,128,161,168,8,20,1,40,24,33,175,83,162,186,241,16,185,162,3,
+18,169,121,42,185,36,134,240,0,145,138,17,34,155,35,24,176,143,2,166,240,129,128,168,74,162,48,137,18,170,9,226,
+7,137,169,88,139,161,98,177,0,147,156,209,34,121,169,152,49,172,123,0,129,145,33,200,27,122,146,169,24,26,29,184,
+69,152,24,129,28,47,1,129,168,161,27,9,43,51,33,240,121,60,11,106,129,184,8,146,13,128,19,17,139,127,136,25,
+57,131,141,128,42,170,90,164,58,92,144,26,152,50,130,251,40,145,31,24,72,27,17,9,153,8,81,227,9,184,33,186,
+47,48,128,76,160,2,59,133,16,172,33,152,45,30,134,25,153,4,154,128,88,194,28,128,136,156,20,74,168,18,162,179,
+47,133,153,8,43,241,145,32,136,16,144,194,146,73,0,209,47,144,178,0,17,2,146,4,60,242,48,11,144,244,0,25,
+153,73,153,19,14,163,32,8,139,199,2,11,3,184,144,82,11,128,41,16,189,199,65,138,128,8,194,24,154,151,26,130,
+139,135,48,170,3,17,235,19,153,58,12,89,173,198,33,153,16,40,144,136,136,49,14,178,186,167,122,169,17,16,152,80,
+153,56,139,50,189,129,93,200,17,75,161,48,144,20,171,97,186,133,45,137,24,11,145,33,40,66,202,35,252,4,45,152,
+8,41,161,16,8,49,200,66,138,129,31,136,29,192,18,41,169,114,137,72,10,19,45,153,17,240,129,72,186,83,11,57,
+169,122,8,243,40,11,144,41,136,147,128,22,156,67,45,129,153,25,26,158,129,33,209,66,138,74,185,23,10,176,1,27,
+233,64,32,58,210,17,27,145,6,136,46,138,32,159,167,2,41,15,8,129,32,177,56,26,162,208,41,142,178,83,25,2,
+232,3,9,138,48,206,211,129,48,25,212,1,113,12,82,0,137,8,34,137,10,166,1,143,146,145,1,144,138,22,43,49,
+210,46,154,176,18,144,163,85,138,0,153,121,136,136,130,170,248,1,130,91,146,25,154,144,113,152,242,17,184,75,16,26,
+3,16,15,146,210,35,24,31,194,10,8,0,140,36,168,132,161,28,50,44,136,226,161,64,137,32,8,245,129,136,128,16,
+16,159,18,28,9,130,0,148,194,145,168,56,3,155,135,45,202,129,17,74,129,56,45,217,64,170,35,49,143,144,160,17,
+152,149,130,140,134,141,16,32,16,242,144,136,152,17,97,152,36,156,1,154,129,82,128,216,152,224,25,130,80,153,132,9,
+139,73,17,82,154,202,179,203,112,152,50,24,232,24,176,0,18,41,75,31,11,138,122,129,33,18,186,131,12,136,17,1,
+124,172,177,26,40,96,40,16,139,193,141,16,4,176,39,218,2,12,25,18,41,179,165,201,10,176,147,20,33,200,72,159,
+8,17,43,23,24,154,129,225,146,33,17,26,143,208,128,32,41,181,58,193,193,26,34,146,51,162,252,88,28,168,19,40,
+209,195,16,171,129,2,48,40,58,191,226,129,33,27,23,10,25,242,9,34,0,160,83,235,145,11,1,40,32,180,243,128,
+153,180,72,17,129,9,31,216,0,17,152,67,144,232,40,154,89,1,16,24,187,43,143,128,20,164,147,211,128,139,3,25,
+73,20,158,153,196,144,74,149,16,41,136,185,169,136,7,136,17,166,142,129,168,48,148,146,48,172,139,26,74,150,16,167,
+177,24,11,136,99,41,184,133,155,163,13,121,0,9,49,250,128,160,9,20,136,34,203,1,153,152,83,129,33,160,143,225,
+152,18,176,112,25,26,138,8,161,134,152,6,209,144,153,162,50,64,4,40,186,168,140,59,146,70,139,232,161,154,56,34,
+40,7,168,32,189,48,11,67,34,42,191,180,44,8,48,18,185,35,191,27,200,105,48,148,25,12,154,179,3,23,33,128,
+160,216,233,17,170,82,0,168,153,123,12,128,131,162,88,56,205,130,169,96,145,72,169,161,145,138,32,98,202,148,128,28,
+185,65,8,81,162,13,25,179,208,5,0,24,177,160,153,184,69,75,129,129,190,72,140,145,2,50,26,187,23,173,1,97,
+168,18,173,40,194,9,146,132,82,141,128,24,201,49,1,35,77,44,68,0,206,0,211,145,18,26,3,179,248,40,169,24,
+32,66,242,169,80,169,179,16,34,91,186,2,29,72,139,64,97,174,128,17,160,26,17,64,144,30,24,10,105,8,20,12,
+184,129,132,137,176,116,136,156,88,138,40,74,128,178,188,32,148,144,161,69,136,184,41,62,177,74,48,1,175,26,131,168,
+45,146,51,153,233,48,169,58,121,4,169,168,80,146,170,48,7,24,143,41,161,138,18,19,29,249,24,146,161,25,7,137,
+128,59,136,56,61,37,28,156,145,129,209,136,3,129,241,56,10,178,155,87,145,141,17,9,9,144,5,0,153,3,186,212,
+16,90,162,154,200,128,129,30,16,167,144,3,24,157,147,58,20,154,208,25,177,131,45,147,97,186,67,158,1,26,164,1,
+200,129,192,3,48,177,114,43,168,8,129,27,8,135,61,248,2,10,146,26,0,184,135,0,187,151,152,163,50,232,57,184,
+33,140,148,41,161,150,11,128,41,193,83,128,193,178,163,244,162,65,170,9,3,202,90,16,128,34,144,9,184,122,192,33,
+235,195,41,184,34,227,35,145,209,65,202,16,57,240,25,185,130,145,66,8,65,122,169,18,32,168,168,215,128,216,1,137,
+130,65,137,25,64,11,24,135,160,176,59,202,193,49,57,43,135,177,58,180,2,40,21,234,242,16,152,161,18,196,145,195,
+148,137,3,242,19,58,217,42,142,145,24,25,9,136,40,156,20,56,130,170,69,177,159,65,28,60,146,136,16,65,26,18,
+1,135,45,161,72,217,32,27,184,74,192,155,39,154,41,51,139,147,109,8,193,137,32,156,9,178,147,106,2,138,56,3,
+207,112,128,24,8,192,41,136,25,34,79,160,164,27,129,138,26,112,25,17,217,184,46,128,152,35,132,10,164,140,42,226,
+48,106,8,2,249,128,26,42,16,34,184,212,33,157,58,2,25,49,164,128,240,27,154,19,18,22,47,160,0,14,130,16,
+41,56,196,17,240,0,26,24,2,145,57,144,15,10,40,161,133,75,17,128,206,177,179,123,145,48,11,212,153,3,44,0,
+40,155,23,169,12,48,249,49,145,41,10,27,143,151,25,130,128,26,147,248,8,32,169,4,160,8,144,139,89,180,64,147,
+138,131,151,188,4,40,43,130,208,48,187,27,147,19,0,6,31,136,178,143,35,210,77,0,130,144,65,42,248,17,169,48,
+0,32,17,225,41,16,173,42,136,177,39,74,172,18,172,129,134,16,10,24,8,128,244,74,42,9,133,192,8,129,43,124,
+144,1,8,144,40,123,248,129,0,8,1,153,136,161,242,80,9,9,130,138,2,146,249,8,163,59,131,165,63,153,177,65,
+152,17,144,26,49,181,223,3,161,123,24,144,10,16,186,48,72,153,179,57,22,152,143,0,180,17,50,172,61,145,217,19,
+33,171,65,184,2,241,139,124,161,129,130,217,16,136,152,50,162,168,5,138,67,205,177,120,128,161,1,152,200,129,17,65,
+152,61,58,26,18,255,129,48,137,42,195,177,26,17,19,28,5,177,124,56,8,143,144,131,146,58,161,201,1,154,122,8,
+16,155,5,17,250,28,32,176,5,1,136,170,128,24,147,131,72,15,24,179,241,170,66,59,48,180,203,0,160,79,17,136,
+178,129,105,193,14,144,148,1,90,9,59,10,177,18,36,141,56,128,160,227,46,24,25,24,5,154,27,33,45,171,7,153,
+130,42,17,240,139,96,25,145,57,168,160,192,130,40,21,156,19,90,193,153,157,52,25,169,83,249,8,144,162,129,19,185,
+131,112,129,191,1,133,0,24,74,193,43,147,169,3,7,140,129,16,153,143,72,128,176,18,137,201,88,137,32,137,52,174,
+50,129,249,24,57,9,0,129,201,193,34,145,79,128,176,16,129,20,191,144,130,65,8,152,91,225,128,3,24,24,75,145,
+49,176,191,144,133,150,9,129,10,139,43,20,128,153,38,217,49,194,159,32,146,130,42,24,156,155,83,0,144,120,184,162,
+34,241,15,56,41,137,16,129,170,40,146,37,186,5,138,41,88,221,169,6,24,9,33,10,154,2,144,135,16,184,180,51,
+9,159,13,20,9,146,56,202,75,187,150,34,210,41,128,16,188,43,31,3,25,181,2,184,130,31,130,89,152,0,128,24,
+13,169,29,3,164,8,17,10,185,217,50,73,9,59,242,7,9,9,44,72,177,136,36,168,43,147,235,146,2,12,8,123,
+162,184,24,146,28,241,33,184,112,177,9,56,132,157,49,161,153,131,202,80,152,137,42,75,178,186,181,114,160,25,40,242,
+50,152,186,126,144,152,25,146,26,33,13,17,20,152,144,81,8,178,158,18,193,13,16,24,158,3,67,0,13,3,139,44,
+7,136,161,131,73,200,10,75,24,153,136,45,9,4,250,17,35,161,28,96,10,24,185,170,23,168,210,57,184,34,15,57,
+32,177,32,12,41,132,241,10,3,129,27,106,170,21,40,30,33,148,154,17,186,36,155,15,1,185,67,158,169,97,160,8,
+0,131,57,43,137,164,39,251,18,43,8,169,204,82,136,75,8,160,17,194,42,8,20,170,177,123,48,43,14,24,165,164,
+17,193,19,20,158,130,130,76,10,154,73,155,234,73,43,146,176,144,146,48,16,152,0,115,131,47,45,40,136,153,16,106,
+40,129,154,89,165,80,59,168,32,164,14,138,0,56,219,136,132,120,139,24,16,0,56,171,160,103,201,24,176,64,136,201,
+0,4,40,160,161,90,58,249,145,96,152,128,11,170,34,210,42,17,26,113,241,57,152,194,129,1,185,39,152,139,168,161,
+4,88,160,16,135,168,8,128,24,120,139,145,131,73,243,201,8,3,136,146,133,57,9,176,249,72,178,33,227,17,130,209,
+139,138,9,134,148,11,133,144,168,8,170,35,148,179,120,8,16,250,224,129,18,24,26,177,148,193,171,58,166,25,135,9,
+136,3,209,170,1,72,18,144,162,185,135,43,15,16,147,161,136,131,128,2,158,223,3,19,153,42,144,178,195,140,65,73,
+16,240,18,16,41,156,201,132,34,9,25,10,22,250,25,59,57,16,227,17,24,40,248,186,0,0,38,27,8,40,8,159,
+138,33,166,145,57,144,50,0,255,9,33,16,144,40,33,156,138,250,65,40,41,42,144,35,140,175,144,40,82,177,123,26,
+129,169,152,49,122,40,168,24,74,16,43,191,72,24,0,8,72,40,184,174,43,97,41,11,0,8,21,201,142,139,113,0,
+41,25,106,168,152,136,133,72,136,8,40,1,43,191,47,144,3,128,128,0,1,217,170,106,56,16,30,145,19,144,187,175,
+49,18,145,177,58,5,143,202,17,1,151,8,8,0,32,185,143,40,58,151,129,128,128,139,128,203,4,36,138,137,44,151,
+161,208,8,1,34,161,200,49,17,251,12,4,0,144,24,137,51,167,250,152,24,35,155,130,131,226,136,141,42,19,135,144,
+144,20,201,165,155,8,82,1,128,152,65,153,251,8,128,135,24,10,24,35,187,251,152,17,7,136,154,20,162,32,75,0,
+153,186,58,48,120,128,168,132,161,146,252,9,64,40,58,161,153,129,152,143,16,22,243,2,10,24,25,169,10,10,115,8,
+224,17,192,56,28,9,130,21,27,11,50,26,241,153,154,115,25,40,43,8,139,224,25,83,153,90,176,105,24,152,143,8,
+8,4,58,25,160,128,208,123,41,40,144,178,131,34,59,204,234,49,48,63,136,144,161,225,25,40,146,144,132,123,9,90,
+233,144,24,17,1,162,128,57,220,46,129,40,129,40,155,4,193,193,138,78,40,129,130,76,136,140,128,146,33,18,157,2,
+144,56,161,223,26,149,147,33,75,10,201,201,99,24,136,58,214,0,1,136,141,136,131,18,91,11,147,252,163,17,137,17,
+177,130,16,59,67,223,144,1,135,42,145,162,185,32,74,25,131,146,181,202,36,146,223,0,2,41,41,163,160,217,41,233,
+133,41,147,25,170,37,160,221,1,0,56,225,19,160,171,73,160,139,39,129,27,145,5,240,144,41,58,59,17,180,177,89,
+140,234,4,178,49,26,152,72,195,203,57,32,27,150,149,210,41,154,162,41,19,56,200,50,176,245,152,144,91,136,131,16,
+0,159,145,169,33,180,98,8,73,137,18,251,26,33,200,34,37,186,48,185,15,24,130,26,36,152,26,51,253,9,9,193,
+122,0,129,9,0,156,16,8,128,134,26,147,45,146,187,168,18,159,83,136,24,18,15,0,58,208,48,128,136,73,179,154,
+89,153,143,2,75,193,64,153,2,43,146,58,136,20,157,33,47,178,80,201,57,11,34,172,147,20,159,35,141,129,129,169,
+21,9,16,128,233,72,13,130,184,150,32,154,132,137,48,137,50,80,45,65,220,147,25,233,49,145,44,1,176,57,137,61,
+171,7,58,27,133,168,43,137,140,57,164,121,8,40,154,204,49,196,1,33,128,113,170,136,234,129,26,164,82,168,130,10,
+155,162,250,22,161,32,32,169,12,226,9,42,67,8,178,133,201,137,153,161,112,131,25,1,48,172,159,25,208,50,33,176,
+122,161,155,9,128,65,133,16,144,121,184,202,177,145,121,33,8,129,248,16,154,26,49,130,16,150,16,170,249,152,9,80,
+130,17,168,213,154,144,40,72,66,24,225,33,210,140,24,12,136,23,136,145,2,29,184,16,128,48,18,8,41,152,252,152,
+231,242,69,0,46,137,134,16,163,10,29,154,136,50,164,50,58,40,228,185,136,15,176,7,8,129,41,12,136,153,19,42,
+23,12,1,146,157,0,171,180,54,58,130,11,9,159,145,17,0,82,139,65,186,233,8,12,3,32,19,193,121,139,186,148,
+19,48,18,29,130,248,176,58,142,195,3,48,56,11,208,155,21,43,56,32,43,23,210,136,59,186,181,1,115,138,18,173,
+152,32,13,18,128,144,133,161,144,143,160,210,89,56,136,1,177,226,57,139,17,168,132,20,0,74,175,194,145,42,88,129,
+20,242,136,42,153,16,17,129,67,131,26,223,129,152,60,130,145,4,195,11,12,137,1,2,130,135,34,141,216,24,41,141,
+131,133,128,165,8,154,11,2,145,32,54,18,43,191,136,24,142,6,137,17,148,28,137,192,1,17,0,32,122,0,189,1,
+138,170,150,130,40,129,58,240,160,132,171,49,73,57,135,160,154,179,242,16,58,33,56,176,214,136,32,31,8,8,33,18,
+13,41,219,9,24,9,67,72,195,195,73,26,141,17,185,20,17,25,233,41,153,250,16,16,25,23,138,26,144,160,164,2,
+33,99,136,193,42,25,220,0,129,40,67,45,154,163,12,130,155,122,146,144,34,30,136,216,129,40,152,114,144,144,131,155,
+9,47,137,160,22,3,159,2,152,12,194,129,65,128,16,122,152,40,152,177,19,131,148,253,17,10,186,179,104,25,160,49,
+202,2,131,190,66,195,40,1,176,120,168,155,161,73,144,11,23,217,40,130,25,131,176,65,9,73,39,158,16,209,40,145,
+161,50,201,136,162,2,165,172,83,200,24,48,10,155,242,64,200,16,34,191,33,194,137,18,0,24,149,8,128,201,135,139,
+80,168,40,33,12,136,154,25,168,121,4,173,1,182,8,129,129,152,3,74,145,232,80,155,26,17,41,169,83,203,146,40,
+208,171,71,171,10,22,169,16,33,138,134,8,17,12,2,138,58,3,15,146,72,169,10,177,162,74,121,185,155,71,140,129,
+32,160,1,163,139,89,155,199,152,120,137,136,16,169,2,200,65,169,74,165,156,81,136,177,66,11,1,227,1,145,28,166,
+137,40,139,147,152,168,135,58,11,32,10,230,152,49,137,136,7,152,17,160,209,2,27,33,15,144,178,8,26,192,88,144,
+177,23,152,132,55,10,66,0,190,20,128,73,129,0,16,176,139,160,184,39,142,147,161,144,144,186,122,136,128,182,147,129,
+175,50,203,50,24,17,0,57,186,253,147,32,185,72,180,32,185,136,12,137,19,35,150,51,239,32,178,8,34,130,29,135,
+136,152,10,16,251,48,146,138,149,160,176,80,137,185,98,152,184,96,8,184,146,18,192,48,147,243,144,120,153,44,128,162,
+40,133,136,17,168,153,226,58,166,47,146,129,25,24,192,16,145,8,208,18,210,13,32,157,17,129,0,147,129,143,193,57,
+224,128,21,9,40,1,176,160,21,203,50,62,197,9,128,160,0,65,154,2,176,166,129,142,130,172,21,152,130,4,136,43,
+0,47,10,40,195,47,40,169,178,180,242,162,19,139,179,176,167,153,37,155,131,33,165,211,32,194,76,176,2,138,82,171,
+211,145,146,8,26,16,46,166,128,152,72,184,211,167,20,76,136,202,136,163,88,11,73,25,0,2,45,171,160,196,151,17,
+40,30,24,138,24,161,196,8,74,162,74,8,128,156,18,158,149,0,145,161,0,209,33,216,18,41,61,129,153,73,153,208,
+3,154,19,241,149,40,28,24,184,160,37,145,137,17,250,153,98,170,32,17,209,2,80,154,48,136,152,167,139,162,43,131,
+162,145,89,99,141,74,136,169,128,149,96,193,184,17,14,57,64,176,72,153,169,130,56,56,44,169,0,55,189,31,8,184,
+52,129,9,17,143,168,51,40,130,106,27,72,12,234,129,41,75,132,184,3,138,218,104,129,128,146,42,2,32,204,45,137,
+18,35,26,137,249,202,73,144,20,24,170,128,151,64,171,8,161,147,80,130,44,185,41,160,71,128,91,140,194,34,129,224,
+152,56,12,149,128,144,138,144,49,122,144,24,218,74,148,24,232,33,30,40,24,144,144,160,128,76,1,226,146,168,145,66,
+128,200,30,73,26,3,9,208,131,28,33,57,178,26,156,136,113,73,232,43,136,147,5,200,129,169,161,73,6,10,40,138,
+58,50,50,195,255,0,195,64,8,170,25,144,132,33,179,75,14,130,8,121,1,218,136,49,57,146,218,169,72,128,35,218,
+192,1,27,35,9,80,148,207,146,4,41,128,156,16,25,18,146,241,161,16,1,62,152,160,131,175,163,20,41,145,12,90,
+58,42,35,143,168,34,160,91,165,5,71,0,130,147,245,169,1,16,33,209,155,32,72,154,7,155,163,24,163,136,75,150,
+243,153,33,2,92,161,153,42,147,24,6,170,192,36,137,130,30,2,145,252,32,8,8,3,204,41,132,26,56,9,29,17,
+24,43,185,37,24,207,59,18,0,17,228,186,81,42,25,16,142,145,18,130,43,16,151,241,25,129,129,72,184,139,0,3,
+74,193,136,243,32,24,169,105,149,153,12,131,74,129,161,203,145,1,132,17,200,145,156,108,130,92,33,203,11,150,128,33,
+178,43,42,153,100,25,25,176,139,0,2,9,186,199,14,178,147,112,138,129,28,25,105,9,146,168,195,0,130,50,153,242,
+28,9,125,136,8,136,177,42,149,8,32,227,26,17,25,24,145,31,178,152,6,177,32,200,227,0,130,0,44,76,9,25,
+17,161,173,17,140,180,35,24,43,31,137,3,61,96,138,1,153,144,82,8,203,24,25,137,112,32,16,130,154,136,203,177,
+97,143,19,184,34,176,160,31,137,217,130,151,0,26,165,177,194,162,1,56,168,42,244,129,73,171,97,152,169,5,136,8,
+144,130,243,17,10,128,88,138,0,72,30,33,31,8,176,40,147,12,105,136,8,16,168,35,142,2,58,156,40,152,121,169,
+16,187,135,25,144,34,249,129,33,169,40,3,196,195,20,74,144,24,195,137,243,128,176,80,170,180,57,146,15,40,152,176,
+151,17,59,61,161,58,160,105,27,1,29,145,154,132,77,153,17,186,164,16,0,9,73,216,243,4,10,19,26,226,49,141,
+18,30,40,169,162,18,208,16,137,179,25,146,20,63,29,136,16,9,57,58,240,49,242,40,144,42,9,18,12,41,1,216,
+16,147,160,212,5,41,128,121,169,131,12,132,44,24,194,192,34,248,24,128,136,8,131,122,43,137,41,176,129,243,89,154,
+32,248,32,40,139,64,162,10,105,136,169,164,163,152,34,79,169,24,8,56,217,51,208,185,151,193,2,32,212,40,145,128,
+41,186,199,129,160,129,129,154,50,156,123,41,59,144,121,28,136,2,140,72,128,41,2,91,138,17,78,24,40,13,145,152,
+166,57,140,2,241,33,25,171,1,26,169,6,131,192,2,224,195,131,208,48,155,1,18,217,3,58,175,130,147,224,4,169,
+48,25,129,146,47,25,25,166,25,144,169,21,95,11,69,0,185,115,44,168,106,9,40,61,152,136,144,125,169,2,137,178,
+104,138,33,152,32,58,240,48,232,2,42,177,89,160,0,155,129,46,208,80,153,34,10,164,2,179,65,153,8,146,228,88,
+185,33,15,161,41,138,40,11,146,66,225,120,154,18,27,177,64,153,33,42,232,17,248,58,200,35,46,128,16,144,17,25,
+160,195,243,106,184,51,138,144,136,27,29,145,136,149,181,89,168,67,140,2,170,130,41,74,128,48,251,107,169,48,139,162,
+48,139,35,50,160,6,224,46,193,49,12,164,24,162,43,144,138,10,165,47,177,120,168,132,128,129,16,137,132,9,72,47,
+178,89,154,1,140,146,43,0,168,57,154,79,178,121,152,129,42,1,59,26,211,41,4,143,179,90,154,132,11,162,24,137,
+104,153,19,30,181,90,192,131,25,0,27,129,32,168,146,175,165,60,192,19,12,1,25,0,81,45,0,141,163,8,179,4,
+26,146,8,169,65,47,169,155,166,57,177,65,138,4,200,131,43,25,34,239,134,26,162,130,177,146,152,178,89,10,65,172,
+167,16,178,19,168,194,136,242,56,152,19,248,146,60,241,32,153,1,11,146,2,24,33,240,34,143,148,25,144,131,138,4,
+10,161,155,242,43,29,164,24,165,17,24,161,34,248,17,233,2,26,146,32,233,19,14,145,42,169,130,176,21,44,167,16,
+129,41,27,184,33,232,34,210,89,155,146,9,153,105,232,32,144,17,129,163,57,237,151,25,0,25,1,8,136,181,43,243,
+41,184,149,40,137,35,184,132,128,208,145,168,26,201,39,25,138,194,57,202,176,183,129,130,93,193,18,25,137,40,184,0,
+176,151,24,194,123,232,2,137,128,136,16,17,169,135,24,128,41,240,2,43,136,48,0,248,130,155,130,218,16,242,19,27,
+33,48,76,129,153,129,201,2,29,198,33,154,146,29,136,26,200,129,56,149,42,244,34,153,33,11,40,1,178,112,145,144,
+26,243,41,218,33,137,129,16,0,48,171,98,174,41,64,140,50,136,8,136,229,25,168,72,203,161,121,8,58,74,160,128,
+162,48,158,66,218,130,120,43,42,1,26,8,136,45,200,24,161,24,127,9,41,9,129,8,56,42,184,96,242,25,107,136,
+9,16,136,10,33,9,136,76,11,90,31,129,160,72,24,154,247,241,66,0,112,44,136,8,161,42,63,16,170,3,34,169,
+112,28,130,168,131,78,61,8,193,1,0,41,27,0,170,130,89,31,62,144,162,1,24,58,28,168,131,141,19,44,31,147,
+193,128,80,12,17,155,5,155,1,154,92,152,164,48,8,92,136,144,33,200,122,168,25,145,212,32,25,44,178,8,2,27,
+74,249,24,182,146,1,24,42,129,137,112,12,136,145,186,135,177,33,154,3,59,153,122,11,24,240,152,163,181,72,178,34,
+25,210,122,128,59,212,8,180,129,136,2,138,146,160,161,90,15,210,136,132,9,40,129,176,132,193,81,12,9,211,169,51,
+26,30,16,168,129,196,48,136,137,167,186,7,25,27,147,26,145,148,57,138,251,151,169,148,32,11,18,184,32,17,29,177,
+160,167,187,23,25,153,132,160,0,1,46,211,144,132,216,34,25,156,19,192,128,34,11,164,186,134,204,35,41,171,21,138,
+17,0,45,135,154,5,171,19,56,14,1,178,8,128,138,165,249,35,188,50,75,138,18,184,2,73,142,167,160,19,217,48,
+42,169,56,136,169,49,139,151,209,65,218,64,9,152,19,153,131,25,156,22,251,49,185,57,8,193,18,0,136,1,243,33,
+186,99,204,80,137,145,0,128,57,136,154,105,211,73,200,48,43,196,57,144,160,152,37,46,177,89,208,40,128,194,56,144,
+16,240,161,64,162,77,144,75,161,162,25,32,43,11,132,184,148,79,153,75,160,162,90,0,43,184,210,33,4,63,0,10,
+3,1,60,19,241,154,24,13,130,29,193,168,212,1,27,146,41,185,164,107,48,13,163,44,131,40,43,19,11,129,49,93,
+48,89,3,28,3,2,138,50,175,136,215,160,131,42,57,173,148,145,187,20,12,184,131,9,3,129,7,186,21,56,204,83,
+170,162,0,11,39,171,36,204,1,16,171,17,168,146,57,185,36,27,55,236,33,0,217,50,201,49,138,169,23,188,35,234,
+146,40,208,16,128,9,40,193,5,152,84,186,129,80,185,49,137,64,26,157,38,187,82,154,146,41,210,41,162,40,61,129,
+88,208,104,185,17,136,161,40,210,49,154,161,32,245,58,177,27,0,162,43,145,112,26,160,130,182,91,176,74,136,211,64,
+160,74,185,26,56,192,30,179,152,160,134,11,5,137,131,131,41,164,107,243,69,255,77,0,42,145,144,40,129,9,168,202,
+120,192,26,162,76,152,33,178,21,147,106,1,29,130,44,129,15,17,152,146,161,178,12,160,173,135,154,133,153,35,0,90,
+0,138,145,24,185,164,10,131,191,82,169,61,193,161,176,33,168,133,42,35,10,65,23,30,32,42,154,48,188,182,9,149,
+29,144,18,141,33,138,144,59,9,7,27,36,11,3,131,218,148,160,160,48,159,131,44,18,159,0,129,185,148,145,137,57,
+0,55,169,39,153,57,74,138,130,129,155,89,210,19,143,33,158,145,0,168,56,24,169,88,147,121,137,96,170,16,24,193,
+74,24,26,170,128,57,190,34,236,32,8,0,123,17,9,8,34,91,12,73,168,184,23,136,9,144,24,11,141,41,186,121,
+185,2,133,17,162,21,217,57,177,78,144,58,178,130,32,160,31,209,25,201,130,58,24,112,160,2,49,26,138,135,216,18,
+25,89,8,26,179,171,19,159,10,42,140,163,25,165,150,2,194,176,66,156,64,59,154,123,145,11,166,8,176,177,90,136,
+45,129,8,1,49,45,164,76,209,144,2,128,74,64,14,0,41,137,25,45,160,144,0,18,184,99,160,129,120,153,72,10,
+144,29,122,152,8,130,168,138,88,171,33,138,148,91,62,1,152,2,129,137,53,168,164,76,147,15,105,136,25,40,184,137,
+16,168,17,15,2,154,46,3,156,0,164,192,40,145,129,45,148,154,90,150,10,33,184,60,43,178,98,141,19,170,43,133,
+152,29,50,142,8,164,0,59,56,172,90,164,0,0,0,30,195,129,131,13,1,2,159,132,144,168,34,216,161,129,2,14,
+165,40,11,3,10,50,216,16,2,42,120,228,130,1,11,2,129,31,128,144,185,65,217,163,129,25,143,183,16,128,136,153,
+5,12,17,168,162,50,221,149,40,153,1,225,146,24,144,144,150,26,161,180,144,134,177,152,2,10,57,215,131,59,160,33,
+176,138,131,200,243,3,216,164,132,27,138,135,11,1,129,141,34,137,136,144,148,24,241,3,26,152,40,215,128,88,160,136,
+20,170,162,67,13,17,42,241,16,144,16,184,50,249,196,56,9,152,56,144,172,120,8,139,49,233,145,105,192,146,1,168,
+16,75,144,58,58,90,26,78,128,211,41,2,142,16,129,12,48,9,44,107,137,130,58,154,176,244,64,0,74,153,49,209,
+64,178,5,31,130,193,41,145,201,32,130,201,88,192,129,58,184,18,43,240,105,153,19,0,136,132,164,45,165,146,137,2,
+140,144,19,155,122,216,1,44,193,72,138,25,10,148,56,58,61,177,50,30,128,17,14,17,142,130,16,144,63,177,129,139,
+132,59,8,42,13,196,81,25,42,210,1,9,130,152,129,1,157,145,82,11,45,199,24,26,161,40,9,161,184,22,24,92,
+186,7,137,24,129,90,43,48,143,2,106,28,178,146,154,130,161,88,176,161,241,179,124,152,24,152,1,10,48,13,128,129,
+240,34,26,64,61,144,73,160,49,136,42,242,182,145,130,24,153,80,12,25,41,43,15,181,136,2,10,9,41,8,137,137,
+183,126,160,56,184,2,177,151,9,16,10,240,34,138,1,59,200,89,152,16,139,35,143,165,136,130,40,11,179,0,144,4,
+154,79,178,136,162,164,59,25,156,33,177,0,95,184,146,176,151,144,148,40,139,131,248,113,11,33,138,196,48,168,130,9,
+210,136,149,41,41,108,169,3,170,3,136,9,202,135,169,19,160,79,136,8,25,128,0,94,184,32,193,146,1,26,244,0,
+160,160,120,10,8,41,194,64,152,57,177,0,224,149,41,144,25,156,18,140,2,27,243,24,211,3,89,128,59,152,128,73,
+0,30,25,203,197,145,144,18,9,27,7,137,4,124,136,8,16,176,49,136,138,140,241,177,17,12,18,42,1,21,43,18,
+60,203,0,197,2,201,34,175,17,155,136,49,30,73,128,147,19,9,40,146,25,4,251,76,139,47,9,9,147,25,134,168,
+4,160,195,2,58,27,122,201,97,203,34,139,0,128,162,5,42,131,29,129,24,186,52,46,202,72,219,131,137,136,51,156,
+39,154,51,46,8,144,0,163,32,241,56,188,18,217,72,58,28,17,154,5,176,128,147,141,134,162,40,46,153,137,16,152,
+72,160,66,218,149,179,25,177,16,130,64,137,14,224,75,136,25,148,129,1,17,170,50,140,244,72,26,34,137,241,56,235,
+0,145,138,134,1,42,0,26,74,177,77,178,89,17,235,17,185,136,58,160,121,163,40,195,41,42,233,130,150,0,48,146,
+143,163,11,176,121,25,0,146,136,161,169,178,34,186,181,71,27,49,207,0,152,9,32,33,122,210,0,128,55,6,75,0,
+153,40,0,24,2,20,193,56,239,195,9,130,24,72,0,152,162,154,152,95,136,19,138,22,137,153,153,185,152,3,113,40,
+130,162,205,40,186,65,72,26,182,19,128,170,207,18,155,72,34,32,89,201,212,8,145,16,24,82,185,19,161,160,175,176,
+3,11,36,34,216,97,186,154,145,120,25,32,24,137,32,208,249,41,136,226,18,16,146,45,42,186,27,68,136,121,160,146,
+128,163,160,175,17,161,9,112,17,46,192,146,169,32,4,9,56,161,42,17,123,159,146,58,144,32,66,154,232,130,233,16,
+72,24,152,0,144,129,7,202,28,177,165,49,16,41,163,140,193,153,113,17,26,161,161,145,67,159,208,144,130,10,6,41,
+139,161,202,33,26,49,39,153,16,240,80,25,201,59,152,128,132,24,182,0,170,224,32,48,89,8,209,40,128,168,23,158,
+129,129,8,33,24,139,168,154,26,60,86,144,72,216,2,8,144,234,193,48,194,40,81,137,30,144,25,43,35,25,148,242,
+131,25,32,140,30,136,1,32,56,2,249,184,131,187,112,33,26,130,8,24,56,191,251,179,131,24,104,40,10,186,130,186,
+79,16,162,16,147,11,112,8,206,147,145,41,89,128,25,210,129,154,42,50,72,169,52,152,29,129,248,170,81,169,72,81,
+169,146,56,186,160,64,129,42,130,145,89,63,185,208,8,165,152,0,131,156,72,227,121,41,152,1,8,1,168,148,8,18,
+140,164,58,27,141,210,8,164,194,42,20,159,163,131,27,17,160,164,24,179,193,64,14,192,147,144,24,178,131,197,155,166,
+195,57,107,200,130,130,16,227,130,128,152,244,2,10,42,25,168,34,152,197,147,33,221,151,128,128,57,184,129,105,154,178,
+131,45,200,132,178,145,41,194,164,128,24,147,106,90,168,136,165,130,138,160,177,18,243,134,25,25,137,164,128,163,161,152,
+55,235,161,147,193,75,170,1,58,139,144,146,235,151,147,2,165,57,162,241,4,45,41,13,24,136,201,18,144,1,88,204,
+5,168,122,2,91,25,171,225,17,168,32,137,1,32,5,47,136,161,140,48,131,121,129,216,1,9,136,60,153,64,11,211,
+151,25,9,160,121,9,24,9,131,153,169,34,170,0,89,244,80,169,24,128,12,1,0,152,67,141,145,195,44,145,163,10,
+77,224,70,0,7,209,8,1,137,149,40,210,25,208,144,146,42,139,135,56,25,146,31,16,45,146,146,148,177,136,60,157,
+16,33,209,132,160,132,153,41,1,161,5,212,25,169,11,56,73,166,163,144,216,144,28,57,73,33,48,240,186,165,26,17,
+51,26,134,13,8,168,24,89,128,2,184,143,75,201,88,0,145,131,27,44,153,65,40,144,20,73,191,178,216,2,181,18,
+136,162,25,30,11,6,129,105,144,194,144,136,184,21,58,106,138,136,139,168,19,146,66,1,136,63,15,136,24,32,1,24,
+42,241,184,51,154,121,17,154,169,192,170,66,210,6,8,43,136,45,58,2,73,72,144,236,163,26,91,1,146,25,153,140,
+140,210,19,20,24,33,157,12,26,109,0,17,145,145,137,142,8,33,152,20,16,15,154,169,0,4,8,7,144,26,169,60,
+50,27,151,162,168,30,154,1,35,32,177,240,193,25,0,56,32,151,150,25,140,27,168,133,18,0,194,185,184,137,114,41,
+21,176,211,153,9,156,22,152,129,162,153,1,75,122,1,24,72,170,128,185,202,55,128,73,152,156,176,27,36,216,53,10,
+138,140,225,144,67,25,34,154,26,250,16,16,9,132,50,31,30,8,137,16,18,168,82,140,169,41,17,16,82,74,169,158,
+41,248,66,24,41,11,26,170,45,32,150,2,8,168,15,136,10,34,17,22,43,171,20,15,17,145,33,25,58,175,137,26,
+121,0,72,139,138,210,59,56,32,178,166,2,15,153,16,49,137,22,29,137,168,152,4,130,129,211,148,141,137,41,34,195,
+134,144,154,153,26,181,67,3,26,210,15,152,25,64,162,132,169,42,14,128,164,133,41,18,11,157,193,129,83,144,131,226,
+137,8,171,7,136,2,128,160,143,177,0,135,144,147,201,1,168,91,17,25,165,16,186,16,173,146,151,2,40,171,24,233,
+24,120,41,8,195,177,170,105,42,1,137,151,169,129,138,18,3,73,153,72,236,144,137,83,129,96,153,160,176,0,73,64,
+32,163,163,207,194,8,33,72,40,27,219,25,155,65,8,20,132,137,141,170,177,83,163,32,3,159,201,40,1,90,88,16,
+224,137,8,139,115,8,146,168,33,159,145,72,8,18,145,241,10,168,74,16,105,152,146,9,137,141,132,2,1,5,171,153,
+184,120,49,123,170,47,77,0,25,184,211,177,42,18,56,145,133,234,144,27,75,1,82,32,142,0,203,145,1,3,37,8,
+208,216,136,74,25,89,128,16,136,170,186,132,112,16,40,169,240,168,17,75,0,18,161,130,143,152,177,5,19,137,77,171,
+137,168,197,49,48,41,152,24,185,57,39,133,136,147,26,108,31,136,0,136,129,153,144,9,161,6,184,26,146,165,145,148,
+144,169,182,152,129,211,65,40,210,10,198,1,144,160,152,8,140,149,16,209,50,9,133,193,129,60,26,44,136,229,162,17,
+59,12,178,165,56,58,45,28,25,176,166,16,168,145,35,135,146,96,144,130,139,178,193,90,138,200,136,242,128,0,164,16,
+58,123,41,43,75,169,209,132,128,232,130,152,186,135,148,130,0,128,24,140,154,129,42,10,172,242,148,24,47,19,137,164,
+167,144,152,161,163,178,163,11,30,1,121,136,57,128,195,129,152,219,134,131,225,148,25,128,60,9,75,89,25,48,208,176,
+8,42,160,60,162,25,137,57,235,20,154,149,66,152,61,175,17,165,0,176,132,128,209,16,145,64,8,105,219,33,156,1,
+11,65,169,32,2,63,152,24,4,187,131,1,172,147,33,160,125,82,58,154,33,44,17,73,15,136,196,178,225,144,130,9,
+8,144,9,194,165,138,179,46,49,156,66,59,40,209,164,18,26,7,137,168,28,129,146,121,128,16,201,24,152,123,134,137,
+193,24,144,11,88,168,64,26,9,153,34,211,26,208,56,161,47,57,203,7,160,130,169,82,145,27,243,16,136,56,26,169,
+165,11,148,42,82,168,89,203,32,216,33,144,80,138,8,208,17,40,8,41,175,150,139,148,8,48,27,32,219,16,2,152,
+244,58,194,65,169,0,194,8,134,9,64,8,8,188,132,138,179,88,48,142,16,201,3,144,66,138,31,177,146,128,18,16,
+72,176,18,154,113,49,223,147,9,48,28,41,201,165,136,131,57,168,228,137,160,96,137,129,180,1,193,104,42,144,40,187,
+183,42,163,42,41,26,151,10,163,163,142,182,16,138,48,76,160,177,35,232,48,104,139,161,76,201,33,8,161,161,64,176,
+57,9,1,64,191,149,43,161,66,42,138,22,12,146,3,44,235,65,140,147,57,152,179,129,128,151,58,44,178,15,225,2,
+136,130,0,10,160,65,136,160,228,245,67,0,80,157,166,59,144,145,73,161,130,58,151,145,8,241,32,156,133,128,136,136,
+81,171,4,16,187,163,60,240,40,136,2,129,123,193,8,1,177,64,159,131,11,128,129,120,27,3,10,1,196,106,201,48,
+154,145,17,40,209,121,136,24,129,138,166,30,144,24,128,128,36,30,128,128,129,185,67,159,146,137,162,194,80,9,0,0,
+16,227,91,160,74,137,9,131,29,3,177,65,154,39,171,18,31,136,137,48,193,1,33,153,152,80,244,57,153,8,26,11,
+2,147,1,4,226,128,135,12,8,154,17,155,114,136,41,16,194,146,50,137,152,242,13,160,75,56,76,9,162,33,9,162,
+243,163,171,41,193,59,145,135,73,10,96,168,3,185,160,157,120,137,144,34,154,91,136,16,65,152,88,168,201,90,171,56,
+54,44,145,89,41,136,131,176,208,40,154,229,144,16,9,169,81,171,133,16,160,59,184,19,217,99,211,40,43,212,129,216,
+18,128,131,141,163,192,145,59,138,60,131,210,32,146,78,138,178,151,129,136,41,176,43,162,165,63,56,44,169,81,9,129,
+90,176,153,196,128,168,25,66,147,141,162,58,143,51,8,195,5,136,153,35,145,218,1,209,112,154,130,1,137,106,176,42,
+40,128,9,93,176,0,154,199,145,144,8,3,128,61,130,193,25,79,154,147,0,210,136,0,72,218,1,197,18,11,136,160,
+192,67,25,90,90,144,154,131,9,43,185,151,179,139,120,168,50,41,162,63,73,59,217,146,24,59,28,130,209,195,147,136,
+105,25,193,177,11,104,42,25,2,195,56,91,152,61,8,148,148,2,140,9,161,88,33,249,17,25,25,58,240,25,44,147,
+13,0,152,179,162,40,45,240,161,1,168,89,24,16,14,2,45,105,10,152,24,177,8,167,1,132,0,16,9,142,24,32,
+13,75,138,40,136,167,59,182,33,170,3,30,1,136,137,161,210,73,155,129,140,7,29,160,41,152,88,152,20,136,164,177,
+149,73,24,139,161,2,75,162,112,161,0,228,2,42,58,193,8,154,171,137,11,108,193,36,11,90,137,6,40,13,0,28,
+130,45,144,137,128,43,161,122,59,145,128,242,76,138,48,0,48,178,164,45,140,129,184,34,31,41,137,20,128,23,10,178,
+42,208,18,13,136,45,240,17,192,2,144,18,193,254,67,0,26,129,47,0,24,144,41,9,34,44,10,231,2,10,161,48,
+241,115,10,137,123,160,40,26,144,129,139,161,148,46,129,24,26,113,11,178,49,29,233,2,8,138,213,48,44,123,168,147,
+145,16,41,137,9,49,142,152,146,201,212,40,225,153,33,160,48,41,186,209,150,8,26,43,24,167,184,66,130,3,65,16,
+17,215,144,211,1,24,185,32,11,130,16,184,82,195,112,136,170,25,229,129,136,64,153,136,147,55,141,1,41,148,140,144,
+146,224,59,137,21,11,128,2,224,56,96,170,188,48,130,155,0,7,160,184,41,21,30,72,1,158,24,17,160,153,135,0,
+153,91,144,145,74,1,141,9,146,132,12,132,0,204,72,129,128,66,8,156,153,20,145,40,33,135,158,72,137,144,33,148,
+138,171,56,137,24,23,197,138,17,10,153,23,8,153,141,40,136,145,51,243,168,128,25,61,34,41,129,175,8,33,26,84,
+154,168,161,138,121,148,41,1,205,10,50,123,8,128,171,180,128,132,130,50,41,248,12,40,18,1,57,30,172,56,179,72,
+243,18,156,169,89,18,0,128,0,143,24,42,130,2,192,155,240,48,8,197,129,1,15,0,32,10,130,128,177,12,104,57,
+180,25,243,153,129,81,42,8,9,232,153,33,80,155,48,218,145,1,130,120,144,65,232,152,80,24,9,41,169,201,132,129,
+48,27,32,249,172,49,4,168,80,12,138,3,106,152,32,9,128,175,49,130,225,50,15,9,56,136,42,194,65,184,44,92,
+24,176,165,144,168,34,56,45,41,161,229,168,89,24,26,177,0,241,130,0,129,16,57,17,175,56,89,10,16,176,137,146,
+90,40,32,142,180,155,88,148,90,27,59,171,180,132,153,150,137,51,159,176,134,129,137,178,40,58,10,193,5,145,64,248,
+137,34,147,186,179,40,31,147,152,134,153,50,233,12,89,1,170,18,128,140,4,144,18,211,24,135,141,90,129,137,8,146,
+170,35,138,145,17,143,135,170,106,16,152,59,160,144,128,81,11,56,10,82,190,8,20,145,30,1,168,9,148,57,9,88,
+136,241,168,21,152,9,16,178,138,7,137,32,9,123,218,128,32,129,169,130,120,154,131,137,17,20,138,40,191,123,2,152,
+26,17,10,128,139,27,39,240,19,15,25,33,192,41,160,129,183,252,73,0,136,41,61,131,232,35,203,29,20,137,152,40,
+146,75,161,123,16,170,36,217,12,81,128,138,8,1,136,168,41,120,10,25,229,138,80,129,184,32,32,10,146,162,80,42,
+59,216,140,92,5,184,41,9,169,162,150,169,53,137,56,191,32,34,194,30,1,26,58,8,188,7,161,145,154,139,55,153,
+153,1,146,91,32,31,32,136,128,203,26,23,128,153,1,201,49,209,58,42,88,169,157,74,20,0,26,185,138,7,145,160,
+83,28,146,173,80,24,128,129,155,187,23,241,17,145,16,154,169,88,0,8,8,170,47,17,184,132,195,0,155,155,115,1,
+57,248,129,26,19,45,19,154,180,218,10,22,24,24,136,250,0,144,73,1,9,163,173,29,133,1,88,138,169,148,145,40,
+2,184,68,174,25,3,129,120,154,155,56,208,49,166,24,144,201,26,20,9,20,128,143,24,141,131,18,184,19,249,137,129,
+146,164,150,136,8,27,74,1,8,33,186,171,91,19,42,151,130,242,43,144,61,8,32,168,224,40,25,90,44,134,168,146,
+1,137,91,128,131,193,192,64,169,25,122,193,40,162,137,32,26,64,136,190,0,197,128,72,139,33,154,144,58,20,10,135,
+11,144,146,231,146,128,147,0,169,8,168,22,0,66,143,8,144,210,75,147,176,130,192,41,209,68,25,59,140,148,201,32,
+163,164,32,200,138,162,134,3,161,143,2,202,59,37,169,98,153,9,160,26,36,160,171,80,189,92,0,24,24,0,216,161,
+42,83,194,192,3,155,41,120,144,40,209,129,208,88,24,4,185,195,137,168,16,16,150,0,185,170,177,120,37,8,202,144,
+192,40,128,51,193,53,158,179,41,66,40,159,0,138,144,98,153,19,171,212,10,17,88,145,155,56,184,143,151,136,2,56,
+187,66,171,149,131,12,128,176,8,18,180,31,4,44,16,92,152,132,169,163,12,56,25,128,130,10,213,12,3,58,210,32,
+218,33,11,227,0,129,57,24,171,120,40,141,18,226,146,32,153,57,169,196,41,170,72,177,90,168,7,141,34,137,177,122,
+144,41,154,195,196,64,42,25,136,161,196,136,3,137,148,62,192,132,24,40,138,88,9,57,26,249,3,240,40,43,208,17,
+136,56,170,4,169,115,154,146,131,251,34,202,34,40,11,73,177,106,152,163,71,15,69,0,185,104,171,211,72,184,82,233,
+48,9,0,42,66,13,8,176,228,72,9,8,0,225,2,184,16,3,195,43,146,218,18,165,152,80,168,16,74,170,52,145,
+15,48,142,42,1,28,24,180,144,57,27,104,32,240,64,202,128,18,9,24,164,144,194,163,58,73,200,128,240,210,49,170,
+129,134,144,136,32,44,24,181,210,128,8,107,168,180,34,152,12,147,40,25,6,202,147,160,10,129,2,122,144,177,24,145,
+12,119,186,17,45,28,178,2,16,25,74,153,137,167,51,219,32,29,43,146,73,107,137,0,137,138,131,134,218,4,29,137,
+0,56,72,138,40,26,139,97,148,11,88,156,184,134,58,24,153,24,33,15,32,33,200,120,169,169,66,27,130,33,13,162,
+185,112,16,152,27,226,169,72,128,129,18,25,208,195,56,72,194,45,195,168,57,0,195,21,26,171,161,179,56,55,175,149,
+154,25,146,146,65,9,209,129,164,10,7,169,164,9,140,150,128,16,144,178,72,139,2,36,184,185,208,26,2,122,144,151,
+168,32,154,16,21,171,180,13,0,128,56,120,168,24,177,24,91,17,138,129,142,10,164,146,115,154,137,148,219,66,144,145,
+60,140,25,16,0,106,130,13,131,217,50,48,216,57,140,9,8,144,96,17,44,139,162,130,118,169,25,41,153,75,146,128,
+131,26,156,122,25,90,195,156,33,168,61,32,152,153,37,140,48,153,32,84,157,136,149,168,80,168,10,146,208,56,1,25,
+50,204,30,129,8,25,65,155,65,154,46,18,161,35,32,31,153,168,168,51,111,153,16,177,18,161,41,90,178,43,128,139,
+166,163,30,76,9,169,134,160,88,145,140,33,161,138,135,168,16,168,184,113,42,153,148,209,64,128,12,130,225,1,25,170,
+131,195,74,24,155,213,3,26,72,128,42,40,170,163,163,155,2,249,243,24,59,244,2,129,74,146,153,146,151,42,40,185,
+178,82,157,75,128,136,40,179,29,6,156,2,148,12,49,170,25,130,184,123,42,177,2,179,78,3,174,180,146,25,9,177,
+163,131,200,63,139,134,25,24,153,132,26,208,134,144,17,128,193,40,193,0,44,194,28,149,153,37,11,184,23,27,58,136,
+178,82,154,45,176,164,41,128,153,135,153,168,98,139,3,26,27,41,129,59,248,151,144,33,175,21,68,0,140,104,169,146,
+10,136,152,40,129,32,48,173,240,133,136,121,168,16,208,163,0,145,136,65,45,27,2,169,42,23,30,89,27,57,176,162,
+65,137,152,73,136,56,81,143,176,5,10,56,139,56,242,161,57,184,164,129,41,28,112,27,144,104,144,24,177,123,184,130,
+27,152,209,144,2,91,122,10,216,19,9,57,137,9,166,144,41,129,224,80,26,9,73,145,138,131,32,15,131,44,161,10,
+90,162,75,28,72,58,65,26,248,2,138,62,129,139,180,57,75,155,82,137,17,3,44,150,170,47,160,124,136,146,180,26,
+27,11,121,25,1,153,88,41,202,17,171,77,73,0,17,161,152,165,160,2,193,155,12,245,1,128,56,192,1,41,64,1,
+16,10,31,160,137,13,130,57,211,17,41,180,139,195,75,25,243,162,73,176,57,1,47,130,197,17,73,138,168,160,17,155,
+168,114,185,16,58,249,35,18,58,171,152,135,184,140,83,28,164,40,145,1,220,19,137,9,24,246,16,136,144,57,128,77,
+164,9,4,25,141,40,9,153,195,74,152,24,74,128,62,194,35,184,25,57,205,2,179,72,138,166,144,144,17,151,160,176,
+57,241,8,163,240,33,40,16,176,150,35,171,26,224,10,145,95,160,3,137,179,123,9,73,160,24,137,203,72,40,45,164,
+59,129,25,13,148,144,106,139,145,9,128,125,136,16,9,8,45,18,153,106,137,176,32,235,36,9,194,130,9,24,8,131,
+175,5,170,130,11,133,80,154,146,128,27,134,128,11,169,132,250,72,128,64,144,181,129,43,32,146,157,144,1,189,72,148,
+145,64,242,144,136,48,32,11,184,163,252,106,0,136,128,130,155,90,4,168,8,169,198,138,72,40,144,178,130,145,46,52,
+161,15,130,193,156,65,57,26,129,58,184,31,50,152,13,24,210,187,84,8,24,145,18,153,138,87,137,155,89,192,43,8,
+4,169,4,136,187,41,23,8,155,32,214,42,73,9,137,161,2,240,89,1,8,170,49,218,145,57,18,152,12,151,153,56,
+96,152,10,146,155,210,123,16,144,168,135,153,89,25,152,42,9,152,249,35,80,9,137,180,162,24,112,137,12,24,9,169,
+0,52,218,147,146,169,65,134,210,144,128,59,13,0,4,138,26,130,251,19,2,161,142,208,4,185,48,130,69,250,71,0,
+136,57,179,153,135,114,200,144,168,164,12,131,34,184,88,160,153,42,66,141,209,105,176,26,132,148,137,2,145,162,32,132,
+8,237,65,170,137,72,162,60,128,26,168,98,136,163,173,67,202,168,35,211,16,137,129,153,135,89,152,203,4,152,136,72,
+136,146,60,176,166,2,89,42,11,242,128,24,161,16,4,185,177,145,197,153,166,76,162,170,7,128,43,0,136,131,25,178,
+212,161,96,139,146,152,183,160,35,142,146,48,154,129,192,99,170,0,64,12,144,168,196,136,20,26,136,141,183,145,1,73,
+138,49,10,145,138,198,18,28,77,145,184,5,136,27,2,200,163,25,12,196,147,45,1,186,83,130,29,1,161,132,18,29,
+160,243,56,169,1,137,149,153,73,11,176,83,43,89,187,133,128,43,75,232,132,169,19,201,19,0,160,47,176,163,48,41,
+30,72,154,177,112,170,5,209,57,9,144,34,161,40,148,138,192,107,13,136,211,136,1,137,112,8,8,16,144,164,134,25,
+74,172,2,185,17,24,129,144,155,123,136,132,0,40,47,137,199,144,40,10,32,248,64,154,161,4,144,62,144,176,179,20,
+185,5,26,152,112,200,65,184,25,19,140,16,178,26,19,15,226,130,26,25,241,146,40,152,42,150,48,11,18,27,149,108,
+25,169,146,176,18,200,41,181,140,16,34,216,35,17,15,1,185,162,17,175,20,200,16,2,143,17,195,26,48,154,32,0,
+13,130,27,160,55,155,120,242,8,1,137,18,136,41,18,31,153,211,8,24,59,43,210,227,148,0,56,208,56,42,161,42,
+21,14,32,137,78,145,153,149,176,57,16,201,131,213,0,16,25,138,161,171,114,153,58,33,157,16,180,11,21,185,131,146,
+16,198,144,225,18,24,62,200,18,128,73,137,194,145,128,92,10,210,162,32,13,19,170,147,32,196,65,200,4,44,160,128,
+165,169,50,216,107,146,139,147,193,161,96,139,33,242,136,2,160,16,25,42,179,81,188,147,195,178,90,61,211,177,132,137,
+128,129,75,25,16,144,179,175,112,168,32,128,196,145,165,56,75,169,152,212,138,36,28,25,145,8,120,171,20,2,145,44,
+185,184,16,210,157,39,10,25,73,168,19,179,203,176,138,47,49,136,20,177,175,52,25,149,241,144,136,45,56,145,48,10,
+90,15,74,0,169,178,39,57,204,1,185,27,2,134,64,9,172,33,90,17,17,159,152,177,146,114,177,17,172,24,48,130,
+34,229,10,45,145,132,131,139,201,42,130,21,154,49,190,153,96,9,65,200,8,138,130,65,195,92,144,139,24,131,137,51,
+158,137,81,26,19,200,148,234,24,24,148,128,177,45,0,16,130,161,113,188,144,51,59,184,1,207,21,152,129,40,153,162,
+76,42,51,200,3,45,160,195,34,29,120,168,29,74,160,163,147,188,80,9,136,145,3,89,235,161,36,136,40,241,168,65,
+26,184,133,24,192,152,35,9,73,186,44,163,197,145,130,40,178,159,121,0,137,130,27,41,8,243,24,147,162,15,26,1,
+35,232,2,137,148,89,138,129,17,189,10,23,25,136,153,210,50,234,33,26,129,240,136,51,27,40,235,64,8,1,156,148,
+80,217,25,32,24,8,145,172,3,146,200,122,195,163,14,40,32,192,56,184,160,135,161,0,106,136,203,57,150,128,136,168,
+64,0,8,17,194,120,171,177,21,8,177,11,194,112,26,144,40,144,240,152,64,9,1,152,10,72,195,41,181,4,250,128,
+122,128,136,145,136,9,132,152,160,34,179,207,2,1,129,16,220,147,16,33,45,178,51,223,16,130,1,139,165,153,89,9,
+10,36,40,251,161,67,42,153,144,26,121,177,145,161,82,240,9,74,129,9,24,156,129,133,24,12,2,167,27,42,0,180,
+41,9,218,20,48,140,56,56,250,186,23,26,137,163,27,89,128,136,145,80,192,155,121,146,0,137,184,8,49,149,141,1,
+50,159,152,7,8,24,160,10,58,17,168,132,128,243,11,123,16,184,131,155,12,149,0,57,0,96,159,145,150,32,140,146,
+9,74,128,161,16,2,225,155,80,136,179,74,184,155,20,65,154,64,88,188,153,37,25,193,49,155,141,149,3,13,163,1,
+172,107,129,17,153,132,10,30,0,146,17,0,197,171,89,129,1,29,163,138,139,32,17,97,60,194,138,137,4,144,62,160,
+131,44,146,25,130,66,43,15,28,161,145,75,0,155,108,162,1,184,135,10,8,25,42,196,32,9,12,49,106,144,141,193,
+18,59,34,47,193,3,128,57,169,148,9,137,73,194,138,5,120,157,18,153,24,59,210,147,137,49,171,18,129,134,207,3,
+41,25,48,243,158,4,72,0,129,0,57,155,225,162,177,77,137,129,241,48,0,10,128,150,137,24,27,166,56,8,168,161,
+97,25,232,11,19,169,16,83,203,51,144,0,12,148,145,121,75,145,242,25,49,172,130,0,152,46,145,129,137,121,139,145,
+33,134,11,202,132,128,56,3,240,16,8,58,155,25,242,41,26,107,185,160,54,11,153,133,161,73,10,244,16,128,136,145,
+33,9,25,207,19,49,137,89,156,1,162,176,210,129,147,67,76,25,148,243,105,155,33,170,2,25,168,148,193,48,27,146,
+193,4,15,177,130,3,46,25,177,129,32,28,197,41,192,58,128,163,34,185,108,192,73,17,24,187,184,243,131,120,137,161,
+144,128,1,18,10,33,223,16,138,18,17,171,163,108,88,145,134,41,169,0,42,48,43,244,144,137,136,24,164,92,152,219,
+130,34,90,8,14,146,128,128,131,42,57,241,12,57,33,43,217,162,98,28,25,163,200,163,76,0,25,193,2,28,36,13,
+179,163,178,0,143,129,152,34,31,185,3,167,16,128,37,12,184,150,0,24,136,8,13,129,31,32,194,130,176,146,72,143,
+150,152,145,48,154,40,155,17,216,16,209,17,32,23,143,137,22,139,146,90,136,136,42,42,130,97,144,144,147,213,58,188,
+166,128,178,129,153,18,140,18,137,142,139,16,21,153,90,144,135,29,136,65,2,152,169,138,16,132,161,23,1,193,28,186,
+39,8,144,169,155,40,1,72,24,177,248,13,32,19,121,153,137,140,128,37,144,129,177,188,0,23,2,57,155,250,44,1,
+20,168,144,169,137,107,133,144,57,185,236,32,50,193,57,185,137,146,53,41,168,65,251,158,35,18,154,0,8,232,97,161,
+26,136,148,173,56,32,161,137,32,235,16,36,184,193,112,216,9,34,1,138,130,136,138,58,23,154,146,22,158,128,50,193,
+43,163,169,24,37,140,1,16,229,11,56,3,169,128,75,240,57,2,10,8,66,219,168,72,65,10,194,2,140,21,32,216,
+43,20,235,152,35,137,0,137,216,59,146,132,203,134,105,201,136,5,8,9,130,170,32,41,161,58,32,39,159,8,40,179,
+11,165,155,8,53,188,18,32,134,142,26,2,0,129,13,193,0,5,10,25,50,212,155,27,4,132,24,12,160,5,40,209,
+137,22,152,140,41,0,132,26,232,21,71,0,155,139,150,64,156,133,26,133,143,0,1,129,24,138,9,10,5,10,130,65,
+178,142,46,131,160,1,169,169,113,152,129,57,0,132,191,74,1,147,27,178,159,51,136,136,32,162,135,159,42,3,146,32,
+153,137,104,2,172,0,19,20,175,170,135,129,24,138,153,32,17,153,186,71,42,142,153,5,17,168,161,10,72,106,176,8,
+163,21,158,8,0,16,136,200,152,24,99,152,137,40,133,249,160,96,41,57,201,136,8,4,144,25,60,8,213,137,48,1,
+195,33,158,17,146,225,1,41,74,129,143,41,165,128,0,155,152,37,169,73,136,41,19,159,26,134,128,152,195,138,36,58,
+186,4,136,114,234,137,34,0,10,193,137,16,5,138,1,46,48,225,201,112,8,152,145,161,25,148,128,26,17,91,166,140,
+40,18,160,50,174,153,35,18,12,161,88,2,175,27,134,128,8,193,184,81,0,153,146,2,97,219,137,51,25,59,181,140,
+56,130,192,19,138,93,217,160,64,136,48,162,141,11,135,152,33,9,128,130,159,74,128,19,1,249,10,130,8,1,4,153,
+7,143,8,18,128,24,200,128,24,161,72,148,42,1,250,186,99,9,8,147,138,30,144,33,34,193,24,228,155,89,32,136,
+20,153,202,144,160,105,130,24,49,250,157,19,25,73,2,186,41,169,219,83,3,24,56,173,184,24,140,112,48,9,24,209,
+10,74,165,24,4,176,186,27,180,136,97,2,136,177,25,236,33,128,162,169,180,168,133,169,85,8,170,2,171,131,116,169,
+122,9,9,24,168,25,40,159,106,137,136,147,129,10,122,168,56,163,56,26,165,137,176,164,24,1,175,210,163,164,81,193,
+25,34,209,41,178,0,9,25,77,26,32,128,80,139,90,153,169,123,225,32,136,128,25,18,28,152,160,25,31,163,3,181,
+17,45,149,10,10,90,155,179,138,75,1,160,133,217,209,50,152,10,134,0,91,27,169,37,18,10,216,208,8,25,8,148,
+20,155,58,180,17,52,176,159,72,43,130,48,16,73,250,168,17,146,89,197,140,24,0,168,36,74,155,128,170,68,33,144,
+147,207,144,1,181,128,161,216,136,51,43,134,24,140,43,169,135,129,9,58,240,144,81,9,25,32,240,137,3,8,75,74,
+27,138,57,48,123,32,168,227,42,35,2,47,135,15,65,0,24,210,25,2,168,42,151,200,154,50,144,224,161,3,217,164,
+1,18,233,65,185,73,128,162,108,27,25,144,130,25,43,84,27,31,142,20,152,9,16,152,73,79,192,163,8,163,44,8,
+0,58,17,30,8,9,6,31,163,40,26,26,129,225,194,33,196,136,17,144,73,172,36,139,160,48,243,48,27,179,4,137,
+10,170,127,200,56,137,177,177,132,170,128,241,35,27,144,20,168,178,90,146,44,58,25,29,20,40,45,148,9,19,217,67,
+43,32,31,160,11,148,136,153,98,16,186,16,41,63,177,112,171,194,146,8,43,5,60,16,153,43,64,217,131,73,244,1,
+26,10,162,18,153,82,163,8,208,211,56,203,21,14,128,144,144,26,33,27,80,160,139,106,10,179,112,226,129,25,144,138,
+129,8,22,9,27,145,187,22,43,134,160,210,42,154,1,49,124,8,25,42,185,151,137,5,16,170,32,25,14,0,56,3,
+131,1,33,175,242,120,137,8,152,194,8,8,187,68,25,136,147,139,184,9,135,34,89,43,156,153,11,96,129,48,176,198,
+130,159,33,9,2,88,157,8,0,11,72,8,40,129,202,178,122,8,16,147,4,141,152,178,5,58,105,16,28,179,169,164,
+160,41,7,136,46,153,138,1,43,144,134,32,250,132,153,57,35,177,137,76,142,164,177,16,18,128,10,0,217,18,28,48,
+90,56,175,24,234,18,8,9,35,15,148,144,130,107,136,1,1,43,153,242,17,11,149,9,65,153,58,28,28,185,23,26,
+10,168,193,163,46,130,121,136,128,40,176,153,57,148,114,140,128,8,27,75,29,132,136,194,17,170,148,215,130,1,154,146,
+144,40,251,35,28,40,16,9,155,165,2,114,26,144,180,0,10,47,42,153,145,18,60,10,208,24,74,3,192,138,96,143,
+162,40,145,5,8,43,152,11,113,42,74,160,136,158,17,171,51,17,214,16,8,186,3,76,58,179,150,11,47,152,1,25,
+2,0,61,90,153,16,120,57,43,162,142,146,177,169,96,25,26,146,139,162,72,45,129,167,136,73,187,18,64,171,137,33,
+25,88,195,1,242,150,128,59,9,154,160,0,186,64,148,59,241,52,45,42,137,144,35,140,161,112,12,137,65,138,133,0,
+32,40,225,144,32,11,29,179,184,224,129,184,50,187,151,18,208,254,66,0,10,147,74,122,24,209,33,137,15,130,27,194,
+34,26,94,9,138,17,177,146,50,157,210,150,27,40,43,44,128,225,130,8,136,9,23,152,193,48,139,20,160,18,128,151,
+58,155,148,24,209,24,144,75,138,203,9,123,41,10,92,216,33,0,40,145,147,203,120,10,40,128,139,66,219,225,130,209,
+1,2,128,139,18,0,78,161,212,163,129,41,204,3,136,209,19,25,15,4,152,1,19,57,144,8,250,32,208,129,25,170,
+152,115,141,17,8,138,167,152,131,10,162,123,130,42,171,60,137,146,166,129,18,28,0,202,120,160,128,80,153,171,135,153,
+58,128,8,161,24,157,135,25,24,34,203,150,56,153,32,73,186,151,8,160,120,153,128,8,193,18,41,13,56,138,147,138,
+242,129,9,25,93,129,26,192,3,138,56,8,29,163,35,204,227,33,156,32,74,155,17,152,227,35,44,228,2,168,149,41,
+193,32,26,184,56,10,1,32,146,113,136,179,132,17,140,65,92,25,73,43,45,12,170,24,30,177,57,192,132,28,17,41,
+16,115,41,41,74,138,201,162,203,161,155,194,2,17,138,121,58,152,38,43,65,60,242,160,193,163,44,0,144,41,1,58,
+121,80,25,2,26,146,5,165,178,164,32,159,193,136,153,145,90,185,8,24,89,11,151,32,0,1,59,60,169,24,14,181,
+26,26,157,16,8,0,17,167,128,211,131,33,243,19,161,209,139,28,193,40,128,177,64,147,144,23,123,1,17,152,194,121,
+138,193,56,29,160,90,139,129,48,44,147,112,13,0,24,15,33,26,184,147,184,166,12,133,168,50,24,154,16,128,138,199,
+145,56,247,56,153,24,0,182,2,58,251,128,163,24,131,173,134,144,24,176,229,0,1,1,2,209,130,8,156,5,154,196,
+16,187,134,8,8,144,40,145,164,45,148,56,11,176,57,30,194,58,24,56,79,176,56,137,176,130,0,31,51,140,130,27,
+140,18,156,115,152,128,144,145,91,128,24,42,243,129,10,242,49,29,129,56,153,132,1,154,5,9,25,4,175,182,41,154,
+163,44,145,19,58,226,130,41,241,72,129,161,58,240,129,42,209,32,9,193,65,186,49,28,152,34,60,209,34,12,227,17,
+154,3,27,182,49,29,160,90,137,163,64,201,2,45,193,40,153,148,57,152,223,240,72,0,133,57,156,166,91,152,18,154,
+131,57,250,2,13,130,16,154,151,25,8,8,136,80,136,140,131,31,161,179,74,136,25,9,150,154,134,8,41,193,73,137,
+194,90,168,1,42,166,26,163,161,75,137,1,45,208,36,140,130,75,168,89,152,149,24,185,7,10,136,162,168,133,56,233,
+80,139,160,32,154,18,41,26,133,10,211,3,204,7,40,153,42,10,136,24,141,3,74,209,4,141,164,24,185,21,42,128,
+43,192,136,72,29,130,62,179,5,10,145,1,10,154,49,226,0,146,248,108,153,145,129,161,64,137,0,57,202,32,122,208,
+32,177,144,61,128,41,161,133,88,154,0,106,187,134,136,146,136,193,8,186,164,0,56,90,34,63,130,9,184,66,8,1,
+172,198,40,203,146,195,73,40,45,128,130,26,162,74,121,137,169,132,217,16,179,153,17,19,41,167,16,136,25,29,98,204,
+131,144,26,153,212,24,146,57,25,209,64,163,29,67,8,12,146,210,56,30,176,146,210,65,138,26,148,136,8,179,40,146,
+14,129,137,157,135,200,97,9,153,2,145,24,1,9,82,137,141,166,155,24,193,74,0,25,89,176,1,177,153,121,32,203,
+23,160,57,26,209,129,162,57,176,195,5,193,47,145,136,0,161,196,72,29,128,136,161,19,156,112,136,137,130,2,29,131,
+138,2,42,157,4,251,17,144,136,57,153,194,183,64,10,144,49,136,28,135,136,136,132,153,4,201,16,177,137,152,182,47,
+1,136,24,128,177,19,28,25,217,145,5,240,56,161,28,73,161,8,133,25,42,72,15,17,201,48,9,171,165,179,59,137,
+154,163,194,120,36,171,99,137,26,150,56,42,129,185,226,194,136,147,15,17,169,1,129,152,16,24,78,10,192,149,180,26,
+167,144,16,24,10,49,62,24,42,156,64,248,0,146,153,1,162,44,145,9,129,78,43,65,173,66,128,152,135,161,40,136,
+25,137,211,9,32,191,49,170,17,4,185,37,136,8,145,168,124,178,156,150,160,74,145,145,145,0,92,59,139,65,232,25,
+3,169,17,27,184,165,136,75,123,59,0,233,104,128,8,18,162,130,212,160,128,192,42,129,175,34,160,40,74,129,74,211,
+41,193,182,41,146,14,33,10,42,148,136,89,160,17,75,202,2,227,28,18,155,177,65,203,167,218,68,0,5,11,40,89,
+187,6,192,32,180,1,1,33,12,195,0,10,161,44,16,250,57,192,145,17,194,148,209,162,148,136,91,163,250,35,153,40,
+178,147,42,195,57,43,234,120,10,14,49,155,72,58,138,146,177,128,131,218,7,176,12,7,10,34,42,128,32,10,44,44,
+14,129,241,24,163,42,9,176,32,147,137,21,185,73,4,158,125,128,26,1,176,1,25,11,211,145,137,7,140,80,136,43,
+41,153,90,10,60,169,199,1,162,11,113,136,57,56,136,24,201,164,16,140,16,203,152,22,154,33,107,28,139,35,178,130,
+25,242,80,171,20,140,162,33,202,34,10,248,4,153,130,0,188,151,90,160,130,26,210,56,27,177,56,218,3,104,211,18,
+137,195,16,214,16,27,9,16,26,216,21,11,56,74,184,48,188,147,128,167,160,176,144,212,146,160,131,14,16,89,10,56,
+168,32,31,32,138,129,128,197,56,244,3,137,179,18,58,201,36,43,153,67,192,41,181,41,169,161,168,185,143,66,12,75,
+194,56,184,8,197,177,147,163,41,142,7,42,25,24,139,134,8,8,211,9,151,153,8,164,42,42,185,152,93,10,18,177,
+147,129,231,40,0,168,34,10,73,17,208,132,193,146,11,241,35,15,0,137,0,0,201,18,160,1,178,40,31,34,16,24,
+211,40,82,140,43,209,136,224,148,138,150,128,129,147,10,133,160,146,72,187,153,41,15,197,17,25,131,10,132,32,3,168,
+20,216,134,44,236,162,136,136,56,128,35,146,163,150,43,243,105,137,128,2,218,42,169,169,99,25,2,162,13,180,145,1,
+145,162,6,146,153,207,0,155,122,128,50,41,28,145,169,33,147,144,23,162,33,251,14,128,9,20,24,152,211,42,58,139,
+5,16,59,129,178,136,255,161,56,88,1,128,41,217,152,56,107,130,168,24,160,128,157,14,161,4,88,177,152,32,154,9,
+53,73,146,200,128,0,129,160,255,178,147,88,144,128,57,187,60,20,128,146,194,138,83,90,136,15,193,130,40,145,161,24,
+157,147,67,152,180,224,25,56,1,29,31,136,149,18,160,192,145,154,131,22,9,177,177,106,56,17,217,47,138,179,5,145,
+152,136,10,40,22,43,155,200,56,48,129,240,31,41,161,36,153,201,129,9,80,147,41,12,153,3,5,1,192,32,67,0,
+251,47,57,9,19,153,249,1,9,32,130,168,25,177,149,66,2,251,75,106,9,1,152,186,162,129,88,162,145,56,152,154,
+52,90,251,47,16,145,3,176,248,129,8,128,130,136,60,137,16,121,8,242,27,24,179,5,176,208,16,24,40,3,8,13,
+0,152,48,36,183,175,146,133,0,128,169,44,41,145,65,136,152,181,130,57,5,129,254,24,48,43,32,154,158,147,146,33,
+145,185,49,76,136,129,34,249,159,48,179,132,177,232,16,24,0,2,169,42,136,164,58,66,147,255,152,5,24,1,154,13,
+32,129,73,16,138,9,56,186,51,37,240,159,56,145,131,137,218,3,65,16,149,144,153,144,129,184,52,192,255,128,19,58,
+137,200,28,33,145,65,9,137,136,34,8,120,20,252,43,64,144,130,168,172,17,49,60,146,1,26,24,193,72,36,241,159,
+129,148,0,8,202,41,56,161,16,57,12,33,73,13,5,147,251,8,83,58,8,160,15,0,129,129,137,185,32,0,161,22,
+2,252,46,73,128,128,161,217,130,18,136,144,146,43,40,176,122,66,200,143,0,132,145,162,240,1,40,136,128,129,25,58,
+26,31,32,163,239,130,3,8,144,184,45,56,145,9,57,184,3,3,155,55,135,221,130,4,25,128,152,31,0,146,128,1,
+192,128,129,160,19,135,222,129,49,26,16,10,15,16,146,8,129,225,16,144,152,34,3,255,128,49,26,0,153,140,18,132,
+58,144,177,59,129,145,37,19,255,9,96,137,129,152,156,131,133,40,0,136,42,33,136,3,7,254,129,33,43,8,9,142,
+129,147,16,129,176,42,17,200,83,33,255,145,34,26,16,26,143,0,146,0,146,153,1,2,58,130,7,223,145,132,25,130,
+9,15,128,162,33,136,9,90,137,0,49,242,141,146,150,24,16,153,91,137,178,21,128,136,24,139,56,32,248,31,24,193,
+3,129,202,16,154,162,23,136,137,144,137,65,88,205,32,57,11,20,136,138,146,218,1,7,0,128,153,25,1,34,255,129,
+8,42,132,161,128,177,176,177,151,131,57,169,25,99,16,207,163,146,89,147,152,128,144,140,64,128,128,211,25,56,50,242,
+143,163,137,96,129,137,128,194,139,178,150,178,5,145,32,25,236,59,136,184,97,1,136,18,204,145,17,240,134,18,186,7,
+205,80,82,0,168,176,43,243,129,16,130,10,128,145,159,164,41,16,3,141,88,8,156,24,161,165,92,145,24,25,1,14,
+129,26,35,57,155,37,31,177,128,40,192,160,18,40,169,113,187,134,59,226,129,1,137,89,12,0,129,162,0,4,47,193,
+129,144,130,26,25,179,29,92,9,64,14,161,165,136,128,128,137,17,225,162,2,80,31,145,152,130,24,153,25,147,249,149,
+0,16,12,179,178,128,106,10,76,9,147,147,186,167,168,182,34,128,48,28,28,42,10,16,131,20,154,23,188,161,153,136,
+113,34,160,1,250,76,139,4,24,129,16,240,10,8,169,165,133,16,209,16,170,9,25,66,59,130,1,252,194,56,168,115,
+16,9,10,208,26,88,153,33,16,128,243,47,9,8,0,132,9,24,138,29,161,36,8,123,10,136,154,137,129,135,73,160,
+161,25,185,124,0,128,24,211,136,13,42,0,34,20,176,77,137,12,2,131,128,4,27,220,25,73,154,124,1,153,160,163,
+140,19,147,128,150,146,172,61,162,106,0,144,27,128,28,160,7,168,4,60,209,9,41,177,17,64,138,139,2,172,115,121,
+137,0,195,201,1,18,43,73,195,154,146,46,42,34,210,0,0,208,43,74,212,130,50,142,24,10,152,32,50,42,60,169,
+250,26,21,11,67,184,140,152,146,75,48,32,24,72,250,141,21,160,129,18,193,169,128,138,5,65,27,45,161,174,88,0,
+128,88,144,155,168,131,81,137,131,153,3,239,24,18,57,10,5,171,137,209,3,161,7,169,1,10,15,73,24,8,34,168,
+184,73,168,161,55,8,26,169,249,153,20,128,123,0,154,155,3,0,80,130,208,182,161,218,64,2,153,0,131,235,105,42,
+8,1,152,163,161,220,32,226,147,41,56,29,154,0,33,135,57,40,176,240,152,32,18,152,133,210,217,0,76,24,16,9,
+16,178,158,9,2,182,18,146,30,136,156,17,51,208,65,43,137,156,136,6,136,162,2,251,176,2,18,59,16,8,148,213,
+141,112,8,136,32,193,152,137,49,162,211,2,137,10,15,137,35,129,25,81,14,186,162,7,25,32,10,136,241,192,88,73,
+9,0,160,168,139,112,24,176,162,17,0,143,153,4,146,1,72,124,154,176,34,148,25,24,57,240,201,33,24,25,40,152,
+225,8,43,83,62,26,73,0,42,185,181,5,233,25,32,8,144,163,32,30,30,32,128,146,160,73,161,205,193,5,24,25,
+136,136,169,72,17,124,144,144,19,211,170,80,25,144,177,133,201,29,16,2,161,8,75,64,159,168,134,17,10,42,129,187,
+137,135,34,43,59,48,241,141,40,24,147,169,194,148,202,73,33,162,192,64,50,15,139,17,81,152,9,50,219,200,147,133,
+145,156,51,160,173,76,2,131,155,75,145,27,138,132,23,202,24,148,168,12,81,88,152,153,130,201,9,56,50,243,176,65,
+160,188,26,20,135,9,41,9,8,136,130,39,170,57,212,210,152,8,97,136,154,129,147,201,90,49,160,138,50,240,9,13,
+97,194,161,24,24,10,10,72,5,171,58,104,186,232,131,35,152,171,129,150,192,0,113,128,136,57,160,184,76,40,179,229,
+144,129,8,184,99,153,163,41,25,44,142,145,23,10,168,56,137,241,1,18,128,29,8,145,139,10,114,40,225,8,144,179,
+44,88,128,154,130,149,59,15,33,2,177,27,57,11,158,165,131,161,42,91,144,235,32,20,40,157,128,1,161,184,112,3,
+170,11,183,160,61,16,35,169,187,8,50,31,73,33,226,144,16,155,219,17,38,146,153,201,34,208,8,112,0,169,64,43,
+217,44,32,2,161,154,129,213,74,28,5,26,42,16,185,174,3,51,193,176,18,13,213,8,33,0,139,32,40,141,15,32,
+3,202,163,130,168,144,32,149,37,15,0,145,154,13,7,25,153,0,128,192,129,18,210,177,52,173,131,44,74,56,184,11,
+81,10,168,4,132,233,147,32,154,203,18,99,43,46,8,184,16,240,20,9,26,32,242,144,25,16,3,209,41,153,113,30,
+24,8,193,129,130,168,209,128,83,168,24,27,1,170,210,96,16,59,137,65,141,233,48,147,178,138,146,164,156,33,67,12,
+74,160,105,141,42,72,163,184,194,19,169,136,97,179,106,10,56,155,234,48,65,25,141,0,146,242,41,128,33,154,16,74,
+202,47,40,4,169,177,123,152,136,161,134,161,152,33,8,158,41,120,41,192,8,145,162,28,32,65,153,144,34,212,15,24,
+50,138,136,137,1,160,186,23,134,152,44,163,240,192,18,72,8,44,26,129,185,88,58,163,209,128,166,193,185,19,66,160,
+154,122,26,192,8,34,131,172,255,233,74,0,0,4,248,160,48,65,152,208,129,128,136,43,67,50,203,200,134,161,250,17,
+33,8,154,59,56,93,13,17,16,160,248,131,1,186,169,38,0,155,9,18,176,139,161,119,9,11,42,146,211,154,1,6,
+128,185,133,48,157,75,32,1,171,128,21,129,249,160,164,88,137,24,8,176,171,112,2,153,42,1,149,26,204,193,132,131,
+8,9,8,177,203,92,82,44,26,16,153,160,232,152,133,35,193,178,4,14,10,106,24,0,10,16,161,128,242,185,52,42,
+0,160,176,153,46,95,16,8,9,168,35,186,213,208,146,5,168,8,40,9,154,42,115,152,8,192,131,16,248,168,1,133,
+163,136,121,154,8,26,64,16,160,9,33,121,194,219,144,147,7,136,9,25,138,75,43,98,128,176,72,176,164,248,168,19,
+33,10,137,0,12,186,125,32,72,154,137,160,149,193,216,33,19,180,8,155,64,29,43,48,36,12,155,50,181,242,153,129,
+33,149,27,26,2,63,13,32,17,152,137,2,75,192,240,176,148,19,42,26,9,8,142,32,126,128,152,152,131,145,241,152,
+2,20,137,42,60,9,139,42,114,17,138,138,165,164,224,145,59,51,194,200,40,76,10,26,89,18,160,138,11,6,196,185,
+42,34,150,11,25,16,12,72,13,132,194,176,32,33,179,250,192,147,52,42,13,24,144,152,61,73,35,172,161,147,135,168,
+235,33,18,161,153,90,24,30,10,33,35,168,251,2,195,164,186,152,21,129,144,26,107,74,140,8,50,177,232,136,133,162,
+210,184,20,48,154,44,16,8,170,91,97,137,194,144,147,19,244,154,24,50,161,138,27,106,40,15,57,34,194,170,24,135,
+161,203,9,35,5,44,26,43,9,172,48,21,176,136,152,163,23,232,145,91,33,10,168,144,41,72,31,41,149,177,160,1,
+5,192,10,137,147,121,42,42,25,27,184,0,39,177,202,183,16,17,217,186,35,82,152,169,88,160,153,28,120,1,153,136,
+17,180,180,156,24,164,19,145,61,61,42,141,2,4,8,225,161,146,133,225,184,64,72,137,137,40,16,138,13,34,177,197,
+136,129,20,232,153,24,34,0,75,11,58,144,174,194,69,160,195,184,4,64,203,144,91,33,24,171,19,43,204,18,147,23,
+154,128,9,132,24,204,168,64,114,137,154,56,0,10,71,0,11,211,160,2,22,200,24,58,131,176,159,58,16,20,9,137,
+74,15,153,16,133,145,168,3,44,132,176,143,75,48,148,152,176,49,29,29,16,133,144,184,146,146,180,201,162,108,40,40,
+192,160,128,8,29,34,19,168,249,138,7,146,202,153,97,56,26,28,128,160,192,1,3,131,187,184,23,147,1,158,249,48,
+66,42,154,59,128,248,160,5,1,177,11,32,66,185,159,60,19,129,8,137,42,173,186,23,2,180,201,162,80,153,49,205,
+106,40,129,153,169,166,162,26,131,40,182,44,11,7,33,154,30,9,42,136,1,44,178,144,19,23,59,233,44,146,135,8,
+26,28,128,144,81,176,137,155,8,19,2,147,231,25,65,11,160,0,107,1,90,185,9,193,164,57,56,133,25,188,33,193,
+9,201,56,16,22,155,65,139,138,171,55,65,141,227,129,40,0,185,11,0,112,9,136,40,241,178,33,210,64,9,58,148,
+194,18,143,17,168,164,160,168,57,27,93,145,1,3,175,34,137,164,153,193,65,0,1,44,12,24,233,2,144,166,161,24,
+33,216,0,185,64,104,128,41,219,131,225,24,57,41,24,152,193,23,10,9,31,17,162,177,8,16,77,168,145,51,12,137,
+248,4,8,154,171,18,7,9,152,129,16,154,242,22,177,147,44,152,33,249,137,129,20,73,188,1,154,147,59,33,67,10,
+44,135,145,193,232,67,25,160,137,210,57,160,10,105,128,160,232,34,16,242,152,40,89,145,152,0,24,61,185,121,146,152,
+42,163,56,193,235,89,128,18,184,76,58,28,140,129,20,0,154,133,18,152,248,59,146,133,9,137,91,138,200,16,133,8,
+152,125,24,136,184,137,56,20,27,153,1,74,208,79,128,146,152,56,44,1,232,168,18,51,138,15,0,145,202,57,48,20,
+155,0,50,150,244,11,16,4,8,168,58,192,144,46,73,129,130,31,16,161,226,26,41,56,162,192,130,162,81,15,136,150,
+128,25,8,17,208,10,138,135,17,12,144,145,11,59,25,68,168,177,35,97,48,191,162,132,33,12,9,59,169,139,177,7,
+20,157,48,144,242,128,136,104,24,8,152,161,131,15,25,32,130,11,168,64,144,2,191,242,19,128,106,138,136,9,184,49,
+19,148,9,73,105,176,41,218,2,146,150,185,145,40,15,10,28,218,71,0,120,145,32,139,179,128,3,175,194,18,51,137,
+40,156,15,152,1,72,48,10,161,163,154,167,141,243,40,2,137,9,65,14,10,145,5,129,42,180,90,129,24,158,41,27,
+5,25,152,26,44,224,40,18,168,177,19,60,35,128,248,29,57,135,139,179,128,160,41,41,5,41,218,146,92,179,0,216,
+13,1,5,153,25,136,148,59,58,23,27,178,136,241,35,153,202,60,32,1,184,149,25,25,159,0,97,161,153,146,20,16,
+240,10,28,34,130,153,73,9,140,11,150,21,152,10,248,2,129,216,136,40,125,8,9,128,161,1,138,52,131,224,9,152,
+48,129,189,153,34,112,153,74,8,203,136,132,66,130,210,0,153,114,201,26,153,19,18,160,25,179,175,9,34,114,177,185,
+131,8,96,248,11,32,65,25,144,48,192,155,16,149,34,128,159,2,1,192,173,123,129,16,209,145,24,153,75,49,65,169,
+242,16,128,9,155,154,5,37,138,25,43,172,225,50,34,139,161,11,122,9,173,152,65,98,160,129,129,248,128,2,33,40,
+157,105,9,152,176,30,74,8,148,176,148,136,185,123,33,16,138,10,51,203,178,15,11,7,144,24,161,88,141,8,64,144,
+136,162,145,2,11,191,10,7,33,155,19,44,202,178,23,129,177,26,0,90,137,159,136,20,8,160,2,73,174,130,17,195,
+162,145,64,90,42,159,160,20,24,9,56,61,172,136,3,148,179,144,42,104,25,175,192,20,32,42,25,58,203,8,36,164,
+136,42,61,16,178,254,161,49,56,152,56,184,185,31,65,129,136,41,10,90,17,241,201,90,40,32,10,136,216,136,8,38,
+24,152,169,0,48,248,156,122,41,16,9,177,193,40,19,8,57,225,162,248,96,193,152,91,8,2,137,149,152,29,26,88,
+9,1,192,16,57,211,46,161,130,8,74,26,136,249,4,128,25,162,107,169,17,128,200,216,35,128,123,8,136,168,61,40,
+161,147,179,141,48,0,249,1,16,4,31,146,192,128,56,153,17,128,97,155,25,67,140,171,11,7,16,185,7,10,139,24,
+64,163,0,167,11,90,145,249,16,40,144,40,26,211,201,4,24,11,48,195,8,24,81,128,191,165,0,32,89,9,139,168,
+24,10,122,35,216,9,177,135,152,27,73,145,16,160,162,147,29,64,172,38,120,49,76,0,58,47,25,160,144,147,156,40,
+146,136,215,18,28,26,25,168,132,18,28,32,156,151,177,43,33,9,41,227,48,11,45,58,168,3,167,56,13,41,26,0,
+155,243,89,32,59,26,227,75,1,59,24,165,137,128,11,99,137,219,225,65,137,58,0,153,32,154,41,98,136,196,194,73,
+16,9,208,137,9,197,34,25,185,56,44,78,137,18,177,139,131,130,6,194,15,41,2,45,130,73,155,152,2,42,131,131,
+250,130,194,3,178,191,161,17,33,131,178,47,44,176,40,0,7,177,180,146,130,224,30,58,130,25,18,185,232,24,144,30,
+151,0,128,56,152,48,11,175,130,80,73,26,160,171,167,128,160,19,145,243,0,1,24,190,56,58,165,48,25,217,24,192,
+179,80,8,178,131,243,2,46,233,32,73,152,32,136,185,25,129,185,39,41,160,19,155,180,72,159,74,179,1,164,132,31,
+136,152,25,151,8,0,136,26,48,250,57,73,137,32,193,211,0,152,41,2,146,209,67,46,136,9,143,131,25,57,18,219,
+128,210,128,48,132,24,75,145,11,56,189,129,122,154,38,137,169,2,205,18,24,34,25,170,124,144,128,14,16,129,153,7,
+168,128,152,11,66,210,18,24,28,40,43,249,25,89,137,0,50,248,128,152,41,19,178,20,218,88,41,136,15,128,146,48,
+0,160,204,148,202,81,145,16,42,10,129,3,223,32,136,128,149,33,137,184,249,177,38,42,42,9,128,146,227,31,128,10,
+57,149,163,24,168,27,59,132,181,121,9,56,152,209,45,41,200,51,168,180,17,15,152,16,0,3,161,74,57,24,251,44,
+57,142,6,128,152,161,168,41,2,56,25,132,33,30,32,255,145,2,26,20,10,136,145,156,130,76,57,2,177,34,0,58,
+255,40,137,146,134,26,24,171,186,4,195,82,74,24,144,160,176,174,34,144,0,135,129,136,200,155,57,32,113,24,33,142,
+161,128,240,0,128,16,5,128,145,156,45,42,56,92,18,24,185,0,216,228,24,153,17,33,41,139,0,250,92,25,17,1,
+194,193,33,128,224,233,2,24,41,40,8,162,160,15,74,9,193,35,130,8,149,136,232,153,185,131,124,18,24,153,145,12,
+73,27,56,167,130,1,45,9,220,144,41,24,120,16,144,178,224,0,136,49,129,227,131,32,55,48,70,0,75,141,13,168,
+129,34,88,42,225,194,161,1,17,42,64,145,145,121,31,136,168,128,1,17,65,138,176,151,184,24,43,33,26,51,26,210,
+111,9,184,144,9,16,49,1,147,240,152,59,92,9,50,28,48,48,138,158,240,154,24,56,52,1,145,144,253,49,12,27,
+130,134,0,65,42,152,173,200,179,16,64,1,200,133,168,140,91,24,40,2,33,25,128,137,183,252,0,25,152,84,137,16,
+153,155,58,26,179,135,243,131,130,152,8,226,169,128,73,109,0,26,8,129,11,145,58,145,151,0,0,40,25,27,207,41,
+10,8,80,132,129,128,172,16,139,225,20,17,40,49,138,8,144,255,138,8,8,37,129,40,16,238,145,0,8,18,17,74,
+2,26,25,169,255,144,24,40,50,178,194,164,155,11,73,10,7,144,33,50,42,186,221,187,180,146,81,4,17,10,227,155,
+24,153,40,114,48,26,163,153,97,248,139,144,16,40,133,17,16,162,159,43,42,60,131,33,46,148,136,147,243,157,128,24,
+58,112,42,56,41,141,10,8,10,128,151,130,150,24,147,28,15,136,43,92,16,136,17,137,75,185,144,8,121,48,193,113,
+10,0,24,152,159,129,144,91,130,56,201,17,220,2,26,144,18,186,32,7,11,49,172,61,28,136,8,21,43,3,4,10,
+160,80,250,50,153,64,128,129,145,148,15,169,153,57,225,82,9,16,184,200,27,33,58,76,66,25,210,121,152,0,216,1,
+8,144,49,128,137,88,240,60,8,136,139,36,12,132,25,0,17,184,220,107,138,0,129,148,48,177,44,45,168,11,166,122,
+136,17,137,162,59,168,174,40,131,75,164,122,0,25,185,163,137,134,73,0,24,25,229,57,8,170,154,196,8,51,16,144,
+121,161,185,42,134,169,146,131,42,135,59,41,41,143,160,14,162,72,178,1,212,163,11,16,138,72,130,47,130,40,9,163,
+233,164,139,24,17,187,71,140,130,137,178,153,0,6,26,35,123,27,3,158,151,136,152,128,185,133,1,16,76,9,0,13,
+147,153,129,144,18,5,185,166,129,154,2,191,150,26,128,51,168,146,168,130,0,144,232,242,5,153,130,58,160,149,12,165,
+59,156,33,14,150,144,146,129,153,146,136,145,65,170,83,139,7,75,137,140,152,179,185,6,17,168,2,248,129,221,74,0,
+165,24,10,64,26,130,72,144,89,185,0,240,148,153,161,138,3,105,9,17,122,138,146,185,151,128,136,73,8,144,146,129,
+73,15,144,232,18,25,144,44,132,160,152,25,65,232,18,176,166,41,0,9,131,41,195,129,59,157,170,244,146,132,185,57,
+132,26,48,13,107,136,129,181,34,26,128,187,198,216,146,168,65,10,49,209,89,25,154,47,130,8,161,2,1,194,24,227,
+168,19,26,0,29,41,46,42,88,25,46,197,24,145,160,137,4,11,16,178,116,9,25,136,11,217,164,209,129,152,133,162,
+17,153,43,146,31,19,171,122,128,147,44,147,59,211,10,150,157,33,43,10,33,43,106,177,48,153,125,161,176,131,137,44,
+112,152,8,178,80,144,46,144,186,2,129,130,16,212,75,193,58,145,106,146,184,135,9,10,49,12,43,146,56,243,59,10,
+171,90,131,137,16,151,90,161,73,144,27,1,157,21,154,24,17,145,45,144,10,197,138,6,184,33,146,139,45,176,59,180,
+17,151,57,145,216,131,9,155,97,132,27,177,153,1,159,3,251,64,8,9,16,145,106,144,145,34,9,64,244,24,137,10,
+48,176,170,182,210,19,13,132,242,16,128,10,144,130,8,34,170,36,219,133,212,0,136,10,0,3,45,0,26,10,15,1,
+210,58,147,26,10,114,26,19,155,146,176,150,165,137,3,204,129,17,233,18,75,8,138,166,181,192,66,13,9,0,144,18,
+128,48,13,128,160,227,105,138,32,146,129,89,169,136,172,16,152,154,125,128,177,149,0,74,136,128,1,4,41,224,40,186,
+138,148,162,24,182,151,16,25,25,168,139,80,158,1,0,25,177,148,138,123,152,16,43,9,195,65,51,31,136,136,44,201,
+148,129,136,110,153,130,40,0,233,4,136,130,16,153,208,10,146,90,28,25,208,21,168,16,40,8,2,235,1,137,152,90,
+161,73,8,8,63,178,193,8,32,41,62,49,15,162,161,156,25,10,165,74,16,148,2,72,75,208,147,17,163,136,130,47,
+154,208,177,75,171,147,72,89,25,195,179,32,200,33,46,41,209,2,17,146,211,129,170,31,136,0,91,128,17,155,153,184,
+89,15,1,128,135,37,139,129,32,216,28,75,0,27,160,176,165,32,59,218,34,41,131,197,179,74,40,28,79,143,167,147,
+136,25,80,0,179,90,13,10,16,57,160,128,144,6,17,29,25,31,136,148,18,9,43,170,0,64,176,241,177,165,145,129,
+8,170,4,73,45,161,151,73,184,41,210,8,16,160,72,1,137,1,59,223,4,10,128,33,170,148,74,76,9,10,134,8,
+60,160,9,160,17,106,10,0,153,25,1,16,247,56,42,26,161,163,136,47,17,192,4,154,112,186,33,26,138,61,136,165,
+2,136,18,143,17,56,141,148,136,10,162,32,216,97,8,185,130,9,162,47,181,146,145,24,43,97,27,130,177,137,151,248,
+48,25,172,131,144,26,57,63,41,58,152,132,224,4,41,27,49,219,130,169,131,228,161,16,128,15,162,16,75,1,90,29,
+16,10,179,128,148,35,159,195,178,18,137,177,64,178,7,138,40,42,241,123,152,0,24,26,153,137,5,42,138,66,139,245,
+17,8,43,26,41,29,162,163,179,18,92,74,140,165,0,192,34,139,28,128,75,41,27,2,41,143,151,0,90,26,144,17,
+193,162,17,27,46,160,76,41,208,0,136,138,97,136,146,9,32,109,168,48,26,208,148,145,24,225,128,162,8,25,74,189,
+18,2,75,178,168,57,68,15,24,128,33,181,11,6,160,43,147,58,160,244,144,160,129,137,3,63,152,243,2,136,42,96,
+154,132,10,144,130,242,49,44,44,145,138,145,177,164,18,62,12,97,155,2,10,24,163,157,33,180,58,4,153,134,2,156,
+178,147,94,9,59,45,144,24,194,162,168,167,123,25,137,130,169,146,35,139,112,44,136,161,245,1,136,8,73,59,42,136,
+168,146,145,168,123,185,21,10,128,152,16,32,147,127,24,57,186,6,13,163,144,137,17,14,162,146,42,108,152,57,144,92,
+152,163,0,170,19,41,146,120,156,4,11,242,16,24,42,92,169,18,177,153,1,9,79,90,13,146,1,152,129,26,149,0,
+128,130,40,9,105,159,32,26,46,24,8,8,137,16,184,106,232,133,42,129,24,185,162,65,77,26,0,11,33,93,184,89,
+153,160,147,136,164,145,11,166,10,57,120,248,18,40,27,57,176,211,133,144,160,146,77,42,141,130,0,12,131,59,42,24,
+76,193,181,130,1,30,129,129,13,161,4,45,129,41,10,64,13,194,40,41,27,58,136,136,25,15,148,8,91,96,201,18,
+16,140,40,162,27,14,70,0,73,26,154,56,171,48,115,174,48,128,170,133,16,143,132,25,42,75,137,147,45,32,185,186,
+133,147,82,137,3,47,137,56,232,8,40,217,129,0,145,56,153,131,243,88,105,201,66,136,185,1,161,8,1,25,1,226,
+154,7,157,40,130,140,4,40,170,167,24,26,0,25,88,143,163,195,161,164,2,59,76,25,41,28,1,185,185,167,128,145,
+163,177,23,155,151,129,136,50,142,40,136,203,66,10,195,180,160,131,161,9,113,186,56,197,178,33,185,2,145,0,145,248,
+131,91,153,72,208,73,43,195,1,178,148,243,145,8,145,154,65,154,179,151,145,146,24,120,154,145,128,227,161,17,141,128,
+134,26,196,146,16,168,40,49,174,161,133,138,146,34,47,152,162,128,146,168,51,47,45,161,60,25,180,16,128,177,36,76,
+47,137,144,91,0,41,40,41,26,146,187,183,25,59,10,139,127,27,8,0,49,60,10,64,184,1,161,246,129,57,27,58,
+26,77,136,0,8,136,91,75,138,242,18,138,162,65,78,26,24,136,33,58,168,40,218,24,15,193,48,44,145,24,106,45,
+58,153,40,211,162,129,0,26,1,216,166,131,29,56,25,160,161,138,50,184,240,51,240,129,128,24,129,166,169,150,73,185,
+128,228,164,145,195,16,10,2,60,41,29,209,131,184,149,152,180,8,228,148,144,130,58,11,1,169,198,163,128,33,211,0,
+211,130,184,33,42,34,112,169,20,249,227,145,128,0,56,138,27,14,145,160,164,9,10,56,173,35,195,32,185,199,52,76,
+128,90,137,144,148,8,0,42,152,32,246,24,180,16,123,10,8,185,150,137,2,27,8,40,224,3,155,4,44,137,82,143,
+148,41,137,0,192,165,145,24,49,61,40,10,8,248,3,45,137,41,201,2,160,10,83,27,10,178,241,165,88,153,130,41,
+243,1,153,0,17,46,144,0,24,160,63,26,8,154,50,250,50,153,131,48,9,122,136,106,140,181,128,147,9,0,1,188,
+1,18,10,120,144,74,244,1,137,162,16,192,163,211,17,136,60,177,130,194,196,59,160,148,201,135,160,17,155,64,163,136,
+19,185,113,172,182,144,129,42,144,88,173,19,9,91,41,27,122,200,33,42,168,49,208,41,226,17,57,77,137,1,152,226,
+32,136,25,26,18,142,2,90,79,17,74,0,26,57,9,96,30,1,28,211,128,145,48,12,16,13,162,130,9,57,16,78,
+224,131,43,9,42,177,122,10,129,8,24,41,58,137,241,122,137,0,24,1,170,182,40,72,138,147,131,243,133,28,162,192,
+145,56,225,145,9,34,45,137,32,138,123,241,2,9,0,8,176,2,241,1,32,62,10,147,184,214,48,138,129,137,180,8,
+56,28,64,25,1,136,210,151,43,178,211,145,17,11,10,26,26,151,1,1,198,42,241,147,25,8,42,200,19,248,33,41,
+27,162,133,156,229,17,152,0,8,145,129,74,26,72,8,129,18,249,151,27,145,193,16,56,13,58,176,147,209,132,42,177,
+73,248,132,9,130,60,152,16,172,49,1,31,1,129,140,182,41,161,128,73,162,9,65,12,16,16,185,64,250,165,45,147,
+153,130,18,170,40,224,65,144,8,40,214,56,202,132,59,152,73,185,3,217,2,40,31,16,136,29,243,48,136,147,57,147,
+152,42,176,122,168,211,1,241,147,12,147,138,49,128,249,35,217,147,8,129,74,193,40,208,132,25,144,73,144,30,184,4,
+9,27,21,9,25,229,40,0,128,41,144,225,3,169,57,10,136,95,200,147,60,211,146,16,162,26,76,169,18,161,17,161,
+145,127,154,145,1,225,16,145,43,41,32,154,77,133,41,61,226,40,136,146,43,131,12,26,26,0,24,168,113,185,7,30,
+161,129,136,3,14,0,137,0,144,197,40,227,56,186,164,2,147,41,0,78,26,33,154,19,130,28,143,166,26,160,49,31,
+129,27,16,25,137,33,233,82,249,132,26,160,33,9,179,201,32,137,88,137,177,0,135,73,141,1,40,128,43,162,94,152,
+145,28,164,40,25,13,196,0,40,16,10,105,154,24,10,64,59,184,121,241,18,139,177,64,9,24,218,33,128,25,211,149,
+25,134,76,169,2,144,145,58,0,143,145,146,153,134,41,41,12,181,25,130,40,140,130,170,164,72,29,128,43,40,242,120,
+12,9,104,137,129,144,57,24,40,224,133,8,144,74,201,130,25,168,40,145,15,148,144,107,161,40,58,141,4,12,16,40,
+138,18,157,194,32,1,46,9,0,198,56,138,177,52,10,10,0,49,158,80,12,16,176,25,106,202,134,144,128,137,131,44,
+130,59,74,129,45,73,12,177,17,139,74,225,163,232,71,0,1,208,179,104,137,74,8,108,136,145,24,128,8,146,137,226,
+132,10,177,196,32,60,27,57,171,181,148,144,176,135,26,162,194,164,88,139,41,59,18,47,25,58,209,2,45,136,49,44,
+77,136,16,137,41,45,42,208,147,24,26,168,131,90,196,89,137,32,139,146,161,246,17,169,3,155,181,56,169,57,11,132,
+160,197,16,33,124,136,40,41,41,62,11,16,45,137,74,63,27,123,56,145,137,240,0,29,8,148,41,153,41,5,152,58,
+201,26,129,7,145,136,9,192,40,51,62,250,17,160,132,59,0,139,27,2,24,65,176,199,41,169,88,29,2,136,57,107,
+128,154,153,60,210,32,12,51,29,131,44,12,81,9,16,8,146,31,194,60,160,16,24,27,29,131,27,48,91,250,34,137,
+168,120,177,25,56,57,209,153,167,33,157,164,56,169,149,136,131,10,243,144,16,1,136,94,153,163,0,196,16,45,25,160,
+161,33,140,3,123,11,209,3,152,148,41,72,160,160,49,42,239,132,9,137,66,28,10,73,26,136,40,1,58,31,180,18,
+185,33,28,42,58,13,59,10,166,195,77,144,161,120,136,41,27,129,152,147,105,9,160,89,154,145,160,228,148,136,24,10,
+193,32,145,214,132,8,27,25,128,209,35,18,12,144,17,123,173,134,26,26,26,43,129,144,183,163,1,137,146,77,194,1,
+160,181,128,90,61,136,8,8,42,199,57,128,128,58,0,153,129,62,169,148,136,19,249,132,76,139,33,170,1,17,176,91,
+137,40,125,137,179,162,8,8,88,25,60,72,44,27,178,151,62,144,176,24,1,30,145,4,9,130,43,27,144,95,26,153,
+18,162,136,64,63,45,28,176,49,241,33,24,58,90,10,169,162,178,0,74,89,73,139,180,130,156,0,12,40,136,1,18,
+121,16,0,143,145,226,129,0,40,90,42,1,74,185,75,244,75,9,152,17,129,57,144,162,62,161,154,4,210,104,24,170,
+147,193,153,148,25,32,73,142,135,169,19,24,13,1,9,168,147,181,8,200,58,136,14,20,26,16,0,248,65,184,129,19,
+27,72,178,141,162,128,140,108,144,168,148,165,145,16,104,187,64,168,177,20,154,108,25,170,56,210,128,3,163,94,8,137,
+8,195,161,166,56,60,11,75,1,190,21,10,56,59,13,33,231,21,76,0,168,130,17,26,60,180,140,147,193,45,106,28,
+41,58,41,26,180,64,10,107,153,19,170,229,16,152,168,64,169,0,6,240,64,9,137,0,195,0,17,25,141,17,30,137,
+210,1,56,0,154,4,1,160,134,160,16,105,169,30,162,185,40,144,58,122,161,33,146,241,19,41,15,130,179,44,225,161,
+41,128,59,105,144,32,161,144,131,196,27,50,211,13,164,176,185,20,31,9,33,44,148,194,24,147,160,88,17,189,21,169,
+218,20,154,24,49,140,3,180,136,20,13,57,2,175,132,136,170,81,139,16,130,153,150,147,41,146,29,57,209,138,164,178,
+10,80,47,26,162,0,181,18,74,176,8,74,242,16,8,136,43,210,32,155,2,73,144,16,56,243,162,48,159,163,11,40,
+29,152,151,0,176,97,74,9,0,0,211,177,32,143,128,57,155,181,34,192,131,49,10,29,48,210,140,35,249,129,75,153,
+2,107,193,35,138,148,136,41,8,204,130,43,240,32,154,130,65,12,52,202,18,33,157,130,12,180,40,141,2,60,9,20,
+140,133,16,29,1,160,241,2,139,145,74,138,179,57,19,73,91,26,18,162,245,8,161,160,77,225,40,57,168,40,147,144,
+32,149,11,10,244,128,137,145,80,28,0,40,180,3,144,150,8,14,195,10,25,162,11,51,192,32,151,40,42,196,136,58,
+203,129,42,249,1,4,161,65,177,167,0,146,185,107,137,170,64,138,137,51,200,113,177,163,81,240,8,129,154,60,145,41,
+73,17,44,149,58,8,145,172,130,202,242,18,184,1,64,144,57,147,182,128,151,154,153,0,27,20,140,49,23,155,34,163,
+219,82,219,24,136,224,2,145,210,66,11,32,160,0,112,201,25,58,185,2,8,145,121,152,32,33,184,113,185,72,141,144,
+152,2,144,80,200,114,137,1,144,184,1,27,12,44,227,49,26,179,23,29,73,128,138,0,224,129,75,152,49,9,211,133,
+137,49,156,9,42,141,145,76,160,4,137,50,193,29,4,26,224,40,154,177,40,136,131,93,50,27,45,1,185,212,0,58,
+144,57,135,34,107,8,137,9,165,15,41,209,145,136,144,25,137,195,1,12,77,18,188,112,153,162,2,181,34,106,11,42,
+8,33,161,27,165,153,16,110,26,136,128,211,145,49,145,204,67,14,10,56,171,6,78,0,161,177,165,24,62,41,17,154,
+75,178,250,129,133,136,72,25,154,49,129,161,142,195,160,74,122,9,144,161,178,187,7,57,186,131,138,58,123,32,0,128,
+160,162,111,144,145,137,161,13,1,2,146,56,241,11,146,115,137,144,128,159,48,8,130,128,211,43,62,0,133,12,0,208,
+8,50,40,12,132,233,145,65,25,227,145,0,155,32,51,192,40,240,128,27,99,10,184,145,144,30,50,178,179,180,168,44,
+121,163,56,188,25,169,49,80,211,0,208,169,40,67,195,2,31,27,90,152,65,137,137,138,137,104,20,208,162,152,27,49,
+56,146,168,142,142,33,48,20,58,203,171,25,18,83,129,192,153,157,105,18,9,50,191,155,65,24,4,16,11,218,176,38,
+0,166,48,157,140,2,56,41,72,139,153,42,41,115,192,4,141,170,51,8,193,5,186,152,16,80,122,138,17,202,9,50,
+145,9,51,173,158,34,161,4,45,163,144,155,49,120,9,146,129,220,33,24,200,106,8,154,177,179,34,36,202,83,156,145,
+99,240,33,152,25,26,137,75,33,45,8,1,143,32,169,19,0,170,53,250,152,130,32,9,105,169,72,28,146,137,130,56,
+249,154,16,134,138,131,58,242,92,8,146,8,162,136,184,75,113,10,8,145,224,25,74,145,137,18,164,218,128,68,58,45,
+32,187,128,48,32,179,15,133,187,59,38,176,152,2,158,24,56,2,209,96,185,184,60,53,153,25,176,216,130,147,99,10,
+27,217,200,50,20,26,12,32,143,131,129,4,161,186,30,10,132,148,152,0,208,25,72,107,179,152,154,8,89,21,26,169,
+1,204,19,49,16,150,157,28,130,32,0,128,234,176,201,23,0,56,155,12,34,8,48,218,34,159,128,40,149,179,170,154,
+72,49,0,144,145,249,91,161,113,144,138,43,24,106,24,8,42,140,41,68,17,203,225,171,88,147,16,145,209,10,148,51,
+120,201,137,8,1,164,16,8,143,136,81,25,148,170,200,72,16,73,9,9,46,153,34,3,236,178,1,152,51,194,17,188,
+187,52,132,146,186,25,42,39,31,18,168,139,73,1,19,173,187,52,42,147,20,176,157,170,150,88,177,241,8,132,144,3,
+56,172,8,16,2,165,250,8,1,10,49,128,185,129,250,114,16,140,136,0,2,160,180,147,85,19,67,0,159,25,99,177,
+138,10,160,37,169,33,168,143,57,65,131,156,218,131,6,136,40,168,185,10,23,2,233,9,18,152,128,165,144,172,107,65,
+193,137,8,130,17,41,89,9,219,16,6,194,11,138,64,0,184,22,241,168,35,1,8,141,25,3,224,17,128,187,42,64,
+5,208,185,19,129,153,83,154,156,16,37,148,251,0,131,27,2,146,224,193,24,99,137,171,3,162,144,49,136,172,158,89,
+7,185,128,3,128,130,26,132,205,24,50,145,187,142,65,168,129,6,210,170,66,17,184,185,48,83,203,18,2,250,57,24,
+122,185,153,34,177,160,151,210,136,17,65,129,158,57,3,185,76,131,171,137,88,133,192,138,20,168,0,132,152,58,15,34,
+160,217,40,18,11,24,147,211,240,0,5,186,137,82,152,40,136,97,140,26,97,177,11,10,3,128,227,4,193,185,48,68,
+203,58,153,17,168,97,72,171,27,149,149,192,161,56,146,28,18,136,218,64,105,8,157,0,4,209,1,131,217,144,147,34,
+176,159,33,25,43,81,168,170,161,56,23,216,8,1,160,128,35,136,28,31,113,152,155,16,130,144,147,149,226,160,49,34,
+187,159,57,24,56,75,129,249,136,17,134,168,184,19,1,168,112,129,156,33,17,129,143,153,7,178,136,35,201,42,24,96,
+185,188,74,56,139,66,129,173,8,0,7,225,160,3,9,25,49,136,217,56,89,1,191,17,130,194,129,2,211,169,34,82,
+138,143,9,129,162,65,33,219,152,1,135,160,185,89,57,170,18,135,138,58,33,17,220,160,37,144,41,66,224,138,48,90,
+128,171,27,162,137,113,16,219,0,136,50,178,159,56,41,137,97,24,208,176,131,23,170,12,57,32,152,19,21,157,9,32,
+133,233,176,1,8,41,80,128,13,10,3,130,240,169,64,0,43,35,210,154,105,72,1,216,137,149,162,89,1,168,9,9,
+72,145,174,9,193,147,1,150,144,202,33,50,209,186,24,2,148,144,23,184,157,67,73,26,140,27,56,161,134,132,185,27,
+17,96,145,173,137,16,160,52,164,224,161,0,20,176,143,32,26,9,35,164,241,160,133,18,154,26,73,74,144,33,1,190,
+144,150,1,160,218,59,106,26,49,128,143,144,146,133,178,154,89,137,74,33,177,10,138,43,23,225,161,147,136,254,73,0,
+8,122,25,128,137,169,34,212,168,177,162,149,41,106,128,156,65,56,170,184,13,3,227,18,98,154,10,132,33,192,184,72,
+24,140,5,147,28,27,26,83,142,138,195,162,73,1,168,145,128,82,241,136,48,10,140,34,3,138,240,49,0,175,16,149,
+160,0,16,130,177,137,7,248,168,33,137,48,10,33,9,28,66,177,143,9,210,2,128,8,149,162,48,8,40,107,154,32,
+167,177,17,128,140,19,28,153,243,41,177,208,64,25,142,129,130,128,16,140,18,184,83,34,187,105,170,174,4,136,1,72,
+136,114,152,2,185,159,33,169,9,3,169,128,17,33,151,153,91,184,27,48,13,108,128,74,48,162,148,176,105,146,128,30,
+131,185,180,20,10,248,24,8,144,136,132,224,42,144,8,16,31,8,162,128,48,148,72,137,176,82,210,203,128,18,156,32,
+2,7,26,97,48,249,9,8,137,160,1,144,156,18,122,32,44,154,144,129,243,17,227,0,8,19,16,138,31,50,1,10,
+120,128,27,162,182,137,26,201,145,217,164,163,219,112,8,1,153,16,43,160,154,165,131,8,0,122,168,242,0,129,9,113,
+136,32,216,18,40,249,137,132,10,8,16,10,193,128,35,178,13,106,153,185,226,163,130,210,52,2,144,81,152,25,40,217,
+64,129,138,96,155,188,151,152,163,137,179,49,221,129,131,61,75,60,41,8,45,16,26,32,33,13,0,171,3,192,172,68,
+225,75,32,129,163,153,31,48,14,89,9,152,32,139,88,168,185,65,201,144,133,152,16,129,121,33,187,66,147,185,49,200,
+25,18,63,113,26,28,56,156,146,136,128,177,220,147,196,177,149,152,64,25,44,16,138,40,21,140,57,186,18,243,168,131,
+148,28,132,1,129,192,42,82,157,40,24,203,33,185,74,144,185,112,208,26,131,152,33,3,33,23,153,104,0,161,43,217,
+57,167,75,18,160,27,33,143,0,9,44,145,175,18,8,140,131,145,56,16,32,150,154,73,16,233,65,155,74,177,233,49,
+185,129,7,56,88,152,12,17,155,137,3,173,8,34,43,228,169,3,194,30,133,136,8,136,48,148,138,65,161,64,64,153,
+47,8,145,82,1,137,136,240,161,200,160,17,174,48,161,232,162,33,133,154,51,133,138,44,241,16,26,138,57,145,180,211,
+85,235,67,0,146,132,136,50,112,136,160,46,25,10,111,136,152,160,2,42,137,61,194,26,56,48,13,65,41,77,43,148,
+10,57,89,141,57,136,164,123,152,163,153,72,128,30,42,146,139,163,129,217,100,154,137,81,140,135,11,165,16,139,178,72,
+10,75,176,164,134,9,144,75,27,132,193,147,1,153,242,16,41,152,152,9,211,1,10,135,16,43,12,128,164,48,76,40,
+224,0,153,12,5,28,33,176,226,2,59,169,120,27,146,56,9,74,45,201,3,42,194,146,216,129,24,10,135,42,130,45,
+129,152,226,2,40,141,148,8,152,34,42,163,157,166,161,16,179,184,61,235,97,153,163,146,0,8,24,242,56,177,57,160,
+181,98,233,0,18,140,131,10,161,31,162,24,32,168,7,169,18,168,210,147,32,209,2,218,161,147,27,178,56,12,134,13,
+56,210,8,181,49,29,129,56,144,248,49,201,2,137,211,8,25,153,131,245,17,195,0,8,9,0,64,171,4,160,17,24,
+175,3,10,28,153,243,120,144,128,129,57,41,9,241,5,177,25,3,13,136,241,2,25,152,16,176,12,132,12,0,20,140,
+4,25,128,16,15,130,168,17,227,160,24,243,74,128,26,130,185,83,144,186,104,25,10,34,139,166,193,137,2,43,40,23,
+142,64,10,25,193,32,184,145,76,169,177,37,49,43,151,149,58,137,28,10,143,16,176,17,50,161,123,148,154,178,216,145,
+58,13,132,32,8,4,160,66,217,184,216,144,40,164,106,130,129,41,178,216,137,168,193,97,136,81,153,131,58,153,171,232,
+225,0,49,2,59,105,144,27,40,188,219,65,16,17,167,18,128,200,41,157,43,56,163,19,19,163,159,226,153,168,8,115,
+128,32,66,45,170,176,228,25,2,8,19,8,210,145,141,0,154,137,100,177,131,153,146,140,18,12,172,97,8,34,16,138,
+215,128,25,184,8,25,120,25,18,44,155,8,131,159,132,48,148,32,58,249,16,140,24,153,0,37,11,146,146,172,165,13,
+24,138,20,132,161,27,181,26,50,236,136,18,89,153,131,160,21,203,25,242,160,130,3,123,8,128,128,184,128,250,18,32,
+161,211,133,10,24,218,13,2,32,49,9,76,19,250,18,187,16,48,136,34,58,56,13,173,208,181,29,19,136,42,98,171,
+130,177,13,163,98,237,69,0,58,89,129,74,34,8,143,194,184,0,33,136,40,165,148,226,91,168,155,50,2,73,88,168,
+65,187,29,179,142,50,161,129,33,251,0,1,61,177,200,65,3,13,35,200,91,148,168,136,9,57,64,232,48,178,11,64,
+205,145,56,0,90,8,211,133,9,41,158,42,147,48,16,193,89,152,137,176,200,17,98,201,32,146,56,40,175,26,161,1,
+66,0,31,134,186,19,185,75,145,136,92,41,40,33,137,15,163,141,33,147,0,50,179,164,141,203,145,28,91,131,73,130,
+138,148,159,0,170,162,6,64,153,35,202,57,136,15,25,24,56,150,10,64,177,13,161,155,129,147,52,120,170,97,155,137,
+1,176,16,6,144,56,180,202,195,203,3,58,2,54,45,9,1,153,159,32,162,81,33,154,131,58,248,138,169,96,42,128,
+24,131,156,128,250,12,51,177,150,48,153,59,176,45,155,48,48,55,234,5,152,138,24,13,40,144,147,0,130,40,249,170,
+136,7,138,67,168,24,34,233,29,152,146,153,23,57,16,43,157,25,177,39,9,24,49,194,153,159,56,139,19,161,137,120,
+129,155,235,41,50,193,17,50,164,145,175,15,33,128,162,32,57,48,250,12,1,200,52,137,45,147,128,173,137,162,22,0,
+136,66,170,160,251,32,89,0,160,147,57,250,25,152,4,77,33,139,5,153,184,162,27,134,0,0,120,185,41,187,30,3,
+32,41,2,27,244,202,16,35,160,35,44,153,145,251,40,0,17,124,130,136,177,159,40,129,24,147,40,129,217,219,137,50,
+7,137,48,18,251,27,138,35,134,137,16,150,138,168,12,80,2,170,23,136,153,138,13,35,192,32,24,211,1,204,185,53,
+9,16,2,153,19,207,8,51,152,16,226,17,200,169,58,150,40,0,98,26,203,155,133,145,0,130,128,135,219,8,1,128,
+34,177,112,145,156,43,160,98,146,145,1,153,159,176,16,81,2,200,38,176,186,154,40,39,201,17,162,210,137,169,112,16,
+160,0,131,208,173,1,50,0,81,50,232,168,184,8,152,24,97,131,25,226,170,11,6,136,129,32,138,216,159,66,25,41,
+35,154,12,244,168,32,128,20,146,25,1,251,156,36,26,56,1,160,33,250,27,75,0,24,193,81,10,184,158,51,10,130,
+1,179,203,146,152,114,35,48,53,33,63,0,151,1,224,152,219,97,8,144,178,132,10,169,45,168,51,129,148,43,18,206,
+218,66,144,40,24,135,10,168,10,129,24,24,21,24,2,175,219,64,2,153,18,16,160,16,175,208,65,8,1,8,16,208,
+156,44,136,33,151,129,152,17,13,200,41,83,132,8,32,26,248,28,8,17,177,3,129,3,204,219,123,161,130,9,72,56,
+217,156,18,144,178,67,186,115,152,192,40,139,17,4,41,59,9,158,3,143,130,2,18,42,171,134,204,177,33,25,112,179,
+136,169,193,136,241,8,7,0,136,130,144,11,156,97,17,57,56,203,96,232,153,16,131,58,0,160,34,188,15,128,8,105,
+17,185,19,160,189,152,2,36,154,67,35,240,169,217,64,24,11,167,2,145,0,221,17,0,152,81,144,16,152,170,139,243,
+64,194,8,20,9,140,10,14,18,146,104,32,10,41,244,137,129,145,73,21,139,8,128,156,8,10,112,145,0,146,226,25,
+187,160,132,105,48,136,138,149,158,24,1,160,17,146,134,130,175,0,129,32,1,156,97,145,201,160,8,5,26,57,146,178,
+9,243,159,50,9,24,184,135,0,186,8,50,40,104,146,73,136,203,202,16,64,1,16,23,138,188,153,136,121,145,3,56,
+161,145,239,26,132,129,9,66,26,137,218,27,17,0,4,128,147,151,249,27,4,136,24,16,49,138,240,10,152,35,17,228,
+1,130,236,138,65,16,184,40,132,136,216,136,33,49,148,1,135,25,218,156,65,17,152,33,72,170,159,154,51,19,170,9,
+37,152,221,25,3,0,138,50,35,14,188,219,35,83,0,168,34,201,190,24,55,169,137,72,147,202,8,16,138,66,164,128,
+32,251,172,56,69,176,169,32,145,173,98,1,153,40,4,168,0,156,218,51,52,168,153,128,191,27,100,145,11,0,134,170,
+144,153,80,16,146,32,128,191,13,34,130,208,0,36,184,219,16,0,20,26,74,163,186,143,32,1,129,161,39,208,139,40,
+0,129,24,42,64,221,11,129,148,134,25,48,168,159,49,145,49,25,40,4,207,137,20,160,40,161,16,197,156,16,1,8,
+33,10,3,249,158,48,146,24,163,72,153,173,28,133,128,2,56,145,163,253,1,25,41,40,168,20,240,136,33,25,139,163,
+154,39,168,74,60,29,1,248,0,48,153,40,221,249,68,0,195,48,132,172,48,146,28,5,155,89,131,219,128,177,1,132,
+139,22,208,9,24,161,90,129,170,66,227,129,172,74,147,177,40,149,24,136,158,25,2,17,164,160,121,146,174,40,145,1,
+6,10,17,145,252,130,153,66,9,156,20,184,138,161,2,74,18,74,135,144,160,162,27,67,9,120,192,2,11,185,96,154,
+91,17,184,184,197,40,49,143,32,8,169,50,143,58,33,218,1,1,32,145,174,49,145,8,163,46,25,132,154,171,135,1,
+165,12,17,224,136,67,12,40,40,170,139,1,27,9,99,160,135,104,136,170,147,43,8,34,19,47,241,146,176,40,123,168,
+32,145,164,144,129,15,56,186,148,2,211,75,9,61,154,2,168,226,50,146,177,170,120,179,0,152,16,15,36,16,44,132,
+152,215,128,40,138,43,91,26,14,146,40,202,33,140,177,136,3,165,89,8,148,186,21,128,2,155,112,0,8,16,73,72,
+13,2,16,250,136,177,132,168,82,155,4,31,145,9,11,162,24,131,146,133,16,186,123,177,17,185,91,75,17,155,18,146,
+241,130,90,168,141,57,180,178,147,18,136,148,30,128,203,14,2,136,114,153,88,160,129,140,130,155,12,131,60,135,160,1,
+40,210,2,186,65,13,146,9,50,7,28,64,170,0,170,197,41,168,76,136,20,176,33,154,147,202,144,16,15,3,48,85,
+216,0,41,153,30,129,136,145,132,40,6,201,24,168,139,17,42,16,121,185,67,133,185,144,141,130,160,60,133,59,25,212,
+34,186,128,14,9,146,82,153,65,48,169,39,235,129,154,33,136,74,144,166,41,136,64,189,167,152,2,24,75,8,184,4,
+12,52,140,196,137,32,154,49,59,136,182,57,135,141,162,9,16,152,88,42,74,192,24,148,12,182,9,2,138,48,12,48,
+170,96,146,42,241,8,145,137,98,27,19,140,18,16,142,243,128,145,8,1,75,16,14,1,8,8,241,145,147,136,163,122,
+138,24,18,40,28,249,145,163,153,4,41,25,146,90,40,15,224,129,162,24,145,49,43,224,96,8,43,217,129,147,169,196,
+34,41,152,96,9,92,218,2,144,129,164,1,0,43,18,43,47,140,128,176,18,229,17,144,145,18,160,78,140,128,0,24,
+216,35,211,17,128,176,61,30,0,25,40,192,151,137,146,130,43,15,75,0,211,25,28,24,8,107,170,36,10,145,3,244,
+128,11,17,10,74,44,133,25,128,136,224,132,137,0,146,16,79,136,16,136,32,13,244,128,136,0,145,72,152,16,72,26,
+45,232,130,136,128,177,21,136,179,64,176,89,15,9,8,128,145,150,24,136,132,217,195,42,24,25,90,57,177,91,57,162,
+10,245,25,144,8,10,52,168,149,74,136,92,156,129,16,0,160,6,25,176,66,233,146,46,128,24,24,28,131,26,8,135,
+155,212,16,137,145,160,66,160,131,74,145,62,187,130,56,137,156,23,10,181,34,202,148,15,146,145,24,42,17,58,153,21,
+13,242,40,152,161,162,48,163,17,28,148,11,232,132,75,40,170,6,136,145,64,202,195,137,160,18,90,28,131,9,145,53,
+15,184,145,32,226,145,81,160,128,1,244,1,29,128,41,9,161,19,27,40,73,240,212,41,152,131,41,136,128,51,30,88,
+27,251,3,9,144,1,27,148,177,51,184,161,47,177,80,44,193,50,10,177,7,153,242,40,139,133,9,8,129,40,27,132,
+42,221,2,57,200,145,64,152,162,114,200,130,15,130,8,26,129,0,41,194,49,43,240,45,192,132,136,128,1,17,152,81,
+43,220,16,152,147,200,65,131,138,123,195,25,192,2,25,152,129,49,196,130,88,161,10,220,129,60,8,144,17,18,182,90,
+2,154,159,2,136,59,176,112,161,145,130,5,139,31,144,152,32,140,49,0,138,7,146,138,249,74,146,10,184,66,48,75,
+137,20,161,184,15,129,140,169,130,19,89,46,21,1,184,169,33,170,218,1,165,34,130,108,18,208,9,153,25,14,138,129,
+4,161,72,97,129,185,176,137,163,15,137,194,36,160,98,25,130,154,184,203,131,15,24,160,132,211,112,128,1,186,177,0,
+144,0,31,32,145,200,6,32,48,189,192,131,162,74,61,41,146,1,89,24,152,234,161,9,129,240,75,8,41,0,160,71,
+42,168,152,9,180,139,170,73,135,177,131,97,26,144,43,232,161,9,42,13,149,178,5,129,1,1,143,8,137,184,88,155,
+5,146,177,85,8,184,160,201,4,153,152,208,84,8,161,64,161,33,143,160,58,153,138,41,128,165,17,159,37,137,153,136,
+248,3,153,144,16,3,202,135,40,34,176,15,129,130,24,192,108,8,145,8,21,13,74,0,18,40,10,229,144,136,8,10,
+61,160,130,57,64,121,136,163,176,176,160,184,243,184,114,10,120,8,24,128,176,178,12,144,169,146,159,7,24,0,16,43,
+48,242,11,24,9,136,176,42,71,24,139,133,153,130,26,191,24,179,59,136,10,85,152,40,181,8,185,0,155,60,48,206,
+19,112,8,184,35,49,188,128,163,134,186,35,146,157,132,160,12,39,138,16,179,31,2,184,144,136,157,49,192,147,38,138,
+107,34,27,139,242,0,176,129,3,32,160,123,176,18,34,175,156,131,27,144,3,121,130,176,147,106,137,155,217,194,74,17,
+141,19,179,195,64,13,33,208,27,129,180,14,18,128,88,1,156,17,147,168,12,140,146,145,92,148,161,26,130,11,96,146,
+204,130,33,138,104,8,165,129,56,162,36,13,187,57,234,3,249,32,33,200,25,195,17,33,159,168,2,12,40,2,138,23,
+184,57,52,153,154,242,10,34,142,17,51,202,32,136,25,23,248,10,40,137,9,34,144,22,140,16,89,169,144,136,185,57,
+151,45,35,129,11,131,10,68,152,142,24,216,26,72,147,48,225,154,48,20,139,169,252,35,42,139,97,160,184,50,169,122,
+132,188,178,50,31,128,8,19,177,0,122,152,129,176,243,57,8,170,130,7,176,0,59,42,151,209,9,9,154,129,5,8,
+132,154,80,146,50,216,171,106,144,161,120,1,192,24,163,28,50,248,153,40,137,129,25,88,164,185,32,1,0,192,208,45,
+40,201,65,18,177,161,130,77,2,169,233,50,188,137,23,25,136,145,43,138,39,176,232,25,32,219,33,65,240,0,56,168,
+65,184,186,18,25,152,39,58,163,8,26,7,146,159,145,152,27,164,57,177,20,40,178,16,55,174,138,8,153,40,112,144,
+26,20,160,48,250,136,152,25,40,48,67,169,21,171,115,130,188,145,208,160,58,32,34,30,105,129,11,24,193,159,1,146,
+158,52,144,136,33,137,81,144,8,8,176,161,134,216,57,17,11,50,174,3,185,202,57,140,145,7,137,197,16,25,217,83,
+154,0,16,241,146,16,41,160,172,21,160,162,108,0,141,2,128,33,153,201,16,177,140,34,141,98,136,168,20,144,15,16,
+200,144,129,56,64,140,83,130,136,131,123,137,176,161,241,57,129,138,16,130,167,8,24,46,164,14,70,0,136,145,168,145,
+140,49,251,56,151,153,33,176,144,195,139,114,160,42,146,130,138,7,170,77,148,137,147,144,72,153,140,19,192,10,4,158,
+129,177,176,64,193,49,25,82,168,176,82,49,17,15,178,89,162,59,160,159,68,168,41,10,168,149,187,40,134,153,56,0,
+201,64,225,137,65,170,32,161,131,121,155,65,180,155,64,145,138,74,200,168,83,161,34,14,57,163,248,145,58,136,56,138,
+160,83,128,157,26,149,27,43,3,14,179,5,120,136,32,9,34,173,7,186,73,178,24,210,145,34,169,241,64,152,25,178,
+25,92,136,154,25,194,32,0,44,153,215,0,19,13,41,176,20,27,89,8,140,4,17,209,24,11,209,161,129,24,73,154,
+3,143,148,179,170,96,138,178,32,26,50,57,112,98,156,132,16,185,80,240,128,17,137,128,152,0,146,29,90,24,12,161,
+131,13,122,136,176,178,33,210,1,1,169,241,49,128,61,10,57,0,15,2,10,40,27,199,34,9,137,32,249,179,192,2,
+32,137,15,166,177,128,2,0,193,193,132,149,154,21,186,149,57,161,89,169,213,176,21,200,4,75,41,159,17,136,129,145,
+16,40,139,83,29,143,146,2,24,48,9,9,144,143,145,160,164,107,10,0,179,160,3,224,32,26,24,150,178,128,168,186,
+39,138,138,135,195,41,184,165,25,10,163,148,0,88,186,36,60,27,62,138,133,24,27,33,143,16,2,152,146,47,154,161,
+182,56,43,10,121,10,146,129,152,147,40,108,137,24,230,136,33,138,152,195,4,41,128,153,148,140,5,139,145,112,153,9,
+1,27,137,242,128,5,26,152,16,225,97,137,40,136,137,9,4,78,145,128,185,18,11,10,195,26,110,168,32,138,56,168,
+35,29,130,226,148,129,136,168,128,214,16,0,136,136,56,207,4,9,161,4,11,72,148,9,49,153,79,209,16,152,128,217,
+132,168,0,131,157,5,26,41,0,24,187,148,61,161,75,210,50,28,2,8,152,20,185,187,75,216,46,197,16,136,48,25,
+24,195,33,179,251,192,131,11,131,19,143,6,43,152,131,194,24,243,9,145,11,18,165,1,35,145,170,39,43,236,178,145,
+60,129,72,32,13,176,129,16,36,240,10,1,29,3,152,82,140,144,129,26,162,214,32,139,154,21,11,51,90,24,72,0,
+168,153,108,137,17,33,31,192,160,129,65,145,164,168,248,1,18,24,171,183,155,4,162,35,1,188,146,202,114,17,24,41,
+250,8,8,56,128,24,171,241,139,6,89,0,153,10,10,76,48,0,57,169,238,32,0,49,161,161,14,168,138,83,145,34,
+226,201,40,8,1,37,177,171,200,152,121,148,1,1,206,32,184,5,17,24,233,25,138,33,3,105,26,202,146,152,5,18,
+33,202,155,27,225,36,128,2,204,177,155,37,34,41,196,158,0,152,51,17,211,28,160,45,2,16,146,149,159,144,130,89,
+130,209,40,139,137,129,21,9,133,157,144,0,48,4,208,74,186,163,18,40,147,171,241,136,164,104,130,152,0,172,132,2,
+48,165,42,190,145,24,96,129,154,128,143,8,5,24,146,10,217,128,9,64,6,13,129,154,17,16,16,16,153,248,10,26,
+112,148,10,176,26,29,2,34,3,156,242,139,50,73,180,0,11,11,169,150,113,137,24,240,0,25,65,136,130,186,137,136,
+115,72,152,161,241,136,42,32,128,163,28,158,32,48,72,152,145,242,169,17,112,8,177,9,12,40,17,56,129,17,253,153,
+58,149,18,192,73,140,136,4,58,145,17,250,138,80,136,134,137,25,170,129,105,24,57,17,251,9,48,160,7,136,11,144,
+137,84,25,32,59,240,157,34,10,133,9,154,177,16,80,0,41,122,240,25,24,24,18,137,12,168,25,19,57,131,49,252,
+142,2,57,150,136,25,156,57,16,32,56,0,253,75,152,65,146,144,144,155,15,50,26,35,146,251,75,152,80,1,192,40,
+216,41,130,49,42,134,189,25,185,99,16,161,10,186,137,50,66,120,130,188,168,28,4,35,26,137,156,186,18,113,4,24,
+251,137,9,65,130,17,169,172,185,107,17,52,24,202,186,47,147,24,36,28,192,138,145,120,145,3,136,234,24,137,131,83,
+128,138,57,159,1,32,133,16,205,40,154,24,148,163,17,139,27,172,99,16,6,173,2,26,184,81,10,49,176,160,1,15,
+72,163,143,147,128,168,34,156,2,9,182,88,153,73,0,157,19,153,74,161,161,24,120,184,131,137,120,128,41,168,128,201,
+67,128,138,197,99,172,130,25,145,45,128,140,165,144,24,227,64,9,9,177,23,154,40,137,40,169,131,58,243,32,145,28,
+86,2,66,0,31,148,168,50,139,160,40,242,8,169,5,144,137,49,135,10,128,9,156,5,75,160,43,68,170,179,120,136,
+161,4,156,179,27,211,176,19,153,133,10,19,42,163,144,191,161,33,9,232,128,23,153,8,16,22,160,168,1,140,10,145,
+248,121,132,41,168,73,40,197,194,148,12,161,146,28,2,25,201,106,11,18,154,152,90,170,131,203,17,24,4,63,130,32,
+148,136,8,56,31,0,145,130,57,23,11,152,151,0,178,14,196,44,146,41,12,133,26,129,8,48,129,190,4,202,65,144,
+192,81,152,32,176,24,5,184,44,129,14,128,144,59,21,203,164,11,81,161,154,129,186,64,176,123,17,176,88,171,121,1,
+160,137,8,139,151,137,56,16,185,124,153,33,146,188,65,233,2,138,48,89,168,41,8,64,5,11,43,193,104,129,137,17,
+180,200,3,136,117,155,137,0,169,83,169,1,161,216,16,197,98,160,10,137,152,73,16,9,133,173,163,161,65,135,140,162,
+8,136,48,154,68,171,154,9,33,23,202,16,170,8,49,184,117,160,59,168,1,7,168,56,137,140,133,168,104,144,27,177,
+8,38,158,129,145,192,34,192,96,176,16,161,138,69,219,16,152,24,24,144,33,164,43,58,162,117,225,25,154,32,164,136,
+106,177,43,128,40,52,173,9,155,9,22,0,58,148,137,164,72,7,139,24,217,9,149,9,49,202,16,193,25,7,153,8,
+28,40,185,48,51,170,32,187,123,135,11,147,205,50,209,24,17,137,145,8,66,197,43,152,12,18,137,1,242,60,147,28,
+81,177,9,176,139,7,9,34,210,41,161,40,6,139,1,142,28,133,138,1,160,24,192,89,149,42,128,155,40,184,21,8,
+186,85,172,48,180,58,144,143,64,153,72,128,11,3,170,115,233,33,200,8,2,12,4,154,17,178,60,133,186,49,186,107,
+165,90,145,138,34,184,33,180,156,150,141,32,160,56,146,30,130,26,18,184,89,193,12,1,169,23,168,57,144,29,35,155,
+57,185,41,248,24,133,136,3,210,40,2,12,57,250,73,137,137,40,24,137,181,67,136,16,234,19,155,5,74,170,104,10,
+131,40,19,157,169,2,234,88,155,130,137,240,89,145,48,136,178,8,129,168,15,149,168,1,155,64,2,139,23,26,168,25,
+8,200,82,171,103,244,63,0,153,185,89,24,26,71,152,129,185,145,168,23,10,210,122,137,73,56,129,17,11,75,184,138,
+135,137,152,224,42,200,82,136,144,72,186,4,27,130,19,208,152,179,159,150,24,144,1,200,176,41,183,113,169,2,137,148,
+25,8,140,162,8,141,130,0,170,19,74,129,123,193,37,153,1,56,248,16,0,129,57,161,235,17,168,48,45,203,133,44,
+8,89,208,17,128,152,33,209,195,0,136,73,155,192,81,24,60,146,249,2,136,24,8,145,170,33,154,113,154,180,131,27,
+41,78,241,145,0,25,41,177,151,1,64,42,26,146,73,16,186,149,10,242,161,32,184,120,232,1,136,41,25,168,123,0,
+138,57,33,30,18,13,137,33,201,130,76,45,57,153,42,19,145,121,208,9,24,41,138,112,154,161,0,12,5,161,24,8,
+216,56,48,77,57,161,149,3,40,44,41,187,243,178,139,149,192,8,18,152,26,81,192,40,130,175,17,217,49,176,227,19,
+129,12,64,140,41,163,27,73,73,139,242,146,56,163,153,1,29,152,242,44,58,9,2,8,32,112,241,16,2,41,135,155,
+33,144,24,50,188,98,249,24,24,153,48,137,43,58,159,48,27,74,168,227,1,176,19,3,240,128,145,74,128,58,73,58,
+157,165,74,56,27,140,193,129,209,41,121,137,105,168,162,135,16,153,128,74,144,27,152,122,153,139,6,43,163,59,184,134,
+25,25,10,80,243,89,152,136,0,145,137,243,9,66,185,181,17,59,47,168,1,25,163,60,161,64,244,57,194,11,133,8,
+73,146,156,36,12,90,176,24,8,27,179,178,153,167,241,35,155,48,43,170,7,168,48,0,31,17,216,40,146,75,9,139,
+112,177,16,10,184,3,186,133,136,89,93,27,212,1,25,162,168,51,152,26,44,63,130,45,24,170,121,161,42,128,210,24,
+177,139,7,152,0,132,153,33,27,81,242,56,192,1,58,147,77,202,146,40,152,25,216,227,8,9,147,74,15,147,136,161,
+32,129,94,154,5,9,146,25,2,28,130,104,184,32,228,57,8,9,42,193,224,149,152,163,40,200,164,145,8,66,31,161,
+40,8,210,16,41,136,109,9,10,16,11,177,22,11,4,172,165,128,8,144,163,26,146,80,161,146,122,43,192,49,12,242,
+42,162,74,128,152,72,144,169,207,230,70,0,135,27,193,161,161,80,208,66,27,161,32,154,33,192,106,154,129,10,133,138,
+52,169,144,18,143,34,253,33,137,145,64,136,56,145,229,18,137,128,42,251,4,25,145,73,0,27,137,226,0,184,178,89,
+202,21,8,8,129,200,18,89,143,145,137,147,0,89,146,24,141,132,216,130,137,43,137,3,114,224,2,138,179,24,25,240,
+2,136,50,123,136,3,202,147,160,209,9,88,29,147,32,152,164,44,152,209,25,136,25,145,135,104,8,176,25,153,24,139,
+169,132,8,167,21,177,131,47,27,28,137,145,138,89,129,4,41,133,156,129,8,59,129,15,51,26,122,0,146,156,2,157,
+162,160,1,2,153,115,195,8,44,169,43,60,141,5,193,148,0,34,170,144,128,216,91,10,17,79,136,1,17,224,2,155,
+155,1,178,73,135,145,80,40,139,130,15,152,1,29,2,0,153,68,208,163,144,25,14,8,45,162,34,44,3,92,138,193,
+146,208,129,25,1,130,146,82,24,143,144,146,31,178,40,42,146,58,178,131,62,208,193,2,177,93,40,144,0,48,195,41,
+232,146,58,240,145,146,18,61,73,152,160,145,43,15,145,24,24,180,211,82,128,170,0,213,137,33,45,25,129,40,3,224,
+195,128,152,42,76,139,153,83,1,43,100,152,30,129,169,146,129,137,113,184,4,48,241,8,128,26,13,161,163,16,179,96,
+58,177,192,194,147,154,129,179,154,99,132,89,34,15,10,194,44,56,202,131,2,168,88,1,200,138,58,137,63,93,24,137,
+131,24,33,184,26,130,243,60,8,144,41,97,47,8,129,185,164,209,153,149,136,130,129,145,20,59,128,143,9,242,0,32,
+176,18,179,41,114,241,41,42,171,121,137,0,0,137,132,57,208,18,187,163,73,16,42,80,193,4,94,160,42,153,40,30,
+163,0,32,208,128,32,211,170,166,161,40,4,140,65,216,136,34,136,10,197,144,160,165,17,128,58,156,147,50,206,33,10,
+141,20,42,9,150,168,1,4,140,129,40,13,21,60,25,136,154,144,151,193,129,56,143,17,9,1,24,28,136,36,15,194,
+16,184,18,74,176,18,160,137,85,173,130,56,143,18,9,152,148,11,179,133,28,145,40,156,7,91,137,16,138,0,3,139,
+145,2,159,150,128,194,131,28,57,162,139,194,207,240,72,0,34,143,3,24,45,146,184,123,164,12,129,145,11,7,152,25,
+178,9,121,152,136,0,168,26,18,213,24,128,193,48,180,75,75,177,28,6,152,73,128,192,34,241,128,8,178,91,16,152,
+24,144,185,112,193,137,48,232,24,133,138,3,10,139,84,202,40,1,155,16,49,11,244,18,139,82,155,217,133,153,8,52,
+13,129,48,142,3,138,9,34,30,8,149,137,0,18,31,1,27,170,150,160,32,145,137,148,194,56,212,152,16,185,48,92,
+160,2,25,128,114,187,194,75,176,196,104,136,9,40,216,35,27,157,65,139,128,99,200,130,24,152,4,136,218,135,9,137,
+66,139,41,128,9,151,136,11,179,154,164,167,0,144,145,122,144,8,11,177,56,59,147,166,9,245,17,144,161,77,144,9,
+73,193,40,41,248,50,137,168,33,241,0,40,8,9,90,185,21,152,216,64,138,137,19,176,179,112,13,132,137,161,146,11,
+180,97,43,216,18,138,18,60,186,148,16,186,23,11,176,67,47,130,11,153,165,59,9,151,42,152,178,4,131,45,12,161,
+16,27,135,42,137,162,91,130,186,145,146,138,123,182,162,152,131,90,0,169,29,145,177,93,164,153,145,165,16,3,154,26,
+130,14,123,128,146,160,146,32,169,161,189,150,137,76,2,42,29,162,41,131,29,45,160,136,33,164,152,160,150,108,129,10,
+10,195,42,74,165,137,129,144,128,135,13,56,155,58,88,161,17,177,4,121,176,8,153,180,8,123,128,169,17,194,33,128,
+142,106,137,176,88,177,40,44,164,131,162,170,42,216,210,112,152,0,41,152,67,153,202,49,143,145,41,212,131,28,129,16,
+168,25,76,75,138,66,128,210,56,210,5,168,160,24,153,93,58,25,176,16,128,20,209,186,145,26,217,39,26,9,56,154,
+23,154,11,128,139,163,23,41,201,131,88,146,137,251,130,92,171,21,137,152,18,75,130,193,152,148,27,10,7,58,11,162,
+64,160,8,14,211,129,11,5,160,8,0,120,10,184,73,176,145,73,163,225,88,43,131,10,224,72,12,177,49,1,240,16,
+152,150,42,218,18,10,10,99,154,179,4,58,149,170,153,135,43,41,131,42,139,8,114,184,137,29,194,211,49,8,184,90,
+192,21,28,138,56,138,152,21,9,227,25,50,210,137,137,161,90,231,69,0,123,137,133,128,153,41,132,170,194,91,25,185,
+52,49,248,18,138,150,10,169,132,136,26,37,59,141,147,104,155,160,41,128,185,114,145,193,64,136,163,185,186,150,91,170,
+23,154,130,0,33,138,157,123,184,16,73,160,178,131,137,7,156,136,146,26,72,66,108,138,0,64,192,136,42,193,136,148,
+165,146,57,155,37,141,168,33,13,136,4,75,192,147,17,178,10,141,228,33,13,18,144,137,65,145,139,210,24,41,187,5,
+96,172,34,40,209,152,89,153,146,89,177,18,29,146,34,141,184,35,12,144,112,26,216,3,73,153,160,46,163,137,58,151,
+160,72,26,163,168,217,98,155,24,3,24,140,164,65,185,10,75,200,181,105,152,130,11,49,178,45,154,150,57,138,50,25,
+224,130,66,217,137,72,9,153,114,168,1,44,9,149,186,160,5,155,32,6,25,11,144,97,154,27,27,128,230,34,0,242,
+0,16,8,153,186,50,63,155,84,137,152,145,2,161,168,62,196,128,24,35,153,78,9,2,168,137,45,178,209,80,0,224,
+17,25,1,201,153,97,11,152,35,129,144,45,48,197,140,177,3,11,179,99,130,173,130,3,25,15,200,33,169,17,148,130,
+11,148,36,193,14,0,16,154,122,17,152,42,130,145,180,157,59,225,178,120,161,128,8,8,66,154,155,42,208,4,79,128,
+128,12,131,147,168,138,28,147,192,97,2,44,31,146,145,145,11,200,1,178,68,16,128,31,16,58,164,14,152,2,169,5,
+161,131,137,29,18,19,159,184,106,136,8,40,165,161,0,57,52,237,161,32,155,2,40,2,17,143,146,5,152,12,11,193,
+1,26,16,7,208,8,51,24,217,144,92,0,140,17,131,8,128,161,23,152,10,202,144,192,91,123,145,9,40,8,160,151,
+153,41,154,177,128,84,41,240,1,72,8,216,163,137,17,29,176,97,145,59,153,51,74,241,140,0,41,42,163,135,40,154,
+163,4,131,234,155,20,30,137,5,9,24,92,153,3,153,194,137,154,1,181,129,83,40,29,1,137,16,242,45,168,40,0,
+128,97,128,161,90,169,65,14,192,0,145,24,160,120,146,41,25,210,145,32,203,32,187,161,113,196,17,1,12,168,32,129,
+5,15,144,25,145,58,32,8,199,106,9,41,8,227,128,122,168,32,208,152,57,179,83,0,88,168,163,16,24,49,153,240,
+42,10,43,72,3,5,138,128,211,209,132,11,139,1,240,2,129,18,24,45,192,56,3,182,138,138,128,227,136,88,2,193,
+33,29,40,136,170,13,74,154,147,113,128,105,168,137,131,130,57,216,186,50,10,58,248,50,32,140,28,197,129,19,143,162,
+128,136,32,229,34,16,60,154,0,34,160,143,161,10,128,74,162,133,243,1,26,42,147,16,173,33,188,5,76,137,147,145,
+144,176,32,154,21,139,187,180,32,32,79,18,162,11,180,16,135,27,201,58,248,129,8,75,34,161,133,28,16,147,66,216,
+10,161,42,240,19,10,150,26,46,146,25,210,9,12,146,40,199,129,130,56,153,25,137,149,33,30,137,27,192,24,149,137,
+80,209,128,145,72,1,216,9,227,1,42,0,122,137,128,131,58,57,25,59,245,137,136,24,137,147,162,124,146,57,155,0,
+0,167,138,211,129,128,56,28,176,50,28,152,123,178,64,137,185,183,145,192,151,26,128,40,136,8,137,72,17,111,137,8,
+193,161,1,26,128,135,153,134,136,56,59,216,147,10,27,33,31,177,25,209,150,25,129,8,17,129,72,14,145,41,240,16,
+136,25,10,179,150,161,27,20,61,154,165,16,138,18,43,169,177,183,32,129,143,2,57,177,134,8,89,152,164,44,210,56,
+154,192,5,137,161,44,41,24,226,148,16,24,42,130,13,243,0,177,9,1,139,151,153,112,136,168,18,8,107,137,24,13,
+195,1,152,165,16,27,147,157,16,88,59,24,144,37,138,123,8,194,128,184,211,17,31,129,169,146,72,168,82,218,2,162,
+148,41,152,49,171,148,24,44,138,143,74,145,209,3,153,16,153,1,79,192,34,170,151,1,137,131,170,129,10,194,8,244,
+66,10,34,11,240,147,176,147,81,13,131,217,17,122,138,74,184,147,128,128,73,216,147,26,180,72,10,18,139,88,9,144,
+108,209,16,136,161,59,154,88,217,148,40,138,4,11,0,49,242,34,208,49,57,188,6,152,42,152,194,58,218,36,155,42,
+41,198,41,164,32,137,162,41,193,51,31,152,41,240,4,170,17,57,154,77,193,0,24,144,75,160,120,139,34,43,144,113,
+185,40,59,194,16,192,130,98,27,59,41,168,149,144,90,10,65,189,24,32,195,10,150,193,160,252,71,0,144,160,88,11,
+58,26,135,58,184,50,168,73,44,212,129,152,49,179,200,143,168,122,168,40,74,192,49,161,56,74,193,1,179,144,70,137,
+57,9,208,26,13,28,179,58,176,178,49,39,158,5,137,146,40,56,140,17,10,161,63,219,64,202,129,40,1,16,129,8,
+167,8,45,160,96,186,48,75,179,77,193,177,8,1,138,52,170,135,17,90,27,128,136,9,75,227,33,152,154,138,21,175,
+32,137,163,72,74,128,56,27,40,31,232,49,144,26,8,97,217,17,136,130,156,16,250,33,10,137,113,184,19,161,168,1,
+56,171,7,200,52,10,90,176,18,26,218,57,227,136,149,11,176,121,168,49,136,162,74,92,153,40,168,195,89,169,72,147,
+13,24,56,201,33,156,150,152,0,41,26,184,177,107,133,58,48,15,160,65,185,34,242,147,8,129,137,134,60,152,0,26,
+145,163,250,193,80,153,161,32,151,26,17,26,41,154,137,64,158,161,135,184,146,88,152,56,186,6,155,33,28,138,8,212,
+17,40,9,134,9,160,81,153,93,154,162,128,20,45,24,176,179,0,123,58,58,29,224,40,129,75,10,150,169,133,136,16,
+136,8,128,137,61,89,60,140,16,177,64,138,165,168,181,129,144,160,59,184,23,209,3,130,11,64,184,57,244,1,28,130,
+153,24,146,136,129,91,8,244,146,32,14,32,155,25,135,169,104,129,10,179,184,89,128,154,66,217,57,8,164,123,136,2,
+170,1,128,136,165,181,26,146,169,128,5,143,129,211,8,40,3,14,133,153,129,162,11,72,44,24,137,152,50,191,114,138,
+146,1,224,24,211,1,146,160,44,131,153,112,177,137,144,132,10,147,151,162,0,194,74,216,2,153,64,58,44,145,170,163,
+5,141,130,144,249,50,170,96,176,195,129,34,76,11,145,160,249,104,136,26,33,170,73,163,44,16,250,56,192,164,107,161,
+136,178,4,9,130,12,131,10,243,49,169,19,154,58,130,184,56,214,11,209,147,47,1,184,82,193,136,147,224,64,138,130,
+1,176,40,233,0,21,140,136,180,43,149,144,17,9,30,17,25,59,3,252,17,25,145,32,169,5,27,161,18,152,15,1,
+27,197,147,32,168,246,18,192,73,138,179,76,210,32,136,136,41,129,10,147,41,45,168,173,39,44,137,163,19,253,70,0,
+168,4,153,0,162,30,75,144,152,6,43,169,34,242,65,138,131,8,160,65,177,59,65,47,232,147,145,9,224,16,145,45,
+1,0,108,136,8,145,137,41,41,208,130,128,160,231,57,56,12,160,2,12,144,132,17,161,242,74,40,27,18,200,1,60,
+75,62,161,161,3,161,73,136,189,7,9,26,130,1,29,197,8,130,12,144,130,14,132,41,0,29,160,49,11,162,64,187,
+213,128,57,178,3,0,168,243,1,128,29,185,74,25,199,72,26,145,136,2,10,183,24,16,130,140,7,137,32,9,154,4,
+26,28,208,59,136,243,40,33,185,149,162,129,169,42,184,151,74,106,11,212,16,9,136,145,45,154,165,32,147,88,154,144,
+137,135,75,137,210,129,24,200,37,28,145,162,160,3,8,61,130,169,147,112,13,148,11,72,185,152,123,192,33,176,164,1,
+136,75,145,136,162,163,209,24,172,167,49,10,169,163,10,245,1,24,170,90,90,137,129,147,144,122,186,7,137,136,51,171,
+149,147,11,164,176,123,128,154,182,24,75,161,42,58,168,179,4,41,75,138,154,135,27,56,225,1,27,195,160,3,15,186,
+7,59,1,59,107,184,0,105,170,146,18,12,42,243,88,8,27,35,170,57,88,157,17,195,25,57,244,33,138,136,1,185,
+136,148,40,138,23,24,154,192,5,138,8,2,42,44,218,64,41,193,192,66,15,128,128,128,163,201,120,184,163,20,27,161,
+180,90,128,10,120,160,24,48,224,24,163,61,137,196,32,10,185,37,154,152,64,200,194,131,24,242,16,25,136,10,197,64,
+138,16,139,96,153,137,91,243,2,26,0,40,170,27,167,168,20,27,176,82,30,163,161,33,161,25,123,195,90,136,9,168,
+167,40,152,9,1,61,217,18,168,48,74,136,176,164,73,10,137,180,37,157,1,152,41,147,140,89,216,33,28,181,16,152,
+29,0,243,64,9,136,1,11,131,160,57,3,40,28,23,43,91,169,160,148,76,137,217,104,26,177,128,2,169,17,42,196,
+32,31,41,201,149,32,136,42,211,43,146,192,139,7,43,8,195,19,138,157,148,227,16,0,153,34,248,35,128,62,8,152,
+194,151,8,24,25,153,66,156,149,160,42,58,185,168,0,149,34,17,186,55,14,0,192,129,57,155,193,36,12,24,196,43,
+145,245,65,0,210,10,40,133,57,136,59,248,48,153,67,11,78,10,1,40,14,4,128,74,160,146,0,10,242,1,40,184,
+44,192,130,147,249,47,129,130,11,181,104,153,58,152,146,26,17,9,13,51,225,0,224,73,152,18,194,80,136,41,202,17,
+9,215,1,57,192,136,1,33,13,161,145,162,93,9,9,178,180,148,129,61,163,172,6,9,139,81,184,18,200,121,160,24,
+128,136,28,151,25,8,216,130,88,185,48,11,161,51,13,8,120,202,3,160,18,76,9,185,134,152,162,130,61,210,18,139,
+147,93,184,17,24,168,57,57,250,106,137,8,8,121,168,17,11,166,41,177,72,154,133,8,128,41,72,10,227,160,178,185,
+120,9,129,122,170,41,56,13,129,146,25,208,81,170,17,63,152,56,139,148,72,10,48,46,144,163,1,153,182,64,154,33,
+8,240,34,44,144,79,168,1,9,178,40,0,140,73,2,141,25,40,171,37,140,161,37,185,122,40,9,10,133,25,130,43,
+144,211,94,185,147,41,226,16,144,136,90,137,41,164,13,17,24,158,129,73,202,66,11,1,123,160,0,0,41,10,198,17,
+200,136,25,170,123,168,131,3,27,5,144,56,75,195,64,211,154,212,146,8,2,123,10,162,136,32,9,178,1,40,7,233,
+169,8,76,17,1,168,65,158,129,148,1,16,162,96,233,184,8,129,123,131,169,16,157,24,17,146,8,227,48,177,175,25,
+81,26,132,144,137,169,49,17,120,192,1,0,128,60,205,41,49,18,26,234,192,41,2,166,8,16,137,120,136,200,12,18,
+33,193,16,184,142,50,41,9,195,171,123,132,41,240,185,83,0,153,0,224,24,34,24,17,13,176,114,42,136,192,156,50,
+0,178,8,172,41,81,43,176,104,27,160,64,75,208,138,16,7,8,146,186,28,50,177,136,43,167,28,166,16,59,242,27,
+48,129,59,129,205,32,16,56,105,170,148,0,162,20,93,176,45,41,146,8,144,156,10,54,170,25,216,146,104,178,136,89,
+160,156,132,131,152,0,170,178,122,196,129,160,162,89,129,200,91,149,155,25,34,42,8,171,185,113,165,128,25,32,93,145,
+179,43,135,154,170,83,153,130,136,201,122,128,24,138,136,60,2,179,172,5,131,234,75,32,178,57,161,47,25,32,139,181,
+169,0,23,156,77,225,76,0,130,56,194,143,0,19,11,17,171,59,53,9,0,56,173,101,9,138,56,16,141,141,35,136,
+194,145,232,0,33,128,59,217,16,90,211,28,3,40,251,17,129,162,40,137,15,48,129,169,164,139,41,23,187,130,114,218,
+25,1,146,40,137,140,34,149,196,163,1,12,20,201,162,112,184,137,16,1,137,148,186,42,4,216,150,136,12,50,138,177,
+115,136,156,90,129,24,146,154,12,36,169,129,2,191,21,139,130,89,176,139,11,82,161,4,153,13,33,3,17,166,156,17,
+74,145,65,194,250,26,66,153,49,171,171,32,194,133,132,173,33,27,165,2,147,204,74,24,128,51,155,159,129,177,133,4,
+186,17,156,49,50,186,159,136,145,6,18,202,24,43,1,135,35,184,0,31,33,155,11,41,226,64,226,0,136,9,11,18,
+145,6,168,74,42,0,220,147,9,48,38,153,42,248,153,72,128,17,51,249,41,161,140,11,195,26,39,26,153,32,173,58,
+66,147,7,41,137,17,249,137,178,131,93,129,41,160,12,170,64,8,147,2,165,152,129,189,46,160,18,121,130,42,177,157,
+144,56,42,7,161,0,32,169,175,58,200,2,128,52,137,180,172,136,41,121,133,2,40,2,153,249,27,240,2,128,18,8,
+147,159,136,25,59,2,160,7,146,144,241,44,169,130,56,50,48,72,142,169,8,156,19,2,133,134,26,184,31,184,146,27,
+66,25,5,208,146,58,156,132,145,134,17,40,16,143,177,137,169,1,151,33,0,141,130,169,176,65,138,52,11,114,158,163,
+26,176,122,144,2,128,146,41,155,58,58,15,133,40,226,73,169,161,10,40,136,36,153,150,91,41,27,177,64,147,91,216,
+2,28,202,148,152,65,8,42,10,165,74,137,8,128,151,144,74,248,146,58,176,73,129,40,9,66,188,82,140,33,43,181,
+152,181,59,169,179,138,121,161,18,0,17,143,162,194,149,49,232,64,185,193,88,184,2,73,137,56,176,243,32,41,168,132,
+40,219,133,11,193,80,10,144,136,164,130,146,50,143,0,152,106,185,128,17,136,159,3,154,193,73,177,51,201,51,190,19,
+152,132,78,8,8,129,176,24,137,177,53,144,151,2,161,107,40,168,24,34,140,3,28,244,59,137,129,234,35,136,161,105,
+200,24,193,1,163,72,61,0,166,36,72,0,234,2,25,152,160,179,48,182,57,242,136,8,50,29,34,141,145,16,192,152,
+178,76,202,150,162,3,62,137,17,25,179,64,155,0,89,28,192,177,242,17,10,1,105,192,152,18,8,179,124,137,17,232,
+34,138,178,138,150,40,170,34,245,0,0,32,154,51,156,131,25,9,9,11,15,211,0,195,120,137,128,24,129,1,58,177,
+42,123,138,226,128,208,73,17,139,16,132,12,128,9,150,73,201,131,209,32,201,48,187,133,28,147,24,164,44,40,46,211,
+18,169,34,10,12,136,41,202,181,89,17,90,139,147,34,11,16,78,152,32,31,153,130,24,9,45,131,162,90,48,156,19,
+203,92,136,210,136,133,44,176,32,144,2,138,148,16,50,255,130,144,211,40,136,1,129,154,48,32,235,4,74,169,26,210,
+147,0,192,50,73,1,200,82,209,40,26,4,159,129,8,169,35,171,98,177,1,186,7,8,50,63,170,139,196,16,153,32,
+137,23,202,3,136,132,75,145,42,187,42,140,210,130,66,74,160,152,151,17,8,35,157,216,25,9,3,25,93,130,9,249,
+34,8,162,34,250,153,152,0,228,32,0,99,171,162,168,36,25,147,141,249,32,208,16,0,34,170,147,46,1,32,8,180,
+142,154,162,65,218,5,56,144,26,26,146,50,24,150,43,223,162,48,232,66,25,160,25,168,40,131,72,226,26,15,33,169,
+1,144,5,11,160,74,153,51,135,140,192,91,154,133,24,129,2,155,208,72,42,162,35,235,8,91,11,146,64,0,133,11,
+26,48,139,150,34,220,139,34,26,139,54,11,165,138,26,4,88,58,199,26,139,1,8,145,34,89,217,148,30,129,56,152,
+147,155,24,168,72,140,5,16,176,138,147,122,129,72,233,144,75,0,16,9,134,1,171,184,135,59,3,18,190,162,13,0,
+128,89,129,150,10,162,42,160,48,144,13,248,129,26,48,141,18,145,194,48,148,48,17,209,248,171,130,89,169,83,43,150,
+25,154,2,0,19,5,142,184,164,43,9,49,186,23,73,170,18,160,75,146,249,144,40,186,23,139,130,8,17,59,228,49,
+170,112,208,25,153,179,27,133,57,73,176,146,128,132,79,153,17,170,181,88,10,136,9,130,1,0,33,52,31,186,83,202,
+129,17,137,57,144,31,224,147,42,48,41,42,50,14,65,0,248,17,154,6,10,136,49,234,8,197,24,168,33,15,3,136,
+8,146,128,26,40,48,209,73,248,35,154,43,153,148,58,19,138,59,134,138,24,6,199,41,24,128,155,181,43,228,40,60,
+144,0,43,199,32,153,18,9,1,11,164,157,151,27,162,89,155,2,145,136,162,64,12,16,136,166,29,179,88,9,24,152,
+19,45,17,0,31,42,161,171,133,151,43,136,131,44,146,157,150,40,44,162,145,9,197,41,193,16,152,32,141,148,139,98,
+140,0,58,242,17,128,128,145,145,145,138,167,64,141,18,26,136,9,128,145,0,92,195,211,144,135,10,152,67,29,8,8,
+8,72,202,56,25,25,128,227,210,4,11,130,28,160,120,200,18,139,88,208,0,0,162,43,179,34,139,4,172,1,40,80,
+157,120,26,145,161,2,27,9,128,146,216,43,83,184,47,21,172,128,36,186,96,184,56,8,200,96,169,144,82,156,19,186,
+179,32,242,2,200,104,152,24,25,17,31,1,27,129,90,137,161,56,40,208,29,183,16,136,56,13,128,129,10,133,11,48,
+184,25,122,228,56,139,165,74,176,16,8,16,24,137,16,79,9,244,3,75,144,234,8,180,129,146,144,80,194,48,12,169,
+161,52,60,40,9,184,128,156,151,26,145,61,152,148,56,59,8,29,41,160,0,37,162,141,184,151,123,168,32,128,34,15,
+32,154,25,201,50,203,148,128,147,46,130,29,162,25,180,18,203,132,8,169,150,161,181,48,137,27,24,16,25,159,135,26,
+160,17,176,4,216,65,139,4,31,178,56,186,50,156,7,10,163,57,194,8,34,141,165,89,154,1,154,35,143,146,24,152,
+1,155,133,11,133,59,169,99,137,9,17,152,164,218,3,152,65,143,148,60,193,88,170,2,137,181,32,139,135,10,177,34,
+139,147,1,160,151,137,132,128,192,164,9,184,16,153,17,191,52,153,18,26,165,33,137,62,164,28,209,129,153,194,50,42,
+140,97,16,25,41,192,147,188,152,73,248,1,26,3,42,20,91,224,50,201,145,177,170,133,26,97,128,1,178,18,192,147,
+16,31,249,9,193,24,131,9,7,137,0,16,10,210,32,156,1,31,48,169,97,177,32,10,160,17,220,146,28,180,9,132,
+128,195,72,25,10,50,250,19,157,33,44,145,18,56,210,49,232,58,70,0,157,4,28,185,129,143,0,17,161,131,196,56,
+128,75,147,242,107,155,32,27,2,73,161,41,56,252,4,128,10,226,24,137,17,25,146,145,140,163,96,209,1,43,27,77,
+154,5,129,33,144,176,128,164,97,249,130,44,192,89,152,1,42,184,1,160,21,41,242,129,139,148,25,34,60,161,31,177,
+17,128,19,200,210,137,136,17,88,44,162,30,137,129,36,12,165,41,184,177,66,24,82,128,26,29,169,74,197,18,140,228,
+137,130,16,24,146,26,128,30,41,19,28,197,145,153,128,73,5,12,131,9,15,128,105,128,145,43,200,136,160,132,166,32,
+170,9,12,19,97,57,217,146,169,129,83,48,128,177,143,160,8,121,1,169,41,248,136,130,33,147,160,185,138,14,96,64,
+24,184,28,217,8,4,66,154,131,235,144,32,90,16,16,189,17,142,33,16,131,154,210,139,57,128,87,136,18,157,145,28,
+147,72,131,138,156,192,154,36,32,9,66,175,178,10,5,32,145,26,186,233,19,73,6,11,148,28,201,32,16,162,164,169,
+137,14,32,8,7,24,184,57,159,17,32,48,225,8,176,128,99,136,130,17,207,2,27,16,4,139,168,145,188,20,49,34,
+73,202,30,192,58,20,136,18,204,147,203,66,56,162,72,235,40,140,50,8,48,250,9,209,129,3,130,144,129,159,32,60,
+106,1,128,153,129,172,53,185,135,8,208,57,233,32,1,128,16,141,136,25,17,133,145,24,173,0,11,36,34,145,159,25,
+193,72,130,34,12,194,15,160,32,0,34,168,173,130,203,37,1,1,65,221,48,154,66,129,128,128,157,9,72,162,65,226,
+152,29,193,73,130,146,17,219,24,139,66,0,3,41,249,63,169,33,1,3,139,140,138,16,52,144,2,233,205,147,57,34,
+33,160,159,137,28,98,128,19,146,220,16,138,97,146,74,168,169,12,132,41,16,163,202,233,195,88,16,25,1,173,0,58,
+88,130,8,163,190,0,43,133,133,24,216,26,154,33,3,0,120,171,170,184,23,17,1,176,11,241,48,35,0,131,46,191,
+148,26,19,128,9,168,220,40,35,25,4,57,207,18,14,18,128,136,145,156,16,42,39,138,147,26,143,161,33,133,136,194,
+11,10,90,32,130,163,169,251,178,90,19,137,135,140,0,138,4,17,169,151,28,39,79,0,171,129,73,152,21,10,218,17,
+154,52,41,24,146,206,16,138,20,0,16,234,160,17,32,19,79,128,202,58,136,112,145,40,170,58,27,3,23,11,18,252,
+8,152,129,150,137,162,13,144,32,163,80,136,216,91,216,65,128,137,146,170,51,28,6,145,129,168,11,197,56,150,9,178,
+44,8,25,48,163,121,201,75,192,40,130,184,148,188,133,24,130,0,1,248,59,208,96,128,9,129,156,2,161,67,184,1,
+161,143,145,35,144,137,197,29,146,161,38,153,40,210,29,160,32,33,13,0,155,17,240,5,152,1,192,10,195,40,132,28,
+178,27,56,184,68,160,32,242,28,128,56,33,184,149,157,34,27,6,168,17,211,142,132,9,18,137,145,184,19,74,22,169,
+34,216,157,131,42,68,156,131,141,145,24,19,160,0,213,13,146,41,34,169,56,159,1,168,38,153,128,195,15,146,9,5,
+137,40,156,128,130,72,160,49,217,11,163,29,38,154,50,188,56,8,49,129,133,193,159,130,28,4,168,19,218,41,8,73,
+161,34,25,205,56,31,34,184,4,184,43,145,80,161,48,168,248,59,13,97,152,48,233,16,168,32,32,168,81,249,24,138,
+35,32,73,201,57,192,64,130,136,41,249,60,200,48,131,24,217,41,169,40,21,57,1,185,175,196,40,147,48,242,25,168,
+24,66,184,83,153,15,145,27,132,162,18,170,169,44,4,27,135,1,188,147,46,17,146,34,210,153,168,18,40,34,76,227,
+31,176,17,8,32,2,141,176,136,131,20,162,113,250,130,12,131,25,34,169,25,158,16,0,89,144,5,143,162,59,162,16,
+163,131,201,59,178,153,39,91,131,14,211,57,184,35,128,16,200,28,136,140,36,16,161,154,230,8,160,33,130,8,181,42,
+201,40,58,66,240,80,155,146,9,162,18,184,146,17,174,81,168,105,200,128,41,184,112,1,160,32,187,149,0,132,65,184,
+40,155,10,188,18,122,152,130,73,248,24,152,83,140,164,24,161,58,177,17,137,141,122,232,48,129,144,8,185,106,201,34,
+32,152,152,184,25,57,210,112,193,16,25,162,45,1,98,144,0,46,177,16,146,148,8,250,41,201,2,19,144,168,142,18,
+155,38,75,208,131,140,161,16,144,6,152,43,144,9,112,168,1,169,152,46,240,34,41,184,123,237,65,0,133,154,137,17,
+146,85,25,184,170,97,43,5,8,17,26,187,165,40,202,178,165,27,60,225,132,25,122,168,129,10,24,1,145,152,40,238,
+17,160,130,19,1,25,157,77,152,32,76,137,201,40,11,17,167,152,134,28,8,17,129,58,80,144,25,152,120,144,130,161,
+209,185,10,51,219,19,42,173,200,66,1,24,161,246,130,136,0,146,42,9,240,25,26,64,9,8,41,159,168,20,17,11,
+4,176,143,145,8,130,73,40,42,138,79,83,9,1,2,250,148,8,146,196,0,170,161,58,136,16,228,16,27,25,154,134,
+32,186,183,177,130,0,145,18,75,140,30,137,99,42,170,201,26,161,137,55,128,136,144,15,10,35,35,47,181,25,16,40,
+16,162,122,152,24,129,184,135,250,146,9,26,41,51,140,130,195,140,211,40,165,16,169,168,208,179,53,170,5,152,29,181,
+24,148,155,145,153,107,25,34,241,24,210,153,133,8,64,152,129,27,17,40,18,134,26,183,75,9,138,127,168,161,145,211,
+17,24,184,4,200,1,197,107,144,128,136,162,42,0,41,40,43,216,180,63,194,17,186,22,171,131,144,162,146,176,135,31,
+164,26,195,18,137,129,41,144,48,241,133,28,194,2,169,146,25,162,195,122,192,32,128,14,164,128,25,129,57,25,0,250,
+20,156,65,170,130,147,154,147,58,137,57,210,241,80,9,12,82,11,32,155,24,57,146,235,7,27,16,153,56,41,92,152,
+42,43,28,211,147,132,60,202,67,13,0,25,128,77,26,129,40,160,120,171,65,153,152,146,195,107,154,49,13,49,41,171,
+121,144,177,164,149,170,3,12,41,9,34,193,125,128,160,34,160,139,211,58,249,40,169,132,123,0,145,1,17,10,30,209,
+40,232,17,26,90,24,136,131,17,162,168,123,192,43,234,196,57,0,40,58,33,15,144,152,145,200,129,24,31,147,8,161,
+135,24,0,59,2,14,147,41,138,164,161,129,148,130,115,15,2,154,18,89,187,34,157,168,145,5,152,104,136,176,4,40,
+203,5,29,138,129,32,137,19,16,40,139,38,207,149,75,153,0,24,152,16,16,16,129,36,222,148,25,10,136,24,0,139,
+50,60,211,33,250,164,42,154,144,1,49,138,69,76,201,4,233,18,152,144,16,154,180,56,56,122,8,32,14,23,70,0,
+208,162,178,0,58,233,4,225,56,40,11,65,233,132,25,10,8,210,162,35,28,34,136,96,193,18,141,8,43,219,146,147,
+154,5,10,48,241,80,200,57,44,168,129,152,165,40,40,26,229,18,162,46,137,178,42,161,64,26,147,17,244,33,162,187,
+132,43,31,144,56,176,81,42,241,3,161,145,41,11,169,165,106,0,106,42,209,32,145,176,44,242,152,146,9,3,93,25,
+194,90,145,128,43,210,136,0,169,21,9,2,195,77,16,136,186,148,138,153,193,36,184,21,195,62,0,8,217,18,12,8,
+192,3,161,33,135,45,131,24,216,64,139,128,168,130,136,41,7,31,130,144,162,58,218,8,8,24,65,139,54,142,130,129,
+162,26,192,10,43,168,21,26,101,141,130,144,147,10,24,13,138,161,4,176,120,168,19,128,17,140,104,172,0,176,133,130,
+122,160,1,1,75,160,43,200,138,243,0,146,122,168,146,48,28,146,139,3,159,130,153,149,32,225,3,58,152,148,169,122,
+139,25,176,4,58,144,18,27,183,34,139,109,171,0,177,106,57,169,35,153,198,65,160,75,193,9,145,73,32,155,22,170,
+150,42,179,11,183,26,24,12,18,200,81,168,129,25,133,156,4,141,130,168,34,185,120,152,18,171,38,171,65,157,1,225,
+49,184,105,136,8,144,64,185,73,169,25,211,56,227,73,161,1,136,80,160,91,176,41,193,41,165,45,164,25,144,24,164,
+44,129,14,145,152,4,140,133,25,161,8,4,12,48,142,130,11,19,173,52,10,145,128,18,156,120,218,18,154,49,155,97,
+185,147,9,49,176,79,192,40,169,51,200,120,161,32,138,130,146,12,163,15,193,147,144,56,131,76,208,1,1,217,65,141,
+161,32,137,90,49,14,163,41,0,184,122,201,2,153,146,41,49,216,51,140,32,193,63,210,41,168,129,25,129,165,56,208,
+19,146,60,162,15,195,24,16,59,18,62,243,1,128,137,89,172,131,137,24,41,81,140,165,24,129,136,74,240,32,202,33,
+136,72,176,3,10,20,137,29,227,42,242,16,136,16,128,72,169,19,137,168,88,15,210,57,144,41,130,0,179,52,9,0,
+111,187,149,27,1,8,0,178,130,24,179,80,15,226,128,153,131,8,33,178,107,152,164,105,153,129,171,192,17,160,66,20,
+57,20,69,0,45,178,1,24,186,121,235,129,8,1,9,52,188,135,128,0,168,91,241,40,137,129,24,80,152,3,152,150,
+136,11,214,59,144,0,136,18,160,72,152,48,40,175,150,13,179,24,160,17,164,24,164,106,8,169,82,159,130,9,161,49,
+9,136,165,41,164,8,92,249,17,138,162,41,1,136,2,73,162,90,41,242,91,176,0,25,130,136,130,243,19,43,168,161,
+159,213,32,138,34,59,200,132,0,136,148,43,173,151,10,178,121,153,3,26,0,16,144,26,240,41,240,17,42,129,128,178,
+120,169,113,139,162,58,242,56,137,0,129,0,128,131,123,232,33,171,132,45,160,32,177,33,136,56,26,241,32,155,17,218,
+97,186,6,27,163,73,177,145,72,157,2,155,130,128,48,248,113,169,35,171,19,157,131,140,131,137,66,154,35,10,51,245,
+109,200,33,154,130,9,32,153,34,154,19,241,106,169,40,209,89,192,64,153,17,136,128,145,75,192,57,209,41,161,122,160,
+73,177,48,160,10,145,29,177,41,165,107,128,136,18,26,198,91,176,57,153,146,40,8,57,228,33,152,180,9,136,14,195,
+106,176,64,9,194,72,144,162,42,168,27,33,143,4,45,162,91,128,17,194,24,169,34,28,208,4,139,130,129,91,10,151,
+47,193,16,137,129,8,0,136,33,138,179,37,159,33,140,147,139,167,41,136,49,13,18,128,155,132,13,0,138,17,25,167,
+74,243,40,145,137,16,138,129,138,134,176,133,72,25,155,39,29,146,25,137,0,184,147,137,177,16,240,82,154,178,10,151,
+14,148,9,1,8,138,131,91,176,2,243,17,138,1,202,135,155,151,25,25,130,11,148,128,136,16,240,129,160,147,140,3,
+158,150,8,1,56,26,130,153,183,16,161,137,48,155,224,23,13,163,41,168,48,169,130,168,26,144,240,50,13,72,186,23,
+141,132,9,144,48,185,147,179,9,74,155,17,156,38,251,6,139,148,136,162,73,137,8,146,153,162,137,0,138,67,245,37,
+141,19,139,149,25,144,41,144,59,10,244,0,168,2,233,99,171,19,11,129,75,152,0,65,140,32,240,2,168,16,241,104,
+169,1,24,8,25,16,154,145,129,176,214,56,136,30,179,120,185,50,11,8,89,200,48,169,3,171,23,24,16,58,240,122,
+153,129,8,152,138,253,71,0,40,186,65,137,16,25,181,91,9,24,193,124,168,41,26,1,137,151,32,170,32,10,153,25,
+107,139,1,124,225,34,26,176,32,160,73,170,16,152,31,34,139,75,17,79,193,33,153,146,0,40,63,128,145,0,148,8,
+61,30,162,27,199,40,154,1,144,1,73,8,10,106,193,144,49,141,129,47,180,24,129,128,40,45,152,162,57,136,42,10,
+51,206,135,44,179,60,177,148,44,128,45,177,19,27,164,72,129,138,135,152,147,76,12,162,56,176,24,195,41,11,210,2,
+42,242,137,26,135,45,145,1,42,129,155,151,8,136,177,57,32,217,19,143,134,27,161,147,169,134,153,1,11,195,147,169,
+53,202,66,141,165,25,193,32,137,132,144,50,128,162,48,63,152,193,42,175,7,11,130,152,128,24,10,89,176,131,25,62,
+27,168,115,233,134,9,128,25,152,17,169,16,136,138,83,202,50,232,34,204,135,9,136,0,9,48,29,144,1,9,132,11,
+0,162,216,242,53,13,1,128,24,24,144,43,9,160,244,0,26,160,122,241,33,154,18,27,144,72,224,40,136,144,0,164,
+91,177,72,248,34,140,130,26,145,57,170,98,169,163,33,40,31,145,0,250,97,139,128,40,176,72,194,33,152,146,132,201,
+49,196,57,208,65,202,33,9,168,106,211,9,16,185,129,73,137,129,124,192,65,154,147,184,130,144,180,91,146,210,40,163,
+12,16,123,232,72,160,0,9,129,27,18,25,75,184,104,201,25,148,60,209,80,193,16,129,16,44,48,187,32,180,8,57,
+13,179,29,199,40,160,57,153,0,11,4,12,32,162,152,151,144,16,63,228,41,178,24,25,129,42,144,211,130,137,58,196,
+154,135,43,161,60,147,12,179,5,13,17,168,152,165,56,129,144,37,12,151,58,162,44,193,145,154,4,136,138,133,186,131,
+209,65,47,195,43,163,152,162,132,59,147,128,178,133,30,162,10,0,174,135,137,2,136,177,132,27,32,169,153,167,153,88,
+225,64,138,149,27,164,144,0,146,152,56,139,7,24,146,24,155,2,207,6,141,147,8,169,135,153,2,57,154,165,162,1,
+240,210,165,129,25,40,27,0,0,186,134,152,24,242,180,177,19,108,138,18,170,131,8,10,121,248,3,200,34,60,137,57,
+176,19,234,148,25,208,148,176,53,216,77,0,35,44,25,74,185,1,2,227,121,201,167,8,27,56,137,73,138,3,145,183,
+184,226,33,130,43,40,8,16,143,32,136,26,61,185,17,16,111,42,8,155,148,40,9,1,8,193,16,169,73,31,2,75,
+145,177,132,27,31,185,36,57,47,42,8,25,164,10,178,149,0,232,17,75,46,128,161,160,134,9,8,145,178,182,8,56,
+47,160,32,0,130,153,226,2,59,225,16,154,91,137,130,161,20,32,122,11,56,240,145,129,137,0,136,8,197,145,177,145,
+144,247,16,25,44,1,0,136,194,24,1,138,147,199,40,65,31,136,145,145,0,74,152,186,195,178,124,41,42,163,165,8,
+136,24,43,141,212,180,105,74,9,16,145,153,129,11,137,10,213,164,72,59,152,4,145,185,161,139,29,157,147,167,89,24,
+8,131,152,248,128,9,152,134,128,131,58,26,91,160,185,146,186,144,90,210,133,178,40,104,200,17,140,128,0,42,19,163,
+106,212,56,72,137,8,168,248,57,138,49,19,144,242,46,106,138,152,163,145,8,72,43,64,177,179,125,136,217,2,41,12,
+131,136,25,147,185,23,73,75,203,144,2,9,89,161,41,26,250,5,74,9,168,24,154,73,41,132,67,171,144,149,0,184,
+164,123,139,25,24,41,0,168,172,71,77,170,179,0,26,80,25,42,1,203,24,23,28,44,0,170,1,2,169,4,146,15,
+56,22,30,26,160,138,65,16,168,131,10,175,50,5,30,25,161,28,32,24,136,19,177,173,36,5,139,25,136,143,33,57,
+12,41,178,250,56,5,138,9,129,251,18,48,137,72,136,204,8,53,138,161,129,15,144,2,165,24,58,169,13,80,8,162,
+129,172,212,8,18,129,136,24,251,40,73,132,16,156,163,154,165,66,25,144,209,41,47,2,1,173,164,177,136,81,152,128,
+161,16,143,32,66,202,163,153,194,56,66,195,137,2,175,128,98,153,150,9,137,10,32,18,160,195,153,209,92,128,150,9,
+136,11,136,66,17,0,187,195,106,240,20,0,137,139,8,8,17,5,202,162,9,249,50,41,49,143,153,24,152,22,160,179,
+128,248,17,128,19,26,171,30,138,68,10,148,160,242,24,137,19,1,8,29,14,73,9,130,40,241,25,160,17,1,131,209,
+192,74,9,5,17,193,106,139,41,136,2,128,53,28,69,0,232,136,224,132,1,210,16,138,42,25,4,56,12,60,189,6,
+24,145,73,154,25,171,6,129,128,26,249,0,64,129,76,152,137,185,35,97,42,9,248,160,32,147,75,195,0,185,2,49,
+131,56,231,136,9,2,106,8,9,249,1,24,129,56,201,75,140,32,40,179,0,240,168,19,72,32,243,168,217,36,60,1,
+153,225,1,25,41,17,242,161,138,64,76,129,168,178,137,40,74,1,181,107,13,16,26,133,8,128,43,137,17,66,229,24,
+154,25,40,133,11,8,28,26,161,134,194,57,13,90,137,67,138,137,11,194,19,18,181,13,168,123,8,148,152,41,29,9,
+148,129,146,170,240,72,128,3,170,72,31,9,2,146,163,15,160,3,4,2,157,129,137,25,6,137,129,15,43,73,196,17,
+139,128,153,131,134,152,181,139,129,112,177,129,154,33,29,2,180,177,74,143,0,4,177,41,170,17,90,18,160,241,193,75,
+33,161,243,0,137,72,24,178,179,156,91,41,134,152,160,43,128,65,17,152,189,233,67,41,129,171,227,24,1,81,25,201,
+225,0,82,137,184,144,161,73,4,40,216,200,24,34,34,206,163,25,48,56,164,160,219,24,21,162,42,159,128,16,5,137,
+163,13,42,36,146,234,40,172,19,32,33,156,185,62,20,130,185,171,63,152,21,24,160,173,48,112,128,152,137,139,121,144,
+18,169,12,42,38,128,192,10,41,43,121,210,145,10,32,33,132,170,10,27,90,18,106,249,128,58,34,194,177,11,8,57,
+69,168,139,250,89,72,8,208,145,8,48,26,3,158,138,130,115,8,155,161,24,42,38,153,168,250,56,132,17,141,74,145,
+44,20,26,184,153,24,84,226,8,9,129,17,24,155,200,219,96,33,138,224,24,138,83,144,73,171,152,18,21,43,171,241,
+41,4,136,2,156,202,5,2,24,30,169,129,64,144,18,171,31,2,130,130,157,10,32,166,41,181,185,42,114,161,48,169,
+28,50,160,6,10,12,28,96,8,200,128,152,130,3,136,228,139,0,5,72,138,141,41,163,131,166,192,160,60,3,131,139,
+28,59,42,53,144,216,202,33,32,135,184,29,73,168,65,177,176,160,9,116,192,161,128,89,58,130,136,227,8,8,113,177,
+186,1,163,123,128,128,185,216,49,21,170,136,11,144,113,40,68,25,74,0,138,137,248,1,7,152,153,48,139,49,0,40,
+142,170,50,135,154,178,177,35,57,42,15,43,142,68,160,169,25,194,2,7,137,24,138,30,21,128,152,26,138,2,180,131,
+25,175,60,18,211,9,0,27,56,164,213,130,27,62,16,177,209,40,8,49,185,2,247,8,74,40,153,176,147,40,32,17,
+177,244,217,49,40,137,10,240,17,24,41,131,249,179,2,88,152,10,8,136,52,41,137,208,248,2,3,168,141,153,18,169,
+71,11,152,9,137,71,192,8,168,8,16,195,81,185,154,96,130,8,201,40,186,113,145,176,148,216,48,50,172,145,152,121,
+41,169,16,240,137,34,51,13,185,133,24,81,137,56,171,251,66,129,152,11,193,145,66,40,138,15,153,145,53,169,168,43,
+150,16,8,66,174,155,22,146,27,26,161,40,34,40,242,45,139,83,129,152,15,136,1,1,130,137,251,60,19,146,153,9,
+14,18,4,179,165,155,123,57,146,185,58,153,46,20,160,193,208,123,24,136,160,129,42,17,57,170,182,217,3,120,160,10,
+146,11,122,2,11,225,152,2,82,10,152,139,8,97,0,40,220,193,17,35,138,154,160,29,52,195,56,202,171,22,19,8,
+176,138,24,109,146,144,138,248,74,2,136,194,160,27,98,25,163,202,241,17,24,147,185,146,137,106,50,10,242,186,18,64,
+177,162,11,33,106,32,58,250,176,75,49,146,234,17,29,136,52,137,137,171,17,120,149,9,138,16,60,66,0,248,8,155,
+22,136,128,11,169,107,17,128,130,220,138,135,147,8,176,176,26,112,129,136,168,240,17,19,136,170,241,32,25,120,136,200,
+0,152,81,178,145,186,176,81,162,88,193,154,76,130,34,210,73,185,24,35,129,107,171,142,18,131,0,170,58,159,34,18,
+16,159,177,136,5,145,130,155,9,77,24,99,203,27,17,8,129,165,128,240,33,128,163,41,249,42,2,0,136,178,248,178,
+113,177,11,40,128,152,18,109,144,9,3,135,9,184,64,170,129,161,133,137,169,83,169,201,109,136,8,128,146,153,20,25,
+164,203,145,2,129,44,130,47,1,184,85,208,155,17,132,162,73,171,91,41,129,132,217,10,25,132,138,151,26,137,64,26,
+150,216,33,8,8,18,240,3,26,153,112,185,161,161,18,138,65,171,32,179,160,2,62,0,139,117,153,140,164,177,65,153,
+58,179,144,56,113,10,28,27,228,129,146,43,0,196,44,23,12,8,25,137,130,224,49,169,153,21,144,16,42,194,92,17,
+169,1,129,175,67,176,136,19,158,19,27,140,150,153,32,25,136,19,233,17,58,197,91,128,168,24,40,141,148,136,8,33,
+141,151,9,161,16,152,89,178,185,99,42,14,2,177,138,147,162,73,77,177,43,163,123,25,128,243,48,155,21,139,25,193,
+177,65,137,58,136,167,59,147,105,140,48,154,180,48,26,31,152,4,153,144,96,138,11,7,170,33,0,31,0,1,184,2,
+136,74,141,150,152,165,152,36,13,8,1,11,82,139,57,17,185,49,214,25,29,72,218,4,137,176,1,154,130,145,26,137,
+13,81,138,73,216,114,155,20,138,146,32,152,1,34,240,34,184,49,168,36,251,97,12,2,153,161,128,178,91,144,128,10,
+164,17,16,19,251,99,172,66,28,160,136,129,177,16,76,59,185,177,165,65,248,72,171,66,153,160,16,162,1,144,35,142,
+184,18,169,125,209,48,217,3,42,128,137,179,9,177,177,122,9,136,183,89,210,32,185,51,30,1,138,2,17,153,134,168,
+165,9,2,91,225,32,203,35,28,16,25,184,19,170,64,41,212,57,141,56,228,64,170,3,25,17,26,9,26,142,146,16,
+181,74,170,24,198,96,185,32,10,176,73,152,24,60,129,184,23,74,225,56,193,72,192,40,28,129,40,144,144,2,168,140,
+167,0,139,78,176,90,152,130,152,5,26,33,128,154,91,170,48,47,145,44,242,73,161,72,137,130,58,26,58,173,0,168,
+8,112,161,46,165,40,177,48,59,170,154,33,13,242,149,136,32,34,144,92,195,170,165,0,186,131,12,129,56,132,145,212,
+149,25,26,155,243,58,194,2,56,32,157,132,34,153,28,240,145,27,1,25,132,91,177,48,2,195,157,213,128,58,24,10,
+25,3,180,41,7,60,216,0,145,73,168,32,25,163,133,139,35,154,203,248,148,31,145,16,41,2,160,0,42,148,30,242,
+161,24,9,17,120,10,164,8,129,129,31,168,194,129,41,194,50,169,2,162,133,156,49,143,168,181,24,164,18,25,89,192,
+19,216,18,31,8,169,4,152,130,3,28,178,2,249,2,15,25,144,49,201,134,26,1,8,62,22,75,0,136,227,145,27,
+76,136,49,170,149,128,89,10,4,174,166,25,41,144,40,9,129,160,66,153,133,174,164,25,32,142,4,10,129,3,137,17,
+145,173,135,154,1,137,66,13,34,12,161,8,162,199,0,28,40,13,49,168,17,177,8,177,23,140,65,31,9,128,16,177,
+40,136,88,154,50,201,124,170,3,171,51,184,107,18,29,146,56,216,105,185,129,176,80,160,50,9,9,180,60,20,15,145,
+8,200,72,145,43,2,139,195,104,177,152,181,29,2,12,3,137,17,128,210,136,135,10,16,46,153,0,2,233,51,184,72,
+185,36,30,24,170,131,185,88,129,77,145,41,225,104,153,24,195,8,129,59,163,59,151,153,4,13,131,154,164,138,147,30,
+147,26,5,169,1,10,65,219,97,217,17,153,131,41,1,154,65,139,104,176,137,183,76,160,56,153,56,194,1,25,193,148,
+60,41,172,135,139,130,137,20,58,184,65,75,136,130,228,91,168,24,32,9,178,24,11,227,81,208,73,187,132,10,147,144,
+35,155,81,152,74,2,143,182,75,177,24,128,0,8,164,161,177,135,26,57,251,3,140,48,43,1,25,162,224,121,144,177,
+148,28,128,42,18,59,179,1,152,150,81,185,65,190,3,156,18,168,122,144,130,27,73,195,168,151,61,168,16,8,136,150,
+58,152,24,132,9,107,203,147,30,163,161,50,153,32,168,48,194,169,167,63,137,136,195,34,144,72,138,25,7,170,112,186,
+130,169,18,145,81,28,177,48,27,150,138,196,77,176,40,144,0,165,24,0,137,132,169,122,187,135,138,146,24,129,41,32,
+153,65,137,244,195,41,200,64,139,34,152,24,129,161,6,144,106,188,19,157,2,0,129,123,160,16,58,178,25,247,57,184,
+16,8,40,148,40,169,168,114,200,81,157,147,27,145,56,16,25,147,12,50,132,31,242,74,192,17,8,129,24,3,140,122,
+8,11,1,233,147,10,162,48,144,121,177,93,8,136,153,182,58,169,17,25,0,128,179,47,152,64,218,51,173,149,27,146,
+32,25,130,46,130,40,145,26,243,91,185,66,10,146,164,122,9,128,129,162,72,157,2,29,145,16,146,63,177,129,168,132,
+138,197,58,153,1,12,5,10,131,144,0,34,241,106,203,131,9,160,82,29,129,161,40,17,138,170,149,47,177,250,77,0,
+184,129,0,169,23,26,176,82,176,145,41,240,0,170,52,31,146,163,16,8,145,1,181,61,216,161,57,217,65,42,9,17,
+160,19,9,139,66,191,5,140,149,8,40,41,24,42,152,2,248,48,140,225,0,177,18,32,74,137,31,165,40,153,80,189,
+4,10,162,72,184,48,170,3,105,145,107,200,2,136,160,50,31,145,8,136,129,160,113,248,17,8,140,131,44,153,19,141,
+146,146,121,9,32,168,176,164,105,139,0,8,169,3,124,193,49,168,144,1,130,14,178,42,232,148,75,226,32,144,146,1,
+145,169,183,73,152,129,90,208,48,161,160,35,152,201,148,44,224,130,77,176,57,144,146,41,49,155,163,146,155,243,124,210,
+41,161,146,75,16,154,3,139,20,154,59,231,16,208,130,57,177,0,144,25,64,137,106,214,128,129,176,88,152,0,40,176,
+33,1,58,199,145,3,204,33,31,161,24,176,96,170,48,211,1,1,27,201,34,236,133,25,152,33,170,151,8,2,138,89,
+233,18,170,180,89,160,32,192,1,32,9,25,56,251,145,26,243,80,169,148,136,50,29,48,171,20,158,148,59,193,17,177,
+147,108,136,42,161,129,177,93,185,64,185,133,8,56,12,0,8,164,8,176,93,154,2,137,35,63,144,59,177,34,27,90,
+249,40,184,149,91,25,24,152,0,144,64,10,123,217,163,128,48,61,2,10,145,40,11,68,140,32,222,132,44,8,128,163,
+136,196,40,25,32,137,152,218,64,15,149,8,146,24,169,72,138,129,131,110,155,145,128,130,180,35,170,210,73,9,2,105,
+31,216,131,137,131,0,129,169,132,42,74,121,75,154,211,0,177,163,131,0,168,131,31,92,26,145,210,195,8,129,25,17,
+73,176,42,154,137,199,135,192,2,12,130,26,32,160,130,43,186,230,34,152,3,47,184,16,136,32,17,24,189,212,40,25,
+66,74,208,1,14,0,16,80,154,180,144,168,17,105,8,32,157,178,27,32,168,23,58,154,139,10,134,132,1,161,15,153,
+136,135,57,178,25,171,8,17,3,3,88,240,11,192,48,2,123,160,136,200,128,34,72,1,243,192,0,59,88,0,1,186,
+195,75,58,133,161,33,157,42,156,64,146,24,243,24,154,40,182,50,60,161,15,209,32,0,146,32,157,136,192,113,25,145,
+53,21,79,0,128,240,16,153,18,16,42,192,152,25,123,163,73,160,209,42,184,81,24,57,243,25,137,1,5,136,3,200,
+13,144,40,66,200,18,159,129,25,35,28,145,178,15,194,33,146,56,184,139,59,210,113,145,8,128,175,147,0,82,170,135,
+12,128,40,24,8,128,161,174,149,75,146,162,16,187,107,146,88,25,160,1,174,131,170,55,11,146,140,128,48,60,211,48,
+216,27,197,32,0,145,8,169,42,57,3,243,18,188,10,131,42,55,138,128,157,48,193,35,184,122,241,57,26,48,144,8,
+154,188,7,9,148,9,180,138,0,96,57,160,59,172,26,21,8,137,166,136,143,148,128,20,138,10,184,24,7,43,146,123,
+202,17,9,33,128,137,200,242,66,139,18,27,129,156,146,80,72,170,146,170,56,64,42,43,104,242,44,9,33,131,201,145,
+162,47,34,28,136,34,190,33,57,60,180,138,123,185,82,43,193,17,178,13,128,1,80,209,32,155,73,0,192,19,24,139,
+25,91,161,135,59,169,134,77,8,218,161,3,155,17,162,96,147,138,43,249,40,146,148,19,130,143,152,25,120,176,9,44,
+145,17,57,152,5,187,91,9,57,114,153,137,42,93,8,152,1,1,233,33,61,41,226,152,49,43,56,1,123,25,193,27,
+40,248,4,193,136,129,59,1,1,158,99,171,58,194,0,149,144,43,24,26,132,179,61,51,191,163,180,17,129,15,161,9,
+131,242,18,57,155,136,177,166,35,170,26,244,129,150,25,128,146,217,1,147,59,165,27,42,209,129,132,136,88,242,9,2,
+10,49,26,175,132,152,17,128,25,194,200,146,145,35,72,240,58,176,49,2,10,130,242,12,56,26,122,128,13,163,154,48,
+161,178,114,240,57,129,42,34,170,44,18,141,3,165,154,23,203,129,146,144,64,160,43,138,25,82,13,48,160,140,2,214,
+32,163,200,16,184,24,1,125,144,152,138,147,11,39,176,181,128,176,74,16,24,32,193,217,40,154,49,151,248,3,155,57,
+131,137,68,144,28,144,44,130,151,1,136,155,232,24,1,66,25,8,143,184,210,20,42,8,226,162,40,0,56,72,44,225,
+160,24,138,32,163,128,224,34,140,122,58,178,146,129,187,178,131,42,247,146,16,42,153,51,208,18,141,160,105,9,226,4,
+136,24,9,163,102,22,71,0,161,132,28,162,59,13,144,145,41,45,76,42,145,46,149,168,17,160,10,40,80,44,13,163,
+144,34,56,47,162,44,160,60,208,20,219,66,169,128,17,128,73,11,163,226,1,123,137,40,184,18,140,148,34,153,89,180,
+13,132,193,1,162,27,186,213,65,29,129,0,169,49,140,131,144,72,168,153,123,170,66,1,188,37,233,129,1,136,211,3,
+107,171,34,26,25,107,184,0,29,194,145,49,90,186,34,89,141,32,145,49,61,153,57,8,124,144,24,44,192,136,164,64,
+27,56,157,32,61,176,32,128,128,242,147,60,0,92,152,24,43,210,24,80,169,144,134,11,42,16,161,58,90,216,73,45,
+178,128,166,24,28,1,26,145,60,166,45,128,146,137,135,26,129,11,179,130,177,7,28,24,9,200,20,139,34,143,146,184,
+147,5,13,48,170,195,3,8,80,28,41,240,129,130,9,40,184,0,241,32,0,45,129,184,155,7,43,1,161,128,198,137,
+4,43,128,145,178,0,139,164,53,216,213,17,128,153,132,160,160,150,28,1,32,138,211,136,177,168,151,161,182,0,161,10,
+123,0,168,1,196,177,165,8,178,5,153,75,27,41,40,216,4,185,160,3,244,0,147,184,32,130,168,4,31,145,163,106,
+160,132,58,136,131,15,2,155,50,208,168,112,184,72,168,211,33,218,49,153,129,195,64,47,168,104,169,2,128,137,33,249,
+130,163,26,76,25,58,243,146,129,136,76,184,163,162,120,11,41,178,242,2,128,59,73,216,2,178,48,25,232,88,176,162,
+133,8,59,168,60,224,51,171,16,145,234,165,130,8,90,192,129,193,56,9,32,77,200,164,178,3,60,136,129,234,20,170,
+105,9,192,130,129,0,59,224,2,211,57,136,91,137,147,201,48,149,154,5,177,8,129,136,42,80,137,185,122,41,176,148,
+8,217,36,143,163,144,148,169,76,146,45,48,27,136,72,240,129,177,19,42,137,56,138,124,27,1,30,146,160,27,135,10,
+73,178,76,44,128,0,8,152,178,58,89,11,97,169,136,164,43,52,15,56,146,171,114,153,1,18,187,148,11,124,137,162,
+145,130,62,29,129,137,166,145,25,2,14,146,193,1,42,10,42,16,243,129,26,130,27,199,129,33,58,30,40,169,180,183,
+8,72,140,40,136,25,73,152,19,236,70,0,108,8,137,148,130,59,168,149,184,135,169,34,139,168,3,228,48,91,29,128,
+8,40,200,18,10,8,211,164,48,137,0,241,128,3,154,137,164,168,240,130,108,44,11,161,10,24,30,33,28,34,60,178,
+4,153,23,9,74,136,210,0,136,64,27,129,2,203,0,135,24,200,150,137,16,138,176,64,177,77,184,57,163,185,132,7,
+169,2,193,169,84,171,17,8,141,194,2,145,104,194,144,19,140,3,193,43,136,0,31,170,16,33,161,145,39,232,165,72,
+160,217,133,154,40,177,0,128,133,9,2,139,52,220,133,10,128,13,130,200,72,0,136,72,0,170,37,137,64,173,163,91,
+144,24,0,1,72,131,73,10,164,44,161,157,154,198,8,26,151,9,132,168,0,2,153,49,169,60,220,130,75,160,162,17,
+7,170,134,136,27,20,248,56,12,160,32,41,168,34,25,44,178,162,112,178,169,121,156,17,136,75,178,67,14,163,176,18,
+41,144,49,47,250,33,10,77,178,73,160,162,24,136,41,41,80,189,166,41,139,16,148,46,180,16,41,153,162,20,153,162,
+113,143,18,153,40,152,35,15,130,137,48,29,161,2,154,213,56,171,89,145,60,180,32,27,146,26,73,57,201,123,233,148,
+9,145,136,19,11,17,178,139,135,9,65,200,56,46,185,0,1,161,166,66,13,145,40,185,82,168,145,147,15,41,201,50,
+9,182,24,164,140,2,41,57,48,143,212,0,152,57,0,77,177,146,177,148,168,121,24,152,8,244,24,8,137,2,41,194,
+148,16,140,4,10,65,41,28,226,136,58,185,50,125,160,144,163,137,168,112,8,73,184,195,76,10,26,3,137,151,161,41,
+184,145,0,83,8,187,6,15,152,130,74,0,179,24,8,220,34,11,51,2,245,73,171,40,137,40,163,5,58,11,153,15,
+131,40,163,123,168,225,145,129,58,132,123,144,176,17,155,8,148,66,8,240,130,143,16,152,65,9,179,0,140,25,177,35,
+120,195,49,31,168,8,16,74,147,74,154,192,129,28,33,210,65,177,232,1,44,43,1,80,153,180,137,42,152,0,135,168,
+7,9,45,170,131,32,75,1,75,186,232,148,16,41,181,1,137,176,168,93,73,168,97,154,129,168,58,1,24,149,145,149,
+185,121,156,1,148,24,144,161,153,184,177,116,181,12,77,0,0,138,6,186,90,185,32,49,139,135,27,137,200,3,25,48,
+73,24,41,207,179,105,8,74,130,137,168,208,80,152,88,128,9,195,208,48,14,56,128,42,146,169,42,137,160,23,161,120,
+176,177,123,201,33,128,56,168,129,59,175,65,152,66,170,3,136,189,148,136,97,153,3,45,137,153,48,152,83,210,1,8,
+220,3,45,40,168,81,152,186,18,28,18,10,21,58,194,153,10,156,73,151,57,196,9,25,46,8,146,56,194,72,208,43,
+242,1,48,9,1,153,44,216,34,32,145,196,146,41,236,0,1,105,136,17,11,185,192,132,41,165,129,8,57,236,32,13,
+130,3,58,24,250,41,11,19,144,145,115,218,32,12,152,162,23,42,177,0,142,136,3,149,58,160,41,8,159,178,148,64,
+16,169,16,15,176,19,147,105,184,49,44,158,161,3,104,169,18,10,29,160,147,67,185,32,148,43,191,166,58,56,177,129,
+9,235,147,40,37,172,134,24,160,184,40,72,46,149,25,168,9,144,105,128,130,152,57,12,244,74,169,48,163,41,169,242,
+72,9,40,146,24,154,21,156,27,200,195,52,160,0,176,42,15,132,32,145,13,18,136,207,132,9,64,9,128,25,185,0,
+2,82,185,162,56,183,27,12,105,138,133,128,0,171,211,88,136,130,152,73,17,10,159,211,129,4,25,154,149,28,8,128,
+50,136,11,21,243,168,8,25,93,162,128,25,217,145,33,74,161,16,136,68,250,76,153,146,19,0,154,181,10,106,144,49,
+128,27,20,26,241,41,169,122,160,162,9,186,212,17,24,10,178,59,130,184,207,211,129,51,169,128,149,31,9,5,41,162,
+0,128,21,185,75,13,211,132,147,155,134,45,136,0,8,1,137,146,19,249,42,138,123,18,26,177,163,200,33,128,194,149,
+29,17,152,201,77,9,8,131,128,11,243,152,24,33,41,209,88,59,241,144,160,48,107,129,8,138,171,210,128,39,137,178,
+72,43,8,203,136,18,123,146,152,160,244,144,2,40,88,11,163,9,121,200,25,24,128,4,0,202,197,24,24,168,37,25,
+26,59,194,229,25,57,26,147,68,172,180,145,74,0,56,152,24,107,168,3,175,177,195,35,1,186,0,232,11,121,24,28,
+17,160,32,33,253,0,24,144,51,192,41,139,201,17,120,168,52,232,73,0,133,152,128,65,248,25,72,139,35,57,188,130,
+170,217,23,144,33,10,137,3,42,191,130,162,122,146,216,3,139,153,51,129,8,19,236,80,42,218,56,9,193,83,153,144,
+161,242,17,40,25,81,11,25,35,224,11,59,242,32,0,176,65,29,187,65,129,0,17,12,73,200,199,25,25,25,18,40,
+200,162,76,31,0,0,16,194,16,42,0,222,162,50,44,17,40,142,145,177,43,38,27,178,133,171,4,184,45,24,144,51,
+32,173,57,176,191,7,24,8,2,169,107,145,219,72,136,25,131,146,232,1,138,24,49,165,121,153,8,72,152,12,147,144,
+88,24,241,16,154,145,107,0,137,16,129,28,132,170,172,161,147,68,128,164,139,72,249,16,105,153,18,152,146,129,251,24,
+1,12,5,0,153,40,11,159,82,144,40,147,170,129,167,15,0,128,72,24,152,136,184,193,122,129,144,33,152,44,19,252,
+40,0,139,114,168,0,137,145,202,35,2,8,163,24,109,8,186,41,0,124,179,33,169,194,209,0,90,41,24,0,140,131,
+212,157,17,208,4,24,144,41,9,202,41,35,162,96,42,233,35,248,26,8,137,22,128,153,2,156,153,66,128,129,6,185,
+96,177,158,0,2,61,33,176,136,160,218,2,130,36,144,167,138,65,235,41,0,168,37,162,139,41,242,9,128,18,24,49,
+138,194,24,250,27,132,73,146,166,129,178,10,138,130,151,72,25,138,105,176,157,144,165,26,52,192,146,138,160,46,33,25,
+25,35,209,72,219,216,33,185,23,16,139,17,169,156,34,10,1,70,187,3,163,206,56,128,26,37,144,138,130,159,42,179,
+164,22,153,1,144,243,28,129,10,66,130,154,179,212,11,128,164,88,145,40,26,161,169,232,56,58,149,167,1,154,16,11,
+16,121,146,145,2,93,168,171,137,162,0,85,176,136,0,249,57,41,136,122,162,129,57,242,10,8,218,6,16,9,24,216,
+9,40,152,49,66,216,48,195,251,16,136,59,99,161,26,8,15,9,1,8,19,194,130,18,250,29,161,128,81,17,156,132,
+154,29,2,8,16,162,147,25,212,12,11,89,136,66,0,137,185,161,161,228,67,32,16,40,226,136,159,74,177,16,64,209,
+8,1,171,9,66,152,120,8,153,32,243,140,1,178,48,66,218,34,11,141,4,222,74,0,89,136,56,129,136,153,135,156,
+25,129,232,99,136,9,16,184,11,131,40,147,65,10,147,217,172,63,168,120,1,25,0,224,153,2,26,129,7,136,24,128,
+157,12,32,137,33,100,153,136,154,195,8,52,25,178,114,137,57,174,144,1,75,72,164,138,128,233,8,2,26,129,98,152,
+124,184,153,56,145,41,21,177,59,185,241,64,10,17,129,25,121,168,249,0,1,27,67,161,171,18,217,78,0,130,25,152,
+161,135,169,27,153,148,97,16,171,56,154,143,150,0,0,179,152,18,131,191,24,0,93,129,17,156,194,0,41,17,129,132,
+171,112,144,153,61,154,128,7,2,186,128,187,2,122,163,8,137,91,8,19,251,152,91,162,50,128,201,185,131,125,16,136,
+152,8,161,21,240,43,9,163,34,2,202,43,92,141,34,130,185,33,160,84,177,249,153,33,92,129,0,140,1,153,66,33,
+201,16,198,8,18,184,15,128,0,2,17,218,41,154,145,147,151,10,163,25,84,16,191,16,43,91,3,24,15,144,129,58,
+129,209,1,75,128,4,184,31,138,1,35,146,232,161,27,33,33,168,49,46,145,113,40,237,145,16,24,50,136,188,168,3,
+124,41,144,168,91,146,32,192,141,8,132,40,19,141,11,58,74,83,16,188,16,20,9,135,219,26,18,42,1,48,159,145,
+160,64,176,148,29,145,32,4,208,15,40,136,17,131,249,24,8,25,131,148,12,144,56,33,123,204,161,17,57,131,209,26,
+160,152,54,0,15,0,9,17,112,186,152,40,162,162,7,186,1,59,57,5,154,32,14,128,22,169,141,177,149,24,19,153,
+140,24,177,112,164,160,8,130,1,134,169,202,72,17,72,43,203,169,3,122,17,211,11,128,193,99,137,141,25,147,0,17,
+177,159,49,193,2,50,189,8,17,16,37,250,27,32,27,149,130,173,129,132,137,52,216,139,51,10,88,178,159,24,148,0,
+130,200,8,8,9,68,129,188,17,144,57,55,237,24,2,138,49,160,157,17,162,56,3,161,159,16,147,66,162,175,1,162,
+66,0,186,92,26,138,83,145,202,136,147,163,84,240,154,64,153,130,17,187,152,48,24,7,148,202,136,64,32,144,175,57,
+131,42,50,235,12,130,162,48,36,248,10,48,137,83,184,159,17,145,17,131,235,178,18,59,183,248,67,0,6,1,143,0,
+8,40,5,174,0,163,9,6,160,12,24,144,105,129,168,8,8,1,49,244,28,32,169,97,128,186,35,170,41,70,169,168,
+130,139,65,34,249,137,32,141,51,28,27,160,200,34,5,41,200,200,19,67,27,159,161,129,60,5,144,11,128,202,18,38,
+152,140,1,9,96,177,188,96,9,8,2,227,41,154,137,23,32,11,128,28,26,53,174,8,3,171,36,163,143,2,153,44,
+51,137,136,153,40,88,226,27,145,210,122,130,200,33,176,11,37,176,16,18,251,17,148,185,10,130,208,82,136,152,0,234,
+2,136,0,163,184,98,146,8,139,11,15,24,74,146,59,37,172,178,34,248,161,121,128,41,17,248,25,1,156,48,146,216,
+19,144,40,169,164,0,121,137,32,90,219,4,168,128,146,202,5,144,11,115,137,11,146,25,193,89,145,136,148,145,193,161,
+95,136,128,33,160,58,179,249,16,150,160,32,145,9,188,149,56,60,24,58,200,200,131,188,65,0,13,4,193,25,112,138,
+136,145,146,162,168,65,145,27,176,183,89,45,210,160,35,202,72,145,137,89,178,144,72,138,0,152,164,120,25,168,2,184,
+169,69,202,73,145,15,3,128,13,49,184,24,2,170,153,16,9,50,7,202,135,43,75,195,177,5,9,41,4,234,56,194,
+8,41,17,186,210,131,93,24,184,24,176,144,21,202,80,154,10,134,24,30,17,192,129,40,136,154,42,107,8,4,137,177,
+45,128,243,17,146,155,48,144,169,51,242,92,11,32,146,202,33,123,160,4,25,202,148,24,11,21,218,136,67,170,16,19,
+203,196,18,137,145,24,158,36,9,32,16,143,0,228,32,1,169,73,193,152,64,176,25,44,16,184,35,188,79,161,147,16,
+209,32,26,31,0,161,184,39,170,0,131,197,168,32,24,28,32,202,35,44,136,56,143,165,193,65,9,136,42,216,104,136,
+128,1,187,132,210,232,68,139,40,8,152,211,120,11,16,26,180,32,9,241,105,176,133,58,184,200,137,151,16,9,41,57,
+136,81,143,145,137,33,145,33,195,136,43,155,130,242,177,122,169,19,25,41,26,27,73,184,151,164,24,195,160,162,1,143,
+2,73,160,177,105,176,138,128,194,18,184,21,35,31,178,11,35,105,58,150,152,10,209,33,208,1,128,46,248,7,78,0,
+0,11,1,78,9,9,58,149,155,133,9,163,130,8,138,48,47,139,26,129,143,3,74,196,32,138,224,48,41,241,32,74,
+176,48,169,34,173,180,8,132,200,180,161,145,134,75,40,10,9,120,169,90,160,1,44,211,16,138,147,42,161,0,42,62,
+176,125,168,1,0,162,107,163,137,162,149,171,83,154,147,75,241,24,136,43,146,146,139,135,41,136,17,188,135,128,61,26,
+1,12,180,130,12,3,142,2,176,131,32,26,43,153,132,138,183,124,161,137,146,146,200,120,153,0,8,176,18,25,74,128,
+165,178,19,29,17,62,154,148,185,75,40,12,136,167,40,138,51,44,8,128,149,61,160,28,194,58,0,184,120,178,60,128,
+34,129,112,152,32,44,242,42,161,43,10,225,160,5,154,4,153,49,33,248,72,43,144,41,198,136,153,132,141,147,161,148,
+32,40,63,161,24,145,136,107,160,29,152,152,211,122,24,136,24,128,42,149,56,153,19,235,163,10,208,152,88,9,24,80,
+44,73,11,129,18,232,4,186,162,225,195,0,16,46,1,17,139,52,46,144,74,210,130,176,32,153,144,152,128,62,33,92,
+169,134,184,148,40,168,32,141,129,249,32,8,27,16,180,17,145,82,14,49,187,167,130,11,59,140,1,152,2,105,8,44,
+211,131,161,2,59,0,201,194,28,226,122,10,2,184,2,4,201,49,160,144,242,148,42,137,29,193,33,138,21,153,49,209,
+194,147,146,30,48,201,25,132,138,40,47,136,148,1,16,2,25,43,168,172,167,44,10,0,248,32,8,184,97,0,28,212,
+146,41,40,12,163,16,185,34,157,4,156,163,162,135,29,2,138,137,6,11,18,47,136,129,152,3,27,25,10,225,0,167,
+41,138,36,157,50,10,184,98,137,40,208,161,8,136,139,151,41,160,122,9,1,47,194,33,153,1,56,241,136,148,137,130,
+44,168,35,168,164,97,138,16,9,179,9,65,47,1,174,48,168,140,81,154,32,137,196,89,152,16,136,49,26,27,160,88,
+30,201,4,154,1,16,241,48,176,1,180,9,33,0,194,66,170,155,208,188,129,181,147,114,145,169,54,155,41,82,156,122,
+136,169,72,153,138,146,131,25,57,165,50,139,185,23,169,123,147,204,49,176,187,6,9,42,21,177,4,72,152,25,193,25,
+240,33,68,0,166,170,42,9,190,50,152,91,33,139,96,136,193,34,160,26,151,137,216,17,172,51,31,0,2,139,36,12,
+168,4,161,11,23,141,24,24,156,146,97,11,49,186,133,160,129,1,128,152,7,188,129,1,143,129,32,176,36,160,161,121,
+161,152,147,0,112,15,160,129,138,2,28,162,134,128,128,80,154,73,18,154,51,46,202,33,159,2,9,128,19,12,166,9,
+144,0,33,139,83,142,201,50,141,128,18,194,49,169,20,138,73,168,162,96,146,175,178,131,13,8,56,200,97,8,146,57,
+193,8,147,26,34,175,144,8,47,129,12,163,19,24,66,12,168,180,56,73,78,176,208,130,138,0,42,1,0,1,87,153,
+153,163,145,1,121,168,169,90,176,170,36,148,56,24,66,157,27,56,173,81,19,206,145,40,26,31,145,147,16,40,1,137,
+165,193,131,138,115,186,160,192,145,161,208,181,19,24,80,160,26,178,106,195,72,211,136,12,146,140,144,115,10,136,88,211,
+152,33,24,26,89,193,136,12,32,29,169,21,136,0,91,129,140,19,137,24,96,152,170,153,132,61,156,89,178,2,144,151,
+128,136,146,161,74,129,76,158,8,40,226,25,130,131,29,3,216,128,96,10,57,16,128,204,1,27,152,42,151,179,90,3,
+154,8,81,169,120,24,28,170,177,161,197,1,129,2,139,7,154,72,11,26,121,144,161,25,240,16,176,210,130,65,140,48,
+136,146,1,28,104,28,145,211,193,40,8,139,178,151,178,34,58,63,9,160,17,164,50,12,137,31,193,9,72,137,145,35,
+169,17,125,137,57,137,179,42,106,142,16,153,129,145,163,51,156,65,183,178,56,19,46,8,161,155,26,26,143,129,197,2,
+165,73,24,153,11,134,26,89,154,152,137,193,136,40,129,66,163,137,121,32,159,65,160,1,145,139,216,138,16,242,16,48,
+148,45,17,128,28,8,3,14,3,241,168,129,25,136,9,65,5,140,98,10,168,145,164,129,73,0,157,184,209,17,58,12,
+53,216,2,1,10,24,28,18,180,80,155,210,139,133,136,9,98,144,29,131,162,153,19,63,144,16,192,193,140,18,187,144,
+68,193,64,26,18,170,148,172,20,106,176,24,249,1,152,8,56,176,50,196,89,25,146,142,131,32,128,10,187,159,131,192,
+41,7,74,160,112,251,74,0,32,8,129,171,56,170,23,129,157,137,137,48,143,3,169,6,42,152,112,168,145,25,50,50,
+159,26,209,16,26,146,75,5,160,144,36,146,159,128,3,9,50,143,153,74,176,0,187,7,24,170,20,145,210,153,80,0,
+49,251,40,30,144,24,137,3,41,8,128,33,44,240,92,0,16,9,161,12,11,50,220,42,51,16,156,120,129,160,42,146,
+17,150,17,221,144,2,217,24,89,152,164,1,169,82,141,179,41,51,0,187,8,139,194,208,20,77,130,24,9,120,152,136,
+41,130,32,196,193,188,81,152,144,137,134,75,193,90,153,3,139,32,76,130,216,161,129,217,66,157,129,74,130,9,42,6,
+169,145,16,149,41,242,8,154,81,170,10,34,163,61,217,99,184,32,144,147,65,145,15,176,48,172,146,11,151,56,185,128,
+7,8,170,34,26,133,11,160,137,9,150,158,3,17,177,124,129,72,185,17,137,2,36,249,9,153,34,159,24,2,128,56,
+161,26,135,9,141,4,57,176,28,192,128,40,155,187,55,43,129,60,6,136,29,130,26,4,168,187,58,243,24,186,34,17,
+5,42,161,120,240,17,138,34,147,232,145,136,44,193,168,24,23,9,160,64,194,178,41,17,8,147,175,184,76,145,152,45,
+135,144,17,25,0,129,144,73,32,1,193,142,26,225,74,218,81,136,1,144,129,19,170,13,35,25,138,240,155,162,90,232,
+0,18,33,155,73,56,24,170,180,48,32,151,207,33,153,160,58,130,82,162,42,60,50,152,232,43,164,51,248,59,141,1,
+24,184,123,4,152,169,21,8,152,28,178,65,0,139,221,56,169,178,26,39,0,168,133,152,99,155,25,57,149,144,138,155,
+162,181,168,5,56,183,73,153,20,152,138,56,144,88,209,155,186,51,157,136,18,135,32,139,65,8,27,143,177,52,129,14,
+154,131,171,65,29,1,80,8,153,67,160,140,144,16,135,137,169,45,25,164,139,74,84,153,8,2,49,250,129,154,18,2,
+243,43,141,18,138,12,48,146,51,138,88,1,146,239,66,25,128,43,185,16,57,185,15,134,17,145,12,35,139,168,164,58,
+64,82,175,9,130,168,218,64,0,129,0,9,114,170,40,155,80,131,240,162,137,136,146,233,1,113,128,136,57,3,186,27,
+155,115,134,169,193,10,17,158,140,205,73,0,0,33,24,18,49,139,20,213,169,145,113,145,154,153,60,128,248,57,0,35,
+216,128,35,211,153,147,89,145,114,155,138,144,164,140,10,39,41,43,152,17,168,9,175,135,48,184,144,161,129,63,192,153,
+22,59,168,49,168,52,142,0,26,153,37,240,136,16,176,144,176,83,168,120,176,146,34,136,172,4,168,112,152,162,58,28,
+32,142,32,153,88,141,149,16,209,129,192,41,9,131,46,193,73,153,24,27,163,73,179,93,146,129,1,16,30,147,90,146,
+128,144,18,159,1,170,18,1,226,35,140,149,155,144,8,166,73,177,18,204,129,45,176,40,184,115,136,56,44,129,9,241,
+17,16,75,56,216,26,200,34,12,41,152,5,144,136,62,32,172,17,73,43,113,27,25,218,130,184,129,44,130,8,164,2,
+107,43,24,31,153,149,41,0,163,180,216,129,59,61,58,8,122,145,138,36,0,242,33,200,17,162,50,188,146,13,193,74,
+160,49,235,21,9,32,45,145,25,192,128,124,144,0,136,180,176,40,12,32,172,135,40,144,74,136,137,209,16,154,96,10,
+181,49,185,139,58,140,0,18,26,22,106,185,133,11,147,61,153,66,136,18,168,42,175,180,42,137,64,136,105,152,16,242,
+146,137,164,74,8,163,72,194,26,33,142,192,52,187,81,58,24,26,209,132,169,145,200,20,200,20,26,154,75,176,12,161,
+187,54,0,138,37,210,129,10,136,131,192,22,26,138,107,142,145,25,130,128,34,144,198,131,224,40,160,42,130,17,16,128,
+251,136,156,197,33,26,64,128,164,56,178,171,138,166,156,21,0,168,63,200,17,153,163,59,6,61,1,8,164,137,168,84,
+172,21,9,153,58,136,76,186,16,162,48,80,193,3,248,33,139,129,57,193,123,193,43,128,177,140,133,10,5,25,163,136,
+161,35,143,16,42,73,176,10,241,128,144,241,130,49,202,113,137,32,152,152,57,163,74,210,8,227,24,28,0,41,74,40,
+129,31,2,193,154,130,165,89,136,136,41,202,11,9,64,63,9,49,144,18,66,58,252,5,26,160,73,1,155,185,147,193,
+145,224,66,0,40,124,9,25,177,61,144,130,12,179,203,128,0,160,130,121,129,89,146,72,168,81,157,130,8,147,137,153,
+44,250,32,185,56,141,7,24,130,136,2,27,14,15,65,0,218,129,41,7,46,144,42,11,49,171,181,76,146,1,186,39,
+155,131,155,1,113,184,24,155,90,152,26,209,149,56,5,42,179,34,31,139,60,4,42,144,185,186,151,138,227,0,18,90,
+136,34,169,58,249,128,33,226,17,154,137,195,90,200,0,57,34,10,5,16,152,251,16,193,16,97,153,184,17,15,128,12,
+80,9,130,16,0,146,217,160,120,128,24,49,170,184,45,228,137,144,179,35,26,147,17,108,176,26,243,130,41,196,1,139,
+192,1,169,49,112,40,148,74,153,178,40,162,186,55,208,36,141,168,42,138,50,143,64,136,161,32,229,48,184,9,9,161,
+67,138,122,171,24,152,129,25,151,48,177,152,36,169,141,97,186,53,27,128,154,204,34,170,134,137,32,129,193,106,145,2,
+156,19,28,152,86,169,9,153,128,28,184,72,146,67,201,18,145,179,221,147,57,21,58,195,169,184,5,185,148,33,210,64,
+44,0,129,40,15,137,80,153,18,144,24,175,148,169,227,17,177,66,176,128,91,138,168,124,137,130,48,145,169,195,128,139,
+233,136,115,153,32,1,27,19,44,249,41,74,24,179,2,234,178,24,13,92,136,19,8,2,200,25,166,209,25,17,136,80,
+170,160,108,170,33,187,149,49,192,64,27,131,25,168,187,23,66,26,21,154,201,9,241,16,1,91,145,9,145,56,143,16,
+12,128,3,195,65,184,136,171,19,31,158,4,10,18,144,16,40,232,0,177,120,0,129,42,243,154,49,140,152,49,149,194,
+42,178,137,151,58,137,73,41,1,227,129,140,192,4,249,33,161,17,26,1,91,155,149,12,17,153,7,9,128,27,200,0,
+25,26,120,147,43,131,146,213,122,137,168,1,1,56,194,45,160,56,159,146,57,8,145,194,7,160,152,184,48,31,56,144,
+28,138,10,145,248,147,18,181,48,58,40,19,175,33,26,123,17,128,224,24,2,202,0,162,8,7,137,104,0,139,193,48,
+42,162,18,181,172,91,129,75,14,1,1,203,132,41,168,131,13,146,130,61,131,158,18,142,3,12,9,52,171,179,122,145,
+161,138,25,33,122,9,160,137,202,164,41,11,151,32,210,2,74,152,60,154,67,154,32,241,41,11,195,75,208,19,25,129,
+73,148,138,180,9,49,43,18,167,43,139,28,224,154,3,37,135,8,70,0,138,81,32,170,196,1,88,232,65,128,152,10,
+160,1,173,72,146,194,136,133,41,192,25,8,193,124,1,168,176,137,163,248,56,163,24,136,5,0,177,139,13,195,112,146,
+16,29,171,211,8,40,8,56,148,17,145,148,27,47,224,50,160,1,10,141,160,200,40,211,105,26,4,25,177,64,156,179,
+25,133,8,135,29,152,136,139,131,90,178,34,2,145,210,122,176,24,73,130,49,171,136,186,11,251,1,9,211,73,161,49,
+47,129,12,17,15,150,24,192,130,154,146,27,163,32,178,114,145,152,168,8,73,216,64,17,184,183,74,154,8,44,144,56,
+194,98,138,4,186,135,138,1,26,211,50,187,6,139,136,61,210,17,9,73,9,128,57,210,73,160,1,129,185,168,18,143,
+2,44,1,24,251,22,139,33,29,3,41,177,99,202,35,188,149,8,138,75,144,106,137,0,25,185,76,198,128,146,128,128,
+160,130,1,12,4,63,144,128,170,82,139,132,169,148,9,212,104,138,16,26,128,44,1,28,165,58,210,34,10,9,11,148,
+32,137,107,227,74,169,132,9,144,73,216,48,209,17,154,4,44,211,58,200,66,12,1,154,21,140,147,56,168,18,184,23,
+10,16,45,145,57,242,56,170,10,28,226,72,176,105,168,32,168,133,11,164,74,176,18,137,81,15,130,27,146,25,155,96,
+169,5,154,131,26,9,74,177,112,153,1,11,212,25,197,41,213,1,128,128,137,148,75,137,73,160,64,171,150,9,145,128,
+208,18,184,4,208,4,43,177,145,216,33,25,16,153,6,14,179,90,137,1,145,4,43,32,14,131,76,192,72,10,42,154,
+136,50,142,73,225,17,193,2,9,0,153,128,162,162,80,139,6,142,132,153,9,26,64,0,217,5,169,3,29,145,1,145,
+160,18,170,18,198,59,198,74,129,154,177,18,179,153,41,151,58,241,64,26,104,155,145,179,161,32,242,49,201,64,185,1,
+47,129,25,144,48,155,132,186,23,42,146,56,140,134,155,4,10,3,31,161,144,224,89,176,17,26,146,75,177,76,161,123,
+169,130,24,162,160,165,72,12,147,137,8,15,34,41,201,34,157,3,156,34,138,151,57,200,17,242,17,137,147,75,145,138,
+227,90,168,130,10,166,0,179,58,193,51,188,18,138,34,45,225,112,154,0,207,253,74,0,136,25,170,135,25,144,73,168,
+49,200,3,160,134,152,4,41,217,64,27,163,27,136,165,189,81,184,131,137,149,60,177,93,152,129,160,128,16,195,153,151,
+8,129,58,74,138,142,112,153,0,144,162,17,186,32,145,4,44,232,114,153,57,136,48,154,194,130,171,152,7,139,17,129,
+78,128,172,115,137,144,8,0,130,240,32,136,163,137,180,137,136,94,153,16,72,169,64,137,107,130,8,137,50,242,149,10,
+147,60,241,32,168,25,168,19,31,128,8,160,64,203,36,168,2,28,128,129,24,9,173,7,42,48,141,210,64,170,50,12,
+144,130,178,31,164,105,154,56,26,145,42,243,49,160,128,243,145,25,131,63,137,0,107,160,185,21,11,146,25,128,112,154,
+176,50,42,25,10,249,179,48,137,14,112,154,96,8,170,23,154,129,74,10,100,169,179,196,136,43,41,138,129,129,130,113,
+169,19,43,159,153,4,17,17,25,142,32,172,2,168,226,163,145,124,144,8,177,24,152,7,42,8,40,170,144,2,168,31,
+166,8,165,178,130,153,170,151,43,196,2,8,48,234,147,153,129,57,128,73,177,167,74,146,0,138,32,159,97,154,16,8,
+193,162,64,61,185,50,176,150,128,1,95,138,128,137,177,2,11,28,151,152,3,26,152,81,29,146,193,147,130,136,129,195,
+57,143,129,152,146,201,210,50,168,128,150,152,2,148,120,10,28,195,146,129,129,9,167,9,16,76,152,169,136,183,144,133,
+40,44,144,2,168,200,149,0,27,136,230,2,9,58,60,26,224,129,17,41,63,145,136,16,74,29,128,42,198,17,152,129,
+45,144,25,162,89,9,155,197,164,176,150,40,26,57,176,3,58,90,171,151,8,146,8,233,18,30,161,210,2,73,169,32,
+161,136,152,149,106,153,146,194,147,16,208,42,179,211,16,153,2,63,171,135,10,3,152,178,82,169,177,148,44,209,129,179,
+194,36,156,1,168,145,243,128,34,10,128,6,136,75,131,47,8,136,147,75,192,2,137,161,201,144,23,140,9,145,165,192,
+5,42,9,41,153,241,34,45,24,43,184,148,193,19,78,9,162,200,4,9,128,59,177,24,243,65,27,152,44,229,33,153,
+16,27,40,216,148,17,46,26,144,131,240,134,25,8,24,193,146,136,58,137,72,10,40,137,250,10,64,0,211,79,152,145,
+177,17,137,181,59,3,186,230,65,27,128,26,129,91,184,64,154,132,26,24,147,159,0,243,18,12,18,9,8,129,176,75,
+57,15,164,42,137,147,61,177,76,2,0,169,21,74,153,130,18,171,181,112,29,160,0,200,50,202,66,139,164,161,104,137,
+153,42,137,18,154,127,9,8,160,163,45,56,170,149,148,9,212,2,152,60,145,128,176,24,122,75,59,41,141,162,56,193,
+88,217,81,28,162,0,161,49,140,48,107,28,9,8,130,152,88,9,160,16,199,25,73,11,9,195,24,42,17,45,30,131,
+137,162,124,152,145,24,8,27,24,8,245,1,184,72,59,57,27,147,64,156,64,177,138,248,147,32,242,72,136,8,168,151,
+11,130,44,17,16,186,23,25,178,9,4,10,193,48,205,164,8,162,129,202,98,141,18,170,51,75,146,30,210,17,153,130,
+194,128,43,241,33,137,41,145,48,59,199,24,160,137,213,18,169,48,59,184,47,149,9,8,128,26,150,137,129,145,194,123,
+10,146,144,19,43,167,144,149,8,136,66,12,27,9,10,25,192,2,242,4,154,212,24,177,25,107,163,75,163,26,40,62,
+160,193,129,43,212,130,144,25,224,33,27,58,164,160,43,21,163,43,135,170,145,131,31,184,177,1,123,226,128,3,17,210,
+33,10,179,194,64,128,240,20,12,24,184,132,137,26,27,225,81,11,0,152,35,46,144,72,169,29,148,136,76,146,11,195,
+17,152,91,185,147,43,167,24,146,123,209,1,153,18,186,51,168,240,35,218,17,152,164,136,167,24,144,16,0,56,28,4,
+46,160,64,137,31,162,179,25,147,31,32,10,137,17,45,179,136,167,24,137,96,139,128,209,18,185,80,138,177,67,186,97,
+168,178,27,149,75,168,50,240,145,56,137,56,241,1,128,13,147,32,77,41,29,146,24,184,132,168,64,186,23,170,1,41,
+192,33,171,16,243,56,73,137,74,58,93,153,137,33,160,57,183,42,178,169,151,144,107,177,145,1,13,146,48,185,98,187,
+150,8,129,9,42,169,25,167,138,36,76,194,16,200,5,184,130,25,25,57,202,120,138,128,192,134,25,153,33,153,162,4,
+104,46,42,137,211,160,3,179,209,19,143,148,136,193,3,184,165,129,49,188,65,157,134,136,177,2,152,128,64,251,69,0,
+136,212,48,140,3,137,162,167,1,1,132,126,10,177,8,121,10,24,59,154,176,243,17,169,130,9,128,76,10,128,128,19,
+44,18,34,188,112,180,32,177,147,17,16,47,195,74,152,0,10,130,201,33,192,147,31,2,27,15,50,14,146,0,152,8,
+209,4,136,129,2,24,122,161,57,28,56,203,20,152,204,1,149,42,153,128,128,75,47,161,161,40,152,193,197,179,88,138,
+164,78,128,152,44,130,44,145,144,147,152,153,66,233,24,48,12,43,0,43,194,96,250,82,152,170,51,145,41,8,24,36,
+64,43,182,44,227,145,128,145,209,148,57,128,31,1,160,91,16,9,146,144,200,24,12,122,128,56,0,27,75,13,170,25,
+114,217,97,137,169,130,144,16,163,136,131,17,175,145,140,144,16,166,180,66,139,144,154,31,5,9,73,24,162,131,176,162,
+137,179,124,176,146,46,170,10,82,184,51,17,253,82,186,144,1,162,18,131,9,64,137,219,3,62,178,146,168,200,192,25,
+98,42,107,18,156,136,208,128,146,152,4,144,164,19,154,25,148,121,16,181,185,17,224,169,116,152,152,33,26,24,27,218,
+2,138,16,49,169,21,216,166,42,128,9,38,184,15,180,200,40,163,72,64,192,16,161,140,41,138,41,7,152,40,146,158,
+130,176,11,70,25,144,46,168,178,89,145,88,32,227,32,137,153,58,203,0,50,157,38,154,9,148,139,9,133,16,165,45,
+152,208,32,136,40,112,184,129,145,200,56,45,160,2,72,179,155,26,182,40,48,154,99,178,188,195,187,74,130,91,114,168,
+0,131,250,32,144,10,33,194,6,17,153,16,46,27,8,40,196,60,201,193,16,176,112,40,138,49,209,184,24,27,25,36,
+24,146,115,155,128,160,8,148,75,240,8,30,145,26,17,150,72,27,144,145,202,130,28,106,24,137,19,180,121,176,129,130,
+192,67,30,138,144,16,154,17,49,1,165,208,168,0,29,31,130,136,4,25,72,209,9,2,208,130,75,218,168,49,152,97,
+88,138,32,152,187,147,139,40,1,12,39,160,82,192,59,57,211,202,41,185,89,49,177,6,67,45,41,184,11,212,137,33,
+241,32,2,154,36,137,11,144,242,77,138,152,88,153,35,136,161,4,168,200,17,13,170,84,11,17,34,136,242,24,8,241,
+167,241,77,0,41,168,200,112,160,8,35,170,51,141,153,147,142,147,136,64,20,8,72,168,56,74,206,129,10,161,4,153,
+21,0,168,2,154,15,0,13,137,166,49,128,129,40,11,3,237,144,41,156,3,131,48,22,29,16,202,75,193,184,65,128,
+129,20,25,59,25,248,138,10,208,0,149,65,74,146,74,128,187,51,240,11,149,160,4,24,16,152,16,172,155,139,218,6,
+91,145,148,57,178,216,137,196,136,56,128,82,56,9,32,141,171,152,159,161,135,26,133,128,26,164,138,138,130,31,128,1,
+34,16,0,5,154,157,177,185,57,54,27,69,0,44,211,177,59,218,1,0,16,114,136,8,33,253,128,128,138,81,176,3,
+18,186,133,140,136,136,139,82,144,113,177,130,17,204,41,248,144,19,138,35,2,30,16,154,140,178,11,33,19,114,133,8,
+33,251,0,25,142,35,10,65,195,9,195,176,75,200,24,65,137,50,178,136,244,11,153,193,104,24,16,17,169,42,168,191,
+148,25,56,3,48,3,58,239,144,153,144,51,0,99,128,155,24,237,24,145,16,4,131,64,226,145,12,160,129,33,20,131,
+132,233,194,152,248,131,24,145,132,24,25,233,27,25,168,98,178,3,1,248,161,0,188,7,24,42,162,59,0,251,72,41,
+153,23,27,136,150,28,161,148,42,241,178,18,28,128,194,76,138,177,5,10,128,161,41,40,176,20,208,128,148,16,67,174,
+2,177,120,129,152,32,168,26,7,29,129,25,9,17,89,250,0,24,16,11,161,77,137,19,42,158,49,193,18,152,36,239,
+3,25,9,0,169,88,24,144,152,172,52,224,149,8,193,89,41,184,17,137,76,128,16,171,161,82,177,75,160,240,121,8,
+152,128,137,144,6,153,24,43,50,225,58,16,173,21,146,139,16,27,36,203,177,148,58,135,139,26,81,155,50,202,73,42,
+178,4,14,130,16,108,9,184,96,185,131,129,155,148,176,96,9,154,18,185,81,141,40,3,220,165,179,32,57,201,36,154,
+107,160,146,145,9,136,246,32,25,138,32,27,123,144,137,1,144,56,169,146,68,154,124,74,12,178,179,24,146,208,19,12,
+8,128,17,81,175,146,212,1,152,160,67,27,161,17,147,152,181,128,131,242,42,148,10,29,136,48,27,192,176,135,40,9,
+74,240,40,80,82,52,80,0,13,1,152,48,155,180,1,128,41,178,45,73,185,147,169,78,178,211,32,45,72,169,152,32,
+107,2,242,0,16,16,136,13,74,145,177,137,9,123,8,153,197,73,9,2,25,140,24,32,89,42,43,184,167,64,42,46,
+27,161,0,8,152,27,48,192,151,62,8,8,152,146,144,91,152,64,3,25,167,58,194,145,169,133,12,10,136,122,26,168,
+131,63,144,24,168,147,26,166,33,76,136,162,33,15,2,138,138,18,154,184,133,160,164,177,113,31,136,162,161,152,198,147,
+1,33,26,18,50,158,35,141,10,24,14,59,42,90,168,161,120,138,177,18,185,128,105,161,34,41,132,192,2,241,130,31,
+152,0,49,140,48,26,164,27,123,201,65,13,145,9,24,17,152,20,145,120,137,194,120,154,18,154,162,144,1,28,8,170,
+91,152,111,184,149,136,1,24,25,58,26,243,40,152,88,201,2,129,9,24,9,26,168,231,89,10,8,178,146,153,48,9,
+26,90,16,7,57,56,152,199,145,41,43,30,161,152,179,3,43,136,14,165,179,202,48,25,113,27,1,88,45,210,128,128,
+152,144,49,140,65,136,9,105,157,146,138,51,15,24,81,25,16,136,133,42,200,131,142,73,11,24,41,155,32,242,16,75,
+224,131,25,72,24,157,40,17,139,32,42,122,136,130,41,47,184,180,160,193,24,97,11,25,148,1,25,89,72,156,57,32,
+248,147,32,25,139,96,143,144,129,16,10,130,17,26,3,173,233,133,61,26,1,9,73,107,153,41,74,26,59,106,153,0,
+0,168,43,120,160,164,32,129,40,94,59,27,59,13,14,33,9,0,123,136,145,0,193,177,57,56,186,121,160,48,31,26,
+9,40,144,132,124,26,12,8,162,57,91,146,178,40,196,33,47,0,9,161,167,0,25,176,27,90,202,19,43,27,138,80,
+88,28,91,24,152,33,242,162,128,144,152,242,49,42,241,130,136,26,144,56,13,24,27,136,39,25,193,134,17,10,163,176,
+212,162,161,153,128,59,49,229,156,88,162,137,129,146,153,123,1,145,16,180,61,25,8,137,157,133,185,56,180,176,162,145,
+96,27,128,155,148,181,196,134,40,58,16,51,30,154,136,161,243,178,25,63,58,9,210,162,8,2,9,168,225,96,137,41,
+168,183,48,72,153,40,61,138,238,0,68,0,195,193,161,168,5,24,26,16,248,19,73,170,135,9,57,59,28,152,32,65,
+234,16,123,154,130,25,9,194,179,165,24,26,160,48,154,243,164,145,137,18,63,160,104,9,128,137,129,216,65,45,9,16,
+138,151,17,75,144,9,8,145,13,41,170,160,56,131,15,120,122,153,32,152,25,160,196,144,128,18,184,72,26,215,57,136,
+25,128,153,59,25,149,93,10,132,161,144,20,28,0,179,104,155,128,104,188,22,249,17,144,136,129,168,132,232,81,160,24,
+129,60,73,170,73,168,88,216,147,144,24,32,171,132,176,160,112,170,146,129,179,11,39,177,56,23,141,161,4,154,40,10,
+31,148,240,1,162,57,144,153,48,197,144,74,9,56,185,148,210,164,130,24,152,249,65,137,57,43,208,4,152,57,10,146,
+187,7,153,145,160,232,7,136,0,161,129,106,176,41,225,2,27,128,12,180,2,177,120,26,1,152,17,27,243,42,226,145,
+160,64,138,5,57,153,96,169,163,11,128,172,215,0,195,32,9,2,8,150,0,25,170,177,242,8,26,129,177,97,130,145,
+20,76,138,11,184,170,194,32,226,83,160,183,49,28,130,27,185,129,153,93,144,17,242,3,137,0,2,27,169,31,9,9,
+90,123,144,0,144,161,33,57,240,152,128,160,122,59,18,27,128,33,187,116,10,187,240,34,28,25,64,153,4,29,131,77,
+8,176,227,8,129,8,24,1,128,26,123,59,57,128,200,248,17,26,195,73,146,192,129,107,136,56,160,217,8,192,35,11,
+133,211,2,140,17,144,147,8,171,15,41,90,168,151,17,137,169,1,133,16,1,188,184,139,7,129,19,132,193,171,104,137,
+50,136,139,207,32,10,129,49,36,90,203,178,146,82,107,153,43,141,146,145,130,3,18,253,1,26,128,49,89,218,152,18,
+9,124,41,164,152,160,2,137,88,16,225,152,24,12,9,131,150,128,137,26,136,18,53,227,76,12,0,11,17,20,27,240,
+128,146,138,22,0,202,144,16,202,34,33,195,129,11,160,226,23,18,169,59,29,240,0,2,73,27,137,208,146,17,33,177,
+141,228,161,24,89,16,153,163,9,43,89,33,73,248,193,24,138,64,8,163,32,141,9,57,123,164,193,129,26,209,16,34,
+1,26,160,47,171,7,136,211,41,137,176,24,75,227,70,0,19,165,91,144,169,162,65,162,168,73,175,2,201,7,57,160,
+8,176,144,121,161,1,43,156,181,145,50,73,169,3,235,129,91,132,44,139,162,152,161,114,9,132,153,209,144,121,128,1,
+13,161,26,160,50,44,147,227,193,32,26,134,24,155,162,160,44,114,139,149,0,176,32,26,151,0,141,164,137,75,24,168,
+180,4,11,24,0,167,130,155,1,9,11,124,168,164,17,10,59,33,247,17,28,152,129,9,1,74,161,1,75,139,135,147,
+176,122,185,162,16,25,56,8,153,162,144,114,177,217,0,29,248,3,144,122,8,144,40,8,2,136,235,130,138,185,7,8,
+128,121,170,2,56,9,9,46,202,180,3,16,56,130,211,56,217,38,28,29,144,9,27,147,40,89,144,184,151,40,40,13,
+9,154,244,17,8,129,1,145,185,20,35,159,24,201,128,41,184,114,0,27,147,165,65,152,155,162,42,143,18,42,74,178,
+177,35,20,153,204,161,188,213,18,62,0,8,145,130,56,132,188,76,224,193,33,137,16,17,130,9,133,17,12,29,171,179,
+76,0,18,94,0,9,1,33,12,143,162,168,41,197,1,16,162,136,151,1,75,186,129,138,185,131,33,75,120,128,195,96,
+152,171,19,143,152,19,169,66,17,203,23,25,128,144,27,11,192,42,130,17,79,177,18,137,151,155,0,176,155,7,153,49,
+88,169,5,161,19,187,28,139,171,248,132,40,89,136,40,1,36,159,24,138,171,149,147,0,114,128,48,145,56,138,142,15,
+177,154,132,136,56,131,144,151,18,242,41,137,153,168,132,137,34,41,163,134,176,23,140,0,154,216,40,168,48,57,17,144,
+23,35,27,46,168,26,30,178,106,24,76,8,129,56,227,11,129,31,168,130,138,112,41,26,2,128,162,10,210,13,195,161,
+57,89,90,137,91,196,2,185,147,152,217,131,195,24,121,178,123,144,1,137,161,43,192,152,18,224,121,128,74,152,131,153,
+0,45,152,168,2,195,123,0,59,128,243,3,184,44,162,169,64,211,76,129,75,168,148,33,56,217,49,14,185,147,62,130,
+76,153,0,32,2,171,88,159,129,33,32,57,47,193,145,136,21,154,11,195,176,18,107,16,28,194,128,32,80,152,137,161,
+58,185,79,146,40,129,194,75,184,180,144,77,138,145,75,149,140,252,78,0,73,26,180,153,147,65,44,44,153,195,61,48,
+30,179,130,137,89,43,9,216,32,25,31,18,176,165,1,26,8,41,151,152,45,9,171,148,2,179,131,49,152,158,3,131,
+175,34,13,162,90,164,0,138,130,170,162,23,200,43,184,181,168,7,32,11,65,154,169,22,8,27,156,149,185,33,19,140,
+147,33,251,33,56,136,159,20,141,164,131,0,26,160,212,145,0,40,143,16,137,243,0,56,137,8,147,130,105,75,171,180,
+0,131,43,58,40,203,211,165,40,9,243,145,28,163,41,161,122,8,144,130,3,52,250,3,159,148,8,41,41,26,168,144,
+0,123,193,146,185,167,0,57,152,165,178,1,144,121,192,146,138,131,45,154,48,164,1,60,156,50,243,33,141,1,8,225,
+131,32,144,128,185,133,192,82,142,145,129,152,73,41,128,128,161,106,162,48,191,148,128,16,12,145,148,162,16,92,184,50,
+251,129,74,137,24,162,17,81,30,41,194,50,172,1,61,152,226,1,17,26,28,145,181,113,170,129,26,193,130,24,32,74,
+200,145,163,120,138,145,172,148,25,58,120,136,178,0,136,122,209,145,136,146,8,0,25,23,193,8,136,120,168,161,12,0,
+144,168,133,147,33,92,170,120,177,163,11,137,17,185,145,21,17,157,195,112,152,148,140,136,1,138,0,88,17,128,242,123,
+161,131,153,153,56,0,201,57,146,58,148,31,195,5,138,186,2,145,24,59,161,38,32,31,242,18,25,138,26,137,195,144,
+3,47,16,137,229,49,10,25,144,138,132,128,48,30,40,155,183,18,58,58,11,29,160,40,24,31,42,138,215,33,24,25,
+24,153,136,1,176,24,122,159,166,24,24,74,26,128,9,208,2,25,91,216,181,32,24,75,8,145,147,168,161,25,48,253,
+182,56,26,25,9,168,149,0,162,91,10,226,164,73,59,27,26,176,129,51,160,74,177,250,151,107,26,25,25,144,8,136,
+80,128,160,229,148,40,137,153,32,168,42,137,72,72,42,244,17,77,136,9,144,161,130,30,0,42,129,211,56,93,42,137,
+152,0,10,177,59,170,23,166,64,61,42,9,8,16,26,184,25,172,183,164,81,29,145,177,147,128,10,163,10,209,16,163,
+127,58,168,178,147,24,27,169,3,204,210,130,126,42,128,161,16,25,153,194,241,235,71,0,195,178,147,32,127,43,129,161,
+1,0,43,140,9,184,137,64,63,139,135,179,1,16,60,137,154,152,225,33,45,11,149,132,16,42,43,42,11,241,137,57,
+47,154,165,148,33,16,168,18,177,0,31,138,77,187,167,130,16,32,168,0,153,145,137,13,138,243,145,180,48,52,136,128,
+208,16,216,128,171,243,163,48,60,57,48,164,9,25,61,47,208,242,2,128,25,0,16,18,144,26,8,15,160,232,130,56,
+46,24,161,34,73,137,88,14,161,225,1,25,26,129,152,2,50,88,9,137,176,240,24,77,12,178,164,129,17,18,16,138,
+215,179,72,45,11,145,8,152,48,77,16,162,210,181,56,60,11,152,144,25,27,90,96,168,151,177,56,42,14,0,176,128,
+0,76,56,144,19,212,107,42,154,146,0,153,26,113,152,0,135,9,28,40,157,129,17,152,122,9,161,130,104,161,171,122,
+153,26,3,144,74,144,184,192,71,144,142,130,168,73,129,8,89,153,176,163,100,136,12,136,177,40,17,130,60,201,200,145,
+116,145,154,145,169,72,65,25,24,249,152,17,121,146,218,146,128,25,35,136,42,235,16,42,120,4,203,144,136,128,21,0,
+25,185,217,34,104,18,158,152,136,33,88,40,187,210,162,56,120,1,170,12,59,9,22,128,161,176,27,88,24,151,168,140,
+58,41,51,33,189,160,26,56,113,151,168,155,128,19,36,58,157,160,9,81,24,162,201,158,147,2,4,49,207,1,128,16,
+88,145,153,159,3,0,2,32,205,147,130,81,152,145,232,186,37,153,32,41,220,16,128,18,162,1,241,156,53,138,145,17,
+172,32,0,66,168,41,241,172,23,138,0,48,142,16,152,19,168,24,242,139,83,184,16,40,201,17,180,22,152,57,224,184,
+114,169,16,41,153,137,179,5,137,16,177,143,97,176,1,41,176,9,146,88,177,25,146,191,112,129,26,75,161,11,40,74,
+9,105,44,204,18,132,153,8,166,0,25,1,146,123,10,242,8,32,160,184,5,11,137,2,1,123,168,179,29,1,134,169,
+88,9,168,16,129,90,184,104,171,145,21,169,8,129,8,46,145,58,196,58,225,160,82,194,145,48,41,13,2,10,146,169,
+163,174,75,135,9,59,145,10,32,44,164,176,80,225,10,67,161,171,7,137,136,168,150,24,60,11,77,0,136,129,15,0,
+19,171,49,28,144,61,24,168,2,67,191,146,23,9,136,8,129,172,167,128,32,75,235,146,33,128,144,8,1,172,135,152,
+72,32,250,8,49,137,8,8,25,203,135,137,48,40,251,144,34,161,144,8,130,236,51,144,90,17,250,8,50,136,42,137,
+193,203,135,24,25,2,205,145,49,129,41,11,162,251,20,152,32,51,222,41,56,145,41,179,168,236,50,43,34,145,249,153,
+40,18,42,128,50,254,33,8,40,21,200,154,88,176,0,161,18,201,57,44,168,135,26,41,77,176,1,224,19,154,64,43,
+187,21,160,0,64,243,24,193,0,128,107,138,137,131,8,16,11,165,1,241,81,24,46,161,153,19,136,26,81,169,136,196,
+128,74,44,144,187,135,28,2,24,176,133,208,48,24,45,177,201,34,176,24,21,145,186,167,24,128,59,241,160,18,156,51,
+17,153,134,193,34,57,31,162,156,33,168,137,35,178,217,6,154,80,11,197,136,33,140,57,163,24,25,179,177,20,143,132,
+157,72,168,24,40,147,12,5,9,0,48,211,185,120,169,48,169,96,170,3,44,130,137,164,141,61,179,160,88,8,203,37,
+139,3,8,146,11,78,168,129,1,74,172,51,159,35,201,66,172,41,148,137,57,36,171,66,11,66,224,20,11,60,177,8,
+160,32,159,162,43,1,177,120,9,45,3,168,144,114,154,128,178,73,208,49,60,156,149,138,130,60,9,106,155,20,184,121,
+8,153,133,137,148,16,9,40,216,2,216,16,0,186,180,177,167,8,1,73,12,35,142,24,8,155,5,185,165,2,129,32,
+128,176,44,155,113,200,210,152,183,24,128,18,27,163,24,48,49,251,20,203,21,27,130,75,208,144,193,161,161,181,145,27,
+97,140,34,74,0,9,168,129,228,145,146,10,30,146,24,40,21,205,2,226,1,129,16,28,25,17,1,64,137,155,184,167,
+0,241,121,154,25,163,131,59,132,172,148,130,42,162,78,154,42,196,33,154,34,141,162,40,129,141,120,137,155,7,144,160,
+35,187,2,147,96,26,57,31,10,18,153,129,43,241,145,131,64,188,122,153,9,66,136,136,32,218,179,50,73,29,28,152,
+80,9,25,0,14,178,161,56,106,173,16,0,56,80,41,129,41,150,152,65,58,186,185,14,33,31,136,1,29,2,67,0,
+157,133,137,40,56,217,56,9,35,58,147,35,238,132,11,121,27,152,9,224,18,152,144,19,235,5,58,74,59,168,73,184,
+51,43,179,146,244,146,26,123,11,131,9,160,96,137,33,40,252,16,45,60,160,2,170,183,144,40,176,182,0,136,42,42,
+11,169,194,32,120,67,145,2,200,7,43,58,153,179,76,137,144,3,7,168,167,0,9,58,251,147,57,30,136,145,88,193,
+131,24,176,26,193,9,195,18,30,48,45,73,26,147,132,217,181,8,138,196,16,40,138,2,177,51,3,141,13,185,250,133,
+11,132,128,26,67,27,32,41,15,75,217,1,152,163,2,170,7,9,131,224,16,154,153,73,153,33,134,9,51,154,20,167,
+155,50,141,10,35,14,131,154,35,187,135,164,184,0,11,74,144,106,35,157,97,184,33,194,160,40,202,40,210,0,132,45,
+57,137,89,193,136,1,202,32,243,129,4,138,81,139,33,144,155,72,142,25,192,147,132,185,98,170,20,144,137,128,13,73,
+208,56,131,169,112,185,20,176,161,146,172,33,185,56,132,184,69,250,51,176,1,24,158,16,169,104,129,9,51,221,18,144,
+145,24,234,1,138,48,2,28,81,156,32,147,24,171,241,90,169,106,146,128,64,141,32,128,10,152,242,40,152,74,145,19,
+120,139,48,0,10,225,242,0,136,75,161,18,1,224,57,32,43,200,196,8,91,29,130,160,148,161,57,88,10,226,161,41,
+62,11,34,184,19,168,73,64,209,195,180,107,10,9,48,152,72,184,89,41,144,242,1,46,137,9,3,24,24,162,47,16,
+8,212,24,139,8,184,22,144,0,177,10,112,24,177,46,139,128,193,51,146,17,183,42,0,131,8,26,175,145,243,32,1,
+12,132,13,146,33,25,78,171,146,168,21,41,128,130,174,133,16,40,30,169,129,193,105,144,41,160,160,148,19,57,31,192,
+146,16,91,16,59,162,203,134,56,42,12,241,129,136,41,32,26,1,250,19,90,58,31,209,1,152,32,24,25,146,233,3,
+56,61,11,241,0,144,40,1,42,179,241,147,96,26,26,224,129,145,40,17,28,146,233,132,32,10,59,248,0,136,73,0,
+75,137,226,33,0,24,13,243,24,136,56,16,62,136,153,129,50,10,200,243,128,128,16,21,45,128,10,136,52,42,187,244,
+102,242,79,0,136,160,34,33,28,40,250,18,89,144,25,233,144,130,41,149,42,136,208,89,0,162,168,160,30,144,41,135,
+136,1,200,56,49,228,129,152,26,40,45,20,139,129,217,24,4,164,226,161,43,136,58,98,168,17,170,57,51,183,193,193,
+10,24,137,85,154,1,11,46,1,179,196,144,140,147,9,38,161,74,137,59,0,135,145,43,141,136,168,6,161,24,43,31,
+1,131,145,44,143,129,160,36,162,137,41,187,165,23,25,44,171,42,177,49,165,8,41,175,132,50,136,152,171,72,26,107,
+151,25,128,184,16,113,152,153,226,25,8,24,33,26,57,248,40,57,167,177,176,41,9,76,20,169,17,176,47,32,145,241,
+146,29,128,9,3,227,131,10,90,24,162,146,154,27,24,15,135,193,2,152,43,33,129,186,48,175,56,27,179,135,177,145,
+123,24,128,168,144,153,123,27,1,210,195,2,25,74,131,249,2,152,63,24,137,129,132,10,80,154,131,192,160,73,31,25,
+0,136,147,129,32,24,22,248,0,168,46,58,136,9,132,41,41,16,16,247,136,128,44,137,3,152,148,48,26,92,18,161,
+31,128,12,24,145,168,52,240,17,136,48,58,142,25,170,160,68,153,130,132,176,131,121,16,14,136,216,8,35,141,2,136,
+152,133,75,33,173,145,145,139,121,130,32,8,195,73,24,72,248,144,177,10,123,152,32,177,1,16,59,122,226,136,1,140,
+72,178,8,132,168,56,91,91,160,200,161,192,40,1,24,32,40,30,81,47,146,178,137,195,60,2,168,17,167,184,20,154,
+19,105,143,16,12,32,160,145,149,176,16,32,58,121,186,16,187,36,148,58,132,251,24,161,129,114,185,26,232,1,56,161,
+17,241,137,128,130,121,145,152,186,49,75,20,40,225,176,40,18,109,145,145,203,147,56,80,144,160,137,156,134,74,178,1,
+250,16,25,24,132,153,137,168,112,43,163,144,242,25,1,161,20,185,160,163,121,26,194,17,208,26,49,168,52,188,177,132,
+88,27,227,0,160,155,4,8,121,208,128,24,0,44,164,59,8,248,33,8,74,161,153,32,129,15,151,137,129,177,73,41,
+27,131,186,41,6,13,20,155,18,133,31,16,152,33,160,154,36,143,18,153,168,36,234,32,8,9,131,218,81,186,51,139,
+225,81,160,28,201,238,79,0,129,161,33,200,56,153,122,168,144,90,33,157,24,1,25,149,25,30,48,169,129,176,83,16,
+191,18,178,1,2,191,97,137,8,24,26,48,241,42,128,144,115,187,90,146,160,16,144,57,36,191,130,129,80,168,28,130,
+177,1,149,25,88,128,142,16,2,169,74,157,163,133,169,131,26,66,241,12,50,153,24,184,29,133,145,137,194,65,0,240,
+58,128,24,165,171,88,2,153,144,136,50,34,223,130,130,164,144,201,97,128,160,138,131,59,112,250,8,149,136,129,153,49,
+0,249,17,8,40,178,250,147,2,136,144,169,20,130,142,41,32,243,162,208,57,4,153,179,128,34,72,15,24,196,178,20,
+158,16,1,160,161,152,104,136,137,211,162,35,60,14,26,5,153,146,9,58,50,242,138,50,31,32,203,129,19,136,10,154,
+41,7,192,104,26,41,16,243,26,49,26,154,192,180,133,41,13,41,25,3,153,143,80,152,128,194,8,121,152,25,144,17,
+17,176,143,72,144,146,136,63,25,144,152,164,1,34,248,26,32,131,123,28,9,128,16,160,144,33,17,249,29,18,90,60,
+169,42,162,1,8,152,121,162,250,3,90,43,145,29,0,24,128,9,10,150,145,12,105,10,149,152,136,48,26,32,193,161,
+40,150,31,168,165,130,160,8,144,32,40,216,8,114,187,10,151,25,131,138,152,181,56,145,208,67,92,250,130,8,32,136,
+9,144,153,4,177,114,44,227,161,0,0,32,168,8,240,0,161,112,28,178,164,153,17,42,48,152,209,210,128,48,42,215,
+18,168,138,32,45,32,194,32,185,42,171,167,66,169,82,11,27,177,161,23,137,3,156,213,16,136,57,26,24,152,176,178,
+26,114,188,135,59,0,59,10,131,45,195,16,42,138,196,149,76,137,25,137,163,57,1,59,176,82,250,52,31,161,56,184,
+34,28,161,41,176,123,192,34,46,161,42,136,1,169,35,11,170,35,248,120,45,128,57,169,18,8,144,89,232,32,184,98,
+47,160,129,152,131,26,130,106,153,32,225,81,12,162,25,195,24,24,137,8,196,25,129,93,10,164,153,164,128,24,26,48,
+170,164,196,93,176,148,137,165,25,0,137,41,195,168,5,60,153,6,169,132,42,41,128,43,178,225,164,47,210,2,137,147,
+26,8,129,27,4,187,4,31,171,242,73,0,194,34,138,148,43,8,153,19,192,192,167,29,179,17,26,133,13,1,0,42,
+181,8,194,58,195,120,137,17,12,136,145,128,179,225,165,27,164,105,154,66,139,8,129,152,163,184,133,28,40,121,11,73,
+152,137,177,149,177,145,18,159,81,60,137,121,168,129,0,129,129,9,59,153,123,77,152,57,137,178,32,168,145,228,65,14,
+32,60,200,64,160,90,176,72,224,2,8,136,24,60,192,72,192,34,186,131,56,172,37,14,8,41,136,179,40,147,106,29,
+0,152,73,138,121,27,9,130,184,4,161,170,20,12,105,44,74,153,177,20,176,40,1,209,63,0,123,10,9,130,192,130,
+128,25,144,59,144,45,98,28,41,209,1,162,73,171,5,43,128,45,92,9,9,225,151,40,176,131,153,141,16,42,92,168,
+18,147,24,144,168,91,41,148,58,180,75,141,193,151,8,26,192,0,146,48,209,57,155,171,149,132,64,195,130,169,34,44,
+162,76,47,225,145,146,17,177,144,25,210,130,33,64,234,129,15,162,1,89,128,137,25,8,130,113,136,162,140,184,145,22,
+10,197,136,42,40,40,42,163,148,189,160,49,99,241,1,186,9,4,9,18,148,32,159,8,17,57,1,140,27,61,147,178,
+58,40,63,159,131,152,50,192,129,90,10,150,129,8,8,40,142,152,49,41,0,143,153,1,178,35,174,1,65,209,41,152,
+35,228,130,200,2,64,168,26,137,146,68,191,2,176,96,192,11,56,194,132,162,24,2,16,148,143,40,150,8,137,200,1,
+33,202,161,0,149,144,241,89,42,40,184,128,168,133,18,169,32,162,240,82,234,57,1,136,176,17,143,130,18,155,129,33,
+79,25,242,8,17,0,8,136,169,7,8,138,59,29,3,192,147,143,32,131,11,144,232,51,32,251,0,32,146,8,57,253,
+16,19,169,41,201,128,20,186,136,67,128,165,145,215,10,33,177,161,178,192,38,162,154,2,0,164,28,89,250,25,36,155,
+8,1,28,21,171,160,34,32,155,192,23,205,18,129,128,32,187,112,128,136,153,1,65,15,56,152,143,49,162,152,144,9,
+164,50,157,73,33,0,157,34,232,27,51,160,192,160,122,8,24,62,137,33,139,194,97,234,32,33,28,138,1,42,164,128,
+168,18,18,139,76,32,191,17,4,140,145,13,70,207,75,0,5,0,153,56,73,25,74,168,242,59,49,137,153,137,140,38,
+128,15,41,130,10,17,25,175,34,19,14,136,137,73,64,240,128,0,1,8,145,25,175,51,162,216,41,242,49,162,144,27,
+149,48,138,16,207,33,8,180,160,144,48,9,180,61,8,77,145,16,173,149,57,146,136,201,128,3,19,31,137,32,216,135,
+172,3,0,32,137,59,43,43,134,211,8,133,42,145,141,128,147,89,25,156,24,209,8,151,59,145,48,232,9,72,161,0,
+196,160,128,17,45,148,152,130,49,14,29,160,181,1,195,26,9,16,56,135,8,8,56,243,184,129,2,89,137,43,10,184,
+90,18,140,167,129,128,173,74,0,73,131,184,58,154,160,21,199,16,136,64,170,28,144,177,114,153,145,146,208,57,165,72,
+169,18,130,163,30,144,179,201,135,138,129,122,185,49,168,128,33,224,128,196,0,136,144,123,145,138,132,24,44,32,138,40,
+45,160,61,33,249,16,130,156,67,139,163,18,153,121,136,76,184,1,56,26,8,243,147,140,120,11,8,16,242,40,128,24,
+169,147,41,195,123,137,129,26,167,43,144,88,185,129,179,160,122,145,28,178,150,144,65,138,131,136,211,0,62,136,152,228,
+130,25,26,130,137,152,150,169,120,160,162,146,194,75,129,144,32,200,18,154,90,31,146,217,51,29,26,49,186,32,33,43,
+124,144,26,164,64,12,145,42,146,59,158,5,13,161,129,240,50,138,25,33,136,25,181,160,57,244,145,0,73,201,65,154,
+56,137,176,120,10,24,25,224,122,9,24,0,128,128,49,43,24,136,227,61,137,14,18,154,0,151,140,51,186,130,56,136,
+47,200,17,41,147,90,155,16,185,23,11,72,138,240,32,208,33,161,25,25,176,51,129,91,138,151,44,161,34,155,53,158,
+128,129,144,125,152,128,0,168,0,147,91,57,187,165,42,58,195,8,144,72,243,24,24,8,138,135,142,64,137,152,32,177,
+34,160,109,136,0,4,171,40,156,36,14,17,9,10,64,219,49,40,47,137,197,146,160,132,26,8,24,128,145,11,107,216,
+148,163,188,22,139,129,1,24,139,7,144,8,4,19,154,121,0,156,209,16,27,136,129,242,177,194,25,88,176,61,154,161,
+164,144,2,147,41,22,30,0,60,134,24,8,153,152,147,142,136,220,73,0,18,72,57,24,41,59,158,7,59,180,18,205,
+132,28,9,8,32,179,168,67,219,32,137,2,10,39,56,175,145,8,40,25,34,128,173,135,138,152,144,106,11,7,26,170,
+164,28,24,144,49,195,56,146,15,128,136,50,233,36,8,234,2,141,129,160,90,148,9,17,170,25,176,8,145,39,73,137,
+76,201,160,17,56,36,31,146,160,24,152,64,155,22,129,33,171,136,141,194,163,21,137,82,138,218,2,140,129,34,24,149,
+0,11,249,42,169,132,48,162,160,10,31,9,235,21,168,65,129,202,147,188,8,6,27,148,72,153,145,29,226,32,129,17,
+40,137,141,196,11,17,170,39,8,161,32,31,176,89,161,17,9,3,184,11,252,130,144,81,40,169,130,155,169,145,57,16,
+112,20,210,169,41,140,200,36,58,133,120,138,177,42,216,49,8,144,50,130,239,3,157,16,16,24,132,41,248,0,144,41,
+128,17,40,3,250,74,232,57,16,25,105,137,195,25,138,146,56,2,177,82,162,10,12,175,148,1,48,2,177,27,219,60,
+12,20,25,1,130,123,189,145,62,144,48,16,181,24,186,25,177,123,145,132,58,73,218,42,232,1,33,9,150,43,211,0,
+10,161,120,144,129,50,216,11,148,43,137,2,21,168,40,170,174,3,136,66,145,125,178,155,33,175,49,161,18,1,136,12,
+157,32,177,20,16,56,4,205,12,227,56,8,17,107,225,16,153,9,16,17,130,26,134,169,169,32,30,1,133,8,0,8,
+173,209,34,1,33,31,182,144,160,48,15,146,130,1,128,155,145,12,36,27,33,28,149,168,170,108,141,132,0,9,131,141,
+128,192,64,161,3,144,131,8,253,73,168,147,19,9,32,157,137,226,72,130,8,137,149,10,208,76,168,165,50,152,40,11,
+141,195,33,146,2,44,131,155,240,75,217,132,72,137,56,139,208,161,17,0,35,12,37,141,145,31,160,147,105,144,24,144,
+170,163,58,73,4,139,37,156,162,31,225,18,41,1,41,154,10,200,48,26,7,9,131,136,216,46,176,3,90,145,64,154,
+11,210,152,35,149,41,65,138,202,30,176,17,92,163,8,0,184,170,56,91,20,184,115,169,8,141,241,18,42,1,16,160,
+9,250,32,26,65,161,48,2,240,29,241,17,42,129,32,137,9,241,0,59,130,238,74,0,18,24,16,164,128,191,180,48,
+31,131,41,136,24,185,168,57,129,146,122,165,144,169,243,73,29,1,0,40,128,169,57,187,16,130,122,165,72,217,178,72,
+187,19,89,168,50,169,25,27,31,145,18,35,11,149,235,64,216,57,16,184,113,144,160,72,153,178,90,146,138,16,161,95,
+136,136,128,144,26,165,153,50,186,149,45,146,44,144,167,74,176,32,11,160,25,16,177,76,136,183,56,128,45,161,131,122,
+176,122,160,0,10,210,16,152,145,134,138,36,171,40,2,31,148,9,130,148,141,165,152,41,193,81,170,34,138,169,97,139,
+3,25,145,154,243,72,155,89,200,19,44,146,168,195,34,31,145,122,136,9,152,18,136,26,193,132,13,18,12,168,135,10,
+148,40,8,8,152,16,138,82,185,3,204,22,141,162,1,29,150,26,145,162,153,132,160,40,185,23,186,3,25,250,72,185,
+6,26,146,128,172,21,139,40,0,17,45,146,152,158,66,156,32,75,146,91,241,33,138,17,200,34,138,4,44,193,32,156,
+133,9,25,130,241,17,136,43,177,120,153,66,27,177,92,216,3,139,17,9,216,20,138,128,0,26,24,27,4,240,151,154,
+18,92,154,18,154,18,44,137,96,187,135,8,161,16,41,40,154,46,162,168,120,12,2,24,184,56,129,121,25,162,64,10,
+69,142,16,9,232,17,25,43,16,186,152,160,8,234,4,28,19,15,164,27,153,144,50,40,72,212,32,187,132,73,40,178,
+6,128,35,189,76,185,129,4,3,44,129,141,176,162,121,145,49,249,17,161,200,57,8,169,23,8,25,160,12,225,2,128,
+66,12,162,0,227,176,25,40,46,165,8,162,136,12,144,0,135,128,0,24,59,243,168,164,17,29,3,10,195,181,9,10,
+105,209,18,160,136,1,146,174,147,144,40,33,0,246,145,178,40,153,37,136,160,16,1,88,159,196,1,136,17,144,73,169,
+42,10,161,98,136,230,129,32,9,217,34,12,137,5,25,136,163,242,10,130,58,58,132,154,88,25,208,76,185,199,1,0,
+41,25,9,201,148,16,32,128,176,179,5,57,31,137,209,49,16,144,121,155,200,181,17,73,24,27,10,149,9,29,160,145,
+106,178,130,123,10,155,49,152,35,16,31,26,145,163,173,130,123,59,40,161,58,218,128,121,253,254,78,0,137,132,40,47,
+26,16,144,217,2,58,77,129,176,146,8,47,74,25,145,130,12,128,1,195,241,129,108,59,8,144,161,161,136,89,32,128,
+176,8,77,123,41,186,33,76,10,131,128,136,242,8,122,25,8,9,168,129,65,24,219,24,28,0,104,9,152,168,145,80,
+145,0,184,224,2,81,123,154,10,42,160,7,128,152,161,136,57,133,91,12,144,129,51,1,243,15,8,161,5,0,28,128,
+28,8,164,128,0,27,146,34,180,193,31,139,167,147,146,168,41,46,144,148,40,8,45,136,148,145,164,15,128,164,3,161,
+137,42,30,161,132,168,18,137,145,0,146,51,255,145,0,163,134,170,57,155,132,131,144,40,240,34,15,195,50,189,130,18,
+75,16,171,42,184,6,74,209,1,152,16,24,1,89,250,0,42,88,9,227,9,177,18,32,144,10,25,24,26,112,44,199,
+43,128,163,33,152,250,32,24,42,34,143,162,16,160,19,58,135,189,131,19,61,33,143,0,9,162,132,139,146,8,72,152,
+153,114,240,42,58,178,48,184,192,17,128,80,9,75,142,134,138,130,16,0,174,146,18,32,41,45,143,147,9,148,168,144,
+20,42,152,8,113,168,143,3,137,132,128,234,49,26,160,3,140,89,153,147,41,209,83,250,40,40,168,50,154,47,176,133,
+9,178,0,8,17,145,144,120,130,143,177,133,41,145,169,24,25,131,145,201,9,114,217,34,168,50,248,29,40,178,3,145,
+189,96,192,2,136,192,88,144,16,10,129,66,221,72,152,32,161,160,28,180,17,145,137,161,34,93,242,40,144,147,143,147,
+129,16,145,169,77,8,242,18,168,16,41,136,25,146,18,249,30,72,192,3,177,170,33,136,104,129,153,106,160,72,209,3,
+177,156,2,179,112,144,169,91,152,56,180,152,177,32,44,130,136,36,251,46,32,27,167,144,168,2,137,81,152,136,24,9,
+136,167,149,185,8,90,153,21,154,144,146,12,66,193,181,0,152,90,16,16,234,16,59,28,20,200,164,152,9,106,8,129,
+9,136,32,92,179,240,146,43,9,67,154,162,193,26,49,41,19,240,166,43,65,24,170,107,156,1,34,154,19,232,128,44,
+24,76,1,136,210,1,33,170,15,241,147,57,40,59,136,193,184,32,25,34,128,151,0,79,40,158,129,8,226,236,75,0,
+9,34,128,17,242,169,2,15,64,152,40,147,11,51,216,157,147,192,50,41,73,42,248,32,187,18,17,25,4,243,19,29,
+160,28,160,9,131,161,52,146,218,167,17,29,57,152,179,132,18,42,153,15,241,145,48,12,16,130,201,19,160,155,7,10,
+145,145,113,44,152,128,155,17,154,166,32,208,148,128,66,13,8,160,177,67,170,64,144,42,217,166,107,154,0,1,168,51,
+129,47,178,161,178,162,123,177,145,5,141,0,177,137,20,16,2,1,124,153,161,147,249,33,137,93,161,144,40,202,32,200,
+178,52,217,104,136,9,0,177,145,48,95,160,56,136,15,56,137,153,132,0,25,32,63,168,160,80,185,17,18,184,128,148,
+63,31,2,171,3,32,155,120,136,24,58,27,73,154,120,152,154,33,12,43,3,15,177,68,155,105,136,41,8,56,168,66,
+9,244,56,185,3,59,44,8,192,121,160,8,107,209,24,17,136,58,40,201,123,168,0,28,162,58,8,48,152,29,43,167,
+129,57,195,14,18,160,107,192,0,26,57,58,185,7,11,146,41,130,161,228,74,128,107,163,154,224,148,11,40,129,91,162,
+56,145,93,160,10,137,178,34,7,208,49,173,17,154,26,4,9,146,23,12,18,171,8,194,19,48,51,251,149,29,177,59,
+162,153,7,144,48,9,184,216,195,16,131,80,144,28,243,0,139,56,185,3,129,183,164,72,170,58,153,34,123,24,192,34,
+174,164,161,161,25,19,107,40,91,140,0,209,72,160,131,58,152,181,61,176,72,201,163,167,24,194,33,13,129,128,153,35,
+154,17,209,199,16,153,64,13,1,144,2,8,161,161,17,25,11,1,113,242,80,170,161,17,232,0,130,58,1,27,73,168,
+40,120,13,90,8,176,180,24,26,140,72,217,34,17,13,48,12,2,200,149,75,136,89,137,169,148,41,13,0,0,208,67,
+11,25,65,233,17,161,74,0,153,182,58,153,48,203,56,229,32,8,128,42,144,181,137,19,136,43,124,248,130,25,145,44,
+145,129,181,18,137,73,10,2,136,129,3,250,50,31,224,33,185,40,9,132,9,1,9,146,17,192,209,98,140,32,249,19,
+156,16,137,193,2,3,26,81,46,144,152,180,178,17,161,92,184,180,24,26,31,17,155,7,136,178,88,154,131,9,146,124,
+113,30,78,0,184,50,143,147,27,210,32,137,2,25,2,29,193,34,155,96,11,2,28,213,56,153,128,43,179,163,65,145,
+9,67,158,20,26,59,19,63,11,208,130,10,137,58,177,129,7,76,16,47,144,160,130,73,44,8,9,10,244,40,27,75,
+161,33,176,114,155,33,192,32,184,112,26,9,182,26,137,57,219,5,160,147,40,56,63,137,162,128,41,120,10,40,240,16,
+139,56,46,136,164,8,146,48,14,41,136,144,33,50,10,95,217,130,138,131,91,58,40,177,57,181,42,43,5,60,160,64,
+242,24,30,177,8,146,16,43,20,30,0,168,164,128,129,152,33,115,14,242,40,168,32,138,146,178,148,165,25,58,0,14,
+163,146,195,132,40,175,149,153,179,24,64,26,130,8,215,16,152,25,40,40,177,137,151,29,144,58,203,4,179,80,168,48,
+139,144,42,228,2,49,241,49,142,1,140,147,160,88,0,145,73,177,128,195,169,66,25,33,46,242,0,208,32,27,24,195,
+56,179,11,132,137,201,67,210,96,186,163,24,184,78,144,8,17,168,18,193,80,13,16,137,56,17,250,64,138,152,179,229,
+72,153,16,40,138,33,25,0,41,208,167,162,121,29,136,144,144,32,42,59,75,241,131,161,48,137,73,75,136,91,154,213,
+0,178,8,88,59,138,148,1,160,165,41,61,24,200,3,209,16,76,11,76,152,177,34,161,76,180,8,8,89,138,131,11,
+241,3,15,128,136,211,17,129,93,25,25,42,161,184,98,152,136,129,42,10,169,137,123,136,17,25,145,17,115,221,5,25,
+153,51,15,41,242,145,128,129,41,144,57,145,136,2,152,123,168,21,10,29,180,176,121,152,59,32,138,162,151,24,152,145,
+58,128,41,56,159,167,128,168,8,91,186,167,34,153,106,43,166,73,153,130,168,157,131,106,27,8,26,4,89,185,129,152,
+90,56,25,24,144,194,27,122,43,171,200,34,63,17,12,19,171,50,203,96,57,208,5,11,40,156,226,16,136,51,139,67,
+138,250,1,10,74,181,89,144,1,12,178,60,153,135,41,179,8,161,185,34,15,133,74,154,164,136,192,1,42,33,152,5,
+170,146,60,170,122,179,65,170,40,12,9,15,227,18,8,16,41,233,17,144,25,146,104,153,162,24,148,141,0,139,163,20,
+155,49,47,160,85,227,73,0,44,162,83,144,3,154,17,64,253,48,141,2,144,40,144,184,76,226,33,25,160,136,128,122,
+162,10,178,89,41,150,10,1,157,130,1,2,130,175,130,40,34,64,239,147,9,17,146,136,139,136,121,162,128,178,10,137,
+19,116,201,140,145,33,17,181,11,138,152,37,66,192,136,138,41,66,152,51,255,0,0,33,185,228,58,128,16,4,168,44,
+136,88,161,1,33,223,145,19,29,163,138,11,5,40,0,192,152,16,26,6,137,18,250,40,128,49,17,156,175,3,17,56,
+196,25,156,134,145,41,16,202,28,5,9,162,58,252,147,16,144,34,156,41,136,147,152,23,170,15,17,179,65,153,248,0,
+129,24,146,60,138,17,161,130,128,23,191,16,4,26,179,224,58,106,160,17,192,0,26,83,155,132,40,220,16,41,24,160,
+179,31,162,49,169,130,174,36,9,178,131,137,165,143,49,145,165,89,235,33,136,24,146,136,75,17,144,8,40,161,255,1,
+163,91,178,169,40,89,184,35,157,162,136,50,33,139,7,250,25,121,152,56,168,137,184,36,169,134,153,25,96,9,40,9,
+153,30,144,34,130,210,240,33,44,8,130,154,32,75,73,168,166,16,240,137,34,28,131,0,15,24,136,56,152,160,74,144,
+16,76,151,153,9,74,152,114,152,168,0,8,72,144,3,138,209,74,167,41,194,138,9,64,42,130,177,225,176,16,25,128,
+6,139,131,25,131,219,209,122,185,37,136,26,144,217,8,163,80,58,131,139,150,58,248,74,152,128,32,130,139,167,42,153,
+161,106,164,128,130,41,11,120,141,136,128,136,5,24,40,187,227,27,130,75,50,0,11,17,228,130,187,193,146,49,16,151,
+122,153,148,169,1,40,17,94,177,128,17,169,27,154,25,144,22,28,165,137,137,154,18,95,192,129,32,209,33,9,25,145,
+50,191,135,27,136,145,152,32,195,16,24,209,64,136,140,18,8,107,20,157,18,153,9,76,226,129,0,25,154,149,41,192,
+121,10,2,155,2,1,10,77,224,129,2,168,0,48,155,227,3,14,88,27,210,2,16,41,148,154,2,213,32,144,44,24,
+193,177,97,186,48,184,149,186,135,24,12,41,200,131,25,146,123,169,36,171,1,2,46,43,214,0,0,8,42,42,145,208,
+88,27,25,129,169,151,40,59,32,4,69,0,193,74,128,160,90,89,141,147,128,177,64,161,9,176,67,143,132,42,138,144,
+177,164,168,135,24,186,68,171,128,132,75,139,135,24,152,18,155,130,181,19,78,9,58,201,147,178,74,138,163,154,7,8,
+170,33,250,3,43,145,124,160,160,178,96,139,163,57,184,133,106,10,169,16,10,135,59,164,184,146,73,142,35,138,146,144,
+3,90,220,50,142,2,56,138,129,168,122,201,67,11,146,42,185,50,240,0,160,17,79,152,16,136,25,168,178,72,176,56,
+225,160,7,24,25,162,95,145,178,19,12,136,129,169,3,172,67,139,145,77,186,50,159,5,137,129,136,201,67,154,33,160,
+1,193,183,123,153,144,10,148,24,16,106,200,16,128,145,152,0,73,185,97,1,177,201,167,9,91,178,152,1,147,15,112,
+10,8,8,162,16,26,202,150,144,121,192,48,13,144,0,145,57,179,176,48,184,81,243,104,10,9,17,41,32,160,57,212,
+29,210,213,40,25,8,128,163,136,153,128,34,142,4,194,125,9,128,129,184,0,58,157,35,8,193,151,75,136,8,168,147,
+41,144,17,32,91,160,231,75,9,169,40,148,137,50,176,146,224,160,134,77,136,129,8,147,48,185,141,144,240,41,34,63,
+128,146,137,162,137,2,153,128,151,161,23,62,168,144,152,128,10,80,24,161,147,128,99,31,160,129,169,5,9,40,128,224,
+177,130,73,142,146,0,152,114,9,40,154,130,131,11,113,171,166,0,8,48,43,27,218,160,2,200,113,219,133,25,144,32,
+138,146,168,152,115,154,83,173,4,10,137,18,192,75,160,17,9,195,112,217,2,25,161,56,168,57,27,129,52,27,125,171,
+162,0,208,0,3,140,166,4,10,34,47,171,134,26,41,40,169,131,146,233,2,156,32,204,33,97,10,32,144,168,34,171,
+151,58,40,243,49,25,40,188,165,27,169,24,40,162,122,230,32,42,152,24,210,24,25,17,160,33,186,241,32,141,194,24,
+145,24,49,130,112,193,41,244,25,16,153,16,131,58,156,151,153,9,138,198,56,128,163,73,195,32,152,184,120,170,64,196,
+89,153,1,155,148,139,163,146,75,163,42,199,72,152,136,8,163,91,163,33,233,132,140,164,28,162,17,9,21,43,144,17,
+184,18,155,213,44,166,0,201,132,29,145,10,182,218,75,0,130,129,62,147,46,195,32,169,34,186,131,41,145,50,191,135,
+31,146,10,145,129,24,1,58,177,50,140,134,141,3,44,137,66,171,132,29,145,11,128,130,47,131,91,176,20,27,1,171,
+57,162,13,7,171,51,15,160,128,179,24,122,168,104,168,132,10,131,44,137,2,160,4,176,35,143,128,152,136,60,123,200,
+49,194,57,136,146,185,128,150,28,97,139,1,170,3,156,1,154,114,232,34,193,90,136,8,128,40,136,91,145,10,128,242,
+8,43,161,168,113,210,64,152,32,137,152,166,9,59,145,165,8,83,173,32,26,155,152,20,168,79,178,0,149,9,130,11,
+26,132,177,98,63,201,18,169,41,0,25,131,24,151,128,81,15,0,160,145,17,42,57,14,196,24,168,91,152,171,23,137,
+0,33,26,137,33,200,59,120,46,144,161,180,152,1,11,162,184,55,171,120,42,152,163,128,179,91,24,152,135,201,5,28,
+26,185,164,129,72,0,58,195,24,164,137,65,31,192,148,16,185,97,155,24,152,161,32,107,44,211,2,128,33,140,17,153,
+211,35,0,60,29,243,0,168,17,27,0,144,149,161,35,95,201,163,16,26,74,0,185,34,203,129,10,79,153,197,64,9,
+9,17,168,163,8,163,74,75,242,180,91,168,40,169,130,136,211,65,25,8,177,135,75,153,40,161,24,129,80,156,73,30,
+224,17,42,9,0,56,153,150,136,49,31,152,162,146,122,144,161,25,211,128,137,66,13,128,196,34,45,161,33,200,18,26,
+177,122,153,145,243,32,28,160,24,176,2,162,57,40,47,194,181,105,10,144,16,161,17,152,26,126,154,146,162,57,30,161,
+1,185,6,41,9,106,153,130,162,123,137,178,48,241,40,152,128,91,160,144,211,121,153,1,8,128,128,128,56,24,158,148,
+162,79,152,129,25,161,0,10,26,94,168,131,129,120,168,132,42,168,64,27,41,92,160,130,160,47,208,16,10,179,25,2,
+32,141,4,152,146,47,226,32,10,131,43,145,32,170,169,128,146,223,166,24,25,49,155,20,25,138,182,10,131,41,212,36,
+28,146,44,9,27,156,166,26,163,43,151,32,171,7,11,1,26,201,6,26,130,12,165,25,139,2,11,57,29,2,146,32,
+22,204,22,27,137,145,130,57,129,26,167,10,176,169,193,76,50,244,69,0,154,163,113,0,8,137,135,169,132,156,132,25,
+185,39,139,130,138,184,17,172,151,139,21,42,144,33,138,34,142,129,90,137,52,140,97,42,240,8,9,26,162,137,48,241,
+146,152,146,43,227,41,25,186,39,154,50,10,48,159,17,43,146,122,25,129,115,184,48,160,48,172,33,28,146,120,8,138,
+56,173,161,9,16,249,88,152,148,41,40,14,74,193,129,144,49,75,57,153,8,176,45,139,123,209,18,200,51,139,57,42,
+195,29,147,29,74,129,26,166,56,188,40,218,130,136,1,57,136,147,180,193,95,161,28,146,57,10,4,144,136,167,27,26,
+59,153,144,167,73,130,193,133,136,1,106,9,61,162,18,149,161,192,181,168,193,18,12,1,76,160,64,128,43,176,166,128,
+227,41,128,88,27,165,10,17,140,168,145,176,194,35,74,80,152,227,24,0,28,24,202,131,132,17,44,137,220,198,128,0,
+25,43,33,136,34,120,27,0,168,215,128,162,40,40,147,9,176,63,155,8,187,167,136,82,9,16,18,154,180,125,184,33,
+193,147,16,33,136,138,241,176,17,139,210,64,186,7,137,49,10,153,32,228,8,144,177,90,209,5,154,17,138,28,0,168,
+73,169,7,8,195,35,171,33,185,242,64,152,25,144,148,128,209,64,204,32,177,8,32,40,128,150,49,59,242,33,249,24,
+163,169,65,177,65,171,16,31,170,81,156,40,162,132,128,167,129,192,34,28,144,120,153,24,130,0,178,146,170,242,106,153,
+145,40,136,192,22,138,129,73,170,163,57,160,176,122,152,162,131,236,2,12,130,41,29,129,195,120,136,136,130,178,75,144,
+105,153,107,160,147,74,185,138,210,17,138,129,92,17,62,145,18,28,19,205,51,171,130,57,170,39,140,161,177,60,187,243,
+49,185,67,41,41,64,156,18,212,91,161,144,3,195,48,16,139,12,142,228,17,9,129,43,18,24,57,26,46,106,188,133,
+8,160,2,169,81,171,9,60,11,94,168,2,145,33,145,194,113,170,64,137,77,9,136,130,16,137,144,175,17,137,136,96,
+59,24,162,151,32,44,177,42,26,241,50,27,33,61,240,0,44,10,25,9,62,179,2,131,1,27,211,17,14,40,27,124,
+41,146,137,1,185,170,183,24,161,16,112,41,92,144,25,10,145,201,130,129,51,4,66,0,128,135,56,216,45,177,44,153,
+2,12,5,58,2,136,163,3,191,149,9,25,3,28,51,61,171,203,162,0,175,135,26,33,0,8,18,45,24,171,48,169,
+15,6,152,2,162,139,248,90,168,8,16,8,136,7,9,145,146,144,212,27,178,147,130,3,107,147,141,240,130,192,2,26,
+3,1,132,164,155,23,155,161,25,177,34,44,134,139,229,129,169,1,11,179,136,52,40,61,32,217,151,136,144,129,25,195,
+0,131,194,31,152,16,233,32,176,34,169,151,1,161,35,14,146,9,180,59,160,122,145,177,9,215,32,169,16,11,165,24,
+8,106,152,32,200,149,8,145,26,144,165,41,193,61,162,58,225,161,48,194,17,154,7,57,144,65,26,152,105,202,64,184,
+25,242,145,40,241,32,184,57,128,162,59,164,73,192,20,11,195,73,211,41,129,184,105,154,74,192,57,168,25,25,167,57,
+25,133,41,177,72,139,88,75,11,80,201,74,128,153,160,212,48,201,104,25,8,25,34,31,0,41,185,132,75,209,73,153,
+137,18,138,43,106,59,211,16,56,131,123,144,146,137,132,41,75,89,157,144,40,202,92,192,0,129,147,128,17,104,137,40,
+31,8,60,136,33,240,8,176,176,120,152,57,17,128,123,152,152,145,8,160,36,59,4,51,203,233,29,141,16,32,41,135,
+24,144,193,137,153,2,107,162,50,73,146,152,207,25,140,1,146,52,90,161,138,233,128,129,33,33,49,137,138,71,140,241,
+8,152,65,0,0,2,27,14,168,17,17,133,40,233,192,17,9,168,78,137,160,17,171,4,11,234,130,152,124,147,32,138,
+193,72,160,181,138,179,195,52,145,136,50,250,44,2,138,22,8,29,145,41,49,184,143,177,164,88,136,162,60,242,128,0,
+0,16,9,216,129,32,166,145,30,16,26,18,42,192,152,185,51,161,134,179,208,75,76,40,128,206,1,129,76,164,161,8,
+169,25,96,145,145,144,208,33,48,129,252,0,44,40,16,168,193,243,16,24,3,152,160,162,2,120,80,224,26,0,128,19,
+136,174,146,8,57,67,14,136,194,1,147,36,205,8,128,129,22,9,12,144,144,32,166,136,137,194,146,67,27,242,31,129,
+129,130,145,170,8,129,41,6,168,61,136,18,140,7,203,41,72,137,4,153,26,10,26,150,154,242,73,0,164,226,0,18,
+186,51,32,206,41,73,136,151,152,152,130,33,26,35,189,122,160,40,144,182,192,129,32,41,0,138,143,16,145,24,146,192,
+152,135,41,0,32,243,30,56,160,32,209,168,17,161,57,48,253,32,128,24,161,163,247,8,32,8,24,152,169,51,168,93,
+179,232,129,147,42,8,57,210,15,48,161,74,178,201,3,48,11,66,208,145,1,49,25,46,147,223,147,19,27,129,12,74,
+194,0,33,172,24,161,129,113,27,56,250,26,132,137,3,188,179,132,194,120,136,26,8,162,1,144,50,252,59,3,8,123,
+192,26,145,129,48,176,59,9,128,39,168,125,209,43,17,152,35,202,25,16,169,83,153,29,9,40,48,160,68,243,62,136,
+1,40,184,59,130,41,34,162,202,160,94,136,24,40,32,255,2,25,1,210,144,25,41,41,42,209,32,15,131,32,25,242,
+28,8,129,18,211,9,75,44,0,1,209,144,8,2,88,211,146,15,8,0,34,154,177,25,140,7,24,193,24,9,77,144,
+3,240,58,138,18,33,192,194,152,144,98,10,164,9,25,181,98,144,217,130,137,34,40,187,183,152,2,177,121,136,168,180,
+91,1,8,175,149,9,131,0,136,160,137,162,59,113,138,211,17,169,68,202,41,201,18,35,44,57,172,211,24,129,147,33,
+60,225,32,150,141,0,139,146,134,128,178,41,139,160,128,55,62,144,27,178,133,170,179,123,8,145,2,33,15,8,169,166,
+56,180,1,43,0,153,193,72,15,0,152,149,25,179,26,43,13,131,210,97,27,152,147,241,130,152,40,56,13,148,152,48,
+186,145,242,145,72,145,74,137,130,43,230,105,153,129,0,160,32,129,138,177,41,180,144,73,245,17,200,34,142,16,10,130,
+160,36,129,59,243,128,144,2,89,59,74,16,219,166,8,152,197,17,160,32,43,168,76,160,128,73,154,51,229,145,9,11,
+10,92,152,50,43,20,45,192,178,56,170,122,0,17,16,140,243,62,153,0,128,50,60,57,11,28,168,40,4,58,100,11,
+200,56,140,9,60,58,194,4,160,9,8,14,150,75,17,108,137,92,184,1,144,18,43,145,149,91,137,75,168,146,8,8,
+7,171,22,143,130,26,145,16,137,146,145,10,18,15,147,152,20,10,92,240,0,144,0,57,32,160,58,248,252,235,75,0,
+72,139,2,41,146,212,160,182,42,128,75,9,80,152,48,169,155,229,146,1,130,1,140,213,75,152,24,74,136,164,40,161,
+0,201,147,136,54,193,121,201,146,8,8,17,40,160,32,249,148,136,0,202,53,173,50,29,168,32,153,130,33,209,0,227,
+129,129,41,225,161,128,56,128,193,1,200,200,35,10,121,136,3,41,8,195,0,251,50,219,146,32,172,3,26,167,25,150,
+11,131,32,218,120,184,8,2,153,57,244,24,8,145,58,195,104,59,24,128,96,193,8,1,57,183,132,170,241,169,56,73,
+160,17,156,135,17,192,16,241,9,32,162,121,137,8,153,179,17,145,140,163,26,150,165,107,169,144,162,33,91,25,153,65,
+141,146,182,58,144,130,209,132,9,138,161,25,160,32,32,79,16,153,8,134,200,149,8,184,33,216,149,74,184,150,136,0,
+25,24,59,152,0,232,5,30,179,17,161,130,13,4,27,177,147,248,130,28,176,131,25,33,169,6,11,133,137,25,72,45,
+162,136,242,49,171,48,30,0,145,59,133,44,212,2,176,40,107,170,164,136,176,147,5,141,149,9,194,1,129,8,160,177,
+79,137,17,12,18,9,3,24,152,26,123,128,41,63,10,171,162,177,177,55,75,136,42,144,168,38,57,248,34,15,129,75,
+168,146,128,16,24,44,43,240,81,9,41,195,146,138,148,58,0,145,121,219,67,44,136,128,225,48,141,162,25,184,3,210,
+80,24,42,42,168,2,129,241,181,75,10,136,107,137,164,16,192,19,139,50,44,140,121,241,17,153,0,58,0,59,163,0,
+136,184,90,195,73,145,47,154,8,152,162,33,112,185,36,227,32,16,25,76,242,16,169,33,30,145,24,210,40,144,0,129,
+56,168,3,143,228,24,144,144,41,1,146,147,33,157,72,24,155,229,24,161,92,153,3,138,131,138,131,64,24,1,13,57,
+254,148,9,145,40,137,16,56,153,64,159,4,40,193,72,15,162,41,184,4,24,18,12,19,156,131,145,197,129,242,16,154,
+0,76,152,16,208,19,136,144,33,72,11,3,207,165,11,182,0,1,0,43,0,137,146,135,8,27,224,17,233,49,12,17,
+42,242,17,128,42,0,160,197,0,26,40,15,130,42,136,56,28,130,184,167,145,120,43,136,92,184,33,138,148,162,129,56,
+90,33,68,0,42,79,136,144,193,0,208,2,141,130,47,162,56,60,40,25,41,160,163,139,215,73,170,33,139,48,152,19,
+137,37,31,1,145,208,1,28,144,63,168,1,161,66,10,106,152,129,194,179,90,202,148,201,166,40,136,41,129,9,162,112,
+57,9,168,199,16,137,56,11,146,178,81,29,106,140,163,163,176,131,31,144,8,178,131,56,95,153,147,128,0,32,156,17,
+249,164,144,73,44,160,146,162,3,57,107,58,193,225,164,74,27,177,162,212,2,25,0,145,1,176,0,10,143,228,146,128,
+16,26,74,153,165,131,33,96,10,228,0,161,57,26,152,0,184,144,61,75,188,167,16,160,20,10,41,137,41,49,31,123,
+185,167,8,152,17,9,160,163,130,2,46,43,232,149,57,42,57,10,178,177,165,34,47,42,249,147,74,138,32,153,4,138,
+162,147,161,163,246,18,46,128,41,9,17,137,145,128,168,133,230,2,10,128,0,9,0,10,128,49,143,178,241,2,28,40,
+58,25,80,12,58,56,47,136,244,33,139,130,25,161,56,30,8,89,138,145,226,88,138,145,161,148,40,136,58,144,41,233,
+167,123,153,146,160,164,16,136,9,40,160,0,161,123,152,133,177,5,75,128,0,169,149,138,147,95,185,131,11,179,26,211,
+0,145,145,196,4,63,160,1,137,2,153,131,155,181,145,168,151,45,161,2,27,19,31,146,160,128,195,208,3,46,145,72,
+169,4,43,145,24,155,3,12,49,191,180,57,185,115,12,3,58,26,146,130,104,168,181,105,153,33,186,3,76,28,194,24,
+2,15,195,72,153,162,195,136,16,168,7,26,89,12,16,43,176,161,183,72,11,209,132,26,40,153,2,168,3,30,1,31,
+146,209,96,10,41,160,41,8,168,144,148,209,148,129,177,66,58,11,208,83,174,80,9,25,40,170,21,160,133,131,128,17,
+154,29,24,189,9,156,64,248,64,152,227,146,8,16,155,136,139,17,107,56,144,122,56,59,105,41,241,25,25,139,149,58,
+56,160,180,20,138,6,9,217,129,169,124,152,17,9,9,145,242,34,169,149,25,154,176,130,72,146,40,152,113,12,133,90,
+153,168,178,64,152,132,136,40,140,216,48,2,179,143,138,169,5,57,56,241,178,16,139,6,152,211,144,10,77,1,18,160,
+137,184,8,48,196,238,66,0,23,72,248,153,57,24,17,166,136,10,192,129,22,8,17,252,144,17,57,1,168,148,158,8,
+35,40,145,152,235,162,1,113,147,128,232,10,33,33,40,9,194,159,26,3,49,210,44,156,1,57,180,130,34,222,0,195,
+18,1,249,129,10,32,1,233,20,172,33,0,16,195,153,137,0,106,152,33,89,251,73,162,41,1,160,106,153,32,8,137,
+2,216,16,4,155,166,168,73,153,64,162,172,82,242,24,128,41,147,192,58,177,72,144,208,65,241,58,163,76,145,138,57,
+161,106,161,171,20,242,41,33,139,130,200,128,64,154,3,251,36,240,25,17,41,145,185,89,128,136,10,164,64,240,42,16,
+8,163,224,88,24,140,130,8,2,249,24,33,138,146,193,1,51,170,82,12,81,250,16,33,10,128,186,104,168,33,153,149,
+32,248,26,34,41,141,211,24,1,59,8,138,88,240,58,147,58,41,232,137,20,162,27,227,88,240,0,1,136,130,216,57,
+177,34,13,145,80,241,25,0,146,128,161,58,145,128,58,77,40,243,12,3,25,163,154,59,81,137,10,0,113,242,138,88,
+128,24,171,17,80,10,43,25,66,242,29,33,16,27,1,13,131,42,138,128,73,6,143,24,145,56,10,201,72,144,40,154,
+32,53,207,16,2,8,144,171,178,135,9,130,62,128,201,144,6,25,147,187,48,131,199,136,144,51,249,137,34,0,178,217,
+56,19,209,137,25,69,240,10,35,137,145,136,13,21,153,138,48,16,218,171,38,176,18,155,160,84,10,10,144,39,224,138,
+49,146,57,154,26,149,147,157,20,72,250,58,48,153,1,26,171,7,10,176,18,128,241,139,66,26,16,9,15,1,19,14,
+160,68,249,128,32,24,25,137,138,4,16,13,72,41,240,9,147,57,177,0,13,5,41,26,42,33,207,163,3,43,149,140,
+24,56,136,24,27,7,159,2,177,64,153,11,32,162,129,8,120,212,29,32,144,48,232,25,32,145,25,163,122,244,25,1,
+136,16,168,152,19,139,145,18,123,250,0,2,25,146,171,0,149,73,136,168,39,159,1,129,8,146,155,18,178,130,192,83,
+244,10,17,177,65,185,153,64,192,65,160,48,249,41,136,179,35,232,9,40,25,5,152,81,251,136,18,136,50,188,168,32,
+8,4,41,37,191,57,0,16,193,251,70,0,149,153,153,209,88,130,16,81,234,42,24,128,51,12,153,152,139,54,144,33,
+183,15,128,0,73,145,128,137,248,56,129,145,34,248,137,24,153,53,26,24,138,174,18,56,25,19,240,12,152,24,83,136,
+40,160,173,40,73,8,6,168,10,153,136,121,161,5,10,192,136,160,49,40,193,74,170,180,0,64,41,57,248,144,216,35,
+162,179,3,154,156,38,72,24,152,240,178,32,133,162,193,132,169,8,179,35,34,141,143,208,164,48,177,168,165,193,9,133,
+136,129,145,141,40,16,9,7,240,146,160,129,49,138,193,136,137,79,144,33,43,200,161,147,32,10,151,241,24,42,58,32,
+33,45,176,43,1,179,230,3,234,145,16,104,9,178,24,144,129,9,4,12,212,9,28,0,133,8,41,171,32,34,183,145,
+196,177,146,3,88,169,1,93,137,104,152,32,176,184,169,135,177,177,56,154,60,36,160,130,151,193,4,163,226,164,169,240,
+162,17,42,128,59,143,27,129,17,137,202,9,144,90,0,144,164,151,144,176,23,8,144,98,154,17,152,211,17,179,64,72,
+152,26,192,6,128,184,90,184,208,75,24,129,181,56,156,1,59,53,8,170,197,243,17,8,32,42,240,128,177,129,18,160,
+29,227,138,136,133,170,21,192,130,153,0,20,160,12,12,9,76,145,131,225,67,157,17,9,150,8,168,56,169,137,32,151,
+11,148,176,138,135,146,128,185,88,209,168,49,7,26,33,140,138,50,42,37,169,170,152,138,113,64,13,164,161,200,40,121,
+25,136,137,11,0,106,42,16,165,177,248,16,40,18,26,234,137,40,77,137,21,184,176,145,161,65,145,133,243,137,8,57,
+58,52,30,59,138,27,25,6,130,144,173,75,137,35,50,10,139,60,174,80,150,131,154,146,172,147,144,135,145,160,138,186,
+17,38,164,45,160,168,233,49,132,129,8,139,170,73,113,145,42,226,178,140,98,136,16,10,168,137,9,122,131,152,211,136,
+13,48,88,43,128,176,241,25,2,148,178,9,161,157,36,129,8,192,19,143,128,50,132,137,59,217,141,3,3,180,194,192,
+144,26,113,43,80,43,154,140,145,21,145,177,8,226,24,59,66,137,125,139,25,152,5,0,192,128,193,136,34,3,9,90,
+157,9,58,130,22,201,177,160,176,7,130,136,11,2,72,0,40,157,152,41,38,80,142,144,1,136,49,130,41,160,159,193,
+72,33,152,155,160,226,16,145,84,9,201,9,11,112,40,178,8,234,147,138,36,2,160,243,9,43,78,48,160,137,154,144,
+32,18,164,150,192,138,60,108,16,144,138,42,169,50,17,213,132,240,128,8,48,32,201,16,45,8,16,50,152,162,205,208,
+128,7,128,168,24,43,44,32,48,91,137,15,200,147,133,129,137,177,24,27,80,40,74,154,44,157,130,7,177,136,209,146,
+136,5,24,8,153,26,159,18,150,0,139,144,228,40,2,0,43,168,232,24,105,2,153,9,241,146,32,49,136,40,143,192,
+136,68,152,144,10,184,210,35,16,160,18,143,232,56,67,138,169,130,186,128,21,65,185,165,27,15,32,66,153,155,130,139,
+168,71,168,25,212,0,155,83,0,139,0,208,16,26,6,137,128,194,210,75,17,145,138,49,156,74,105,145,24,73,171,217,
+49,67,232,42,0,154,57,97,169,16,50,191,128,129,67,201,130,9,186,122,1,153,131,133,159,0,2,145,145,179,10,15,
+18,74,1,61,226,9,8,16,129,144,178,202,124,144,73,57,25,219,17,13,131,130,146,160,209,25,162,53,121,40,156,168,
+10,147,38,170,164,184,160,176,7,56,16,138,159,24,42,20,24,225,0,154,128,3,36,193,132,175,8,32,32,18,138,187,
+9,157,114,145,146,149,187,201,5,9,51,136,202,129,173,66,49,168,37,251,9,24,59,4,49,172,0,140,24,53,11,22,
+154,156,41,216,66,48,11,10,169,234,36,26,20,8,205,129,41,42,120,144,25,176,153,161,97,178,6,170,128,9,208,65,
+72,27,41,153,141,49,26,166,17,217,16,171,88,0,161,106,8,171,32,1,145,37,173,147,27,195,131,130,52,48,143,24,
+42,25,19,252,178,152,56,196,139,7,9,10,48,154,122,145,136,210,137,130,164,24,89,177,45,164,44,26,134,137,146,169,
+9,164,139,69,200,74,145,168,73,131,27,162,13,136,195,177,115,176,26,132,139,73,147,130,44,90,159,148,128,35,138,128,
+25,169,8,21,0,143,161,137,211,64,128,161,128,178,13,50,123,144,152,137,27,24,60,35,240,133,224,136,33,64,168,40,
+219,32,169,123,56,201,132,144,170,66,145,40,128,235,24,26,173,233,67,0,62,88,176,33,160,185,162,71,153,49,156,27,
+128,33,105,128,137,26,234,48,17,243,89,11,154,41,145,48,151,8,25,11,186,71,176,88,138,26,61,153,18,2,152,155,
+165,9,39,169,145,153,168,63,168,120,24,9,145,171,20,16,152,133,216,168,148,29,19,74,137,17,157,64,0,41,17,250,
+138,147,139,7,178,41,131,159,17,32,11,65,219,8,145,154,36,197,32,161,137,76,34,28,32,154,13,9,145,5,133,9,
+136,13,56,8,161,129,178,191,154,40,147,151,50,30,10,73,58,145,75,208,153,216,4,24,2,121,169,27,3,90,32,61,
+155,193,144,180,147,130,112,171,145,129,34,74,61,156,192,32,153,5,129,18,186,240,64,129,50,44,176,189,80,168,51,33,
+170,192,168,72,72,181,25,241,154,40,9,1,68,155,0,29,130,80,162,144,192,204,73,193,81,0,9,153,43,0,50,20,
+248,144,171,32,184,115,48,169,24,142,16,17,65,248,144,138,128,144,113,32,12,1,142,130,32,132,137,177,31,161,129,66,
+17,14,16,140,128,33,131,193,169,204,41,128,121,131,10,144,168,59,66,5,160,128,239,16,25,48,146,9,144,176,108,72,
+1,184,144,219,25,72,42,135,152,8,216,48,75,18,153,27,173,10,33,57,7,24,154,194,25,22,18,144,31,154,42,18,
+26,151,1,43,154,27,180,39,168,45,202,56,153,163,5,16,10,144,42,144,71,9,141,137,153,146,180,68,168,40,169,9,
+144,103,27,11,128,186,178,67,64,152,176,35,248,57,81,154,156,132,140,24,73,105,9,152,147,200,18,83,185,136,150,155,
+32,105,45,1,8,128,201,56,1,152,216,130,218,91,0,43,149,16,26,209,56,24,162,185,33,191,40,41,177,23,130,58,
+170,125,153,18,8,26,216,28,129,209,19,0,57,29,152,153,20,64,142,161,11,163,17,124,0,145,48,240,0,56,129,168,
+4,142,1,43,60,148,9,16,240,41,25,178,145,160,232,16,8,77,4,137,64,169,59,139,135,136,58,241,8,176,163,51,
+29,33,41,15,161,51,59,158,163,137,152,181,32,0,1,187,177,120,88,160,216,34,31,153,130,128,66,145,138,131,109,8,
+147,168,96,156,24,129,168,35,209,42,152,60,1,134,45,169,176,169,37,155,75,222,68,0,68,137,8,194,25,73,120,58,
+217,162,152,146,42,113,153,146,24,10,121,26,33,186,11,155,200,104,160,166,1,26,24,40,9,55,12,26,47,170,18,194,
+3,56,42,16,169,132,39,26,31,137,155,132,152,32,24,139,4,224,19,88,59,157,130,13,40,27,75,150,10,130,161,56,
+80,186,209,18,143,16,137,89,161,0,128,149,61,32,168,177,146,158,1,11,43,135,177,49,161,60,32,130,159,131,31,144,
+128,136,35,161,88,179,163,51,167,154,0,11,159,147,154,50,25,61,48,249,130,181,129,43,160,157,165,8,0,65,44,32,
+184,19,130,224,75,216,168,1,195,56,147,90,129,58,24,35,248,62,201,160,40,184,96,24,25,165,178,82,8,139,26,240,
+168,51,203,115,25,9,147,145,120,8,168,90,201,137,2,186,65,48,141,51,186,3,52,204,105,170,169,67,202,48,2,12,
+50,138,137,39,249,32,169,138,50,250,33,24,177,98,136,26,18,171,26,170,205,4,184,96,8,225,3,136,41,17,59,47,
+168,137,2,44,72,40,192,7,8,136,19,139,8,219,128,10,59,78,8,139,5,10,32,35,28,224,161,43,25,171,96,144,
+18,106,161,58,21,153,240,17,155,16,27,250,134,8,42,1,26,32,167,169,33,172,25,88,187,51,58,12,37,201,40,167,
+0,40,184,9,64,15,25,17,186,37,184,1,51,201,161,147,158,8,129,15,18,140,89,161,1,32,17,201,48,218,233,19,
+13,41,136,9,64,128,41,123,49,41,32,242,122,44,156,161,73,25,146,136,40,133,131,200,18,159,184,135,56,137,144,0,
+10,74,131,192,162,89,203,182,129,8,136,25,58,2,1,50,33,169,248,33,191,32,140,56,148,178,152,192,33,198,151,136,
+24,144,8,28,40,47,136,0,128,51,63,144,0,162,8,175,129,178,243,17,144,57,145,90,1,179,49,143,8,128,9,177,
+40,47,227,152,132,42,106,0,154,32,152,11,124,136,24,145,193,64,179,56,19,173,136,192,44,88,186,10,5,28,0,196,
+56,178,146,12,151,138,41,147,12,5,137,0,76,192,34,153,152,57,240,24,128,144,42,115,153,72,227,136,18,225,24,176,
+146,193,21,140,18,154,152,7,11,17,40,188,19,243,41,1,11,16,163,9,37,29,24,128,89,42,73,0,216,130,194,26,
+136,148,0,136,24,15,66,14,131,136,185,35,143,178,50,10,160,132,11,2,63,0,48,174,163,32,174,51,168,145,149,0,
+59,200,4,213,8,25,43,185,66,192,195,49,76,136,128,162,5,30,9,129,14,130,8,128,81,43,243,146,17,8,139,9,
+177,28,136,64,60,58,242,165,162,48,10,8,31,193,32,153,105,43,194,147,136,48,11,6,193,9,201,34,47,9,24,178,
+19,61,25,185,51,214,194,0,40,59,158,18,24,168,105,9,40,138,135,160,140,49,10,186,134,88,168,57,24,182,0,146,
+180,140,144,146,248,33,41,74,139,72,162,128,75,180,12,177,129,210,56,74,16,176,10,114,59,58,200,17,252,131,75,9,
+24,128,146,25,46,41,82,12,129,170,210,24,24,193,3,128,212,48,77,16,139,146,185,91,41,153,182,16,165,80,12,17,
+176,49,176,11,191,49,170,145,7,24,129,139,5,160,106,129,13,25,11,179,176,34,97,200,16,10,2,57,135,46,154,1,
+185,65,139,37,160,138,133,200,68,27,128,15,145,26,144,56,128,2,203,7,138,50,74,169,58,172,34,15,1,48,197,48,
+200,48,153,65,201,10,11,128,79,153,35,184,148,168,34,76,146,195,209,90,138,42,8,16,104,176,74,43,152,167,165,136,
+9,26,153,0,195,19,149,47,41,209,19,144,9,138,208,40,9,17,81,27,12,137,131,22,32,249,0,186,2,56,122,90,
+160,74,168,0,131,25,154,248,192,148,56,139,113,138,24,137,131,120,41,187,198,144,145,130,8,147,107,169,128,120,58,136,
+178,152,153,137,182,41,131,168,194,104,107,144,147,145,169,142,161,129,105,168,51,187,128,112,41,1,49,175,136,16,169,134,
+144,132,136,10,2,192,5,40,31,140,129,137,1,73,17,188,132,129,2,120,0,187,152,24,13,146,122,163,139,24,198,0,
+48,16,141,168,2,141,1,122,136,192,3,161,8,112,128,155,161,162,41,92,90,224,129,0,128,136,66,177,171,130,163,95,
+42,128,152,1,56,203,1,36,240,192,18,138,41,24,164,26,56,43,29,121,136,182,136,128,75,152,24,194,25,41,48,47,
+0,146,132,154,25,13,208,49,184,2,79,8,26,129,35,107,171,185,50,170,165,163,26,123,9,161,67,72,156,38,70,0,
+41,138,11,216,195,163,20,13,8,176,178,18,134,120,139,137,212,160,147,58,152,137,134,162,34,121,25,144,202,197,9,146,
+26,152,130,243,33,45,40,1,196,1,185,8,200,89,171,7,153,18,42,8,34,184,1,244,72,138,184,1,242,33,29,1,
+26,163,148,20,61,11,138,194,130,144,76,11,145,152,181,99,8,24,26,176,72,203,106,154,161,227,146,40,33,64,201,149,
+153,0,40,58,15,226,24,160,1,65,152,96,145,138,176,122,139,0,10,8,41,210,97,144,3,148,152,140,57,13,129,104,
+154,72,155,131,226,134,0,185,40,200,128,17,145,125,136,43,146,9,35,194,30,144,160,146,18,24,122,201,0,16,48,104,
+203,144,144,193,18,24,75,166,185,36,154,112,161,46,160,160,2,0,8,99,170,137,18,10,55,171,26,241,128,8,163,24,
+151,137,137,148,89,57,143,145,178,32,8,144,36,218,163,128,89,48,250,1,160,41,129,152,114,177,208,147,136,64,136,15,
+1,155,32,16,44,147,244,0,128,106,129,217,2,152,42,40,44,1,194,8,1,171,55,224,8,0,185,65,27,40,5,156,
+18,137,76,132,235,148,152,41,0,26,36,217,32,27,57,49,248,16,153,154,7,136,3,162,59,73,12,80,152,156,129,248,
+17,160,16,2,248,17,9,92,129,170,131,137,61,195,0,131,243,16,25,27,36,248,40,137,43,3,154,162,151,138,17,169,
+82,164,14,16,155,121,152,128,2,184,18,153,57,7,185,144,1,47,129,168,20,178,26,41,9,39,194,193,74,170,106,144,
+8,17,139,44,144,65,198,8,152,8,90,144,161,18,10,10,60,28,39,218,130,9,136,163,129,130,20,44,47,136,48,243,
+136,24,153,148,160,146,166,58,27,11,120,163,142,0,136,16,164,224,19,153,24,56,16,52,142,25,60,129,193,150,137,130,
+139,136,2,179,201,176,61,47,163,130,144,49,202,48,11,39,242,144,75,170,64,128,2,8,154,33,46,131,183,59,139,11,
+137,21,25,151,152,74,58,216,133,136,137,136,176,41,167,48,41,45,43,197,2,160,57,154,160,17,179,135,48,45,154,34,
+129,145,155,12,204,163,130,199,16,76,136,0,148,9,152,10,168,177,245,148,8,0,107,176,2,16,144,123,59,187,167,128,
+140,244,76,0,178,1,169,4,184,36,42,59,63,170,130,136,3,175,148,154,166,145,18,89,11,33,10,147,33,61,153,32,
+208,231,17,137,129,9,146,137,8,105,139,72,139,160,194,40,5,217,3,192,130,33,75,31,145,41,137,146,123,160,179,129,
+162,186,120,138,128,16,200,122,26,0,162,164,148,144,26,16,25,251,17,156,122,137,41,176,151,24,161,48,26,243,130,130,
+58,40,15,195,130,160,34,29,152,184,181,56,42,47,128,43,1,163,63,129,10,177,194,179,112,29,8,136,129,145,80,61,
+0,160,210,131,27,18,31,136,145,137,64,28,90,201,147,144,179,48,155,243,161,148,75,73,60,9,146,145,151,128,89,168,
+0,182,161,88,44,26,10,194,2,10,144,106,192,194,130,9,48,75,155,151,25,32,60,137,146,216,132,152,8,0,234,131,
+162,80,42,62,169,150,153,131,42,11,148,152,196,132,61,8,9,0,210,16,25,59,169,162,242,2,59,106,176,151,41,145,
+58,17,42,11,183,24,161,75,9,209,177,8,243,48,13,162,129,180,24,74,154,2,162,208,67,31,25,184,180,20,153,106,
+137,129,195,162,24,89,27,168,226,148,73,155,17,9,232,150,128,40,25,11,177,161,35,26,47,32,202,149,147,3,61,128,
+160,132,162,17,31,45,162,185,2,33,47,144,145,9,244,0,40,154,18,160,168,112,136,73,59,244,1,168,48,139,209,16,
+162,104,9,107,10,177,162,161,32,136,0,246,131,9,144,107,9,0,161,41,107,12,161,40,234,150,41,136,16,129,179,145,
+72,57,90,14,162,152,129,58,30,18,170,166,130,72,24,172,145,0,202,33,28,154,148,60,184,166,124,160,32,0,128,106,
+152,26,130,172,147,24,61,1,250,17,9,11,66,74,33,242,0,24,43,13,195,168,18,10,9,114,169,150,144,24,32,138,
+132,146,17,170,88,191,130,168,216,113,136,2,25,144,2,232,41,43,91,160,162,170,33,44,33,78,178,149,41,136,156,41,
+180,144,57,158,113,169,32,18,162,82,157,171,2,179,1,41,76,34,251,3,82,9,28,157,193,132,144,40,73,24,184,26,
+68,16,143,139,129,211,133,41,24,89,170,128,33,132,143,43,136,164,1,17,8,219,146,128,5,3,156,30,42,16,146,67,
+27,186,8,20,12,33,69,0,22,242,42,14,152,146,132,0,160,209,25,40,16,18,218,152,217,145,81,17,26,42,47,26,
+18,132,1,157,154,145,19,23,161,193,152,128,24,52,4,185,186,31,43,18,147,48,142,208,129,8,32,34,187,10,201,76,
+112,146,89,140,168,8,19,132,193,161,204,2,91,48,0,144,11,188,0,7,35,28,168,228,145,89,26,129,0,12,11,128,
+130,39,12,192,192,144,112,8,8,152,176,57,9,32,134,0,185,225,153,68,57,138,128,170,41,76,161,135,1,185,226,24,
+48,80,10,176,10,29,26,35,197,18,184,170,24,96,72,56,203,17,47,136,3,161,82,168,218,16,25,122,129,184,0,44,
+186,7,136,2,184,234,56,58,57,130,169,63,168,184,151,64,137,179,138,152,137,5,149,145,137,216,162,57,113,136,161,25,
+241,161,132,132,138,160,9,41,60,122,145,168,2,240,136,65,128,8,137,9,41,47,17,133,168,33,156,30,64,128,0,153,
+137,145,201,134,162,153,19,186,216,8,134,164,8,27,152,11,22,0,154,23,154,168,154,115,34,12,27,170,144,147,34,112,
+128,26,244,168,1,34,184,177,209,129,163,30,97,144,9,163,185,62,120,24,137,153,1,128,226,36,145,170,72,161,143,128,
+5,161,137,24,184,185,20,147,150,10,148,156,29,81,8,152,25,8,153,197,131,147,42,58,211,175,18,147,1,160,187,18,
+211,80,18,201,1,193,251,24,96,41,136,170,40,136,60,5,128,10,164,139,62,75,20,144,153,161,196,161,33,36,154,146,
+154,175,128,23,129,157,129,152,40,26,36,152,26,61,249,8,82,0,140,24,43,8,136,7,16,170,2,251,26,120,130,26,
+11,41,192,130,50,178,187,151,171,43,120,164,128,12,161,145,162,99,144,152,164,11,47,104,0,144,153,176,181,16,50,136,
+168,166,139,47,89,8,176,176,162,162,40,5,145,10,183,11,60,121,24,160,153,145,193,17,19,210,131,242,152,61,72,40,
+169,136,40,27,40,150,209,2,217,209,17,33,40,218,40,75,28,16,148,25,41,171,240,131,4,146,169,8,41,13,114,0,
+10,16,46,30,0,130,177,138,177,194,24,20,193,162,145,186,107,48,67,140,45,10,176,3,135,8,58,218,225,130,3,130,
+200,41,42,138,66,17,31,24,117,21,74,0,140,140,34,149,128,185,177,180,131,97,0,154,179,186,63,97,24,137,10,176,
+162,19,52,153,40,241,249,130,66,26,11,169,161,28,88,147,154,65,233,200,50,18,136,186,195,194,42,114,8,153,18,156,
+15,64,2,169,129,152,224,32,65,193,136,163,139,143,80,17,153,144,160,141,57,20,144,144,132,140,14,65,48,168,161,144,
+200,40,6,146,0,18,159,12,17,133,137,168,144,216,9,20,147,130,72,159,153,18,17,136,145,16,173,201,5,19,90,41,
+225,168,44,32,56,25,57,218,209,41,56,32,35,197,141,141,17,89,8,145,178,9,15,16,1,2,147,218,201,72,56,130,
+17,88,139,157,0,34,146,1,144,191,218,18,18,57,161,5,143,153,17,147,50,90,200,140,28,2,18,25,58,228,184,25,
+8,151,34,8,224,200,32,57,144,3,72,203,224,0,73,24,133,129,140,218,34,57,25,147,3,143,170,130,96,32,17,193,
+157,170,131,19,32,133,177,158,138,32,81,64,24,209,171,155,148,5,32,129,225,185,25,0,21,49,41,240,171,27,131,7,
+73,136,168,139,60,33,18,73,24,240,154,30,131,18,40,0,208,139,76,0,18,18,57,201,173,188,114,145,48,137,176,29,
+10,8,135,129,2,194,157,25,128,132,56,136,153,226,172,32,135,16,129,146,141,154,129,114,27,33,152,235,16,161,66,0,
+34,241,144,218,32,51,138,151,162,156,129,24,88,144,0,147,204,173,18,56,25,146,154,15,153,168,37,166,128,131,187,171,
+22,2,49,58,78,140,176,20,40,56,10,146,249,184,17,112,144,128,128,171,9,21,41,144,210,16,241,170,121,16,9,8,
+144,201,104,129,138,133,146,41,162,139,107,162,164,57,156,152,152,33,144,16,169,95,128,172,0,195,81,10,210,0,75,25,
+146,88,140,194,5,154,139,36,25,27,129,185,63,49,241,25,129,8,66,249,152,50,137,161,34,157,41,148,16,57,225,1,
+37,240,9,65,154,32,16,203,8,3,137,8,32,174,135,146,15,41,162,0,0,216,8,121,137,161,129,144,34,18,207,129,
+132,25,16,139,29,32,226,131,128,201,65,32,221,130,33,29,40,176,138,2,148,32,41,140,0,21,240,25,72,137,3,185,
+155,3,112,42,176,171,131,52,210,14,0,178,131,235,73,0,3,0,143,64,9,168,132,153,136,83,146,191,165,1,42,18,
+170,136,8,165,18,170,16,161,39,251,25,91,41,147,185,168,177,114,25,193,0,147,35,240,61,41,162,133,168,155,3,59,
+147,179,155,184,55,202,47,162,146,32,192,185,96,8,162,3,187,2,195,114,158,129,1,89,168,9,16,186,38,160,200,1,
+34,2,223,17,24,42,131,156,28,165,136,16,179,129,34,66,239,48,40,44,17,11,152,194,58,35,225,0,128,145,249,41,
+57,75,19,143,144,177,74,21,216,16,136,2,202,32,41,136,22,156,144,129,42,2,243,18,169,97,218,24,24,1,24,31,
+128,192,40,1,129,0,1,135,220,2,9,104,16,137,184,128,42,57,36,193,40,226,158,146,26,115,161,9,161,186,72,129,
+19,194,112,154,14,146,137,99,144,26,184,153,3,162,36,145,8,145,191,164,43,64,145,73,225,25,136,185,82,130,185,23,
+138,74,170,25,21,136,66,137,136,140,208,145,35,17,192,66,159,169,48,129,58,33,139,132,139,12,150,26,131,179,176,78,
+25,28,17,177,63,161,186,65,150,193,17,9,45,58,144,40,40,42,216,202,178,151,136,18,1,158,81,153,40,66,137,153,
+145,43,197,165,0,24,43,216,8,33,109,152,136,179,200,56,164,137,32,179,216,92,137,17,17,138,17,188,50,144,164,241,
+5,171,34,12,139,54,156,128,147,10,60,210,145,134,152,8,128,73,160,16,128,123,200,8,134,137,65,178,154,3,145,217,
+65,137,89,153,11,153,161,36,61,178,248,147,140,51,41,30,19,233,8,1,8,153,3,172,151,43,8,130,0,129,41,169,
+95,201,48,180,136,56,212,13,130,146,144,74,137,50,156,130,3,131,97,145,196,169,133,140,67,155,42,149,157,57,128,145,
+217,150,24,176,16,128,56,41,16,24,31,47,168,49,196,160,33,202,26,151,0,128,24,27,152,138,135,136,146,148,171,211,
+152,150,75,129,26,73,9,140,67,1,25,242,148,144,0,106,136,0,152,40,186,185,4,153,26,178,243,56,153,98,136,240,
+18,26,227,161,2,64,187,48,154,168,74,168,22,12,33,74,217,196,88,200,49,11,17,202,17,170,18,203,20,138,165,41,
+41,129,122,177,21,25,57,20,155,48,248,42,248,16,28,146,9,253,69,0,8,24,163,25,128,88,13,19,27,31,197,41,
+186,34,27,162,7,42,176,33,201,132,16,148,162,31,142,2,10,146,18,25,224,32,156,147,8,147,22,24,250,17,15,178,
+48,8,165,18,169,136,28,8,36,8,58,67,249,137,15,128,40,1,164,24,201,136,43,72,16,2,19,167,249,41,187,4,
+16,0,21,171,177,160,29,147,37,9,211,150,201,32,156,149,132,24,0,157,170,130,121,128,32,10,18,17,175,0,139,18,
+6,48,10,29,137,176,64,160,56,15,32,152,31,161,148,1,8,10,8,57,124,154,130,144,0,137,52,174,18,28,20,171,
+144,161,90,11,131,75,50,137,63,227,1,218,2,26,33,32,171,1,241,93,160,17,137,147,75,129,18,191,17,145,113,8,
+152,8,192,41,1,177,128,13,139,7,11,170,3,130,100,8,185,91,169,64,160,18,185,134,153,67,152,191,146,128,112,152,
+8,27,179,40,96,184,136,148,8,81,129,159,136,2,57,35,141,41,8,160,183,41,200,113,153,1,152,242,57,56,43,178,
+162,141,163,40,48,224,128,8,128,108,145,194,29,130,129,50,218,152,0,182,66,12,153,16,152,81,137,227,12,16,193,4,
+144,168,50,44,2,25,138,48,1,60,167,179,207,130,32,41,56,157,137,128,104,144,163,8,128,35,139,54,253,8,17,72,
+43,154,153,0,134,161,130,44,13,130,163,33,226,31,41,129,41,177,177,24,56,135,138,129,10,113,8,17,209,142,24,40,
+160,148,152,153,104,129,138,144,177,17,112,24,75,205,195,4,8,17,27,171,194,37,27,88,11,8,146,0,162,191,8,72,
+165,146,144,157,17,89,10,130,152,129,120,129,18,248,137,32,41,40,202,184,0,122,160,2,185,0,67,57,211,250,177,2,
+3,122,24,142,128,130,24,48,11,203,50,151,128,218,128,40,33,72,153,218,168,96,176,131,209,0,122,40,8,170,129,48,
+120,136,128,187,196,24,128,131,43,155,162,55,137,236,9,17,18,65,154,139,155,24,135,80,136,138,24,66,162,223,145,16,
+48,1,1,221,128,41,129,49,0,202,128,122,179,234,8,18,73,66,16,233,161,25,56,42,130,12,184,162,23,159,42,40,
+168,6,128,193,58,11,40,128,6,144,40,45,180,192,156,50,128,2,66,176,161,19,65,0,12,141,91,155,20,0,197,16,
+25,58,173,178,163,34,123,40,73,176,2,9,27,76,11,210,165,144,147,25,157,129,1,90,74,26,138,196,0,25,49,46,
+0,168,194,132,1,47,161,10,179,182,40,10,73,139,176,193,121,25,25,8,209,0,0,146,19,163,199,4,136,91,41,171,
+4,44,24,46,153,168,135,152,1,25,9,210,49,40,91,138,63,176,8,145,130,24,209,146,208,1,0,108,41,136,56,192,
+40,12,57,169,167,242,130,10,144,24,136,17,57,56,124,0,128,151,128,144,160,160,178,1,94,59,9,31,178,161,179,179,
+1,243,145,129,130,40,95,9,25,144,146,16,24,162,186,215,243,1,137,17,61,136,8,40,137,59,168,240,148,0,147,121,
+168,149,9,129,122,9,25,161,152,161,160,25,168,183,178,134,169,104,139,2,42,0,56,62,152,161,164,243,64,10,24,136,
+168,60,137,16,137,151,194,163,8,184,122,192,2,8,42,73,29,44,211,18,146,48,144,243,147,168,17,9,111,9,137,128,
+153,8,152,17,161,182,181,90,26,25,74,128,40,9,25,138,204,215,131,0,128,74,169,0,123,58,26,24,155,183,146,209,
+32,170,163,2,58,77,41,91,128,32,152,164,1,212,146,169,144,177,123,128,58,60,209,152,4,11,131,226,211,34,9,12,
+56,140,2,33,9,58,236,194,134,136,152,2,154,82,29,169,33,43,43,181,162,139,135,41,132,61,168,2,16,124,9,168,
+130,152,1,179,184,184,230,161,113,8,8,44,177,136,145,11,136,66,242,132,176,0,56,137,145,128,22,92,152,91,242,144,
+176,130,58,16,41,130,88,185,58,44,74,46,166,130,160,165,139,146,153,3,130,226,83,153,131,145,161,4,159,179,131,160,
+92,155,74,157,128,152,121,42,160,17,176,0,162,27,81,50,142,128,129,77,144,60,9,165,164,133,25,24,25,42,29,24,
+3,74,24,90,203,168,44,194,176,112,24,26,18,13,18,139,148,75,137,99,240,160,16,179,63,136,0,162,161,129,24,73,
+26,154,210,36,137,240,105,184,128,28,179,8,16,145,50,144,44,248,0,40,149,201,52,138,248,17,209,1,137,8,0,146,
+164,161,24,123,8,176,112,168,8,163,24,144,12,152,36,178,133,195,168,52,31,144,75,163,208,24,73,0,58,128,121,139,
+137,185,166,56,48,11,2,178,135,193,58,209,24,58,131,28,225,8,138,24,47,8,136,131,0,181,60,16,154,122,130,177,
+177,145,31,42,27,216,148,161,97,136,28,2,11,177,83,41,74,138,65,187,80,218,162,32,24,18,15,3,137,152,131,195,
+107,192,32,139,182,160,226,48,60,129,186,21,168,32,62,129,25,176,180,19,156,210,137,128,76,0,13,33,161,130,17,32,
+124,186,146,181,1,177,178,63,8,0,219,34,160,72,154,6,129,136,161,17,197,162,244,32,44,136,154,178,150,24,25,65,
+10,129,9,195,121,9,145,177,106,153,176,155,167,8,193,34,26,32,136,41,162,47,162,0,59,90,241,152,162,179,57,88,
+129,1,188,52,31,161,128,164,0,34,28,248,57,248,130,75,136,32,136,163,20,171,5,153,145,162,4,30,153,17,204,33,
+25,9,0,43,167,2,211,17,137,32,164,168,31,163,31,184,18,11,2,161,7,137,10,165,24,42,57,146,250,82,201,128,
+129,26,11,227,132,57,8,0,131,30,148,144,9,73,225,161,8,129,139,5,58,152,180,88,1,77,160,165,168,41,132,43,
+42,227,152,176,89,43,177,41,135,128,33,144,185,140,148,136,122,8,27,211,136,144,192,44,2,187,135,33,136,42,97,11,
+147,145,72,137,89,201,213,177,33,26,44,168,180,25,73,59,11,150,130,148,17,75,144,210,147,144,18,46,161,141,25,160,
+51,29,144,209,179,164,32,178,48,49,15,146,131,11,47,128,235,129,128,162,152,45,144,212,148,8,74,12,148,146,41,162,
+89,9,129,179,210,72,47,169,145,128,184,33,136,32,32,149,242,121,42,0,129,136,17,138,134,0,10,217,1,137,28,0,
+91,185,17,136,169,122,152,151,195,130,25,47,0,136,161,32,0,78,26,194,179,177,56,141,152,128,161,27,124,136,60,162,
+180,3,40,9,224,1,242,2,144,72,42,14,163,145,136,56,26,187,34,151,1,97,78,136,129,161,48,58,155,226,210,1,
+177,123,27,152,178,147,49,47,137,144,131,242,130,41,75,154,163,245,16,25,9,1,136,177,136,35,29,105,156,148,1,25,
+0,29,8,139,196,145,104,43,152,178,179,161,122,154,2,144,135,32,61,58,185,131,195,50,74,9,50,243,25,18,62,0,
+194,40,12,75,9,147,0,44,29,10,164,245,1,136,0,24,10,178,178,107,27,75,140,181,145,1,32,31,1,185,163,18,
+60,72,26,194,195,165,58,25,154,129,151,75,27,11,141,148,177,67,56,156,164,179,211,105,24,9,49,139,33,146,31,42,
+138,194,151,161,145,16,45,10,163,25,93,61,193,163,152,8,136,179,33,187,3,184,167,120,136,0,209,132,10,41,10,44,
+169,128,92,74,45,0,153,165,18,209,2,137,163,43,2,155,192,135,28,130,60,171,7,0,34,46,24,41,146,186,133,25,
+171,211,1,242,136,154,162,129,150,2,136,133,146,163,31,177,28,90,154,88,184,161,56,9,133,128,104,33,8,243,27,200,
+225,17,138,3,130,152,146,136,88,11,124,16,17,159,178,144,136,162,99,57,153,64,138,170,36,46,5,16,218,129,12,152,
+35,76,162,179,42,186,216,16,16,133,50,194,143,160,218,51,153,20,49,171,194,234,2,32,65,3,80,235,161,12,137,3,
+48,179,181,10,157,136,104,24,35,148,160,142,193,128,34,1,68,12,171,177,28,56,1,77,65,186,201,24,138,91,145,122,
+178,201,0,152,64,132,24,65,128,140,1,27,81,4,154,1,197,30,8,72,25,128,136,179,171,184,129,120,131,120,202,10,
+149,9,16,130,26,1,141,137,163,13,55,154,32,137,143,24,147,128,136,152,96,25,30,168,20,59,1,60,225,145,58,27,
+147,24,140,150,56,157,9,8,33,148,92,169,129,138,50,143,35,11,25,67,240,12,129,163,33,161,58,145,46,145,149,46,
+130,153,48,18,191,162,128,4,56,241,18,154,3,154,51,143,147,59,50,24,207,145,161,66,160,201,131,154,115,153,2,157,
+162,66,195,162,141,9,1,6,10,233,2,128,40,193,130,14,130,32,24,250,25,0,16,20,186,212,16,0,64,153,32,143,
+1,147,17,208,14,16,0,48,138,249,32,144,132,136,168,170,52,34,140,51,239,0,130,1,129,173,40,20,137,89,185,152,
+65,0,155,83,249,26,64,136,89,154,137,5,144,144,163,218,81,128,24,75,24,159,130,179,1,8,171,106,179,1,162,189,
+49,48,228,16,18,188,44,34,137,16,137,158,6,152,163,224,24,32,152,56,59,179,191,19,4,168,149,184,104,16,9,153,
+73,10,71,0,138,145,53,24,143,33,248,137,50,152,40,138,202,6,1,170,8,170,69,16,176,77,145,188,17,167,0,145,
+184,49,49,249,25,153,17,50,184,42,120,251,41,4,26,16,168,154,114,177,138,195,65,42,144,9,123,192,28,34,144,28,
+146,216,33,148,139,74,43,0,135,25,44,33,159,0,18,8,137,160,31,134,153,144,0,8,48,193,153,98,184,140,83,177,
+17,201,8,36,176,156,36,12,41,18,157,2,146,159,64,0,153,179,209,2,16,170,40,242,2,18,12,45,50,252,16,17,
+152,16,184,179,1,179,13,169,19,7,168,43,113,240,10,50,128,136,8,176,18,167,137,42,58,33,232,161,121,178,31,24,
+162,160,163,129,26,34,248,56,9,80,27,8,91,147,191,18,3,153,193,147,14,3,168,9,76,145,33,137,78,0,248,40,
+33,153,129,25,45,130,164,156,56,24,164,25,156,53,201,28,72,161,24,136,172,5,162,59,169,149,136,133,29,131,40,159,
+48,146,9,152,242,16,179,145,28,128,40,3,46,11,99,159,1,34,169,17,176,138,135,162,10,8,108,41,11,0,50,236,
+10,51,169,178,181,137,49,1,249,32,10,113,26,26,40,212,44,32,136,208,164,153,130,65,156,40,160,132,24,152,109,161,
+153,1,148,58,162,156,161,22,136,29,40,137,3,168,40,112,250,25,148,128,144,8,29,132,194,136,144,89,0,144,168,39,
+185,44,73,210,1,138,8,33,128,234,146,16,58,33,158,4,195,141,49,1,160,8,244,17,0,10,12,130,25,4,154,59,
+34,255,0,132,9,0,168,128,2,196,25,43,65,48,232,9,5,172,42,20,152,177,128,172,69,184,194,40,1,120,186,1,
+48,249,25,34,1,171,148,156,20,130,218,33,136,129,144,140,100,217,9,65,152,8,136,10,0,135,200,24,129,16,25,73,
+64,243,13,32,144,128,128,216,49,0,192,153,131,72,136,89,59,151,143,0,34,10,144,200,33,17,241,57,169,36,169,0,
+91,130,175,1,34,160,8,140,136,7,184,25,0,66,10,177,128,7,143,24,2,137,145,184,40,81,193,169,166,32,24,9,
+28,5,251,24,33,10,9,195,152,35,149,139,145,56,150,152,61,65,251,8,18,161,0,153,141,50,179,14,146,48,163,185,
+195,39,219,25,81,229,76,0,50,153,16,154,139,82,179,173,182,16,32,154,90,34,249,29,64,8,9,161,153,80,147,28,
+136,136,132,136,11,85,249,25,32,129,10,136,11,73,151,154,146,1,145,195,178,38,170,31,64,152,0,160,168,88,131,187,
+198,16,8,161,9,81,200,14,56,0,137,129,192,121,1,169,145,128,2,129,28,120,193,140,49,1,11,8,44,186,23,217,
+130,24,2,42,137,50,245,27,56,132,10,144,17,154,6,172,131,24,129,168,154,22,242,13,56,72,10,9,8,1,130,217,
+130,137,134,161,138,121,163,143,16,17,137,144,11,1,20,175,2,128,19,169,185,38,164,143,32,129,41,161,152,58,55,175,
+130,129,0,145,155,120,177,141,32,32,11,0,160,34,22,219,8,17,144,167,153,80,177,13,48,145,10,24,45,144,34,249,
+9,130,51,154,192,2,183,29,64,128,138,24,1,59,99,188,178,148,19,26,249,33,224,137,49,26,26,11,48,132,65,173,
+8,145,49,199,144,49,216,138,67,176,8,42,46,18,192,169,32,177,4,176,128,39,249,26,51,169,24,24,44,20,136,157,
+34,226,2,144,41,122,251,8,19,138,25,152,89,18,185,25,72,136,160,150,136,114,158,0,34,170,136,178,124,0,168,137,
+17,1,10,179,121,129,173,0,23,169,0,136,41,34,216,26,57,35,218,181,17,1,191,16,3,139,25,26,110,16,192,136,
+40,50,140,161,17,19,207,16,65,154,137,209,80,24,168,153,8,82,152,139,113,146,236,130,4,168,0,176,18,18,184,47,
+9,19,161,200,49,149,191,129,132,9,8,136,75,20,200,136,41,50,9,249,32,51,207,16,2,154,162,179,78,16,152,138,
+136,65,129,171,105,5,250,0,34,153,42,178,29,19,146,15,129,32,179,152,44,37,221,128,3,160,9,40,139,52,211,13,
+0,49,26,161,171,55,232,10,34,177,136,129,29,81,25,203,128,129,35,186,243,50,196,14,33,1,139,16,169,64,20,159,
+129,40,2,128,201,121,8,172,128,21,139,0,160,56,83,157,8,56,41,129,168,27,71,249,9,33,152,177,2,45,1,144,
+217,8,35,41,0,159,52,210,140,49,211,24,136,184,81,0,137,11,66,8,147,219,25,55,251,9,34,154,17,153,59,132,
+147,15,8,48,162,168,154,102,99,47,77,0,144,143,0,146,24,16,187,49,19,190,16,9,88,128,200,131,22,232,9,56,
+163,136,8,30,49,144,25,176,24,81,170,30,179,36,251,10,66,128,185,164,75,2,24,139,168,82,8,137,13,20,164,191,
+33,133,25,154,162,27,83,200,137,8,149,146,129,25,67,240,140,88,162,16,43,153,64,51,159,128,137,18,145,240,0,19,
+250,138,82,144,152,1,61,24,147,154,26,9,7,160,137,33,150,143,25,4,137,168,136,24,35,153,248,16,132,18,170,153,
+52,231,138,65,0,9,26,138,2,22,172,9,17,162,0,216,0,68,189,24,51,136,12,177,26,23,194,140,33,136,56,160,
+203,85,168,140,104,161,137,0,168,73,133,170,0,2,42,34,159,1,5,219,56,50,139,57,241,41,33,169,13,162,0,2,
+200,43,69,240,138,66,8,24,10,169,82,136,139,9,48,161,166,137,105,130,175,0,132,10,0,12,33,0,195,128,11,66,
+130,233,0,52,250,26,66,152,128,136,12,80,128,192,169,19,33,202,42,21,210,143,80,0,137,8,185,33,51,235,152,130,
+35,145,203,120,17,175,0,18,137,137,211,136,37,193,169,49,136,19,240,24,98,232,136,34,136,137,145,30,32,130,234,24,
+0,1,161,169,84,226,10,88,128,9,8,140,49,3,157,152,3,0,136,187,99,149,159,40,4,11,24,155,19,37,187,27,
+3,17,164,250,32,147,175,16,4,153,136,176,105,34,232,144,16,64,242,165,16,128,159,0,2,128,152,144,2,20,161,142,
+137,130,97,153,131,163,186,170,23,41,172,243,32,24,161,169,51,209,144,147,77,24,241,33,10,145,184,165,59,162,151,168,
+48,24,232,56,28,148,154,25,36,176,8,152,16,32,231,40,9,128,179,152,72,66,158,144,3,24,248,32,8,1,208,42,
+73,161,149,29,145,133,217,40,17,27,185,0,76,17,26,44,57,48,193,30,130,2,191,72,1,0,154,48,60,41,242,61,
+129,129,136,74,58,163,240,25,83,139,176,8,165,17,227,43,145,145,146,24,160,113,203,139,7,129,139,56,11,20,243,8,
+32,73,155,161,208,21,186,25,67,224,161,146,56,57,3,175,131,33,160,44,178,165,229,152,34,136,153,160,181,18,144,30,
+8,17,178,0,25,49,249,234,35,163,140,32,13,253,74,0,8,152,135,170,56,56,8,251,131,16,244,10,34,162,226,17,
+136,56,16,189,32,0,131,140,136,33,231,152,32,147,192,152,17,0,49,15,46,129,130,25,145,122,177,170,57,151,137,59,
+10,1,65,14,26,105,0,168,16,17,144,15,17,196,32,171,56,42,72,187,24,44,6,138,145,58,181,15,33,129,160,136,
+13,36,144,139,27,73,120,9,136,8,57,143,44,150,25,136,25,136,68,169,8,9,66,43,9,11,51,255,0,2,8,154,
+193,17,20,41,143,0,130,144,146,44,88,240,152,20,136,152,42,192,3,144,75,28,73,9,3,185,81,162,175,4,164,152,
+17,138,74,16,225,176,64,57,28,193,9,133,13,41,34,170,164,178,26,98,11,216,131,144,132,76,11,49,240,153,51,25,
+155,131,250,18,18,60,43,136,72,50,15,41,26,248,145,149,25,152,145,128,34,216,120,11,9,2,145,14,19,209,12,32,
+180,146,137,25,1,51,31,10,12,121,26,144,40,18,235,24,4,152,161,244,56,24,25,152,144,129,2,45,10,128,199,154,
+147,133,136,195,168,149,80,28,136,25,8,32,153,89,10,232,25,19,57,208,161,91,148,136,137,32,201,100,10,24,26,178,
+158,88,162,128,169,130,145,21,29,227,136,0,80,28,8,16,218,129,34,168,24,242,2,160,131,46,152,43,163,80,185,121,
+161,12,33,164,128,8,168,3,240,33,140,57,76,128,25,161,5,175,32,147,168,147,209,34,56,172,17,234,65,42,128,9,
+131,252,128,35,139,145,181,8,67,155,129,160,192,39,153,76,24,240,136,35,9,138,152,25,166,163,75,60,43,17,136,28,
+113,248,26,2,210,1,8,9,17,177,168,196,32,41,33,216,51,243,30,16,129,136,194,168,81,136,137,153,177,105,49,47,
+41,8,15,32,145,136,136,209,1,147,152,10,0,40,3,210,63,147,175,163,134,128,129,184,65,128,194,152,0,40,60,144,
+12,3,251,28,83,26,160,179,139,23,138,24,137,136,2,195,58,83,250,28,32,163,10,162,158,4,33,170,3,153,19,151,
+128,18,45,175,129,3,160,163,154,90,0,224,16,0,45,35,11,9,49,249,63,57,160,147,200,161,161,149,137,227,128,50,
+123,26,24,144,142,18,163,73,192,226,145,131,136,0,140,41,157,239,73,0,147,34,15,32,251,17,32,160,18,138,14,179,
+134,10,144,138,18,130,232,49,90,143,129,130,130,8,248,73,129,161,177,129,45,51,140,9,32,249,41,90,136,146,169,9,
+20,178,137,214,8,33,129,141,50,9,159,1,2,42,210,200,65,8,145,59,153,88,163,73,45,1,242,10,18,160,1,156,
+201,135,145,40,137,57,24,192,0,145,68,191,130,2,177,49,140,60,136,144,32,248,18,59,56,10,19,105,143,130,164,129,
+197,178,72,10,24,146,59,143,146,24,91,42,178,47,42,185,19,138,250,130,0,33,169,14,32,25,17,11,112,242,128,34,
+144,4,168,26,34,132,74,249,24,17,41,170,49,40,223,145,4,136,162,217,75,1,24,25,170,44,6,136,0,2,145,207,
+1,165,16,145,232,48,8,25,24,156,122,129,43,162,2,155,15,136,1,128,209,209,81,168,24,130,138,161,51,122,24,12,
+2,143,144,149,137,130,201,48,25,24,18,187,49,22,72,234,129,132,175,131,130,24,16,219,48,8,16,72,173,33,146,195,
+32,178,17,223,129,33,57,129,175,88,137,18,58,176,40,212,33,161,176,18,249,14,65,9,58,154,60,144,18,8,243,152,
+128,16,181,1,57,242,31,17,137,17,160,11,148,129,33,165,15,1,168,2,0,169,37,175,147,0,48,145,156,34,28,24,
+6,172,146,136,3,12,160,52,250,75,41,24,64,136,140,17,128,24,243,41,138,17,16,24,76,178,191,18,180,88,162,187,
+18,8,56,64,189,128,129,73,132,30,40,192,139,113,162,5,138,152,193,0,18,184,10,144,142,100,9,9,32,252,32,128,
+32,129,201,43,195,56,20,217,129,136,25,19,0,77,129,174,163,34,16,227,154,0,28,66,56,143,144,128,3,8,40,50,
+218,188,148,178,113,209,144,128,176,96,146,44,146,139,67,8,0,1,249,29,178,128,67,176,184,130,15,2,80,154,9,177,
+40,121,16,136,162,175,16,178,83,176,186,17,25,76,22,59,161,153,1,136,80,210,249,40,137,24,52,139,9,225,10,18,
+129,4,153,200,56,241,50,16,172,176,25,60,84,168,74,200,24,0,35,160,147,251,144,72,17,243,29,0,9,19,58,152,
+180,171,33,177,124,164,140,2,153,147,50,207,33,152,90,1,0,56,203,152,255,238,70,0,48,243,40,145,8,8,161,67,
+248,41,140,58,81,136,16,210,141,131,192,64,128,176,1,142,64,148,28,0,41,25,133,9,136,226,170,32,177,22,41,170,
+152,18,123,128,139,1,202,121,178,3,26,184,12,148,44,133,25,25,177,44,37,152,30,146,171,66,1,138,179,249,161,8,
+186,87,136,40,185,145,82,177,217,1,184,56,197,34,26,232,10,3,44,132,48,136,176,25,163,112,235,162,137,40,36,137,
+32,155,157,26,213,104,136,72,137,152,0,147,241,136,152,152,49,65,152,68,140,0,43,24,37,184,128,249,179,72,145,201,
+152,43,144,82,113,9,128,14,144,57,178,80,144,42,210,195,56,128,250,25,40,57,179,113,25,136,169,240,24,128,33,177,
+56,41,215,40,65,187,0,138,9,121,18,11,194,138,243,25,24,129,166,128,40,2,76,41,153,157,4,154,57,49,212,136,
+144,169,104,202,33,161,5,75,16,157,4,128,232,0,152,200,50,152,6,41,12,24,146,42,49,192,48,179,221,161,4,9,
+172,179,72,139,98,16,41,192,25,232,2,139,5,40,128,196,178,59,9,2,252,24,128,25,116,25,10,130,140,8,226,153,
+4,177,49,145,62,128,40,136,24,11,44,154,227,25,21,177,8,240,184,0,49,97,8,32,11,88,25,2,224,140,136,214,
+24,130,17,28,176,26,92,193,73,128,24,0,1,187,80,26,163,159,161,24,15,5,16,24,161,128,26,9,248,24,152,18,
+41,162,76,130,42,249,43,58,140,135,8,130,17,192,128,249,0,144,64,25,24,58,216,98,17,203,128,176,8,72,180,144,
+132,249,145,72,156,16,49,178,122,147,42,33,187,157,30,228,1,152,18,42,129,153,146,9,137,81,79,164,129,169,3,9,
+178,242,26,176,25,4,63,178,3,177,42,42,173,129,151,144,57,162,47,163,144,170,56,226,57,1,7,26,25,24,157,198,
+24,153,33,58,24,128,232,151,137,16,170,167,128,8,96,8,57,168,184,145,192,33,185,5,90,152,35,170,122,137,171,144,
+144,112,144,104,26,144,57,160,12,42,146,151,177,83,203,33,59,153,13,128,78,9,33,145,147,2,184,94,11,169,49,8,
+112,28,24,27,58,201,151,48,171,162,173,147,133,16,90,171,131,130,77,46,152,8,1,163,20,246,76,0,36,136,146,188,
+194,32,162,138,97,9,8,6,15,25,144,185,19,1,133,61,194,0,25,225,10,144,0,1,160,18,182,12,0,153,154,151,
+129,56,33,213,131,8,80,9,128,234,147,130,41,24,162,6,209,137,59,144,170,186,163,71,25,44,59,148,2,156,131,158,
+180,171,48,151,136,73,42,137,18,169,148,249,20,152,164,20,192,129,27,128,169,203,1,28,42,211,134,24,136,136,152,181,
+91,162,130,164,3,91,138,161,10,249,27,154,133,192,4,160,3,42,131,224,146,57,77,19,248,147,17,202,49,139,144,164,
+226,25,59,176,167,1,162,32,73,216,130,25,9,44,166,2,41,59,161,154,48,63,218,42,171,149,114,43,16,168,161,167,
+58,76,137,154,149,24,8,32,186,134,144,8,44,45,176,212,2,138,49,58,146,178,249,112,28,25,137,146,16,41,56,2,
+9,243,146,25,28,180,185,146,128,143,114,137,136,128,161,33,91,187,180,195,133,57,0,56,160,74,29,16,15,41,168,161,
+8,18,161,24,147,241,24,66,46,10,105,177,89,136,57,28,1,224,148,57,10,137,137,184,162,92,48,61,153,72,138,90,
+138,176,57,241,50,57,26,20,243,136,40,74,139,82,140,144,89,153,56,138,182,1,216,104,168,136,144,2,73,160,3,41,
+109,152,128,58,226,145,0,217,129,242,32,26,41,40,9,33,228,25,72,171,134,0,17,138,129,41,153,11,231,90,137,24,
+138,131,59,169,128,131,41,215,3,138,10,18,139,145,50,57,123,209,131,241,165,136,1,154,4,0,130,62,136,74,155,196,
+147,29,57,10,243,131,9,129,16,9,153,213,132,42,43,8,203,166,2,249,67,29,8,213,17,43,200,32,160,129,16,146,
+136,134,10,24,72,44,48,142,145,26,1,9,137,225,145,228,129,57,92,128,9,168,180,17,105,9,152,9,132,141,32,57,
+185,19,154,27,96,145,10,185,112,161,61,16,209,80,152,57,8,48,219,146,45,176,58,148,121,184,180,161,49,31,0,168,
+144,18,30,0,211,3,144,128,34,8,185,181,12,160,105,153,128,50,240,144,161,50,158,151,128,162,25,176,51,15,130,9,
+2,92,185,56,9,193,8,0,30,144,16,34,15,88,152,16,8,129,202,18,146,5,137,183,25,196,136,152,233,245,71,0,
+144,195,40,8,48,192,50,143,16,168,166,149,216,18,169,178,0,9,91,168,66,77,128,91,192,3,168,50,12,160,149,160,
+0,146,62,160,160,33,160,31,144,10,17,135,136,8,181,193,150,40,140,24,57,138,19,30,26,58,172,149,193,1,195,24,
+17,146,129,7,94,10,0,26,162,26,193,8,131,240,146,24,26,144,177,122,0,137,5,63,152,129,137,130,144,129,32,169,
+199,26,136,9,25,242,57,16,106,57,26,146,164,40,180,31,176,146,9,2,92,27,17,224,18,29,32,140,131,153,197,1,
+177,162,152,121,60,154,35,14,8,2,136,128,56,144,42,2,26,183,67,155,50,136,47,241,0,44,10,193,50,186,35,28,
+138,1,243,144,133,74,8,33,153,177,89,15,137,1,224,33,128,8,24,64,128,241,64,11,155,5,57,210,33,153,163,200,
+150,160,106,138,137,0,128,145,226,133,137,147,168,24,129,147,15,2,200,2,8,123,25,176,184,38,13,2,59,42,167,161,
+48,169,26,154,211,112,12,146,10,64,194,2,185,133,178,146,41,138,76,9,187,38,14,144,58,136,208,17,57,145,28,176,
+55,169,144,18,18,1,67,250,18,28,234,64,184,136,55,170,72,216,10,48,217,18,26,41,89,59,0,44,137,214,152,33,
+48,128,44,160,182,169,104,193,129,0,26,25,151,169,73,160,146,162,144,33,146,47,128,129,12,162,197,16,212,2,26,43,
+185,178,18,48,235,135,152,16,28,146,176,177,135,27,120,24,9,25,161,153,195,105,136,144,10,49,29,168,135,196,153,4,
+153,128,145,32,60,9,58,91,12,194,48,170,134,192,56,146,89,140,4,9,152,162,9,93,153,130,185,211,146,152,67,8,
+133,60,0,152,233,33,129,122,137,40,234,149,144,145,58,136,59,139,194,18,137,129,17,63,227,34,145,145,33,214,24,10,
+56,143,145,152,179,9,16,107,176,51,240,91,16,25,128,17,144,51,13,193,193,162,240,136,16,9,145,16,148,153,142,35,
+163,61,104,44,73,11,0,160,131,225,149,8,185,2,249,18,27,153,89,9,33,105,43,8,181,200,131,56,169,135,28,40,
+8,153,2,209,10,104,11,209,35,140,32,136,144,128,195,40,164,61,161,128,62,8,12,161,113,169,0,0,176,96,162,26,
+208,255,67,0,16,129,9,215,40,144,195,176,132,153,32,15,149,144,17,12,148,40,11,146,34,15,178,27,0,150,28,33,
+185,25,176,27,154,183,17,194,88,136,136,81,10,183,40,152,149,216,20,168,90,26,24,184,131,44,129,9,25,241,1,141,
+4,43,32,25,216,115,152,41,185,161,0,25,44,136,226,17,153,88,43,194,29,17,57,203,51,1,160,47,148,149,0,137,
+129,177,80,171,1,15,181,40,138,50,155,123,161,146,12,176,98,137,169,4,184,52,169,65,186,212,41,144,154,185,3,227,
+0,179,112,16,57,44,123,153,16,10,67,31,1,137,228,129,144,1,145,145,176,14,49,43,145,57,127,107,170,130,24,136,
+201,131,1,144,43,161,132,169,214,1,16,74,40,168,1,192,1,50,143,149,153,185,149,8,66,186,91,10,33,59,167,152,
+1,8,138,132,60,141,36,140,130,147,31,144,193,9,3,12,1,176,48,73,149,26,133,60,8,136,218,51,138,200,135,152,
+9,146,169,120,136,9,0,152,5,42,188,151,16,152,114,154,8,16,201,17,27,156,35,137,4,91,169,32,171,43,23,8,
+155,120,241,32,16,137,0,146,171,120,168,193,33,185,4,136,8,164,210,8,51,189,4,144,169,67,202,136,113,224,1,24,
+169,3,146,232,1,160,26,114,169,57,144,130,60,195,138,166,176,80,138,176,7,8,58,89,153,136,129,136,24,146,29,164,
+154,75,195,16,122,169,9,132,42,42,25,186,208,69,155,0,194,120,153,2,153,163,153,181,145,32,62,16,156,49,157,131,
+179,125,25,12,51,10,40,28,58,9,197,58,177,73,137,242,163,129,27,24,169,128,138,87,142,129,9,32,9,131,138,5,
+227,161,177,148,129,137,49,12,162,242,131,79,160,32,185,52,219,17,9,194,130,145,74,41,172,134,0,29,8,32,171,105,
+0,10,33,225,128,2,9,59,139,2,81,191,88,0,154,32,164,26,162,168,244,66,138,136,57,176,66,139,145,97,241,59,
+180,10,160,134,137,18,8,45,16,0,137,89,144,43,229,25,146,152,153,135,153,56,162,61,168,40,76,9,138,17,183,1,
+16,9,216,135,184,33,0,154,75,34,47,153,130,203,135,26,129,137,146,164,160,72,90,10,8,144,147,174,36,172,132,9,
+161,166,144,122,130,14,79,0,169,19,10,178,48,169,2,56,95,25,25,25,144,216,179,153,20,29,16,234,165,40,137,73,
+8,42,212,41,24,186,45,24,145,121,22,12,17,13,75,209,129,144,128,146,164,144,149,26,61,226,0,147,48,29,40,128,
+160,43,18,217,193,17,11,0,216,163,130,106,161,147,90,136,192,146,179,91,42,208,160,132,44,132,8,156,98,169,89,153,
+40,136,0,60,42,57,92,194,57,0,131,156,5,61,169,200,147,196,59,184,145,146,128,130,168,182,148,144,194,65,72,13,
+17,136,168,64,241,74,9,72,137,57,35,128,15,134,137,1,42,137,40,185,74,160,95,201,16,128,48,185,8,2,180,27,
+8,133,57,242,107,161,0,152,210,48,160,89,153,90,9,227,58,210,8,16,0,43,137,72,0,169,8,135,47,144,25,144,
+24,12,132,10,57,91,193,146,170,135,195,33,16,31,0,153,193,18,139,146,203,36,138,33,201,41,150,40,160,19,26,23,
+14,34,170,227,49,138,24,153,29,132,137,134,12,162,17,187,5,92,144,24,184,18,209,1,153,167,24,16,25,176,0,178,
+248,36,157,16,25,8,145,184,48,141,131,16,150,27,145,22,251,18,169,35,28,27,216,35,10,136,145,120,153,90,168,147,
+43,9,132,10,45,145,40,30,40,137,147,107,58,154,36,171,5,47,194,57,145,74,152,0,216,50,157,121,153,130,196,57,
+168,65,154,180,16,176,168,150,16,43,145,31,148,10,151,25,25,137,161,136,57,29,194,73,16,137,83,60,169,6,154,40,
+136,9,12,60,132,157,33,160,216,148,129,161,181,32,16,170,23,139,164,0,8,176,72,41,235,104,168,8,1,28,163,0,
+76,57,184,128,41,248,33,13,16,136,135,154,81,144,0,10,130,43,241,170,39,155,128,16,225,56,25,40,176,134,152,137,
+81,251,33,128,136,144,33,152,184,144,47,243,72,193,152,115,24,170,145,76,194,153,113,168,8,32,138,128,51,141,40,60,
+17,211,145,9,216,34,62,128,169,60,0,185,133,161,74,161,93,8,32,193,145,209,56,168,136,72,163,42,123,128,138,0,
+8,11,217,41,4,45,2,128,10,121,29,164,56,178,9,75,9,178,107,161,31,145,11,182,17,152,0,160,34,74,154,106,
+25,133,11,146,195,105,140,136,107,239,74,0,74,170,149,57,43,50,188,146,40,0,40,145,153,167,76,40,136,129,140,105,
+9,8,96,187,0,129,182,129,137,112,172,50,154,162,66,201,145,33,138,57,234,113,216,1,128,147,43,128,46,138,147,131,
+34,178,194,210,4,168,44,217,89,138,145,76,144,57,146,63,162,164,57,24,193,112,169,40,177,58,244,40,152,128,60,194,
+42,145,16,128,26,89,19,220,50,26,47,130,153,176,81,137,8,25,73,44,145,139,234,80,169,35,245,129,129,136,18,12,
+0,17,10,58,60,196,145,169,65,235,132,217,35,152,27,32,8,200,113,43,56,187,21,201,50,161,168,15,130,56,171,50,
+74,204,163,144,112,128,26,42,0,243,24,0,91,216,49,202,81,168,132,137,2,28,73,154,49,184,138,32,200,90,129,143,
+163,24,80,28,144,163,123,177,10,19,186,88,25,9,1,241,56,131,31,161,75,136,130,155,113,154,129,161,65,200,90,136,
+9,18,178,13,37,169,179,107,139,131,251,3,168,35,138,153,18,0,45,32,192,4,159,135,184,3,58,140,32,152,146,130,
+28,131,233,2,128,145,129,159,82,155,1,163,144,74,170,71,173,50,209,16,25,137,25,129,168,65,156,50,251,51,138,25,
+43,170,114,184,130,184,48,67,233,58,33,160,160,3,94,42,29,90,139,65,11,138,63,137,104,58,7,155,149,43,56,157,
+16,140,49,26,64,28,152,1,18,206,40,56,8,129,26,131,197,40,137,170,23,192,56,193,154,0,160,35,201,8,133,194,
+51,185,4,91,163,29,9,0,180,152,196,132,12,194,57,40,186,72,136,128,242,16,138,133,49,12,147,19,78,194,16,43,
+10,201,208,144,129,129,216,131,123,41,168,165,56,168,162,36,59,107,170,41,140,128,185,32,162,183,4,59,91,9,143,3,
+26,48,154,132,72,137,32,241,179,132,184,132,169,177,64,46,154,34,60,9,34,217,50,243,130,59,28,106,138,0,42,226,
+152,73,129,154,160,34,33,72,59,242,149,128,139,128,146,163,243,160,167,18,128,139,17,8,146,175,146,146,164,145,3,201,
+48,211,144,92,24,43,169,12,169,19,120,168,25,51,233,37,15,32,10,153,17,26,226,136,48,16,12,58,195,36,76,24,
+193,16,193,5,168,90,26,200,161,0,16,173,215,238,64,0,164,81,170,129,1,30,145,17,186,88,128,48,153,106,136,26,
+136,209,21,224,1,8,155,178,128,151,17,29,66,144,0,8,161,155,37,48,206,40,169,144,49,235,4,155,40,123,3,184,
+1,143,145,176,129,147,3,138,134,137,148,50,14,13,17,139,163,137,192,34,152,100,8,35,180,40,3,28,243,1,143,144,
+16,8,138,209,3,8,161,227,56,89,12,153,162,184,151,2,184,35,12,34,208,145,162,148,201,75,145,192,225,129,33,241,
+16,2,3,0,32,197,56,137,137,241,24,9,136,161,47,8,59,1,106,12,137,163,194,49,75,10,13,67,138,40,192,24,
+1,190,17,244,17,168,136,1,77,24,42,56,107,145,128,146,33,91,129,141,1,216,56,175,99,184,212,17,59,240,146,129,
+210,129,35,217,112,154,146,9,184,3,12,162,19,128,10,180,200,81,11,80,73,59,217,150,162,16,9,73,45,154,129,3,
+155,145,42,26,31,32,50,154,209,121,154,40,178,164,10,135,176,48,8,137,31,10,0,195,153,183,163,105,137,168,2,146,
+12,149,161,161,34,8,5,176,2,243,58,211,145,153,153,150,24,160,162,145,48,63,41,62,177,9,57,143,148,10,49,160,
+25,104,8,56,15,17,137,107,26,184,48,128,171,58,32,4,143,88,209,129,40,74,233,2,145,0,144,161,64,144,49,9,
+175,75,74,139,179,149,138,76,146,17,163,8,26,251,129,97,137,74,161,75,176,135,154,59,26,74,138,32,130,109,58,168,
+144,33,45,144,178,113,42,56,15,16,136,160,130,12,122,9,8,160,128,153,128,41,36,191,18,25,145,90,62,76,75,153,
+65,141,32,26,193,51,137,40,146,8,4,226,25,153,235,3,128,76,24,139,16,41,63,29,9,105,176,8,146,48,43,43,
+43,56,121,154,105,41,8,28,9,45,17,41,13,24,44,40,184,22,29,134,153,48,59,47,41,186,35,186,144,36,154,91,
+42,249,2,137,65,61,74,9,136,178,120,184,66,202,24,41,25,26,195,45,167,8,145,24,61,10,24,177,17,81,26,56,
+14,145,72,141,163,76,162,137,17,184,121,1,187,132,193,56,105,28,57,168,161,3,157,48,62,185,56,209,193,4,10,32,
+137,44,0,58,123,129,9,135,0,25,26,19,11,201,75,140,232,253,71,0,48,26,14,123,184,147,161,146,94,8,11,147,
+25,8,50,221,82,137,16,153,176,18,41,169,147,140,11,55,174,151,41,168,34,140,66,169,57,162,154,18,228,27,167,144,
+1,0,26,130,140,24,168,10,96,240,40,148,176,20,169,123,128,169,1,243,129,146,26,92,152,8,178,1,75,74,12,16,
+129,25,65,26,31,162,152,182,16,0,152,73,160,168,4,75,46,160,144,195,2,11,24,42,10,215,40,17,61,43,162,27,
+166,153,120,136,138,129,145,123,0,41,17,33,40,128,1,175,136,9,242,128,160,240,161,24,8,121,155,10,161,132,128,178,
+186,136,99,57,151,122,161,18,12,164,24,161,145,9,138,128,74,92,43,131,187,39,128,136,34,121,15,129,11,0,0,160,
+132,137,48,11,13,57,26,187,120,138,64,9,91,73,46,180,16,168,177,153,147,26,60,141,16,24,201,134,129,76,8,8,
+9,106,136,225,148,10,130,45,33,24,168,150,160,24,137,241,1,43,11,136,129,165,21,73,17,61,169,1,176,161,184,132,
+220,50,40,226,81,10,147,152,243,178,56,156,2,30,211,131,152,133,90,25,24,11,216,129,25,192,1,58,148,44,132,144,
+2,244,0,9,43,44,248,130,25,128,80,8,18,91,153,144,185,168,32,159,19,56,225,134,40,152,131,47,137,57,140,129,
+16,58,145,58,40,33,173,245,161,0,152,40,2,210,5,75,168,128,24,153,11,63,192,148,16,164,2,140,147,184,1,177,
+29,73,25,72,47,33,156,130,16,29,90,8,155,136,129,72,9,114,16,171,34,10,240,131,1,172,58,128,57,129,55,144,
+219,49,200,43,32,64,251,168,16,184,51,83,131,145,153,142,242,17,24,9,25,28,192,121,144,147,89,169,176,9,27,3,
+180,57,26,156,124,56,129,122,8,153,12,25,44,1,146,149,153,28,146,43,81,122,25,128,187,16,123,136,65,128,178,232,
+179,161,161,133,145,90,156,153,8,162,114,130,1,8,232,193,196,145,129,16,43,46,184,33,72,3,80,184,152,170,169,154,
+146,104,145,148,92,26,42,19,65,16,14,171,168,125,10,130,146,146,146,155,160,58,68,145,166,177,251,130,43,40,7,144,
+131,210,209,8,43,57,1,61,137,184,47,41,33,97,128,145,144,234,169,136,191,203,72,0,2,35,16,25,141,31,24,64,
+75,128,1,241,224,145,162,2,1,66,8,139,158,162,24,8,135,8,160,208,177,130,178,23,129,16,168,236,25,1,0,83,
+74,9,139,153,145,150,147,34,227,136,250,26,136,32,16,16,48,136,30,58,132,194,165,160,181,26,187,131,1,23,137,65,
+11,12,12,146,1,208,179,97,192,176,19,16,144,3,172,1,250,10,32,161,135,180,180,131,184,75,48,153,17,25,170,108,
+31,57,138,163,36,138,165,161,242,8,136,0,170,21,162,209,178,48,106,10,129,178,183,178,152,13,130,163,192,37,144,58,
+27,211,41,185,48,184,178,15,196,131,133,32,154,151,208,16,153,17,26,139,7,160,168,193,4,40,164,161,163,128,159,58,
+33,49,45,88,91,201,152,146,132,26,160,51,175,8,8,57,90,58,72,121,185,161,17,136,177,11,66,249,136,89,16,9,
+32,33,76,142,27,145,210,180,131,57,138,186,134,18,0,105,8,25,175,25,64,136,129,130,180,186,16,32,226,16,21,176,
+139,29,105,9,9,18,194,243,136,146,132,8,161,32,204,171,48,7,16,0,146,201,248,2,146,138,132,163,233,186,133,49,
+128,32,105,13,139,16,40,176,20,0,216,200,16,20,145,148,74,12,172,122,25,128,129,17,169,220,19,32,179,56,48,205,
+43,73,64,26,72,25,219,186,35,132,89,144,26,156,170,17,115,57,59,40,175,144,65,17,144,28,153,225,152,36,33,138,
+130,171,240,75,32,178,57,219,210,176,80,49,131,139,132,188,13,49,120,9,152,162,169,184,82,134,136,129,192,202,2,121,
+1,136,24,8,157,0,66,9,169,243,160,169,51,34,3,159,2,138,26,114,56,168,138,241,170,164,21,128,184,128,168,145,
+73,84,8,153,216,169,137,23,130,177,160,41,43,14,115,136,24,10,15,42,40,18,41,169,169,196,169,38,16,137,12,12,
+11,121,50,48,201,136,160,26,16,151,194,216,144,185,49,5,34,152,9,10,201,82,130,165,171,209,218,1,51,132,160,128,
+11,28,91,82,144,141,161,12,138,68,1,129,43,218,90,138,66,25,152,58,158,40,48,23,152,177,201,160,128,147,182,2,
+152,187,74,64,23,130,208,161,168,161,129,150,129,184,235,179,17,38,1,138,28,12,0,122,132,20,79,0,128,17,186,184,
+153,10,116,17,9,140,42,153,97,41,17,9,13,155,184,55,1,130,159,128,9,138,114,128,161,27,185,41,51,101,161,216,
+177,177,193,50,65,144,58,236,1,0,20,2,217,16,186,186,34,7,168,145,201,8,56,113,130,201,16,10,8,77,19,26,
+200,194,186,1,113,2,11,138,27,28,74,97,128,144,160,141,24,112,146,25,141,9,27,145,115,0,128,26,141,43,36,149,
+162,208,184,137,10,113,1,16,128,185,139,147,71,136,193,176,195,160,17,18,59,12,10,224,149,21,136,216,144,146,152,19,
+149,25,248,168,177,2,52,129,201,170,33,142,20,131,2,240,152,193,24,113,145,152,138,136,12,48,96,25,178,192,194,8,
+81,33,170,13,25,154,34,49,151,161,129,153,79,56,130,170,217,128,176,41,113,146,153,136,12,47,65,17,136,172,152,178,
+1,135,164,128,43,15,27,49,2,163,187,154,211,28,21,130,144,1,218,201,67,49,161,251,128,177,41,132,131,162,11,192,
+241,17,7,145,171,25,138,144,52,80,57,153,226,200,32,52,0,203,25,155,154,112,32,24,15,17,28,59,83,41,156,138,
+160,177,67,1,59,143,128,137,93,49,32,138,15,137,144,16,51,8,208,16,173,41,35,37,168,235,184,146,107,40,130,177,
+20,250,177,34,34,163,143,145,42,12,33,49,130,57,249,152,9,52,163,190,25,59,155,112,16,128,107,176,57,44,112,128,
+154,27,136,128,138,69,0,12,24,31,43,97,0,138,155,192,163,128,37,1,58,74,172,139,22,4,154,12,137,193,11,7,
+130,25,33,202,192,33,150,144,200,145,144,58,121,1,25,145,242,210,2,130,160,185,162,177,9,114,128,89,9,193,192,17,
+21,200,184,8,161,137,114,0,128,144,178,171,123,84,138,154,26,169,17,18,134,129,178,147,220,90,49,24,159,26,26,9,
+49,35,16,224,149,170,88,49,128,140,141,41,28,33,81,144,0,152,159,41,49,147,185,140,8,143,2,115,128,58,153,171,
+44,5,3,234,152,145,192,16,53,0,42,28,14,43,48,132,185,192,136,226,24,5,131,0,24,14,11,32,148,137,171,136,
+248,130,36,146,146,178,154,175,83,0,144,139,145,241,56,131,18,162,178,241,158,18,146,160,42,178,136,123,178,254,72,0,
+133,16,176,40,251,155,51,148,184,169,182,184,82,32,131,1,106,234,154,3,146,176,194,149,169,129,35,167,145,35,218,170,
+35,0,218,128,162,201,0,70,195,129,2,240,169,130,36,138,128,16,11,13,66,180,168,5,208,216,24,18,137,128,64,9,
+45,49,2,76,153,136,175,59,56,178,130,90,168,203,36,105,24,0,72,188,171,0,148,32,147,167,152,177,48,134,128,33,
+184,159,10,24,162,21,136,17,233,137,164,2,149,144,168,170,76,74,81,24,17,192,154,137,41,1,161,166,242,137,25,81,
+58,34,58,11,156,13,144,44,227,162,152,152,150,146,3,136,38,14,40,152,9,178,25,156,128,183,148,162,144,51,141,128,
+162,128,88,156,162,123,137,64,145,176,181,161,195,138,20,152,56,29,82,10,33,16,12,155,176,199,186,133,144,128,162,98,
+8,121,41,128,169,25,200,13,130,8,176,152,148,165,2,176,112,153,56,29,138,130,9,163,139,151,130,80,176,131,213,131,
+141,58,25,26,0,27,132,12,149,181,146,176,50,173,42,192,35,225,128,7,57,25,130,176,17,232,248,1,169,164,24,128,
+17,56,146,72,210,73,155,140,24,201,151,145,136,128,144,163,97,1,17,251,160,129,184,55,77,42,242,144,178,8,179,34,
+153,123,129,216,132,10,40,59,48,164,170,151,10,136,138,132,201,146,133,90,25,57,24,14,128,136,144,43,144,128,211,132,
+165,136,135,128,1,57,45,203,168,145,169,57,52,56,153,133,162,148,41,24,169,188,47,15,24,34,163,122,209,162,0,42,
+75,138,162,160,2,202,54,153,56,136,129,28,217,23,171,145,138,243,50,26,149,128,8,25,152,50,77,11,177,144,241,4,
+153,164,146,194,136,145,139,154,32,128,194,127,9,1,131,160,177,148,209,144,1,251,0,192,68,153,3,25,144,169,137,167,
+137,232,2,129,136,7,24,57,59,137,177,194,139,186,182,10,210,176,135,147,4,161,32,14,73,24,128,13,41,241,24,25,
+178,4,59,18,202,130,27,128,45,93,154,131,28,177,33,34,136,154,169,185,215,50,152,171,64,63,130,176,17,20,209,24,
+24,189,216,36,32,8,144,211,200,144,16,144,8,13,16,5,216,34,123,2,144,176,92,153,154,64,136,129,32,145,199,8,
+44,12,74,0,32,0,200,79,10,160,161,41,179,122,58,177,132,9,18,168,57,249,202,162,91,137,131,113,27,130,8,41,
+140,50,162,242,177,62,12,144,65,129,165,0,144,155,145,24,67,202,26,171,17,32,124,150,49,10,138,169,29,152,165,132,
+136,152,60,42,130,112,8,128,138,139,211,40,61,57,35,173,213,145,160,58,32,72,26,185,128,175,130,21,8,35,162,252,
+162,145,136,99,0,176,169,43,140,67,34,133,177,155,254,144,2,0,3,32,176,193,41,94,40,16,129,160,159,171,19,161,
+133,19,128,152,170,180,61,49,11,18,152,31,159,145,163,19,133,129,208,138,226,32,25,2,56,157,138,29,64,128,36,16,
+138,188,186,226,3,7,160,33,171,137,61,35,17,90,136,158,201,40,177,4,133,17,128,13,169,2,19,1,152,250,11,169,
+33,2,151,36,152,17,187,217,144,20,27,35,173,160,42,41,151,162,40,41,245,171,163,33,145,164,34,217,57,170,84,144,
+50,25,62,158,153,18,147,32,147,134,188,33,192,180,1,169,0,12,156,15,5,0,49,57,153,228,128,16,128,185,144,183,
+176,136,121,57,162,32,129,176,173,89,26,136,243,1,128,160,16,107,48,170,178,59,176,174,49,19,142,181,49,136,232,163,
+57,57,13,0,147,176,137,97,8,64,193,64,18,175,185,17,104,169,3,155,130,142,82,1,56,130,41,200,186,143,26,18,
+27,149,9,178,1,97,166,17,225,130,209,185,1,73,136,1,67,157,25,10,17,154,64,144,162,175,27,83,72,17,137,149,
+142,152,130,136,0,19,165,144,250,33,146,152,7,152,202,153,49,178,40,138,100,234,145,3,51,180,1,195,173,201,17,33,
+12,51,73,219,172,20,34,152,132,160,249,137,2,1,25,83,1,159,26,41,129,154,65,226,138,27,7,145,18,1,216,170,
+44,3,144,18,10,250,152,112,24,3,8,16,172,158,1,49,168,129,179,191,136,4,22,136,49,192,202,42,49,195,25,9,
+188,154,112,67,138,51,160,251,11,65,1,10,130,168,236,57,82,9,48,137,220,141,17,2,25,146,4,251,32,16,8,40,
+32,188,159,33,16,144,56,20,236,16,129,2,137,80,249,139,1,34,161,1,163,204,60,34,37,26,32,235,186,56,67,144,
+43,179,158,25,63,232,69,0,72,68,10,40,202,171,57,7,161,136,195,168,193,51,6,137,26,204,201,16,6,162,16,130,
+140,168,19,133,153,24,159,154,57,22,136,129,2,169,25,99,164,160,145,15,141,40,19,168,145,162,171,169,119,0,128,178,
+208,184,3,36,139,227,161,152,29,34,16,76,154,200,154,35,4,136,194,41,172,60,51,121,153,161,139,141,50,36,51,9,
+148,172,74,73,0,9,178,205,171,83,17,34,3,211,219,130,19,138,156,123,173,136,34,65,137,16,200,11,48,51,8,168,
+167,173,42,50,39,26,163,177,159,0,35,153,9,16,207,11,51,4,153,1,201,142,57,34,209,41,185,186,31,66,3,40,
+179,200,155,77,1,25,25,136,175,28,4,32,17,130,168,171,104,163,136,74,9,159,45,34,130,17,154,208,156,34,147,4,
+137,133,143,25,34,17,146,16,249,28,0,49,176,20,136,174,40,19,133,138,8,174,186,129,67,25,144,26,223,24,51,134,
+16,162,234,184,25,17,0,64,161,157,10,81,3,88,194,161,217,160,147,129,3,129,248,200,133,1,129,161,193,185,137,2,
+23,144,149,241,137,147,2,147,179,211,185,137,146,53,179,6,216,184,2,16,163,146,184,223,168,33,50,16,51,240,201,40,
+32,18,49,168,191,187,58,80,34,5,178,200,45,8,32,88,24,11,173,9,73,130,20,2,156,15,0,9,9,0,178,188,
+161,5,23,129,33,217,153,145,147,147,132,209,184,152,40,102,16,1,216,192,152,128,128,1,144,159,152,40,49,37,4,210,
+152,139,40,9,80,138,193,185,136,16,87,1,1,12,12,138,8,80,16,152,169,162,44,80,3,163,143,9,141,28,41,72,
+25,56,128,4,2,148,225,128,168,154,76,57,57,91,88,42,18,66,128,240,187,210,184,1,128,129,147,49,46,50,50,91,
+13,42,155,143,8,0,145,147,213,148,130,130,161,185,17,175,8,17,91,73,74,0,56,48,11,191,9,176,201,144,164,130,
+147,134,33,23,129,128,139,13,13,28,40,40,129,32,5,136,18,165,196,163,10,189,12,10,42,130,24,39,56,8,11,147,
+160,66,175,144,224,136,0,49,130,52,160,227,240,129,89,11,136,144,162,145,7,1,2,144,144,210,220,161,57,154,136,24,
+29,19,113,50,17,32,193,169,165,25,62,0,206,128,41,169,4,16,32,1,167,34,136,88,185,241,152,192,161,195,32,17,
+129,144,32,153,248,183,24,10,26,146,226,34,89,128,25,16,225,8,224,9,160,153,195,39,0,33,8,137,129,155,170,241,
+171,11,141,8,114,16,34,131,65,9,139,161,158,137,142,25,171,55,24,52,40,28,10,25,57,187,209,144,140,143,146,130,
+114,57,9,168,156,194,178,176,151,145,24,129,3,35,31,17,157,168,60,152,26,64,225,17,149,132,146,51,143,8,139,184,
+34,14,40,169,137,49,147,135,164,1,184,232,24,41,160,3,151,178,131,3,6,138,9,95,185,8,161,128,27,148,25,163,
+20,146,3,233,241,152,42,16,8,83,42,226,25,24,177,177,176,74,31,170,6,27,34,57,17,22,1,29,200,154,25,158,
+1,144,132,16,178,144,150,131,19,1,29,171,15,59,169,135,73,181,8,145,147,161,145,57,30,140,0,16,168,50,211,27,
+147,25,183,144,161,15,10,40,130,149,135,0,200,17,200,168,0,184,24,177,82,2,146,23,0,128,1,241,169,177,14,9,
+9,147,81,16,196,164,42,145,18,31,178,160,10,49,243,19,145,2,181,60,178,208,160,58,185,57,64,130,178,156,151,242,
+1,57,155,134,59,224,32,32,136,131,122,192,177,137,24,193,153,146,169,166,65,2,213,166,16,137,128,75,11,168,194,56,
+137,81,152,3,177,193,27,29,57,73,89,57,108,46,0,0,152,179,176,128,140,145,16,170,37,130,104,136,165,10,209,193,
+136,168,199,2,128,163,106,42,56,25,41,137,12,157,153,178,128,183,131,163,181,129,212,132,43,144,24,154,41,133,0,75,
+90,29,128,58,41,140,8,27,186,85,121,58,75,200,161,195,130,43,161,41,224,0,162,36,138,23,9,153,41,188,32,152,
+209,225,150,8,1,16,25,211,8,192,148,24,162,146,64,46,57,89,12,160,0,10,63,45,25,41,200,150,136,161,16,153,
+32,154,176,0,185,183,35,57,112,57,59,210,198,162,178,130,57,28,0,131,162,165,178,17,45,137,58,76,217,195,176,179,
+131,96,76,16,27,136,136,33,32,110,27,24,61,138,128,41,200,57,141,42,58,12,2,44,167,129,18,128,3,47,216,128,
+137,152,56,44,56,74,26,88,139,165,146,193,97,230,71,0,130,73,12,136,146,129,180,105,25,74,42,61,44,43,60,160,
+64,25,122,76,26,41,185,133,139,1,0,43,113,9,88,136,161,18,168,122,45,27,26,169,146,33,193,3,74,193,136,57,
+224,181,160,178,33,63,136,1,160,183,129,128,144,242,129,168,104,138,132,153,148,8,92,10,26,176,147,136,114,43,128,147,
+32,58,169,48,143,241,1,46,152,16,9,163,8,148,162,164,20,10,48,141,165,163,169,20,47,154,128,9,128,8,131,44,
+198,132,41,0,136,194,193,192,131,47,168,104,26,0,42,0,153,180,80,153,130,26,25,243,226,2,11,145,58,59,24,58,
+6,58,74,136,121,136,25,46,192,209,1,43,9,57,195,3,168,134,136,40,48,152,51,31,8,210,195,50,47,41,155,161,
+164,136,164,161,16,144,131,52,30,136,224,243,16,60,137,58,178,20,10,130,192,136,161,162,78,152,90,25,243,49,28,8,
+8,137,163,144,72,155,127,153,48,41,44,10,195,210,17,27,0,77,152,131,137,16,153,194,136,121,42,162,114,152,167,0,
+43,160,137,160,177,75,29,161,147,4,48,80,60,59,250,180,32,13,1,44,193,130,24,1,59,161,42,163,74,95,152,161,
+182,0,10,24,47,137,1,0,56,33,128,156,198,129,59,138,42,230,1,24,136,72,12,48,27,139,151,43,136,195,88,160,
+64,136,181,24,152,32,46,186,80,11,129,131,154,167,9,24,27,89,192,4,129,216,50,15,144,40,12,162,8,179,3,18,
+128,112,74,216,130,171,178,57,159,134,25,1,25,32,153,72,192,194,105,140,179,146,145,178,64,168,107,61,137,56,152,166,
+16,192,16,136,137,148,162,146,146,120,169,33,12,147,15,194,177,17,27,121,26,32,137,179,197,193,132,137,152,73,59,60,
+24,160,166,147,160,146,63,11,130,40,195,64,202,211,145,24,59,73,60,1,24,177,33,46,241,180,178,161,48,15,129,60,
+1,26,56,152,129,166,81,26,95,154,163,161,194,148,144,129,25,90,29,0,136,164,128,161,74,62,139,1,209,165,130,144,
+179,144,147,76,42,62,152,8,178,17,108,11,33,139,164,193,148,177,33,128,60,209,57,192,25,164,106,58,29,129,42,128,
+40,149,232,130,169,25,208,18,226,3,179,96,26,138,2,62,150,28,78,0,129,28,148,153,162,177,1,249,130,160,145,180,
+121,24,42,179,44,196,58,144,26,209,194,148,144,49,171,4,241,34,138,57,184,90,179,62,195,0,146,42,193,138,132,156,
+20,242,65,153,24,152,137,196,89,168,0,180,8,146,27,132,201,51,172,83,155,3,194,56,180,108,136,8,177,16,225,75,
+136,138,3,169,68,29,145,144,177,163,106,152,20,170,17,233,32,154,42,193,178,38,123,176,130,136,128,8,168,150,139,3,
+156,151,184,135,137,164,8,40,186,66,219,51,201,18,192,16,8,79,137,41,193,16,180,49,16,153,149,12,129,14,130,169,
+164,130,161,1,41,152,180,209,16,77,192,57,210,129,146,136,51,234,33,137,72,31,25,184,149,25,129,178,89,169,48,155,
+104,26,133,42,167,27,162,170,196,196,17,137,81,44,8,74,26,10,178,161,152,244,129,8,2,144,167,24,24,0,8,137,
+145,31,0,59,132,27,167,16,138,43,218,164,192,134,161,17,170,81,12,57,136,41,12,163,3,104,60,170,129,140,9,182,
+41,196,56,0,74,16,89,25,153,184,208,168,185,134,80,27,132,43,195,56,152,141,147,12,42,24,48,59,68,217,215,129,
+161,148,9,2,76,25,59,24,160,227,164,161,144,74,26,10,57,156,166,136,146,16,162,79,26,1,24,19,171,3,159,217,
+227,129,144,19,58,164,104,25,56,187,149,203,197,145,0,16,144,3,107,26,136,56,217,0,140,136,160,135,144,134,25,42,
+75,154,3,12,72,42,26,181,33,168,34,31,162,29,1,136,2,63,139,0,59,140,133,184,167,0,16,24,0,16,248,128,
+11,91,44,25,0,17,240,19,41,144,8,250,162,11,35,29,99,43,57,46,144,130,60,139,42,235,147,163,33,4,76,8,
+13,1,200,3,28,27,129,93,152,66,168,148,161,2,73,142,130,232,130,152,18,46,128,8,8,192,18,180,33,9,11,216,
+169,161,176,23,136,66,139,133,179,130,240,9,11,26,59,1,3,51,90,199,51,139,162,249,211,152,129,74,74,152,149,16,
+26,161,26,47,217,146,130,2,90,160,33,42,28,80,201,165,24,128,138,56,58,242,130,144,146,92,152,123,10,160,89,154,
+130,58,24,161,168,243,18,178,19,93,139,152,42,153,16,121,154,7,137,19,109,43,74,0,153,178,108,13,144,128,129,40,
+164,32,41,10,64,201,243,194,25,138,105,75,136,179,148,0,42,130,59,31,242,16,153,147,17,48,26,40,13,136,242,163,
+64,156,149,43,144,136,16,176,132,184,115,152,145,123,11,192,17,177,160,151,8,32,11,120,169,165,144,41,153,56,28,128,
+165,162,5,27,151,26,176,211,74,170,18,8,1,164,145,136,137,227,48,155,244,2,137,16,40,125,137,1,152,130,178,16,
+44,240,146,144,131,10,50,12,24,153,95,144,16,11,225,180,193,163,48,45,136,48,138,35,212,33,62,141,178,8,161,146,
+35,24,105,137,57,208,121,11,137,162,41,145,48,88,44,145,216,133,152,128,58,143,162,57,241,148,1,136,130,44,129,144,
+180,2,44,160,107,153,177,181,72,168,24,4,160,182,25,59,141,57,11,132,162,32,48,143,2,92,201,164,42,168,64,45,
+0,129,178,148,90,41,45,153,242,0,9,32,74,24,195,2,160,144,129,45,170,241,130,10,49,154,134,42,152,211,1,182,
+49,62,168,130,27,195,146,34,31,32,187,5,8,129,26,155,199,25,152,2,90,28,1,9,3,144,148,155,156,11,12,162,
+2,23,105,25,42,24,243,194,0,28,137,74,144,148,80,9,129,137,2,9,201,40,31,154,1,195,149,179,122,154,8,57,
+153,2,16,40,88,93,25,137,180,136,227,16,80,25,193,146,62,170,56,26,177,50,75,160,161,69,28,240,163,26,43,26,
+59,123,8,1,162,163,69,13,152,184,136,233,19,106,25,56,161,8,27,130,75,171,247,17,168,33,75,42,152,162,8,186,
+82,11,10,241,129,136,19,48,124,144,72,44,25,147,137,57,241,25,192,25,24,10,148,34,162,65,151,92,11,200,8,184,
+1,179,80,165,17,136,0,0,15,9,202,16,184,133,49,123,152,1,128,11,167,25,60,185,64,184,4,48,25,73,13,57,
+250,131,9,136,160,179,132,12,88,13,40,136,17,180,66,25,184,163,184,89,184,76,178,9,96,58,92,138,180,129,160,40,
+168,25,76,192,49,76,47,144,161,9,8,29,144,132,49,1,33,43,171,143,176,45,10,41,149,22,26,2,24,27,155,213,
+144,9,169,130,24,123,129,51,143,179,192,161,58,141,147,182,131,0,16,25,48,10,151,0,141,20,65,0,114,185,34,241,
+160,146,156,2,29,129,161,113,41,16,194,169,196,27,154,180,80,137,132,73,27,145,6,42,203,178,60,202,2,64,0,130,
+65,155,229,50,63,201,164,24,25,9,129,24,161,163,142,132,193,18,192,136,9,9,23,58,8,242,130,169,129,166,0,210,
+0,27,128,35,28,128,154,2,224,35,130,16,199,60,171,144,3,107,130,129,8,188,72,11,40,7,15,178,136,65,152,2,
+177,106,154,25,0,130,178,211,75,153,108,129,129,163,155,192,226,0,130,20,194,185,179,136,120,8,128,130,175,162,48,65,
+144,3,242,45,25,58,18,137,1,240,25,128,51,176,30,144,31,161,179,82,169,0,9,10,131,2,44,45,171,31,34,165,
+51,11,186,170,63,16,16,27,90,203,57,33,65,182,10,169,194,96,144,17,128,227,170,33,153,80,193,25,12,139,23,26,
+40,17,193,11,1,212,20,184,25,8,0,20,169,16,43,191,91,10,146,37,138,168,4,28,167,10,152,34,188,2,65,26,
+149,59,10,144,57,243,10,24,17,250,74,1,49,3,251,24,139,2,153,163,36,7,248,136,131,26,147,15,58,25,89,9,
+154,180,4,202,41,18,32,18,143,129,17,64,46,169,128,80,185,27,72,17,40,168,216,132,19,142,177,9,150,25,202,33,
+35,9,227,240,128,0,0,128,27,151,18,208,42,16,8,2,143,27,17,64,138,0,0,50,196,250,144,33,8,194,208,16,
+3,9,41,203,4,41,24,255,32,130,33,152,184,24,20,168,142,145,17,21,129,15,10,135,25,168,192,129,131,8,168,129,
+23,136,161,250,136,34,169,194,162,107,33,162,136,28,64,176,144,9,175,131,133,128,16,201,48,132,202,138,8,39,160,17,
+227,14,2,128,152,75,156,35,24,170,147,73,133,171,20,242,43,33,144,8,64,156,21,152,28,161,41,164,14,130,177,57,
+36,144,27,137,142,18,208,47,8,49,136,9,147,241,43,64,208,128,17,30,2,136,43,136,56,58,25,146,239,130,20,168,
+40,210,8,34,28,11,225,65,137,74,41,240,8,33,187,147,168,79,2,144,56,26,133,25,11,2,222,40,18,138,1,211,
+57,3,155,168,64,56,188,48,33,255,130,34,172,147,184,120,128,184,1,25,131,144,104,1,175,32,180,25,199,248,74,0,
+153,168,100,0,11,161,24,178,25,4,245,43,33,146,128,26,251,33,201,41,8,43,3,138,71,249,1,130,129,9,128,12,
+17,194,9,34,57,129,63,179,175,18,144,58,208,136,81,24,161,93,176,129,161,131,242,30,49,154,17,139,74,137,17,76,
+42,178,75,96,192,11,1,164,42,130,138,74,171,212,135,40,27,40,179,159,17,193,16,136,177,3,1,168,67,204,146,0,
+5,235,34,49,12,148,154,58,185,148,128,3,187,80,99,250,8,131,58,0,8,15,178,160,56,181,144,16,97,218,41,56,
+141,2,42,76,145,40,168,150,176,26,35,249,60,17,74,40,26,157,162,168,122,147,9,40,19,249,59,56,140,19,141,8,
+129,10,0,7,160,48,3,220,128,48,45,24,186,11,18,184,115,134,137,193,66,251,24,56,28,131,8,91,169,145,41,145,
+227,32,65,220,32,25,59,2,144,47,161,136,16,164,1,16,2,223,58,41,41,4,152,140,208,129,112,0,145,2,26,252,
+8,56,44,131,146,43,169,248,4,8,1,144,32,204,44,1,0,37,201,136,192,161,32,3,130,27,49,232,31,144,163,51,
+136,233,144,193,26,83,1,73,9,213,169,152,25,74,19,3,9,195,15,24,201,148,130,104,160,138,146,200,66,24,41,163,
+144,46,145,10,21,180,19,155,31,160,160,160,136,157,121,136,132,56,137,128,192,131,240,137,56,29,1,179,131,89,26,10,
+93,160,48,145,134,59,202,209,41,59,29,146,8,161,211,145,16,45,179,209,16,8,185,212,148,138,17,129,81,24,32,167,
+26,74,43,131,123,8,163,165,9,33,216,40,41,161,186,135,16,232,177,169,148,107,128,25,16,153,0,153,50,143,82,184,
+65,185,168,32,15,145,107,40,58,40,186,19,235,24,32,137,170,106,154,136,104,143,132,137,2,161,3,152,165,195,48,248,
+27,152,11,134,144,1,227,130,138,130,164,48,137,134,133,170,168,32,153,24,123,152,131,240,129,129,8,18,120,193,131,170,
+129,186,156,9,114,65,24,26,160,146,240,41,136,38,130,233,178,9,136,185,88,43,34,130,60,245,144,129,40,19,161,28,
+177,185,13,157,56,64,24,210,148,25,229,16,10,129,67,169,145,26,58,168,63,160,193,17,147,19,240,193,129,1,213,128,
+133,247,74,0,145,0,25,171,105,27,162,135,8,145,17,14,129,144,129,161,56,248,131,194,27,180,163,160,160,0,135,48,
+30,128,20,154,10,59,243,169,57,167,32,25,28,16,145,29,42,162,34,49,159,242,145,3,177,19,40,59,58,240,24,27,
+92,144,4,41,189,176,33,185,216,52,75,72,153,17,242,16,138,145,98,168,192,163,137,26,139,104,33,24,155,243,3,169,
+0,64,8,129,183,161,31,153,140,51,136,36,161,18,163,12,128,237,1,18,193,40,157,0,192,144,133,104,16,41,122,144,
+137,161,32,168,244,128,137,128,224,128,1,48,1,33,17,31,152,128,144,57,146,47,178,11,227,201,65,27,65,155,121,147,
+9,161,76,25,144,216,160,8,1,27,109,129,152,50,0,19,249,24,138,73,196,138,147,15,17,137,137,152,37,8,123,145,
+163,131,16,43,16,249,208,144,16,13,58,164,177,133,155,20,152,16,145,72,18,219,179,159,2,10,59,146,164,42,25,21,
+82,168,130,130,84,253,136,137,8,2,27,145,4,81,154,2,10,146,150,57,48,194,202,10,176,143,177,25,146,82,17,8,
+114,201,2,1,65,177,147,207,129,161,25,131,171,4,180,67,15,161,161,34,134,8,144,156,216,24,153,43,130,152,115,19,
+64,216,33,13,0,177,125,168,24,0,138,145,139,147,32,144,99,161,201,18,161,115,227,1,144,202,128,11,176,16,127,9,
+34,11,56,168,9,8,17,194,179,39,0,144,30,144,173,32,152,34,8,91,183,144,56,25,152,96,224,42,153,154,65,209,
+20,0,25,210,40,200,0,129,8,133,10,211,145,57,142,25,42,29,60,130,129,81,129,12,165,176,132,176,151,144,8,160,
+137,0,60,168,136,48,47,0,29,97,24,8,20,41,140,25,170,41,160,178,7,137,196,200,131,26,128,212,3,155,212,149,
+24,0,40,44,138,63,153,136,40,42,130,121,41,128,160,160,181,43,40,31,77,128,48,153,8,160,176,160,193,183,144,5,
+208,3,160,146,138,130,16,15,164,168,150,24,164,0,128,1,63,155,0,162,74,129,97,139,1,72,252,147,152,163,0,1,
+72,8,16,138,243,43,200,58,42,169,48,17,111,208,4,58,24,46,144,152,144,195,162,3,74,153,2,61,170,161,61,129,
+230,33,42,24,216,16,72,0,26,9,0,63,12,48,13,32,9,168,132,144,33,176,194,7,29,16,28,136,132,41,33,28,
+128,60,171,128,138,147,122,161,73,244,179,26,128,27,193,131,144,146,36,161,19,16,151,148,13,1,15,152,193,2,58,61,
+64,140,34,139,184,34,44,57,41,144,21,11,72,210,145,228,72,141,0,10,128,56,179,32,3,107,195,176,151,137,144,195,
+180,162,151,89,168,24,144,193,0,168,57,27,9,200,36,139,97,153,17,241,198,130,32,186,56,200,130,178,131,120,59,27,
+25,13,32,157,164,211,181,163,1,41,162,44,2,170,147,56,15,44,26,140,197,163,165,2,152,130,161,8,60,178,56,56,
+59,41,232,57,179,91,244,146,32,160,185,2,241,122,60,25,130,16,113,185,195,145,137,0,138,44,13,42,10,1,187,39,
+27,57,26,2,47,9,128,10,225,33,41,75,16,16,6,25,242,2,1,90,27,168,80,171,64,154,26,144,216,1,51,40,
+34,74,104,139,227,130,48,155,244,129,202,33,138,25,167,56,161,59,131,46,24,241,40,248,2,136,9,145,128,145,195,52,
+136,25,107,29,164,43,177,16,29,224,40,9,24,0,50,128,228,24,160,49,251,33,29,160,131,11,197,129,16,9,82,27,
+180,130,107,241,0,26,136,130,26,163,0,131,105,88,10,1,57,62,203,166,9,136,8,90,168,48,136,8,163,27,151,193,
+24,61,172,180,128,161,165,64,25,132,16,137,122,152,0,141,180,24,42,138,40,217,2,128,2,150,57,147,24,243,26,47,
+153,136,8,164,17,177,132,66,26,129,27,245,57,186,144,180,168,51,31,33,58,60,153,19,144,148,138,215,128,152,58,90,
+155,133,89,144,144,17,128,137,209,129,47,9,141,130,197,2,136,145,34,12,131,16,228,72,12,162,160,177,164,121,9,8,
+8,168,131,168,133,62,185,165,0,161,105,43,128,8,57,154,88,136,145,208,198,128,128,8,124,168,2,8,129,128,160,130,
+16,251,105,28,8,137,179,182,19,137,33,27,152,1,77,136,47,208,1,176,1,56,63,128,9,145,148,16,152,2,219,167,
+43,10,89,42,177,5,136,131,42,8,16,41,240,58,220,145,176,161,20,79,144,56,9,136,17,179,4,250,148,44,9,11,
+1,192,20,154,147,32,61,0,29,4,70,0,57,40,63,248,2,153,128,16,28,33,44,179,2,129,1,226,194,80,15,0,
+26,9,194,19,168,131,156,19,210,16,130,31,197,41,168,48,76,138,2,128,146,42,20,58,148,216,104,156,129,154,148,129,
+123,168,32,168,129,152,65,137,171,7,59,145,46,161,194,150,9,1,44,8,10,3,140,90,251,2,176,32,56,106,161,0,
+243,0,145,73,152,160,19,15,8,153,149,160,51,12,48,12,129,177,17,46,29,242,1,128,74,8,9,147,0,131,137,17,
+187,183,152,114,14,130,184,2,128,106,160,56,153,17,186,52,185,240,146,31,8,28,130,145,4,136,3,59,8,28,132,154,
+60,249,128,168,41,78,24,160,57,165,18,137,88,145,136,94,140,145,160,130,136,65,10,64,28,147,144,72,168,210,180,63,
+137,59,144,176,151,128,130,26,3,41,7,28,40,240,129,160,16,75,41,209,33,184,1,210,48,2,250,33,15,129,138,164,
+145,40,154,4,138,35,154,69,27,184,215,0,136,58,28,144,133,44,146,8,152,25,151,136,88,140,147,185,149,24,90,152,
+32,154,130,144,121,136,152,198,58,136,43,136,212,132,9,147,43,24,139,7,154,64,186,149,160,19,8,94,152,24,177,1,
+161,16,197,160,179,62,144,29,129,193,134,9,17,153,128,25,32,12,107,241,1,160,32,136,91,144,41,136,42,210,74,164,
+185,17,31,136,9,131,195,52,153,51,139,107,160,128,160,143,213,24,144,0,25,24,147,10,7,169,4,24,195,242,0,170,
+128,169,3,149,64,16,17,1,24,210,49,137,221,183,136,145,10,90,168,130,24,24,130,64,25,182,162,46,200,160,144,227,
+2,89,136,2,8,160,146,136,2,244,9,43,169,161,31,196,0,146,146,81,58,16,33,58,249,131,15,136,41,139,145,18,
+25,138,37,143,17,25,75,152,97,75,10,0,169,145,140,24,153,112,146,20,128,0,211,162,17,137,235,149,228,129,144,136,
+184,129,1,180,8,48,193,130,226,133,25,72,14,25,209,1,9,16,65,157,163,90,138,128,50,45,179,58,139,242,73,12,
+26,57,56,130,1,98,144,18,154,111,200,16,9,201,33,155,24,148,9,129,146,123,147,51,218,183,8,27,1,46,178,132,
+40,169,19,140,145,151,57,208,88,139,161,49,227,28,71,0,218,35,29,9,177,136,180,24,80,9,36,174,166,8,42,136,
+42,197,146,130,168,146,152,155,23,8,148,156,164,216,17,209,64,136,0,164,152,163,177,16,2,121,178,142,197,144,16,9,
+123,144,162,130,139,145,176,48,148,113,145,156,181,168,48,25,122,162,162,163,201,129,184,90,130,0,5,250,33,156,8,148,
+40,165,145,0,187,24,187,34,53,10,39,202,43,241,136,4,8,50,27,153,169,143,162,129,18,144,96,152,142,130,28,81,
+136,33,178,185,195,13,18,10,49,192,48,243,202,131,26,113,8,42,161,217,1,26,65,128,91,145,42,209,27,148,16,51,
+137,92,187,192,147,128,49,0,14,1,144,249,105,152,1,2,192,48,188,28,1,16,20,137,75,153,2,250,75,10,32,135,
+152,181,144,10,41,0,128,194,24,50,2,255,0,40,58,52,15,145,161,24,41,129,74,170,144,35,176,239,129,16,73,34,
+46,11,177,41,18,3,0,9,128,119,152,173,163,136,81,128,58,11,169,120,24,128,10,171,40,71,27,143,145,145,50,211,
+9,9,152,48,49,209,27,12,136,39,186,31,128,129,51,227,160,24,169,48,129,209,24,44,32,5,249,60,40,9,82,184,
+193,130,168,5,144,168,9,168,113,128,248,24,73,9,112,138,137,145,0,131,162,1,170,4,33,1,254,8,32,32,33,15,
+11,0,17,137,243,137,128,3,36,128,191,128,20,9,4,187,61,1,40,128,171,170,65,211,48,150,175,131,19,25,130,188,
+46,17,152,16,184,9,50,17,2,23,239,146,132,8,145,137,59,72,136,59,154,171,113,8,1,35,239,145,134,136,128,152,
+42,50,1,43,8,140,64,170,144,38,191,146,6,9,8,168,43,34,136,46,136,9,48,129,152,22,252,8,20,26,128,136,
+28,49,129,15,137,9,56,152,1,81,240,27,83,10,16,27,14,17,130,140,129,176,80,160,144,34,241,31,64,144,40,9,
+187,132,2,186,162,0,45,18,169,114,161,15,40,148,24,145,242,1,3,170,169,41,26,105,24,60,4,175,1,132,152,161,
+194,41,66,185,43,25,152,66,10,73,20,251,10,37,153,129,138,30,64,26,14,24,128,73,0,153,52,234,43,120,136,41,
+9,154,50,1,158,0,129,43,2,169,112,147,159,48,146,10,26,1,71,0,8,249,32,17,153,59,75,59,34,156,120,20,
+205,1,4,152,161,161,10,66,168,13,129,146,146,136,185,55,241,13,50,152,8,56,142,32,1,140,136,17,57,26,138,114,
+194,15,56,145,137,25,232,2,132,184,0,32,9,0,185,122,5,190,2,6,153,128,194,25,32,176,28,17,145,17,200,26,
+23,249,25,81,137,8,24,29,40,145,170,16,132,24,145,16,113,162,175,64,1,138,136,216,129,5,208,8,1,144,129,161,
+59,38,191,32,35,138,152,128,31,33,152,29,24,146,0,178,12,5,241,11,65,17,27,26,172,50,19,174,40,1,32,8,
+184,113,131,239,16,132,153,128,153,40,66,137,43,24,40,160,209,25,83,242,13,35,144,137,57,141,64,33,171,56,35,141,
+1,186,120,179,175,33,131,154,8,225,41,66,200,25,65,154,2,10,106,2,237,129,3,136,170,130,13,50,3,143,17,160,
+56,13,152,36,210,13,72,129,154,1,185,18,38,218,33,0,43,152,9,122,16,175,8,20,168,136,129,59,51,176,155,88,
+161,49,46,107,34,209,143,56,130,139,56,208,17,20,185,8,145,128,25,138,112,50,255,8,34,138,145,24,208,23,10,141,
+16,130,24,169,3,1,149,159,107,25,25,128,161,17,18,172,26,18,9,198,137,1,56,236,1,35,185,57,11,154,71,145,
+171,129,16,210,200,51,91,145,15,48,194,26,26,128,57,50,26,29,48,179,42,143,8,7,248,136,19,152,8,72,140,18,
+40,188,41,132,25,10,169,125,129,141,72,0,0,144,161,10,53,224,9,25,11,136,144,121,57,194,45,73,0,26,152,201,
+5,49,169,9,0,138,138,0,93,162,251,136,100,153,129,9,25,57,180,208,33,210,145,177,146,64,0,175,18,4,152,44,
+161,32,121,169,10,32,192,32,179,163,115,248,25,88,152,9,41,186,4,145,192,41,130,177,25,146,97,133,250,129,4,10,
+152,147,44,41,154,31,41,130,27,57,61,104,128,15,24,147,0,136,180,145,2,248,153,2,25,193,33,89,8,240,139,98,
+8,136,56,12,41,145,185,33,163,177,133,177,114,17,191,16,6,9,9,185,0,35,176,14,57,128,162,6,27,1,243,14,
+34,161,9,42,156,104,40,139,153,5,9,40,153,66,179,191,1,135,152,177,68,230,77,0,162,58,48,169,15,0,2,145,
+1,122,0,200,27,115,144,138,9,140,34,1,235,1,18,137,162,130,42,96,191,40,6,153,129,176,56,120,168,24,16,179,
+144,4,11,41,231,27,88,8,11,24,136,48,50,175,160,5,169,3,178,41,37,207,8,20,168,128,8,12,50,56,143,17,
+136,136,131,155,19,198,15,48,161,138,147,184,16,55,156,73,41,10,18,200,136,80,252,16,3,169,145,162,139,53,176,137,
+24,211,64,128,13,82,184,29,64,144,10,34,219,49,3,219,1,2,169,72,218,32,50,207,1,134,152,144,178,42,64,184,
+8,50,200,3,168,233,135,209,10,48,128,41,1,140,33,128,219,34,17,15,1,12,64,16,191,130,133,152,162,193,2,35,
+185,32,107,155,16,141,26,52,250,9,98,137,161,129,186,36,145,185,51,57,154,24,10,115,180,175,112,25,136,16,185,48,
+49,251,8,24,176,3,30,56,35,223,33,16,152,129,208,41,80,184,136,1,168,32,156,137,71,234,128,35,152,16,8,15,
+72,8,140,32,168,17,144,153,69,224,138,97,136,136,32,156,64,16,141,24,144,10,40,136,66,165,15,56,146,154,17,201,
+16,53,171,41,48,140,32,169,91,23,188,0,7,153,129,177,10,51,216,138,72,168,32,128,43,39,241,10,66,169,129,128,
+186,20,146,158,32,9,11,32,75,104,165,30,73,128,25,9,200,1,34,156,40,57,28,72,137,59,115,159,40,2,137,145,
+194,136,18,241,26,1,168,33,0,169,71,233,128,50,153,160,18,140,19,179,158,16,178,138,68,154,113,161,30,89,128,10,
+41,186,32,131,188,17,4,11,89,25,76,18,159,40,133,152,136,176,136,34,218,153,35,152,162,151,180,4,241,136,51,138,
+27,40,30,89,9,139,56,144,138,1,180,36,245,10,64,129,138,57,139,58,88,15,8,56,137,1,131,130,2,191,3,7,
+153,169,180,25,17,208,137,49,137,34,80,33,42,253,152,37,154,169,2,45,48,144,203,50,145,136,17,73,64,240,47,73,
+144,137,25,169,17,19,202,25,18,152,49,150,96,136,159,48,131,170,152,227,75,33,216,26,16,178,32,3,179,55,251,10,
+98,138,136,9,12,50,146,141,49,144,57,48,216,21,211,15,56,162,10,8,185,32,36,203,55,237,72,0,32,17,138,112,
+176,88,32,207,0,134,152,144,146,25,18,160,153,33,249,129,3,27,19,248,15,72,152,137,24,153,32,18,188,34,148,26,
+3,160,82,65,239,17,2,154,40,137,58,113,168,16,89,128,8,24,184,5,248,138,35,176,152,1,186,113,131,140,74,56,
+28,57,26,122,136,143,56,129,154,16,168,130,6,185,8,6,152,128,178,136,6,220,136,52,139,153,131,30,88,137,10,18,
+195,0,32,200,17,242,14,56,146,25,57,155,1,6,186,90,17,141,17,9,42,67,191,0,7,136,136,161,1,17,193,144,
+17,169,16,27,44,22,240,28,120,9,136,128,136,16,129,153,145,165,137,179,161,121,161,143,56,131,44,73,139,16,18,249,
+129,0,153,131,9,33,3,255,0,19,11,144,179,59,112,152,44,16,186,209,147,177,21,241,10,36,152,24,106,139,89,8,
+139,34,25,12,48,184,5,162,175,19,148,153,2,242,8,33,203,56,24,201,32,130,26,21,251,152,135,160,0,130,154,51,
+137,143,34,155,77,128,168,50,192,13,81,144,25,16,201,48,40,141,32,129,140,132,136,76,16,159,32,149,10,16,193,8,
+17,233,8,33,155,34,32,170,39,250,41,4,10,41,1,140,65,160,29,33,169,136,20,201,66,241,10,98,152,10,72,155,
+16,1,13,42,130,44,41,176,122,162,15,48,129,11,56,144,29,33,188,8,19,11,24,163,9,87,189,129,23,138,25,129,
+11,18,178,141,34,224,129,1,152,67,249,9,84,154,137,32,13,24,1,140,48,162,10,35,128,120,200,45,121,128,137,32,
+154,161,5,203,33,9,8,58,165,90,145,31,25,19,171,0,209,128,18,216,9,33,154,18,162,48,121,191,130,23,169,145,
+146,154,34,242,152,33,176,129,20,155,37,248,9,81,184,0,16,11,40,150,140,17,145,170,19,162,120,161,143,88,145,138,
+57,200,41,20,186,48,18,188,35,131,26,55,175,56,4,139,10,180,139,51,248,136,19,184,41,5,43,66,251,137,68,169,
+152,147,156,34,162,141,48,210,137,4,144,49,241,11,113,144,138,32,154,57,131,172,148,151,153,3,128,128,148,159,80,129,
+154,40,192,161,35,232,41,17,186,18,148,24,49,223,24,5,169,8,146,26,34,212,152,132,161,0,1,241,253,254,76,0,
+50,240,137,81,152,153,17,170,32,4,172,17,132,170,18,195,40,182,159,32,148,153,24,178,10,5,176,26,67,216,1,1,
+0,5,240,11,82,185,25,48,156,32,131,14,32,162,10,33,168,34,39,207,17,164,169,17,177,26,80,169,25,50,200,74,
+130,155,23,193,13,80,136,25,17,200,145,51,218,32,146,11,48,186,41,68,248,15,16,9,56,42,217,33,164,144,146,145,
+58,8,242,41,34,221,153,83,11,0,129,13,34,20,171,130,146,136,176,193,171,103,219,137,52,137,8,16,173,97,129,169,
+24,2,138,133,192,42,51,254,8,19,169,3,8,30,49,161,12,9,130,56,24,170,72,39,190,129,21,153,8,161,27,98,
+160,156,33,217,48,153,153,113,145,156,19,5,154,161,1,28,49,169,139,123,153,145,1,186,135,17,190,19,151,137,129,128,
+25,3,186,153,109,8,8,8,24,106,40,159,1,148,152,0,178,176,134,243,152,3,186,34,24,155,116,128,29,40,130,43,
+8,209,136,34,192,8,32,155,37,240,137,35,229,10,65,169,57,25,218,56,146,169,33,16,41,22,202,48,20,249,26,49,
+186,17,185,219,50,147,218,121,178,57,1,153,122,4,157,16,1,154,0,216,42,80,136,43,73,16,57,200,161,7,243,137,
+90,129,11,41,169,8,83,202,32,17,24,24,160,113,33,190,24,35,169,153,130,12,83,178,31,8,50,187,26,185,134,242,
+138,120,128,9,16,169,56,51,142,41,50,28,153,193,16,211,142,75,163,8,129,227,57,48,152,10,34,146,153,179,59,55,
+238,8,35,169,8,213,24,57,130,29,128,165,153,17,138,64,248,169,83,145,42,72,138,32,165,42,26,64,140,25,142,18,
+209,11,40,165,128,11,128,16,48,234,184,5,28,137,32,42,37,190,18,21,152,129,178,161,113,177,41,41,25,13,33,63,
+72,203,136,98,138,0,137,9,72,161,136,24,145,42,192,69,161,165,159,82,136,136,26,137,42,35,157,25,129,29,16,44,
+36,24,175,106,16,155,32,217,130,64,168,25,18,170,147,168,123,130,221,0,133,137,145,16,140,64,128,152,104,128,136,24,
+44,34,203,15,121,152,0,24,137,89,40,170,16,131,12,153,152,133,133,203,1,53,138,40,28,24,80,179,60,61,169,184,
+255,245,73,0,195,20,24,242,138,50,179,168,72,157,130,17,171,91,8,195,139,166,1,19,174,136,21,144,10,162,61,75,
+0,31,8,146,160,2,145,132,182,142,72,0,10,25,176,40,67,138,12,5,152,178,2,28,36,250,170,115,168,24,57,186,
+104,40,171,2,177,163,49,230,0,130,219,0,20,185,88,129,45,56,136,138,32,0,79,144,153,25,163,142,0,6,11,130,
+16,47,0,9,169,18,11,129,49,141,17,3,159,57,132,29,24,185,228,3,169,194,17,145,147,163,226,49,209,138,112,25,
+59,75,224,8,131,137,42,32,194,33,194,25,112,218,24,104,138,25,147,169,48,165,12,32,145,26,129,193,26,20,191,1,
+131,249,133,178,144,34,193,10,51,241,0,163,8,42,163,159,124,136,128,1,184,16,33,157,32,129,186,132,242,128,19,249,
+8,34,208,1,146,10,0,149,170,19,225,24,2,157,65,40,143,57,164,10,33,177,30,33,169,42,16,155,81,177,91,65,
+185,155,39,200,1,1,219,17,164,200,32,130,27,34,44,76,89,157,24,130,153,146,152,139,7,130,153,3,232,147,3,26,
+114,224,24,9,179,40,192,160,145,148,144,192,149,10,65,46,58,57,235,128,65,27,17,10,153,35,180,136,210,160,112,42,
+14,147,145,174,17,130,160,4,232,1,16,178,49,58,47,91,11,0,88,232,25,33,184,33,146,172,166,163,161,129,184,75,
+91,184,81,130,234,40,135,26,128,160,43,32,26,45,121,139,40,144,128,4,227,138,50,210,129,145,244,145,146,160,32,0,
+141,129,2,1,20,159,9,80,153,40,9,170,89,8,93,40,154,152,128,133,1,196,12,136,150,152,164,195,144,16,136,72,
+128,168,11,132,51,41,234,13,49,137,130,56,15,42,91,27,4,178,217,163,18,163,2,239,1,162,130,147,161,8,45,200,
+130,67,14,10,41,57,3,203,168,113,25,80,59,12,57,43,136,113,192,144,177,179,35,130,206,162,149,145,162,0,15,137,
+161,88,57,136,44,24,65,34,144,143,42,162,60,73,171,201,131,10,4,36,143,146,129,176,22,241,8,16,168,80,41,155,
+128,16,12,21,144,153,34,217,2,51,252,25,129,45,56,176,26,89,169,120,0,137,8,146,170,19,149,159,2,8,59,4,
+242,0,128,136,157,251,75,0,3,129,201,135,176,136,130,243,42,90,138,32,40,12,8,24,58,176,242,2,136,177,64,49,
+203,61,130,137,68,184,12,44,160,9,16,162,88,168,73,97,88,15,9,146,58,128,196,9,146,211,16,17,137,178,33,30,
+96,153,142,32,153,24,65,188,3,162,200,135,130,136,145,152,80,89,233,136,56,154,65,25,153,148,225,0,2,180,24,128,
+61,58,131,174,136,150,8,130,178,8,193,10,104,129,140,16,45,44,1,161,15,129,17,44,20,153,128,8,157,135,41,10,
+42,138,48,65,251,8,33,155,50,48,159,129,152,91,49,28,91,137,145,35,136,159,33,184,24,149,244,0,160,144,49,32,
+31,128,160,64,0,208,8,145,217,132,162,43,130,26,93,48,11,0,146,60,32,214,27,145,177,18,150,185,149,145,12,34,
+10,168,146,203,49,150,205,148,179,128,150,179,8,146,138,96,24,154,17,43,30,17,249,144,131,200,20,144,10,57,11,78,
+24,144,32,42,42,120,226,8,1,192,33,16,140,25,12,75,8,162,64,27,154,68,240,9,16,160,121,24,153,72,138,27,
+3,180,89,128,139,112,162,157,17,194,42,149,160,57,152,142,66,146,9,50,172,72,146,250,26,162,170,6,0,44,17,140,
+57,5,138,56,139,28,5,217,27,34,202,67,17,141,48,170,12,6,128,59,152,45,32,1,175,33,177,32,83,185,89,9,
+234,34,41,139,24,27,2,68,253,1,146,136,19,136,30,136,208,32,17,153,146,0,163,23,249,152,2,169,36,56,31,8,
+168,73,32,137,16,137,129,6,243,11,33,139,120,57,14,9,128,42,17,136,57,169,177,38,244,10,17,138,89,48,13,8,
+162,59,33,176,57,194,201,35,246,137,16,144,73,64,170,144,180,43,18,131,128,131,241,1,182,171,56,0,77,104,153,136,
+145,154,2,148,9,146,193,152,149,142,40,49,61,96,152,184,1,30,40,40,41,129,147,25,211,143,16,24,43,89,145,169,
+25,15,40,25,72,194,3,169,163,191,33,16,28,80,128,168,72,140,137,16,177,7,147,179,180,240,154,49,14,57,8,129,
+131,9,10,123,10,18,49,1,57,243,159,48,26,60,24,177,18,138,152,63,139,210,4,163,147,166,218,16,8,139,129,149,
+105,9,32,41,153,227,41,1,245,17,69,0,0,163,240,43,74,139,145,5,44,1,1,128,211,1,172,129,34,65,209,47,
+26,154,162,32,137,138,23,195,129,160,168,216,50,136,114,141,56,43,168,149,56,193,137,132,154,180,228,162,1,33,57,75,
+156,10,146,156,96,144,152,3,133,152,149,160,26,144,123,89,9,14,162,131,46,128,137,136,194,148,128,147,11,73,73,123,
+1,224,0,1,136,27,136,200,163,146,150,130,129,56,76,58,25,164,249,106,138,160,8,152,209,130,194,51,153,64,74,58,
+57,40,225,9,63,169,129,171,164,165,129,162,21,8,75,11,75,168,145,105,140,73,168,164,168,164,180,147,144,7,26,42,
+146,145,56,76,137,25,31,242,130,12,152,146,1,58,17,154,3,166,145,81,152,129,18,172,135,17,189,147,130,59,46,41,
+59,136,96,47,24,25,8,145,240,131,10,240,129,57,138,146,17,180,130,64,200,18,209,129,17,240,40,140,216,90,9,144,
+40,1,80,41,41,73,40,187,57,41,248,60,209,40,44,144,129,147,45,64,136,75,40,192,27,16,167,32,241,1,60,184,
+8,64,139,59,49,153,177,131,183,160,133,163,67,200,61,160,161,46,40,154,42,106,0,17,16,194,150,161,1,17,28,189,
+129,11,14,58,137,40,40,114,179,178,122,145,152,73,43,137,186,44,8,128,157,88,17,160,150,133,43,136,34,93,27,8,
+27,40,142,64,169,176,152,165,197,162,176,165,18,25,4,161,17,122,41,57,14,152,11,248,1,8,185,128,113,9,17,33,
+152,65,45,25,16,192,156,165,8,176,151,8,16,160,67,9,226,57,43,171,48,14,144,146,61,146,3,143,40,9,60,24,
+146,79,25,144,48,176,164,146,225,196,16,200,145,170,136,131,41,79,17,41,72,0,0,144,162,194,4,250,58,139,209,41,
+1,42,16,0,120,146,146,177,240,161,131,41,47,144,8,41,163,15,16,184,28,129,151,0,193,134,129,16,43,16,129,234,
+33,156,161,10,155,166,131,184,135,2,136,50,156,26,131,153,98,141,46,144,9,171,151,162,144,3,16,32,218,16,144,177,
+112,45,25,16,141,179,18,233,146,16,137,33,42,156,19,37,114,10,24,24,185,184,242,128,188,197,144,65,169,168,81,2,
+88,59,162,41,169,2,131,192,176,140,251,48,173,249,65,0,156,140,161,193,127,164,72,58,153,9,169,49,192,4,200,35,
+90,138,185,138,0,122,88,59,136,177,72,30,41,128,9,13,179,90,184,3,148,29,152,25,178,164,2,17,240,146,149,25,
+16,43,211,16,41,141,42,15,144,25,162,64,0,130,99,138,89,138,180,2,184,180,152,108,170,2,161,139,138,147,145,148,
+120,78,9,161,33,8,16,65,202,132,136,25,188,130,28,168,129,27,65,2,120,179,169,6,1,74,169,167,25,0,138,169,
+72,174,210,129,25,28,89,25,148,32,59,41,43,130,151,184,134,26,232,145,8,152,16,136,155,89,27,133,129,147,88,13,
+163,135,9,17,154,0,89,58,12,29,144,208,0,137,132,145,0,197,131,136,33,242,48,10,27,63,45,9,128,128,40,90,
+74,24,193,180,129,177,17,56,42,185,181,156,16,49,60,138,171,0,147,231,150,128,144,25,216,1,1,40,78,136,10,137,
+57,13,128,49,156,21,8,3,13,24,153,169,212,82,41,148,160,200,42,30,10,129,33,89,152,20,8,210,152,154,63,161,
+5,17,8,60,139,201,144,210,0,136,146,165,9,7,136,90,139,192,3,1,91,16,162,34,139,156,0,18,143,41,138,19,
+65,3,174,178,208,18,225,5,26,177,74,12,160,10,43,56,49,165,2,163,64,29,9,242,107,44,9,177,131,57,143,129,
+33,193,161,152,178,56,17,34,166,112,139,32,141,34,218,165,32,153,128,26,144,72,44,120,10,129,145,24,60,169,24,235,
+0,41,161,33,241,177,57,4,8,33,186,121,16,32,49,123,163,61,15,16,9,145,56,176,148,240,131,24,13,40,43,217,
+131,26,50,172,29,193,161,8,135,136,8,132,25,19,75,219,19,142,8,193,145,128,1,73,160,197,148,34,45,42,176,8,
+25,120,169,148,180,163,24,186,197,194,161,49,169,32,1,228,2,40,46,76,136,208,3,138,90,10,8,152,0,195,227,162,
+18,105,9,129,128,148,152,16,3,31,145,60,9,9,129,162,91,25,106,9,141,145,170,183,180,1,0,128,185,60,154,94,
+152,132,8,50,171,18,40,45,129,14,192,41,12,184,57,27,213,148,130,20,161,0,24,176,74,138,25,105,11,230,32,140,
+130,128,1,92,42,137,169,164,82,27,0,156,130,171,133,146,192,247,61,0,1,241,162,145,73,59,90,161,19,43,5,30,
+17,42,144,148,13,227,0,11,0,161,32,133,88,152,16,186,147,159,161,145,73,154,121,184,3,12,89,226,40,176,48,160,
+56,178,24,144,79,168,147,137,14,165,74,176,2,136,25,12,35,29,33,10,64,141,18,168,17,135,42,199,128,176,72,11,
+57,168,89,185,1,16,0,16,31,136,13,4,165,24,128,184,42,154,50,151,74,162,120,26,17,170,66,248,2,152,9,24,
+26,89,172,146,24,178,128,131,234,5,44,12,40,8,129,129,168,163,165,159,166,60,137,162,129,19,43,10,25,23,41,193,
+0,92,216,2,154,171,130,160,167,96,136,144,5,136,146,164,75,42,153,74,8,143,161,128,130,1,90,11,136,186,24,108,
+144,44,180,182,131,129,160,151,160,0,25,64,61,128,77,26,8,43,166,178,161,163,169,137,164,90,0,165,144,162,33,153,
+129,190,149,59,15,58,152,26,167,41,25,148,178,33,137,77,176,169,4,169,88,9,9,178,229,133,8,0,178,216,64,138,
+10,19,10,196,164,49,200,145,130,228,40,16,31,136,0,136,74,26,176,227,1,0,187,32,129,120,62,144,106,44,0,16,
+10,48,186,165,163,1,169,40,64,167,32,122,201,146,147,177,177,149,176,133,146,105,154,10,73,44,27,41,30,9,234,1,
+168,24,168,153,21,12,64,9,0,146,25,82,43,19,136,165,1,18,21,79,145,128,160,146,48,251,2,41,76,26,163,10,
+227,33,44,219,129,8,147,90,160,9,128,67,187,123,1,25,163,91,17,40,212,65,42,138,17,190,194,146,136,62,58,152,
+29,17,169,16,226,50,0,155,90,240,136,16,152,44,57,202,1,179,34,14,195,8,133,170,108,161,26,137,17,43,49,204,
+194,149,40,24,29,17,17,218,4,178,152,195,5,8,35,92,26,8,64,24,74,57,241,9,162,177,57,249,147,195,24,19,
+204,56,177,41,20,10,5,200,112,10,27,136,10,128,169,26,151,157,3,163,27,5,208,32,9,171,4,139,120,152,8,56,
+141,148,200,1,160,24,146,159,34,41,176,72,27,112,42,0,50,219,135,131,152,89,160,16,0,233,128,200,144,145,25,32,
+8,0,170,114,44,43,147,218,88,24,208,5,25,137,179,130,56,157,163,129,41,5,53,0,206,0,193,160,0,187,151,148,
+16,160,177,3,151,32,60,128,43,172,163,187,9,95,10,177,20,162,34,227,133,128,24,135,0,9,145,161,34,43,47,152,
+27,74,153,171,97,138,62,24,153,17,184,165,75,11,10,24,137,57,143,64,129,41,160,148,135,139,178,198,57,128,45,168,
+164,8,240,130,16,145,195,164,73,26,26,1,76,41,152,104,9,58,44,192,17,48,62,25,164,42,48,79,27,161,161,176,
+2,241,1,42,25,137,120,76,43,91,43,184,197,162,145,144,146,41,10,26,106,91,59,42,16,41,126,152,212,226,148,128,
+8,0,152,129,136,74,25,154,146,176,56,168,242,17,8,56,40,120,74,63,73,13,2,145,145,32,11,32,186,177,35,217,
+26,0,155,179,241,178,1,194,215,166,178,129,17,143,16,8,168,64,9,72,10,40,57,142,130,179,26,58,46,26,121,59,
+45,9,178,227,132,138,16,59,208,2,160,146,136,211,17,162,197,147,2,8,185,135,32,74,79,42,8,155,150,168,24,32,
+155,56,11,130,217,164,67,30,57,25,41,26,168,230,162,211,146,8,0,138,150,193,24,0,59,59,162,25,3,78,106,137,
+32,8,219,120,93,43,25,152,145,144,1,155,132,185,161,179,131,178,7,1,56,215,120,9,41,152,179,162,163,138,73,43,
+12,128,0,143,35,157,57,26,182,61,145,40,176,133,0,0,76,41,138,160,198,177,146,163,128,153,182,182,58,176,56,192,
+149,152,19,11,146,147,241,148,176,88,58,63,11,178,3,14,16,136,129,136,113,26,26,0,1,9,20,128,9,166,243,194,
+179,49,143,16,10,152,128,146,64,28,33,12,73,144,8,138,145,43,33,111,108,139,40,8,152,130,178,40,57,29,145,168,
+179,179,129,240,151,144,57,79,168,136,147,179,57,161,8,112,47,9,128,145,2,9,107,41,0,57,111,184,32,177,128,10,
+145,9,40,30,177,212,180,147,0,128,16,153,112,46,210,24,144,40,26,152,56,146,203,146,165,25,16,45,105,43,74,74,
+140,150,9,144,1,185,165,128,56,154,64,154,59,130,242,25,162,24,123,153,23,138,32,40,137,32,152,17,26,138,41,15,
+138,193,80,185,126,58,202,132,168,32,26,208,18,227,32,128,152,145,145,9,3,232,72,26,112,1,62,0,123,232,19,186,
+16,1,208,76,145,0,145,148,57,0,44,138,26,47,25,140,179,120,58,47,128,8,128,179,32,40,225,144,3,26,147,128,
+112,0,124,44,24,138,184,146,26,44,137,160,66,168,65,167,41,1,108,47,136,9,160,32,192,34,153,150,177,147,176,197,
+178,211,34,47,144,1,25,1,185,132,139,210,128,152,105,184,133,178,20,63,9,9,9,25,153,148,16,146,151,0,130,185,
+245,195,146,42,128,41,41,146,24,17,45,139,74,172,145,0,72,167,167,0,0,145,8,32,175,162,58,45,73,10,40,11,
+242,211,163,9,0,28,9,33,42,1,57,60,145,145,25,0,248,182,151,8,163,148,136,33,11,72,160,40,122,144,105,27,
+152,209,163,26,1,193,196,150,136,146,74,154,161,137,26,76,41,33,166,0,163,161,203,242,152,128,92,9,88,10,16,10,
+128,153,149,170,149,74,139,4,76,129,1,136,129,11,31,42,30,73,169,0,161,165,211,130,161,179,165,160,132,10,8,123,
+59,75,0,43,32,201,32,145,77,136,145,144,161,132,29,33,63,43,64,47,25,8,137,1,176,149,164,177,6,184,149,9,
+25,28,25,11,136,166,0,132,60,138,18,141,169,211,226,131,178,80,128,57,44,152,128,156,25,160,135,144,150,163,162,177,
+8,171,74,187,60,183,129,113,0,32,0,139,176,176,245,194,162,0,32,76,40,0,8,160,28,141,160,152,147,131,41,151,
+134,40,161,168,12,44,141,17,75,56,72,41,1,161,228,240,146,60,10,24,57,40,41,33,92,145,128,15,0,137,26,183,
+163,89,26,9,74,8,152,59,219,129,120,9,17,92,155,179,4,136,195,0,28,153,32,8,128,51,46,10,99,128,153,160,
+224,155,149,1,168,6,216,17,0,131,41,154,96,141,40,192,165,178,178,163,0,66,153,177,224,225,128,32,8,73,210,194,
+148,2,16,168,139,224,208,148,0,129,162,18,108,59,40,42,141,232,162,136,129,181,131,72,153,1,64,105,44,43,28,169,
+146,129,19,73,168,59,153,68,136,217,9,139,63,79,8,144,3,9,153,130,146,147,243,144,155,243,147,131,72,40,14,138,
+17,41,72,11,224,8,9,10,134,3,161,243,56,76,24,73,9,140,42,140,176,82,40,128,161,240,179,165,62,246,79,0,
+4,26,28,11,152,24,81,56,137,40,156,153,18,7,177,244,161,136,8,72,33,10,129,185,217,91,147,196,162,211,178,161,
+35,34,64,43,43,223,8,17,145,104,10,169,192,131,146,167,131,152,169,153,92,32,34,152,186,46,138,136,120,131,161,210,
+178,153,41,98,129,138,171,8,15,72,17,49,62,152,169,249,148,18,146,161,128,12,45,88,76,58,26,154,10,184,1,4,
+7,0,12,42,44,8,64,16,185,77,11,28,90,48,40,136,185,185,200,180,6,128,162,193,241,24,24,88,41,40,185,224,
+145,33,1,131,164,187,171,136,242,65,67,25,61,12,154,169,5,40,128,185,179,211,133,35,129,138,0,207,138,41,131,167,
+148,130,153,137,8,227,146,129,161,74,11,46,74,105,137,17,176,163,168,34,166,177,197,161,211,43,138,66,40,59,129,241,
+162,144,48,172,53,157,1,0,24,47,1,128,57,45,42,202,40,8,136,146,37,179,244,178,128,42,25,152,127,10,9,1,
+129,48,56,9,74,187,15,146,73,216,18,144,12,91,0,128,24,3,12,0,159,163,1,183,178,145,130,75,10,121,24,9,
+44,178,201,58,64,0,137,51,202,203,145,151,138,5,10,50,13,152,3,22,59,168,201,210,224,130,130,131,128,112,14,27,
+0,130,129,32,11,170,184,7,147,144,244,179,9,93,58,0,128,24,155,136,13,33,10,167,129,180,208,145,17,89,29,16,
+9,137,48,48,77,25,74,216,176,8,17,162,40,88,171,168,61,34,41,48,108,9,143,16,2,208,1,128,141,57,72,2,
+74,72,14,170,57,1,59,8,130,249,128,131,2,1,57,241,203,161,100,145,16,144,26,143,1,176,167,163,178,184,41,33,
+147,168,150,153,142,129,37,25,34,248,200,160,148,145,3,8,161,186,134,18,40,26,15,172,0,16,6,128,162,185,226,0,
+18,80,144,9,172,40,113,41,8,217,194,10,129,114,160,131,186,140,129,5,40,24,60,31,42,56,178,166,160,154,12,80,
+32,16,26,9,143,40,74,57,41,187,156,161,84,32,58,170,153,153,56,117,89,26,12,10,92,8,24,193,145,168,8,56,
+7,8,138,9,15,40,80,136,40,185,226,144,132,16,9,153,208,128,131,7,145,152,9,15,41,16,146,168,197,152,160,6,
+61,254,78,0,163,162,160,9,201,112,18,24,139,168,251,16,34,56,158,129,224,1,2,3,168,168,250,73,90,18,170,178,
+176,137,58,55,160,161,240,136,41,52,10,25,31,168,11,133,35,153,176,9,141,36,130,164,154,145,63,75,120,8,10,138,
+155,40,34,3,138,161,12,137,113,148,0,13,30,9,56,131,33,15,136,138,56,131,20,156,177,250,2,49,121,10,153,200,
+17,91,18,27,161,240,144,64,1,8,146,12,11,120,129,200,3,171,232,24,19,179,181,160,182,9,3,145,136,161,249,138,
+84,0,177,41,226,168,146,149,162,74,154,45,57,99,184,153,130,155,153,115,162,8,192,144,144,39,163,152,12,57,13,33,
+17,42,159,27,186,39,130,179,168,177,170,120,105,25,170,194,152,88,49,0,154,227,9,138,64,147,128,144,15,75,56,130,
+59,47,28,11,90,146,146,130,176,208,3,36,45,137,42,186,93,147,144,185,129,240,1,20,145,208,1,153,28,134,129,168,
+56,188,74,50,36,234,8,200,193,148,34,26,57,155,184,49,22,185,27,241,177,1,99,168,5,168,192,40,18,153,211,178,
+160,90,89,10,41,192,152,152,39,145,192,24,10,47,16,1,25,9,141,61,50,0,184,25,217,30,0,82,153,18,200,26,
+74,64,139,30,8,43,153,39,144,131,168,137,92,2,160,29,44,26,27,52,184,149,154,216,16,6,0,154,16,156,176,23,
+128,24,11,136,63,130,130,233,162,209,145,50,145,9,161,160,47,35,41,158,26,200,1,20,134,144,129,171,10,114,163,200,
+25,184,41,121,17,138,129,248,136,49,17,14,145,176,178,66,1,43,41,142,186,70,162,192,176,179,169,83,18,186,167,161,
+202,52,1,170,139,179,188,37,51,196,18,216,185,149,133,144,11,0,31,40,16,152,57,208,184,3,23,170,8,8,192,33,
+67,13,90,138,169,64,4,192,160,144,200,32,36,192,0,18,190,89,49,9,142,8,209,129,132,147,0,129,219,0,35,128,
+141,42,140,40,51,194,137,196,249,2,34,161,186,194,179,18,120,8,59,170,204,33,23,161,168,177,208,58,21,177,1,144,
+251,90,33,9,154,41,170,47,33,34,8,145,250,24,132,1,185,90,140,75,32,24,11,131,191,72,18,160,10,130,186,123,
+50,168,46,17,163,26,71,0,143,75,65,153,136,25,26,29,51,210,9,128,138,62,113,137,137,42,26,140,7,16,9,128,
+155,25,22,144,160,61,11,43,36,73,138,41,175,57,65,0,12,129,186,210,21,1,27,16,159,58,96,144,137,129,153,169,
+22,180,128,145,185,47,65,152,42,43,154,202,23,0,32,57,203,168,20,161,0,75,186,30,80,0,26,73,218,26,50,128,
+187,7,184,152,67,32,46,41,155,141,51,164,184,16,152,235,32,7,137,145,165,187,51,34,157,9,1,173,57,114,40,25,
+130,234,136,50,128,30,41,59,15,72,0,10,56,138,142,32,1,128,144,0,204,40,120,0,74,9,45,155,35,129,60,43,
+240,193,145,149,18,8,2,174,41,42,177,24,133,29,144,2,150,146,163,212,209,24,128,58,41,56,202,40,11,2,107,17,
+216,197,145,144,195,129,56,9,11,195,80,16,1,178,63,158,162,161,129,148,134,152,0,161,9,42,2,190,40,108,43,40,
+149,130,241,163,177,1,161,148,59,13,160,145,48,121,195,64,202,176,132,154,3,152,170,76,98,129,42,122,140,136,64,1,
+27,43,194,139,57,39,185,27,180,170,131,124,0,28,56,155,149,2,17,154,10,34,154,31,19,169,45,145,156,166,8,180,
+18,13,0,129,160,196,49,13,27,112,41,26,16,137,185,153,4,42,176,51,223,50,136,162,80,15,136,162,40,57,75,167,
+9,40,176,180,32,145,30,176,32,168,128,132,200,11,115,43,162,128,135,176,144,146,32,31,10,24,107,40,137,9,27,107,
+138,80,137,183,144,161,16,32,155,6,139,129,124,25,58,153,89,203,0,17,145,17,148,9,129,9,23,209,11,26,29,91,
+18,152,194,73,138,26,145,83,171,144,44,34,141,112,0,59,12,16,144,23,26,193,156,128,42,136,57,83,137,8,0,131,
+95,9,160,248,40,129,148,17,1,241,160,130,12,41,8,66,141,200,2,8,163,151,195,8,160,146,160,134,0,0,143,24,
+44,146,120,24,137,27,10,153,9,6,129,9,136,32,47,16,36,202,152,186,128,82,134,130,145,171,140,26,33,78,24,9,
+31,8,17,49,74,40,158,155,40,179,131,53,224,184,137,32,93,2,17,160,155,138,58,108,25,0,202,153,25,39,105,136,
+33,188,170,177,133,40,135,129,35,51,79,0,153,152,178,163,20,9,9,142,11,73,24,98,137,144,186,160,20,151,147,145,
+243,201,136,19,42,4,2,10,29,153,80,25,160,243,170,153,20,34,16,17,161,221,41,9,4,17,19,240,217,0,130,16,
+5,25,14,153,25,56,40,104,12,160,169,48,66,132,145,210,187,184,16,98,44,51,107,13,26,16,74,24,24,173,170,162,
+178,55,17,144,176,186,12,49,50,121,0,216,139,9,150,3,18,24,159,139,57,18,1,81,174,26,43,17,97,149,146,152,
+142,9,56,25,26,130,24,174,6,17,57,10,168,250,185,16,36,42,34,243,177,107,25,25,144,66,0,186,250,16,194,146,
+150,16,28,57,11,17,136,8,170,173,186,23,3,33,20,137,191,128,72,154,26,19,97,30,25,1,16,58,140,242,136,128,
+16,41,33,157,112,26,138,32,32,58,41,213,176,154,150,144,16,1,163,97,12,44,8,40,142,128,136,192,56,151,146,1,
+177,144,80,13,13,56,56,11,48,144,27,154,135,168,152,180,163,56,95,155,40,122,9,8,18,43,25,81,169,154,194,210,
+129,41,153,115,8,74,184,130,173,161,10,34,224,135,147,18,141,193,0,40,12,32,128,194,43,32,75,129,145,214,129,208,
+145,136,50,139,160,106,59,29,81,16,146,16,224,184,182,153,24,90,152,65,146,40,13,57,139,44,170,80,161,52,219,18,
+161,146,44,18,158,28,72,146,25,122,139,128,194,179,90,130,41,44,58,186,78,26,0,169,52,89,16,161,26,154,48,159,
+128,11,8,79,17,24,16,76,128,172,234,33,130,136,165,179,241,56,0,8,138,16,18,168,240,148,195,176,164,179,184,147,
+50,19,175,132,72,202,155,1,48,88,50,151,160,200,131,176,144,65,1,191,25,16,150,56,129,140,219,24,133,0,130,82,
+248,153,0,3,152,49,242,160,26,97,176,129,48,208,157,33,17,137,24,133,14,43,1,129,26,18,1,173,124,32,137,9,
+129,172,137,67,130,42,107,169,248,1,65,138,136,16,216,136,19,148,43,41,248,13,50,19,12,25,210,200,40,81,137,16,
+10,235,40,51,0,219,179,176,47,48,5,8,144,186,27,89,132,26,59,30,168,56,23,8,152,200,200,56,51,122,139,144,
+201,74,41,129,169,184,234,162,39,129,192,177,215,205,74,0,226,8,17,149,129,8,168,42,114,16,144,138,129,31,32,81,
+26,139,184,28,64,73,136,60,26,155,18,98,11,138,249,138,33,7,161,128,161,224,145,35,193,144,161,232,33,20,163,169,
+192,168,27,53,149,8,185,159,0,96,0,27,8,59,15,17,17,57,27,159,137,96,0,0,24,26,158,17,2,154,24,189,
+10,104,19,136,26,154,202,57,23,136,2,156,208,18,7,160,144,161,201,48,6,129,153,185,203,65,22,160,176,129,155,24,
+100,146,136,169,220,57,84,16,152,8,155,46,64,145,25,186,249,41,112,8,136,24,10,13,48,56,43,41,218,14,64,16,
+153,56,154,184,96,33,29,9,201,10,96,17,12,128,130,186,96,130,27,10,42,159,113,16,136,152,129,200,17,163,1,12,
+186,173,52,131,180,168,147,189,3,69,10,162,200,171,82,33,176,26,177,199,18,1,184,243,184,169,66,149,136,136,163,224,
+34,0,185,3,185,191,23,131,176,136,178,184,68,0,184,16,250,157,50,5,155,161,147,187,83,6,153,1,200,171,64,21,
+170,128,33,240,17,131,168,144,184,205,50,5,137,12,130,216,49,33,186,25,184,175,7,4,168,137,145,168,18,7,177,16,
+158,169,18,6,137,136,137,160,32,7,128,2,201,219,32,134,137,136,40,216,80,129,25,144,176,236,18,149,144,9,1,156,
+121,24,152,129,178,219,34,38,153,137,179,186,57,22,177,64,152,190,74,97,153,152,2,153,29,51,8,40,177,249,28,81,
+137,9,56,169,12,5,1,137,146,218,29,49,17,27,56,218,154,34,19,10,35,175,28,84,16,45,25,138,170,2,4,107,
+24,139,158,66,136,137,129,152,235,5,17,40,25,224,155,20,161,161,2,212,169,19,32,216,148,195,173,3,19,184,65,210,
+170,58,131,226,65,145,202,88,34,155,0,2,189,26,134,41,26,6,203,26,49,144,26,20,248,136,64,8,138,6,184,155,
+97,129,11,130,163,235,89,145,160,2,181,203,33,34,153,16,151,187,44,48,8,58,55,13,139,50,162,75,16,169,190,81,
+152,16,1,163,253,32,128,0,8,150,169,136,18,194,57,20,204,138,98,9,8,3,138,159,40,162,40,33,197,217,17,129,
+161,33,132,159,152,130,130,97,34,142,169,33,144,56,2,144,22,36,67,0,191,41,128,72,56,167,217,0,24,0,130,134,
+154,169,9,1,113,17,26,13,43,192,33,35,137,251,176,178,81,131,150,170,0,153,160,65,4,156,160,17,56,33,23,153,
+153,154,243,89,16,136,192,57,156,0,165,130,153,4,138,0,192,149,144,32,31,16,42,145,0,2,172,215,129,152,25,2,
+91,25,8,200,96,137,193,165,129,249,148,162,18,152,160,24,24,0,132,73,160,175,1,25,145,195,210,28,162,35,40,35,
+213,154,153,133,212,32,9,168,8,132,168,135,128,138,139,163,50,161,17,242,15,128,33,161,32,240,176,165,132,162,40,44,
+28,138,36,152,20,154,128,143,2,40,138,43,233,41,18,21,160,128,242,240,131,0,8,24,140,144,144,7,8,8,128,169,
+43,7,144,144,153,241,24,33,41,209,40,226,0,48,73,13,16,201,0,3,83,28,40,155,154,28,20,157,72,10,152,120,
+17,154,163,160,152,12,21,42,200,49,241,91,40,136,42,16,187,128,147,3,253,18,185,9,3,7,154,134,0,26,11,135,
+45,160,8,146,57,1,0,75,47,169,57,161,43,194,65,184,3,181,34,156,120,156,34,29,129,42,40,141,2,0,25,41,
+9,15,165,128,0,59,209,0,147,153,199,121,152,40,42,42,186,146,176,32,163,97,9,179,152,196,0,17,175,40,196,20,
+29,130,169,180,2,11,123,163,154,211,130,25,77,129,169,48,56,143,32,16,11,212,40,209,32,136,145,140,36,138,72,32,
+139,141,0,228,48,128,24,208,1,148,33,10,76,190,164,16,41,24,9,169,14,9,50,43,153,210,42,187,70,10,90,154,
+182,10,67,0,9,3,209,1,161,132,161,152,136,29,72,23,169,4,153,232,128,50,173,1,160,160,2,149,164,194,24,193,
+154,19,161,60,129,57,79,121,136,136,136,196,27,0,146,25,129,211,240,67,153,2,9,216,128,139,131,26,144,13,146,25,
+121,57,233,165,128,144,80,10,1,136,0,138,154,2,95,8,24,61,232,148,129,137,49,12,144,128,49,59,185,105,9,61,
+72,28,209,132,194,0,80,25,152,2,154,57,154,91,25,59,122,154,241,147,152,162,96,10,58,178,75,56,155,168,27,41,
+63,62,245,130,136,146,58,41,137,161,146,24,60,43,145,47,72,11,242,129,242,233,75,0,145,243,33,145,43,17,144,32,
+0,27,31,59,76,29,209,4,154,130,17,9,138,133,184,60,32,141,128,72,123,44,136,24,144,149,25,9,72,170,178,89,
+136,153,75,92,25,76,194,1,145,194,1,136,217,145,0,11,20,8,51,123,106,27,178,8,240,129,137,163,11,133,144,57,
+162,179,58,125,26,60,168,131,152,193,147,137,162,165,162,24,114,201,1,57,125,27,129,9,160,179,24,49,249,148,152,137,
+129,0,24,80,123,60,147,41,193,226,8,25,155,1,178,139,7,146,41,52,61,27,16,172,240,24,136,72,154,149,9,3,
+165,18,155,25,59,143,0,11,41,34,12,179,135,1,128,128,192,212,140,34,123,12,145,8,64,32,30,130,161,145,178,137,
+153,144,232,16,79,43,51,171,5,8,185,131,40,235,168,178,148,136,6,121,75,27,152,152,2,195,178,9,163,203,135,146,
+160,64,212,25,63,9,145,128,131,16,158,88,24,192,2,128,193,144,209,34,77,9,130,170,11,66,27,109,57,136,160,201,
+149,161,147,34,31,155,33,128,152,21,0,43,31,138,16,163,151,176,211,56,61,8,40,27,160,178,188,49,85,137,65,154,
+225,177,165,130,58,41,25,142,42,88,137,48,1,202,11,160,166,210,151,1,138,152,40,41,41,120,8,12,29,128,17,8,
+164,196,193,161,0,0,33,48,241,153,43,73,72,41,74,169,186,184,135,5,40,128,9,251,144,65,144,24,43,136,14,41,
+49,164,194,4,141,155,33,3,177,16,128,173,28,81,18,169,104,242,176,16,64,144,25,136,208,27,121,16,10,57,56,186,
+142,131,167,177,32,161,168,24,22,10,136,105,136,140,26,49,10,242,180,146,10,133,16,137,144,148,160,61,203,34,123,9,
+136,194,178,19,144,195,9,194,165,177,177,64,64,10,94,43,11,177,134,161,152,148,16,161,194,144,130,89,27,41,79,42,
+58,176,199,128,8,163,25,176,208,18,4,0,153,26,28,57,59,246,178,32,144,162,162,243,24,130,148,170,17,61,60,72,
+154,244,144,33,136,163,193,177,17,131,151,10,24,41,47,72,153,224,147,56,184,146,147,224,152,51,3,159,136,48,77,57,
+168,209,146,32,193,1,138,132,14,10,34,144,41,113,59,60,29,227,161,16,8,136,8,32,99,254,70,0,104,200,41,128,
+130,8,108,57,141,180,3,140,136,18,137,8,40,154,36,189,182,51,44,29,153,145,5,42,160,16,11,146,167,153,16,194,
+211,27,93,33,185,131,18,171,136,67,251,177,132,153,137,128,39,44,43,67,153,232,3,8,138,32,248,152,33,2,136,0,
+1,105,156,45,137,165,147,138,0,58,41,115,208,168,17,192,129,84,186,43,25,167,25,137,147,48,16,177,242,27,3,241,
+161,122,153,27,35,149,153,146,148,42,129,244,144,136,163,243,129,50,142,58,3,193,10,32,153,73,177,176,41,162,151,2,
+2,175,90,121,152,153,0,144,40,145,242,0,131,181,0,195,155,90,65,12,169,19,10,24,147,185,211,21,17,146,251,176,
+65,33,12,141,177,19,33,184,225,48,131,162,225,171,91,135,152,10,40,41,148,0,11,43,112,8,204,24,2,146,153,164,
+41,106,65,171,184,51,177,175,89,144,179,0,164,163,145,36,170,25,121,128,220,40,32,24,170,137,166,1,164,161,186,117,
+184,27,121,152,129,57,12,24,1,152,128,66,194,156,28,20,10,58,62,140,36,24,155,34,3,207,136,3,210,136,148,176,
+72,66,28,9,36,232,154,34,128,187,18,194,184,23,177,25,52,169,143,17,2,156,0,0,25,152,177,161,71,242,153,49,
+0,11,90,192,0,48,170,43,114,241,144,33,162,154,17,144,28,80,138,185,39,153,10,114,8,170,129,161,9,0,179,62,
+48,157,139,39,129,28,25,136,61,161,144,0,37,220,144,67,9,12,32,177,58,56,172,105,64,218,136,134,152,137,3,136,
+75,32,187,161,116,171,40,51,155,171,6,178,40,182,162,43,106,141,26,5,25,12,1,26,40,148,152,1,179,251,25,34,
+25,47,136,161,72,16,153,48,98,252,25,2,184,129,132,152,89,40,219,130,67,157,9,51,201,128,0,145,80,177,195,41,
+104,15,137,4,25,10,0,139,16,133,170,18,135,234,1,34,10,28,178,177,89,8,153,90,34,248,136,34,192,160,19,11,
+44,146,208,32,113,184,43,96,160,138,8,178,145,135,25,41,33,185,203,38,8,154,43,173,5,17,201,8,37,248,25,49,
+9,155,131,160,76,19,11,156,35,215,169,33,130,184,33,56,29,130,209,42,1,166,15,41,129,136,16,194,39,240,74,0,
+8,6,9,13,17,146,143,48,129,136,44,129,136,80,169,186,50,133,175,16,36,154,128,24,61,56,8,186,56,50,253,9,
+21,168,144,129,12,145,151,26,48,48,220,25,3,210,145,176,208,18,131,12,33,150,225,9,18,129,10,136,216,0,5,200,
+2,19,249,137,50,184,211,24,169,80,8,129,48,34,246,154,17,145,136,24,13,144,7,27,24,49,217,10,65,193,144,0,
+218,35,48,203,41,133,193,31,18,128,59,75,152,73,16,216,162,64,233,8,48,210,48,27,154,121,25,138,2,89,249,128,
+17,16,136,1,156,129,49,143,16,72,203,24,65,152,163,179,185,20,169,61,9,135,141,8,35,28,1,128,12,130,163,11,
+151,150,13,16,146,153,40,184,26,48,48,31,33,178,143,129,165,57,169,42,8,165,57,0,68,233,29,1,8,41,176,218,
+33,34,161,120,1,242,28,0,128,24,136,184,42,67,130,128,23,240,43,16,160,34,139,186,18,105,42,8,53,171,158,147,
+192,64,1,140,162,1,42,193,115,41,187,89,10,137,21,193,153,57,169,49,193,50,10,76,124,168,24,88,169,169,131,200,
+16,0,65,42,135,146,27,50,140,155,43,90,15,161,32,129,18,48,28,234,178,128,129,41,29,74,8,120,17,185,128,132,
+185,26,184,250,4,164,152,176,121,8,1,120,155,160,1,147,138,11,3,160,231,17,128,129,120,24,43,62,129,168,136,161,
+176,46,90,216,148,18,137,162,0,41,12,61,9,193,176,6,1,42,32,243,160,160,128,160,62,144,145,112,75,0,145,32,
+153,186,27,11,210,42,149,17,193,81,64,62,16,152,137,128,26,27,78,160,227,137,25,3,74,89,10,136,80,42,219,132,
+129,141,194,162,147,65,178,129,121,171,146,58,91,187,179,163,108,48,40,201,50,226,187,36,29,137,33,28,41,65,144,83,
+152,73,158,128,163,169,163,3,143,16,129,106,26,145,169,49,179,31,40,195,195,1,201,73,25,193,32,88,60,11,131,171,
+50,15,75,233,48,178,1,51,136,29,45,12,124,128,161,131,139,58,203,36,146,8,248,17,146,176,178,144,31,208,23,144,
+144,16,184,161,88,152,225,8,163,209,129,67,185,41,210,40,128,18,137,137,57,140,208,56,167,153,65,32,153,248,148,153,
+226,224,76,0,32,234,18,129,128,137,23,128,76,26,136,136,138,164,187,22,136,24,136,132,27,160,217,105,195,138,131,17,
+122,9,45,129,18,12,41,209,176,146,75,137,0,88,141,33,154,151,128,73,136,136,9,151,136,42,178,153,176,51,68,200,
+80,11,155,4,42,186,185,151,164,226,18,56,176,41,34,29,188,130,227,8,132,169,26,149,5,168,137,8,146,74,106,58,
+26,16,14,0,0,136,175,4,146,218,88,168,147,72,128,11,128,80,200,96,147,153,136,136,153,138,67,206,48,193,40,41,
+130,20,143,50,12,75,169,90,24,24,29,16,32,187,5,26,137,232,131,128,78,41,170,57,17,162,63,145,168,161,51,14,
+74,18,155,8,115,153,208,49,136,168,145,211,145,28,165,136,0,202,2,114,58,8,192,16,11,212,24,25,136,244,1,41,
+192,18,18,31,152,2,152,76,128,160,47,146,136,137,33,32,44,136,176,77,33,152,10,123,146,178,48,160,137,167,28,170,
+33,147,208,160,0,155,151,25,147,151,128,8,48,241,17,10,202,2,76,27,64,146,128,30,161,128,41,0,192,63,161,146,
+9,18,211,45,75,27,8,121,0,129,129,128,164,2,248,144,147,216,154,17,57,58,146,18,143,0,182,1,48,10,210,61,
+139,21,61,11,160,147,15,40,33,1,148,145,40,47,155,160,58,157,172,48,51,6,1,130,163,138,60,168,168,13,15,152,
+48,121,132,161,49,8,204,8,74,203,25,74,42,160,151,130,1,129,160,25,145,89,143,8,160,24,139,6,145,8,42,135,
+19,169,234,27,137,59,242,48,57,161,164,133,48,147,184,250,0,137,152,29,40,23,136,0,20,129,241,155,169,130,156,17,
+20,2,91,130,56,104,128,188,170,43,218,128,115,32,136,128,18,131,112,159,169,146,129,152,48,2,16,248,129,21,16,160,
+28,171,187,85,16,40,3,187,248,26,36,0,241,129,10,185,57,64,35,242,137,11,130,82,129,27,152,90,31,25,24,0,
+185,243,162,66,33,208,136,152,168,154,115,32,156,137,137,41,112,7,168,144,160,152,57,82,17,10,153,45,58,1,23,188,
+208,162,128,128,99,1,43,156,8,154,49,23,200,209,1,24,58,97,8,11,188,145,25,65,7,168,177,25,9,58,51,29,
+201,138,217,128,59,187,69,0,115,4,1,154,169,192,16,133,131,136,202,144,15,50,65,0,218,160,14,24,33,65,169,16,
+202,156,35,34,162,1,243,234,24,80,1,9,40,172,157,25,84,128,24,1,171,189,18,5,168,8,152,218,10,55,130,24,
+16,152,207,16,2,24,128,136,232,169,52,16,179,24,241,172,41,33,50,9,65,249,139,33,35,152,75,147,191,9,37,16,
+154,149,201,170,40,83,128,48,128,174,170,53,128,160,197,169,10,16,55,24,1,145,204,155,66,160,129,179,15,139,82,33,
+40,8,160,175,171,37,0,146,1,185,142,65,33,137,145,145,223,25,134,24,0,177,184,11,51,40,89,26,129,207,72,147,
+32,136,241,153,25,130,2,67,92,168,155,88,8,129,144,218,168,57,131,23,129,56,250,138,88,25,128,144,170,144,81,64,
+131,136,0,222,26,48,41,147,193,43,234,149,33,146,160,146,175,43,135,33,24,184,152,160,8,146,133,176,177,235,92,33,
+43,161,234,28,137,16,49,49,161,243,12,73,130,88,41,188,129,8,64,132,66,41,240,169,50,9,64,137,188,128,129,66,
+64,128,8,252,9,32,160,22,41,143,129,8,25,163,0,16,207,144,35,26,20,176,29,9,161,51,194,128,18,239,24,131,
+128,20,169,186,129,25,89,25,147,5,223,130,147,24,132,200,27,137,145,50,128,4,134,159,16,163,56,130,248,136,144,24,
+34,0,107,211,140,0,163,58,149,184,41,1,57,51,216,67,176,207,56,161,88,147,201,57,144,18,49,142,48,241,30,16,
+160,81,9,185,2,26,8,146,154,23,208,43,49,128,98,136,187,130,140,32,194,136,100,250,8,2,136,33,170,155,1,10,
+2,165,77,5,218,16,17,154,35,186,28,130,9,112,193,16,4,174,0,3,27,132,154,46,8,41,65,185,32,5,175,2,
+147,40,163,192,90,153,16,16,13,57,180,143,32,145,56,145,248,16,168,32,130,218,34,226,29,48,144,65,144,187,19,186,
+2,151,138,34,243,45,16,137,98,138,139,147,11,56,195,26,20,242,25,34,137,23,138,27,144,27,49,242,24,64,251,1,
+129,41,131,155,91,184,25,51,157,33,132,191,3,146,57,149,170,90,184,41,35,155,64,178,175,3,160,115,193,168,32,185,
+48,83,156,17,226,76,24,144,231,252,75,0,82,137,169,2,154,17,179,30,1,249,58,57,137,70,154,154,163,10,34,144,
+40,129,251,76,16,42,39,140,27,161,10,51,184,98,8,191,4,128,57,148,186,44,160,41,67,10,52,153,159,147,178,96,
+147,217,24,137,1,4,10,19,249,31,0,144,64,144,184,16,152,35,148,43,19,252,47,8,8,20,9,169,162,25,56,1,
+10,3,255,58,0,40,6,153,153,184,73,56,144,33,35,255,17,1,73,130,137,156,200,16,48,8,50,40,255,129,0,41,
+131,176,138,141,40,50,32,35,0,255,136,16,74,147,128,26,186,152,23,16,16,194,206,25,0,56,135,0,9,201,136,32,
+40,17,165,234,41,24,40,22,129,152,185,157,25,129,37,16,171,29,177,136,37,130,153,138,235,155,114,16,3,160,153,154,
+31,136,23,152,8,163,156,25,129,21,25,33,206,152,9,56,134,48,48,251,152,24,145,16,115,136,155,178,72,42,18,133,
+12,171,138,225,8,115,146,8,26,11,217,72,57,160,145,193,180,170,53,1,72,168,24,221,137,89,8,17,50,192,218,1,
+9,161,6,130,30,27,25,27,160,23,148,27,24,170,162,84,40,216,49,139,143,144,2,24,26,136,0,128,89,38,168,24,
+201,14,155,135,144,16,146,8,25,136,20,73,27,172,212,28,41,161,18,147,130,218,8,227,16,48,145,162,123,193,180,0,
+123,24,169,34,153,155,148,83,184,154,167,169,138,24,163,49,115,43,177,176,80,186,6,241,129,170,72,1,41,133,1,169,
+168,170,30,34,32,128,189,135,27,75,144,1,145,152,146,43,1,38,135,145,40,79,156,144,130,9,16,24,122,138,0,161,
+29,18,129,9,184,133,141,132,44,49,156,165,144,140,32,97,152,2,168,11,249,136,32,24,115,157,17,41,41,57,49,73,
+171,205,48,140,48,146,0,163,76,232,16,106,169,50,140,130,184,48,159,20,13,32,136,56,137,24,1,185,22,48,159,193,
+41,15,129,40,4,41,24,192,176,75,129,153,20,141,147,46,57,57,43,60,146,158,40,146,76,131,128,145,172,166,8,170,
+19,180,202,23,75,128,9,136,152,10,88,11,147,123,169,56,28,146,163,74,144,41,15,64,149,57,160,185,232,168,129,32,
+163,0,151,32,41,146,56,184,109,171,107,12,167,233,74,0,24,144,1,196,64,170,80,26,9,161,122,194,162,129,42,219,
+17,184,20,177,163,7,169,5,232,148,16,168,27,177,25,40,44,112,8,8,25,88,172,121,26,57,10,16,138,10,28,48,
+47,57,16,95,9,25,8,24,58,144,31,9,160,92,144,1,48,153,211,194,164,8,147,89,128,11,212,17,184,178,194,152,
+163,243,49,26,8,202,212,136,164,25,136,76,160,163,18,145,108,58,32,142,133,24,1,44,136,10,242,1,24,92,27,0,
+176,148,40,91,24,153,9,200,177,49,137,124,176,146,197,129,57,58,24,33,172,165,153,31,25,168,167,1,177,98,139,1,
+16,145,128,61,170,129,250,147,147,28,180,0,217,133,9,34,9,137,177,244,136,146,136,195,130,177,35,1,41,113,136,241,
+10,208,145,57,8,161,35,242,33,91,153,50,162,42,48,234,56,61,186,196,178,3,130,17,0,149,112,25,15,57,13,138,
+17,136,161,135,136,2,137,25,112,138,24,77,12,168,131,152,178,1,136,2,88,176,52,56,159,61,138,178,67,160,32,80,
+171,163,210,195,34,57,233,16,200,161,162,130,14,136,228,150,2,144,128,145,192,152,212,0,107,42,137,146,180,128,2,169,
+74,128,226,178,19,79,44,152,178,129,3,41,147,33,187,198,146,27,108,46,137,145,1,137,17,26,193,165,146,48,32,12,
+107,139,171,194,50,47,56,176,197,131,8,59,40,154,146,240,178,163,40,44,129,194,148,17,57,74,131,165,152,225,216,128,
+9,147,9,167,161,177,2,16,19,166,181,164,138,31,168,129,144,20,8,196,148,144,130,178,243,42,74,14,178,3,152,1,
+43,11,122,8,1,4,105,44,169,160,178,49,201,50,152,60,203,19,92,42,112,139,163,193,160,162,147,31,1,128,40,161,
+105,136,128,242,178,146,43,32,73,217,145,32,156,2,162,112,212,18,9,24,137,192,147,168,184,147,242,153,135,137,149,1,
+24,137,137,25,78,168,25,147,146,224,149,168,147,195,64,74,25,168,168,134,13,152,129,8,194,3,32,30,42,162,196,65,
+176,82,26,154,176,130,138,77,93,25,25,177,56,42,169,47,1,209,1,129,154,162,176,199,196,131,48,12,41,184,151,9,
+24,136,57,136,192,195,212,73,41,10,0,197,64,26,9,0,218,17,71,0,144,194,226,4,9,59,12,212,145,129,163,163,
+185,196,194,146,131,25,114,154,163,193,1,59,76,168,16,74,154,42,126,44,25,160,16,24,0,44,145,0,154,35,49,108,
+58,217,164,243,16,57,43,146,74,200,136,248,32,24,10,182,2,0,28,26,42,72,15,49,137,24,26,153,216,149,40,123,
+137,24,168,48,43,26,145,241,210,148,177,145,48,57,243,130,17,42,25,108,184,160,169,130,72,123,57,61,176,177,16,26,
+120,60,128,9,137,137,121,61,26,144,133,184,40,184,144,16,135,129,92,10,9,138,243,148,1,0,16,136,170,147,88,9,
+24,29,9,176,240,3,109,26,9,40,153,130,62,128,144,25,181,179,144,50,11,169,243,176,131,163,164,167,146,208,196,129,
+40,154,9,3,2,60,93,26,136,120,42,57,91,59,47,10,128,24,76,42,8,184,17,44,8,92,59,16,137,244,145,145,
+24,194,161,164,2,60,25,25,43,162,199,146,137,40,136,176,26,57,106,124,24,176,149,162,160,17,42,184,166,145,242,25,
+27,177,148,211,180,81,42,44,137,146,16,12,131,62,41,43,24,92,29,91,75,26,128,144,42,10,16,43,92,145,57,25,
+25,46,192,151,145,146,33,152,136,211,192,130,43,137,9,226,146,195,122,43,146,56,73,41,15,75,44,25,129,168,162,32,
+74,0,224,2,243,145,194,131,224,130,129,176,74,139,178,135,179,33,128,193,130,192,131,8,60,11,47,28,57,42,122,90,
+42,9,41,141,56,44,74,24,184,162,198,24,58,160,162,132,162,194,11,200,194,150,196,1,8,26,152,178,51,49,59,38,
+47,184,177,150,9,75,26,42,153,147,32,60,170,5,219,195,151,128,1,26,137,176,150,136,2,122,137,1,169,129,29,106,
+90,11,8,162,27,77,26,41,73,128,35,30,26,44,136,179,147,148,160,179,248,193,20,227,1,160,146,184,161,167,177,48,
+26,56,136,210,108,9,42,9,41,57,144,96,46,44,169,129,34,155,195,151,160,164,144,130,40,25,148,144,164,164,26,202,
+130,27,88,121,137,43,44,29,162,146,122,16,75,153,137,27,178,33,179,135,211,211,164,144,137,145,145,34,169,41,77,172,
+3,177,1,121,40,26,60,209,72,56,144,93,9,177,161,195,136,64,43,8,242,9,65,0,229,128,195,145,144,0,209,194,
+132,16,18,47,43,152,145,9,112,44,0,10,26,58,45,42,122,128,9,179,128,14,24,42,130,3,1,16,44,15,178,229,
+147,145,48,171,160,212,130,194,2,8,25,227,161,163,130,105,43,128,185,51,156,27,171,21,240,64,128,17,13,41,224,130,
+27,62,145,49,136,161,72,128,109,138,17,25,131,91,156,9,184,32,25,90,74,187,33,45,42,89,124,25,136,8,1,31,
+24,26,75,178,1,144,130,143,64,168,211,180,129,0,169,193,162,199,147,164,1,9,137,227,148,1,26,1,43,137,171,243,
+33,42,92,59,152,73,74,41,31,16,44,44,128,40,59,76,28,161,177,50,193,129,168,33,143,1,145,41,183,146,210,164,
+152,89,152,147,132,136,48,153,240,144,180,168,149,64,28,169,195,162,17,58,123,24,136,192,145,73,16,79,26,8,26,136,
+74,46,8,41,24,24,75,27,90,31,144,160,48,144,145,195,49,192,19,16,162,167,145,244,161,194,0,177,180,147,8,24,
+162,0,242,180,162,164,73,9,186,180,145,154,0,39,41,144,229,129,28,48,29,32,27,145,152,91,12,16,8,165,132,88,
+154,90,10,9,128,192,132,160,243,128,145,145,48,25,148,24,228,152,195,128,163,181,18,28,10,90,160,24,40,160,123,77,
+25,154,129,24,29,42,61,73,57,16,90,10,89,138,1,243,130,152,136,192,161,179,195,183,130,178,24,210,145,165,177,18,
+177,227,152,161,25,18,88,123,24,0,140,17,31,42,41,74,42,26,30,57,77,42,25,56,137,88,137,26,41,154,9,145,
+195,2,161,0,247,16,195,145,195,32,8,154,211,178,176,147,76,64,130,15,147,10,8,90,47,0,177,210,1,137,152,107,
+40,194,132,194,0,136,176,134,176,150,162,160,0,168,162,8,167,146,74,152,27,146,146,56,110,60,28,9,168,18,77,74,
+58,25,9,19,9,31,25,11,187,212,160,34,152,50,149,151,129,178,226,161,152,170,181,166,162,19,17,48,164,192,240,176,
+24,27,17,2,56,43,195,95,41,24,168,168,90,15,24,56,74,44,8,8,5,138,31,10,160,33,104,160,2,152,185,32,
+151,161,42,228,144,128,33,209,148,129,168,32,148,241,137,1,170,16,67,138,136,23,138,40,115,25,73,0,35,251,27,73,
+12,48,17,137,28,144,158,82,17,137,44,10,142,16,33,24,9,17,204,56,21,208,24,64,202,16,19,186,152,167,184,40,
+7,176,8,27,248,1,34,161,145,147,234,26,5,1,155,144,194,44,81,24,43,91,139,12,115,8,128,28,153,171,35,50,
+74,160,88,173,16,66,19,202,137,185,29,1,4,105,11,192,169,134,35,129,184,233,176,136,3,7,16,28,201,168,129,22,
+24,128,138,153,27,33,115,136,43,204,144,34,67,33,142,160,26,108,32,48,28,139,13,169,112,57,129,169,200,42,41,65,
+4,41,217,184,27,5,88,161,160,240,128,24,4,16,8,169,248,160,4,3,184,197,153,155,18,17,38,9,160,185,242,65,
+130,1,11,139,143,129,50,153,2,242,10,153,23,1,144,25,218,155,33,133,130,177,160,224,43,51,4,148,24,217,60,47,
+33,186,216,3,11,161,105,18,128,20,170,189,40,34,52,43,9,190,144,106,129,149,42,172,152,144,115,144,1,27,138,185,
+5,120,144,145,8,185,154,23,41,177,128,184,179,56,5,202,160,243,168,161,39,149,152,152,153,161,33,37,35,158,193,185,
+163,66,132,137,184,146,157,107,131,128,10,160,90,30,32,88,145,46,160,24,59,44,1,137,10,29,46,51,89,152,25,13,
+145,90,24,48,29,160,40,141,32,56,9,172,138,243,32,16,133,154,179,144,15,18,35,176,170,129,248,136,34,135,128,216,
+144,185,146,20,179,129,232,144,25,83,16,178,3,143,11,42,39,128,137,27,24,45,41,68,29,129,29,152,25,67,16,29,
+138,11,74,59,35,28,139,19,175,16,72,131,208,139,181,145,17,122,128,184,212,128,128,4,1,192,152,200,128,129,38,129,
+200,168,168,155,7,133,163,11,10,144,8,83,149,25,184,136,140,25,23,162,145,14,56,12,0,4,137,137,10,220,91,40,
+20,136,11,44,57,170,34,135,177,160,27,31,73,131,1,13,26,168,16,96,2,185,128,169,187,177,112,135,160,185,1,178,
+209,38,136,152,0,201,72,19,112,152,12,200,129,16,132,4,184,193,153,11,57,7,8,139,138,197,16,34,129,163,251,16,
+140,131,150,147,185,144,232,17,72,34,200,161,184,241,25,81,34,153,186,43,234,66,8,2,177,186,203,60,82,204,68,0,
+122,67,144,11,169,179,179,116,144,2,169,139,29,18,4,1,234,153,195,9,18,130,195,42,224,156,48,51,22,154,186,8,
+193,40,39,8,168,12,138,45,48,96,152,139,58,9,50,50,160,189,41,223,41,112,16,153,152,44,161,130,37,164,128,209,
+27,187,53,19,195,176,232,194,16,24,5,137,184,177,15,162,37,178,208,136,152,16,49,135,136,161,200,153,164,22,25,176,
+154,28,57,64,73,24,28,128,203,40,113,40,156,59,59,59,43,52,60,41,185,217,122,80,129,25,156,10,145,131,6,130,
+192,225,153,25,64,148,165,154,160,136,146,4,148,129,137,235,153,80,5,161,136,140,128,42,98,144,136,0,174,154,33,7,
+131,184,168,136,73,90,40,136,43,158,155,148,7,129,168,0,57,136,40,134,16,154,218,195,40,113,40,171,10,41,200,50,
+73,144,29,144,30,45,105,16,9,154,168,2,146,67,24,40,47,12,139,25,7,162,200,177,40,75,41,120,8,0,186,242,
+0,16,129,144,153,74,157,147,22,128,164,145,184,138,57,7,146,184,211,161,209,64,1,9,40,143,168,0,113,0,153,27,
+60,59,57,104,24,138,129,189,0,66,22,160,171,154,194,195,34,20,26,187,24,251,56,120,148,161,157,8,128,129,36,128,
+192,1,141,226,18,34,33,141,155,72,9,130,33,152,29,42,173,137,1,39,146,202,9,58,26,120,1,161,169,80,14,170,
+146,23,162,9,25,59,13,0,48,27,128,120,216,169,178,7,129,152,128,41,139,10,18,1,146,185,167,250,129,115,16,137,
+28,32,25,11,80,33,156,9,16,191,77,89,24,137,9,136,136,41,88,17,42,154,90,143,42,41,134,129,169,178,129,26,
+88,0,192,162,9,213,168,177,23,129,154,9,128,198,177,131,48,201,16,4,138,141,49,149,194,194,1,40,160,105,42,24,
+12,128,160,173,8,120,33,26,14,144,1,26,48,113,153,42,29,152,155,16,71,8,138,28,9,162,18,152,134,138,177,97,
+12,169,49,131,161,159,40,88,154,160,82,41,43,74,163,156,15,88,1,9,27,18,8,185,122,41,17,30,9,128,204,9,
+112,129,137,153,146,149,136,146,5,169,9,64,200,168,49,39,152,200,193,130,224,179,147,164,128,137,41,140,219,88,32,137,
+185,220,72,0,140,26,64,128,10,130,22,152,32,120,200,168,0,38,17,11,8,105,137,137,56,183,129,153,178,169,188,3,
+23,178,161,45,1,155,136,115,32,185,41,160,217,12,98,18,152,143,40,24,40,43,50,12,12,74,185,225,40,105,25,186,
+136,32,2,163,106,129,0,157,35,170,250,148,21,179,140,9,131,161,139,67,129,251,8,177,209,139,34,23,152,192,40,8,
+153,49,36,2,28,177,235,248,130,67,24,10,31,24,8,152,34,149,200,2,9,141,141,48,4,144,170,48,56,10,57,39,
+42,59,14,16,187,81,66,16,15,138,32,24,10,32,240,177,26,48,30,30,129,3,226,160,24,32,10,105,41,24,171,33,
+172,200,74,120,0,42,13,32,9,24,24,48,8,125,12,27,31,16,16,24,184,17,160,57,45,104,41,25,136,25,158,40,
+81,56,140,91,136,0,153,48,144,9,31,74,12,61,57,2,241,152,128,33,129,32,0,60,143,24,153,144,165,21,128,142,
+9,33,128,40,130,1,248,137,208,136,9,112,146,176,176,33,128,0,48,113,195,16,152,10,236,2,67,24,169,58,43,29,
+155,5,163,136,197,128,188,47,72,33,185,169,165,130,136,65,130,160,140,41,233,138,132,7,193,152,8,40,163,18,2,138,
+252,144,194,177,2,113,129,185,185,4,180,145,5,17,224,152,131,178,241,129,134,129,170,8,129,192,195,131,166,128,128,144,
+201,155,7,130,195,168,130,0,152,57,133,128,210,24,177,252,16,80,129,170,58,16,177,176,7,179,224,9,49,156,29,32,
+6,169,169,1,96,26,48,40,152,188,18,163,26,109,104,8,170,139,32,130,40,145,5,218,138,80,137,219,33,135,145,155,
+73,40,136,169,51,180,170,131,151,217,27,49,149,194,177,149,177,192,2,147,176,1,33,240,251,129,35,146,170,72,25,192,
+129,6,147,200,1,20,172,140,49,135,168,169,1,33,139,80,49,140,15,16,144,186,56,116,8,155,28,32,145,8,36,162,
+234,41,24,202,186,38,134,176,184,32,17,11,73,49,169,157,147,243,184,57,115,144,153,11,5,144,144,66,130,169,107,16,
+169,159,33,65,9,158,73,40,26,26,49,137,202,1,32,157,63,72,1,187,154,35,163,145,120,3,171,172,131,213,216,3,
+35,144,157,9,177,225,72,0,17,176,1,115,144,224,128,129,11,46,64,32,186,153,18,34,30,80,48,11,11,32,224,186,
+16,71,137,156,0,1,184,24,6,129,169,193,148,155,74,49,167,192,160,162,149,9,32,2,144,29,1,248,152,18,22,154,
+154,58,73,154,74,34,146,233,16,176,140,92,96,128,154,10,1,178,17,51,16,232,32,65,142,186,37,149,200,152,40,40,
+140,1,50,137,173,51,201,185,104,53,152,141,43,56,185,1,96,128,186,33,146,143,29,98,1,168,170,49,168,170,131,5,
+153,12,20,217,250,130,21,144,168,40,48,138,137,36,33,158,165,179,201,59,112,32,28,28,128,160,136,34,130,177,60,18,
+143,142,33,163,178,177,24,130,137,147,135,193,10,16,212,184,90,113,40,156,42,0,153,74,17,16,187,49,8,159,31,64,
+129,160,144,130,160,26,81,0,8,78,56,200,187,24,39,193,25,57,0,173,0,18,1,233,51,177,170,31,121,24,11,136,
+1,152,13,49,33,15,75,56,232,144,1,5,184,24,128,40,204,33,32,163,174,19,145,202,45,104,1,169,144,5,169,137,
+50,19,170,88,137,215,200,1,20,184,24,57,8,249,145,51,160,139,64,17,143,138,49,18,202,193,97,9,13,40,162,177,
+10,51,146,143,43,5,144,9,43,133,200,43,49,164,129,15,2,193,217,40,50,144,160,32,215,193,1,80,25,137,128,129,
+193,186,72,121,145,9,0,177,224,147,18,133,154,56,34,234,249,56,73,8,29,58,26,217,178,35,176,161,27,33,166,188,
+40,19,164,168,8,135,41,11,114,152,163,128,19,160,187,147,113,151,192,162,148,8,77,41,25,138,136,1,152,248,161,48,
+17,26,162,160,199,136,106,0,24,140,17,136,145,142,40,57,24,211,161,164,202,3,93,40,28,28,145,2,193,11,91,18,
+225,64,25,137,184,179,89,137,10,74,120,9,139,91,0,148,169,49,44,240,129,130,58,27,58,1,148,186,201,113,16,75,
+27,40,143,168,132,149,16,136,130,57,9,31,75,8,148,136,26,9,186,27,180,23,74,28,40,176,195,172,18,82,136,57,
+62,27,203,162,167,164,128,16,16,217,176,105,40,27,9,41,152,154,89,134,178,179,24,38,138,141,32,24,152,138,193,177,
+177,124,72,137,209,131,41,8,100,13,71,0,29,139,7,162,136,26,193,145,43,121,16,136,154,167,178,137,26,18,165,211,
+24,27,152,121,32,0,25,59,41,231,184,18,17,200,9,136,146,185,98,33,136,31,42,104,139,136,130,149,209,160,131,136,
+24,17,4,170,170,97,144,159,42,99,153,160,40,211,161,129,134,129,160,104,8,153,13,33,145,208,8,40,43,29,148,149,
+153,9,3,240,153,21,72,11,11,32,187,16,37,132,153,184,147,240,232,17,50,137,29,91,137,136,1,134,145,168,19,225,
+138,73,2,176,201,164,162,152,124,1,160,153,35,137,250,56,50,169,250,130,195,209,18,49,11,10,56,177,156,62,35,177,
+173,130,162,242,8,7,144,24,74,129,156,41,65,152,155,136,34,189,162,38,193,177,17,16,143,42,96,0,11,137,147,216,
+144,52,25,153,2,181,235,73,56,129,154,9,147,189,17,51,148,11,123,147,203,10,22,147,186,129,192,208,89,0,34,186,
+80,25,143,44,130,149,161,145,152,161,28,129,66,9,112,137,154,139,2,165,176,147,180,193,45,21,137,144,48,19,240,138,
+112,40,140,57,10,217,162,20,160,129,154,21,184,142,104,145,128,0,8,153,28,90,146,26,27,38,152,217,136,35,136,169,
+113,41,143,91,40,10,25,17,130,243,26,41,1,169,163,181,241,8,40,1,75,61,73,26,172,2,17,24,16,73,185,218,
+144,4,136,40,49,40,143,14,25,130,198,129,129,168,60,72,128,145,145,98,24,139,14,64,43,136,9,170,242,161,150,2,
+200,2,128,136,156,144,98,17,27,48,46,15,41,128,129,179,196,148,168,42,60,129,144,132,241,161,24,91,33,27,72,25,
+178,240,177,33,16,61,28,9,202,164,20,152,1,25,74,28,155,32,167,165,161,146,11,59,75,48,1,184,152,40,30,47,
+75,17,192,212,146,168,152,37,144,17,48,138,73,249,9,48,90,27,138,152,240,2,136,19,168,227,32,192,26,9,37,73,
+8,9,236,0,56,17,11,20,218,163,145,220,33,19,178,91,168,202,146,7,128,32,57,41,186,204,180,3,161,209,122,137,
+12,56,17,136,144,76,153,67,172,152,7,177,144,147,8,31,89,16,28,138,147,91,136,10,154,135,145,193,147,161,44,88,
+65,45,9,128,0,128,142,9,2,152,195,149,150,9,75,0,168,138,133,16,44,40,61,25,133,157,9,34,137,26,7,168,
+25,17,200,129,32,241,41,49,235,168,67,10,58,65,27,171,114,136,176,167,179,8,56,232,10,48,8,75,107,152,168,128,
+130,24,135,226,145,48,152,15,74,128,128,17,160,200,48,200,8,113,152,168,146,7,172,129,4,138,131,65,13,58,41,154,
+41,197,178,176,135,145,44,75,160,24,136,213,0,16,8,25,72,11,153,168,135,144,128,18,233,148,144,136,24,73,60,8,
+17,159,1,33,230,0,40,145,8,26,208,129,9,8,122,1,28,10,64,160,240,129,147,26,146,132,170,176,177,80,57,226,
+57,48,90,250,145,40,184,66,16,192,240,2,153,17,17,11,98,73,136,14,160,147,136,129,163,13,160,166,144,129,165,129,
+9,34,175,128,181,17,33,8,143,25,209,130,146,147,163,162,57,249,43,123,128,1,56,143,0,26,11,22,129,136,145,180,
+185,62,107,137,24,17,153,27,58,45,32,16,192,49,33,242,143,32,136,74,32,176,10,42,25,61,17,25,170,81,146,203,
+240,165,57,56,200,41,131,193,97,33,186,57,76,154,172,210,165,2,40,138,152,211,169,84,40,10,74,16,171,143,129,180,
+145,35,179,46,187,180,65,129,128,50,123,13,28,26,146,56,1,164,10,152,212,1,34,42,168,17,13,143,27,57,122,1,
+176,137,145,12,51,134,194,145,2,201,143,24,2,32,105,154,10,138,11,120,19,25,160,3,251,12,1,148,32,81,26,28,
+139,153,98,9,144,18,160,251,138,2,227,34,56,12,76,58,12,56,0,16,137,154,161,31,225,132,16,32,218,136,40,138,
+88,2,162,169,17,8,191,105,163,66,145,224,160,194,137,49,33,154,148,8,154,175,48,75,42,135,161,144,177,217,20,145,
+9,66,136,209,155,9,40,63,148,179,178,194,241,1,161,129,20,160,151,184,1,24,27,20,164,27,186,12,155,151,147,3,
+1,138,249,13,129,129,65,120,10,41,155,169,19,144,7,146,136,136,190,160,19,130,67,129,29,168,141,59,1,149,6,130,
+145,145,175,128,145,152,37,8,137,153,187,120,9,169,38,146,16,242,153,168,212,17,2,0,9,130,202,9,59,10,134,0,
+23,200,169,26,242,130,49,43,19,137,44,88,27,9,5,1,136,52,68,0,128,237,144,0,171,179,23,8,137,56,12,58,
+46,48,24,2,161,159,161,25,28,4,181,0,162,137,29,0,92,8,17,41,161,15,140,1,24,20,130,16,241,128,25,25,
+59,32,128,37,205,139,152,202,21,130,148,145,164,25,9,62,29,131,24,149,27,201,0,156,132,25,145,22,209,129,9,45,
+42,137,19,38,137,44,9,172,1,24,37,160,196,145,145,31,25,152,24,7,152,26,138,218,49,0,146,50,226,129,131,31,
+154,17,161,39,136,46,9,185,0,161,149,24,16,17,1,173,88,152,227,51,137,153,154,211,171,151,24,57,49,12,212,1,
+169,8,162,121,17,232,130,152,200,145,121,8,8,160,3,161,140,48,10,161,39,177,30,9,232,17,1,2,42,3,24,205,
+4,13,177,129,21,25,171,164,12,185,21,27,56,147,193,133,8,154,28,18,153,39,176,12,185,178,152,120,32,89,194,2,
+153,169,25,169,39,19,50,207,2,10,159,3,41,144,33,242,129,16,170,73,0,1,145,19,159,208,168,57,17,75,34,211,
+16,43,184,142,128,131,121,21,184,138,153,208,41,33,179,98,1,48,14,160,152,8,3,122,145,249,129,10,168,72,25,179,
+83,136,41,185,216,24,43,36,123,48,249,0,10,186,40,24,165,113,24,8,152,144,27,141,64,147,37,217,34,141,200,1,
+9,3,48,176,146,210,187,58,75,16,39,67,233,58,187,176,89,136,50,90,130,152,10,156,138,168,6,4,56,144,15,208,
+0,42,161,65,162,134,25,1,136,153,208,40,72,57,3,252,128,45,139,16,26,151,65,8,136,160,186,10,11,98,20,130,
+227,26,171,186,137,21,48,122,131,153,163,185,138,145,108,0,84,129,170,10,200,170,24,67,25,37,193,24,13,184,168,241,
+149,195,71,137,160,161,218,177,2,8,32,88,24,40,11,123,29,26,43,58,133,18,154,225,0,137,160,66,8,164,163,16,
+187,241,128,144,1,66,112,155,181,138,136,40,59,79,178,163,19,42,13,209,136,160,17,24,133,3,137,240,26,140,24,33,
+163,67,75,1,31,145,80,9,128,144,42,145,15,42,155,90,208,18,28,89,152,65,27,177,74,161,74,186,33,45,57,57,
+152,229,41,136,30,17,8,24,144,137,128,228,4,29,32,10,168,33,179,2,56,9,63,0,235,226,129,2,59,224,135,0,
+145,162,209,56,25,184,149,56,145,178,234,161,172,243,179,3,32,25,130,225,129,56,233,130,164,130,144,145,158,32,209,210,
+2,161,24,193,4,136,0,73,168,114,169,163,169,212,8,146,194,177,130,9,152,44,210,133,3,32,44,197,146,33,56,62,
+154,160,26,140,40,181,149,176,210,178,169,73,3,2,19,48,15,160,25,13,80,137,3,146,185,156,227,24,152,108,1,147,
+14,176,42,144,73,74,19,152,41,41,143,10,163,136,83,136,57,90,157,104,25,138,81,163,80,170,41,27,153,136,44,18,
+26,132,159,129,47,128,24,162,72,45,160,8,208,148,16,11,66,165,160,130,11,10,248,168,81,26,58,193,80,139,24,59,
+155,100,40,40,155,197,10,194,128,32,150,131,196,136,194,145,164,129,148,28,25,145,169,193,129,73,60,216,67,44,59,0,
+248,146,184,151,8,24,176,20,208,1,137,136,161,66,128,1,141,56,171,185,52,105,24,146,241,137,152,12,88,163,57,106,
+25,14,129,10,81,24,73,24,153,185,21,171,0,16,41,193,241,178,40,208,41,29,149,40,4,45,9,136,153,128,34,47,
+32,168,209,128,129,29,2,192,135,176,136,147,201,149,177,133,24,136,145,145,31,17,137,144,163,225,147,42,243,64,176,16,
+65,138,130,163,226,16,200,3,11,209,145,48,15,176,145,211,192,20,10,165,144,163,42,11,33,26,151,33,57,44,172,58,
+16,46,96,29,8,161,43,153,32,178,165,183,178,163,160,166,161,2,10,57,216,133,162,33,138,165,179,209,65,155,23,154,
+144,9,9,27,177,164,32,137,160,183,0,38,47,75,137,144,24,57,143,80,168,8,145,178,130,129,197,2,177,9,43,144,
+153,167,132,184,16,185,227,177,151,74,26,152,41,41,200,34,56,167,20,33,170,245,163,161,2,46,144,128,160,75,43,200,
+146,40,56,75,73,192,18,154,3,233,1,59,28,3,240,80,27,8,138,210,6,9,9,145,226,128,136,136,129,181,20,41,
+156,212,130,152,25,200,132,73,177,105,161,1,144,48,11,4,145,36,171,15,128,242,137,57,9,179,120,43,154,177,145,5,
+40,161,39,176,128,217,129,42,200,80,25,163,160,24,153,175,1,196,130,2,121,160,176,128,14,248,64,0,42,138,169,71,
+43,0,156,195,9,160,40,149,7,16,0,0,58,143,34,218,144,147,1,58,209,208,131,139,73,58,161,146,19,107,143,163,
+16,203,166,16,0,1,28,56,29,145,138,65,227,3,42,209,192,162,58,141,24,8,166,25,161,57,153,176,131,151,32,162,
+5,113,59,42,154,200,4,8,147,140,138,179,137,184,172,39,162,50,95,184,8,144,227,146,131,89,139,128,178,123,43,26,
+138,133,8,144,80,210,136,152,162,63,176,146,147,75,58,16,202,152,66,178,179,130,57,175,182,177,7,58,9,3,209,3,
+45,8,168,177,51,104,29,152,160,168,163,44,154,49,187,117,185,162,122,168,18,58,160,57,145,130,165,26,210,156,6,145,
+76,32,47,138,168,1,201,49,1,194,56,178,30,1,240,0,33,89,128,17,151,128,32,184,19,220,145,160,17,14,176,161,
+137,15,144,146,243,18,13,0,42,144,3,43,80,9,161,42,148,136,18,6,136,135,24,0,64,186,135,16,26,200,1,43,
+170,91,155,25,248,56,152,130,224,144,34,40,125,145,32,153,51,156,149,168,130,4,13,16,139,178,30,0,74,29,1,154,
+161,40,186,145,56,44,122,9,176,195,180,130,59,168,21,136,44,98,156,144,152,130,152,202,245,16,152,41,241,162,130,72,
+107,9,16,200,34,60,161,19,169,23,40,40,46,184,163,178,129,88,186,182,193,18,12,10,146,177,7,42,33,156,196,145,
+57,42,104,212,1,144,25,155,168,130,24,23,9,48,234,177,168,0,58,95,144,17,153,58,29,154,163,25,81,28,163,169,
+16,123,75,177,50,228,34,152,8,169,161,243,194,67,13,129,160,146,152,59,226,32,162,2,56,10,200,242,177,210,4,10,
+33,169,212,146,16,24,74,228,33,42,45,153,178,1,12,33,171,4,161,16,138,122,170,147,183,48,42,12,136,0,131,244,
+34,24,34,192,163,144,91,188,147,163,137,168,202,65,13,24,12,125,184,131,180,16,160,41,177,3,151,9,88,185,40,155,
+48,31,92,194,161,148,128,184,195,147,200,83,26,146,0,152,46,28,145,12,149,0,40,14,178,129,18,0,24,167,145,148,
+91,153,200,149,128,1,9,128,243,130,59,62,137,178,149,8,24,154,179,217,66,12,146,0,133,40,171,178,68,253,61,0,
+201,149,43,72,145,164,136,12,169,128,165,72,48,209,131,216,57,31,128,1,161,64,10,185,146,139,144,5,130,135,33,120,
+136,196,144,56,30,42,152,19,152,65,235,211,128,136,24,184,23,58,8,138,144,149,24,44,61,194,128,128,168,210,194,162,
+130,32,131,130,160,127,26,10,179,32,44,16,11,226,145,168,192,130,145,193,151,132,75,136,25,1,42,145,241,149,16,32,
+177,212,177,211,2,10,177,16,164,209,166,176,144,180,146,183,146,145,152,178,161,2,25,165,162,5,161,250,163,209,163,136,
+196,179,181,17,137,43,161,153,134,208,35,24,48,241,168,130,11,170,227,135,144,33,139,129,144,3,147,59,151,19,3,24,
+203,243,160,241,18,178,128,9,165,27,169,80,13,177,3,128,43,10,185,168,240,72,16,51,152,111,59,139,136,74,58,153,
+135,161,49,45,137,168,109,25,42,136,129,89,11,160,192,5,25,9,90,24,145,45,138,27,24,98,75,209,150,161,17,42,
+42,193,181,104,42,26,184,212,144,129,137,8,178,81,24,44,42,12,40,92,11,163,145,132,45,155,195,147,128,105,145,2,
+129,47,168,24,25,78,73,43,41,139,25,62,77,9,161,163,16,41,235,146,16,137,40,178,23,73,24,139,194,66,123,59,
+24,138,130,136,46,10,92,169,0,145,41,177,224,163,27,16,156,135,0,73,153,16,209,81,59,45,128,161,146,44,154,168,
+65,140,120,176,3,184,181,210,33,153,123,144,57,136,16,29,161,180,184,7,160,146,24,61,144,144,165,41,26,78,144,128,
+57,10,17,18,105,140,64,156,130,8,8,152,130,248,147,184,193,151,57,186,56,176,130,57,27,52,91,13,146,132,30,25,
+26,130,42,195,24,135,12,193,144,162,42,128,179,39,241,131,76,186,133,26,227,32,25,8,177,164,33,170,120,146,146,40,
+15,1,139,0,12,17,60,11,33,156,10,17,79,176,49,139,149,42,152,48,153,7,137,211,8,164,160,179,164,213,131,76,
+169,179,145,225,19,138,145,0,233,132,137,49,59,242,146,88,139,32,12,131,41,185,21,106,27,43,160,195,211,165,3,0,
+47,9,169,16,41,59,80,44,57,139,44,12,200,49,161,151,40,192,129,153,132,43,229,18,16,25,63,10,168,162,5,17,
+183,36,70,0,58,128,24,194,130,163,15,201,194,161,145,152,29,168,63,184,133,9,168,91,144,73,169,148,179,9,52,184,
+82,25,19,162,64,72,210,16,10,33,154,122,8,155,26,240,130,136,72,45,160,163,192,229,16,136,8,33,91,137,162,49,
+160,152,108,232,130,144,32,10,2,144,211,177,129,219,135,27,164,106,8,128,11,16,189,17,88,155,16,25,176,9,40,124,
+240,96,26,137,41,161,42,9,16,17,17,42,123,30,177,145,208,133,41,224,56,153,0,25,131,104,40,44,40,12,128,131,
+11,24,179,50,81,235,167,107,137,160,179,148,152,163,136,10,139,166,150,40,41,132,178,10,144,151,158,147,192,212,130,144,
+16,160,1,9,148,129,3,143,42,192,57,155,23,139,5,161,0,32,217,121,153,136,9,8,152,35,30,18,145,160,149,128,
+232,33,218,148,128,138,35,57,44,3,44,80,160,47,28,144,47,194,33,152,40,41,64,155,134,144,10,90,155,74,136,136,
+52,15,2,128,136,130,250,136,194,128,129,1,123,128,0,48,30,2,138,153,144,248,2,184,167,147,153,131,129,76,128,161,
+79,170,131,61,161,2,128,145,194,49,78,144,34,143,161,128,137,146,0,66,170,33,61,224,4,25,152,1,140,0,168,113,
+152,18,26,224,72,28,130,25,168,8,29,168,166,0,145,50,31,192,35,29,145,17,154,129,185,17,152,128,20,136,132,153,
+232,92,0,72,139,123,138,240,2,9,1,24,162,40,138,44,91,149,57,11,8,140,211,56,25,133,138,166,43,152,72,42,
+135,168,1,137,160,120,201,2,16,242,129,153,17,29,17,16,160,90,140,40,28,8,49,129,34,159,210,129,161,5,136,2,
+13,185,178,42,75,164,133,1,216,9,61,160,120,0,130,43,170,248,147,145,17,131,168,145,139,155,83,31,134,129,160,0,
+143,8,1,90,145,131,152,208,160,146,136,96,56,165,156,226,145,136,149,48,40,185,160,192,75,180,48,131,36,158,25,157,
+179,49,160,5,144,154,209,160,72,178,150,56,196,9,155,146,140,7,41,145,146,28,161,24,148,16,152,2,204,167,44,129,
+137,152,150,136,130,153,3,107,184,132,9,166,16,0,153,0,240,25,146,225,48,168,144,0,240,18,8,16,146,131,250,18,
+30,152,52,10,225,23,70,0,128,137,241,137,136,65,58,0,60,182,154,168,41,122,130,26,32,154,14,144,121,179,16,42,
+4,159,129,42,153,37,10,164,144,200,128,137,38,43,179,122,193,8,138,3,24,161,34,248,144,44,168,35,28,82,25,10,
+47,185,88,1,9,17,217,25,154,2,114,161,65,225,137,152,168,105,146,16,144,139,168,233,80,129,130,34,249,25,186,33,
+82,40,24,241,41,186,178,23,168,22,185,136,9,170,114,144,65,169,168,25,10,112,147,35,28,251,1,170,67,152,2,42,
+204,41,169,68,24,148,136,171,10,138,22,72,195,163,187,136,138,5,51,165,160,159,138,40,82,16,128,177,174,194,24,4,
+20,136,153,171,171,97,35,49,136,250,28,154,2,53,1,160,251,169,0,65,35,1,210,219,136,57,4,21,128,153,143,168,
+33,33,65,168,250,136,154,6,17,130,192,217,41,137,83,0,163,9,189,136,2,36,130,228,26,203,130,64,4,25,218,144,
+154,49,66,130,25,252,136,136,34,6,162,8,234,0,58,34,50,187,201,173,136,50,7,1,170,240,144,1,21,0,17,173,
+176,9,34,6,144,152,187,187,112,48,21,136,249,136,152,35,1,146,144,204,176,65,35,33,153,174,143,0,48,2,16,235,
+193,10,35,82,152,147,159,177,72,17,2,200,178,142,128,34,4,17,203,154,12,33,38,136,145,157,200,24,3,7,144,177,
+169,8,19,36,51,219,249,137,73,17,1,17,159,176,41,72,133,136,144,202,138,18,65,37,9,188,193,58,65,164,0,153,
+204,153,96,33,32,138,187,142,145,96,147,146,139,203,59,5,66,32,128,159,169,32,18,19,152,227,159,144,49,48,133,137,
+218,9,144,21,129,148,27,172,56,33,51,138,151,143,168,2,89,163,136,169,187,8,54,56,131,25,252,8,128,35,145,146,
+157,235,16,57,133,18,137,250,153,130,33,5,8,170,188,16,88,48,18,128,175,10,26,67,5,144,210,154,153,131,51,20,
+130,237,9,152,56,115,25,26,184,30,24,35,41,149,154,156,25,42,23,40,170,24,159,128,18,4,40,216,187,145,148,68,
+163,9,171,219,74,132,112,152,128,187,177,56,51,133,161,233,139,161,36,20,2,10,251,28,128,120,129,0,137,233,24,16,
+17,48,128,173,155,8,122,2,192,9,73,0,32,137,188,25,64,33,19,5,217,171,42,128,114,161,144,186,232,49,146,22,
+136,225,153,168,133,33,132,136,187,156,40,81,17,130,17,253,10,25,49,49,176,91,204,24,41,51,64,9,15,12,41,40,
+51,41,172,139,172,36,121,130,74,216,9,138,131,98,152,137,137,156,48,4,52,152,8,191,161,33,35,19,216,168,251,136,
+36,0,2,16,254,128,128,73,33,137,41,201,26,72,40,33,128,249,140,16,9,82,1,186,177,204,48,49,131,53,202,219,
+25,192,83,131,130,138,233,10,146,51,2,17,249,172,24,160,39,24,192,8,219,33,129,37,9,146,141,185,18,41,135,130,
+154,178,188,65,1,150,89,185,11,10,2,122,32,136,176,153,153,3,115,210,147,216,152,24,152,80,16,45,26,136,177,72,
+18,136,25,172,170,7,200,133,17,200,16,26,160,17,178,149,40,180,15,148,25,12,32,12,1,176,32,121,153,49,41,147,
+49,237,132,11,166,25,146,136,140,178,9,50,0,138,133,250,16,76,193,36,185,19,14,160,8,146,67,29,136,138,186,66,
+91,16,144,136,13,152,80,152,133,152,134,12,128,33,27,0,32,15,0,153,162,5,26,56,217,28,178,28,177,7,177,130,
+146,8,160,7,136,36,30,184,18,155,34,154,179,151,153,212,48,168,73,129,137,13,2,42,80,169,212,32,141,146,24,168,
+36,143,161,107,144,16,24,129,140,196,0,136,148,144,49,172,145,81,139,21,170,179,44,243,1,16,19,171,225,176,144,133,
+8,148,136,137,177,161,87,144,147,138,0,11,121,34,137,154,184,157,145,89,163,48,189,161,137,104,181,18,152,19,250,106,
+8,162,139,177,14,146,41,129,135,169,179,184,40,151,17,144,49,158,40,107,145,24,145,186,146,44,128,22,11,194,136,44,
+165,0,178,40,249,0,57,165,24,161,242,72,161,1,33,160,227,161,12,150,0,144,145,28,185,66,16,91,154,209,59,152,
+19,82,137,26,186,15,66,58,44,160,145,143,73,185,134,8,161,59,193,131,49,1,72,160,169,56,208,121,138,128,169,40,
+63,9,40,161,128,138,4,95,178,16,140,9,106,160,2,161,99,139,161,81,10,73,137,233,51,185,130,180,128,156,243,42,
+147,56,138,97,154,8,122,8,8,168,240,16,96,251,68,0,140,129,17,17,59,170,31,148,16,177,49,27,184,121,57,58,
+58,242,152,2,152,19,167,9,28,219,17,8,128,64,163,143,64,8,43,49,225,25,154,226,35,146,21,73,187,56,157,147,
+123,129,11,154,49,156,148,2,35,169,234,32,9,167,41,233,17,141,1,25,3,89,169,34,175,128,33,170,72,169,57,76,
+16,120,161,5,154,25,45,146,152,168,166,152,8,4,73,17,136,250,45,9,33,139,50,200,137,32,149,22,17,145,242,140,
+33,11,75,49,187,106,9,144,81,1,179,189,184,24,224,50,130,162,74,202,41,120,19,138,142,155,144,24,35,134,59,217,
+24,42,67,66,161,143,185,162,8,151,3,152,128,28,98,26,135,44,154,192,58,9,164,3,32,193,225,178,164,129,131,49,
+138,15,8,74,9,130,165,224,144,162,129,35,104,186,170,40,13,51,18,145,136,240,136,1,59,52,41,175,9,2,188,20,
+26,200,162,24,91,132,144,21,170,13,2,56,242,2,57,219,20,138,1,161,200,8,18,234,107,129,240,1,8,130,24,144,
+162,72,210,41,195,18,172,162,193,24,17,145,129,90,177,60,178,153,183,52,136,152,68,44,156,24,200,128,161,145,143,178,
+129,108,146,17,9,24,155,40,194,16,145,55,159,152,81,43,147,40,208,184,136,48,28,149,90,153,18,45,154,113,24,11,
+16,9,141,0,32,187,20,168,200,36,146,198,32,194,145,16,165,24,26,0,252,64,138,129,40,194,58,184,32,12,23,137,
+168,16,141,26,66,10,60,24,185,162,162,7,156,135,160,144,34,192,169,48,152,43,98,16,129,227,242,129,129,179,130,161,
+12,15,27,148,24,1,1,242,1,28,32,72,128,24,11,154,249,131,18,34,178,9,8,14,242,32,2,42,15,137,9,1,
+74,14,147,146,180,164,144,169,40,183,128,168,131,143,136,128,136,69,9,128,0,185,146,83,134,10,145,139,170,112,59,27,
+22,136,61,12,185,48,41,163,60,90,25,152,11,165,226,19,129,66,29,161,41,24,72,200,35,158,153,25,177,73,19,243,
+33,217,17,16,134,138,160,178,158,40,160,145,17,196,1,170,212,128,21,107,154,56,186,194,121,160,16,131,145,25,132,75,
+30,32,168,185,34,219,24,166,8,25,151,153,0,16,187,6,169,253,70,0,179,9,106,169,168,51,242,17,19,144,225,41,
+152,72,1,152,137,137,191,56,50,73,57,2,140,158,161,16,7,184,140,16,201,129,52,201,33,8,192,14,18,16,136,183,
+41,138,146,47,17,43,129,96,200,129,25,21,152,152,89,171,154,43,165,41,160,19,250,35,140,36,128,194,64,170,152,26,
+41,40,55,137,177,2,90,177,199,152,145,184,56,19,26,113,161,226,160,57,134,184,193,195,137,208,130,9,130,18,241,8,
+146,100,138,137,130,202,137,0,21,73,56,28,153,123,72,24,43,184,43,158,17,26,17,32,31,28,75,34,129,201,145,209,
+137,72,146,51,3,42,191,36,74,131,224,160,168,184,161,68,42,49,76,235,16,18,145,243,9,10,154,74,17,56,152,166,
+233,130,16,132,185,128,27,159,1,66,32,154,135,25,184,67,129,160,171,25,221,146,51,152,19,244,136,136,2,65,217,136,
+45,201,32,3,164,1,148,193,24,121,1,8,13,153,170,153,20,164,82,42,144,28,25,99,40,157,177,193,154,129,64,56,
+56,29,138,76,17,41,157,165,153,10,40,32,41,21,34,15,177,98,144,169,128,24,15,128,104,136,2,153,208,145,80,136,
+178,44,12,169,136,22,128,19,163,173,128,120,24,163,26,232,178,152,147,36,16,164,241,10,24,18,18,141,168,146,159,146,
+67,136,163,210,11,28,18,64,234,130,12,168,128,18,50,4,6,233,161,88,144,0,44,169,193,41,1,131,22,146,9,15,
+27,2,128,153,128,15,170,2,148,134,130,130,169,152,81,48,177,31,154,184,72,56,2,36,43,248,8,28,135,17,170,160,
+25,159,16,131,32,179,40,159,193,35,24,56,15,169,208,24,16,130,82,26,242,128,16,1,3,216,152,10,15,129,3,130,
+151,128,171,163,96,24,128,12,171,210,25,90,17,73,137,168,162,0,23,19,202,161,0,158,144,4,0,165,56,141,144,98,
+25,17,170,181,162,30,9,145,106,11,145,44,26,8,0,170,177,47,157,17,74,144,48,123,10,41,80,0,2,27,216,130,
+43,130,23,90,137,128,9,169,37,129,200,27,30,169,129,17,3,72,160,185,42,112,132,181,11,233,130,44,1,40,90,10,
+160,24,42,55,9,192,176,27,174,19,33,128,132,44,158,129,122,128,161,138,239,242,70,0,208,161,136,48,3,3,2,243,
+12,176,36,33,219,25,14,11,144,68,0,148,40,140,144,122,41,177,27,192,209,16,73,130,65,25,184,58,59,135,48,157,
+184,41,15,0,65,25,4,18,170,145,67,41,249,10,11,216,1,88,128,40,11,137,144,80,147,166,171,233,146,29,162,20,
+128,195,163,154,128,21,73,184,60,31,186,130,49,145,131,89,141,144,49,131,3,143,184,177,47,58,50,74,168,226,136,137,
+22,16,201,0,60,186,147,50,17,7,1,156,194,33,33,133,142,160,178,25,25,166,72,153,194,0,10,182,3,192,162,60,
+140,145,19,26,2,63,11,179,56,33,168,15,169,215,32,25,128,56,138,208,34,75,40,50,175,145,88,14,128,130,160,148,
+145,11,178,130,133,163,31,154,197,17,41,128,104,136,193,17,41,16,32,156,241,162,60,25,128,41,178,212,40,152,129,3,
+225,89,46,185,147,130,128,34,9,170,180,2,50,0,143,171,246,128,16,136,18,24,192,48,59,34,2,223,163,177,61,42,
+144,72,145,179,17,26,112,128,249,0,59,15,128,146,24,148,17,73,136,17,5,200,57,30,202,146,130,8,3,25,28,183,
+146,4,176,45,11,248,146,146,144,51,43,27,5,128,48,145,15,202,227,8,17,137,50,42,249,132,128,17,32,15,168,178,
+58,75,9,113,153,177,20,8,89,25,141,193,161,43,40,26,42,181,146,83,130,48,50,253,1,73,140,129,178,136,147,26,
+125,8,128,129,193,27,25,241,145,17,27,122,42,43,131,146,123,152,184,24,1,13,40,160,201,151,128,89,8,184,150,128,
+152,18,57,47,160,178,42,193,129,120,10,160,132,25,169,18,44,11,244,146,9,128,16,88,128,128,131,16,21,130,210,227,
+144,42,45,43,153,9,131,209,17,196,133,145,58,29,208,179,165,144,136,152,1,8,148,18,17,113,232,16,77,153,1,185,
+161,169,146,120,16,128,166,147,128,184,121,8,192,195,136,12,0,33,24,130,24,248,165,145,3,77,27,41,155,25,147,145,
+113,56,42,138,58,215,165,8,129,26,169,48,169,197,178,176,8,0,121,105,43,41,59,61,168,149,145,211,211,161,161,176,
+148,129,153,147,177,129,49,37,121,42,128,152,162,181,161,243,192,193,145,195,164,164,180,163,252,249,69,0,178,162,24,150,
+128,136,160,16,14,211,16,129,145,96,11,178,167,2,40,45,27,137,149,89,44,8,27,43,46,43,136,41,160,145,2,25,
+123,72,195,131,76,59,27,161,40,8,47,139,26,60,79,184,149,161,196,40,0,57,57,25,160,59,240,1,153,195,40,30,
+9,42,28,0,3,177,18,106,62,0,88,128,166,227,163,24,176,33,153,128,15,184,147,128,18,145,166,145,56,9,16,145,
+218,196,8,171,48,46,209,179,160,177,183,131,40,160,195,121,45,146,16,178,135,137,144,8,57,154,162,153,249,24,26,196,
+131,153,8,192,151,0,178,34,185,132,75,140,162,7,42,179,104,140,18,24,8,56,241,136,152,73,42,24,136,67,142,144,
+1,211,129,216,136,176,136,89,153,194,163,162,19,186,39,144,180,123,200,2,155,151,48,58,24,142,161,128,1,57,30,0,
+152,40,89,41,77,11,227,178,180,17,153,244,162,177,128,17,75,24,1,146,151,129,147,129,144,149,208,129,90,139,129,161,
+210,161,168,246,179,163,163,10,78,176,33,58,144,65,26,0,123,169,129,161,185,199,145,9,128,176,34,209,166,73,27,17,
+224,199,130,128,145,16,8,144,32,27,184,145,1,214,162,180,153,217,165,56,137,19,127,43,43,25,25,28,0,10,144,161,
+178,131,193,20,32,139,22,89,75,40,43,58,176,136,72,141,179,128,194,66,31,106,59,43,25,128,42,183,144,178,167,24,
+153,193,130,153,179,50,92,59,75,76,168,83,140,8,26,169,146,128,43,244,0,8,0,1,123,56,177,132,228,1,8,11,
+148,140,178,130,44,24,162,3,27,147,199,163,79,137,152,33,187,164,33,30,18,201,20,138,32,57,175,132,26,29,180,24,
+129,128,50,24,29,132,9,32,250,180,0,27,48,12,131,148,41,72,27,18,30,25,189,177,178,74,60,169,135,180,24,1,
+57,10,182,164,76,138,138,129,152,132,196,57,128,26,42,178,134,162,47,11,12,164,32,24,181,32,137,208,130,17,2,242,
+106,43,10,1,58,64,213,8,8,185,2,0,32,164,63,139,224,2,136,195,133,25,128,160,58,46,179,50,142,194,0,60,
+160,72,91,42,144,145,144,195,130,182,144,59,62,171,134,27,150,0,8,8,128,17,10,50,24,236,228,0,77,255,80,0,
+26,136,57,89,27,144,40,218,1,33,56,56,63,138,209,227,130,145,50,78,10,137,8,153,66,144,97,29,26,138,144,179,
+167,147,0,58,31,136,42,2,16,8,59,31,136,1,42,167,147,178,177,153,74,31,49,12,148,26,184,144,152,1,36,32,
+97,29,217,32,139,112,24,8,139,193,208,129,0,133,17,41,10,12,46,194,17,18,162,138,244,26,43,161,98,40,26,24,
+170,75,137,4,4,168,215,8,28,152,129,121,8,8,24,154,137,2,121,72,152,163,28,170,144,57,32,18,2,14,186,218,
+20,76,17,72,60,13,209,144,146,2,2,0,45,137,156,1,3,81,80,153,42,186,11,5,160,7,128,12,144,203,49,40,
+18,50,208,15,168,41,122,128,34,184,201,161,138,49,147,51,24,205,45,184,43,55,73,76,169,0,170,162,112,145,24,8,
+241,24,10,0,4,129,147,60,31,138,18,152,131,146,136,15,217,146,72,128,35,186,200,17,47,121,9,33,10,225,0,168,
+0,165,1,58,218,56,170,25,52,42,123,168,137,168,209,83,144,128,177,169,8,0,113,163,133,48,248,57,154,34,162,163,
+137,249,136,185,50,34,43,22,240,10,137,9,115,168,6,169,168,146,169,37,137,33,194,173,146,184,82,133,41,90,142,129,
+9,129,50,153,163,251,161,144,64,147,66,184,176,25,61,124,16,9,165,170,26,184,120,162,16,128,155,25,250,133,18,74,
+8,201,128,168,120,161,2,8,172,128,170,53,128,25,151,202,40,170,120,146,0,145,187,145,192,66,34,107,152,139,186,135,
+64,16,144,129,157,152,9,52,128,131,216,15,9,136,114,152,146,144,11,24,107,17,128,16,205,10,178,64,51,12,56,159,
+153,165,50,16,8,27,221,129,146,66,168,165,137,138,168,97,65,153,148,200,43,128,90,133,24,12,168,11,164,64,161,33,
+186,15,152,164,37,8,128,169,185,32,18,100,26,177,174,168,2,72,5,155,211,153,41,17,113,145,0,219,9,8,34,67,
+10,170,174,145,34,135,3,41,217,29,16,41,65,136,139,240,152,18,48,25,147,248,172,2,90,35,44,160,154,12,49,56,
+149,146,234,12,41,57,66,211,145,170,168,81,1,37,138,193,143,128,129,20,136,9,139,141,148,82,0,130,139,13,152,40,
+74,251,70,0,36,10,208,186,137,18,97,65,153,243,59,136,4,32,177,153,142,137,3,20,147,41,252,43,25,32,133,144,
+201,169,25,20,67,161,33,191,28,146,66,2,28,30,169,146,19,19,151,41,187,25,9,112,130,154,10,14,9,51,123,176,
+165,155,1,1,72,146,10,156,62,10,3,3,8,243,140,41,194,6,128,168,128,154,120,16,24,59,249,9,130,0,20,138,
+44,232,130,17,146,19,138,186,31,8,123,164,136,152,186,2,96,24,195,18,159,0,1,32,18,140,152,28,152,36,42,148,
+177,175,8,193,99,9,137,8,187,36,32,104,59,240,26,0,160,22,153,26,176,8,34,20,80,137,241,25,41,59,7,27,
+153,208,40,8,17,129,2,207,130,41,8,7,10,144,170,17,41,3,1,41,239,0,41,88,145,136,8,189,83,25,145,16,
+144,175,180,17,81,152,10,176,154,66,48,65,177,243,28,160,73,50,201,1,171,31,32,58,147,147,243,10,128,24,52,137,
+0,159,41,177,65,148,25,169,15,192,49,32,184,162,248,42,72,64,24,43,241,27,177,49,65,184,182,169,152,131,114,130,
+0,147,143,176,56,146,181,17,203,25,233,51,9,0,135,172,164,136,17,2,59,137,171,73,184,7,74,8,241,90,169,17,
+129,136,164,137,136,177,97,144,129,1,250,33,172,51,42,26,161,9,181,26,69,59,154,50,207,165,25,8,8,145,130,137,
+163,64,240,5,137,0,91,155,18,155,132,130,44,45,193,40,9,195,16,242,0,10,145,120,137,32,154,194,17,8,94,136,
+144,0,176,16,136,7,24,65,28,153,25,161,147,160,80,140,158,148,26,131,146,243,2,171,33,59,33,73,232,131,152,15,
+24,145,1,40,201,130,240,17,128,129,123,8,28,194,146,32,32,28,129,157,8,177,26,151,164,64,128,59,144,157,164,131,
+26,160,14,211,64,60,128,128,182,129,160,58,128,64,184,165,145,147,143,90,160,16,9,169,108,224,129,130,42,16,136,140,
+148,27,51,47,41,194,26,27,179,64,180,34,9,132,25,122,10,162,162,234,89,140,32,42,139,135,138,210,2,40,24,76,
+136,185,130,144,64,74,29,130,31,160,2,25,180,48,185,155,57,41,4,196,166,130,46,168,131,57,185,35,175,148,9,3,
+80,8,17,159,211,251,72,0,16,176,128,130,152,96,31,168,35,60,195,16,160,129,139,112,153,16,164,144,14,161,48,10,
+58,110,170,163,136,3,42,75,137,154,243,18,32,27,150,10,170,128,121,8,148,176,148,72,0,56,161,243,179,61,139,25,
+131,152,105,10,142,2,26,5,8,152,24,141,128,150,32,138,177,47,25,12,52,185,4,200,0,44,10,5,160,226,1,42,
+26,133,8,8,140,26,10,150,1,18,41,9,161,249,149,178,1,28,184,16,24,96,61,211,0,193,34,8,59,43,240,41,
+147,32,155,241,72,12,137,72,146,9,243,8,11,18,45,148,27,195,9,42,135,40,26,28,60,168,2,133,1,130,146,31,
+180,1,146,40,175,146,11,24,20,60,168,11,154,66,147,36,11,212,10,169,50,16,230,56,201,57,44,179,98,153,137,184,
+25,73,133,192,151,25,153,131,74,128,137,29,193,25,164,1,18,150,154,146,193,65,41,156,146,63,10,49,46,178,131,187,
+51,186,55,140,0,194,1,91,169,72,75,185,48,15,146,1,184,17,11,153,91,178,2,122,157,147,130,59,131,61,45,177,
+91,163,129,35,34,143,33,168,73,162,188,135,155,0,120,12,129,160,144,17,9,67,186,64,242,41,9,195,24,0,184,123,
+153,17,33,241,8,160,74,9,16,164,88,218,3,58,168,4,139,26,241,40,129,137,52,72,189,4,136,90,178,137,24,233,
+49,74,138,20,10,156,163,72,32,242,57,145,12,1,184,161,5,59,47,169,16,145,146,58,164,175,161,41,135,8,9,26,
+161,16,81,9,1,14,8,21,13,66,58,177,64,224,56,144,178,136,240,136,0,136,129,164,25,216,33,78,195,32,152,200,
+2,193,28,130,98,18,123,218,161,13,130,56,170,166,40,18,232,132,8,234,130,16,34,32,30,168,153,168,164,24,56,154,
+135,112,9,152,1,186,2,155,170,39,27,34,141,50,136,26,112,144,28,185,177,30,146,80,42,161,41,65,169,7,187,91,
+187,16,134,42,129,144,129,152,115,25,40,159,193,25,56,56,1,147,92,186,4,17,1,244,137,153,24,131,16,152,240,8,
+30,33,132,17,170,186,11,33,7,161,80,13,153,34,129,17,24,252,136,138,19,65,160,201,160,136,115,1,40,25,251,26,
+0,49,50,189,160,184,124,131,235,19,77,0,129,160,193,200,73,16,73,145,152,170,148,121,129,137,178,72,170,138,112,153,
+130,154,10,150,32,91,154,32,43,148,143,49,153,2,225,9,145,89,128,9,74,185,5,143,2,25,48,161,200,65,136,163,
+129,229,32,161,171,16,192,121,168,25,57,41,75,8,32,24,96,172,232,2,147,24,194,155,81,139,6,169,130,89,10,140,
+1,17,76,178,170,121,154,18,131,28,156,23,185,25,128,32,52,171,216,0,130,67,153,217,34,197,10,141,66,41,48,187,
+27,72,17,169,17,15,18,197,155,145,150,24,144,137,60,132,42,144,11,73,165,177,175,32,18,146,161,186,105,179,72,241,
+41,32,67,200,171,68,176,2,9,159,130,16,176,8,11,64,4,244,138,33,24,3,202,192,164,81,154,144,74,129,35,169,
+175,48,178,35,27,175,129,19,193,194,138,52,149,9,173,8,4,3,202,171,17,115,41,169,145,33,98,1,238,0,17,145,
+8,170,75,18,194,162,192,56,21,24,241,140,48,17,8,187,186,65,23,169,152,9,82,161,192,142,0,6,128,154,169,34,
+49,148,202,73,73,145,40,250,60,32,4,152,169,28,20,130,155,158,130,131,145,40,252,0,21,9,169,144,25,6,9,137,
+44,74,19,152,168,175,72,149,161,152,152,32,6,208,168,18,16,1,10,202,31,48,2,12,154,152,19,38,203,136,5,131,
+128,40,251,44,80,128,168,137,137,19,2,219,90,16,1,0,165,221,0,35,9,153,144,62,34,138,248,0,1,8,136,2,
+223,17,19,153,136,170,121,50,201,9,16,48,144,152,133,207,50,131,184,146,217,17,51,189,138,33,88,128,130,250,12,96,
+146,152,136,216,35,146,202,57,25,131,148,0,206,41,97,128,10,192,25,18,150,138,26,0,56,40,226,205,33,19,8,232,
+168,74,34,0,170,130,37,147,56,204,143,33,147,24,142,186,5,20,12,152,56,40,163,176,249,9,115,137,136,168,59,65,
+178,192,0,136,34,105,189,138,82,146,146,170,186,23,17,58,142,0,145,21,184,156,88,1,2,160,250,32,32,200,162,26,
+73,56,128,223,129,34,17,9,172,9,19,161,1,186,214,5,130,188,41,64,25,18,174,8,0,33,17,156,10,4,65,248,
+28,129,1,2,202,155,4,32,96,169,144,35,117,15,66,0,52,250,138,18,0,32,168,175,32,60,16,147,154,19,121,243,
+138,129,147,65,152,159,0,0,1,147,168,131,18,241,204,58,32,72,25,208,9,128,17,54,153,43,168,83,205,137,3,18,
+37,208,10,24,1,49,192,27,141,64,211,172,65,152,65,161,154,0,144,145,167,152,40,41,39,204,43,1,40,53,185,185,
+177,152,33,6,17,136,17,244,175,33,16,57,146,203,10,161,132,5,17,185,132,113,170,169,50,168,80,160,219,18,216,41,
+17,41,0,148,23,172,25,145,149,21,177,176,152,187,123,64,28,16,59,10,191,57,136,147,17,185,43,137,242,24,132,50,
+3,74,20,189,77,128,41,98,8,26,136,139,56,2,24,151,161,34,251,139,2,138,98,144,10,8,171,157,5,57,25,1,
+67,137,239,146,145,48,3,194,136,184,154,77,130,2,19,17,35,255,138,129,128,49,57,158,146,200,9,65,1,18,0,48,
+200,223,144,145,130,7,9,26,153,202,32,129,104,40,11,19,218,159,0,2,65,129,177,144,243,129,48,1,1,33,15,148,
+208,75,9,24,65,145,225,17,156,168,21,42,137,24,56,180,243,46,41,136,50,137,154,129,46,43,165,32,144,176,18,195,
+249,40,57,156,7,153,9,146,11,123,145,128,145,185,83,128,249,25,8,1,22,8,139,144,44,49,243,129,128,168,80,152,
+200,44,145,162,113,152,161,17,142,8,4,24,145,136,91,33,176,222,129,16,88,1,170,168,200,130,21,0,176,8,74,99,
+154,249,25,56,10,4,168,178,164,44,106,17,1,161,250,16,34,168,175,145,146,66,146,186,60,155,2,38,144,185,136,92,
+65,161,249,27,32,32,65,138,154,163,152,129,196,67,11,28,17,33,162,255,136,2,105,129,154,25,216,2,21,144,144,184,
+16,114,128,202,30,25,1,49,176,234,130,8,57,19,137,11,181,131,3,176,255,1,57,136,4,137,154,210,8,105,18,152,
+10,155,51,54,200,175,161,129,83,129,185,44,139,18,84,144,152,16,42,4,2,252,44,41,152,51,168,219,131,26,74,50,
+42,43,153,9,39,195,207,146,1,90,33,154,12,177,162,82,145,168,33,157,40,22,203,46,8,0,50,211,201,16,42,42,
+53,41,141,131,136,81,128,191,1,17,27,50,138,158,161,177,86,219,68,0,50,65,43,64,186,152,23,225,27,24,168,114,
+129,200,25,26,139,54,0,154,194,8,112,128,205,0,34,11,20,144,143,16,161,25,131,145,122,0,9,32,177,15,16,193,
+8,34,184,9,10,159,48,83,137,138,136,33,7,250,128,57,42,18,148,156,168,179,89,18,130,30,24,24,2,250,15,24,
+146,128,130,192,41,73,139,41,99,137,146,146,136,5,219,177,36,27,34,3,159,170,211,24,82,162,138,56,43,164,241,12,
+72,8,1,2,249,144,16,139,48,5,10,56,128,9,225,15,42,179,146,35,211,170,44,169,81,98,152,137,130,1,129,143,
+176,7,40,41,178,13,168,177,106,40,145,8,138,2,0,239,162,3,42,65,24,11,202,136,28,35,150,145,16,17,136,207,
+168,105,24,40,48,203,208,0,139,50,83,8,1,40,154,251,28,73,8,83,41,161,160,157,153,24,115,136,17,10,136,240,
+140,0,163,24,36,164,61,11,128,28,16,2,169,6,17,0,220,185,49,13,72,65,168,160,184,194,128,40,130,48,121,2,
+216,141,25,179,0,4,7,0,136,177,44,128,153,2,1,12,120,203,176,34,168,41,61,165,168,32,2,74,56,152,185,115,
+27,32,45,146,32,248,46,42,27,224,17,24,41,42,243,144,25,123,2,59,138,4,140,145,123,177,16,1,165,152,161,9,
+25,64,155,165,24,164,155,24,141,90,146,137,72,57,10,122,42,248,132,8,182,128,155,50,44,144,168,179,145,44,145,9,
+35,149,195,73,13,177,16,184,132,50,58,159,145,0,96,32,1,177,152,7,145,157,195,112,186,21,25,169,138,186,97,137,
+145,34,24,1,10,31,24,227,17,147,16,186,168,31,144,58,201,160,104,41,240,56,9,193,68,58,185,52,142,163,129,160,
+64,8,26,28,168,76,152,4,24,138,67,16,47,153,162,40,10,142,8,57,15,12,34,43,248,5,9,40,42,136,162,52,
+45,193,42,59,171,139,165,162,145,24,14,90,176,5,80,154,183,195,72,41,10,138,146,24,24,0,42,138,26,145,93,24,
+180,89,137,227,16,155,94,59,185,135,128,11,49,140,162,134,24,9,24,74,0,138,158,16,61,136,161,179,24,13,104,26,
+160,199,131,128,152,105,154,160,132,160,34,41,11,21,74,40,129,41,33,180,46,61,62,0,90,241,25,15,154,179,213,147,
+145,136,47,128,161,130,160,163,43,144,131,30,58,170,150,131,146,106,41,57,9,134,226,180,74,160,129,185,4,28,32,144,
+164,132,193,2,89,137,130,157,129,138,161,120,140,56,217,148,56,168,19,139,165,132,233,17,11,0,27,149,4,177,88,28,
+24,9,177,147,59,15,184,12,148,43,8,65,11,22,142,1,8,24,131,160,31,193,25,32,60,9,136,130,165,107,25,27,
+2,178,194,132,172,130,225,130,121,26,73,137,180,8,147,2,60,243,40,185,146,27,148,25,128,65,31,137,129,8,148,148,
+172,164,74,8,89,27,164,161,180,67,169,24,57,152,72,61,251,160,180,8,16,57,154,211,149,129,9,33,154,244,17,12,
+145,27,181,163,17,51,159,1,24,152,163,65,251,162,58,152,56,185,151,0,1,80,170,195,49,217,3,29,180,141,164,72,
+43,8,152,179,36,153,130,43,160,243,44,160,147,191,135,16,26,18,155,149,16,161,2,40,240,73,142,1,42,184,149,0,
+152,80,184,128,0,3,146,249,180,27,40,47,56,171,135,152,17,58,161,138,164,17,12,214,0,160,40,26,40,168,21,195,
+43,2,136,16,240,64,249,2,9,136,41,10,67,46,161,40,169,34,137,248,72,172,131,171,135,128,32,138,112,11,2,24,
+147,42,192,148,46,144,43,193,133,41,169,18,11,137,112,24,28,153,183,42,153,57,137,180,166,0,163,41,136,26,114,24,
+31,184,17,155,40,91,24,178,49,241,34,176,147,138,163,124,202,19,138,25,93,58,25,40,9,131,185,4,25,251,48,15,
+144,41,185,129,112,8,16,27,130,57,165,89,209,180,73,153,41,145,196,18,91,137,73,10,40,141,32,13,228,0,152,17,
+10,178,148,8,129,0,58,120,8,138,79,200,129,176,1,105,10,129,16,161,32,216,97,8,128,63,154,128,152,180,33,9,
+136,66,201,20,192,132,16,224,64,13,8,27,160,146,145,24,34,57,232,162,5,136,178,18,63,75,60,138,33,163,161,20,
+137,144,27,151,32,250,177,60,155,123,8,137,20,137,176,66,170,67,139,3,45,240,40,139,17,78,9,136,33,152,9,34,
+0,184,167,124,185,145,145,164,90,74,25,25,152,18,171,84,11,193,80,203,163,168,164,130,172,242,71,0,42,43,113,13,
+17,137,147,74,217,17,30,145,8,179,149,146,1,81,60,168,17,178,57,15,227,57,186,16,152,212,131,161,149,57,10,76,
+136,1,140,210,72,11,57,137,179,166,145,196,146,8,56,139,37,45,157,48,185,149,25,40,0,1,243,165,194,130,24,153,
+104,140,145,58,177,17,91,176,19,156,34,185,182,147,177,211,47,136,41,26,164,96,26,18,28,129,129,165,162,139,198,10,
+178,2,9,28,1,62,16,40,154,3,147,229,137,244,17,170,17,128,144,49,60,107,43,43,128,180,193,48,159,148,160,144,
+34,74,152,74,136,177,20,0,112,171,33,142,177,147,8,180,121,177,162,16,152,107,168,34,143,146,60,152,136,152,151,0,
+0,179,146,130,6,16,57,47,137,153,144,226,17,144,33,184,176,148,217,4,147,176,43,170,93,29,9,17,216,149,33,153,
+120,153,164,152,180,24,186,2,60,10,121,27,129,16,178,150,43,133,136,168,17,242,144,8,26,122,43,24,73,176,20,186,
+19,194,226,11,146,11,136,3,45,58,76,106,136,1,129,48,56,66,240,177,195,196,8,24,58,75,27,67,13,136,59,16,
+25,40,141,201,193,229,161,33,41,60,77,8,0,136,17,9,44,177,16,175,178,8,214,32,152,18,76,0,25,25,74,162,
+56,241,49,175,146,0,176,19,42,72,107,9,128,0,77,9,28,168,1,203,146,164,233,134,128,41,32,91,8,1,74,161,
+48,15,129,13,145,145,136,166,146,152,145,123,136,8,75,145,0,140,147,29,61,178,43,182,147,57,144,32,203,163,40,17,
+136,175,165,216,8,166,40,128,181,48,169,129,58,200,22,9,162,31,145,153,75,177,4,130,180,88,141,128,9,176,49,18,
+33,220,145,172,42,131,1,7,165,56,169,89,138,129,64,2,64,249,24,140,138,35,169,148,133,139,145,141,0,1,73,135,
+40,144,30,138,153,56,163,67,161,225,10,184,8,36,152,39,42,41,204,0,30,25,3,24,182,128,154,24,9,4,146,50,
+120,42,187,47,29,0,2,168,150,153,154,24,8,39,137,0,24,42,204,74,28,48,20,153,150,160,10,0,129,52,200,1,
+41,9,206,74,30,8,132,153,130,136,12,130,165,19,160,28,0,0,250,105,12,0,2,185,165,162,139,131,216,229,70,0,
+129,34,230,129,16,41,202,123,138,129,35,169,147,144,173,147,133,72,192,145,128,19,152,47,155,178,120,176,1,24,171,161,
+7,9,212,16,42,33,128,15,129,1,122,144,178,56,203,146,64,137,180,153,41,3,57,191,243,129,64,160,1,75,202,146,
+34,153,181,136,1,36,153,159,193,2,106,178,144,42,185,58,22,160,196,128,40,51,9,175,161,17,104,162,155,58,200,145,
+23,152,144,144,16,22,27,175,128,129,96,145,185,75,168,130,36,193,162,40,2,114,136,157,145,130,123,130,185,27,129,145,
+81,232,178,24,130,49,26,239,129,17,57,132,187,12,3,24,18,160,200,74,0,133,145,223,16,40,0,148,200,26,104,152,
+2,176,161,16,4,32,137,239,8,50,41,1,186,15,18,180,0,8,232,129,130,152,35,237,41,104,137,16,152,12,18,148,
+25,128,194,1,36,186,34,200,15,121,144,0,25,188,33,17,138,145,242,145,33,178,74,17,175,57,150,8,8,185,58,6,
+192,136,146,139,37,137,169,83,250,40,49,169,16,10,141,20,162,185,131,241,49,129,201,82,193,30,56,145,9,40,219,1,
+18,186,26,198,17,17,184,74,4,175,16,134,9,24,137,26,51,177,170,129,149,50,193,29,66,250,11,82,153,128,0,141,
+33,148,170,145,133,128,1,155,81,177,175,49,164,26,41,249,40,19,200,168,3,0,16,0,44,19,255,0,35,11,25,128,
+156,36,180,200,48,177,33,8,184,89,244,28,48,144,27,0,186,33,23,202,152,150,16,57,137,16,130,191,33,6,137,24,
+184,24,36,242,152,129,0,10,148,27,51,254,25,66,10,9,145,153,20,181,185,0,130,129,18,189,98,176,143,104,128,9,
+136,160,0,6,169,160,18,8,48,184,90,50,239,16,34,11,136,178,27,68,209,184,33,24,8,160,171,69,249,10,98,137,
+136,0,171,21,148,200,16,128,17,130,192,104,160,30,56,130,138,144,240,16,33,232,136,1,136,1,161,74,96,189,33,34,
+170,136,212,24,34,209,138,41,0,162,164,153,52,251,28,113,137,8,128,137,33,164,154,27,34,147,152,242,81,225,27,120,
+145,137,24,168,2,147,218,153,17,149,17,171,121,8,143,32,2,152,0,227,145,50,208,153,16,4,40,137,90,32,191,24,
+121,242,76,0,19,170,178,147,154,114,160,218,58,5,24,144,40,65,251,29,50,153,152,2,139,33,19,207,10,20,161,129,
+40,64,216,15,64,144,136,1,168,17,131,250,170,6,130,9,0,72,137,159,32,131,184,129,225,129,18,224,185,19,34,10,
+48,106,41,206,56,19,160,128,180,42,34,211,189,80,16,195,8,43,40,251,28,66,160,0,160,153,64,19,159,89,180,150,
+152,176,42,145,31,32,162,128,18,28,10,104,204,1,33,1,1,13,40,25,143,1,147,154,179,160,19,66,250,9,49,161,
+132,12,88,24,249,42,33,176,128,56,156,48,181,226,57,145,56,44,138,50,0,15,64,161,41,45,9,1,131,188,15,20,
+26,136,152,72,128,174,161,22,137,25,227,8,18,25,152,49,72,171,128,63,73,251,8,64,168,24,25,9,4,211,136,25,
+132,42,153,144,114,128,143,64,128,152,8,216,130,18,202,144,4,25,10,8,121,64,173,16,19,153,152,193,58,96,162,170,
+89,72,169,129,59,4,242,29,18,129,138,128,185,49,151,169,168,98,9,153,40,57,181,143,56,18,43,29,176,16,36,216,
+169,97,26,136,16,42,129,253,130,50,154,170,180,24,66,149,171,91,0,136,16,58,65,241,11,66,176,192,1,140,2,135,
+154,27,18,32,28,137,33,105,143,16,20,154,144,226,2,64,184,139,35,130,25,75,140,32,240,28,81,168,168,2,185,83,
+196,153,16,34,153,26,200,120,144,155,120,162,153,26,194,130,5,184,11,20,32,28,25,59,112,189,16,5,176,144,147,43,
+90,194,138,121,16,137,160,145,49,243,30,56,144,137,73,153,146,133,202,74,130,8,24,177,82,3,175,40,5,139,137,131,
+41,51,232,140,33,168,208,1,58,51,249,30,81,168,152,17,137,32,131,173,40,3,128,154,11,120,4,191,32,149,154,32,
+160,128,53,187,185,67,89,153,8,73,66,250,10,66,169,128,50,143,17,145,187,2,66,185,56,11,67,18,255,32,144,144,
+32,184,16,54,187,168,68,136,41,25,41,84,252,128,34,10,136,145,140,33,144,156,123,146,144,129,41,56,180,191,89,163,
+161,32,184,130,35,236,139,5,136,16,152,33,115,190,0,19,152,152,165,25,88,144,170,32,0,179,16,77,120,241,9,64,
+137,136,128,152,37,231,74,0,40,3,158,136,132,16,26,137,56,6,175,48,149,136,16,184,57,81,185,176,33,18,161,160,
+123,1,251,29,49,136,176,3,15,32,177,184,161,7,1,152,153,133,129,143,40,146,168,41,171,17,7,169,169,66,33,194,
+152,3,81,207,1,35,153,184,211,130,105,152,184,105,24,146,139,33,74,241,11,96,136,144,8,60,8,2,201,42,32,19,
+43,137,101,178,159,40,4,8,137,139,17,37,217,192,17,17,11,154,33,52,250,140,35,128,168,8,31,16,148,169,26,22,
+144,136,140,3,213,13,72,128,24,42,155,17,133,152,187,51,33,25,140,66,52,223,8,19,8,43,178,44,2,180,251,41,
+33,128,169,57,81,242,11,121,0,138,8,9,146,7,168,136,1,4,137,9,66,131,191,58,133,8,169,242,128,49,136,156,
+40,50,152,186,72,115,250,136,65,128,153,144,144,89,130,187,186,38,128,152,9,6,148,175,32,132,144,27,177,25,36,193,
+216,33,3,168,169,65,114,248,137,50,8,155,1,141,32,132,249,8,3,129,153,160,35,146,191,89,4,137,0,216,129,67,
+184,154,66,1,200,194,24,66,250,10,82,152,152,145,10,104,162,186,24,20,144,162,11,120,2,175,56,148,136,10,216,0,
+5,168,153,34,33,176,160,125,72,218,136,82,137,160,129,27,17,165,170,57,130,20,137,141,88,130,175,24,134,152,144,160,
+146,35,184,13,72,162,18,168,90,97,154,13,65,145,137,8,176,130,7,170,154,2,131,1,159,49,34,207,24,19,152,10,
+178,24,122,1,157,0,1,147,40,140,65,130,191,16,135,144,137,161,57,123,153,9,25,40,154,164,202,4,3,207,32,130,
+160,9,164,152,21,177,200,50,73,24,145,187,113,151,11,89,128,169,35,169,10,55,185,137,34,128,32,208,13,36,243,139,
+64,160,9,1,202,48,21,187,41,129,0,20,204,24,39,234,8,17,0,25,168,139,34,134,157,24,8,33,136,172,81,18,
+236,25,34,144,144,152,153,100,8,139,44,16,96,154,137,34,147,223,136,5,144,152,145,8,96,8,170,24,49,136,228,136,
+65,148,156,57,5,152,136,145,8,97,144,141,41,145,24,145,155,53,226,157,64,3,201,16,152,25,82,168,14,1,128,16,
+145,170,68,242,155,81,145,153,126,244,73,0,64,138,0,7,153,8,130,154,81,170,26,36,250,138,21,152,138,2,11,120,
+128,154,40,153,48,179,251,50,165,143,24,132,168,25,162,144,50,176,170,148,50,67,202,137,85,248,10,50,136,29,16,26,
+26,5,201,8,145,65,176,144,2,167,143,0,132,137,136,146,160,82,137,203,48,16,161,134,161,67,240,138,21,144,137,32,
+28,41,164,200,25,0,144,35,188,131,183,159,81,145,137,40,153,177,4,8,142,1,0,32,137,12,21,174,0,135,160,8,
+1,10,80,136,169,57,24,8,160,192,69,250,9,67,168,169,33,11,81,128,11,93,9,162,128,136,97,248,9,80,161,168,
+40,59,40,131,187,92,130,24,49,170,68,243,14,72,145,153,8,136,130,3,202,11,4,160,56,144,114,193,143,72,129,137,
+10,41,41,49,248,153,50,137,1,160,56,38,207,56,4,160,137,153,49,96,185,140,88,145,25,16,42,20,223,24,133,144,
+136,160,1,50,200,202,81,0,10,25,8,83,221,144,22,136,138,161,16,65,145,187,104,16,184,128,40,81,250,153,83,8,
+170,16,27,88,146,218,41,34,160,152,9,51,246,140,65,128,169,16,11,32,22,202,27,34,146,24,139,52,214,139,96,145,
+152,41,170,0,38,168,141,18,1,9,187,96,148,142,57,132,152,8,184,152,68,161,188,34,18,40,219,48,53,191,25,6,
+8,9,178,136,66,177,233,16,32,152,195,42,114,234,136,66,137,168,1,27,89,1,170,60,1,128,144,13,81,243,139,65,
+161,144,33,140,26,21,169,138,4,16,0,240,1,4,159,40,131,137,8,193,168,37,160,218,33,16,144,130,12,114,202,136,
+20,152,137,2,171,113,163,186,73,1,145,145,177,100,243,11,96,128,138,16,137,26,3,169,29,1,48,128,184,75,151,143,
+41,133,136,10,161,152,51,144,190,17,64,40,128,219,83,218,169,37,128,10,129,138,106,132,170,43,18,32,8,200,106,148,
+143,57,18,153,26,153,136,68,176,202,18,147,24,198,137,82,203,138,38,144,168,129,168,96,2,170,91,40,48,32,188,88,
+179,175,56,148,152,25,176,136,38,176,204,80,41,24,176,178,83,250,137,51,152,154,147,28,122,129,154,43,48,0,2,156,
+96,178,159,80,129,152,41,200,144,5,194,153,116,224,73,0,1,48,56,184,26,38,207,0,20,152,9,145,154,120,129,185,
+59,48,48,178,142,98,242,138,81,128,137,16,138,57,51,186,15,0,163,2,171,32,23,175,40,4,153,42,152,26,98,160,
+186,16,33,24,193,137,7,204,8,7,25,27,128,153,34,147,187,44,33,65,160,27,114,251,42,5,168,136,146,154,65,149,
+11,25,0,2,181,192,23,188,57,51,170,170,133,170,81,161,185,90,19,137,17,41,115,159,8,6,160,152,129,128,73,168,
+216,24,18,144,26,74,132,191,64,1,153,129,192,129,37,185,169,49,4,160,193,105,242,43,89,0,11,24,137,137,22,169,
+139,67,128,10,24,97,205,144,36,0,139,90,41,59,145,170,47,17,17,185,3,18,223,40,133,128,138,145,40,4,139,141,
+3,24,33,203,72,227,14,34,163,249,17,169,2,3,234,8,3,41,128,129,107,204,0,51,161,13,8,105,41,128,202,169,
+39,137,164,57,8,142,0,135,176,128,168,210,4,136,169,136,18,76,185,4,184,12,120,144,144,41,145,9,132,178,138,2,
+135,131,144,49,242,26,115,184,161,24,152,73,50,156,13,24,145,4,153,150,217,152,98,160,153,49,155,105,16,153,59,8,
+49,163,217,83,236,136,36,152,138,161,41,26,100,171,44,9,32,25,160,96,249,136,66,128,139,145,0,91,19,172,75,89,
+42,25,160,108,225,9,49,128,185,17,153,2,21,192,43,145,0,121,153,65,168,31,48,16,138,41,185,88,0,195,156,148,
+128,145,50,28,16,207,64,0,160,59,233,132,57,162,155,24,24,25,4,90,122,157,40,32,193,41,216,128,17,179,185,17,
+9,133,18,187,114,250,128,97,136,9,26,144,49,165,152,12,180,0,131,176,67,201,157,80,147,137,61,152,2,146,215,136,
+146,8,16,194,58,89,219,40,132,128,11,148,25,3,163,188,163,195,34,151,44,25,214,137,49,128,139,24,160,41,83,201,
+10,211,16,163,56,143,135,156,17,2,201,16,178,145,20,209,137,145,146,32,1,202,68,190,145,22,168,9,147,139,49,164,
+138,152,128,52,122,200,64,209,168,82,0,139,72,154,26,6,169,9,177,34,73,200,74,2,175,32,133,154,8,177,129,39,
+193,160,16,24,104,168,56,56,250,10,67,153,43,144,27,34,12,24,67,0,32,175,129,25,76,0,12,56,243,140,97,128,
+137,24,176,129,133,161,9,42,93,24,41,13,34,159,0,19,154,136,161,177,35,183,144,57,77,57,57,12,72,200,139,113,
+128,10,41,136,25,134,200,25,41,24,72,154,56,194,175,64,133,169,0,227,145,2,194,9,72,136,91,145,73,24,172,25,
+23,153,9,162,200,18,198,144,56,152,43,18,136,56,240,31,64,136,137,128,27,0,135,168,24,179,27,80,145,136,248,10,
+113,8,138,16,11,145,135,136,43,163,10,40,150,128,250,25,35,130,156,1,29,0,134,153,43,1,153,18,49,49,255,25,
+36,169,168,146,10,20,195,8,31,16,8,144,105,136,15,56,17,169,137,129,160,7,211,129,136,32,8,200,1,214,10,80,
+8,154,16,27,0,18,185,160,138,21,34,189,66,250,152,38,160,153,17,137,40,167,136,42,138,112,136,27,16,143,57,4,
+168,185,149,0,0,211,177,130,24,66,2,143,48,15,74,1,138,9,128,128,147,228,145,0,137,35,177,27,90,143,75,148,
+8,29,144,56,164,178,194,164,145,20,161,169,21,159,56,132,168,138,179,0,19,243,184,2,208,18,213,136,33,241,9,35,
+152,10,1,29,17,130,140,90,153,57,2,217,88,1,159,32,130,138,136,176,210,135,129,152,1,10,2,161,12,98,152,15,
+89,0,138,8,211,0,130,176,144,147,176,130,163,43,112,24,191,112,129,154,146,195,136,132,129,157,3,144,0,66,12,72,
+40,220,0,3,209,146,162,12,34,178,200,66,184,9,120,154,33,90,187,15,18,163,144,129,208,153,23,177,153,17,185,2,
+4,156,81,130,249,25,51,154,136,138,13,36,129,14,40,9,40,25,138,24,7,180,234,129,18,185,4,136,172,121,2,10,
+75,136,27,147,197,144,51,160,222,41,52,154,136,25,140,104,1,186,24,180,149,0,128,33,34,185,234,60,104,41,138,61,
+138,8,17,210,163,144,152,3,193,141,66,18,221,45,80,8,41,138,192,130,132,144,169,19,152,184,56,194,50,122,137,191,
+32,150,145,194,177,9,4,146,144,168,16,37,128,157,81,56,139,207,146,7,9,137,128,136,48,162,27,8,177,15,33,27,
+41,21,241,209,24,64,129,168,41,201,32,98,136,139,33,12,56,147,216,19,0,42,69,0,163,252,11,51,178,131,143,9,
+57,65,10,28,8,128,242,148,8,32,146,241,141,34,147,26,25,233,42,34,144,224,147,176,40,17,128,66,164,181,191,48,
+36,184,137,193,154,35,135,144,58,144,154,82,176,25,89,11,175,32,51,160,209,194,177,49,19,140,58,180,201,120,8,152,
+64,0,190,40,81,161,162,40,158,8,67,144,128,42,154,90,56,58,29,2,251,219,67,17,170,9,160,152,52,97,155,40,
+171,128,19,232,164,166,209,26,64,17,10,152,184,26,65,33,170,48,159,178,134,164,57,74,192,189,49,4,144,26,176,154,
+115,18,186,145,210,193,51,25,144,17,248,173,49,50,144,155,128,203,10,55,227,160,8,41,3,2,169,116,129,159,56,49,
+43,26,142,153,2,19,8,11,153,130,58,199,17,8,164,255,24,50,153,136,163,200,73,18,145,176,200,161,5,8,18,25,
+152,207,156,37,130,176,26,173,24,37,128,153,72,137,50,58,45,66,243,157,0,4,24,153,160,184,0,3,115,26,9,10,
+10,40,244,128,6,203,9,81,145,144,146,184,44,80,56,9,137,42,210,163,149,50,44,224,171,48,5,194,26,10,154,49,
+21,144,218,161,134,128,43,128,33,16,205,141,120,1,25,153,152,138,131,164,182,136,137,148,145,146,81,32,140,159,57,65,
+16,139,201,161,162,65,33,248,146,1,144,51,12,75,105,217,139,8,6,146,162,59,171,160,21,130,171,88,58,44,57,26,
+73,17,242,205,2,50,8,209,162,128,201,114,0,24,42,24,44,139,149,162,1,192,250,138,34,6,138,25,26,138,123,16,
+168,168,130,195,2,8,209,7,146,201,140,56,51,128,186,59,250,192,21,162,26,42,193,1,149,162,24,57,233,10,12,80,
+19,243,128,145,27,75,162,8,129,0,75,124,152,56,25,8,185,242,157,19,18,27,225,136,144,34,18,105,57,59,136,24,
+58,161,39,128,158,217,168,35,132,211,24,27,140,73,152,73,136,194,0,51,15,32,131,152,225,216,26,80,146,9,27,169,
+146,179,50,65,2,239,130,144,128,56,88,26,88,29,141,1,18,128,193,177,40,136,196,145,131,18,61,10,58,94,145,136,
+161,243,232,0,16,162,148,161,169,91,80,25,25,43,168,1,131,151,152,2,57,213,161,168,3,0,66,0,137,40,0,77,
+89,26,9,42,1,148,136,41,210,245,129,144,56,24,74,139,218,28,16,24,167,147,186,128,146,213,1,16,9,73,72,26,
+32,29,41,171,198,130,184,59,176,181,131,1,2,62,91,137,0,25,121,153,193,129,24,81,168,144,161,197,147,136,28,75,
+29,43,1,197,130,24,8,155,180,151,145,177,0,74,106,32,73,170,131,194,146,131,185,57,225,245,144,2,57,28,43,27,
+91,129,162,153,128,136,136,90,198,164,24,145,60,41,42,138,141,185,132,145,166,165,128,11,181,149,8,8,1,154,47,56,
+25,10,48,248,162,51,8,13,197,130,138,18,136,153,125,136,153,17,17,208,228,129,9,9,195,3,139,177,4,72,91,24,
+9,64,187,212,133,1,42,186,148,56,200,180,32,74,30,16,26,154,177,181,152,91,64,168,2,137,242,129,48,12,10,112,
+139,136,131,178,24,33,142,157,135,145,152,0,26,41,74,41,41,168,184,165,133,49,137,240,180,177,130,21,139,75,26,91,
+8,1,186,165,200,152,3,245,147,0,8,10,74,40,73,43,12,170,3,134,24,153,146,243,130,147,164,48,8,159,42,49,
+216,64,193,145,1,132,0,242,160,176,164,57,41,61,9,13,9,132,211,161,1,216,145,182,146,1,152,10,88,41,59,93,
+144,170,147,4,160,8,144,244,160,2,148,25,32,138,58,29,196,194,212,160,48,129,180,181,180,180,145,146,0,242,129,9,
+176,7,215,131,144,139,59,43,24,9,17,32,64,93,107,9,136,10,60,66,76,8,144,11,145,129,42,156,180,154,66,146,
+44,184,243,24,105,144,162,1,169,197,24,57,185,132,146,89,12,25,193,24,0,136,128,123,76,129,24,171,11,57,77,57,
+105,138,164,56,73,161,240,136,129,168,81,12,145,131,60,59,72,192,17,144,62,24,219,149,128,90,138,0,27,40,63,41,
+161,178,48,60,24,164,168,167,128,72,16,153,48,44,29,10,29,1,226,73,200,0,40,129,17,29,18,28,74,1,47,9,
+26,73,10,153,196,131,208,129,45,26,130,128,61,74,26,147,132,33,155,79,138,180,9,1,144,179,153,75,24,114,30,144,
+41,136,0,179,73,228,146,8,16,74,136,40,26,63,141,144,162,145,131,40,59,2,165,42,16,15,41,49,156,13,62,0,
+63,77,152,0,40,154,80,144,177,0,74,15,179,41,180,17,184,90,72,162,171,196,18,136,47,208,1,136,136,58,184,4,
+57,63,73,44,136,59,57,128,44,196,166,136,8,192,145,48,58,11,57,63,169,1,121,9,25,211,149,25,130,41,169,49,
+173,56,15,17,43,144,72,25,15,160,132,26,129,171,132,65,137,130,91,121,10,136,43,129,179,194,121,138,130,9,1,19,
+24,123,186,49,137,31,12,1,184,167,40,192,19,25,42,14,145,41,201,16,136,50,26,151,137,16,128,210,167,41,13,144,
+8,192,148,136,57,42,146,114,41,144,3,157,197,210,163,1,144,56,58,47,160,129,106,43,153,161,170,197,149,144,8,8,
+96,57,184,123,9,9,138,146,72,32,129,248,18,137,32,45,32,176,43,210,129,160,130,7,60,8,180,225,18,184,136,125,
+137,24,136,145,161,60,57,75,27,91,216,196,129,162,152,17,43,168,212,7,136,145,40,91,29,152,16,243,1,136,161,16,
+0,8,241,131,184,57,75,58,40,202,134,145,48,9,228,136,40,140,164,177,129,9,17,107,137,152,19,244,32,176,164,25,
+76,59,226,163,130,32,46,57,138,150,161,129,128,137,163,45,48,45,137,177,166,16,60,139,193,243,145,164,57,138,178,17,
+122,27,16,194,195,24,59,62,136,162,2,169,123,145,0,171,3,251,129,244,130,0,25,40,25,17,8,90,45,42,154,176,
+7,160,145,243,130,9,8,89,10,32,138,76,14,40,177,209,130,147,0,180,149,40,74,45,137,56,59,33,169,134,200,154,
+167,147,41,42,128,226,25,60,75,9,193,163,56,163,164,169,130,229,41,27,168,129,121,59,168,160,149,164,57,176,177,187,
+122,128,25,164,9,43,128,114,196,56,27,49,159,130,8,45,40,200,198,147,146,57,153,32,14,74,74,41,28,10,129,12,
+1,227,179,151,136,128,128,74,75,26,24,64,44,0,194,153,32,160,162,197,145,24,65,15,0,128,129,50,139,130,56,159,
+95,137,0,160,146,168,163,35,219,146,242,48,138,27,115,154,92,9,184,147,180,130,138,33,12,25,80,74,160,57,10,47,
+24,72,170,179,178,167,27,18,129,186,151,56,192,72,137,138,163,129,142,210,148,145,58,177,17,209,151,48,44,138,0,24,
+137,1,62,0,47,0,160,130,16,1,224,147,1,146,167,57,24,30,145,42,42,77,217,147,128,8,178,8,168,194,33,120,
+129,140,194,162,90,136,185,166,32,12,59,176,120,152,130,10,0,192,167,34,139,168,228,32,73,10,17,59,157,41,16,164,
+130,241,162,16,27,73,169,35,10,171,1,53,56,15,140,0,63,138,66,25,24,241,184,148,146,145,66,90,44,75,8,128,
+0,177,184,17,113,138,128,243,59,242,48,140,65,43,59,58,4,64,57,168,147,79,11,226,0,168,193,177,137,177,128,9,
+248,147,25,12,178,122,26,48,58,128,104,168,135,145,146,32,9,2,184,150,17,48,15,24,75,144,146,128,140,170,24,177,
+97,144,211,153,146,16,132,131,14,209,40,75,40,65,11,184,58,113,41,11,242,129,185,165,105,137,58,155,162,61,9,129,
+9,9,162,44,137,3,147,119,128,146,76,40,210,148,9,184,144,147,137,159,164,136,11,152,144,136,137,93,152,33,128,24,
+47,36,33,60,42,164,48,58,31,176,40,27,211,178,50,43,0,151,145,8,195,181,24,122,139,168,135,130,16,154,33,8,
+217,226,133,41,44,27,8,145,178,74,47,74,153,147,184,195,169,144,162,216,164,128,43,121,76,26,34,43,73,29,56,28,
+17,4,40,193,128,129,169,243,193,136,16,44,136,182,162,152,40,64,154,48,144,74,174,136,133,24,154,229,145,149,16,8,
+8,153,184,131,120,43,59,73,154,26,140,98,139,144,28,176,132,24,93,152,149,145,16,17,169,146,88,11,91,28,91,42,
+184,161,227,181,0,144,131,145,152,139,17,15,26,58,146,23,145,18,17,146,110,0,179,56,72,147,35,15,153,145,178,200,
+163,177,25,159,29,92,137,25,26,169,9,82,17,224,181,40,25,10,57,92,169,212,161,0,56,145,170,179,49,59,63,121,
+60,24,152,147,72,184,147,162,162,249,194,88,9,28,26,130,152,17,165,8,34,30,154,145,24,15,1,91,43,42,129,182,
+184,137,16,11,47,40,33,134,40,76,74,16,57,74,146,19,169,76,11,210,41,170,225,8,179,97,138,177,128,160,168,206,
+19,92,10,128,146,147,160,243,129,152,162,224,195,149,0,25,40,43,15,16,161,34,12,185,81,25,47,225,2,144,17,161,
+150,144,8,8,50,1,59,0,136,27,60,44,33,211,8,49,105,14,168,163,225,163,144,164,66,29,137,24,192,17,26,0,
+66,44,43,4,129,73,48,107,56,41,180,135,153,160,128,156,249,145,16,16,26,41,58,201,24,248,196,144,145,1,25,0,
+242,211,18,59,152,49,11,136,79,40,138,144,18,155,1,5,129,226,146,63,139,180,0,12,122,41,26,10,132,0,154,195,
+164,16,176,88,76,194,129,44,0,42,193,17,184,151,44,184,166,8,9,8,58,25,123,16,145,136,182,147,32,17,121,25,
+179,24,195,148,160,169,75,249,1,42,9,138,139,30,44,11,104,137,195,2,176,144,167,2,56,57,154,151,128,9,164,185,
+162,240,241,145,58,138,18,29,41,49,161,34,74,197,147,57,28,146,192,8,92,12,56,12,1,17,3,43,32,244,74,28,
+128,184,129,73,209,177,24,155,224,2,56,57,80,9,60,20,3,72,74,146,20,16,49,248,8,172,154,218,57,73,10,226,
+129,1,161,137,7,72,136,60,13,16,0,201,137,41,136,9,130,151,25,215,128,10,24,40,27,184,35,104,27,138,179,19,
+2,159,0,23,16,153,195,34,44,32,162,9,135,170,187,172,81,137,171,58,49,122,26,57,121,8,210,136,132,58,168,129,
+130,1,201,249,120,44,176,9,32,5,74,161,21,1,11,25,17,177,90,42,13,139,153,210,128,177,195,159,167,0,169,24,
+33,12,25,57,7,24,154,178,147,13,12,138,48,42,109,58,131,163,47,211,129,168,26,18,177,16,47,8,146,44,40,89,
+137,168,2,167,161,130,17,36,170,95,25,152,186,42,28,155,250,1,2,129,26,67,133,128,25,51,32,168,24,39,50,143,
+73,75,216,10,152,133,59,169,4,18,153,42,19,181,144,63,144,180,8,25,120,202,138,194,131,153,13,88,176,130,93,41,
+129,169,48,73,176,43,61,0,188,128,122,128,193,144,49,74,13,29,20,136,129,48,83,129,178,244,129,13,169,179,195,211,
+176,179,0,184,92,9,212,17,60,62,9,152,2,32,43,163,67,35,32,12,21,57,11,16,152,121,128,109,12,152,241,163,
+1,10,178,128,24,179,17,130,145,148,137,192,131,147,121,24,91,187,224,164,57,79,44,136,129,154,130,160,149,177,146,8,
+243,128,163,24,176,198,161,73,172,239,72,0,240,148,144,211,146,162,89,24,137,25,9,0,176,23,42,139,60,130,42,109,
+25,153,128,17,170,38,29,43,11,212,1,177,133,42,200,33,193,19,24,172,42,2,136,182,50,106,137,136,243,130,17,15,
+12,1,16,0,144,28,0,184,242,113,25,25,25,160,144,1,129,131,75,110,154,41,152,165,152,10,155,134,148,128,26,25,
+244,24,8,0,163,167,9,8,145,2,211,8,177,120,28,40,137,130,154,170,146,50,17,111,201,48,25,43,26,151,9,145,
+59,42,1,185,215,48,139,33,176,182,3,211,185,8,6,41,179,44,153,137,16,67,10,228,147,27,63,57,160,123,11,8,
+32,57,184,137,151,170,168,34,80,106,201,144,0,50,11,195,180,178,164,27,56,123,162,202,16,42,146,19,140,144,215,136,
+144,121,145,128,41,25,73,105,24,25,224,129,144,59,18,137,168,15,8,49,152,61,139,193,182,27,128,20,133,177,193,128,
+50,92,10,168,129,141,149,136,163,128,218,32,197,32,136,57,56,152,175,77,88,41,168,144,128,24,129,161,129,173,180,152,
+131,120,161,57,160,113,202,34,1,154,182,232,130,40,1,24,243,160,24,57,17,143,131,139,132,0,10,123,168,0,176,24,
+120,170,40,9,180,194,146,51,179,168,10,212,50,216,132,30,8,27,162,56,214,0,176,129,131,240,1,56,90,138,163,90,
+88,10,136,160,128,185,21,209,162,59,136,73,176,121,10,138,104,216,162,131,112,28,24,136,168,32,147,138,168,248,2,16,
+129,168,176,16,213,2,162,195,120,13,58,128,17,153,164,34,25,175,16,19,8,251,1,28,1,34,182,8,128,153,193,167,
+1,154,90,136,128,2,145,0,146,8,250,139,68,227,42,76,138,176,20,136,193,0,57,14,130,243,40,40,137,0,131,41,
+18,201,1,209,15,147,128,25,13,9,72,8,196,177,33,45,57,248,16,65,138,145,52,41,60,138,176,149,200,154,74,133,
+154,144,40,137,178,199,163,160,48,14,136,22,139,136,132,2,26,43,130,192,168,165,143,49,91,153,24,184,24,42,23,245,
+144,24,9,34,11,58,40,1,73,216,130,179,184,23,186,194,41,21,48,204,161,9,83,152,241,128,26,18,136,26,34,184,
+73,145,42,202,73,7,12,160,143,18,50,140,51,0,74,0,136,169,33,91,193,32,143,1,130,145,129,164,2,64,45,171,
+40,21,142,128,177,201,18,2,19,234,144,89,194,65,27,57,152,64,26,178,7,185,10,146,27,20,143,1,160,144,234,129,
+37,152,161,90,171,129,129,67,249,144,34,148,9,147,185,24,142,148,184,132,0,32,193,250,16,41,4,144,143,58,200,22,
+9,8,9,148,1,179,130,146,26,46,201,16,65,59,29,144,250,8,2,19,233,137,201,80,33,145,56,248,8,18,27,164,
+170,76,161,0,194,130,2,168,210,174,8,38,145,25,189,73,48,130,161,128,10,150,16,153,177,12,176,90,148,42,20,52,
+141,216,138,112,136,24,184,200,19,17,17,196,169,2,24,2,44,122,216,26,132,169,16,16,160,182,220,130,163,50,241,137,
+48,90,32,8,154,202,166,3,26,171,194,40,4,147,251,49,73,169,208,128,64,90,162,218,1,136,135,56,14,8,161,17,
+136,139,131,27,80,169,163,17,23,155,236,17,33,25,138,28,137,134,165,177,33,45,8,144,145,10,67,14,161,16,225,131,
+56,15,137,89,145,160,105,10,8,40,165,169,34,32,140,8,242,16,27,136,19,13,194,48,25,140,91,138,5,152,25,33,
+192,146,151,154,149,129,42,9,181,216,130,18,43,224,16,129,147,63,26,136,32,219,2,26,76,1,16,250,17,42,16,25,
+152,250,34,76,50,143,153,149,0,153,136,0,3,242,24,42,16,8,167,137,8,146,21,137,168,61,29,2,90,139,74,0,
+161,128,10,62,41,179,242,129,1,82,75,13,136,16,145,128,74,140,178,216,133,17,202,1,130,0,137,171,125,0,136,27,
+146,165,42,48,137,203,167,17,128,145,11,250,64,2,10,168,58,241,19,171,10,90,5,200,24,130,136,104,57,200,152,65,
+91,72,12,137,128,40,178,61,144,178,56,240,179,172,72,131,200,132,40,92,48,13,161,136,1,128,43,178,250,133,137,1,
+16,138,9,137,120,140,90,10,164,132,10,9,146,130,148,225,145,24,73,192,24,61,26,147,40,134,28,168,147,123,26,12,
+0,149,162,138,48,26,8,249,163,9,40,167,24,45,0,153,80,137,225,162,49,155,18,13,184,84,161,9,74,75,136,196,
+145,42,177,18,46,46,144,162,89,58,41,185,168,151,160,1,21,245,72,0,28,88,167,177,40,58,144,32,170,17,31,128,
+41,185,166,129,169,3,179,216,113,138,145,8,47,16,179,197,136,16,24,152,180,210,194,33,41,28,40,181,138,64,10,136,
+136,243,146,43,62,74,149,192,129,8,128,64,169,164,225,130,32,43,152,162,131,26,56,14,25,243,181,10,129,104,152,129,
+152,210,16,33,176,240,163,146,48,12,42,58,230,130,9,73,12,17,137,30,129,130,0,240,147,25,24,48,155,44,8,165,
+194,32,62,43,145,197,146,180,25,8,179,143,3,72,152,16,153,181,80,25,139,13,146,244,147,144,130,29,129,8,130,9,
+10,89,188,163,99,152,0,192,136,18,3,10,9,46,208,3,226,128,32,28,58,58,160,166,107,29,9,26,149,16,24,40,
+202,2,196,17,168,40,15,132,136,168,114,139,24,9,212,2,152,26,42,59,73,185,112,177,42,163,149,200,16,24,169,6,
+152,186,3,123,75,2,28,176,152,137,42,121,179,192,129,146,2,58,135,155,58,59,107,120,209,161,25,25,65,8,177,176,
+146,168,75,78,3,28,139,18,59,0,39,188,193,152,72,32,180,193,8,9,120,41,10,180,176,9,185,121,88,146,186,32,
+140,164,81,192,178,8,9,34,9,179,141,185,151,50,28,165,24,249,145,41,73,17,138,147,216,57,121,128,128,153,209,32,
+161,51,219,229,16,41,27,57,0,168,177,15,16,120,168,147,136,176,33,132,144,128,157,178,48,77,128,170,182,35,139,59,
+128,193,227,184,41,115,128,130,136,218,96,26,0,192,211,33,9,17,13,162,144,133,128,144,107,185,146,218,132,56,152,64,
+140,128,178,65,75,195,139,197,40,145,148,168,177,56,130,78,73,11,192,228,24,16,137,3,208,212,48,138,48,27,178,8,
+153,72,162,35,249,2,184,148,107,160,16,192,157,132,18,78,162,136,168,145,57,36,169,196,160,184,105,57,128,138,179,128,
+56,3,175,0,247,40,10,1,33,161,1,208,10,57,24,156,151,137,128,146,134,75,184,161,144,82,31,178,18,188,135,136,
+56,26,153,5,169,107,136,146,128,0,153,178,183,16,145,211,16,62,154,194,131,194,90,169,3,24,8,130,199,128,44,178,
+163,34,47,137,1,46,136,1,153,132,11,210,167,161,178,2,27,56,192,2,174,252,71,0,145,161,60,225,181,130,194,50,
+59,0,13,224,132,8,154,16,178,161,242,3,44,128,148,40,3,218,162,45,225,128,10,135,131,56,171,219,196,163,130,24,
+162,209,149,227,16,25,140,163,20,144,73,43,8,140,74,164,43,27,178,200,166,148,8,27,16,185,23,161,24,177,9,242,
+195,179,2,10,19,184,123,192,16,152,130,241,147,192,48,156,22,29,0,41,194,80,139,130,168,17,202,2,73,62,61,136,
+8,2,152,177,49,17,15,184,64,25,76,161,16,26,179,136,179,155,245,43,2,8,31,40,232,33,210,132,41,16,45,192,
+64,185,130,10,128,26,212,105,137,34,28,0,59,177,28,0,168,64,65,46,17,107,138,24,58,43,172,17,171,108,8,90,
+74,58,8,8,94,9,137,41,152,25,128,95,43,24,137,145,106,11,128,58,9,177,58,108,57,56,0,17,63,152,43,154,
+136,218,149,58,137,69,45,24,57,13,211,8,168,162,24,106,24,64,9,73,75,168,211,137,129,153,32,0,64,34,10,123,
+168,180,232,144,210,162,145,161,7,40,144,57,187,181,242,128,162,17,138,166,2,32,142,0,184,183,145,129,1,43,144,130,
+195,97,28,136,216,165,128,161,2,41,58,242,17,25,77,27,8,145,162,198,147,1,186,181,33,10,129,41,192,149,177,242,
+48,46,26,176,24,112,10,73,169,182,1,136,145,136,242,147,41,16,128,168,225,131,192,128,32,105,43,40,62,58,152,12,
+211,40,137,48,40,24,105,13,10,24,242,131,160,151,128,129,177,17,154,179,203,165,182,128,181,145,152,163,17,139,131,73,
+240,1,177,180,181,16,40,62,41,25,75,9,187,177,150,232,149,1,42,41,41,26,74,45,185,146,0,8,151,16,211,129,
+128,184,92,8,169,2,151,161,181,163,0,42,9,169,196,178,215,16,136,0,242,2,41,138,16,176,144,145,199,17,1,208,
+165,56,29,25,153,146,128,161,167,16,144,195,166,74,10,9,144,32,10,160,148,44,130,240,180,33,10,145,1,65,43,226,
+132,59,45,137,160,73,44,0,193,151,144,178,164,10,145,216,164,32,74,91,10,72,10,176,162,27,226,145,6,25,129,136,
+228,1,154,131,152,26,8,178,53,29,129,59,208,129,152,8,93,169,182,165,130,136,17,176,72,4,71,0,1,192,16,58,
+51,47,74,208,65,12,25,137,185,162,148,16,89,241,17,138,50,15,0,8,16,73,154,64,30,208,131,168,33,11,64,176,
+165,32,144,168,226,242,179,128,89,168,34,137,180,1,9,40,12,228,1,184,20,11,196,35,185,2,90,138,210,183,2,169,
+48,138,137,152,226,149,57,9,147,200,5,44,92,169,0,152,130,24,17,9,199,179,32,27,95,153,0,160,147,57,168,48,
+186,167,88,27,109,153,129,8,192,130,42,0,16,227,66,11,72,24,156,180,9,145,58,152,20,59,43,65,31,177,43,1,
+140,57,169,115,10,1,46,40,47,128,24,41,145,73,202,0,42,11,122,58,28,81,27,19,10,220,129,139,146,106,26,65,
+61,24,90,9,168,161,178,201,132,32,123,0,57,75,29,136,128,193,16,241,1,24,161,16,12,147,29,163,64,154,2,30,
+137,162,72,152,75,180,149,57,227,145,60,185,41,168,34,76,193,23,43,210,1,169,0,12,128,104,43,131,60,211,161,178,
+165,160,0,164,106,168,18,61,185,5,154,148,24,192,33,185,145,179,91,56,173,134,8,0,17,43,159,163,26,144,123,25,
+194,20,168,131,91,139,25,186,19,124,28,18,170,149,160,144,2,154,192,135,42,40,75,11,209,18,176,20,57,210,146,42,
+232,16,47,24,192,34,24,60,0,137,201,0,169,51,95,152,181,32,168,16,137,160,152,200,147,78,185,167,194,129,178,8,
+33,8,10,57,42,91,154,214,181,16,179,49,130,2,79,170,18,140,178,163,181,16,3,185,22,28,155,227,41,216,165,16,
+0,25,130,27,17,209,152,213,17,184,181,1,145,161,112,139,32,128,169,4,157,197,1,176,130,128,48,141,34,26,152,80,
+60,250,129,146,162,1,72,184,49,161,241,89,15,161,0,145,41,24,105,154,180,163,8,73,139,226,32,57,128,125,42,168,
+16,1,27,9,225,131,154,135,75,43,57,186,4,107,168,34,12,177,42,48,46,57,42,130,10,7,128,141,145,74,169,82,
+139,16,56,242,144,48,154,60,152,42,143,18,0,46,128,162,168,113,176,144,148,57,170,65,47,12,33,138,0,89,160,146,
+16,13,225,32,160,179,1,150,41,25,150,28,25,11,193,16,211,178,21,8,160,130,165,73,42,139,196,9,254,2,74,0,
+131,44,93,9,9,128,4,30,8,160,176,163,16,29,64,152,42,166,104,10,8,154,25,74,59,59,96,128,137,1,72,235,
+145,227,8,128,147,153,134,161,26,146,89,9,177,65,47,42,42,137,40,151,152,2,81,225,163,32,158,40,137,9,144,132,
+29,50,44,146,27,9,15,16,42,25,88,34,142,40,137,194,25,48,191,36,11,9,145,132,155,66,24,48,177,79,224,89,
+27,9,128,17,153,65,42,145,41,202,162,79,152,9,163,135,129,8,162,16,208,138,33,159,148,10,197,33,152,75,145,160,
+163,32,25,31,144,240,163,17,24,137,131,1,67,141,91,187,147,240,130,16,8,209,20,169,18,138,26,240,1,224,49,26,
+129,144,17,160,82,154,144,180,33,214,40,136,1,152,153,151,59,193,129,169,128,230,25,2,9,42,128,35,31,132,42,201,
+212,147,137,32,168,75,162,80,154,82,154,169,183,0,138,72,136,13,135,9,161,40,160,241,4,138,129,9,180,0,34,154,
+5,139,7,169,65,171,129,155,134,11,24,178,64,176,114,192,56,176,46,177,40,10,33,17,28,181,16,245,0,0,186,2,
+137,144,81,57,160,16,241,183,32,152,194,25,211,24,41,9,17,217,133,145,152,195,129,28,35,15,17,40,64,216,129,180,
+16,25,45,153,58,186,73,75,40,176,161,151,11,6,137,73,153,153,169,35,34,154,147,167,75,4,24,218,162,156,195,28,
+33,128,49,246,128,32,58,92,11,161,152,161,33,9,48,88,78,32,62,40,9,155,195,9,145,18,26,166,43,65,45,59,
+136,154,185,137,194,164,90,152,120,49,46,144,24,137,0,156,148,0,44,48,15,64,12,163,136,194,24,136,147,45,41,16,
+28,120,154,149,160,161,152,152,130,96,137,3,73,120,152,146,145,144,141,65,185,152,153,112,139,121,153,131,152,163,9,130,
+8,146,10,124,157,48,241,164,24,145,26,9,0,162,196,120,184,34,225,130,42,136,26,153,177,82,171,114,155,136,151,0,
+136,128,138,18,0,90,16,94,184,2,183,16,144,40,154,161,73,10,8,79,192,136,179,73,8,74,138,1,176,2,9,95,
+176,16,147,80,10,26,193,168,27,5,74,47,193,144,148,24,57,59,12,9,194,147,56,31,179,137,135,57,137,57,26,179,
+249,8,65,0,8,137,121,41,213,136,147,60,136,1,169,147,137,27,17,190,115,155,133,26,166,40,201,146,9,42,89,27,
+166,26,32,170,135,128,169,148,10,144,32,172,22,29,1,152,145,152,242,179,0,146,8,161,70,172,51,13,2,178,182,32,
+144,25,170,183,147,153,120,9,25,177,0,185,161,153,176,167,7,137,33,28,74,136,160,184,88,185,179,209,135,169,20,153,
+18,137,227,129,137,33,216,177,135,184,130,232,130,144,132,8,0,11,225,162,5,8,80,152,17,227,65,170,0,27,184,229,
+147,24,91,12,128,145,1,27,49,28,8,196,19,153,121,138,162,209,2,44,16,60,169,163,144,151,76,153,0,178,120,138,
+32,186,164,137,146,123,76,144,32,144,123,137,16,153,162,164,48,193,2,73,143,145,122,43,9,136,136,25,233,33,29,178,
+16,152,34,139,147,25,193,12,48,51,31,50,78,161,34,29,33,208,106,9,144,0,48,8,170,2,61,241,152,193,149,144,
+48,195,42,9,61,61,42,11,19,168,19,147,107,136,15,129,184,151,0,193,1,26,18,29,10,76,169,32,12,57,161,132,
+138,199,8,41,90,28,57,2,170,20,185,150,128,26,24,140,91,197,162,48,74,91,152,185,193,49,59,29,16,137,75,17,
+41,229,145,147,208,8,18,8,170,134,40,165,10,168,67,43,13,177,0,31,164,1,177,1,161,166,42,19,12,249,89,42,
+24,216,145,2,178,26,145,51,251,132,10,32,61,160,146,10,53,138,184,105,164,192,136,43,57,209,186,38,57,186,49,7,
+8,157,25,24,153,49,193,130,57,120,161,131,200,248,136,137,18,129,240,35,88,28,153,64,177,192,43,1,128,154,181,7,
+8,138,136,36,193,25,75,138,58,72,243,146,146,152,152,120,130,219,137,133,16,155,32,32,209,152,1,67,192,158,148,19,
+155,41,59,146,200,33,193,35,132,190,177,21,185,59,16,151,160,1,41,52,140,155,170,151,152,106,56,8,184,129,7,24,
+0,172,200,167,161,1,49,153,25,160,165,43,48,31,234,130,18,169,17,49,240,144,195,17,40,138,250,18,193,24,49,0,
+144,173,179,134,24,25,185,0,13,3,95,128,137,185,19,10,114,168,169,49,241,40,0,65,43,140,132,129,89,27,129,159,
+132,153,152,96,113,18,79,0,10,25,56,10,72,16,173,162,211,161,146,120,72,139,136,20,137,92,153,10,168,34,249,3,
+56,155,134,209,34,26,140,57,153,128,136,21,106,168,194,164,128,9,146,29,162,17,201,114,41,11,145,144,129,133,169,154,
+211,153,23,42,105,184,153,65,136,8,74,185,209,32,227,48,8,168,24,74,17,18,175,57,241,128,33,27,33,42,43,27,
+120,144,9,31,144,177,8,89,8,137,121,26,89,0,136,62,177,40,177,128,150,146,45,24,58,178,106,15,146,27,129,8,
+137,56,0,76,131,167,140,17,160,42,16,63,24,26,107,26,160,150,160,138,17,136,47,40,152,42,123,128,32,144,193,137,
+32,142,147,60,161,66,29,33,44,129,146,185,4,14,72,185,179,41,162,73,30,34,219,17,3,15,57,128,147,155,148,129,
+159,34,168,138,39,61,137,1,193,136,8,145,28,144,145,242,112,42,8,137,3,176,176,147,186,114,248,163,105,10,57,10,
+1,13,148,0,0,90,225,129,0,8,9,8,2,157,2,146,47,58,144,139,72,0,184,130,6,139,242,19,27,24,58,242,
+58,42,129,44,83,141,161,144,130,62,152,8,25,147,92,177,90,233,131,176,148,56,169,48,154,83,138,123,130,168,130,179,
+162,77,16,15,8,160,0,11,132,200,196,3,144,9,110,136,153,17,1,26,16,2,240,128,129,123,28,26,9,197,40,178,
+128,209,148,160,34,26,63,26,8,137,17,0,42,212,129,162,160,79,16,13,162,18,161,131,42,180,136,249,81,11,9,24,
+9,201,7,26,128,48,157,146,136,16,144,153,144,199,16,151,8,60,162,176,144,164,180,11,1,49,157,36,79,137,56,138,
+152,168,151,137,145,130,201,50,76,42,61,40,45,24,73,136,41,141,148,128,2,48,28,136,186,32,60,60,31,0,12,179,
+131,153,56,243,129,136,167,91,29,17,10,24,88,137,10,149,26,240,34,138,8,57,176,10,194,148,74,1,78,137,91,152,
+136,73,25,139,39,26,144,108,58,138,24,128,169,41,227,129,181,16,47,25,107,185,132,136,145,57,160,16,138,99,45,40,
+61,200,56,193,32,186,133,42,9,89,42,59,78,152,26,163,178,193,50,139,120,138,131,59,79,152,9,0,181,24,161,73,
+154,163,16,27,124,209,8,0,206,246,75,0,163,11,129,0,0,16,9,113,11,183,10,130,58,241,89,168,1,41,136,18,
+249,133,169,34,137,192,40,227,57,145,73,136,184,199,1,26,211,2,59,128,27,209,146,130,14,151,9,128,148,138,72,145,
+162,186,162,19,206,135,152,2,136,144,25,80,169,162,136,193,197,4,41,24,168,152,16,176,228,166,130,209,242,1,25,136,
+2,154,128,0,60,129,146,151,181,153,10,168,5,17,177,179,0,158,20,133,161,134,187,208,72,137,32,72,170,25,176,130,
+23,74,29,16,139,139,104,192,18,3,153,0,161,110,137,145,56,57,187,140,80,58,59,199,144,40,156,48,16,144,73,123,
+152,28,129,145,89,57,143,162,0,25,145,147,90,75,192,44,40,152,145,20,46,153,74,128,17,43,144,65,173,59,162,33,
+121,137,170,133,88,75,42,168,41,33,191,3,40,26,130,24,13,153,56,34,63,27,41,129,191,134,177,50,26,174,33,42,
+59,130,197,41,122,160,44,146,176,2,129,140,145,145,196,121,152,177,18,225,58,128,169,6,178,154,182,80,10,1,160,9,
+67,169,154,183,147,41,8,57,15,145,168,130,147,192,17,19,248,12,5,43,144,179,188,167,147,40,177,130,12,21,176,63,
+137,161,17,209,130,25,25,141,22,138,0,122,154,136,136,2,33,136,154,13,135,146,65,30,152,161,3,129,14,1,184,132,
+147,9,11,46,153,150,163,27,49,155,170,151,164,81,29,26,184,149,24,0,153,129,165,160,151,28,57,10,211,3,139,145,
+136,132,1,129,27,110,152,142,148,161,17,144,152,48,27,41,48,125,153,128,183,161,145,1,48,169,180,59,27,61,128,194,
+199,2,24,169,138,149,136,146,2,15,194,210,149,16,8,25,40,224,136,32,153,132,180,232,148,8,25,16,176,145,131,144,
+173,161,167,161,151,0,41,138,25,2,128,34,196,193,214,160,18,41,58,0,203,166,136,9,17,176,150,128,163,14,161,162,
+1,134,160,40,184,248,4,153,49,43,161,129,250,129,196,129,17,209,2,44,26,28,2,152,32,3,169,59,246,160,19,139,
+50,47,128,56,11,64,57,233,64,137,16,30,16,31,145,24,42,56,25,29,17,170,121,170,97,28,152,48,137,42,25,152,
+48,208,120,27,89,140,17,137,40,57,25,27,248,1,67,0,64,156,98,171,48,218,180,73,160,16,73,155,80,169,72,11,
+66,12,163,72,208,33,24,106,11,194,121,200,32,153,129,42,145,76,9,136,152,167,32,184,33,216,72,184,131,0,128,152,
+134,152,136,231,1,160,2,59,209,129,59,228,1,160,178,212,48,138,48,139,182,1,144,2,11,182,48,228,73,9,128,184,
+135,26,136,40,139,181,145,131,63,152,90,168,17,153,18,42,128,25,62,17,15,161,107,9,136,162,105,153,40,8,9,40,
+63,137,93,10,0,8,16,90,10,128,60,48,31,136,57,186,19,45,72,76,9,16,42,88,15,129,58,193,48,43,25,43,
+57,25,63,92,29,145,9,162,16,10,48,170,2,25,27,122,14,163,58,164,90,154,19,28,1,74,28,72,188,150,152,146,
+40,138,129,144,41,105,139,64,248,165,136,131,41,26,2,193,81,10,176,132,243,164,153,131,25,201,2,145,26,56,248,181,
+242,131,137,17,25,192,17,128,25,144,144,183,243,18,170,48,25,184,2,210,17,153,153,135,224,49,201,64,43,136,161,197,
+17,42,25,177,129,120,201,120,9,128,160,181,16,25,26,8,138,72,240,72,26,8,176,5,42,41,60,0,14,57,243,40,
+42,26,185,133,57,25,45,0,28,58,179,60,48,44,128,146,62,24,43,121,29,27,197,57,136,32,186,181,124,32,26,128,
+11,251,130,152,133,8,177,20,128,24,202,183,11,2,147,33,152,182,152,178,56,26,175,4,10,41,167,153,128,17,0,35,
+29,2,43,201,213,8,147,137,129,226,150,8,144,160,152,128,242,130,49,141,134,136,57,168,146,180,152,182,160,161,120,152,
+25,145,160,167,145,178,1,33,248,32,26,144,16,17,160,122,146,57,241,212,146,138,57,139,1,74,129,26,137,148,29,64,
+10,122,44,160,73,178,25,2,193,36,158,2,26,141,89,168,89,137,129,41,8,76,160,4,40,91,12,176,137,163,120,28,
+146,16,216,97,10,0,25,161,1,40,154,146,218,161,228,72,137,0,32,241,25,160,40,24,49,40,241,40,171,32,76,182,
+72,184,146,28,161,129,208,113,137,17,156,164,10,1,128,1,5,28,208,1,9,128,160,39,12,149,138,8,137,56,160,82,
+154,151,152,145,28,2,129,73,128,161,242,59,168,153,132,49,242,13,70,0,141,98,201,130,26,144,32,45,178,135,184,34,
+143,128,32,168,21,161,40,157,179,10,74,33,28,112,184,59,176,17,74,26,33,105,13,0,171,83,153,129,81,145,113,203,
+3,155,57,72,14,17,153,152,147,45,148,59,148,42,25,26,143,129,176,20,168,19,17,140,123,185,32,130,59,246,17,160,
+153,162,58,30,36,62,160,145,128,154,179,72,26,19,58,106,153,108,185,3,162,8,148,160,75,208,128,56,57,228,162,153,
+151,154,149,169,19,152,3,129,10,241,244,32,194,1,128,136,16,185,89,200,40,16,241,2,144,0,8,10,32,224,113,138,
+32,168,169,147,225,122,128,74,152,144,129,139,16,166,129,34,136,122,12,73,12,163,1,168,48,249,130,10,136,73,40,9,
+0,58,150,219,132,186,151,24,129,41,10,8,141,64,9,151,32,169,146,154,42,187,42,23,10,64,40,159,147,41,0,47,
+145,26,146,4,142,2,169,18,150,49,42,143,178,41,155,135,136,130,136,196,25,177,1,142,35,170,134,8,138,130,43,180,
+1,129,50,31,131,234,177,58,59,160,36,179,14,180,10,144,82,177,131,105,169,193,8,176,90,196,4,186,66,139,199,56,
+160,128,2,129,45,164,160,216,130,136,198,33,136,152,136,41,26,163,65,214,0,146,154,75,42,224,4,8,42,152,129,240,
+73,58,9,17,153,164,167,137,161,185,21,144,104,9,184,144,192,58,96,123,176,1,0,154,60,136,40,20,58,104,11,58,
+240,130,74,176,40,8,77,185,144,180,25,16,160,115,57,140,16,14,57,168,133,24,0,0,203,9,1,131,51,47,195,201,
+72,30,9,49,201,20,138,56,60,218,183,0,16,10,163,1,10,162,29,20,138,147,183,33,136,202,24,60,12,3,40,129,
+174,167,153,32,129,18,2,187,18,232,154,199,128,3,59,128,24,59,216,243,3,28,129,243,16,129,169,131,27,60,136,52,
+89,156,146,217,129,128,131,49,77,25,184,216,198,129,65,11,147,146,43,44,155,150,128,32,144,27,145,199,0,10,168,2,
+152,135,9,17,155,44,145,140,51,50,167,1,203,16,143,128,2,163,151,24,160,14,57,154,151,130,26,128,193,209,48,12,
+128,16,25,180,37,60,192,162,145,106,10,17,128,129,243,9,13,152,2,107,62,251,79,0,130,9,160,137,8,43,133,65,
+58,178,186,183,56,43,13,146,161,107,136,164,76,145,27,137,184,33,134,72,176,74,171,217,33,10,37,74,1,209,8,29,
+34,46,129,163,75,12,171,133,40,176,72,11,25,30,66,75,145,16,168,242,161,133,137,195,132,137,136,170,89,169,2,62,
+9,161,139,43,26,167,3,144,165,208,2,146,121,9,162,9,129,43,57,210,7,24,144,41,61,42,11,166,56,154,145,157,
+163,144,121,225,148,128,153,73,161,104,10,1,154,0,25,170,135,24,122,200,147,9,41,137,132,57,161,153,160,186,97,153,
+48,60,126,202,131,24,144,128,17,12,40,156,56,8,2,18,178,26,108,143,148,90,137,16,8,10,138,19,76,209,132,137,
+176,56,47,241,17,152,129,9,146,25,163,58,80,129,170,151,26,74,108,137,146,32,139,1,60,10,172,36,76,136,40,160,
+161,57,126,184,33,152,193,1,43,138,18,218,4,168,130,232,19,9,113,61,8,163,177,45,147,43,128,152,177,130,251,144,
+228,180,122,160,16,152,145,8,40,10,145,192,17,19,30,179,242,165,120,11,8,24,152,144,18,11,24,147,26,17,143,128,
+245,180,64,10,9,41,185,16,32,90,42,146,145,122,130,128,243,197,131,137,144,41,154,195,17,45,60,138,130,25,146,42,
+230,196,130,128,57,42,169,146,192,64,73,169,134,154,48,30,160,244,148,128,8,41,26,136,24,32,60,201,147,144,72,79,
+152,194,149,128,9,56,138,145,131,179,110,136,8,152,104,44,26,184,165,24,152,32,10,136,200,135,25,144,49,141,72,46,
+8,177,4,10,128,8,201,132,8,148,58,208,163,161,121,44,59,217,131,161,0,73,28,128,210,33,59,139,64,193,65,107,
+91,153,17,209,130,24,154,9,177,146,105,168,35,184,14,72,61,185,35,160,194,48,160,138,35,33,191,213,162,145,40,109,
+43,152,132,193,1,25,9,10,179,48,153,211,178,183,162,97,77,139,24,9,137,32,9,32,80,154,134,147,180,163,146,105,
+63,154,24,129,137,17,139,186,13,1,176,194,50,199,146,124,59,9,73,160,161,179,146,58,24,226,80,153,129,208,210,32,
+61,138,89,9,208,131,16,9,41,41,58,9,41,246,0,17,25,136,8,178,0,48,204,90,153,5,66,0,0,163,95,192,
+17,225,164,8,40,139,130,144,183,72,26,41,140,145,9,136,123,138,182,178,18,152,48,9,242,18,153,131,45,8,73,26,
+74,200,243,129,42,192,129,8,227,73,152,146,18,148,72,42,44,192,179,147,107,177,49,138,242,24,176,32,12,136,9,41,
+79,26,176,150,24,161,89,137,128,144,151,16,9,144,128,60,45,9,192,161,43,181,42,131,148,136,150,8,153,166,88,47,
+42,24,154,146,24,200,32,146,213,146,17,136,161,50,40,121,93,10,9,152,160,163,61,16,152,59,214,128,144,1,25,10,
+96,9,153,8,74,176,81,105,153,89,10,176,145,214,130,24,40,61,154,146,139,160,107,58,153,58,148,8,197,164,146,179,
+112,58,8,57,46,146,32,27,176,14,216,129,154,166,146,162,104,75,137,24,0,208,17,72,168,26,0,128,31,176,179,197,
+72,45,9,128,8,195,48,65,137,42,178,12,153,210,243,180,33,75,9,136,152,213,1,26,40,46,128,41,41,160,163,135,
+131,40,41,184,0,242,0,89,137,29,59,31,10,168,194,166,129,0,56,137,131,167,24,8,16,12,40,26,61,28,9,230,
+129,0,10,9,25,196,16,72,9,58,42,153,26,60,155,183,132,146,16,144,112,178,10,151,128,153,16,58,47,42,11,196,
+17,59,145,0,59,194,178,6,146,26,133,202,107,29,26,200,1,24,129,25,105,210,181,18,144,25,9,1,47,58,45,160,
+0,201,148,75,10,9,160,2,149,160,50,96,45,16,60,169,131,145,149,8,8,197,161,73,210,128,209,146,25,74,46,153,
+146,144,64,136,91,144,162,130,163,161,4,180,250,35,31,128,30,8,24,9,91,128,40,138,5,137,194,35,47,8,10,0,
+168,195,62,136,92,137,24,89,42,160,18,178,166,33,59,43,12,136,152,77,45,129,136,240,2,43,160,40,184,22,74,107,
+10,2,153,146,32,216,90,45,152,162,145,130,241,177,9,146,154,128,11,209,9,130,130,110,152,35,144,146,167,2,146,133,
+144,131,242,1,160,196,128,24,106,28,25,146,178,181,130,40,240,146,144,147,153,180,9,10,47,26,1,137,229,130,0,144,
+129,132,161,145,145,194,242,144,212,32,59,73,43,225,24,136,136,44,152,195,211,32,25,40,10,129,40,21,234,0,63,0,
+224,133,32,10,16,95,8,169,146,168,195,10,24,92,42,43,132,60,59,56,139,145,130,144,215,129,147,9,151,63,10,24,
+168,146,8,131,136,125,128,145,88,44,136,26,194,48,12,40,59,128,218,148,91,10,8,41,10,56,180,66,35,61,41,31,
+137,156,162,48,160,113,168,151,139,194,129,200,50,157,165,24,8,64,169,66,12,33,28,136,90,160,132,137,151,160,144,25,
+169,160,200,20,42,196,33,136,144,34,129,224,182,130,163,16,241,180,145,155,194,25,162,152,40,50,112,44,182,182,1,136,
+0,11,144,160,193,132,72,8,170,149,26,153,25,25,64,28,0,80,152,60,203,3,61,57,75,120,0,137,133,0,138,25,
+31,9,31,152,129,153,4,16,24,105,10,41,128,80,45,24,16,9,154,241,8,139,11,1,112,106,26,40,73,176,1,144,
+177,40,171,124,170,66,13,160,25,160,66,140,49,90,17,109,136,64,170,1,155,210,42,161,32,27,5,59,177,56,242,145,
+26,33,156,3,242,129,228,18,27,8,160,160,80,178,76,57,128,58,236,56,224,8,209,2,24,3,26,90,130,163,224,17,
+177,57,228,8,129,128,201,178,194,199,145,160,18,8,129,104,8,56,11,131,240,128,184,65,208,145,149,136,184,145,161,225,
+129,72,75,144,0,163,135,128,26,2,0,185,194,180,164,129,200,195,163,91,12,77,44,24,168,130,3,60,26,194,48,42,
+92,106,9,129,177,32,156,45,60,154,106,46,42,8,168,35,9,48,62,48,91,155,112,136,129,128,194,0,185,29,152,9,
+154,122,122,26,129,129,128,136,168,181,164,41,74,75,26,209,197,129,160,32,153,16,30,17,91,137,147,243,2,10,193,136,
+145,19,60,105,16,146,10,241,145,193,130,14,130,0,153,0,129,162,243,147,147,136,64,43,139,199,148,177,24,138,226,212,
+162,25,17,26,130,50,24,145,15,136,209,198,16,8,16,168,211,0,195,130,137,130,192,20,60,27,16,136,64,29,42,152,
+139,178,179,120,107,40,160,8,171,168,137,14,79,1,145,49,61,128,153,184,164,200,132,121,137,74,41,72,14,24,91,25,
+137,9,56,91,155,1,33,122,27,41,136,152,90,57,75,60,0,13,10,31,160,178,161,2,19,147,90,58,147,3,24,47,
+46,20,65,0,250,165,160,162,40,25,0,60,153,123,0,28,228,17,40,16,45,24,9,138,168,152,160,16,183,166,17,161,
+24,185,198,128,162,138,241,145,183,162,146,18,25,144,129,216,165,145,180,0,166,24,160,58,31,8,153,145,64,32,73,185,
+151,0,90,61,26,9,177,128,144,162,178,181,36,14,9,128,153,42,129,164,167,145,166,145,1,43,170,32,218,148,16,147,
+41,192,199,161,104,27,8,74,24,42,138,49,91,43,89,154,74,139,0,109,41,136,179,32,30,139,128,44,62,60,9,1,
+41,146,149,9,1,13,130,73,62,153,211,146,178,128,57,137,41,210,49,40,60,245,149,128,145,145,168,160,0,184,33,40,
+30,183,2,243,130,153,194,161,40,9,160,165,180,165,33,155,129,152,198,164,2,136,132,13,210,33,154,144,147,41,41,56,
+46,162,57,180,132,76,79,16,152,243,194,160,8,147,65,171,196,16,16,216,162,161,56,121,1,129,168,145,168,232,36,30,
+153,40,24,25,128,49,251,3,152,60,122,9,161,145,146,153,34,40,229,49,136,152,177,210,58,248,9,8,0,45,24,228,
+32,77,136,0,56,136,91,137,16,61,193,106,144,41,58,137,48,31,43,10,0,45,2,29,161,1,161,4,139,135,136,25,
+169,1,32,92,25,77,152,137,128,145,192,2,40,171,167,50,162,185,133,27,57,241,137,151,163,72,137,144,11,137,11,7,
+168,105,43,156,32,176,7,24,178,162,129,251,131,41,42,0,144,200,5,152,150,185,4,77,136,0,144,144,1,185,136,243,
+193,210,6,137,1,57,154,161,34,137,170,199,161,226,129,40,128,88,136,32,136,61,192,193,149,162,73,29,136,136,130,26,
+136,16,227,20,91,40,154,2,138,132,91,140,73,153,132,40,59,27,31,25,201,129,147,139,209,16,32,20,43,54,31,160,
+146,155,19,140,167,8,128,227,146,25,60,25,1,136,8,130,113,10,162,182,33,46,137,152,165,16,130,12,145,138,170,149,
+154,160,26,240,177,149,135,144,5,42,26,25,200,164,161,180,163,144,25,173,131,161,136,167,129,166,178,82,11,161,177,164,
+32,129,27,83,168,243,152,193,195,136,49,44,75,138,156,1,228,35,153,104,42,152,73,240,0,129,24,42,168,1,170,104,
+42,44,58,194,220,236,70,0,2,161,97,9,26,161,148,95,9,41,61,128,136,178,0,41,27,73,47,28,25,171,64,43,
+163,74,34,0,195,34,142,29,9,178,62,144,16,184,135,145,180,48,192,162,197,132,136,8,56,185,129,199,145,24,145,192,
+213,146,144,1,24,26,153,178,42,31,79,152,146,2,146,129,9,242,160,162,88,45,26,160,148,130,91,58,45,0,8,136,
+19,10,9,242,147,168,50,47,139,0,146,148,128,192,178,182,146,160,42,155,27,106,50,153,113,24,209,147,184,15,178,0,
+224,131,0,130,93,59,41,58,107,43,59,73,193,40,193,130,32,181,209,25,92,9,25,8,178,128,105,9,13,193,210,161,
+57,32,42,32,164,162,122,41,31,136,0,9,74,137,145,225,148,16,24,25,8,32,60,40,15,180,56,43,17,200,179,64,
+24,143,129,0,209,148,137,192,16,172,152,122,1,9,148,145,192,4,137,192,0,179,1,136,98,45,177,213,195,130,73,136,
+136,129,195,74,168,24,199,148,177,32,30,0,9,128,40,138,49,45,177,184,227,88,28,16,58,57,41,90,153,41,233,144,
+26,76,27,56,75,0,161,198,131,32,42,169,113,136,42,185,40,148,183,178,0,44,2,11,58,76,187,89,226,130,137,59,
+73,47,56,28,72,9,177,164,0,24,159,40,8,140,3,136,108,10,162,164,128,18,136,73,182,145,147,25,128,179,228,146,
+28,2,138,45,8,45,58,144,13,226,161,146,144,21,8,58,164,136,0,150,28,153,24,177,200,181,2,27,146,40,52,242,
+16,177,2,182,42,129,73,216,22,26,0,46,8,137,209,130,152,1,10,217,0,153,48,184,37,240,149,130,74,153,131,140,
+8,154,131,153,135,168,161,96,156,35,185,67,12,4,144,122,43,42,154,21,28,9,181,128,131,169,80,26,44,178,186,129,
+170,32,242,4,130,210,146,180,30,195,176,177,49,61,40,28,163,128,83,186,6,138,2,125,9,9,162,1,29,17,125,154,
+33,185,33,168,130,26,180,2,1,31,153,213,8,145,130,43,228,32,17,139,122,154,146,176,161,20,157,21,10,40,57,171,
+19,145,45,18,31,9,194,65,201,66,155,178,33,43,40,171,32,183,57,168,26,138,166,202,53,59,161,108,136,41,45,209,
+162,145,165,136,49,15,33,46,19,7,81,0,136,40,185,19,41,46,64,11,41,128,123,184,51,157,194,147,193,1,197,144,
+163,10,193,163,31,179,9,32,161,9,21,169,22,154,195,144,146,148,208,133,41,17,10,18,107,192,19,200,76,128,169,58,
+0,45,162,27,80,0,140,133,91,154,0,129,26,129,230,25,56,11,65,58,11,129,219,17,11,138,27,215,161,147,151,160,
+20,10,10,56,136,56,24,109,62,137,91,8,8,136,25,158,2,0,75,17,8,170,162,120,58,59,31,128,30,0,179,24,
+144,177,42,243,129,5,10,129,186,73,27,53,45,40,186,213,2,180,0,2,154,161,16,125,144,24,169,2,174,34,164,162,
+152,193,168,17,122,24,3,139,180,136,10,55,192,41,217,170,40,57,44,128,74,169,72,105,132,130,192,128,216,120,25,136,
+9,8,31,8,58,162,151,152,144,32,137,81,152,74,171,60,10,130,57,22,139,144,147,58,35,183,187,90,202,108,137,17,
+152,16,27,1,178,7,19,171,160,72,8,30,130,78,176,10,192,20,10,18,42,40,29,44,18,137,145,30,168,47,145,65,
+43,0,155,128,162,42,111,128,128,218,146,24,89,76,145,8,8,1,153,17,1,167,24,192,26,153,177,243,147,46,132,42,
+41,145,161,128,142,34,9,242,128,193,147,169,7,138,19,26,154,29,152,130,243,20,161,138,8,0,144,197,52,10,146,47,
+160,1,144,74,211,25,177,168,146,137,120,192,148,43,5,139,72,154,129,154,23,0,176,144,168,16,189,141,99,137,19,173,
+130,128,42,0,135,72,147,171,145,27,105,152,51,202,130,179,236,194,17,0,133,46,1,169,40,144,141,25,129,19,181,33,
+144,197,193,59,16,162,82,171,242,154,129,58,130,42,118,169,194,130,43,129,150,128,130,145,128,13,152,232,131,90,42,42,
+176,132,227,137,129,153,84,168,34,141,24,9,10,170,23,56,152,224,10,161,128,242,19,48,74,152,170,155,66,26,113,160,
+32,151,168,25,136,128,168,96,106,25,26,170,64,173,72,137,1,105,136,41,153,185,32,167,120,136,136,177,153,11,122,26,
+130,48,137,138,133,171,33,165,57,113,0,169,147,184,93,140,40,176,120,42,161,154,58,48,10,105,88,9,76,201,72,10,
+9,18,161,9,33,241,161,75,29,41,10,149,98,244,74,0,40,225,129,168,177,64,50,28,68,168,14,2,137,40,184,134,
+9,26,107,170,128,49,155,61,144,135,136,56,201,106,152,8,80,129,144,168,142,16,137,27,69,169,177,9,163,11,121,2,
+186,20,72,32,240,24,1,141,73,146,0,163,26,143,8,185,83,40,0,240,137,40,44,33,76,226,128,18,9,154,132,169,
+8,177,8,39,226,8,12,9,128,19,65,160,56,142,72,154,120,130,169,162,178,74,152,73,173,151,8,128,89,144,192,168,
+2,26,134,33,208,169,147,136,138,39,136,137,25,172,98,137,0,153,129,162,138,55,153,28,201,7,42,1,147,217,8,144,
+60,56,33,170,244,8,136,25,147,178,75,165,60,8,34,242,28,2,24,136,163,158,144,0,188,116,128,195,25,9,153,0,
+66,160,16,210,195,12,134,16,139,96,137,128,58,186,139,166,17,163,112,9,203,9,134,42,16,48,217,144,16,138,124,0,
+138,164,145,185,17,185,133,27,5,27,33,161,240,16,145,20,24,183,169,209,16,192,81,144,162,44,24,168,25,51,26,9,
+30,243,154,5,145,9,40,3,137,46,26,202,32,5,8,32,235,128,186,35,49,208,23,202,145,25,32,33,1,97,233,128,
+137,2,138,24,105,130,29,160,57,143,129,2,35,249,1,12,144,88,136,16,19,159,9,74,41,8,120,177,25,201,16,211,
+33,1,152,76,152,136,80,152,64,32,46,241,40,26,25,128,132,152,208,184,24,170,17,135,91,136,171,179,17,132,88,0,
+138,186,40,73,123,32,179,196,177,1,200,3,8,151,26,0,47,8,128,25,35,153,162,12,172,3,2,55,31,147,154,169,
+1,154,39,25,130,220,0,73,154,68,136,185,200,132,44,57,73,152,1,26,143,153,34,196,1,25,128,138,200,150,25,82,
+10,144,145,170,90,25,52,42,200,193,170,43,241,6,129,131,157,192,32,42,51,137,137,200,203,33,123,34,227,2,138,136,
+156,4,161,18,144,184,15,132,176,18,113,138,164,136,217,18,146,131,58,146,11,191,27,4,89,17,153,234,243,17,26,50,
+168,193,176,160,88,90,9,146,162,76,30,27,147,128,178,17,27,138,145,235,23,72,12,17,169,160,74,131,148,56,24,219,
+137,62,128,73,20,136,189,0,137,81,72,176,144,139,30,74,124,231,76,0,32,4,168,177,131,143,10,64,152,72,10,138,
+152,80,209,146,5,136,56,205,32,57,17,74,161,2,241,200,129,41,104,128,25,217,160,144,134,19,192,43,208,9,57,33,
+73,152,166,193,168,40,81,155,2,179,43,13,177,227,133,131,136,57,171,248,129,6,40,177,128,244,128,27,148,74,162,195,
+160,168,0,132,146,197,24,184,9,75,20,169,151,0,152,193,10,130,8,50,152,47,17,234,56,56,32,140,65,250,160,17,
+81,26,32,58,143,137,128,147,57,19,12,202,128,140,36,36,139,186,213,129,153,65,57,162,24,182,10,234,146,160,36,16,
+30,8,29,25,64,25,147,35,189,27,46,34,57,33,140,152,30,202,19,120,16,140,129,9,156,81,136,162,129,242,8,41,
+8,163,145,36,57,143,225,128,128,131,40,169,180,242,25,56,16,179,180,128,153,143,34,19,149,128,28,187,200,150,1,49,
+155,179,186,244,49,58,41,155,226,40,193,161,128,23,138,18,128,225,202,129,66,137,163,146,217,128,25,35,132,135,201,0,
+187,147,7,19,25,171,29,192,163,18,21,11,139,41,168,31,43,7,153,160,105,9,42,138,34,24,122,73,154,12,186,82,
+1,88,10,10,153,209,120,0,1,138,128,169,187,113,4,160,161,8,140,8,128,20,145,3,172,197,161,136,123,89,10,27,
+194,24,153,88,18,129,57,178,191,217,64,49,144,137,184,136,169,123,52,8,186,148,154,245,163,148,17,42,138,29,128,185,
+19,164,147,241,150,160,138,33,128,180,41,129,144,15,168,135,17,9,128,157,209,40,0,21,169,144,10,161,123,72,24,170,
+18,44,137,42,3,7,184,129,139,151,153,26,21,27,200,20,169,185,128,35,161,2,209,136,173,162,115,82,129,11,141,170,
+63,89,16,169,24,25,200,24,66,81,140,58,41,154,144,19,99,137,137,171,51,191,195,97,160,162,146,243,137,137,49,129,
+10,146,16,143,153,38,146,147,153,0,237,138,50,5,8,46,137,160,136,36,57,200,16,160,241,16,32,162,198,179,160,19,
+189,129,66,144,195,17,178,251,184,21,162,0,160,169,168,145,7,34,19,232,176,185,14,97,0,8,10,168,161,29,99,0,
+137,74,136,10,30,48,56,8,201,177,82,203,57,122,145,24,9,161,159,42,145,216,73,0,35,179,41,196,9,14,9,36,
+1,145,153,170,204,186,114,20,43,29,74,27,137,81,1,192,32,128,218,163,88,136,64,170,136,66,172,43,97,0,138,88,
+9,205,136,4,146,57,168,44,139,145,114,34,145,201,196,160,200,50,179,160,27,165,10,24,4,8,8,8,8,8,8,128,
+8,128,8,128,8,8,128,128,8,8,128,128,8,128,8,128,8,8,8,8,8,128,128,128,128,128,144,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
@@ -24,8 +24,20 @@
 #define COLOR_TH_1      30
 #define COLOR_TH_2      60
 #define COLOR_TH_3      80
+#define MAX_BARS        32
+#define PEAK_SHIFT      4           /* peak levels kept in 1/16 of step */
+#define NO_STEP         0xFFFF
 /*==================[internal data declaration]==============================*/
+typedef struct{
+    vumeter_t * vum;
+    uint8_t bar;
+} bar_render_t;
+
 static uint16_t bars_width, bars_dist, bars_gap;
+static uint16_t bars_steps[MAX_BARS];       /* lit steps currently on screen */
+static uint16_t bars_peak[MAX_BARS];        /* peak level, 1/16 of step */
+static uint16_t bars_marker[MAX_BARS];      /* peak marker step on screen */
+static uint8_t bars_hold[MAX_BARS];         /* updates left before the peak falls */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -33,6 +45,74 @@ static uint16_t bars_width, bars_dist, bars_gap;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint16_t StepColor(vumeter_t * vum, uint16_t step){
+    if(STEP_DIST*step < vum->height*COLOR_TH_1/100){
+        return vum->step_color_1;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_2/100){
+        return vum->step_color_2;
+    } else if(STEP_DIST*step < vum->height*COLOR_TH_3/100){
+        return vum->step_color_3;
+    }
+    return vum->step_color_4;
+}
+
+/* Draws a strip of one bar: each row belongs to a step, or to the gap between steps */
+static void BarRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+    bar_render_t * br = (bar_render_t *)param;
+    vumeter_t * vum = br->vum;
+    uint16_t *row, color, dist, step;
+    for (uint16_t l=0; l<lines; l++){
+        row = &strip[l*width];
+        /* Step j covers from (bottom - STEP_DIST*j - STEP_HEIGHT) to (bottom - STEP_DIST*j) */
+        dist = vum->y_pos + vum->height - (y0 + l);
+        step = dist / STEP_DIST;
+        if (dist % STEP_DIST > STEP_HEIGHT){
+            color = vum->back_color;
+        } else if (step == bars_marker[br->bar]){
+            color = vum->peak_color;
+        } else if (step < bars_steps[br->bar]){
+            color = StepColor(vum, step);
+        } else {
+            color = vum->back_color;
+        }
+        color = ILI9341_STRIP_COLOR(color);
+        for (uint16_t x=0; x<width; x++){
+            row[x] = color;
+        }
+    }
+}
+
+/* Redraws steps first to last (inclusive) of a bar */
+static void BarSteps(vumeter_t * vum, uint8_t bar, uint16_t first, uint16_t last){
+    bar_render_t br = {vum, bar};
+    uint16_t bar_start = vum->x_pos + bar*bars_dist + bars_gap/2;
+    uint16_t bottom = vum->y_pos + vum->height;
+    ILI9341RenderArea(bar_start, bottom - STEP_DIST*last - STEP_HEIGHT, bar_start + bars_width, bottom - STEP_DIST*first,
+        BarRender, &br);
+}
+
+/* Moves the peak of a bar: held for peak_hold updates, then falls peak_decay/16 steps per update */
+static uint16_t BarPeak(vumeter_t * vum, uint8_t bar, uint16_t steps){
+    uint16_t level = steps << PEAK_SHIFT;
+    if (vum->peak_decay == 0){
+        return NO_STEP;
+    }
+    if (level >= bars_peak[bar]){
+        bars_peak[bar] = level;
+        bars_hold[bar] = vum->peak_hold;
+    } else if (bars_hold[bar] > 0){
+        bars_hold[bar]--;
+    } else if (bars_peak[bar] > level + vum->peak_decay){
+        bars_peak[bar] -= vum->peak_decay;
+    } else {
+        bars_peak[bar] = level;
+    }
+    /* The marker takes the place of the top step of the peak level */
+    if (bars_peak[bar] < (1 << PEAK_SHIFT)){
+        return NO_STEP;
+    }
+    return (bars_peak[bar] >> PEAK_SHIFT) - 1;
+}
 
 /*==================[external functions definition]==========================*/
 void VumeterInit(vumeter_t * vum){
@@ -42,10 +122,58 @@ void VumeterInit(vumeter_t * vum){
     bars_width = (vum->width / vum->n_bars) * BAR_WIDTH_PERC / 100;
     bars_dist = (vum->width / vum->n_bars);
     bars_gap = bars_dist - bars_width;
+    for (uint8_t i=0; i<MAX_BARS; i++){
+        bars_steps[i] = 0;
+        bars_peak[i] = 0;
+        bars_hold[i] = 0;
+        bars_marker[i] = NO_STEP;
+    }
 }
 
 void VumeterUpdate(vumeter_t * vum, uint8_t * values){
     uint16_t n_steps, color, step_start, bar_start;
+    uint16_t old_steps, old_marker, ranges[3][2];
+    uint8_t n_ranges, r;
+    if (vum->n_bars <= MAX_BARS){
+        /* Only the steps that changed are redrawn: the ones lit or turned off,
+         * and the old and new positions of the peak marker */
+        for (uint8_t i=0; i<vum->n_bars; i++){
+            n_steps = ((values[i] * vum->height) / BAR_MAX) / STEP_DIST;
+            old_steps = bars_steps[i];
+            old_marker = bars_marker[i];
+            bars_steps[i] = n_steps;
+            bars_marker[i] = BarPeak(vum, i, n_steps);
+            /* Changed step ranges, merged when they touch */
+            n_ranges = 0;
+            if (n_steps != old_steps){
+                ranges[n_ranges][0] = (n_steps < old_steps) ? n_steps : old_steps;
+                ranges[n_ranges++][1] = ((n_steps > old_steps) ? n_steps : old_steps) - 1;
+            }
+            if (bars_marker[i] != old_marker){
+                for (uint16_t marker = old_marker, m = 0; m < 2; marker = bars_marker[i], m++){
+                    if (marker == NO_STEP){
+                        continue;
+                    }
+                    for (r = 0; r < n_ranges; r++){
+                        if (marker + 1 >= ranges[r][0] && marker <= ranges[r][1] + 1){
+                            break;
+                        }
+                    }
+                    if (r == n_ranges){
+                        ranges[n_ranges][0] = marker;
+                        ranges[n_ranges++][1] = marker;
+                    } else {
+                        ranges[r][0] = (marker < ranges[r][0]) ? marker : ranges[r][0];
+                        ranges[r][1] = (marker > ranges[r][1]) ? marker : ranges[r][1];
+                    }
+                }
+            }
+            for (r = 0; r < n_ranges; r++){
+                BarSteps(vum, i, ranges[r][0], ranges[r][1]);
+            }
+        }
+        return;
+    }
     for (uint8_t i=0; i<vum->n_bars; i++){
         /* Delete previous bar */
         bar_start = vum->x_pos+i*bars_dist + bars_gap/2;
@@ -56,15 +184,7 @@ void VumeterUpdate(vumeter_t * vum, uint8_t * values){
         n_steps = ((values[i] * vum->height) / BAR_MAX) / STEP_DIST;
         for(uint8_t j=0; j<n_steps; j++){
             step_start = vum->y_pos+vum->height-(STEP_DIST)*j;
-            if(STEP_DIST*j < vum->height*COLOR_TH_1/100){
-                color = vum->step_color_1;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_2/100){
-                color = vum->step_color_2;
-            } else if(STEP_DIST*j < vum->height*COLOR_TH_3/100){
-                color = vum->step_color_3;
-            }else{
-                color = vum->step_color_4;
-            }
+            color = StepColor(vum, j);
             ILI9341DrawFilledRectangle(bar_start, step_start,
                 bar_start + bars_width, step_start - STEP_HEIGHT,
                 color);
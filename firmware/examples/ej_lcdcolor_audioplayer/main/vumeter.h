@@ -16,6 +16,8 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 12/04/2024 | Document creation		                         						|
+ * | 14/10/2026 | Update drawn strip by strip (ILI9341RenderArea)                       |
+ * | 14/10/2026 | Only changed steps redrawn, optional peak-hold markers                |
  * 
  **/
 
@@ -39,6 +41,9 @@ typedef struct{
     uint16_t step_color_3;		/*!< number of bars */
     uint16_t step_color_4;		/*!< number of bars */
     uint16_t back_color;		/*!< plot background color */
+    uint16_t peak_color;		/*!< peak marker color */
+    uint8_t peak_hold;			/*!< updates the peak marker is held before falling */
+    uint8_t peak_decay;			/*!< peak marker fall speed, in 1/16 step per update (0: no markers) */
 } vumeter_t;
 
 /*==================[external data declaration]==============================*/
@@ -52,7 +57,11 @@ typedef struct{
 void VumeterInit(vumeter_t * vum);
 
 /**
- * @brief 
+ * @brief Updates the vumeter bars
+ * 
+ * @note Only the steps that changed since the last update (and the moved peak
+ * markers) are sent to the display, so the SPI traffic follows how much the
+ * spectrum changed. With more than 32 bars the whole bars are redrawn.
  * 
  * @param vum       Structure with the plot configuration
  * @param values    height of each vumeter bar (from 0 to 256)
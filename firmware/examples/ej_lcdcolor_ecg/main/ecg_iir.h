@@ -0,0 +1,22 @@
+/**
+ * @file ecg_iir.h
+ * @brief Filtros Butterworth para fs = 200 Hz
+ * @note Creado con iir_design.py: --filtro hp:1:2 --filtro lp:30:2
+ */
+#include "iir_filter.h"
+
+/* Pasa altos de orden 2, fc = 1 Hz */
+static const iir_design_t ecg_hp_1 = {
+    .n_sos = 1,
+    .coeff = {
+        {0.978033662f, -1.95606732f, 0.978033662f, -1.95558465f, 0.956550121f}
+    }
+};
+
+/* Pasa bajos de orden 2, fc = 30 Hz */
+static const iir_design_t ecg_lp_30 = {
+    .n_sos = 1,
+    .coeff = {
+        {0.131113648f, 0.262227297f, 0.131113648f, -0.747830272f, 0.272284865f}
+    }
+};
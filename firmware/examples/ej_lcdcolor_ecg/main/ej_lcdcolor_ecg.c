@@ -27,6 +27,23 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 05/04/2024 | Document creation		                         |
+ * | 14/10/2026 | Textos, íconos e imagen dibujados con la escena |
+ * | 			| de ILI9341 (solo se redibuja lo que cambia)	 |
+ * | 14/10/2026 | Corazón como imagen comprimida (heart_img.h)	 |
+ * | 14/10/2026 | Señal cruda y filtrada graficadas por bloques	 |
+ * | 15/10/2026 | Frecuencia cardíaca por detección de QRS		 |
+ * | 			| (correlación con una plantilla)				 |
+ * | 15/10/2026 | Detección de QRS por Pan-Tompkins (qrs_detector),|
+ * | 			| sin latencia de bloque						 |
+ * | 15/10/2026 | Filtros diseñados off-line (ecg_iir.h)		 |
+ * | 15/10/2026 | Supervisión del período de procesamiento		 |
+ * | 15/10/2026 | Trazos suavizados (antialias) por columna      |
+ * | 15/10/2026 | Bloques filtrados compartidos por el gráfico y |
+ * | 			| el detector de QRS (sample_bus), sin copias	 |
+ * | 15/10/2026 | Filtros iniciados en el estado estacionario	 |
+ * | 			| (sin transitorio al arrancar)					 |
+ * | 15/10/2026 | Escalado de frecuencia y light sleep: máxima	 |
+ * | 			| frecuencia solo durante el dibujado			 |
  *
  * @author Albano Peñalva (albano.penalva@uner.edu.ar)
  *
@@ -38,24 +55,32 @@
 #include <string.h>
 #include "sys/time.h"
 
-#include "iir_filter.h"
+#include "ecg_iir.h"         /* python iir_design.py ecg --fs 200 --filtro hp:1:2 --filtro lp:30:2 */
+#include "qrs_detector.h"
+#include "period_monitor.h"
+#include "sample_bus.h"
 #include "timer_mcu.h"
 #include "gpio_mcu.h"
 #include "rtc_mcu.h"
+#include "power_mcu.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "switch.h"
 #include "ili9341.h"
+#include "ili9341_scene.h"
 #include "roll_plot.h"
-#include "heart_pic.h"
+#include "heart_img.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE         256
 #define SAMPLE_FREQ	        200
 #define T_SENIAL            4000 
 #define CHUNK               16 
 #define LIGHT_BLUE_COLOR    0x0B2F
+#define TOLERANCIA          2000        /* Atraso aceptado del procesamiento de un bloque (us) */
+#define BLOQUES_BUS         4           /* Bloques de muestras compartidos por el gráfico y el detector */
+#define AVISO_BLOQUE        0x01        /* Bit de notificación de un bloque nuevo */
 /*==================[internal data definition]===============================*/
 float ecg[] = {
      76,  76,  77,  77,  76,  83,  85,  78,  76,  85,  93,  85,  79,
@@ -79,20 +104,78 @@ float ecg[] = {
      69,  75,  79,  75,  68,  68,  76,  76,  69,  67,  74,  81,  77,
      71,  72,  82,  82,  76,  77,  76,  76,  75
 };
-static float ecg_filt[CHUNK];
+static float hp_delay[1][IIR_N_DELAY];
+static float lp_delay[1][IIR_N_DELAY];
+static qrs_detector_t qrs;
+static period_monitor_t monitor_bloque;
+/* Cada bloque: CHUNK muestras crudas seguidas de CHUNK filtradas */
+SAMPLE_BUS_DEFINE(bus_ecg, float, 2*CHUNK, BLOQUES_BUS);
+static int8_t suscriptor_plot, suscriptor_qrs;
+TaskHandle_t filter_task_handle = NULL;
 TaskHandle_t plot_task_handle = NULL;
-uint8_t frecuencia_cardiaca = 71;
+TaskHandle_t qrs_task_handle = NULL;
+volatile uint8_t frecuencia_cardiaca = 0;
+int8_t freq_id, hour_min_id, heart_id;
 /*==================[internal functions declaration]=========================*/
 /**
  * @brief Función ejecutada en la interrupción del Timer
  * 
  */
 void FuncTimerSenial(void* param){
-    xTaskNotifyGive(plot_task_handle);
+    xTaskNotifyGive(filter_task_handle);
 }
 
 /**
- * @brief Tarea encargada de filtrar la señal y graficarla en
+ * @brief Tarea encargada de filtrar la señal y publicar cada bloque
+ * (crudo y filtrado) en el bus, una sola vez para todos los suscriptores.
+ * 
+ */
+static void FilterTask(void *pvParameter){
+    static uint8_t indice = 0;
+    sample_block_t *bloque;
+    float *muestras;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        PeriodMonitorTick(&monitor_bloque);
+
+        /* Si el gráfico o el detector se atrasan no hay bloque libre y
+         * éste se pierde (SampleBusDropped) */
+        bloque = SampleBusAcquire(&bus_ecg);
+        if(bloque != NULL){
+            muestras = bloque->data;
+            memcpy(muestras, &ecg[indice], CHUNK * sizeof(float));
+            /* Filtrado de señal, directamente en el bloque */
+            IirFilterConst(&ecg_hp_1, hp_delay, &ecg[indice], &muestras[CHUNK], CHUNK);
+            IirFilterConst(&ecg_lp_30, lp_delay, &muestras[CHUNK], &muestras[CHUNK], CHUNK);
+            SampleBusPublish(&bus_ecg, bloque, 2*CHUNK);
+        }
+        indice += CHUNK;
+    }
+}
+
+/**
+ * @brief Tarea encargada de detectar los complejos QRS en la señal
+ * filtrada del bus.
+ * 
+ */
+static void QrsTask(void *pvParameter){
+    const sample_block_t *bloque;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while((bloque = SampleBusTake(&bus_ecg, suscriptor_qrs)) != NULL){
+            /* La frecuencia sale del promedio de los últimos intervalos RR */
+            if(QrsDetectorProcess(&qrs, &((const float *)bloque->data)[CHUNK], CHUNK) > 0){
+                frecuencia_cardiaca = QrsHeartRate(&qrs);
+            }
+            SampleBusRelease(&bus_ecg, bloque);
+        }
+    }
+}
+
+/**
+ * @brief Tarea encargada de graficar la señal cruda y filtrada en
  * el display LCD.
  * 
  */
@@ -102,6 +185,10 @@ static void PlotTask(void *pvParameter){
     static char hour_min[] = "00:00";
     static bool beat = true;
     rtc_t actual_time;
+    static int16_t ecg_block[2][CHUNK];
+    static uint32_t perdidos = 0;
+    const sample_block_t *bloque;
+    const float *muestras;
 
     /* Configuración de área de gráfica */
     plot_t plot1 = {
@@ -110,10 +197,19 @@ static void PlotTask(void *pvParameter){
         .width = 240,
         .height = 100,
         .x_scale = 30,
-        .back_color = ILI9341_WHITE
+        .back_color = ILI9341_WHITE,
+        .antialias = true
 	};
 	RTPlotInit(&plot1); 
-    /* Configuración de señal a graficar */
+    /* Configuración de señales a graficar (cruda y filtrada) */
+    signal_t ecg_raw = {
+        .y_scale = 30,
+        .y_offset = 0,
+        .color = LIGHT_BLUE_COLOR,
+        .x_prev = 0,
+        .y_prev = 0
+	};
+	RTSignalInit(&plot1, &ecg_raw);
     signal_t ecg1 = {
         .y_scale = 40,
         .y_offset = 50,
@@ -122,40 +218,63 @@ static void PlotTask(void *pvParameter){
         .y_prev = 0
 	};
 	RTSignalInit(&plot1, &ecg1);
+    signal_t * signals[] = {&ecg_raw, &ecg1};
+    const int16_t * samples[] = {ecg_block[0], ecg_block[1]};
+    period_stats_t estadisticas;
 
     while(true){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        
-        /* Filtrado de señal */
-        HiPassFilter(&ecg[indice], ecg_filt, CHUNK);
-        LowPassFilter(ecg_filt, ecg_filt, CHUNK);
-
-        /* Graficación de señal */
-        for(uint8_t i=0; i<CHUNK; i++){
-            RTPlotDraw(&ecg1, ecg_filt[i]);
-        }
-        indice += CHUNK;
+        while((bloque = SampleBusTake(&bus_ecg, suscriptor_plot)) != NULL){
+            /* Graficación de señales: todo el bloque en una sola escritura */
+            muestras = bloque->data;
+            for(uint8_t i=0; i<CHUNK; i++){
+                ecg_block[0][i] = muestras[i];
+                ecg_block[1][i] = muestras[CHUNK + i];
+            }
+            SampleBusRelease(&bus_ecg, bloque);
+            RTPlotDrawBlock(&plot1, signals, 2, samples, CHUNK);
+            indice += CHUNK;
 
-        if(indice == 0){
-            /* Actualización de datos en display */
-            ILI9341DrawString(20, 60, freq, &font_89, ILI9341_WHITE, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, LIGHT_BLUE_COLOR, LIGHT_BLUE_COLOR);
-            sprintf(freq, "%03i", frecuencia_cardiaca);
-            RtcRead(&actual_time);
-            sprintf(hour_min, "%02i:%02i", actual_time.hour%MAX_HOUR, actual_time.min%MAX_MIN);
-            ILI9341DrawString(20, 60, freq, &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-            ILI9341DrawString(10, 8, hour_min, &font_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-            if(beat){
-                ILI9341DrawPicture(170, 65, HEART_WIDTH, HEART_HEIGHT, heart);
-            }else{
-                ILI9341DrawFilledRectangle(170, 65, 170+HEART_WIDTH, 65+HEART_HEIGHT, ILI9341_WHITE);
+            if(indice == 0){
+                /* Actualización de datos en display (solo se redibujan los
+                 * caracteres que cambiaron y el corazón) */
+                sprintf(freq, "%03i", frecuencia_cardiaca);
+                RtcRead(&actual_time);
+                sprintf(hour_min, "%02i:%02i", actual_time.hour%MAX_HOUR, actual_time.min%MAX_MIN);
+                ILI9341SceneSetText(freq_id, freq);
+                ILI9341SceneSetText(hour_min_id, hour_min);
+                ILI9341SceneSetVisible(heart_id, beat);
+                ILI9341SceneFlush();
+                beat = !beat;
+                /* Bloques atrasados: el filtrado no terminó antes del siguiente
+                 * aviso */
+                PeriodMonitorGet(&monitor_bloque, &estadisticas);
+                if(estadisticas.missed > 0){
+                    PeriodMonitorPrint();
+                    PeriodMonitorReset(&monitor_bloque);
+                }
+                /* Bloques perdidos: el gráfico o el detector retenían todos
+                 * los bloques del bus */
+                if(SampleBusDropped(&bus_ecg) != perdidos){
+                    perdidos = SampleBusDropped(&bus_ecg);
+                    printf("bus_ecg: %lu bloques perdidos\n", (unsigned long)perdidos);
+                }
             }
-            beat = !beat;
         }
     }
 }
 /*==================[external functions definition]==========================*/
 void app_main(void){
+    /* Gestión de energía: la CPU baja a 40 MHz cuando espera y el dibujado
+     * de la escena corre a la máxima frecuencia (PowerBurstBegin) */
+    power_config_t energia = {
+        .max_freq_mhz = 160,
+        .min_freq_mhz = 40,
+        .light_sleep = true,
+    };
+    if (!PowerInit(&energia))
+        printf("Gestión de energía no disponible (CONFIG_PM_ENABLE)\r\n");
+
     /* Configuración de timer */
     timer_config_t timer_senial = {
         .timer = TIMER_B,
@@ -164,26 +283,41 @@ void app_main(void){
         .param_p = NULL
     };
     TimerInit(&timer_senial);
+    PeriodMonitorInit(&monitor_bloque, "ecg", T_SENIAL*CHUNK, TOLERANCIA);
 
     /* Configuración de display */
     ILI9341Init(SPI_1, GPIO_9, GPIO_18);
 	ILI9341Rotate(ILI9341_Portrait_2);
-	ILI9341Fill(ILI9341_WHITE);
-    ILI9341DrawFilledRectangle(0, 0, 240, 40, LIGHT_BLUE_COLOR);
-    ILI9341DrawFilledRectangle(0, 280, 240, 320, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(10, 290, "TIME10S", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(178, 290, "00:04", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawString(178, 120, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawString(20, 60, "000", &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
-    ILI9341DrawIcon(170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-    ILI9341DrawIcon(200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
-
-    /* Filtros */
-    LowPassInit(SAMPLE_FREQ, 30, ORDER_2);
-    HiPassInit(SAMPLE_FREQ, 1, ORDER_2);
-
-    /* Tarea para actualizar pantalla */
+    /* Escena: los ítems se dibujan en el orden en que se agregan */
+    ILI9341SceneInit(ILI9341_WHITE);
+    ILI9341SceneAddRect(0, 0, 239, 40, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddRect(0, 280, 239, 319, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddText(10, 290, "TIME10S", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddText(178, 290, "00:04", &font_22, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddText(178, 120, "bpm", &font_22, LIGHT_BLUE_COLOR, ILI9341_WHITE);
+    freq_id = ILI9341SceneAddText(20, 60, "000", &font_89, LIGHT_BLUE_COLOR, ILI9341_WHITE);
+    hour_min_id = ILI9341SceneAddText(10, 8, "00:00", &font_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddIcon(170, 8, ICON_BLUETOOTH, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    ILI9341SceneAddIcon(200, 8, ICON_BAT_3, &icon_30, ILI9341_WHITE, LIGHT_BLUE_COLOR);
+    heart_id = ILI9341SceneAddImage(170, 65, &heart_img);
+    ILI9341SceneSetVisible(heart_id, false);
+    /* Primer dibujado de la pantalla completa */
+    ILI9341SceneInvalidate(0, 0, ILI9341_WIDTH-1, ILI9341_HEIGHT-1);
+    ILI9341SceneFlush();
+
+    /* Filtros en el estado estacionario de la primera muestra: la salida es
+     * válida desde el primer bloque, sin transitorio */
+    IirDesignWarmStart(&ecg_lp_30, lp_delay, IirDesignWarmStart(&ecg_hp_1, hp_delay, ecg[0]));
+
+    /* Detector de QRS */
+    QrsDetectorInit(&qrs, SAMPLE_FREQ);
+
+    /* Tareas suscriptas al bus (antes del primer bloque) y tarea que lo publica */
     xTaskCreate(&PlotTask, "Plot", 4096, NULL, 5, &plot_task_handle);
+    xTaskCreate(&QrsTask, "Qrs", 2048, NULL, 5, &qrs_task_handle);
+    suscriptor_plot = SampleBusSubscribe(&bus_ecg, plot_task_handle, AVISO_BLOQUE);
+    suscriptor_qrs = SampleBusSubscribe(&bus_ecg, qrs_task_handle, AVISO_BLOQUE);
+    xTaskCreate(&FilterTask, "Filter", 2048, NULL, 6, &filter_task_handle);
 
     /* Configuración inicial de RTC */
     // rtc_t config_time = {
@@ -0,0 +1,72 @@
+/**
+ * @file heart_img.h
+ * @brief Imagen heart (52x45 pixeles, 79 colores)
+ * @note Creado con pic_to_edu.py a partir de heart_pic.h
+ */
+#include <stdint.h>
+#include "ili9341.h"
+
+#define HEART_WIDTH     52
+#define HEART_HEIGHT    45
+
+const uint16_t heart_palette[] = {
+    0xd000,0xd020,0xd021,0xd041,0xd061,0xd062,0xd082,0xd0a2,0xd0a3,0xd0c3,0xd0e3,0xd124,
+    0xd145,0xd165,0xd185,0xd1a6,0xd1a7,0xd1c7,0xd966,0xd9c7,0xd9e7,0xda08,0xda28,0xda49,
+    0xda69,0xda8a,0xdacb,0xdaeb,0xdb0c,0xdb2c,0xdb4d,0xdb8e,0xe32c,0xe34d,0xe36d,0xe38e,
+    0xe3ae,0xe3af,0xe3ce,0xe3cf,0xe410,0xe431,0xe451,0xe471,0xe492,0xe4b2,0xecb2,0xecd3,
+    0xecf3,0xed14,0xed55,0xed75,0xed76,0xed96,0xedb6,0xedf7,0xee18,0xf617,0xf638,0xf659,
+    0xf679,0xf699,0xf69a,0xf6ba,0xf6db,0xf6fb,0xf6fc,0xf71b,0xf71c,0xff3c,0xff5c,0xff5d,
+    0xff7d,0xff9d,0xff9e,0xffbe,0xffde,0xffdf,0xffff
+};
+
+const uint32_t heart_rows[] = {
+    0,2,30,55,78,99,118,135,154,169,179,187,
+    195,203,211,219,227,235,243,253,263,273,284,294,
+    304,316,326,337,349,361,372,383,393,403,413,423,
+    434,446,458,470,482,494,506,518,527
+};
+
+const uint8_t heart_data[] = {
+    0xb3,0x4e,0x88,0x4e,0x09,0x49,0x32,0x22,0x16,0x12,0x0d,0x13,0x1a,0x2b,0x40,0x8d,
+    0x4e,0x09,0x44,0x2e,0x1c,0x14,0x0d,0x0d,0x15,0x20,0x31,0x47,0x88,0x4e,0x86,0x4e,
+    0x02,0x44,0x21,0x04,0x88,0x00,0x01,0x17,0x3d,0x89,0x4e,0x02,0x41,0x1a,0x01,0x87,
+    0x00,0x02,0x03,0x1a,0x3f,0x86,0x4e,0x85,0x4e,0x01,0x2e,0x04,0x8b,0x00,0x01,0x02,
+    0x29,0x87,0x4e,0x01,0x31,0x05,0x8b,0x00,0x02,0x01,0x27,0x4d,0x84,0x4e,0x83,0x4e,
+    0x01,0x4d,0x1c,0x8f,0x00,0x01,0x1c,0x4d,0x84,0x4e,0x00,0x28,0x8f,0x00,0x01,0x17,
+    0x4a,0x83,0x4e,0x83,0x4e,0x00,0x1d,0x91,0x00,0x00,0x1e,0x83,0x4e,0x00,0x2a,0x91,
+    0x00,0x01,0x16,0x4c,0x82,0x4e,0x82,0x4e,0x00,0x2f,0x93,0x00,0x03,0x2d,0x4e,0x4e,
+    0x36,0x93,0x00,0x00,0x26,0x82,0x4e,0x81,0x4e,0x01,0x45,0x06,0x93,0x00,0x03,0x03,
+    0x3f,0x47,0x08,0x93,0x00,0x03,0x01,0x3c,0x4e,0x4e,0x81,0x4e,0x00,0x25,0x95,0x00,
+    0x01,0x16,0x1d,0x95,0x00,0x02,0x19,0x4e,0x4e,0x02,0x4e,0x4d,0x07,0xad,0x00,0x02,
+    0x01,0x45,0x4e,0x01,0x4e,0x38,0xaf,0x00,0x01,0x30,0x4e,0x01,0x4e,0x2a,0xaf,0x00,
+    0x01,0x20,0x4e,0x01,0x4e,0x21,0xaf,0x00,0x01,0x16,0x4e,0x01,0x4e,0x1a,0xaf,0x00,
+    0x01,0x10,0x4e,0x01,0x4e,0x1a,0xaf,0x00,0x01,0x11,0x4e,0x01,0x4e,0x23,0xaf,0x00,
+    0x01,0x18,0x4e,0x01,0x4e,0x2e,0xaf,0x00,0x01,0x23,0x4e,0x01,0x4e,0x3c,0xaf,0x00,
+    0x01,0x32,0x4e,0x02,0x4e,0x4d,0x09,0xad,0x00,0x02,0x01,0x47,0x4e,0x81,0x4e,0x00,
+    0x22,0xad,0x00,0x02,0x17,0x4e,0x4e,0x81,0x4e,0x00,0x3d,0xad,0x00,0x02,0x33,0x4e,
+    0x4e,0x82,0x4e,0x00,0x17,0xab,0x00,0x03,0x0c,0x4d,0x4e,0x4e,0x82,0x4e,0x00,0x3c,
+    0xab,0x00,0x00,0x33,0x82,0x4e,0x83,0x4e,0x00,0x1d,0xa9,0x00,0x00,0x15,0x83,0x4e,
+    0x83,0x4e,0x01,0x47,0x09,0xa7,0x00,0x01,0x03,0x3f,0x83,0x4e,0x84,0x4e,0x00,0x34,
+    0xa7,0x00,0x00,0x2b,0x84,0x4e,0x85,0x4e,0x00,0x1e,0xa5,0x00,0x01,0x17,0x4d,0x84,
+    0x4e,0x85,0x4e,0x01,0x4b,0x0f,0xa3,0x00,0x01,0x0a,0x46,0x85,0x4e,0x86,0x4e,0x01,
+    0x42,0x09,0xa1,0x00,0x01,0x03,0x3b,0x86,0x4e,0x87,0x4e,0x01,0x3a,0x03,0xa0,0x00,
+    0x00,0x32,0x87,0x4e,0x88,0x4e,0x01,0x33,0x01,0x9e,0x00,0x00,0x2b,0x88,0x4e,0x89,
+    0x4e,0x00,0x30,0x9d,0x00,0x00,0x27,0x89,0x4e,0x8a,0x4e,0x00,0x2c,0x9b,0x00,0x00,
+    0x1f,0x8a,0x4e,0x8b,0x4e,0x00,0x2c,0x99,0x00,0x00,0x23,0x8b,0x4e,0x8c,0x4e,0x00,
+    0x2f,0x97,0x00,0x00,0x27,0x8c,0x4e,0x8d,0x4e,0x01,0x32,0x03,0x94,0x00,0x00,0x2a,
+    0x8d,0x4e,0x8e,0x4e,0x01,0x37,0x06,0x91,0x00,0x01,0x03,0x31,0x8e,0x4e,0x8f,0x4e,
+    0x01,0x3e,0x0b,0x8f,0x00,0x01,0x07,0x39,0x8f,0x4e,0x90,0x4e,0x01,0x47,0x16,0x8d,
+    0x00,0x01,0x0e,0x41,0x90,0x4e,0x91,0x4e,0x01,0x4d,0x24,0x8b,0x00,0x01,0x1b,0x4a,
+    0x91,0x4e,0x93,0x4e,0x01,0x35,0x07,0x87,0x00,0x01,0x04,0x2f,0x93,0x4e,0x94,0x4e,
+    0x01,0x45,0x18,0x85,0x00,0x01,0x11,0x3f,0x94,0x4e,0x96,0x4e,0x06,0x31,0x07,0x00,
+    0x00,0x04,0x2a,0x4d,0x95,0x4e,0x97,0x4e,0x03,0x48,0x23,0x1b,0x43,0x97,0x4e,0xb3,
+    0x4e
+};
+
+const ili9341_image_t heart_img = {
+    HEART_WIDTH,
+    HEART_HEIGHT,
+    heart_palette,
+    heart_rows,
+    heart_data
+};
@@ -13,42 +13,262 @@
 #include "roll_plot.h"
 #include "ili9341.h"
 /*==================[macros and definitions]=================================*/
+#define BLOCK_COLUMNS   32      /*!< Maximum number of columns rendered by RTPlotDrawBlock in one window */
 
 /*==================[internal data declaration]==============================*/
+/**
+ * @brief Columns of a block of samples (see RTPlotDrawBlock)
+ */
+typedef struct{
+    plot_t * plot;                                          /*!< plot */
+    signal_t ** signals;                                    /*!< signals drawn on the plot */
+    uint8_t n_signals;                                      /*!< number of signals */
+    uint16_t first;                                         /*!< first column (relative to x_pos) */
+    uint16_t n_columns;                                     /*!< number of columns */
+    uint16_t y_min[RTPLOT_MAX_SIGNALS][BLOCK_COLUMNS + 1];  /*!< lowest y of each signal on each column (1/RTPLOT_SUBPIXEL pixels) */
+    uint16_t y_max[RTPLOT_MAX_SIGNALS][BLOCK_COLUMNS + 1];  /*!< highest y of each signal on each column (< y_min: empty) */
+} plot_block_t;
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static plot_block_t block;
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* y position of a data value, limited to the plot */
+static int16_t PlotY(signal_t * signal, int16_t data){
+    plot_t * plot = signal->plot;
+    int16_t y = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
+
+    if (y < plot->y_pos){
+        y = plot->y_pos;
+    }
+    if (y > (plot->y_pos + plot->height)){
+        y = plot->y_pos + plot->height;
+    }
+    return y;
+}
+
+/* y position of a data value in 1/RTPLOT_SUBPIXEL pixels, limited to the plot */
+static uint16_t PlotYSub(signal_t * signal, int16_t data){
+    plot_t * plot = signal->plot;
+    int32_t y = (int32_t)(plot->y_pos + plot->height - signal->y_offset) * RTPLOT_SUBPIXEL
+                - ((int32_t)data * signal->y_scale * RTPLOT_SUBPIXEL) / 100;
+
+    if (y < plot->y_pos * RTPLOT_SUBPIXEL){
+        y = plot->y_pos * RTPLOT_SUBPIXEL;
+    }
+    if (y > (plot->y_pos + plot->height) * RTPLOT_SUBPIXEL){
+        y = (plot->y_pos + plot->height) * RTPLOT_SUBPIXEL;
+    }
+    return y;
+}
+
+/* Blend of two RGB565 colors, alpha from 0 (back) to 32 (fore): the three
+ * channels are spread over a 32 bit word and scaled with one multiplication */
+static uint16_t Blend565(uint16_t fore, uint16_t back, uint8_t alpha){
+    uint32_t f = (fore | ((uint32_t)fore << 16)) & 0x07E0F81F;
+    uint32_t b = (back | ((uint32_t)back << 16)) & 0x07E0F81F;
+    uint32_t c = ((((f - b) * alpha) >> 5) + b) & 0x07E0F81F;
+
+    return (uint16_t)((c >> 16) | c);
+}
+
+/* Render function of a block: background and the segments of every signal (the last one on top) */
+static void PlotBlockRender(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+    plot_block_t * b = (plot_block_t *)param;
+    uint16_t color, k;
+    int32_t top, cover;
+    /* column of the block for x0 (the window may start after the plot wrapped) */
+    uint16_t k0 = (x0 - b->plot->x_pos + b->plot->width - b->first) % b->plot->width;
+
+    for (uint16_t l = 0; l < lines; l++){
+        /* pixel row [top, top + RTPLOT_SUBPIXEL) */
+        top = (int32_t)(y0 + l) * RTPLOT_SUBPIXEL;
+        for (uint16_t j = 0; j < width; j++){
+            k = k0 + j;
+            color = b->plot->back_color;
+            for (uint8_t s = 0; s < b->n_signals; s++){
+                if (b->y_max[s][k] < b->y_min[s][k]){
+                    continue;
+                }
+                if (!b->plot->antialias){
+                    if (top / RTPLOT_SUBPIXEL >= b->y_min[s][k] / RTPLOT_SUBPIXEL &&
+                        top / RTPLOT_SUBPIXEL <= b->y_max[s][k] / RTPLOT_SUBPIXEL){
+                        color = b->signals[s]->color;
+                    }
+                    continue;
+                }
+                /* part of the row covered by the span [y_min, y_max + 1 pixel) */
+                cover = ((top + RTPLOT_SUBPIXEL < b->y_max[s][k] + RTPLOT_SUBPIXEL) ? top + RTPLOT_SUBPIXEL : b->y_max[s][k] + RTPLOT_SUBPIXEL)
+                        - ((top > b->y_min[s][k]) ? top : b->y_min[s][k]);
+                if (cover >= RTPLOT_SUBPIXEL){
+                    color = b->signals[s]->color;
+                } else if (cover > 0){
+                    color = Blend565(b->signals[s]->color, color, cover * 32 / RTPLOT_SUBPIXEL);
+                }
+            }
+            *strip++ = ILI9341_STRIP_COLOR(color);
+        }
+    }
+}
+
+/* Sends the columns of a block, in two windows when it wraps at the right side */
+static void PlotBlockFlush(plot_block_t * b){
+    plot_t * plot = b->plot;
+    uint16_t last = b->first + b->n_columns - 1;
+
+    if (last < plot->width){
+        ILI9341RenderArea(plot->x_pos + b->first, plot->y_pos, plot->x_pos + last,
+            plot->y_pos + plot->height, PlotBlockRender, b);
+    } else{
+        ILI9341RenderArea(plot->x_pos + b->first, plot->y_pos, plot->x_pos + plot->width - 1,
+            plot->y_pos + plot->height, PlotBlockRender, b);
+        ILI9341RenderArea(plot->x_pos, plot->y_pos, plot->x_pos + last - plot->width,
+            plot->y_pos + plot->height, PlotBlockRender, b);
+    }
+}
+
+/* Render function of a plot column: background and the signal between y_min and y_max */
+static void PlotColumn(uint16_t *strip, uint16_t x0, uint16_t y0, uint16_t width, uint16_t lines, void *param){
+    signal_t * signal = (signal_t *)param;
+
+    for (uint16_t l = 0; l < lines; l++){
+        if ((y0 + l) >= signal->y_min && (y0 + l) <= signal->y_max){
+            strip[l] = ILI9341_STRIP_COLOR(signal->color);
+        } else{
+            strip[l] = ILI9341_STRIP_COLOR(signal->plot->back_color);
+        }
+    }
+}
+
+/* Scroll mode: each sample rewrites only the column of the newest point */
+static void RTPlotScroll(signal_t * signal, int16_t y_act){
+    plot_t * plot = signal->plot;
+    int32_t x_act, column, column_act, length = (int32_t)plot->width * 100;
+    uint16_t y_old;
+
+    /* positions relative to the left side of the plot */
+    column = (signal->x_prev - plot->x_pos * 100) / 100;
+    x_act = (signal->x_prev - plot->x_pos * 100) + plot->x_scale;
+    column_act = x_act / 100;
+    if (column_act == column){
+        /* same column: only the pixels that extend its segment are drawn */
+        column_act %= plot->width;
+        if (y_act < signal->y_min){
+            y_old = signal->y_min;
+            signal->y_min = y_act;
+            ILI9341RenderArea(plot->x_pos + column_act, y_act, plot->x_pos + column_act, y_old - 1, PlotColumn, signal);
+        }
+        if (y_act > signal->y_max){
+            y_old = signal->y_max;
+            signal->y_max = y_act;
+            ILI9341RenderArea(plot->x_pos + column_act, y_old + 1, plot->x_pos + column_act, y_act, PlotColumn, signal);
+        }
+        signal->x_prev = plot->x_pos * 100 + x_act % length;
+        signal->y_prev = y_act;
+        return;
+    } else{
+        /* new column: it joins the previous point with the new one. Columns
+         * skipped when x_scale > 100 get the same segment */
+        signal->y_min = (y_act < signal->y_prev) ? y_act : signal->y_prev;
+        signal->y_max = (y_act > signal->y_prev) ? y_act : signal->y_prev;
+        for (column++; column < column_act; column++){
+            ILI9341RenderArea(plot->x_pos + column % plot->width, plot->y_pos,
+                plot->x_pos + column % plot->width, plot->y_pos + plot->height, PlotColumn, signal);
+        }
+    }
+    column_act %= plot->width;
+    ILI9341RenderArea(plot->x_pos + column_act, plot->y_pos,
+        plot->x_pos + column_act, plot->y_pos + plot->height, PlotColumn, signal);
+    /* the newest column is shown at the right side */
+    ILI9341Scroll(column_act + 1);
+    signal->x_prev = plot->x_pos * 100 + x_act % length;
+    signal->y_prev = y_act;
+}
+
+/* Erase mode with several samples per column: the samples of a column only
+ * widen its span, which is drawn once (with the erase of the next column)
+ * when the first sample of the next column arrives */
+static void RTPlotEnvelope(signal_t * signal, int16_t y_act){
+    plot_t * plot = signal->plot;
+    uint16_t column = signal->x_prev / 100;
+    uint16_t x_act = signal->x_prev + plot->x_scale;
+    uint16_t gap;
+
+    if (x_act / 100 == column){
+        if (y_act < signal->y_min){
+            signal->y_min = y_act;
+        }
+        if (y_act > signal->y_max){
+            signal->y_max = y_act;
+        }
+    } else{
+        /* the column is complete (it was erased ahead): one span, and the erase of the next one */
+        if (signal->y_min <= signal->y_max){
+            ILI9341DrawFilledRectangle(column, signal->y_min, column, signal->y_max, signal->color);
+        }
+        gap = (column + 1 < plot->x_pos + plot->width) ? (column + 1) : plot->x_pos;
+        ILI9341DrawFilledRectangle(gap, plot->y_pos, gap, plot->y_pos + plot->height, plot->back_color);
+        if ((x_act / 100) < (plot->x_pos + plot->width)){
+            /* the new column starts joined to the previous point */
+            signal->y_min = (y_act < signal->y_prev) ? y_act : signal->y_prev;
+            signal->y_max = (y_act > signal->y_prev) ? y_act : signal->y_prev;
+        } else{
+            /* when reach right limit it start again from left */
+            x_act = plot->x_pos * 100;
+            signal->y_min = y_act;
+            signal->y_max = y_act;
+        }
+    }
+    signal->x_prev = x_act;
+    signal->y_prev = y_act;
+}
 
 /*==================[external functions definition]==========================*/
 void RTPlotInit(plot_t * plot){
+    ili9341_orientation_t orientation = ILI9341GetOrientation();
+
 	ILI9341DrawFilledRectangle(plot->x_pos, plot->y_pos,
 			plot->x_pos + plot->width, plot->y_pos + plot->height,
 			plot->back_color);
-
+    if (plot->scroll){
+        if (orientation == ILI9341_Landscape_1 || orientation == ILI9341_Landscape_2){
+            ILI9341ScrollArea(plot->x_pos, plot->width);
+            /* the first column is shown at the right side */
+            ILI9341Scroll(1);
+        } else{
+            plot->scroll = false;
+        }
+    }
 }
 
 void RTSignalInit(plot_t * plot, signal_t * signal){
 	signal->x_prev = plot->x_pos * 100;
 	signal->y_prev = plot->y_pos + plot->height - signal->y_offset;
+	/* empty first column */
+	signal->y_min = signal->y_prev + 1;
+	signal->y_max = signal->y_prev;
+	signal->y_prev_sub = signal->y_prev * RTPLOT_SUBPIXEL;
+	signal->y_min_sub = signal->y_min * RTPLOT_SUBPIXEL;
+	signal->y_max_sub = signal->y_max * RTPLOT_SUBPIXEL;
 	signal->plot = plot;
 }
 
 void RTPlotDraw(signal_t * signal, int16_t data){
     int16_t x_act, y_act, blanck_act;
     plot_t * plot = signal->plot;
-    /* next point to draw */
-    y_act = plot->y_pos + plot->height - (data * signal->y_scale) / 100 - signal->y_offset;
-    /* it can exceed plot limits */
-    if (y_act < plot->y_pos){
-        y_act = plot->y_pos;
+    /* next point to draw (it can't exceed plot limits) */
+    y_act = PlotY(signal, data);
+    if (plot->scroll){
+        RTPlotScroll(signal, y_act);
+        return;
     }
-    if (y_act > (plot->y_pos + plot->height)){
-        y_act = plot->y_pos + plot->height;
+    if (plot->x_scale < 100){
+        RTPlotEnvelope(signal, y_act);
+        return;
     }
     /* when reach right limit it start again from left */
     x_act = signal->x_prev + plot->x_scale;
@@ -75,4 +295,104 @@ void RTPlotDraw(signal_t * signal, int16_t data){
     signal->y_prev = y_act;
 }
 
+void RTPlotDrawBlock(plot_t * plot, signal_t * signals[], uint8_t n_signals, const int16_t * samples[], uint16_t n){
+    uint16_t i = 0, k, c, step, frac, frac_act, column, limit;
+    int16_t y, y_prev, y_a, y_b;
+    uint8_t s;
+
+    if (n_signals == 0 || n_signals > RTPLOT_MAX_SIGNALS){
+        return;
+    }
+    /* one column of the block is kept for the erase ahead of the newest column */
+    limit = (plot->width - 2 < BLOCK_COLUMNS - 1) ? (plot->width - 2) : (BLOCK_COLUMNS - 1);
+    if ((plot->x_scale + 99) / 100 > limit){
+        /* too many columns per sample for a block */
+        for (i = 0; i < n; i++){
+            for (s = 0; s < n_signals; s++){
+                RTPlotDraw(signals[s], samples[s][i]);
+            }
+        }
+        return;
+    }
+    block.plot = plot;
+    block.signals = signals;
+    block.n_signals = n_signals;
+    /* all the signals of the plot advance together, the position is split in
+     * column and hundredths of pixel so no divisions are needed per sample */
+    column = signals[0]->x_prev / 100 - plot->x_pos;
+    frac = signals[0]->x_prev % 100;
+    while (i < n){
+        block.first = column;
+        for (s = 0; s < n_signals; s++){
+            block.y_min[s][0] = signals[s]->y_min_sub;
+            block.y_max[s][0] = signals[s]->y_max_sub;
+        }
+        k = 0;
+        while (i < n){
+            step = 0;
+            frac_act = frac + plot->x_scale;
+            while (frac_act >= 100){
+                frac_act -= 100;
+                step++;
+            }
+            if (k + step > limit){
+                break;
+            }
+            for (s = 0; s < n_signals; s++){
+                y = PlotYSub(signals[s], samples[s][i]);
+                y_prev = signals[s]->y_prev_sub;
+                if (step == 0){
+                    /* same column: the segment is added to it */
+                    if (y < block.y_min[s][k]){
+                        block.y_min[s][k] = y;
+                    }
+                    if (y > block.y_max[s][k]){
+                        block.y_max[s][k] = y;
+                    }
+                }
+                for (c = 1; c <= step; c++){
+                    /* new columns join the previous point with the new one */
+                    y_a = y_prev + (y - y_prev) * (c - 1) / step;
+                    y_b = y_prev + (y - y_prev) * c / step;
+                    if (!plot->scroll && (column + k + c) % plot->width == 0){
+                        /* erase mode starts again from the left side */
+                        y_a = y;
+                    }
+                    block.y_min[s][k + c] = (y_a < y_b) ? y_a : y_b;
+                    block.y_max[s][k + c] = (y_a > y_b) ? y_a : y_b;
+                }
+                signals[s]->y_prev_sub = y;
+            }
+            frac = frac_act;
+            k += step;
+            i++;
+        }
+        block.n_columns = k + 1;
+        if (!plot->scroll){
+            /* to erase previous plot */
+            for (s = 0; s < n_signals; s++){
+                block.y_min[s][k + 1] = UINT16_MAX;
+                block.y_max[s][k + 1] = 0;
+            }
+            block.n_columns++;
+        }
+        PlotBlockFlush(&block);
+        column = (column + k) % plot->width;
+        if (plot->scroll){
+            /* the newest column is shown at the right side */
+            ILI9341Scroll(column + 1);
+        }
+        for (s = 0; s < n_signals; s++){
+            signals[s]->y_min_sub = block.y_min[s][k];
+            signals[s]->y_max_sub = block.y_max[s][k];
+        }
+    }
+    for (s = 0; s < n_signals; s++){
+        signals[s]->x_prev = (plot->x_pos + column) * 100 + frac;
+        signals[s]->y_prev = signals[s]->y_prev_sub / RTPLOT_SUBPIXEL;
+        signals[s]->y_min = signals[s]->y_min_sub / RTPLOT_SUBPIXEL;
+        signals[s]->y_max = signals[s]->y_max_sub / RTPLOT_SUBPIXEL;
+    }
+}
+
 /*==================[end of file]============================================*/
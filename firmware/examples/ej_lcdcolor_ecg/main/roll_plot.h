@@ -18,12 +18,19 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 04/04/2024 | Document creation		                         						|
+ * | 14/10/2026 | Scroll mode using the LCD hardware scrolling							|
+ * | 14/10/2026 | Blocks of samples of several signals (RTPlotDrawBlock)					|
+ * | 15/10/2026 | Antialiased blocks: sub-pixel positions and coverage per column		|
+ * | 15/10/2026 | RTPlotDraw draws one min/max span per column when x_scale < 100		|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define RTPLOT_MAX_SIGNALS  4   /*!< Maximum number of signals drawn by RTPlotDrawBlock */
+#define RTPLOT_SUBPIXEL     32  /*!< Steps per pixel of the y positions of RTPlotDrawBlock */
 
 /*==================[typedef]================================================*/
 /**
@@ -37,6 +44,8 @@ typedef struct{
     uint16_t height; 	/*!< plot height */
     uint16_t x_scale;	/*!< x scale in % (number of pixels drawn per 100 data samples) */
     uint16_t back_color;/*!< plot background color */
+    bool scroll;        /*!< scroll mode: new samples are drawn at the right side and the plot scrolls left (see RTPlotInit) */
+    bool antialias;     /*!< RTPlotDrawBlock blends the ends of each column with the background (see RTPlotDrawBlock) */
 } plot_t;
 
 /**
@@ -49,6 +58,11 @@ typedef struct{
 	uint16_t color;		/*!< plot color */
 	uint16_t x_prev;	/*!< x position of last point drawn */
 	uint16_t y_prev;	/*!< y position of last point drawn */
+	uint16_t y_min;		/*!< lowest y of the current column (scroll mode, or x_scale < 100) */
+	uint16_t y_max;		/*!< highest y of the current column (scroll mode, or x_scale < 100) */
+	uint16_t y_prev_sub;/*!< y_prev in 1/RTPLOT_SUBPIXEL pixels (RTPlotDrawBlock) */
+	uint16_t y_min_sub;	/*!< y_min in 1/RTPLOT_SUBPIXEL pixels (RTPlotDrawBlock) */
+	uint16_t y_max_sub;	/*!< y_max in 1/RTPLOT_SUBPIXEL pixels (RTPlotDrawBlock) */
 	plot_t * plot;		/*!< plot in which the signal'll be drawn */
 } signal_t;
 
@@ -58,6 +72,11 @@ typedef struct{
 
 /**
  * @brief  		Initializes a plot
+ * @note		Scroll mode uses the LCD hardware scrolling, which moves whole columns
+ * 				only in landscape orientations (in portrait the plot falls back to the
+ * 				erase mode). The columns of the plot scroll over the whole LCD height,
+ * 				so nothing else must be drawn above or below the plot. RTPlotDraw can
+ * 				only draw one signal on it (RTPlotDrawBlock draws several).
  * @param[in]  	plot: Structure with the plot configuration
  * @retval 		NONE
  */
@@ -77,10 +96,34 @@ void RTSignalInit(plot_t * plot, signal_t * signal);
  * @param[in]  	signal: Structure with the signal configuration
  * @param[in]	data: Data value to draw in plot
  * @return  	None
- * @note
+ * @note		With x_scale < 100 several samples fall on the same column: they only
+ * 				update its lowest and highest point, and the column is drawn once as
+ * 				a vertical span when the next column starts (one column behind the
+ * 				newest sample). The drawing cost is then bounded by the columns
+ * 				advanced, not by the sample rate.
  */
 void RTPlotDraw(signal_t * signal, int16_t data);
 
+/**
+ * @brief		Draws a block of samples of several signals of the same plot
+ * @note		The columns covered by the block are rendered off-screen and sent in a
+ * 				single window (two when the plot wraps), so the cost per sample drops
+ * 				with the block size. Signals are drawn in order (the last one on top).
+ * 				Use either RTPlotDraw or RTPlotDrawBlock on a plot, not both.
+ * @note		Positions are kept with 1/RTPLOT_SUBPIXEL pixel resolution. With
+ * 				antialias, each column of a signal is the span between its lowest and
+ * 				highest point, one pixel thick, and the pixels at its ends are blended
+ * 				in proportion to the part they cover (Xiaolin Wu's rule, in integers):
+ * 				a nearly flat trace falls between two rows instead of stepping.
+ * @param[in]	plot: Structure with the plot configuration
+ * @param[in]  	signals: Signals (initialized with RTSignalInit on this plot)
+ * @param[in]  	n_signals: Number of signals (up to RTPLOT_MAX_SIGNALS)
+ * @param[in]	samples: samples[s] has the n data values of signals[s]
+ * @param[in]	n: Number of samples of each signal
+ * @return  	None
+ */
+void RTPlotDrawBlock(plot_t * plot, signal_t * signals[], uint8_t n_signals, const int16_t * samples[], uint16_t n);
+
 #endif /* ROLL_PLOT_H_ */
 
 /*==================[end of file]============================================*/
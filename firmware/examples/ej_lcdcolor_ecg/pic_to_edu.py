@@ -0,0 +1,154 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Wed Oct 14 10:00:00 2026
+
+@author: Albano Peñalva
+
+Conversión de imágenes al formato comprimido de ILI9341DrawImage
+(paleta de hasta 256 colores + RLE por fila, ver ili9341_image_t en ili9341.h)
+
+Uso:
+    python pic_to_edu.py imagen.png nombre [--colores N]
+    python pic_to_edu.py imagen_pic.h nombre --ancho W --alto H
+
+La entrada puede ser una imagen (png, jpg, bmp...) o un archivo .h con un
+arreglo RGB565 de 2 bytes/pixel (como los generados por el conversor de
+digole.com). Se genera el archivo nombre_img.h.
+"""
+
+# Librerías
+import argparse
+import re
+
+RLE_RUN = 0x80      # Token de repetición (bit 7)
+RLE_MAX = 128       # Máxima longitud de un token
+
+
+def leer_h(archivo, ancho, alto):
+    """Lee un arreglo RGB565 (big endian) de un archivo .h"""
+    texto = open(archivo, encoding='utf-8').read()
+    texto = texto[texto.index('{') + 1:texto.index('}')]
+    datos = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]{1,2}', texto)]
+    if len(datos) != 2 * ancho * alto:
+        raise ValueError(f'se esperaban {2 * ancho * alto} bytes y hay {len(datos)}')
+    pixeles = [datos[i] << 8 | datos[i + 1] for i in range(0, len(datos), 2)]
+    return [pixeles[f * ancho:(f + 1) * ancho] for f in range(alto)]
+
+
+def leer_imagen(archivo, colores):
+    """Lee una imagen y la convierte a RGB565 (cuantizando si hace falta)"""
+    from PIL import Image
+    img = Image.open(archivo).convert('RGB')
+    if len(img.getcolors(maxcolors=1 << 24)) > colores:
+        img = img.quantize(colors=colores).convert('RGB')
+    ancho, alto = img.size
+    rgb = list(img.getdata())
+    pixeles = [(r >> 3) << 11 | (g >> 2) << 5 | (b >> 3) for r, g, b in rgb]
+    return [pixeles[f * ancho:(f + 1) * ancho] for f in range(alto)]
+
+
+def rle_fila(indices):
+    """Codifica una fila de índices de paleta en tokens de repetición y literales"""
+    tokens = []
+    literal = []
+
+    def cerrar_literal():
+        if literal:
+            tokens.append(len(literal) - 1)
+            tokens.extend(literal)
+            literal.clear()
+
+    i = 0
+    while i < len(indices):
+        j = i
+        while j < len(indices) and indices[j] == indices[i] and j - i < RLE_MAX:
+            j += 1
+        n = j - i
+        # Una repetición de 2 solo conviene si no corta un literal
+        if n >= 3 or (n == 2 and not literal):
+            cerrar_literal()
+            tokens.extend([RLE_RUN | (n - 1), indices[i]])
+            i = j
+        else:
+            literal.append(indices[i])
+            i += 1
+            if len(literal) == RLE_MAX:
+                cerrar_literal()
+    cerrar_literal()
+    return tokens
+
+
+def arreglo_c(valores, formato, por_linea=16):
+    lineas = []
+    for i in range(0, len(valores), por_linea):
+        lineas.append('    ' + ','.join(formato.format(v) for v in valores[i:i + por_linea]))
+    return ',\n'.join(lineas)
+
+
+# %% Lectura de argumentos
+parser = argparse.ArgumentParser(description='Conversión de imágenes para ILI9341DrawImage')
+parser.add_argument('entrada', help='imagen o archivo .h con arreglo RGB565')
+parser.add_argument('nombre', help='nombre de la imagen en el código')
+parser.add_argument('--ancho', type=int, help='ancho en pixeles (entrada .h)')
+parser.add_argument('--alto', type=int, help='alto en pixeles (entrada .h)')
+parser.add_argument('--colores', type=int, default=256, help='máximo número de colores (<= 256)')
+args = parser.parse_args()
+
+# %% Conversión a RGB565
+if args.entrada.endswith('.h'):
+    pixeles = leer_h(args.entrada, args.ancho, args.alto)
+else:
+    pixeles = leer_imagen(args.entrada, min(args.colores, 256))
+alto, ancho = len(pixeles), len(pixeles[0])
+
+# %% Paleta
+paleta = sorted(set(c for fila in pixeles for c in fila))
+posicion = {c: i for i, c in enumerate(paleta)}
+indices = [[posicion[c] for c in fila] for fila in pixeles]
+if len(paleta) > 256:
+    raise ValueError(f'la imagen tiene {len(paleta)} colores (máximo 256)')
+
+# %% Compresión por filas
+datos = []
+filas = []
+for fila in indices:
+    filas.append(len(datos))
+    datos.extend(rle_fila(fila))
+
+print(f'{args.nombre}: {ancho}x{alto}, {len(paleta)} colores')
+print(f'sin comprimir: {2 * ancho * alto} bytes, comprimida: {2 * len(paleta) + 4 * alto + len(datos)} bytes')
+
+# %% Guardado en archivo .h
+nombre = args.nombre
+with open(f'{nombre}_img.h', 'w', encoding='utf-8') as f:
+    f.write(f'''/**
+ * @file {nombre}_img.h
+ * @brief Imagen {nombre} ({ancho}x{alto} pixeles, {len(paleta)} colores)
+ * @note Creado con pic_to_edu.py a partir de {args.entrada.split('/')[-1]}
+ */
+#include <stdint.h>
+#include "ili9341.h"
+
+#define {nombre.upper()}_WIDTH     {ancho}
+#define {nombre.upper()}_HEIGHT    {alto}
+
+const uint16_t {nombre}_palette[] = {{
+{arreglo_c(paleta, '0x{:04x}', 12)}
+}};
+
+const uint32_t {nombre}_rows[] = {{
+{arreglo_c(filas, '{}', 12)}
+}};
+
+const uint8_t {nombre}_data[] = {{
+{arreglo_c(datos, '0x{:02x}')}
+}};
+
+const ili9341_image_t {nombre}_img = {{
+    {nombre.upper()}_WIDTH,
+    {nombre.upper()}_HEIGHT,
+    {nombre}_palette,
+    {nombre}_rows,
+    {nombre}_data
+}};
+''')
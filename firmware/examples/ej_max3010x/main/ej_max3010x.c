@@ -3,6 +3,9 @@
  * @section genDesc General Description
  *
  * Este proyecto ejemplifica el uso del dispositivo MAX30102.
+ * Las muestras se adquieren por interrupción (FIFO casi llena): el driver
+ * vacía la FIFO por bloques y los entrega a la aplicación. La frecuencia
+ * cardíaca y la SpO2 se estiman muestra a muestra y se informan en cada latido.
  *
  * \section hardConn Hardware Connection
  *
@@ -12,12 +15,16 @@
  * | 	3V3		 	| 	3V3			|
  * | 	SCL		 	| 	SCL 		|
  * | 	GND		 	| 	GND			|
+ * | 	INT		 	| 	GPIO_3		|
  * 
  * @section changelog Changelog
  *
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 21/05/2024 | Document creation		                         |
+ * | 14/10/2026 | Adquisición por interrupción A_FULL            |
+ * | 14/10/2026 | Estimación de HR y SpO2 por latido             |
+ * | 15/10/2026 | Índice de perfusión con máximo y mínimo móviles |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -29,26 +36,49 @@
 #include <stdbool.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include <iir_filter.h>
 #include <max3010x.h>
 #include "spo2_algorithm.h"
+#include "sliding_window.h"
 #include "led.h"
 /*==================[macros and definitions]=================================*/
 #define BUFFER_SIZE 256
 #define SAMPLE_FREQ	100
 #define CONFIG_BLINK_PERIOD 100
+#define MAX_INT_PIN GPIO_3          /* pin INT del MAX30102 */
+#define NEW_SAMPLES 25              /* muestras por interrupción de FIFO casi llena */
+#define SAMPLES_QUEUE 64
+#define VENTANA_PERFUSION SAMPLE_FREQ   /* muestras de IR (1 s, al menos un latido) para el índice de perfusión */
 /*==================[internal data definition]===============================*/
 float dato_filt;
 float dato;
 
-uint32_t irBuffer[100]; //infrared LED sensor data
-uint32_t redBuffer[100];  //red LED sensor data
-int32_t bufferLength=100; //data length
+maxim_stream_t estimador; //HR and SPO2 streaming estimator state
 int32_t spo2; //SPO2 value
 int8_t validSPO2; //indicator to show if the SPO2 calculation is valid
 int32_t heartRate; //heart rate value
 int8_t validHeartRate; //indicator to show if the heart rate calculation is valid
+sliding_minmax_t ir_ventana; //IR máximo y mínimo del último segundo
+
+typedef struct {
+    uint32_t red;
+    uint32_t ir;
+} muestra_t;
+QueueHandle_t muestras;
 /*==================[internal functions declaration]=========================*/
+/**
+ * @brief Recibe cada bloque de muestras leído de la FIFO del sensor
+ * (se ejecuta en la tarea de adquisición del driver).
+ */
+static void RecibirBloque(const uint32_t *red, const uint32_t *ir, const uint32_t *green, uint8_t n, void *param){
+    muestra_t m;
+    for (uint8_t i = 0; i < n; i++){
+        m.red = red[i];
+        m.ir = ir[i];
+        xQueueSend(muestras, &m, 0);
+    }
+}
 
 /*==================[external functions definition]==========================*/
 void app_main(void){
@@ -57,40 +87,36 @@ void app_main(void){
     LedsInit();
     MAX3010X_begin();
 	MAX3010X_setup( 30, 1 , 2, SAMPLE_FREQ, 69, 4096);
+    muestras = xQueueCreate(SAMPLES_QUEUE, sizeof(muestra_t));
+    MAX3010X_subscribe(RecibirBloque, NULL);
+    /* Interrupción cuando la FIFO del sensor tiene NEW_SAMPLES muestras */
+    MAX3010X_startAcquisition(MAX_INT_PIN, NEW_SAMPLES);
     /* Se imprimen por consola los valores de frequencia y magnitud correspondiente */
     printf("****MAX30102 Test****\n");
 
+    maxim_stream_init(&estimador, SAMPLE_FREQ);
+    SlidingMinMaxInit(&ir_ventana, VENTANA_PERFUSION);
+
     while(1){
-        uint8_t i;
-	    for (i = 25; i < 100; i++)
-	    {
-		    redBuffer[i - 25] = redBuffer[i];
-		    irBuffer[i - 25] = irBuffer[i];
-	    }
+        muestra_t m;
+        xQueueReceive(muestras, &m, portMAX_DELAY); //sleeps until the next block arrives
 
-	    //take 25 sets of samples before calculating the heart rate.
-	    for ( i = 75; i < 100; i++)
-	    {
-		    while (MAX3010X_available() == false) //do we have new data?
-			    MAX3010X_check(); //Check the sensor for new data
-            
-		    redBuffer[i] = MAX3010X_getRed();
-		    irBuffer[i] = MAX3010X_getIR();
-		    MAX3010X_nextSample(); //We're finished with this sample so move to next sample
-		            
-            //send samples and calculation result to terminal program through UART
-	     	dato = (float)redBuffer[i];
-			HiPassFilter(&dato, &dato_filt, 1);
-	        //printf("%ld,%2.2f,%ld\n", redBuffer[i], dato_filt, heartRate);
-             
-	}
+        //send samples and calculation result to terminal program through UART
+        dato = (float)m.red;
+        HiPassFilter(&dato, &dato_filt, 1);
+        SlidingMinMaxAdd(&ir_ventana, (float)m.ir);
+        //printf("%ld,%2.2f,%ld\n", m.red, dato_filt, heartRate);
 
-	//After gathering 25 new samples recalculate HR and SP02
-	maxim_heart_rate_and_oxygen_saturation(irBuffer, bufferLength, redBuffer, &spo2, &validSPO2, &heartRate, &validHeartRate);
-    printf("HR= %ld, HRvalid= %d \n", heartRate, validHeartRate);
-    printf("SPO2= %ld, SPO2Valid= %d \n", spo2, validSPO2);
-	LedToggle(LED_1);
-    //vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
+        //HR and SP02 are recalculated at every beat
+        if(maxim_stream_update(&estimador, m.ir, m.red, &spo2, &validSPO2, &heartRate, &validHeartRate)){
+            printf("HR= %ld, HRvalid= %d \n", heartRate, validHeartRate);
+            printf("SPO2= %ld, SPO2Valid= %d \n", spo2, validSPO2);
+            /* Índice de perfusión: componente pulsátil (AC) sobre la continua (DC)
+             * del IR, en centésimas de % */
+            uint32_t pi = (uint32_t)(10000.0f * (SlidingMax(&ir_ventana) - SlidingMin(&ir_ventana)) / SlidingMax(&ir_ventana));
+            printf("PI= %lu.%02lu %%\n", pi / 100, pi % 100);
+            LedToggle(LED_1);
+        }
     }
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
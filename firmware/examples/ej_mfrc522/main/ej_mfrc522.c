@@ -3,6 +3,9 @@
  * \section genDesc General Description
  *
  * Este proyecto ejemplifica el uso del dispositivo MFRC522.
+ * Para ahorrar energía el lector pasa apagado la mayor parte del tiempo: cada
+ * 100 ms a 1 s (más espaciado mientras no aparecen tarjetas) enciende el campo
+ * sólo para buscar una tarjeta.
  *
  * \section hardConn Hardware Connection
  *
@@ -14,6 +17,7 @@
  * | 	SDI/MOSI 	| 	GPIO_21		|
  * | 	RESET	 	| 	GPIO_18		|
  * | 	CS		 	| 	GPIO_9		|
+ * | 	IRQ		 	| 	GPIO_3		|
  * | 	GND		 	| 	GND			|
  *
  * @section changelog Changelog
@@ -21,6 +25,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 14/10/2026 | Espera de comandos por el pin IRQ              |
+ * | 14/10/2026 | Detección de tarjetas de bajo consumo          |
  *
  * @author Juan Ignacio Cerrudo (juan.cerrudo@uner.edu.ar)
  *
@@ -35,8 +41,9 @@
 #include "led.h"
 #include "uart_mcu.h"
 #include "rfid_utils.h"
+#include "rfid_presence.h"
 /*==================[macros and definitions]=================================*/
-#define CONFIG_BLINK_PERIOD 1000
+#define RFID_IRQ_PIN GPIO_3		/*!< Pin IRQ del MFRC522: la tarea duerme mientras espera a la tarjeta */
 /*==================[internal data definition]===============================*/
 unsigned int last_user_ID;
 // RFID structs
@@ -77,19 +84,19 @@ void app_main(void){
 	UART_USB.port = UART_PC;
 	UartInit(&UART_USB);
 	setupRFID(&mfrcInstance);
+	PCD_EnableIrq(mfrcInstance, RFID_IRQ_PIN);
+	RfidPresenceInit(mfrcInstance, NULL);
 
 	UartSendString(UART_PC,"Init MRFC522 test.\r\n");
 	
     while(true){
-		UartSendString(UART_PC,"Reading... \r\n");
-		if (PICC_IsNewCardPresent(mfrcInstance)) {
-			if (PICC_ReadCardSerial(mfrcInstance)) {
-				LedOn(LED_1);
-				userTapIn();
-				LedOff(LED_1);
-			}
+		// La tarea duerme hasta que una tarjeta queda seleccionada
+		if (RfidPresenceWait(RFID_PRESENCE_FOREVER)) {
+			LedOn(LED_1);
+			userTapIn();
+			LedOff(LED_1);
+			RfidPresenceRelease();
 		}
-		vTaskDelay(CONFIG_BLINK_PERIOD / portTICK_PERIOD_MS);
 	}
 }
 /*==================[end of file]============================================*/
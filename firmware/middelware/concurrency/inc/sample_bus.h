@@ -0,0 +1,178 @@
+#ifndef SAMPLE_BUS_H_
+#define SAMPLE_BUS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sample_Bus Sample Bus
+ ** @{ */
+
+/** \brief Publish/subscribe bus of sample blocks, without copies
+ *
+ * A topic (SAMPLE_BUS_DEFINE) owns a fixed set of sample blocks. The producer
+ * task takes a free block (SampleBusAcquire), writes the samples in place and
+ * publishes it (SampleBusPublish): every subscriber gets a reference to the
+ * same block and its task is notified. Each subscriber takes the blocks in
+ * publication order (SampleBusTake) and releases them when done
+ * (SampleBusRelease); a block is free again once every subscriber released it.
+ *
+ * @code
+ * SAMPLE_BUS_DEFINE(ecg_bus, int16_t, 16, 4);
+ *
+ * int8_t id = SampleBusSubscribe(&ecg_bus, plot_task, 1);  // before the first block
+ *
+ * sample_block_t *block = SampleBusAcquire(&ecg_bus);      // producer
+ * if(block != NULL){
+ *     int16_t *samples = block->data;
+ *     ...
+ *     SampleBusPublish(&ecg_bus, block, 16);
+ * }
+ *
+ * ulTaskNotifyTake(pdTRUE, portMAX_DELAY);                 // subscriber
+ * const sample_block_t *b;
+ * while((b = SampleBusTake(&ecg_bus, id)) != NULL){
+ *     ...
+ *     SampleBusRelease(&ecg_bus, b);
+ * }
+ * @endcode
+ *
+ * @note One producer task per topic. Subscribers are added before the first
+ * block is published.
+ * @note A subscriber that falls behind keeps its blocks: when none is free
+ * the producer drops the new block (SampleBusDropped) and the sequence
+ * number of the next one shows the gap to every subscriber.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros]=================================================*/
+#define SAMPLE_BUS_SUBSCRIBERS_MAX  4   /*!< Subscribers of each topic */
+#define SAMPLE_BUS_BLOCKS_MAX       16  /*!< Blocks of each topic */
+
+/**
+ * @brief Define a statically allocated topic
+ *
+ * @param name      Topic variable name
+ * @param type      Sample type
+ * @param length    Samples of each block
+ * @param count     Number of blocks (up to SAMPLE_BUS_BLOCKS_MAX)
+ */
+#define SAMPLE_BUS_DEFINE(name, type, length, count)                                    \
+    _Static_assert((count) > 0 && (count) <= SAMPLE_BUS_BLOCKS_MAX, "Too many blocks"); \
+    static type name##_storage[(count) * (length)];                                     \
+    static sample_block_t name##_blocks[count];                                         \
+    static sample_bus_t name = {                                                        \
+        .storage = (uint8_t *)name##_storage,                                           \
+        .blocks = name##_blocks,                                                        \
+        .block_size = (length) * sizeof(type),                                          \
+        .n_blocks = (count),                                                            \
+        .n_subs = 0,                                                                    \
+        .seq = 0,                                                                       \
+        .dropped = 0,                                                                   \
+    }
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample block
+ */
+typedef struct {
+    void *data;                 /*!< Samples */
+    uint16_t length;            /*!< Number of samples published */
+    uint32_t seq;               /*!< Publication number (a jump means dropped blocks) */
+    uint8_t refs;               /*!< Subscribers still using the block (0: free) */
+} sample_block_t;
+
+/**
+ * @brief Subscriber of a topic
+ */
+typedef struct {
+    TaskHandle_t task;                      /*!< Task notified on every block */
+    uint32_t bits;                          /*!< Notification bits set on the task */
+    uint8_t queue[SAMPLE_BUS_BLOCKS_MAX];   /*!< Published blocks not taken yet */
+    uint32_t head;                          /*!< Write index (only modified by the producer) */
+    uint32_t tail;                          /*!< Read index (only modified by the subscriber) */
+} sample_bus_sub_t;
+
+/**
+ * @brief Topic struct (use SAMPLE_BUS_DEFINE to create one)
+ */
+typedef struct {
+    uint8_t *storage;                       /*!< Samples of every block */
+    sample_block_t *blocks;                 /*!< Blocks */
+    size_t block_size;                      /*!< Size of a block (in bytes) */
+    uint8_t n_blocks;                       /*!< Number of blocks */
+    uint8_t n_subs;                         /*!< Number of subscribers */
+    sample_bus_sub_t subs[SAMPLE_BUS_SUBSCRIBERS_MAX]; /*!< Subscribers */
+    uint32_t seq;                           /*!< Next publication number */
+    uint32_t dropped;                       /*!< Blocks dropped because none was free */
+} sample_bus_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Add a subscriber
+ *
+ * @param bus   Topic
+ * @param task  Task notified on every block
+ * @param bits  Notification bits set on the task (eSetBits, not 0)
+ * @return int8_t Subscriber id, -1 if the topic is full
+ */
+int8_t SampleBusSubscribe(sample_bus_t *bus, TaskHandle_t task, uint32_t bits);
+
+/**
+ * @brief Take a free block to write (producer)
+ *
+ * @param bus   Topic
+ * @return sample_block_t* Block, NULL if every block is in use (the block is dropped)
+ */
+sample_block_t *SampleBusAcquire(sample_bus_t *bus);
+
+/**
+ * @brief Publish a block to every subscriber and notify them (producer)
+ *
+ * @param bus       Topic
+ * @param block     Block taken with SampleBusAcquire
+ * @param length    Number of samples written
+ */
+void SampleBusPublish(sample_bus_t *bus, sample_block_t *block, uint16_t length);
+
+/**
+ * @brief Take the oldest block published to a subscriber
+ *
+ * @param bus   Topic
+ * @param id    Subscriber id
+ * @return const sample_block_t* Block (release it with SampleBusRelease), NULL if none
+ */
+const sample_block_t *SampleBusTake(sample_bus_t *bus, int8_t id);
+
+/**
+ * @brief Release a block taken with SampleBusTake
+ *
+ * @param bus   Topic
+ * @param block Block
+ */
+void SampleBusRelease(sample_bus_t *bus, const sample_block_t *block);
+
+/**
+ * @brief Blocks dropped because none was free
+ *
+ * @param bus   Topic
+ * @return uint32_t Number of blocks dropped
+ */
+uint32_t SampleBusDropped(sample_bus_t *bus);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SAMPLE_BUS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,84 @@
+#ifndef SENSOR_SCHEDULER_H_
+#define SENSOR_SCHEDULER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sensor_Scheduler Sensor Scheduler
+ ** @{ */
+
+/** \brief Acquisition of several sensors, each at its own rate, onto the sample bus
+ *
+ * Every sensor (sensor.h) is added with its period and a topic of the sample
+ * bus (sample_bus.h). One task serves all of them: the ready callbacks only
+ * set a notification bit, and the task reads the samples waiting
+ * (read_block, never blocking) straight into a block of the topic, and
+ * publishes the block when it is full. The block length of each topic sets
+ * the batching of its sensor.
+ *
+ * @code
+ * SAMPLE_BUS_DEFINE(imu_bus, int16_t, 6 * 20, 4);      // 20 MPU6050 samples per block
+ * SAMPLE_BUS_DEFINE(dist_bus, uint16_t, 1, 4);         // every distance
+ *
+ * SensorSchedulerAdd(MPU6050_sensor(GPIO_INT), 5000, &imu_bus);   // 200 Hz
+ * SensorSchedulerAdd(HcSr04Sensor(), 100000, &dist_bus);           // 10 Hz
+ * SampleBusSubscribe(&imu_bus, fusion_task, 1);
+ * SampleBusSubscribe(&dist_bus, display_task, 1);
+ * SensorSchedulerStart(5);
+ * @endcode
+ *
+ * @note The scheduler task is the producer of the topics (one producer per
+ * topic). When a topic has no free block the samples read are dropped
+ * (SampleBusDropped counts the blocks).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sensor.h"
+#include "sample_bus.h"
+/*==================[macros]=================================================*/
+#define SENSOR_SCHEDULER_MAX    8   /*!< Sensors served by the scheduler */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Add a sensor (before SensorSchedulerStart)
+ *
+ * @param sensor    Sensor
+ * @param period_us Sample period (us)
+ * @param bus       Topic its samples are published to, whose block holds a
+ *                  whole number of samples (SensorSampleSize)
+ * @return int8_t   Sensor index, -1 if full, running or the block doesn't fit
+ */
+int8_t SensorSchedulerAdd(const sensor_t *sensor, uint32_t period_us, sample_bus_t *bus);
+
+/**
+ * @brief Start the scheduler task and every sensor added
+ *
+ * @param priority  Priority of the scheduler task
+ * @return true     Every sensor started
+ * @return false    The task could not be created or a sensor did not start
+ */
+bool SensorSchedulerStart(uint8_t priority);
+
+/**
+ * @brief Stop every sensor; the samples waiting are published (partial blocks included)
+ */
+void SensorSchedulerStop(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SENSOR_SCHEDULER_H_ */
+
+/*==================[end of file]============================================*/
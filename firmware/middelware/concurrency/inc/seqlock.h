@@ -0,0 +1,80 @@
+#ifndef SEQLOCK_H_
+#define SEQLOCK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Seqlock Seqlock
+ ** @{ */
+
+/** \brief Sequence lock to share the latest value of a struct
+ * 
+ * A single writer publishes a new value and any number of readers take a
+ * consistent snapshot of it, without blocking the writer. Readers retry when
+ * the value changed while it was being copied, so they never see a torn value.
+ * 
+ * @note If a reader has higher priority than the writer it backs off one tick
+ * after SEQLOCK_SPIN_MAX retries, letting the writer finish.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+#define SEQLOCK_SPIN_MAX    8   /*!< Read retries before yielding to the writer */
+
+/**
+ * @brief Define a statically allocated seqlock protected value
+ * 
+ * @param name  Seqlock variable name
+ * @param type  Type of the shared value
+ */
+#define SEQLOCK_DEFINE(name, type)          \
+    static type name##_data;                \
+    static seqlock_t name = {               \
+        .data = &name##_data,               \
+        .size = sizeof(type),               \
+        .seq = 0,                           \
+    }
+/*==================[typedef]================================================*/
+/**
+ * @brief Seqlock struct (use SEQLOCK_DEFINE to create one)
+ */
+typedef struct {
+    void *data;                 /*!< Shared value storage */
+    size_t size;                /*!< Size of the shared value (in bytes) */
+    uint32_t seq;               /*!< Sequence counter (odd while writing) */
+} seqlock_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Publish a new value (single writer)
+ * 
+ * @param lock  Seqlock
+ * @param src   Pointer to the new value
+ */
+void SeqlockWrite(seqlock_t *lock, const void *src);
+
+/**
+ * @brief Take a consistent snapshot of the latest value
+ * 
+ * @param lock  Seqlock
+ * @param dst   Pointer where the value is copied
+ * @return uint32_t Sequence number of the snapshot (increases by 2 on every write)
+ */
+uint32_t SeqlockRead(seqlock_t *lock, void *dst);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SEQLOCK_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,105 @@
+#ifndef SPSC_RING_H_
+#define SPSC_RING_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup SPSC_Ring SPSC Ring Buffer
+ ** @{ */
+
+/** \brief Lock-free single-producer/single-consumer ring buffer
+ * 
+ * One task (or ISR) pushes items and one task pops them, without critical
+ * sections or mutexes. The storage is statically allocated with SPSC_RING_DEFINE,
+ * so the capacity is fixed at compile time and must be a power of two.
+ * 
+ * @note The ring holds up to length - 1 items.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+/**
+ * @brief Define a statically allocated ring buffer
+ * 
+ * @param name      Ring buffer variable name
+ * @param type      Item type
+ * @param length    Number of slots (power of two)
+ */
+#define SPSC_RING_DEFINE(name, type, length)                                            \
+    _Static_assert(((length) & ((length) - 1)) == 0, "Ring length must be a power of two"); \
+    static uint8_t name##_storage[(length) * sizeof(type)];                             \
+    static spsc_ring_t name = {                                                         \
+        .buffer = name##_storage,                                                       \
+        .item_size = sizeof(type),                                                      \
+        .mask = (length) - 1,                                                           \
+        .head = 0,                                                                      \
+        .tail = 0,                                                                      \
+        .dropped = 0,                                                                   \
+    }
+/*==================[typedef]================================================*/
+/**
+ * @brief Ring buffer struct (use SPSC_RING_DEFINE to create one)
+ */
+typedef struct {
+    uint8_t *buffer;            /*!< Item storage */
+    size_t item_size;           /*!< Size of each item (in bytes) */
+    uint32_t mask;              /*!< Number of slots - 1 */
+    uint32_t head;              /*!< Write index (only modified by the producer) */
+    uint32_t tail;              /*!< Read index (only modified by the consumer) */
+    uint32_t dropped;           /*!< Items rejected because the ring was full */
+} spsc_ring_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Push an item (producer side, ISR safe)
+ * 
+ * @param ring  Ring buffer
+ * @param item  Pointer to the item to copy into the ring
+ * @return true     Item stored
+ * @return false    Ring full, item dropped
+ */
+bool SpscRingPush(spsc_ring_t *ring, const void *item);
+
+/**
+ * @brief Pop the oldest item (consumer side)
+ * 
+ * @param ring  Ring buffer
+ * @param item  Pointer where the item is copied
+ * @return true     Item read
+ * @return false    Ring empty
+ */
+bool SpscRingPop(spsc_ring_t *ring, void *item);
+
+/**
+ * @brief Number of items ready to be read
+ * 
+ * @param ring  Ring buffer
+ * @return uint32_t Items stored
+ */
+uint32_t SpscRingCount(spsc_ring_t *ring);
+
+/**
+ * @brief Number of items dropped since initialization because the ring was full
+ * 
+ * @param ring  Ring buffer
+ * @return uint32_t Items dropped
+ */
+uint32_t SpscRingDropped(spsc_ring_t *ring);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SPSC_RING_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,95 @@
+/**
+ * @file sample_bus.c
+ * @brief Publish/subscribe bus of sample blocks, without copies
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sample_bus.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int8_t SampleBusSubscribe(sample_bus_t *bus, TaskHandle_t task, uint32_t bits){
+    sample_bus_sub_t *sub;
+
+    if(bus->n_subs >= SAMPLE_BUS_SUBSCRIBERS_MAX || task == NULL || bits == 0){
+        return -1;
+    }
+    sub = &bus->subs[bus->n_subs];
+    sub->task = task;
+    sub->bits = bits;
+    sub->head = 0;
+    sub->tail = 0;
+    return (int8_t)bus->n_subs++;
+}
+
+sample_block_t *SampleBusAcquire(sample_bus_t *bus){
+    for(uint8_t i = 0; i < bus->n_blocks; i++){
+        sample_block_t *block = &bus->blocks[i];
+        // only the producer takes a block out of the free state
+        if(__atomic_load_n(&block->refs, __ATOMIC_ACQUIRE) == 0){
+            block->refs = 1;
+            block->data = &bus->storage[i * bus->block_size];
+            return block;
+        }
+    }
+    bus->dropped++;
+    bus->seq++;
+    return NULL;
+}
+
+void SampleBusPublish(sample_bus_t *bus, sample_block_t *block, uint16_t length){
+    uint8_t index = (uint8_t)(block - bus->blocks);
+
+    block->length = length;
+    block->seq = bus->seq++;
+    // one reference per subscriber, set before any of them can release it
+    __atomic_store_n(&block->refs, bus->n_subs, __ATOMIC_RELEASE);
+    for(uint8_t i = 0; i < bus->n_subs; i++){
+        sample_bus_sub_t *sub = &bus->subs[i];
+        uint32_t head = sub->head;
+        // the subscriber holds a reference to every queued block, so the
+        // queue never has more than n_blocks entries
+        sub->queue[head % SAMPLE_BUS_BLOCKS_MAX] = index;
+        __atomic_store_n(&sub->head, head + 1, __ATOMIC_RELEASE);
+        xTaskNotify(sub->task, sub->bits, eSetBits);
+    }
+}
+
+const sample_block_t *SampleBusTake(sample_bus_t *bus, int8_t id){
+    sample_bus_sub_t *sub = &bus->subs[id];
+    uint32_t tail = sub->tail;
+    uint32_t head = __atomic_load_n(&sub->head, __ATOMIC_ACQUIRE);
+    uint8_t index;
+
+    if(tail == head){
+        return NULL;
+    }
+    index = sub->queue[tail % SAMPLE_BUS_BLOCKS_MAX];
+    __atomic_store_n(&sub->tail, tail + 1, __ATOMIC_RELEASE);
+    return &bus->blocks[index];
+}
+
+void SampleBusRelease(sample_bus_t *bus, const sample_block_t *block){
+    sample_block_t *b = &bus->blocks[block - bus->blocks];
+    // the last subscriber leaves the block free for the producer
+    __atomic_sub_fetch(&b->refs, 1, __ATOMIC_ACQ_REL);
+}
+
+uint32_t SampleBusDropped(sample_bus_t *bus){
+    return bus->dropped;
+}
+
+/*==================[end of file]============================================*/
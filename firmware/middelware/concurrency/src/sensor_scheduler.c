@@ -0,0 +1,147 @@
+/**
+ * @file sensor_scheduler.c
+ * @brief Acquisition of several sensors, each at its own rate, onto the sample bus
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sensor_scheduler.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+#define SCHED_TASK_STACK    3072
+#define SCHED_SCRATCH       256             /* Samples read while the topic has no free block */
+#define SCHED_FLUSH_BIT     (1UL << 31)     /* Stopped: publish the partial blocks */
+
+_Static_assert(SENSOR_SCHEDULER_MAX < 31, "One notification bit per sensor");
+/*==================[internal data declaration]==============================*/
+typedef struct {
+    const sensor_t *sensor;
+    uint32_t period_us;
+    sample_bus_t *bus;
+    size_t sample_size;
+    sample_block_t *block;      /* Block being filled, NULL if none */
+    uint16_t fill;              /* Samples in block */
+} sched_entry_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static sched_entry_t entries[SENSOR_SCHEDULER_MAX];
+static uint8_t n_entries = 0;
+static TaskHandle_t sched_task = NULL;
+static volatile bool running = false;
+static uint8_t scratch[SCHED_SCRATCH];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Ready callback of every sensor: param is its index. Drivers call it from
+ * interrupts or from their own tasks */
+static void SchedReady(const sensor_t *sensor, void *param){
+    uint32_t bit = 1UL << (uintptr_t)param;
+    BaseType_t woken = pdFALSE;
+
+    if(xPortInIsrContext()){
+        xTaskNotifyFromISR(sched_task, bit, eSetBits, &woken);
+        portYIELD_FROM_ISR(woken);
+    }else{
+        xTaskNotify(sched_task, bit, eSetBits);
+    }
+}
+
+static void SchedPublish(sched_entry_t *e){
+    SampleBusPublish(e->bus, e->block, e->fill);
+    e->block = NULL;
+    e->fill = 0;
+}
+
+/* Read every sample waiting, into the blocks of the topic */
+static void SchedDrain(sched_entry_t *e){
+    uint16_t room, n;
+
+    while(true){
+        if(e->block == NULL){
+            e->block = SampleBusAcquire(e->bus);
+        }
+        if(e->block == NULL){
+            // no free block: the samples are dropped, the next block shows the gap
+            if(SensorReadBlock(e->sensor, scratch, SCHED_SCRATCH / e->sample_size) == 0){
+                return;
+            }
+            continue;
+        }
+        room = e->bus->block_size / e->sample_size - e->fill;
+        n = SensorReadBlock(e->sensor, (uint8_t *)e->block->data + e->fill * e->sample_size, room);
+        e->fill += n;
+        if(n == room){
+            SchedPublish(e);
+        }else{
+            return;
+        }
+    }
+}
+
+static void SchedTask(void *param){
+    uint32_t bits;
+
+    while(true){
+        xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+        for(uint8_t i = 0; i < n_entries; i++){
+            if(bits & ((1UL << i) | SCHED_FLUSH_BIT)){
+                SchedDrain(&entries[i]);
+            }
+            if((bits & SCHED_FLUSH_BIT) && entries[i].fill > 0){
+                SchedPublish(&entries[i]);
+            }
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+int8_t SensorSchedulerAdd(const sensor_t *sensor, uint32_t period_us, sample_bus_t *bus){
+    size_t sample_size = SensorSampleSize(sensor->format);
+    sched_entry_t *e;
+
+    if(running || n_entries >= SENSOR_SCHEDULER_MAX || sample_size > SCHED_SCRATCH ||
+       bus->block_size < sample_size || bus->block_size % sample_size != 0){
+        return -1;
+    }
+    e = &entries[n_entries];
+    e->sensor = sensor;
+    e->period_us = period_us;
+    e->bus = bus;
+    e->sample_size = sample_size;
+    e->block = NULL;
+    e->fill = 0;
+    return (int8_t)n_entries++;
+}
+
+bool SensorSchedulerStart(uint8_t priority){
+    bool started = true;
+
+    if(running){
+        return true;
+    }
+    if(sched_task == NULL &&
+       xTaskCreate(SchedTask, "SensorSched", SCHED_TASK_STACK, NULL, priority, &sched_task) != pdPASS){
+        return false;
+    }
+    running = true;
+    for(uint8_t i = 0; i < n_entries; i++){
+        started &= SensorStart(entries[i].sensor, entries[i].period_us, SchedReady, (void *)(uintptr_t)i);
+    }
+    return started;
+}
+
+void SensorSchedulerStop(void){
+    if(!running){
+        return;
+    }
+    for(uint8_t i = 0; i < n_entries; i++){
+        SensorStop(entries[i].sensor);
+    }
+    running = false;
+    xTaskNotify(sched_task, SCHED_FLUSH_BIT, eSetBits);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,58 @@
+/**
+ * @file seqlock.c
+ * @brief Sequence lock to share the latest value of a struct
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "seqlock.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void SeqlockWrite(seqlock_t *lock, const void *src){
+    uint32_t seq = __atomic_load_n(&lock->seq, __ATOMIC_RELAXED);
+    // odd sequence: write in progress
+    __atomic_store_n(&lock->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(lock->data, src, lock->size);
+    __atomic_store_n(&lock->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+uint32_t SeqlockRead(seqlock_t *lock, void *dst){
+    uint32_t seq_start, seq_end;
+    uint8_t spin = 0;
+
+    while(true){
+        seq_start = __atomic_load_n(&lock->seq, __ATOMIC_ACQUIRE);
+        if((seq_start & 1) == 0){
+            memcpy(dst, lock->data, lock->size);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            seq_end = __atomic_load_n(&lock->seq, __ATOMIC_RELAXED);
+            if(seq_start == seq_end){
+                return seq_start;
+            }
+        }
+        // the writer may be preempted by this reader: let it run
+        if(++spin >= SEQLOCK_SPIN_MAX){
+            spin = 0;
+            vTaskDelay(1);
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
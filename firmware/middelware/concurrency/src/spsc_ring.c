@@ -0,0 +1,63 @@
+/**
+ * @file spsc_ring.c
+ * @brief Lock-free single-producer/single-consumer ring buffer
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "spsc_ring.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool SpscRingPush(spsc_ring_t *ring, const void *item){
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t next = (head + 1) & ring->mask;
+
+    if(next == tail){
+        ring->dropped++;
+        return false;
+    }
+    memcpy(&ring->buffer[head * ring->item_size], item, ring->item_size);
+    // publish the item only after it has been completely written
+    __atomic_store_n(&ring->head, next, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool SpscRingPop(spsc_ring_t *ring, void *item){
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if(tail == head){
+        return false;
+    }
+    memcpy(item, &ring->buffer[tail * ring->item_size], ring->item_size);
+    // release the slot only after it has been completely read
+    __atomic_store_n(&ring->tail, (tail + 1) & ring->mask, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t SpscRingCount(spsc_ring_t *ring){
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    return (head - tail) & ring->mask;
+}
+
+uint32_t SpscRingDropped(spsc_ring_t *ring){
+    return ring->dropped;
+}
+
+/*==================[end of file]============================================*/
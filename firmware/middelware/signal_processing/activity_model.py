@@ -0,0 +1,333 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 18:00:00 2026
+
+@author: Albano Peñalva
+
+Entrenamiento off-line del clasificador de actividad (activity_classifier.h).
+Calcula las mismas características que ActivityAdd() por ventanas de
+ACTIVITY_SEGMENTS segmentos, entrena un modelo lineal (regresión logística
+multiclase), lo cuantiza a int8 como lo evalúa ActivityClassify()
+(dspi_dotprod_s8 con una entrada de sesgo fija en 127) y genera un archivo .h
+con el activity_model_t constante.
+
+Las ventanas de entrenamiento salen de señales sintéticas de inclinación y
+módulo de la aceleración filtrados, a la frecuencia de salida del
+posture_pipeline:
+- quieto: postura mantenida (correcta o no), con balanceo lento y cambios
+  lentos de postura que se mantienen
+- alcance: movimientos cortos que vuelven (alcanzar algo, girar)
+- caminata: oscilación del módulo a la frecuencia de los pasos
+A las sintéticas se pueden agregar ventanas reales etiquetadas (--csv), con una
+línea por ventana: tilt_std,tilt_range,tilt_net,mag_std,step_freq,step_power,clase (clase
+quieto, alcance o caminata), con las características de ActivityAdd().
+
+Uso:
+    python activity_model.py nombre --fs 100 [--segmento 1000] [--csv ventanas.csv]
+
+Se genera el archivo nombre_actividad.h con el modelo nombre_actividad.
+"""
+
+# Librerías
+import argparse
+import math
+import random
+import struct
+
+CLASES = ['quieto', 'alcance', 'caminata']
+CARACTERISTICAS = ['tilt_std', 'tilt_range', 'tilt_net', 'mag_std', 'step_freq', 'step_power']
+SEGMENTOS = 4           # ACTIVITY_SEGMENTS
+PASOS_MIN_HZ = 1.0      # ACTIVITY_STEP_MIN_HZ
+PASOS_BINS = 8          # ACTIVITY_STEP_BINS
+N_ENTRADAS = 8          # ACTIVITY_N_INPUTS
+Q_MAX = 127             # ACTIVITY_Q_MAX
+RANGO_Z = 4             # desvíos estándar que cubre el rango int8 de cada característica
+
+
+def f32(valor):
+    """Redondeo a float de 32 bits"""
+    return struct.unpack('f', struct.pack('f', valor))[0]
+
+
+# %% Señales sintéticas: inclinación (grados) y módulo (g) por muestra, y clase de cada muestra
+def ruido(n, desvio, fs, fc=3.0):
+    """Ruido gaussiano pasado por un pasa bajos de 1er orden (como la salida filtrada)"""
+    a = math.exp(-2 * math.pi * fc / fs)
+    y, salida = 0.0, []
+    for _ in range(n):
+        y = a * y + (1 - a) * random.gauss(0, desvio / math.sqrt((1 - a) / (1 + a)))
+        salida.append(y)
+    return salida
+
+
+def balanceo(n, fs):
+    """Balanceo lento de una postura mantenida"""
+    comp = [(random.uniform(0.2, 1.0), random.uniform(0.05, 0.4), random.uniform(0, 2 * math.pi)) for _ in range(2)]
+    return [sum(a * math.sin(2 * math.pi * f * i / fs + p) for a, f, p in comp) for i in range(n)]
+
+
+def quieto(duracion, fs):
+    n = int(duracion * fs)
+    tilt = [random.uniform(0, 45)] * n
+    # cambios lentos de postura que se mantienen
+    t = int(random.uniform(5, 20) * fs)
+    while t < n:
+        largo = int(random.uniform(1.0, 3.0) * fs)
+        delta = random.uniform(-25, 25)
+        for i in range(t, n):
+            tilt[i] += delta * min(1.0, (i - t) / largo)
+        t += largo + int(random.uniform(10, 30) * fs)
+    sway = balanceo(n, fs)
+    tilt = [max(0.0, v + s + r) for v, s, r in zip(tilt, sway, ruido(n, 0.2, fs))]
+    mag = [1 + r for r in ruido(n, 0.003, fs)]
+    return tilt, mag, [0] * n
+
+
+def alcance(duracion, fs):
+    n = int(duracion * fs)
+    base = random.uniform(0, 30)
+    tilt, mag, clase = [base] * n, [1.0] * n, [0] * n
+    t = int(random.uniform(2, 6) * fs)
+    while t < n:
+        ida = int(random.uniform(0.4, 1.0) * fs)
+        espera = int(random.uniform(0, 2.5) * fs)
+        vuelta = int(random.uniform(0.4, 1.0) * fs)
+        delta = random.uniform(15, 50)
+        golpe = random.uniform(0.03, 0.12)
+        for k in range(ida + espera + vuelta):
+            i = t + k
+            if i >= n:
+                break
+            if k < ida:
+                fase = k / ida
+                tilt[i] = base + delta * (1 - math.cos(math.pi * fase)) / 2
+                mag[i] += golpe * math.sin(2 * math.pi * fase)
+            elif k < ida + espera:
+                tilt[i] = base + delta
+            else:
+                fase = (k - ida - espera) / vuelta
+                tilt[i] = base + delta * (1 + math.cos(math.pi * fase)) / 2
+                mag[i] -= golpe * math.sin(2 * math.pi * fase)
+            clase[i] = 1
+        t += ida + espera + vuelta + int(random.uniform(3, 12) * fs)
+    sway = balanceo(n, fs)
+    tilt = [max(0.0, v + s + r) for v, s, r in zip(tilt, sway, ruido(n, 0.2, fs))]
+    mag = [v + r for v, r in zip(mag, ruido(n, 0.003, fs))]
+    return tilt, mag, clase
+
+
+def caminata(duracion, fs):
+    n = int(duracion * fs)
+    base = random.uniform(0, 20)
+    f = random.uniform(1.4, 2.3)
+    a = random.uniform(0.08, 0.35)
+    osc = random.uniform(1, 4)
+    fase = random.uniform(0, 2 * math.pi)
+    tilt = [max(0.0, base + osc * math.sin(math.pi * f * i / fs + fase) + r) for i, r in enumerate(ruido(n, 0.5, fs))]
+    mag = [1 + a * math.sin(2 * math.pi * f * i / fs) + 0.3 * a * math.sin(4 * math.pi * f * i / fs + fase) + r
+           for i, r in enumerate(ruido(n, 0.01, fs))]
+    return tilt, mag, [2] * n
+
+
+# %% Características, igual que ActivityAdd()
+def welford_union(a, b):
+    """Une las estadísticas (n, media, m2) de dos segmentos"""
+    n = a[0] + b[0]
+    if b[0] == 0:
+        return a
+    delta = b[1] - a[1]
+    return (n, a[1] + delta * b[0] / n, a[2] + b[2] + delta * delta * a[0] * b[0] / n)
+
+
+def welford(valores):
+    n, media, m2 = 0, 0.0, 0.0
+    for x in valores:
+        n += 1
+        delta = x - media
+        media += delta / n
+        m2 += delta * (x - media)
+    return (n, media, m2)
+
+
+def banda_pasos(mag, fs, varianza):
+    """Frecuencia dominante y fracción de la varianza en la banda de pasos (Goertzel)"""
+    n = len(mag)
+    bin_hz = fs / n
+    primero = math.ceil(PASOS_MIN_HZ / bin_hz)
+    a = []
+    for k in range(primero, primero + PASOS_BINS):
+        coef = 2 * math.cos(2 * math.pi * k / n)
+        s1 = s2 = 0.0
+        for x in mag:
+            s1, s2 = x - 1 + coef * s1 - s2, s1
+        a.append(2 * math.sqrt(max(0.0, s1 * s1 + s2 * s2 - coef * s1 * s2)) / n)
+    mejor = a.index(max(a))
+    d = 0.0
+    if 0 < mejor < PASOS_BINS - 1:
+        den = a[mejor - 1] - 2 * a[mejor] + a[mejor + 1]
+        if den < 0:
+            d = 0.5 * (a[mejor - 1] - a[mejor + 1]) / den
+    potencia = sum(v * v / 2 for v in a)
+    return (primero + mejor + d) * bin_hz, min(potencia / varianza, 1.0) if varianza > 0 else 0.0
+
+
+def ventanas(tilt, mag, clase, fs, segmento_ms):
+    """Características y clase de cada ventana completa de la señal"""
+    muestras = round(segmento_ms * fs / 1000)
+    segmentos, salida = [], []
+    for inicio in range(0, len(tilt) - muestras + 1, muestras):
+        t = tilt[inicio:inicio + muestras]
+        segmentos.append((welford(t), welford(mag[inicio:inicio + muestras]), min(t), max(t), inicio,
+                          clase[inicio:inicio + muestras]))
+        if len(segmentos) < SEGMENTOS:
+            continue
+        v = segmentos[-SEGMENTOS:]
+        wt, wm = (0, 0.0, 0.0), (0, 0.0, 0.0)
+        for s in v:
+            wt, wm = welford_union(wt, s[0]), welford_union(wm, s[1])
+        car = [math.sqrt(wt[2] / wt[0]),
+               max(s[3] for s in v) - min(s[2] for s in v),
+               abs(v[-1][0][1] - v[0][0][1]),
+               math.sqrt(wm[2] / wm[0]),
+               *banda_pasos(mag[v[0][4]:v[-1][4] + muestras], fs, wm[2] / wm[0])]
+        etiquetas = [c for s in v for c in s[5]]
+        if 2 in etiquetas:
+            etiqueta = 2
+        elif etiquetas.count(1) >= len(etiquetas) / 4:
+            etiqueta = 1
+        else:
+            etiqueta = 0
+        salida.append((car, etiqueta))
+    return salida
+
+
+# %% Modelo
+def cuantizar(car, offset, gain):
+    return [max(-Q_MAX, min(Q_MAX, round((c - o) * g))) for c, o, g in zip(car, offset, gain)]
+
+
+def entrenar(x, y, iteraciones, paso=0.5, l2=1e-3):
+    """Regresión logística multiclase por descenso de gradiente, clases balanceadas"""
+    n_car, n_cl = len(x[0]), len(CLASES)
+    w = [[0.0] * (n_car + 1) for _ in range(n_cl)]
+    peso_clase = [len(y) / (n_cl * max(1, y.count(k))) for k in range(n_cl)]
+    total = sum(peso_clase[k] for k in y)
+    for _ in range(iteraciones):
+        grad = [[0.0] * (n_car + 1) for _ in range(n_cl)]
+        for xi, yi in zip(x, y):
+            z = [sum(wk[j] * xi[j] for j in range(n_car)) + wk[n_car] for wk in w]
+            m = max(z)
+            e = [math.exp(v - m) for v in z]
+            s = sum(e)
+            for k in range(n_cl):
+                d = peso_clase[yi] * (e[k] / s - (1 if k == yi else 0))
+                for j in range(n_car):
+                    grad[k][j] += d * xi[j]
+                grad[k][n_car] += d
+        for k in range(n_cl):
+            for j in range(n_car + 1):
+                w[k][j] -= paso * (grad[k][j] / total + (l2 * w[k][j] if j < n_car else 0))
+    return w
+
+
+def puntaje_int(q, pesos, shift):
+    """Como dspi_dotprod_s8_ansi: suma, redondeo y desplazamiento"""
+    acc = sum(a * b for a, b in zip(q + [Q_MAX] + [0] * (N_ENTRADAS - len(q) - 1), pesos))
+    return (acc + (1 << (shift - 1))) >> shift
+
+
+def clasificar_int(q, pesos, shift):
+    puntajes = [puntaje_int(q, p, shift) for p in pesos]
+    return puntajes.index(max(puntajes))
+
+
+def matriz(y, pred):
+    m = [[0] * len(CLASES) for _ in CLASES]
+    for a, b in zip(y, pred):
+        m[a][b] += 1
+    return m
+
+
+# %% Lectura de argumentos
+parser = argparse.ArgumentParser(description='Entrenamiento del clasificador de actividad')
+parser.add_argument('nombre', help='prefijo del modelo y del archivo')
+parser.add_argument('--fs', type=float, required=True, help='frecuencia de salida del posture_pipeline (Hz)')
+parser.add_argument('--segmento', type=int, default=1000, help='duración de cada segmento (ms)')
+parser.add_argument('--senales', type=int, default=40, help='señales sintéticas de cada clase')
+parser.add_argument('--iteraciones', type=int, default=300, help='iteraciones del entrenamiento')
+parser.add_argument('--csv', help='ventanas reales etiquetadas')
+parser.add_argument('--semilla', type=int, default=1, help='semilla de las señales sintéticas')
+args = parser.parse_args()
+random.seed(args.semilla)
+
+# %% Ventanas de entrenamiento
+datos = []
+for generador in (quieto, alcance, caminata):
+    for _ in range(args.senales):
+        datos += ventanas(*generador(60, args.fs), args.fs, args.segmento)
+if args.csv:
+    with open(args.csv, encoding='utf-8') as f:
+        for linea in f:
+            campos = linea.strip().split(',')
+            if len(campos) == len(CARACTERISTICAS) + 1 and campos[-1] in CLASES:
+                datos.append(([float(c) for c in campos[:-1]], CLASES.index(campos[-1])))
+random.shuffle(datos)
+x = [d[0] for d in datos]
+y = [d[1] for d in datos]
+print('ventanas: ' + ', '.join(f'{c} {y.count(k)}' for k, c in enumerate(CLASES)))
+
+# %% Cuantización de las características: RANGO_Z desvíos a cada lado de la media
+n = len(x)
+offset = [f32(sum(v[j] for v in x) / n) for j in range(len(CARACTERISTICAS))]
+desvio = [math.sqrt(sum((v[j] - offset[j]) ** 2 for v in x) / n) for j in range(len(CARACTERISTICAS))]
+gain = [f32(Q_MAX / (RANGO_Z * max(d, 1e-6))) for d in desvio]
+unidad = Q_MAX / RANGO_Z
+xq = [cuantizar(v, offset, gain) for v in x]
+
+# %% Entrenamiento sobre las características cuantizadas (en desvíos)
+w = entrenar([[q / unidad for q in v] for v in xq], y, args.iteraciones)
+
+# %% Pesos int8: el mayor llega a 127, el sesgo es el peso de la entrada fija en 127
+escala = Q_MAX / max(max(abs(v) / unidad for wk in w for v in wk[:-1]), max(abs(wk[-1]) / Q_MAX for wk in w))
+pesos = []
+for wk in w:
+    fila = [round(v * escala / unidad) for v in wk[:-1]] + [round(wk[-1] * escala / Q_MAX)]
+    pesos.append(fila + [0] * (N_ENTRADAS - len(fila)))
+# desplazamiento para que ningún puntaje se salga de int8
+shift = max(1, math.ceil(math.log2(max(sum(abs(v) for v in p) for p in pesos) + 1)))
+
+# %% Evaluación: modelo real y cuantizado
+pred_float = [max(range(len(CLASES)), key=lambda k: sum(w[k][j] * q / unidad for j, q in enumerate(v)) + w[k][-1])
+              for v in xq]
+pred_int = [clasificar_int(v, pesos, shift) for v in xq]
+for titulo, pred in (('float', pred_float), ('int8', pred_int)):
+    aciertos = sum(a == b for a, b in zip(y, pred)) / n
+    print(f'{titulo}: {100 * aciertos:.1f} % de aciertos (filas: clase, columnas: predicción)')
+    for k, fila in enumerate(matriz(y, pred)):
+        print(f'  {CLASES[k]:9s}' + ''.join(f'{v:7d}' for v in fila))
+
+# %% Guardado en archivo .h
+nombre = args.nombre
+with open(f'{nombre}_actividad.h', 'w', encoding='utf-8') as f:
+    filas = '\n'.join('        {' + ', '.join(f'{v:4d}' for v in p) + '},' + f'   /* {CLASES[k]} */'
+                       for k, p in enumerate(pesos))
+    f.write(f'''/**
+ * @file {nombre}_actividad.h
+ * @brief Clasificador de actividad para fs = {args.fs:g} Hz, segmentos de {args.segmento} ms
+ * @note Creado con activity_model.py: {args.senales} señales sintéticas por clase{', ventanas de ' + args.csv if args.csv else ''}
+ * (semilla {args.semilla}), {100 * sum(a == b for a, b in zip(y, pred_int)) / n:.1f} % de aciertos en int8
+ */
+#include "activity_classifier.h"
+
+/* Características: {', '.join(CARACTERISTICAS)} */
+static const activity_model_t {nombre}_actividad = {{
+    .segment_ms = {args.segmento},
+    .offset = {{{', '.join('%.9gf' % v for v in offset)}}},
+    .gain = {{{', '.join('%.9gf' % v for v in gain)}}},
+    .weight = {{
+{filas}
+    }},
+    .shift = {shift},
+}};
+''')
+print(f'{nombre}_actividad.h: shift {shift}')
@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 22:00:00 2026
+
+@author: Albano Peñalva
+
+Decodificador off-line de los bloques de dct_codec (dct_codec.h, middelware).
+Cada bloque es una ventana de n muestras int16:
+
+    paso (2)        paso de cuantización en 1/16 de la unidad, little endian
+    m (1)           coeficientes codificados, el resto son 0
+    DC (2)          primer coeficiente en pasos (int16, little endian)
+    coeficientes    1 a m - 1, en zig-zag con código Rice de parámetro
+                    adaptivo (como RICE de sample_stream.py); 16 unos
+                    anuncian el coeficiente int16 completo
+
+Los coeficientes son los de la DCT-II ortonormal: las muestras se recuperan
+con la DCT-III ortonormal de los coeficientes por el paso.
+
+Uso:
+    python dct_codec.py bloques.bin -n 64                (un canal)
+    python dct_codec.py bloques.bin -n 64 --canales 3    (ventanas de ax, ay, az alternadas)
+
+Los bloques están uno a continuación del otro ("-" lee de la entrada estándar).
+Imprime una muestra por línea, los canales separados por comas.
+"""
+
+# Librerías
+import argparse
+import math
+import struct
+import sys
+
+CABECERA = 5
+RICE_Q_MAX = 16
+RICE_K_MAX = 15
+RICE_SUMA_INICIAL = 16
+RICE_REINICIO = 32
+
+
+class LectorBits:
+    """Lee bits de un bloque, el más significativo primero."""
+
+    def __init__(self, datos):
+        self.datos = datos
+        self.pos = 0
+
+    def leer(self, n):
+        valor = 0
+        for _ in range(n):
+            byte = self.datos[self.pos >> 3]
+            valor = (valor << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return valor
+
+
+def a_int16(valor):
+    return valor - 0x10000 if valor & 0x8000 else valor
+
+
+def idct(coeficientes, n):
+    """DCT-III ortonormal (inversa de la DCT-II ortonormal)."""
+    muestras = []
+    for i in range(n):
+        suma = coeficientes[0] * math.sqrt(1 / n)
+        for k in range(1, len(coeficientes)):
+            suma += coeficientes[k] * math.sqrt(2 / n) * math.cos(math.pi * k * (i + 0.5) / n)
+        muestras.append(suma)
+    return muestras
+
+
+def decodificar(datos, n):
+    """Devuelve (muestras, bytes del bloque) del bloque al principio de datos."""
+    paso_q4, m, dc = struct.unpack_from('<HBh', datos)
+    if m == 0 or m > n or paso_q4 == 0:
+        raise ValueError('bloque inválido')
+    paso = paso_q4 / 16
+    lector = LectorBits(datos[CABECERA:])
+    coeficientes = [dc]
+    suma, corridas = RICE_SUMA_INICIAL, 1
+    while len(coeficientes) < m:
+        k = 0
+        while k < RICE_K_MAX and (corridas << k) < suma:
+            k += 1
+        q = 0
+        while q < RICE_Q_MAX and lector.leer(1):
+            q += 1
+        if q == RICE_Q_MAX:
+            valor = a_int16(lector.leer(16))
+            u = 2 * valor if valor >= 0 else -2 * valor - 1
+        else:
+            u = (q << k) | lector.leer(k)
+            valor = u >> 1 if u % 2 == 0 else -((u + 1) >> 1)
+        coeficientes.append(valor)
+        suma += u
+        corridas += 1
+        if corridas == RICE_REINICIO:
+            suma >>= 1
+            corridas >>= 1
+    muestras = [max(-32767, min(32767, round(x))) for x in idct([c * paso for c in coeficientes], n)]
+    return muestras, CABECERA + (lector.pos + 7) // 8
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decodificador de bloques de dct_codec')
+    parser.add_argument('archivo', help='bloques, uno a continuación del otro (- para stdin)')
+    parser.add_argument('-n', type=int, default=64, help='muestras por ventana')
+    parser.add_argument('--canales', type=int, default=1, help='canales con ventanas alternadas')
+    args = parser.parse_args()
+
+    datos = sys.stdin.buffer.read() if args.archivo == '-' else open(args.archivo, 'rb').read()
+    pos = 0
+    while pos + CABECERA <= len(datos):
+        ventanas = []
+        for _ in range(args.canales):
+            muestras, largo = decodificar(datos[pos:], args.n)
+            ventanas.append(muestras)
+            pos += largo
+        for fila in zip(*ventanas):
+            print(','.join(str(m) for m in fila))
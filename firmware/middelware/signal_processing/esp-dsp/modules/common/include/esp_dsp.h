@@ -60,6 +60,7 @@ extern "C"
 
 #ifdef __cplusplus
 #include "mat.h"
+#include "mat_n.h"
 #endif
 
 #endif // _esp_dsp_H_
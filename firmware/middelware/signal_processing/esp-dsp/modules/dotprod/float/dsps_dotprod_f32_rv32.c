@@ -0,0 +1,32 @@
+// ESP32-C6 (RV32IMAC) version of dsps_dotprod_f32_ansi.
+//
+// Four independent accumulators and one pointer increment per four
+// products. The C6 has no FPU, the partial sums only cut loop overhead and
+// loads; the rounding differs from the ANSI version by the summation order.
+
+#include "dsps_dotprod.h"
+
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+
+esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len)
+{
+    float acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+    const float *end4 = src1 + (len & ~3);
+    const float *end = src1 + len;
+
+    while (src1 < end4) {
+        acc0 += src1[0] * src2[0];
+        acc1 += src1[1] * src2[1];
+        acc2 += src1[2] * src2[2];
+        acc3 += src1[3] * src2[3];
+        src1 += 4;
+        src2 += 4;
+    }
+    while (src1 < end) {
+        acc0 += *src1++ * *src2++;
+    }
+    *dest = (acc0 + acc1) + (acc2 + acc3);
+    return ESP_OK;
+}
+
+#endif // dsps_dotprod_f32_rv32_enabled
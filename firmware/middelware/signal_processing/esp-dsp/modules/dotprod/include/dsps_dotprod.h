@@ -65,6 +65,7 @@ esp_err_t dsps_dotprod_s16_ae32(const int16_t *src1, const int16_t *src2, int16_
 esp_err_t dsps_dotprod_f32_ansi(const float *src1, const float *src2, float *dest, int len);
 esp_err_t dsps_dotprod_f32_ae32(const float *src1, const float *src2, float *dest, int len);
 esp_err_t dsps_dotprod_f32_aes3(const float *src1, const float *src2, float *dest, int len);
+esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len);
 /**@}*/
 
 /**@{*/
@@ -106,6 +107,9 @@ esp_err_t dsps_dotprode_f32_ae32(const float *src1, const float *src2, float *de
 #elif (dotprod_f32_ae32_enabled == 1)
 #define dsps_dotprod_f32 dsps_dotprod_f32_ae32
 #define dsps_dotprode_f32 dsps_dotprode_f32_ae32
+#elif (dsps_dotprod_f32_rv32_enabled == 1)
+#define dsps_dotprod_f32 dsps_dotprod_f32_rv32
+#define dsps_dotprode_f32 dsps_dotprode_f32_ansi
 #else
 #define dsps_dotprod_f32 dsps_dotprod_f32_ansi
 #define dsps_dotprode_f32 dsps_dotprode_f32_ansi
@@ -113,7 +117,12 @@ esp_err_t dsps_dotprode_f32_ae32(const float *src1, const float *src2, float *de
 
 #else // CONFIG_DSP_OPTIMIZED
 #define dsps_dotprod_s16 dsps_dotprod_s16_ansi
+// plain C, selected without CONFIG_DSP_OPTIMIZED as well
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+#define dsps_dotprod_f32 dsps_dotprod_f32_rv32
+#else
 #define dsps_dotprod_f32 dsps_dotprod_f32_ansi
+#endif
 #define dsps_dotprode_f32 dsps_dotprode_f32_ansi
 #endif // CONFIG_DSP_OPTIMIZED
 
@@ -29,4 +29,8 @@
 #endif
 
 
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_dotprod_f32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+
 #endif // _dsps_dotprod_platform_H_
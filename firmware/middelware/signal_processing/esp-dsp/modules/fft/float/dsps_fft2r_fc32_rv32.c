@@ -0,0 +1,60 @@
+// ESP32-C6 (RV32IMAC) version of dsps_fft2r_fc32_ansi_.
+//
+// Pointer walk instead of index arithmetic, and the first group of every
+// stage (twiddle w[0] = 1 + 0j) is done without products: N - 1 of the
+// N/2 * log2(N) butterflies. The C6 has no FPU, each skipped product saves
+// a soft-float call. The other butterflies keep the ANSI operation order.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    float re_temp, im_temp;
+    float *p0, *p1;
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        p0 = data;
+        p1 = data + 2 * N2;
+        for (int i = 0; i < N2; i++) {
+            re_temp = p1[0];
+            im_temp = p1[1];
+            p1[0] = p0[0] - re_temp;
+            p1[1] = p0[1] - im_temp;
+            p0[0] = p0[0] + re_temp;
+            p0[1] = p0[1] + im_temp;
+            p0 += 2;
+            p1 += 2;
+        }
+        for (int j = 1; j < ie; j++) {
+            const float c = w[2 * j];
+            const float s = w[2 * j + 1];
+            // the next group starts where the second half of this one ended
+            p0 = p1;
+            p1 = p0 + 2 * N2;
+            for (int i = 0; i < N2; i++) {
+                re_temp = c * p1[0] + s * p1[1];
+                im_temp = c * p1[1] - s * p1[0];
+                p1[0] = p0[0] - re_temp;
+                p1[1] = p0[1] - im_temp;
+                p0[0] = p0[0] + re_temp;
+                p0[1] = p0[1] + im_temp;
+                p0 += 2;
+                p1 += 2;
+            }
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
@@ -0,0 +1,80 @@
+// ESP32-C6 (RV32IMAC) version of dsps_fft4r_fc32_ansi_.
+//
+// The radix-4 butterfly shares its partial sums (in0 +- in2, in1 +- in3):
+// 16 additions instead of 24 per butterfly, each one a soft-float call on
+// the C6, which has no FPU. The rounding differs slightly from the ANSI
+// version because of the different summation order.
+
+#include "dsps_fft4r.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+
+#if (dsps_fft4r_fc32_rv32_enabled == 1)
+
+esp_err_t dsps_fft4r_fc32_rv32_(float *data, int length, float *table, int table_size)
+{
+    if (0 == dsps_fft4r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    int log2N = dsp_power_of_two(length);
+    int log4N = log2N >> 1;
+    if ((log2N & 0x01) != 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+
+    int m = 2;
+    int wind_step = table_size / length;
+    for (; log4N > 0; log4N--) {
+        length = length >> 2;
+        for (int j = 0; j < m; j += 2) { // j: which FFT of this step
+            fc32_t *ptrc0 = (fc32_t *)data + j * (length << 1);
+            fc32_t *ptrc1 = ptrc0 + length;
+            fc32_t *ptrc2 = ptrc1 + length;
+            fc32_t *ptrc3 = ptrc2 + length;
+            const fc32_t *winc0 = (fc32_t *)table;
+            const fc32_t *winc1 = winc0;
+            const fc32_t *winc2 = winc0;
+
+            for (int k = 0; k < length; k++) {
+                const float s02_re = ptrc0->re + ptrc2->re;
+                const float s02_im = ptrc0->im + ptrc2->im;
+                const float d02_re = ptrc0->re - ptrc2->re;
+                const float d02_im = ptrc0->im - ptrc2->im;
+                const float s13_re = ptrc1->re + ptrc3->re;
+                const float s13_im = ptrc1->im + ptrc3->im;
+                const float d13_re = ptrc1->re - ptrc3->re;
+                const float d13_im = ptrc1->im - ptrc3->im;
+
+                const float b1_re = d02_re + d13_im;
+                const float b1_im = d02_im - d13_re;
+                const float b2_re = s02_re - s13_re;
+                const float b2_im = s02_im - s13_im;
+                const float b3_re = d02_re - d13_im;
+                const float b3_im = d02_im + d13_re;
+
+                ptrc0->re = s02_re + s13_re;
+                ptrc0->im = s02_im + s13_im;
+                ptrc1->re = b1_re * winc0->re + b1_im * winc0->im;
+                ptrc1->im = b1_im * winc0->re - b1_re * winc0->im;
+                ptrc2->re = b2_re * winc1->re + b2_im * winc1->im;
+                ptrc2->im = b2_im * winc1->re - b2_re * winc1->im;
+                ptrc3->re = b3_re * winc2->re + b3_im * winc2->im;
+                ptrc3->im = b3_im * winc2->re - b3_re * winc2->im;
+
+                winc0 += wind_step;
+                winc1 += 2 * wind_step;
+                winc2 += 3 * wind_step;
+                ptrc0++;
+                ptrc1++;
+                ptrc2++;
+                ptrc3++;
+            }
+        }
+        m = m << 2;
+        wind_step = wind_step << 2;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft4r_fc32_rv32_enabled
@@ -33,4 +33,8 @@
 #endif
 
 
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_fft2r_fc32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+
 #endif // _dsps_fft2r_platform_H_
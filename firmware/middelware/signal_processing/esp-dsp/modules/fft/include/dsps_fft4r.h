@@ -89,11 +89,13 @@ void dsps_fft4r_deinit_fc32(void);
  */
 esp_err_t dsps_fft4r_fc32_ansi_(float *data, int N, float *table, int table_size);
 esp_err_t dsps_fft4r_fc32_ae32_(float *data, int N, float *table, int table_size);
+esp_err_t dsps_fft4r_fc32_rv32_(float *data, int N, float *table, int table_size);
 /**@}*/
 // This is workaround because linker generates permanent error when assembler uses
 // direct access to the table pointer
 #define dsps_fft4r_fc32_ansi(data, N) dsps_fft4r_fc32_ansi_(data, N, dsps_fft4r_w_table_fc32, dsps_fft4r_w_table_size)
 #define dsps_fft4r_fc32_ae32(data, N) dsps_fft4r_fc32_ae32_(data, N, dsps_fft4r_w_table_fc32, dsps_fft4r_w_table_size)
+#define dsps_fft4r_fc32_rv32(data, N) dsps_fft4r_fc32_rv32_(data, N, dsps_fft4r_w_table_fc32, dsps_fft4r_w_table_size)
 
 /**@{*/
 /**
@@ -154,6 +156,8 @@ esp_err_t dsps_gen_bitrev4r_table(int N, int step, char *name_ext);
 #if CONFIG_DSP_OPTIMIZED
 #if (dsps_fft4r_fc32_ae32_enabled == 1)
 #define dsps_fft4r_fc32 dsps_fft4r_fc32_ae32
+#elif (dsps_fft4r_fc32_rv32_enabled == 1)
+#define dsps_fft4r_fc32 dsps_fft4r_fc32_rv32
 #else
 #define dsps_fft4r_fc32 dsps_fft4r_fc32_ansi
 #endif // dsps_fft4r_fc32_ae32_enabled
@@ -167,8 +171,13 @@ esp_err_t dsps_gen_bitrev4r_table(int N, int step, char *name_ext);
 #define dsps_cplx2real_fc32 dsps_cplx2real_fc32_ansi
 #endif // dsps_cplx2real_fc32_ae32_enabled
 
+#else
+// plain C, selected without CONFIG_DSP_OPTIMIZED as well
+#if (dsps_fft4r_fc32_rv32_enabled == 1)
+#define dsps_fft4r_fc32 dsps_fft4r_fc32_rv32
 #else
 #define dsps_fft4r_fc32 dsps_fft4r_fc32_ansi
+#endif
 #define dsps_fft4r_sc16 dsps_fft4r_sc16_ansi
 #define dsps_bit_rev4r_fc32 dsps_bit_rev4r_fc32
 #define dsps_cplx2real_fc32 dsps_cplx2real_fc32_ansi
@@ -31,4 +31,8 @@
 
 
 
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_fft4r_fc32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+
 #endif // _dsps_fft4r_platform_H_
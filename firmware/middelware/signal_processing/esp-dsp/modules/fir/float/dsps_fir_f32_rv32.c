@@ -0,0 +1,50 @@
+// ESP32-C6 (RV32IMAC) version of dsps_fir_f32_ansi.
+//
+// The circular delay line is walked as two linear runs (oldest to the end,
+// then the start) with two accumulators per run, and the filter state stays
+// in registers along the block. The C6 has no FPU, the gain is in loads,
+// index arithmetic and branches around each soft-float product.
+
+#include "dsps_fir.h"
+
+#if (dsps_fir_f32_rv32_enabled == 1)
+
+static inline float dsps_fir_run_rv32(const float *coeffs, const float *delay, int n, float acc)
+{
+    float acc1 = 0;
+    const float *end2 = delay + (n & ~1);
+    const float *end = delay + n;
+
+    while (delay < end2) {
+        acc += coeffs[0] * delay[0];
+        acc1 += coeffs[1] * delay[1];
+        coeffs += 2;
+        delay += 2;
+    }
+    if (delay < end) {
+        acc += coeffs[0] * delay[0];
+    }
+    return acc + acc1;
+}
+
+esp_err_t dsps_fir_f32_rv32(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    float *delay = fir->delay;
+    const float *coeffs = fir->coeffs;
+    const int N = fir->N;
+    int pos = fir->pos;
+
+    for (int i = 0 ; i < len ; i++) {
+        delay[pos] = input[i];
+        if (++pos >= N) {
+            pos = 0;
+        }
+        // oldest sample first: delay[pos..N-1] then delay[0..pos-1]
+        float acc = dsps_fir_run_rv32(coeffs, &delay[pos], N - pos, 0);
+        output[i] = dsps_fir_run_rv32(&coeffs[N - pos], delay, pos, acc);
+    }
+    fir->pos = pos;
+    return ESP_OK;
+}
+
+#endif // dsps_fir_f32_rv32_enabled
@@ -28,4 +28,8 @@
 #endif //
 #endif // __XTENSA__
 
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_fir_f32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+
 #endif // _dsps_fir_platform_H_
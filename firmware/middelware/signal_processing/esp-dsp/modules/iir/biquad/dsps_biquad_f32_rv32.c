@@ -0,0 +1,43 @@
+// ESP32-C6 (RV32IMAC) version of dsps_biquad_f32_ansi.
+//
+// The C6 has no FPU: every float operation is a libgcc call, so the gain
+// comes from keeping the coefficients and the delay line in registers and
+// from running two samples per iteration. Same operation order as the ANSI
+// version, so the output is bit exact.
+
+#include "dsps_biquad.h"
+
+#if (dsps_biquad_f32_rv32_enabled == 1)
+
+esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w)
+{
+    const float b0 = coef[0];
+    const float b1 = coef[1];
+    const float b2 = coef[2];
+    const float a1 = coef[3];
+    const float a2 = coef[4];
+    float w0 = w[0];
+    float w1 = w[1];
+    float d0, d1;
+    int i = 0;
+
+    for (; i + 1 < len; i += 2) {
+        d0 = input[i] - a1 * w0 - a2 * w1;
+        output[i] = b0 * d0 + b1 * w0 + b2 * w1;
+        d1 = input[i + 1] - a1 * d0 - a2 * w0;
+        output[i + 1] = b0 * d1 + b1 * d0 + b2 * w0;
+        w1 = d0;
+        w0 = d1;
+    }
+    if (i < len) {
+        d0 = input[i] - a1 * w0 - a2 * w1;
+        output[i] = b0 * d0 + b1 * w0 + b2 * w1;
+        w1 = w0;
+        w0 = d0;
+    }
+    w[0] = w0;
+    w[1] = w1;
+    return ESP_OK;
+}
+
+#endif // dsps_biquad_f32_rv32_enabled
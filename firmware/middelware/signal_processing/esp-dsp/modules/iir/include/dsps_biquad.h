@@ -46,6 +46,7 @@ extern "C"
 esp_err_t dsps_biquad_f32_ansi(const float *input, float *output, int len, float *coef, float *w);
 esp_err_t dsps_biquad_f32_ae32(const float *input, float *output, int len, float *coef, float *w);
 esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float *coef, float *w);
+esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w);
 /**@}*/
 
 
@@ -59,13 +60,20 @@ esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float
 #define dsps_biquad_f32 dsps_biquad_f32_ae32
 #elif (dsps_biquad_f32_aes3_enabled == 1)
 #define dsps_biquad_f32 dsps_biquad_f32_aes3
+#elif (dsps_biquad_f32_rv32_enabled == 1)
+#define dsps_biquad_f32 dsps_biquad_f32_rv32
 #else
 #define dsps_biquad_f32 dsps_biquad_f32_ansi
 #endif
 
 #else // CONFIG_DSP_OPTIMIZED
 
+// plain C, selected without CONFIG_DSP_OPTIMIZED as well
+#if (dsps_biquad_f32_rv32_enabled == 1)
+#define dsps_biquad_f32 dsps_biquad_f32_rv32
+#else
 #define dsps_biquad_f32 dsps_biquad_f32_ansi
+#endif
 
 #endif // CONFIG_DSP_OPTIMIZED
 
@@ -22,4 +22,8 @@
 #endif // __XTENSA__
 
 
+#if CONFIG_IDF_TARGET_ESP32C6
+#define dsps_biquad_f32_rv32_enabled 1
+#endif // CONFIG_IDF_TARGET_ESP32C6
+
 #endif // _dsps_biquad_platform_H_
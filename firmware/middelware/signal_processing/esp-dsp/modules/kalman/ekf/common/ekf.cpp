@@ -22,7 +22,14 @@ ekf::ekf(int x, int w) : NUMX(x),
     F(*new dspm::Mat(x, x)),
     G(*new dspm::Mat(x, w)),
     P(*new dspm::Mat(x, x)),
-    Q(*new dspm::Mat(w, w))
+    Q(*new dspm::Mat(w, w)),
+
+    Xlast(x, 1),
+    Xdot(x, 1),
+    Kacc(x, 1),
+    Fd(x, x),
+    FP(x, x),
+    GQ(x, w)
 {
 
     this->P *= 0;
@@ -45,8 +52,8 @@ ekf::~ekf()
     delete &P;
     delete &Q;
 
-    delete this->HP;
-    delete this->Km;
+    delete[] this->HP;
+    delete[] this->Km;
 }
 
 void ekf::Process(float *u, float dt)
@@ -60,91 +67,123 @@ void ekf::RungeKutta(dspm::Mat &x, float *U, float dt)
 {
 
     float dt2 = dt / 2.0f;
+    float *k = this->Xdot.data;
+    float *acc = this->Kacc.data;
+    float *xlast = this->Xlast.data;
+
+    // Same steps as the expression form, on the preallocated vectors
+    this->Xlast = x;                    // make a working copy
+    this->StateXdotInto(x, U, this->Xdot); // k1 = f(x, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        acc[i] = k[i];
+        x(i, 0) = xlast[i] + k[i] * dt2;
+    }
 
-    dspm::Mat Xlast = x;          // make a working copy
-    dspm::Mat K1 = StateXdot(x, U); // k1 = f(x, u)
-    x = Xlast + (K1 * dt2);
-
-    dspm::Mat K2 = StateXdot(x, U); // k2 = f(x + 0.5*dT*k1, u)
-    x = Xlast + K2 * dt2;
+    this->StateXdotInto(x, U, this->Xdot); // k2 = f(x + 0.5*dT*k1, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        acc[i] += 2.0f * k[i];
+        x(i, 0) = xlast[i] + k[i] * dt2;
+    }
 
-    dspm::Mat K3 = StateXdot(x, U); // k3 = f(x + 0.5*dT*k2, u)
-    x = Xlast + K3 * dt;
+    this->StateXdotInto(x, U, this->Xdot); // k3 = f(x + 0.5*dT*k2, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        acc[i] += 2.0f * k[i];
+        x(i, 0) = xlast[i] + k[i] * dt;
+    }
 
-    dspm::Mat K4 = StateXdot(x, U); // k4 = f(x + dT * k3, u)
+    this->StateXdotInto(x, U, this->Xdot); // k4 = f(x + dT * k3, u)
 
     // Xnew = X + dT * (k1 + 2 * k2 + 2 * k3 + k4) / 6
-    x = Xlast + (K1 + 2.0f * K2 + 2.0f * K3 + K4) * (dt / 6.0f);
+    for (int i = 0; i < this->NUMX; i++) {
+        x(i, 0) = xlast[i] + (acc[i] + k[i]) * (dt / 6.0f);
+    }
 }
 
 dspm::Mat ekf::SkewSym4x4(float w[3])
+{
+    dspm::Mat result(4, 4);
+    SkewSym4x4(w, result);
+    return result;
+}
+
+void ekf::SkewSym4x4(float *w, dspm::Mat &result)
 {
     //={    0,  -w[0],  -w[1],  -w[2],
     //   w[0],      0,   w[2],  -w[1],
     //   w[1],  -w[2],      0,   w[0],
     //   w[2],   w[1],  -w[0],     0 };
 
-    dspm::Mat result(4, 4);
-    result.data[0] = 0;
-    result.data[1] = -w[0];
-    result.data[2] = -w[1];
-    result.data[3] = -w[2];
-
-    result.data[4] = w[0];
-    result.data[5] = 0;
-    result.data[6] = w[2];
-    result.data[7] = -w[1];
-
-    result.data[8] = w[1];
-    result.data[9] = -w[2];
-    result.data[10] = 0;
-    result.data[11] = w[0];
-
-    result.data[12] = w[2];
-    result.data[13] = w[1];
-    result.data[14] = -w[0];
-    result.data[15] = 0;
-
-    return result;
+    result(0, 0) = 0;
+    result(0, 1) = -w[0];
+    result(0, 2) = -w[1];
+    result(0, 3) = -w[2];
+
+    result(1, 0) = w[0];
+    result(1, 1) = 0;
+    result(1, 2) = w[2];
+    result(1, 3) = -w[1];
+
+    result(2, 0) = w[1];
+    result(2, 1) = -w[2];
+    result(2, 2) = 0;
+    result(2, 3) = w[0];
+
+    result(3, 0) = w[2];
+    result(3, 1) = w[1];
+    result(3, 2) = -w[0];
+    result(3, 3) = 0;
 }
 
 dspm::Mat ekf::qProduct(float *q)
 {
     dspm::Mat result(4, 4);
-
-    result.data[0] = q[0];
-    result.data[1] = -q[1];
-    result.data[2] = -q[2];
-    result.data[3] = -q[3];
-
-    result.data[4] = q[1];
-    result.data[5] = q[0];
-    result.data[6] = -q[3];
-    result.data[7] = q[2];
-
-    result.data[8] = q[2];
-    result.data[9] = q[3];
-    result.data[10] = q[0];
-    result.data[11] = -q[1];
-
-    result.data[12] = q[3];
-    result.data[13] = -q[2];
-    result.data[14] = q[1];
-    result.data[15] = q[0];
-
+    qProduct(q, result);
     return result;
 }
 
-void ekf::CovariancePrediction(float dt)
+void ekf::qProduct(float *q, dspm::Mat &result)
 {
-    dspm::Mat f = this->F * dt;
+    result(0, 0) = q[0];
+    result(0, 1) = -q[1];
+    result(0, 2) = -q[2];
+    result(0, 3) = -q[3];
+
+    result(1, 0) = q[1];
+    result(1, 1) = q[0];
+    result(1, 2) = -q[3];
+    result(1, 3) = q[2];
+
+    result(2, 0) = q[2];
+    result(2, 1) = q[3];
+    result(2, 2) = q[0];
+    result(2, 3) = -q[1];
+
+    result(3, 0) = q[3];
+    result(3, 1) = -q[2];
+    result(3, 2) = q[1];
+    result(3, 3) = q[0];
+}
 
-    f = f + dspm::Mat::eye(this->NUMX);
+void ekf::CovariancePrediction(float dt)
+{
+    // f = I + F*dt
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int j = 0; j < this->NUMX; j++) {
+            this->Fd(i, j) = this->F(i, j) * dt + ((i == j) ? 1.0f : 0.0f);
+        }
+    }
 
-    dspm::Mat f_t = f.t();
-    this->P = ((f * this->P) * f_t) + (dt * dt) * ((G * Q) * G.t());
+    // P = f*P*f' + dt^2*G*Q*G', without temporaries
+    dspm::Mat::mul_into(this->Fd, this->P, this->FP);
+    dspm::Mat::mul_t_into(this->FP, this->Fd, this->P);
+    dspm::Mat::mul_into(this->G, this->Q, this->GQ);
+    dspm::Mat::mul_t_into(this->GQ, this->G, this->FP);
+    for (int i = 0; i < this->NUMX; i++) {
+        for (int j = 0; j < this->NUMX; j++) {
+            this->P(i, j) += (dt * dt) * this->FP(i, j);
+        }
+    }
 }
-
 void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
 {
     float HPHR, Error;
@@ -206,12 +245,18 @@ void ekf::UpdateRef(dspm::Mat &H, float *measured, float *expected, float *R)
 }
 
 dspm::Mat ekf::quat2rotm(float q[4])
+{
+    dspm::Mat Rm(3, 3);
+    quat2rotm(q, Rm);
+    return Rm;
+}
+
+void ekf::quat2rotm(float q[4], dspm::Mat &Rm)
 {
     float q0 = q[0];
     float q1 = q[1];
     float q2 = q[2];
     float q3 = q[3];
-    dspm::Mat Rm(3, 3);
 
     Rm(0, 0) = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
     Rm(1, 0) = 2.0f * (q1 * q2 + q0 * q3);
@@ -222,8 +267,6 @@ dspm::Mat ekf::quat2rotm(float q[4])
     Rm(0, 2) = 2.0f * (q1 * q3 + q0 * q2);
     Rm(1, 2) = 2.0f * (q2 * q3 - q0 * q1);
     Rm(2, 2) = (q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3);
-
-    return Rm;
 }
 
 dspm::Mat ekf::quat2eul(const float q[4])
@@ -388,6 +431,12 @@ dspm::Mat ekf::dFdq(dspm::Mat &vector, dspm::Mat &q)
 dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
 {
     dspm::Mat result(3, 4);
+    dFdq_inv(vector, q, result);
+    return result;
+}
+
+void ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q, dspm::Mat &result)
+{
     result(0, 0) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
     result(0, 1) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
     result(0, 2) = -q.data[2] * vector.data[0] + q.data[1] * vector.data[1] - q.data[0] * vector.data[2];
@@ -404,7 +453,6 @@ dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
     result(2, 3) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
 
     result *= 2;
-    return result;
 }
 
 dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
@@ -413,3 +461,8 @@ dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
     dspm::Mat Xdot = (this->F * x + this->G * U);
     return Xdot;
 }
+
+void ekf::StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot)
+{
+    xdot = StateXdot(x, u);
+}
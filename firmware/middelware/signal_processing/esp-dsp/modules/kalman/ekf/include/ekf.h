@@ -31,7 +31,8 @@ public:
 
     /**
      * Constructor of EKF.
-     * THe constructor allocate main memory for the matrixes.
+     * THe constructor allocate main memory for the matrixes, and the working
+     * matrices of Process(), so the processing itself makes no heap allocations.
      * @param[in] x: - amount of states in EKF. x[n] = F*x[n-1] + G*u + W. Size of matrix F
      * @param[in] w: - amount of control measurements and noise inputs. Size of matrix G
     */
@@ -112,6 +113,15 @@ public:
      *      - derivative of input vector x and u
      */
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    /**
+     * Derivative of state vector X into a preallocated vector.
+     * Used by RungeKutta(). The default implementation copies the result of
+     * StateXdot(); a system overrides it to avoid the temporary matrices.
+     * @param[in] x: state vector
+     * @param[in] u: control measurement
+     * @param[out] xdot: derivative of input vector x and u, NUMX x 1
+     */
+    virtual void StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot);
     /**
      * Calculation of system state matrices F and G
      * @param[in] x: state vector
@@ -159,6 +169,21 @@ public:
     */
     float *Km;
 
+    /**
+     * Working matrices of RungeKutta(): state at the start of the step,
+     * derivative and weighted sum of the derivatives (NUMX x 1)
+    */
+    dspm::Mat Xlast;
+    dspm::Mat Xdot;
+    dspm::Mat Kacc;
+    /**
+     * Working matrices of CovariancePrediction(): discrete F (NUMX x NUMX),
+     * F*P or G*Q*G' (NUMX x NUMX) and G*Q (NUMX x NUMW)
+    */
+    dspm::Mat Fd;
+    dspm::Mat FP;
+    dspm::Mat GQ;
+
 public:
     // Additional universal helper methods
     /**
@@ -169,6 +194,12 @@ public:
      *      - rotation matrix 3x3
      */
     static dspm::Mat quat2rotm(float q[4]);
+    /**
+     * Convert quaternion to rotation matrix, without allocations.
+     * @param[in] q: quaternion
+     * @param[out] result: rotation matrix 3x3 (may be a sub-matrix)
+     */
+    static void quat2rotm(float q[4], dspm::Mat &result);
 
     /**
      * Convert rotation matrix to quaternion.
@@ -224,6 +255,13 @@ public:
      *      - Derivative matrix 3x4
      */
     static dspm::Mat dFdq_inv(dspm::Mat &vector, dspm::Mat &quat);
+    /**
+     * Df/dq: Derivative of vector by inverted quaternion, without allocations.
+     * @param[in] vector: input vector
+     * @param[in] quat: quaternion
+     * @param[out] result: derivative matrix 3x4 (may be a sub-matrix)
+     */
+    static void dFdq_inv(dspm::Mat &vector, dspm::Mat &quat, dspm::Mat &result);
 
     /**
      * Make skew-symmetric matrix of vector.
@@ -233,6 +271,12 @@ public:
      *      - skew-symmetric matrix 4x4
      */
     static dspm::Mat SkewSym4x4(float *w);
+    /**
+     * Make skew-symmetric matrix of vector, without allocations.
+     * @param[in] w: source vector
+     * @param[out] result: skew-symmetric matrix 4x4 (may be a sub-matrix)
+     */
+    static void SkewSym4x4(float *w, dspm::Mat &result);
 
     // q product
     // Rl = [q(1) - q(2) - q(3) - q(4); ...
@@ -248,6 +292,12 @@ public:
      *      - right quaternion-product matrix 4x4
      */
     static dspm::Mat qProduct(float *q);
+    /**
+     * Make right quaternion-product matrices, without allocations.
+     * @param[in] q: source quaternion
+     * @param[out] result: right quaternion-product matrix 4x4 (may be a sub-matrix)
+     */
+    static void qProduct(float *q, dspm::Mat &result);
 
 };
 
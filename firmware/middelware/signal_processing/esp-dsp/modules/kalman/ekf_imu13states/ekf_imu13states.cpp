@@ -16,7 +16,8 @@
 
 ekf_imu13states::ekf_imu13states() : ekf(13, 18),
     mag0(3, 1),
-    accel0(3, 1)
+    accel0(3, 1),
+    H(10, 13)
 {
     this->NUMU = 3;
 }
@@ -51,24 +52,32 @@ void ekf_imu13states::Init()
 }
 
 dspm::Mat ekf_imu13states::StateXdot(dspm::Mat &x, float *u)
+{
+    dspm::Mat Xdot(this->NUMX, 1);
+    StateXdotInto(x, u, Xdot);
+    return Xdot;
+}
+
+void ekf_imu13states::StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot)
 {
     float wx = u[0] - x(4, 0); // subtract the biases on gyros
     float wy = u[1] - x(5, 0);
     float wz = u[2] - x(6, 0);
 
     float w[] = {wx, wy, wz};
-    dspm::Mat q = dspm::Mat(x.data, 4, 1);
+    dspm::Mat omega = this->W.view();
+    dspm::MatN<4, 1> q(x.data);
 
     // qdot = Q * w
-    dspm::Mat Omega = 0.5 * SkewSym4x4(w);
-    dspm::Mat qdot = Omega * q;
-    dspm::Mat Xdot(this->NUMX, 1);
-    Xdot *= 0;
-    Xdot.Copy(qdot, 0, 0);
+    SkewSym4x4(w, omega);
+    dspm::MatN<4, 1> qdot = (0.5f * this->W) * q;
+    xdot.clear();
+    for (int i = 0; i < 4; i++) {
+        xdot(i, 0) = qdot.data[i];
+    }
     // dwbias = 0
     // dMang_Ampl = 0
     // dMang_offset = 0
-    return Xdot;
 }
 
 void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
@@ -76,28 +85,35 @@ void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
     float w[3] = {(u[0] - x(4, 0)), (u[1] - x(5, 0)), (u[2] - x(6, 0))}; // subtract the biases on gyros
     // float w[3] = {u[0], u[1], u[2]}; // subtract the biases on gyros
 
-    this->F *= 0; // Initialize F and G matrixes.
-    this->G *= 0;
+    this->F.clear(); // Initialize F and G matrixes.
+    this->G.clear();
 
     // dqdot / dq - skey matrix
-    F.Copy(0.5 * ekf::SkewSym4x4(w), 0, 0);
+    dspm::Mat dqdot_dq = F.getROI(0, 0, 4, 4);
+    ekf::SkewSym4x4(w, dqdot_dq);
+    dqdot_dq *= 0.5f;
 
     // dqdot/dvector
-    dspm::Mat dq = -0.5 * qProduct(x.data);
-    dspm::Mat dq_q = dq.Get(0, 4, 1, 3);
-
-    // dqdot / dnw
-    G.Copy(dq_q, 0, 0);
-    // dqdot / dwbias
-    F.Copy(dq_q, 0, 4);
+    dspm::Mat q_product = this->W.view();
+    qProduct(x.data, q_product);
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            float dq = -0.5f * this->W(i, j + 1);
+            G(i, j) = dq;     // dqdot / dnw
+            F(i, j + 4) = dq; // dqdot / dwbias
+        }
+    }
 
-    dspm::Mat rotm = -1 * this->quat2rotm(x.data); // Convert quat to rotation matrix
+    dspm::Mat rotm = G.getROI(7, 6, 3, 3);
+    this->quat2rotm(x.data, rotm); // Convert quat to rotation matrix
+    rotm *= -1;
 
-    G.Copy(rotm, 7, 6);
-    G.Copy(dspm::Mat::eye(3), 4, 3);   // random noise wbias
-    G.Copy(dspm::Mat::eye(3), 7, 12);  // random noise magnetometer amplitude
-    G.Copy(dspm::Mat::eye(3), 10, 9);  // magnetometer offset constant
-    G.Copy(dspm::Mat::eye(3), 10, 15); // random noise offset constant
+    for (int i = 0; i < 3; i++) {
+        G(4 + i, 3 + i) = 1;   // random noise wbias
+        G(7 + i, 12 + i) = 1;  // random noise magnetometer amplitude
+        G(10 + i, 9 + i) = 1;  // magnetometer offset constant
+        G(10 + i, 15 + i) = 1; // random noise offset constant
+    }
 }
 
 void ekf_imu13states::Test()
@@ -184,110 +200,85 @@ void ekf_imu13states::TestFull(bool enable_att)
     std::cout << "Final State data : " << this->X.t() << std::endl;
 }
 
-void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+void ekf_imu13states::MagnAccelMeasurement(float *accel_data, float *magn_data, bool magn_states,
+        float *measured_data, float *expected_data)
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
-
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-
-    // dMagn/dq
     dspm::Mat magn(&this->X.data[7], 3, 1);
     dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    dspm::Mat dMagn_dq = this->H.getROI(0, 0, 3, 4);
+    dspm::Mat dAccel_dq = this->H.getROI(3, 0, 3, 4);
+    dspm::Mat rotm = this->Rm.view();
+
+    this->H.clear();
+    this->quat2rotm(quat.data, rotm); // Re = Rm'
+
+    if (magn_states) {
+        // We include these two line to update magnetometer initial state
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                this->H(i, 7 + j) = this->Rm(j, i);
+            }
+            this->H(i, 10 + i) = 1;
+        }
+    }
+    // dAccel/dq
+    ekf::dFdq_inv(this->accel0, quat, dAccel_dq);
+    // dMagn/dq
+    ekf::dFdq_inv(magn, quat, dMagn_dq);
 
-    float measured_data[6];
-    float expected_data[6];
-    for (size_t i = 0; i < 3; i++) {
+    // Re = Rm': expected_magn = Re * magn + magn_offset, expected_accel = Re * accel0
+    dspm::MatN<3, 1> expected_magn = dspm::mul_tn(this->Rm, dspm::MatN<3, 1>(magn.data)) +
+                                     dspm::MatN<3, 1>(magn_offset.data);
+    dspm::MatN<3, 1> expected_accel = dspm::mul_tn(this->Rm, dspm::MatN<3, 1>(this->accel0.data));
+    for (int i = 0; i < 3; i++) {
         measured_data[i] = magn_data[i];
         expected_data[i] = expected_magn.data[i];
         measured_data[i + 3] = accel_data[i];
         expected_data[i + 3] = expected_accel.data[i];
     }
+}
+
+void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+{
+    dspm::Mat quat(this->X.data, 4, 1);
+    dspm::Mat H6(this->H.data, 6, this->NUMX, this->NUMX); // first 6 rows, no copy
+    float measured_data[6];
+    float expected_data[6];
 
-    this->Update(H, measured_data, expected_data, R);
+    MagnAccelMeasurement(accel_data, magn_data, false, measured_data, expected_data);
+    this->Update(H6, measured_data, expected_data, R);
     quat /= quat.norm();
 }
 
 void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_data, float R[6])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
-
-    // We include these two line to update magnetometer initial state
-    H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
-
+    dspm::Mat H6(this->H.data, 6, this->NUMX, this->NUMX); // first 6 rows, no copy
     float measured_data[6];
     float expected_data[6];
-    for (size_t i = 0; i < 3; i++) {
-        measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
-        measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
-    }
 
-    this->Update(H, measured_data, expected_data, R);
+    MagnAccelMeasurement(accel_data, magn_data, true, measured_data, expected_data);
+    this->Update(H6, measured_data, expected_data, R);
     quat /= quat.norm();
 }
 
 void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(10, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
-
-    H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    // dq/dq
-    H.Copy(dspm::Mat::eye(4), 6, 1);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
-
     float measured_data[10];
     float expected_data[10];
-    for (size_t i = 0; i < 3; i++) {
-        measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
-        measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
+
+    MagnAccelMeasurement(accel_data, magn_data, true, measured_data, expected_data);
+    // dq/dq
+    for (int i = 0; i < 4; i++) {
+        this->H(6 + i, 1 + i) = 1;
     }
     for (size_t i = 0; i < 4; i++) {
         measured_data[i + 6] = attitude[i];
         expected_data[i + 6] = this->X.data[i];
     }
 
-    this->Update(H, measured_data, expected_data, R);
+    this->Update(this->H, measured_data, expected_data, R);
     quat /= quat.norm();
 }
@@ -16,6 +16,7 @@
 #define _ekf_imu13states_H_
 
 #include "ekf.h"
+#include "mat_n.h"
 
 /**
 * @brief This class is used to process and calculate attitude from imu sensors.
@@ -27,6 +28,9 @@
 *   X[10..12] - magnetometer offset value - magn_offset
 *
 *   where, reference magnetometer value = magn_ampl*rotation_matrix' + magn_offset
+*
+*   Process() and the UpdateRefMeasurement methods work on matrices allocated by
+*   the constructor: a filter step makes no heap allocations.
 */
 class ekf_imu13states: public ekf {
 public:
@@ -37,6 +41,7 @@ public:
     // Method calculates Xdot values depends on U
     // U - gyroscope values in radian per seconds (rad/sec)
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    virtual void StateXdotInto(dspm::Mat &x, float *u, dspm::Mat &xdot);
     virtual void LinearizeFG(dspm::Mat &x, float *u);
 
     /**
@@ -93,6 +98,26 @@ public:
      */
     void UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10]);
 
+protected:
+    /**
+     * Measurement matrix of the updates (10 x 13, the first 6 rows without attitude)
+     */
+    dspm::Mat H;
+    /**
+     * Rotation matrix of the current attitude
+     */
+    dspm::MatN<3, 3> Rm;
+    /**
+     * 4x4 working matrix of StateXdotInto() and LinearizeFG()
+     */
+    dspm::MatN<4, 4> W;
+
+    /**
+     * Fills the magnetometer and accelerometer rows (0..5) of H, with the
+     * magnetometer states when magn_states, and their measured and expected values.
+     */
+    void MagnAccelMeasurement(float *accel_data, float *magn_data, bool magn_states,
+                              float *measured_data, float *expected_data);
 };
 
 #endif // _ekf_imu13states_H_
@@ -408,6 +408,27 @@ public:
      */
     void clear(void);
 
+    /**
+     * Multiplication of two matrices into a preallocated matrix, result = A * B.
+     * Unlike the * operator it makes no temporary matrices, so no memory is allocated.
+     * The method use DSP optimized implementation of multiplication.
+     *
+     * @param[in] A: matrix [N]x[M]
+     * @param[in] B: matrix [M]x[K]
+     * @param[out] result: matrix [N]x[K], must not be A or B
+     */
+    static void mul_into(const Mat &A, const Mat &B, Mat &result);
+
+    /**
+     * Multiplication by a transposed matrix into a preallocated matrix, result = A * B^T.
+     * Same as mul_into(A, B.t(), result) without the transposed copy of B.
+     *
+     * @param[in] A: matrix [N]x[M]
+     * @param[in] B: matrix [K]x[M]
+     * @param[out] result: matrix [N]x[K], must not be A or B
+     */
+    static void mul_t_into(const Mat &A, const Mat &B, Mat &result);
+
     /**
      * @brief   Solve the matrix
      *
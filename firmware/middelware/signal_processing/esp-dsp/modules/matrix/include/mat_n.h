@@ -0,0 +1,294 @@
+// Fixed size companion of dspm::Mat for the small matrices of the
+// orientation filters (rotations, quaternions, 3-axis vectors).
+
+#ifndef _dspm_mat_n_h_
+#define _dspm_mat_n_h_
+#include <string.h>
+#include <math.h>
+#include "mat.h"
+
+namespace dspm {
+/**
+ * @brief   Fixed size matrix
+ *
+ * Matrix with the dimensions known at compile time and the data inside the
+ * object (stack or member storage, no allocation). The products are loops
+ * with constant bounds, so the compiler unrolls them for the small sizes of
+ * rotations and quaternions (3x3, 4x4, 3x1, ...).
+ *
+ * A MatN is used where a Mat is expected through view(), a sub-matrix of
+ * its data (no copy).
+ *
+ * @tparam R: amount of rows
+ * @tparam C: amount of columns
+ */
+template <int R, int C>
+class MatN {
+public:
+    static constexpr int rows = R;  /*!< Amount of rows*/
+    static constexpr int cols = C;  /*!< Amount of columns*/
+    float data[R * C];              /*!< Data, row by row*/
+
+    /**
+     * Matrix with all elements 0.
+     */
+    MatN()
+    {
+        clear();
+    }
+
+    /**
+     * Matrix with a copy of R*C values, row by row.
+     * @param[in] src: source values
+     */
+    explicit MatN(const float *src)
+    {
+        memcpy(data, src, sizeof(data));
+    }
+
+    /**
+     * Matrix with a copy of a Mat of the same size (sub-matrices too).
+     * @param[in] src: source matrix
+     */
+    explicit MatN(const Mat &src)
+    {
+        for (int r = 0; r < R; r++) {
+            memcpy(&data[r * C], &src.data[r * src.stride], C * sizeof(float));
+        }
+    }
+
+    /**
+     * Access to the element
+     * @param[in] row: row position
+     * @param[in] col: column position
+     * @return
+     *      - element of matrix M[row][col]
+     */
+    inline float &operator()(int row, int col)
+    {
+        return data[row * C + col];
+    }
+
+    /**
+     * Access to the element
+     * @param[in] row: row position
+     * @param[in] col: column position
+     * @return
+     *      - element of matrix M[row][col]
+     */
+    inline const float &operator()(int row, int col) const
+    {
+        return data[row * C + col];
+    }
+
+    /**
+     * Mat over the data of this matrix, without copy.
+     * The view is valid while this matrix exists.
+     * @return
+     *      - sub-matrix RxC
+     */
+    Mat view()
+    {
+        return Mat(data, R, C, C);
+    }
+
+    /**
+     * The method fill 0 to the matrix.
+     */
+    void clear(void)
+    {
+        memset(data, 0, sizeof(data));
+    }
+
+    /**
+     * Create identity matrix.
+     * @return
+     *      - matrix RxC with 1 in diagonal
+     */
+    static MatN eye(void)
+    {
+        MatN result;
+        for (int i = 0; i < R && i < C; i++) {
+            result(i, i) = 1;
+        }
+        return result;
+    }
+
+    /**
+     * Matrix transpose.
+     * @return
+     *      - transposed matrix CxR
+     */
+    MatN<C, R> t() const
+    {
+        MatN<C, R> result;
+        for (int r = 0; r < R; r++) {
+            for (int c = 0; c < C; c++) {
+                result(c, r) = (*this)(r, c);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * += operator
+     * @param[in] A: matrix RxC
+     * @return
+     *      - result matrix
+     */
+    MatN &operator+=(const MatN &A)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] += A.data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * -= operator
+     * @param[in] A: matrix RxC
+     * @return
+     *      - result matrix
+     */
+    MatN &operator-=(const MatN &A)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] -= A.data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * *= with constant operator
+     * @param[in] num: constant value
+     * @return
+     *      - result matrix
+     */
+    MatN &operator*=(float num)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] *= num;
+        }
+        return *this;
+    }
+
+    /**
+     * Return norm of the vector.
+     * If it's matrix, calculate matrix norm
+     * @return
+     *      - matrix norm
+     */
+    float norm(void) const
+    {
+        float sqr_norm = 0;
+        for (int i = 0; i < R * C; i++) {
+            sqr_norm += data[i] * data[i];
+        }
+        return sqrtf(sqr_norm);
+    }
+};
+
+/**
+ * + operator, sum of two matrices
+ * @param[in] A: Input matrix A
+ * @param[in] B: Input matrix B
+ * @return
+ *     - result matrix A+B
+*/
+template <int R, int C>
+inline MatN<R, C> operator+(const MatN<R, C> &A, const MatN<R, C> &B)
+{
+    MatN<R, C> result(A.data);
+    return (result += B);
+}
+
+/**
+ * - operator, subtraction of two matrices
+ * @param[in] A: Input matrix A
+ * @param[in] B: Input matrix B
+ * @return
+ *     - result matrix A-B
+*/
+template <int R, int C>
+inline MatN<R, C> operator-(const MatN<R, C> &A, const MatN<R, C> &B)
+{
+    MatN<R, C> result(A.data);
+    return (result -= B);
+}
+
+/**
+ * * operator, multiplication of matrix with constant
+ * @param[in] A: Input matrix A
+ * @param[in] num: Input constant
+ * @return
+ *     - result matrix A*num
+*/
+template <int R, int C>
+inline MatN<R, C> operator*(const MatN<R, C> &A, float num)
+{
+    MatN<R, C> result(A.data);
+    return (result *= num);
+}
+
+/**
+ * * operator, multiplication of matrix with constant
+ * @param[in] num: Input constant
+ * @param[in] A: Input matrix A
+ * @return
+ *     - result matrix num*A
+*/
+template <int R, int C>
+inline MatN<R, C> operator*(float num, const MatN<R, C> &A)
+{
+    return (A * num);
+}
+
+/**
+ * * operator, multiplication of two matrices, the inner dimension checked at compile time
+ * @param[in] A: Input matrix A, RxK
+ * @param[in] B: Input matrix B, KxC
+ * @return
+ *     - result matrix A*B, RxC
+*/
+template <int R, int K, int C>
+inline MatN<R, C> operator*(const MatN<R, K> &A, const MatN<K, C> &B)
+{
+    MatN<R, C> result;
+    for (int r = 0; r < R; r++) {
+        for (int c = 0; c < C; c++) {
+            float acc = 0;
+            for (int k = 0; k < K; k++) {
+                acc += A(r, k) * B(k, c);
+            }
+            result(r, c) = acc;
+        }
+    }
+    return result;
+}
+
+/**
+ * Multiplication of a transposed matrix, A' * B, without the transposed copy
+ * (e.g. a rotation matrix applied backwards)
+ * @param[in] A: Input matrix A, KxR
+ * @param[in] B: Input matrix B, KxC
+ * @return
+ *     - result matrix A'*B, RxC
+*/
+template <int R, int K, int C>
+inline MatN<R, C> mul_tn(const MatN<K, R> &A, const MatN<K, C> &B)
+{
+    MatN<R, C> result;
+    for (int r = 0; r < R; r++) {
+        for (int c = 0; c < C; c++) {
+            float acc = 0;
+            for (int k = 0; k < K; k++) {
+                acc += A(k, r) * B(k, c);
+            }
+            result(r, c) = acc;
+        }
+    }
+    return result;
+}
+
+}
+#endif //_dspm_mat_n_h_
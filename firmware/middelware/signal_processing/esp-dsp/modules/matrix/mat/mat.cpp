@@ -427,6 +427,41 @@ void Mat::clear()
     }
 }
 
+void Mat::mul_into(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.cols != B.rows) || (result.rows != A.rows) || (result.cols != B.cols)) {
+        ESP_LOGW("Mat", "mul_into Error: matrices do not have correct dimensions");
+        return;
+    }
+
+    if (A.sub_matrix || B.sub_matrix || result.sub_matrix) {
+        dspm_mult_ex_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols, A.padding, B.padding, result.padding);
+    } else {
+        dspm_mult_f32(A.data, B.data, result.data, A.rows, A.cols, B.cols);
+    }
+}
+
+void Mat::mul_t_into(const Mat &A, const Mat &B, Mat &result)
+{
+    if ((A.cols != B.cols) || (result.rows != A.rows) || (result.cols != B.rows)) {
+        ESP_LOGW("Mat", "mul_t_into Error: matrices do not have correct dimensions");
+        return;
+    }
+
+    // rows of A by rows of B: both read contiguously
+    for (int i = 0; i < A.rows; i++) {
+        const float *a = &A.data[i * A.stride];
+        for (int j = 0; j < B.rows; j++) {
+            const float *b = &B.data[j * B.stride];
+            float acc = 0;
+            for (int k = 0; k < A.cols; k++) {
+                acc += a[k] * b[k];
+            }
+            result(i, j) = acc;
+        }
+    }
+}
+
 // Duplicate to Get method
 Mat Mat::block(int startRow, int startCol, int blockRows, int blockCols)
 {
@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 10:00:00 2026
+
+@author: Albano Peñalva
+
+Diseño off-line de filtros Butterworth para frecuencias de muestreo fijas.
+Genera un archivo .h con un iir_design_t constante por filtro (ver
+iir_filter.h), con los mismos coeficientes que LowPassInit/HiPassInit
+(dsps_biquad_gen_lpf_f32/dsps_biquad_gen_hpf_f32), para usar con
+IirFilterConst() o IirDesignInit() sin diseñar en tiempo de ejecución.
+
+Uso:
+    python iir_design.py nombre --fs 200 --filtro hp:1:2 --filtro lp:30:2
+
+Cada --filtro es tipo:frecuencia_de_corte:orden, con tipo lp (pasa bajos) o
+hp (pasa altos) y orden 2, 4, 6 u 8. Cada filtro se llama nombre_tipo_fc
+(por ejemplo ecg_hp_1, ecg_lp_30). Se genera el archivo nombre_iir.h.
+"""
+
+# Librerías
+import argparse
+import math
+import struct
+
+# Q de cada sección de 2do orden, por orden del filtro (igual que iir_filter.c)
+SOS_Q = {
+    2: [1 / 1.414],
+    4: [1 / 0.765, 1 / 1.848],
+    6: [1 / 0.518, 1 / 1.414, 1 / 1.932],
+    8: [1 / 0.390, 1 / 1.111, 1 / 1.663, 1 / 1.962],
+}
+
+
+def f32(valor):
+    """Redondeo a float de 32 bits"""
+    return struct.unpack('f', struct.pack('f', valor))[0]
+
+
+def seccion(tipo, f, q):
+    """Coeficientes b0, b1, b2, a1, a2 de una sección (f = fc / fs)"""
+    w0 = 2 * math.pi * f
+    c = math.cos(w0)
+    alpha = math.sin(w0) / (2 * q)
+    if tipo == 'lp':
+        b = [(1 - c) / 2, 1 - c, (1 - c) / 2]
+    else:
+        b = [(1 + c) / 2, -(1 + c), (1 + c) / 2]
+    a0 = 1 + alpha
+    return [f32(v / a0) for v in b + [-2 * c, 1 - alpha]]
+
+
+def nombre_fc(fc):
+    """Frecuencia de corte como parte de un identificador C (0.5 -> 0p5)"""
+    return ('%g' % fc).replace('.', 'p')
+
+
+# %% Lectura de argumentos
+parser = argparse.ArgumentParser(description='Diseño de filtros IIR para iir_filter')
+parser.add_argument('nombre', help='prefijo de los filtros y del archivo')
+parser.add_argument('--fs', type=float, required=True, help='frecuencia de muestreo (Hz)')
+parser.add_argument('--filtro', action='append', required=True,
+                    help='tipo:fc:orden (tipo lp o hp, orden 2, 4, 6 u 8)')
+args = parser.parse_args()
+
+# %% Diseño
+filtros = []
+for texto in args.filtro:
+    tipo, fc, orden = texto.split(':')
+    fc, orden = float(fc), int(orden)
+    if tipo not in ('lp', 'hp') or orden not in SOS_Q or not 0 < fc < args.fs / 2:
+        raise ValueError(f'filtro inválido: {texto}')
+    coeff = [seccion(tipo, fc / args.fs, q) for q in SOS_Q[orden]]
+    filtros.append((f'{args.nombre}_{tipo}_{nombre_fc(fc)}', tipo, fc, orden, coeff))
+    print(f'{filtros[-1][0]}: {orden // 2} secciones')
+
+# %% Guardado en archivo .h
+nombre = args.nombre
+with open(f'{nombre}_iir.h', 'w', encoding='utf-8') as f:
+    f.write(f'''/**
+ * @file {nombre}_iir.h
+ * @brief Filtros Butterworth para fs = {args.fs:g} Hz
+ * @note Creado con iir_design.py: {' '.join('--filtro ' + t for t in args.filtro)}
+ */
+#include "iir_filter.h"
+''')
+    for ident, tipo, fc, orden, coeff in filtros:
+        filas = ',\n'.join('        {' + ', '.join('%.9gf' % v for v in c) + '}' for c in coeff)
+        f.write(f'''
+/* {'Pasa bajos' if tipo == 'lp' else 'Pasa altos'} de orden {orden}, fc = {fc:g} Hz */
+static const iir_design_t {ident} = {{
+    .n_sos = {orden // 2},
+    .coeff = {{
+{filas}
+    }}
+}};
+''')
@@ -0,0 +1,173 @@
+#ifndef ACTIVITY_CLASSIFIER_H_
+#define ACTIVITY_CLASSIFIER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Activity_Classifier Activity Classifier
+ ** @{ */
+
+/** \brief Classification of the activity of the user from the filtered acceleration and tilt
+ *
+ * A tilt over the threshold is not always a bad posture: reaching for
+ * something or walking tilt the sensor too. This module tells those
+ * activities apart from holding a posture, so the posture pipeline only
+ * times bad postures that are held.
+ *
+ * The samples are summarized in windows of ACTIVITY_SEGMENTS segments of
+ * segment_ms, one classification per segment (each window overlaps the
+ * previous one). Features of a window:
+ * - tilt dispersion (deg RMS)
+ * - tilt range, largest minus smallest tilt (deg)
+ * - tilt net change, between the first and the last segment (deg): reaching
+ *   goes and comes back, leaning into a posture does not
+ * - dispersion of the acceleration magnitude (g RMS)
+ * - dominant frequency of the magnitude in the step band (Hz)
+ * - fraction of the magnitude variance in the step band
+ *
+ * The step band is GOERTZEL_MAX_BANDS consecutive bins of the window, from the
+ * first one at or above ACTIVITY_STEP_MIN_HZ (0.25 Hz apart with 1 s
+ * segments), computed with a Goertzel bank (band_energy) instead of a whole
+ * FFT. The bank runs over the ring of the window as it is: at exact bins a
+ * circular shift of the samples does not change the magnitudes.
+ *
+ * The model is linear: the features are quantized to int8 and each class
+ * score is the dot product (esp-dsp dspi_dotprod_s8_ansi) of the quantized features,
+ * plus a constant bias input, with the int8 weights of the class. The class of
+ * the highest score wins. Models are trained off-line with activity_model.py,
+ * which computes the same features and writes the activity_model_t.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Step band frequency and power instead of magnitude crossings			|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "running_stats.h"
+#include "band_energy.h"
+/*==================[macros]=================================================*/
+#define ACTIVITY_N_FEATURES     6   /*!< Features of a window */
+#define ACTIVITY_N_INPUTS       8   /*!< Model inputs: features, bias input and zero padding */
+#define ACTIVITY_BIAS_INPUT     ACTIVITY_N_FEATURES     /*!< Input fixed at ACTIVITY_Q_MAX: its weight is the class bias */
+#define ACTIVITY_Q_MAX          127 /*!< Largest quantized feature */
+#define ACTIVITY_SEGMENTS       4   /*!< Segments of a window */
+#define ACTIVITY_MAX_WINDOW     512 /*!< Maximum samples of a window */
+#define ACTIVITY_STEP_MIN_HZ    1.0f    /*!< Lower edge of the step band */
+#define ACTIVITY_STEP_BINS      GOERTZEL_MAX_BANDS  /*!< Bins of the step band */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Activities
+ */
+typedef enum {
+    ACTIVITY_STILL,         /*!< Holding a posture (correct or not) */
+    ACTIVITY_REACHING,      /*!< Short movement that comes back (reaching, turning) */
+    ACTIVITY_WALKING,       /*!< Walking */
+    ACTIVITY_CLASSES
+} activity_t;
+
+/**
+ * @brief Features of a window
+ */
+typedef enum {
+    ACTIVITY_TILT_STD,      /*!< Tilt dispersion (deg RMS) */
+    ACTIVITY_TILT_RANGE,    /*!< Largest minus smallest tilt (deg) */
+    ACTIVITY_TILT_NET,      /*!< Tilt change between the first and the last segment (deg, absolute) */
+    ACTIVITY_MAG_STD,       /*!< Dispersion of the acceleration magnitude (g RMS) */
+    ACTIVITY_STEP_FREQ,     /*!< Dominant frequency of the magnitude in the step band (Hz) */
+    ACTIVITY_STEP_POWER     /*!< Power of the step band over the variance of the magnitude (0 to 1) */
+} activity_feature_t;
+
+/**
+ * @brief Quantized linear model (generated by activity_model.py)
+ */
+typedef struct {
+    uint16_t segment_ms;                                /*!< Segment length the model was trained with */
+    float offset[ACTIVITY_N_FEATURES];                  /*!< Subtracted from each feature */
+    float gain[ACTIVITY_N_FEATURES];                    /*!< Quantized units per feature unit */
+    int8_t weight[ACTIVITY_CLASSES][ACTIVITY_N_INPUTS]; /*!< Weights of each class (bias at ACTIVITY_BIAS_INPUT) */
+    uint8_t shift;                                      /*!< Right shift of the scores, so they fit in int8 (at least 1) */
+} activity_model_t;
+
+/**
+ * @brief Statistics of a segment
+ */
+typedef struct {
+    welford_t tilt;         /*!< Tilt statistics */
+    welford_t mag;          /*!< Magnitude statistics */
+    float tilt_min;         /*!< Smallest tilt */
+    float tilt_max;         /*!< Largest tilt */
+} activity_segment_t;
+
+/**
+ * @brief Activity classifier (use ActivityInit to fill it)
+ */
+typedef struct {
+    const activity_model_t *model;                  /*!< Model */
+    activity_segment_t segment[ACTIVITY_SEGMENTS];  /*!< Segments of the window (ring) */
+    uint8_t current;                                /*!< Segment being filled */
+    uint8_t filled;                                 /*!< Complete segments */
+    uint16_t samples;                               /*!< Samples of a segment */
+    float sample_frec;                              /*!< Sample frequency (Hz) */
+    float mag[ACTIVITY_MAX_WINDOW];                 /*!< Magnitude minus 1 g of the window (ring of ACTIVITY_SEGMENTS * samples) */
+    uint16_t pos;                                   /*!< Ring position of the next magnitude */
+    goertzel_bank_t steps;                          /*!< Step band bins of the window */
+    float step_hz[ACTIVITY_STEP_BINS];              /*!< Frequency of each step band bin (Hz) */
+    float features[ACTIVITY_N_FEATURES];            /*!< Features of the last window */
+    activity_t activity;                            /*!< Activity of the last window */
+} activity_classifier_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a classifier (ACTIVITY_STILL until the first window is complete)
+ *
+ * @param c             Classifier
+ * @param model         Model (not copied)
+ * @param sample_frec   Sample frequency (Hz)
+ * @return true     Classifier initialized
+ * @return false    Invalid model or sample frequency (window over ACTIVITY_MAX_WINDOW
+ *                  samples or step band over the Nyquist frequency)
+ */
+bool ActivityInit(activity_classifier_t *c, const activity_model_t *model, float sample_frec);
+
+/**
+ * @brief Forgets the samples added (ACTIVITY_STILL until a window is complete again)
+ *
+ * @param c     Classifier
+ */
+void ActivityReset(activity_classifier_t *c);
+
+/**
+ * @brief Adds a sample
+ *
+ * @param c         Classifier
+ * @param x         Filtered acceleration in X (g)
+ * @param y         Filtered acceleration in Y (g)
+ * @param z         Filtered acceleration in Z (g)
+ * @param tilt_deg  Tilt angle (deg)
+ * @return true     A window was classified (activity and features updated)
+ */
+bool ActivityAdd(activity_classifier_t *c, float x, float y, float z, float tilt_deg);
+
+/**
+ * @brief Classifies the features of a window
+ *
+ * @param model     Model
+ * @param features  Features (ACTIVITY_N_FEATURES, in activity_feature_t order)
+ * @return activity_t Activity of the highest score
+ */
+activity_t ActivityClassify(const activity_model_t *model, const float *features);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ACTIVITY_CLASSIFIER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,84 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup ADPCM ADPCM
+ ** @{ */
+
+/** \brief IMA-ADPCM decoder for audio stored in flash
+ *
+ * Each sample is coded in 4 bits (the difference with a prediction, scaled by
+ * an adaptive step), half the size of 8 bit PCM, and decoded to 16 bit PCM
+ * with a few additions and shifts per sample.
+ *
+ * Audio is stored in independent blocks of a fixed number of samples, so any
+ * block can be decoded without the previous ones (seek, playlists):
+ *
+ * | bytes            | content                                                  |
+ * |:----------------:|:---------------------------------------------------------|
+ * | 0-1              | predictor before the first sample (int16, little endian) |
+ * | 2                | step index before the first sample (0 to 88)             |
+ * | 3                | reserved (0)                                             |
+ * | 4 to 3 + n/2     | samples, two per byte, the first one in the low nibble   |
+ *
+ * The blocks are made by the encoder of examples/ej_lcdcolor_audioplayer
+ * (adpcm_encoder.py), which uses the same step tables.
+ *
+ * @code
+ * for(b = 0; b < n_blocks; b++){
+ *     AdpcmDecodeBlock(&song[b * ADPCM_BLOCK_BYTES(1024)], 1024, pcm);
+ *     AudioOutWritePcm(pcm, 1024, portMAX_DELAY);
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define ADPCM_HEADER_BYTES      4                                   /*!< Block header: predictor and step index */
+#define ADPCM_BLOCK_BYTES(n)    (ADPCM_HEADER_BYTES + (n) / 2)      /*!< Size of a block of n samples (n even) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Decoder state
+ */
+typedef struct {
+    int16_t predictor;          /*!< Last decoded sample */
+    uint8_t index;              /*!< Step index (0 to 88) */
+} adpcm_state_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Decode a block
+ *
+ * @param block         Block: header and n / 2 bytes of samples
+ * @param n             Samples in the block (even)
+ * @param pcm           Decoded samples (16 bit PCM)
+ */
+void AdpcmDecodeBlock(const uint8_t *block, uint16_t n, int16_t *pcm);
+
+/**
+ * @brief Decode samples continuing from a state (no block headers)
+ *
+ * @param state         Decoder state, updated
+ * @param data          Samples, two per byte, the first one in the low nibble
+ * @param n             Samples to decode (even)
+ * @param pcm           Decoded samples (16 bit PCM)
+ */
+void AdpcmDecode(adpcm_state_t *state, const uint8_t *data, uint16_t n, int16_t *pcm);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ADPCM_H_ */
+
+/*==================[end of file]============================================*/
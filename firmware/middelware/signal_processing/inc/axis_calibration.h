@@ -0,0 +1,92 @@
+#ifndef AXIS_CALIBRATION_H_
+#define AXIS_CALIBRATION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Axis_Calibration Axis Calibration
+ ** @{ */
+
+/** \brief Scale, misalignment and bias correction of 3-axis samples
+ *
+ * A per-axis offset and sensitivity does not correct a sensor mounted with
+ * its axes slightly rotated or coupled. The full correction is
+ *
+ *     corrected = matrix · (raw - bias)
+ *
+ * with a 3x3 matrix (scale on the diagonal, misalignment off it). It is
+ * applied to whole blocks of samples stored as three rows (X, Y and Z of
+ * every sample), the layout of the accelerometer frames: a single
+ * 3x3 by 3xN product (esp-dsp dspm_mult_ex_f32) plus a constant per row.
+ *
+ * @code
+ * static const float matrix[9] = {1.02f, 0.01f, 0, -0.01f, 0.98f, 0, 0, 0, 1.01f};
+ * static const float bias[3] = {0.02f, -0.01f, 0.03f};
+ * axis_calibration_t cal;
+ *
+ * AxisCalibrationInit(&cal, matrix, bias);
+ * AxisCalibrationApplyBlock(&cal, frame.x, frame.len, ACCEL_FRAME_LEN); // x, y and z are consecutive rows
+ * @endcode
+ *
+ * @note Needs CONFIG_MIDDELWARE_DSP_MATRIX. The block work buffer is taken
+ * from the DSP scratch arena (3 * len floats).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Axis correction (use AxisCalibrationInit to fill it)
+ */
+typedef struct {
+    float matrix[9];    /*!< Scale and misalignment, row major */
+    float offset[3];    /*!< Added after the matrix: -matrix · bias */
+} axis_calibration_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a correction
+ *
+ * @param cal       Correction
+ * @param matrix    Scale and misalignment, row major (NULL: identity)
+ * @param bias      Raw value of each axis at zero (NULL: no bias)
+ */
+void AxisCalibrationInit(axis_calibration_t *cal, const float matrix[9], const float bias[3]);
+
+/**
+ * @brief Corrects one sample, in place
+ *
+ * @param cal   Correction
+ * @param v     X, Y and Z
+ */
+void AxisCalibrationApply(const axis_calibration_t *cal, float v[3]);
+
+/**
+ * @brief Corrects a block of samples, in place
+ *
+ * @param cal       Correction
+ * @param rows      X of every sample, followed by Y at rows + stride and Z at rows + 2 * stride
+ * @param len       Number of samples
+ * @param stride    Distance between the rows (floats, at least len)
+ * @return true     Block corrected
+ * @return false    Wrong parameters or no room in the DSP scratch arena (block unchanged)
+ */
+bool AxisCalibrationApplyBlock(const axis_calibration_t *cal, float *rows, uint16_t len, uint16_t stride);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* AXIS_CALIBRATION_H_ */
+
+/*==================[end of file]============================================*/
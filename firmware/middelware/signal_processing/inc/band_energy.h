@@ -0,0 +1,136 @@
+#ifndef BAND_ENERGY_H_
+#define BAND_ENERGY_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Band_Energy Band Energy
+ ** @{ */
+
+/** \brief Spectral band levels for vumeter-like consumers
+ *
+ * Two ways to get the level of a few frequency bands:
+ * - Band map: groups the bins of an FFT magnitude (FFTMagnitude or
+ *   FFTMagnitudeQ15) into linear or log spaced bands. The bin range and the
+ *   inverse of the width of each band are precomputed, so averaging needs no
+ *   divisions.
+ * - Goertzel bank: computes only the bins of a few frequencies directly from
+ *   the samples, without a full FFT. It costs signal_lenght multiply-adds per
+ *   band, so it is cheaper than the FFT for small band counts.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define BAND_MAX_BANDS          32      /*!< Maximum number of bands of a band map */
+#define GOERTZEL_MAX_BANDS      8       /*!< Maximum number of frequencies of a Goertzel bank */
+/*==================[typedef]================================================*/
+/**
+ * @brief Bin to band map
+ */
+typedef struct {
+    uint8_t n_bands;                            /*!< Number of bands */
+    uint16_t first_bin[BAND_MAX_BANDS + 1];     /*!< Band b covers bins first_bin[b] to first_bin[b+1] - 1 */
+    float inv_width[BAND_MAX_BANDS];            /*!< 1 / number of bins of each band */
+    uint32_t inv_width_q16[BAND_MAX_BANDS];     /*!< 65536 / number of bins of each band */
+} band_map_t;
+
+/**
+ * @brief Goertzel bank
+ */
+typedef struct {
+    uint8_t n_bands;                            /*!< Number of frequencies */
+    uint16_t signal_lenght;                     /*!< Samples per block */
+    float coeff[GOERTZEL_MAX_BANDS];            /*!< 2 cos(2 pi k / N) of each frequency */
+} goertzel_bank_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a band map with bands of the same width
+ *
+ * @param map       Band map to be initialized
+ * @param n_bins    Number of bins of the spectrum (signal_lenght / 2)
+ * @param n_bands   Number of bands (up to BAND_MAX_BANDS and n_bins)
+ * @return true     Map initialized
+ * @return false    Invalid configuration
+ */
+bool BandMapInitLinear(band_map_t *map, uint16_t n_bins, uint8_t n_bands);
+
+/**
+ * @brief Initialize a band map with log spaced bands between f_min and f_max
+ *
+ * @note Bands are at least one bin wide, so low bands may be wider than
+ * requested when the frequency resolution is coarse.
+ *
+ * @param map           Band map to be initialized
+ * @param sample_freq   Sample frequency of the signal
+ * @param signal_lenght Lenght of the signal used to compute the spectrum
+ * @param n_bands       Number of bands (up to BAND_MAX_BANDS)
+ * @param f_min         Lower edge of the first band (> 0)
+ * @param f_max         Upper edge of the last band (<= sample_freq / 2)
+ * @return true     Map initialized
+ * @return false    Invalid configuration
+ */
+bool BandMapInitLog(band_map_t *map, float sample_freq, uint16_t signal_lenght, uint8_t n_bands, float f_min, float f_max);
+
+/**
+ * @brief Average of the FFT magnitude in each band
+ *
+ * @param map       Band map
+ * @param fft       FFT magnitude (from FFTMagnitude)
+ * @param bands     Array to store the level of each band (of lenght = n_bands)
+ */
+void BandEnergy(const band_map_t *map, const float *fft, float *bands);
+
+/**
+ * @brief Average of the FFT magnitude in each band, in fixed point
+ *
+ * @param map       Band map
+ * @param fft       FFT magnitude (from FFTMagnitudeQ15)
+ * @param bands     Array to store the level of each band (of lenght = n_bands)
+ */
+void BandEnergyQ15(const band_map_t *map, const uint16_t *fft, uint16_t *bands);
+
+/**
+ * @brief Initialize a Goertzel bank
+ *
+ * @note Each frequency is rounded to the nearest FFT bin of a signal_lenght
+ * transform.
+ *
+ * @param bank          Goertzel bank to be initialized
+ * @param sample_freq   Sample frequency of the signal
+ * @param signal_lenght Samples per block
+ * @param freqs         Frequencies to be measured (of lenght = n_bands)
+ * @param n_bands       Number of frequencies (up to GOERTZEL_MAX_BANDS)
+ * @return true     Bank initialized
+ * @return false    Invalid configuration
+ */
+bool GoertzelBankInit(goertzel_bank_t *bank, float sample_freq, uint16_t signal_lenght, const float *freqs, uint8_t n_bands);
+
+/**
+ * @brief Computes the magnitude of each frequency of the bank over one block
+ *
+ * @note Magnitude is the amplitude of a sinusoid at that frequency
+ * (2·|X[k]|/N, no window applied).
+ *
+ * @param bank      Goertzel bank
+ * @param signal    Array with signal values (of lenght = signal_lenght)
+ * @param magnitude Array to store the magnitude of each frequency (of lenght = n_bands)
+ */
+void GoertzelBankProcess(const goertzel_bank_t *bank, const float *signal, float *magnitude);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BAND_ENERGY_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,107 @@
+#ifndef DCT_CODEC_H_
+#define DCT_CODEC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup DCT_Codec DCT Codec
+ ** @{ */
+
+/** \brief Lossy compression of windows of slow signals (accelerations, angles)
+ *
+ * Each window of n int16 samples is transformed with the DCT-II (dsps_dct_f32,
+ * scaled to be orthonormal), every coefficient is divided by the same step and
+ * rounded, the zeros at the end are dropped and the rest are packed with the
+ * adaptive Rice code of sample_stream (zig-zag, parameter from the mean of the
+ * previous values). Posture signals have their energy in the first few
+ * coefficients, so a window is a handful of bytes.
+ *
+ * The error of each coefficient is at most step / 2. The transform is
+ * orthonormal, so the RMS error of the decoded samples is the RMS error of the
+ * coefficients, about step / sqrt(12) (DCT_CODEC_STEP_FOR_RMS gives the step
+ * for an RMS error); a single sample may be off by up to sqrt(n) * step / 2.
+ *
+ * Blocks are independent (the Rice state starts again in each one):
+ *
+ * | bytes    | content                                                         |
+ * |:--------:|:----------------------------------------------------------------|
+ * | 0-1      | step, in 1/16 of the sample unit (uint16, little endian)        |
+ * | 2        | m: coefficients coded, the rest are 0                           |
+ * | 3-4      | first coefficient (DC) in steps (int16, little endian)          |
+ * | 5 to end | coefficients 1 to m - 1, Rice coded, most significant bit first |
+ *
+ * A Rice code is q ones, a zero and the k low bits of the zig-zag value (q is
+ * the value shifted right k bits); q = DCT_CODEC_RICE_Q_MAX ones are followed by
+ * the value as int16 instead. The coefficients are saturated to int16 steps: the
+ * step must be at least max|x| * sqrt(n) / 32767 (0.5 mg for 64 samples of an
+ * accelerometer at +/-2 g).
+ *
+ * middelware/signal_processing/dct_codec.py decodes the blocks offline.
+ *
+ * @code
+ * DctCodecInit();
+ * len = DctCodecEncode(window_mg, 64, DCT_CODEC_STEP_FOR_RMS(4.0f), block);   // 4 mg RMS
+ * ...
+ * DctCodecDecode(block, len, 64, window_mg);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define DCT_CODEC_MAX_LENGTH        128                     /*!< Longest window (power of two, from 8) */
+#define DCT_CODEC_HEADER_BYTES      5                       /*!< Step, coefficients coded and DC */
+#define DCT_CODEC_MAX_BYTES(n)      (DCT_CODEC_HEADER_BYTES + 4 * (n))  /*!< Largest block of a window of n samples */
+#define DCT_CODEC_RICE_Q_MAX        16                      /*!< Unary quotients this long are the escape */
+#define DCT_CODEC_STEP_FOR_RMS(e)   (3.4641f * (e))         /*!< Step for an RMS error e (sqrt(12) * e) */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize the transform tables (the ones of the FFT module)
+ *
+ * @return true     Ready
+ * @return false    Not possible to initialize the FFT tables
+ */
+bool DctCodecInit(void);
+
+/**
+ * @brief Compress a window
+ *
+ * @note The work buffer (8 bytes per sample) comes from dsp_scratch.
+ *
+ * @param x         Samples
+ * @param n         Samples in the window (power of two, 8 to DCT_CODEC_MAX_LENGTH)
+ * @param step      Quantization step, in the sample unit (1/16 to 4095)
+ * @param block     Compressed block, up to DCT_CODEC_MAX_BYTES(n) bytes
+ * @return uint16_t Bytes of the block, 0 if the arguments are invalid or there is no work buffer
+ */
+uint16_t DctCodecEncode(const int16_t *x, uint16_t n, float step, uint8_t *block);
+
+/**
+ * @brief Decompress a window
+ *
+ * @param block     Compressed block
+ * @param length    Bytes available in block (a block may be followed by others)
+ * @param n         Samples in the window (the same as in DctCodecEncode)
+ * @param x         Decoded samples
+ * @return uint16_t Bytes of the block, 0 if the block is not valid
+ */
+uint16_t DctCodecDecode(const uint8_t *block, uint16_t length, uint16_t n, int16_t *x);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DCT_CODEC_H_ */
+
+/*==================[end of file]============================================*/
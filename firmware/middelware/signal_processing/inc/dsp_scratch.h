@@ -0,0 +1,88 @@
+#ifndef DSP_SCRATCH_H_
+#define DSP_SCRATCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup DSP_Scratch DSP Scratch
+ ** @{ */
+
+/** \brief Scoped scratch arena for DSP work buffers
+ *
+ * A single static arena (CONFIG_MIDDELWARE_DSP_SCRATCH_SIZE bytes) that FFT,
+ * filter and pipeline functions borrow their work buffers from, instead of
+ * each module reserving its worst case. Allocations are stack-like: a scope
+ * starts with DspScratchMark(), allocates with DspScratchAlloc() and gives
+ * everything back with DspScratchRelease(). Scopes nest (an FFT inside a
+ * pipeline run), so the RAM in use at any time is what the running
+ * processing needs. DspScratchPeak() tells the highest use, to size the
+ * arena.
+ *
+ * The arena is owned by one task from DspScratchMark() to the matching
+ * DspScratchRelease(): other tasks wait in DspScratchMark().
+ *
+ * @code
+ * dsp_scratch_mark_t mark = DspScratchMark();
+ * float *buffer = DspScratchAlloc(n * sizeof(float));
+ * if(buffer != NULL){
+ *     ...
+ * }
+ * DspScratchRelease(mark);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stddef.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Arena position to release up to
+ */
+typedef size_t dsp_scratch_mark_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start a scratch scope (takes the arena, waiting for other tasks to release it)
+ *
+ * @return dsp_scratch_mark_t   Position to give to DspScratchRelease()
+ */
+dsp_scratch_mark_t DspScratchMark(void);
+
+/**
+ * @brief Allocate a buffer from the arena, inside a scope
+ *
+ * @param size      Size in bytes (rounded up to 16 byte aligned blocks)
+ * @return void*    16 byte aligned buffer, NULL if it doesn't fit or not inside a scope
+ */
+void *DspScratchAlloc(size_t size);
+
+/**
+ * @brief End a scratch scope: frees everything allocated since the mark
+ *
+ * @param mark      Value returned by the matching DspScratchMark()
+ */
+void DspScratchRelease(dsp_scratch_mark_t mark);
+
+/**
+ * @brief Highest arena use since start-up
+ *
+ * @return size_t   Bytes
+ */
+size_t DspScratchPeak(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DSP_SCRATCH_H_ */
+
+/*==================[end of file]============================================*/
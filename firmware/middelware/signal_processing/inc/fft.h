@@ -8,6 +8,10 @@
  */
 
 /** \brief Functionalities to calculate FFT
+ * 
+ * With power management (PowerInit) each FFTMagnitude... call is a burst at
+ * the maximum CPU frequency, the rest of the time the CPU can scale down or
+ * sleep.
  * 
  * @author Peñalva Albano
  *
@@ -16,6 +20,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Window selection, window cached between calls                         |
+ * | 14/10/2026 | Real input FFT of half lenght, two signals per transform             |
+ * | 14/10/2026 | Radix-4 backend selection                                             |
+ * | 14/10/2026 | Fixed-point (Q15) FFT magnitude                                       |
+ * | 15/10/2026 | Work buffers from dsp_scratch, caches sized by the transform lenght   |
+ * | 15/10/2026 | Several channels of the same lenght per call (FFTMagnitudeMulti)      |
+ * | 15/10/2026 | Transforms run at the maximum CPU frequency (PowerBurstBegin)         |
+ * | 15/10/2026 | FFTMagnitude* report a missing work buffer instead of returning stale data |
  * 
  **/
 
@@ -23,8 +35,18 @@
 #include <stdint.h>
 #include <stdbool.h>
 /*==================[macros]=================================================*/
-#define MAX_SIGNAL_LENGHT   2048
+#define MAX_SIGNAL_LENGHT   2048    /*!< Longest transform (work buffers: 8 bytes per sample, 4 for Q15, from dsp_scratch) */
 /*==================[typedef]================================================*/
+typedef enum fft_radix {
+    FFT_RADIX_2,            /*!< Radix-2 FFT for every lenght (default) */
+    FFT_RADIX_4             /*!< Radix-4 FFT when the transform lenght is a power of four, radix-2 otherwise */
+} fft_radix_t;
+
+typedef enum fft_window {
+    FFT_WINDOW_HANN,        /*!< Hann window (default) */
+    FFT_WINDOW_BLACKMAN,    /*!< Blackman window */
+    FFT_WINDOW_FLAT_TOP     /*!< Flat-top window (accurate amplitude) */
+} fft_window_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -37,6 +59,49 @@
  */
 bool FFTInit(void);
 
+/**
+ * @brief Initialize the FFT calculation module selecting the FFT radix
+ * 
+ * @note Radix-4 needs fewer passes and multiplications, but its twiddle table
+ * takes extra RAM. If it can not be initialized radix-2 is used.
+ * 
+ * @param radix     FFT radix
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTInitRadix(fft_radix_t radix);
+
+/**
+ * @brief Initialize the fixed-point (Q15) FFT used by FFTMagnitudeQ15
+ * 
+ * @note It can be used with or without FFTInit.
+ * 
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTInitQ15(void);
+
+/**
+ * @brief Returns the radix used for a complex transform of a given lenght
+ * 
+ * @note FFTMagnitude runs a transform of signal_lenght / 2 points and
+ * FFTMagnitudeDual one of signal_lenght points.
+ * 
+ * @param transform_lenght  Number of complex points of the transform
+ * @return fft_radix_t      Radix in use for that lenght
+ */
+fft_radix_t FFTGetRadix(uint16_t transform_lenght);
+
+/**
+ * @brief Selects the window applied by FFTMagnitude
+ * 
+ * @note The window is generated once and reused while the type and the signal
+ * lenght do not change.
+ * 
+ * @param window            Window type
+ */
+void FFTSetWindow(fft_window_t window);
+
 /**
  * @brief Calculates the Fast Fourier Transform of a given signal
  * 
@@ -45,8 +110,60 @@ bool FFTInit(void);
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
  * @param signal_lenght     Lenght of signal arrays
+ * @return true            Magnitude calculated
+ * @return false           Invalid lenght or no work buffer (dsp_scratch): the output is not written
+ */
+bool FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
+
+/**
+ * @brief Calculates the FFT magnitude of two signals with a single complex transform
+ * 
+ * @note  Lenght of signal arrays must be a power of two (with maximun value = MAX_SIGNAL_LENGHT).
+ * Same result as calling FFTMagnitude for each signal.
+ * 
+ * @param signal_a          Array with first signal values (of lenght = signal_lenght)
+ * @param signal_b          Array with second signal values (of lenght = signal_lenght)
+ * @param fft_a             Array to store first signal FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param fft_b             Array to store second signal FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ * @return true            Magnitude calculated
+ * @return false           Invalid lenght or no work buffer (dsp_scratch): the output is not written
+ */
+bool FFTMagnitudeDual(float * signal_a, float * signal_b, float * fft_a, float * fft_b, uint16_t signal_lenght);
+
+/**
+ * @brief Calculates the FFT magnitude of several signals of the same lenght
+ * 
+ * @note  Lenght of signal arrays must be a power of two (with maximun value = MAX_SIGNAL_LENGHT).
+ * Same result as calling FFTMagnitude for each signal. The channels are transformed two
+ * by two as in FFTMagnitudeDual (the last one of an odd number as in FFTMagnitude),
+ * with a single work buffer and window check for the whole call.
+ * 
+ * @param signals           Arrays with the signal values of each channel (of lenght = signal_lenght)
+ * @param ffts              Arrays to store the FFT magnitude of each channel (of lenght = signal_lenght / 2)
+ * @param n_channels        Number of channels
+ * @param signal_lenght     Lenght of signal arrays
+ * @return true            Magnitude calculated
+ * @return false           Invalid lenght or no work buffer (dsp_scratch): the output is not written
+ */
+bool FFTMagnitudeMulti(float * const signals[], float * const ffts[], uint8_t n_channels, uint16_t signal_lenght);
+
+/**
+ * @brief Calculates the FFT magnitude of a signal with a fixed-point (Q15) transform
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT).
+ * Uses the window selected by FFTSetWindow and half the work memory of FFTMagnitude.
+ * The result has the same scaling as FFTMagnitude (saturated to UINT16_MAX), but every
+ * stage of the transform divides the data by two: scale the samples to use the whole
+ * int16 range (e.g. 8 bit samples << 8) to keep the resolution.
+ * 
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal array
+ * @return true            Magnitude calculated
+ * @return false           Invalid lenght or no work buffer (dsp_scratch): the output is not written
  */
-void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
+bool FFTMagnitudeQ15(const int16_t * signal, uint16_t * fft, uint16_t signal_lenght);
 
 /**
  * @brief Return the FFT frequency axis vector
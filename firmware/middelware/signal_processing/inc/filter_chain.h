@@ -0,0 +1,134 @@
+#ifndef FILTER_CHAIN_H_
+#define FILTER_CHAIN_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Filter_Chain Filter Chain
+ ** @{ */
+
+/** \brief Configurable chain of filter stages processed in blocks
+ * 
+ * Each chain filters one signal through up to FILTER_CHAIN_MAX_STAGES stages:
+ * median, spike rejection, Butterworth low/hi pass (iir_filter instances)
+ * and decimation. Stages after a decimation are designed at the reduced
+ * sample frequency, so a signal can be sampled fast and decimated cheaply.
+ *
+ * A chain starts in the steady state of its first sample (FilterChainWarmStart),
+ * so its output is valid right away instead of settling from 0.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Warm start from the first sample, reset                               |
+ * | 15/10/2026 | Running median (sliding_window), spike rejection stage                |
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+#include "sliding_window.h"
+/*==================[macros]=================================================*/
+#define FILTER_CHAIN_MAX_STAGES     4   /*!< Maximum number of stages of a chain */
+#define FILTER_MEDIAN_MAX_WINDOW    SLIDING_MEDIAN_MAX_WINDOW   /*!< Maximum (odd) median window */
+/*==================[typedef]================================================*/
+/**
+ * @brief Filter stage types
+ */
+typedef enum filter_stage_type {
+    STAGE_MEDIAN,       /*!< Median of the last "window" samples (rejects outliers) */
+    STAGE_SPIKE,        /*!< Samples farther than "threshold" from the median of the last "window" samples are replaced by the median */
+    STAGE_LOW_PASS,     /*!< Butterworth low pass filter */
+    STAGE_HI_PASS,      /*!< Butterworth hi pass filter */
+    STAGE_DECIMATE      /*!< Keeps one out of "factor" samples */
+} filter_stage_type_t;
+
+/**
+ * @brief Filter stage configuration
+ */
+typedef struct {
+    filter_stage_type_t type;   /*!< Stage type */
+    float cut_frec;             /*!< Cut-off frequency (STAGE_LOW_PASS and STAGE_HI_PASS) */
+    filter_order_t order;       /*!< Filter order (STAGE_LOW_PASS and STAGE_HI_PASS) */
+    uint8_t window;             /*!< Median window, odd, up to FILTER_MEDIAN_MAX_WINDOW (STAGE_MEDIAN and STAGE_SPIKE) */
+    float threshold;            /*!< Largest distance of a valid sample to the median (STAGE_SPIKE) */
+    uint8_t factor;             /*!< Decimation factor (STAGE_DECIMATE) */
+} filter_stage_config_t;
+
+/**
+ * @brief Filter stage state
+ */
+typedef struct {
+    filter_stage_config_t config;               /*!< Stage configuration */
+    union {
+        iir_filter_t iir;                       /*!< Filter instance (STAGE_LOW_PASS and STAGE_HI_PASS) */
+        sliding_median_t median;                /*!< Median of the last samples (STAGE_MEDIAN and STAGE_SPIKE) */
+    };
+    uint8_t count;                              /*!< Decimation phase (STAGE_DECIMATE) */
+} filter_stage_t;
+
+/**
+ * @brief Filter chain (one per signal)
+ */
+typedef struct {
+    filter_stage_t stage[FILTER_CHAIN_MAX_STAGES];  /*!< Stages, in processing order */
+    uint8_t n_stages;                               /*!< Number of stages */
+    uint16_t decimation;                            /*!< Total decimation factor of the chain */
+    float output_frec;                              /*!< Sample frequency at the chain output */
+    bool started;                                   /*!< The stages hold the state of a signal */
+} filter_chain_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a filter chain
+ * 
+ * @param chain         Chain to be initialized
+ * @param sample_frec   Input signal's sample frequency
+ * @param stages        Stages configuration, in processing order
+ * @param n_stages      Number of stages (up to FILTER_CHAIN_MAX_STAGES)
+ * @return true     Chain initialized
+ * @return false    Invalid configuration
+ */
+bool FilterChainInit(filter_chain_t *chain, float sample_frec, const filter_stage_config_t *stages, uint8_t n_stages);
+
+/**
+ * @brief Forget the signal: the next block warm starts the chain again from its first sample
+ * 
+ * @param chain     Filter chain
+ */
+void FilterChainReset(filter_chain_t *chain);
+
+/**
+ * @brief Load every stage with the steady state of a constant input
+ * 
+ * @note Called by FilterChainProcess() with the first sample after init or reset.
+ * 
+ * @param chain     Filter chain
+ * @param x0        Input value (first sample, or DC value of the signal)
+ */
+void FilterChainWarmStart(filter_chain_t *chain, float x0);
+
+/**
+ * @brief Filter a block of samples in place
+ * 
+ * @note Use blocks multiple of the chain decimation to get the same number
+ * of output samples on each call.
+ * 
+ * @param chain     Filter chain
+ * @param signal    Input samples, overwritten with the output samples
+ * @param length    Number of input samples
+ * @return int16_t  Number of output samples
+ */
+int16_t FilterChainProcess(filter_chain_t *chain, float *signal, int16_t length);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FILTER_CHAIN_H_ */
+
+/*==================[end of file]============================================*/
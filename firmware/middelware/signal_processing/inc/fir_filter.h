@@ -0,0 +1,176 @@
+#ifndef FIR_FILTER_H_
+#define FIR_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FIR_Filter FIR Filter
+ ** @{ */
+
+/** \brief FIR filters, polyphase decimators and interpolators
+ *
+ * - Filter: FIR filter instance, one per signal.
+ * - Decimator: keeps one out of "factor" samples of the filtered signal, but
+ *   only computes the samples it keeps (n_taps multiply-adds per output
+ *   sample instead of per input sample).
+ * - Interpolator: inserts factor - 1 samples between input samples. Each
+ *   output sample runs one of the factor sub-filters (phases) of n_taps /
+ *   factor taps, without filtering the zeros of a full rate upsampler.
+ * - Design: windowed-sinc low pass coefficients for any of the above.
+ *
+ * Coefficients are given oldest sample first, as esp-dsp takes them (the
+ * same as the impulse response for the symmetric FirLowPassDesign filters),
+ * and copied into the instance, so the array can be reused.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define FIR_MAX_TAPS    64  /*!< Maximum number of coefficients of a filter */
+#define FIR_MAX_FACTOR  8   /*!< Maximum decimation or interpolation factor */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Windows for FirLowPassDesign
+ */
+typedef enum fir_window {
+    FIR_WINDOW_HAMMING,     /*!< Hamming: ~53 dB stop band attenuation */
+    FIR_WINDOW_BLACKMAN     /*!< Blackman: ~74 dB stop band attenuation, wider transition band */
+} fir_window_t;
+
+/**
+ * @brief Filter instance, keeps its own coefficients and delay line
+ */
+typedef struct {
+    uint16_t n_taps;                                            /*!< Number of coefficients (padded to a multiple of 4) */
+    uint16_t pos;                                               /*!< Position of the next sample in the delay line */
+    float coeff[FIR_MAX_TAPS] __attribute__((aligned(16)));     /*!< Coefficients, oldest sample first */
+    float delay[FIR_MAX_TAPS] __attribute__((aligned(16)));     /*!< Delay line (circular) */
+} fir_filter_t;
+
+/**
+ * @brief Decimator instance
+ */
+typedef struct {
+    fir_filter_t fir;       /*!< Anti-aliasing filter */
+    uint8_t factor;         /*!< Decimation factor */
+    uint8_t phase;          /*!< Input samples of the output sample in progress */
+} fir_decimator_t;
+
+/**
+ * @brief Interpolator instance
+ */
+typedef struct {
+    uint8_t factor;                                     /*!< Interpolation factor (number of phases) */
+    uint16_t n_phase_taps;                              /*!< Coefficients of each phase */
+    uint16_t pos;                                       /*!< Position of the newest sample in the delay line */
+    float coeff[FIR_MAX_TAPS + FIR_MAX_FACTOR];         /*!< Impulse response of each phase, newest sample first */
+    float delay[2 * FIR_MAX_TAPS];                      /*!< Delay line, stored twice to read it without wrapping */
+} fir_interpolator_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design a windowed-sinc low pass filter (unity gain at DC)
+ *
+ * @param coeff         Coefficients array (n_taps elements)
+ * @param n_taps        Number of coefficients (up to FIR_MAX_TAPS, odd is best)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency (-6 dB)
+ * @param window        Window applied to the sinc
+ * @return true     Coefficients designed
+ * @return false    Invalid parameters
+ */
+bool FirLowPassDesign(float *coeff, uint16_t n_taps, float sample_frec, float cut_frec, fir_window_t window);
+
+/**
+ * @brief Initialize a filter instance (clears its delay line)
+ *
+ * @param filter    Filter instance
+ * @param coeff     Coefficients, oldest sample first
+ * @param n_taps    Number of coefficients (up to FIR_MAX_TAPS)
+ * @return true     Filter initialized
+ * @return false    Too many coefficients
+ */
+bool FirInit(fir_filter_t *filter, const float *coeff, uint16_t n_taps);
+
+/**
+ * @brief Apply a filter instance to a signal array (input and output may be the same array)
+ *
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FirFilter(fir_filter_t *filter, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Initialize a decimator (clears its delay line)
+ *
+ * @note The filter must cut below sample_frec / (2 * factor), e.g.
+ * FirLowPassDesign(coeff, n_taps, sample_frec, 0.4 * sample_frec / factor, FIR_WINDOW_HAMMING)
+ *
+ * @param decimator Decimator instance
+ * @param coeff     Anti-aliasing filter coefficients
+ * @param n_taps    Number of coefficients (up to FIR_MAX_TAPS)
+ * @param factor    Decimation factor (up to FIR_MAX_FACTOR)
+ * @return true     Decimator initialized
+ * @return false    Invalid parameters
+ */
+bool FirDecimatorInit(fir_decimator_t *decimator, const float *coeff, uint16_t n_taps, uint8_t factor);
+
+/**
+ * @brief Filter and decimate a block of samples (input and output may be the same array)
+ *
+ * @note Blocks need not be multiple of the factor: the phase is kept between calls.
+ *
+ * @param decimator         Decimator instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Output signal array (up to signal_lenght / factor + 1 samples)
+ * @param signal_lenght     Number of input samples
+ * @return int16_t          Number of output samples
+ */
+int16_t FirDecimate(fir_decimator_t *decimator, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Initialize an interpolator (clears its delay line)
+ *
+ * @note The filter is designed at the output rate and must cut below the
+ * input Nyquist frequency, e.g. FirLowPassDesign(coeff, n_taps, factor *
+ * sample_frec, 0.4 * sample_frec, FIR_WINDOW_HAMMING). The gain is scaled by
+ * factor to make up for the inserted samples.
+ *
+ * @param interpolator  Interpolator instance
+ * @param coeff         Interpolation filter coefficients
+ * @param n_taps        Number of coefficients (up to FIR_MAX_TAPS)
+ * @param factor        Interpolation factor (up to FIR_MAX_FACTOR)
+ * @return true     Interpolator initialized
+ * @return false    Invalid parameters
+ */
+bool FirInterpolatorInit(fir_interpolator_t *interpolator, const float *coeff, uint16_t n_taps, uint8_t factor);
+
+/**
+ * @brief Interpolate a block of samples
+ *
+ * @param interpolator      Interpolator instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Output signal array (signal_lenght * factor samples, not the input array)
+ * @param signal_lenght     Number of input samples
+ * @return int16_t          Number of output samples
+ */
+int16_t FirInterpolate(fir_interpolator_t *interpolator, const float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FIR_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,13 @@
  */
 
 /** \brief Functionalities to design and use filters
+ * 
+ * A filter started with its delay lines cleared sees its first sample as a
+ * step from 0, and its output takes several time constants to settle. The
+ * warm start functions load the delay lines with the steady state of a
+ * constant input instead (the first sample, or the signal's DC value), so the
+ * output is valid from the first sample. They return the steady-state output,
+ * to warm start the next filter of a cascade.
  * 
  * @author Peñalva Albano
  *
@@ -16,12 +23,26 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 14/10/2026 | Filter instances (iir_filter_t) for independent signals               |
+ * | 14/10/2026 | Multi-channel filter for interleaved signals                          |
+ * | 14/10/2026 | Fused cascaded sections kernel                                        |
+ * | 15/10/2026 | Constant designs generated off-line (iir_design.py, IirFilterConst)   |
+ * | 15/10/2026 | Fixed-point (Q15) cascade for int16 samples                           |
+ * | 15/10/2026 | Notch filter instance (mains interference)                            |
+ * | 15/10/2026 | State reset, snapshot and steady-state warm start                     |
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define IIR_MAX_SOS     4   /*!< 2nd order sections of the highest order filter */
+#define IIR_N_COEFF     5   /*!< Coefficients of each 2nd order section */
+#define IIR_N_DELAY     2   /*!< Delay line length of each 2nd order section */
+#define IIR_MAX_CHANNELS 8  /*!< Maximum number of channels of a multi-channel filter */
+#define IIR_Q15_N_DELAY 4   /*!< Delay line length of each Q15 section: x[n-1], x[n-2], y[n-1], y[n-2] */
+#define IIR_Q15_FRAC    14  /*!< Fractional bits of the Q15 filter coefficients (Q2.14: -2 to 2) */
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,6 +51,50 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+/**
+ * @brief Filter instance, keeps its own coefficients and delay lines
+ */
+typedef struct {
+    uint8_t n_sos;                              /*!< Number of 2nd order sections (order / 2) */
+    float coeff[IIR_MAX_SOS][IIR_N_COEFF];      /*!< Coefficients of each section */
+    float delay[IIR_MAX_SOS][IIR_N_DELAY];      /*!< Delay line of each section */
+} iir_filter_t;
+
+/**
+ * @brief Snapshot of the delay lines of a filter instance (IirSaveState, IirRestoreState)
+ */
+typedef struct {
+    float delay[IIR_MAX_SOS][IIR_N_DELAY];      /*!< Delay line of each section */
+} iir_state_t;
+
+/**
+ * @brief Filter design: coefficients of each section, for designs computed
+ * off-line and kept in flash (generated by iir_design.py)
+ */
+typedef struct {
+    uint8_t n_sos;                              /*!< Number of 2nd order sections (order / 2) */
+    float coeff[IIR_MAX_SOS][IIR_N_COEFF];      /*!< Coefficients of each section */
+} iir_design_t;
+
+/**
+ * @brief Multi-channel filter instance: same response for every channel, one delay line per channel
+ */
+typedef struct {
+    uint8_t n_channels;                                         /*!< Number of interleaved channels */
+    uint8_t n_sos;                                              /*!< Number of 2nd order sections (order / 2) */
+    float coeff[IIR_MAX_SOS][IIR_N_COEFF];                      /*!< Coefficients of each section (shared) */
+    float delay[IIR_MAX_CHANNELS][IIR_MAX_SOS][IIR_N_DELAY];    /*!< Delay lines of each channel */
+} iir_multi_filter_t;
+
+/**
+ * @brief Fixed-point filter instance for int16 samples (Q15 data, Q2.14 coefficients)
+ */
+typedef struct {
+    uint8_t n_sos;                              /*!< Number of 2nd order sections (order / 2) */
+    int16_t coeff[IIR_MAX_SOS][IIR_N_COEFF];    /*!< b0, b1, b2, a1, a2 of each section (Q2.14) */
+    int16_t delay[IIR_MAX_SOS][IIR_Q15_N_DELAY];/*!< Delay line of each section (direct form I) */
+} iir_q15_filter_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
@@ -69,6 +134,319 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
  */
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
 
+/**
+ * @brief Clear the delay lines of the low pass filter (LowPassFilter)
+ */
+void LowPassReset(void);
+
+/**
+ * @brief Clear the delay lines of the hi pass filter (HiPassFilter)
+ */
+void HiPassReset(void);
+
+/**
+ * @brief Load the low pass filter (LowPassFilter) with the steady state of a constant input
+ * 
+ * @param x0            Input value (first sample, or DC value of the signal)
+ * @return float        Steady-state output
+ */
+float LowPassWarmStart(float x0);
+
+/**
+ * @brief Load the hi pass filter (HiPassFilter) with the steady state of a constant input
+ * 
+ * @param x0            Input value (first sample, or DC value of the signal)
+ * @return float        Steady-state output (0)
+ */
+float HiPassWarmStart(float x0);
+
+/**
+ * @brief Initialize a Butterworth Low Pass Filter instance (clears its delay lines)
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void IirLowPassInit(iir_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a Butterworth Hi Pass Filter instance (clears its delay lines)
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void IirHiPassInit(iir_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a 2nd order Notch Filter instance (clears its delay lines)
+ * 
+ * @note Unity gain away from the notch, zero gain at notch_frec. The rejected
+ * band is about notch_frec / q wide (-3 dB).
+ * 
+ * @param filter        Filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param notch_frec    Rejected frequency (e.g. 50 or 60 Hz mains)
+ * @param q             Quality factor (higher: narrower notch, longer settling)
+ */
+void IirNotchInit(iir_filter_t *filter, float sample_frec, float notch_frec, float q);
+
+/**
+ * @brief Initialize a filter instance from a constant design (clears its delay lines)
+ * 
+ * @param filter        Filter instance
+ * @param design        Filter design (from iir_design.py)
+ */
+void IirDesignInit(iir_filter_t *filter, const iir_design_t *design);
+
+/**
+ * @brief Apply a filter instance to a signal array (input and output may be the same array)
+ * 
+ * @note Filters of order 4 or more run all their sections per sample, in a single
+ * pass over the signal.
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilter(iir_filter_t *filter, float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply a filter instance one section at a time (one dsps_biquad_f32 pass per section)
+ * 
+ * @note Same result as IirFilter(), kept as reference for benchmarks.
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterMultiPass(iir_filter_t *filter, float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the delay lines of a filter instance (as after its init)
+ * 
+ * @param filter        Filter instance
+ */
+void IirReset(iir_filter_t *filter);
+
+/**
+ * @brief Load the delay lines of a filter instance with the steady state of a constant input
+ * 
+ * @param filter        Filter instance
+ * @param x0            Input value (first sample, or DC value of the signal)
+ * @return float        Steady-state output (0 for a hi pass filter)
+ */
+float IirWarmStart(iir_filter_t *filter, float x0);
+
+/**
+ * @brief Load the delay lines of a constant design (IirFilterConst) with the steady state of a constant input
+ * 
+ * @param design        Filter design
+ * @param delay         Delay lines (delay[design->n_sos][IIR_N_DELAY])
+ * @param x0            Input value (first sample, or DC value of the signal)
+ * @return float        Steady-state output
+ */
+float IirDesignWarmStart(const iir_design_t *design, float delay[][IIR_N_DELAY], float x0);
+
+/**
+ * @brief Save the delay lines of a filter instance
+ * 
+ * @param filter        Filter instance
+ * @param state         Snapshot
+ */
+void IirSaveState(const iir_filter_t *filter, iir_state_t *state);
+
+/**
+ * @brief Restore the delay lines of a filter instance saved with IirSaveState
+ * 
+ * @note The snapshot is only meaningful for a filter with the same coefficients.
+ * 
+ * @param filter        Filter instance
+ * @param state         Snapshot
+ */
+void IirRestoreState(iir_filter_t *filter, const iir_state_t *state);
+
+/**
+ * @brief Initialize a Butterworth Low Pass multi-channel filter (clears its delay lines)
+ * 
+ * @param filter        Filter instance
+ * @param n_channels    Number of interleaved channels (up to IIR_MAX_CHANNELS)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void IirMultiLowPassInit(iir_multi_filter_t *filter, uint8_t n_channels, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a Butterworth Hi Pass multi-channel filter (clears its delay lines)
+ * 
+ * @param filter        Filter instance
+ * @param n_channels    Number of interleaved channels (up to IIR_MAX_CHANNELS)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void IirMultiHiPassInit(iir_multi_filter_t *filter, uint8_t n_channels, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a multi-channel filter to an interleaved signal array in a single pass
+ * 
+ * @note Sample of channel ch in frame n is at [n * n_channels + ch]. Input and
+ * output may be the same array.
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Interleaved input signal array
+ * @param output_signal     Interleaved filtered signal array
+ * @param n_frames          Number of frames (samples per channel)
+ */
+void IirMultiFilter(iir_multi_filter_t *filter, float * input_signal, float * output_signal, int16_t n_frames);
+
+/**
+ * @brief Clear the delay lines of every channel of a multi-channel filter
+ * 
+ * @param filter        Filter instance
+ */
+void IirMultiReset(iir_multi_filter_t *filter);
+
+/**
+ * @brief Load the delay lines of each channel with the steady state of a constant input
+ * 
+ * @param filter        Filter instance
+ * @param x0            Input value of each channel (one frame: x0[ch])
+ */
+void IirMultiWarmStart(iir_multi_filter_t *filter, const float *x0);
+
+/**
+ * @brief Initialize a fixed-point filter from a float design (clears its delay lines)
+ * 
+ * @note The coefficients are rounded to Q2.14. The quantization moves the poles
+ * of very narrow filters (cut-off below about 0.5% of the sample frequency):
+ * check the response of such designs against the float filter.
+ * 
+ * @param filter        Fixed-point filter instance
+ * @param design        Filter design (from iir_design.py, or the coefficients of an iir_filter_t)
+ * @return true     Filter initialized
+ * @return false    A coefficient is out of the Q2.14 range (-2 to 2)
+ */
+bool IirQ15DesignInit(iir_q15_filter_t *filter, const iir_design_t *design);
+
+/**
+ * @brief Initialize a fixed-point Butterworth Low Pass Filter (clears its delay lines)
+ * 
+ * @param filter        Fixed-point filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true     Filter initialized
+ * @return false    A coefficient is out of the Q2.14 range
+ */
+bool IirQ15LowPassInit(iir_q15_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a fixed-point Butterworth Hi Pass Filter (clears its delay lines)
+ * 
+ * @param filter        Fixed-point filter instance
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true     Filter initialized
+ * @return false    A coefficient is out of the Q2.14 range
+ */
+bool IirQ15HiPassInit(iir_q15_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a fixed-point filter to an int16 signal array (input and output may be the same array)
+ * 
+ * @note Direct form I with a 32 bit accumulator per section: the output of each
+ * section is rounded and saturated to int16. Scale the samples to use the int16
+ * range (e.g. 12 bit ADC values << 3) to keep the resolution, leaving headroom
+ * for the gain of the filter.
+ * 
+ * @param filter            Fixed-point filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirQ15Filter(iir_q15_filter_t *filter, const int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the delay lines of a fixed-point filter
+ * 
+ * @param filter        Fixed-point filter instance
+ */
+void IirQ15Reset(iir_q15_filter_t *filter);
+
+/**
+ * @brief Load the delay lines of a fixed-point filter with the steady state of a constant input
+ * 
+ * @param filter        Fixed-point filter instance
+ * @param x0            Input value (first sample, or DC value of the signal)
+ * @return int16_t      Steady-state output (saturated)
+ */
+int16_t IirQ15WarmStart(iir_q15_filter_t *filter, int16_t x0);
+
+/**
+ * @brief Cascaded 2nd order sections in a single pass (direct form II, same as dsps_biquad_f32)
+ * 
+ * @note Each sample goes through every section before the next one is read,
+ * with the delay lines kept in locals. Always inlined: with a constant n_sos
+ * the section loop is unrolled and the state stays in registers, and with
+ * constant coefficients they are folded into the code.
+ * 
+ * @param input     Input signal array
+ * @param output    Filtered signal array (may be input)
+ * @param len       Number of samples of both signals
+ * @param coeff     Coefficients of each section
+ * @param delay     Delay line of each section
+ * @param n_sos     Number of sections
+ */
+static inline __attribute__((always_inline)) void IirSosKernel(const float *input, float *output, int16_t len,
+        const float coeff[][IIR_N_COEFF], float delay[][IIR_N_DELAY], const uint8_t n_sos){
+    float w0[IIR_MAX_SOS], w1[IIR_MAX_SOS];
+    float x, d0;
+
+    for(uint8_t i = 0; i < n_sos; i++){
+        w0[i] = delay[i][0];
+        w1[i] = delay[i][1];
+    }
+    for(int16_t n = 0; n < len; n++){
+        x = input[n];
+        for(uint8_t i = 0; i < n_sos; i++){
+            d0 = x - coeff[i][3] * w0[i] - coeff[i][4] * w1[i];
+            x = coeff[i][0] * d0 + coeff[i][1] * w0[i] + coeff[i][2] * w1[i];
+            w1[i] = w0[i];
+            w0[i] = d0;
+        }
+        output[n] = x;
+    }
+    for(uint8_t i = 0; i < n_sos; i++){
+        delay[i][0] = w0[i];
+        delay[i][1] = w1[i];
+    }
+}
+
+/**
+ * @brief Apply a constant design to a signal array, with the coefficients built into the code
+ * 
+ * @note Called with a static const design (from iir_design.py), the filter is
+ * specialized at compile time: no init, no coefficient loads from RAM and
+ * the sections unrolled. Each call site gets its own copy of the loop.
+ * 
+ * @param design            Filter design (static const)
+ * @param delay             Delay lines, zero initialized (delay[design->n_sos][IIR_N_DELAY])
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (may be input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+static inline __attribute__((always_inline)) void IirFilterConst(const iir_design_t *design, float delay[][IIR_N_DELAY],
+        const float *input_signal, float *output_signal, int16_t signal_lenght){
+    IirSosKernel(input_signal, output_signal, signal_lenght, design->coeff, delay, design->n_sos);
+}
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -0,0 +1,112 @@
+#ifndef ORIENTATION_H_
+#define ORIENTATION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Orientation Orientation
+ ** @{ */
+
+/** \brief Orientation estimation fusing accelerometer and gyroscope (e.g. MPU6050)
+ * 
+ * Mahony complementary filter on a quaternion: the gyroscope is integrated on
+ * every sample and the accelerometer only corrects the slow drift (proportional
+ * and integral gains on the error between measured and estimated gravity).
+ * The integral term also tracks the gyroscope bias. Accelerometer samples whose
+ * magnitude departs from the calibrated gravity by more than accel_gate are
+ * ignored, so linear accelerations are not taken as tilt, and the estimate
+ * follows fast movements without the lag of heavy accelerometer filtering.
+ *
+ * The estimated gravity (OrientationGravity) has the direction a resting
+ * accelerometer would measure, so it can be given directly to posture_math
+ * (PostureOverThreshold, PostureAngle) in place of the raw acceleration.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define ORIENTATION_KP          1.0f    /*!< Default proportional gain (1/s) */
+#define ORIENTATION_KI          0.05f   /*!< Default integral gain (1/s²) */
+#define ORIENTATION_ACCEL_GATE  0.15f   /*!< Default accelerometer gate (fraction of gravity) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Orientation estimator state (use OrientationInit to fill it)
+ */
+typedef struct {
+    float q[4];             /*!< Orientation quaternion (w, x, y, z), sensor to earth frame */
+    float bias[3];          /*!< Integral correction, opposite of the gyroscope bias (rad/s) */
+    float kp;               /*!< Proportional gain */
+    float ki;               /*!< Integral gain */
+    float accel_gate;       /*!< Accelerometer gate (fraction of gravity, 0 disables it) */
+    float gravity2;         /*!< Squared calibrated gravity magnitude (accelerometer units) */
+} orientation_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes the estimator aligned with a resting accelerometer reading
+ * 
+ * The heading (rotation around gravity) starts at zero. The magnitude of the
+ * reading is taken as the gravity used by the accelerometer gate.
+ * 
+ * @param ori           Estimator to be initialized
+ * @param ax            Resting acceleration in X (any unit, e.g. a calibration average)
+ * @param ay            Resting acceleration in Y (same unit as ax)
+ * @param az            Resting acceleration in Z (same unit as ax)
+ */
+void OrientationInit(orientation_t *ori, float ax, float ay, float az);
+
+/**
+ * @brief Changes the filter gains
+ * 
+ * @param ori           Estimator
+ * @param kp            Proportional gain (higher follows the accelerometer faster)
+ * @param ki            Integral gain (gyroscope bias tracking, 0 disables it)
+ * @param accel_gate    Accelerometer gate (fraction of gravity, 0 disables it)
+ */
+void OrientationSetGains(orientation_t *ori, float kp, float ki, float accel_gate);
+
+/**
+ * @brief Updates the estimation with a new sample
+ * 
+ * @param ori   Estimator
+ * @param ax    Acceleration in X (same unit as OrientationInit)
+ * @param ay    Acceleration in Y
+ * @param az    Acceleration in Z
+ * @param gx    Angular rate around X (rad/s)
+ * @param gy    Angular rate around Y (rad/s)
+ * @param gz    Angular rate around Z (rad/s)
+ * @param dt    Time since the previous sample (s)
+ */
+void OrientationUpdate(orientation_t *ori, float ax, float ay, float az, float gx, float gy, float gz, float dt);
+
+/**
+ * @brief Copies the orientation quaternion
+ * 
+ * @param ori   Estimator
+ * @param q     Quaternion (w, x, y, z)
+ */
+void OrientationQuaternion(const orientation_t *ori, float q[4]);
+
+/**
+ * @brief Estimated gravity direction in the sensor frame (unit vector, no sqrtf)
+ * 
+ * @param ori   Estimator
+ * @param g     Gravity direction (X, Y, Z), as measured by a resting accelerometer
+ */
+void OrientationGravity(const orientation_t *ori, float g[3]);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ORIENTATION_H_ */
+
+/*==================[end of file]============================================*/
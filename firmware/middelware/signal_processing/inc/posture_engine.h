@@ -0,0 +1,136 @@
+#ifndef POSTURE_ENGINE_H_
+#define POSTURE_ENGINE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Posture_Engine Posture Engine
+ ** @{ */
+
+/** \brief Posture state machine with hysteresis and minimum dwell
+ * 
+ * A bad posture period starts when the tilt goes above the enter threshold and
+ * only ends after the tilt stays under the (lower) exit threshold for the
+ * minimum dwell time. Noise around a single threshold, or a short upright
+ * glitch, does not restart the warning and alert timers. All the times are
+ * measured with the timestamps of the samples, not with the number of calls.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Bad posture periods resumed from another engine (PostureEngineResume)	|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Posture states
+ */
+typedef enum {
+    POSTURE_CORRECT = 0,    /*!< No bad posture period, or shorter than warning_ms */
+    POSTURE_WARNING,        /*!< Bad posture for warning_ms */
+    POSTURE_ALERT,          /*!< Bad posture for alert_ms */
+} posture_state_t;
+
+/**
+ * @brief Posture engine configuration
+ */
+typedef struct {
+    uint16_t enter_cdeg;    /*!< Tilt that starts a bad posture period (hundredths of degree) */
+    uint16_t exit_cdeg;     /*!< Tilt under which the posture is correct again (hundredths of degree, <= enter_cdeg) */
+    uint32_t dwell_ms;      /*!< Time under exit_cdeg needed to end a bad posture period */
+    uint32_t warning_ms;    /*!< Bad posture time to warn */
+    uint32_t alert_ms;      /*!< Bad posture time to alert (>= warning_ms) */
+} posture_engine_config_t;
+
+/**
+ * @brief Posture engine state (use PostureEngineInit to fill it)
+ */
+typedef struct {
+    posture_engine_config_t config;
+    posture_state_t state;          /*!< Current state */
+    int64_t bad_since_us;           /*!< Start of the bad posture period, -1 if none */
+    int64_t upright_since_us;       /*!< Start of the time under exit_cdeg inside a bad period, -1 if none */
+    uint32_t carry_ms;              /*!< Bad posture time of the period before bad_since_us (see PostureEngineResume) */
+} posture_engine_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a posture engine in the correct state
+ * 
+ * @param engine    Engine to be initialized
+ * @param config    Configuration
+ * @return true     Engine initialized
+ * @return false    Invalid configuration (see PostureEngineSetConfig)
+ */
+bool PostureEngineInit(posture_engine_t *engine, const posture_engine_config_t *config);
+
+/**
+ * @brief Checks a configuration
+ * 
+ * @param config    Configuration
+ * @return true     exit_cdeg <= enter_cdeg and warning_ms <= alert_ms
+ */
+bool PostureEngineConfigValid(const posture_engine_config_t *config);
+
+/**
+ * @brief Changes the configuration keeping the current bad posture period
+ * 
+ * @param engine    Posture engine
+ * @param config    New configuration
+ * @return true     Configuration applied
+ * @return false    exit_cdeg > enter_cdeg or warning_ms > alert_ms, the configuration is not changed
+ */
+bool PostureEngineSetConfig(posture_engine_t *engine, const posture_engine_config_t *config);
+
+/**
+ * @brief Processes a sample
+ * 
+ * @param engine        Posture engine
+ * @param angle_cdeg    Tilt angle (hundredths of degree, e.g. from PostureAngleFixed)
+ * @param timestamp_us  Acquisition time of the sample (us)
+ * @return posture_state_t State after the sample
+ */
+posture_state_t PostureEngineUpdate(posture_engine_t *engine, uint16_t angle_cdeg, int64_t timestamp_us);
+
+/**
+ * @brief Duration of the current bad posture period
+ * 
+ * @param engine        Posture engine
+ * @param timestamp_us  Time of the last sample (us)
+ * @return uint32_t Bad posture time (ms), 0 if the posture is correct
+ */
+uint32_t PostureEngineBadTime(const posture_engine_t *engine, int64_t timestamp_us);
+
+/**
+ * @brief Continues a bad posture period measured by another engine
+ *
+ * E.g. the LP core measured bad_ms of bad posture while the HP core slept: the
+ * period goes on from the next sample, whatever its tilt, and the warning and
+ * alert times count bad_ms as already elapsed.
+ * @param engine    Posture engine
+ * @param bad_ms    Bad posture time already elapsed (ms), 0 does nothing
+ */
+void PostureEngineResume(posture_engine_t *engine, uint32_t bad_ms);
+
+/**
+ * @brief Ends the bad posture period (e.g. after a recalibration)
+ * 
+ * @param engine    Posture engine
+ */
+void PostureEngineReset(posture_engine_t *engine);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POSTURE_ENGINE_H_ */
+
+/*==================[end of file]============================================*/
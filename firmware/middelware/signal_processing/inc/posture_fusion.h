@@ -0,0 +1,144 @@
+#ifndef POSTURE_FUSION_H_
+#define POSTURE_FUSION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Posture_Fusion Posture Fusion
+ ** @{ */
+/** \brief Per-sensor calibration and fused tilt of several accelerometers
+ * 
+ * Each sensor has its own reference posture (mean acceleration measured while
+ * the user holds the reference) and its own tilt angle, computed with
+ * posture_math. The fused score is the weighted mean of the last angle of
+ * every calibrated sensor, so sensors with different sample rates can be
+ * fused: each one updates its angle when it has a new sample.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Calibration mean and dispersion with Welford's update					|
+ * 
+ **/
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "posture_math.h"
+#include "running_stats.h"
+/*==================[macros]=================================================*/
+#define POSTURE_FUSION_MAX  2   /*!< Maximum number of sensors */
+/*==================[typedef]================================================*/
+/**
+ * @brief Calibration of one sensor
+ */
+typedef struct {
+    float base[3];      /*!< Mean acceleration in the reference posture (g) */
+    float dispersion;   /*!< Dispersion of the averaged samples (g RMS) */
+} posture_calibration_t;
+/**
+ * @brief State of one sensor
+ */
+typedef struct {
+    posture_ref_t ref;              /*!< Reference of the current calibration */
+    posture_calibration_t cal;      /*!< Current calibration */
+    welford_t acc[3];               /*!< Calibration statistics of each axis */
+    uint16_t angle_cdeg;            /*!< Last tilt angle (hundredths of degree) */
+    uint8_t weight;                 /*!< Weight in the fused score */
+    bool calibrated;                /*!< The sensor has a calibration */
+} posture_fusion_sensor_t;
+/**
+ * @brief Fusion of several sensors
+ */
+typedef struct {
+    posture_fusion_sensor_t sensor[POSTURE_FUSION_MAX];
+    uint8_t count;                  /*!< Number of sensors */
+    float threshold_deg;            /*!< Tilt threshold of the references (see PostureRefInit) */
+} posture_fusion_t;
+/*==================[external data declaration]==============================*/
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a fusion of uncalibrated sensors
+ * 
+ * @param fusion        Fusion to be initialized
+ * @param count         Number of sensors (up to POSTURE_FUSION_MAX)
+ * @param weights       Weight of each sensor, NULL for equal weights
+ * @param threshold_deg Tilt threshold of the references (degrees)
+ * @return true     Fusion initialized
+ * @return false    Invalid number of sensors
+ */
+bool PostureFusionInit(posture_fusion_t *fusion, uint8_t count, const uint8_t *weights, float threshold_deg);
+/**
+ * @brief Clears the calibration accumulators of every sensor
+ * 
+ * @param fusion    Fusion
+ */
+void PostureFusionCalibrationStart(posture_fusion_t *fusion);
+/**
+ * @brief Adds a sample to the calibration accumulators of a sensor
+ * 
+ * @param fusion    Fusion
+ * @param sensor    Sensor index
+ * @param x         Acceleration in X (g)
+ * @param y         Acceleration in Y (g)
+ * @param z         Acceleration in Z (g)
+ */
+void PostureFusionCalibrationAdd(posture_fusion_t *fusion, uint8_t sensor, float x, float y, float z);
+/**
+ * @brief Mean and dispersion of the accumulated samples of a sensor
+ * 
+ * @note The calibration in use is not changed (see PostureFusionSetCalibration).
+ * 
+ * @param fusion    Fusion
+ * @param sensor    Sensor index
+ * @param cal       Measured calibration
+ * @return true     Calibration measured
+ * @return false    No samples accumulated
+ */
+bool PostureFusionCalibrationEnd(const posture_fusion_t *fusion, uint8_t sensor, posture_calibration_t *cal);
+/**
+ * @brief Sets the calibration of a sensor (measured or restored)
+ * 
+ * @param fusion    Fusion
+ * @param sensor    Sensor index
+ * @param cal       Calibration
+ */
+void PostureFusionSetCalibration(posture_fusion_t *fusion, uint8_t sensor, const posture_calibration_t *cal);
+/**
+ * @brief Clears the calibration of every sensor
+ * 
+ * @param fusion    Fusion
+ */
+void PostureFusionClearCalibration(posture_fusion_t *fusion);
+/**
+ * @brief Checks if every sensor is calibrated
+ * 
+ * @param fusion    Fusion
+ * @return true     All the sensors are calibrated
+ */
+bool PostureFusionReady(const posture_fusion_t *fusion);
+/**
+ * @brief Updates the tilt angle of a sensor with a new sample (fixed point)
+ * 
+ * @param fusion    Fusion
+ * @param sensor    Sensor index (calibrated)
+ * @param x_mg      Acceleration in X (mili-g)
+ * @param y_mg      Acceleration in Y (mili-g)
+ * @param z_mg      Acceleration in Z (mili-g)
+ * @return uint16_t Tilt angle of the sensor (hundredths of degree)
+ */
+uint16_t PostureFusionUpdate(posture_fusion_t *fusion, uint8_t sensor, int16_t x_mg, int16_t y_mg, int16_t z_mg);
+/**
+ * @brief Fused score: weighted mean of the last angle of every calibrated sensor
+ * 
+ * @param fusion    Fusion
+ * @return uint16_t Fused tilt angle (hundredths of degree), 0 if no sensor is calibrated
+ */
+uint16_t PostureFusionScore(const posture_fusion_t *fusion);
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POSTURE_FUSION_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,108 @@
+#ifndef POSTURE_HISTORY_H_
+#define POSTURE_HISTORY_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Posture_History Posture History
+ ** @{ */
+
+/** \brief Per-minute posture statistics in a fixed size ring
+ * 
+ * Each processed sample is added with its posture state and tilt. Every minute
+ * (measured with the sample timestamps) the time in each state, the mean and
+ * maximum tilt and the number of alerts are closed into one 15 byte entry of a
+ * ring that keeps the last POSTURE_HISTORY_LEN minutes. The ring is a plain
+ * struct, so it can be stored as is (e.g. a NVS blob) and restored at boot.
+ * 
+ * @note Not thread safe: protect PostureHistoryAdd and the ring readers with
+ * the same lock if they run in different tasks.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "posture_engine.h"
+/*==================[macros]=================================================*/
+#define POSTURE_HISTORY_LEN         120     /*!< Minutes kept in the ring */
+#define POSTURE_HISTORY_STATES      3       /*!< Number of posture_state_t values */
+#define POSTURE_HISTORY_MAX_GAP_MS  1000    /*!< Longer gaps between samples are not accounted */
+/*==================[typedef]================================================*/
+/**
+ * @brief Statistics of one minute (little-endian, packed)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t minute;                                /*!< Minute number, keeps counting when the ring is restored */
+    uint16_t state_ms[POSTURE_HISTORY_STATES];      /*!< Time in each posture_state_t (ms) */
+    uint16_t mean_cdeg;                             /*!< Mean tilt (hundredths of degree) */
+    uint16_t max_cdeg;                              /*!< Maximum tilt (hundredths of degree) */
+    uint8_t alerts;                                 /*!< Transitions to POSTURE_ALERT */
+} posture_minute_t;
+
+/**
+ * @brief Ring of closed minutes
+ */
+typedef struct {
+    posture_minute_t entries[POSTURE_HISTORY_LEN];
+    uint16_t head;              /*!< Next entry to be written */
+    uint16_t count;             /*!< Valid entries */
+    uint32_t next_minute;       /*!< Number of the minute being aggregated */
+} posture_history_ring_t;
+
+/**
+ * @brief Posture history (use PostureHistoryInit to fill it)
+ */
+typedef struct {
+    posture_history_ring_t ring;    /*!< Closed minutes */
+    posture_minute_t current;       /*!< Minute being aggregated */
+    uint32_t angle_sum;             /*!< Sum of the tilts of the current minute */
+    uint16_t samples;               /*!< Samples of the current minute */
+    posture_state_t last_state;     /*!< State of the previous sample */
+    int64_t minute_start_us;        /*!< Start of the current minute, -1 before the first sample */
+    int64_t last_us;                /*!< Timestamp of the previous sample */
+} posture_history_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a posture history
+ * 
+ * @param history   History to be initialized
+ * @param restored  Ring previously stored (e.g. read from NVS), NULL to start empty
+ */
+void PostureHistoryInit(posture_history_t *history, const posture_history_ring_t *restored);
+
+/**
+ * @brief Adds a processed sample
+ * 
+ * @param history       Posture history
+ * @param state         Posture state after the sample
+ * @param angle_cdeg    Tilt angle (hundredths of degree)
+ * @param timestamp_us  Acquisition time of the sample (us)
+ * @return true     A minute was closed into the ring
+ */
+bool PostureHistoryAdd(posture_history_t *history, posture_state_t state, uint16_t angle_cdeg, int64_t timestamp_us);
+
+/**
+ * @brief Copies the closed minutes, oldest first
+ * 
+ * @param ring      Ring of a posture history (history.ring), or a copy of it
+ * @param entries   Destination (at least max entries)
+ * @param max       Maximum number of entries to copy (the newest are copied)
+ * @return uint16_t Number of entries copied
+ */
+uint16_t PostureHistoryRead(const posture_history_ring_t *ring, posture_minute_t *entries, uint16_t max);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POSTURE_HISTORY_H_ */
+
+/*==================[end of file]============================================*/
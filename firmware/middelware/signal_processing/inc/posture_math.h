@@ -0,0 +1,96 @@
+#ifndef POSTURE_MATH_H_
+#define POSTURE_MATH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Posture_Math Posture Math
+ ** @{ */
+
+/** \brief Tilt angle between an acceleration vector and a calibrated reference
+ * 
+ * The reference vector is normalized once, at calibration time, together with
+ * the cosine of the tilt threshold. Checking the threshold then takes a dot
+ * product and a comparison (no sqrtf, division or acosf), and the angle itself
+ * can be obtained in fixed point with an integer square root and CORDIC.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define POSTURE_Q15_ONE     32767   /*!< 1.0 in Q15 */
+/*==================[typedef]================================================*/
+/**
+ * @brief Calibrated reference (use PostureRefInit to fill it)
+ */
+typedef struct {
+    float ref[3];           /*!< Normalized reference vector */
+    int16_t ref_q15[3];     /*!< Normalized reference vector (Q15) */
+    float cos_umbral;       /*!< Cosine of the tilt threshold */
+    float cos2_umbral;      /*!< Squared cosine of the tilt threshold */
+    bool valid;             /*!< The reference vector is not null */
+} posture_ref_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Stores the normalized reference vector and the threshold cosine
+ * 
+ * @param ref           Reference to be initialized
+ * @param x             Reference acceleration in X (any unit)
+ * @param y             Reference acceleration in Y (same unit as x)
+ * @param z             Reference acceleration in Z (same unit as x)
+ * @param umbral_deg    Tilt threshold (degrees)
+ */
+void PostureRefInit(posture_ref_t *ref, float x, float y, float z, float umbral_deg);
+
+/**
+ * @brief Checks if the tilt exceeds the threshold (no sqrtf/acosf for thresholds up to 90°)
+ * 
+ * @param ref   Calibrated reference
+ * @param ax    Acceleration in X (same unit as the reference)
+ * @param ay    Acceleration in Y
+ * @param az    Acceleration in Z
+ * @return true     Tilt above threshold
+ * @return false    Tilt under threshold, null acceleration or no calibration
+ */
+bool PostureOverThreshold(const posture_ref_t *ref, float ax, float ay, float az);
+
+/**
+ * @brief Tilt angle in floating point (one sqrtf and one acosf)
+ * 
+ * @param ref   Calibrated reference
+ * @param ax    Acceleration in X (same unit as the reference)
+ * @param ay    Acceleration in Y
+ * @param az    Acceleration in Z
+ * @return float Tilt angle (degrees, 0 to 180)
+ */
+float PostureAngle(const posture_ref_t *ref, float ax, float ay, float az);
+
+/**
+ * @brief Tilt angle in fixed point (integer square root and CORDIC, no floating point)
+ * 
+ * @note Error under 0.05°.
+ * 
+ * @param ref   Calibrated reference
+ * @param ax    Acceleration in X (integer units, e.g. mili-g)
+ * @param ay    Acceleration in Y
+ * @param az    Acceleration in Z
+ * @return uint16_t Tilt angle (hundredths of degree, 0 to 18000)
+ */
+uint16_t PostureAngleFixed(const posture_ref_t *ref, int16_t ax, int16_t ay, int16_t az);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POSTURE_MATH_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,292 @@
+#ifndef POSTURE_PIPELINE_H_
+#define POSTURE_PIPELINE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Posture_Pipeline Posture Pipeline
+ ** @{ */
+
+/** \brief Posture detection from raw samples: filter, calibration, tilt and state machine
+ *
+ * The whole posture detection of one or more accelerometers, driven only by
+ * timestamped samples: no tasks, timers, peripherals or clocks. The same
+ * samples always give the same decisions, so recorded traces can be replayed
+ * on the board or on a PC (benchmarks/host) as fast as the CPU allows.
+ *
+ * For each sensor the raw samples are collected in blocks of
+ * POSTURE_PIPELINE_BLOCK and every axis goes through its filter chain
+ * (filter_chain), whose last stage decimates to output_frec. Each filtered
+ * sample then:
+ * 1. During calibration_ms (timed by the main sensor, index 0) feeds the
+ *    calibration (posture_fusion). Without a calibration the measured one is
+ *    used; with a restored calibration (PosturePipelineRestore) it is only
+ *    verified: if the user held still and the magnitude of a sensor drifted more
+ *    than max_drift, the sensor is recalibrated.
+ * 2. With a calibration, updates the tilt angle of its sensor.
+ * 3. On the main sensor, the fused tilt goes through the state machine
+ *    (posture_engine) and the sample is an output of the pipeline.
+ * 4. With refine_rate > 0, refines the reference of its sensor while the
+ *    posture is correct and the sensor has been still (running_stats) for
+ *    refine_hold_ms: each sample moves the reference refine_rate of the way
+ *    towards it, so a sensor that shifted on the body is followed without a
+ *    new calibration. The reference never moves more than refine_max_deg away
+ *    from the last measured or restored calibration. When the still period
+ *    ends the refined calibration is given as a result (refined = true).
+ * 5. With an activity_model, the main sensor samples and the fused tilt feed
+ *    the activity classifier (activity_classifier). While the user is reaching
+ *    or walking the tilt is not a held posture and it is reported as correct.
+ *    The state machine keeps timing: a movement that ends in a held bad
+ *    posture is reported, once still, with its whole duration.
+ *
+ * PosturePipelineSaveState keeps what can't be measured again in a few
+ * samples (the refined references, the last measured ones and the current bad
+ * posture period) in a small struct that survives a deep sleep in RTC memory;
+ * PosturePipelineRestoreState resumes from it without a verification period.
+ * The filters are not saved: they start in steady state from the first sample.
+ *
+ * @code
+ * n = PosturePipelineAdd(&pipeline, 0, x, y, z, timestamp_us, out);
+ * for(i = 0; i < n; i++){
+ *     Indicate(out[i].state);
+ * }
+ * if(PosturePipelineTakeCalibration(&pipeline, &cal)){
+ *     Store(&cal);
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Reference refined during still, correct posture periods				|
+ * | 15/10/2026 | Bad postures reported only while still (activity_classifier)			|
+ * | 15/10/2026 | Raw sample frequency of a sensor changed on the run					|
+ * | 15/10/2026 | State saved and restored across deep sleep							|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "filter_chain.h"
+#include "posture_fusion.h"
+#include "posture_engine.h"
+#include "running_stats.h"
+#include "activity_classifier.h"
+/*==================[macros]=================================================*/
+#define POSTURE_PIPELINE_BLOCK  8   /*!< Raw samples filtered at once (multiple of every decimation) */
+#define POSTURE_PIPELINE_MAIN   0   /*!< Main sensor: times the calibration and gives the outputs */
+#define POSTURE_PIPELINE_STILL_MS   1000    /*!< Time constant of the dispersion of the stillness detector */
+/*==================[typedef]================================================*/
+/**
+ * @brief Posture pipeline configuration
+ */
+typedef struct {
+    const filter_stage_config_t *stages;    /*!< Filter stages of every axis, the last one STAGE_DECIMATE (its factor is set for each sensor) */
+    uint8_t n_stages;                       /*!< Number of filter stages */
+    float output_frec;                      /*!< Sample frequency after the decimation (Hz) */
+    float threshold_deg;                    /*!< Tilt threshold of the references (see PostureRefInit) */
+    uint32_t calibration_ms;                /*!< Calibration time */
+    float max_dispersion;                   /*!< Largest dispersion of a still calibration (g RMS) */
+    float max_drift;                        /*!< Largest magnitude change against a restored calibration (g) */
+    posture_engine_config_t engine;         /*!< State machine configuration */
+    float refine_rate;                      /*!< Weight of each still sample in the reference (0: no refinement) */
+    uint32_t refine_hold_ms;                /*!< Still time before refining */
+    float refine_max_std;                   /*!< Largest dispersion of a still sensor (g RMS) */
+    float refine_max_tilt_deg;              /*!< Largest tilt of the samples that refine the reference */
+    float refine_max_deg;                   /*!< Largest move of the reference from the last calibration */
+    const activity_model_t *activity_model; /*!< Activity classifier model at output_frec (not copied), NULL: every tilt is timed */
+} posture_pipeline_config_t;
+
+/**
+ * @brief Calibration phase
+ */
+typedef enum {
+    POSTURE_CAL_MEASURING,      /*!< No reference: samples are averaged, no decisions */
+    POSTURE_CAL_VERIFYING,      /*!< Restored reference: decisions while the drift is measured */
+    POSTURE_CAL_DONE            /*!< Valid reference */
+} posture_cal_phase_t;
+
+/**
+ * @brief Calibration measured by the pipeline
+ */
+typedef struct {
+    posture_calibration_t sensor[POSTURE_FUSION_MAX];   /*!< Measured calibration of each sensor */
+    bool measured[POSTURE_FUSION_MAX];                  /*!< The sensor had samples (the others keep no calibration) */
+    float dispersion;                                   /*!< Largest dispersion (g RMS) */
+    float drift;                                        /*!< Largest drift that discarded a restored calibration (g), 0 if none */
+    bool still;                                         /*!< dispersion <= max_dispersion: worth storing */
+    bool refined;                                       /*!< Reference refined during a still period, not a new calibration */
+} posture_cal_result_t;
+
+/**
+ * @brief Filtered sample of the main sensor and decision
+ */
+typedef struct {
+    float x;                    /*!< Filtered acceleration in X (g) */
+    float y;                    /*!< Filtered acceleration in Y (g) */
+    float z;                    /*!< Filtered acceleration in Z (g) */
+    int64_t timestamp_us;       /*!< Acquisition time of the last raw sample of the group (us) */
+    uint16_t angle_cdeg;        /*!< Fused tilt (hundredths of degree), 0 without calibration */
+    posture_state_t state;      /*!< State after the sample (POSTURE_CORRECT without calibration or while moving) */
+    uint32_t bad_ms;            /*!< Duration of the current bad posture period (ms) */
+    activity_t activity;        /*!< Activity of the last window (ACTIVITY_STILL without classifier) */
+    bool calibrated;            /*!< The decision is valid (there is a calibration) */
+} posture_output_t;
+
+/**
+ * @brief Filters and raw block of one sensor
+ */
+typedef struct {
+    filter_chain_t filter[3];                       /*!< Filter chain of each axis */
+    float block[3][POSTURE_PIPELINE_BLOCK];         /*!< Raw samples of each axis (g) */
+    int64_t block_t[POSTURE_PIPELINE_BLOCK];        /*!< Acquisition time of each raw sample (us) */
+    uint8_t length;                                 /*!< Raw samples in the block */
+    stability_t stability;                          /*!< Stillness of the filtered samples */
+    posture_ref_t anchor;                           /*!< Last measured or restored calibration */
+    bool refined;                                   /*!< The reference was refined in the current still period */
+} posture_channel_t;
+
+/**
+ * @brief State to resume a pipeline (see PosturePipelineSaveState)
+ */
+typedef struct {
+    posture_calibration_t sensor[POSTURE_FUSION_MAX];   /*!< Current (refined) calibration of each sensor */
+    posture_ref_t anchor[POSTURE_FUSION_MAX];           /*!< Last measured or restored calibration of each sensor */
+    bool calibrated[POSTURE_FUSION_MAX];                /*!< The sensor has a calibration */
+    uint8_t count;                                      /*!< Number of sensors */
+    posture_cal_phase_t phase;                          /*!< Calibration phase */
+    uint32_t bad_ms;                                    /*!< Duration of the current bad posture period (ms) */
+} posture_pipeline_state_t;
+
+/**
+ * @brief Posture pipeline (use PosturePipelineInit to fill it)
+ */
+typedef struct {
+    posture_pipeline_config_t config;
+    posture_channel_t channel[POSTURE_FUSION_MAX];  /*!< Filters of each sensor */
+    uint8_t count;                                  /*!< Number of sensors */
+    posture_fusion_t fusion;                        /*!< Calibration and tilt of each sensor */
+    posture_engine_t engine;                        /*!< State machine */
+    activity_classifier_t activity;                 /*!< Activity of the user (with config.activity_model) */
+    posture_cal_phase_t phase;                      /*!< Calibration phase */
+    bool calibrated;                                /*!< Decisions are valid */
+    int64_t cal_start_us;                           /*!< First sample of the calibration in progress, -1 to start one */
+    posture_cal_result_t result;                    /*!< Last measured calibration */
+    bool new_result;                                /*!< result not taken yet */
+} posture_pipeline_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a pipeline without calibration
+ *
+ * @note The filter stages are copied, the configuration can be temporary.
+ *
+ * @param pipeline      Pipeline to be initialized
+ * @param config        Configuration
+ * @param sample_frec   Raw sample frequency of each sensor (multiple of output_frec)
+ * @param count         Number of sensors (up to POSTURE_FUSION_MAX)
+ * @return true     Pipeline initialized
+ * @return false    Invalid configuration
+ */
+bool PosturePipelineInit(posture_pipeline_t *pipeline, const posture_pipeline_config_t *config,
+                         const float *sample_frec, uint8_t count);
+
+/**
+ * @brief Uses a stored calibration right away and verifies it during the first calibration_ms
+ *
+ * @param pipeline      Pipeline
+ * @param cal           Calibration of each sensor
+ */
+void PosturePipelineRestore(posture_pipeline_t *pipeline, const posture_calibration_t *cal);
+
+/**
+ * @brief Saves the calibrations and the bad posture period (e.g. before a deep sleep)
+ *
+ * @param pipeline      Pipeline
+ * @param timestamp_us  Time of the last sample (us)
+ * @param state         Saved state
+ */
+void PosturePipelineSaveState(const posture_pipeline_t *pipeline, int64_t timestamp_us, posture_pipeline_state_t *state);
+
+/**
+ * @brief Resumes a pipeline from a saved state
+ *
+ * A calibration that was being verified is taken as valid (it was verified or
+ * refined before the sleep); one that was being measured starts again. The
+ * bad posture period goes on from the next sample (see PostureEngineResume).
+ *
+ * @param pipeline      Pipeline initialized with the same number of sensors
+ * @param state         Saved state
+ * @return true     Resumed
+ * @return false    The state belongs to another number of sensors (the pipeline is not changed)
+ */
+bool PosturePipelineRestoreState(posture_pipeline_t *pipeline, const posture_pipeline_state_t *state);
+
+/**
+ * @brief Discards the calibration and measures a new one (from the next sample)
+ *
+ * @param pipeline      Pipeline
+ */
+void PosturePipelineRecalibrate(posture_pipeline_t *pipeline);
+
+/**
+ * @brief Changes the raw sample frequency of a sensor (e.g. a low rate profile while still)
+ *
+ * The filters of the sensor are designed for the new frequency and start in
+ * steady state from its next raw sample; the raw samples of an incomplete block
+ * are dropped. The calibration, the tilt and the state machine go on.
+ *
+ * @param pipeline      Pipeline
+ * @param sensor        Sensor index
+ * @param sample_frec   New raw sample frequency (multiple of output_frec)
+ * @return true     Frequency changed
+ * @return false    Invalid sensor or frequency (the previous one is kept)
+ */
+bool PosturePipelineSetSampleFrec(posture_pipeline_t *pipeline, uint8_t sensor, float sample_frec);
+
+/**
+ * @brief Changes the state machine configuration keeping the current bad posture period
+ *
+ * @param pipeline      Pipeline
+ * @param config        State machine configuration
+ * @return true     Configuration applied
+ * @return false    Invalid configuration (see PostureEngineSetConfig)
+ */
+bool PosturePipelineSetConfig(posture_pipeline_t *pipeline, const posture_engine_config_t *config);
+
+/**
+ * @brief Adds a raw sample of a sensor
+ *
+ * @param pipeline      Pipeline
+ * @param sensor        Sensor index
+ * @param x             Acceleration in X (g)
+ * @param y             Acceleration in Y (g)
+ * @param z             Acceleration in Z (g)
+ * @param timestamp_us  Acquisition time (us)
+ * @param out           Outputs, room for POSTURE_PIPELINE_BLOCK (main sensor only)
+ * @return uint8_t      Number of outputs (0 until a block of the main sensor is complete)
+ */
+uint8_t PosturePipelineAdd(posture_pipeline_t *pipeline, uint8_t sensor, float x, float y, float z,
+                           int64_t timestamp_us, posture_output_t *out);
+
+/**
+ * @brief Takes the last measured calibration, once
+ *
+ * @note A restored calibration that passed its verification gives no result.
+ *
+ * @param pipeline      Pipeline
+ * @param result        Measured calibration
+ * @return true     There was a new calibration
+ */
+bool PosturePipelineTakeCalibration(posture_pipeline_t *pipeline, posture_cal_result_t *result);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* POSTURE_PIPELINE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,116 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS Detector
+ ** @{ */
+
+/** \brief Streaming QRS detector and heart rate estimator (Pan-Tompkins)
+ *
+ * Works on the band limited ECG (the HiPassFilter/LowPassFilter output),
+ * given in blocks of any length. Each sample goes through integer stages:
+ *  - derivative: 2x[n] + x[n-1] - x[n-3] - 2x[n-4]
+ *  - square
+ *  - moving window integration over 150 ms (running sum)
+ *
+ * and the peaks of the integrated signal are classified against adaptive
+ * thresholds that follow the signal (SPKI) and noise (NPKI) peak levels.
+ * When no QRS is found for 166% of the average RR interval, the highest
+ * peak over half the threshold since the last QRS is taken (search back).
+ * A refractory period of 200 ms skips T waves. The first 2 seconds are used
+ * to learn the initial levels.
+ *
+ * Work per sample is constant and nothing is buffered but the integration
+ * window. A QRS is reported some 100 ms after it happens (half the window
+ * plus the fall of the integrated peak); intervals are not affected.
+ *
+ * @code
+ * QrsDetectorInit(&qrs, SAMPLE_FREQ);
+ * ...
+ * if(QrsDetectorProcess(&qrs, ecg_filt, CHUNK) > 0){
+ *     bpm = QrsHeartRate(&qrs);
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define QRS_MAX_WINDOW      64      /*!< Maximum integration window (150 ms up to 426 Hz) */
+#define QRS_RR_AVERAGE      8       /*!< RR intervals averaged for the heart rate */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief QRS detector
+ */
+typedef struct {
+    uint16_t sample_frec;           /*!< Sample frequency */
+    uint16_t window;                /*!< Integration window (samples) */
+    uint16_t refractory;            /*!< Refractory period (samples) */
+    uint32_t learning;              /*!< Samples left of the learning period */
+    uint32_t count;                 /*!< Samples processed */
+    int32_t x[4];                   /*!< Last input samples, oldest first */
+    uint32_t square[QRS_MAX_WINDOW];/*!< Squared derivative over the window */
+    uint16_t pos;                   /*!< Oldest value in square */
+    uint32_t mwi;                   /*!< Moving window integral */
+    uint32_t mwi_max;               /*!< Highest integral of the current peak */
+    uint32_t mwi_max_at;            /*!< Sample of mwi_max */
+    uint32_t spki;                  /*!< Signal peak level */
+    uint32_t npki;                  /*!< Noise peak level */
+    uint32_t threshold;             /*!< Detection threshold */
+    uint32_t search_back;           /*!< Highest peak over threshold/2 since the last QRS */
+    uint32_t search_back_at;        /*!< Sample of search_back */
+    uint32_t last_qrs;              /*!< Sample of the last QRS */
+    bool qrs_found;                 /*!< A QRS was already found */
+    uint16_t rr[QRS_RR_AVERAGE];    /*!< Last RR intervals (samples) */
+    uint8_t rr_pos;                 /*!< Next position in rr */
+    uint8_t rr_count;               /*!< Intervals in rr */
+    uint32_t rr_sum;                /*!< Sum of the intervals in rr */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ *
+ * @param qrs           QRS detector to be initialized
+ * @param sample_frec   ECG sample frequency (up to 426 Hz)
+ * @return true     Detector initialized
+ * @return false    Sample frequency out of range
+ */
+bool QrsDetectorInit(qrs_detector_t *qrs, uint16_t sample_frec);
+
+/**
+ * @brief Process a block of ECG samples
+ *
+ * @param qrs       QRS detector
+ * @param ecg       Band limited ECG samples (ADC units or more resolution)
+ * @param length    Number of samples
+ * @return uint8_t  Number of QRS complexes found in the block
+ */
+uint8_t QrsDetectorProcess(qrs_detector_t *qrs, const float *ecg, int16_t length);
+
+/**
+ * @brief Heart rate from the average of the last RR intervals
+ *
+ * @param qrs           QRS detector
+ * @return uint16_t     Beats per minute (0 until two QRS complexes are found)
+ */
+uint16_t QrsHeartRate(const qrs_detector_t *qrs);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
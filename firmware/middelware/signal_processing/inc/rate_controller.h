@@ -0,0 +1,113 @@
+#ifndef RATE_CONTROLLER_H_
+#define RATE_CONTROLLER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Rate_Controller Rate Controller
+ ** @{ */
+
+/** \brief Sample rate level from the dispersion of the tilt and the posture state
+ *
+ * The application maps each level to a sample rate of its sensors (and to any
+ * other periodic work, e.g. a stream), level 0 the fastest. The controller
+ * follows the filtered samples of the posture pipeline:
+ * - A change of the posture state, a movement reported by the caller or a
+ *   tilt dispersion (exponentially weighted) of fast_std_deg or more go back
+ *   to level 0 at once.
+ * - With the dispersion under slow_std_deg during hold_ms, the level goes one
+ *   step slower; each step needs another hold_ms.
+ * - In between, the level is kept.
+ * Like the posture engine, it is driven only by the timestamps of the samples,
+ * so a replay gives the same levels.
+ *
+ * @code
+ * if(RateControllerAdd(&rc, angle_deg, state, moving, timestamp_us)){
+ *     SetSampleRate(rate[RateControllerLevel(&rc)]);
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "running_stats.h"
+#include "posture_engine.h"
+/*==================[macros]=================================================*/
+#define RATE_CONTROLLER_MAX_LEVELS  4   /*!< Maximum number of levels */
+/*==================[typedef]================================================*/
+/**
+ * @brief Rate controller configuration
+ */
+typedef struct {
+    uint8_t levels;         /*!< Number of levels (1 to RATE_CONTROLLER_MAX_LEVELS), 0 the fastest */
+    float alpha;            /*!< Weight of each sample in the tilt dispersion (about 1 / samples averaged) */
+    float fast_std_deg;     /*!< Tilt dispersion that goes back to level 0 */
+    float slow_std_deg;     /*!< Tilt dispersion under which the level goes slower (< fast_std_deg) */
+    uint32_t hold_ms;       /*!< Time under slow_std_deg before each slower level */
+} rate_controller_config_t;
+
+/**
+ * @brief Rate controller (use RateControllerInit to fill it)
+ */
+typedef struct {
+    rate_controller_config_t config;
+    ewma_stats_t tilt;              /*!< Weighted mean and variance of the tilt */
+    uint8_t level;                  /*!< Current level */
+    posture_state_t state;          /*!< State of the last sample */
+    int64_t calm_since_us;          /*!< Start of the time under slow_std_deg at this level, -1 if none */
+} rate_controller_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a rate controller at level 0
+ *
+ * @param rc        Rate controller
+ * @param config    Configuration
+ * @return true     Controller initialized
+ * @return false    Invalid configuration
+ */
+bool RateControllerInit(rate_controller_t *rc, const rate_controller_config_t *config);
+
+/**
+ * @brief Goes back to level 0 and forgets the tilt (e.g. after a recalibration)
+ *
+ * @param rc        Rate controller
+ */
+void RateControllerReset(rate_controller_t *rc);
+
+/**
+ * @brief Adds a filtered sample
+ *
+ * @param rc            Rate controller
+ * @param tilt_deg      Tilt of the sample (degrees)
+ * @param state         Posture state after the sample
+ * @param moving        The user is moving (e.g. not ACTIVITY_STILL): level 0
+ * @param timestamp_us  Acquisition time of the sample (us)
+ * @return true     The level changed
+ */
+bool RateControllerAdd(rate_controller_t *rc, float tilt_deg, posture_state_t state, bool moving,
+                       int64_t timestamp_us);
+
+/**
+ * @brief Current level
+ *
+ * @param rc        Rate controller
+ * @return uint8_t  Level, 0 the fastest
+ */
+uint8_t RateControllerLevel(const rate_controller_t *rc);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RATE_CONTROLLER_H_ */
+
+/*==================[end of file]============================================*/
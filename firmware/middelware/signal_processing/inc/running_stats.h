@@ -0,0 +1,137 @@
+#ifndef RUNNING_STATS_H_
+#define RUNNING_STATS_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Running_Stats Running Statistics
+ ** @{ */
+
+/** \brief Incremental statistics, one sample at a time
+ *
+ * - welford_t: mean and variance of every sample added (Welford's update).
+ *   Unlike sums of x and x², it does not lose precision in single precision
+ *   when the mean is large compared to the dispersion or after many samples.
+ * - ewma_stats_t: exponentially weighted mean and variance, following a
+ *   signal with a time constant of about 1 / alpha samples.
+ * - stability_t: detects a still 3-axis signal: the weighted dispersion of the
+ *   three axes stays under a limit during a number of samples.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Mean and variance of every sample (use WelfordInit to clear it)
+ */
+typedef struct {
+    uint32_t n;         /*!< Number of samples */
+    float mean;         /*!< Mean */
+    float m2;           /*!< Sum of squared differences from the mean */
+} welford_t;
+
+/**
+ * @brief Exponentially weighted mean and variance (use EwmaStatsInit to fill it)
+ */
+typedef struct {
+    float alpha;        /*!< Weight of each new sample (0 to 1) */
+    float mean;         /*!< Weighted mean */
+    float var;          /*!< Weighted variance */
+    bool started;       /*!< The first sample was added */
+} ewma_stats_t;
+
+/**
+ * @brief Stillness detector of a 3-axis signal (use StabilityInit to fill it)
+ */
+typedef struct {
+    ewma_stats_t axis[3];   /*!< Weighted statistics of each axis */
+    float max_var;          /*!< Largest total variance of a still signal */
+    uint32_t hold;          /*!< Still samples needed */
+    uint32_t count;         /*!< Consecutive still samples */
+} stability_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Clears the statistics
+ *
+ * @param w     Statistics
+ */
+void WelfordInit(welford_t *w);
+
+/**
+ * @brief Adds a sample
+ *
+ * @param w     Statistics
+ * @param x     Sample
+ */
+void WelfordAdd(welford_t *w, float x);
+
+/**
+ * @brief Population variance of the samples added
+ *
+ * @param w     Statistics
+ * @return float Variance, 0 without samples
+ */
+float WelfordVariance(const welford_t *w);
+
+/**
+ * @brief Initializes weighted statistics
+ *
+ * @param s         Statistics
+ * @param alpha     Weight of each new sample (0 to 1), about 1 / number of samples averaged
+ */
+void EwmaStatsInit(ewma_stats_t *s, float alpha);
+
+/**
+ * @brief Adds a sample (the first one sets the mean)
+ *
+ * @param s     Statistics
+ * @param x     Sample
+ */
+void EwmaStatsAdd(ewma_stats_t *s, float x);
+
+/**
+ * @brief Initializes a stillness detector
+ *
+ * @param s         Detector
+ * @param alpha     Weight of each sample in the dispersion of each axis
+ * @param max_std   Largest total dispersion of the three axes of a still signal
+ * @param hold      Consecutive still samples needed
+ */
+void StabilityInit(stability_t *s, float alpha, float max_std, uint32_t hold);
+
+/**
+ * @brief Forgets the signal: it has to be still during hold samples again
+ *
+ * @param s     Detector
+ */
+void StabilityReset(stability_t *s);
+
+/**
+ * @brief Adds a sample
+ *
+ * @param s     Detector
+ * @param x     Sample of the first axis
+ * @param y     Sample of the second axis
+ * @param z     Sample of the third axis
+ * @return true     The signal has been still during the last hold samples
+ */
+bool StabilityAdd(stability_t *s, float x, float y, float z);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RUNNING_STATS_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,109 @@
+#ifndef SAMPLE_CONVERT_H_
+#define SAMPLE_CONVERT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sample_Convert Sample Convert
+ ** @{ */
+
+/** \brief Block conversion between integer samples and float, with offset and scale
+ *
+ * The boundaries between acquisition (ADC codes or mV, Q15, 32-bit counts of
+ * optical sensors) and the float processing, and back to the integer formats
+ * that are stored, sent or played (mg, DAC codes), converted a block at a
+ * time:
+ * - To float:   out = (in - offset) * scale
+ * - From float: out = in * scale + offset, rounded to the nearest integer and
+ *   saturated to the range of the output
+ *
+ * Each call is a single loop unrolled by 4 with the offset and the scale fused,
+ * instead of a function call and a division per sample. Input and output may
+ * not overlap.
+ *
+ * @code
+ * SampleConvertU16ToF32(mv, g, n, ZERO_G_MV, 1.0f / MV_PER_G);
+ * SampleConvertF32ToI16(g, mg, n, 0.0f, 1000.0f);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Unsigned 16-bit samples (e.g. 12-bit ADC codes or mV) to float
+ *
+ * @param in        Input samples
+ * @param out       Output, (in - offset) * scale
+ * @param len       Number of samples
+ * @param offset    Offset, in input units
+ * @param scale     Scale
+ */
+void SampleConvertU16ToF32(const uint16_t *in, float *out, uint16_t len, float offset, float scale);
+
+/**
+ * @brief Signed 16-bit samples (e.g. Q15 or mg) to float
+ *
+ * @param in        Input samples
+ * @param out       Output, (in - offset) * scale
+ * @param len       Number of samples
+ * @param offset    Offset, in input units
+ * @param scale     Scale
+ */
+void SampleConvertI16ToF32(const int16_t *in, float *out, uint16_t len, float offset, float scale);
+
+/**
+ * @brief Unsigned 32-bit samples (e.g. counts of an optical sensor) to float
+ *
+ * @note Counts over 2^24 lose their lowest bits in the float.
+ *
+ * @param in        Input samples
+ * @param out       Output, (in - offset) * scale
+ * @param len       Number of samples
+ * @param offset    Offset, in input units
+ * @param scale     Scale
+ */
+void SampleConvertU32ToF32(const uint32_t *in, float *out, uint16_t len, float offset, float scale);
+
+/**
+ * @brief Float to signed 16-bit samples, rounded and saturated to INT16_MIN..INT16_MAX
+ *
+ * @param in        Input samples
+ * @param out       Output, in * scale + offset
+ * @param len       Number of samples
+ * @param offset    Offset, in output units
+ * @param scale     Scale
+ */
+void SampleConvertF32ToI16(const float *in, int16_t *out, uint16_t len, float offset, float scale);
+
+/**
+ * @brief Float to unsigned 16-bit samples (e.g. DAC codes), rounded and saturated to 0..max
+ *
+ * @param in        Input samples
+ * @param out       Output, in * scale + offset
+ * @param len       Number of samples
+ * @param offset    Offset, in output units
+ * @param scale     Scale
+ * @param max       Largest output (e.g. 4095 for 12 bits)
+ */
+void SampleConvertF32ToU16(const float *in, uint16_t *out, uint16_t len, float offset, float scale, uint16_t max);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SAMPLE_CONVERT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,176 @@
+#ifndef SIGNAL_PIPELINE_H_
+#define SIGNAL_PIPELINE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Signal_Pipeline Signal Pipeline
+ ** @{ */
+
+/** \brief Block processing pipeline of filter, FFT and feature stages
+ *
+ * The stages are declared once, as an array of pipeline_stage_config_t, and
+ * their states and working buffers are carved out of a single arena given
+ * by the caller (PipelineArenaSize tells how big it must be).
+ *
+ * A block goes through the whole pipeline without copies: the first stage
+ * reads the caller's samples and writes the working buffer, and the
+ * following ones run in place on it. Only stages that can't run in place
+ * (band energy and functions declared so) write to a second buffer, and the
+ * two are ping-ponged; it is only reserved when one of those stages is not
+ * the first. Adding stages thus adds their state, never a full size array.
+ *
+ * With max_length 0 the arena only holds the stage states, and the buffers
+ * are borrowed from dsp_scratch on each block, sized by that block. The
+ * output is then in the scratch arena, so PipelineProcess() must run inside
+ * a DspScratchMark() / DspScratchRelease() scope that also covers the use of
+ * the output.
+ *
+ * Example (ECG spectrum):
+ * @code
+ * static const pipeline_stage_config_t stages[] = {
+ *     {.type = PIPE_HI_PASS, .cut_frec = 1, .order = ORDER_2},
+ *     {.type = PIPE_LOW_PASS, .cut_frec = 30, .order = ORDER_4},
+ *     {.type = PIPE_FFT_MAGNITUDE},
+ * };
+ * static uint8_t arena[2048] __attribute__((aligned(16)));
+ * PipelineInit(&pipe, arena, sizeof(arena), SAMPLE_FREQ, 256, stages, 3);
+ * n = PipelineProcess(&pipe, ecg, 256, &spectrum);    // 128 bins
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Working buffers from dsp_scratch (max_length 0)                       |
+ * | 15/10/2026 | Notch filter stage                                                    |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "iir_filter.h"
+#include "band_energy.h"
+/*==================[macros]=================================================*/
+#define PIPELINE_MAX_STAGES     8   /*!< Maximum number of stages of a pipeline */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Custom stage function
+ *
+ * @param ctx       Context given in the stage configuration
+ * @param input     Input samples
+ * @param output    Output samples (the input array when the stage is in_place)
+ * @param length    Number of input samples
+ * @return int16_t  Number of output samples (up to length)
+ */
+typedef int16_t (*pipeline_func)(void *ctx, const float *input, float *output, int16_t length);
+
+/**
+ * @brief Pipeline stage types
+ */
+typedef enum pipeline_stage_type {
+    PIPE_LOW_PASS,          /*!< Butterworth low pass filter (iir_filter) */
+    PIPE_HI_PASS,           /*!< Butterworth hi pass filter (iir_filter) */
+    PIPE_NOTCH,             /*!< 2nd order notch filter at cut_frec (iir_filter) */
+    PIPE_FIR,               /*!< FIR filter (fir_filter) */
+    PIPE_DECIMATE,          /*!< FIR filter and decimation, only the kept samples are computed (fir_filter) */
+    PIPE_FFT_MAGNITUDE,     /*!< FFT magnitude (fft), length / 2 bins out of length samples */
+    PIPE_BAND_ENERGY,       /*!< Average of the FFT magnitude in bands (band_energy), n_bands values out */
+    PIPE_FUNC               /*!< Custom function (feature extraction, thresholds...) */
+} pipeline_stage_type_t;
+
+/**
+ * @brief Pipeline stage configuration
+ */
+typedef struct {
+    pipeline_stage_type_t type; /*!< Stage type */
+    float cut_frec;             /*!< Cut-off frequency (PIPE_LOW_PASS and PIPE_HI_PASS), rejected frequency (PIPE_NOTCH) */
+    filter_order_t order;       /*!< Filter order (PIPE_LOW_PASS and PIPE_HI_PASS) */
+    float q;                    /*!< Quality factor (PIPE_NOTCH) */
+    const float *coeff;         /*!< Coefficients, oldest sample first (PIPE_FIR and PIPE_DECIMATE) */
+    uint16_t n_taps;            /*!< Number of coefficients (PIPE_FIR and PIPE_DECIMATE) */
+    uint8_t factor;             /*!< Decimation factor (PIPE_DECIMATE) */
+    const band_map_t *map;      /*!< Band map (PIPE_BAND_ENERGY) */
+    pipeline_func func_p;       /*!< Function (PIPE_FUNC) */
+    void *ctx;                  /*!< Function context (PIPE_FUNC) */
+    bool in_place;              /*!< The function can write over its input (PIPE_FUNC) */
+} pipeline_stage_config_t;
+
+/**
+ * @brief Pipeline stage
+ */
+typedef struct {
+    const pipeline_stage_config_t *config;  /*!< Stage configuration */
+    void *state;                            /*!< Stage state, in the arena (filters only) */
+    bool in_place;                          /*!< The stage can write over its input */
+} pipeline_stage_t;
+
+/**
+ * @brief Pipeline
+ */
+typedef struct {
+    pipeline_stage_t stage[PIPELINE_MAX_STAGES];    /*!< Stages, in processing order */
+    uint8_t n_stages;                               /*!< Number of stages */
+    int16_t max_length;                             /*!< Maximum number of samples of a block (0: buffers from dsp_scratch) */
+    bool ping_pong;                                 /*!< A second working buffer is needed */
+    float *buffer[2];                               /*!< Working buffers, in the arena (buffer[1] may be NULL) */
+    float output_frec;                              /*!< Sample frequency after the last decimation */
+} pipeline_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Arena size needed by a pipeline
+ *
+ * @param stages        Stages configuration, in processing order
+ * @param n_stages      Number of stages (up to PIPELINE_MAX_STAGES)
+ * @param max_length    Maximum number of samples of a block (0: buffers from dsp_scratch)
+ * @return size_t       Arena size in bytes
+ */
+size_t PipelineArenaSize(const pipeline_stage_config_t *stages, uint8_t n_stages, int16_t max_length);
+
+/**
+ * @brief Initialize a pipeline
+ *
+ * @note The stages configuration is not copied: it must outlive the pipeline.
+ * FFT stages need FFTInit() to be called before PipelineProcess().
+ *
+ * @param pipeline      Pipeline to be initialized
+ * @param arena         Memory for the stage states and buffers, 16 byte aligned
+ * @param arena_size    Arena size in bytes (at least PipelineArenaSize())
+ * @param sample_frec   Input signal's sample frequency
+ * @param max_length    Maximum number of samples of a block (0: buffers from dsp_scratch)
+ * @param stages        Stages configuration, in processing order
+ * @param n_stages      Number of stages (up to PIPELINE_MAX_STAGES)
+ * @return true     Pipeline initialized
+ * @return false    Invalid configuration, stage not built (see Kconfig) or arena too small
+ */
+bool PipelineInit(pipeline_t *pipeline, void *arena, size_t arena_size, float sample_frec, int16_t max_length,
+                  const pipeline_stage_config_t *stages, uint8_t n_stages);
+
+/**
+ * @brief Process a block of samples through every stage
+ *
+ * @note Filter states are kept between calls, so a signal can be processed in
+ * consecutive blocks. Use blocks multiple of the decimation factors to get
+ * the same number of output samples on each call.
+ *
+ * @param pipeline      Pipeline
+ * @param input         Input samples (not modified)
+ * @param length        Number of input samples (up to max_length, if not 0)
+ * @param output        Set to the output samples (a pipeline buffer, valid until the next call,
+ *                      or until the scratch scope is released)
+ * @return int16_t      Number of output samples (0 if the scratch arena is too small)
+ */
+int16_t PipelineProcess(pipeline_t *pipeline, const float *input, int16_t length, const float **output);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SIGNAL_PIPELINE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,148 @@
+#ifndef SLIDING_WINDOW_H_
+#define SLIDING_WINDOW_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sliding_Window Sliding Window
+ ** @{ */
+
+/** \brief Minimum, maximum and median of the last samples of a signal
+ *
+ * - sliding_minmax_t: minimum and maximum of the last "window" samples, with
+ *   two monotonic deques: each sample enters and leaves each deque once, so a
+ *   sample costs O(1) on average whatever the window.
+ * - sliding_median_t: median of the last "window" samples, with a max-heap of
+ *   the samples under the median and a min-heap of those above it, both over
+ *   a ring of the samples: the sample that leaves the window is replaced in
+ *   place, O(log window) per sample instead of sorting the window.
+ *
+ * Until the window is full, the results are those of the samples available.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define SLIDING_MINMAX_MAX_WINDOW   128 /*!< Maximum window of a sliding_minmax_t */
+#define SLIDING_MEDIAN_MAX_WINDOW   15  /*!< Maximum window of a sliding_median_t */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Deque of ring positions, values in monotonic order
+ */
+typedef struct {
+    uint8_t slot[SLIDING_MINMAX_MAX_WINDOW];    /*!< Ring positions, oldest first */
+    uint8_t head;                               /*!< Index of the oldest position */
+    uint8_t count;                              /*!< Positions in the deque */
+} sliding_deque_t;
+
+/**
+ * @brief Sliding minimum and maximum (use SlidingMinMaxInit to fill it)
+ */
+typedef struct {
+    float value[SLIDING_MINMAX_MAX_WINDOW];     /*!< Last samples (ring) */
+    sliding_deque_t min;                        /*!< Candidates to minimum, increasing values */
+    sliding_deque_t max;                        /*!< Candidates to maximum, decreasing values */
+    uint8_t window;                             /*!< Window length */
+    uint8_t pos;                                /*!< Ring position of the next sample */
+    uint8_t count;                              /*!< Samples in the window */
+} sliding_minmax_t;
+
+/**
+ * @brief Sliding median (use SlidingMedianInit to fill it)
+ */
+typedef struct {
+    float value[SLIDING_MEDIAN_MAX_WINDOW];     /*!< Last samples (ring) */
+    int8_t heap_pos[SLIDING_MEDIAN_MAX_WINDOW]; /*!< Heap position of each sample: 0 median, < 0 max-heap, > 0 min-heap */
+    uint8_t heap[SLIDING_MEDIAN_MAX_WINDOW];    /*!< Ring position at each heap position (offset by window / 2) */
+    uint8_t window;                             /*!< Window length */
+    uint8_t pos;                                /*!< Ring position of the next sample */
+    uint8_t min_count;                          /*!< Samples in the min-heap */
+    uint8_t max_count;                          /*!< Samples in the max-heap */
+} sliding_median_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initializes a sliding minimum and maximum
+ *
+ * @param s         Sliding minimum and maximum
+ * @param window    Window length (1 to SLIDING_MINMAX_MAX_WINDOW)
+ * @return true     Initialized
+ * @return false    Invalid window
+ */
+bool SlidingMinMaxInit(sliding_minmax_t *s, uint8_t window);
+
+/**
+ * @brief Adds a sample (the oldest one leaves the window)
+ *
+ * @param s     Sliding minimum and maximum
+ * @param x     Sample
+ */
+void SlidingMinMaxAdd(sliding_minmax_t *s, float x);
+
+/**
+ * @brief Minimum of the samples in the window
+ *
+ * @param s     Sliding minimum and maximum (at least one sample added)
+ * @return float Minimum
+ */
+float SlidingMin(const sliding_minmax_t *s);
+
+/**
+ * @brief Maximum of the samples in the window
+ *
+ * @param s     Sliding minimum and maximum (at least one sample added)
+ * @return float Maximum
+ */
+float SlidingMax(const sliding_minmax_t *s);
+
+/**
+ * @brief Initializes a sliding median
+ *
+ * @param s         Sliding median
+ * @param window    Window length (1 to SLIDING_MEDIAN_MAX_WINDOW, odd for a centered median)
+ * @return true     Initialized
+ * @return false    Invalid window
+ */
+bool SlidingMedianInit(sliding_median_t *s, uint8_t window);
+
+/**
+ * @brief Fills the window with a value, as if it had been the signal for a whole window
+ *
+ * @param s     Sliding median
+ * @param x     Value
+ */
+void SlidingMedianFill(sliding_median_t *s, float x);
+
+/**
+ * @brief Adds a sample (the oldest one leaves the window)
+ *
+ * @param s     Sliding median
+ * @param x     Sample
+ * @return float Median of the window (the upper one of the two middle samples of an even count)
+ */
+float SlidingMedianAdd(sliding_median_t *s, float x);
+
+/**
+ * @brief Median of the samples in the window
+ *
+ * @param s     Sliding median (at least one sample added)
+ * @return float Median
+ */
+float SlidingMedian(const sliding_median_t *s);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SLIDING_WINDOW_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,103 @@
+#ifndef SPECTRAL_FEATURES_H_
+#define SPECTRAL_FEATURES_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Spectral_Features Spectral Features
+ ** @{ */
+
+/** \brief Features of an FFT magnitude spectrum
+ *
+ * Summarizes the output of FFTMagnitude in a few values, to be sent or
+ * stored instead of the whole spectrum:
+ * - dominant frequency, refined between bins by parabolic interpolation
+ * - spectral centroid (magnitude weighted mean frequency)
+ * - SNR: power of the dominant peak (its bin and SPECTRAL_PEAK_BINS at each
+ *   side, the Hann main lobe) against the power of the other bins, as
+ *   dsps_snr_f32 measures it but without a second FFT
+ * - power in user defined frequency bands
+ *
+ * The DC bin is left out of every feature. Powers are sums of squared
+ * magnitudes, in the squared units of the signal.
+ *
+ * @code
+ * static const float edges[] = {0.5, 5, 15, 40};     // 3 bands
+ * SpectralInit(&spectral, SAMPLE_FREQ, 256, edges, 3);
+ * FFTMagnitude(signal, fft, 256);
+ * SpectralFeatures(&spectral, fft, &features);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define SPECTRAL_MAX_BANDS      8       /*!< Maximum number of power bands */
+#define SPECTRAL_PEAK_BINS      2       /*!< Bins at each side of the dominant one counted as signal for the SNR */
+#define SPECTRAL_MAX_SNR        192     /*!< SNR given for a spectrum without noise (dB) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Spectral features configuration
+ */
+typedef struct {
+    float bin_width;                            /*!< Hz per bin */
+    uint16_t n_bins;                            /*!< Bins of the spectrum (signal_lenght / 2) */
+    uint8_t n_bands;                            /*!< Number of power bands */
+    uint16_t band_bin[SPECTRAL_MAX_BANDS + 1];  /*!< Band b covers bins band_bin[b] to band_bin[b+1] - 1 */
+} spectral_config_t;
+
+/**
+ * @brief Spectral features
+ */
+typedef struct {
+    float dominant_freq;                /*!< Frequency of the highest peak (Hz) */
+    float dominant_mag;                 /*!< Interpolated magnitude of the highest peak */
+    float centroid;                     /*!< Spectral centroid (Hz) */
+    float snr;                          /*!< Dominant peak to rest of the spectrum power ratio (dB) */
+    float total_power;                  /*!< Power of the whole spectrum but DC */
+    float band_power[SPECTRAL_MAX_BANDS];   /*!< Power in each band */
+} spectral_features_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a spectral features configuration
+ *
+ * @note Band edges are rounded to the nearest bin, and each band is at least
+ * one bin wide.
+ *
+ * @param config        Configuration to be initialized
+ * @param sample_freq   Sample frequency of the signal
+ * @param signal_lenght Lenght of the signal used to compute the spectrum
+ * @param band_edges    Band edges in Hz, increasing (of lenght = n_bands + 1, NULL if n_bands is 0)
+ * @param n_bands       Number of bands (up to SPECTRAL_MAX_BANDS)
+ * @return true     Configuration initialized
+ * @return false    Invalid configuration
+ */
+bool SpectralInit(spectral_config_t *config, float sample_freq, uint16_t signal_lenght,
+                  const float *band_edges, uint8_t n_bands);
+
+/**
+ * @brief Compute the features of a spectrum
+ *
+ * @param config    Configuration
+ * @param fft       FFT magnitude (from FFTMagnitude, of lenght = signal_lenght / 2)
+ * @param features  Features
+ */
+void SpectralFeatures(const spectral_config_t *config, const float *fft, spectral_features_t *features);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SPECTRAL_FEATURES_H_ */
+
+/*==================[end of file]============================================*/
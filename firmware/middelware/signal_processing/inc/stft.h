@@ -0,0 +1,144 @@
+#ifndef STFT_H_
+#define STFT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup STFT Short-Time Fourier Transform
+ ** @{ */
+
+/** \brief Streaming STFT with overlapped frames, on top of FFTMagnitude
+ *
+ * Samples are pushed one at a time (or in blocks) into a ring that keeps the
+ * last frames. Every "hop" samples a new overlapped frame is ready; StftProcess
+ * computes its windowed spectrum and passes it to the subscribed callbacks.
+ *
+ * StftPush* and StftProcess may run in different contexts (e.g. a timer ISR
+ * and a task), with a single producer and a single consumer. The consumer has
+ * frame_lenght samples of time to process each frame; if it falls behind, the
+ * oldest frames are skipped and only the latest one is processed.
+ *
+ * @note FFTInit must be called before StftProcess. The window is the one
+ * selected with FFTSetWindow (Hann by default, constant overlap-add for 50%
+ * and 75% overlap).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define STFT_MAX_FRAME          1024    /*!< Maximum frame lenght (power of two) */
+#define STFT_MAX_SUBSCRIBERS    4       /*!< Maximum number of callbacks per STFT */
+/*==================[typedef]================================================*/
+/**
+ * @brief Overlap between consecutive frames
+ */
+typedef enum stft_overlap {
+    STFT_OVERLAP_50 = 2,    /*!< 50% overlap: hop = frame_lenght / 2 */
+    STFT_OVERLAP_75 = 4     /*!< 75% overlap: hop = frame_lenght / 4 */
+} stft_overlap_t;
+
+/**
+ * @brief Function called with the spectrum of each frame
+ *
+ * @param spectrum  FFT magnitude of the frame (of lenght n_bins), valid only during the call
+ * @param n_bins    Number of bins (frame_lenght / 2)
+ * @param param     Parameter given to StftSubscribe
+ */
+typedef void (*stft_callback_t)(const float *spectrum, uint16_t n_bins, void *param);
+
+/**
+ * @brief STFT state (one per signal)
+ */
+typedef struct {
+    uint16_t frame_lenght;                          /*!< Frame lenght (power of two) */
+    uint16_t hop;                                   /*!< Samples between consecutive frames */
+    uint32_t mask;                                  /*!< Ring lenght - 1 (ring of 2 * frame_lenght samples) */
+    float ring[2 * STFT_MAX_FRAME];                 /*!< Last samples */
+    float frame[STFT_MAX_FRAME];                    /*!< Frame being processed (in order) */
+    float spectrum[STFT_MAX_FRAME / 2];             /*!< Spectrum of the last processed frame */
+    volatile uint32_t written;                      /*!< Samples pushed (only modified by the producer) */
+    volatile uint32_t frames;                       /*!< Frames completed (only modified by the producer) */
+    int32_t hop_count;                              /*!< Samples since the last frame (producer) */
+    uint32_t processed;                             /*!< Frames consumed (only modified by the consumer) */
+    uint32_t skipped;                               /*!< Frames lost because the consumer fell behind */
+    stft_callback_t func_p[STFT_MAX_SUBSCRIBERS];   /*!< Subscribed callbacks */
+    void *param_p[STFT_MAX_SUBSCRIBERS];            /*!< Callbacks parameters */
+    uint8_t n_subscribers;                          /*!< Number of subscribed callbacks */
+} stft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a STFT
+ *
+ * @param stft          STFT to be initialized
+ * @param frame_lenght  Frame lenght (power of two, up to STFT_MAX_FRAME)
+ * @param overlap       Overlap between consecutive frames
+ * @return true     STFT initialized
+ * @return false    Invalid configuration
+ */
+bool StftInit(stft_t *stft, uint16_t frame_lenght, stft_overlap_t overlap);
+
+/**
+ * @brief Subscribe a function to the spectrum of each frame
+ *
+ * @param stft      STFT
+ * @param func_p    Function called from StftProcess
+ * @param param_p   Parameter passed to the function
+ * @return true     Function subscribed
+ * @return false    No free subscriber slots
+ */
+bool StftSubscribe(stft_t *stft, stft_callback_t func_p, void *param_p);
+
+/**
+ * @brief Push one sample (producer side, ISR safe)
+ *
+ * @param stft      STFT
+ * @param sample    New sample
+ * @return true     A new frame is ready to be processed
+ * @return false    No new frame
+ */
+bool StftPushSample(stft_t *stft, float sample);
+
+/**
+ * @brief Push a block of samples (producer side)
+ *
+ * @param stft      STFT
+ * @param samples   New samples
+ * @param length    Number of samples
+ * @return uint16_t Number of new frames ready to be processed
+ */
+uint16_t StftPushBlock(stft_t *stft, const float *samples, uint16_t length);
+
+/**
+ * @brief Compute the spectrum of the latest ready frame and call the subscribers
+ * (consumer side, task context)
+ *
+ * @param stft      STFT
+ * @return true     A frame was processed
+ * @return false    No frame ready
+ */
+bool StftProcess(stft_t *stft);
+
+/**
+ * @brief Number of frames skipped since initialization because StftProcess fell behind
+ *
+ * @param stft      STFT
+ * @return uint32_t Frames skipped
+ */
+uint32_t StftSkipped(stft_t *stft);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STFT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,151 @@
+#ifndef TEMPLATE_MATCH_H_
+#define TEMPLATE_MATCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Template_Match Template Match
+ ** @{ */
+
+/** \brief Streaming normalised cross-correlation (template matching)
+ *
+ * Slides a template (a QRS complex, an accelerometer gesture...) over a
+ * signal given in blocks of any length, and gives for each new sample the
+ * normalised cross-correlation (Pearson coefficient, -1 to 1) between the
+ * template and the last template length samples. It is insensitive to the
+ * offset and the gain of the signal, so one threshold works for every
+ * subject and electrode placement.
+ *
+ * The correlation is computed by overlap-save: the samples are gathered in
+ * frames of an N point FFT (N the power of two that fits the template and
+ * the requested block), each frame keeps the last length-1 samples of the
+ * previous one and gives N-length+1 outputs with one forward and one inverse
+ * FFT, against the template spectrum computed at init. The cost per output
+ * is thus bounded and independent of the template length. The FFT work
+ * buffer (8*N bytes) is borrowed from dsp_scratch.
+ *
+ * The outputs of a frame are given when it is complete, so they come in
+ * groups of TemplateMatchBlock() samples, with up to that delay.
+ * TemplateDetect() turns them into events (peaks over a threshold, with a
+ * refractory period) and the interval between the last two.
+ *
+ * Example (heart rate):
+ * @code
+ * TemplateMatchInit(&qrs, qrs_template, 20, CHUNK);
+ * TemplateDetectorInit(&detector, 0.7, SAMPLE_FREQ / 4);
+ * n = TemplateMatchProcess(&qrs, ecg_filt, CHUNK, ncc);
+ * if(TemplateDetect(&detector, ncc, n) > 0 && detector.interval > 0){
+ *     bpm = 60 * SAMPLE_FREQ / detector.interval;
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TEMPLATE_MAX_LENGTH     64      /*!< Maximum number of samples of a template */
+#define TEMPLATE_MAX_FFT        256     /*!< Maximum FFT length (template length + block - 1, rounded up to a power of two) */
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Streaming template matcher
+ */
+typedef struct {
+    uint16_t length;                                    /*!< Template length */
+    uint16_t fft_length;                                /*!< FFT length N */
+    uint16_t block;                                     /*!< New samples per frame (N - length + 1) */
+    uint16_t fill;                                      /*!< New samples in the current frame */
+    float spectrum[2 * TEMPLATE_MAX_FFT] __attribute__((aligned(16)));    /*!< Conjugate spectrum of the normalised template, divided by N */
+    float frame[TEMPLATE_MAX_FFT];                      /*!< Last length-1 samples of the previous frame and the new ones */
+} template_match_t;
+
+/**
+ * @brief Template match event detector
+ */
+typedef struct {
+    float threshold;        /*!< Correlation over which a peak is an event */
+    uint32_t refractory;    /*!< Samples after an event in which peaks are ignored */
+    uint32_t since_event;   /*!< Samples since the last event */
+    uint32_t interval;      /*!< Samples between the last two events (0: less than two events yet) */
+    float peak;             /*!< Highest correlation of the current peak */
+    uint32_t peak_at;       /*!< Value of since_event at the highest correlation */
+    bool in_peak;           /*!< Correlation over the threshold */
+    bool first;             /*!< An event was already found */
+} template_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a template matcher
+ *
+ * @note It initializes the radix-2 FFT tables if FFTInit() wasn't called.
+ *
+ * @param tm        Template matcher to be initialized
+ * @param templ     Template samples, oldest first (copied)
+ * @param length    Template length (2 to TEMPLATE_MAX_LENGTH)
+ * @param block     Minimum number of new samples per frame (the actual one is TemplateMatchBlock())
+ * @return true     Template matcher initialized
+ * @return false    Invalid length, flat template, FFT too long or not possible to initialize the FFT
+ */
+bool TemplateMatchInit(template_match_t *tm, const float *templ, uint16_t length, uint16_t block);
+
+/**
+ * @brief Number of new samples per frame: the outputs come in groups of this size
+ *
+ * @param tm            Template matcher
+ * @return uint16_t     Samples
+ */
+uint16_t TemplateMatchBlock(const template_match_t *tm);
+
+/**
+ * @brief Correlate a block of samples with the template
+ *
+ * @note The output for a sample is the correlation of the template with the
+ * window that ends at that sample. Until length-1 samples have been given the
+ * window includes zeros from init.
+ *
+ * @param tm        Template matcher
+ * @param input     Input samples
+ * @param length    Number of input samples
+ * @param ncc       Normalised cross-correlation, room for length + TemplateMatchBlock() - 1 values
+ * @return int16_t  Number of values written to ncc (a multiple of TemplateMatchBlock(),
+ *                  0 if the scratch arena is too small)
+ */
+int16_t TemplateMatchProcess(template_match_t *tm, const float *input, int16_t length, float *ncc);
+
+/**
+ * @brief Initialize an event detector
+ *
+ * @param detector      Detector to be initialized
+ * @param threshold     Correlation over which a peak is an event (0 to 1)
+ * @param refractory    Samples after an event in which peaks are ignored
+ */
+void TemplateDetectorInit(template_detector_t *detector, float threshold, uint32_t refractory);
+
+/**
+ * @brief Find events in the output of TemplateMatchProcess()
+ *
+ * @note An event is the highest correlation of a peak over the threshold, and
+ * it is reported when the correlation falls below it again.
+ *
+ * @param detector      Detector
+ * @param ncc           Normalised cross-correlation
+ * @param length        Number of values
+ * @return uint8_t      Number of events found (interval is updated on each one)
+ */
+uint8_t TemplateDetect(template_detector_t *detector, const float *ncc, int16_t length);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TEMPLATE_MATCH_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,113 @@
+#ifndef WELCH_H_
+#define WELCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Welch Welch power spectrum
+ ** @{ */
+
+/** \brief Streaming power spectrum estimate (Welch), on top of the STFT
+ *
+ * The spectrum of a single frame is noisy. A Welch estimator subscribes to a
+ * STFT (overlapped, windowed segments) and averages the power (squared
+ * magnitude) of every bin over the last segments, updating the average with
+ * each new segment: O(bins) per segment, no segments stored.
+ *
+ * - Until depth segments have been averaged, every segment has the same weight
+ *   (plain mean of the segments so far).
+ * - From then on, each new segment has weight 1 / depth (exponential average):
+ *   the estimate follows changes in about depth segments.
+ *
+ * After each update the averaged spectrum is passed to the subscribed callbacks,
+ * with the same signature as the STFT ones.
+ *
+ * @code
+ * static stft_t stft;
+ * static welch_t welch;
+ *
+ * StftInit(&stft, 256, STFT_OVERLAP_50);
+ * WelchInit(&welch, &stft, 8);
+ * WelchSubscribe(&welch, ShowSpectrum, NULL);
+ * ...
+ * StftPushBlock(&stft, samples, n);    // producer
+ * StftProcess(&stft);                  // consumer: ShowSpectrum gets the average
+ * @endcode
+ *
+ * @note The power has the scaling of FFTMagnitude, squared: a sine of amplitude
+ * A gives about A² on its bin. Divide by the bin width (sample frequency /
+ * frame lenght) and the window's equivalent noise bandwidth for a density.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "stft.h"
+/*==================[macros]=================================================*/
+#define WELCH_MAX_SUBSCRIBERS   4       /*!< Maximum number of callbacks per estimator */
+/*==================[typedef]================================================*/
+/**
+ * @brief Welch estimator state (one per STFT)
+ */
+typedef struct {
+    float power[STFT_MAX_FRAME / 2];                /*!< Averaged power of each bin */
+    uint16_t n_bins;                                /*!< Number of bins (frame_lenght / 2) */
+    uint16_t depth;                                 /*!< Segments averaged */
+    uint32_t segments;                              /*!< Segments added since the last reset */
+    stft_callback_t func_p[WELCH_MAX_SUBSCRIBERS];  /*!< Subscribed callbacks */
+    void *param_p[WELCH_MAX_SUBSCRIBERS];           /*!< Callbacks parameters */
+    uint8_t n_subscribers;                          /*!< Number of subscribed callbacks */
+} welch_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an estimator and subscribe it to a STFT
+ *
+ * @param welch     Estimator to be initialized
+ * @param stft      STFT already initialized (takes one of its subscriber slots)
+ * @param depth     Segments averaged (at least 1)
+ * @return true     Estimator initialized
+ * @return false    Invalid depth or no free subscriber slots in the STFT
+ */
+bool WelchInit(welch_t *welch, stft_t *stft, uint16_t depth);
+
+/**
+ * @brief Subscribe a function to the averaged spectrum
+ *
+ * @param welch     Estimator
+ * @param func_p    Function called (from StftProcess) with the averaged power after each segment
+ * @param param_p   Parameter passed to the function
+ * @return true     Function subscribed
+ * @return false    No free subscriber slots
+ */
+bool WelchSubscribe(welch_t *welch, stft_callback_t func_p, void *param_p);
+
+/**
+ * @brief Forget the segments averaged so far (e.g. after a change of the signal source)
+ *
+ * @param welch     Estimator
+ */
+void WelchReset(welch_t *welch);
+
+/**
+ * @brief Segments in the average since initialization or the last reset
+ *
+ * @param welch     Estimator
+ * @return uint32_t Number of segments (stops growing at depth)
+ */
+uint32_t WelchSegments(const welch_t *welch);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* WELCH_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,200 @@
+/**
+ * @file activity_classifier.c
+ * @brief Classification of the activity of the user from the filtered acceleration and tilt
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "activity_classifier.h"
+#include "dspi_dotprod.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void SegmentClear(activity_segment_t *s){
+    WelfordInit(&s->tilt);
+    WelfordInit(&s->mag);
+    s->tilt_min = 0;
+    s->tilt_max = 0;
+}
+
+/**
+ * @brief Adds the statistics of b to a (parallel form of Welford's update)
+ */
+static void WelfordMerge(welford_t *a, const welford_t *b){
+    float delta = b->mean - a->mean;
+    uint32_t n = a->n + b->n;
+
+    if(b->n == 0){
+        return;
+    }
+    a->mean += delta * b->n / n;
+    a->m2 += b->m2 + delta * delta * ((float)a->n * b->n / n);
+    a->n = n;
+}
+
+/**
+ * @brief Dominant frequency and power of the step band of the magnitude ring
+ */
+static void StepBand(activity_classifier_t *c, float variance){
+    float a[ACTIVITY_STEP_BINS], power = 0, d, den;
+    uint8_t best = 0;
+
+    GoertzelBankProcess(&c->steps, c->mag, a);
+    for(uint8_t i = 0; i < ACTIVITY_STEP_BINS; i++){
+        power += a[i] * a[i] / 2;
+        if(a[i] > a[best]){
+            best = i;
+        }
+    }
+    // parabolic interpolation between the neighbour bins
+    d = 0;
+    if(best > 0 && best < ACTIVITY_STEP_BINS - 1){
+        den = a[best - 1] - 2 * a[best] + a[best + 1];
+        if(den < 0){
+            d = 0.5f * (a[best - 1] - a[best + 1]) / den;
+        }
+    }
+    c->features[ACTIVITY_STEP_FREQ] = c->step_hz[best] + d * (c->step_hz[1] - c->step_hz[0]);
+    c->features[ACTIVITY_STEP_POWER] = (variance > 0) ? fminf(power / variance, 1.0f) : 0;
+}
+
+/**
+ * @brief Features of the complete window, the oldest segment at c->current
+ */
+static void WindowFeatures(activity_classifier_t *c){
+    const activity_segment_t *first = &c->segment[c->current];
+    const activity_segment_t *last = &c->segment[(c->current + ACTIVITY_SEGMENTS - 1) % ACTIVITY_SEGMENTS];
+    const activity_segment_t *s;
+    welford_t tilt, mag;
+    float tilt_min = first->tilt_min, tilt_max = first->tilt_max;
+
+    WelfordInit(&tilt);
+    WelfordInit(&mag);
+    for(uint8_t i = 0; i < ACTIVITY_SEGMENTS; i++){
+        s = &c->segment[(c->current + i) % ACTIVITY_SEGMENTS];
+        WelfordMerge(&tilt, &s->tilt);
+        WelfordMerge(&mag, &s->mag);
+        tilt_min = fminf(tilt_min, s->tilt_min);
+        tilt_max = fmaxf(tilt_max, s->tilt_max);
+    }
+    c->features[ACTIVITY_TILT_STD] = sqrtf(WelfordVariance(&tilt));
+    c->features[ACTIVITY_TILT_RANGE] = tilt_max - tilt_min;
+    c->features[ACTIVITY_TILT_NET] = fabsf(last->tilt.mean - first->tilt.mean);
+    c->features[ACTIVITY_MAG_STD] = sqrtf(WelfordVariance(&mag));
+    StepBand(c, WelfordVariance(&mag));
+}
+
+/*==================[external functions definition]==========================*/
+bool ActivityInit(activity_classifier_t *c, const activity_model_t *model, float sample_frec){
+    uint32_t samples = (uint32_t)lrintf(model->segment_ms * sample_frec / 1000.0f);
+    uint16_t window, first_bin;
+    float bin_hz;
+
+    if(model->shift == 0 || samples < 2 || ACTIVITY_SEGMENTS * samples > ACTIVITY_MAX_WINDOW){
+        return false;
+    }
+    // bins of the whole window, the first one at or above ACTIVITY_STEP_MIN_HZ
+    window = (uint16_t)(ACTIVITY_SEGMENTS * samples);
+    bin_hz = sample_frec / window;
+    first_bin = (uint16_t)ceilf(ACTIVITY_STEP_MIN_HZ / bin_hz);
+    for(uint8_t i = 0; i < ACTIVITY_STEP_BINS; i++){
+        c->step_hz[i] = (first_bin + i) * bin_hz;
+    }
+    if(!GoertzelBankInit(&c->steps, sample_frec, window, c->step_hz, ACTIVITY_STEP_BINS)){
+        return false;
+    }
+    c->model = model;
+    c->sample_frec = sample_frec;
+    c->samples = (uint16_t)samples;
+    ActivityReset(c);
+    return true;
+}
+
+void ActivityReset(activity_classifier_t *c){
+    for(uint8_t i = 0; i < ACTIVITY_SEGMENTS; i++){
+        SegmentClear(&c->segment[i]);
+    }
+    c->current = 0;
+    c->filled = 0;
+    c->pos = 0;
+    memset(c->features, 0, sizeof(c->features));
+    c->activity = ACTIVITY_STILL;
+}
+
+bool ActivityAdd(activity_classifier_t *c, float x, float y, float z, float tilt_deg){
+    activity_segment_t *seg = &c->segment[c->current];
+    float mag = sqrtf(x * x + y * y + z * z);
+    bool classified = false;
+
+    WelfordAdd(&seg->tilt, tilt_deg);
+    WelfordAdd(&seg->mag, mag);
+    if(seg->tilt.n == 1){
+        seg->tilt_min = tilt_deg;
+        seg->tilt_max = tilt_deg;
+    } else {
+        seg->tilt_min = fminf(seg->tilt_min, tilt_deg);
+        seg->tilt_max = fmaxf(seg->tilt_max, tilt_deg);
+    }
+    // without the gravity the resonators of the Goertzel bank stay small
+    c->mag[c->pos] = mag - 1.0f;
+    if(++c->pos == c->steps.signal_lenght){
+        c->pos = 0;
+    }
+    if(seg->tilt.n < c->samples){
+        return false;
+    }
+
+    // segment complete: classify the window ending with it
+    c->current = (c->current + 1) % ACTIVITY_SEGMENTS;
+    if(c->filled < ACTIVITY_SEGMENTS){
+        c->filled++;
+    }
+    if(c->filled == ACTIVITY_SEGMENTS){
+        WindowFeatures(c);
+        c->activity = ActivityClassify(c->model, c->features);
+        classified = true;
+    }
+    SegmentClear(&c->segment[c->current]);
+    return classified;
+}
+
+activity_t ActivityClassify(const activity_model_t *model, const float *features){
+    int8_t q[ACTIVITY_N_INPUTS] __attribute__((aligned(16))) = {0};
+    image2d_t input = {.data = q, .step_x = 1, .step_y = 1, .stride_x = ACTIVITY_N_INPUTS, .stride_y = 1};
+    image2d_t weight = input;
+    activity_t best = ACTIVITY_STILL;
+    int8_t score, best_score = INT8_MIN;
+    float v;
+
+    for(uint8_t i = 0; i < ACTIVITY_N_FEATURES; i++){
+        v = roundf((features[i] - model->offset[i]) * model->gain[i]);
+        q[i] = (int8_t)fmaxf(-ACTIVITY_Q_MAX, fminf(ACTIVITY_Q_MAX, v));
+    }
+    q[ACTIVITY_BIAS_INPUT] = ACTIVITY_Q_MAX;
+    for(uint8_t k = 0; k < ACTIVITY_CLASSES; k++){
+        weight.data = (void *)model->weight[k];
+        // the model shift keeps every score in int8 (activity_model.py); no
+        // esp-dsp sdkconfig selects the kernel, the ANSI one is the RISC-V one
+        dspi_dotprod_s8_ansi(&input, &weight, &score, ACTIVITY_N_INPUTS, 1, model->shift);
+        // ties go to the first class, ACTIVITY_STILL: the posture keeps being timed
+        if(score > best_score){
+            best_score = score;
+            best = (activity_t)k;
+        }
+    }
+    return best;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,80 @@
+/**
+ * @file adpcm.c
+ * @brief IMA-ADPCM decoder for audio stored in flash
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "adpcm.h"
+/*==================[macros and definitions]=================================*/
+#define ADPCM_INDEX_MAX     88
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const int8_t index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static const uint16_t step_table[ADPCM_INDEX_MAX + 1] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline int16_t DecodeNibble(adpcm_state_t *state, uint8_t code){
+    int32_t step = step_table[state->index];
+    int32_t diff = step >> 3;
+    int32_t sample;
+    int8_t index;
+
+    // diff = (code + 0.5) * step / 4, with the rounding of the reference decoder
+    if(code & 4){
+        diff += step;
+    }
+    if(code & 2){
+        diff += step >> 1;
+    }
+    if(code & 1){
+        diff += step >> 2;
+    }
+    sample = state->predictor + ((code & 8) ? -diff : diff);
+    if(sample > INT16_MAX){
+        sample = INT16_MAX;
+    } else if(sample < INT16_MIN){
+        sample = INT16_MIN;
+    }
+    index = state->index + index_table[code & 7];
+    if(index < 0){
+        index = 0;
+    } else if(index > ADPCM_INDEX_MAX){
+        index = ADPCM_INDEX_MAX;
+    }
+    state->predictor = (int16_t)sample;
+    state->index = index;
+    return state->predictor;
+}
+/*==================[external functions definition]==========================*/
+void AdpcmDecodeBlock(const uint8_t *block, uint16_t n, int16_t *pcm){
+    adpcm_state_t state;
+
+    state.predictor = (int16_t)(block[0] | (block[1] << 8));
+    state.index = (block[2] <= ADPCM_INDEX_MAX) ? block[2] : ADPCM_INDEX_MAX;
+    AdpcmDecode(&state, &block[ADPCM_HEADER_BYTES], n, pcm);
+}
+
+void AdpcmDecode(adpcm_state_t *state, const uint8_t *data, uint16_t n, int16_t *pcm){
+    for(uint16_t i = 0; i < n / 2; i++){
+        pcm[2 * i] = DecodeNibble(state, data[i] & 0x0F);
+        pcm[2 * i + 1] = DecodeNibble(state, data[i] >> 4);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,73 @@
+/**
+ * @file axis_calibration.c
+ * @brief Scale, misalignment and bias correction of 3-axis samples
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "axis_calibration.h"
+#include "dsp_scratch.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+static const float identity[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void AxisCalibrationInit(axis_calibration_t *cal, const float matrix[9], const float bias[3]){
+    memcpy(cal->matrix, (matrix != NULL) ? matrix : identity, sizeof(cal->matrix));
+    if(bias == NULL){
+        memset(cal->offset, 0, sizeof(cal->offset));
+        return;
+    }
+    // matrix · (raw - bias) = matrix · raw - matrix · bias
+    dspm_mult_3x3x1_f32(cal->matrix, bias, cal->offset);
+    for(uint8_t axis = 0; axis < 3; axis++){
+        cal->offset[axis] = -cal->offset[axis];
+    }
+}
+
+void AxisCalibrationApply(const axis_calibration_t *cal, float v[3]){
+    float out[3];
+
+    dspm_mult_3x3x1_f32(cal->matrix, v, out);
+    for(uint8_t axis = 0; axis < 3; axis++){
+        v[axis] = out[axis] + cal->offset[axis];
+    }
+}
+
+bool AxisCalibrationApplyBlock(const axis_calibration_t *cal, float *rows, uint16_t len, uint16_t stride){
+    dsp_scratch_mark_t mark;
+    float *out;
+    bool ok = false;
+
+    if(len == 0){
+        return true;
+    }
+    if(stride < len){
+        return false;
+    }
+    mark = DspScratchMark();
+    out = DspScratchAlloc(3 * len * sizeof(float));
+    if(out != NULL){
+        // 3x3 by 3xlen in one call, skipping the unused end of each row
+        ok = (dspm_mult_ex_f32(cal->matrix, rows, out, 3, 3, len, 0, stride - len, 0) == ESP_OK);
+        for(uint8_t axis = 0; ok && axis < 3; axis++){
+            dsps_addc_f32(&out[axis * len], &rows[axis * stride], len, cal->offset[axis], 1, 1);
+        }
+    }
+    DspScratchRelease(mark);
+    return ok;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,136 @@
+/**
+ * @file band_energy.c
+ * @brief Spectral band levels for vumeter-like consumers
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "band_energy.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void BandMapWidths(band_map_t *map){
+    uint16_t width;
+
+    for(uint8_t b = 0; b < map->n_bands; b++){
+        width = map->first_bin[b + 1] - map->first_bin[b];
+        map->inv_width[b] = 1.0f / width;
+        map->inv_width_q16[b] = 65536UL / width;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool BandMapInitLinear(band_map_t *map, uint16_t n_bins, uint8_t n_bands){
+    if(n_bands == 0 || n_bands > BAND_MAX_BANDS || n_bands > n_bins){
+        return false;
+    }
+    map->n_bands = n_bands;
+    for(uint8_t b = 0; b <= n_bands; b++){
+        map->first_bin[b] = (uint32_t)b * n_bins / n_bands;
+    }
+    BandMapWidths(map);
+    return true;
+}
+
+bool BandMapInitLog(band_map_t *map, float sample_freq, uint16_t signal_lenght, uint8_t n_bands, float f_min, float f_max){
+    float bins_per_hz = signal_lenght / sample_freq;
+    float ratio;
+    uint16_t n_bins = signal_lenght / 2;
+    uint16_t bin;
+
+    if(n_bands == 0 || n_bands > BAND_MAX_BANDS || f_min <= 0 || f_max <= f_min || f_max > sample_freq / 2){
+        return false;
+    }
+    ratio = powf(f_max / f_min, 1.0f / n_bands);
+    map->n_bands = n_bands;
+    map->first_bin[0] = (uint16_t)(f_min * bins_per_hz + 0.5f);
+    for(uint8_t b = 1; b <= n_bands; b++){
+        bin = (uint16_t)(f_min * powf(ratio, b) * bins_per_hz + 0.5f);
+        /* at least one bin per band */
+        if(bin <= map->first_bin[b - 1]){
+            bin = map->first_bin[b - 1] + 1;
+        }
+        map->first_bin[b] = bin;
+    }
+    if(map->first_bin[n_bands] > n_bins){
+        return false;
+    }
+    BandMapWidths(map);
+    return true;
+}
+
+void BandEnergy(const band_map_t *map, const float *fft, float *bands){
+    float acc;
+
+    for(uint8_t b = 0; b < map->n_bands; b++){
+        acc = 0;
+        for(uint16_t k = map->first_bin[b]; k < map->first_bin[b + 1]; k++){
+            acc += fft[k];
+        }
+        bands[b] = acc * map->inv_width[b];
+    }
+}
+
+void BandEnergyQ15(const band_map_t *map, const uint16_t *fft, uint16_t *bands){
+    uint32_t acc;
+
+    for(uint8_t b = 0; b < map->n_bands; b++){
+        acc = 0;
+        for(uint16_t k = map->first_bin[b]; k < map->first_bin[b + 1]; k++){
+            acc += fft[k];
+        }
+        bands[b] = (uint16_t)(((uint64_t)acc * map->inv_width_q16[b]) >> 16);
+    }
+}
+
+bool GoertzelBankInit(goertzel_bank_t *bank, float sample_freq, uint16_t signal_lenght, const float *freqs, uint8_t n_bands){
+    float k;
+
+    if(n_bands == 0 || n_bands > GOERTZEL_MAX_BANDS || signal_lenght == 0){
+        return false;
+    }
+    for(uint8_t b = 0; b < n_bands; b++){
+        if(freqs[b] < 0 || freqs[b] > sample_freq / 2){
+            return false;
+        }
+        k = roundf(freqs[b] * signal_lenght / sample_freq);
+        bank->coeff[b] = 2 * cosf(2 * (float)M_PI * k / signal_lenght);
+    }
+    bank->n_bands = n_bands;
+    bank->signal_lenght = signal_lenght;
+    return true;
+}
+
+void GoertzelBankProcess(const goertzel_bank_t *bank, const float *signal, float *magnitude){
+    float s0, s1[GOERTZEL_MAX_BANDS] = {0}, s2[GOERTZEL_MAX_BANDS] = {0};
+    float power;
+
+    /* all the bands in a single pass over the samples */
+    for(uint16_t i = 0; i < bank->signal_lenght; i++){
+        for(uint8_t b = 0; b < bank->n_bands; b++){
+            s0 = signal[i] + bank->coeff[b] * s1[b] - s2[b];
+            s2[b] = s1[b];
+            s1[b] = s0;
+        }
+    }
+    for(uint8_t b = 0; b < bank->n_bands; b++){
+        power = s1[b] * s1[b] + s2[b] * s2[b] - bank->coeff[b] * s1[b] * s2[b];
+        if(power < 0){
+            power = 0;
+        }
+        magnitude[b] = 2 * sqrtf(power) / bank->signal_lenght;
+    }
+}
+
+/*==================[end of file]============================================*/
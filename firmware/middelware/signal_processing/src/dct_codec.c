@@ -0,0 +1,279 @@
+/**
+ * @file dct_codec.c
+ * @brief Lossy compression of signal windows: orthonormal DCT, uniform
+ * quantization and adaptive Rice coding
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "sdkconfig.h"
+#include "dct_codec.h"
+#include "dsp_scratch.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define RICE_K_MAX      15      /*!< Largest Rice parameter */
+#define RICE_SUM_INIT   16      /*!< Value sum at the start of a block (k = 4) */
+#define RICE_RESET      32      /*!< Values after which the sum and count are halved */
+#define STEP_SCALE      16.0f   /*!< The step is stored in 1/16 of the sample unit */
+#define MIN_LENGTH      8
+/*==================[typedef]================================================*/
+/* Rice coder state, the same for the writer and the reader */
+typedef struct {
+    uint8_t *data;
+    uint16_t length;        /* Bytes written or read */
+    uint16_t max;           /* Bytes available (reader) */
+    uint32_t acc;
+    uint8_t bits;
+    uint32_t sum;
+    uint16_t runs;
+} rice_t;
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool ValidLength(uint16_t n){
+    return n >= MIN_LENGTH && n <= DCT_CODEC_MAX_LENGTH && n <= CONFIG_DSP_MAX_FFT_SIZE && (n & (n - 1)) == 0;
+}
+
+static int16_t Saturate(float value){
+    value = roundf(value);
+    if(value > INT16_MAX){
+        return INT16_MAX;
+    }
+    if(value < -INT16_MAX){
+        return -INT16_MAX;
+    }
+    return (int16_t)value;
+}
+
+static uint32_t ZigZag(int16_t value){
+    return (value >= 0) ? ((uint32_t)value << 1) : (((uint32_t)-value << 1) - 1);
+}
+
+static int16_t ZigZagInverse(uint32_t u){
+    return (u & 1) ? -(int16_t)((u + 1) >> 1) : (int16_t)(u >> 1);
+}
+
+static void RiceStart(rice_t *rice, uint8_t *data, uint16_t max){
+    rice->data = data;
+    rice->length = 0;
+    rice->max = max;
+    rice->acc = 0;
+    rice->bits = 0;
+    rice->sum = RICE_SUM_INIT;
+    rice->runs = 1;
+}
+
+/* Rice parameter from the mean of the previous values of the block */
+static uint8_t RiceK(const rice_t *rice){
+    uint8_t k = 0;
+
+    while(k < RICE_K_MAX && ((uint32_t)rice->runs << k) < rice->sum){
+        k++;
+    }
+    return k;
+}
+
+static void RiceUpdate(rice_t *rice, uint32_t u){
+    rice->sum += u;
+    if(++rice->runs == RICE_RESET){
+        rice->sum >>= 1;
+        rice->runs >>= 1;
+    }
+}
+
+/* Append bits, most significant first */
+static void BitsPut(rice_t *rice, uint32_t value, uint8_t n){
+    while(n--){
+        rice->acc = (rice->acc << 1) | ((value >> n) & 1);
+        if(++rice->bits == 8){
+            rice->data[rice->length++] = rice->acc;
+            rice->acc = 0;
+            rice->bits = 0;
+        }
+    }
+}
+
+static void BitsFlush(rice_t *rice){
+    if(rice->bits > 0){
+        rice->data[rice->length++] = rice->acc << (8 - rice->bits);
+        rice->acc = 0;
+        rice->bits = 0;
+    }
+}
+
+/* Next bit, false past the end of the block */
+static bool BitGet(rice_t *rice, uint8_t *bit){
+    if(rice->bits == 0){
+        if(rice->length >= rice->max){
+            return false;
+        }
+        rice->acc = rice->data[rice->length++];
+        rice->bits = 8;
+    }
+    rice->bits--;
+    *bit = (rice->acc >> rice->bits) & 1;
+    return true;
+}
+
+static bool BitsGet(rice_t *rice, uint8_t n, uint32_t *value){
+    uint8_t bit;
+
+    *value = 0;
+    while(n--){
+        if(!BitGet(rice, &bit)){
+            return false;
+        }
+        *value = (*value << 1) | bit;
+    }
+    return true;
+}
+
+static void RicePut(rice_t *rice, int16_t value){
+    uint32_t u = ZigZag(value);
+    uint8_t k = RiceK(rice);
+    uint32_t q = u >> k;
+
+    if(q < DCT_CODEC_RICE_Q_MAX){
+        BitsPut(rice, ((1UL << q) - 1) << 1, q + 1);
+        BitsPut(rice, u, k);
+    } else{
+        BitsPut(rice, (1UL << DCT_CODEC_RICE_Q_MAX) - 1, DCT_CODEC_RICE_Q_MAX);
+        BitsPut(rice, (uint16_t)value, 16);
+    }
+    RiceUpdate(rice, u);
+}
+
+static bool RiceGet(rice_t *rice, int16_t *value){
+    uint8_t k = RiceK(rice), bit = 1;
+    uint32_t q = 0, low, u;
+
+    while(q < DCT_CODEC_RICE_Q_MAX){
+        if(!BitGet(rice, &bit)){
+            return false;
+        }
+        if(bit == 0){
+            break;
+        }
+        q++;
+    }
+    if(q == DCT_CODEC_RICE_Q_MAX){
+        if(!BitsGet(rice, 16, &low)){
+            return false;
+        }
+        *value = (int16_t)low;
+        u = ZigZag(*value);
+    } else{
+        if(!BitsGet(rice, k, &low)){
+            return false;
+        }
+        u = (q << k) | low;
+        *value = ZigZagInverse(u);
+    }
+    RiceUpdate(rice, u);
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool DctCodecInit(void){
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    return ret == ESP_OK || ret == ESP_ERR_DSP_REINITIALIZED;
+}
+
+uint16_t DctCodecEncode(const int16_t *x, uint16_t n, float step, uint8_t *block){
+    dsp_scratch_mark_t mark = DspScratchMark();
+    float *work = DspScratchAlloc(2 * n * sizeof(float));
+    int16_t coef[DCT_CODEC_MAX_LENGTH];
+    uint16_t step_q4, m = 0;
+    float scale_dc, scale_ac;
+    rice_t rice;
+
+    step_q4 = (uint16_t)fminf(fmaxf(roundf(step * STEP_SCALE), 1.0f), (float)UINT16_MAX);
+    if(work == NULL || !ValidLength(n)){
+        DspScratchRelease(mark);
+        return 0;
+    }
+    for(uint16_t i = 0; i < n; i++){
+        work[i] = x[i];
+    }
+    dsps_dct_f32(work, n);
+    /* orthonormal scaling and the step in one product per coefficient */
+    step = step_q4 / STEP_SCALE;
+    scale_dc = sqrtf(1.0f / n) / step;
+    scale_ac = sqrtf(2.0f / n) / step;
+    coef[0] = Saturate(work[0] * scale_dc);
+    for(uint16_t i = 1; i < n; i++){
+        coef[i] = Saturate(work[i] * scale_ac);
+        if(coef[i] != 0){
+            m = i;
+        }
+    }
+    DspScratchRelease(mark);
+    m = m + 1;
+    block[0] = step_q4 & 0xFF;
+    block[1] = step_q4 >> 8;
+    block[2] = m;
+    block[3] = (uint16_t)coef[0] & 0xFF;
+    block[4] = (uint16_t)coef[0] >> 8;
+    RiceStart(&rice, &block[DCT_CODEC_HEADER_BYTES], 0);
+    for(uint16_t i = 1; i < m; i++){
+        RicePut(&rice, coef[i]);
+    }
+    BitsFlush(&rice);
+    return DCT_CODEC_HEADER_BYTES + rice.length;
+}
+
+uint16_t DctCodecDecode(const uint8_t *block, uint16_t length, uint16_t n, int16_t *x){
+    dsp_scratch_mark_t mark;
+    float *work;
+    float step, scale_dc, scale_ac;
+    uint16_t m;
+    int16_t value;
+    rice_t rice;
+
+    if(!ValidLength(n) || length < DCT_CODEC_HEADER_BYTES){
+        return 0;
+    }
+    step = (block[0] | (block[1] << 8)) / STEP_SCALE;
+    m = block[2];
+    if(m == 0 || m > n || step == 0){
+        return 0;
+    }
+    mark = DspScratchMark();
+    work = DspScratchAlloc(2 * n * sizeof(float));
+    if(work == NULL){
+        DspScratchRelease(mark);
+        return 0;
+    }
+    /* inverse of the orthonormal DCT-II with dsps_dct_inv_f32, which
+       computes x[i] = X[0] / 2 + sum(X[k] cos(pi k (i + 0.5) / n)) */
+    scale_dc = 2.0f * step * sqrtf(1.0f / n);
+    scale_ac = step * sqrtf(2.0f / n);
+    memset(work, 0, 2 * n * sizeof(float));
+    work[0] = (int16_t)(block[3] | (block[4] << 8)) * scale_dc;
+    RiceStart(&rice, (uint8_t *)&block[DCT_CODEC_HEADER_BYTES], length - DCT_CODEC_HEADER_BYTES);
+    for(uint16_t i = 1; i < m; i++){
+        if(!RiceGet(&rice, &value)){
+            DspScratchRelease(mark);
+            return 0;
+        }
+        work[i] = value * scale_ac;
+    }
+    dsps_dct_inv_f32(work, n);
+    for(uint16_t i = 0; i < n; i++){
+        x[i] = Saturate(work[i]);
+    }
+    DspScratchRelease(mark);
+    return DCT_CODEC_HEADER_BYTES + rice.length;
+}
+
+/*==================[end of file]============================================*/
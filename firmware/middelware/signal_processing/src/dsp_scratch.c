@@ -0,0 +1,76 @@
+/**
+ * @file dsp_scratch.c
+ * @brief Scoped scratch arena for DSP work buffers
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "dsp_scratch.h"
+/*==================[macros and definitions]=================================*/
+#define TAG             "DSP scratch"
+#define SCRATCH_ALIGN   16
+/*==================[internal data declaration]==============================*/
+static uint8_t arena[CONFIG_MIDDELWARE_DSP_SCRATCH_SIZE] __attribute__((aligned(SCRATCH_ALIGN)));
+static size_t top = 0;                      /* first free byte */
+static size_t peak = 0;                     /* highest top */
+static SemaphoreHandle_t owner = NULL;      /* recursive mutex, held from mark to release */
+static StaticSemaphore_t owner_buffer;
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+dsp_scratch_mark_t DspScratchMark(void){
+    if(owner == NULL){
+        taskENTER_CRITICAL(&lock);
+        if(owner == NULL){
+            owner = xSemaphoreCreateRecursiveMutexStatic(&owner_buffer);
+        }
+        taskEXIT_CRITICAL(&lock);
+    }
+    xSemaphoreTakeRecursive(owner, portMAX_DELAY);
+    return top;
+}
+
+void *DspScratchAlloc(size_t size){
+    void *buffer;
+
+    if(owner == NULL || xSemaphoreGetMutexHolder(owner) != xTaskGetCurrentTaskHandle()){
+        return NULL;
+    }
+    size = (size + SCRATCH_ALIGN - 1) & ~(size_t)(SCRATCH_ALIGN - 1);
+    if(size > sizeof(arena) - top){
+        ESP_LOGE(TAG, "%u bytes don't fit (%u free), raise CONFIG_MIDDELWARE_DSP_SCRATCH_SIZE",
+                 (unsigned)size, (unsigned)(sizeof(arena) - top));
+        return NULL;
+    }
+    buffer = &arena[top];
+    top += size;
+    if(top > peak){
+        peak = top;
+    }
+    return buffer;
+}
+
+void DspScratchRelease(dsp_scratch_mark_t mark){
+    top = mark;
+    xSemaphoreGiveRecursive(owner);
+}
+
+size_t DspScratchPeak(void){
+    return peak;
+}
+
+/*==================[end of file]============================================*/
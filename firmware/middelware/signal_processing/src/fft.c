@@ -11,15 +11,32 @@
 
 /*==================[inclusions]=============================================*/
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include "fft.h"
+#include "dsp_scratch.h"
+#include "power_mcu.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
-static float wind[MAX_SIGNAL_LENGHT];
+/* Windows and twiddles are kept between calls, in heap buffers sized by the
+ * longest transform used so far. Work buffers are borrowed from dsp_scratch
+ * during each call. */
+static float *wind = NULL;
+static uint16_t wind_capacity = 0;                  /* elements allocated in wind */
+static fft_window_t window_type = FFT_WINDOW_HANN;  /* window applied by FFTMagnitude */
+static fft_window_t wind_type;                      /* window stored in wind */
+static uint16_t wind_lenght = 0;                    /* lenght of the window stored in wind (0: none) */
+static float *split_tw = NULL;                      /* cos, sin of 2*pi*k/N (k < N/2) for the real FFT split */
+static uint16_t split_capacity = 0;                 /* elements allocated in split_tw */
+static uint16_t split_lenght = 0;                   /* lenght N of the twiddles stored in split_tw (0: none) */
+static fft_radix_t fft_radix = FFT_RADIX_2;         /* selected by FFTInitRadix */
+static int16_t *wind_q15 = NULL;
+static uint16_t wind_q15_capacity = 0;              /* elements allocated in wind_q15 */
+static fft_window_t wind_q15_type;                  /* window stored in wind_q15 */
+static uint16_t wind_q15_lenght = 0;                /* lenght of the window stored in wind_q15 (0: none) */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,36 +44,310 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Grows a cache to lenght elements (its contents are regenerated by the caller) */
+static bool CacheReserve(void **cache, uint16_t *capacity, uint16_t lenght, size_t element_size){
+    void *p;
+
+    if(*capacity >= lenght){
+        return true;
+    }
+    p = realloc(*cache, lenght * element_size);
+    if(p == NULL){
+        ESP_LOGE(TAG, "No memory for a %u point transform", lenght);
+        return false;
+    }
+    *cache = p;
+    *capacity = lenght;
+    return true;
+}
+
+/* Generates the window only when the lenght or the window type change */
+static bool UpdateWindow(uint16_t signal_lenght){
+    if(wind_lenght == signal_lenght && wind_type == window_type){
+        return true;
+    }
+    wind_lenght = 0;
+    if(!CacheReserve((void **)&wind, &wind_capacity, signal_lenght, sizeof(float))){
+        return false;
+    }
+    switch(window_type){
+        case FFT_WINDOW_BLACKMAN:
+            dsps_wind_blackman_f32(wind, signal_lenght);
+        break;
+        case FFT_WINDOW_FLAT_TOP:
+            dsps_wind_flat_top_f32(wind, signal_lenght);
+        break;
+        case FFT_WINDOW_HANN:
+        default:
+            dsps_wind_hann_f32(wind, signal_lenght);
+        break;
+    }
+    wind_type = window_type;
+    wind_lenght = signal_lenght;
+    return true;
+}
+
+/* Generates the Q15 window only when the lenght or the window type change */
+static bool UpdateWindowQ15(uint16_t signal_lenght){
+    if(wind_q15_lenght == signal_lenght && wind_q15_type == window_type){
+        return true;
+    }
+    wind_q15_lenght = 0;
+    if(!UpdateWindow(signal_lenght) ||
+       !CacheReserve((void **)&wind_q15, &wind_q15_capacity, signal_lenght, sizeof(int16_t))){
+        return false;
+    }
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        wind_q15[i] = (int16_t)(wind[i] * INT16_MAX);
+    }
+    wind_q15_type = window_type;
+    wind_q15_lenght = signal_lenght;
+    return true;
+}
+
+/* Integer sqrt(re^2 + im^2), rounded down (bit by bit, no multiplications) */
+static uint16_t MagnitudeQ15(int16_t re, int16_t im){
+    uint32_t op = (uint32_t)((int32_t)re * re) + (uint32_t)((int32_t)im * im);
+    uint32_t res = 0;
+    uint32_t one = 1UL << 30;
+    while(one > op){
+        one >>= 2;
+    }
+    while(one != 0){
+        if(op >= res + one){
+            op -= res + one;
+            res = (res >> 1) + one;
+        } else {
+            res >>= 1;
+        }
+        one >>= 2;
+    }
+    return (uint16_t)res;
+}
+
+/* Generates the split twiddles only when the lenght changes */
+static bool UpdateSplitTwiddles(uint16_t signal_lenght){
+    if(split_lenght == signal_lenght){
+        return true;
+    }
+    split_lenght = 0;
+    if(!CacheReserve((void **)&split_tw, &split_capacity, signal_lenght, sizeof(float))){
+        return false;
+    }
+    for(uint16_t k = 0; k < signal_lenght / 2; k++){
+        split_tw[k*2+0] = cosf(2 * (float)M_PI * k / signal_lenght);
+        split_tw[k*2+1] = sinf(2 * (float)M_PI * k / signal_lenght);
+    }
+    split_lenght = signal_lenght;
+    return true;
+}
+
+/* true if n is a power of four (n is already a power of two) */
+static bool IsPowerOfFour(uint16_t n){
+    return (n & 0x5555) != 0;
+}
+
+/* Complex FFT (in natural order) with the radix chosen for this lenght */
+static void ComplexFFT(float * data, uint16_t n){
+    if(FFTGetRadix(n) == FFT_RADIX_4){
+        dsps_fft4r_fc32(data, n);
+        dsps_bit_rev4r_fc32(data, n);
+    } else {
+        dsps_fft2r_fc32(data, n);
+        dsps_bit_rev_fc32(data, n);
+    }
+}
+
+/* Magnitude of the first signal_lenght/2 bins, as given by dsps_cplx2reC_fc32 */
+static void Magnitude(float * bins, float * fft, uint16_t signal_lenght){
+    for (int j = 0; j < signal_lenght / 2; j++){
+        fft[j] = 2*(sqrtf(bins[j*2+0]*bins[j*2+0] + bins[j*2+1]*bins[j*2+1])) / (signal_lenght/2);
+    }
+    fft[0] = fft[0] / 2;
+}
+
+/* FFT magnitude of a real signal with a complex transform of half lenght
+ * (window and split twiddles already updated, work: 2 * signal_lenght floats) */
+static void RealMagnitude(const float * signal, float * fft, uint16_t signal_lenght, float * fft_complex){
+    uint16_t m = signal_lenght / 2, mk;
+    float zr, zi, cr, ci, e_re, e_im, o_re, o_im, xr, xi, wr, wi;
+    float * bins = &fft_complex[signal_lenght];
+
+    // Multiply input array with window: even samples become the real part and
+    // odd samples the imaginary part of a signal_lenght/2 complex signal
+    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 1);
+    // Calculate FFT of half lenght
+    ComplexFFT(fft_complex, m);
+    // Split: X[k] = E[k] + W^k O[k], E and O being the spectra of even and odd samples
+    for (uint16_t k = 0; k < m; k++){
+        mk = (k == 0) ? 0 : (m - k);
+        zr = fft_complex[k*2+0];
+        zi = fft_complex[k*2+1];
+        cr = fft_complex[mk*2+0];
+        ci = -fft_complex[mk*2+1];
+        e_re = (zr + cr) / 2;
+        e_im = (zi + ci) / 2;
+        o_re = (zi - ci) / 2;
+        o_im = (cr - zr) / 2;
+        wr = split_tw[k*2+0];
+        wi = -split_tw[k*2+1];
+        xr = e_re + (wr * o_re - wi * o_im);
+        xi = e_im + (wr * o_im + wi * o_re);
+        // Same scaling as the complex path (dsps_cplx2reC_fc32 gives 2·X[k], X[0] for DC)
+        bins[k*2+0] = (k == 0) ? xr : 2 * xr;
+        bins[k*2+1] = (k == 0) ? xi : 2 * xi;
+    }
+    // Calculate FFT magnitude 
+    Magnitude(bins, fft, signal_lenght);
+}
+
+/* FFT magnitude of two real signals with one complex transform
+ * (window already updated, work: 2 * signal_lenght floats) */
+static void DualMagnitude(const float * signal_a, const float * signal_b, float * fft_a, float * fft_b,
+                          uint16_t signal_lenght, float * fft_complex){
+    // First signal as real part, second signal as imaginary part
+    dsps_mul_f32(signal_a, wind, &fft_complex[0], signal_lenght, 1, 1, 2);
+    dsps_mul_f32(signal_b, wind, &fft_complex[1], signal_lenght, 1, 1, 2);
+    // Calculate FFT  
+    ComplexFFT(fft_complex, signal_lenght);
+    // Convert one complex vector to two complex vectors
+    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
+    // Calculate FFT magnitude of both signals
+    Magnitude(&fft_complex[0], fft_a, signal_lenght);
+    Magnitude(&fft_complex[signal_lenght], fft_b, signal_lenght);
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
+    return FFTInitRadix(FFT_RADIX_2);
+}
+
+bool FFTInitQ15(void){
+    return dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE) == ESP_OK;
+}
+
+bool FFTInitRadix(fft_radix_t radix){
+    // Radix-2 is always available, for lenghts that are not a power of four
     esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
     if (ret != ESP_OK){
         return false;
     }
+    if (radix == FFT_RADIX_4){
+        ret = dsps_fft4r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+        if (ret != ESP_OK){
+            ESP_LOGW(TAG, "Radix-4 not available, using radix-2");
+            radix = FFT_RADIX_2;
+        }
+    }
+    fft_radix = radix;
     return true;
 }
 
-void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
-    // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
-    // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
+fft_radix_t FFTGetRadix(uint16_t transform_lenght){
+    if (fft_radix == FFT_RADIX_4 && IsPowerOfFour(transform_lenght)){
+        return FFT_RADIX_4;
     }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    return FFT_RADIX_2;
+}
+
+void FFTSetWindow(fft_window_t window){
+    window_type = window;
+}
+
+bool FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+    dsp_scratch_mark_t mark = DspScratchMark();
+    float * fft_complex = DspScratchAlloc(2 * signal_lenght * sizeof(float));
+    bool ok;
+
+    PowerBurstBegin();
+
+    // Generate the window and split twiddles (only if lenght or type changed)
+    ok = fft_complex != NULL && UpdateWindow(signal_lenght) && UpdateSplitTwiddles(signal_lenght);
+    if(ok){
+        RealMagnitude(signal, fft, signal_lenght, fft_complex);
+    }
+    PowerBurstEnd();
+    DspScratchRelease(mark);
+    return ok;
+}
+
+bool FFTMagnitudeDual(float * signal_a, float * signal_b, float * fft_a, float * fft_b, uint16_t signal_lenght){
+    dsp_scratch_mark_t mark = DspScratchMark();
+    float * fft_complex = DspScratchAlloc(2 * signal_lenght * sizeof(float));
+    bool ok;
+
+    PowerBurstBegin();
+
+    // Generate the window (only if lenght or type changed)
+    ok = fft_complex != NULL && UpdateWindow(signal_lenght);
+    if(ok){
+        DualMagnitude(signal_a, signal_b, fft_a, fft_b, signal_lenght, fft_complex);
+    }
+    PowerBurstEnd();
+    DspScratchRelease(mark);
+    return ok;
+}
+
+bool FFTMagnitudeMulti(float * const signals[], float * const ffts[], uint8_t n_channels, uint16_t signal_lenght){
+    uint8_t c;
+    dsp_scratch_mark_t mark = DspScratchMark();
+    float * fft_complex = DspScratchAlloc(2 * signal_lenght * sizeof(float));
+    bool ok = true;
+
+    PowerBurstBegin();
+
+    // One work buffer and one window check for every channel
+    if(fft_complex == NULL || !UpdateWindow(signal_lenght)){
+        PowerBurstEnd();
+        DspScratchRelease(mark);
+        return false;
+    }
+    // Two channels per complex transform
+    for(c = 0; c + 1 < n_channels; c += 2){
+        DualMagnitude(signals[c], signals[c + 1], ffts[c], ffts[c + 1], signal_lenght, fft_complex);
+    }
+    // The last one of an odd number of channels, as a real transform of half lenght
+    if(c < n_channels){
+        ok = UpdateSplitTwiddles(signal_lenght);
+        if(ok){
+            RealMagnitude(signals[c], ffts[c], signal_lenght, fft_complex);
+        }
+    }
+    PowerBurstEnd();
+    DspScratchRelease(mark);
+    return ok;
+}
+
+bool FFTMagnitudeQ15(const int16_t * signal, uint16_t * fft, uint16_t signal_lenght){
+    uint32_t mag;
+    dsp_scratch_mark_t mark = DspScratchMark();
+    int16_t * fft_q15 = DspScratchAlloc(2 * signal_lenght * sizeof(int16_t));
+
+    PowerBurstBegin();
+
+    // Generate the Q15 window (only if lenght or type changed)
+    if(fft_q15 == NULL || !UpdateWindowQ15(signal_lenght)){
+        PowerBurstEnd();
+        DspScratchRelease(mark);
+        return false;
+    }
+    // Multiply input array with window, as the real part of a complex signal
+    for (uint16_t i = 0; i < signal_lenght; i++){
+        fft_q15[i*2+0] = (int16_t)(((int32_t)signal[i] * wind_q15[i]) >> 15);
+        fft_q15[i*2+1] = 0;
+    }
+    // Calculate FFT (each stage halves the data: output is X[k] / signal_lenght)
+    dsps_fft2r_sc16(fft_q15, signal_lenght);
+    dsps_bit_rev_sc16_ansi(fft_q15, signal_lenght);
+    // Calculate FFT magnitude, same scaling as FFTMagnitude (8·|X[k]|/N, 2·|X[0]|/N for DC)
+    for (uint16_t k = 0; k < signal_lenght / 2; k++){
+        mag = MagnitudeQ15(fft_q15[k*2+0], fft_q15[k*2+1]);
+        mag = (k == 0) ? (mag * 2) : (mag * 8);
+        fft[k] = (mag > UINT16_MAX) ? UINT16_MAX : (uint16_t)mag;
+    }
+    PowerBurstEnd();
+    DspScratchRelease(mark);
+    return true;
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
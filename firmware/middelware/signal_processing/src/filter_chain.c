@@ -0,0 +1,172 @@
+/**
+ * @file filter_chain.c
+ * @brief Configurable chain of filter stages processed in blocks
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "filter_chain.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void MedianProcess(filter_stage_t *stage, float *signal, int16_t length){
+    for(int16_t i = 0; i < length; i++){
+        signal[i] = SlidingMedianAdd(&stage->median, signal[i]);
+    }
+}
+
+static void SpikeProcess(filter_stage_t *stage, float *signal, int16_t length){
+    float median;
+
+    for(int16_t i = 0; i < length; i++){
+        median = SlidingMedianAdd(&stage->median, signal[i]);
+        if(fabsf(signal[i] - median) > stage->config.threshold){
+            signal[i] = median;
+        }
+    }
+}
+
+static int16_t DecimateProcess(filter_stage_t *stage, float *signal, int16_t length){
+    int16_t out = 0;
+
+    for(int16_t i = 0; i < length; i++){
+        if(++stage->count >= stage->config.factor){
+            stage->count = 0;
+            signal[out++] = signal[i];
+        }
+    }
+    return out;
+}
+
+/*==================[external functions definition]==========================*/
+bool FilterChainInit(filter_chain_t *chain, float sample_frec, const filter_stage_config_t *stages, uint8_t n_stages){
+    filter_stage_t *stage;
+
+    if(n_stages > FILTER_CHAIN_MAX_STAGES){
+        return false;
+    }
+    memset(chain, 0, sizeof(filter_chain_t));
+    chain->n_stages = n_stages;
+    chain->decimation = 1;
+    for(uint8_t i = 0; i < n_stages; i++){
+        stage = &chain->stage[i];
+        stage->config = stages[i];
+        switch(stage->config.type){
+            case STAGE_SPIKE:
+                if(stage->config.threshold <= 0){
+                    return false;
+                }
+                /* fall through */
+            case STAGE_MEDIAN:
+                if((stage->config.window % 2) == 0 || !SlidingMedianInit(&stage->median, stage->config.window)){
+                    return false;
+                }
+            break;
+            case STAGE_LOW_PASS:
+                IirLowPassInit(&stage->iir, sample_frec, stage->config.cut_frec, stage->config.order);
+            break;
+            case STAGE_HI_PASS:
+                IirHiPassInit(&stage->iir, sample_frec, stage->config.cut_frec, stage->config.order);
+            break;
+            case STAGE_DECIMATE:
+                if(stage->config.factor == 0){
+                    return false;
+                }
+                /* following stages run at the reduced rate */
+                sample_frec /= stage->config.factor;
+                chain->decimation *= stage->config.factor;
+            break;
+            default:
+                return false;
+        }
+    }
+    chain->output_frec = sample_frec;
+    return true;
+}
+
+void FilterChainReset(filter_chain_t *chain){
+    filter_stage_t *stage;
+
+    for(uint8_t i = 0; i < chain->n_stages; i++){
+        stage = &chain->stage[i];
+        switch(stage->config.type){
+            case STAGE_MEDIAN:
+            case STAGE_SPIKE:
+                SlidingMedianInit(&stage->median, stage->config.window);
+            break;
+            case STAGE_LOW_PASS:
+            case STAGE_HI_PASS:
+                IirReset(&stage->iir);
+            break;
+            case STAGE_DECIMATE:
+                stage->count = 0;
+            break;
+        }
+    }
+    chain->started = false;
+}
+
+void FilterChainWarmStart(filter_chain_t *chain, float x0){
+    filter_stage_t *stage;
+
+    for(uint8_t i = 0; i < chain->n_stages; i++){
+        stage = &chain->stage[i];
+        switch(stage->config.type){
+            case STAGE_MEDIAN:
+            case STAGE_SPIKE:
+                SlidingMedianFill(&stage->median, x0);
+            break;
+            case STAGE_LOW_PASS:
+            case STAGE_HI_PASS:
+                /* the output of each stage is the input of the next one */
+                x0 = IirWarmStart(&stage->iir, x0);
+            break;
+            case STAGE_DECIMATE:
+                stage->count = 0;
+            break;
+        }
+    }
+    chain->started = true;
+}
+
+int16_t FilterChainProcess(filter_chain_t *chain, float *signal, int16_t length){
+    filter_stage_t *stage;
+
+    if(!chain->started && length > 0){
+        FilterChainWarmStart(chain, signal[0]);
+    }
+    for(uint8_t i = 0; i < chain->n_stages && length > 0; i++){
+        stage = &chain->stage[i];
+        switch(stage->config.type){
+            case STAGE_MEDIAN:
+                MedianProcess(stage, signal, length);
+            break;
+            case STAGE_SPIKE:
+                SpikeProcess(stage, signal, length);
+            break;
+            case STAGE_LOW_PASS:
+            case STAGE_HI_PASS:
+                /* the whole block in a single dsps_biquad_f32 call per section */
+                IirFilter(&stage->iir, signal, signal, length);
+            break;
+            case STAGE_DECIMATE:
+                length = DecimateProcess(stage, signal, length);
+            break;
+        }
+    }
+    return length;
+}
+
+/*==================[end of file]============================================*/
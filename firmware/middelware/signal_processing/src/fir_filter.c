@@ -0,0 +1,199 @@
+/**
+ * @file fir_filter.c
+ * @brief FIR filters, polyphase decimators and interpolators
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "fir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define FIR_TAPS_ALIGN  4   /* the esp32s3 kernels take multiples of 4 coefficients */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/*
+ * esp-dsp state over the instance arrays. Built on each call, so instances
+ * can be copied (fir_f32_t keeps pointers).
+ */
+static void FirState(fir_filter_t *filter, fir_f32_t *fir, int decim){
+    fir->coeffs = filter->coeff;
+    fir->delay = filter->delay;
+    fir->N = filter->n_taps;
+    fir->pos = filter->pos;
+    fir->decim = decim;
+    fir->use_delay = 0;
+}
+
+static void FirPush(fir_filter_t *filter, float sample){
+    filter->delay[filter->pos++] = sample;
+    if(filter->pos >= filter->n_taps){
+        filter->pos = 0;
+    }
+}
+
+/* Output for the samples in the delay line, as dsps_fir_f32 computes it */
+static float FirOutput(const fir_filter_t *filter){
+    const float *coeff = filter->coeff;
+    float acc = 0;
+    uint16_t n;
+
+    for(n = filter->pos; n < filter->n_taps; n++){
+        acc += *coeff++ * filter->delay[n];
+    }
+    for(n = 0; n < filter->pos; n++){
+        acc += *coeff++ * filter->delay[n];
+    }
+    return acc;
+}
+
+/*==================[external functions definition]==========================*/
+bool FirLowPassDesign(float *coeff, uint16_t n_taps, float sample_frec, float cut_frec, fir_window_t window){
+    float fc = cut_frec / sample_frec;
+    float m = n_taps - 1;
+    float t, w, sum = 0;
+
+    if(n_taps == 0 || n_taps > FIR_MAX_TAPS || fc <= 0 || fc >= 0.5f){
+        return false;
+    }
+    for(uint16_t n = 0; n < n_taps; n++){
+        t = n - m / 2;
+        coeff[n] = (t == 0) ? 2 * fc : sinf(2 * (float)M_PI * fc * t) / ((float)M_PI * t);
+        if(n_taps > 1){
+            switch(window){
+                case FIR_WINDOW_BLACKMAN:
+                    w = 0.42f - 0.5f * cosf(2 * (float)M_PI * n / m) + 0.08f * cosf(4 * (float)M_PI * n / m);
+                break;
+                case FIR_WINDOW_HAMMING:
+                default:
+                    w = 0.54f - 0.46f * cosf(2 * (float)M_PI * n / m);
+                break;
+            }
+            coeff[n] *= w;
+        }
+        sum += coeff[n];
+    }
+    for(uint16_t n = 0; n < n_taps; n++){
+        coeff[n] /= sum;
+    }
+    return true;
+}
+
+bool FirInit(fir_filter_t *filter, const float *coeff, uint16_t n_taps){
+    uint16_t pad = (FIR_TAPS_ALIGN - n_taps % FIR_TAPS_ALIGN) % FIR_TAPS_ALIGN;
+
+    if(n_taps == 0 || n_taps + pad > FIR_MAX_TAPS){
+        return false;
+    }
+    /* zeros on the oldest side: same response and delay as the n_taps filter */
+    memset(filter, 0, sizeof(fir_filter_t));
+    memcpy(&filter->coeff[pad], coeff, n_taps * sizeof(float));
+    filter->n_taps = n_taps + pad;
+    return true;
+}
+
+void FirFilter(fir_filter_t *filter, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    fir_f32_t fir;
+
+    FirState(filter, &fir, 1);
+    dsps_fir_f32(&fir, input_signal, output_signal, signal_lenght);
+    filter->pos = fir.pos;
+}
+
+bool FirDecimatorInit(fir_decimator_t *decimator, const float *coeff, uint16_t n_taps, uint8_t factor){
+    if(factor == 0 || factor > FIR_MAX_FACTOR){
+        return false;
+    }
+    decimator->factor = factor;
+    decimator->phase = 0;
+    return FirInit(&decimator->fir, coeff, n_taps);
+}
+
+int16_t FirDecimate(fir_decimator_t *decimator, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    fir_filter_t *filter = &decimator->fir;
+    fir_f32_t fir;
+    int16_t out = 0, frames;
+
+    /* finish the output sample left in progress by the previous block */
+    while(signal_lenght > 0 && decimator->phase != 0){
+        FirPush(filter, *input_signal++);
+        signal_lenght--;
+        if(++decimator->phase == decimator->factor){
+            decimator->phase = 0;
+            output_signal[out++] = FirOutput(filter);
+        }
+    }
+    /* whole frames: only the kept samples are computed */
+    frames = signal_lenght / decimator->factor;
+    if(frames > 0){
+        FirState(filter, &fir, decimator->factor);
+        out += dsps_fird_f32(&fir, input_signal, &output_signal[out], frames);
+        filter->pos = fir.pos;
+        input_signal += frames * decimator->factor;
+        signal_lenght -= frames * decimator->factor;
+    }
+    /* start of the next output sample */
+    while(signal_lenght-- > 0){
+        FirPush(filter, *input_signal++);
+        decimator->phase++;
+    }
+    return out;
+}
+
+bool FirInterpolatorInit(fir_interpolator_t *interpolator, const float *coeff, uint16_t n_taps, uint8_t factor){
+    uint16_t n_phase_taps;
+
+    if(factor == 0 || factor > FIR_MAX_FACTOR || n_taps == 0 || n_taps > FIR_MAX_TAPS){
+        return false;
+    }
+    n_phase_taps = (n_taps + factor - 1) / factor;
+    memset(interpolator, 0, sizeof(fir_interpolator_t));
+    interpolator->factor = factor;
+    interpolator->n_phase_taps = n_phase_taps;
+    /* phase p, tap k: impulse response sample p + k * factor (coeff is oldest
+       sample first, i.e. reversed), times factor for unity gain */
+    for(uint8_t p = 0; p < factor; p++){
+        for(uint16_t k = 0; k < n_phase_taps; k++){
+            if(p + k * factor < n_taps){
+                interpolator->coeff[p * n_phase_taps + k] = factor * coeff[n_taps - 1 - (p + k * factor)];
+            }
+        }
+    }
+    return true;
+}
+
+int16_t FirInterpolate(fir_interpolator_t *interpolator, const float * input_signal, float * output_signal, int16_t signal_lenght){
+    const uint16_t n_phase_taps = interpolator->n_phase_taps;
+    const float *coeff, *delay;
+    float acc;
+    int16_t out = 0;
+
+    for(int16_t i = 0; i < signal_lenght; i++){
+        /* newest sample first, at pos and pos + n_phase_taps */
+        interpolator->pos = (interpolator->pos == 0) ? n_phase_taps - 1 : interpolator->pos - 1;
+        interpolator->delay[interpolator->pos] = input_signal[i];
+        interpolator->delay[interpolator->pos + n_phase_taps] = input_signal[i];
+        delay = &interpolator->delay[interpolator->pos];
+        coeff = interpolator->coeff;
+        for(uint8_t p = 0; p < interpolator->factor; p++){
+            acc = 0;
+            for(uint16_t k = 0; k < n_phase_taps; k++){
+                acc += *coeff++ * delay[k];
+            }
+            output_signal[out++] = acc;
+        }
+    }
+    return out;
+}
+
+/*==================[end of file]============================================*/
@@ -10,43 +10,36 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
 #include "iir_filter.h"
 #include "esp_dsp.h"
 /*==================[macros and definitions]=================================*/
-#define N_SOS       5
-#define N_DELAY     2
 // 2nd order Butterworth 
-#define ORDER2_Q    (1 / 1.414)
+#define ORDER2_Q    (1 / 1.414f)
 // 4th order Butterworth 
-#define ORDER4_Q1   (1 / 0.765)
-#define ORDER4_Q2   (1 / 1.848)
+#define ORDER4_Q1   (1 / 0.765f)
+#define ORDER4_Q2   (1 / 1.848f)
 // 6th order Butterworth 
-#define ORDER6_Q1   (1 / 0.518)
-#define ORDER6_Q2   (1 / 1.414)
-#define ORDER6_Q3   (1 / 1.932)
+#define ORDER6_Q1   (1 / 0.518f)
+#define ORDER6_Q2   (1 / 1.414f)
+#define ORDER6_Q3   (1 / 1.932f)
 // 8th order Butterworth 
-#define ORDER8_Q1   (1 / 0.390)
-#define ORDER8_Q2   (1 / 1.111)
-#define ORDER8_Q3   (1 / 1.663)
-#define ORDER8_Q4   (1 / 1.962)
+#define ORDER8_Q1   (1 / 0.390f)
+#define ORDER8_Q2   (1 / 1.111f)
+#define ORDER8_Q3   (1 / 1.663f)
+#define ORDER8_Q4   (1 / 1.962f)
+// 1.0 in the Q2.14 coefficients of the fixed-point filters
+#define Q15_ONE     (1L << IIR_Q15_FRAC)
 /*==================[internal data declaration]==============================*/
-static uint8_t lp_order, hp_order;
-float hp2_delay[N_DELAY] = {0, 0};  // delay
-float hp4_delay[N_DELAY] = {0, 0};  // delay
-float hp6_delay[N_DELAY] = {0, 0};  // delay
-float hp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_delay[N_DELAY] = {0, 0};  // delay
-float lp4_delay[N_DELAY] = {0, 0};  // delay
-float lp6_delay[N_DELAY] = {0, 0};  // delay
-float lp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_sos_coeff[N_SOS]; 
-float lp4_sos_coeff[N_SOS]; 
-float lp6_sos_coeff[N_SOS]; 
-float lp8_sos_coeff[N_SOS]; 
-float hp2_sos_coeff[N_SOS]; 
-float hp4_sos_coeff[N_SOS]; 
-float hp6_sos_coeff[N_SOS]; 
-float hp8_sos_coeff[N_SOS]; 
+/* Butterworth Q of each 2nd order section, by filter order */
+static const float sos_q[IIR_MAX_SOS][IIR_MAX_SOS] = {
+    {ORDER2_Q, 0, 0, 0},
+    {ORDER4_Q1, ORDER4_Q2, 0, 0},
+    {ORDER6_Q1, ORDER6_Q2, ORDER6_Q3, 0},
+    {ORDER8_Q1, ORDER8_Q2, ORDER8_Q3, ORDER8_Q4},
+};
+static iir_filter_t lp_filter, hp_filter;  /* filters used by LowPass and HiPass functions */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -54,103 +47,284 @@ float hp8_sos_coeff[N_SOS];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static uint8_t IirDesign(float coeff[][IIR_N_COEFF], float sample_frec, float cut_frec, filter_order_t order, bool hi_pass){
+    float f = cut_frec / sample_frec;
+    uint8_t n_sos = order / 2;
+    for(uint8_t i = 0; i < n_sos; i++){
+        if(hi_pass){
+            dsps_biquad_gen_hpf_f32(coeff[i], f, sos_q[n_sos - 1][i]);
+        } else {
+            dsps_biquad_gen_lpf_f32(coeff[i], f, sos_q[n_sos - 1][i]);
+        }
+    }
+    return n_sos;
+}
+
+static void IirInit(iir_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order, bool hi_pass){
+    filter->n_sos = IirDesign(filter->coeff, sample_frec, cut_frec, order, hi_pass);
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+static void IirMultiInit(iir_multi_filter_t *filter, uint8_t n_channels, float sample_frec, float cut_frec, filter_order_t order, bool hi_pass){
+    filter->n_channels = (n_channels > IIR_MAX_CHANNELS) ? IIR_MAX_CHANNELS : n_channels;
+    filter->n_sos = IirDesign(filter->coeff, sample_frec, cut_frec, order, hi_pass);
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+/* Delay lines of cascaded direct form II sections in the steady state of a
+ * constant input: w = x / (1 + a1 + a2) in each section, whose output
+ * (b0 + b1 + b2) * w is the input of the next one */
+static float WarmStart(const float coeff[][IIR_N_COEFF], float delay[][IIR_N_DELAY], uint8_t n_sos, float x){
+    float w;
+
+    for(uint8_t i = 0; i < n_sos; i++){
+        w = x / (1 + coeff[i][3] + coeff[i][4]);
+        delay[i][0] = w;
+        delay[i][1] = w;
+        x = (coeff[i][0] + coeff[i][1] + coeff[i][2]) * w;
+    }
+    return x;
+}
+
+/* Saturation of a section output to int16 */
+static inline int16_t Saturate16(int32_t x){
+    if(x > INT16_MAX){
+        return INT16_MAX;
+    }
+    if(x < INT16_MIN){
+        return INT16_MIN;
+    }
+    return (int16_t)x;
+}
 
 /*==================[external functions definition]==========================*/
+void IirLowPassInit(iir_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    IirInit(filter, sample_frec, cut_frec, order, false);
+}
 
-void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    lp_order = order;
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
+void IirHiPassInit(iir_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    IirInit(filter, sample_frec, cut_frec, order, true);
+}
+
+void IirNotchInit(iir_filter_t *filter, float sample_frec, float notch_frec, float q){
+    float w0 = 2 * (float)M_PI * notch_frec / sample_frec;
+    float alpha = sinf(w0) / (2 * q);
+    float a0 = 1 + alpha;
+
+    /* zeros on the unit circle at w0, poles just inside: b and a share b1 */
+    filter->n_sos = 1;
+    filter->coeff[0][0] = 1 / a0;
+    filter->coeff[0][1] = -2 * cosf(w0) / a0;
+    filter->coeff[0][2] = 1 / a0;
+    filter->coeff[0][3] = filter->coeff[0][1];
+    filter->coeff[0][4] = (1 - alpha) / a0;
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IirDesignInit(iir_filter_t *filter, const iir_design_t *design){
+    filter->n_sos = design->n_sos;
+    memcpy(filter->coeff, design->coeff, sizeof(filter->coeff));
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IirFilter(iir_filter_t *filter, float * input_signal, float * output_signal, int16_t signal_lenght){
+    switch(filter->n_sos){
+        case 1:
+            /* a single section: the esp-dsp kernel (assembly on ESP32/ESP32-S3) */
+            dsps_biquad_f32(input_signal, output_signal, signal_lenght, filter->coeff[0], filter->delay[0]);
         break;
-        case ORDER_4:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER4_Q2);
+        case 2:
+            IirSosKernel(input_signal, output_signal, signal_lenght, filter->coeff, filter->delay, 2);
         break;
-        case ORDER_6:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER6_Q3);
+        case 3:
+            IirSosKernel(input_signal, output_signal, signal_lenght, filter->coeff, filter->delay, 3);
         break;
-        case ORDER_8:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
+        case 4:
+            IirSosKernel(input_signal, output_signal, signal_lenght, filter->coeff, filter->delay, 4);
         break;
     }
 }
 
-void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    hp_order = order;
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
-        break;
+void IirReset(iir_filter_t *filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+float IirWarmStart(iir_filter_t *filter, float x0){
+    return WarmStart(filter->coeff, filter->delay, filter->n_sos, x0);
+}
+
+float IirDesignWarmStart(const iir_design_t *design, float delay[][IIR_N_DELAY], float x0){
+    return WarmStart(design->coeff, delay, design->n_sos, x0);
+}
+
+void IirSaveState(const iir_filter_t *filter, iir_state_t *state){
+    memcpy(state->delay, filter->delay, sizeof(state->delay));
+}
+
+void IirRestoreState(iir_filter_t *filter, const iir_state_t *state){
+    memcpy(filter->delay, state->delay, sizeof(filter->delay));
+}
+
+void IirFilterMultiPass(iir_filter_t *filter, float * input_signal, float * output_signal, int16_t signal_lenght){
+    for(uint8_t i = 0; i < filter->n_sos; i++){
+        dsps_biquad_f32(input_signal, output_signal, signal_lenght, filter->coeff[i], filter->delay[i]);
+        input_signal = output_signal;
     }
 }
 
-void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
-        break;
+bool IirQ15DesignInit(iir_q15_filter_t *filter, const iir_design_t *design){
+    float c;
+
+    if(design->n_sos == 0 || design->n_sos > IIR_MAX_SOS){
+        return false;
     }
+    for(uint8_t i = 0; i < design->n_sos; i++){
+        for(uint8_t j = 0; j < IIR_N_COEFF; j++){
+            c = roundf(design->coeff[i][j] * Q15_ONE);
+            if(c < INT16_MIN || c > INT16_MAX){
+                return false;
+            }
+            filter->coeff[i][j] = (int16_t)c;
+        }
+    }
+    filter->n_sos = design->n_sos;
+    memset(filter->delay, 0, sizeof(filter->delay));
+    return true;
 }
 
-void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
-        break;
+bool IirQ15LowPassInit(iir_q15_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    iir_design_t design = {0};
+
+    design.n_sos = IirDesign(design.coeff, sample_frec, cut_frec, order, false);
+    return IirQ15DesignInit(filter, &design);
+}
+
+bool IirQ15HiPassInit(iir_q15_filter_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    iir_design_t design = {0};
+
+    design.n_sos = IirDesign(design.coeff, sample_frec, cut_frec, order, true);
+    return IirQ15DesignInit(filter, &design);
+}
+
+void IirQ15Filter(iir_q15_filter_t *filter, const int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght){
+    const int16_t *c;
+    int16_t *d, x;
+    uint32_t acc;
+
+    for(int16_t n = 0; n < signal_lenght; n++){
+        x = input_signal[n];
+        for(uint8_t i = 0; i < filter->n_sos; i++){
+            c = filter->coeff[i];
+            d = filter->delay[i];
+            /* direct form I, products in Q15 * Q2.14. The sum is kept modulo 2^32
+             * (two's complement wrap, as a MAC unit): partial sums may overflow as
+             * long as the section output fits in +-4 full scale */
+            acc = (uint32_t)((int32_t)c[0] * x) + (uint32_t)((int32_t)c[1] * d[0]) + (uint32_t)((int32_t)c[2] * d[1])
+                - (uint32_t)((int32_t)c[3] * d[2]) - (uint32_t)((int32_t)c[4] * d[3]);
+            d[1] = d[0];
+            d[0] = x;
+            x = Saturate16(((int32_t)acc + (1L << (IIR_Q15_FRAC - 1))) >> IIR_Q15_FRAC);
+            d[3] = d[2];
+            d[2] = x;
+        }
+        output_signal[n] = x;
     }
 }
 
+void IirQ15Reset(iir_q15_filter_t *filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+int16_t IirQ15WarmStart(iir_q15_filter_t *filter, int16_t x0){
+    const int16_t *c;
+    int16_t *d, x = x0;
+    float gain;
+
+    for(uint8_t i = 0; i < filter->n_sos; i++){
+        c = filter->coeff[i];
+        d = filter->delay[i];
+        /* DC gain of the quantized coefficients, so the state matches what
+         * IirQ15Filter settles to */
+        gain = (float)(c[0] + c[1] + c[2]) / (float)(Q15_ONE + c[3] + c[4]);
+        d[0] = x;
+        d[1] = x;
+        x = Saturate16(lroundf(gain * x));
+        d[2] = x;
+        d[3] = x;
+    }
+    return x;
+}
+
+void IirMultiLowPassInit(iir_multi_filter_t *filter, uint8_t n_channels, float sample_frec, float cut_frec, filter_order_t order){
+    IirMultiInit(filter, n_channels, sample_frec, cut_frec, order, false);
+}
+
+void IirMultiHiPassInit(iir_multi_filter_t *filter, uint8_t n_channels, float sample_frec, float cut_frec, filter_order_t order){
+    IirMultiInit(filter, n_channels, sample_frec, cut_frec, order, true);
+}
+
+void IirMultiFilter(iir_multi_filter_t *filter, float * input_signal, float * output_signal, int16_t n_frames){
+    uint8_t n_ch = filter->n_channels;
+    float x, d0, *w, *c;
+
+    /* one pass over the interleaved buffer: every frame goes through all the sections of each channel */
+    for(int16_t n = 0; n < n_frames; n++){
+        for(uint8_t ch = 0; ch < n_ch; ch++){
+            x = input_signal[n * n_ch + ch];
+            for(uint8_t i = 0; i < filter->n_sos; i++){
+                c = filter->coeff[i];
+                w = filter->delay[ch][i];
+                /* direct form II, same as dsps_biquad_f32 */
+                d0 = x - c[3] * w[0] - c[4] * w[1];
+                x = c[0] * d0 + c[1] * w[0] + c[2] * w[1];
+                w[1] = w[0];
+                w[0] = d0;
+            }
+            output_signal[n * n_ch + ch] = x;
+        }
+    }
+}
+
+void IirMultiReset(iir_multi_filter_t *filter){
+    memset(filter->delay, 0, sizeof(filter->delay));
+}
+
+void IirMultiWarmStart(iir_multi_filter_t *filter, const float *x0){
+    for(uint8_t ch = 0; ch < filter->n_channels; ch++){
+        WarmStart(filter->coeff, filter->delay[ch], filter->n_sos, x0[ch]);
+    }
+}
+
+void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirLowPassInit(&lp_filter, sample_frec, cut_frec, order);
+}
+
+void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirHiPassInit(&hp_filter, sample_frec, cut_frec, order);
+}
+
+void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilter(&lp_filter, input_signal, output_signal, signal_lenght);
+}
+
+void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilter(&hp_filter, input_signal, output_signal, signal_lenght);
+}
+
+void LowPassReset(void){
+    IirReset(&lp_filter);
+}
+
+void HiPassReset(void){
+    IirReset(&hp_filter);
+}
+
+float LowPassWarmStart(float x0){
+    return IirWarmStart(&lp_filter, x0);
+}
+
+float HiPassWarmStart(float x0){
+    return IirWarmStart(&hp_filter, x0);
+}
+
 /*==================[end of file]============================================*/
\ No newline at end of file
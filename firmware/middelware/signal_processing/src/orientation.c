@@ -0,0 +1,113 @@
+/**
+ * @file orientation.c
+ * @brief Orientation estimation fusing accelerometer and gyroscope (Mahony filter)
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "orientation.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void OrientationInit(orientation_t *ori, float ax, float ay, float az){
+    float roll = atan2f(ay, az);
+    float pitch = atan2f(-ax, sqrtf((ay * ay) + (az * az)));
+    float cr = cosf(roll / 2.0f), sr = sinf(roll / 2.0f);
+    float cp = cosf(pitch / 2.0f), sp = sinf(pitch / 2.0f);
+
+    /* q = q_pitch(Y) * q_roll(X), zero heading */
+    ori->q[0] = cr * cp;
+    ori->q[1] = sr * cp;
+    ori->q[2] = cr * sp;
+    ori->q[3] = -sr * sp;
+    for(uint8_t i = 0; i < 3; i++){
+        ori->bias[i] = 0.0f;
+    }
+    ori->gravity2 = (ax * ax) + (ay * ay) + (az * az);
+    OrientationSetGains(ori, ORIENTATION_KP, ORIENTATION_KI, ORIENTATION_ACCEL_GATE);
+}
+
+void OrientationSetGains(orientation_t *ori, float kp, float ki, float accel_gate){
+    ori->kp = kp;
+    ori->ki = ki;
+    ori->accel_gate = accel_gate;
+}
+
+void OrientationUpdate(orientation_t *ori, float ax, float ay, float az, float gx, float gy, float gz, float dt){
+    float *q = ori->q;
+    float a2 = (ax * ax) + (ay * ay) + (az * az);
+    float v[3], ex, ey, ez, inv, qw, qx, qy, qz;
+    float lim_min = 1.0f - ori->accel_gate, lim_max = 1.0f + ori->accel_gate;
+
+    /* accelerometer correction only when |a| is close to gravity (compared squared) */
+    if((a2 > 0.0f) && ((ori->accel_gate <= 0.0f) ||
+       ((a2 >= lim_min * lim_min * ori->gravity2) && (a2 <= lim_max * lim_max * ori->gravity2)))){
+        inv = 1.0f / sqrtf(a2);
+        ax *= inv;
+        ay *= inv;
+        az *= inv;
+        OrientationGravity(ori, v);
+        /* error: rotation from the estimated to the measured gravity */
+        ex = (ay * v[2]) - (az * v[1]);
+        ey = (az * v[0]) - (ax * v[2]);
+        ez = (ax * v[1]) - (ay * v[0]);
+        if(ori->ki > 0.0f){
+            ori->bias[0] += ori->ki * ex * dt;
+            ori->bias[1] += ori->ki * ey * dt;
+            ori->bias[2] += ori->ki * ez * dt;
+        }
+        gx += ori->kp * ex;
+        gy += ori->kp * ey;
+        gz += ori->kp * ez;
+    }
+    gx += ori->bias[0];
+    gy += ori->bias[1];
+    gz += ori->bias[2];
+
+    /* q += q ⊗ (0, g) · dt / 2 */
+    gx *= 0.5f * dt;
+    gy *= 0.5f * dt;
+    gz *= 0.5f * dt;
+    qw = q[0];
+    qx = q[1];
+    qy = q[2];
+    qz = q[3];
+    q[0] += (-qx * gx) - (qy * gy) - (qz * gz);
+    q[1] += (qw * gx) + (qy * gz) - (qz * gy);
+    q[2] += (qw * gy) - (qx * gz) + (qz * gx);
+    q[3] += (qw * gz) + (qx * gy) - (qy * gx);
+    inv = 1.0f / sqrtf((q[0] * q[0]) + (q[1] * q[1]) + (q[2] * q[2]) + (q[3] * q[3]));
+    for(uint8_t i = 0; i < 4; i++){
+        q[i] *= inv;
+    }
+}
+
+void OrientationQuaternion(const orientation_t *ori, float q[4]){
+    for(uint8_t i = 0; i < 4; i++){
+        q[i] = ori->q[i];
+    }
+}
+
+void OrientationGravity(const orientation_t *ori, float g[3]){
+    const float *q = ori->q;
+
+    /* earth Z axis expressed in the sensor frame (third row of the rotation matrix) */
+    g[0] = 2.0f * ((q[1] * q[3]) - (q[0] * q[2]));
+    g[1] = 2.0f * ((q[0] * q[1]) + (q[2] * q[3]));
+    g[2] = (q[0] * q[0]) - (q[1] * q[1]) - (q[2] * q[2]) + (q[3] * q[3]);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,96 @@
+/**
+ * @file posture_engine.c
+ * @brief Posture state machine with hysteresis and minimum dwell
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "posture_engine.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool PostureEngineInit(posture_engine_t *engine, const posture_engine_config_t *config){
+    PostureEngineReset(engine);
+    engine->config = (posture_engine_config_t){0};
+    return PostureEngineSetConfig(engine, config);
+}
+
+bool PostureEngineConfigValid(const posture_engine_config_t *config){
+    return (config->exit_cdeg <= config->enter_cdeg) && (config->warning_ms <= config->alert_ms);
+}
+
+bool PostureEngineSetConfig(posture_engine_t *engine, const posture_engine_config_t *config){
+    if(!PostureEngineConfigValid(config)){
+        return false;
+    }
+    engine->config = *config;
+    return true;
+}
+
+posture_state_t PostureEngineUpdate(posture_engine_t *engine, uint16_t angle_cdeg, int64_t timestamp_us){
+    uint32_t bad_ms;
+
+    if(engine->bad_since_us < 0){
+        if(angle_cdeg <= engine->config.enter_cdeg && engine->carry_ms == 0){
+            return engine->state;
+        }
+        engine->bad_since_us = timestamp_us;
+        engine->upright_since_us = -1;
+    } else if(angle_cdeg < engine->config.exit_cdeg){
+        /* upright inside a bad period: it ends only after the minimum dwell */
+        if(engine->upright_since_us < 0){
+            engine->upright_since_us = timestamp_us;
+        }
+        if((timestamp_us - engine->upright_since_us) >= (engine->config.dwell_ms * 1000LL)){
+            PostureEngineReset(engine);
+            return engine->state;
+        }
+    } else {
+        engine->upright_since_us = -1;
+    }
+    /* the timers keep running while waiting out the dwell */
+    bad_ms = PostureEngineBadTime(engine, timestamp_us);
+    if(bad_ms >= engine->config.alert_ms){
+        engine->state = POSTURE_ALERT;
+    } else if(bad_ms >= engine->config.warning_ms){
+        engine->state = POSTURE_WARNING;
+    } else {
+        engine->state = POSTURE_CORRECT;
+    }
+    return engine->state;
+}
+
+uint32_t PostureEngineBadTime(const posture_engine_t *engine, int64_t timestamp_us){
+    if(engine->bad_since_us < 0 || timestamp_us < engine->bad_since_us){
+        return engine->carry_ms;
+    }
+    return engine->carry_ms + (uint32_t)((timestamp_us - engine->bad_since_us) / 1000);
+}
+
+void PostureEngineResume(posture_engine_t *engine, uint32_t bad_ms){
+    if(bad_ms > 0){
+        PostureEngineReset(engine);
+        engine->carry_ms = bad_ms;
+    }
+}
+
+void PostureEngineReset(posture_engine_t *engine){
+    engine->state = POSTURE_CORRECT;
+    engine->bad_since_us = -1;
+    engine->upright_since_us = -1;
+    engine->carry_ms = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,120 @@
+/**
+ * @file posture_fusion.c
+ * @brief Per-sensor calibration and fused tilt of several accelerometers
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <string.h>
+#include "posture_fusion.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool PostureFusionInit(posture_fusion_t *fusion, uint8_t count, const uint8_t *weights, float threshold_deg){
+    if(count == 0 || count > POSTURE_FUSION_MAX){
+        return false;
+    }
+    memset(fusion, 0, sizeof(*fusion));
+    fusion->count = count;
+    fusion->threshold_deg = threshold_deg;
+    for(uint8_t i = 0; i < count; i++){
+        fusion->sensor[i].weight = (weights == NULL) ? 1 : weights[i];
+    }
+    return true;
+}
+
+void PostureFusionCalibrationStart(posture_fusion_t *fusion){
+    posture_fusion_sensor_t *s;
+
+    for(uint8_t i = 0; i < fusion->count; i++){
+        s = &fusion->sensor[i];
+        for(uint8_t axis = 0; axis < 3; axis++){
+            WelfordInit(&s->acc[axis]);
+        }
+    }
+}
+
+void PostureFusionCalibrationAdd(posture_fusion_t *fusion, uint8_t sensor, float x, float y, float z){
+    posture_fusion_sensor_t *s = &fusion->sensor[sensor];
+
+    WelfordAdd(&s->acc[0], x);
+    WelfordAdd(&s->acc[1], y);
+    WelfordAdd(&s->acc[2], z);
+}
+
+bool PostureFusionCalibrationEnd(const posture_fusion_t *fusion, uint8_t sensor, posture_calibration_t *cal){
+    const posture_fusion_sensor_t *s = &fusion->sensor[sensor];
+    float variance = 0;
+
+    if(s->acc[0].n == 0){
+        return false;
+    }
+    for(uint8_t axis = 0; axis < 3; axis++){
+        cal->base[axis] = s->acc[axis].mean;
+        variance += WelfordVariance(&s->acc[axis]);
+    }
+    /* total dispersion of the three axes */
+    cal->dispersion = sqrtf(variance);
+    return true;
+}
+
+void PostureFusionSetCalibration(posture_fusion_t *fusion, uint8_t sensor, const posture_calibration_t *cal){
+    posture_fusion_sensor_t *s = &fusion->sensor[sensor];
+
+    s->cal = *cal;
+    PostureRefInit(&s->ref, cal->base[0], cal->base[1], cal->base[2], fusion->threshold_deg);
+    s->angle_cdeg = 0;
+    s->calibrated = true;
+}
+
+void PostureFusionClearCalibration(posture_fusion_t *fusion){
+    for(uint8_t i = 0; i < fusion->count; i++){
+        fusion->sensor[i].calibrated = false;
+        fusion->sensor[i].angle_cdeg = 0;
+    }
+}
+
+bool PostureFusionReady(const posture_fusion_t *fusion){
+    for(uint8_t i = 0; i < fusion->count; i++){
+        if(!fusion->sensor[i].calibrated){
+            return false;
+        }
+    }
+    return fusion->count > 0;
+}
+
+uint16_t PostureFusionUpdate(posture_fusion_t *fusion, uint8_t sensor, int16_t x_mg, int16_t y_mg, int16_t z_mg){
+    posture_fusion_sensor_t *s = &fusion->sensor[sensor];
+
+    s->angle_cdeg = PostureAngleFixed(&s->ref, x_mg, y_mg, z_mg);
+    return s->angle_cdeg;
+}
+
+uint16_t PostureFusionScore(const posture_fusion_t *fusion){
+    const posture_fusion_sensor_t *s;
+    uint32_t sum = 0, weights = 0;
+
+    for(uint8_t i = 0; i < fusion->count; i++){
+        s = &fusion->sensor[i];
+        if(s->calibrated){
+            sum += (uint32_t)s->angle_cdeg * s->weight;
+            weights += s->weight;
+        }
+    }
+    return (weights == 0) ? 0 : (uint16_t)((sum + weights / 2) / weights);
+}
+
+/*==================[end of file]============================================*/
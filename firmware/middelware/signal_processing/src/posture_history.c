@@ -0,0 +1,112 @@
+/**
+ * @file posture_history.c
+ * @brief Per-minute posture statistics in a fixed size ring
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stddef.h>
+#include <string.h>
+#include "posture_history.h"
+/*==================[macros and definitions]=================================*/
+#define MINUTE_US   60000000LL
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void StartMinute(posture_history_t *history){
+    memset(&history->current, 0, sizeof(history->current));
+    history->current.minute = history->ring.next_minute;
+    history->angle_sum = 0;
+    history->samples = 0;
+}
+
+static void CloseMinute(posture_history_t *history){
+    posture_history_ring_t *ring = &history->ring;
+
+    if(history->samples > 0){
+        history->current.mean_cdeg = history->angle_sum / history->samples;
+    }
+    ring->entries[ring->head] = history->current;
+    ring->head = (ring->head + 1) % POSTURE_HISTORY_LEN;
+    if(ring->count < POSTURE_HISTORY_LEN){
+        ring->count++;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+void PostureHistoryInit(posture_history_t *history, const posture_history_ring_t *restored){
+    if(restored != NULL && restored->head < POSTURE_HISTORY_LEN && restored->count <= POSTURE_HISTORY_LEN){
+        history->ring = *restored;
+    } else {
+        memset(&history->ring, 0, sizeof(history->ring));
+    }
+    history->last_state = POSTURE_CORRECT;
+    history->minute_start_us = -1;
+    history->last_us = -1;
+    StartMinute(history);
+}
+
+bool PostureHistoryAdd(posture_history_t *history, posture_state_t state, uint16_t angle_cdeg, int64_t timestamp_us){
+    bool closed = false;
+    int64_t elapsed_us;
+
+    if(history->minute_start_us < 0){
+        history->minute_start_us = timestamp_us;
+    }
+    elapsed_us = timestamp_us - history->minute_start_us;
+    if(elapsed_us >= MINUTE_US){
+        CloseMinute(history);
+        closed = true;
+        if(elapsed_us >= 2 * MINUTE_US){
+            /* samples missing for minutes: skip their numbers, do not store empty entries */
+            history->ring.next_minute += elapsed_us / MINUTE_US;
+            history->minute_start_us = timestamp_us;
+        } else {
+            history->ring.next_minute++;
+            history->minute_start_us += MINUTE_US;
+        }
+        StartMinute(history);
+    }
+    /* the time since the previous sample belongs to the previous state */
+    if(history->last_us >= 0 && timestamp_us > history->last_us){
+        int64_t dt_ms = (timestamp_us - history->last_us) / 1000;
+        if(dt_ms <= POSTURE_HISTORY_MAX_GAP_MS && history->last_state < POSTURE_HISTORY_STATES){
+            /* packed struct: no pointers to its members */
+            int64_t acc = history->current.state_ms[history->last_state] + dt_ms;
+            history->current.state_ms[history->last_state] = (acc > UINT16_MAX) ? UINT16_MAX : acc;
+        }
+    }
+    if(state == POSTURE_ALERT && history->last_state != POSTURE_ALERT && history->current.alerts < UINT8_MAX){
+        history->current.alerts++;
+    }
+    history->angle_sum += angle_cdeg;
+    history->samples++;
+    if(angle_cdeg > history->current.max_cdeg){
+        history->current.max_cdeg = angle_cdeg;
+    }
+    history->last_state = state;
+    history->last_us = timestamp_us;
+    return closed;
+}
+
+uint16_t PostureHistoryRead(const posture_history_ring_t *ring, posture_minute_t *entries, uint16_t max){
+    uint16_t n = (ring->count < max) ? ring->count : max;
+    /* the newest n entries end just before head */
+    uint16_t index = (ring->head + POSTURE_HISTORY_LEN - n) % POSTURE_HISTORY_LEN;
+
+    for(uint16_t i = 0; i < n; i++){
+        entries[i] = ring->entries[index];
+        index = (index + 1) % POSTURE_HISTORY_LEN;
+    }
+    return n;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,145 @@
+/**
+ * @file posture_math.c
+ * @brief Tilt angle between an acceleration vector and a calibrated reference
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include "posture_math.h"
+/*==================[macros and definitions]=================================*/
+#define RAD_TO_DEG          (180.0f / 3.14159265f)
+#define CORDIC_ITERATIONS   16
+#define CORDIC_LIMIT        (1L << 29)  /* keeps the CORDIC gain (1.647) inside an int32 */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/* atan(2^-i) in thousandths of degree */
+static const int32_t cordic_atan_mdeg[CORDIC_ITERATIONS] = {
+    45000, 26565, 14036, 7125, 3576, 1790, 895, 448,
+    224, 112, 56, 28, 14, 7, 3, 2
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint64_t Isqrt64(uint64_t value){
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while(bit > value){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/* atan(y / x) for x, y >= 0 in thousandths of degree (CORDIC vectoring mode) */
+static int32_t CordicAtan2(int64_t y, int64_t x){
+    int32_t xi, yi, tmp, angle = 0;
+
+    while(x >= CORDIC_LIMIT || y >= CORDIC_LIMIT){
+        x >>= 1;
+        y >>= 1;
+    }
+    xi = (int32_t)x;
+    yi = (int32_t)y;
+    for(uint8_t i = 0; i < CORDIC_ITERATIONS; i++){
+        tmp = xi;
+        if(yi > 0){
+            xi += yi >> i;
+            yi -= tmp >> i;
+            angle += cordic_atan_mdeg[i];
+        } else {
+            xi -= yi >> i;
+            yi += tmp >> i;
+            angle -= cordic_atan_mdeg[i];
+        }
+    }
+    return angle;
+}
+
+/*==================[external functions definition]==========================*/
+void PostureRefInit(posture_ref_t *ref, float x, float y, float z, float umbral_deg){
+    float mag = sqrtf(x * x + y * y + z * z);
+    float v[3] = {x, y, z};
+
+    ref->valid = (mag > 0.0f);
+    for(uint8_t i = 0; i < 3; i++){
+        ref->ref[i] = ref->valid ? (v[i] / mag) : 0.0f;
+        ref->ref_q15[i] = (int16_t)lrintf(ref->ref[i] * POSTURE_Q15_ONE);
+    }
+    ref->cos_umbral = cosf(umbral_deg / RAD_TO_DEG);
+    ref->cos2_umbral = ref->cos_umbral * ref->cos_umbral;
+}
+
+bool PostureOverThreshold(const posture_ref_t *ref, float ax, float ay, float az){
+    float dot = (ax * ref->ref[0]) + (ay * ref->ref[1]) + (az * ref->ref[2]);
+    float mag2 = (ax * ax) + (ay * ay) + (az * az);
+
+    if(!ref->valid || mag2 == 0.0f){
+        return false;
+    }
+    /* angle > threshold <=> dot / |a| < cos(threshold) */
+    if(ref->cos_umbral >= 0.0f){
+        if(dot <= 0.0f){
+            return true;
+        }
+        return (dot * dot) < (ref->cos2_umbral * mag2);
+    }
+    return dot < (ref->cos_umbral * sqrtf(mag2));
+}
+
+float PostureAngle(const posture_ref_t *ref, float ax, float ay, float az){
+    float dot = (ax * ref->ref[0]) + (ay * ref->ref[1]) + (az * ref->ref[2]);
+    float mag = sqrtf((ax * ax) + (ay * ay) + (az * az));
+    float cos_theta;
+
+    if(!ref->valid || mag == 0.0f){
+        return 0.0f;
+    }
+    cos_theta = dot / mag;
+    /* rounding errors may take it out of [-1, 1] */
+    if(cos_theta > 1.0f){
+        cos_theta = 1.0f;
+    } else if(cos_theta < -1.0f){
+        cos_theta = -1.0f;
+    }
+    return acosf(cos_theta) * RAD_TO_DEG;
+}
+
+uint16_t PostureAngleFixed(const posture_ref_t *ref, int16_t ax, int16_t ay, int16_t az){
+    const int16_t *r = ref->ref_q15;
+    int64_t dot, cx, cy, cz;
+    int32_t angle;
+
+    if(!ref->valid || (ax == 0 && ay == 0 && az == 0)){
+        return 0;
+    }
+    /* |a|·cos and |a|·sin in Q15 (|ref| = 1): dot and cross products */
+    dot = ((int64_t)ax * r[0]) + ((int64_t)ay * r[1]) + ((int64_t)az * r[2]);
+    cx = ((int64_t)ay * r[2]) - ((int64_t)az * r[1]);
+    cy = ((int64_t)az * r[0]) - ((int64_t)ax * r[2]);
+    cz = ((int64_t)ax * r[1]) - ((int64_t)ay * r[0]);
+    angle = CordicAtan2((int64_t)Isqrt64((uint64_t)((cx * cx) + (cy * cy) + (cz * cz))), (dot < 0) ? -dot : dot);
+    if(angle < 0){
+        angle = 0;
+    }
+    if(dot < 0){
+        angle = 180000 - angle;
+    }
+    return (uint16_t)((angle + 5) / 10);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,403 @@
+/**
+ * @file posture_pipeline.c
+ * @brief Posture detection from raw samples: filter, calibration, tilt and state machine
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <math.h>
+#include <string.h>
+#include "posture_pipeline.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Acceleration in mili-g, saturated to int16_t
+ */
+static int16_t MilliG(float g){
+    float mg = g * 1000.0f;
+
+    if(mg > INT16_MAX){
+        return INT16_MAX;
+    }
+    if(mg < INT16_MIN){
+        return INT16_MIN;
+    }
+    return (int16_t)lrintf(mg);
+}
+
+static float Magnitude(const float v[3]){
+    return sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+/**
+ * @brief Designs the filter chains of a sensor, the decimation from sample_frec to output_frec
+ */
+static bool ChannelFilters(posture_channel_t *channel, const filter_stage_config_t *config, uint8_t n_stages,
+                           float sample_frec, float output_frec){
+    filter_stage_config_t stages[FILTER_CHAIN_MAX_STAGES];
+    uint8_t last = n_stages - 1;
+
+    memcpy(stages, config, n_stages * sizeof(filter_stage_config_t));
+    stages[last].factor = (uint8_t)lrintf(sample_frec / output_frec);
+    if(stages[last].factor == 0 || (POSTURE_PIPELINE_BLOCK % stages[last].factor) != 0){
+        return false;
+    }
+    for(uint8_t axis = 0; axis < 3; axis++){
+        if(!FilterChainInit(&channel->filter[axis], sample_frec, stages, n_stages)){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Uses a calibration on a sensor and keeps it as the limit of the refinement
+ */
+static void SetCalibration(posture_pipeline_t *pipeline, uint8_t s, const posture_calibration_t *cal){
+    posture_channel_t *channel = &pipeline->channel[s];
+
+    PostureFusionSetCalibration(&pipeline->fusion, s, cal);
+    PostureRefInit(&channel->anchor, cal->base[0], cal->base[1], cal->base[2], pipeline->config.threshold_deg);
+    StabilityReset(&channel->stability);
+    channel->refined = false;
+}
+
+/**
+ * @brief Gives the refined references as a result, at the end of a still period
+ *
+ * A measured calibration not taken yet keeps its flags, with the refined references.
+ */
+static void RefineEnd(posture_pipeline_t *pipeline){
+    posture_cal_result_t *result = &pipeline->result;
+    bool measured_pending = pipeline->new_result && !result->refined;
+    float dispersion = 0;
+
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        result->measured[s] = pipeline->fusion.sensor[s].calibrated;
+        if(result->measured[s]){
+            result->sensor[s] = pipeline->fusion.sensor[s].cal;
+            dispersion = fmaxf(dispersion, result->sensor[s].dispersion);
+        }
+    }
+    if(!measured_pending){
+        result->dispersion = dispersion;
+        result->drift = 0;
+        result->still = true;
+        result->refined = true;
+    }
+    pipeline->new_result = true;
+}
+
+/**
+ * @brief Moves the reference of a sensor towards a still sample taken in correct posture
+ */
+static void Refine(posture_pipeline_t *pipeline, uint8_t s, float x, float y, float z){
+    posture_channel_t *channel = &pipeline->channel[s];
+    posture_fusion_sensor_t *sensor = &pipeline->fusion.sensor[s];
+    posture_calibration_t cal;
+    const float sample[3] = {x, y, z};
+    bool still = StabilityAdd(&channel->stability, x, y, z);
+
+    if(!still || pipeline->engine.state != POSTURE_CORRECT ||
+       sensor->angle_cdeg > pipeline->config.refine_max_tilt_deg * 100.0f){
+        if(channel->refined){
+            channel->refined = false;
+            RefineEnd(pipeline);
+        }
+        return;
+    }
+    cal = sensor->cal;
+    for(uint8_t axis = 0; axis < 3; axis++){
+        cal.base[axis] += pipeline->config.refine_rate * (sample[axis] - cal.base[axis]);
+    }
+    // Beyond refine_max_deg the sensor moved too much: it needs a new calibration
+    if(PostureAngle(&channel->anchor, cal.base[0], cal.base[1], cal.base[2]) > pipeline->config.refine_max_deg){
+        return;
+    }
+    PostureFusionSetCalibration(&pipeline->fusion, s, &cal);
+    channel->refined = true;
+}
+
+/**
+ * @brief Ends a calibration period: verifies the restored calibration or uses the measured one
+ */
+static void CalibrationEnd(posture_pipeline_t *pipeline){
+    posture_cal_result_t *result = &pipeline->result;
+    posture_fusion_sensor_t *sensor;
+    float dispersion = 0, drift = 0;
+
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        sensor = &pipeline->fusion.sensor[s];
+        result->measured[s] = PostureFusionCalibrationEnd(&pipeline->fusion, s, &result->sensor[s]);
+        if(!result->measured[s]){
+            continue;
+        }
+        dispersion = fmaxf(dispersion, result->sensor[s].dispersion);
+        if(sensor->calibrated){
+            drift = fmaxf(drift, fabsf(Magnitude(result->sensor[s].base) - Magnitude(sensor->cal.base)));
+        }
+    }
+    if(pipeline->phase == POSTURE_CAL_VERIFYING){
+        // Movement hides the drift: the restored calibration is kept
+        if(dispersion > pipeline->config.max_dispersion || drift <= pipeline->config.max_drift){
+            pipeline->phase = POSTURE_CAL_DONE;
+            return;
+        }
+        result->drift = drift;
+    } else {
+        result->drift = 0;
+    }
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        if(result->measured[s]){
+            SetCalibration(pipeline, s, &result->sensor[s]);
+        }
+    }
+    result->dispersion = dispersion;
+    result->still = (dispersion <= pipeline->config.max_dispersion);
+    result->refined = false;
+    pipeline->new_result = true;
+    pipeline->calibrated = true;
+    pipeline->phase = POSTURE_CAL_DONE;
+}
+
+/**
+ * @brief Filters the block of a sensor and processes the filtered samples
+ */
+static uint8_t ProcessBlock(posture_pipeline_t *pipeline, uint8_t s, posture_output_t *out){
+    posture_channel_t *channel = &pipeline->channel[s];
+    posture_output_t *o;
+    float x, y, z;
+    int64_t time;
+    int16_t length;
+    uint8_t n = 0;
+
+    FilterChainProcess(&channel->filter[0], channel->block[0], POSTURE_PIPELINE_BLOCK);
+    FilterChainProcess(&channel->filter[1], channel->block[1], POSTURE_PIPELINE_BLOCK);
+    length = FilterChainProcess(&channel->filter[2], channel->block[2], POSTURE_PIPELINE_BLOCK);
+    channel->length = 0;
+
+    for(int16_t k = 0; k < length; k++){
+        x = channel->block[0][k];
+        y = channel->block[1][k];
+        z = channel->block[2][k];
+        // Each decimated sample stands for the last raw sample of its group
+        time = channel->block_t[(k + 1) * channel->filter[2].decimation - 1];
+
+        if(s == POSTURE_PIPELINE_MAIN && pipeline->cal_start_us < 0){
+            pipeline->cal_start_us = time;
+            PostureFusionCalibrationStart(&pipeline->fusion);
+        }
+        if(pipeline->phase != POSTURE_CAL_DONE){
+            PostureFusionCalibrationAdd(&pipeline->fusion, s, x, y, z);
+            if(s == POSTURE_PIPELINE_MAIN &&
+               (time - pipeline->cal_start_us) >= (int64_t)pipeline->config.calibration_ms * 1000){
+                CalibrationEnd(pipeline);
+            }
+        }
+        if(pipeline->calibrated && pipeline->fusion.sensor[s].calibrated){
+            if(pipeline->config.refine_rate > 0 && pipeline->phase == POSTURE_CAL_DONE){
+                Refine(pipeline, s, x, y, z);
+            }
+            PostureFusionUpdate(&pipeline->fusion, s, MilliG(x), MilliG(y), MilliG(z));
+        }
+        if(s != POSTURE_PIPELINE_MAIN){
+            continue;
+        }
+
+        o = &out[n++];
+        o->x = x;
+        o->y = y;
+        o->z = z;
+        o->timestamp_us = time;
+        o->calibrated = pipeline->calibrated;
+        o->activity = ACTIVITY_STILL;
+        if(pipeline->calibrated){
+            o->angle_cdeg = PostureFusionScore(&pipeline->fusion);
+            if(pipeline->config.activity_model != NULL){
+                ActivityAdd(&pipeline->activity, x, y, z, o->angle_cdeg / 100.0f);
+                o->activity = pipeline->activity.activity;
+            }
+            o->state = PostureEngineUpdate(&pipeline->engine, o->angle_cdeg, time);
+            o->bad_ms = PostureEngineBadTime(&pipeline->engine, time);
+            // Reaching or walking: the tilt is not a held posture (yet). The
+            // engine keeps timing, a movement that ends in a held bad posture
+            // is reported from when it began
+            if(o->activity != ACTIVITY_STILL){
+                o->state = POSTURE_CORRECT;
+                o->bad_ms = 0;
+            }
+        } else {
+            // Calibrating: the bad posture period in progress is no longer valid
+            PostureEngineReset(&pipeline->engine);
+            o->angle_cdeg = 0;
+            o->state = POSTURE_CORRECT;
+            o->bad_ms = 0;
+        }
+    }
+    return n;
+}
+/*==================[external functions definition]==========================*/
+bool PosturePipelineInit(posture_pipeline_t *pipeline, const posture_pipeline_config_t *config,
+                         const float *sample_frec, uint8_t count){
+    uint8_t last = config->n_stages - 1;
+
+    if(config->n_stages == 0 || config->n_stages > FILTER_CHAIN_MAX_STAGES ||
+       config->stages[last].type != STAGE_DECIMATE || config->output_frec <= 0 ||
+       config->refine_rate < 0 || config->refine_rate >= 1){
+        return false;
+    }
+    memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->config = *config;
+    pipeline->config.stages = NULL;     // the copies are in the filter chains
+    if(!PostureFusionInit(&pipeline->fusion, count, NULL, config->threshold_deg) ||
+       !PostureEngineInit(&pipeline->engine, &config->engine)){
+        return false;
+    }
+    if(config->activity_model != NULL &&
+       !ActivityInit(&pipeline->activity, config->activity_model, config->output_frec)){
+        return false;
+    }
+    for(uint8_t s = 0; s < count; s++){
+        if(!ChannelFilters(&pipeline->channel[s], config->stages, config->n_stages, sample_frec[s],
+                           config->output_frec)){
+            return false;
+        }
+        StabilityInit(&pipeline->channel[s].stability, 1000.0f / (POSTURE_PIPELINE_STILL_MS * config->output_frec),
+                      config->refine_max_std, (uint32_t)(config->refine_hold_ms * config->output_frec / 1000.0f));
+    }
+    pipeline->count = count;
+    pipeline->phase = POSTURE_CAL_MEASURING;
+    pipeline->cal_start_us = -1;
+    return true;
+}
+
+void PosturePipelineRestore(posture_pipeline_t *pipeline, const posture_calibration_t *cal){
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        SetCalibration(pipeline, s, &cal[s]);
+    }
+    pipeline->calibrated = true;
+    pipeline->phase = POSTURE_CAL_VERIFYING;
+    pipeline->cal_start_us = -1;
+}
+
+void PosturePipelineSaveState(const posture_pipeline_t *pipeline, int64_t timestamp_us, posture_pipeline_state_t *state){
+    memset(state, 0, sizeof(*state));
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        state->sensor[s] = pipeline->fusion.sensor[s].cal;
+        state->anchor[s] = pipeline->channel[s].anchor;
+        state->calibrated[s] = pipeline->fusion.sensor[s].calibrated;
+    }
+    state->count = pipeline->count;
+    state->phase = pipeline->phase;
+    state->bad_ms = PostureEngineBadTime(&pipeline->engine, timestamp_us);
+}
+
+bool PosturePipelineRestoreState(posture_pipeline_t *pipeline, const posture_pipeline_state_t *state){
+    if(state->count != pipeline->count){
+        return false;
+    }
+    if(state->phase == POSTURE_CAL_MEASURING){
+        PosturePipelineRecalibrate(pipeline);
+        return true;
+    }
+    PostureFusionClearCalibration(&pipeline->fusion);
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        if(state->calibrated[s]){
+            PostureFusionSetCalibration(&pipeline->fusion, s, &state->sensor[s]);
+        }
+        pipeline->channel[s].anchor = state->anchor[s];
+        StabilityReset(&pipeline->channel[s].stability);
+        pipeline->channel[s].refined = false;
+    }
+    pipeline->calibrated = true;
+    pipeline->phase = POSTURE_CAL_DONE;
+    pipeline->cal_start_us = -1;
+    PostureEngineReset(&pipeline->engine);
+    PostureEngineResume(&pipeline->engine, state->bad_ms);
+    return true;
+}
+
+void PosturePipelineRecalibrate(posture_pipeline_t *pipeline){
+    PostureFusionClearCalibration(&pipeline->fusion);
+    for(uint8_t s = 0; s < pipeline->count; s++){
+        StabilityReset(&pipeline->channel[s].stability);
+        pipeline->channel[s].refined = false;
+    }
+    if(pipeline->config.activity_model != NULL){
+        ActivityReset(&pipeline->activity);
+    }
+    pipeline->calibrated = false;
+    pipeline->phase = POSTURE_CAL_MEASURING;
+    pipeline->cal_start_us = -1;
+}
+
+bool PosturePipelineSetSampleFrec(posture_pipeline_t *pipeline, uint8_t sensor, float sample_frec){
+    posture_channel_t *channel;
+    filter_stage_config_t stages[FILTER_CHAIN_MAX_STAGES];
+    uint8_t n_stages;
+
+    if(sensor >= pipeline->count){
+        return false;
+    }
+    channel = &pipeline->channel[sensor];
+    // the chains keep the stages given to PosturePipelineInit
+    n_stages = channel->filter[0].n_stages;
+    for(uint8_t i = 0; i < n_stages; i++){
+        stages[i] = channel->filter[0].stage[i].config;
+    }
+    // an invalid frequency is rejected before the chains change
+    if(!ChannelFilters(channel, stages, n_stages, sample_frec, pipeline->config.output_frec)){
+        return false;
+    }
+    // samples of the old frequency: the new chains start at the next block
+    channel->length = 0;
+    return true;
+}
+
+bool PosturePipelineSetConfig(posture_pipeline_t *pipeline, const posture_engine_config_t *config){
+    if(!PostureEngineSetConfig(&pipeline->engine, config)){
+        return false;
+    }
+    pipeline->config.engine = *config;
+    return true;
+}
+
+uint8_t PosturePipelineAdd(posture_pipeline_t *pipeline, uint8_t sensor, float x, float y, float z,
+                           int64_t timestamp_us, posture_output_t *out){
+    posture_channel_t *channel;
+
+    if(sensor >= pipeline->count){
+        return 0;
+    }
+    channel = &pipeline->channel[sensor];
+    channel->block[0][channel->length] = x;
+    channel->block[1][channel->length] = y;
+    channel->block[2][channel->length] = z;
+    channel->block_t[channel->length] = timestamp_us;
+    if(++channel->length < POSTURE_PIPELINE_BLOCK){
+        return 0;
+    }
+    return ProcessBlock(pipeline, sensor, out);
+}
+
+bool PosturePipelineTakeCalibration(posture_pipeline_t *pipeline, posture_cal_result_t *result){
+    if(!pipeline->new_result){
+        return false;
+    }
+    *result = pipeline->result;
+    pipeline->new_result = false;
+    return true;
+}
+
+/*==================[end of file]============================================*/
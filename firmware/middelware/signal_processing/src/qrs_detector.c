@@ -0,0 +1,158 @@
+/**
+ * @file qrs_detector.c
+ * @brief Streaming QRS detector and heart rate estimator (Pan-Tompkins)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "qrs_detector.h"
+/*==================[macros and definitions]=================================*/
+#define WINDOW_MS       150
+#define REFRACTORY_MS   200
+#define LEARNING_S      2
+#define SEARCH_BACK     166     /* % of the average RR without QRS to search back */
+/* the integral and 8 times a level must fit in 32 bits */
+#define MAX_SQUARE      (UINT32_MAX / (8 * QRS_MAX_WINDOW))
+#define MAX_DERIVATIVE  2896    /* sqrt(MAX_SQUARE) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void UpdateThreshold(qrs_detector_t *qrs){
+    qrs->threshold = qrs->npki + (qrs->spki - qrs->npki) / 4;
+}
+
+static void AddQrs(qrs_detector_t *qrs, uint32_t at){
+    uint32_t rr = at - qrs->last_qrs;
+
+    if(qrs->qrs_found){
+        if(rr > UINT16_MAX){
+            rr = UINT16_MAX;
+        }
+        if(qrs->rr_count == QRS_RR_AVERAGE){
+            qrs->rr_sum -= qrs->rr[qrs->rr_pos];
+        } else {
+            qrs->rr_count++;
+        }
+        qrs->rr[qrs->rr_pos] = rr;
+        qrs->rr_sum += rr;
+        qrs->rr_pos = (qrs->rr_pos + 1) % QRS_RR_AVERAGE;
+    }
+    qrs->qrs_found = true;
+    qrs->last_qrs = at;
+    qrs->search_back = 0;
+}
+
+/* A peak of the integral, found when it falls to half its value */
+static bool ClassifyPeak(qrs_detector_t *qrs, uint32_t peak, uint32_t at){
+    if(qrs->learning > 0){
+        /* levels are learned from the whole learning period */
+        return false;
+    }
+    if(peak > qrs->threshold && (!qrs->qrs_found || at - qrs->last_qrs > qrs->refractory)){
+        qrs->spki = (peak + 7 * qrs->spki) / 8;
+        UpdateThreshold(qrs);
+        AddQrs(qrs, at);
+        return true;
+    }
+    qrs->npki = (peak + 7 * qrs->npki) / 8;
+    UpdateThreshold(qrs);
+    if(peak > qrs->threshold / 2 && peak > qrs->search_back &&
+       (!qrs->qrs_found || at - qrs->last_qrs > qrs->refractory)){
+        qrs->search_back = peak;
+        qrs->search_back_at = at;
+    }
+    return false;
+}
+
+/* No QRS for too long: the best candidate since the last one is taken */
+static bool SearchBack(qrs_detector_t *qrs){
+    if(qrs->rr_count == 0 || qrs->search_back == 0 ||
+       (qrs->count - qrs->last_qrs) * 100 < (qrs->rr_sum / qrs->rr_count) * SEARCH_BACK){
+        return false;
+    }
+    qrs->spki = (qrs->search_back + 3 * qrs->spki) / 4;
+    UpdateThreshold(qrs);
+    AddQrs(qrs, qrs->search_back_at);
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool QrsDetectorInit(qrs_detector_t *qrs, uint16_t sample_frec){
+    uint16_t window = (uint32_t)sample_frec * WINDOW_MS / 1000;
+
+    if(window < 2 || window > QRS_MAX_WINDOW){
+        return false;
+    }
+    memset(qrs, 0, sizeof(qrs_detector_t));
+    qrs->sample_frec = sample_frec;
+    qrs->window = window;
+    qrs->refractory = (uint32_t)sample_frec * REFRACTORY_MS / 1000;
+    qrs->learning = (uint32_t)sample_frec * LEARNING_S;
+    return true;
+}
+
+uint8_t QrsDetectorProcess(qrs_detector_t *qrs, const float *ecg, int16_t length){
+    uint8_t found = 0;
+    int32_t x, d;
+    uint32_t square;
+
+    for(int16_t i = 0; i < length; i++){
+        /* derivative */
+        x = (int32_t)ecg[i];
+        if(qrs->count == 0){
+            /* no step from zero on the first sample */
+            qrs->x[0] = qrs->x[1] = qrs->x[2] = qrs->x[3] = x;
+        }
+        d = 2 * x + qrs->x[3] - qrs->x[1] - 2 * qrs->x[0];
+        qrs->x[0] = qrs->x[1];
+        qrs->x[1] = qrs->x[2];
+        qrs->x[2] = qrs->x[3];
+        qrs->x[3] = x;
+        /* square and moving window integration */
+        d = (d < 0) ? -d : d;
+        square = (d > MAX_DERIVATIVE) ? MAX_SQUARE : (uint32_t)(d * d);
+        qrs->mwi += square - qrs->square[qrs->pos];
+        qrs->square[qrs->pos] = square;
+        qrs->pos = (qrs->pos + 1) % qrs->window;
+        qrs->count++;
+        /* peaks */
+        if(qrs->mwi > qrs->mwi_max){
+            qrs->mwi_max = qrs->mwi;
+            qrs->mwi_max_at = qrs->count;
+        } else if(qrs->mwi < qrs->mwi_max / 2){
+            found += ClassifyPeak(qrs, qrs->mwi_max, qrs->mwi_max_at);
+            qrs->mwi_max = qrs->mwi;
+        }
+        if(qrs->learning > 0){
+            /* signal level: a third of the highest peak, noise level: half the mean */
+            if(qrs->mwi / 3 > qrs->spki){
+                qrs->spki = qrs->mwi / 3;
+            }
+            qrs->npki += qrs->mwi / (2 * qrs->sample_frec * LEARNING_S);
+            if(--qrs->learning == 0){
+                UpdateThreshold(qrs);
+            }
+        } else {
+            found += SearchBack(qrs);
+        }
+    }
+    return found;
+}
+
+uint16_t QrsHeartRate(const qrs_detector_t *qrs){
+    if(qrs->rr_count == 0){
+        return 0;
+    }
+    return (60UL * qrs->sample_frec * qrs->rr_count + qrs->rr_sum / 2) / qrs->rr_sum;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,72 @@
+/**
+ * @file rate_controller.c
+ * @brief Sample rate level from the dispersion of the tilt and the posture state
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "rate_controller.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool RateControllerInit(rate_controller_t *rc, const rate_controller_config_t *config){
+    if(config->levels == 0 || config->levels > RATE_CONTROLLER_MAX_LEVELS ||
+       config->alpha <= 0 || config->alpha > 1 || config->slow_std_deg >= config->fast_std_deg){
+        return false;
+    }
+    rc->config = *config;
+    RateControllerReset(rc);
+    return true;
+}
+
+void RateControllerReset(rate_controller_t *rc){
+    EwmaStatsInit(&rc->tilt, rc->config.alpha);
+    rc->level = 0;
+    rc->state = POSTURE_CORRECT;
+    rc->calm_since_us = -1;
+}
+
+bool RateControllerAdd(rate_controller_t *rc, float tilt_deg, posture_state_t state, bool moving,
+                       int64_t timestamp_us){
+    const rate_controller_config_t *c = &rc->config;
+    uint8_t level = rc->level;
+    float var;
+
+    EwmaStatsAdd(&rc->tilt, tilt_deg);
+    var = rc->tilt.var;
+    if(moving || state != rc->state || var >= c->fast_std_deg * c->fast_std_deg){
+        rc->level = 0;
+        rc->calm_since_us = -1;
+    } else if(var < c->slow_std_deg * c->slow_std_deg){
+        if(rc->calm_since_us < 0){
+            rc->calm_since_us = timestamp_us;
+        } else if(rc->level < c->levels - 1 &&
+                  (timestamp_us - rc->calm_since_us) >= (int64_t)c->hold_ms * 1000){
+            // one step at a time, each one after another hold_ms
+            rc->level++;
+            rc->calm_since_us = timestamp_us;
+        }
+    } else {
+        rc->calm_since_us = -1;
+    }
+    rc->state = state;
+    return rc->level != level;
+}
+
+uint8_t RateControllerLevel(const rate_controller_t *rc){
+    return rc->level;
+}
+
+/*==================[end of file]============================================*/
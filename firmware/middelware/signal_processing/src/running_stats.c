@@ -0,0 +1,94 @@
+/**
+ * @file running_stats.c
+ * @brief Incremental statistics, one sample at a time
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "running_stats.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void WelfordInit(welford_t *w){
+    w->n = 0;
+    w->mean = 0;
+    w->m2 = 0;
+}
+
+void WelfordAdd(welford_t *w, float x){
+    float delta = x - w->mean;
+
+    w->n++;
+    w->mean += delta / w->n;
+    w->m2 += delta * (x - w->mean);
+}
+
+float WelfordVariance(const welford_t *w){
+    return (w->n == 0) ? 0 : w->m2 / w->n;
+}
+
+void EwmaStatsInit(ewma_stats_t *s, float alpha){
+    s->alpha = alpha;
+    s->mean = 0;
+    s->var = 0;
+    s->started = false;
+}
+
+void EwmaStatsAdd(ewma_stats_t *s, float x){
+    float delta, step;
+
+    if(!s->started){
+        s->mean = x;
+        s->var = 0;
+        s->started = true;
+        return;
+    }
+    delta = x - s->mean;
+    step = s->alpha * delta;
+    s->mean += step;
+    s->var = (1.0f - s->alpha) * (s->var + delta * step);
+}
+
+void StabilityInit(stability_t *s, float alpha, float max_std, uint32_t hold){
+    for(uint8_t axis = 0; axis < 3; axis++){
+        EwmaStatsInit(&s->axis[axis], alpha);
+    }
+    s->max_var = max_std * max_std;
+    s->hold = hold;
+    s->count = 0;
+}
+
+void StabilityReset(stability_t *s){
+    for(uint8_t axis = 0; axis < 3; axis++){
+        EwmaStatsInit(&s->axis[axis], s->axis[axis].alpha);
+    }
+    s->count = 0;
+}
+
+bool StabilityAdd(stability_t *s, float x, float y, float z){
+    EwmaStatsAdd(&s->axis[0], x);
+    EwmaStatsAdd(&s->axis[1], y);
+    EwmaStatsAdd(&s->axis[2], z);
+    if(s->axis[0].var + s->axis[1].var + s->axis[2].var > s->max_var){
+        s->count = 0;
+        return false;
+    }
+    if(s->count < s->hold){
+        s->count++;
+    }
+    return s->count >= s->hold;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,89 @@
+/**
+ * @file sample_convert.c
+ * @brief Block conversion between integer samples and float, with offset and scale
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sample_convert.h"
+#include <math.h>
+/*==================[macros and definitions]=================================*/
+/* Same loop for every integer input: four samples per iteration, then the rest */
+#define TO_F32_LOOP(in, out, len, offset, scale)                    \
+    do {                                                            \
+        uint16_t i = 0;                                             \
+        for(; i + 4 <= (len); i += 4){                              \
+            (out)[i] = ((float)(in)[i] - (offset)) * (scale);       \
+            (out)[i + 1] = ((float)(in)[i + 1] - (offset)) * (scale); \
+            (out)[i + 2] = ((float)(in)[i + 2] - (offset)) * (scale); \
+            (out)[i + 3] = ((float)(in)[i + 3] - (offset)) * (scale); \
+        }                                                           \
+        for(; i < (len); i++){                                      \
+            (out)[i] = ((float)(in)[i] - (offset)) * (scale);       \
+        }                                                           \
+    } while(0)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Rounds and saturates to [low, high]: the comparison is done in float, before lrintf can overflow */
+static inline int32_t Saturate(float value, float low, float high){
+    if(value >= high){
+        return (int32_t)high;
+    }
+    if(value <= low){
+        return (int32_t)low;
+    }
+    return (int32_t)lrintf(value);
+}
+
+/*==================[external functions definition]==========================*/
+void SampleConvertU16ToF32(const uint16_t *in, float *out, uint16_t len, float offset, float scale){
+    TO_F32_LOOP(in, out, len, offset, scale);
+}
+
+void SampleConvertI16ToF32(const int16_t *in, float *out, uint16_t len, float offset, float scale){
+    TO_F32_LOOP(in, out, len, offset, scale);
+}
+
+void SampleConvertU32ToF32(const uint32_t *in, float *out, uint16_t len, float offset, float scale){
+    TO_F32_LOOP(in, out, len, offset, scale);
+}
+
+void SampleConvertF32ToI16(const float *in, int16_t *out, uint16_t len, float offset, float scale){
+    uint16_t i = 0;
+
+    for(; i + 4 <= len; i += 4){
+        out[i] = (int16_t)Saturate(in[i] * scale + offset, INT16_MIN, INT16_MAX);
+        out[i + 1] = (int16_t)Saturate(in[i + 1] * scale + offset, INT16_MIN, INT16_MAX);
+        out[i + 2] = (int16_t)Saturate(in[i + 2] * scale + offset, INT16_MIN, INT16_MAX);
+        out[i + 3] = (int16_t)Saturate(in[i + 3] * scale + offset, INT16_MIN, INT16_MAX);
+    }
+    for(; i < len; i++){
+        out[i] = (int16_t)Saturate(in[i] * scale + offset, INT16_MIN, INT16_MAX);
+    }
+}
+
+void SampleConvertF32ToU16(const float *in, uint16_t *out, uint16_t len, float offset, float scale, uint16_t max){
+    float high = max;
+    uint16_t i = 0;
+
+    for(; i + 4 <= len; i += 4){
+        out[i] = (uint16_t)Saturate(in[i] * scale + offset, 0, high);
+        out[i + 1] = (uint16_t)Saturate(in[i + 1] * scale + offset, 0, high);
+        out[i + 2] = (uint16_t)Saturate(in[i + 2] * scale + offset, 0, high);
+        out[i + 3] = (uint16_t)Saturate(in[i + 3] * scale + offset, 0, high);
+    }
+    for(; i < len; i++){
+        out[i] = (uint16_t)Saturate(in[i] * scale + offset, 0, high);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,230 @@
+/**
+ * @file signal_pipeline.c
+ * @brief Block processing pipeline of filter, FFT and feature stages
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "sdkconfig.h"
+#include "signal_pipeline.h"
+#include "dsp_scratch.h"
+#if CONFIG_MIDDELWARE_DSP_FIR
+#include "fir_filter.h"
+#endif
+#if CONFIG_MIDDELWARE_DSP_FFT
+#include "fft.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define ARENA_ALIGN     16  /* fir_filter_t arrays are 16 byte aligned */
+#define ALIGN_UP(size)  (((size) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* State size of a stage, 0 for stateless stages and SIZE_MAX for stages not built */
+static size_t StageStateSize(const pipeline_stage_config_t *config){
+    switch(config->type){
+#if CONFIG_MIDDELWARE_DSP_IIR
+        case PIPE_LOW_PASS:
+        case PIPE_HI_PASS:
+        case PIPE_NOTCH:
+            return sizeof(iir_filter_t);
+#endif
+#if CONFIG_MIDDELWARE_DSP_FIR
+        case PIPE_FIR:
+            return sizeof(fir_filter_t);
+        case PIPE_DECIMATE:
+            return sizeof(fir_decimator_t);
+#endif
+#if CONFIG_MIDDELWARE_DSP_FFT
+        case PIPE_FFT_MAGNITUDE:
+#endif
+        case PIPE_BAND_ENERGY:
+        case PIPE_FUNC:
+            return 0;
+        default:
+            return SIZE_MAX;
+    }
+}
+
+static bool StageInPlace(const pipeline_stage_config_t *config){
+    switch(config->type){
+        case PIPE_BAND_ENERGY:
+            return false;
+        case PIPE_FUNC:
+            return config->in_place;
+        default:
+            /* filters and FFTMagnitude read each sample before writing it */
+            return true;
+    }
+}
+
+/* Second buffer: only for a stage that can't run in place after the first one */
+static bool NeedsPingPong(const pipeline_stage_config_t *stages, uint8_t n_stages){
+    for(uint8_t i = 1; i < n_stages; i++){
+        if(!StageInPlace(&stages[i])){
+            return true;
+        }
+    }
+    return false;
+}
+
+static int16_t StageRun(pipeline_stage_t *stage, const float *input, float *output, int16_t length){
+    const pipeline_stage_config_t *config = stage->config;
+
+    switch(config->type){
+#if CONFIG_MIDDELWARE_DSP_IIR
+        case PIPE_LOW_PASS:
+        case PIPE_HI_PASS:
+        case PIPE_NOTCH:
+            IirFilter(stage->state, (float *)input, output, length);
+            return length;
+#endif
+#if CONFIG_MIDDELWARE_DSP_FIR
+        case PIPE_FIR:
+            FirFilter(stage->state, input, output, length);
+            return length;
+        case PIPE_DECIMATE:
+            return FirDecimate(stage->state, input, output, length);
+#endif
+#if CONFIG_MIDDELWARE_DSP_FFT
+        case PIPE_FFT_MAGNITUDE:
+            FFTMagnitude((float *)input, output, length);
+            return length / 2;
+#endif
+        case PIPE_BAND_ENERGY:
+            BandEnergy(config->map, input, output);
+            return config->map->n_bands;
+        case PIPE_FUNC:
+            return config->func_p(config->ctx, input, output, length);
+        default:
+            return 0;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+size_t PipelineArenaSize(const pipeline_stage_config_t *stages, uint8_t n_stages, int16_t max_length){
+    size_t size = ALIGN_UP(max_length * sizeof(float)), state;
+
+    if(NeedsPingPong(stages, n_stages)){
+        size *= 2;
+    }
+    for(uint8_t i = 0; i < n_stages; i++){
+        state = StageStateSize(&stages[i]);
+        if(state == SIZE_MAX){
+            return SIZE_MAX;
+        }
+        size += ALIGN_UP(state);
+    }
+    return size;
+}
+
+bool PipelineInit(pipeline_t *pipeline, void *arena, size_t arena_size, float sample_frec, int16_t max_length,
+                  const pipeline_stage_config_t *stages, uint8_t n_stages){
+    uint8_t *free_p = arena;
+    pipeline_stage_t *stage;
+    bool ok = true;
+
+    if(n_stages > PIPELINE_MAX_STAGES || max_length < 0 || ((uintptr_t)arena % ARENA_ALIGN) != 0 ||
+       PipelineArenaSize(stages, n_stages, max_length) > arena_size){
+        return false;
+    }
+    memset(pipeline, 0, sizeof(pipeline_t));
+    pipeline->n_stages = n_stages;
+    pipeline->max_length = max_length;
+    pipeline->ping_pong = NeedsPingPong(stages, n_stages);
+    if(max_length > 0){
+        pipeline->buffer[0] = (float *)free_p;
+        free_p += ALIGN_UP(max_length * sizeof(float));
+        if(pipeline->ping_pong){
+            pipeline->buffer[1] = (float *)free_p;
+            free_p += ALIGN_UP(max_length * sizeof(float));
+        }
+    }
+    for(uint8_t i = 0; i < n_stages && ok; i++){
+        stage = &pipeline->stage[i];
+        stage->config = &stages[i];
+        stage->in_place = StageInPlace(&stages[i]);
+        stage->state = free_p;
+        free_p += ALIGN_UP(StageStateSize(&stages[i]));
+        switch(stages[i].type){
+#if CONFIG_MIDDELWARE_DSP_IIR
+            case PIPE_LOW_PASS:
+                IirLowPassInit(stage->state, sample_frec, stages[i].cut_frec, stages[i].order);
+            break;
+            case PIPE_HI_PASS:
+                IirHiPassInit(stage->state, sample_frec, stages[i].cut_frec, stages[i].order);
+            break;
+            case PIPE_NOTCH:
+                ok = (stages[i].q > 0 && stages[i].cut_frec < sample_frec / 2);
+                if(ok){
+                    IirNotchInit(stage->state, sample_frec, stages[i].cut_frec, stages[i].q);
+                }
+            break;
+#endif
+#if CONFIG_MIDDELWARE_DSP_FIR
+            case PIPE_FIR:
+                ok = FirInit(stage->state, stages[i].coeff, stages[i].n_taps);
+            break;
+            case PIPE_DECIMATE:
+                ok = FirDecimatorInit(stage->state, stages[i].coeff, stages[i].n_taps, stages[i].factor);
+                /* following stages run at the reduced rate */
+                sample_frec /= (ok ? stages[i].factor : 1);
+            break;
+#endif
+            case PIPE_BAND_ENERGY:
+                ok = (stages[i].map != NULL);
+            break;
+            case PIPE_FUNC:
+                ok = (stages[i].func_p != NULL);
+            break;
+            default:
+            break;
+        }
+    }
+    pipeline->output_frec = sample_frec;
+    return ok;
+}
+
+int16_t PipelineProcess(pipeline_t *pipeline, const float *input, int16_t length, const float **output){
+    const float *in = input;
+    float *buffer[2] = {pipeline->buffer[0], pipeline->buffer[1]};
+    float *out;
+    uint8_t b = 0;
+
+    if(pipeline->max_length == 0){
+        /* borrowed for this block, inside the caller's scratch scope */
+        buffer[0] = DspScratchAlloc(length * sizeof(float));
+        if(pipeline->ping_pong){
+            buffer[1] = DspScratchAlloc(length * sizeof(float));
+        }
+        if(buffer[0] == NULL || (pipeline->ping_pong && buffer[1] == NULL)){
+            *output = input;
+            return 0;
+        }
+    } else if(length > pipeline->max_length){
+        length = pipeline->max_length;
+    }
+    for(uint8_t i = 0; i < pipeline->n_stages && length > 0; i++){
+        /* the first stage moves the samples into the buffer, the others stay
+           there unless they can't write over their input */
+        if(in == buffer[b] && !pipeline->stage[i].in_place){
+            b ^= 1;
+        }
+        out = buffer[b];
+        length = StageRun(&pipeline->stage[i], in, out, length);
+        in = out;
+    }
+    *output = in;
+    return length;
+}
+
+/*==================[end of file]============================================*/
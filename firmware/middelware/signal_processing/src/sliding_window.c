@@ -0,0 +1,227 @@
+/**
+ * @file sliding_window.c
+ * @brief Minimum, maximum and median of the last samples of a signal
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "sliding_window.h"
+/*==================[macros and definitions]=================================*/
+#define DEQUE_MASK  (SLIDING_MINMAX_MAX_WINDOW - 1)
+_Static_assert((SLIDING_MINMAX_MAX_WINDOW & DEQUE_MASK) == 0 && SLIDING_MINMAX_MAX_WINDOW <= 128,
+               "SLIDING_MINMAX_MAX_WINDOW must be a power of two up to 128");
+_Static_assert(SLIDING_MEDIAN_MAX_WINDOW <= 127, "Heap positions are int8_t");
+
+/* Ring position at heap position p (p from -window / 2 to (window - 1) / 2) */
+#define HEAP(s, p)  ((s)->heap[(p) + (s)->window / 2])
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief The sample at ring position pos leaves the window
+ */
+static void DequeExpire(sliding_deque_t *d, uint8_t pos){
+    // it can only be the oldest one of the deque
+    if(d->count > 0 && d->slot[d->head] == pos){
+        d->head = (d->head + 1) & DEQUE_MASK;
+        d->count--;
+    }
+}
+
+/**
+ * @brief The sample at ring position pos enters the window: the older ones
+ * that can no longer be the extreme are dropped from the back
+ */
+static void DequePush(sliding_deque_t *d, const float *value, uint8_t pos, bool max){
+    float x = value[pos], back;
+
+    while(d->count > 0){
+        back = value[d->slot[(d->head + d->count - 1) & DEQUE_MASK]];
+        if(max ? (back > x) : (back < x)){
+            break;
+        }
+        d->count--;
+    }
+    d->slot[(d->head + d->count) & DEQUE_MASK] = pos;
+    d->count++;
+}
+
+static bool HeapLess(const sliding_median_t *s, int16_t i, int16_t j){
+    return s->value[HEAP(s, i)] < s->value[HEAP(s, j)];
+}
+
+/**
+ * @brief Swaps heap positions i and j if the sample at i is less than the one at j
+ */
+static bool HeapOrder(sliding_median_t *s, int16_t i, int16_t j){
+    uint8_t aux;
+
+    if(!HeapLess(s, i, j)){
+        return false;
+    }
+    aux = HEAP(s, i);
+    HEAP(s, i) = HEAP(s, j);
+    HEAP(s, j) = aux;
+    s->heap_pos[HEAP(s, i)] = i;
+    s->heap_pos[HEAP(s, j)] = j;
+    return true;
+}
+
+/* Min-heap: positions 1 to min_count, children of i at 2i and 2i + 1 */
+static void MinSortDown(sliding_median_t *s, int16_t i){
+    for(i *= 2; i <= s->min_count; i *= 2){
+        if(i < s->min_count && HeapLess(s, i + 1, i)){
+            i++;
+        }
+        if(!HeapOrder(s, i, i / 2)){
+            break;
+        }
+    }
+}
+
+/* Max-heap: positions -1 to -max_count (i / 2 rounds towards 0, as the parent) */
+static void MaxSortDown(sliding_median_t *s, int16_t i){
+    for(i *= 2; i >= -s->max_count; i *= 2){
+        if(i > -s->max_count && HeapLess(s, i, i - 1)){
+            i--;
+        }
+        if(!HeapOrder(s, i / 2, i)){
+            break;
+        }
+    }
+}
+
+/* Both return true if the sample went up to the median */
+static bool MinSortUp(sliding_median_t *s, int16_t i){
+    while(i > 0 && HeapOrder(s, i, i / 2)){
+        i /= 2;
+    }
+    return i == 0;
+}
+
+static bool MaxSortUp(sliding_median_t *s, int16_t i){
+    while(i < 0 && HeapOrder(s, i / 2, i)){
+        i /= 2;
+    }
+    return i == 0;
+}
+
+/*==================[external functions definition]==========================*/
+bool SlidingMinMaxInit(sliding_minmax_t *s, uint8_t window){
+    if(window == 0 || window > SLIDING_MINMAX_MAX_WINDOW){
+        return false;
+    }
+    s->window = window;
+    s->pos = 0;
+    s->count = 0;
+    s->min.head = 0;
+    s->min.count = 0;
+    s->max.head = 0;
+    s->max.count = 0;
+    return true;
+}
+
+void SlidingMinMaxAdd(sliding_minmax_t *s, float x){
+    if(s->count == s->window){
+        DequeExpire(&s->min, s->pos);
+        DequeExpire(&s->max, s->pos);
+    } else {
+        s->count++;
+    }
+    s->value[s->pos] = x;
+    DequePush(&s->min, s->value, s->pos, false);
+    DequePush(&s->max, s->value, s->pos, true);
+    if(++s->pos == s->window){
+        s->pos = 0;
+    }
+}
+
+float SlidingMin(const sliding_minmax_t *s){
+    return s->value[s->min.slot[s->min.head]];
+}
+
+float SlidingMax(const sliding_minmax_t *s){
+    return s->value[s->max.slot[s->max.head]];
+}
+
+bool SlidingMedianInit(sliding_median_t *s, uint8_t window){
+    if(window == 0 || window > SLIDING_MEDIAN_MAX_WINDOW){
+        return false;
+    }
+    s->window = window;
+    s->pos = 0;
+    s->min_count = 0;
+    s->max_count = 0;
+    // ring positions fill the heaps in the order median, max, min, max, min...
+    for(uint8_t i = 0; i < window; i++){
+        s->heap_pos[i] = (int8_t)(((i + 1) / 2) * ((i & 1) ? -1 : 1));
+        HEAP(s, s->heap_pos[i]) = i;
+        s->value[i] = 0;
+    }
+    return true;
+}
+
+void SlidingMedianFill(sliding_median_t *s, float x){
+    SlidingMedianInit(s, s->window);
+    for(uint8_t i = 0; i < s->window; i++){
+        s->value[i] = x;
+    }
+    s->min_count = (s->window - 1) / 2;
+    s->max_count = s->window / 2;
+}
+
+float SlidingMedianAdd(sliding_median_t *s, float x){
+    int16_t p = s->heap_pos[s->pos];
+    float old = s->value[s->pos];
+
+    s->value[s->pos] = x;
+    if(++s->pos == s->window){
+        s->pos = 0;
+    }
+    if(p > 0){
+        // in the min-heap: a larger sample only goes down
+        if(s->min_count < (s->window - 1) / 2){
+            s->min_count++;
+        } else if(x > old){
+            MinSortDown(s, p);
+            return SlidingMedian(s);
+        }
+        if(MinSortUp(s, p) && HeapOrder(s, 0, -1)){
+            MaxSortDown(s, -1);
+        }
+    } else if(p < 0){
+        // in the max-heap: a smaller sample only goes down
+        if(s->max_count < s->window / 2){
+            s->max_count++;
+        } else if(x < old){
+            MaxSortDown(s, p);
+            return SlidingMedian(s);
+        }
+        if(MaxSortUp(s, p) && s->min_count > 0 && HeapOrder(s, 1, 0)){
+            MinSortDown(s, 1);
+        }
+    } else {
+        // the median itself was replaced
+        if(s->max_count > 0 && MaxSortUp(s, -1)){
+            MaxSortDown(s, -1);
+        }
+        if(s->min_count > 0 && MinSortUp(s, 1)){
+            MinSortDown(s, 1);
+        }
+    }
+    return SlidingMedian(s);
+}
+
+float SlidingMedian(const sliding_median_t *s){
+    return s->value[HEAP(s, 0)];
+}
+
+/*==================[end of file]============================================*/
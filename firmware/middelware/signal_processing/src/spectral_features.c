@@ -0,0 +1,106 @@
+/**
+ * @file spectral_features.c
+ * @brief Features of an FFT magnitude spectrum
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "spectral_features.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static float BinsPower(const float *fft, uint16_t first, uint16_t last){
+    float power = 0;
+
+    for(uint16_t k = first; k <= last; k++){
+        power += fft[k] * fft[k];
+    }
+    return power;
+}
+
+/*==================[external functions definition]==========================*/
+bool SpectralInit(spectral_config_t *config, float sample_freq, uint16_t signal_lenght,
+                  const float *band_edges, uint8_t n_bands){
+    float bins_per_hz = signal_lenght / sample_freq;
+    uint16_t n_bins = signal_lenght / 2;
+    uint16_t bin;
+
+    if(n_bins < 3 || n_bands > SPECTRAL_MAX_BANDS || (n_bands > 0 && band_edges == NULL)){
+        return false;
+    }
+    config->bin_width = sample_freq / signal_lenght;
+    config->n_bins = n_bins;
+    config->n_bands = n_bands;
+    for(uint8_t b = 0; b <= n_bands && n_bands > 0; b++){
+        if(band_edges[b] < 0 || (b > 0 && band_edges[b] <= band_edges[b - 1])){
+            return false;
+        }
+        bin = (uint16_t)(band_edges[b] * bins_per_hz + 0.5f);
+        /* no DC, at least one bin per band, up to the last bin */
+        if(bin < 1){
+            bin = 1;
+        }
+        if(b > 0 && bin <= config->band_bin[b - 1]){
+            bin = config->band_bin[b - 1] + 1;
+        }
+        if(bin > n_bins){
+            return false;
+        }
+        config->band_bin[b] = bin;
+    }
+    return true;
+}
+
+void SpectralFeatures(const spectral_config_t *config, const float *fft, spectral_features_t *features){
+    uint16_t n_bins = config->n_bins, peak = 1;
+    float power = 0, weighted = 0, sum = 0, peak_power;
+    float a, b, c, denom, delta = 0;
+
+    memset(features, 0, sizeof(spectral_features_t));
+    for(uint16_t k = 1; k < n_bins; k++){
+        if(fft[k] > fft[peak]){
+            peak = k;
+        }
+        power += fft[k] * fft[k];
+        weighted += k * fft[k];
+        sum += fft[k];
+    }
+    if(sum <= 0){
+        return;
+    }
+    /* parabola through the peak and its neighbours */
+    b = fft[peak];
+    if(peak + 1 < n_bins){
+        a = fft[peak - 1];
+        c = fft[peak + 1];
+        denom = a - 2 * b + c;
+        if(denom < 0){
+            delta = 0.5f * (a - c) / denom;
+        }
+        b -= 0.25f * (a - c) * delta;
+    }
+    features->dominant_freq = (peak + delta) * config->bin_width;
+    features->dominant_mag = b;
+    features->centroid = weighted / sum * config->bin_width;
+    features->total_power = power;
+    peak_power = BinsPower(fft, (peak > SPECTRAL_PEAK_BINS) ? peak - SPECTRAL_PEAK_BINS : 1,
+                           (peak + SPECTRAL_PEAK_BINS < n_bins) ? peak + SPECTRAL_PEAK_BINS : n_bins - 1);
+    features->snr = (power > peak_power) ? 10 * log10f(peak_power / (power - peak_power)) : SPECTRAL_MAX_SNR;
+    for(uint8_t i = 0; i < config->n_bands; i++){
+        features->band_power[i] = BinsPower(fft, config->band_bin[i], config->band_bin[i + 1] - 1);
+    }
+}
+
+/*==================[end of file]============================================*/
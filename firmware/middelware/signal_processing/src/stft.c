@@ -0,0 +1,113 @@
+/**
+ * @file stft.c
+ * @brief Streaming STFT with overlapped frames, on top of FFTMagnitude
+ * @version 0.1
+ * @date 2026-10-14
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "stft.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool StftInit(stft_t *stft, uint16_t frame_lenght, stft_overlap_t overlap){
+    if(frame_lenght < 4 || frame_lenght > STFT_MAX_FRAME || (frame_lenght & (frame_lenght - 1)) != 0){
+        return false;
+    }
+    if(overlap != STFT_OVERLAP_50 && overlap != STFT_OVERLAP_75){
+        return false;
+    }
+    memset(stft, 0, sizeof(stft_t));
+    stft->frame_lenght = frame_lenght;
+    stft->hop = frame_lenght / overlap;
+    stft->mask = 2 * frame_lenght - 1;
+    /* the first frame is ready after frame_lenght samples */
+    stft->hop_count = (int32_t)stft->hop - frame_lenght;
+    return true;
+}
+
+bool StftSubscribe(stft_t *stft, stft_callback_t func_p, void *param_p){
+    if(stft->n_subscribers >= STFT_MAX_SUBSCRIBERS || func_p == NULL){
+        return false;
+    }
+    stft->func_p[stft->n_subscribers] = func_p;
+    stft->param_p[stft->n_subscribers] = param_p;
+    stft->n_subscribers++;
+    return true;
+}
+
+bool StftPushSample(stft_t *stft, float sample){
+    uint32_t written = stft->written;
+
+    stft->ring[written & stft->mask] = sample;
+    stft->written = written + 1;
+    stft->hop_count++;
+    if(stft->hop_count == stft->hop){
+        stft->hop_count = 0;
+        stft->frames = stft->frames + 1;
+        return true;
+    }
+    return false;
+}
+
+uint16_t StftPushBlock(stft_t *stft, const float *samples, uint16_t length){
+    uint16_t new_frames = 0;
+
+    for(uint16_t i = 0; i < length; i++){
+        if(StftPushSample(stft, samples[i])){
+            new_frames++;
+        }
+    }
+    return new_frames;
+}
+
+bool StftProcess(stft_t *stft){
+    uint32_t frames = stft->frames;
+    uint32_t end, start, first;
+
+    if(frames == stft->processed){
+        return false;
+    }
+    /* only the latest frame is processed */
+    stft->skipped += frames - stft->processed - 1;
+    stft->processed = frames;
+    end = stft->frame_lenght + (frames - 1) * stft->hop;
+    start = end - stft->frame_lenght;
+    /* copy the frame in order (the ring may wrap inside it) */
+    first = stft->mask + 1 - (start & stft->mask);
+    if(first >= stft->frame_lenght){
+        memcpy(stft->frame, &stft->ring[start & stft->mask], stft->frame_lenght * sizeof(float));
+    } else {
+        memcpy(stft->frame, &stft->ring[start & stft->mask], first * sizeof(float));
+        memcpy(&stft->frame[first], stft->ring, (stft->frame_lenght - first) * sizeof(float));
+    }
+    /* the producer may have overwritten the start of the frame while copying */
+    if(stft->written - end > stft->frame_lenght){
+        stft->skipped++;
+        return false;
+    }
+    FFTMagnitude(stft->frame, stft->spectrum, stft->frame_lenght);
+    for(uint8_t i = 0; i < stft->n_subscribers; i++){
+        stft->func_p[i](stft->spectrum, stft->frame_lenght / 2, stft->param_p[i]);
+    }
+    return true;
+}
+
+uint32_t StftSkipped(stft_t *stft){
+    return stft->skipped;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,188 @@
+/**
+ * @file template_match.c
+ * @brief Streaming normalised cross-correlation (template matching)
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "sdkconfig.h"
+#include "template_match.h"
+#include "dsp_scratch.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define MIN_ENERGY  1e-12f  /* windows with less energy (flat signal) correlate 0 */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Complex FFT, in natural order */
+static void ComplexFFT(float *data, uint16_t n){
+    dsps_fft2r_fc32(data, n);
+    dsps_bit_rev_fc32(data, n);
+}
+
+/* Correlation of a complete frame: block outputs in ncc */
+static void CorrelateFrame(template_match_t *tm, float *work, float *ncc){
+    uint16_t n = tm->fft_length, m = tm->length;
+    float mean = 0, sum = 0, sum_sq = 0, energy, re, im;
+
+    /* the template has zero mean, so removing the frame mean doesn't change
+       the correlation and keeps the running sums small */
+    for(uint16_t i = 0; i < n; i++){
+        mean += tm->frame[i];
+    }
+    mean /= n;
+    for(uint16_t i = 0; i < n; i++){
+        work[2*i] = tm->frame[i] - mean;
+        work[2*i+1] = 0;
+    }
+    ComplexFFT(work, n);
+    /* conj(X * conj(T)): the inverse transform as a forward one */
+    for(uint16_t k = 0; k < n; k++){
+        re = work[2*k] * tm->spectrum[2*k] - work[2*k+1] * tm->spectrum[2*k+1];
+        im = work[2*k] * tm->spectrum[2*k+1] + work[2*k+1] * tm->spectrum[2*k];
+        work[2*k] = re;
+        work[2*k+1] = -im;
+    }
+    ComplexFFT(work, n);
+    /* output j: window frame[j .. j+m-1], its energy from running sums of
+       the centred samples (recomputed each frame, so errors don't build up) */
+    for(uint16_t i = 0; i < m - 1; i++){
+        re = tm->frame[i] - mean;
+        sum += re;
+        sum_sq += re * re;
+    }
+    for(uint16_t j = 0; j < tm->block; j++){
+        re = tm->frame[j + m - 1] - mean;
+        sum += re;
+        sum_sq += re * re;
+        energy = sum_sq - sum * sum / m;
+        ncc[j] = (energy > MIN_ENERGY) ? work[2*j] / sqrtf(energy) : 0;
+        re = tm->frame[j] - mean;
+        sum -= re;
+        sum_sq -= re * re;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool TemplateMatchInit(template_match_t *tm, const float *templ, uint16_t length, uint16_t block){
+    float mean = 0, norm = 0, *spectrum = tm->spectrum;
+    uint16_t n = 2;
+
+    if(length < 2 || length > TEMPLATE_MAX_LENGTH || block == 0){
+        return false;
+    }
+    while(n < length + block - 1){
+        n *= 2;
+    }
+    if(n > TEMPLATE_MAX_FFT || n > CONFIG_DSP_MAX_FFT_SIZE ||
+       dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE) != ESP_OK){
+        return false;
+    }
+    for(uint16_t i = 0; i < length; i++){
+        mean += templ[i];
+    }
+    mean /= length;
+    for(uint16_t i = 0; i < length; i++){
+        norm += (templ[i] - mean) * (templ[i] - mean);
+    }
+    if(norm <= MIN_ENERGY){
+        return false;
+    }
+    /* zero mean, unit energy template, so the correlation with a window
+       divided by the window's deviation is the Pearson coefficient */
+    norm = sqrtf(norm);
+    memset(spectrum, 0, sizeof(tm->spectrum));
+    for(uint16_t i = 0; i < length; i++){
+        spectrum[2*i] = (templ[i] - mean) / norm;
+    }
+    ComplexFFT(spectrum, n);
+    /* conjugated for the correlation, and scaled by 1/N for the inverse FFT */
+    for(uint16_t k = 0; k < n; k++){
+        spectrum[2*k] /= n;
+        spectrum[2*k+1] /= -(float)n;
+    }
+    tm->length = length;
+    tm->fft_length = n;
+    tm->block = n - length + 1;
+    tm->fill = 0;
+    memset(tm->frame, 0, sizeof(tm->frame));
+    return true;
+}
+
+uint16_t TemplateMatchBlock(const template_match_t *tm){
+    return tm->block;
+}
+
+int16_t TemplateMatchProcess(template_match_t *tm, const float *input, int16_t length, float *ncc){
+    dsp_scratch_mark_t mark = DspScratchMark();
+    float *work = DspScratchAlloc(2 * tm->fft_length * sizeof(float));
+    uint16_t history = tm->length - 1, copy;
+    int16_t n = 0;
+
+    while(length > 0){
+        copy = tm->block - tm->fill;
+        if(copy > length){
+            copy = length;
+        }
+        memcpy(&tm->frame[history + tm->fill], input, copy * sizeof(float));
+        tm->fill += copy;
+        input += copy;
+        length -= copy;
+        if(tm->fill == tm->block){
+            /* without work buffer the frame is dropped, to stay in step */
+            if(work != NULL){
+                CorrelateFrame(tm, work, &ncc[n]);
+                n += tm->block;
+            }
+            memmove(tm->frame, &tm->frame[tm->block], history * sizeof(float));
+            tm->fill = 0;
+        }
+    }
+    DspScratchRelease(mark);
+    return n;
+}
+
+void TemplateDetectorInit(template_detector_t *detector, float threshold, uint32_t refractory){
+    memset(detector, 0, sizeof(template_detector_t));
+    detector->threshold = threshold;
+    detector->refractory = refractory;
+}
+
+uint8_t TemplateDetect(template_detector_t *detector, const float *ncc, int16_t length){
+    uint8_t events = 0;
+
+    for(int16_t i = 0; i < length; i++){
+        detector->since_event++;
+        if(detector->in_peak){
+            if(ncc[i] > detector->peak){
+                detector->peak = ncc[i];
+                detector->peak_at = detector->since_event;
+            } else if(ncc[i] < detector->threshold){
+                /* end of the peak: the event is at its highest value */
+                detector->in_peak = false;
+                detector->interval = detector->first ? detector->peak_at : 0;
+                detector->first = true;
+                detector->since_event -= detector->peak_at;
+                events++;
+            }
+        } else if(ncc[i] >= detector->threshold &&
+                  (!detector->first || detector->since_event >= detector->refractory)){
+            detector->in_peak = true;
+            detector->peak = ncc[i];
+            detector->peak_at = detector->since_event;
+        }
+    }
+    return events;
+}
+
+/*==================[end of file]============================================*/
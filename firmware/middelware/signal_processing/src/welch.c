@@ -0,0 +1,72 @@
+/**
+ * @file welch.c
+ * @brief Streaming power spectrum estimate (Welch), on top of the STFT
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "welch.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* STFT callback: adds the power of a segment to the average */
+static void WelchAdd(const float *spectrum, uint16_t n_bins, void *param){
+    welch_t *welch = param;
+    float weight;
+
+    // Plain mean while filling, then exponential average with weight 1 / depth
+    if(welch->segments < welch->depth){
+        welch->segments++;
+    }
+    weight = 1.0f / welch->segments;
+    for(uint16_t k = 0; k < n_bins; k++){
+        welch->power[k] += weight * (spectrum[k] * spectrum[k] - welch->power[k]);
+    }
+    welch->n_bins = n_bins;
+    for(uint8_t i = 0; i < welch->n_subscribers; i++){
+        welch->func_p[i](welch->power, n_bins, welch->param_p[i]);
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool WelchInit(welch_t *welch, stft_t *stft, uint16_t depth){
+    if(depth == 0){
+        return false;
+    }
+    memset(welch, 0, sizeof(welch_t));
+    welch->depth = depth;
+    welch->n_bins = stft->frame_lenght / 2;
+    return StftSubscribe(stft, WelchAdd, welch);
+}
+
+bool WelchSubscribe(welch_t *welch, stft_callback_t func_p, void *param_p){
+    if(welch->n_subscribers >= WELCH_MAX_SUBSCRIBERS || func_p == NULL){
+        return false;
+    }
+    welch->func_p[welch->n_subscribers] = func_p;
+    welch->param_p[welch->n_subscribers] = param_p;
+    welch->n_subscribers++;
+    return true;
+}
+
+void WelchReset(welch_t *welch){
+    // The first segment after a reset replaces the average (weight 1)
+    welch->segments = 0;
+}
+
+uint32_t WelchSegments(const welch_t *welch){
+    return welch->segments;
+}
+
+/*==================[end of file]============================================*/
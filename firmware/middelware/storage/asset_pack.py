@@ -0,0 +1,152 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 21:00:00 2026
+
+@author: Albano Peñalva
+
+Genera un paquete de recursos (asset_pack.h) para grabar en una partición de
+datos: fuentes e íconos de fonts.c e icons.c, imágenes, pistas de audio y
+archivos sin procesar. La aplicación lo abre con AssetPackOpen y usa los
+recursos en su lugar, sin copiarlos, así los arreglos grandes no se compilan
+ni se graban con cada cambio del programa.
+
+Las fuentes y los íconos se guardan empaquetados (FONT_PACKED / ICON_PACKED,
+como font_pack.py): las filas no se completan a un byte.
+
+Uso:
+    python asset_pack.py assets.bin --fuente font_22=22 --iconos icon_30=30
+    python asset_pack.py assets.bin --audio cancion=main/song_adpcm.h --tamanio 0x200000
+    python asset_pack.py assets.bin --imagen logo=pic.c:picture:240:320 --crudo tabla=tabla.bin
+
+--audio acepta el song_adpcm.h de adpcm_encoder.py (IMA-ADPCM) o el song.h de
+wav_to_edu.py (PCM de 8 bits). --imagen toma un arreglo RGB565 de un archivo
+.c o .h (el formato de ILI9341DrawPicture); --crudo copia el archivo tal cual.
+Con --tamanio se verifica que el paquete entre en la partición.
+"""
+
+# Librerías
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'drivers', 'devices'))
+import font_pack  # noqa: E402
+
+MAGIA = 0x54455341          # "ASET"
+VERSION = 1
+LARGO_NOMBRE = 20
+CABECERA = '<IHHI'          # asset_pack_header_t
+ENTRADA = '<20sB3xII'       # asset_entry_t
+RAW, FONT, ICONS, PICTURE, AUDIO = range(5)
+AUDIO_U8, AUDIO_ADPCM = range(2)
+FONT_PACKED = ICON_PACKED = 0x01
+
+
+def numeros(texto, nombre):
+    """Valores de un arreglo C (hexadecimales, enteros o en notación científica)"""
+    cuerpo = font_pack.arreglo(font_pack.sin_comentarios(texto), nombre)
+    valores = re.findall(r'0x[0-9a-fA-F]+|[-+]?\d+(?:\.\d*)?(?:[eE][-+]?\d+)?', cuerpo)
+    return [int(v, 16) if v.lower().startswith('0x') else int(float(v)) for v in valores]
+
+
+def fuente(alto):
+    datos, info = font_pack.leer_fuente(alto)
+    glifos, tabla = [], b''
+    for ancho, offset in info:
+        tabla += struct.pack('<BxH', ancho, len(glifos))
+        glifos += font_pack.empaquetar(datos, offset, ancho, alto)
+    cabecera = struct.pack('<BBH', alto, FONT_PACKED, 4 + len(tabla))
+    return cabecera + tabla + bytes(glifos)
+
+
+def iconos(alto):
+    datos, alto_, ancho, offset = font_pack.leer_iconos(alto)
+    salida = []
+    for i in range(len(datos) // offset):
+        salida += font_pack.empaquetar(datos, i * offset, ancho, alto_)
+    bytes_icono = (ancho * alto_ + 7) // 8
+    return struct.pack('<BBHB3x', alto_, ancho, bytes_icono, ICON_PACKED) + bytes(salida)
+
+
+def imagen(archivo, nombre, ancho, alto):
+    datos = numeros(open(archivo, encoding='utf-8').read(), nombre)
+    if len(datos) < 2 * ancho * alto:
+        raise SystemExit(f'{archivo}: {nombre} tiene {len(datos)} bytes, se esperaban {2 * ancho * alto}')
+    return struct.pack('<HH', ancho, alto) + bytes(datos[:2 * ancho * alto])
+
+
+def audio(archivo):
+    texto = open(archivo, encoding='utf-8').read()
+
+    def definido(nombre, otro=None):
+        m = re.search(rf'#define {nombre}\s+(?:"([^"]*)"|(\d+))', texto)
+        return otro if m is None else (m.group(1) if m.group(1) is not None else int(m.group(2)))
+
+    n = definido('N_SONG')
+    if 'song_adpcm' in texto:
+        formato, muestras = AUDIO_ADPCM, numeros(texto, 'song_adpcm')
+    else:
+        formato, muestras = AUDIO_U8, numeros(texto, 'song')[:n]
+    cabecera = struct.pack('<IIHBx32s32s', n, definido('SONG_FREC', 8000), definido('SONG_BLOCK', 0), formato,
+                           definido('SONG_NAME', '').encode('utf-8')[:31], definido('SONG_ARTIST', '').encode('utf-8')[:31])
+    return cabecera + bytes(muestras)
+
+
+def paquete(recursos):
+    """Cabecera, tabla y recursos alineados a 4 bytes"""
+    posicion = struct.calcsize(CABECERA) + len(recursos) * struct.calcsize(ENTRADA)
+    tabla, datos = b'', b''
+    for nombre, tipo, contenido in recursos:
+        relleno = -(posicion + len(datos)) % 4
+        datos += bytes(relleno)
+        tabla += struct.pack(ENTRADA, nombre.encode('ascii'), tipo, posicion + len(datos), len(contenido))
+        datos += contenido
+    total = posicion + len(datos)
+    return struct.pack(CABECERA, MAGIA, VERSION, len(recursos), total) + tabla + datos
+
+
+def par(texto):
+    nombre, _, valor = texto.partition('=')
+    if not valor or not 0 < len(nombre) < LARGO_NOMBRE:
+        raise argparse.ArgumentTypeError(f'se esperaba nombre=valor con un nombre de hasta {LARGO_NOMBRE - 1} caracteres')
+    return nombre, valor
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Paquete de recursos para una partición de datos (asset_pack.h)')
+    parser.add_argument('salida', help='archivo .bin generado')
+    parser.add_argument('--fuente', type=par, action='append', default=[], help='nombre=alto de la fuente de fonts.c')
+    parser.add_argument('--iconos', type=par, action='append', default=[], help='nombre=alto de los íconos de icons.c')
+    parser.add_argument('--imagen', type=par, action='append', default=[], help='nombre=archivo:arreglo:ancho:alto')
+    parser.add_argument('--audio', type=par, action='append', default=[], help='nombre=song_adpcm.h o song.h')
+    parser.add_argument('--crudo', type=par, action='append', default=[], help='nombre=archivo')
+    parser.add_argument('--tamanio', type=lambda t: int(t, 0), help='tamaño de la partición (bytes)')
+    args = parser.parse_args()
+
+    recursos = []
+    for nombre, alto in args.fuente:
+        recursos.append((nombre, FONT, fuente(int(alto))))
+    for nombre, alto in args.iconos:
+        recursos.append((nombre, ICONS, iconos(int(alto))))
+    for nombre, valor in args.imagen:
+        archivo, arreglo, ancho, alto = valor.rsplit(':', 3)
+        recursos.append((nombre, PICTURE, imagen(archivo, arreglo, int(ancho), int(alto))))
+    for nombre, archivo in args.audio:
+        recursos.append((nombre, AUDIO, audio(archivo)))
+    for nombre, archivo in args.crudo:
+        recursos.append((nombre, RAW, open(archivo, 'rb').read()))
+    if not recursos:
+        parser.error('no se indicó ningún recurso')
+
+    datos = paquete(recursos)
+    for nombre, tipo, contenido in recursos:
+        print(f'{nombre}: {len(contenido)} bytes')
+    print(f'{args.salida}: {len(recursos)} recursos, {len(datos)} bytes')
+    if args.tamanio is not None and len(datos) > args.tamanio:
+        raise SystemExit(f'el paquete ({len(datos)} bytes) no entra en la partición ({args.tamanio} bytes)')
+    os.makedirs(os.path.dirname(os.path.abspath(args.salida)), exist_ok=True)
+    with open(args.salida, 'wb') as f:
+        f.write(datos)
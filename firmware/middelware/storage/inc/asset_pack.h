@@ -0,0 +1,211 @@
+#ifndef ASSET_PACK_H_
+#define ASSET_PACK_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Asset_Pack Asset Pack
+ ** @{ */
+
+/** \brief Fonts, icons, pictures and audio in a data partition, memory-mapped
+ *
+ * Large constant arrays (fonts.c, icons.c, pictures, songs) compiled into the
+ * application make every build, link and flash slower. They can go instead to
+ * an asset pack: a binary written once to its own data partition by
+ * asset_pack.py, which the application maps into the address space
+ * (esp_partition_mmap) and uses through pointers to the flash, with no copies.
+ * Rebuilding or flashing the application (idf.py app-flash) doesn't touch it.
+ *
+ * Pack (little-endian, packed, every asset aligned to 4 bytes):
+ *
+ * | asset_pack_header_t | count x asset_entry_t | assets... |
+ *
+ * Each asset starts with a header of its type followed by the data in the
+ * format of the driver that uses it:
+ * - ASSET_FONT: asset_font_t, 95 char_info_t (' ' to '~'), glyphs (fonts.h)
+ * - ASSET_ICONS: asset_icons_t, icons (icons.h)
+ * - ASSET_PICTURE: asset_picture_t, RGB565 pixels (ILI9341DrawPicture)
+ * - ASSET_AUDIO: asset_audio_t, 8 bit PCM or IMA-ADPCM blocks (adpcm.h)
+ * - ASSET_RAW: the data, no header
+ *
+ * @note The pointers returned are valid until AssetPackClose. Flash mapped
+ * data can't be read by DMA: ILI9341DrawPicture copies it through its strip
+ * buffers.
+ *
+ * @code
+ * Font_t titulo;
+ * AssetPackOpen("assets");
+ * AssetGetFont("font_22", &titulo);
+ * ILI9341DrawString(10, 8, "Hola", &titulo, ILI9341_WHITE, ILI9341_BLACK);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fonts.h"
+#include "icons.h"
+/*==================[macros]=================================================*/
+#define ASSET_PACK_MAGIC        0x54455341      /*!< "ASET" */
+#define ASSET_PACK_VERSION      1
+#define ASSET_NAME_MAX          20              /*!< Name length, '\0' included */
+/*==================[typedef]================================================*/
+/**
+ * @brief Asset types
+ */
+typedef enum {
+    ASSET_RAW,
+    ASSET_FONT,
+    ASSET_ICONS,
+    ASSET_PICTURE,
+    ASSET_AUDIO,
+} asset_type_t;
+
+/**
+ * @brief Audio sample formats
+ */
+typedef enum {
+    ASSET_AUDIO_U8,             /*!< 8 bit PCM, 128 is silence */
+    ASSET_AUDIO_ADPCM,          /*!< IMA-ADPCM blocks of block samples (adpcm.h) */
+} asset_audio_format_t;
+
+/**
+ * @brief Pack header
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             /*!< ASSET_PACK_MAGIC */
+    uint16_t version;           /*!< ASSET_PACK_VERSION */
+    uint16_t count;             /*!< Assets in the pack */
+    uint32_t size;              /*!< Pack size, header included (bytes) */
+} asset_pack_header_t;
+
+/**
+ * @brief Entry of the asset table
+ */
+typedef struct __attribute__((packed)) {
+    char name[ASSET_NAME_MAX];  /*!< Asset name, '\0' terminated */
+    uint8_t type;               /*!< asset_type_t */
+    uint8_t reserved[3];
+    uint32_t offset;            /*!< Position from the start of the pack */
+    uint32_t size;              /*!< Size, type header included */
+} asset_entry_t;
+
+/**
+ * @brief Header of a font (followed by the char_info_t and the glyphs)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t height;             /*!< Font height in pixels */
+    uint8_t flags;              /*!< FONT_PACKED or 0 */
+    uint16_t glyphs_offset;     /*!< Position of the glyphs from the start of the asset */
+} asset_font_t;
+
+/**
+ * @brief Header of a set of icons (followed by the icons, in icon_t order)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t height;             /*!< Icon height in pixels */
+    uint8_t width;              /*!< Icon width in pixels */
+    uint16_t offset;            /*!< Bytes between icons */
+    uint8_t flags;              /*!< ICON_PACKED or 0 */
+    uint8_t reserved[3];
+} asset_icons_t;
+
+/**
+ * @brief Header of a picture (followed by width x height RGB565 pixels)
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t width;             /*!< Picture width in pixels */
+    uint16_t height;            /*!< Picture height in pixels */
+} asset_picture_t;
+
+/**
+ * @brief Header of an audio track (followed by the samples)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t samples;           /*!< Number of samples */
+    uint32_t sample_freq;       /*!< Sampling frequency (Hz) */
+    uint16_t block;             /*!< ADPCM: samples per block */
+    uint8_t format;             /*!< asset_audio_format_t */
+    uint8_t reserved;
+    char title[32];             /*!< Track title, '\0' terminated */
+    char artist[32];            /*!< Artist, '\0' terminated */
+} asset_audio_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Check the pack written in a data partition and map it
+ *
+ * @param label     Partition label (partitions.csv)
+ * @return true     Pack mapped
+ * @return false    Partition not found, no valid pack or no free address space
+ */
+bool AssetPackOpen(const char *label);
+
+/**
+ * @brief Unmap the pack: the pointers to its assets are no longer valid
+ */
+void AssetPackClose(void);
+
+/**
+ * @brief Get an asset
+ *
+ * @param name      Asset name
+ * @param type      Expected type
+ * @param size      Where the size of the asset is copied (NULL if not needed)
+ * @return const uint8_t* Start of the asset (its type header), NULL if not found
+ */
+const uint8_t * AssetGet(const char *name, asset_type_t type, uint32_t *size);
+
+/**
+ * @brief Get a font, ready for the ILI9341 functions
+ *
+ * @param name      Asset name
+ * @param font      Font to fill in (its tables stay in the pack)
+ * @return true     Found
+ * @return false    Not found or not a font
+ */
+bool AssetGetFont(const char *name, Font_t *font);
+
+/**
+ * @brief Get a set of icons, ready for ILI9341DrawIcon
+ *
+ * @param name      Asset name
+ * @param icons     Icon font to fill in (its data stays in the pack)
+ * @return true     Found
+ * @return false    Not found or not icons
+ */
+bool AssetGetIcons(const char *name, icon_font_t *icons);
+
+/**
+ * @brief Get a picture, ready for ILI9341DrawPicture
+ *
+ * @param name      Asset name
+ * @param width     Where the width is copied
+ * @param height    Where the height is copied
+ * @return const uint8_t* Pixels, NULL if not found
+ */
+const uint8_t * AssetGetPicture(const char *name, uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Get an audio track
+ *
+ * @param name      Asset name
+ * @param audio     Where the header of the track is copied
+ * @return const uint8_t* Samples (or ADPCM blocks), NULL if not found
+ */
+const uint8_t * AssetGetAudio(const char *name, asset_audio_t *audio);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ASSET_PACK_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,126 @@
+#ifndef FLASH_LOG_H_
+#define FLASH_LOG_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Flash_Log Flash Log
+ ** @{ */
+
+/** \brief Append-only log of fixed size records in a flash partition
+ * 
+ * Records are appended to one of two RAM blocks; when a block is full it is
+ * handed to a low priority writer task, which erases the next sector of the
+ * partition and writes the block while records keep going to the other one.
+ * The partition is used as a ring: once full, the oldest blocks are reused.
+ * 
+ * Block (one 4 KB flash sector): a flash_log_header_t followed by count packed
+ * records. The header is written after the records, so a block with a valid
+ * magic is always complete (e.g. after a power loss).
+ * 
+ * @note FlashLogAppend may be called from one task only. The log can be read
+ * back block by block, oldest first, while it is not recording.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define FLASH_LOG_BLOCK_SIZE    4096            /*!< Block size, one flash sector (bytes) */
+#define FLASH_LOG_MAGIC         0x474F4C46      /*!< "FLOG", marks a written block */
+#define FLASH_LOG_RECORD_MAX    64              /*!< Largest record (bytes) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Block header (little-endian, packed)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;         /*!< FLASH_LOG_MAGIC */
+    uint32_t seq;           /*!< Block number, increases with every block written */
+    uint32_t first_ms;      /*!< Timestamp of the first record (ms) */
+    uint16_t session;       /*!< Recording number, increases with every FlashLogStart */
+    uint16_t count;         /*!< Records in the block */
+    uint8_t record_size;    /*!< Size of each record (bytes) */
+    uint8_t reserved[3];
+} flash_log_header_t;
+
+/**
+ * @brief Log statistics
+ */
+typedef struct {
+    uint32_t blocks;        /*!< Blocks written since FlashLogInit */
+    uint32_t records;       /*!< Records appended since FlashLogInit */
+    uint32_t overruns;      /*!< Records discarded because the writer was still busy */
+    bool recording;         /*!< A recording is in progress */
+} flash_log_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Opens the log partition and starts the writer task
+ * 
+ * @note Scans the block headers to continue after the newest block.
+ * 
+ * @param label         Label of the partition (data type) in the partition table
+ * @param record_size   Size of each record (up to FLASH_LOG_RECORD_MAX bytes)
+ * @param priority      Priority of the writer task (lower than the producer)
+ * @return true     Log ready
+ * @return false    Partition not found or invalid record size
+ */
+bool FlashLogInit(const char *label, uint8_t record_size, uint8_t priority);
+
+/**
+ * @brief Starts a new recording (new session number)
+ */
+void FlashLogStart(void);
+
+/**
+ * @brief Ends the recording, writing the last (partial) block
+ */
+void FlashLogStop(void);
+
+/**
+ * @brief Appends a record (never blocks)
+ * 
+ * @param record        Record (record_size bytes)
+ * @param timestamp_us  Acquisition time of the record (us), stored for the first record of each block
+ * @return true     Record appended
+ * @return false    Not recording, or both blocks full (overrun)
+ */
+bool FlashLogAppend(const void *record, int64_t timestamp_us);
+
+/**
+ * @brief Number of blocks of the partition (written or not)
+ * 
+ * @return uint32_t Number of blocks
+ */
+uint32_t FlashLogBlockCount(void);
+
+/**
+ * @brief Reads a block, counting from the oldest one
+ * 
+ * @param n     Block position (0 is the oldest, FlashLogBlockCount() - 1 the newest)
+ * @param block Destination (FLASH_LOG_BLOCK_SIZE bytes)
+ * @return uint16_t Bytes of the block (header and records), 0 if the position was never written or the log is recording
+ */
+uint16_t FlashLogReadBlock(uint32_t n, uint8_t *block);
+
+/**
+ * @brief Gets the log statistics
+ * 
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void FlashLogGetStats(flash_log_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FLASH_LOG_H_ */
+
+/*==================[end of file]============================================*/
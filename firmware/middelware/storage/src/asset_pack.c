@@ -0,0 +1,149 @@
+/**
+ * @file asset_pack.c
+ * @brief Assets in a data partition, used in place through esp_partition_mmap
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "esp_partition.h"
+#include "asset_pack.h"
+/*==================[macros and definitions]=================================*/
+#define FONT_CHARS      (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+_Static_assert(sizeof(char_info_t) == 4, "the pack stores char_info_t as width, pad, offset (16 bits)");
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static esp_partition_mmap_handle_t map_handle;
+static const uint8_t *pack = NULL;
+static const asset_entry_t *entries;
+static uint16_t count = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool AssetPackOpen(const char *label){
+    const esp_partition_t *partition;
+    asset_pack_header_t header;
+    const void *map;
+
+    if(pack != NULL){
+        AssetPackClose();
+    }
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if(partition == NULL ||
+       esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+       header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION ||
+       header.size > partition->size ||
+       header.size < sizeof(header) + header.count * sizeof(asset_entry_t)){
+        return false;
+    }
+    // Only the pack is mapped, not the whole partition: address space is scarce
+    if(esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &map, &map_handle) != ESP_OK){
+        return false;
+    }
+    pack = map;
+    entries = (const asset_entry_t *)(pack + sizeof(header));
+    count = header.count;
+    // Checked once here: the getters trust the table
+    for(uint16_t i = 0; i < count; i++){
+        if(entries[i].offset > header.size || entries[i].size > header.size - entries[i].offset ||
+           entries[i].name[ASSET_NAME_MAX - 1] != '\0'){
+            AssetPackClose();
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetPackClose(void){
+    if(pack != NULL){
+        esp_partition_munmap(map_handle);
+        pack = NULL;
+        count = 0;
+    }
+}
+
+const uint8_t * AssetGet(const char *name, asset_type_t type, uint32_t *size){
+    for(uint16_t i = 0; i < count; i++){
+        if(entries[i].type == type && strcmp(entries[i].name, name) == 0){
+            if(size != NULL){
+                *size = entries[i].size;
+            }
+            return pack + entries[i].offset;
+        }
+    }
+    return NULL;
+}
+
+bool AssetGetFont(const char *name, Font_t *font){
+    asset_font_t header;
+    uint32_t size;
+    const uint8_t *asset = AssetGet(name, ASSET_FONT, &size);
+
+    if(asset == NULL || size < sizeof(header) + FONT_CHARS * sizeof(char_info_t)){
+        return false;
+    }
+    memcpy(&header, asset, sizeof(header));
+    if(header.glyphs_offset > size){
+        return false;
+    }
+    font->font_height = header.height;
+    font->flags = header.flags;
+    // The drawing functions only read the table
+    font->info = (char_info_t *)(asset + sizeof(header));
+    font->data = asset + header.glyphs_offset;
+    return true;
+}
+
+bool AssetGetIcons(const char *name, icon_font_t *icons){
+    asset_icons_t header;
+    uint32_t size;
+    const uint8_t *asset = AssetGet(name, ASSET_ICONS, &size);
+
+    if(asset == NULL || size < sizeof(header)){
+        return false;
+    }
+    memcpy(&header, asset, sizeof(header));
+    icons->height = header.height;
+    icons->width = header.width;
+    icons->offset = header.offset;
+    icons->flags = header.flags;
+    icons->data = asset + sizeof(header);
+    return true;
+}
+
+const uint8_t * AssetGetPicture(const char *name, uint16_t *width, uint16_t *height){
+    asset_picture_t header;
+    uint32_t size;
+    const uint8_t *asset = AssetGet(name, ASSET_PICTURE, &size);
+
+    if(asset == NULL || size < sizeof(header)){
+        return NULL;
+    }
+    memcpy(&header, asset, sizeof(header));
+    if(size - sizeof(header) < 2UL * header.width * header.height){
+        return NULL;
+    }
+    *width = header.width;
+    *height = header.height;
+    return asset + sizeof(header);
+}
+
+const uint8_t * AssetGetAudio(const char *name, asset_audio_t *audio){
+    uint32_t size;
+    const uint8_t *asset = AssetGet(name, ASSET_AUDIO, &size);
+
+    if(asset == NULL || size < sizeof(asset_audio_t)){
+        return NULL;
+    }
+    memcpy(audio, asset, sizeof(asset_audio_t));
+    return asset + sizeof(asset_audio_t);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,210 @@
+/**
+ * @file flash_log.c
+ * @brief Append-only log of fixed size records in a flash partition (double buffered)
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_partition.h"
+#include "flash_log.h"
+/*==================[macros and definitions]=================================*/
+#define HEADER_SIZE     sizeof(flash_log_header_t)
+#define WRITER_STACK    2048
+#define NO_BUFFER       -1
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const esp_partition_t *partition = NULL;
+static uint32_t blocks_total = 0;
+static uint32_t next_block = 0;         /*!< Next block to be written (the oldest one once the ring is full) */
+static uint32_t next_seq = 0;
+static uint16_t session = 0;
+static uint8_t record_size = 0;
+static uint16_t block_capacity = 0;     /*!< Records per block */
+static uint8_t buffers[2][FLASH_LOG_BLOCK_SIZE];
+static uint8_t active = 0;              /*!< Buffer being filled */
+static uint16_t active_count = 0;       /*!< Records in the active buffer */
+static volatile int8_t pending = NO_BUFFER;     /*!< Buffer waiting for the writer */
+static volatile bool recording = false;
+static flash_log_stats_t stats;
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t writer_task = NULL;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Hands the active buffer to the writer (call inside the critical section) */
+static bool SwapBuffer(void){
+    flash_log_header_t *header = (flash_log_header_t *)buffers[active];
+
+    if(active_count == 0){
+        return false;
+    }
+    if(pending != NO_BUFFER){
+        /* the writer is still busy with the other buffer: the block is lost */
+        stats.overruns += active_count;
+        active_count = 0;
+        return false;
+    }
+    header->count = active_count;
+    header->session = session;
+    header->record_size = record_size;
+    pending = active;
+    active ^= 1;
+    active_count = 0;
+    return true;
+}
+
+static void FlashLogWriter(void *pvParameter){
+    flash_log_header_t *header;
+    uint32_t offset;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if(pending == NO_BUFFER){
+            continue;
+        }
+        header = (flash_log_header_t *)buffers[pending];
+        header->magic = FLASH_LOG_MAGIC;
+        header->seq = next_seq++;
+        offset = next_block * FLASH_LOG_BLOCK_SIZE;
+        /* records first, header last: a valid magic means a complete block */
+        if(esp_partition_erase_range(partition, offset, FLASH_LOG_BLOCK_SIZE) == ESP_OK &&
+           esp_partition_write(partition, offset + HEADER_SIZE, buffers[pending] + HEADER_SIZE,
+                               (uint32_t)header->count * header->record_size) == ESP_OK &&
+           esp_partition_write(partition, offset, header, HEADER_SIZE) == ESP_OK){
+            stats.blocks++;
+        }
+        next_block = (next_block + 1) % blocks_total;
+        pending = NO_BUFFER;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool FlashLogInit(const char *label, uint8_t size, uint8_t priority){
+    flash_log_header_t header;
+    bool found = false;
+
+    if(size == 0 || size > FLASH_LOG_RECORD_MAX || writer_task != NULL){
+        return false;
+    }
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if(partition == NULL || partition->size < FLASH_LOG_BLOCK_SIZE){
+        return false;
+    }
+    record_size = size;
+    block_capacity = (FLASH_LOG_BLOCK_SIZE - HEADER_SIZE) / size;
+    blocks_total = partition->size / FLASH_LOG_BLOCK_SIZE;
+    /* continue after the newest block */
+    for(uint32_t i = 0; i < blocks_total; i++){
+        if(esp_partition_read(partition, i * FLASH_LOG_BLOCK_SIZE, &header, HEADER_SIZE) != ESP_OK ||
+           header.magic != FLASH_LOG_MAGIC){
+            continue;
+        }
+        if(!found || header.seq >= next_seq){
+            next_seq = header.seq + 1;
+            next_block = (i + 1) % blocks_total;
+            found = true;
+        }
+        if(header.session > session){
+            session = header.session;
+        }
+    }
+    memset(&stats, 0, sizeof(stats));
+    xTaskCreate(FlashLogWriter, "flash_log", WRITER_STACK, NULL, priority, &writer_task);
+    return writer_task != NULL;
+}
+
+void FlashLogStart(void){
+    if(writer_task == NULL || recording){
+        return;
+    }
+    taskENTER_CRITICAL(&lock);
+    session++;
+    active_count = 0;
+    recording = true;
+    taskEXIT_CRITICAL(&lock);
+}
+
+void FlashLogStop(void){
+    bool full;
+
+    if(!recording){
+        return;
+    }
+    taskENTER_CRITICAL(&lock);
+    recording = false;
+    full = SwapBuffer();
+    taskEXIT_CRITICAL(&lock);
+    if(full){
+        xTaskNotifyGive(writer_task);
+    }
+}
+
+bool FlashLogAppend(const void *record, int64_t timestamp_us){
+    flash_log_header_t *header;
+    bool full = false;
+
+    if(!recording){
+        return false;
+    }
+    taskENTER_CRITICAL(&lock);
+    if(!recording){
+        /* stopped from another task in the meantime */
+        taskEXIT_CRITICAL(&lock);
+        return false;
+    }
+    header = (flash_log_header_t *)buffers[active];
+    if(active_count == 0){
+        header->first_ms = (uint32_t)(timestamp_us / 1000);
+    }
+    memcpy(buffers[active] + HEADER_SIZE + (uint32_t)active_count * record_size, record, record_size);
+    active_count++;
+    stats.records++;
+    if(active_count == block_capacity){
+        full = SwapBuffer();
+    }
+    taskEXIT_CRITICAL(&lock);
+    if(full){
+        xTaskNotifyGive(writer_task);
+    }
+    return true;
+}
+
+uint32_t FlashLogBlockCount(void){
+    return blocks_total;
+}
+
+uint16_t FlashLogReadBlock(uint32_t n, uint8_t *block){
+    flash_log_header_t *header = (flash_log_header_t *)block;
+    uint32_t offset;
+    uint32_t length;
+
+    if(partition == NULL || recording || pending != NO_BUFFER || n >= blocks_total){
+        return 0;
+    }
+    /* next_block holds the oldest block once the ring has wrapped */
+    offset = ((next_block + n) % blocks_total) * FLASH_LOG_BLOCK_SIZE;
+    if(esp_partition_read(partition, offset, header, HEADER_SIZE) != ESP_OK || header->magic != FLASH_LOG_MAGIC){
+        return 0;
+    }
+    length = HEADER_SIZE + (uint32_t)header->count * header->record_size;
+    if(length > FLASH_LOG_BLOCK_SIZE ||
+       esp_partition_read(partition, offset + HEADER_SIZE, block + HEADER_SIZE, length - HEADER_SIZE) != ESP_OK){
+        return 0;
+    }
+    return length;
+}
+
+void FlashLogGetStats(flash_log_stats_t *dst){
+    *dst = stats;
+    dst->recording = recording;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,168 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 21:00:00 2026
+
+@author: Albano Peñalva
+
+Decodificador del modo osciloscopio (adc_scope.h, middelware). Las muestras
+llegan en tramas del sumidero de telemetría (telemetry.h), por UART o BLE:
+
+    trama           COBS, terminada en 0x00
+    seq (2)         número de trama, little endian (un salto indica pérdida)
+    tipo (1)        0x50 muestras, 0x51 estado
+    datos           muestras: canal (1) y 20 muestras de 12 bits, dos cada
+                    tres bytes (s0[7:0], s1[3:0] s0[11:8], s1[11:4])
+                    estado: frecuencia de muestreo (2), muestras por segundo
+                    entregadas (4) y perdidas (4) en el último período
+    crc (2)         CRC-16/CCITT-FALSE de seq, tipo y datos
+
+Uso:
+    python adc_scope.py --puerto /dev/ttyUSB0 --baudios 921600   (requiere pyserial)
+    python adc_scope.py --ble ESP_EDU_1                           (requiere bleak)
+    python adc_scope.py captura.bin                               (bytes recibidos)
+
+Imprime las muestras, una por línea ("canal,mV"), y los estados por stderr.
+Con --solo-estado sólo se imprimen los estados.
+"""
+
+# Librerías
+import argparse
+import struct
+import sys
+
+TIPO_MUESTRAS = 0x50
+TIPO_ESTADO = 0x51
+CARACTERISTICA = '0000ffe1-0000-1000-8000-00805f9b34fb'   # datos del servicio HM-10
+
+
+def crc16(datos):
+    crc = 0xFFFF
+    for byte in datos:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decodificar(datos):
+    salida = bytearray()
+    i = 0
+    while i < len(datos):
+        codigo = datos[i]
+        if codigo == 0 or i + codigo > len(datos) + 1:
+            raise ValueError('COBS inválido')
+        salida += datos[i + 1:i + codigo]
+        i += codigo
+        if codigo < 0xFF and i < len(datos):
+            salida.append(0)
+    return bytes(salida)
+
+
+def desempaquetar12(datos):
+    muestras = []
+    for i in range(0, len(datos) - 2, 3):
+        muestras.append(datos[i] | ((datos[i + 1] & 0x0F) << 8))
+        muestras.append((datos[i + 1] >> 4) | (datos[i + 2] << 4))
+    return muestras
+
+
+class Receptor:
+    """Separa las tramas del flujo de bytes, verifica el CRC y cuenta las pérdidas."""
+
+    def __init__(self, solo_estado):
+        self.solo_estado = solo_estado
+        self.pendiente = bytearray()
+        self.ultimo = None
+        self.tramas = 0
+        self.perdidas = 0
+        self.erroneas = 0
+
+    def recibir(self, datos):
+        self.pendiente += datos
+        while 0 in self.pendiente:
+            fin = self.pendiente.index(0)
+            codificada = bytes(self.pendiente[:fin])
+            del self.pendiente[:fin + 1]
+            if codificada:
+                self.trama(codificada)
+
+    def trama(self, codificada):
+        try:
+            trama = cobs_decodificar(codificada)
+        except ValueError:
+            self.erroneas += 1
+            return
+        if len(trama) < 5 or crc16(trama[:-2]) != struct.unpack_from('<H', trama, len(trama) - 2)[0]:
+            self.erroneas += 1
+            return
+        seq, tipo = struct.unpack_from('<HB', trama)
+        if self.ultimo is not None:
+            self.perdidas += (seq - self.ultimo - 1) & 0xFFFF
+        self.ultimo = seq
+        self.tramas += 1
+        datos = trama[3:-2]
+        if tipo == TIPO_MUESTRAS and not self.solo_estado:
+            canal = datos[0]
+            for m in desempaquetar12(datos[1:]):
+                print(f'{canal},{m}')
+        elif tipo == TIPO_ESTADO:
+            frecuencia, entregadas, perdidas = struct.unpack_from('<HII', datos)
+            print(f'{frecuencia} Hz por canal, {entregadas} muestras/s, {perdidas} perdidas', file=sys.stderr)
+
+    def resumen(self):
+        print(f'{self.tramas} tramas recibidas, {self.perdidas} saltos de secuencia, '
+              f'{self.erroneas} con errores', file=sys.stderr)
+
+
+def recibir_serie(puerto, baudios, receptor):
+    import serial
+
+    with serial.Serial(puerto, baudios, timeout=0.1) as conexion:
+        try:
+            while True:
+                receptor.recibir(conexion.read(4096))
+        except KeyboardInterrupt:
+            pass
+
+
+def recibir_ble(nombre, receptor):
+    import asyncio
+    from bleak import BleakClient, BleakScanner
+
+    async def principal():
+        dispositivo = await BleakScanner.find_device_by_name(nombre)
+        if dispositivo is None:
+            sys.exit(f'no se encontró {nombre}')
+        async with BleakClient(dispositivo) as cliente:
+            await cliente.start_notify(CARACTERISTICA, lambda _, datos: receptor.recibir(datos))
+            while cliente.is_connected:
+                await asyncio.sleep(1)
+
+    try:
+        asyncio.run(principal())
+    except KeyboardInterrupt:
+        pass
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decodificador del modo osciloscopio (adc_scope)')
+    parser.add_argument('archivo', nargs='?', help='bytes recibidos, sin procesar')
+    parser.add_argument('--puerto', help='puerto serie (UART_PC o USB Serial/JTAG)')
+    parser.add_argument('--baudios', type=int, default=921600, help='velocidad del puerto serie (no se usa con USB)')
+    parser.add_argument('--ble', metavar='NOMBRE', help='nombre del dispositivo BLE')
+    parser.add_argument('--solo-estado', action='store_true', help='sólo imprimir los estados')
+    args = parser.parse_args()
+
+    receptor = Receptor(args.solo_estado)
+    if args.puerto:
+        recibir_serie(args.puerto, args.baudios, receptor)
+    elif args.ble:
+        recibir_ble(args.ble, receptor)
+    elif args.archivo:
+        with open(args.archivo, 'rb') as entrada:
+            receptor.recibir(entrada.read())
+    else:
+        parser.error('indicar un archivo, --puerto o --ble')
+    receptor.resumen()
@@ -0,0 +1,115 @@
+#ifndef ADC_SCOPE_H_
+#define ADC_SCOPE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup ADC_Scope ADC Scope
+ ** @{ */
+
+/** \brief Scope mode: raw ADC channels streamed through the telemetry sink at the highest rate the link takes
+ *
+ * The channels are converted in continuous mode (analog_io_mcu, DMA frames).
+ * A task woken by each frame collects ADC_SCOPE_SAMPLES samples of each
+ * channel and queues them as one telemetry record, packed in 12 bits (two
+ * samples in three bytes):
+ *
+ * | channel (1) | s0[7:0] | s1[3:0] s0[11:8] | s1[11:4] | s2[7:0] | ... |
+ *
+ * The link sets the pace: the UART drain blocks while its TX ring is full, so
+ * the record ring fills and TelemetryPush rejects records; BLE drops the
+ * records without a free transmission buffer, USB the batches the host
+ * doesn't read in time. Every ADC_SCOPE_ADAPT_MS the losses decide the sample
+ * frequency of the channels:
+ * - No losses: the frequency doubles until the first loss, then grows by 1/8.
+ * - Losses: the frequency goes down by 1/4. Without any sample delivered (BLE
+ *   not connected) it goes back to min_frec and starts doubling again.
+ * Each period a status record reports the sample frequency and the samples
+ * per second that reached the link (ADC_SCOPE_TYPE_STATUS, little-endian):
+ *
+ * | sample_frec (2) | delivered (4) | lost (4) |
+ *
+ * middelware/telemetry/adc_scope.py decodes the frames on the PC.
+ *
+ * @note The link losses are read from the sink statistics: the scope should be
+ * the only source of the sink.
+ *
+ * @code
+ * static const adc_ch_t channels[] = {CH1, CH2};
+ * adc_scope_config_t scope = {
+ *     .channels = channels, .n_channels = 2,
+ *     .min_frec = 100, .max_frec = 20000, .priority = 3,
+ * };
+ * TelemetryInit(TELEMETRY_UART_PC, 1);
+ * AdcScopeInit(&scope);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | USB Serial/JTAG link (TELEMETRY_USB)                                  |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "analog_io_mcu.h"
+/*==================[macros]=================================================*/
+#define ADC_SCOPE_MAX_CHANNELS  4       /*!< Channels of the scope (CH0 to CH3) */
+#define ADC_SCOPE_SAMPLES       20      /*!< Samples of a channel in each record (30 bytes packed) */
+#define ADC_SCOPE_TYPE_SAMPLES  0x50    /*!< Record type of the samples */
+#define ADC_SCOPE_TYPE_STATUS   0x51    /*!< Record type of the status */
+#define ADC_SCOPE_ADAPT_MS      500     /*!< Period of the rate adaptation and the status */
+/*==================[typedef]================================================*/
+/**
+ * @brief Scope configuration
+ */
+typedef struct {
+    const adc_ch_t *channels;   /*!< Channels, each one once */
+    uint8_t n_channels;         /*!< Number of channels (up to ADC_SCOPE_MAX_CHANNELS) */
+    uint16_t min_frec;          /*!< Lowest sample frequency of each channel (Hz), the first one */
+    uint16_t max_frec;          /*!< Highest sample frequency of each channel (Hz) */
+    uint8_t oversampling;       /*!< Conversions averaged per sample (0 or 1: none) */
+    uint8_t priority;           /*!< Priority of the scope task (above the telemetry drain task) */
+} adc_scope_config_t;
+
+/**
+ * @brief Scope statistics
+ */
+typedef struct {
+    uint16_t sample_frec;       /*!< Current sample frequency of each channel (Hz) */
+    uint32_t delivered;         /*!< Samples per second that reached the link in the last period (all channels) */
+    uint32_t lost;              /*!< Samples lost in the last period */
+    uint32_t total;             /*!< Samples that reached the link since AdcScopeInit */
+} adc_scope_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Starts the conversion of the channels and the scope task
+ *
+ * @note The telemetry sink must be running (TelemetryInit). The channels are
+ * initialized in continuous mode by the scope.
+ *
+ * @param config    Configuration (copied)
+ * @return true     Scope running
+ * @return false    Invalid configuration, already running, or no room for the source or the task
+ */
+bool AdcScopeInit(const adc_scope_config_t *config);
+
+/**
+ * @brief Get the scope statistics (updated every ADC_SCOPE_ADAPT_MS)
+ *
+ * @param stats     Pointer to the struct where the statistics are stored
+ */
+void AdcScopeGetStats(adc_scope_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ADC_SCOPE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,112 @@
+#ifndef BOOT_TRACE_H_
+#define BOOT_TRACE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Boot_Trace Boot Trace
+ ** @{ */
+
+/** \brief Startup time breakdown and parallel initialization
+ *
+ * The application calls BootMark at the end of each startup phase (phase
+ * names are string constants, not copied). Times come from esp_timer, which
+ * starts counting at reset: the first mark includes the ROM, the second stage
+ * bootloader and the ESP-IDF startup, so the first phase of app_main should be
+ * marked on its first line. BootTracePrint logs every phase in one line:
+ *
+ * @code
+ * BOOT 3412.6 ms app_main:285.1 power:0.4 ble:121.3 sensors*:40.2 leds*:0.3 init:41.0 ... decision:3001.2
+ * @endcode
+ *
+ * Each value is the duration of the phase in ms (time since the previous
+ * mark). Phases marked with '*' ran in parallel (BootParallel): their value
+ * is their own duration and the next sequential mark covers the whole batch.
+ * The first value is the total time up to the last mark.
+ *
+ * BootParallel runs independent initializations, each one in its own task, and
+ * returns when all of them have finished. With one core it pays off when the
+ * jobs wait for hardware (bus probes, flash, delays); jobs must not depend on
+ * each other nor call non reentrant functions of a shared driver.
+ *
+ * @note Once printed the trace is closed: later marks (e.g. a recalibration)
+ * are ignored. Up to BOOT_TRACE_MARKS marks are kept.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define BOOT_TRACE_MARKS        16      /*!< Maximum number of marks */
+#define BOOT_PARALLEL_JOBS      8       /*!< Maximum number of jobs of BootParallel */
+/*==================[typedef]================================================*/
+/**
+ * @brief Startup phase
+ */
+typedef struct {
+    const char *name;           /*!< Phase name (string constant, not copied) */
+    uint32_t time_us;           /*!< End of the phase since reset (us) */
+    uint32_t duration_us;       /*!< Duration of the phase (us) */
+    uint8_t parallel;           /*!< The phase ran in a BootParallel task */
+} boot_mark_t;
+
+/**
+ * @brief Initialization function of a parallel job
+ */
+typedef void (*boot_func_t)(void);
+
+/**
+ * @brief Independent initialization run by BootParallel
+ */
+typedef struct {
+    const char *name;           /*!< Phase name, marked when the job finishes */
+    boot_func_t func;           /*!< Initialization function */
+    uint32_t stack;             /*!< Stack of the job task (bytes) */
+} boot_job_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Mark the end of a startup phase
+ *
+ * @param name          Phase name
+ */
+void BootMark(const char *name);
+
+/**
+ * @brief Run several initializations in parallel tasks and wait for all of them
+ *
+ * @note The tasks have the priority of the caller. A job whose task can not be
+ * created runs in the caller before returning.
+ *
+ * @param jobs          Array of jobs
+ * @param n_jobs        Number of jobs (up to BOOT_PARALLEL_JOBS)
+ */
+void BootParallel(const boot_job_t *jobs, uint8_t n_jobs);
+
+/**
+ * @brief Copy the marks
+ *
+ * @param marks         Array where the marks are copied
+ * @param max           Size of the array
+ * @return uint8_t      Number of marks copied
+ */
+uint8_t BootTraceGet(boot_mark_t *marks, uint8_t max);
+
+/**
+ * @brief Print the startup breakdown in one line and close the trace
+ */
+void BootTracePrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* BOOT_TRACE_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,94 @@
+#ifndef MEM_REPORT_H_
+#define MEM_REPORT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Mem_Report Memory Report
+ ** @{ */
+
+/** \brief Static RAM and heap by capability
+ *
+ * Runtime half of the memory footprint report: the size of the static
+ * variables (.data and .bss, from the linker symbols) and, for each heap
+ * capability (internal, DMA capable, default and RTC/LP RAM), the total,
+ * free, minimum free since boot and largest free block.
+ *
+ * The build half is mem_report.py, which reads the linker map and breaks the
+ * static RAM down by module and lists the biggest variables. It runs after
+ * idf.py build with the mem_report target:
+ *
+ * @code
+ * cmake --build build --target mem_report
+ * @endcode
+ *
+ * The target fails when the static RAM goes over CONFIG_MIDDELWARE_MEM_BUDGET
+ * (menuconfig: Middleware memory report, 0 disables the check), so a project
+ * can set its own budget in sdkconfig.defaults.
+ *
+ * @note Task stacks are allocated from the heap: the stack of each task and
+ * its headroom is in the task profiler report (task_profiler.h).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Heap capabilities included in the report
+ */
+typedef enum {
+    MEM_HEAP_INTERNAL,          /*!< Internal RAM (MALLOC_CAP_INTERNAL) */
+    MEM_HEAP_DMA,               /*!< DMA capable (MALLOC_CAP_DMA) */
+    MEM_HEAP_DEFAULT,           /*!< Used by malloc (MALLOC_CAP_DEFAULT) */
+    MEM_HEAP_RTC,               /*!< RTC / LP RAM (MALLOC_CAP_RTCRAM) */
+    MEM_HEAP_CAPS               /*!< Number of capabilities */
+} mem_heap_caps_t;
+
+/**
+ * @brief Heap of one capability (bytes)
+ */
+typedef struct {
+    uint32_t total;             /*!< Size of the heap regions */
+    uint32_t free;              /*!< Free now */
+    uint32_t minimum;           /*!< Minimum free since boot */
+    uint32_t largest;           /*!< Largest free block */
+} mem_heap_t;
+
+/**
+ * @brief Memory report (bytes)
+ */
+typedef struct {
+    uint32_t data;                      /*!< Initialized static variables (.data) */
+    uint32_t bss;                       /*!< Zero initialized static variables (.bss) */
+    mem_heap_t heap[MEM_HEAP_CAPS];     /*!< Heap by capability */
+} mem_report_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Fill a memory report
+ *
+ * @param report    Pointer to the struct where the report is stored
+ */
+void MemReportGet(mem_report_t *report);
+
+/**
+ * @brief Print the memory report on the console
+ */
+void MemReportPrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MEM_REPORT_H_ */
+
+/*==================[end of file]============================================*/
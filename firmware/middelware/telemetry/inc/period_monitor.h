@@ -0,0 +1,133 @@
+#ifndef PERIOD_MONITOR_H_
+#define PERIOD_MONITOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Period_Monitor Period Monitor
+ ** @{ */
+
+/** \brief Supervision of periodic jobs (timer callbacks and periodic tasks)
+ *
+ * Each periodic job calls PeriodMonitorTick when it is activated (first line
+ * of the timer callback, or right after the task wakes up). The interval since
+ * the previous activation is compared with the nominal period:
+ * - histogram of the jitter |interval - period| in powers of two of us:
+ *   0, 1, 2-3, 4-7, 8-15, 16-31, 32-63 and 64 us or more
+ * - late activations: interval longer than period + tolerance
+ * - missed activations: periods without activation, when the interval spans
+ *   several periods (e.g. a task that was still busy with the previous one)
+ * - minimum, mean and maximum interval
+ *
+ * Monitors are registered in PeriodMonitorInit; the task profiler includes
+ * all of them in its reports and logs a warning when a job misses activations.
+ *
+ * @note PeriodMonitorTick is in IRAM and can be called from interrupts; reset
+ * the monitor when the job is restarted after a pause (PeriodMonitorReset). Time
+ * comes from esp_timer (1 us).
+ *
+ * @code
+ * static period_monitor_t dac_monitor;
+ * PeriodMonitorInit(&dac_monitor, "dac", 125, 10);
+ * ...
+ * void FuncTimerSenial(void *param){
+ *     PeriodMonitorTick(&dac_monitor);
+ *     ...
+ * }
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define PERIOD_MONITOR_BINS     8       /*!< Jitter histogram bins */
+/*==================[typedef]================================================*/
+/**
+ * @brief Statistics of a periodic job
+ */
+typedef struct {
+    uint32_t activations;                       /*!< Calls to PeriodMonitorTick */
+    uint32_t late;                              /*!< Intervals longer than period + tolerance */
+    uint32_t missed;                            /*!< Periods without activation */
+    uint32_t min_us;                            /*!< Shortest interval (us) */
+    uint32_t max_us;                            /*!< Longest interval (us) */
+    uint32_t mean_us;                           /*!< Mean interval (us) */
+    uint32_t histogram[PERIOD_MONITOR_BINS];    /*!< Intervals by jitter: 0, 1, 2-3, ..., >= 64 us */
+} period_stats_t;
+
+/**
+ * @brief Monitor of a periodic job (allocated by the caller, initialized with PeriodMonitorInit)
+ */
+typedef struct period_monitor_s {
+    const char *name;                   /*!< Job name (string constant, not copied) */
+    uint32_t period_us;                 /*!< Nominal period (us) */
+    uint32_t tolerance_us;              /*!< Accepted delay (us) */
+    int64_t last_us;                    /*!< Time of the last activation (us) */
+    uint64_t sum_us;                    /*!< Sum of the intervals (us) */
+    uint32_t intervals;                 /*!< Intervals in sum_us */
+    period_stats_t stats;               /*!< Statistics */
+    struct period_monitor_s *next;      /*!< Next registered monitor */
+} period_monitor_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize and register a monitor
+ *
+ * @param monitor       Pointer to the monitor
+ * @param name          Job name
+ * @param period_us     Nominal period (us)
+ * @param tolerance_us  Accepted delay of an activation (us)
+ */
+void PeriodMonitorInit(period_monitor_t *monitor, const char *name, uint32_t period_us, uint32_t tolerance_us);
+
+/**
+ * @brief Record an activation of the job (tasks and interrupts)
+ *
+ * @param monitor       Pointer to the monitor
+ */
+void PeriodMonitorTick(period_monitor_t *monitor);
+
+/**
+ * @brief Copy the statistics of a monitor
+ *
+ * @param monitor       Pointer to the monitor
+ * @param stats         Pointer to the struct where the statistics are copied
+ */
+void PeriodMonitorGet(period_monitor_t *monitor, period_stats_t *stats);
+
+/**
+ * @brief Clear the statistics (the next activation starts a new interval),
+ * from tasks or interrupts
+ *
+ * @param monitor       Pointer to the monitor
+ */
+void PeriodMonitorReset(period_monitor_t *monitor);
+
+/**
+ * @brief Walk the registered monitors
+ *
+ * @param monitor               Current monitor, NULL for the first one
+ * @return period_monitor_t*    Next monitor, NULL after the last one
+ */
+period_monitor_t *PeriodMonitorNext(period_monitor_t *monitor);
+
+/**
+ * @brief Print the statistics of every monitor on the console
+ */
+void PeriodMonitorPrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* PERIOD_MONITOR_H_ */
+
+/*==================[end of file]============================================*/
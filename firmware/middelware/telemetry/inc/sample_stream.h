@@ -0,0 +1,163 @@
+#ifndef SAMPLE_STREAM_H_
+#define SAMPLE_STREAM_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Sample_Stream Sample Stream
+ ** @{ */
+
+/** \brief Binary streaming of int16 sample blocks over BLE
+ *
+ * Samples are packed in BLE notifications as large as the negotiated MTU,
+ * written in place in the transmission buffers of ble_mcu (zero-copy). Each
+ * notification is a block that can be decoded on its own:
+ *
+ * | seq (2) | id and encoding (1) | count (1) | samples |
+ *
+ * - seq: block sequence number (little endian). It also advances when samples
+ *   are dropped (no device connected or no free buffer), so a gap shows a loss.
+ * - id and encoding: stream id in the high nibble (several streams can share
+ *   the link), sample_stream_encoding_t in the low one.
+ * - count: number of samples in the block.
+ * - SAMPLE_STREAM_RAW16: count int16, little endian.
+ * - SAMPLE_STREAM_DELTA8: the first sample as int16, then the difference with
+ *   the previous sample as int8; differences out of -127..127 are sent as the
+ *   SAMPLE_STREAM_ESCAPE byte followed by the sample as int16.
+ * - SAMPLE_STREAM_RICE: bit stream, most significant bit first. The first
+ *   sample as int16 (big endian), then each difference with the previous
+ *   sample zig-zag mapped (0, -1, 1, -2... to 0, 1, 2, 3...) and Rice coded:
+ *   the quotient u >> k in unary (ones ended by a zero) and the k low bits.
+ *   k is the smallest value with runs << k >= sum, where sum starts at 16 and
+ *   runs at 1 in each block, every residual u is added to sum and increments
+ *   runs, and both are halved when runs reaches 32 (the decoder tracks the
+ *   same values). A run of 16 ones is the escape: the sample follows as int16.
+ *   The last byte is padded with zeros.
+ *
+ * Compared with text values ("*G-12.34*", about 9 bytes per sample) a raw
+ * sample takes 2 bytes and a smooth signal in delta mode about 1 byte, so the
+ * same link carries 4 to 9 times more samples per second. Rice coding adapts
+ * to the size of the differences: correlated biosignals (ECG, PPG,
+ * acceleration) take 3 to 6 bits per sample. Every block starts from scratch,
+ * so decoding resumes after a lost block.
+ *
+ * middelware/telemetry/sample_stream.py decodes the blocks on the PC.
+ *
+ * @code
+ * SampleStreamInit(&stream, 0, SAMPLE_STREAM_DELTA8);
+ * ...
+ * SampleStreamWrite(&stream, samples, n);     // sends every full block
+ * SampleStreamFlush(&stream);                 // sends the last samples now
+ * @endcode
+ *
+ * @note A block is kept in a transmission buffer until it is full or
+ * flushed: with a low sample rate call SampleStreamFlush periodically to
+ * bound the latency. Only one task may write to each stream.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Zig-zag Rice encoding                                                 |
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define SAMPLE_STREAM_HEADER    4       /*!< Bytes of the block header */
+#define SAMPLE_STREAM_BLOCK_MAX 244     /*!< Largest block (largest notification of ble_mcu) */
+#define SAMPLE_STREAM_ESCAPE    0x80    /*!< Delta byte announcing an int16 sample */
+/*==================[typedef]================================================*/
+/**
+ * @brief Sample encoding
+ */
+typedef enum {
+    SAMPLE_STREAM_RAW16 = 0,    /*!< int16 samples */
+    SAMPLE_STREAM_DELTA8 = 1,   /*!< First sample int16, then int8 differences */
+    SAMPLE_STREAM_RICE = 2,     /*!< First sample int16, then adaptive Rice coded differences */
+} sample_stream_encoding_t;
+
+/**
+ * @brief Stream statistics
+ */
+typedef struct {
+    uint32_t blocks;            /*!< Blocks sent */
+    uint32_t bytes;             /*!< Bytes sent, headers included */
+    uint32_t samples;           /*!< Samples sent */
+    uint32_t dropped;           /*!< Samples dropped (no device connected or no free buffer) */
+    uint32_t escapes;           /*!< Samples sent whole (difference out of the int8 range or Rice quotient too long) */
+} sample_stream_stats_t;
+
+/**
+ * @brief Sample stream (use SampleStreamInit to fill it)
+ */
+typedef struct {
+    uint8_t id;                             /*!< Stream id (0 to 15) */
+    sample_stream_encoding_t encoding;      /*!< Sample encoding */
+    uint16_t seq;                           /*!< Sequence number of the block being filled */
+    uint8_t *block;                         /*!< Transmission buffer being filled, NULL if none */
+    uint16_t capacity;                      /*!< Size of the block (MTU - 3 when it was started) */
+    uint16_t length;                        /*!< Whole bytes in the block */
+    uint8_t count;                          /*!< Samples in the block */
+    int16_t last;                           /*!< Last sample of the block (delta reference) */
+    uint8_t acc;                            /*!< Bits of the byte being filled (Rice encoding) */
+    uint8_t bits;                           /*!< Number of bits in acc */
+    uint32_t sum;                           /*!< Sum of the recent residuals (Rice parameter) */
+    uint8_t runs;                           /*!< Number of residuals in sum */
+    bool lost;                              /*!< Samples dropped since the last block (seq already advanced) */
+    sample_stream_stats_t stats;
+} sample_stream_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a stream
+ *
+ * @param stream        Stream to be initialized
+ * @param id            Stream id (0 to 15)
+ * @param encoding      Sample encoding
+ */
+void SampleStreamInit(sample_stream_t *stream, uint8_t id, sample_stream_encoding_t encoding);
+
+/**
+ * @brief Change the encoding (from the next block on, the current one is sent)
+ *
+ * @param stream        Stream
+ * @param encoding      Sample encoding
+ */
+void SampleStreamSetEncoding(sample_stream_t *stream, sample_stream_encoding_t encoding);
+
+/**
+ * @brief Add samples to the stream, sending every block that gets full (never blocks)
+ *
+ * @param stream        Stream
+ * @param samples       Samples
+ * @param n             Number of samples
+ * @return uint16_t     Samples queued, the others were dropped
+ */
+uint16_t SampleStreamWrite(sample_stream_t *stream, const int16_t *samples, uint16_t n);
+
+/**
+ * @brief Send the block being filled, if it has samples
+ *
+ * @param stream        Stream
+ */
+void SampleStreamFlush(sample_stream_t *stream);
+
+/**
+ * @brief Get the stream statistics
+ *
+ * @param stream        Stream
+ * @param stats         Pointer to the struct where the statistics are stored
+ */
+void SampleStreamGetStats(const sample_stream_t *stream, sample_stream_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* SAMPLE_STREAM_H_ */
+
+/*==================[end of file]============================================*/
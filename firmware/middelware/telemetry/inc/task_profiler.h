@@ -0,0 +1,141 @@
+#ifndef TASK_PROFILER_H_
+#define TASK_PROFILER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Task_Profiler Task Profiler
+ ** @{ */
+
+/** \brief Per task CPU load, stack headroom and heap minimum
+ *
+ * A low priority task samples the FreeRTOS run time counters of every task
+ * (uxTaskGetSystemState) each period and computes:
+ * - CPU load of each task in the last period (time running / total time)
+ * - minimum free stack since the task started (the high water mark that
+ *   uxTaskGetStackHighWaterMark returns, in bytes)
+ * - free heap, minimum free heap since boot and largest free block
+ * - statistics of the periodic jobs registered in period_monitor
+ *
+ * Every report is published (TaskProfilerGetReport) and sent as telemetry
+ * records through its own source ring, so it reaches the PC or the phone over
+ * the link of the telemetry sink (UART or BLE):
+ *
+ * | type     | payload (little-endian)                                              |
+ * |:--------:|:---------------------------------------------------------------------|
+ * | type     | heap free (4), heap minimum (4), largest block (4), CPU load (2), tasks (1) |
+ * | type + 1 | name (16, zero padded), CPU load (2), free stack (2), priority (1), task number (1) |
+ * | type + 2 | name (12, zero padded), activations (4), late (4), missed (4), max period (4), mean period (4) |
+ *
+ * CPU loads are in tenths of percent; the load of the summary record is the
+ * time not spent in the idle task. A warning is logged when the free stack
+ * of a task falls below TASK_PROFILER_STACK_WARNING, and when a periodic job
+ * missed activations since the previous report.
+ *
+ * Tasks of the schedule table (rt_schedule_mcu.h) carry their estimated load,
+ * WCET / period, which is printed next to the measured one; a task that
+ * loads the CPU more than that is logged as a warning (its WCET estimate,
+ * or its minimum interval, does not hold).
+ *
+ * @note Needs CONFIG_MIDDELWARE_TASK_PROFILER (menuconfig: Middleware task
+ * profiler), which enables the FreeRTOS trace facility and run time stats.
+ * The run time counter is esp_timer (1 us), a 32 bit counter wraps every 71
+ * minutes, so the period must be shorter than that.
+ *
+ * @code
+ * TelemetryInit(TELEMETRY_UART_PC, 1);
+ * TaskProfilerInit(5000, 0x10, 1);     // report every 5 s, records 0x10 and 0x11
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Periodic job statistics (period_monitor)								|
+ * | 15/10/2026 | Estimated load of the tasks of the schedule table						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "period_monitor.h"
+/*==================[macros]=================================================*/
+#define TASK_PROFILER_MAX_TASKS     24      /*!< Tasks included in a report */
+#define TASK_PROFILER_NAME_LENGTH   16      /*!< Task name length (configMAX_TASK_NAME_LEN) */
+#define TASK_PROFILER_STACK_WARNING 256     /*!< Free stack that triggers a warning (bytes) */
+#define TASK_PROFILER_MAX_MONITORS  8       /*!< Periodic jobs included in a report */
+/*==================[typedef]================================================*/
+/**
+ * @brief Profile of one task
+ */
+typedef struct {
+    char name[TASK_PROFILER_NAME_LENGTH];   /*!< Task name */
+    uint16_t cpu;                           /*!< CPU load in the last period (tenths of %) */
+    uint16_t stack_free;                    /*!< Minimum free stack since the task started (bytes) */
+    uint8_t priority;                       /*!< Current priority */
+    uint8_t number;                         /*!< FreeRTOS task number (unique) */
+    uint16_t budget;                        /*!< Estimated load from the schedule table (tenths of %), 0 if not in it */
+} task_profile_t;
+
+/**
+ * @brief Statistics of one periodic job
+ */
+typedef struct {
+    const char *name;                       /*!< Job name */
+    uint32_t period_us;                     /*!< Nominal period (us) */
+    period_stats_t stats;                   /*!< Statistics since start (or PeriodMonitorReset) */
+} task_profiler_job_t;
+
+/**
+ * @brief Report of one period
+ */
+typedef struct {
+    uint32_t timestamp_ms;                  /*!< Time of the report (TimestampMs) */
+    uint32_t heap_free;                     /*!< Free heap (bytes) */
+    uint32_t heap_min;                      /*!< Minimum free heap since boot (bytes) */
+    uint32_t heap_largest;                  /*!< Largest free block (bytes) */
+    uint16_t cpu;                           /*!< CPU load out of the idle task (tenths of %) */
+    uint8_t n_tasks;                        /*!< Tasks in the report */
+    task_profile_t tasks[TASK_PROFILER_MAX_TASKS];  /*!< Tasks, in FreeRTOS order */
+    uint8_t n_jobs;                         /*!< Periodic jobs in the report */
+    task_profiler_job_t jobs[TASK_PROFILER_MAX_MONITORS];  /*!< Periodic jobs (period_monitor) */
+} task_profiler_report_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the profiler task
+ *
+ * @note Call it after TelemetryInit to send the reports (the profiler takes
+ * one of the TELEMETRY_MAX_SOURCES rings).
+ *
+ * @param period_ms Report period (ms)
+ * @param type      Telemetry record type of the summary, task records use type + 1
+ * @param priority  Priority of the profiler task (lowest that gets to run)
+ * @return true     Profiler started
+ * @return false    Already started, no telemetry source available or run time stats disabled
+ */
+bool TaskProfilerInit(uint32_t period_ms, uint8_t type, uint8_t priority);
+
+/**
+ * @brief Get the last report
+ *
+ * @param report    Pointer to the struct where the report is copied
+ * @return true     Report copied
+ * @return false    No report yet
+ */
+bool TaskProfilerGetReport(task_profiler_report_t *report);
+
+/**
+ * @brief Print the last report as a table on the console
+ */
+void TaskProfilerPrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TASK_PROFILER_H_ */
+
+/*==================[end of file]============================================*/
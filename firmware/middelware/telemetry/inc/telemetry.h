@@ -0,0 +1,249 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Telemetry Telemetry
+ ** @{ */
+
+/** \brief Binary telemetry sink over UART, USB or BLE
+ * 
+ * Producers push fixed size records into their own SPSC ring (lock-free, never
+ * blocks); a low priority drain task empties the rings, frames each record and
+ * writes the frames in batches to the selected link.
+ * 
+ * Frame, before encoding (multibyte fields little-endian):
+ * 
+ * | seq (2) | type (1) | payload (0..TELEMETRY_PAYLOAD_MAX) | crc (2) |
+ * 
+ * seq counts every frame of the sink (gaps show lost frames), crc is
+ * CRC-16/CCITT-FALSE of seq, type and payload. The frame is COBS encoded and
+ * ended with a 0x00 byte, so a receiver resynchronizes at the next zero.
+ * 
+ * @note The link is handled as a byte stream: frames are packed in notifications
+ * of up to MTU - 3 bytes (or UART writes of 256 bytes, USB writes of 2048 bytes)
+ * and may be split between two of them. With BLE, records are discarded while
+ * no device is connected or no transmission buffer is free.
+ * With UART the port must be initialized by the application (UartInit or
+ * UartStreamInit).
+ *
+ * With TELEMETRY_USB the frames go through the USB Serial/JTAG controller
+ * (usb_serial_mcu, initialized by the application with UsbSerialInit), a CDC
+ * port on the PC far faster than the UART. The drain task never waits for
+ * the host: records are discarded while no host is connected, and a whole
+ * batch when the host doesn't read the port and the TX ring is full (its
+ * frames are counted in dropped_link).
+ *
+ * With TELEMETRY_UDP (TelemetryInitUdp, needs CONFIG_DRIVERS_WIFI) the records
+ * are not framed one by one: they are collected for period_ms (or until
+ * TELEMETRY_UDP_RAW_MAX bytes) and sent in one datagram, so the radio wakes up
+ * once per period (wifi_mcu Target Wake Time) and a server collects the
+ * datagrams of many devices. Each datagram stands alone (a lost one doesn't
+ * affect the next), little-endian:
+ *
+ * | 'T' (1) | flags (1) | mac (6) | seq (2) | records (1) | uptime_ms (4) | raw length (2) | body |
+ *
+ * The raw body is every record as | type (1) | length (1) | payload |, where a
+ * payload is XORed with the previous record of the same type and length of
+ * the datagram (slowly changing records become mostly zeros). With flags bit 0
+ * the body is zero-run encoded: 0x00 n stands for n zero bytes, any other byte
+ * is itself. middelware/telemetry/telemetry_server.py receives and decodes them.
+ * The Wi-Fi station must be initialized by the application (WifiInit).
+ *
+ * With TELEMETRY_ESPNOW (TelemetryInitEspNow, needs CONFIG_DRIVERS_ESPNOW) the
+ * records go straight to another board (espnow_mcu), for sensors spread over
+ * several boards and fused on one: every push wakes the drain task, and the
+ * records pending are sent at once in one ESP-NOW frame, so a record reaches
+ * the other board in well under a millisecond. Frame, little-endian:
+ *
+ * | 'E' (1) | ack batch (1) | seq (2) | records (1) | records: type (1) | length (1) | payload |
+ *
+ * The receiving board gets the records with TelemetryEspNowListen. Unicast
+ * frames are acknowledged by the radio; with ack_batch > 0 the receiver also
+ * acknowledges every ack_batch frames of a sender with one broadcast frame:
+ *
+ * | 'A' (1) | sender mac (6) | newest seq (2) | bitmap (4) |
+ *
+ * where bit i of the bitmap is set if frame newest seq - 1 - i was received.
+ * The sender keeps its last TELEMETRY_ESPNOW_WINDOW frames and sends the ones
+ * reported missing once more (also with broadcast, that has no radio
+ * acknowledgements); the receiver discards duplicates. Frames that start with
+ * other bytes are left to the modules sharing the radio (EspNowAddHandler,
+ * e.g. time_sync.h).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * | 15/10/2026 | Batched and compressed UDP datagrams over Wi-Fi (TELEMETRY_UDP)       |
+ * | 15/10/2026 | Board to board frames over ESP-NOW with batched acknowledgements      |
+ * | 15/10/2026 | USB Serial/JTAG link, non-blocking (TELEMETRY_USB)                    |
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "spsc_ring.h"
+/*==================[macros]=================================================*/
+#define TELEMETRY_PAYLOAD_MAX   32      /*!< Maximum payload of a record (bytes) */
+#define TELEMETRY_MAX_SOURCES   4       /*!< Rings drained by the sink */
+#define TELEMETRY_UDP_RAW_MAX   1024    /*!< Raw body of a datagram (TELEMETRY_UDP) */
+#define TELEMETRY_UDP_HEADER    17      /*!< Datagram header (TELEMETRY_UDP) */
+#define TELEMETRY_UDP_ZRLE      0x01    /*!< Flag of a zero-run encoded body (TELEMETRY_UDP) */
+#define TELEMETRY_ESPNOW_HEADER 5       /*!< Frame header (TELEMETRY_ESPNOW) */
+#define TELEMETRY_ESPNOW_WINDOW 8       /*!< Frames kept for retransmission (TELEMETRY_ESPNOW with ack_batch) */
+#define TELEMETRY_ESPNOW_SENDERS 4      /*!< Boards tracked by TelemetryEspNowListen (duplicates and acknowledgements) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Telemetry link
+ */
+typedef enum {
+    TELEMETRY_UART_PC,          /*!< UART_PC */
+    TELEMETRY_UART_CONNECTOR,   /*!< UART_CONNECTOR */
+    TELEMETRY_BLE,              /*!< BLE notifications (ble_mcu) */
+    TELEMETRY_UDP,              /*!< Datagrams to a server over Wi-Fi (wifi_mcu), see TelemetryInitUdp */
+    TELEMETRY_ESPNOW,           /*!< Frames to another board over ESP-NOW (espnow_mcu), see TelemetryInitEspNow */
+    TELEMETRY_USB,              /*!< USB Serial/JTAG CDC port (usb_serial_mcu) */
+} telemetry_link_t;
+
+/**
+ * @brief UDP link configuration
+ */
+typedef struct {
+    const char *host;           /*!< IPv4 address of the server */
+    uint16_t port;              /*!< UDP port of the server */
+    uint32_t period_ms;         /*!< Time between datagrams (the Wi-Fi wake interval) */
+} telemetry_udp_config_t;
+
+/**
+ * @brief ESP-NOW link configuration
+ */
+typedef struct {
+    const uint8_t *peer;        /*!< Address of the receiving board (6 bytes), NULL for every board on the channel */
+    uint8_t channel;            /*!< Wi-Fi channel (1 to 13), the same in every board */
+    uint8_t ack_batch;          /*!< Frames per acknowledgement of the receiver (0: radio acknowledgements only, up to TELEMETRY_ESPNOW_WINDOW / 2 so a lost acknowledgement is covered by the next one) */
+} telemetry_espnow_config_t;
+
+/**
+ * @brief Record queued by a producer (item type of the source rings)
+ */
+typedef struct {
+    uint8_t type;                               /*!< Record type, defined by the application */
+    uint8_t length;                             /*!< Payload length */
+    uint8_t payload[TELEMETRY_PAYLOAD_MAX];     /*!< Payload */
+} telemetry_record_t;
+
+/**
+ * @brief Prototype of callback function for the records received over ESP-NOW
+ *
+ * @note Called from the Wi-Fi task: keep it short (e.g. copy the record to a queue).
+ *
+ * @param mac       address of the sending board (6 bytes)
+ * @param record    received record
+ */
+typedef void (*telemetry_record_func) (const uint8_t *mac, const telemetry_record_t *record);
+
+/**
+ * @brief Sink statistics
+ */
+typedef struct {
+    uint32_t frames;            /*!< Frames written to the link */
+    uint32_t bytes;             /*!< Bytes written to the link */
+    uint32_t dropped_queue;     /*!< Records rejected because a source ring was full */
+    uint32_t dropped_link;      /*!< Records discarded because the link was not available */
+    uint32_t datagrams;         /*!< Datagrams sent (TELEMETRY_UDP) */
+    uint32_t raw_bytes;         /*!< Raw body bytes of the datagrams sent, before the encoding (TELEMETRY_UDP) */
+    uint32_t retransmissions;   /*!< Frames sent again, reported missing by the receiver (TELEMETRY_ESPNOW) */
+    uint32_t unacked;           /*!< Records of frames never acknowledged by the receiver (TELEMETRY_ESPNOW) */
+    uint32_t received;          /*!< Records received and delivered (TelemetryEspNowListen) */
+    uint32_t gaps;              /*!< Frames of the senders never received (TelemetryEspNowListen) */
+} telemetry_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start the sink and its drain task
+ * 
+ * @param link      Link where the frames are written
+ * @param priority  Priority of the drain task (lower than the producers)
+ * @return true     Sink started
+ */
+bool TelemetryInit(telemetry_link_t link, uint8_t priority);
+
+/**
+ * @brief Start the sink on the UDP link and its drain task
+ * 
+ * @note frames counts the records sent, bytes the datagram bytes.
+ * 
+ * @param config    Server and period
+ * @param priority  Priority of the drain task (lower than the producers)
+ * @return true     Sink started
+ * @return false    Already started, invalid server or built without CONFIG_DRIVERS_WIFI
+ */
+bool TelemetryInitUdp(const telemetry_udp_config_t *config, uint8_t priority);
+
+/**
+ * @brief Start the sink on the ESP-NOW link and its drain task
+ * 
+ * @note frames counts the records sent, bytes the ESP-NOW frame bytes.
+ * 
+ * @param config    Receiving board, channel and acknowledgements
+ * @param priority  Priority of the drain task (lower than the producers)
+ * @return true     Sink started
+ * @return false    Already started, ack_batch above TELEMETRY_ESPNOW_WINDOW, ESP-NOW not available or built without CONFIG_DRIVERS_ESPNOW
+ */
+bool TelemetryInitEspNow(const telemetry_espnow_config_t *config, uint8_t priority);
+
+/**
+ * @brief Receive the records sent by other boards with TELEMETRY_ESPNOW
+ * 
+ * @note Independent of the sink: a board may forward its own records to any
+ * link and receive the ones of other boards. With TelemetryInitEspNow on the
+ * same board, use the same channel.
+ * 
+ * @param channel   Wi-Fi channel (1 to 13), the same in every board
+ * @param func_p    Pointer to callback function to call for each record
+ * @return true     Listening
+ * @return false    ESP-NOW not available or built without CONFIG_DRIVERS_ESPNOW
+ */
+bool TelemetryEspNowListen(uint8_t channel, telemetry_record_func func_p);
+
+/**
+ * @brief Register a producer ring (defined with SPSC_RING_DEFINE(name, telemetry_record_t, length))
+ * 
+ * @param ring  Ring of the producer
+ * @return true     Ring added
+ * @return false    TELEMETRY_MAX_SOURCES rings already added
+ */
+bool TelemetryAddSource(spsc_ring_t *ring);
+
+/**
+ * @brief Queue a record (producer side, never blocks)
+ * 
+ * @note Only one task may push to each ring.
+ * 
+ * @param ring      Ring of the producer
+ * @param type      Record type
+ * @param payload   Payload
+ * @param length    Payload length (up to TELEMETRY_PAYLOAD_MAX)
+ * @return true     Record queued
+ * @return false    Ring full or payload too long, record dropped
+ */
+bool TelemetryPush(spsc_ring_t *ring, uint8_t type, const void *payload, uint8_t length);
+
+/**
+ * @brief Get the sink statistics
+ * 
+ * @param stats Pointer to the struct where the statistics are stored
+ */
+void TelemetryGetStats(telemetry_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TELEMETRY_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,115 @@
+#ifndef TIME_SYNC_H_
+#define TIME_SYNC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Time_Sync Time Sync
+ ** @{ */
+
+/** \brief Time synchronization between boards over ESP-NOW
+ *
+ * Boards that sample together (e.g. sensors on the chest and on the back
+ * fused on one of them) need a common time base to line up their samples.
+ * One board is the master; every period_ms each client exchanges timestamps
+ * with it, as NTP does:
+ *
+ * | 'S' (1) | seq (1) | t1 (8) |                                         request, client to master
+ * | 'R' (1) | client mac (6) | seq (1) | t1 (8) | t2 (8) | t3 (8) |      reply, broadcast
+ *
+ * t1 is the client's time when the request is sent, t2 and t3 the master's
+ * sync time when it is received and when the reply is sent, and t4 the
+ * client's time when the reply is received (microseconds, little-endian):
+ *
+ *   offset = ((t2 - t1) + (t3 - t4)) / 2        delay = (t4 - t1) - (t3 - t2)
+ *
+ * The offset is exact if both ways take the same time, so the client keeps
+ * the last TIME_SYNC_SAMPLES exchanges and trusts the one with the shortest
+ * delay (the least queued in the radio and the Wi-Fi task). The drift (the
+ * difference between the crystals) is the slope of a least squares line
+ * through the offsets of the exchanges with a delay close to that one. Both
+ * go to TimestampSyncAdjust (timestamp_mcu.h), which slews the sync time of
+ * the client towards the master's: stamp the samples with TimestampSyncUs,
+ * or convert TimestampUs stamps with TimestampToSyncUs.
+ *
+ * @note Needs CONFIG_DRIVERS_ESPNOW. The radio is shared with the telemetry
+ * sink (TELEMETRY_ESPNOW): the same channel must be used by both.
+ *
+ * @code
+ * time_sync_config_t sync = {.role = TIME_SYNC_CLIENT, .master = NULL, .channel = 1, .period_ms = 1000};
+ * TimeSyncInit(&sync, 3);
+ * ...
+ * muestra.t = TimestampSyncUs();
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 15/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define TIME_SYNC_SAMPLES       16      /*!< Exchanges kept by a client for the offset and drift estimates */
+#define TIME_SYNC_MARGIN_US     200     /*!< Exchanges up to this longer than the shortest are used for the drift */
+#define TIME_SYNC_TIMEOUT_MS    50      /*!< Time a client waits for a reply */
+/*==================[typedef]================================================*/
+/**
+ * @brief Role of the board
+ */
+typedef enum {
+    TIME_SYNC_MASTER,           /*!< Answers the requests with its sync time */
+    TIME_SYNC_CLIENT,           /*!< Follows the master's time */
+} time_sync_role_t;
+
+/**
+ * @brief Time sync configuration
+ */
+typedef struct {
+    time_sync_role_t role;      /*!< Master or client */
+    const uint8_t *master;      /*!< Client: address of the master (6 bytes), NULL to broadcast the requests */
+    uint8_t channel;            /*!< Wi-Fi channel, the same in every board */
+    uint16_t period_ms;         /*!< Client: time between exchanges */
+} time_sync_config_t;
+
+/**
+ * @brief Time sync statistics (client)
+ */
+typedef struct {
+    bool synced;                /*!< The sync time follows the master */
+    int64_t offset_us;          /*!< Master minus local time, best exchange */
+    int32_t drift_ppb;          /*!< Master rate relative to the local clock */
+    uint32_t delay_us;          /*!< Round trip of the best exchange */
+    uint32_t exchanges;         /*!< Requests answered */
+    uint32_t lost;              /*!< Requests not answered within TIME_SYNC_TIMEOUT_MS */
+} time_sync_stats_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Start answering (master) or sending (client) time requests
+ *
+ * @param config    Time sync configuration
+ * @param priority  Priority of the client task (unused by the master)
+ * @return true     Started
+ * @return false    Already started, ESP-NOW not available or built without CONFIG_DRIVERS_ESPNOW
+ */
+bool TimeSyncInit(const time_sync_config_t *config, uint8_t priority);
+
+/**
+ * @brief Get the statistics of the client
+ *
+ * @param stats     Pointer to the struct where the statistics are copied
+ */
+void TimeSyncGetStats(time_sync_stats_t *stats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TIME_SYNC_H_ */
+
+/*==================[end of file]============================================*/
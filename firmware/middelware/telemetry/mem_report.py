@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 16:00:00 2026
+
+@author: Albano Peñalva
+
+Reporte de memoria estática a partir del archivo .map del enlazador.
+Suma por módulo (archivo objeto o biblioteca) los bytes de cada región:
+
+    data    variables inicializadas (.data, .sdata), RAM y flash
+    bss     variables sin inicializar (.bss, .sbss, COMMON, .noinit), RAM
+    iram    código en RAM (.iram0)
+    text    código en flash
+    rodata  constantes en flash
+
+y lista las variables más grandes de RAM. En el ESP32-C6 data, bss e iram
+comparten la misma RAM interna que el heap: lo que suman es lo que el heap
+no tiene. Con --presupuesto el script termina con error si la RAM estática
+supera ese valor (presupuesto de cada proyecto, CONFIG_MIDDELWARE_MEM_BUDGET).
+
+Uso (después de idf.py build):
+    cmake --build build --target mem_report
+    python mem_report.py build/proyecto.map --por biblioteca --cantidad 30
+
+El reporte de la RAM dinámica (heap por capacidad) se imprime en la placa con
+MemReportPrint() (mem_report.h).
+"""
+
+# Librerías
+import argparse
+import re
+import sys
+from collections import defaultdict
+
+REGIONES = ['data', 'bss', 'iram', 'text', 'rodata']
+RAM = ['data', 'bss', 'iram']
+
+# Sección de entrada en una línea o con dirección y tamaño en la línea siguiente
+SECCION = re.compile(r'^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+))?$')
+DIRECCION = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+)$')
+# Nombre de la variable o función en secciones por símbolo (-fdata-sections)
+SIMBOLO = re.compile(r'^\.(?:s?bss|s?data|dram1|iram1|rodata|srodata|text|literal)\.(.+)$')
+# Biblioteca y objeto: esp-idf/middelware/libmiddelware.a(fft.c.obj)
+ARCHIVO = re.compile(r'([^/\\]+\.a)\(([^)]+)\)$')
+
+
+def region(salida):
+    """Región de una sección de salida, None si no ocupa memoria"""
+    if salida.startswith('.debug') or salida in ('.comment', '.riscv.attributes'):
+        return None
+    if 'bss' in salida or 'noinit' in salida:
+        return 'bss'
+    if salida.startswith('.iram'):
+        return 'iram'
+    if 'rodata' in salida or 'appdesc' in salida:
+        return 'rodata'
+    if salida.startswith('.flash') and 'text' in salida:
+        return 'text'
+    if 'data' in salida:
+        return 'data'
+    return None
+
+
+def modulo(archivo, por):
+    """Nombre del módulo según el agrupamiento"""
+    m = ARCHIVO.search(archivo)
+    if m is None:
+        # objeto suelto o símbolos del enlazador
+        return archivo.split('/')[-1].split('\\')[-1]
+    if por == 'biblioteca':
+        return m.group(1)
+    return m.group(1) + ':' + m.group(2)
+
+
+def leer_map(nombre, por):
+    """Tamaños por módulo y región, y variables de RAM (región, símbolo, módulo, bytes)"""
+    modulos = defaultdict(lambda: defaultdict(int))
+    simbolos = []
+    salida = None
+    pendiente = None
+    en_mapa = False
+    with open(nombre, encoding='utf-8', errors='replace') as f:
+        for linea in f:
+            linea = linea.rstrip('\n')
+            if not en_mapa:
+                en_mapa = linea.startswith('Linker script and memory map')
+                continue
+            if linea and not linea[0].isspace():
+                # sección de salida (.dram0.bss, .flash.text, ...)
+                salida = linea.split()[0]
+                pendiente = None
+                continue
+            if pendiente is not None:
+                m = DIRECCION.match(linea)
+                seccion, pendiente = pendiente, None
+                if m is None:
+                    continue
+                tamanio, archivo = int(m.group(2), 16), m.group(3)
+            else:
+                m = SECCION.match(linea)
+                if m is None or m.group(1).startswith('*'):
+                    continue
+                if m.group(2) is None:
+                    pendiente = m.group(1)
+                    continue
+                seccion, tamanio, archivo = m.group(1), int(m.group(3), 16), m.group(4)
+            r = region(salida or '')
+            if r is None or tamanio == 0:
+                continue
+            mod = modulo(archivo.strip(), por)
+            modulos[mod][r] += tamanio
+            if r in RAM:
+                s = SIMBOLO.match(seccion)
+                simbolos.append((r, s.group(1) if s else seccion, mod, tamanio))
+    return modulos, simbolos
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Reporte de memoria estática por módulo')
+    parser.add_argument('map', help='archivo .map generado por idf.py build')
+    parser.add_argument('--por', choices=['objeto', 'biblioteca'], default='objeto',
+                        help='agrupar por archivo objeto o por biblioteca')
+    parser.add_argument('--cantidad', type=int, default=20, help='módulos y variables a listar')
+    parser.add_argument('--presupuesto', type=int, default=0,
+                        help='RAM estática máxima en bytes (0: sin control)')
+    args = parser.parse_args()
+
+    modulos, simbolos = leer_map(args.map, args.por)
+    if not modulos:
+        print('No se encontró el mapa de memoria en ' + args.map)
+        return 1
+    total = defaultdict(int)
+    for tamanios in modulos.values():
+        for r in REGIONES:
+            total[r] += tamanios[r]
+
+    # módulos ordenados por RAM estática
+    orden = sorted(modulos.items(), key=lambda m: sum(m[1][r] for r in RAM), reverse=True)
+    print('%-48s %8s %8s %8s %8s %8s %8s' % ('modulo', 'data', 'bss', 'iram', 'RAM', 'text', 'rodata'))
+    for mod, t in orden[:args.cantidad]:
+        print('%-48s %8d %8d %8d %8d %8d %8d' % (mod[-48:], t['data'], t['bss'], t['iram'],
+                                                 sum(t[r] for r in RAM), t['text'], t['rodata']))
+    ram = sum(total[r] for r in RAM)
+    print('%-48s %8d %8d %8d %8d %8d %8d' % ('TOTAL (%d modulos)' % len(modulos), total['data'],
+                                             total['bss'], total['iram'], ram, total['text'], total['rodata']))
+
+    print('\nVariables de RAM mas grandes:')
+    for r, simbolo, mod, tamanio in sorted(simbolos, key=lambda s: s[3], reverse=True)[:args.cantidad]:
+        print('%8d  %-4s  %-40s %s' % (tamanio, r, simbolo[-40:], mod))
+
+    if args.presupuesto > 0:
+        print('\nRAM estatica %d de %d bytes (margen %d)' % (ram, args.presupuesto, args.presupuesto - ram))
+        if ram > args.presupuesto:
+            print('Presupuesto de RAM estatica excedido')
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,182 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 19:00:00 2026
+
+@author: Albano Peñalva
+
+Decodificador de los bloques de muestras enviados por BLE con sample_stream
+(sample_stream.h, middelware). Cada notificación es un bloque:
+
+    seq (2)         número de bloque, little endian (un salto indica pérdida)
+    id y modo (1)   id del flujo en el nibble alto, codificación en el bajo
+    cantidad (1)    muestras del bloque
+    muestras        RAW16: int16 little endian
+                    DELTA8: la primera int16, luego diferencias int8; el byte
+                    0x80 anuncia una muestra int16 completa
+                    RICE: flujo de bits; la primera int16, luego diferencias
+                    en zig-zag con código Rice de parámetro adaptivo (ver
+                    sample_stream.h); 16 unos anuncian una muestra int16
+
+Uso:
+    python sample_stream.py bloques.txt          (un bloque por línea, en hexadecimal)
+    python sample_stream.py --ble ESP_EDU_1      (se conecta y recibe, requiere bleak)
+
+Imprime las muestras de cada flujo, una por línea ("id,muestra"), y al final
+la cantidad de bloques recibidos y perdidos. Con --escala se divide cada
+muestra (por ejemplo 10 para el ECG de ej_bluetooth_filter).
+"""
+
+# Librerías
+import argparse
+import struct
+import sys
+
+CABECERA = 4
+RAW16 = 0
+DELTA8 = 1
+RICE = 2
+ESCAPE = 0x80
+RICE_Q_MAX = 16
+RICE_K_MAX = 15
+RICE_SUMA_INICIAL = 16
+RICE_REINICIO = 32
+CARACTERISTICA = '0000ffe1-0000-1000-8000-00805f9b34fb'   # datos del servicio HM-10
+
+
+class LectorBits:
+    """Lee bits de un bloque, el más significativo primero."""
+
+    def __init__(self, datos):
+        self.datos = datos
+        self.pos = 0
+
+    def leer(self, n):
+        valor = 0
+        for _ in range(n):
+            byte = self.datos[self.pos >> 3]
+            valor = (valor << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return valor
+
+
+def a_int16(valor):
+    return valor - 0x10000 if valor & 0x8000 else valor
+
+
+def decodificar_rice(datos, cantidad):
+    """Sigue el mismo estado que el codificador (suma y cantidad de residuos)."""
+    lector = LectorBits(datos)
+    muestras = []
+    if cantidad > 0:
+        muestras.append(a_int16(lector.leer(16)))
+    suma, corridas = RICE_SUMA_INICIAL, 1
+    while len(muestras) < cantidad:
+        k = 0
+        while k < RICE_K_MAX and (corridas << k) < suma:
+            k += 1
+        q = 0
+        while q < RICE_Q_MAX and lector.leer(1):
+            q += 1
+        anterior = muestras[-1]
+        if q == RICE_Q_MAX:
+            muestra = a_int16(lector.leer(16))
+            delta = muestra - anterior
+            u = 2 * delta if delta >= 0 else -2 * delta - 1
+        else:
+            u = (q << k) | lector.leer(k)
+            muestra = anterior + (u >> 1 if u % 2 == 0 else -((u + 1) >> 1))
+        muestras.append(muestra)
+        suma += u
+        corridas += 1
+        if corridas == RICE_REINICIO:
+            suma >>= 1
+            corridas >>= 1
+    return muestras
+
+
+def decodificar(bloque):
+    """Devuelve (seq, id, muestras) de un bloque."""
+    seq, modo, cantidad = struct.unpack_from('<HBB', bloque)
+    flujo, codificacion = modo >> 4, modo & 0x0F
+    datos = bloque[CABECERA:]
+    muestras = []
+    if codificacion == RAW16:
+        muestras = list(struct.unpack_from(f'<{cantidad}h', datos))
+    elif codificacion == DELTA8:
+        if cantidad > 0:
+            muestras.append(struct.unpack_from('<h', datos)[0])
+        i = 2
+        while len(muestras) < cantidad:
+            if datos[i] == ESCAPE:
+                muestras.append(struct.unpack_from('<h', datos, i + 1)[0])
+                i += 3
+            else:
+                muestras.append(muestras[-1] + struct.unpack_from('<b', datos, i)[0])
+                i += 1
+    elif codificacion == RICE:
+        muestras = decodificar_rice(datos, cantidad)
+    else:
+        raise ValueError(f'codificación desconocida {codificacion}')
+    return seq, flujo, muestras
+
+
+class Receptor:
+    """Acumula las muestras de cada flujo y cuenta los bloques perdidos."""
+
+    def __init__(self, escala):
+        self.escala = escala
+        self.ultimo = {}
+        self.bloques = 0
+        self.perdidos = 0
+
+    def recibir(self, bloque):
+        seq, flujo, muestras = decodificar(bytes(bloque))
+        if flujo in self.ultimo:
+            self.perdidos += (seq - self.ultimo[flujo] - 1) & 0xFFFF
+        self.ultimo[flujo] = seq
+        self.bloques += 1
+        for m in muestras:
+            print(f'{flujo},{m / self.escala:g}')
+
+    def resumen(self):
+        print(f'{self.bloques} bloques recibidos, {self.perdidos} saltos de secuencia', file=sys.stderr)
+
+
+def recibir_ble(nombre, receptor):
+    import asyncio
+    from bleak import BleakClient, BleakScanner
+
+    async def principal():
+        dispositivo = await BleakScanner.find_device_by_name(nombre)
+        if dispositivo is None:
+            sys.exit(f'no se encontró {nombre}')
+        async with BleakClient(dispositivo) as cliente:
+            await cliente.start_notify(CARACTERISTICA, lambda _, datos: receptor.recibir(datos))
+            while cliente.is_connected:
+                await asyncio.sleep(1)
+
+    try:
+        asyncio.run(principal())
+    except KeyboardInterrupt:
+        pass
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Decodificador de bloques de sample_stream')
+    parser.add_argument('archivo', nargs='?', help='bloques en hexadecimal, uno por línea (- para stdin)')
+    parser.add_argument('--ble', metavar='NOMBRE', help='nombre del dispositivo BLE')
+    parser.add_argument('--escala', type=float, default=1, help='divisor de las muestras')
+    args = parser.parse_args()
+
+    receptor = Receptor(args.escala)
+    if args.ble:
+        recibir_ble(args.ble, receptor)
+    elif args.archivo:
+        entrada = sys.stdin if args.archivo == '-' else open(args.archivo)
+        for linea in entrada:
+            if linea.strip():
+                receptor.recibir(bytes.fromhex(linea.strip()))
+    else:
+        parser.error('indicar un archivo o --ble')
+    receptor.resumen()
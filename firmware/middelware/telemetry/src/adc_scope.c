@@ -0,0 +1,187 @@
+/**
+ * @file adc_scope.c
+ * @brief Scope mode: raw ADC channels streamed through the telemetry sink at the highest rate the link takes
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "adc_scope.h"
+#include "telemetry.h"
+#include "spsc_ring.h"
+/*==================[macros and definitions]=================================*/
+#define SCOPE_RING_LENGTH   64      /*!< Records queued for the drain task */
+#define SCOPE_STACK         3072    /*!< Stack of the scope task (frame buffers) */
+#define PACKED_LENGTH       (ADC_SCOPE_SAMPLES * 3 / 2)     /*!< Bytes of the packed samples of a record */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+SPSC_RING_DEFINE(scope_ring, telemetry_record_t, SCOPE_RING_LENGTH);
+static adc_scope_config_t scope_config;
+static TaskHandle_t scope_task = NULL;
+static uint16_t pending[ADC_SCOPE_MAX_CHANNELS][ADC_SCOPE_SAMPLES];    /*!< Samples of each channel (by adc_ch_t) */
+static uint8_t pending_count[ADC_SCOPE_MAX_CHANNELS];
+static uint16_t sample_frec;
+static bool slow_start = true;          /*!< The frequency doubles until the first loss */
+static uint32_t pushed = 0;             /*!< Samples queued in the current period */
+static uint32_t rejected = 0;           /*!< Samples rejected by the ring in the current period */
+static uint32_t last_dropped_link = 0;
+static adc_scope_stats_t stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void IRAM_ATTR AdcScopeFrameIsr(void *param){
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(scope_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Packs 12 bit samples, two in three bytes (little-endian nibbles)
+ */
+static void Pack12(const uint16_t *samples, uint8_t *out, uint8_t n){
+    uint16_t s0, s1;
+    for(uint8_t i = 0; i < n; i += 2){
+        s0 = samples[i] & 0x0FFF;
+        s1 = samples[i + 1] & 0x0FFF;
+        *out++ = s0 & 0xFF;
+        *out++ = (s0 >> 8) | ((s1 & 0x0F) << 4);
+        *out++ = s1 >> 4;
+    }
+}
+
+static void AdcScopeAdd(adc_ch_t channel, uint16_t value){
+    uint8_t payload[1 + PACKED_LENGTH];
+
+    pending[channel][pending_count[channel]++] = value;
+    if(pending_count[channel] < ADC_SCOPE_SAMPLES){
+        return;
+    }
+    pending_count[channel] = 0;
+    payload[0] = channel;
+    Pack12(pending[channel], &payload[1], ADC_SCOPE_SAMPLES);
+    if(TelemetryPush(&scope_ring, ADC_SCOPE_TYPE_SAMPLES, payload, sizeof(payload))){
+        pushed += ADC_SCOPE_SAMPLES;
+    }else{
+        rejected += ADC_SCOPE_SAMPLES;
+    }
+}
+
+/**
+ * @brief Measures the last period, chooses the next sample frequency and
+ * queues the status record
+ */
+static void AdcScopeAdapt(uint32_t elapsed_ms){
+    telemetry_stats_t link;
+    uint32_t link_lost, frec = sample_frec;
+    uint8_t status[10];
+
+    TelemetryGetStats(&link);
+    link_lost = (link.dropped_link - last_dropped_link) * ADC_SCOPE_SAMPLES;
+    last_dropped_link = link.dropped_link;
+    if(link_lost > pushed){
+        link_lost = pushed;
+    }
+    stats.delivered = (uint64_t)(pushed - link_lost) * 1000 / elapsed_ms;
+    stats.lost = rejected + link_lost;
+    stats.total += pushed - link_lost;
+
+    if(stats.lost == 0){
+        frec += slow_start ? frec : (frec / 8 > 0 ? frec / 8 : 1);
+    }else if(stats.delivered == 0){
+        // nothing reaches the link (e.g. BLE not connected): probe again from the bottom
+        frec = scope_config.min_frec;
+        slow_start = true;
+    }else{
+        frec -= frec / 4;
+        slow_start = false;
+    }
+    if(frec < scope_config.min_frec){
+        frec = scope_config.min_frec;
+    }else if(frec > scope_config.max_frec){
+        frec = scope_config.max_frec;
+    }
+    if(frec != sample_frec){
+        sample_frec = frec;
+        AnalogSetContinuousFrequency(sample_frec);
+        // the conversion restarts: the samples of both rates don't share a record
+        memset(pending_count, 0, sizeof(pending_count));
+    }
+    stats.sample_frec = sample_frec;
+    pushed = 0;
+    rejected = 0;
+
+    status[0] = sample_frec & 0xFF;
+    status[1] = sample_frec >> 8;
+    for(uint8_t i = 0; i < 4; i++){
+        status[2 + i] = (stats.delivered >> (8 * i)) & 0xFF;
+        status[6 + i] = (stats.lost >> (8 * i)) & 0xFF;
+    }
+    TelemetryPush(&scope_ring, ADC_SCOPE_TYPE_STATUS, status, sizeof(status));
+}
+
+/**
+ * @brief Scope task: empties the DMA frames at each frame interrupt and adapts
+ * the sample frequency every ADC_SCOPE_ADAPT_MS
+ */
+static void AdcScopeTask(void *pvParameter){
+    uint16_t values[ADC_CONT_FRAME_LEN];
+    adc_ch_t channels[ADC_CONT_FRAME_LEN];
+    TickType_t period_start = xTaskGetTickCount(), elapsed;
+    uint16_t n;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ADC_SCOPE_ADAPT_MS));
+        while((n = AnalogInputReadFrame(values, channels)) > 0){
+            for(uint16_t i = 0; i < n; i++){
+                AdcScopeAdd(channels[i], values[i]);
+            }
+        }
+        elapsed = xTaskGetTickCount() - period_start;
+        if(elapsed >= pdMS_TO_TICKS(ADC_SCOPE_ADAPT_MS)){
+            AdcScopeAdapt(elapsed * portTICK_PERIOD_MS);
+            period_start += elapsed;
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+bool AdcScopeInit(const adc_scope_config_t *config){
+    analog_input_config_t input;
+
+    if(scope_task != NULL || config->n_channels == 0 || config->n_channels > ADC_SCOPE_MAX_CHANNELS ||
+       config->min_frec == 0 || config->min_frec > config->max_frec){
+        return false;
+    }
+    scope_config = *config;
+    sample_frec = config->min_frec;
+    stats.sample_frec = sample_frec;
+    if(!TelemetryAddSource(&scope_ring) ||
+       xTaskCreate(AdcScopeTask, "adc_scope", SCOPE_STACK, NULL, config->priority, &scope_task) != pdPASS){
+        return false;
+    }
+    for(uint8_t i = 0; i < config->n_channels; i++){
+        input.input = config->channels[i];
+        input.mode = ADC_CONTINUOUS;
+        // one interrupt per frame is enough: every frame carries all the channels
+        input.func_p = (i == 0) ? AdcScopeFrameIsr : NULL;
+        input.param_p = NULL;
+        input.sample_frec = sample_frec;
+        input.oversampling = config->oversampling;
+        AnalogInputInit(&input);
+    }
+    AnalogStartContinuous(config->channels[0]);
+    return true;
+}
+
+void AdcScopeGetStats(adc_scope_stats_t *stats_out){
+    *stats_out = stats;
+}
+
+/*==================[end of file]============================================*/
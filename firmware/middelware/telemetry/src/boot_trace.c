@@ -0,0 +1,126 @@
+/**
+ * @file boot_trace.c
+ * @brief Startup phase timestamps and parallel initialization tasks
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "boot_trace.h"
+/*==================[macros and definitions]=================================*/
+#define JOB_TASK_NAME   "boot_job"
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Parallel job and the semaphore given when it finishes
+ */
+typedef struct {
+    const boot_job_t *job;
+    SemaphoreHandle_t done;
+} job_context_t;
+/*==================[internal functions declaration]==========================*/
+
+/*==================[internal data definition]===============================*/
+static boot_mark_t marks[BOOT_TRACE_MARKS];
+static uint8_t n_marks = 0;
+static uint32_t last_us = 0;            /*!< End of the last sequential phase */
+static uint32_t parallel_us = 0;        /*!< Start of the running BootParallel batch */
+static bool closed = false;
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void Mark(const char *name, bool parallel){
+    uint32_t now = (uint32_t)esp_timer_get_time();
+
+    taskENTER_CRITICAL(&lock);
+    if(!closed && n_marks < BOOT_TRACE_MARKS){
+        marks[n_marks].name = name;
+        marks[n_marks].time_us = now;
+        marks[n_marks].parallel = parallel;
+        if(parallel){
+            marks[n_marks].duration_us = now - parallel_us;
+        } else {
+            marks[n_marks].duration_us = now - last_us;
+            last_us = now;
+        }
+        n_marks++;
+    }
+    taskEXIT_CRITICAL(&lock);
+}
+
+static void JobTask(void *param){
+    job_context_t *context = (job_context_t *)param;
+
+    context->job->func();
+    Mark(context->job->name, true);
+    xSemaphoreGive(context->done);
+    vTaskDelete(NULL);
+}
+/*==================[external functions definition]==========================*/
+void BootMark(const char *name){
+    Mark(name, false);
+}
+
+void BootParallel(const boot_job_t *jobs, uint8_t n_jobs){
+    job_context_t context[BOOT_PARALLEL_JOBS];
+    UBaseType_t priority = uxTaskPriorityGet(NULL);
+    SemaphoreHandle_t done;
+    uint8_t started = 0;
+
+    n_jobs = (n_jobs < BOOT_PARALLEL_JOBS) ? n_jobs : BOOT_PARALLEL_JOBS;
+    parallel_us = (uint32_t)esp_timer_get_time();
+    done = xSemaphoreCreateCounting(n_jobs, 0);
+    for(uint8_t i = 0; i < n_jobs; i++){
+        context[i].job = &jobs[i];
+        context[i].done = done;
+        if(done != NULL && xTaskCreate(JobTask, JOB_TASK_NAME, jobs[i].stack, &context[i], priority, NULL) == pdPASS){
+            started++;
+        } else {
+            jobs[i].func();
+            Mark(jobs[i].name, true);
+        }
+    }
+    // context[] lives in this stack frame: wait for every task before returning
+    for(uint8_t i = 0; i < started; i++){
+        xSemaphoreTake(done, portMAX_DELAY);
+    }
+    if(done != NULL){
+        vSemaphoreDelete(done);
+    }
+}
+
+uint8_t BootTraceGet(boot_mark_t *copy, uint8_t max){
+    uint8_t n;
+
+    taskENTER_CRITICAL(&lock);
+    n = (n_marks < max) ? n_marks : max;
+    for(uint8_t i = 0; i < n; i++){
+        copy[i] = marks[i];
+    }
+    taskEXIT_CRITICAL(&lock);
+    return n;
+}
+
+void BootTracePrint(void){
+    taskENTER_CRITICAL(&lock);
+    closed = true;
+    taskEXIT_CRITICAL(&lock);
+    if(n_marks == 0){
+        return;
+    }
+    printf("BOOT %lu.%lu ms", last_us / 1000, (last_us / 100) % 10);
+    for(uint8_t i = 0; i < n_marks; i++){
+        printf(" %s%s:%lu.%lu", marks[i].name, marks[i].parallel ? "*" : "",
+               marks[i].duration_us / 1000, (marks[i].duration_us / 100) % 10);
+    }
+    printf("\r\n");
+}
+
+/*==================[end of file]============================================*/
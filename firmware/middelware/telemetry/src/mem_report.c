@@ -0,0 +1,64 @@
+/**
+ * @file mem_report.c
+ * @brief Static RAM and heap by capability
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "esp_heap_caps.h"
+#include "mem_report.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+/* Linker script symbols */
+extern int _data_start, _data_end, _bss_start, _bss_end;
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const uint32_t heap_caps[MEM_HEAP_CAPS] = {
+    [MEM_HEAP_INTERNAL] = MALLOC_CAP_INTERNAL,
+    [MEM_HEAP_DMA] = MALLOC_CAP_DMA,
+    [MEM_HEAP_DEFAULT] = MALLOC_CAP_DEFAULT,
+    [MEM_HEAP_RTC] = MALLOC_CAP_RTCRAM,
+};
+static const char *heap_names[MEM_HEAP_CAPS] = {
+    [MEM_HEAP_INTERNAL] = "internal",
+    [MEM_HEAP_DMA] = "DMA",
+    [MEM_HEAP_DEFAULT] = "default",
+    [MEM_HEAP_RTC] = "RTC",
+};
+/*==================[external data definition]===============================*/
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void MemReportGet(mem_report_t *report){
+    report->data = (uint32_t)((uint8_t *)&_data_end - (uint8_t *)&_data_start);
+    report->bss = (uint32_t)((uint8_t *)&_bss_end - (uint8_t *)&_bss_start);
+    for(uint8_t i = 0; i < MEM_HEAP_CAPS; i++){
+        report->heap[i].total = heap_caps_get_total_size(heap_caps[i]);
+        report->heap[i].free = heap_caps_get_free_size(heap_caps[i]);
+        report->heap[i].minimum = heap_caps_get_minimum_free_size(heap_caps[i]);
+        report->heap[i].largest = heap_caps_get_largest_free_block(heap_caps[i]);
+    }
+}
+
+void MemReportPrint(void){
+    mem_report_t report;
+
+    MemReportGet(&report);
+    printf("Static RAM %lu bytes (data %lu, bss %lu)\r\n", report.data + report.bss, report.data, report.bss);
+    printf("Heap          total     free  minimum  largest\r\n");
+    for(uint8_t i = 0; i < MEM_HEAP_CAPS; i++){
+        if(report.heap[i].total == 0){
+            continue;
+        }
+        printf("%-9s %9lu %8lu %8lu %8lu\r\n", heap_names[i], report.heap[i].total, report.heap[i].free,
+               report.heap[i].minimum, report.heap[i].largest);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,114 @@
+/**
+ * @file period_monitor.c
+ * @brief Period, jitter and missed activations of periodic jobs
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "period_monitor.h"
+/*==================[macros and definitions]=================================*/
+#define NO_ACTIVATION   -1
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static period_monitor_t *monitors = NULL;       /*!< Registered monitors */
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Histogram bin of a jitter: 0, 1, 2-3, 4-7, ... (log2 + 1)
+ */
+static inline uint8_t IRAM_ATTR JitterBin(uint32_t jitter_us){
+    uint8_t bin = (jitter_us == 0) ? 0 : 32 - __builtin_clz(jitter_us);
+    return (bin < PERIOD_MONITOR_BINS) ? bin : PERIOD_MONITOR_BINS - 1;
+}
+
+static void ClearStats(period_monitor_t *monitor){
+    memset(&monitor->stats, 0, sizeof(period_stats_t));
+    monitor->stats.min_us = UINT32_MAX;
+    monitor->last_us = NO_ACTIVATION;
+    monitor->sum_us = 0;
+    monitor->intervals = 0;
+}
+/*==================[external functions definition]==========================*/
+void PeriodMonitorInit(period_monitor_t *monitor, const char *name, uint32_t period_us, uint32_t tolerance_us){
+    monitor->name = name;
+    monitor->period_us = period_us;
+    monitor->tolerance_us = tolerance_us;
+    ClearStats(monitor);
+    taskENTER_CRITICAL(&lock);
+    monitor->next = monitors;
+    monitors = monitor;
+    taskEXIT_CRITICAL(&lock);
+}
+
+void IRAM_ATTR PeriodMonitorTick(period_monitor_t *monitor){
+    int64_t now = esp_timer_get_time();
+    period_stats_t *stats = &monitor->stats;
+    uint32_t interval, jitter, periods;
+
+    portENTER_CRITICAL_SAFE(&lock);
+    stats->activations++;
+    if(monitor->last_us != NO_ACTIVATION){
+        interval = (uint32_t)(now - monitor->last_us);
+        jitter = (interval > monitor->period_us) ? interval - monitor->period_us : monitor->period_us - interval;
+        stats->histogram[JitterBin(jitter)]++;
+        if(interval > monitor->period_us + monitor->tolerance_us){
+            stats->late++;
+            // periods that went by without an activation, rounded
+            periods = (interval + monitor->period_us / 2) / monitor->period_us;
+            stats->missed += (periods > 1) ? periods - 1 : 0;
+        }
+        stats->min_us = (interval < stats->min_us) ? interval : stats->min_us;
+        stats->max_us = (interval > stats->max_us) ? interval : stats->max_us;
+        monitor->sum_us += interval;
+        monitor->intervals++;
+    }
+    monitor->last_us = now;
+    portEXIT_CRITICAL_SAFE(&lock);
+}
+
+void PeriodMonitorGet(period_monitor_t *monitor, period_stats_t *stats){
+    taskENTER_CRITICAL(&lock);
+    *stats = monitor->stats;
+    stats->mean_us = (monitor->intervals > 0) ? monitor->sum_us / monitor->intervals : 0;
+    taskEXIT_CRITICAL(&lock);
+    if(stats->min_us == UINT32_MAX){
+        stats->min_us = 0;
+    }
+}
+
+void PeriodMonitorReset(period_monitor_t *monitor){
+    portENTER_CRITICAL_SAFE(&lock);
+    ClearStats(monitor);
+    portEXIT_CRITICAL_SAFE(&lock);
+}
+
+period_monitor_t *PeriodMonitorNext(period_monitor_t *monitor){
+    return (monitor == NULL) ? monitors : monitor->next;
+}
+
+void PeriodMonitorPrint(void){
+    period_stats_t stats;
+
+    for(period_monitor_t *monitor = monitors; monitor != NULL; monitor = monitor->next){
+        PeriodMonitorGet(monitor, &stats);
+        printf("%s: period %lu us (%lu..%lu), %lu activations, %lu late, %lu missed\r\n", monitor->name,
+               stats.mean_us, stats.min_us, stats.max_us, stats.activations, stats.late, stats.missed);
+        printf("  jitter us   0:%lu 1:%lu 2:%lu 4:%lu 8:%lu 16:%lu 32:%lu 64+:%lu\r\n", stats.histogram[0],
+               stats.histogram[1], stats.histogram[2], stats.histogram[3], stats.histogram[4],
+               stats.histogram[5], stats.histogram[6], stats.histogram[7]);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,231 @@
+/**
+ * @file sample_stream.c
+ * @brief Binary streaming of int16 sample blocks over BLE
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "sample_stream.h"
+#include "ble_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define DELTA_MAX       127     /*!< Largest difference sent in one byte (-128 is the escape) */
+#define RICE_Q_MAX      16      /*!< Unary quotients this long are the escape (raw sample follows) */
+#define RICE_K_MAX      15      /*!< Largest Rice parameter */
+#define RICE_SUM_INIT   16      /*!< Residual sum at the start of a block (k = 4) */
+#define RICE_RESET      32      /*!< Residuals after which the sum and count are halved */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Take a transmission buffer for a new block
+ * @return false    No device connected or no free buffer
+ */
+static bool BlockStart(sample_stream_t *stream){
+    uint16_t mtu = BleGetMtu() - 3;
+
+    stream->block = BleTxBufferGet();
+    if(stream->block == NULL){
+        // One sequence number per loss: the receiver sees a gap
+        if(!stream->lost){
+            stream->seq++;
+            stream->lost = true;
+        }
+        return false;
+    }
+    stream->capacity = (mtu < SAMPLE_STREAM_BLOCK_MAX) ? mtu : SAMPLE_STREAM_BLOCK_MAX;
+    stream->length = SAMPLE_STREAM_HEADER;
+    stream->count = 0;
+    stream->lost = false;
+    stream->acc = 0;
+    stream->bits = 0;
+    stream->sum = RICE_SUM_INIT;
+    stream->runs = 1;
+    return true;
+}
+
+static void BlockSend(sample_stream_t *stream){
+    uint8_t *block = stream->block;
+
+    if(stream->bits > 0){
+        // Last byte of the bit stream, padded with zeros
+        block[stream->length++] = stream->acc << (8 - stream->bits);
+        stream->bits = 0;
+    }
+    block[0] = stream->seq & 0xFF;
+    block[1] = stream->seq >> 8;
+    block[2] = (stream->id << 4) | stream->encoding;
+    block[3] = stream->count;
+    BleTxBufferSend(block, stream->length);
+    stream->stats.blocks++;
+    stream->stats.bytes += stream->length;
+    stream->stats.samples += stream->count;
+    stream->seq++;
+    stream->block = NULL;
+}
+
+/**
+ * @brief Zig-zag map of a difference: 0, -1, 1, -2, 2... to 0, 1, 2, 3, 4...
+ */
+static uint32_t ZigZag(int16_t sample, int16_t last){
+    int32_t delta = (int32_t)sample - last;
+
+    return (delta >= 0) ? ((uint32_t)delta << 1) : (((uint32_t)-delta << 1) - 1);
+}
+
+/**
+ * @brief Rice parameter from the mean of the previous residuals of the block
+ */
+static uint8_t RiceK(const sample_stream_t *stream){
+    uint8_t k = 0;
+
+    while(k < RICE_K_MAX && ((uint32_t)stream->runs << k) < stream->sum){
+        k++;
+    }
+    return k;
+}
+
+/**
+ * @brief Bits the sample takes in the current block
+ */
+static uint8_t SampleBits(const sample_stream_t *stream, int16_t sample){
+    int32_t delta = (int32_t)sample - stream->last;
+    uint32_t q;
+    uint8_t k;
+
+    if(stream->encoding == SAMPLE_STREAM_RAW16 || stream->count == 0){
+        return 16;
+    }
+    if(stream->encoding == SAMPLE_STREAM_DELTA8){
+        return (delta >= -DELTA_MAX && delta <= DELTA_MAX) ? 8 : 24;
+    }
+    k = RiceK(stream);
+    q = ZigZag(sample, stream->last) >> k;
+    return (q < RICE_Q_MAX) ? q + 1 + k : RICE_Q_MAX + 16;
+}
+
+/**
+ * @brief Append bits to the block, most significant first
+ */
+static void BitsPut(sample_stream_t *stream, uint32_t value, uint8_t n){
+    while(n--){
+        stream->acc = (stream->acc << 1) | ((value >> n) & 1);
+        if(++stream->bits == 8){
+            stream->block[stream->length++] = stream->acc;
+            stream->acc = 0;
+            stream->bits = 0;
+        }
+    }
+}
+
+static void RicePut(sample_stream_t *stream, int16_t sample){
+    uint32_t u = ZigZag(sample, stream->last);
+    uint8_t k = RiceK(stream);
+    uint32_t q = u >> k;
+
+    if(q < RICE_Q_MAX){
+        BitsPut(stream, ((1UL << q) - 1) << 1, q + 1);
+        BitsPut(stream, u, k);
+    } else{
+        BitsPut(stream, (1UL << RICE_Q_MAX) - 1, RICE_Q_MAX);
+        BitsPut(stream, (uint16_t)sample, 16);
+        stream->stats.escapes++;
+    }
+    stream->sum += u;
+    if(++stream->runs == RICE_RESET){
+        stream->sum >>= 1;
+        stream->runs >>= 1;
+    }
+}
+
+static void SamplePut(sample_stream_t *stream, int16_t sample, uint8_t bits){
+    uint8_t *p = &stream->block[stream->length];
+
+    if(stream->encoding == SAMPLE_STREAM_RICE){
+        if(stream->count == 0){
+            BitsPut(stream, (uint16_t)sample, 16);
+        } else{
+            RicePut(stream, sample);
+        }
+    } else{
+        switch(bits){
+            case 8:
+                p[0] = (uint8_t)(int8_t)(sample - stream->last);
+                break;
+            case 24:
+                *p++ = SAMPLE_STREAM_ESCAPE;
+                stream->stats.escapes++;
+                /* fall through */
+            default:
+                p[0] = (uint16_t)sample & 0xFF;
+                p[1] = (uint16_t)sample >> 8;
+                break;
+        }
+        stream->length += bits / 8;
+    }
+    stream->count++;
+    stream->last = sample;
+}
+
+/**
+ * @brief The sample doesn't fit in the current block
+ */
+static bool BlockFull(const sample_stream_t *stream, uint8_t bits){
+    return (stream->length * 8 + stream->bits + bits > stream->capacity * 8) || stream->count == UINT8_MAX;
+}
+/*==================[external functions definition]==========================*/
+void SampleStreamInit(sample_stream_t *stream, uint8_t id, sample_stream_encoding_t encoding){
+    memset(stream, 0, sizeof(*stream));
+    stream->id = id & 0x0F;
+    stream->encoding = encoding;
+}
+
+void SampleStreamSetEncoding(sample_stream_t *stream, sample_stream_encoding_t encoding){
+    if(encoding != stream->encoding){
+        SampleStreamFlush(stream);
+        stream->encoding = encoding;
+    }
+}
+
+uint16_t SampleStreamWrite(sample_stream_t *stream, const int16_t *samples, uint16_t n){
+    uint16_t queued = 0;
+    uint8_t bits;
+
+    for(uint16_t i = 0; i < n; i++){
+        if(stream->block == NULL && !BlockStart(stream)){
+            continue;
+        }
+        bits = SampleBits(stream, samples[i]);
+        if(BlockFull(stream, bits)){
+            BlockSend(stream);
+            if(!BlockStart(stream)){
+                continue;
+            }
+            bits = SampleBits(stream, samples[i]);
+        }
+        SamplePut(stream, samples[i], bits);
+        queued++;
+    }
+    stream->stats.dropped += n - queued;
+    return queued;
+}
+
+void SampleStreamFlush(sample_stream_t *stream){
+    if(stream->block != NULL && stream->count > 0){
+        BlockSend(stream);
+    }
+}
+
+void SampleStreamGetStats(const sample_stream_t *stream, sample_stream_stats_t *stats){
+    *stats = stream->stats;
+}
+
+/*==================[end of file]============================================*/
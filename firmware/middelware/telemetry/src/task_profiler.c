@@ -0,0 +1,285 @@
+/**
+ * @file task_profiler.c
+ * @brief Per task CPU load, stack headroom and heap minimum
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "task_profiler.h"
+#include "telemetry.h"
+#include "seqlock.h"
+#include "timestamp_mcu.h"
+#include "rt_schedule_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define PROFILER_STACK      3072
+#define RING_LENGTH         64      /*!< Summary, task and job records of a report (power of two) */
+#define JOB_NAME_LENGTH     12
+#define PERMILLE(part, total)   ((total) > 0 ? (uint16_t)(((uint64_t)(part) * 1000 + (total) / 2) / (total)) : 0)
+
+static const char *TAG = "task_profiler";
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Payload of the summary record
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t heap_free;
+    uint32_t heap_min;
+    uint32_t heap_largest;
+    uint16_t cpu;
+    uint8_t n_tasks;
+} summary_record_t;
+
+/**
+ * @brief Payload of a task record
+ */
+typedef struct __attribute__((packed)) {
+    char name[TASK_PROFILER_NAME_LENGTH];
+    uint16_t cpu;
+    uint16_t stack_free;
+    uint8_t priority;
+    uint8_t number;
+} task_record_t;
+/**
+ * @brief Payload of a periodic job record
+ */
+typedef struct __attribute__((packed)) {
+    char name[JOB_NAME_LENGTH];
+    uint32_t activations;
+    uint32_t late;
+    uint32_t missed;
+    uint32_t max_us;
+    uint32_t mean_us;
+} job_record_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static TaskHandle_t profiler_task = NULL;
+static uint32_t period;
+static uint8_t record_type;
+static bool reported = false;
+static TaskStatus_t status[TASK_PROFILER_MAX_TASKS];
+/* run time counter and free stack of each task at the previous sample, by task number */
+static UBaseType_t last_number[TASK_PROFILER_MAX_TASKS];
+static configRUN_TIME_COUNTER_TYPE last_counter[TASK_PROFILER_MAX_TASKS];
+static uint16_t last_stack[TASK_PROFILER_MAX_TASKS];
+static uint8_t last_count = 0;
+static configRUN_TIME_COUNTER_TYPE last_total = 0;
+/* missed activations of each periodic job at the previous sample */
+static const period_monitor_t *last_job[TASK_PROFILER_MAX_MONITORS];
+static uint32_t last_missed[TASK_PROFILER_MAX_MONITORS];
+static uint8_t last_jobs = 0;
+static task_profiler_report_t work;        /*!< Report being built by the profiler task */
+static task_profiler_report_t printed;     /*!< Copy printed by TaskProfilerPrint */
+SPSC_RING_DEFINE(profiler_ring, telemetry_record_t, RING_LENGTH);
+SEQLOCK_DEFINE(last_report, task_profiler_report_t);
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static int16_t FindLast(UBaseType_t number){
+    for(uint8_t i = 0; i < last_count; i++){
+        if(last_number[i] == number){
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Add the statistics of the periodic jobs to the report
+ */
+static void TaskProfilerSampleJobs(task_profiler_report_t *report){
+    const period_monitor_t *sampled[TASK_PROFILER_MAX_MONITORS];
+    period_monitor_t *monitor = NULL;
+    uint32_t missed;
+    uint8_t n = 0;
+
+    while((monitor = PeriodMonitorNext(monitor)) != NULL && n < TASK_PROFILER_MAX_MONITORS){
+        task_profiler_job_t *job = &report->jobs[n];
+
+        job->name = monitor->name;
+        job->period_us = monitor->period_us;
+        PeriodMonitorGet(monitor, &job->stats);
+        missed = 0;
+        for(uint8_t i = 0; i < last_jobs; i++){
+            if(last_job[i] == monitor){
+                missed = last_missed[i];
+                break;
+            }
+        }
+        // a reset monitor starts again from zero
+        if(job->stats.missed > missed){
+            ESP_LOGW(TAG, "%s: %lu activations missed", job->name, job->stats.missed - missed);
+        }
+        sampled[n++] = monitor;
+    }
+    for(uint8_t i = 0; i < n; i++){
+        last_job[i] = sampled[i];
+        last_missed[i] = report->jobs[i].stats.missed;
+    }
+    last_jobs = n;
+    report->n_jobs = n;
+}
+
+/**
+ * @brief Build a report from the counters of every task
+ */
+static void TaskProfilerSample(task_profiler_report_t *report){
+    configRUN_TIME_COUNTER_TYPE total, elapsed, counter;
+    TaskHandle_t idle = xTaskGetIdleTaskHandle();
+    const rt_task_t *scheduled;
+    uint16_t idle_cpu = 0;
+    UBaseType_t n;
+    int16_t last;
+
+    n = uxTaskGetSystemState(status, TASK_PROFILER_MAX_TASKS, &total);
+    if(n == 0){
+        // more tasks than TASK_PROFILER_MAX_TASKS: nothing is filled in
+        ESP_LOGW(TAG, "More than %d tasks", TASK_PROFILER_MAX_TASKS);
+        return;
+    }
+    elapsed = total - last_total;
+    report->timestamp_ms = TimestampMs();
+    report->n_tasks = n;
+    for(uint8_t i = 0; i < n; i++){
+        task_profile_t *task = &report->tasks[i];
+
+        last = FindLast(status[i].xTaskNumber);
+        // a task created in this period counts from zero
+        counter = status[i].ulRunTimeCounter - ((last >= 0) ? last_counter[last] : 0);
+        strlcpy(task->name, status[i].pcTaskName, TASK_PROFILER_NAME_LENGTH);
+        task->cpu = PERMILLE(counter, elapsed);
+        task->stack_free = (status[i].usStackHighWaterMark > UINT16_MAX) ? UINT16_MAX : status[i].usStackHighWaterMark;
+        task->priority = status[i].uxCurrentPriority;
+        task->number = status[i].xTaskNumber;
+        scheduled = RtScheduleFind(task->name);
+        task->budget = (scheduled != NULL) ? RtScheduleLoad(scheduled) : 0;
+        if(scheduled != NULL && last >= 0 && task->cpu > task->budget){
+            ESP_LOGW(TAG, "%s: load %u.%u%% over its estimate of %u.%u%%", task->name, task->cpu / 10, task->cpu % 10,
+                     task->budget / 10, task->budget % 10);
+        }
+        if(status[i].xHandle == idle){
+            idle_cpu += task->cpu;
+        }
+        if(task->stack_free < TASK_PROFILER_STACK_WARNING && (last < 0 || task->stack_free < last_stack[last])){
+            ESP_LOGW(TAG, "%s: %u bytes of stack left", task->name, task->stack_free);
+        }
+    }
+    report->cpu = (idle_cpu < 1000) ? 1000 - idle_cpu : 0;
+    report->heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    report->heap_min = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    report->heap_largest = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+
+    for(uint8_t i = 0; i < n; i++){
+        last_number[i] = status[i].xTaskNumber;
+        last_counter[i] = status[i].ulRunTimeCounter;
+        last_stack[i] = report->tasks[i].stack_free;
+    }
+    last_count = n;
+    last_total = total;
+    TaskProfilerSampleJobs(report);
+}
+
+static void TaskProfilerSend(const task_profiler_report_t *report){
+    summary_record_t summary = {
+        .heap_free = report->heap_free,
+        .heap_min = report->heap_min,
+        .heap_largest = report->heap_largest,
+        .cpu = report->cpu,
+        .n_tasks = report->n_tasks,
+    };
+    task_record_t task;
+    job_record_t job;
+
+    TelemetryPush(&profiler_ring, record_type, &summary, sizeof(summary));
+    for(uint8_t i = 0; i < report->n_tasks; i++){
+        memcpy(task.name, report->tasks[i].name, TASK_PROFILER_NAME_LENGTH);
+        task.cpu = report->tasks[i].cpu;
+        task.stack_free = report->tasks[i].stack_free;
+        task.priority = report->tasks[i].priority;
+        task.number = report->tasks[i].number;
+        TelemetryPush(&profiler_ring, record_type + 1, &task, sizeof(task));
+    }
+    for(uint8_t i = 0; i < report->n_jobs; i++){
+        memset(job.name, 0, JOB_NAME_LENGTH);
+        strncpy(job.name, report->jobs[i].name, JOB_NAME_LENGTH);
+        job.activations = report->jobs[i].stats.activations;
+        job.late = report->jobs[i].stats.late;
+        job.missed = report->jobs[i].stats.missed;
+        job.max_us = report->jobs[i].stats.max_us;
+        job.mean_us = report->jobs[i].stats.mean_us;
+        TelemetryPush(&profiler_ring, record_type + 2, &job, sizeof(job));
+    }
+}
+
+static void TaskProfilerTask(void *pvParameter){
+    TickType_t wake = xTaskGetTickCount();
+
+    while(true){
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(period));
+        memset(&work, 0, sizeof(work));
+        TaskProfilerSample(&work);
+        if(work.n_tasks == 0){
+            continue;
+        }
+        SeqlockWrite(&last_report, &work);
+        reported = true;
+        TaskProfilerSend(&work);
+    }
+}
+/*==================[external functions definition]==========================*/
+bool TaskProfilerInit(uint32_t period_ms, uint8_t type, uint8_t priority){
+    if(profiler_task != NULL || period_ms == 0 || !TelemetryAddSource(&profiler_ring)){
+        return false;
+    }
+    period = period_ms;
+    record_type = type;
+    // counters from boot, so the first report is the load since then
+    return xTaskCreate(TaskProfilerTask, "TaskProfiler", PROFILER_STACK, NULL, priority, &profiler_task) == pdPASS;
+}
+
+bool TaskProfilerGetReport(task_profiler_report_t *report){
+    if(!reported){
+        return false;
+    }
+    SeqlockRead(&last_report, report);
+    return true;
+}
+
+void TaskProfilerPrint(void){
+    rt_schedule_summary_t schedule;
+
+    if(!TaskProfilerGetReport(&printed)){
+        return;
+    }
+    printf("Task              CPU%%  Free stack  Priority  Estimate%%\r\n");
+    for(uint8_t i = 0; i < printed.n_tasks; i++){
+        printf("%-16s %3u.%u %11u %9u", printed.tasks[i].name, printed.tasks[i].cpu / 10,
+               printed.tasks[i].cpu % 10, printed.tasks[i].stack_free, printed.tasks[i].priority);
+        if(printed.tasks[i].budget > 0){
+            printf(" %8u.%u", printed.tasks[i].budget / 10, printed.tasks[i].budget % 10);
+        }
+        printf("\r\n");
+    }
+    printf("CPU %u.%u%%, free heap %lu (minimum %lu, largest block %lu)\r\n", printed.cpu / 10, printed.cpu % 10,
+           printed.heap_free, printed.heap_min, printed.heap_largest);
+    if(RtScheduleGetSummary(&schedule)){
+        printf("Schedule: estimated utilization %u.%u%% (bound %u.%u%%), %u deadlines at risk\r\n",
+               schedule.utilization / 10, schedule.utilization % 10, schedule.bound / 10, schedule.bound % 10,
+               schedule.misses);
+    }
+    for(uint8_t i = 0; i < printed.n_jobs; i++){
+        const period_stats_t *stats = &printed.jobs[i].stats;
+        printf("%-16s period %lu us (%lu..%lu, nominal %lu), %lu late, %lu missed\r\n", printed.jobs[i].name,
+               stats->mean_us, stats->min_us, stats->max_us, printed.jobs[i].period_us, stats->late, stats->missed);
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,696 @@
+/**
+ * @file telemetry.c
+ * @brief Binary telemetry sink over UART, USB or BLE (COBS framing, sequence numbers and CRC)
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "telemetry.h"
+#include "uart_mcu.h"
+#include "usb_serial_mcu.h"
+#include "ble_mcu.h"
+#if CONFIG_DRIVERS_WIFI
+#include "wifi_mcu.h"
+#endif
+#if CONFIG_DRIVERS_ESPNOW
+#include "espnow_mcu.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define FRAME_RAW_MAX       (2 + 1 + TELEMETRY_PAYLOAD_MAX + 2)     /*!< seq, type, payload, crc */
+#define FRAME_ENCODED_MAX   (FRAME_RAW_MAX + FRAME_RAW_MAX / 254 + 2) /*!< COBS overhead and delimiter */
+#define UART_BATCH_SIZE     256     /*!< Bytes written to the UART at once */
+#define USB_BATCH_SIZE      2048    /*!< Bytes written to the USB at once (one TX ring write) */
+#define BLE_BATCH_MAX       244     /*!< Largest notification of ble_mcu */
+#define DRAIN_PERIOD_MS     20      /*!< Maximum time a record waits in its ring */
+#define UDP_XOR_TYPES       8       /*!< Record types of a datagram with a XOR reference (the first ones) */
+#define ESPNOW_DATA         'E'     /*!< First byte of an ESP-NOW frame of records */
+#define ESPNOW_ACK          'A'     /*!< First byte of an ESP-NOW acknowledgement */
+#define ESPNOW_ACK_LENGTH   13      /*!< 'A', sender mac, newest seq, bitmap */
+#define ESPNOW_ACK_BITS     32      /*!< Frames before the newest covered by an acknowledgement */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static telemetry_link_t sink_link;
+static spsc_ring_t *sources[TELEMETRY_MAX_SOURCES];
+static uint8_t sources_count = 0;
+static TaskHandle_t drain_task = NULL;
+static uint16_t sequence = 0;
+static telemetry_stats_t stats;
+static uint8_t stream_batch[USB_BATCH_SIZE];
+static uint8_t *batch = NULL;           /*!< Batch being filled (stream_batch or a BLE buffer) */
+static uint16_t batch_capacity = 0;
+static uint16_t batch_length = 0;
+#if CONFIG_DRIVERS_WIFI
+static uint32_t udp_period_ms = 0;
+static TickType_t udp_sent_tick = 0;
+static uint8_t udp_mac[6];
+static uint16_t udp_sequence = 0;
+static uint8_t udp_raw[TELEMETRY_UDP_RAW_MAX];      /*!< Raw body of the datagram being filled */
+static uint16_t udp_raw_length = 0;
+static uint8_t udp_records = 0;
+static uint8_t udp_datagram[TELEMETRY_UDP_HEADER + TELEMETRY_UDP_RAW_MAX];
+static telemetry_record_t udp_last[UDP_XOR_TYPES];  /*!< Last record of each type of the datagram (XOR reference) */
+static uint8_t udp_last_count = 0;
+#endif
+#if CONFIG_DRIVERS_ESPNOW
+/** Frame kept until the receiver acknowledges it */
+typedef struct {
+    bool waiting;               /*!< Sent and not acknowledged yet */
+    bool retried;               /*!< Already sent again */
+    uint16_t seq;
+    uint8_t records;
+    uint8_t length;
+    uint8_t data[ESPNOW_FRAME_MAX];
+} espnow_sent_t;
+/** Board sending records to TelemetryEspNowListen */
+typedef struct {
+    uint8_t mac[6];
+    uint16_t newest;            /*!< Newest frame received */
+    uint32_t bitmap;            /*!< Bit i: frame newest - 1 - i received */
+    uint8_t since_ack;          /*!< Frames received since the last acknowledgement */
+} espnow_sender_t;
+static bool espnow_started = false;
+static uint8_t espnow_mac[6];                       /*!< Address of this board */
+static const uint8_t *espnow_peer = ESPNOW_BROADCAST;
+static uint8_t espnow_peer_mac[6];
+static uint8_t espnow_ack_batch = 0;
+static uint16_t espnow_sequence = 0;
+static uint8_t espnow_frame[ESPNOW_FRAME_MAX];      /*!< Frame being filled */
+static uint8_t espnow_length = TELEMETRY_ESPNOW_HEADER;
+static uint8_t espnow_records = 0;
+static espnow_sent_t espnow_window[TELEMETRY_ESPNOW_WINDOW];
+static portMUX_TYPE espnow_ack_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool espnow_ack_pending = false;             /*!< Acknowledgement received, handled by the drain task */
+static uint16_t espnow_ack_newest;
+static uint32_t espnow_ack_bitmap;
+static telemetry_record_func espnow_listen_p = NULL;
+static espnow_sender_t espnow_senders[TELEMETRY_ESPNOW_SENDERS];
+static uint8_t espnow_senders_count = 0;
+#endif
+
+/** CRC-16/CCITT-FALSE, one nibble at a time */
+static const uint16_t crc_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t Crc16(const uint8_t *data, uint16_t length){
+    uint16_t crc = 0xFFFF;
+    for(uint16_t i = 0; i < length; i++){
+        crc = (crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    return crc;
+}
+
+/**
+ * @brief COBS encoding of src, followed by the 0x00 delimiter
+ * @return Bytes written in dst
+ */
+static uint16_t CobsEncode(const uint8_t *src, uint16_t length, uint8_t *dst){
+    uint16_t code_pos = 0, out = 1;
+    uint8_t code = 1;
+    for(uint16_t i = 0; i < length; i++){
+        if(src[i] == 0){
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        }else{
+            dst[out++] = src[i];
+            if(++code == 0xFF){
+                dst[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+    dst[code_pos] = code;
+    dst[out++] = 0x00;
+    return out;
+}
+
+/**
+ * @brief Builds the encoded frame of a record
+ * @return Frame length
+ */
+static uint16_t TelemetryFrame(const telemetry_record_t *record, uint8_t *dst){
+    uint8_t raw[FRAME_RAW_MAX];
+    uint16_t length = 0, crc;
+    raw[length++] = sequence & 0xFF;
+    raw[length++] = sequence >> 8;
+    raw[length++] = record->type;
+    memcpy(&raw[length], record->payload, record->length);
+    length += record->length;
+    crc = Crc16(raw, length);
+    raw[length++] = crc & 0xFF;
+    raw[length++] = crc >> 8;
+    sequence++;
+    return CobsEncode(raw, length, dst);
+}
+
+/**
+ * @brief Where to write the next bytes of the link (a BLE transmission
+ * buffer is taken when the batch starts)
+ */
+static uint8_t *TelemetryBatchStart(uint16_t *capacity){
+    uint16_t mtu;
+    if(sink_link == TELEMETRY_USB){
+        *capacity = USB_BATCH_SIZE;
+        return UsbSerialConnected() ? stream_batch : NULL;
+    }
+    if(sink_link != TELEMETRY_BLE){
+        *capacity = UART_BATCH_SIZE;
+        return stream_batch;
+    }
+    mtu = BleGetMtu() - 3;
+    *capacity = (mtu < BLE_BATCH_MAX) ? mtu : BLE_BATCH_MAX;
+    return BleTxBufferGet();
+}
+
+static void TelemetryBatchSend(void){
+    uint16_t written = batch_length;
+    uint16_t lost = 0;
+
+    switch(sink_link){
+        case TELEMETRY_BLE:
+            BleTxBufferSend(batch, batch_length);
+            break;
+        case TELEMETRY_UART_PC:
+            UartStreamWrite(UART_PC, batch, batch_length);
+            break;
+        case TELEMETRY_UART_CONNECTOR:
+            UartStreamWrite(UART_CONNECTOR, batch, batch_length);
+            break;
+        case TELEMETRY_USB:
+            if(UsbSerialWrite(batch, batch_length) == 0){
+                // the host doesn't read: the frames that end in the batch (delimiter) are lost
+                written = 0;
+                for(uint16_t i = 0; i < batch_length; i++){
+                    lost += (batch[i] == 0x00);
+                }
+                stats.frames -= lost;
+                stats.dropped_link += lost;
+            }
+            break;
+        default:
+            break;
+    }
+    stats.bytes += written;
+    batch = NULL;
+    batch_length = 0;
+}
+
+/**
+ * @brief Appends a frame to the batch. The link is a byte stream: a frame
+ * may be split between two notifications (or UART or USB writes).
+ * @return false if the link is not available
+ */
+static bool TelemetryAppend(const uint8_t *frame, uint16_t length){
+    uint16_t n;
+    while(length > 0){
+        if(batch == NULL && (batch = TelemetryBatchStart(&batch_capacity)) == NULL){
+            return false;
+        }
+        n = batch_capacity - batch_length;
+        if(n > length){
+            n = length;
+        }
+        memcpy(&batch[batch_length], frame, n);
+        batch_length += n;
+        frame += n;
+        length -= n;
+        if(batch_length == batch_capacity){
+            TelemetryBatchSend();
+        }
+    }
+    return true;
+}
+
+#if CONFIG_DRIVERS_WIFI
+/**
+ * @brief Zero-run encoding: 0x00 n stands for n zero bytes (1 to 255), any
+ * other byte is itself
+ * @return Encoded length in dst, 0 if it is not shorter than the raw data
+ */
+static uint16_t ZeroRunEncode(const uint8_t *src, uint16_t length, uint8_t *dst){
+    uint16_t i = 0, out = 0;
+    uint8_t run;
+    while(i < length){
+        if(out + 2 > length){
+            return 0;
+        }
+        if(src[i] != 0){
+            dst[out++] = src[i++];
+            continue;
+        }
+        run = 0;
+        while(i < length && src[i] == 0 && run < 255){
+            run++;
+            i++;
+        }
+        dst[out++] = 0;
+        dst[out++] = run;
+    }
+    return out;
+}
+
+/**
+ * @brief Sends the datagram being filled (if it has records) and starts a new one
+ */
+static void TelemetryUdpSend(void){
+    uint8_t *header = udp_datagram;
+    uint32_t uptime_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    uint16_t length;
+
+    if(udp_records == 0){
+        return;
+    }
+    header[1] = TELEMETRY_UDP_ZRLE;
+    length = ZeroRunEncode(udp_raw, udp_raw_length, &udp_datagram[TELEMETRY_UDP_HEADER]);
+    if(length == 0){
+        header[1] = 0;
+        memcpy(&udp_datagram[TELEMETRY_UDP_HEADER], udp_raw, udp_raw_length);
+        length = udp_raw_length;
+    }
+    header[0] = 'T';
+    memcpy(&header[2], udp_mac, sizeof(udp_mac));
+    header[8] = udp_sequence & 0xFF;
+    header[9] = udp_sequence >> 8;
+    header[10] = udp_records;
+    for(uint8_t i = 0; i < 4; i++){
+        header[11 + i] = (uptime_ms >> (8 * i)) & 0xFF;
+    }
+    header[15] = udp_raw_length & 0xFF;
+    header[16] = udp_raw_length >> 8;
+    length += TELEMETRY_UDP_HEADER;
+    if(WifiUdpSend(udp_datagram, length)){
+        stats.frames += udp_records;
+        stats.bytes += length;
+        stats.datagrams++;
+        stats.raw_bytes += udp_raw_length;
+    }else{
+        // Wi-Fi not connected: the records of the datagram are lost
+        stats.dropped_link += udp_records;
+    }
+    udp_sequence++;
+    udp_raw_length = 0;
+    udp_records = 0;
+    udp_last_count = 0;
+}
+
+/**
+ * @brief Appends a record to the datagram, its payload XORed with the previous
+ * record of the same type and length
+ */
+static void TelemetryUdpAppend(const telemetry_record_t *record){
+    telemetry_record_t *last = NULL;
+    uint8_t *dst;
+    uint8_t i;
+
+    if(udp_raw_length + 2 + record->length > TELEMETRY_UDP_RAW_MAX || udp_records == UINT8_MAX){
+        TelemetryUdpSend();
+    }
+    for(i = 0; i < udp_last_count; i++){
+        if(udp_last[i].type == record->type){
+            last = &udp_last[i];
+            break;
+        }
+    }
+    if(last == NULL && udp_last_count < UDP_XOR_TYPES){
+        last = &udp_last[udp_last_count++];
+        last->length = 0;
+    }
+    dst = &udp_raw[udp_raw_length];
+    dst[0] = record->type;
+    dst[1] = record->length;
+    for(i = 0; i < record->length; i++){
+        dst[2 + i] = record->payload[i];
+        if(last != NULL && last->length == record->length){
+            dst[2 + i] ^= last->payload[i];
+        }
+    }
+    if(last != NULL){
+        *last = *record;
+    }
+    udp_raw_length += 2 + record->length;
+    udp_records++;
+}
+#endif
+
+#if CONFIG_DRIVERS_ESPNOW
+/**
+ * @brief Sends the frame being filled (if it has records) and keeps it for
+ * retransmission when the receiver acknowledges
+ */
+static void TelemetryEspNowSend(void){
+    espnow_sent_t *sent;
+
+    if(espnow_records == 0){
+        return;
+    }
+    espnow_frame[0] = ESPNOW_DATA;
+    espnow_frame[1] = espnow_ack_batch;
+    espnow_frame[2] = espnow_sequence & 0xFF;
+    espnow_frame[3] = espnow_sequence >> 8;
+    espnow_frame[4] = espnow_records;
+    if(EspNowSend(espnow_peer, espnow_frame, espnow_length)){
+        stats.frames += espnow_records;
+        stats.bytes += espnow_length;
+    }else{
+        // radio queue full: the records of the frame are lost
+        stats.dropped_link += espnow_records;
+    }
+    if(espnow_ack_batch > 0){
+        sent = &espnow_window[espnow_sequence % TELEMETRY_ESPNOW_WINDOW];
+        if(sent->waiting){
+            stats.unacked += sent->records;
+        }
+        sent->waiting = true;
+        sent->retried = false;
+        sent->seq = espnow_sequence;
+        sent->records = espnow_records;
+        sent->length = espnow_length;
+        memcpy(sent->data, espnow_frame, espnow_length);
+    }
+    espnow_sequence++;
+    espnow_length = TELEMETRY_ESPNOW_HEADER;
+    espnow_records = 0;
+}
+
+static void TelemetryEspNowAppend(const telemetry_record_t *record){
+    if(espnow_length + 2 + record->length > ESPNOW_FRAME_MAX || espnow_records == UINT8_MAX){
+        TelemetryEspNowSend();
+    }
+    espnow_frame[espnow_length++] = record->type;
+    espnow_frame[espnow_length++] = record->length;
+    memcpy(&espnow_frame[espnow_length], record->payload, record->length);
+    espnow_length += record->length;
+    espnow_records++;
+}
+
+/**
+ * @brief Marks the frames acknowledged by the receiver and sends once more
+ * the ones it reported missing
+ */
+static void TelemetryEspNowAcked(void){
+    uint16_t newest, distance;
+    uint32_t bitmap;
+    bool pending;
+
+    taskENTER_CRITICAL(&espnow_ack_lock);
+    pending = espnow_ack_pending;
+    newest = espnow_ack_newest;
+    bitmap = espnow_ack_bitmap;
+    espnow_ack_pending = false;
+    taskEXIT_CRITICAL(&espnow_ack_lock);
+    if(!pending){
+        return;
+    }
+    for(uint8_t i = 0; i < TELEMETRY_ESPNOW_WINDOW; i++){
+        espnow_sent_t *sent = &espnow_window[i];
+        distance = newest - sent->seq;
+        if(!sent->waiting || distance > ESPNOW_ACK_BITS){
+            continue;   // newer than the acknowledgement
+        }
+        if(distance == 0 || (bitmap & (1UL << (distance - 1)))){
+            sent->waiting = false;
+        }else if(!sent->retried){
+            sent->retried = true;
+            if(EspNowSend(espnow_peer, sent->data, sent->length)){
+                stats.retransmissions++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Frame of records from another board: duplicates are discarded, the
+ * records delivered and the sender acknowledged every ack batch frames
+ */
+static void TelemetryEspNowData(const uint8_t *mac, const uint8_t *data, uint8_t length){
+    espnow_sender_t *sender = NULL;
+    telemetry_record_t record;
+    uint16_t seq = data[2] | (data[3] << 8), distance;
+    uint8_t ack[ESPNOW_ACK_LENGTH], i, n;
+
+    for(i = 0; i < espnow_senders_count; i++){
+        if(memcmp(espnow_senders[i].mac, mac, 6) == 0){
+            sender = &espnow_senders[i];
+            break;
+        }
+    }
+    if(sender == NULL && espnow_senders_count < TELEMETRY_ESPNOW_SENDERS){
+        sender = &espnow_senders[espnow_senders_count++];
+        memcpy(sender->mac, mac, 6);
+        sender->newest = seq - 1;
+        sender->bitmap = 0;
+        sender->since_ack = 0;
+    }
+    if(sender != NULL){
+        distance = seq - sender->newest;
+        if(distance == 0){
+            return;
+        }
+        if(distance < 0x8000){
+            // newer: the frames in between are missing (for now)
+            stats.gaps += distance - 1;
+            sender->bitmap = (distance > ESPNOW_ACK_BITS) ? 0 : (sender->bitmap << 1 | 1) << (distance - 1);
+            sender->newest = seq;
+        }else{
+            // older: a retransmission, if it is still missing
+            distance = sender->newest - seq;
+            if(distance > ESPNOW_ACK_BITS || (sender->bitmap & (1UL << (distance - 1)))){
+                return;
+            }
+            sender->bitmap |= 1UL << (distance - 1);
+            stats.gaps--;
+        }
+    }
+    for(i = 0, n = TELEMETRY_ESPNOW_HEADER; i < data[4] && n + 2 <= length; i++){
+        record.type = data[n];
+        record.length = data[n + 1];
+        if(record.length > TELEMETRY_PAYLOAD_MAX || n + 2 + record.length > length){
+            break;
+        }
+        memcpy(record.payload, &data[n + 2], record.length);
+        n += 2 + record.length;
+        stats.received++;
+        espnow_listen_p(mac, &record);
+    }
+    if(sender != NULL && data[1] > 0 && ++sender->since_ack >= data[1]){
+        sender->since_ack = 0;
+        ack[0] = ESPNOW_ACK;
+        memcpy(&ack[1], mac, 6);
+        ack[7] = sender->newest & 0xFF;
+        ack[8] = sender->newest >> 8;
+        for(i = 0; i < 4; i++){
+            ack[9 + i] = (sender->bitmap >> (8 * i)) & 0xFF;
+        }
+        EspNowSend(ESPNOW_BROADCAST, ack, sizeof(ack));
+    }
+}
+
+/**
+ * @brief Frame of records (Wi-Fi task), for TelemetryEspNowListen
+ */
+static void TelemetryEspNowReadData(const uint8_t *mac, const uint8_t *data, uint8_t length){
+    if(length >= TELEMETRY_ESPNOW_HEADER && espnow_listen_p != NULL){
+        TelemetryEspNowData(mac, data, length);
+    }
+}
+
+/**
+ * @brief Acknowledgement (Wi-Fi task): handed to the drain task if it is for
+ * this board's sink
+ */
+static void TelemetryEspNowReadAck(const uint8_t *mac, const uint8_t *data, uint8_t length){
+    if(length == ESPNOW_ACK_LENGTH && memcmp(&data[1], espnow_mac, 6) == 0 &&
+       sink_link == TELEMETRY_ESPNOW && drain_task != NULL){
+        taskENTER_CRITICAL(&espnow_ack_lock);
+        espnow_ack_newest = data[7] | (data[8] << 8);
+        espnow_ack_bitmap = data[9] | (data[10] << 8) | ((uint32_t)data[11] << 16) | ((uint32_t)data[12] << 24);
+        espnow_ack_pending = true;
+        taskEXIT_CRITICAL(&espnow_ack_lock);
+        xTaskNotifyGive(drain_task);
+    }
+}
+
+/**
+ * @brief ESP-NOW start, shared with other modules (e.g. time_sync): the sink
+ * only takes the frames that start with ESPNOW_DATA and ESPNOW_ACK
+ */
+static bool TelemetryEspNowStart(uint8_t channel){
+    espnow_config_t config = {
+        .channel = channel,
+        .func_p = ESPNOW_NO_INT,
+    };
+    if(!espnow_started){
+        espnow_started = EspNowAddHandler(ESPNOW_DATA, TelemetryEspNowReadData) &&
+                         EspNowAddHandler(ESPNOW_ACK, TelemetryEspNowReadAck) &&
+                         EspNowInit(&config);
+        EspNowGetMac(espnow_mac);
+    }
+    return espnow_started;
+}
+#endif
+
+/**
+ * @brief Drain task: wakes up when a ring is half full or every DRAIN_PERIOD_MS,
+ * and empties the rings in turns, one record of each source at a time
+ */
+static void TelemetryDrainTask(void *pvParameter){
+    telemetry_record_t record;
+    uint8_t frame[FRAME_ENCODED_MAX];
+    bool pending;
+
+    while(true){
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DRAIN_PERIOD_MS));
+        do{
+            pending = false;
+            for(uint8_t i = 0; i < __atomic_load_n(&sources_count, __ATOMIC_ACQUIRE); i++){
+                if(!SpscRingPop(sources[i], &record)){
+                    continue;
+                }
+                pending = true;
+#if CONFIG_DRIVERS_WIFI
+                if(sink_link == TELEMETRY_UDP){
+                    TelemetryUdpAppend(&record);
+                    continue;
+                }
+#endif
+#if CONFIG_DRIVERS_ESPNOW
+                if(sink_link == TELEMETRY_ESPNOW){
+                    TelemetryEspNowAppend(&record);
+                    continue;
+                }
+#endif
+                if(TelemetryAppend(frame, TelemetryFrame(&record, frame))){
+                    stats.frames++;
+                }else{
+                    // BLE or USB not connected, BLE congested: the record is lost
+                    stats.dropped_link++;
+                }
+            }
+        }while(pending);
+#if CONFIG_DRIVERS_WIFI
+        if(sink_link == TELEMETRY_UDP){
+            if(xTaskGetTickCount() - udp_sent_tick >= pdMS_TO_TICKS(udp_period_ms)){
+                TelemetryUdpSend();
+                udp_sent_tick = xTaskGetTickCount();
+            }
+            continue;
+        }
+#endif
+#if CONFIG_DRIVERS_ESPNOW
+        if(sink_link == TELEMETRY_ESPNOW){
+            // no waiting for more records: latency first
+            TelemetryEspNowSend();
+            TelemetryEspNowAcked();
+            continue;
+        }
+#endif
+        if(batch_length > 0){
+            TelemetryBatchSend();
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+bool TelemetryInit(telemetry_link_t link, uint8_t priority){
+    if(drain_task != NULL || link == TELEMETRY_UDP || link == TELEMETRY_ESPNOW){
+        return false;
+    }
+    sink_link = link;
+    return xTaskCreate(TelemetryDrainTask, "Telemetry", 2048, NULL, priority, &drain_task) == pdPASS;
+}
+
+bool TelemetryInitUdp(const telemetry_udp_config_t *config, uint8_t priority){
+#if CONFIG_DRIVERS_WIFI
+    if(drain_task != NULL || !WifiUdpOpen(config->host, config->port)){
+        return false;
+    }
+    WifiGetMac(udp_mac);
+    udp_period_ms = config->period_ms;
+    udp_sent_tick = xTaskGetTickCount();
+    sink_link = TELEMETRY_UDP;
+    return xTaskCreate(TelemetryDrainTask, "Telemetry", 2048, NULL, priority, &drain_task) == pdPASS;
+#else
+    return false;
+#endif
+}
+
+bool TelemetryInitEspNow(const telemetry_espnow_config_t *config, uint8_t priority){
+#if CONFIG_DRIVERS_ESPNOW
+    if(drain_task != NULL || config->ack_batch > TELEMETRY_ESPNOW_WINDOW || !TelemetryEspNowStart(config->channel)){
+        return false;
+    }
+    if(config->peer != NULL){
+        memcpy(espnow_peer_mac, config->peer, sizeof(espnow_peer_mac));
+        if(!EspNowAddPeer(espnow_peer_mac)){
+            return false;
+        }
+        espnow_peer = espnow_peer_mac;
+    }
+    espnow_ack_batch = config->ack_batch;
+    sink_link = TELEMETRY_ESPNOW;
+    return xTaskCreate(TelemetryDrainTask, "Telemetry", 2048, NULL, priority, &drain_task) == pdPASS;
+#else
+    return false;
+#endif
+}
+
+bool TelemetryEspNowListen(uint8_t channel, telemetry_record_func func_p){
+#if CONFIG_DRIVERS_ESPNOW
+    espnow_listen_p = func_p;
+    return TelemetryEspNowStart(channel);
+#else
+    return false;
+#endif
+}
+
+bool TelemetryAddSource(spsc_ring_t *ring){
+    if(sources_count == TELEMETRY_MAX_SOURCES){
+        return false;
+    }
+    sources[sources_count] = ring;
+    // published after the slot is written: the drain task may be reading sources_count
+    __atomic_store_n(&sources_count, sources_count + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool TelemetryPush(spsc_ring_t *ring, uint8_t type, const void *payload, uint8_t length){
+    telemetry_record_t record;
+    if(length > TELEMETRY_PAYLOAD_MAX){
+        return false;
+    }
+    record.type = type;
+    record.length = length;
+    memcpy(record.payload, payload, length);
+    if(!SpscRingPush(ring, &record)){
+        return false;
+    }
+    // ESP-NOW: every record wakes the drain task, the link is there for latency
+    if(drain_task != NULL && (sink_link == TELEMETRY_ESPNOW || SpscRingCount(ring) >= (ring->mask + 1) / 2)){
+        xTaskNotifyGive(drain_task);
+    }
+    return true;
+}
+
+void TelemetryGetStats(telemetry_stats_t *stats_out){
+    *stats_out = stats;
+    stats_out->dropped_queue = 0;
+    for(uint8_t i = 0; i < sources_count; i++){
+        stats_out->dropped_queue += SpscRingDropped(sources[i]);
+    }
+}
+
+/*==================[end of file]============================================*/
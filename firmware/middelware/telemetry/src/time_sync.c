@@ -0,0 +1,245 @@
+/**
+ * @file time_sync.c
+ * @brief Two-way timestamp exchange over ESP-NOW, offset and drift estimation
+ * @version 0.1
+ * @date 2026-10-15
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "timestamp_mcu.h"
+#include "time_sync.h"
+#if CONFIG_DRIVERS_ESPNOW
+#include "espnow_mcu.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define SYNC_REQUEST            'S'     /*!< First byte of a request */
+#define SYNC_REPLY              'R'     /*!< First byte of a reply */
+#define SYNC_REQUEST_LENGTH     10
+#define SYNC_REPLY_LENGTH       32
+#define SYNC_MIN_SAMPLES        4       /*!< Exchanges needed for a drift estimate */
+#define SYNC_MIN_SPAN_US        3000000 /*!< Shortest time spanned by them */
+/*==================[internal data declaration]==============================*/
+/** One exchange, t1..t4 reduced to offset and delay */
+typedef struct {
+    int64_t local_us;           /*!< Local time in the middle of the exchange */
+    int64_t offset_us;
+    uint32_t delay_us;
+} sync_sample_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+#if CONFIG_DRIVERS_ESPNOW
+static bool started = false;
+static uint8_t own_mac[6];
+static const uint8_t *master = ESPNOW_BROADCAST;
+static uint8_t master_mac[6];
+static uint16_t period_ms;
+static TaskHandle_t client_task = NULL;
+static portMUX_TYPE reply_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint8_t request_seq = 0;        /*!< Request waiting for its reply */
+static bool reply_ready = false;
+static int64_t reply_t[4];                      /*!< t1..t4 of the reply */
+static sync_sample_t samples[TIME_SYNC_SAMPLES];
+static uint8_t samples_count = 0;
+static uint8_t samples_next = 0;
+#endif
+static time_sync_stats_t stats;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+#if CONFIG_DRIVERS_ESPNOW
+static void PutInt64(uint8_t *data, int64_t value){
+    for(uint8_t i = 0; i < 8; i++){
+        data[i] = ((uint64_t)value >> (8 * i)) & 0xFF;
+    }
+}
+
+static int64_t GetInt64(const uint8_t *data){
+    uint64_t value = 0;
+    for(uint8_t i = 0; i < 8; i++){
+        value |= (uint64_t)data[i] << (8 * i);
+    }
+    return (int64_t)value;
+}
+
+/**
+ * @brief Master (Wi-Fi task): answers a request with the sync time at which
+ * it was received and at which the reply is sent
+ */
+static void TimeSyncRequest(const uint8_t *mac, const uint8_t *data, uint8_t length){
+    int64_t t2 = TimestampSyncUs();
+    uint8_t reply[SYNC_REPLY_LENGTH];
+
+    if(length != SYNC_REQUEST_LENGTH){
+        return;
+    }
+    reply[0] = SYNC_REPLY;
+    memcpy(&reply[1], mac, 6);
+    memcpy(&reply[7], &data[1], 9);             // seq and t1, echoed
+    PutInt64(&reply[16], t2);
+    PutInt64(&reply[24], TimestampSyncUs());
+    EspNowSend(ESPNOW_BROADCAST, reply, sizeof(reply));
+}
+
+/**
+ * @brief Client (Wi-Fi task): the reply to the last request is handed to the
+ * client task
+ */
+static void TimeSyncReply(const uint8_t *mac, const uint8_t *data, uint8_t length){
+    int64_t t4 = TimestampUs();
+
+    if(length != SYNC_REPLY_LENGTH || memcmp(&data[1], own_mac, 6) != 0 || data[7] != request_seq){
+        return;
+    }
+    taskENTER_CRITICAL(&reply_lock);
+    reply_t[0] = GetInt64(&data[8]);
+    reply_t[1] = GetInt64(&data[16]);
+    reply_t[2] = GetInt64(&data[24]);
+    reply_t[3] = t4;
+    reply_ready = true;
+    taskEXIT_CRITICAL(&reply_lock);
+    xTaskNotifyGive(client_task);
+}
+
+/**
+ * @brief Least squares slope of the offsets of the samples with a delay up
+ * to max_delay, in ppb (false if they are too few or too close in time)
+ */
+static bool TimeSyncDrift(const sync_sample_t *ref, uint32_t max_delay, int32_t *drift_ppb){
+    float x[TIME_SYNC_SAMPLES], y[TIME_SYNC_SAMPLES];
+    float mx = 0.0f, my = 0.0f, sxx = 0.0f, sxy = 0.0f;
+    int64_t first = ref->local_us, last = ref->local_us;
+    uint8_t n = 0;
+
+    for(uint8_t i = 0; i < samples_count; i++){
+        if(samples[i].delay_us > max_delay){
+            continue;
+        }
+        // relative to the reference: small enough for a float
+        x[n] = (float)(samples[i].local_us - ref->local_us);
+        y[n] = (float)(samples[i].offset_us - ref->offset_us);
+        mx += x[n];
+        my += y[n];
+        first = (samples[i].local_us < first) ? samples[i].local_us : first;
+        last = (samples[i].local_us > last) ? samples[i].local_us : last;
+        n++;
+    }
+    if(n < SYNC_MIN_SAMPLES || last - first < SYNC_MIN_SPAN_US){
+        return false;
+    }
+    // centered: the sums of squares don't cancel out
+    mx /= n;
+    my /= n;
+    for(uint8_t i = 0; i < n; i++){
+        sxx += (x[i] - mx) * (x[i] - mx);
+        sxy += (x[i] - mx) * (y[i] - my);
+    }
+    *drift_ppb = (int32_t)(sxy / sxx * 1e9f);
+    return true;
+}
+
+/**
+ * @brief New exchange: the sync time follows the best one of the window
+ */
+static void TimeSyncUpdate(const int64_t *t){
+    sync_sample_t *best;
+    sync_sample_t *sample = &samples[samples_next];
+
+    sample->local_us = t[0] + (t[3] - t[0]) / 2;
+    sample->offset_us = ((t[1] - t[0]) + (t[2] - t[3])) / 2;
+    sample->delay_us = (uint32_t)((t[3] - t[0]) - (t[2] - t[1]));
+    samples_next = (samples_next + 1) % TIME_SYNC_SAMPLES;
+    if(samples_count < TIME_SYNC_SAMPLES){
+        samples_count++;
+    }
+    best = sample;
+    for(uint8_t i = 0; i < samples_count; i++){
+        if(samples[i].delay_us < best->delay_us){
+            best = &samples[i];
+        }
+    }
+    TimeSyncDrift(best, best->delay_us + TIME_SYNC_MARGIN_US, &stats.drift_ppb);
+    TimestampSyncAdjust(best->local_us, best->offset_us, stats.drift_ppb);
+    stats.offset_us = best->offset_us;
+    stats.delay_us = best->delay_us;
+    stats.exchanges++;
+    stats.synced = true;
+}
+
+/**
+ * @brief Client task: one exchange every period
+ */
+static void TimeSyncTask(void *pvParameter){
+    uint8_t request[SYNC_REQUEST_LENGTH];
+    int64_t t[4];
+    bool ready;
+
+    while(true){
+        request[0] = SYNC_REQUEST;
+        request[1] = request_seq + 1;
+        taskENTER_CRITICAL(&reply_lock);
+        reply_ready = false;
+        request_seq = request[1];
+        taskEXIT_CRITICAL(&reply_lock);
+        PutInt64(&request[2], TimestampUs());
+        ulTaskNotifyTake(pdTRUE, 0);
+        if(EspNowSend(master, request, sizeof(request)) &&
+           ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(TIME_SYNC_TIMEOUT_MS)) > 0){
+            taskENTER_CRITICAL(&reply_lock);
+            ready = reply_ready;
+            memcpy(t, reply_t, sizeof(t));
+            taskEXIT_CRITICAL(&reply_lock);
+            if(ready){
+                TimeSyncUpdate(t);
+            }
+        }else{
+            stats.lost++;
+        }
+        vTaskDelay(pdMS_TO_TICKS(period_ms));
+    }
+}
+#endif
+/*==================[external functions definition]==========================*/
+bool TimeSyncInit(const time_sync_config_t *config, uint8_t priority){
+#if CONFIG_DRIVERS_ESPNOW
+    espnow_config_t espnow = {
+        .channel = config->channel,
+        .func_p = ESPNOW_NO_INT,
+    };
+
+    if(started){
+        return false;
+    }
+    if(config->role == TIME_SYNC_MASTER){
+        started = EspNowAddHandler(SYNC_REQUEST, TimeSyncRequest) && EspNowInit(&espnow);
+        return started;
+    }
+    if(!EspNowAddHandler(SYNC_REPLY, TimeSyncReply) || !EspNowInit(&espnow)){
+        return false;
+    }
+    EspNowGetMac(own_mac);
+    if(config->master != NULL){
+        memcpy(master_mac, config->master, sizeof(master_mac));
+        if(!EspNowAddPeer(master_mac)){
+            return false;
+        }
+        master = master_mac;
+    }
+    period_ms = config->period_ms;
+    started = true;
+    return xTaskCreate(TimeSyncTask, "TimeSync", 2048, NULL, priority, &client_task) == pdPASS;
+#else
+    return false;
+#endif
+}
+
+void TimeSyncGetStats(time_sync_stats_t *stats_out){
+    *stats_out = stats;
+}
+
+/*==================[end of file]============================================*/
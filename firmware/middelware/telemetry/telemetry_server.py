@@ -0,0 +1,155 @@
+# -*- coding: utf-8 -*-
+"""
+Created on Thu Oct 15 22:00:00 2026
+
+@author: Albano Peñalva
+
+Servidor de telemetría para muchos equipos: recibe los datagramas UDP del
+sumidero de telemetría (telemetry.h, enlace TELEMETRY_UDP) y separa los
+registros de cada equipo por su dirección MAC. Cada datagrama (little endian):
+
+    'T' (1)         marca
+    flags (1)       bit 0: cuerpo codificado por corridas de ceros
+    mac (6)         dirección MAC del equipo
+    seq (2)         número de datagrama del equipo (un salto indica pérdida)
+    registros (1)   cantidad de registros del cuerpo
+    uptime (4)      ms desde el arranque del equipo al enviarlo
+    largo (2)       largo del cuerpo sin codificar
+    cuerpo          registros: tipo (1), largo (1) y datos, cada uno XOR con
+                    el anterior del mismo tipo y largo del datagrama (sólo los
+                    primeros 8 tipos del datagrama tienen referencia). Con la
+                    codificación, 0x00 n representa n bytes en cero.
+
+Uso:
+    python telemetry_server.py --puerto 5005                 (escucha en UDP)
+    python telemetry_server.py captura.txt                   (un datagrama por línea, en hexadecimal)
+
+Imprime un registro por línea ("mac,uptime_ms,tipo,datos en hexadecimal") y,
+al terminar (Ctrl+C), los datagramas recibidos y perdidos y la compresión de
+cada equipo.
+"""
+
+# Librerías
+import argparse
+import socket
+import struct
+import sys
+
+CABECERA = 17
+ZRLE = 0x01
+TIPOS_XOR = 8
+
+
+def decodificar_ceros(datos):
+    salida = bytearray()
+    i = 0
+    while i < len(datos):
+        if datos[i] == 0:
+            salida += bytes(datos[i + 1])
+            i += 2
+        else:
+            salida.append(datos[i])
+            i += 1
+    return bytes(salida)
+
+
+def decodificar(datagrama):
+    """Devuelve (mac, seq, uptime_ms, registros, largo sin codificar) de un datagrama."""
+    marca, flags, mac, seq, cantidad, uptime, largo = struct.unpack_from('<cB6sHBIH', datagrama)
+    if marca != b'T':
+        raise ValueError('no es un datagrama de telemetría')
+    cuerpo = datagrama[CABECERA:]
+    if flags & ZRLE:
+        cuerpo = decodificar_ceros(cuerpo)
+    if len(cuerpo) != largo:
+        raise ValueError('largo inválido')
+    registros, anteriores = [], {}
+    i = 0
+    for _ in range(cantidad):
+        tipo, n = cuerpo[i], cuerpo[i + 1]
+        datos = bytearray(cuerpo[i + 2:i + 2 + n])
+        i += 2 + n
+        if tipo in anteriores:
+            anterior = anteriores[tipo]
+            if anterior is not None and len(anterior) == n:
+                datos = bytearray(a ^ b for a, b in zip(datos, anterior))
+            anteriores[tipo] = bytes(datos)
+        elif len(anteriores) < TIPOS_XOR:
+            anteriores[tipo] = bytes(datos)
+        registros.append((tipo, bytes(datos)))
+    return mac.hex(':'), seq, uptime, registros, largo
+
+
+class Equipo:
+    def __init__(self):
+        self.ultimo = None
+        self.datagramas = 0
+        self.perdidos = 0
+        self.bytes = 0
+        self.bytes_crudos = 0
+
+
+class Receptor:
+    """Acumula las estadísticas de cada equipo."""
+
+    def __init__(self):
+        self.equipos = {}
+        self.erroneos = 0
+
+    def recibir(self, datagrama):
+        try:
+            mac, seq, uptime, registros, largo = decodificar(datagrama)
+        except (ValueError, IndexError, struct.error):
+            self.erroneos += 1
+            return
+        equipo = self.equipos.setdefault(mac, Equipo())
+        if equipo.ultimo is not None:
+            self.perdidos_equipo(equipo, seq)
+        equipo.ultimo = seq
+        equipo.datagramas += 1
+        equipo.bytes += len(datagrama)
+        equipo.bytes_crudos += CABECERA + largo
+        for tipo, datos in registros:
+            print(f'{mac},{uptime},{tipo},{datos.hex()}')
+
+    @staticmethod
+    def perdidos_equipo(equipo, seq):
+        salto = (seq - equipo.ultimo - 1) & 0xFFFF
+        # un salto muy grande es un reinicio del equipo, no una pérdida
+        if salto < 0x8000:
+            equipo.perdidos += salto
+
+    def resumen(self):
+        for mac, equipo in sorted(self.equipos.items()):
+            compresion = equipo.bytes_crudos / equipo.bytes if equipo.bytes else 0
+            print(f'{mac}: {equipo.datagramas} datagramas, {equipo.perdidos} perdidos, '
+                  f'compresión {compresion:.2f}', file=sys.stderr)
+        if self.erroneos:
+            print(f'{self.erroneos} datagramas inválidos', file=sys.stderr)
+
+
+# %% Programa principal
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Servidor de telemetría UDP')
+    parser.add_argument('archivo', nargs='?', help='datagramas en hexadecimal, uno por línea (- para stdin)')
+    parser.add_argument('--puerto', type=int, help='puerto UDP donde escuchar')
+    args = parser.parse_args()
+
+    receptor = Receptor()
+    if args.puerto:
+        servidor = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        servidor.bind(('', args.puerto))
+        try:
+            while True:
+                datagrama, _ = servidor.recvfrom(2048)
+                receptor.recibir(datagrama)
+        except KeyboardInterrupt:
+            pass
+    elif args.archivo:
+        entrada = sys.stdin if args.archivo == '-' else open(args.archivo)
+        for linea in entrada:
+            if linea.strip():
+                receptor.recibir(bytes.fromhex(linea.strip()))
+    else:
+        parser.error('indicar un archivo o --puerto')
+    receptor.resumen()
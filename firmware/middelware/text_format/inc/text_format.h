@@ -0,0 +1,91 @@
+#ifndef TEXT_FORMAT_H_
+#define TEXT_FORMAT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Text_Format Text format
+ ** @{ */
+
+/** \brief Reentrant number to text conversion for text protocols
+ * 
+ * Every function writes into a buffer given by the caller, ends it with '\0'
+ * and returns the number of characters written (without the '\0'), so a
+ * message is built by advancing a pointer:
+ * 
+ *     char *p = msg;
+ *     p += FmtStr(p, "*G");
+ *     p += FmtFloat(p, value, 2);
+ *     p += FmtStr(p, "*");
+ * 
+ * Decimal integers are converted two digits at a time and floats in fixed
+ * point (integer part and scaled fraction), without newlib printf.
+ * 
+ * @note FmtFloat rounds to nearest at the requested number of decimals, like
+ * "%.Nf", except halfway cases (no exact binary to decimal conversion).
+ * Values whose integer part does not fit in 32 bits are written as "inf".
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 14/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+/*==================[macros]=================================================*/
+#define FMT_UINT_MAX_LEN    33      /*!< Buffer size for any FmtUint (32 binary digits + '\0') */
+#define FMT_INT_MAX_LEN     12      /*!< Buffer size for any FmtInt */
+#define FMT_DECIMALS_MAX    6       /*!< Maximum decimals of FmtFloat */
+#define FMT_FLOAT_MAX_LEN   (12 + FMT_DECIMALS_MAX)  /*!< Buffer size for any FmtFloat */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Write an unsigned integer
+ * 
+ * @param buf   Destination (at least FMT_UINT_MAX_LEN bytes for base 2)
+ * @param val   Number to be converted
+ * @param base  Base of the converted number (2 to 16, lower case digits)
+ * @return uint8_t Characters written
+ */
+uint8_t FmtUint(char *buf, uint32_t val, uint8_t base);
+
+/**
+ * @brief Write a signed decimal integer
+ * 
+ * @param buf   Destination (at least FMT_INT_MAX_LEN bytes)
+ * @param val   Number to be converted
+ * @return uint8_t Characters written
+ */
+uint8_t FmtInt(char *buf, int32_t val);
+
+/**
+ * @brief Write a float with a fixed number of decimals (like "%.Nf")
+ * 
+ * @param buf       Destination (at least FMT_FLOAT_MAX_LEN bytes)
+ * @param val       Number to be converted
+ * @param decimals  Digits after the decimal point (up to FMT_DECIMALS_MAX)
+ * @return uint8_t Characters written
+ */
+uint8_t FmtFloat(char *buf, float val, uint8_t decimals);
+
+/**
+ * @brief Copy a string (without the '\0' count, like the other functions)
+ * 
+ * @param buf   Destination
+ * @param str   String to be copied
+ * @return uint8_t Characters written
+ */
+uint8_t FmtStr(char *buf, const char *str);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TEXT_FORMAT_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,156 @@
+/**
+ * @file text_format.c
+ * @brief Reentrant number to text conversion for text protocols
+ * @version 0.1
+ * @date 2026-10-14
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "text_format.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** @brief "00" to "99", to convert two decimal digits per division */
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint32_t pow10[FMT_DECIMALS_MAX + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Number of decimal digits of val (at least 1)
+ */
+static uint8_t DecimalDigits(uint32_t val){
+    uint8_t n = 1;
+    while(val >= 10000){
+        val /= 10000;
+        n += 4;
+    }
+    if(val >= 1000) return n + 3;
+    if(val >= 100) return n + 2;
+    if(val >= 10) return n + 1;
+    return n;
+}
+
+/**
+ * @brief Write val in decimal using exactly len digits (leading zeros if needed)
+ */
+static void WriteDecimal(char *buf, uint32_t val, uint8_t len){
+    char *p = buf + len;
+    while(len >= 2){
+        uint32_t pair = (val % 100) * 2;
+        val /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+        len -= 2;
+    }
+    if(len){
+        *--p = '0' + (val % 10);
+    }
+}
+/*==================[external functions definition]==========================*/
+uint8_t FmtUint(char *buf, uint32_t val, uint8_t base){
+    uint8_t len;
+    if(base == 10){
+        len = DecimalDigits(val);
+        WriteDecimal(buf, val, len);
+    }else{
+        char tmp[32];
+        uint8_t i = 0;
+        if(base < 2 || base > 16){
+            base = 16;
+        }
+        if((base & (base - 1)) == 0){
+            // power of two: shifts instead of divisions
+            uint8_t shift = __builtin_ctz(base);
+            do{
+                tmp[i++] = "0123456789abcdef"[val & (base - 1)];
+                val >>= shift;
+            }while(val);
+        }else{
+            do{
+                tmp[i++] = "0123456789abcdef"[val % base];
+                val /= base;
+            }while(val);
+        }
+        for(len = 0; i; len++){
+            buf[len] = tmp[--i];
+        }
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+uint8_t FmtInt(char *buf, int32_t val){
+    if(val < 0){
+        *buf = '-';
+        // through uint32_t so INT32_MIN does not overflow
+        return 1 + FmtUint(buf + 1, 0u - (uint32_t)val, 10);
+    }
+    return FmtUint(buf, val, 10);
+}
+
+uint8_t FmtFloat(char *buf, float val, uint8_t decimals){
+    uint8_t len = 0;
+    uint32_t int_part, frac_part;
+
+    if(val != val){
+        return FmtStr(buf, "nan");
+    }
+    if(decimals > FMT_DECIMALS_MAX){
+        decimals = FMT_DECIMALS_MAX;
+    }
+    if(val < 0.0f){
+        buf[len++] = '-';
+        val = -val;
+    }
+    if(val >= 4294967040.0f){
+        // largest float below 2^32
+        return len + FmtStr(buf + len, "inf");
+    }
+    int_part = (uint32_t)val;
+    frac_part = (uint32_t)((val - (float)int_part) * (float)pow10[decimals] + 0.5f);
+    if(frac_part >= pow10[decimals]){
+        // rounding carried into the integer part (e.g. 1.999 with 2 decimals)
+        frac_part -= pow10[decimals];
+        if(int_part == UINT32_MAX){
+            return len + FmtStr(buf + len, "inf");
+        }
+        int_part++;
+    }
+    len += FmtUint(buf + len, int_part, 10);
+    if(decimals){
+        buf[len++] = '.';
+        WriteDecimal(buf + len, frac_part, decimals);
+        len += decimals;
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+uint8_t FmtStr(char *buf, const char *str){
+    uint8_t len = 0;
+    while(str[len]){
+        buf[len] = str[len];
+        len++;
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+/*==================[end of file]============================================*/